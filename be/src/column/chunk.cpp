@@ -78,8 +78,14 @@ Chunk::Chunk(Columns columns, const SlotHashMap& slot_map, const TupleHashMap& t
 
 void Chunk::reset() {
     for (ColumnPtr& c : _columns) {
-        c->reset_column();
+        if (_is_copy_on_write && c.use_count() > 1) {
+            // There is no need to copy the rows to be dropped.
+            c = c->clone_empty();
+        } else {
+            c->reset_column();
+        }
     }
+    _is_copy_on_write = false;
     _delete_state = DEL_NOT_SATISFIED;
 }
 
@@ -90,9 +96,11 @@ void Chunk::swap_chunk(Chunk& other) {
     _slot_id_to_index.swap(other._slot_id_to_index);
     _tuple_id_to_index.swap(other._tuple_id_to_index);
     std::swap(_delete_state, other._delete_state);
+    std::swap(_is_copy_on_write, other._is_copy_on_write);
 }
 
 void Chunk::set_num_rows(size_t count) {
+    _make_columns_unique();
     for (ColumnPtr& c : _columns) {
         c->resize(count);
     }
@@ -158,6 +166,22 @@ void Chunk::remove_columns_by_index(const std::vector<size_t>& indexes) {
     }
 }
 
+void Chunk::remove_column_by_slot_id(SlotId slot_id) {
+    auto iter = _slot_id_to_index.find(slot_id);
+    if (iter == _slot_id_to_index.end()) {
+        return;
+    }
+    size_t idx = iter->second;
+    _slot_id_to_index.erase(iter);
+    remove_column_by_index(idx);
+    for (auto& [id, index] : _slot_id_to_index) {
+        index -= index > idx;
+    }
+    for (auto& [id, index] : _tuple_id_to_index) {
+        index -= index > idx;
+    }
+}
+
 void Chunk::rebuild_cid_index() {
     _cid_to_index.clear();
     for (size_t i = 0; i < _schema->num_fields(); i++) {
@@ -227,8 +251,38 @@ std::unique_ptr<Chunk> Chunk::clone_unique() const {
     return chunk;
 }
 
+std::unique_ptr<Chunk> Chunk::clone_shallow() {
+    auto chunk = std::make_unique<Chunk>(_columns, _slot_id_to_index, _tuple_id_to_index);
+    chunk->_schema = _schema;
+    chunk->_cid_to_index = _cid_to_index;
+    chunk->_delete_state = _delete_state;
+    chunk->_is_copy_on_write = true;
+    _is_copy_on_write = true;
+    return chunk;
+}
+
+ColumnPtr& Chunk::make_column_unique(size_t idx) {
+    ColumnPtr& column = _columns[idx];
+    if (_is_copy_on_write && column.use_count() > 1) {
+        column = column->clone_shared();
+    }
+    return column;
+}
+
+void Chunk::_make_columns_unique() {
+    if (!_is_copy_on_write) {
+        return;
+    }
+    for (size_t i = 0; i < _columns.size(); i++) {
+        make_column_unique(i);
+    }
+    // No column is shared any more.
+    _is_copy_on_write = false;
+}
+
 void Chunk::append_selective(const Chunk& src, const uint32_t* indexes, uint32_t from, uint32_t size) {
     DCHECK_EQ(_columns.size(), src.columns().size());
+    _make_columns_unique();
     for (size_t i = 0; i < _columns.size(); ++i) {
         _columns[i]->append_selective(*src.columns()[i].get(), indexes, from, size);
     }
@@ -237,6 +291,7 @@ void Chunk::append_selective(const Chunk& src, const uint32_t* indexes, uint32_t
 void Chunk::rolling_append_selective(Chunk& src, const uint32_t* indexes, uint32_t from, uint32_t size) {
     size_t num_columns = _columns.size();
     DCHECK_EQ(num_columns, src.columns().size());
+    _make_columns_unique();
 
     for (size_t i = 0; i < num_columns; ++i) {
         _columns[i]->append_selective(*src.columns()[i].get(), indexes, from, size);
@@ -248,6 +303,7 @@ size_t Chunk::filter(const Buffer<uint8_t>& selection, bool force) {
     if (!force && SIMD::count_zero(selection) == 0) {
         return num_rows();
     }
+    _make_columns_unique();
     for (auto& column : _columns) {
         column->filter(selection);
     }
@@ -255,6 +311,7 @@ size_t Chunk::filter(const Buffer<uint8_t>& selection, bool force) {
 }
 
 size_t Chunk::filter_range(const Buffer<uint8_t>& selection, size_t from, size_t to) {
+    _make_columns_unique();
     for (auto& column : _columns) {
         column->filter_range(selection, from, to);
     }
@@ -374,6 +431,7 @@ void Chunk::merge(Chunk&& src) {
 
 void Chunk::append(const Chunk& src, size_t offset, size_t count) {
     DCHECK_EQ(num_columns(), src.num_columns());
+    _make_columns_unique();
     const size_t n = src.num_columns();
     for (size_t i = 0; i < n; i++) {
         ColumnPtr& c = get_column_by_index(i);
@@ -385,6 +443,7 @@ void Chunk::append_safe(const Chunk& src, size_t offset, size_t count) {
     DCHECK_EQ(num_columns(), src.num_columns());
     const size_t n = src.num_columns();
     size_t cur_rows = num_rows();
+    _make_columns_unique();
 
     for (size_t i = 0; i < n; i++) {
         ColumnPtr& c = get_column_by_index(i);
@@ -395,6 +454,7 @@ void Chunk::append_safe(const Chunk& src, size_t offset, size_t count) {
 }
 
 void Chunk::reserve(size_t cap) {
+    _make_columns_unique();
     for (auto& c : _columns) {
         c->reserve(cap);
     }
@@ -91,6 +91,9 @@ public:
     // |indexes| can be empty and no column will be removed in this case.
     void remove_columns_by_index(const std::vector<size_t>& indexes);
 
+    // Remove the column of |slot_id| if it exists, the indexes of the columns after it are updated.
+    void remove_column_by_slot_id(SlotId slot_id);
+
     // schema must exists.
     const ColumnPtr& get_column_by_name(const std::string& column_name) const;
     ColumnPtr& get_column_by_name(const std::string& column_name);
@@ -131,6 +134,17 @@ public:
     ChunkUniquePtr clone_empty_with_tuple(size_t size) const;
     ChunkUniquePtr clone_unique() const;
 
+    // Create a chunk sharing the columns of this chunk, without copying any data. The columns of both
+    // chunks are then copied on write: the mutations through the methods of a chunk, e.g. filter() or
+    // append(), first copy the columns it still shares, so neither chunk sees the mutations of the other.
+    // It is meant for the chunks handed to several consumers, e.g. by a broadcast exchange.
+    // NOTE: a column got by get_column_by_xxx() is not copied on write, call make_column_unique() before
+    // mutating it directly.
+    ChunkUniquePtr clone_shallow();
+
+    // Copy the |idx|-th column if it is shared with another chunk, and return it.
+    ColumnPtr& make_column_unique(size_t idx);
+
     void append(const Chunk& src) { append(src, 0, src.num_rows()); }
     void merge(Chunk&& src);
 
@@ -244,6 +258,9 @@ public:
 private:
     void rebuild_cid_index();
 
+    // Copy the columns shared with other chunks, see clone_shallow().
+    void _make_columns_unique();
+
     Columns _columns;
     std::shared_ptr<Schema> _schema;
     ColumnIdHashMap _cid_to_index;
@@ -251,6 +268,8 @@ private:
     SlotHashMap _slot_id_to_index;
     TupleHashMap _tuple_id_to_index;
     DelCondSatisfied _delete_state = DEL_NOT_SATISFIED;
+    // Whether some columns may be shared with a chunk created by clone_shallow().
+    bool _is_copy_on_write = false;
 };
 
 inline const ColumnPtr& Chunk::get_column_by_name(const std::string& column_name) const {
@@ -18,6 +18,25 @@ Status datum_from_string(TypeInfo* type_info, Datum* dst, const std::string& str
     return Status::OK();
 }
 
+static Status slice_datum_from_string(FieldType type, Datum* dst, const Slice& str, MemPool* mem_pool) {
+    /* Type need memory allocated */
+    Slice slice;
+    slice.size = str.size;
+    if (mem_pool == nullptr) {
+        slice.data = str.data;
+    } else {
+        slice.data = reinterpret_cast<char*>(mem_pool->allocate(slice.size));
+        RETURN_IF_UNLIKELY_NULL(slice.data, Status::MemoryAllocFailed("alloc mem for varchar field failed"));
+        memcpy(slice.data, str.data, slice.size);
+    }
+    // If type is OLAP_FIELD_TYPE_CHAR, strip its tailing '\0'
+    if (type == OLAP_FIELD_TYPE_CHAR) {
+        slice.size = strnlen(slice.data, slice.size);
+    }
+    dst->set_slice(slice);
+    return Status::OK();
+}
+
 Status datum_from_string(TypeInfo* type_info, Datum* dst, const std::string& str, MemPool* mem_pool) {
     const auto type = type_info->type();
     switch (type) {
@@ -39,24 +58,8 @@ Status datum_from_string(TypeInfo* type_info, Datum* dst, const std::string& str
     }
         /* Type need memory allocated */
     case OLAP_FIELD_TYPE_CHAR:
-    case OLAP_FIELD_TYPE_VARCHAR: {
-        /* Type need memory allocated */
-        Slice slice;
-        slice.size = str.size();
-        if (mem_pool == nullptr) {
-            slice.data = (char*)str.data();
-        } else {
-            slice.data = reinterpret_cast<char*>(mem_pool->allocate(slice.size));
-            RETURN_IF_UNLIKELY_NULL(slice.data, Status::MemoryAllocFailed("alloc mem for varchar field failed"));
-            memcpy(slice.data, str.data(), slice.size);
-        }
-        // If type is OLAP_FIELD_TYPE_CHAR, strip its tailing '\0'
-        if (type == OLAP_FIELD_TYPE_CHAR) {
-            slice.size = strnlen(slice.data, slice.size);
-        }
-        dst->set_slice(slice);
-        break;
-    }
+    case OLAP_FIELD_TYPE_VARCHAR:
+        return slice_datum_from_string(type, dst, Slice(str), mem_pool);
     default:
         return Status::NotSupported(Substitute("Type $0 not supported", type));
     }
@@ -64,6 +67,14 @@ Status datum_from_string(TypeInfo* type_info, Datum* dst, const std::string& str
     return Status::OK();
 }
 
+Status datum_from_string(TypeInfo* type_info, Datum* dst, const Slice& str, MemPool* mem_pool) {
+    const auto type = type_info->type();
+    if (type == OLAP_FIELD_TYPE_CHAR || type == OLAP_FIELD_TYPE_VARCHAR) {
+        return slice_datum_from_string(type, dst, str, mem_pool);
+    }
+    return datum_from_string(type_info, dst, str.to_string(), mem_pool);
+}
+
 template <FieldType TYPE>
 std::string datum_to_string(TypeInfo* type_info, const Datum& datum) {
     using CppType = typename CppTypeTraits<TYPE>::CppType;
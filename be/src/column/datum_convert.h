@@ -8,6 +8,8 @@ namespace starrocks::vectorized {
 
 Status datum_from_string(Datum* dst, FieldType type, const std::string& str, MemPool* mem_pool);
 Status datum_from_string(TypeInfo* type_info, Datum* dst, const std::string& str, MemPool* mem_pool);
+// The CHAR and VARCHAR datums point to |str| if |mem_pool| is null.
+Status datum_from_string(TypeInfo* type_info, Datum* dst, const Slice& str, MemPool* mem_pool);
 
 std::string datum_to_string(const Datum& datum, FieldType type);
 std::string datum_to_string(TypeInfo* type_info, const Datum& datum);
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 
 #include "column/column_hash.h"
 #include "util/phmap/phmap.h"
@@ -130,6 +131,63 @@ struct SliceKey16 {
     SliceKey16(SliceKey16&& x) noexcept { u.value = x.u.value; }
 };
 
+// A slice whose data of at most 15 bytes is kept inline, like SliceKey16, e.g. the serialized key of the fixed size
+// columns of a set operation, so that it neither has to be copied to a MemPool nor is compared and hashed byte
+// by byte. The last byte of an inline one is 0x80 | size, it's 0 otherwise since the size fits in 4 bytes.
+struct InlinableSlice {
+    static constexpr size_t max_inline_size = 15;
+
+    union U {
+        struct {
+            const uint8_t* data;
+            uint32_t size;
+        } __attribute__((packed)) ref;
+        struct {
+            uint8_t data[15];
+            uint8_t size;
+        } __attribute__((packed)) inlined;
+        uint64_t words[2];
+    } u;
+    static_assert(sizeof(u) == sizeof(u.words));
+
+    InlinableSlice(const uint8_t* data, size_t size) {
+        u.words[0] = 0;
+        u.words[1] = 0;
+        if (size <= max_inline_size) {
+            memcpy(u.inlined.data, data, size);
+            u.inlined.size = 0x80 | size;
+        } else {
+            u.ref.data = data;
+            u.ref.size = size;
+        }
+    }
+
+    bool is_inline() const { return u.inlined.size & 0x80; }
+    const uint8_t* data() const { return is_inline() ? u.inlined.data : u.ref.data; }
+    size_t size() const { return is_inline() ? u.inlined.size & 0x7f : u.ref.size; }
+    // The slice of an inline one points to this.
+    Slice slice() const { return {data(), size()}; }
+
+    bool operator==(const InlinableSlice& rhs) const {
+        // The second words are the sizes of the ones not inline, and the ends of the inline ones.
+        if (u.words[1] != rhs.u.words[1]) {
+            return false;
+        }
+        return is_inline() ? u.words[0] == rhs.u.words[0]
+                           : memequal(u.ref.data, u.ref.size, rhs.u.ref.data, rhs.u.ref.size);
+    }
+
+    size_t hash(uint32_t seed) const {
+        if (is_inline()) {
+            uint64_t hash = seed;
+            hash_combine(hash, u.words[0]);
+            hash_combine(hash, u.words[1]);
+            return phmap_mix<sizeof(size_t)>()(hash);
+        }
+        return crc_hash_64(u.ref.data, u.ref.size, seed);
+    }
+};
+
 template <typename SliceKey, PhmapSeed seed>
 class FixedSizeSliceKeyHash {
 public:
@@ -190,7 +190,10 @@ Status NullableColumn::update_rows(const Column& src, const uint32_t* indexes) {
 size_t NullableColumn::filter_range(const Column::Filter& filter, size_t from, size_t to) {
     auto s1 = _data_column->filter_range(filter, from, to);
     auto s2 = _null_column->filter_range(filter, from, to);
-    update_has_null();
+    // Filtering out rows never brings in null.
+    if (_has_null) {
+        update_has_null();
+    }
     DCHECK_EQ(s1, s2);
     return s1;
 }
@@ -237,6 +240,13 @@ uint32_t NullableColumn::serialize_default(uint8_t* pos) {
 size_t NullableColumn::serialize_batch_at_interval(uint8_t* dst, size_t byte_offset, size_t byte_interval, size_t start,
                                                    size_t count) {
     _null_column->serialize_batch_at_interval(dst, byte_offset, byte_interval, start, count);
+    // fast path when _has_null is false
+    if (!_has_null) {
+        for (size_t i = start; i < start + count; i++) {
+            _data_column->serialize(i, dst + (i - start) * byte_interval + byte_offset + 1);
+        }
+        return _null_column->type_size() + _data_column->type_size();
+    }
     for (size_t i = start; i < start + count; i++) {
         if (_null_column->get_data()[i] == 0) {
             _data_column->serialize(i, dst + (i - start) * byte_interval + byte_offset + 1);
@@ -282,13 +292,12 @@ void NullableColumn::fnv_hash(uint32_t* hash, uint32_t from, uint32_t to) const
         return;
     }
 
-    auto null_data = _null_column->get_data();
+    const auto& null_data = _null_column->get_data();
     uint32_t value = 0x9e3779b9;
     while (from < to) {
-        uint32_t new_from = from + 1;
-        while (new_from < to && null_data[from] == null_data[new_from]) {
-            ++new_from;
-        }
+        // the end of the run of nulls or not nulls starting at |from|
+        uint32_t new_from = null_data[from] ? SIMD::find_zero(null_data, from, to - from)
+                                            : SIMD::find_nonzero(null_data, from, to - from);
         if (null_data[from]) {
             for (uint32_t i = from; i < new_from; ++i) {
                 hash[i] = hash[i] ^ (value + (hash[i] << 6) + (hash[i] >> 2));
@@ -307,14 +316,13 @@ void NullableColumn::crc32_hash(uint32_t* hash, uint32_t from, uint32_t to) cons
         return;
     }
 
-    auto null_data = _null_column->get_data();
+    const auto& null_data = _null_column->get_data();
     // NULL is treat as 0 when crc32 hash for data loading
     static const int INT_VALUE = 0;
     while (from < to) {
-        uint32_t new_from = from + 1;
-        while (new_from < to && null_data[from] == null_data[new_from]) {
-            ++new_from;
-        }
+        // the end of the run of nulls or not nulls starting at |from|
+        uint32_t new_from = null_data[from] ? SIMD::find_zero(null_data, from, to - from)
+                                            : SIMD::find_nonzero(null_data, from, to - from);
         if (null_data[from]) {
             for (uint32_t i = from; i < new_from; ++i) {
                 hash[i] = HashUtil::zlib_crc_hash(&INT_VALUE, 4, hash[i]);
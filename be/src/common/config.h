@@ -103,8 +103,14 @@ CONF_Int32(alter_tablet_worker_count, "3");
 CONF_Int32(parallel_clone_task_per_path, "2");
 // The count of thread to clone.
 CONF_Int32(clone_worker_count, "3");
+// The count of the files of a clone task downloaded in parallel, which share max_download_speed_kbps.
+CONF_mInt32(clone_download_streams, "4");
 // The count of thread to clone.
 CONF_Int32(storage_medium_migrate_count, "1");
+// The count of the rowsets of a tablet copied in parallel by a storage migration.
+CONF_mInt32(storage_migration_copy_streams, "4");
+// The max speed(KB/s) a storage migration copies the files of a tablet, 0 means unlimited.
+CONF_mInt32(storage_migration_max_speed_kbps, "0");
 // The count of thread to check consistency.
 CONF_Int32(check_consistency_worker_count, "1");
 // The count of thread to upload.
@@ -129,6 +135,14 @@ CONF_mInt32(max_download_speed_kbps, "50000");
 CONF_mInt32(download_low_speed_limit_kbps, "50");
 // The download low speed time(seconds).
 CONF_mInt32(download_low_speed_time, "300");
+// The max count of the files sent by the download action of the http server at the same time, the requests beyond
+// it are rejected with 503 and retried by the clients. 0 means unlimited.
+CONF_mInt32(download_max_concurrent_files, "0");
+// The max speed(KB/s) the download action sends each file, 0 means unlimited.
+CONF_mInt32(download_max_send_speed_kbps, "0");
+// Whether HttpClient::execute_with_retry reuses the curl handle of the thread, which keeps the connections to the
+// servers alive, so that downloading many files from a server does not connect for each file.
+CONF_mBool(http_client_reuse_connections, "true");
 // The sleep time for one second.
 CONF_Int32(sleep_one_second, "1");
 // The sleep time for five seconds.
@@ -173,6 +187,20 @@ CONF_Bool(compress_rowbatches, "true");
 // Compress ratio when shuffle row_batches in network, not in storage engine.
 // If ratio is less than this value, use uncompressed data instead.
 CONF_mDouble(rpc_compress_ratio_threshold, "1.1");
+// If true, the exchange sink of pipeline engine serializes the uncompressed chunks into buffers handed over to
+// the brpc attachment, instead of serializing them into the protobuf and copying them to the attachment.
+CONF_mBool(enable_exchange_zero_copy_attachment, "true");
+// If true, the exchange sink of pipeline engine packs the pending requests to the fragment instances on the same
+// host into one RPC. All the BEs must support the batched requests before enabling it.
+CONF_mBool(enable_exchange_rpc_batching, "false");
+// If true and the transmission is compressed, the exchange sink of pipeline engine picks the codec for each
+// destination: no compression for the destinations on the same host and the incompressible data,
+// ZSTD for the slow networks and LZ4 for the others.
+CONF_mBool(enable_exchange_adaptive_compression, "false");
+// The number of chunks sent uncompressed after a chunk is found incompressible.
+CONF_mInt64(exchange_adaptive_compression_retry_chunks, "64");
+// The network throughput in bytes per second below which the exchange data is compressed by ZSTD.
+CONF_mInt64(exchange_adaptive_compression_zstd_max_throughput, "134217728");
 // Serialize and deserialize each returned row batch.
 CONF_Bool(serialize_batch, "false");
 // Interval between profile reports; in seconds.
@@ -184,6 +212,15 @@ CONF_mInt32(scanner_thread_pool_thread_num, "48");
 // Number of olap/external scanner thread pool size.
 CONF_Int32(scanner_thread_pool_queue_size, "102400");
 CONF_mDouble(scan_use_query_mem_ratio, "0.25");
+// Max number of scanner threads of a file scan node of broker load.
+CONF_mInt32(file_scan_max_scanner_num, "4");
+// A plain CSV file of a file scan node is split into ranges of this size, which are scanned concurrently.
+// The file is not split if it is non-positive.
+CONF_mInt64(file_scan_csv_split_size, "67108864");
+// Whether the records of a plain CSV stream load are parsed by file_scan_max_scanner_num scanners concurrently.
+// The rows are not loaded in the order of the stream then, which matters to the rows of the same key of a primary
+// key table.
+CONF_mBool(enable_stream_load_parallel_scan, "false");
 // Number of etl thread pool size.
 CONF_Int32(etl_thread_pool_size, "8");
 CONF_Int32(udf_thread_pool_size, "1");
@@ -208,6 +245,9 @@ CONF_mInt32(max_scan_key_num, "1024");
 CONF_mInt32(max_pushdown_conditions_per_column, "1024");
 // (Advanced) Maximum size of per-query receive-side buffer.
 CONF_mInt32(exchg_node_buffer_size_bytes, "10485760");
+// The number of chunks of each sender buffered by the merging exchange of pipeline engine even if the receive-side
+// buffer is full, the merge needs the next chunk of every sender, so a sender must not be blocked by the others.
+CONF_mInt32(exchg_merge_prefetch_chunks, "4");
 // The block_size every block allocate for sorter.
 CONF_Int32(sorter_block_size, "8388608");
 
@@ -216,6 +256,9 @@ CONF_mInt64(column_dictionary_key_size_threshold, "0");
 // The memory_limitation_per_thread_for_schema_change unit GB.
 CONF_mInt32(memory_limitation_per_thread_for_schema_change, "2");
 CONF_mDouble(memory_ratio_for_sorting_schema_change, "0.8");
+// Whether widening the type of a value column (e.g. INT to BIGINT) or the length of a VARCHAR column is
+// a linked schema change, i.e. the segments are kept and the values are widened when they are read.
+CONF_mBool(enable_lazy_schema_change_widening, "true");
 
 CONF_mInt32(update_cache_expire_sec, "360");
 CONF_mInt32(file_descriptor_cache_clean_interval, "3600");
@@ -252,6 +295,29 @@ CONF_Int64(index_stream_cache_capacity, "10737418240");
 CONF_String(storage_page_cache_limit, "0");
 // whether to disable page cache feature in storage
 CONF_Bool(disable_storage_page_cache, "true");
+// The ratio of the page cache capacity for the pages hit again after inserted. The pages read once,
+// e.g. by a big scan, only evict the other pages, then the hot pages survive the scans. `0` is plain LRU.
+CONF_Double(storage_page_cache_protected_ratio, "0.8");
+// The initial ratio of the page cache capacity for the compressed tier, which caches the raw compressed pages
+// and decompresses them on hit. The ratio is adjusted by the hit rates of the tiers. `0` disables the tier.
+CONF_Double(storage_page_cache_compressed_ratio, "0");
+// A query scan is a sequential scan if the tablet has at least this many rows and there is no limit,
+// its pages are evicted first and don't enter the protected part of the page cache. `0` disables it.
+CONF_mInt64(storage_page_cache_sequential_scan_rows, "100000000");
+// The number of data pages of a column read by one I/O when a page is to be read, including the pages
+// read ahead for the following reads. It cuts the I/O latency on cold disks and remote storage,
+// and keeps at most this many pages in memory for each column iterator. `0` or `1` disables read ahead.
+CONF_mInt32(column_page_read_ahead_num, "0");
+// Whether to read the local segment files by mmap. The uncompressed pages are referenced in the mapping without
+// a copy and are not inserted into the page cache, which relies on the OS page cache instead, and the pages read
+// ahead are advised by madvise(MADV_WILLNEED). The mapped bytes are tracked by the "mmap" MemTracker.
+CONF_mBool(enable_segment_mmap_read, "false");
+// The pages read ahead are read by one I/O if the gap bytes between them are at most this many,
+// set it larger for remote storage where the requests are more expensive than the bytes.
+CONF_mInt64(column_page_read_ahead_max_gap_bytes, "0");
+// Whether to submit the batched reads of local files by io_uring, e.g. the uncoalesced pages read ahead.
+// It falls back to pread if the kernel doesn't support io_uring.
+CONF_mBool(enable_io_uring, "false");
 // whether to disable column pool
 CONF_Bool(disable_column_pool, "false");
 
@@ -280,6 +346,19 @@ CONF_mInt32(cumulative_compaction_skip_window_seconds, "30");
 CONF_mInt32(update_compaction_check_interval_seconds, "60");
 CONF_Int32(update_compaction_num_threads_per_disk, "1");
 CONF_Int32(update_compaction_per_tablet_min_interval_seconds, "120"); // 2min
+// The number of threads to update the primary index of a large apply by its sub-maps concurrently, 0 to disable.
+CONF_Int32(update_apply_index_num_threads, "8");
+// The applies whose upserts have fewer rows update the primary index in the apply thread.
+CONF_mInt64(update_apply_index_parallel_min_rows, "65536");
+// Flush the l0 of a persistent index into a small l1 delta file instead of merging it into the whole l1.
+// IMPORTANT NOTE: enabling this config must require all BEs to be upgraded to new version, which can read
+// the l1 delta files.
+CONF_mBool(enable_persistent_index_l1_delta, "false");
+// The flush of l0 merges l0 and all the l1 delta files into a new l1 when there are so many deltas.
+CONF_mInt32(persistent_index_max_l1_delta_num, "4");
+// Write a bloom filter for each shard of the l1 files of persistent index, which is kept in memory
+// to skip the shard reads of the keys that don't exist, e.g. the new keys of a load.
+CONF_mBool(enable_persistent_index_bloom_filter, "true");
 
 CONF_mInt32(repair_compaction_interval_seconds, "600"); // 10 min
 
@@ -293,6 +372,18 @@ CONF_mInt64(min_compaction_failure_interval_sec, "120"); // 2 min
 // set it to larger than C will be set to equal to C.
 // This config can be set to 0, which means to forbid any compaction, for some special cases.
 CONF_Int32(max_compaction_concurrency, "-1");
+// The max bytes read and written by the compaction tasks of a data dir per second, 0 means no limit.
+CONF_mInt64(compaction_hdd_io_bytes_per_second, "0");
+CONF_mInt64(compaction_ssd_io_bytes_per_second, "0");
+// The limits above are reduced while the average latency of the page reads of queries on the disk
+// exceeds this, 0 means not to adapt to the queries.
+CONF_mInt64(compaction_io_throttle_scan_latency_us, "20000");
+// The compaction tasks whose input is larger than this are disk bound, and are postponed while the
+// compaction io of their data dirs is throttled for queries, so they run on the idle disks first.
+CONF_mInt64(compaction_disk_bound_input_bytes, /*1GB=*/"1073741824");
+// The compaction scores of the tablets needing compaction are multiplied by
+// 1 + compaction_read_heat_weight * log2(1 + the decayed reads of the tablet), 0 means not to consider the reads.
+CONF_mDouble(compaction_read_heat_weight, "0");
 
 // Threshold to logging compaction trace, in seconds.
 CONF_mInt32(compaction_trace_threshold, "60");
@@ -302,6 +393,16 @@ CONF_mInt32(compaction_trace_threshold, "60");
 // the columns will be divided into groups for vertical compaction.
 CONF_Int64(vertical_compaction_max_columns_per_group, "5");
 
+// Whether the string columns of a compaction output keep the encoding shared by all the input segments,
+// instead of speculating on the data and trying dict encoding again.
+CONF_mBool(compaction_inherit_string_encoding, "true");
+
+// Whether a cumulative compaction links the input segments into the output rowset without rewriting them,
+// if they are already sorted by key across the inputs and no delete predicate is involved.
+CONF_mBool(enable_compaction_link_segments, "true");
+// The inputs are rewritten anyway if their average segment size is below this, to merge small segments.
+CONF_mInt64(compaction_link_segments_min_bytes, "16777216");
+
 CONF_Bool(enable_event_based_compaction_framework, "true");
 // 5GB
 CONF_mInt64(min_cumulative_compaction_size, "5368709120");
@@ -398,12 +499,28 @@ CONF_Bool(use_mmap_allocate_chunk, "false");
 // acquire more free memory which can not be used by other modules
 CONF_Int64(chunk_reserved_bytes_limit, "2147483648");
 
+// Whether to return the free chunks reserved by the Chunk Allocator to the system gradually, with the same
+// smooth-step policy and period as the tcmalloc gc, so that the reserve only keeps the chunks needed lately.
+CONF_mBool(enable_chunk_reserved_bytes_gc, "true");
+
 // The probing algorithm of partitioned hash table.
 // Enable quadratic probing hash table
 CONF_Bool(enable_quadratic_probing, "false");
 
 // for pprof
 CONF_String(pprof_profile_dir, "${STARROCKS_HOME}/log");
+// Whether the ProfiledMutex, e.g. of SinkBuffer, PipelineSenderQueue, LRUCache and WorkGroupDriverQueue, record
+// the wait time and the hold time, which are served by /pprof/contention.
+CONF_mBool(enable_lock_contention_profile, "false");
+// The stack of a lock waited or held longer than this is sampled.
+CONF_mInt64(lock_contention_stack_threshold_us, "1000");
+// Whether to sample the allocations by the MemTracker labels and the stacks, which are served by /pprof/mem_alloc.
+CONF_mBool(enable_mem_alloc_profile, "false");
+// One allocation is sampled each time a thread allocates this many bytes.
+CONF_mInt64(mem_alloc_profile_sample_bytes, "1048576");
+
+// The half-life of the decayed reads and scanned bytes of the tablets and the rowsets, see ReadHeat.
+CONF_mInt64(scan_heat_half_life_sec, "3600");
 
 // for partition
 // CONF_Bool(enable_partitioned_hash_join, "false")
@@ -452,6 +569,23 @@ CONF_Int32(memory_max_alignment, "16");
 
 // write buffer size before flush
 CONF_mInt64(write_buffer_size, "104857600");
+// Sort each chunk inserted into the memtable and merge the sorted chunks when the memtable is flushed,
+// instead of sorting all the rows at once, which spreads the cost of sort over the inserts.
+CONF_mBool(enable_memtable_incremental_sort, "false");
+// The write buffer shared by the memtables of all the tablets of an index in a load, 0 means disabled.
+// When the total size of the memtables exceeds it, only the memtables larger than the average are flushed,
+// so loading into many tablets with small batches produces fewer and larger segments.
+CONF_mInt64(load_shared_write_buffer_size, "0");
+// Whether the segment and delete files of the loads are closed without fsync and made durable in groups by one
+// syncfs of the data dir for all the concurrent loads, before their rowsets are committed. It reduces the syncs
+// of many concurrent small loads, while a round also waits for the other dirty data of the file system.
+CONF_mBool(enable_load_group_commit_sync, "false");
+// The max number of the memtables of a tablet waiting for or being flushed. When one more memtable is full,
+// the write waits for the earlier flushes, 0 means no limit.
+CONF_mInt32(memtable_max_flushing_per_tablet, "2");
+// When the memory of the loads reaches this percent of their limit, the memtables not smaller than the average
+// are flushed before they are full, so the loads rarely wait for the flushes on the limit. 0 means disabled.
+CONF_mInt32(memtable_flush_ahead_percent, "80");
 
 // Following 2 configs limit the memory consumption of load process on a Backend.
 // eg: memory limit to 80% of mem limit config but up to 100GB(default)
@@ -467,6 +601,10 @@ CONF_Int64(compaction_memory_limit_per_worker, "2147483648"); // 2GB
 CONF_String(consistency_max_memory_limit, "10G");
 CONF_Int32(consistency_max_memory_limit_percent, "20");
 CONF_Int32(update_memory_limit_percent, "60");
+// The memory budget of the primary indexes in the index cache, as a percentage of the update memory limit.
+// Beyond it the least recently used indexes, which are not being used, are evicted and loaded again on demand,
+// from the index files if the tablet enables persistent index. 0 means no budget.
+CONF_mInt32(update_index_cache_capacity_percent, "80");
 
 // Update interval of tablet stat cache.
 CONF_mInt32(tablet_stat_cache_update_interval_second, "300");
@@ -498,6 +636,8 @@ CONF_Int32(routine_load_thread_pool_size, "10");
 
 // kafka reqeust timeout
 CONF_Int32(routine_load_kafka_timeout_second, "10");
+// The max time(ms) a consumed kafka message waits for the others to be put to the stream load pipe together.
+CONF_mInt32(routine_load_kafka_batch_max_wait_ms, "100");
 
 // Is set to true, index loading failure will not causing BE exit,
 // and the tablet will be marked as bad, so that FE will try to repair it.
@@ -522,6 +662,10 @@ CONF_Int32(es_http_timeout_ms, "5000");
 // https://www.elastic.co/guide/en/elasticsearch/reference/current/index-modules.html
 CONF_Int32(es_index_max_result_window, "10000");
 
+// The number of the slices of a sliced scroll each es shard is read by, which are read by different scanners in
+// parallel. 1 means reading a shard by a single scroll.
+CONF_mInt32(es_scroll_slices_per_shard, "1");
+
 // The max client cache number per each host.
 // There are variety of client cache in BE, but currently we use the
 // same cache size configuration.
@@ -575,6 +719,8 @@ CONF_Int32(txn_shard_size, "1024");
 
 // Whether to continue to start be when load tablet from header failed.
 CONF_Bool(ignore_load_tablet_failure, "false");
+// The number of threads of each data dir loading its tablets and rowsets from the meta at BE startup.
+CONF_Int32(load_tablet_threads_per_data_dir, "8");
 
 // Whether to continue to start be when load tablet from header failed.
 CONF_Bool(ignore_rowset_stale_unconsistent_delete, "false");
@@ -582,16 +728,36 @@ CONF_Bool(ignore_rowset_stale_unconsistent_delete, "false");
 // The chunk size for vector query engine
 CONF_Int32(vector_chunk_size, "4096");
 
+// The target memory usage of a chunk, 0 means unlimited. The olap and parquet scans read fewer rows than
+// the chunk size per chunk if their rows are wide, and ChunkAccumulateOperator stops merging chunks beyond it.
+CONF_mInt64(chunk_target_bytes, "33554432");
+
+// Whether the subexpressions shared by the conjuncts of a select operator are evaluated only once per chunk.
+CONF_Bool(enable_common_expr_elimination, "true");
+
 // Valid range: [0-1000].
 // `0` will disable late materialization.
 // `1000` will enable late materialization always.
 CONF_Int32(late_materialization_ratio, "10");
 
+// When the fraction of the rows of a chunk passing the evaluated conjuncts drops below this ratio, the
+// remaining conjuncts are evaluated on the passing rows of the columns they reference only.
+// `0` disables it.
+CONF_mDouble(conjunct_selected_eval_ratio, "0.2");
+
+// The conjuncts of an operator are reordered by their cost and selectivity measured once per this number of
+// chunks, see AdaptiveConjunctsOrder. `0` keeps them in the order of the plan.
+CONF_mInt32(adaptive_conjuncts_order_sample_interval, "32");
+
 // Valid range: [0-1000].
 // `0` will disable late materialization select metric type.
 // `1000` will enable late materialization always select metric type.
 CONF_Int32(metric_late_materialization_ratio, "1000");
 
+// Whether the late materialized columns are read by the ranges of the rows surviving the predicates,
+// instead of row by row. The rows in the same page are decoded together, which reads less for clustered rows.
+CONF_mBool(enable_late_materialization_by_range, "true");
+
 // Max batched bytes for each transmit request. (256KB)
 CONF_Int64(max_transmit_batched_bytes, "262144");
 
@@ -616,9 +782,47 @@ CONF_mInt16(storage_format_version, "2");
 // 1 for LZ4_NULL
 CONF_mInt16(null_encoding, "0");
 
+// IMPORTANT NOTE: enabling this config must require all BEs to be upgraded to new version,
+// which can read DELTA_ENCODING pages.
+// Whether to encode the first sort key column of INT, BIGINT, DATE, DATETIME types by delta or
+// delta-of-delta encoding, which fits the sorted values better than BIT_SHUFFLE.
+CONF_mBool(enable_delta_encoding_for_sort_key, "false");
+
+// IMPORTANT NOTE: enabling this config must require all BEs to be upgraded to new version,
+// which can read ALP_ENCODING pages.
+// Whether to encode the FLOAT and DOUBLE columns by ALP (adaptive lossless floating-point) encoding,
+// which fits the decimals of a few digits better than BIT_SHUFFLE.
+CONF_mBool(enable_alp_encoding_for_float, "false");
+
+// IMPORTANT NOTE: enabling this config must require all BEs to be upgraded to new version,
+// which can read DICT_CODE_ZONE_MAP_INDEX.
+// Whether to write the page-level zone maps of the dictionary codes for the dict-encoded string columns,
+// which skip the data pages by the predicates rewritten to the dictionary codes.
+CONF_mBool(enable_dict_code_zone_map, "false");
+
+// Whether to write the count of the not-null values and their sum in the zone maps of the numeric columns,
+// which answer the aggregates of the pages without decoding them. The older BEs ignore them.
+CONF_mBool(enable_zone_map_aggregates, "true");
+
+// IMPORTANT NOTE: enabling this config must require all BEs to be upgraded to new version,
+// which can read NGRAM_BLOOM_FILTER_INDEX.
+// If it's greater than 0, the CHAR and VARCHAR bloom filter columns also build the bloom filters of
+// their n-grams of this number of bytes, which skip the data pages for LIKE, locate and instr predicates.
+CONF_mInt32(ngram_bloom_filter_index_gram_num, "0");
+
+// IMPORTANT NOTE: enabling this config must require all BEs to be upgraded to new version,
+// which can read INVERTED_INDEX.
+// Whether the CHAR and VARCHAR bitmap index columns also build the inverted index of their tokens,
+// which turns the token predicates into the row id bitmaps before reading the columns.
+CONF_mBool(enable_inverted_index_for_bitmap_index_columns, "false");
+
 // Do pre-aggregate if effect great than the factor, factor range:[1-100].
 CONF_Int16(pre_aggregate_factor, "80");
 
+// A query of a tablet of aggregate or unique keys only merges the rows of the rowsets whose ranges of the first
+// key column overlap, by the zone maps of the segments, and unions the others.
+CONF_mBool(enable_union_non_overlapping_rowsets, "true");
+
 #ifdef __x86_64__
 // Enable genearate minidump for crash.
 CONF_Bool(sys_minidump_enable, "false");
@@ -652,6 +856,30 @@ CONF_Int64(pipeline_scan_thread_pool_thread_num, "0");
 CONF_Int64(pipeline_hdfs_scan_thread_pool_thread_num, "48");
 // Queue size of scan thread pool for pipeline engine.
 CONF_Int64(pipeline_scan_thread_pool_queue_size, "102400");
+// Whether a scan operator starts with a single io task and runs more of them, up to io_tasks_per_scan_operator,
+// only while its chunk buffer is drained and morsels are left, and fewer while its chunk buffer is full.
+CONF_mBool(enable_adaptive_scan_io_tasks, "false");
+// Whether a fragment instance having read its own scan ranges of an olap scan node steals the scan ranges
+// not read yet by the other instances of the same fragment on this BE. Only for the fragments which merely
+// filter, project or pre-aggregate the scanned rows, whose result does not depend on the ranges of an instance.
+CONF_mBool(enable_scan_morsel_stealing, "false");
+// The capacity in bytes of the cache of the chunks read from the tablets by the scan nodes FE sends a digest for.
+// 0 disables the cache.
+CONF_Int64(scan_result_cache_capacity, "536870912");
+// The chunks read from a tablet are cached only if their memory usage is at most this many bytes.
+CONF_mInt64(scan_result_cache_entry_max_bytes, "4194304");
+// Whether the concurrent queries scanning a whole tablet at the same version share the reads of its segments,
+// see SharedTabletScan. A shared scan reads all the rows, without the short key index, the zone maps or the
+// bitmap indexes, and each query filters the rows read, so it pays off only for many concurrent full scans.
+CONF_mBool(enable_shared_tablet_scan, "false");
+// The number of rows of a segment in a unit of a shared tablet scan.
+CONF_mInt64(shared_tablet_scan_unit_rows, "65536");
+// The number of the units read most recently kept by a shared tablet scan for the queries following.
+CONF_mInt64(shared_tablet_scan_kept_units, "4");
+// The I/O bandwidth in bytes per second shared by the resource groups of a scan thread pool, according to their
+// cpu limits. A resource group which reads more than its share yields to the others, if they have scan tasks.
+// There is no I/O bandwidth control if it is 0.
+CONF_mInt64(scan_io_bandwidth_bytes_per_second, "0");
 // The number of execution threads for pipeline engine.
 CONF_Int64(pipeline_exec_thread_pool_thread_num, "0");
 // The number of threads for preparing fragment instances in pipeline engine, vCPUs by default.
@@ -664,7 +892,110 @@ CONF_Int64(pipeline_sink_brpc_dop, "64");
 // Used to reject coming fragment instances, when the number of running drivers
 // exceeds it*pipeline_exec_thread_pool_thread_num.
 CONF_Int64(pipeline_max_num_drivers_per_exec_thread, "10240");
+// The max time in milliseconds a new query waits in the queue of the BE to be admitted to its resource group,
+// when the group or the BE is overloaded. A query exceeding the concurrency limit of its resource group is
+// rejected immediately if it is 0.
+CONF_mInt64(query_queue_timeout_ms, "0");
+// A new query is queued while the memory usage of its resource group plus the estimated memory of the query
+// exceeds this ratio of the memory limit of the group.
+CONF_mDouble(query_queue_mem_used_pct_limit, "0.9");
+// A new query is queued while the number of pipeline drivers of the BE exceeds this ratio of
+// pipeline_max_num_drivers_per_exec_thread*pipeline_exec_thread_pool_thread_num.
+CONF_mDouble(query_queue_driver_high_water_ratio, "0.8");
 CONF_mBool(pipeline_print_profile, "false");
+// One of every this many chunks moved by a pipeline driver is sampled into the histograms of the operator types,
+// e.g. pipe_operator_chunk_time_ns, exported by the metrics http action. <= 0 means no sampling.
+CONF_mInt64(pipeline_operator_metrics_sample_interval, "64");
+// The max number of descriptor tables with a fingerprint cached across the queries, 0 disables the cache.
+CONF_mInt64(pipeline_desc_tbl_cache_capacity, "1024");
+// Whether the streaming pre-aggregation in AUTO mode samples the NDV of the keys to choose between aggregating,
+// aggregating into a cache resident hash table and passing through, see StreamingPreaggController.
+CONF_mBool(enable_adaptive_streaming_preaggregation, "false");
+// The number of input rows after which the adaptive streaming pre-aggregation reconsiders its strategy.
+CONF_mInt64(streaming_preagg_adaptive_window_rows, "262144");
+// The number of rows sampled at the beginning of each window to estimate the NDV.
+CONF_mInt64(streaming_preagg_adaptive_sample_rows, "8192");
+// The rows are passed through if there are fewer rows than this per distinct key.
+CONF_mDouble(streaming_preagg_pass_through_reduction, "1.2");
+// The hash table is expanded without limit if there are at least this many rows per distinct key.
+CONF_mDouble(streaming_preagg_expand_reduction, "4.0");
+// The size of a hash table which is supposed to stay in cache.
+CONF_mInt64(streaming_preagg_limited_ht_bytes, "2097152");
+// The hash table of a join whose right table has at least this many rows is constructed by multiple threads.
+// <= 0 means always constructing it by the build driver alone.
+CONF_mInt64(join_parallel_build_min_rows, "4194304");
+// The number of threads to construct the join hash tables, 0 means the number of cores.
+CONF_Int32(join_parallel_build_thread_num, "0");
+// The probe of a join hash table of at least this many bytes prefetches the buckets and the chain heads
+// ahead of the rows, which hides the memory latency of the tables far larger than the cache.
+// < 0 means never prefetching.
+CONF_mInt64(join_probe_prefetch_min_bytes, "8388608");
+// A LEFT SEMI or LEFT ANTI hash join without other join conjuncts on an INT or BIGINT key keeps a bitset of the
+// build keys instead of the hash table, if the bitset of the range of the keys takes at most this many bytes and
+// no more than the hash table. <= 0 means never using the bitset.
+CONF_mInt64(semi_join_bitset_max_bytes, "4194304");
+// A nestloop join with join conjuncts bounding a column of the right table by the left table, e.g.
+// b.ts BETWEEN a.start AND a.end, sorts the right table by the column and joins each left row only with the
+// window of the right rows within the bounds, instead of with all of them.
+CONF_mBool(enable_nljoin_range_join, "true");
+// A key of at least this ratio of the rows of the hash table of a hash join, and of at least a chunk of rows,
+// is reported as a heavy hitter in the profile, which is a sign of the skew of the join keys.
+// <= 0 means never looking for the heavy hitters.
+CONF_mDouble(join_heavy_hitter_min_ratio, "0.1");
+// The drivers blocked on a source operator which notifies its readiness, such as exchange source and scan,
+// are checked by the poller only after being notified, and all of them are checked every this interval anyway.
+// <= 0 means polling all the blocked drivers continuously.
+CONF_mInt64(pipeline_poller_event_sweep_interval_ms, "10");
+// Whether the executor threads of the pipeline engine take drivers from their own local queues and steal
+// from the others, instead of a queue shared by all threads. Not used by the resource group executor.
+CONF_Bool(pipeline_enable_work_stealing, "true");
+// Whether to partition the pipeline executor threads and scan threads by NUMA node, and keep the drivers
+// and scan tasks of a fragment instance on one node. It needs pipeline_enable_work_stealing, and isn't used
+// by the resource group executors.
+CONF_Bool(enable_pipeline_numa_aware, "false");
+// Whether to dedicate as many cores as the cpu limit of the short query workgroup, and the executor threads and
+// the scan threads of the workgroups pinned to them, to the short query workgroup, see
+// exec/workgroup/cpu_isolation.h. The other workgroups run on the rest of the cores.
+CONF_mBool(enable_workgroup_cpu_isolation, "false");
+// Whether to count the cpu cycles, instructions, LLC misses and branch misses of pushing and pulling the chunks
+// of each operator by perf events, shown in the HardwareCounters of the operator profile and in the query trace.
+// Each push or pull reads the counters by two syscalls.
+CONF_mBool(enable_pipeline_perf_event_counters, "false");
+// The local partition TopN gives up partitioning and passes the rows through once it has more than
+// partition_topn_downgrade_min_partitions partitions, with less than partition_topn_downgrade_min_rows_per_partition
+// rows per partition on average, because pre-filtering so many small partitions costs more than it saves.
+CONF_mInt64(partition_topn_downgrade_min_partitions, "512");
+CONF_mInt64(partition_topn_downgrade_min_rows_per_partition, "10000");
+// The hash table of a local partition TopN is converted into a two-level one once its memory usage reaches
+// this many bytes, which makes its resizing and probing cache friendly.
+CONF_mInt64(partition_topn_two_level_hash_map_bytes, "33554432");
+// Whether the hash table of a blocking aggregate is output by all the source drivers of the pipeline,
+// instead of only by its own driver. It spreads the output of a big hash table left by skewed data,
+// the aggregate functions to finalize must be safe to call concurrently.
+CONF_mBool(enable_aggregate_parallel_output, "false");
+
+// The directory of the temporary files written by spillable operators when
+// the session variable enable_spilling is on.
+CONF_String(spill_local_storage_dir, "${STARROCKS_HOME}/spill");
+// Spillable operators start spilling when the memory usage reaches this percentage
+// of the lowest memory limit of the query.
+CONF_mInt32(spill_mem_limit_threshold, "80");
+// The number of hash partitions that spilled data is split into.
+CONF_mInt32(spill_partition_num, "16");
+// The max level of recursive spilling, a spilled partition that is still too big at this
+// level is processed entirely in memory.
+CONF_mInt32(spill_max_partition_level, "3");
+// The number of threads writing spill files on each spill directory.
+CONF_Int32(spill_io_threads_per_disk, "2");
+// The max bytes of the spill files on this BE, -1 means no limit.
+CONF_mInt64(spill_max_bytes, "-1");
+// The max bytes of the spill files of a single query, -1 means no limit.
+CONF_mInt64(spill_query_max_bytes, "-1");
+// The compression codec of the spilled blocks: NONE, LZ4, LZ4_FRAME, SNAPPY, ZSTD or ZLIB.
+CONF_String(spill_compression, "LZ4");
+// The max bytes that a spill file can have pending in the I/O queue, appending to the file
+// waits for the pending writes when it is exceeded.
+CONF_mInt64(spill_file_max_pending_write_bytes, "67108864");
 
 /// For parallel scan on the single tablet.
 // These three configs are used to calculate the minimum number of rows picked up from a segment at one time.
@@ -692,6 +1023,13 @@ CONF_Int64(max_segment_file_size, "1073741824");
 // we may need the both implementations for perf test for now, so use it to decide which implementations to use
 // default: true
 CONF_Bool(rewrite_partial_segment, "true");
+// IMPORTANT NOTE: enabling this config must require all BEs to be upgraded to new version, which can read
+// the delta column groups.
+// Whether to apply a partial update which only updates the existing rows of the tablet in column mode,
+// which writes the updated columns of each updated segment into a delta column group file, instead of
+// reading the other columns and rewriting the full rows. The delta column groups are merged by the reads
+// and folded into the segments by the compaction.
+CONF_mBool(enable_column_mode_partial_update, "false");
 
 // Properties to access object storage
 CONF_String(object_storage_access_key_id, "");
@@ -712,6 +1050,8 @@ CONF_Bool(enable_orc_late_materialization, "true");
 CONF_Int32(orc_file_cache_max_size, "8388608");
 CONF_Int32(orc_natural_read_size, "8388608");
 CONF_mBool(orc_coalesce_read_enable, "true");
+// orc reader, skip the stripes whose stripe statistics fail to satisfy the min/max conjuncts.
+CONF_mBool(orc_stripe_filter_enable, "true");
 
 // parquet reader, each column will reserve X bytes for read
 // but with coalesce read enabled, this value is not used.
@@ -719,6 +1059,13 @@ CONF_mInt32(parquet_buffer_stream_reserve_size, "1048576");
 CONF_mBool(parquet_coalesce_read_enable, "true");
 CONF_mInt32(parquet_header_max_size, "16384");
 CONF_Bool(parquet_late_materialization_enable, "true");
+// parquet reader, skip the pages whose min/max values in page index can't match the min/max conjuncts.
+CONF_mBool(parquet_page_index_enable, "true");
+// parquet reader, skip the row groups whose bloom filters can't match the equal or in conjuncts.
+CONF_mBool(parquet_bloom_filter_enable, "true");
+// The memory capacity of the cache of the parsed footers of the files of external tables, shared by all
+// scanners. The cache is disabled if it's not positive.
+CONF_Int64(file_metadata_cache_capacity, "268435456");
 
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
@@ -736,8 +1083,29 @@ CONF_mBool(aws_sdk_logging_trace_enabled, "false");
 CONF_mInt64(experimental_s3_max_single_part_size, "16777216");
 // default: 16MB
 CONF_mInt64(experimental_s3_min_upload_part_size, "16777216");
+// The batch reads on S3 whose gaps are at most this many bytes are merged into one GET.
+CONF_mInt64(s3_coalesce_read_max_gap_bytes, /*128KB=*/"131072");
+// The max size of a merged GET of the batch reads on S3.
+CONF_mInt64(s3_coalesce_read_max_bytes, /*8MB=*/"8388608");
+// The number of threads issuing the GETs of the batch reads on S3 in parallel.
+CONF_Int32(s3_batch_read_threads, "16");
+// The max number of parts of a multipart upload on S3 uploaded in the background at the same time, which
+// bounds the memory of a writing file to about this many times experimental_s3_min_upload_part_size.
+// 1 means uploading the parts synchronously.
+CONF_mInt32(experimental_s3_max_concurrent_upload_parts, "4");
+// The number of threads uploading the parts of the multipart uploads on S3.
+CONF_Int32(s3_upload_threads, "16");
 
 CONF_Int64(max_load_dop, "16");
+// The number of the in-flight add chunk requests of each node channel of a load, when the load doesn't
+// set load_dop. Should be in [1, max_load_dop].
+CONF_mInt32(load_default_parallel_request_size, "1");
+// Only the primary replica of each tablet builds the segments of a load and replicates the segment files to
+// the secondary replicas, instead of every replica parsing, sorting and encoding the same chunks.
+// Read by the backend coordinating the load.
+CONF_mBool(enable_load_segment_replication, "false");
+// The timeout of a secondary replica waiting for the rowset of the primary replica at commit.
+CONF_mInt32(load_segment_replication_timeout_s, "300");
 
 CONF_Bool(enable_load_colocate_mv, "false");
 
@@ -750,6 +1118,18 @@ CONF_Int64(deliver_broadcast_rf_passthrough_bytes_limit, "131072");
 // in passthrough style, the number of inflight RPCs of parallel deliveries are issued is not exceeds this limit.
 CONF_Int64(deliver_broadcast_rf_passthrough_inflight_num, "10");
 CONF_Int64(send_rpc_runtime_filter_timeout_ms, "1000");
+// The number of threads of RuntimeFilterWorker, the global runtime filters are merged and sent by the thread of
+// filter_id % runtime_filter_worker_num.
+CONF_Int32(runtime_filter_worker_num, "4");
+// The partitioned runtime filters of a global runtime filter still not complete this long after the first one
+// arrived are dropped, since the probe side has most likely finished. 0 means never.
+CONF_mInt64(runtime_filter_merge_timeout_ms, "30000");
+// Whether a top-n sort over an OLAP scan publishes its current boundary to the scan, which skips the pages
+// whose zone map is entirely after the boundary.
+CONF_mBool(enable_topn_runtime_filter, "true");
+// Whether a full sort without limit merges the sorted runs of its sinks by several drivers, each merging a
+// disjoint key range, instead of by a single driver. The output is still emitted in order by one driver.
+CONF_mBool(enable_parallel_local_merge, "true");
 
 // enable optimized implementation of schema change
 CONF_Bool(enable_schema_change_v2, "true");
@@ -769,6 +1149,8 @@ CONF_String(jaeger_endpoint, "");
 
 // Config for query debug trace
 CONF_String(query_debug_trace_dir, "${STARROCKS_HOME}/query_debug_trace");
+// The max number of the latest events of a pipeline driver kept by the query debug trace.
+CONF_mInt64(query_debug_trace_buffer_size, "65536");
 
 #ifdef USE_STAROS
 CONF_Int32(starlet_port, "9070");
@@ -779,9 +1161,32 @@ CONF_String(starlet_cache_dir, "");
 CONF_Int64(lake_metadata_cache_limit, /*2GB=*/"2147483648");
 CONF_Int64(lake_gc_metadata_max_versions, "10");
 CONF_Int64(lake_gc_metadata_check_interval, /*10 minutes=*/"600");
-CONF_Int64(lake_gc_segment_check_interval, /*60 minutes=*/"3600");
+// The files obsoleted by the new versions, e.g. by compaction, are deleted by the metadata GC. The segment GC,
+// which lists all the files and reads all the metadata, is only a safety sweep of the files of the failed jobs.
+CONF_Int64(lake_gc_segment_check_interval, /*1 day=*/"86400");
 // This value should be much larger than the maximum timeout of loading/compaction/schema change jobs.
 CONF_Int64(lake_gc_segment_expire_seconds, /*1 day=*/"86400");
+// Whether to load the metadata and the segment footers of all the lake tablets to scan by a fragment in
+// parallel when preparing the fragment, instead of one by one when each tablet is scanned.
+CONF_mBool(lake_enable_metadata_prefetch, "true");
+// The number of threads prefetching the metadata of lake tablets.
+CONF_Int32(lake_metadata_prefetch_threads, "16");
+// The memory limit of the primary indexes of the lake primary key tablets kept by a compute node. The index of a
+// tablet is only a cache of its latest version, it's rebuilt from the segments and the delete vectors when evicted.
+CONF_Int64(lake_primary_index_cache_limit, /*1GB=*/"1073741824");
+// Whether to cache the blocks of the segment files of lake tablets in memory and on the local disk.
+CONF_Bool(block_cache_enable, "false");
+// The directory of the disk tier of block cache, which is kept across restarts.
+CONF_String(block_cache_disk_path, "${STARROCKS_HOME}/block_cache");
+// 0 means no disk tier.
+CONF_Int64(block_cache_disk_size, /*20GB=*/"21474836480");
+// 0 means no memory tier.
+CONF_Int64(block_cache_mem_size, /*1GB=*/"1073741824");
+CONF_Int64(block_cache_block_size, /*1MB=*/"1048576");
+// Whether to cache the blocks of the remote files of external tables, e.g. hive tables, on the local disks.
+// The blocks are of block_cache_block_size, and cached under the directory "datacache" of each storage path.
+CONF_Bool(datacache_enable, "false");
+CONF_Int64(datacache_disk_size_per_dir, /*100GB=*/"107374182400");
 
 CONF_mBool(dependency_librdkafka_debug_enable, "false");
 
@@ -83,6 +83,7 @@ void gc_memory(void* arg_this) {
     using namespace starrocks::vectorized;
     const static float kFreeRatio = 0.5;
     GCHelper gch(config::tc_gc_period, config::memory_maintenance_sleep_time_s, MonoTime::Now());
+    GCHelper chunk_gch(config::tc_gc_period, config::memory_maintenance_sleep_time_s, MonoTime::Now());
 
     Daemon* daemon = static_cast<Daemon*>(arg_this);
     while (!daemon->stopped()) {
@@ -94,6 +95,16 @@ void gc_memory(void* arg_this) {
         ForEach<ColumnPoolList>(releaser);
         LOG_IF(INFO, releaser.freed_bytes() > 0) << "Released " << releaser.freed_bytes() << " bytes from column pool";
 
+        auto* chunk_allocator = ChunkAllocator::instance();
+        if (config::enable_chunk_reserved_bytes_gc && chunk_allocator != nullptr) {
+            // The chunks freed within the gc period are mostly kept by the smooth-step backlog.
+            size_t chunk_bytes_to_gc = chunk_gch.bytes_should_gc(MonoTime::Now(), chunk_allocator->reserved_bytes());
+            if (chunk_bytes_to_gc > 0) {
+                size_t released_bytes = chunk_allocator->release_free_chunks(chunk_bytes_to_gc);
+                LOG_IF(INFO, released_bytes > 0) << "Released " << released_bytes << " bytes from chunk allocator";
+            }
+        }
+
 #if !defined(ADDRESS_SANITIZER) && !defined(LEAK_SANITIZER) && !defined(THREAD_SANITIZER) && !defined(USE_JEMALLOC)
         size_t used_size = 0;
         size_t free_size = 0;
@@ -135,6 +146,7 @@ void calculate_metrics(void* arg_this) {
     int64_t last_ts = -1L;
     int64_t lst_push_bytes = -1;
     int64_t lst_query_bytes = -1;
+    int64_t lst_spill_read_bytes = -1;
 
     std::map<std::string, int64_t> lst_disks_io_time;
     std::map<std::string, int64_t> lst_net_send_bytes;
@@ -148,6 +160,7 @@ void calculate_metrics(void* arg_this) {
             last_ts = MonotonicSeconds();
             lst_push_bytes = StarRocksMetrics::instance()->push_request_write_bytes.value();
             lst_query_bytes = StarRocksMetrics::instance()->query_scan_bytes.value();
+            lst_spill_read_bytes = StarRocksMetrics::instance()->spill_read_bytes_total.value();
             StarRocksMetrics::instance()->system_metrics()->get_disks_io_time(&lst_disks_io_time);
             StarRocksMetrics::instance()->system_metrics()->get_network_traffic(&lst_net_send_bytes,
                                                                                 &lst_net_receive_bytes);
@@ -168,13 +181,19 @@ void calculate_metrics(void* arg_this) {
             StarRocksMetrics::instance()->query_scan_bytes_per_second.set_value(qps < 0 ? 0 : qps);
             lst_query_bytes = current_query_bytes;
 
-            // 3. max disk io util.
+            // 3. spill read bytes per second.
+            int64_t current_spill_read_bytes = StarRocksMetrics::instance()->spill_read_bytes_total.value();
+            int64_t srps = (current_spill_read_bytes - lst_spill_read_bytes) / (interval == 0 ? 1 : interval);
+            StarRocksMetrics::instance()->spill_read_bytes_per_second.set_value(srps < 0 ? 0 : srps);
+            lst_spill_read_bytes = current_spill_read_bytes;
+
+            // 4. max disk io util.
             StarRocksMetrics::instance()->max_disk_io_util_percent.set_value(
                     StarRocksMetrics::instance()->system_metrics()->get_max_io_util(lst_disks_io_time, 15));
             // Update lst map.
             StarRocksMetrics::instance()->system_metrics()->get_disks_io_time(&lst_disks_io_time);
 
-            // 4. max network traffic.
+            // 5. max network traffic.
             int64_t max_send = 0;
             int64_t max_receive = 0;
             StarRocksMetrics::instance()->system_metrics()->get_max_net_traffic(
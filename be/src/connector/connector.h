@@ -87,6 +87,16 @@ public:
     // such as MySQL/JDBC, so `accept_empty_scan_ranges` is false, and most in most cases, these data source(MySQL/JDBC)
     // the method `insert_local_exchange_operator` is true also.
     virtual bool accept_empty_scan_ranges() const { return true; }
+
+    // The scan ranges read by the data sources if FE sends none, one by default. A data source may be split
+    // into several ones instead, e.g. the ranges of a JDBC table, which are read in parallel.
+    virtual std::vector<TScanRangeParams> placeholder_scan_ranges() const { return {TScanRangeParams()}; }
+
+    // Split the scan ranges sent by FE into the ones read by the data sources, e.g. each shard of Elasticsearch
+    // into the slices read in parallel. They are read as they are by default.
+    virtual std::vector<TScanRangeParams> split_scan_ranges(const std::vector<TScanRangeParams>& scan_ranges) const {
+        return scan_ranges;
+    }
 };
 using DataSourceProviderPtr = std::unique_ptr<DataSourceProvider>;
 
@@ -2,6 +2,7 @@
 
 #include "connector/es_connector.h"
 
+#include "common/config.h"
 #include "exec/es/es_predicate.h"
 #include "exec/es/es_query_builder.h"
 #include "exec/es/es_scan_reader.h"
@@ -31,6 +32,29 @@ DataSourcePtr ESDataSourceProvider::create_data_source(const TScanRange& scan_ra
     return std::make_unique<ESDataSource>(this, scan_range);
 }
 
+std::vector<TScanRangeParams> ESDataSourceProvider::split_scan_ranges(
+        const std::vector<TScanRangeParams>& scan_ranges) const {
+    const int max_slices = config::es_scroll_slices_per_shard;
+    if (max_slices <= 1) {
+        return scan_ranges;
+    }
+    std::vector<TScanRangeParams> slices;
+    slices.reserve(scan_ranges.size() * max_slices);
+    for (const auto& scan_range : scan_ranges) {
+        const auto& es_scan_range = scan_range.scan_range.es_scan_range;
+        if (!scan_range.scan_range.__isset.es_scan_range || es_scan_range.__isset.max_slices) {
+            slices.emplace_back(scan_range);
+            continue;
+        }
+        for (int i = 0; i < max_slices; i++) {
+            auto& slice = slices.emplace_back(scan_range);
+            slice.scan_range.es_scan_range.__set_slice_id(i);
+            slice.scan_range.es_scan_range.__set_max_slices(max_slices);
+        }
+    }
+    return slices;
+}
+
 // ================================
 
 ESDataSource::ESDataSource(const ESDataSourceProvider* provider, const TScanRange& scan_range)
@@ -170,6 +194,10 @@ Status ESDataSource::_create_scanner() {
         _properties[ESScanReader::KEY_TYPE] = es_scan_range.type;
     }
     _properties[ESScanReader::KEY_SHARD] = std::to_string(es_scan_range.shard_id);
+    if (es_scan_range.__isset.max_slices && es_scan_range.max_slices > 1) {
+        _properties[ESScanReader::KEY_SLICE_ID] = std::to_string(es_scan_range.slice_id);
+        _properties[ESScanReader::KEY_MAX_SLICES] = std::to_string(es_scan_range.max_slices);
+    }
     _properties[ESScanReader::KEY_BATCH_SIZE] =
             std::to_string(std::min(config::es_index_max_result_window, _runtime_state->chunk_size()));
     _properties[ESScanReader::KEY_HOST_PORT] = get_host_port(es_scan_range.es_hosts);
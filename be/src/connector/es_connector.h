@@ -35,6 +35,7 @@ public:
     friend class ESDataSource;
     ESDataSourceProvider(vectorized::ConnectorScanNode* scan_node, const TPlanNode& plan_node);
     DataSourcePtr create_data_source(const TScanRange& scan_range) override;
+    std::vector<TScanRangeParams> split_scan_ranges(const std::vector<TScanRangeParams>& scan_ranges) const override;
 
 protected:
     vectorized::ConnectorScanNode* _scan_node;
@@ -4,6 +4,7 @@
 
 #include <sstream>
 
+#include "common/config.h"
 #include "exec/exec_node.h"
 #include "exec/vectorized/jdbc_scanner.h"
 #include "exprs/expr.h"
@@ -31,6 +32,30 @@ DataSourcePtr JDBCDataSourceProvider::create_data_source(const TScanRange& scan_
     return std::make_unique<JDBCDataSource>(this, scan_range);
 }
 
+std::vector<TScanRangeParams> JDBCDataSourceProvider::placeholder_scan_ranges() const {
+    if (_jdbc_scan_node.split_filters.empty()) {
+        return DataSourceProvider::placeholder_scan_ranges();
+    }
+    // Each data source holds a connection of the pool until it's closed, so the adjacent splits are merged
+    // into at most jdbc_connection_pool_size ones, rather than wait for the connections.
+    const auto& split_filters = _jdbc_scan_node.split_filters;
+    size_t num_scan_ranges =
+            std::min<size_t>(split_filters.size(), std::max<int>(1, config::jdbc_connection_pool_size));
+    std::vector<TScanRangeParams> scan_ranges(num_scan_ranges);
+    for (size_t i = 0; i < num_scan_ranges; i++) {
+        size_t begin = split_filters.size() * i / num_scan_ranges;
+        size_t end = split_filters.size() * (i + 1) / num_scan_ranges;
+        std::ostringstream split_filter;
+        for (size_t j = begin; j < end; j++) {
+            split_filter << (j == begin ? "" : " OR ") << "(" << split_filters[j] << ")";
+        }
+        TJDBCScanRange jdbc_scan_range;
+        jdbc_scan_range.__set_split_filter(split_filter.str());
+        scan_ranges[i].scan_range.__set_jdbc_scan_range(jdbc_scan_range);
+    }
+    return scan_ranges;
+}
+
 // ================================
 
 static std::string get_jdbc_sql(const Slice jdbc_url, const std::string& table, const std::vector<std::string>& columns,
@@ -61,7 +86,11 @@ static std::string get_jdbc_sql(const Slice jdbc_url, const std::string& table,
 }
 
 JDBCDataSource::JDBCDataSource(const JDBCDataSourceProvider* provider, const TScanRange& scan_range)
-        : _provider(provider) {}
+        : _provider(provider) {
+    if (scan_range.__isset.jdbc_scan_range) {
+        _split_filter = scan_range.jdbc_scan_range.split_filter;
+    }
+}
 
 Status JDBCDataSource::open(RuntimeState* state) {
     const TJDBCScanNode& jdbc_scan_node = _provider->_jdbc_scan_node;
@@ -129,8 +158,12 @@ Status JDBCDataSource::_create_scanner(RuntimeState* state) {
     scan_ctx.jdbc_url = jdbc_table->jdbc_url();
     scan_ctx.user = jdbc_table->jdbc_user();
     scan_ctx.passwd = jdbc_table->jdbc_passwd();
-    scan_ctx.sql = get_jdbc_sql(scan_ctx.jdbc_url, jdbc_table->jdbc_table(), jdbc_scan_node.columns,
-                                jdbc_scan_node.filters, _read_limit);
+    std::vector<std::string> filters = jdbc_scan_node.filters;
+    if (!_split_filter.empty()) {
+        filters.emplace_back(_split_filter);
+    }
+    scan_ctx.sql =
+            get_jdbc_sql(scan_ctx.jdbc_url, jdbc_table->jdbc_table(), jdbc_scan_node.columns, filters, _read_limit);
     _scanner = _pool->add(new vectorized::JDBCScanner(scan_ctx, _tuple_desc, _runtime_profile));
 
     RETURN_IF_ERROR(_scanner->open(state));
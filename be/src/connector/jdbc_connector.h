@@ -34,6 +34,8 @@ public:
 
     bool insert_local_exchange_operator() const override { return true; }
     bool accept_empty_scan_ranges() const override { return false; }
+    // A scan range for each of the split filters.
+    std::vector<TScanRangeParams> placeholder_scan_ranges() const override;
 
 protected:
     vectorized::ConnectorScanNode* _scan_node;
@@ -59,6 +61,8 @@ private:
 
     // ====================================
     const JDBCDataSourceProvider* _provider;
+    // The filter of the split read by this data source, empty if the table is not split.
+    std::string _split_filter;
     ObjectPool _obj_pool;
     ObjectPool* _pool = &_obj_pool;
     RuntimeState* _runtime_state = nullptr;
@@ -0,0 +1,86 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/adaptive_conjuncts_order.h"
+
+#include <algorithm>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "common/config.h"
+#include "exec/exec_node.h"
+#include "exprs/expr_context.h"
+#include "runtime/current_thread.h"
+#include "simd/simd.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+double AdaptiveConjunctsOrder::ConjunctStats::rank() const {
+    if (rows <= 0) {
+        return 0;
+    }
+    double filtered_ratio = 1 - passed_rows / rows;
+    return (ns / rows) / std::max(filtered_ratio, 1e-6);
+}
+
+AdaptiveConjunctsOrder::ConjunctStats* AdaptiveConjunctsOrder::_stats_of(const ExprContext* ctx) {
+    for (auto& stats : _stats) {
+        if (stats.ctx == ctx) {
+            return &stats;
+        }
+    }
+    auto& stats = _stats.emplace_back();
+    stats.ctx = ctx;
+    return &stats;
+}
+
+Status AdaptiveConjunctsOrder::eval_conjuncts(std::vector<ExprContext*>* ctxs, vectorized::Chunk* chunk,
+                                              vectorized::FilterPtr* filter_ptr) {
+    const int64_t interval = config::adaptive_conjuncts_order_sample_interval;
+    if (interval <= 0 || ctxs->size() <= 1 || chunk->num_rows() == 0 || _num_chunks++ % interval != 0) {
+        return ExecNode::eval_conjuncts(*ctxs, chunk, filter_ptr);
+    }
+    return _eval_and_sample(ctxs, chunk, filter_ptr);
+}
+
+Status AdaptiveConjunctsOrder::_eval_and_sample(std::vector<ExprContext*>* ctxs, vectorized::Chunk* chunk,
+                                                vectorized::FilterPtr* filter_ptr) {
+    TRY_CATCH_ALLOC_SCOPE_START()
+    const size_t num_rows = chunk->num_rows();
+    vectorized::FilterPtr filter(new vectorized::Column::Filter(num_rows, 1));
+    if (filter_ptr != nullptr) {
+        *filter_ptr = filter;
+    }
+    for (auto& stats : _stats) {
+        stats.ns /= 2;
+        stats.rows /= 2;
+        stats.passed_rows /= 2;
+    }
+    // Each conjunct is evaluated on all the rows, to measure its own selectivity rather than the one
+    // conditioned on the conjuncts before it.
+    for (ExprContext* ctx : *ctxs) {
+        int64_t start_ns = MonotonicNanos();
+        ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate(chunk));
+        size_t true_count = vectorized::ColumnHelper::count_true_with_notnull(column);
+        ConjunctStats* stats = _stats_of(ctx);
+        stats->ns += MonotonicNanos() - start_ns;
+        stats->rows += num_rows;
+        stats->passed_rows += true_count;
+        if (true_count != column->size()) {
+            vectorized::ColumnHelper::merge_two_filters(column, filter.get(), nullptr);
+        }
+    }
+    std::stable_sort(ctxs->begin(), ctxs->end(), [this](const ExprContext* lhs, const ExprContext* rhs) {
+        return _stats_of(lhs)->rank() < _stats_of(rhs)->rank();
+    });
+
+    if (SIMD::count_nonzero(*filter) == 0) {
+        chunk->set_num_rows(0);
+    } else {
+        chunk->filter(*filter);
+    }
+    TRY_CATCH_ALLOC_SCOPE_END()
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,47 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/status.h"
+
+namespace starrocks {
+
+class ExprContext;
+
+// Orders the conjuncts of an operator by their measured cost and selectivity, so that the cheap and selective
+// conjuncts are evaluated first and the following ones are evaluated on fewer rows, see ExecNode::eval_conjuncts.
+//
+// Once every adaptive_conjuncts_order_sample_interval chunks, each conjunct is evaluated on the whole chunk to
+// measure its time per row and the fraction of the rows passing it, and the conjuncts are sorted ascending by
+// cost / (1 - pass ratio). The statistics are halved on each sample, so that the order follows the data.
+// It's not thread-safe, each driver keeps its own.
+class AdaptiveConjunctsOrder {
+public:
+    // Evaluate |ctxs| on |chunk| like ExecNode::eval_conjuncts, and reorder |ctxs| after the sampled chunks.
+    Status eval_conjuncts(std::vector<ExprContext*>* ctxs, vectorized::Chunk* chunk,
+                          vectorized::FilterPtr* filter_ptr = nullptr);
+
+private:
+    struct ConjunctStats {
+        const ExprContext* ctx = nullptr;
+        double ns = 0;
+        double rows = 0;
+        double passed_rows = 0;
+
+        double rank() const;
+    };
+
+    Status _eval_and_sample(std::vector<ExprContext*>* ctxs, vectorized::Chunk* chunk,
+                            vectorized::FilterPtr* filter_ptr);
+
+    ConjunctStats* _stats_of(const ExprContext* ctx);
+
+    int64_t _num_chunks = 0;
+    std::vector<ConjunctStats> _stats;
+};
+
+} // namespace starrocks
@@ -39,6 +39,8 @@ public:
     static constexpr const char* KEY_INDEX = "index";
     static constexpr const char* KEY_TYPE = "type";
     static constexpr const char* KEY_SHARD = "shard_id";
+    static constexpr const char* KEY_SLICE_ID = "slice_id";
+    static constexpr const char* KEY_MAX_SLICES = "max_slices";
     static constexpr const char* KEY_QUERY = "query";
     static constexpr const char* KEY_BATCH_SIZE = "batch_size";
     static constexpr const char* KEY_TERMINATE_AFTER = "limit";
@@ -126,6 +126,15 @@ std::string ESScrollQueryBuilder::build(const std::map<std::string, std::string>
     es_query_dsl.AddMember("sort", sort_node, allocator);
     // number of docuements returned
     es_query_dsl.AddMember("size", size, allocator);
+    // read one slice of the shard by a sliced scroll, the slices are read by different scanners in parallel.
+    // a search terminated after the limit isn't a scroll, so it's never sliced.
+    if (properties.find(ESScanReader::KEY_MAX_SLICES) != properties.end() &&
+        properties.find(ESScanReader::KEY_TERMINATE_AFTER) == properties.end()) {
+        rapidjson::Value slice_node(rapidjson::kObjectType);
+        slice_node.AddMember("id", atoi(properties.at(ESScanReader::KEY_SLICE_ID).c_str()), allocator);
+        slice_node.AddMember("max", atoi(properties.at(ESScanReader::KEY_MAX_SLICES).c_str()), allocator);
+        es_query_dsl.AddMember("slice", slice_node, allocator);
+    }
     rapidjson::StringBuffer buffer;
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
     es_query_dsl.Accept(writer);
@@ -24,9 +24,11 @@
 #include <thrift/protocol/TDebugProtocol.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <sstream>
 
 #include "column/column_helper.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "exec/empty_set_node.h"
@@ -600,6 +602,73 @@ Status eager_prune_eval_conjuncts(const std::vector<ExprContext*>& ctxs, vectori
     return Status::OK();
 }
 
+// Evaluate the conjuncts from |ctxs[from]| on the rows selected by |filter| only, and clear the rows of
+// |filter| not passing them. The columns referenced by these conjuncts are compacted into a narrower chunk,
+// so the conjuncts after a selective one, e.g. the expensive string or json functions, skip the filtered
+// rows without copying the other columns of |chunk|. Return false if it's not applicable.
+static StatusOr<bool> eval_conjuncts_on_selected(const std::vector<ExprContext*>& ctxs, size_t from,
+                                                 vectorized::Chunk* chunk, vectorized::Column::Filter* filter) {
+    if (chunk->has_tuple_columns()) {
+        return false;
+    }
+    std::vector<SlotId> slot_ids;
+    for (size_t i = from; i < ctxs.size(); i++) {
+        ctxs[i]->root()->get_slot_ids(&slot_ids);
+    }
+    std::sort(slot_ids.begin(), slot_ids.end());
+    slot_ids.erase(std::unique(slot_ids.begin(), slot_ids.end()), slot_ids.end());
+    if (slot_ids.empty() || slot_ids.size() >= chunk->num_columns()) {
+        return false;
+    }
+    for (SlotId slot_id : slot_ids) {
+        if (!chunk->is_slot_exist(slot_id)) {
+            return false;
+        }
+    }
+
+    std::vector<uint32_t> selection;
+    selection.reserve(SIMD::count_nonzero(*filter));
+    for (uint32_t i = 0; i < filter->size(); i++) {
+        if ((*filter)[i]) {
+            selection.push_back(i);
+        }
+    }
+    vectorized::Chunk selected;
+    for (SlotId slot_id : slot_ids) {
+        const ColumnPtr& column = chunk->get_column_by_slot_id(slot_id);
+        ColumnPtr dst;
+        if (column->is_constant()) {
+            dst = column->clone();
+            dst->resize(selection.size());
+        } else {
+            dst = column->clone_empty();
+            dst->append_selective(*column, selection.data(), 0, selection.size());
+        }
+        selected.append_column(std::move(dst), slot_id);
+    }
+
+    vectorized::Column::Filter selected_filter(selection.size(), 1);
+    for (size_t i = from; i < ctxs.size(); i++) {
+        ASSIGN_OR_RETURN(ColumnPtr column, ctxs[i]->evaluate(&selected));
+        size_t true_count = vectorized::ColumnHelper::count_true_with_notnull(column);
+        if (true_count == column->size()) {
+            continue;
+        } else if (true_count == 0) {
+            selected_filter.assign(selection.size(), 0);
+            break;
+        }
+        bool all_zero = false;
+        vectorized::ColumnHelper::merge_two_filters(column, &selected_filter, &all_zero);
+        if (all_zero) {
+            break;
+        }
+    }
+    for (size_t i = 0; i < selection.size(); i++) {
+        (*filter)[selection[i]] = selected_filter[i];
+    }
+    return true;
+}
+
 Status ExecNode::eval_conjuncts(const std::vector<ExprContext*>& ctxs, vectorized::Chunk* chunk,
                                 vectorized::FilterPtr* filter_ptr) {
     // No need to do expression if none rows
@@ -628,8 +697,8 @@ Status ExecNode::eval_conjuncts(const std::vector<ExprContext*>& ctxs, vectorize
     }
     vectorized::Column::Filter* raw_filter = filter.get();
 
-    for (auto* ctx : ctxs) {
-        ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate(chunk));
+    for (size_t i = 0; i < ctxs.size(); i++) {
+        ASSIGN_OR_RETURN(ColumnPtr column, ctxs[i]->evaluate(chunk));
         size_t true_count = vectorized::ColumnHelper::count_true_with_notnull(column);
 
         if (true_count == column->size()) {
@@ -647,6 +716,14 @@ Status ExecNode::eval_conjuncts(const std::vector<ExprContext*>& ctxs, vectorize
                 return Status::OK();
             }
         }
+        // The following conjuncts are evaluated on the selected rows only if few rows are left.
+        if (i + 1 < ctxs.size() &&
+            SIMD::count_nonzero(*raw_filter) < chunk->num_rows() * config::conjunct_selected_eval_ratio) {
+            ASSIGN_OR_RETURN(bool evaluated, eval_conjuncts_on_selected(ctxs, i + 1, chunk, raw_filter));
+            if (evaluated) {
+                break;
+            }
+        }
     }
 
     chunk->filter(*raw_filter);
@@ -9,6 +9,9 @@ namespace starrocks::pipeline {
 Status AggregateBlockingSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
     RETURN_IF_ERROR(_aggregator->prepare(state, state->obj_pool(), _unique_metrics.get(), _mem_tracker.get()));
+    if (state->enable_spill()) {
+        _aggregator->enable_spill();
+    }
     return _aggregator->open(state);
 }
 
@@ -44,6 +47,8 @@ Status AggregateBlockingSinkOperator::set_finishing(RuntimeState* state) {
     }
     COUNTER_SET(_aggregator->input_row_count(), _aggregator->num_input_rows());
 
+    RETURN_IF_ERROR(_aggregator->finish_spill());
+    _aggregator->prepare_parallel_output();
     _aggregator->sink_complete();
     return Status::OK();
 }
@@ -64,6 +69,12 @@ Status AggregateBlockingSinkOperator::push_chunk(RuntimeState* state, const vect
     DCHECK_LE(chunk_size, state->chunk_size());
 
     SCOPED_TIMER(_aggregator->agg_compute_timer());
+    if (_aggregator->is_spill_enabled() && !agg_group_by_with_limit &&
+        (_aggregator->is_spilling() || _aggregator->should_spill())) {
+        RETURN_IF_ERROR(_aggregator->spill_chunk(chunk));
+        _aggregator->update_num_input_rows(chunk_size);
+        return _aggregator->check_has_error();
+    }
     if (!_aggregator->is_none_group_by_exprs()) {
         if (false) {
         }
@@ -2,16 +2,24 @@
 
 #include "aggregate_blocking_source_operator.h"
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "exec/exec_node.h"
+#include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 
 bool AggregateBlockingSourceOperator::has_output() const {
-    return _aggregator->is_sink_complete() && !_aggregator->is_ht_eos();
+    if (!_aggregator->is_sink_complete()) {
+        return false;
+    }
+    return !_aggregator->is_ht_eos() || _aggregator->has_spilled_data() || _has_peer_output();
 }
 
 bool AggregateBlockingSourceOperator::is_finished() const {
-    return _aggregator->is_sink_complete() && _aggregator->is_ht_eos();
+    return _aggregator->is_sink_complete() && _aggregator->is_ht_eos() && !_aggregator->has_spilled_data() &&
+           !_has_peer_output();
 }
 
 Status AggregateBlockingSourceOperator::set_finished(RuntimeState* state) {
@@ -26,12 +34,35 @@ void AggregateBlockingSourceOperator::close(RuntimeState* state) {
 StatusOr<vectorized::ChunkPtr> AggregateBlockingSourceOperator::pull_chunk(RuntimeState* state) {
     RETURN_IF_CANCELLED(state);
 
+    if (_aggregator->is_ht_eos() && _aggregator->has_spilled_data()) {
+        // Load the spilled partitions chunk by chunk, to avoid occupying the driver for a long time.
+        RETURN_IF_ERROR(_aggregator->restore_spilled_chunk());
+        return nullptr;
+    }
+
     int32_t chunk_size = state->chunk_size();
     vectorized::ChunkPtr chunk = std::make_shared<vectorized::Chunk>();
 
-    if (_aggregator->is_none_group_by_exprs()) {
+    if (_aggregator->is_ht_eos() && !_aggregator->has_spilled_data()) {
+        // The own hash table has been output, help the peers to output theirs.
+        ASSIGN_OR_RETURN(chunk, _pull_chunk_from_peers(state));
+        if (chunk == nullptr) {
+            return nullptr;
+        }
+    } else if (_aggregator->is_none_group_by_exprs()) {
         SCOPED_TIMER(_aggregator->get_results_timer());
         _aggregator->convert_to_chunk_no_groupby(&chunk);
+    } else if (_aggregator->is_parallel_output()) {
+        if (false) {
+        }
+#define HASH_MAP_METHOD(NAME)                                                                  \
+    else if (_aggregator->hash_map_variant().type == vectorized::AggHashMapVariant::Type::NAME) \
+            _aggregator->convert_hash_map_batches_to_chunk<                                    \
+                    decltype(_aggregator->hash_map_variant().NAME)::element_type>(            \
+                    *_aggregator->hash_map_variant().NAME, chunk_size, &chunk, true);
+        APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+        _aggregator->update_num_rows_returned(chunk->num_rows());
     } else {
         if (false) {
         }
@@ -55,4 +86,60 @@ StatusOr<vectorized::ChunkPtr> AggregateBlockingSourceOperator::pull_chunk(Runti
     return std::move(chunk);
 }
 
+const std::vector<Aggregator*>& AggregateBlockingSourceOperator::_peers() const {
+    if (!_peers_initialized) {
+        _peers_initialized = true;
+        if (config::enable_aggregate_parallel_output) {
+            for (const auto& [id, aggregator] : _aggregator_factory->aggregators()) {
+                if (aggregator != _aggregator) {
+                    _peer_aggregators.emplace_back(aggregator.get());
+                }
+            }
+            // Start from different peers, to not contend for the same hash table.
+            if (!_peer_aggregators.empty()) {
+                std::rotate(_peer_aggregators.begin(),
+                            _peer_aggregators.begin() + _driver_sequence % _peer_aggregators.size(),
+                            _peer_aggregators.end());
+            }
+        }
+    }
+    return _peer_aggregators;
+}
+
+static bool is_peer_outputting(Aggregator* peer) {
+    return peer->is_sink_complete() && peer->has_unclaimed_output() && !peer->is_finished();
+}
+
+bool AggregateBlockingSourceOperator::_has_peer_output() const {
+    const auto& peers = _peers();
+    return std::any_of(peers.begin(), peers.end(), is_peer_outputting);
+}
+
+StatusOr<vectorized::ChunkPtr> AggregateBlockingSourceOperator::_pull_chunk_from_peers(RuntimeState* state) {
+    int32_t chunk_size = state->chunk_size();
+    for (Aggregator* peer : _peers()) {
+        // The peer is closed once its own operators are closed, ref it during the output.
+        if (!is_peer_outputting(peer) || !peer->try_ref()) {
+            continue;
+        }
+        DeferOp unref([peer, state] { peer->unref(state); });
+        if (peer->is_finished()) {
+            continue;
+        }
+
+        vectorized::ChunkPtr chunk = std::make_shared<vectorized::Chunk>();
+        if (false) {
+        }
+#define HASH_MAP_METHOD(NAME)                                                                                    \
+    else if (peer->hash_map_variant().type == vectorized::AggHashMapVariant::Type::NAME)                         \
+            peer->convert_hash_map_batches_to_chunk<decltype(peer->hash_map_variant().NAME)::element_type>( \
+                    *peer->hash_map_variant().NAME, chunk_size, &chunk, false);
+        APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+        _aggregator->update_num_rows_returned(chunk->num_rows());
+        return chunk;
+    }
+    return nullptr;
+}
+
 } // namespace starrocks::pipeline
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <utility>
+#include <vector>
 
 #include "exec/pipeline/source_operator.h"
 #include "exec/vectorized/aggregator.h"
@@ -11,9 +12,10 @@ namespace starrocks::pipeline {
 class AggregateBlockingSourceOperator : public SourceOperator {
 public:
     AggregateBlockingSourceOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
-                                    AggregatorPtr aggregator)
+                                    AggregatorPtr aggregator, const AggregatorFactory* aggregator_factory)
             : SourceOperator(factory, id, "aggregate_blocking_source", plan_node_id, driver_sequence),
-              _aggregator(std::move(aggregator)) {
+              _aggregator(std::move(aggregator)),
+              _aggregator_factory(aggregator_factory) {
         _aggregator->ref();
     }
 
@@ -35,6 +37,18 @@ private:
     // - reffed at constructor() of both sink and source operator,
     // - unreffed at close() of both sink and source operator.
     AggregatorPtr _aggregator = nullptr;
+
+    // The aggregators of the other source operators, whose hash tables are output in parallel and
+    // may be helped to output by this operator after its own hash table is output.
+    // See Aggregator::prepare_parallel_output().
+    const std::vector<Aggregator*>& _peers() const;
+    bool _has_peer_output() const;
+    StatusOr<vectorized::ChunkPtr> _pull_chunk_from_peers(RuntimeState* state);
+
+    const AggregatorFactory* _aggregator_factory;
+    // Initialized at the first use, when all the aggregators have been created.
+    mutable std::vector<Aggregator*> _peer_aggregators;
+    mutable bool _peers_initialized = false;
 };
 
 class AggregateBlockingSourceOperatorFactory final : public SourceOperatorFactory {
@@ -47,7 +61,8 @@ public:
 
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
         return std::make_shared<AggregateBlockingSourceOperator>(this, _id, _plan_node_id, driver_sequence,
-                                                                 _aggregator_factory->get_or_create(driver_sequence));
+                                                                 _aggregator_factory->get_or_create(driver_sequence),
+                                                                 _aggregator_factory.get());
     }
 
     bool need_local_shuffle() const override { return _need_local_shuffle; }
@@ -2,6 +2,7 @@
 
 #include "aggregate_streaming_sink_operator.h"
 
+#include "common/config.h"
 #include "runtime/current_thread.h"
 #include "simd/simd.h"
 namespace starrocks::pipeline {
@@ -9,6 +10,11 @@ namespace starrocks::pipeline {
 Status AggregateStreamingSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
     RETURN_IF_ERROR(_aggregator->prepare(state, state->obj_pool(), _unique_metrics.get(), _mem_tracker.get()));
+    if (config::enable_adaptive_streaming_preaggregation &&
+        _aggregator->streaming_preaggregation_mode() == TStreamingPreaggregationMode::AUTO &&
+        !_aggregator->is_none_group_by_exprs()) {
+        _preagg_controller = std::make_unique<vectorized::StreamingPreaggController>(_unique_metrics.get());
+    }
     return _aggregator->open(state);
 }
 
@@ -44,6 +50,8 @@ Status AggregateStreamingSinkOperator::push_chunk(RuntimeState* state, const vec
         return _push_chunk_by_force_streaming();
     } else if (_aggregator->streaming_preaggregation_mode() == TStreamingPreaggregationMode::FORCE_PREAGGREGATION) {
         return _push_chunk_by_force_preaggregation(chunk->num_rows());
+    } else if (_preagg_controller != nullptr) {
+        return _push_chunk_by_adaptive(chunk->num_rows());
     } else {
         return _push_chunk_by_auto(chunk->num_rows());
     }
@@ -121,52 +129,73 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const size_t chunk_si
 
         COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
     } else {
-        {
-            SCOPED_TIMER(_aggregator->agg_compute_timer());
-            if (false) {
-            }
-#define HASH_MAP_METHOD(NAME)                                                                     \
-    else if (_aggregator->hash_map_variant().type == vectorized::AggHashMapVariant::Type::NAME) { \
-        TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map_with_selection<typename decltype(         \
-                                    _aggregator->hash_map_variant().NAME)::element_type>(         \
-                *_aggregator->hash_map_variant().NAME, chunk_size));                              \
+        RETURN_IF_ERROR(_push_chunk_by_selection(chunk_size));
+    }
+
+    return Status::OK();
+}
+
+Status AggregateStreamingSinkOperator::_push_chunk_by_adaptive(const size_t chunk_size) {
+    size_t ht_bytes = _aggregator->hash_map_variant().allocated_memory_usage(_aggregator->mem_pool());
+    auto mode = _preagg_controller->next_mode(_aggregator->group_by_columns(), chunk_size,
+                                              _aggregator->hash_map_variant().size(), ht_bytes);
+    switch (mode) {
+    case vectorized::StreamingPreaggController::Mode::PREAGGREGATE:
+        return _push_chunk_by_force_preaggregation(chunk_size);
+    case vectorized::StreamingPreaggController::Mode::SELECTIVE:
+        return _push_chunk_by_selection(chunk_size);
+    case vectorized::StreamingPreaggController::Mode::PASS_THROUGH:
+        return _push_chunk_by_force_streaming();
     }
-            APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
+    return Status::OK();
+}
+
+Status AggregateStreamingSinkOperator::_push_chunk_by_selection(const size_t chunk_size) {
+    {
+        SCOPED_TIMER(_aggregator->agg_compute_timer());
+        if (false) {
+        }
+#define HASH_MAP_METHOD(NAME)                                                                                   \
+    else if (_aggregator->hash_map_variant().type == vectorized::AggHashMapVariant::Type::NAME) {               \
+        TRY_CATCH_BAD_ALLOC(                                                                                    \
+                _aggregator->build_hash_map_with_selection<                                                     \
+                        typename decltype(_aggregator->hash_map_variant().NAME)::element_type>(                 \
+                        *_aggregator->hash_map_variant().NAME, chunk_size));                                    \
+    }
+        APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
 #undef HASH_MAP_METHOD
-            else {
-                DCHECK(false);
-            }
+        else {
+            DCHECK(false);
         }
+    }
 
-        size_t zero_count = SIMD::count_zero(_aggregator->streaming_selection());
-        // very poor aggregation
-        if (zero_count == 0) {
+    size_t zero_count = SIMD::count_zero(_aggregator->streaming_selection());
+    // very poor aggregation
+    if (zero_count == 0) {
+        SCOPED_TIMER(_aggregator->streaming_timer());
+        vectorized::ChunkPtr chunk = std::make_shared<vectorized::Chunk>();
+        _aggregator->output_chunk_by_streaming(&chunk);
+        _aggregator->offer_chunk_to_buffer(chunk);
+    }
+    // very high aggregation
+    else if (zero_count == _aggregator->streaming_selection().size()) {
+        SCOPED_TIMER(_aggregator->agg_compute_timer());
+        _aggregator->compute_batch_agg_states(chunk_size);
+    } else {
+        // middle cases, first aggregate locally and output by stream
+        {
+            SCOPED_TIMER(_aggregator->agg_compute_timer());
+            _aggregator->compute_batch_agg_states_with_selection(chunk_size);
+        }
+        {
             SCOPED_TIMER(_aggregator->streaming_timer());
             vectorized::ChunkPtr chunk = std::make_shared<vectorized::Chunk>();
-            _aggregator->output_chunk_by_streaming(&chunk);
+            _aggregator->output_chunk_by_streaming_with_selection(&chunk);
             _aggregator->offer_chunk_to_buffer(chunk);
         }
-        // very high aggregation
-        else if (zero_count == _aggregator->streaming_selection().size()) {
-            SCOPED_TIMER(_aggregator->agg_compute_timer());
-            _aggregator->compute_batch_agg_states(chunk_size);
-        } else {
-            // middle cases, first aggregate locally and output by stream
-            {
-                SCOPED_TIMER(_aggregator->agg_compute_timer());
-                _aggregator->compute_batch_agg_states_with_selection(chunk_size);
-            }
-            {
-                SCOPED_TIMER(_aggregator->streaming_timer());
-                vectorized::ChunkPtr chunk = std::make_shared<vectorized::Chunk>();
-                _aggregator->output_chunk_by_streaming_with_selection(&chunk);
-                _aggregator->offer_chunk_to_buffer(chunk);
-            }
-        }
-
-        COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
     }
 
+    COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
     return Status::OK();
 }
 } // namespace starrocks::pipeline
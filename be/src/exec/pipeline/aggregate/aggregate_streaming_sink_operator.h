@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "exec/pipeline/operator.h"
+#include "exec/vectorized/aggregate/streaming_preagg_controller.h"
 #include "exec/vectorized/aggregator.h"
 
 namespace starrocks::pipeline {
@@ -40,12 +41,21 @@ private:
     // Invoked by push_chunk  if current mode is TStreamingPreaggregationMode::AUTO
     Status _push_chunk_by_auto(const size_t chunk_size);
 
+    // Invoked by push_chunk if current mode is TStreamingPreaggregationMode::AUTO and
+    // config::enable_adaptive_streaming_preaggregation is on
+    Status _push_chunk_by_adaptive(const size_t chunk_size);
+
+    // Aggregate the rows whose keys are in the hash table, and pass through the others.
+    Status _push_chunk_by_selection(const size_t chunk_size);
+
     // It is used to perform aggregation algorithms shared by
     // AggregateStreamingSourceOperator. It is
     // - prepared at SinkOperator::prepare(),
     // - reffed at constructor() of both sink and source operator,
     // - unreffed at close() of both sink and source operator.
     AggregatorPtr _aggregator = nullptr;
+    // Only created in the adaptive mode.
+    std::unique_ptr<vectorized::StreamingPreaggController> _preagg_controller;
     // Whether prev operator has no output
     bool _is_finished = false;
 };
@@ -2,6 +2,8 @@
 
 #include "exec/pipeline/aggregate/repeat/repeat_operator.h"
 
+#include <algorithm>
+
 #include "column/chunk.h"
 #include "exec/exec_node.h"
 #include "runtime/descriptors.h"
@@ -28,13 +30,38 @@ bool RepeatOperator::has_output() const {
 }
 
 StatusOr<vectorized::ChunkPtr> RepeatOperator::pull_chunk(RuntimeState* state) {
-    ChunkPtr curr_chunk = _curr_chunk->clone_empty(_curr_chunk->num_rows());
-    curr_chunk->append_safe(*_curr_chunk, 0, _curr_chunk->num_rows());
+    ChunkPtr curr_chunk;
+    if (_repeat_times_last + 1 == _repeat_times_required) {
+        // The last grouping set takes the input chunk itself, which is not read any more.
+        curr_chunk = std::move(_curr_chunk);
+    } else {
+        curr_chunk = _copy_curr_chunk();
+    }
     extend_and_update_columns(&curr_chunk);
     RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, curr_chunk.get()));
     return curr_chunk;
 }
 
+vectorized::ChunkPtr RepeatOperator::_copy_curr_chunk() const {
+    const size_t num_rows = _curr_chunk->num_rows();
+    const auto& slot_id_to_index = _curr_chunk->get_slot_id_to_index_map();
+    if (slot_id_to_index.size() != _curr_chunk->num_columns()) {
+        ChunkPtr copy = _curr_chunk->clone_empty(num_rows);
+        copy->append_safe(*_curr_chunk, 0, num_rows);
+        return copy;
+    }
+    const std::vector<SlotId>& null_slot_ids = _null_slot_ids[_repeat_times_last];
+    vectorized::Columns columns(_curr_chunk->num_columns());
+    for (const auto& [slot_id, index] : slot_id_to_index) {
+        if (std::find(null_slot_ids.begin(), null_slot_ids.end(), slot_id) != null_slot_ids.end()) {
+            columns[index] = ColumnHelper::create_const_null_column(num_rows);
+        } else {
+            columns[index] = _curr_chunk->get_column_by_index(index)->clone_shared();
+        }
+    }
+    return std::make_shared<vectorized::Chunk>(std::move(columns), slot_id_to_index);
+}
+
 void RepeatOperator::extend_and_update_columns(ChunkPtr* curr_chunk) {
     // extend virtual columns for gourping_id and grouping()/grouping_id() columns.
     for (int i = 0; i < _grouping_list.size(); ++i) {
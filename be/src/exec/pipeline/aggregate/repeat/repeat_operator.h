@@ -59,6 +59,9 @@ private:
 
     void extend_and_update_columns(vectorized::ChunkPtr* curr_chunk);
 
+    // The copy of _curr_chunk for the current grouping set. The columns set to NULL by it are not copied.
+    vectorized::ChunkPtr _copy_curr_chunk() const;
+
     /*
      * _curr_chunk
      * _curr_columns
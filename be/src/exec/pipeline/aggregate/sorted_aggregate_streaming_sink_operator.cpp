@@ -0,0 +1,54 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "sorted_aggregate_streaming_sink_operator.h"
+
+#include "runtime/current_thread.h"
+
+namespace starrocks::pipeline {
+
+Status SortedAggregateStreamingSinkOperator::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(Operator::prepare(state));
+    RETURN_IF_ERROR(_aggregator->prepare(state, state->obj_pool(), _unique_metrics.get(), _mem_tracker.get()));
+    DCHECK(_aggregator->is_sorted_streaming());
+    return _aggregator->open(state);
+}
+
+void SortedAggregateStreamingSinkOperator::close(RuntimeState* state) {
+    _aggregator->unref(state);
+    Operator::close(state);
+}
+
+Status SortedAggregateStreamingSinkOperator::set_finishing(RuntimeState* state) {
+    _is_finished = true;
+
+    vectorized::ChunkPtr chunk;
+    TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_aggregator->finish_sorted_groups(&chunk)));
+    if (chunk != nullptr && !chunk->is_empty()) {
+        _aggregator->offer_chunk_to_buffer(chunk);
+    }
+    _aggregator->set_ht_eos();
+    _aggregator->sink_complete();
+    return Status::OK();
+}
+
+StatusOr<vectorized::ChunkPtr> SortedAggregateStreamingSinkOperator::pull_chunk(RuntimeState* state) {
+    return Status::InternalError("Not support");
+}
+
+Status SortedAggregateStreamingSinkOperator::push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) {
+    size_t chunk_size = chunk->num_rows();
+
+    _aggregator->update_num_input_rows(chunk_size);
+    COUNTER_SET(_aggregator->input_row_count(), _aggregator->num_input_rows());
+
+    RETURN_IF_ERROR(_aggregator->evaluate_exprs(chunk.get()));
+
+    vectorized::ChunkPtr output;
+    TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_aggregator->build_sorted_groups(chunk_size, &output)));
+    if (output != nullptr && !output->is_empty()) {
+        _aggregator->offer_chunk_to_buffer(output);
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks::pipeline
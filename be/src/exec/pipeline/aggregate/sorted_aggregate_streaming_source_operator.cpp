@@ -0,0 +1,51 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "sorted_aggregate_streaming_source_operator.h"
+
+namespace starrocks::pipeline {
+
+bool SortedAggregateStreamingSourceOperator::is_finished() const {
+    // source operator may finish early
+    if (_is_finished) {
+        return true;
+    }
+
+    // The sink operator offers every group to the chunk buffer, there is no hash table to output.
+    if (_aggregator->is_sink_complete() && _aggregator->is_chunk_buffer_empty()) {
+        _is_finished = true;
+    }
+    return _is_finished;
+}
+
+Status SortedAggregateStreamingSourceOperator::set_finishing(RuntimeState* state) {
+    _is_finished = true;
+    return Status::OK();
+}
+
+Status SortedAggregateStreamingSourceOperator::set_finished(RuntimeState* state) {
+    return _aggregator->set_finished();
+}
+
+void SortedAggregateStreamingSourceOperator::close(RuntimeState* state) {
+    _aggregator->unref(state);
+    SourceOperator::close(state);
+}
+
+StatusOr<vectorized::ChunkPtr> SortedAggregateStreamingSourceOperator::pull_chunk(RuntimeState* state) {
+    vectorized::ChunkPtr chunk = _aggregator->poll_chunk_buffer();
+    if (chunk == nullptr) {
+        return nullptr;
+    }
+
+    size_t old_size = chunk->num_rows();
+    eval_runtime_bloom_filters(chunk.get());
+
+    // For having
+    RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_aggregator->conjunct_ctxs(), chunk.get()));
+    _aggregator->update_num_rows_returned(-(old_size - chunk->num_rows()));
+
+    DCHECK_CHUNK(chunk);
+    return std::move(chunk);
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,60 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <utility>
+
+#include "exec/pipeline/source_operator.h"
+#include "exec/vectorized/aggregator.h"
+
+namespace starrocks::pipeline {
+// Output the groups aggregated by the SortedAggregateStreamingSinkOperator, in the order they are ended.
+class SortedAggregateStreamingSourceOperator : public SourceOperator {
+public:
+    SortedAggregateStreamingSourceOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id,
+                                           int32_t driver_sequence, AggregatorPtr aggregator)
+            : SourceOperator(factory, id, "sorted_aggregate_streaming_source", plan_node_id, driver_sequence),
+              _aggregator(std::move(aggregator)) {
+        _aggregator->ref();
+    }
+
+    ~SortedAggregateStreamingSourceOperator() override = default;
+
+    bool has_output() const override { return !_aggregator->is_chunk_buffer_empty(); }
+    bool is_finished() const override;
+    Status set_finishing(RuntimeState* state) override;
+    Status set_finished(RuntimeState* state) override;
+
+    void close(RuntimeState* state) override;
+
+    StatusOr<vectorized::ChunkPtr> pull_chunk(RuntimeState* state) override;
+
+private:
+    // It is used to perform aggregation algorithms shared by
+    // SortedAggregateStreamingSinkOperator. It is
+    // - prepared at SinkOperator::prepare(),
+    // - reffed at constructor() of both sink and source operator,
+    // - unreffed at close() of both sink and source operator.
+    AggregatorPtr _aggregator = nullptr;
+    // Whether prev operator has no output
+    mutable bool _is_finished = false;
+};
+
+class SortedAggregateStreamingSourceOperatorFactory final : public SourceOperatorFactory {
+public:
+    SortedAggregateStreamingSourceOperatorFactory(int32_t id, int32_t plan_node_id,
+                                                  AggregatorFactoryPtr aggregator_factory)
+            : SourceOperatorFactory(id, "sorted_aggregate_streaming_source", plan_node_id),
+              _aggregator_factory(std::move(aggregator_factory)) {}
+
+    ~SortedAggregateStreamingSourceOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<SortedAggregateStreamingSourceOperator>(
+                this, _id, _plan_node_id, driver_sequence, _aggregator_factory->get_or_create(driver_sequence));
+    }
+
+private:
+    AggregatorFactoryPtr _aggregator_factory = nullptr;
+};
+} // namespace starrocks::pipeline
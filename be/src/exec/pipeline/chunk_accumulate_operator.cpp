@@ -3,6 +3,7 @@
 #include "exec/pipeline/chunk_accumulate_operator.h"
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "runtime/runtime_state.h"
 
 namespace starrocks {
@@ -20,8 +21,10 @@ Status ChunkAccumulateOperator::push_chunk(RuntimeState* state, const vectorized
         _in_chunk->append(*chunk);
     }
 
+    // The scans shrink the chunks of wide rows to chunk_target_bytes, which are not merged back.
+    size_t low_watermark_bytes = config::chunk_target_bytes > 0 ? config::chunk_target_bytes : LOW_WATERMARK_BYTES;
     if (_out_chunk == nullptr && (_in_chunk->num_rows() >= state->chunk_size() * LOW_WATERMARK_ROWS_RATE ||
-                                  _in_chunk->memory_usage() >= LOW_WATERMARK_BYTES)) {
+                                  _in_chunk->memory_usage() >= low_watermark_bytes)) {
         _out_chunk = std::move(_in_chunk);
     }
 
@@ -40,6 +40,18 @@ public:
     // by ref() are visible to unref(), so we needn't barrier here.
     void ref() { _num_running_operators.fetch_add(1, std::memory_order_relaxed); }
 
+    // Ref the context from an operator which isn't related to it, e.g. a source operator helping to output it.
+    // Return false if the context has been closed by the last unref(), or is being closed.
+    bool try_ref() {
+        int32_t num = _num_running_operators.load(std::memory_order_acquire);
+        while (num > 0) {
+            if (_num_running_operators.compare_exchange_weak(num, num + 1, std::memory_order_acq_rel)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     // Called by operator::close. Close the context when the last running operator is closed.
     void unref(RuntimeState* state) {
         if (_num_running_operators.fetch_sub(1, std::memory_order_acq_rel) == 1) {
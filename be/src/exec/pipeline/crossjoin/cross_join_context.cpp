@@ -76,6 +76,35 @@ void CrossJoinContext::append_build_chunk(int32_t sinker_id, vectorized::ChunkPt
     _input_chunks[sinker_id].push_back(chunk);
 }
 
+void CrossJoinContext::_sort_build_chunks(RuntimeState* state) {
+    ChunkPtr build_chunk = _build_chunks[0]->clone_empty(_num_build_rows);
+    for (auto& chunk : _build_chunks) {
+        build_chunk->append(*chunk);
+    }
+    _build_chunks.clear();
+    size_t num_rows = build_chunk->num_rows();
+    ColumnPtr keys = vectorized::ColumnHelper::unpack_and_duplicate_const_column(
+            num_rows, build_chunk->get_column_by_slot_id(_range_join_build_slot));
+    const vectorized::Column* key_data = vectorized::ColumnHelper::get_data_column(keys.get());
+
+    // The rows with null keys never match the range join conjuncts, they are put last.
+    std::vector<uint32_t> order(num_rows);
+    std::iota(order.begin(), order.end(), 0);
+    auto non_null_end =
+            std::stable_partition(order.begin(), order.end(), [&](uint32_t i) { return !keys->is_null(i); });
+    std::stable_sort(order.begin(), non_null_end,
+                     [&](uint32_t lhs, uint32_t rhs) { return key_data->compare_at(lhs, rhs, *key_data, 1) < 0; });
+
+    _range_join_build_keys = key_data->clone_empty();
+    _range_join_build_keys->append_selective(*key_data, order.data(), 0, non_null_end - order.begin());
+    for (size_t start = 0; start < num_rows; start += _build_chunk_desired_size) {
+        size_t count = std::min<size_t>(_build_chunk_desired_size, num_rows - start);
+        ChunkPtr chunk = build_chunk->clone_empty(count);
+        chunk->append_selective(*build_chunk, order.data(), start, count);
+        _build_chunks.emplace_back(std::move(chunk));
+    }
+}
+
 int CrossJoinContext::get_build_chunk_start(int index) const {
     DCHECK_LT(index, _build_chunks.size());
     return _build_chunk_desired_size * index;
@@ -103,6 +132,9 @@ Status CrossJoinContext::finish_one_right_sinker(RuntimeState* state) {
         _input_chunks.shrink_to_fit();
 
         _build_chunk_desired_size = state->chunk_size();
+        if (_range_join_build_slot >= 0 && !_build_chunks.empty()) {
+            _sort_build_chunks(state);
+        }
         _all_right_finished = true;
     }
     return Status::OK();
@@ -47,6 +47,15 @@ public:
 
     vectorized::Chunk* get_build_chunk(int32_t index) const { return _build_chunks[index].get(); }
 
+    // Sort the build rows by |slot_id| once all of them are received, for the range join, see
+    // enable_nljoin_range_join. Must be called before any build chunk is received.
+    void set_range_join_build_slot(SlotId slot_id) { _range_join_build_slot = slot_id; }
+    SlotId range_join_build_slot() const { return _range_join_build_slot; }
+
+    // The non-null values of the range join slot of the sorted build rows, ascending. The build rows with
+    // null values are after all of them.
+    const ColumnPtr& range_join_build_keys() const { return _range_join_build_keys; }
+
     // Start row index of a chunk
     int get_build_chunk_start(int index) const;
 
@@ -63,6 +72,7 @@ public:
 
 private:
     Status _init_runtime_filter(RuntimeState* state);
+    void _sort_build_chunks(RuntimeState* state);
 
     const int32_t _num_left_probers;
     const int32_t _num_right_sinkers;
@@ -85,6 +95,9 @@ private:
     int _num_post_probers = 0;
     std::vector<uint8_t> _shared_build_match_flag;
 
+    SlotId _range_join_build_slot = -1;
+    ColumnPtr _range_join_build_keys;
+
     // conjuncts in cross join, used for generate runtime_filter
     std::vector<ExprContext*> _conjuncts_ctx;
 
@@ -2,11 +2,16 @@
 
 #include "exec/pipeline/crossjoin/cross_join_left_operator.h"
 
+#include <map>
+#include <unordered_set>
+
 #include "column/column_helper.h"
 #include "column/nullable_column.h"
+#include "common/config.h"
 #include "exec/exec_node.h"
 #include "exec/pipeline/crossjoin/nljoin_probe_operator.h"
 #include "exprs/expr.h"
+#include "exprs/vectorized/column_ref.h"
 #include "runtime/runtime_state.h"
 
 namespace starrocks::pipeline {
@@ -326,10 +331,105 @@ void CrossJoinLeftOperatorFactory::_init_row_desc() {
     }
 }
 
+static bool is_range_join_type(const TypeDescriptor& type) {
+    switch (type.type) {
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_LARGEINT:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+    case TYPE_DECIMALV2:
+    case TYPE_DECIMAL32:
+    case TYPE_DECIMAL64:
+    case TYPE_DECIMAL128:
+    case TYPE_CHAR:
+    case TYPE_VARCHAR:
+        return true;
+    default:
+        // The floats are excluded, whose NaN are ordered differently by the sort and the predicates.
+        return false;
+    }
+}
+
+static TExprOpcode::type reverse_range_op(TExprOpcode::type op) {
+    switch (op) {
+    case TExprOpcode::LT:
+        return TExprOpcode::GT;
+    case TExprOpcode::LE:
+        return TExprOpcode::GE;
+    case TExprOpcode::GT:
+        return TExprOpcode::LT;
+    case TExprOpcode::GE:
+        return TExprOpcode::LE;
+    default:
+        return op;
+    }
+}
+
+// Find the join conjuncts comparing a build slot with an expression of the probe slots, and choose the build slot
+// which is bounded on the most sides, e.g. b.ts of b.ts BETWEEN a.start AND a.end.
+void CrossJoinLeftOperatorFactory::_init_range_join() {
+    if (!config::enable_nljoin_range_join || _join_conjuncts.empty()) {
+        return;
+    }
+    std::unordered_set<SlotId> probe_slots;
+    std::unordered_set<SlotId> build_slots;
+    for (size_t i = 0; i < _col_types.size(); i++) {
+        (i < _probe_column_count ? probe_slots : build_slots).insert(_col_types[i]->id());
+    }
+
+    std::map<SlotId, std::vector<RangeJoinPredicate>> candidates;
+    for (ExprContext* ctx : _join_conjuncts) {
+        Expr* expr = ctx->root();
+        TExprOpcode::type op = expr->op();
+        if (expr->node_type() != TExprNodeType::BINARY_PRED || expr->get_num_children() != 2 ||
+            (op != TExprOpcode::LT && op != TExprOpcode::LE && op != TExprOpcode::GT && op != TExprOpcode::GE)) {
+            continue;
+        }
+        for (int i = 0; i < 2; i++) {
+            Expr* build_expr = expr->get_child(i);
+            Expr* probe_expr = expr->get_child(1 - i);
+            if (build_expr->node_type() != TExprNodeType::SLOT_REF || !is_range_join_type(build_expr->type()) ||
+                !(build_expr->type() == probe_expr->type())) {
+                continue;
+            }
+            SlotId build_slot = down_cast<vectorized::ColumnRef*>(build_expr)->slot_id();
+            std::vector<SlotId> slot_ids;
+            probe_expr->get_slot_ids(&slot_ids);
+            if (build_slots.count(build_slot) == 0 || slot_ids.empty() ||
+                !std::all_of(slot_ids.begin(), slot_ids.end(), [&](SlotId id) { return probe_slots.count(id) > 0; })) {
+                continue;
+            }
+            candidates[build_slot].push_back({ctx, probe_expr, i == 0 ? op : reverse_range_op(op)});
+            break;
+        }
+    }
+
+    int best_num_sides = 0;
+    for (auto& [slot_id, predicates] : candidates) {
+        bool has_lower = false;
+        bool has_upper = false;
+        for (const auto& pred : predicates) {
+            bool is_lower = pred.op == TExprOpcode::GT || pred.op == TExprOpcode::GE;
+            has_lower |= is_lower;
+            has_upper |= !is_lower;
+        }
+        int num_sides = has_lower + has_upper;
+        if (num_sides > best_num_sides) {
+            best_num_sides = num_sides;
+            _range_join_predicates = predicates;
+            _cross_join_context->set_range_join_build_slot(slot_id);
+        }
+    }
+}
+
 OperatorPtr CrossJoinLeftOperatorFactory::create(int32_t degree_of_parallelism, int32_t driver_sequence) {
     return std::make_shared<NLJoinProbeOperator>(this, _id, _plan_node_id, driver_sequence, _join_op,
                                                  _sql_join_conjuncts, _join_conjuncts, _conjunct_ctxs, _col_types,
-                                                 _probe_column_count, _build_column_count, _cross_join_context);
+                                                 _probe_column_count, _build_column_count, _cross_join_context,
+                                                 _range_join_predicates);
 }
 
 Status CrossJoinLeftOperatorFactory::prepare(RuntimeState* state) {
@@ -338,6 +438,7 @@ Status CrossJoinLeftOperatorFactory::prepare(RuntimeState* state) {
     _init_row_desc();
     RETURN_IF_ERROR(Expr::prepare(_join_conjuncts, state));
     RETURN_IF_ERROR(Expr::open(_join_conjuncts, state));
+    _init_range_join();
     RETURN_IF_ERROR(Expr::prepare(_conjunct_ctxs, state));
     RETURN_IF_ERROR(Expr::open(_conjunct_ctxs, state));
 
@@ -5,6 +5,7 @@
 #include "column/chunk.h"
 #include "column/vectorized_fwd.h"
 #include "exec/pipeline/crossjoin/cross_join_context.h"
+#include "exec/pipeline/crossjoin/nljoin_probe_operator.h"
 #include "exec/pipeline/operator_with_dependency.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/descriptors.h"
@@ -178,6 +179,7 @@ public:
 
 private:
     void _init_row_desc();
+    void _init_range_join();
 
     const TJoinOp::type _join_op;
     const RowDescriptor& _row_descriptor;
@@ -191,6 +193,7 @@ private:
     std::string _sql_join_conjuncts;
     std::vector<ExprContext*> _join_conjuncts;
     std::vector<ExprContext*> _conjunct_ctxs;
+    std::vector<RangeJoinPredicate> _range_join_predicates;
 
     std::shared_ptr<CrossJoinContext> _cross_join_context;
 };
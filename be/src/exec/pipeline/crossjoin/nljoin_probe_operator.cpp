@@ -2,6 +2,8 @@
 
 #include "exec/pipeline/crossjoin/nljoin_probe_operator.h"
 
+#include <algorithm>
+
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "exec/pipeline/crossjoin/cross_join_right_sink_operator.h"
@@ -20,7 +22,8 @@ NLJoinProbeOperator::NLJoinProbeOperator(OperatorFactory* factory, int32_t id, i
                                          const std::vector<ExprContext*>& conjunct_ctxs,
                                          const std::vector<SlotDescriptor*>& col_types, size_t probe_column_count,
                                          size_t build_column_count,
-                                         const std::shared_ptr<CrossJoinContext>& cross_join_context)
+                                         const std::shared_ptr<CrossJoinContext>& cross_join_context,
+                                         const std::vector<RangeJoinPredicate>& range_join_predicates)
         : OperatorWithDependency(factory, id, "nestloop_join_probe", plan_node_id, driver_sequence),
           _join_op(join_op),
           _col_types(col_types),
@@ -29,7 +32,8 @@ NLJoinProbeOperator::NLJoinProbeOperator(OperatorFactory* factory, int32_t id, i
           _sql_join_conjuncts(sql_join_conjuncts),
           _join_conjuncts(join_conjuncts),
           _conjunct_ctxs(conjunct_ctxs),
-          _cross_join_context(cross_join_context) {
+          _cross_join_context(cross_join_context),
+          _range_join_predicates(range_join_predicates) {
     _cross_join_context->ref();
 }
 
@@ -38,6 +42,10 @@ Status NLJoinProbeOperator::prepare(RuntimeState* state) {
     _output_accumulator.set_desired_size(state->chunk_size());
 
     _unique_metrics->add_info_string("join_conjuncts", _sql_join_conjuncts);
+    if (_is_range_join()) {
+        _unique_metrics->add_info_string("range_join_build_slot",
+                                         std::to_string(_cross_join_context->range_join_build_slot()));
+    }
     return Operator::prepare(state);
 }
 
@@ -239,6 +247,146 @@ Status NLJoinProbeOperator::_probe(RuntimeState* state, ChunkPtr chunk) {
     return Status::OK();
 }
 
+// The number of the ascending |keys| less than the |row|-th value of |values|, or not greater than it if
+// |inclusive|.
+static uint32_t count_keys_before(const vectorized::Column& keys, const vectorized::Column& values, size_t row,
+                                  bool inclusive) {
+    uint32_t lo = 0;
+    uint32_t hi = keys.size();
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        int cmp = keys.compare_at(mid, row, values, 1);
+        if (cmp < 0 || (inclusive && cmp == 0)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// Find the window of the sorted build rows of each probe row, which is the intersection of the bounds of all
+// the range join predicates. The probe rows with null bounds match nothing.
+Status NLJoinProbeOperator::_init_range_windows() {
+    size_t num_rows = _probe_chunk->num_rows();
+    const ColumnPtr& build_keys = _cross_join_context->range_join_build_keys();
+    uint32_t num_keys = build_keys == nullptr ? 0 : build_keys->size();
+    _range_windows.assign(num_rows, {0, num_keys});
+    if (num_keys == 0) {
+        return Status::OK();
+    }
+    for (const auto& pred : _range_join_predicates) {
+        ASSIGN_OR_RETURN(ColumnPtr probe_keys, pred.ctx->evaluate(pred.probe_expr, _probe_chunk.get()));
+        probe_keys = vectorized::ColumnHelper::unpack_and_duplicate_const_column(num_rows, probe_keys);
+        const vectorized::Column* probe_data = vectorized::ColumnHelper::get_data_column(probe_keys.get());
+        for (size_t i = 0; i < num_rows; i++) {
+            auto& [start, end] = _range_windows[i];
+            if (probe_keys->is_null(i)) {
+                start = end = 0;
+                continue;
+            }
+            switch (pred.op) {
+            case TExprOpcode::GT:
+                start = std::max(start, count_keys_before(*build_keys, *probe_data, i, true));
+                break;
+            case TExprOpcode::GE:
+                start = std::max(start, count_keys_before(*build_keys, *probe_data, i, false));
+                break;
+            case TExprOpcode::LT:
+                end = std::min(end, count_keys_before(*build_keys, *probe_data, i, false));
+                break;
+            case TExprOpcode::LE:
+                end = std::min(end, count_keys_before(*build_keys, *probe_data, i, true));
+                break;
+            default:
+                DCHECK(false) << "unexpected range join op: " << pred.op;
+            }
+        }
+    }
+    for (auto& [start, end] : _range_windows) {
+        start = std::min(start, end);
+    }
+    return Status::OK();
+}
+
+// Permute the probe rows with the build rows in their windows, until the chunk is full or the probe chunk is
+// finished. The window of a probe row may be split into several segments by the build chunks and output chunks.
+ChunkPtr NLJoinProbeOperator::_permute_range_chunk(RuntimeState* state) {
+    ChunkPtr chunk = _init_output_chunk(state);
+    _range_segments.clear();
+    size_t num_probe_rows = _probe_chunk->num_rows();
+    while (_probe_row_current < num_probe_rows && chunk->num_rows() < state->chunk_size()) {
+        size_t start = _range_build_current;
+        size_t end = _range_windows[_probe_row_current].second;
+        size_t num_rows = 0;
+        if (start < end) {
+            int build_chunk_index = start / state->chunk_size();
+            size_t build_chunk_start = _cross_join_context->get_build_chunk_start(build_chunk_index);
+            vectorized::Chunk* build_chunk = _cross_join_context->get_build_chunk(build_chunk_index);
+            num_rows = std::min({end - start, build_chunk_start + build_chunk->num_rows() - start,
+                                 state->chunk_size() - chunk->num_rows()});
+            for (size_t i = 0; i < _col_types.size(); i++) {
+                SlotDescriptor* slot = _col_types[i];
+                ColumnPtr& dst_col = chunk->get_column_by_slot_id(slot->id());
+                if (i < _probe_column_count) {
+                    ColumnPtr& src_col = _probe_chunk->get_column_by_slot_id(slot->id());
+                    dst_col->append_value_multiple_times(*src_col, _probe_row_current, num_rows);
+                } else {
+                    ColumnPtr& src_col = build_chunk->get_column_by_slot_id(slot->id());
+                    dst_col->append(*src_col, start - build_chunk_start, num_rows);
+                }
+            }
+        }
+        _range_build_current = start + num_rows;
+        bool probe_row_finished = _range_build_current >= end;
+        _range_segments.push_back({_probe_row_current, start, num_rows, probe_row_finished});
+        if (probe_row_finished) {
+            ++_probe_row_current;
+            if (_probe_row_current < num_probe_rows) {
+                _range_build_current = _range_windows[_probe_row_current].first;
+            }
+        }
+    }
+    return chunk;
+}
+
+// Apply the join conjuncts to the chunk permuted by _permute_range_chunk, and maintain the match states of the
+// segments for the outer joins.
+Status NLJoinProbeOperator::_probe_range(RuntimeState* state, ChunkPtr chunk) {
+    vectorized::FilterPtr filter;
+    if (!chunk->is_empty()) {
+        size_t rows = chunk->num_rows();
+        RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_join_conjuncts, chunk.get(), &filter));
+        DCHECK(!!filter);
+
+        // The filter has not been assigned if no rows matched
+        if (chunk->num_rows() == 0) {
+            filter->assign(rows, 0);
+        }
+    }
+
+    size_t offset = 0;
+    for (const auto& segment : _range_segments) {
+        if (segment.num_rows > 0) {
+            if (_is_left_join()) {
+                _probe_row_matched = _probe_row_matched || SIMD::contain_nonzero(*filter, offset, segment.num_rows);
+            }
+            if (_is_right_join()) {
+                vectorized::ColumnHelper::or_two_filters(
+                        segment.num_rows, _self_build_match_flag.data() + segment.build_start, filter->data() + offset);
+            }
+            offset += segment.num_rows;
+        }
+        if (_is_left_join() && segment.probe_row_finished) {
+            if (!_probe_row_matched) {
+                _permute_left_join(state, chunk, segment.probe_row, 1);
+            }
+            _probe_row_matched = false;
+        }
+    }
+    return Status::OK();
+}
+
 // Permute enough rows from build side and probe side
 // The chunk either consists two conditions:
 // 1. Multiple probe rows and multiple build single-chunk
@@ -363,9 +511,15 @@ StatusOr<vectorized::ChunkPtr> NLJoinProbeOperator::pull_chunk(RuntimeState* sta
         return chunk;
     }
     while (_probe_chunk && _probe_row_current < _probe_chunk->num_rows()) {
-        ChunkPtr chunk = _permute_chunk(state);
-        DCHECK(chunk);
-        RETURN_IF_ERROR(_probe(state, chunk));
+        ChunkPtr chunk;
+        if (_is_range_join()) {
+            chunk = _permute_range_chunk(state);
+            RETURN_IF_ERROR(_probe_range(state, chunk));
+        } else {
+            chunk = _permute_chunk(state);
+            DCHECK(chunk);
+            RETURN_IF_ERROR(_probe(state, chunk));
+        }
         RETURN_IF_ERROR(eval_conjuncts(_conjunct_ctxs, chunk.get(), nullptr));
 
         RETURN_IF_ERROR(_output_accumulator.push(std::move(chunk)));
@@ -394,6 +548,10 @@ Status NLJoinProbeOperator::push_chunk(RuntimeState* state, const vectorized::Ch
     _probe_row_current = 0;
     _probe_row_matched = false;
     _move_build_chunk_index(0);
+    if (_is_range_join()) {
+        RETURN_IF_ERROR(_init_range_windows());
+        _range_build_current = _range_windows.empty() ? 0 : _range_windows[0].first;
+    }
 
     return Status::OK();
 }
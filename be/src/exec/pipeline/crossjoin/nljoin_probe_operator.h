@@ -11,19 +11,33 @@
 
 namespace starrocks::pipeline {
 
+// A join conjunct bounding a slot of the build side by an expression of the probe side, e.g. b.ts >= a.start,
+// with which the probe rows are joined only with a window of the build rows sorted by the slot.
+struct RangeJoinPredicate {
+    // The context of the join conjunct.
+    ExprContext* ctx;
+    Expr* probe_expr;
+    // LT, LE, GT or GE of the build slot to the probe expression, e.g. GE for both b.ts >= a.start and
+    // a.start <= b.ts.
+    TExprOpcode::type op;
+};
+
 // NestLoopJoin
 // Implement the block-wise nestloop algorithm, support inner/outer join
 // The algorithm consists of three steps:
 // 1. Permute the block from probe side and build side
 // 2. Apply the join conjuncts and filter data
 // 3. Emit the unmatched probe rows and build row for outer join
+// With the range join predicates, the build rows are sorted by their slot, and each probe row is only permuted
+// with the window of the build rows within the bounds found by binary search, see enable_nljoin_range_join.
 class NLJoinProbeOperator final : public OperatorWithDependency {
 public:
     NLJoinProbeOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
                         TJoinOp::type join_op, const std::string& sql_join_conjuncts,
                         const std::vector<ExprContext*>& join_conjuncts, const std::vector<ExprContext*>& conjunct_ctxs,
                         const std::vector<SlotDescriptor*>& col_types, size_t probe_column_count,
-                        size_t build_column_count, const std::shared_ptr<CrossJoinContext>& cross_join_context);
+                        size_t build_column_count, const std::shared_ptr<CrossJoinContext>& cross_join_context,
+                        const std::vector<RangeJoinPredicate>& range_join_predicates);
 
     ~NLJoinProbeOperator() override = default;
 
@@ -66,6 +80,11 @@ private:
     bool _is_left_join() const;
     bool _is_right_join() const;
 
+    bool _is_range_join() const { return !_range_join_predicates.empty(); }
+    Status _init_range_windows();
+    ChunkPtr _permute_range_chunk(RuntimeState* state);
+    Status _probe_range(RuntimeState* state, ChunkPtr chunk);
+
 private:
     const TJoinOp::type _join_op;
     const std::vector<SlotDescriptor*>& _col_types;
@@ -92,6 +111,23 @@ private:
     bool _probe_row_matched = false;
     size_t _probe_row_start = 0;   // Start index of current chunk
     size_t _probe_row_current = 0; // End index of current chunk
+
+    // Range join states
+    struct RangeSegment {
+        size_t probe_row;
+        // The index of the first build row in all the build rows.
+        size_t build_start;
+        size_t num_rows;
+        // Whether it's the last segment of the window of the probe row.
+        bool probe_row_finished;
+    };
+    const std::vector<RangeJoinPredicate>& _range_join_predicates;
+    // The window [first, second) of the sorted build rows of each probe row.
+    std::vector<std::pair<uint32_t, uint32_t>> _range_windows;
+    // The next build row to permute with _probe_row_current.
+    size_t _range_build_current = 0;
+    // The segments of the build rows permuted in the current chunk.
+    std::vector<RangeSegment> _range_segments;
 };
 
 } // namespace starrocks::pipeline
\ No newline at end of file
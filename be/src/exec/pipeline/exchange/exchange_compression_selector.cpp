@@ -0,0 +1,44 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/pipeline/exchange/exchange_compression_selector.h"
+
+#include "common/config.h"
+#include "util/compression/block_compression.h"
+
+namespace starrocks::pipeline {
+
+ExchangeCompressionSelector::ExchangeCompressionSelector(bool is_local, std::function<int64_t()> network_throughput)
+        : _is_local(is_local), _network_throughput(std::move(network_throughput)) {}
+
+Status ExchangeCompressionSelector::init() {
+    RETURN_IF_ERROR(get_block_compression_codec(CompressionTypePB::LZ4, &_lz4_codec));
+    RETURN_IF_ERROR(get_block_compression_codec(CompressionTypePB::ZSTD, &_zstd_codec));
+    return Status::OK();
+}
+
+const BlockCompressionCodec* ExchangeCompressionSelector::next_codec() {
+    if (_is_local) {
+        return nullptr;
+    }
+    if (_num_skipped_chunks > 0) {
+        _num_skipped_chunks--;
+        return nullptr;
+    }
+    int64_t throughput = _network_throughput == nullptr ? 0 : _network_throughput();
+    if (throughput > 0 && throughput < config::exchange_adaptive_compression_zstd_max_throughput) {
+        return _zstd_codec;
+    }
+    return _lz4_codec;
+}
+
+void ExchangeCompressionSelector::update(size_t uncompressed_size, size_t compressed_size) {
+    if (compressed_size == 0) {
+        return;
+    }
+    double ratio = static_cast<double>(uncompressed_size) / compressed_size;
+    if (ratio <= config::rpc_compress_ratio_threshold) {
+        _num_skipped_chunks = config::exchange_adaptive_compression_retry_chunks;
+    }
+}
+
+} // namespace starrocks::pipeline
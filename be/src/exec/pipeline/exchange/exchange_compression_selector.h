@@ -0,0 +1,49 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "common/status.h"
+
+namespace starrocks {
+class BlockCompressionCodec;
+} // namespace starrocks
+
+namespace starrocks::pipeline {
+
+// ExchangeCompressionSelector picks the codec for each chunk sent to one destination when the adaptive
+// exchange compression is enabled.
+// - The chunks sent to a destination on the same host are never compressed, because they don't go through
+//   the network.
+// - If a chunk doesn't shrink by `rpc_compress_ratio_threshold`, the data is considered incompressible, and the
+//   following `exchange_adaptive_compression_retry_chunks` chunks are sent uncompressed.
+// - If the network throughput to the destination is below `exchange_adaptive_compression_zstd_max_throughput`,
+//   the network is the bottleneck and ZSTD is used for its ratio, otherwise LZ4 is used for its speed.
+class ExchangeCompressionSelector {
+public:
+    // |network_throughput| returns the measured bytes per second sent to the destination, 0 if unknown.
+    ExchangeCompressionSelector(bool is_local, std::function<int64_t()> network_throughput);
+
+    Status init();
+
+    // The codec to compress the next chunk, nullptr means sending it uncompressed.
+    const BlockCompressionCodec* next_codec();
+
+    // Report the sizes of a chunk compressed by the codec returned by next_codec().
+    void update(size_t uncompressed_size, size_t compressed_size);
+
+private:
+    const bool _is_local;
+    const std::function<int64_t()> _network_throughput;
+
+    const BlockCompressionCodec* _lz4_codec = nullptr;
+    const BlockCompressionCodec* _zstd_codec = nullptr;
+
+    // The number of the following chunks to send uncompressed because the data is incompressible.
+    int64_t _num_skipped_chunks = 0;
+};
+
+} // namespace starrocks::pipeline
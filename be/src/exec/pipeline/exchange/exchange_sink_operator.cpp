@@ -10,6 +10,7 @@
 #include <random>
 
 #include "common/config.h"
+#include "exec/pipeline/exchange/exchange_compression_selector.h"
 #include "exec/pipeline/exchange/shuffler.h"
 #include "exec/pipeline/exchange/sink_buffer.h"
 #include "exprs/expr.h"
@@ -113,6 +114,11 @@ private:
     std::vector<std::unique_ptr<vectorized::Chunk>> _chunks;
     PTransmitChunkParamsPtr _chunk_request;
     size_t _current_request_bytes = 0;
+    // The data of the chunks in _chunk_request if the parent uses zero-copy attachment.
+    butil::IOBuf _attachment;
+    int64_t _attachment_physical_bytes = 0;
+    // Not nullptr if the parent uses the adaptive compression.
+    std::unique_ptr<ExchangeCompressionSelector> _compression_selector;
 
     bool _is_inited = false;
     bool _use_pass_through = false;
@@ -160,6 +166,14 @@ Status ExchangeSinkOperator::Channel::init(RuntimeState* state) {
     _brpc_stub = state->exec_env()->brpc_stub_cache()->get_stub(_brpc_dest_addr);
     _prepare_pass_through();
 
+    if (_parent->_use_adaptive_compression) {
+        std::shared_ptr<SinkBuffer> buffer = _parent->_buffer;
+        TUniqueId instance_id = _fragment_instance_id;
+        _compression_selector = std::make_unique<ExchangeCompressionSelector>(
+                is_local(), [buffer, instance_id] { return buffer->network_throughput(instance_id); });
+        RETURN_IF_ERROR(_compression_selector->init());
+    }
+
     _is_inited = true;
     return Status::OK();
 }
@@ -215,8 +229,18 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(const vectorized::Chunk* ch
                 _chunk_request->add_driver_sequences(driver_sequence);
             }
             auto pchunk = _chunk_request->add_chunks();
-            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_parent->serialize_chunk(chunk, pchunk, &_is_first_chunk)));
-            _current_request_bytes += pchunk->data().size();
+            if (_parent->use_zero_copy_attachment()) {
+                int64_t data_size = 0;
+                TRY_CATCH_BAD_ALLOC(ASSIGN_OR_RETURN(
+                        data_size, _parent->serialize_chunk_to_attachment(chunk, pchunk, &_is_first_chunk, &_attachment,
+                                                                          &_attachment_physical_bytes, 1,
+                                                                          _compression_selector.get())));
+                _current_request_bytes += data_size;
+            } else {
+                TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(
+                        _parent->serialize_chunk(chunk, pchunk, &_is_first_chunk, 1, _compression_selector.get())));
+                _current_request_bytes += pchunk->data().size();
+            }
         }
     }
 
@@ -226,7 +250,8 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(const vectorized::Chunk* ch
         _chunk_request->set_eos(eos);
         _chunk_request->set_use_pass_through(_use_pass_through);
         butil::IOBuf attachment;
-        int64_t attachment_physical_bytes = _parent->construct_brpc_attachment(_chunk_request, attachment);
+        int64_t attachment_physical_bytes =
+                _parent->_take_attachment(_chunk_request, &_attachment, &_attachment_physical_bytes, attachment);
         TransmitChunkInfo info = {this->_fragment_instance_id, _brpc_stub, std::move(_chunk_request), attachment,
                                   attachment_physical_bytes};
         _parent->_buffer->add_request(info);
@@ -357,6 +382,15 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
         _compress_type = CompressionTypePB::LZ4;
     }
     RETURN_IF_ERROR(get_block_compression_codec(_compress_type, &_compress_codec));
+    _use_zero_copy_attachment = config::enable_exchange_zero_copy_attachment;
+    _use_adaptive_compression = config::enable_exchange_adaptive_compression && _compress_codec != nullptr;
+    if (_use_adaptive_compression) {
+        // The request of broadcast is shared by all the destinations, so it's decided by the slowest one.
+        std::shared_ptr<SinkBuffer> buffer = _buffer;
+        _compression_selector = std::make_unique<ExchangeCompressionSelector>(
+                false, [buffer] { return buffer->min_network_throughput(); });
+        RETURN_IF_ERROR(_compression_selector->init());
+    }
 
     std::string instances;
     for (const auto& channel : _channels) {
@@ -387,6 +421,11 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
     _serialize_chunk_timer = ADD_TIMER(_unique_metrics, "SerializeChunkTime");
     _shuffle_hash_timer = ADD_TIMER(_unique_metrics, "ShuffleHashTime");
     _compress_timer = ADD_TIMER(_unique_metrics, "CompressTime");
+    if (_use_adaptive_compression) {
+        _adaptive_lz4_chunks = ADD_COUNTER(_unique_metrics, "AdaptiveCompressLZ4Chunks", TUnit::UNIT);
+        _adaptive_zstd_chunks = ADD_COUNTER(_unique_metrics, "AdaptiveCompressZSTDChunks", TUnit::UNIT);
+        _adaptive_uncompressed_chunks = ADD_COUNTER(_unique_metrics, "AdaptiveUncompressedChunks", TUnit::UNIT);
+    }
 
     for (auto& [_, channel] : _instance_id2channel) {
         RETURN_IF_ERROR(channel->init(state));
@@ -399,7 +438,9 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
 }
 
 bool ExchangeSinkOperator::is_finished() const {
-    return _is_finished;
+    // Finished early if all the receivers have finished, then the upstream operators, e.g. the scans, are finished
+    // by the driver too.
+    return _is_finished || (_buffer != nullptr && _buffer->is_all_receivers_finished());
 }
 
 bool ExchangeSinkOperator::need_input() const {
@@ -457,13 +498,23 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const vectorized::C
             // 1. create a new chunk PB to serialize
             ChunkPB* pchunk = _chunk_request->add_chunks();
             // 2. serialize input chunk to pchunk
-            TRY_CATCH_BAD_ALLOC(
-                    RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &_is_first_chunk, _channels.size())));
-            _current_request_bytes += pchunk->data().size();
+            if (_use_zero_copy_attachment) {
+                int64_t data_size = 0;
+                TRY_CATCH_BAD_ALLOC(ASSIGN_OR_RETURN(
+                        data_size, serialize_chunk_to_attachment(send_chunk, pchunk, &_is_first_chunk, &_attachment,
+                                                                 &_attachment_physical_bytes, _channels.size(),
+                                                                 _compression_selector.get())));
+                _current_request_bytes += data_size;
+            } else {
+                TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &_is_first_chunk,
+                                                                    _channels.size(), _compression_selector.get())));
+                _current_request_bytes += pchunk->data().size();
+            }
             // 3. if request bytes exceede the threshold, send current request
             if (_current_request_bytes > config::max_transmit_batched_bytes) {
                 butil::IOBuf attachment;
-                int64_t attachment_physical_bytes = construct_brpc_attachment(_chunk_request, attachment);
+                int64_t attachment_physical_bytes =
+                        _take_attachment(_chunk_request, &_attachment, &_attachment_physical_bytes, attachment);
                 for (auto idx : _channel_indices) {
                     if (!_channels[idx]->use_pass_through()) {
                         PTransmitChunkParamsPtr copy = std::make_shared<PTransmitChunkParams>(*_chunk_request);
@@ -522,22 +573,9 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const vectorized::C
             }
 
             // Compute row indexes for each channel's each shuffle
-            _channel_row_idx_start_points.assign(_num_shuffles + 1, 0);
             _shuffler->exchange_shuffle(_shuffle_channel_ids, _hash_values, num_rows);
-
-            for (size_t i = 0; i < num_rows; ++i) {
-                _channel_row_idx_start_points[_shuffle_channel_ids[i]]++;
-            }
-            // NOTE:
-            // we make the last item equal with number of rows of this chunk
-            for (int32_t i = 1; i <= _num_shuffles; ++i) {
-                _channel_row_idx_start_points[i] += _channel_row_idx_start_points[i - 1];
-            }
-
-            for (int32_t i = num_rows - 1; i >= 0; --i) {
-                _row_indexes[_channel_row_idx_start_points[_shuffle_channel_ids[i]] - 1] = i;
-                _channel_row_idx_start_points[_shuffle_channel_ids[i]]--;
-            }
+            Shuffler::build_row_indexes(_shuffle_channel_ids, num_rows, _num_shuffles, _channel_row_idx_start_points,
+                                        _row_indexes.data());
         }
 
         for (int32_t channel_id : _channel_indices) {
@@ -570,7 +608,8 @@ Status ExchangeSinkOperator::set_finishing(RuntimeState* state) {
 
     if (_chunk_request != nullptr) {
         butil::IOBuf attachment;
-        int64_t attachment_physical_bytes = construct_brpc_attachment(_chunk_request, attachment);
+        int64_t attachment_physical_bytes =
+                _take_attachment(_chunk_request, &_attachment, &_attachment_physical_bytes, attachment);
         for (const auto& [_, channel] : _instance_id2channel) {
             PTransmitChunkParamsPtr copy = std::make_shared<PTransmitChunkParams>(*_chunk_request);
             channel->send_chunk_request(copy, attachment, attachment_physical_bytes);
@@ -592,8 +631,29 @@ void ExchangeSinkOperator::close(RuntimeState* state) {
     Operator::close(state);
 }
 
+const BlockCompressionCodec* ExchangeSinkOperator::_choose_codec(ExchangeCompressionSelector* selector) {
+    if (selector == nullptr) {
+        return _compress_codec;
+    }
+    const BlockCompressionCodec* codec = selector->next_codec();
+    if (codec == nullptr) {
+        COUNTER_UPDATE(_adaptive_uncompressed_chunks, 1);
+    } else if (codec->type() == CompressionTypePB::ZSTD) {
+        COUNTER_UPDATE(_adaptive_zstd_chunks, 1);
+    } else {
+        COUNTER_UPDATE(_adaptive_lz4_chunks, 1);
+    }
+    return codec;
+}
+
 Status ExchangeSinkOperator::serialize_chunk(const vectorized::Chunk* src, ChunkPB* dst, bool* is_first_chunk,
-                                             int num_receivers) {
+                                             int num_receivers, ExchangeCompressionSelector* selector) {
+    return _serialize_chunk(src, dst, is_first_chunk, num_receivers, _choose_codec(selector), selector);
+}
+
+Status ExchangeSinkOperator::_serialize_chunk(const vectorized::Chunk* src, ChunkPB* dst, bool* is_first_chunk,
+                                              int num_receivers, const BlockCompressionCodec* codec,
+                                              ExchangeCompressionSelector* selector) {
     VLOG_ROW << "[ExchangeSinkOperator] serializing " << src->num_rows() << " rows";
     {
         SCOPED_TIMER(_serialize_chunk_timer);
@@ -613,22 +673,21 @@ Status ExchangeSinkOperator::serialize_chunk(const vectorized::Chunk* src, Chunk
     DCHECK_EQ(dst->uncompressed_size(), dst->data().size());
     const size_t uncompressed_size = dst->uncompressed_size();
 
-    if (_compress_codec != nullptr && _compress_codec->exceed_max_input_size(uncompressed_size)) {
+    if (codec != nullptr && codec->exceed_max_input_size(uncompressed_size)) {
         return Status::InternalError(strings::Substitute("The input size for compression should be less than $0",
-                                                         _compress_codec->max_input_size()));
+                                                         codec->max_input_size()));
     }
 
     // try compress the ChunkPB data
-    if (_compress_codec != nullptr && uncompressed_size > 0) {
+    if (codec != nullptr && uncompressed_size > 0) {
         SCOPED_TIMER(_compress_timer);
 
-        if (use_compression_pool(_compress_codec->type())) {
+        if (use_compression_pool(codec->type())) {
             Slice compressed_slice;
             Slice input(dst->data());
-            _compress_codec->compress(input, &compressed_slice, true, uncompressed_size, nullptr,
-                                      &_compression_scratch);
+            codec->compress(input, &compressed_slice, true, uncompressed_size, nullptr, &_compression_scratch);
         } else {
-            int max_compressed_size = _compress_codec->max_compressed_len(uncompressed_size);
+            int max_compressed_size = codec->max_compressed_len(uncompressed_size);
 
             if (_compression_scratch.size() < max_compressed_size) {
                 _compression_scratch.resize(max_compressed_size);
@@ -637,14 +696,17 @@ Status ExchangeSinkOperator::serialize_chunk(const vectorized::Chunk* src, Chunk
             Slice compressed_slice{_compression_scratch.data(), _compression_scratch.size()};
 
             Slice input(dst->data());
-            _compress_codec->compress(input, &compressed_slice);
+            codec->compress(input, &compressed_slice);
             _compression_scratch.resize(compressed_slice.size);
         }
+        if (selector != nullptr) {
+            selector->update(uncompressed_size, _compression_scratch.size());
+        }
 
         double compress_ratio = (static_cast<double>(uncompressed_size)) / _compression_scratch.size();
         if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
             dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
-            dst->set_compress_type(_compress_type);
+            dst->set_compress_type(codec->type());
         }
 
         VLOG_ROW << "uncompressed size: " << uncompressed_size << ", compressed size: " << _compression_scratch.size();
@@ -656,6 +718,78 @@ Status ExchangeSinkOperator::serialize_chunk(const vectorized::Chunk* src, Chunk
     return Status::OK();
 }
 
+StatusOr<int64_t> ExchangeSinkOperator::serialize_chunk_to_attachment(const vectorized::Chunk* src, ChunkPB* dst,
+                                                                      bool* is_first_chunk, butil::IOBuf* attachment,
+                                                                      int64_t* attachment_physical_bytes,
+                                                                      int num_receivers,
+                                                                      ExchangeCompressionSelector* selector) {
+    const BlockCompressionCodec* codec = _choose_codec(selector);
+    if (codec != nullptr) {
+        // The data is compressed into a string, and the compressed data is usually small enough
+        // to be copied to the attachment cheaply.
+        RETURN_IF_ERROR(_serialize_chunk(src, dst, is_first_chunk, num_receivers, codec, selector));
+        int64_t data_size = dst->data().size();
+        dst->set_data_size(data_size);
+
+        int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
+        attachment->append(dst->data());
+        *attachment_physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
+
+        dst->clear_data();
+        if (_is_large_chunk(data_size)) {
+            dst->mutable_data()->shrink_to_fit();
+        }
+        return data_size;
+    }
+
+    VLOG_ROW << "[ExchangeSinkOperator] serializing " << src->num_rows() << " rows to attachment";
+    int64_t data_size = 0;
+    {
+        SCOPED_TIMER(_serialize_chunk_timer);
+        data_size = serde::ProtobufChunkSerde::max_serialized_size(*src);
+
+        int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
+        // The buffer is owned by the attachment once appended, and freed after the RPC is done.
+        auto* buff = static_cast<uint8_t*>(malloc(data_size));
+        if (UNLIKELY(buff == nullptr)) {
+            return Status::MemoryAllocFailed(strings::Substitute("Failed to allocate $0 bytes to serialize chunk",
+                                                                 data_size));
+        }
+        Status st = serde::ProtobufChunkSerde::serialize_data(*src, buff, data_size, dst);
+        if (!st.ok()) {
+            free(buff);
+            return st;
+        }
+        if (attachment->append_user_data(buff, data_size, free) != 0) {
+            free(buff);
+            return Status::InternalError("Failed to append the serialized chunk to the attachment");
+        }
+        *attachment_physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
+
+        // We only serialize chunk meta for first chunk
+        if (*is_first_chunk) {
+            serde::ProtobufChunkSerde::serialize_meta(*src, dst);
+            *is_first_chunk = false;
+        }
+    }
+    dst->set_data_size(data_size);
+
+    COUNTER_UPDATE(_uncompressed_bytes_counter, data_size * num_receivers);
+    return data_size;
+}
+
+int64_t ExchangeSinkOperator::_take_attachment(const PTransmitChunkParamsPtr& chunk_request,
+                                               butil::IOBuf* pending_attachment, int64_t* pending_physical_bytes,
+                                               butil::IOBuf& attachment) {
+    if (!_use_zero_copy_attachment) {
+        return construct_brpc_attachment(chunk_request, attachment);
+    }
+    attachment.swap(*pending_attachment);
+    int64_t attachment_physical_bytes = *pending_physical_bytes;
+    *pending_physical_bytes = 0;
+    return attachment_physical_bytes;
+}
+
 int64_t ExchangeSinkOperator::construct_brpc_attachment(PTransmitChunkParamsPtr chunk_request,
                                                         butil::IOBuf& attachment) {
     int64_t attachment_physical_bytes = 0;
@@ -9,6 +9,7 @@
 #include "common/global_types.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "common/statusor.h"
 #include "exec/data_sink.h"
 #include "exec/pipeline/exchange/shuffler.h"
 #include "exec/pipeline/exchange/sink_buffer.h"
@@ -29,6 +30,7 @@ class BlockCompressionCodec;
 class ExprContext;
 
 namespace pipeline {
+class ExchangeCompressionSelector;
 class SinkBuffer;
 class ExchangeSinkOperator final : public Operator {
 public:
@@ -63,12 +65,35 @@ public:
 
     // For the first chunk , serialize the chunk data and meta to ChunkPB both.
     // For other chunk, only serialize the chunk data to ChunkPB.
-    Status serialize_chunk(const vectorized::Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers = 1);
+    // The data is compressed by the codec chosen by |selector|, or by the codec of the session if it's nullptr.
+    Status serialize_chunk(const vectorized::Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers = 1,
+                           ExchangeCompressionSelector* selector = nullptr);
+
+    // Like serialize_chunk(), but append the data to |attachment| instead of leaving it in |dst|.
+    // The uncompressed data is serialized into a buffer handed over to |attachment| without copy.
+    // Return the size of the appended data, and add the physical bytes of it to |attachment_physical_bytes|.
+    StatusOr<int64_t> serialize_chunk_to_attachment(const vectorized::Chunk* chunk, ChunkPB* dst,
+                                                    bool* is_first_chunk, butil::IOBuf* attachment,
+                                                    int64_t* attachment_physical_bytes, int num_receivers = 1,
+                                                    ExchangeCompressionSelector* selector = nullptr);
 
     // Return the physical bytes of attachment.
     int64_t construct_brpc_attachment(PTransmitChunkParamsPtr _chunk_request, butil::IOBuf& attachment);
 
+    // Whether the chunks are appended to the attachment as soon as they are serialized,
+    // see serialize_chunk_to_attachment().
+    bool use_zero_copy_attachment() const { return _use_zero_copy_attachment; }
+
 private:
+    const BlockCompressionCodec* _choose_codec(ExchangeCompressionSelector* selector);
+    Status _serialize_chunk(const vectorized::Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers,
+                            const BlockCompressionCodec* codec, ExchangeCompressionSelector* selector);
+
+    // Fill |attachment| with the data of the chunks in |chunk_request|, which are either in the chunks or in
+    // |pending_attachment| if _use_zero_copy_attachment. Return the physical bytes of attachment.
+    int64_t _take_attachment(const PTransmitChunkParamsPtr& chunk_request, butil::IOBuf* pending_attachment,
+                             int64_t* pending_physical_bytes, butil::IOBuf& attachment);
+
     bool _is_large_chunk(size_t sz) const {
         // ref olap_scan_node.cpp release_large_columns
         return sz > runtime_state()->chunk_size() * 512;
@@ -144,8 +169,12 @@ private:
     // Only used when broadcast
     PTransmitChunkParamsPtr _chunk_request;
     size_t _current_request_bytes = 0;
+    // The data of the chunks in _chunk_request if _use_zero_copy_attachment.
+    butil::IOBuf _attachment;
+    int64_t _attachment_physical_bytes = 0;
 
     bool _is_first_chunk = true;
+    bool _use_zero_copy_attachment = false;
 
     // String to write compressed chunk data in serialize().
     // This is a string so we can swap() with the string in the ChunkPB we're serializing
@@ -155,12 +184,19 @@ private:
 
     CompressionTypePB _compress_type = CompressionTypePB::NO_COMPRESSION;
     const BlockCompressionCodec* _compress_codec = nullptr;
+    // If true, each channel picks its own codec, see ExchangeCompressionSelector.
+    bool _use_adaptive_compression = false;
+    // Picks the codec of broadcast, whose request is shared by all the channels.
+    std::unique_ptr<ExchangeCompressionSelector> _compression_selector;
 
     RuntimeProfile::Counter* _serialize_chunk_timer = nullptr;
     RuntimeProfile::Counter* _shuffle_hash_timer = nullptr;
     RuntimeProfile::Counter* _compress_timer = nullptr;
     RuntimeProfile::Counter* _bytes_pass_through_counter = nullptr;
     RuntimeProfile::Counter* _uncompressed_bytes_counter = nullptr;
+    RuntimeProfile::Counter* _adaptive_lz4_chunks = nullptr;
+    RuntimeProfile::Counter* _adaptive_zstd_chunks = nullptr;
+    RuntimeProfile::Counter* _adaptive_uncompressed_chunks = nullptr;
 
     std::atomic<bool> _is_finished = false;
     std::atomic<bool> _is_cancelled = false;
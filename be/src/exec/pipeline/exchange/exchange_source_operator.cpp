@@ -12,9 +12,17 @@ namespace starrocks::pipeline {
 Status ExchangeSourceOperator::prepare(RuntimeState* state) {
     SourceOperator::prepare(state);
     _stream_recvr = static_cast<ExchangeSourceOperatorFactory*>(_factory)->create_stream_recvr(state, _unique_metrics);
+    _stream_recvr->set_ready_observer_for_pipeline(_driver_sequence, [this] { notify_ready(); });
     return Status::OK();
 }
 
+void ExchangeSourceOperator::close(RuntimeState* state) {
+    if (_stream_recvr != nullptr) {
+        _stream_recvr->set_ready_observer_for_pipeline(_driver_sequence, nullptr);
+    }
+    SourceOperator::close(state);
+}
+
 bool ExchangeSourceOperator::has_output() const {
     return _stream_recvr->has_output_for_pipeline(_driver_sequence);
 }
@@ -19,10 +19,15 @@ public:
 
     Status prepare(RuntimeState* state) override;
 
+    void close(RuntimeState* state) override;
+
     bool has_output() const override;
 
     bool is_finished() const override;
 
+    // Notified by DataStreamRecvr when chunks are received or the stream ends.
+    bool supports_ready_notification() const override { return true; }
+
     Status set_finishing(RuntimeState* state) override;
 
     StatusOr<vectorized::ChunkPtr> pull_chunk(RuntimeState* state) override;
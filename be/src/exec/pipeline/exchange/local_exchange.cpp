@@ -42,19 +42,8 @@ Status PartitionExchanger::Partitioner::partition_chunk(const vectorized::ChunkP
 
     _shuffler->local_exchange_shuffle(_shuffle_channel_id, _hash_values, num_rows);
 
-    _partition_row_indexes_start_points.assign(num_partitions + 1, 0);
-    for (size_t i = 0; i < num_rows; ++i) {
-        _partition_row_indexes_start_points[_shuffle_channel_id[i]]++;
-    }
-    // We make the last item equal with number of rows of this chunk.
-    for (int32_t i = 1; i <= num_partitions; ++i) {
-        _partition_row_indexes_start_points[i] += _partition_row_indexes_start_points[i - 1];
-    }
-
-    for (int32_t i = num_rows - 1; i >= 0; --i) {
-        partition_row_indexes[_partition_row_indexes_start_points[_shuffle_channel_id[i]] - 1] = i;
-        _partition_row_indexes_start_points[_shuffle_channel_id[i]]--;
-    }
+    Shuffler::build_row_indexes(_shuffle_channel_id, num_rows, num_partitions, _partition_row_indexes_start_points,
+                                partition_row_indexes.data());
 
     return Status::OK();
 }
@@ -98,8 +87,10 @@ Status PartitionExchanger::accept(const vectorized::ChunkPtr& chunk, const int32
 }
 
 Status BroadcastExchanger::accept(const vectorized::ChunkPtr& chunk, const int32_t sink_driver_sequence) {
-    for (auto* source : _source->get_sources()) {
-        source->add_chunk(chunk);
+    // Each source gets its own chunk sharing the columns, which are copied only if the source mutates them.
+    const auto& sources = _source->get_sources();
+    for (size_t i = 0; i < sources.size(); i++) {
+        sources[i]->add_chunk(i + 1 == sources.size() ? chunk : vectorized::ChunkPtr(chunk->clone_shallow()));
     }
     return Status::OK();
 }
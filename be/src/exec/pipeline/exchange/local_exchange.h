@@ -96,7 +96,7 @@ class PartitionExchanger final : public LocalExchanger {
         // And the last item is the number of rows of the current shuffle chunk.
         // It will easy to get number of rows belong to one channel by doing
         // _partition_row_indexes_start_points[i + 1] - _partition_row_indexes_start_points[i]
-        std::vector<size_t> _partition_row_indexes_start_points;
+        std::vector<uint32_t> _partition_row_indexes_start_points;
         std::unique_ptr<Shuffler> _shuffler;
     };
 
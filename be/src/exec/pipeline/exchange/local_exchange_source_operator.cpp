@@ -10,12 +10,17 @@ namespace starrocks::pipeline {
 // Used for PassthroughExchanger.
 // The input chunk is most likely full, so we don't merge it to avoid copying chunk data.
 Status LocalExchangeSourceOperator::add_chunk(vectorized::ChunkPtr chunk) {
-    std::lock_guard<std::mutex> l(_chunk_lock);
     if (_is_finished) {
         return Status::OK();
     }
-    _memory_manager->update_row_count(chunk->num_rows());
-    _full_chunk_queue.emplace(std::move(chunk));
+    auto num_rows = static_cast<int32_t>(chunk->num_rows());
+    // Count the rows before the chunk is visible to pull_chunk(), which uncounts them.
+    _memory_manager->update_row_count(num_rows);
+    if (!_full_chunk_queue.put(std::move(chunk))) {
+        _memory_manager->update_row_count(-num_rows);
+        return Status::OK();
+    }
+    notify_ready();
 
     return Status::OK();
 }
@@ -25,47 +30,47 @@ Status LocalExchangeSourceOperator::add_chunk(vectorized::ChunkPtr chunk) {
 Status LocalExchangeSourceOperator::add_chunk(vectorized::ChunkPtr chunk,
                                               std::shared_ptr<std::vector<uint32_t>> indexes, uint32_t from,
                                               uint32_t size) {
-    std::lock_guard<std::mutex> l(_chunk_lock);
     if (_is_finished) {
         return Status::OK();
     }
     _memory_manager->update_row_count(size);
-    _partition_chunk_queue.emplace(std::move(chunk), std::move(indexes), from, size);
-    _partition_rows_num += size;
+    if (!_partition_chunk_queue.put(PartitionChunk(std::move(chunk), std::move(indexes), from, size))) {
+        _memory_manager->update_row_count(-static_cast<int32_t>(size));
+        return Status::OK();
+    }
+    const auto chunk_size = static_cast<int64_t>(_factory->runtime_state()->chunk_size());
+    int64_t prev_rows_num = _partition_rows_num.fetch_add(size);
+    // has_output() waits for a full chunk of rows, so only notify when the rows reach it.
+    if (prev_rows_num + size >= chunk_size && prev_rows_num < chunk_size) {
+        notify_ready();
+    }
 
     return Status::OK();
 }
 
 bool LocalExchangeSourceOperator::is_finished() const {
-    std::lock_guard<std::mutex> l(_chunk_lock);
-
-    return _is_finished && _full_chunk_queue.empty() && !_partition_rows_num;
+    return _is_finished && _full_chunk_queue.empty() && _partition_rows_num <= 0;
 }
 
 bool LocalExchangeSourceOperator::has_output() const {
-    std::lock_guard<std::mutex> l(_chunk_lock);
-
-    return !_full_chunk_queue.empty() || _partition_rows_num >= _factory->runtime_state()->chunk_size() ||
-           (_is_finished && _partition_rows_num > 0);
+    int64_t partition_rows_num = _partition_rows_num;
+    return !_full_chunk_queue.empty() || partition_rows_num >= _factory->runtime_state()->chunk_size() ||
+           (_is_finished && partition_rows_num > 0);
 }
 
 Status LocalExchangeSourceOperator::set_finished(RuntimeState* state) {
-    std::lock_guard<std::mutex> l(_chunk_lock);
     _is_finished = true;
-    // Compute out the number of rows of the _full_chunk_queue.
-    size_t full_rows_num = 0;
-    while (!_full_chunk_queue.empty()) {
-        auto chunk = std::move(_full_chunk_queue.front());
-        _full_chunk_queue.pop();
-        full_rows_num += chunk->num_rows();
+    // Drop the buffered chunks, and subtract their rows from row_count of _memory_manager to make it unblocked.
+    // The sinks adding chunks concurrently drop their chunks by themselves once the queues are shutdown.
+    _full_chunk_queue.shutdown();
+    _partition_chunk_queue.shutdown();
+    _full_chunk_queue.clear();
+    _partition_chunk_queue.clear();
+    if (_pending_partition_chunk.has_value()) {
+        _memory_manager->update_row_count(-static_cast<int32_t>(_pending_partition_chunk->size));
+        _partition_rows_num -= _pending_partition_chunk->size;
+        _pending_partition_chunk.reset();
     }
-    // clear _full_chunk_queue
-    { [[maybe_unused]] typeof(_full_chunk_queue) tmp = std::move(_full_chunk_queue); }
-    // clear _partition_chunk_queue
-    { [[maybe_unused]] typeof(_partition_chunk_queue) tmp = std::move(_partition_chunk_queue); }
-    // Subtract the number of rows of buffered chunks from row_count of _memory_manager and make it unblocked.
-    _memory_manager->update_row_count(-(full_rows_num + _partition_rows_num));
-    _partition_rows_num = 0;
     return Status::OK();
 }
 
@@ -74,46 +79,50 @@ StatusOr<vectorized::ChunkPtr> LocalExchangeSourceOperator::pull_chunk(RuntimeSt
     if (chunk == nullptr) {
         chunk = _pull_shuffle_chunk(state);
     }
+    if (chunk == nullptr) {
+        return nullptr;
+    }
     _memory_manager->update_row_count(-(static_cast<int32_t>(chunk->num_rows())));
     return std::move(chunk);
 }
 
 vectorized::ChunkPtr LocalExchangeSourceOperator::_pull_passthrough_chunk(RuntimeState* state) {
-    std::lock_guard<std::mutex> l(_chunk_lock);
-
-    if (!_full_chunk_queue.empty()) {
-        vectorized::ChunkPtr chunk = std::move(_full_chunk_queue.front());
-        _full_chunk_queue.pop();
+    vectorized::ChunkPtr chunk;
+    if (_full_chunk_queue.try_get(&chunk)) {
         return chunk;
     }
-
     return nullptr;
 }
 
 vectorized::ChunkPtr LocalExchangeSourceOperator::_pull_shuffle_chunk(RuntimeState* state) {
     std::vector<PartitionChunk> selected_partition_chunks;
     size_t rows_num = 0;
-    // Lock during pop partition chunks from queue.
-    {
-        std::lock_guard<std::mutex> l(_chunk_lock);
-
-        DCHECK(!_partition_chunk_queue.empty());
 
-        while (!_partition_chunk_queue.empty() &&
-               rows_num + _partition_chunk_queue.front().size <= state->chunk_size()) {
-            rows_num += _partition_chunk_queue.front().size;
-            selected_partition_chunks.emplace_back(std::move(_partition_chunk_queue.front()));
-            _partition_chunk_queue.pop();
+    // The pending partition chunk is merged first, it's the only one that may exceed chunk_size by itself.
+    if (_pending_partition_chunk.has_value()) {
+        rows_num += _pending_partition_chunk->size;
+        selected_partition_chunks.emplace_back(std::move(_pending_partition_chunk.value()));
+        _pending_partition_chunk.reset();
+    }
+    PartitionChunk partition_chunk;
+    while (rows_num < state->chunk_size() && _partition_chunk_queue.try_get(&partition_chunk)) {
+        if (!selected_partition_chunks.empty() && rows_num + partition_chunk.size > state->chunk_size()) {
+            _pending_partition_chunk.emplace(std::move(partition_chunk));
+            break;
         }
-        _partition_rows_num -= rows_num;
+        rows_num += partition_chunk.size;
+        selected_partition_chunks.emplace_back(std::move(partition_chunk));
+    }
+    _partition_rows_num -= rows_num;
+
+    if (selected_partition_chunks.empty()) {
+        return nullptr;
     }
 
-    // Unlock during merging partition chunks into a full chunk.
     vectorized::ChunkPtr chunk = selected_partition_chunks[0].chunk->clone_empty_with_slot();
     chunk->reserve(rows_num);
-    for (const auto& partition_chunk : selected_partition_chunks) {
-        chunk->append_selective(*partition_chunk.chunk, partition_chunk.indexes->data(), partition_chunk.from,
-                                partition_chunk.size);
+    for (const auto& selected : selected_partition_chunks) {
+        chunk->append_selective(*selected.chunk, selected.indexes->data(), selected.from, selected.size);
     }
 
     return chunk;
@@ -2,35 +2,48 @@
 
 #pragma once
 
-#include <mutex>
-#include <queue>
+#include <atomic>
+#include <optional>
 #include <utility>
 
 #include "exec/pipeline/exchange/local_exchange_memory_manager.h"
 #include "exec/pipeline/source_operator.h"
+#include "util/lock_free_queue.h"
 
 namespace starrocks::pipeline {
 class LocalExchangeSourceOperator final : public SourceOperator {
     class PartitionChunk {
     public:
+        // Dequeuing from LockFreeQueue needs a default constructed element to move into.
+        PartitionChunk() = default;
+
         PartitionChunk(vectorized::ChunkPtr chunk, std::shared_ptr<std::vector<uint32_t>> indexes, const uint32_t from,
                        const uint32_t size)
                 : chunk(std::move(chunk)), indexes(std::move(indexes)), from(from), size(size) {}
 
         PartitionChunk(const PartitionChunk&) = delete;
+        PartitionChunk& operator=(const PartitionChunk&) = delete;
 
         PartitionChunk(PartitionChunk&&) = default;
+        PartitionChunk& operator=(PartitionChunk&&) = default;
 
         vectorized::ChunkPtr chunk;
         std::shared_ptr<std::vector<uint32_t>> indexes;
-        const uint32_t from;
-        const uint32_t size;
+        uint32_t from = 0;
+        uint32_t size = 0;
     };
 
 public:
     LocalExchangeSourceOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
                                 const std::shared_ptr<LocalExchangeMemoryManager>& memory_manager)
             : SourceOperator(factory, id, "local_exchange_source", plan_node_id, driver_sequence),
+              _full_chunk_queue([this](const vectorized::ChunkPtr& chunk) {
+                  _memory_manager->update_row_count(-static_cast<int32_t>(chunk->num_rows()));
+              }),
+              _partition_chunk_queue([this](const PartitionChunk& partition_chunk) {
+                  _memory_manager->update_row_count(-static_cast<int32_t>(partition_chunk.size));
+                  _partition_rows_num.fetch_sub(partition_chunk.size);
+              }),
               _memory_manager(memory_manager) {}
 
     Status add_chunk(vectorized::ChunkPtr chunk);
@@ -42,10 +55,13 @@ public:
 
     bool is_finished() const override;
 
+    // Notified when a chunk is added or the sinks are finished.
+    bool supports_ready_notification() const override { return true; }
+
     Status set_finished(RuntimeState* state) override;
     Status set_finishing(RuntimeState* state) override {
-        std::lock_guard<std::mutex> l(_chunk_lock);
         _is_finished = true;
+        notify_ready();
         return Status::OK();
     }
 
@@ -56,13 +72,19 @@ private:
 
     vectorized::ChunkPtr _pull_shuffle_chunk(RuntimeState* state);
 
-    bool _is_finished = false;
-    std::queue<vectorized::ChunkPtr> _full_chunk_queue;
-    std::queue<PartitionChunk> _partition_chunk_queue;
-    size_t _partition_rows_num = 0;
+    // The chunks are added by multiple local exchange sinks and pulled by this operator only,
+    // so the queues are lock-free, and the rows dropped by set_finished() are returned to _memory_manager
+    // by the drop callbacks of the queues.
+    std::atomic<bool> _is_finished = false;
+    LockFreeQueue<vectorized::ChunkPtr> _full_chunk_queue;
+    LockFreeQueue<PartitionChunk> _partition_chunk_queue;
+    // The rows of _partition_chunk_queue and _pending_partition_chunk.
+    // Signed, because the rows are counted after the partition chunk is enqueued.
+    std::atomic<int64_t> _partition_rows_num = 0;
+    // The partition chunk dequeued but not merged by the last pull, because it would exceed chunk_size.
+    // Only accessed by the thread pulling this operator.
+    std::optional<PartitionChunk> _pending_partition_chunk;
 
-    // TODO(KKS): make it lock free
-    mutable std::mutex _chunk_lock;
     const std::shared_ptr<LocalExchangeMemoryManager>& _memory_manager;
 };
 
@@ -108,8 +108,10 @@ StatusOr<vectorized::ChunkPtr> MultiCastLocalExchanger::pull_chunk(RuntimeState*
     _progress[mcast_consumer_index] = cell;
     cell->used_count += 1;
 
+    // The consumers get their own chunks sharing the columns, which are copied only if a consumer mutates them.
+    vectorized::ChunkPtr chunk = cell->chunk->clone_shallow();
     _update_progress(cell);
-    return cell->chunk;
+    return chunk;
 }
 
 void MultiCastLocalExchanger::open_source_operator(int32_t mcast_consumer_index) {
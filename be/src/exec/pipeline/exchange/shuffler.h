@@ -3,6 +3,7 @@
 #pragma once
 
 #include <cstdint>
+#include <type_traits>
 #include <vector>
 
 #include "gen_cpp/Partitions_types.h"
@@ -47,6 +48,26 @@ public:
         (this->*_local_exchange_shuffle)(shuffle_channel_ids, hash_values, num_rows);
     }
 
+    // Arrange the row indexes by shuffle ids with a counting sort, then the rows of the i-th shuffle are
+    // row_indexes[start_points[i], start_points[i + 1]) in the original order.
+    // start_points has num_shuffles + 1 items, and the last one is num_rows.
+    static void build_row_indexes(const std::vector<uint32_t>& shuffle_ids, size_t num_rows, size_t num_shuffles,
+                                  std::vector<uint32_t>& start_points, uint32_t* row_indexes) {
+        start_points.assign(num_shuffles + 1, 0);
+        const uint32_t* __restrict ids = shuffle_ids.data();
+        uint32_t* __restrict counts = start_points.data();
+        for (size_t i = 0; i < num_rows; ++i) {
+            counts[ids[i]]++;
+        }
+        // Make the last item equal with the number of rows.
+        for (size_t i = 1; i <= num_shuffles; ++i) {
+            counts[i] += counts[i - 1];
+        }
+        for (int64_t i = static_cast<int64_t>(num_rows) - 1; i >= 0; --i) {
+            row_indexes[--counts[ids[i]]] = i;
+        }
+    }
+
 private:
     void (Shuffler::*_exchange_shuffle)(std::vector<uint32_t>& shuffle_channel_ids,
                                         const std::vector<uint32_t>& hash_values, size_t num_rows) = nullptr;
@@ -54,19 +75,34 @@ private:
     void (Shuffler::*_local_exchange_shuffle)(std::vector<uint32_t>& shuffle_channel_ids,
                                               std::vector<uint32_t>& hash_values, size_t num_rows) = nullptr;
 
+    // ModuloOp is computed by FastModuloOp to avoid a division per row,
+    // while ReduceOp is a multiplication and a shift, which the compiler vectorizes.
+    template <typename ReduceOp>
+    static auto _make_reducer(uint32_t r) {
+        if constexpr (std::is_same_v<ReduceOp, ModuloOp>) {
+            return FastModuloOp(r);
+        } else {
+            return [r](uint32_t l) { return ReduceOp()(l, r); };
+        }
+    }
+
     template <bool two_level_shuffle, typename ReduceOp>
     void exchange_shuffle(std::vector<uint32_t>& shuffle_channel_ids, const std::vector<uint32_t>& hash_values,
                           size_t num_rows) {
-        for (size_t i = 0; i < num_rows; ++i) {
-            size_t channel_id = ReduceOp()(hash_values[i], _num_channels);
-            size_t shuffle_id;
-            if constexpr (!two_level_shuffle) {
-                shuffle_id = channel_id;
-            } else {
-                uint32_t driver_sequence = ReduceOp()(HashUtil::xorshift32(hash_values[i]), _num_shuffles_per_channel);
-                shuffle_id = channel_id * _num_shuffles_per_channel + driver_sequence;
+        const uint32_t* __restrict hashes = hash_values.data();
+        uint32_t* __restrict shuffle_ids = shuffle_channel_ids.data();
+        const auto channel_reducer = _make_reducer<ReduceOp>(_num_channels);
+        if constexpr (!two_level_shuffle) {
+            for (size_t i = 0; i < num_rows; ++i) {
+                shuffle_ids[i] = channel_reducer(hashes[i]);
+            }
+        } else {
+            const auto driver_reducer = _make_reducer<ReduceOp>(_num_shuffles_per_channel);
+            for (size_t i = 0; i < num_rows; ++i) {
+                uint32_t channel_id = channel_reducer(hashes[i]);
+                uint32_t driver_sequence = driver_reducer(HashUtil::xorshift32(hashes[i]));
+                shuffle_ids[i] = channel_id * _num_shuffles_per_channel + driver_sequence;
             }
-            shuffle_channel_ids[i] = shuffle_id;
         }
     }
 
@@ -80,9 +116,11 @@ private:
     template <typename ReduceOp>
     void local_exchange_shuffle(std::vector<uint32_t>& shuffle_channel_ids, std::vector<uint32_t>& hash_values,
                                 size_t num_rows) {
-        for (int32_t i = 0; i < num_rows; ++i) {
-            uint32_t driver_sequence = ReduceOp()(HashUtil::xorshift32(hash_values[i]), _num_channels);
-            shuffle_channel_ids[i] = driver_sequence;
+        const uint32_t* __restrict hashes = hash_values.data();
+        uint32_t* __restrict shuffle_ids = shuffle_channel_ids.data();
+        const auto reducer = _make_reducer<ReduceOp>(_num_channels);
+        for (size_t i = 0; i < num_rows; ++i) {
+            shuffle_ids[i] = reducer(HashUtil::xorshift32(hashes[i]));
         }
     }
 
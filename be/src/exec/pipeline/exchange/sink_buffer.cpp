@@ -10,6 +10,7 @@ DIAGNOSTIC_IGNORE("-Wclass-memaccess")
 DIAGNOSTIC_POP
 
 #include "fmt/core.h"
+#include "util/hash_util.hpp"
 #include "util/time.h"
 #include "util/uid_util.h"
 
@@ -40,7 +41,9 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
             _num_finished_rpcs[instance_id.lo] = 0;
             _num_in_flight_rpcs[instance_id.lo] = 0;
             _network_times[instance_id.lo] = TimeTrace{};
-            _mutexes[instance_id.lo] = std::make_unique<Mutex>();
+            _network_throughputs[instance_id.lo] = std::make_unique<NetworkThroughput>();
+            _mutexes[instance_id.lo] = std::make_unique<Mutex>("sink_buffer");
+            _is_receiver_finished[instance_id.lo] = false;
 
             PUniqueId finst_id;
             finst_id.set_hi(instance_id.hi);
@@ -50,6 +53,28 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
     }
 
     _num_remaining_eos = _num_sinkers.size() * num_sinkers;
+
+    phmap::flat_hash_map<std::string, std::vector<int64_t>> host_instances;
+    for (const auto& dest : destinations) {
+        const auto& instance_id = dest.fragment_instance_id;
+        if (instance_id.lo == -1) {
+            continue;
+        }
+        auto& instances = host_instances[fmt::format("{}:{}", dest.brpc_server.hostname, dest.brpc_server.port)];
+        if (std::find(instances.begin(), instances.end(), instance_id.lo) == instances.end()) {
+            instances.push_back(instance_id.lo);
+        }
+    }
+    for (const auto& [_, instances] : host_instances) {
+        for (int64_t lo : instances) {
+            auto& peers = _same_host_instances[lo];
+            for (int64_t peer : instances) {
+                if (peer != lo) {
+                    peers.push_back(peer);
+                }
+            }
+        }
+    }
 }
 
 SinkBuffer::~SinkBuffer() {
@@ -73,7 +98,12 @@ void SinkBuffer::add_request(TransmitChunkInfo& request) {
     }
     {
         auto& instance_id = request.fragment_instance_id;
-        _try_to_send_rpc(instance_id, [&]() { _buffers[instance_id.lo].push(request); });
+        _try_to_send_rpc(instance_id, [&]() {
+            // The eos is still sent, which finishes the sinker.
+            if (!_is_receiver_finished[instance_id.lo] || request.params->eos()) {
+                _buffers[instance_id.lo].push(request);
+            }
+        });
     }
 }
 
@@ -136,6 +166,10 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
     auto* request_sent_counter = ADD_COUNTER(profile, "RequestSent", TUnit::UNIT);
     COUNTER_SET(bytes_sent_counter, _bytes_sent);
     COUNTER_SET(request_sent_counter, _request_sent);
+    if (_request_batched > 0) {
+        auto* request_batched_counter = ADD_COUNTER(profile, "RequestBatched", TUnit::UNIT);
+        COUNTER_SET(request_batched_counter, _request_batched);
+    }
 
     if (_bytes_enqueued - _bytes_sent > 0) {
         auto* bytes_unsent_counter = ADD_COUNTER(profile, "BytesUnsent", TUnit::BYTES);
@@ -172,10 +206,43 @@ void SinkBuffer::cancel_one_sinker() {
     }
 }
 
+int64_t SinkBuffer::NetworkThroughput::value() const {
+    int64_t t = time.load(std::memory_order_relaxed);
+    if (t <= 0) {
+        return 0;
+    }
+    return static_cast<int64_t>(bytes.load(std::memory_order_relaxed) * 1000000000.0 / t);
+}
+
+int64_t SinkBuffer::network_throughput(const TUniqueId& instance_id) const {
+    auto it = _network_throughputs.find(instance_id.lo);
+    return it == _network_throughputs.end() ? 0 : it->second->value();
+}
+
+int64_t SinkBuffer::min_network_throughput() const {
+    int64_t min = 0;
+    for (const auto& [_, throughput] : _network_throughputs) {
+        int64_t value = throughput->value();
+        if (value > 0 && (min == 0 || value < min)) {
+            min = value;
+        }
+    }
+    return min;
+}
+
 void SinkBuffer::_update_network_time(const TUniqueId& instance_id, const int64_t send_timestamp,
-                                      const int64_t receive_timestamp) {
+                                      const int64_t receive_timestamp, const int64_t attachment_bytes) {
     int32_t concurrency = _num_in_flight_rpcs[instance_id.lo];
     _network_times[instance_id.lo].update(receive_timestamp - send_timestamp, concurrency);
+
+    // The clocks of the two hosts may be skewed, ignore the samples which are obviously wrong.
+    int64_t network_time = receive_timestamp - send_timestamp;
+    if (network_time > 0 && attachment_bytes > 0) {
+        auto& throughput = *_network_throughputs[instance_id.lo];
+        // The concurrent RPCs to the same destination share the bandwidth.
+        throughput.bytes.fetch_add(attachment_bytes, std::memory_order_relaxed);
+        throughput.time.fetch_add(network_time / std::max(1, concurrency + 1), std::memory_order_relaxed);
+    }
 }
 
 void SinkBuffer::_process_send_window(const TUniqueId& instance_id, const int64_t sequence) {
@@ -194,6 +261,97 @@ void SinkBuffer::_process_send_window(const TUniqueId& instance_id, const int64_
     }
 }
 
+bool SinkBuffer::_too_much_brpc_process(int64_t instance_id_lo) {
+    if (_is_dest_merge) {
+        // discontinuous_acked_window_size means that we are not received all the ack
+        // with sequence from _max_continuous_acked_seqs[x] to _request_seqs[x]
+        // Limit the size of the window to avoid buffering too much out-of-order data at the receiving side
+        int64_t discontinuous_acked_window_size =
+                _request_seqs[instance_id_lo] - _max_continuous_acked_seqs[instance_id_lo];
+        return discontinuous_acked_window_size >= config::pipeline_sink_brpc_dop;
+    }
+    return _num_in_flight_rpcs[instance_id_lo] >= config::pipeline_sink_brpc_dop;
+}
+
+void SinkBuffer::_batch_requests_of_same_host(const TUniqueId& instance_id, TransmitChunkInfo& request,
+                                              ClosureContext* ctx, butil::IOBuf* attachment,
+                                              int64_t* attachment_physical_bytes) {
+    auto it = _same_host_instances.find(instance_id.lo);
+    if (it == _same_host_instances.end()) {
+        return;
+    }
+    size_t batched_bytes = request.attachment.size();
+    for (int64_t peer : it->second) {
+        if (batched_bytes >= config::max_transmit_batched_bytes) {
+            break;
+        }
+        std::unique_lock<Mutex> l(*_mutexes[peer], std::try_to_lock);
+        if (!l.owns_lock()) {
+            continue;
+        }
+        auto& buffer = _buffers[peer];
+        // The first request and the eos of a destination are always sent alone, because they are ordered
+        // against its other requests.
+        if (buffer.empty() || _num_finished_rpcs[peer] == 0 || _too_much_brpc_process(peer)) {
+            continue;
+        }
+        TransmitChunkInfo& peer_request = buffer.front();
+        if (peer_request.params->eos() || peer_request.brpc_stub != request.brpc_stub) {
+            continue;
+        }
+
+        *peer_request.params->mutable_finst_id() = _instance_id2finst_id[peer];
+        peer_request.params->set_sequence(++_request_seqs[peer]);
+        ++_num_in_flight_rpcs[peer];
+        ctx->batched_requests.emplace_back(peer_request.fragment_instance_id, peer_request.params->sequence());
+
+        if (!peer_request.attachment.empty()) {
+            _bytes_sent += peer_request.attachment.size();
+            _request_sent++;
+        }
+        _request_batched++;
+        batched_bytes += peer_request.attachment.size();
+        attachment->append(peer_request.attachment);
+        *attachment_physical_bytes += peer_request.attachment_physical_bytes;
+        request.params->add_batched_requests()->Swap(peer_request.params.get());
+
+        // The request memory is acquired by ExchangeSinkOperator, see pop_defer in _try_to_send_rpc.
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+        buffer.pop();
+    }
+}
+
+void SinkBuffer::_mark_receiver_finished(int64_t instance_id_lo) {
+    auto it = _mutexes.find(instance_id_lo);
+    if (it == _mutexes.end()) {
+        return;
+    }
+    std::lock_guard<Mutex> l(*it->second);
+    bool& finished = _is_receiver_finished[instance_id_lo];
+    if (!finished) {
+        finished = true;
+        _num_finished_receivers++;
+    }
+}
+
+void SinkBuffer::_finish_batched_requests(const ClosureContext& ctx, bool success, int64_t receive_timestamp) {
+    for (const auto& [peer_instance_id, sequence] : ctx.batched_requests) {
+        {
+            std::lock_guard<Mutex> l(*_mutexes[peer_instance_id.lo]);
+            ++_num_finished_rpcs[peer_instance_id.lo];
+            --_num_in_flight_rpcs[peer_instance_id.lo];
+        }
+        if (!success) {
+            continue;
+        }
+        const int64_t seq = sequence;
+        _try_to_send_rpc(peer_instance_id, [&]() {
+            _process_send_window(peer_instance_id, seq);
+            _update_network_time(peer_instance_id, ctx.send_timestamp, receive_timestamp, 0);
+        });
+    }
+}
+
 void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<void()> pre_works) {
     std::lock_guard<Mutex> l(*_mutexes[instance_id.lo]);
     pre_works();
@@ -208,18 +366,7 @@ void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<vo
 
         auto& buffer = _buffers[instance_id.lo];
 
-        bool too_much_brpc_process = false;
-        if (_is_dest_merge) {
-            // discontinuous_acked_window_size means that we are not received all the ack
-            // with sequence from _max_continuous_acked_seqs[x] to _request_seqs[x]
-            // Limit the size of the window to avoid buffering too much out-of-order data at the receiving side
-            int64_t discontinuous_acked_window_size =
-                    _request_seqs[instance_id.lo] - _max_continuous_acked_seqs[instance_id.lo];
-            too_much_brpc_process = discontinuous_acked_window_size >= config::pipeline_sink_brpc_dop;
-        } else {
-            too_much_brpc_process = _num_in_flight_rpcs[instance_id.lo] >= config::pipeline_sink_brpc_dop;
-        }
-        if (buffer.empty() || too_much_brpc_process) {
+        if (buffer.empty() || _too_much_brpc_process(instance_id.lo)) {
             return;
         }
 
@@ -282,28 +429,46 @@ void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<vo
             _request_sent++;
         }
 
-        auto* closure = new DisposableClosure<PTransmitChunkResult, ClosureContext>(
-                {instance_id, request.params->sequence(), GetCurrentTimeNanos()});
+        ClosureContext ctx{instance_id, request.params->sequence(), GetCurrentTimeNanos(),
+                           static_cast<int64_t>(request.attachment.size()), {}};
+        butil::IOBuf batched_attachment;
+        int64_t batched_physical_bytes = 0;
+        if (config::enable_exchange_rpc_batching && !request.params->eos()) {
+            _batch_requests_of_same_host(instance_id, request, &ctx, &batched_attachment, &batched_physical_bytes);
+        }
+        if (starrocks::debug::tls_trace_ctx.event_buffer != nullptr) {
+            ctx.trace_ctx = starrocks::debug::tls_trace_ctx;
+            ctx.trace_ctx.id = HashUtil::hash64(&ctx.sequence, sizeof(ctx.sequence), instance_id.lo);
+            QUERY_TRACE_ASYNC_START("transmit_chunk", "rpc", ctx.trace_ctx);
+        }
+
+        auto* closure = new DisposableClosure<PTransmitChunkResult, ClosureContext>(ctx);
 
         closure->addFailedHandler([this](const ClosureContext& ctx) noexcept {
+            QUERY_TRACE_ASYNC_FINISH("transmit_chunk", "rpc", ctx.trace_ctx);
             _is_finishing = true;
             {
                 std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
                 ++_num_finished_rpcs[ctx.instance_id.lo];
                 --_num_in_flight_rpcs[ctx.instance_id.lo];
             }
+            _finish_batched_requests(ctx, false, 0);
             --_total_in_flight_rpc;
             std::string err_msg = fmt::format("transmit chunk rpc failed:{}", print_id(ctx.instance_id));
             _fragment_ctx->cancel(Status::InternalError(err_msg));
             LOG(WARNING) << err_msg;
         });
         closure->addSuccessHandler([this](const ClosureContext& ctx, const PTransmitChunkResult& result) noexcept {
+            QUERY_TRACE_ASYNC_FINISH("transmit_chunk", "rpc", ctx.trace_ctx);
             Status status(result.status());
             {
                 std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
                 ++_num_finished_rpcs[ctx.instance_id.lo];
                 --_num_in_flight_rpcs[ctx.instance_id.lo];
             }
+            for (const auto& finst_id : result.finished_finst_ids()) {
+                _mark_receiver_finished(finst_id.lo());
+            }
             if (!status.ok()) {
                 _is_finishing = true;
                 _fragment_ctx->cancel(status);
@@ -312,9 +477,11 @@ void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<vo
             } else {
                 _try_to_send_rpc(ctx.instance_id, [&]() {
                     _process_send_window(ctx.instance_id, ctx.sequence);
-                    _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receive_timestamp());
+                    _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receive_timestamp(),
+                                         ctx.attachment_bytes);
                 });
             }
+            _finish_batched_requests(ctx, status.ok(), result.receive_timestamp());
             --_total_in_flight_rpc;
         });
 
@@ -323,12 +490,15 @@ void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<vo
 
         // Attachment will be released by process_mem_tracker in closure->Run() in bthread, when receiving the response,
         // so decrease the memory usage of attachment from instance_mem_tracker immediately before sending the request.
-        _mem_tracker->release(request.attachment_physical_bytes);
-        ExecEnv::GetInstance()->process_mem_tracker()->consume(request.attachment_physical_bytes);
+        _mem_tracker->release(request.attachment_physical_bytes + batched_physical_bytes);
+        ExecEnv::GetInstance()->process_mem_tracker()->consume(request.attachment_physical_bytes +
+                                                               batched_physical_bytes);
 
         closure->cntl.Reset();
         closure->cntl.set_timeout_ms(_brpc_timeout_ms);
         closure->cntl.request_attachment().append(request.attachment);
+        // The data of the batched requests follow the data of this request, see DataStreamMgr::transmit_chunk.
+        closure->cntl.request_attachment().append(batched_attachment);
 
         if (bthread_self()) {
             request.brpc_stub->transmit_chunk(&closure->cntl, request.params.get(), &closure->result, closure);
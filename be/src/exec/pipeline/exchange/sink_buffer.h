@@ -21,8 +21,10 @@ DIAGNOSTIC_POP
 #include "runtime/current_thread.h"
 #include "runtime/runtime_state.h"
 #include "util/brpc_stub_cache.h"
+#include "util/debug/query_trace.h"
 #include "util/defer_op.h"
 #include "util/disposable_closure.h"
+#include "util/lock_contention_profiler.h"
 #include "util/phmap/phmap.h"
 
 namespace starrocks::pipeline {
@@ -44,6 +46,12 @@ struct ClosureContext {
     TUniqueId instance_id;
     int64_t sequence;
     int64_t send_timestamp;
+    int64_t attachment_bytes;
+    // The instance ids and the sequences of the requests batched into this RPC,
+    // see SinkBuffer::_batch_requests_of_same_host().
+    std::vector<std::pair<TUniqueId, int64_t>> batched_requests;
+    // The trace context of the driver sending the RPC, whose event_buffer is null if the query isn't traced.
+    starrocks::debug::QueryTraceContext trace_ctx;
 };
 
 // TimeTrace is introduced to estimate time more accurately.
@@ -79,6 +87,12 @@ public:
     void set_finishing();
     bool is_finished() const;
 
+    // Whether the receivers of all the destinations have finished before receiving eos, e.g. by reaching the limit,
+    // see DataStreamMgr::mark_recvr_finished_early. Then the sinkers needn't produce data anymore.
+    bool is_all_receivers_finished() const {
+        return !_num_sinkers.empty() && _num_finished_receivers >= _num_sinkers.size();
+    }
+
     // Add counters to the given profile
     void update_profile(RuntimeProfile* profile);
 
@@ -86,11 +100,25 @@ public:
     // the rest chunk request and EOS request needn't be sent anymore.
     void cancel_one_sinker();
 
+    // The measured bytes per second transmitted to the destination |instance_id|, 0 if nothing is measured yet.
+    int64_t network_throughput(const TUniqueId& instance_id) const;
+    // The minimum measured network_throughput() among all the destinations, 0 if nothing is measured yet.
+    int64_t min_network_throughput() const;
+
 private:
-    using Mutex = bthread::Mutex;
+    using Mutex = ProfiledMutex<bthread::Mutex>;
+
+    // The attachment bytes and the network time, divided by the concurrency, of the finished RPCs
+    // to a destination. They are read by the sinkers without lock.
+    struct NetworkThroughput {
+        std::atomic<int64_t> bytes = 0;
+        std::atomic<int64_t> time = 0;
+
+        int64_t value() const;
+    };
 
     void _update_network_time(const TUniqueId& instance_id, const int64_t send_timestamp,
-                              const int64_t receive_timestamp);
+                              const int64_t receive_timestamp, const int64_t attachment_bytes);
     // Update the discontinuous acked window, here are the invariants:
     // all acks received with sequence from [0, _max_continuous_acked_seqs[x]]
     // not all the acks received with sequence from [_max_continuous_acked_seqs[x]+1, _request_seqs[x]]
@@ -101,6 +129,22 @@ private:
     // And we need to put this function and other extra works(pre_works) together as an atomic operation
     void _try_to_send_rpc(const TUniqueId& instance_id, std::function<void()> pre_works);
 
+    // Whether there are enough RPCs in flight to |instance_id| now. The mutex of |instance_id| must be held.
+    bool _too_much_brpc_process(int64_t instance_id_lo);
+
+    // Pack the first pending requests of the other destinations on the same host as |instance_id| into |request|,
+    // so a host running many instances of the destination fragment gets one RPC instead of one per instance.
+    // Only the destinations whose mutexes are not held by others right now are batched, to avoid deadlock.
+    // The mutex of |instance_id| must be held.
+    void _batch_requests_of_same_host(const TUniqueId& instance_id, TransmitChunkInfo& request, ClosureContext* ctx,
+                                      butil::IOBuf* attachment, int64_t* attachment_physical_bytes);
+
+    // Stop sending chunks to the destination whose receiver has finished.
+    void _mark_receiver_finished(int64_t instance_id_lo);
+
+    // Account the finish of the requests batched into the RPC of |ctx|.
+    void _finish_batched_requests(const ClosureContext& ctx, bool success, int64_t receive_timestamp);
+
     // Roughly estimate network time which is defined as the time between sending a and receiving a packet,
     // and the processing time of both sides are excluded
     // For each destination, we may send multiply packages at the same time, and the time is
@@ -140,7 +184,13 @@ private:
     phmap::flat_hash_map<int64_t, int32_t> _num_finished_rpcs;
     phmap::flat_hash_map<int64_t, int32_t> _num_in_flight_rpcs;
     phmap::flat_hash_map<int64_t, TimeTrace> _network_times;
+    phmap::flat_hash_map<int64_t, std::unique_ptr<NetworkThroughput>> _network_throughputs;
     phmap::flat_hash_map<int64_t, std::unique_ptr<Mutex>> _mutexes;
+    // Whether the receiver of each destination has finished, the chunks to it are dropped then.
+    phmap::flat_hash_map<int64_t, bool> _is_receiver_finished;
+    std::atomic<size_t> _num_finished_receivers = 0;
+    // The other destinations on the same host of each destination.
+    phmap::flat_hash_map<int64_t, std::vector<int64_t>> _same_host_instances;
 
     // True means that SinkBuffer needn't input chunk and send chunk anymore,
     // but there may be still in-flight RPC running.
@@ -161,6 +211,7 @@ private:
     std::atomic<int64_t> _request_enqueued = 0;
     std::atomic<int64_t> _bytes_sent = 0;
     std::atomic<int64_t> _request_sent = 0;
+    std::atomic<int64_t> _request_batched = 0;
 
     int64_t _pending_timestamp = -1;
     mutable std::atomic<int64_t> _last_full_timestamp = -1;
@@ -0,0 +1,74 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/pipeline/export_sink_operator.h"
+
+#include "column/chunk.h"
+#include "exec/file_builder.h"
+#include "exprs/expr.h"
+#include "gutil/casts.h"
+#include "runtime/export_sink.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+
+Status ExportSinkOperator::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(Operator::prepare(state));
+
+    _rows_written_counter = ADD_COUNTER(_unique_metrics, "RowsExported", TUnit::UNIT);
+    _write_timer = ADD_TIMER(_unique_metrics, "WriteTime");
+
+    // The drivers write the files of different numbers, so their names don't conflict.
+    std::string file_path;
+    ASSIGN_OR_RETURN(_file_builder,
+                     ExportSink::create_file_builder(_t_export_sink, _output_expr_ctxs, _driver_sequence,
+                                                     ExportSink::file_write_timeout_ms(state), &file_path));
+    down_cast<ExportSinkOperatorFactory*>(_factory)->add_export_output_file(state, file_path);
+    return Status::OK();
+}
+
+void ExportSinkOperator::close(RuntimeState* state) {
+    // Not finished if the driver is cancelled, the partial file is left to the export job to clean up.
+    _file_builder.reset();
+    Operator::close(state);
+}
+
+Status ExportSinkOperator::set_finishing(RuntimeState* state) {
+    _is_finished = true;
+    SCOPED_TIMER(_write_timer);
+    Status st = _file_builder->finish();
+    _file_builder.reset();
+    return st;
+}
+
+StatusOr<vectorized::ChunkPtr> ExportSinkOperator::pull_chunk(RuntimeState* state) {
+    return Status::InternalError("Shouldn't pull chunk from export sink operator");
+}
+
+Status ExportSinkOperator::push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) {
+    SCOPED_TIMER(_write_timer);
+    RETURN_IF_ERROR(_file_builder->add_chunk(chunk.get()));
+    COUNTER_UPDATE(_rows_written_counter, chunk->num_rows());
+    return Status::OK();
+}
+
+Status ExportSinkOperatorFactory::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(OperatorFactory::prepare(state));
+
+    RETURN_IF_ERROR(Expr::create_expr_trees(state->obj_pool(), _t_output_expr, &_output_expr_ctxs));
+    RETURN_IF_ERROR(Expr::prepare(_output_expr_ctxs, state));
+    RETURN_IF_ERROR(Expr::open(_output_expr_ctxs, state));
+
+    return Status::OK();
+}
+
+void ExportSinkOperatorFactory::close(RuntimeState* state) {
+    Expr::close(_output_expr_ctxs, state);
+    OperatorFactory::close(state);
+}
+
+void ExportSinkOperatorFactory::add_export_output_file(RuntimeState* state, const std::string& file_path) {
+    std::lock_guard l(_output_files_lock);
+    state->add_export_output_file(file_path);
+}
+
+} // namespace starrocks::pipeline
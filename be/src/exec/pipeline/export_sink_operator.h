@@ -0,0 +1,86 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <mutex>
+#include <utility>
+
+#include "exec/pipeline/fragment_context.h"
+#include "exec/pipeline/operator.h"
+#include "gen_cpp/DataSinks_types.h"
+
+namespace starrocks {
+class ExprContext;
+class FileBuilder;
+
+namespace pipeline {
+// Each driver of the export sink writes its own file, so the export scales with the degree of parallelism of the
+// last pipeline rather than funneling all the rows through one writer.
+class ExportSinkOperator final : public Operator {
+public:
+    ExportSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
+                       const TExportSink& t_export_sink, const std::vector<ExprContext*>& output_expr_ctxs)
+            : Operator(factory, id, "export_sink", plan_node_id, driver_sequence),
+              _t_export_sink(t_export_sink),
+              _output_expr_ctxs(output_expr_ctxs) {}
+
+    ~ExportSinkOperator() override = default;
+
+    Status prepare(RuntimeState* state) override;
+
+    void close(RuntimeState* state) override;
+
+    bool has_output() const override { return false; }
+
+    bool need_input() const override { return !_is_finished; }
+
+    bool is_finished() const override { return _is_finished; }
+
+    Status set_finishing(RuntimeState* state) override;
+
+    StatusOr<vectorized::ChunkPtr> pull_chunk(RuntimeState* state) override;
+
+    Status push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) override;
+
+private:
+    const TExportSink& _t_export_sink;
+    const std::vector<ExprContext*>& _output_expr_ctxs;
+
+    std::unique_ptr<FileBuilder> _file_builder;
+    bool _is_finished = false;
+
+    RuntimeProfile::Counter* _rows_written_counter = nullptr;
+    RuntimeProfile::Counter* _write_timer = nullptr;
+};
+
+class ExportSinkOperatorFactory final : public OperatorFactory {
+public:
+    ExportSinkOperatorFactory(int32_t id, TExportSink t_export_sink, std::vector<TExpr> t_output_expr)
+            : OperatorFactory(id, "export_sink", Operator::s_pseudo_plan_node_id_for_export_sink),
+              _t_export_sink(std::move(t_export_sink)),
+              _t_output_expr(std::move(t_output_expr)) {}
+
+    ~ExportSinkOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<ExportSinkOperator>(this, _id, _plan_node_id, driver_sequence, _t_export_sink,
+                                                    _output_expr_ctxs);
+    }
+
+    Status prepare(RuntimeState* state) override;
+
+    void close(RuntimeState* state) override;
+
+    // Called by the drivers to report their files, which share the RuntimeState of the fragment instance.
+    void add_export_output_file(RuntimeState* state, const std::string& file_path);
+
+private:
+    TExportSink _t_export_sink;
+    std::vector<TExpr> _t_output_expr;
+    std::vector<ExprContext*> _output_expr_ctxs;
+
+    std::mutex _output_files_lock;
+};
+
+} // namespace pipeline
+} // namespace starrocks
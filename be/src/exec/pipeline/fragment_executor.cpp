@@ -9,6 +9,7 @@
 #include "exec/pipeline/exchange/exchange_sink_operator.h"
 #include "exec/pipeline/exchange/multi_cast_local_exchange.h"
 #include "exec/pipeline/exchange/sink_buffer.h"
+#include "exec/pipeline/export_sink_operator.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/olap_table_sink_operator.h"
 #include "exec/pipeline/pipeline_builder.h"
@@ -29,8 +30,10 @@
 #include "runtime/data_stream_sender.h"
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
+#include "runtime/export_sink.h"
 #include "runtime/multi_cast_data_stream_sink.h"
 #include "runtime/result_sink.h"
+#include "storage/lake/tablet_manager.h"
 #include "util/debug/query_trace.h"
 #include "util/pretty_printer.h"
 #include "util/time.h"
@@ -164,7 +167,13 @@ Status FragmentExecutor::_prepare_workgroup(const UnifiedExecPlanFragmentParams&
             wg = WorkGroupManager::instance()->get_default_workgroup();
         }
         DCHECK(wg != nullptr);
-        RETURN_IF_ERROR(_query_ctx->init_query(wg.get()));
+        // The query memory limit set by the planner, if any, is the only estimate of the memory of the query here.
+        const auto& query_options = request.common().query_options;
+        int64_t estimated_mem_bytes = 0;
+        if (query_options.__isset.query_mem_limit && query_options.query_mem_limit > 0) {
+            estimated_mem_bytes = query_options.query_mem_limit;
+        }
+        RETURN_IF_ERROR(_query_ctx->init_query(wg.get(), estimated_mem_bytes));
         _wg = wg;
     }
     DCHECK(!_fragment_ctx->enable_resource_group() || _wg != nullptr);
@@ -217,19 +226,25 @@ Status FragmentExecutor::_prepare_runtime_state(ExecEnv* exec_env, const Unified
     auto* obj_pool = runtime_state->obj_pool();
     // Set up desc tbl
     DescriptorTbl* desc_tbl = nullptr;
-    if (t_desc_tbl.__isset.is_cached) {
-        if (t_desc_tbl.is_cached) {
-            desc_tbl = _query_ctx->desc_tbl();
-            if (desc_tbl == nullptr) {
-                return Status::Cancelled("Query terminates prematurely");
-            }
+    if (t_desc_tbl.__isset.is_cached && t_desc_tbl.is_cached) {
+        desc_tbl = _query_ctx->desc_tbl();
+        if (desc_tbl == nullptr) {
+            return Status::Cancelled("Query terminates prematurely");
+        }
+    } else {
+        // Reuse the table created by a previous query with the same plan fingerprint, if any.
+        ASSIGN_OR_RETURN(auto cached_desc_tbl,
+                         exec_env->query_context_mgr()->get_desc_tbl(t_desc_tbl, runtime_state->chunk_size()));
+        if (cached_desc_tbl != nullptr) {
+            desc_tbl = cached_desc_tbl->desc_tbl;
+            _query_ctx->hold_cached_desc_tbl(std::move(cached_desc_tbl));
         } else {
-            RETURN_IF_ERROR(DescriptorTbl::create(_query_ctx->object_pool(), t_desc_tbl, &desc_tbl,
-                                                  runtime_state->chunk_size()));
+            ObjectPool* pool = t_desc_tbl.__isset.is_cached ? _query_ctx->object_pool() : obj_pool;
+            RETURN_IF_ERROR(DescriptorTbl::create(pool, t_desc_tbl, &desc_tbl, runtime_state->chunk_size()));
+        }
+        if (t_desc_tbl.__isset.is_cached) {
             _query_ctx->set_desc_tbl(desc_tbl);
         }
-    } else {
-        RETURN_IF_ERROR(DescriptorTbl::create(obj_pool, t_desc_tbl, &desc_tbl, runtime_state->chunk_size()));
     }
     runtime_state->set_desc_tbl(desc_tbl);
 
@@ -268,6 +283,29 @@ int FragmentExecutor::_calc_query_expired_seconds(const UnifiedExecPlanFragmentP
     return QueryContext::DEFAULT_EXPIRE_SECONDS;
 }
 
+// The scan of a fragment instance can steal the scan ranges of the other instances, only if the rows read by an
+// instance need not stay in it, i.e. the fragment filters and projects them, at most pre-aggregating them
+// before an exchange. A join, a union or a finalizing aggregation may rely on where the tablets are read.
+static bool can_steal_morsels(const TPlan& plan) {
+    int num_aggregations = 0;
+    for (const auto& tnode : plan.nodes) {
+        switch (tnode.node_type) {
+        case TPlanNodeType::OLAP_SCAN_NODE:
+        case TPlanNodeType::PROJECT_NODE:
+        case TPlanNodeType::SELECT_NODE:
+            break;
+        case TPlanNodeType::AGGREGATION_NODE:
+            if (tnode.agg_node.need_finalize || ++num_aggregations > 1) {
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
 Status FragmentExecutor::_prepare_exec_plan(ExecEnv* exec_env, const UnifiedExecPlanFragmentParams& request) {
     auto* runtime_state = _fragment_ctx->runtime_state();
     auto* obj_pool = runtime_state->obj_pool();
@@ -281,6 +319,8 @@ Status FragmentExecutor::_prepare_exec_plan(ExecEnv* exec_env, const UnifiedExec
     bool enable_tablet_internal_parallel =
             query_options.__isset.enable_tablet_internal_parallel && query_options.enable_tablet_internal_parallel;
 
+    bool enable_morsel_stealing = config::enable_scan_morsel_stealing && can_steal_morsels(fragment.plan);
+
     // Set up plan
     RETURN_IF_ERROR(ExecNode::create_tree(runtime_state, obj_pool, fragment.plan, desc_tbl, &_fragment_ctx->plan()));
     ExecNode* plan = _fragment_ctx->plan();
@@ -301,6 +341,8 @@ Status FragmentExecutor::_prepare_exec_plan(ExecEnv* exec_env, const UnifiedExec
     std::vector<ExecNode*> scan_nodes;
     plan->collect_scan_nodes(&scan_nodes);
 
+    _prefetch_lake_metadata(exec_env, request, scan_nodes);
+
     MorselQueueFactoryMap& morsel_queue_factories = _fragment_ctx->morsel_queue_factories();
     for (auto& i : scan_nodes) {
         auto* scan_node = down_cast<ScanNode*>(i);
@@ -313,6 +355,11 @@ Status FragmentExecutor::_prepare_exec_plan(ExecEnv* exec_env, const UnifiedExec
 
         if (auto* olap_scan = dynamic_cast<vectorized::OlapScanNode*>(scan_node)) {
             olap_scan->enable_shared_scan(enable_shared_scan && morsel_queue_factory->is_shared());
+
+            auto* shared_factory = dynamic_cast<SharedMorselQueueFactory*>(morsel_queue_factory.get());
+            if (enable_morsel_stealing && shared_factory != nullptr && shared_factory->can_steal_morsels()) {
+                shared_factory->enable_morsel_stealing(_query_ctx->morsel_queue_steal_pool(scan_node->id()));
+            }
         }
 
         morsel_queue_factories.emplace(scan_node->id(), std::move(morsel_queue_factory));
@@ -346,6 +393,39 @@ Status FragmentExecutor::_prepare_exec_plan(ExecEnv* exec_env, const UnifiedExec
     return Status::OK();
 }
 
+void FragmentExecutor::_prefetch_lake_metadata(ExecEnv* exec_env, const UnifiedExecPlanFragmentParams& request,
+                                               const std::vector<ExecNode*>& scan_nodes) {
+    if (!config::lake_enable_metadata_prefetch || exec_env->lake_tablet_manager() == nullptr) {
+        return;
+    }
+    std::vector<std::pair<int64_t, int64_t>> tablets;
+    auto add_tablets = [&](const std::vector<TScanRangeParams>& scan_ranges) {
+        for (const auto& scan_range : scan_ranges) {
+            if (scan_range.scan_range.__isset.internal_scan_range) {
+                const auto& range = scan_range.scan_range.internal_scan_range;
+                tablets.emplace_back(range.tablet_id, strtoll(range.version.c_str(), nullptr, 10));
+            }
+        }
+    };
+    for (auto* scan_node : scan_nodes) {
+        if (scan_node->type() != TPlanNodeType::LAKE_SCAN_NODE) {
+            continue;
+        }
+        add_tablets(request.scan_ranges_of_node(scan_node->id()));
+        for (const auto& [_, scan_ranges] : request.per_driver_seq_scan_ranges_of_node(scan_node->id())) {
+            add_tablets(scan_ranges);
+        }
+    }
+    // A single tablet gains nothing from the parallelism.
+    if (tablets.size() <= 1) {
+        return;
+    }
+    auto st = exec_env->lake_tablet_manager()->prefetch_metadata(tablets, true);
+    // Not fatal, the scan loads the metadata again and reports the error if any.
+    LOG_IF(WARNING, !st.ok()) << "Fail to prefetch the metadata of lake tablets of fragment "
+                              << print_id(request.fragment_instance_id()) << ": " << st;
+}
+
 Status FragmentExecutor::_prepare_pipeline_driver(ExecEnv* exec_env, const UnifiedExecPlanFragmentParams& request) {
     const auto fragment_instance_id = request.fragment_instance_id();
     const auto degree_of_parallelism = _calc_dop(exec_env, request);
@@ -576,6 +656,7 @@ Status FragmentExecutor::_decompose_data_sink_to_operator(RuntimeState* runtime_
         // Result sink doesn't have plan node id;
         OpFactoryPtr op =
                 std::make_shared<ResultSinkOperatorFactory>(context->next_operator_id(), result_sink->get_sink_type(),
+                                                            result_sink->get_num_result_partitions(),
                                                             result_sink->get_output_exprs(), fragment_ctx);
         // Add result sink operator to last pipeline
         fragment_ctx->pipelines().back()->add_op_factory(op);
@@ -640,6 +721,34 @@ Status FragmentExecutor::_decompose_data_sink_to_operator(RuntimeState* runtime_
         runtime_state->set_num_per_fragment_instances(request.common().params.num_senders);
         OpFactoryPtr op =
                 std::make_shared<OlapTableSinkOperatorFactory>(context->next_operator_id(), datasink, fragment_ctx);
+        auto& last_pipeline = fragment_ctx->pipelines().back();
+        const int dop = last_pipeline->source_operator_factory()->degree_of_parallelism();
+        if (dop == 1) {
+            last_pipeline->add_op_factory(op);
+            return Status::OK();
+        }
+
+        // The fragment instance is one sender of the load, so the drivers of the last pipeline, e.g. the scan and
+        // the projection of INSERT INTO SELECT, run in parallel, and their chunks are gathered by a local
+        // passthrough exchange into the single driver of the sink.
+        auto pseudo_plan_node_id = context->next_pseudo_plan_node_id();
+        auto mem_mgr = std::make_shared<LocalExchangeMemoryManager>(
+                runtime_state->chunk_size() * dop * PipelineBuilderContext::kLocalExchangeBufferChunks);
+        auto local_exchange_source = std::make_shared<LocalExchangeSourceOperatorFactory>(
+                context->next_operator_id(), pseudo_plan_node_id, mem_mgr);
+        local_exchange_source->set_runtime_state(runtime_state);
+        local_exchange_source->set_degree_of_parallelism(1);
+        auto local_exchange = std::make_shared<PassthroughExchanger>(mem_mgr, local_exchange_source.get());
+        last_pipeline->add_op_factory(std::make_shared<LocalExchangeSinkOperatorFactory>(
+                context->next_operator_id(), pseudo_plan_node_id, local_exchange));
+
+        OpFactories ops{std::move(local_exchange_source), std::move(op)};
+        fragment_ctx->pipelines().emplace_back(std::make_shared<Pipeline>(context->next_pipe_id(), ops));
+    } else if (typeid(*datasink) == typeid(starrocks::ExportSink)) {
+        // Each driver of the last pipeline writes its own file.
+        ExportSink* export_sink = down_cast<starrocks::ExportSink*>(datasink.get());
+        OpFactoryPtr op = std::make_shared<ExportSinkOperatorFactory>(
+                context->next_operator_id(), export_sink->t_export_sink(), export_sink->output_exprs());
         fragment_ctx->pipelines().back()->add_op_factory(op);
     }
 
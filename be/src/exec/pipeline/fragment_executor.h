@@ -11,6 +11,7 @@
 namespace starrocks {
 class DataSink;
 class ExecEnv;
+class ExecNode;
 class RuntimeProfile;
 class TPlanFragmentExecParams;
 class RuntimeState;
@@ -94,6 +95,9 @@ private:
     Status _prepare_workgroup(const UnifiedExecPlanFragmentParams& request);
     Status _prepare_runtime_state(ExecEnv* exec_env, const UnifiedExecPlanFragmentParams& request);
     Status _prepare_exec_plan(ExecEnv* exec_env, const UnifiedExecPlanFragmentParams& request);
+    // Load the metadata of all the lake tablets to scan in parallel, which are loaded one by one otherwise.
+    void _prefetch_lake_metadata(ExecEnv* exec_env, const UnifiedExecPlanFragmentParams& request,
+                                 const std::vector<ExecNode*>& scan_nodes);
     Status _prepare_global_dict(const UnifiedExecPlanFragmentParams& request);
     Status _prepare_pipeline_driver(ExecEnv* exec_env, const UnifiedExecPlanFragmentParams& request);
 
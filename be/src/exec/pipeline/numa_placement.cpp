@@ -0,0 +1,47 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/pipeline/numa_placement.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "util/cpu_info.h"
+#include "util/hash_util.hpp"
+
+namespace starrocks::pipeline {
+
+int num_placement_numa_nodes() {
+    static const int num_nodes = config::enable_pipeline_numa_aware ? CpuInfo::get_max_num_numa_nodes() : 1;
+    return num_nodes;
+}
+
+int numa_node_of_fragment_instance(const TUniqueId& fragment_instance_id) {
+    int num_nodes = num_placement_numa_nodes();
+    if (num_nodes <= 1) {
+        return 0;
+    }
+    return std::hash<TUniqueId>()(fragment_instance_id) % num_nodes;
+}
+
+void bind_current_thread_to_numa_node(int node) {
+    if (num_placement_numa_nodes() <= 1) {
+        return;
+    }
+    const auto& cores = CpuInfo::get_cores_of_numa_node(node);
+    if (cores.empty()) {
+        return;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int core : cores) {
+        CPU_SET(core, &cpu_set);
+    }
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (ret != 0) {
+        LOG(WARNING) << "Failed to bind thread to NUMA node " << node << ", error=" << ret;
+    }
+}
+
+} // namespace starrocks::pipeline
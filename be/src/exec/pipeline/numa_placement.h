@@ -0,0 +1,25 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include "gen_cpp/Types_types.h"
+
+namespace starrocks::pipeline {
+
+// NUMA-aware placement of the pipeline engine, enabled by config::enable_pipeline_numa_aware.
+//
+// The executor threads and the scan threads are partitioned by NUMA node and pinned to the cores of
+// their node. All the drivers and the scan tasks of a fragment instance are placed on the same node,
+// chosen by the hash of the fragment instance id. Since Linux allocates a page on the node of the
+// thread first touching it, the chunks of a fragment instance are allocated on its node as well.
+
+// Return the number of NUMA nodes used for placement, it is 1 if the placement is disabled.
+int num_placement_numa_nodes();
+
+// Return the NUMA node of the fragment instance, in the range [0, num_placement_numa_nodes()).
+int numa_node_of_fragment_instance(const TUniqueId& fragment_instance_id);
+
+// Pin the calling thread to the cores of |node|, do nothing if the placement is disabled.
+void bind_current_thread_to_numa_node(int node);
+
+} // namespace starrocks::pipeline
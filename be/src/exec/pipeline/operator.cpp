@@ -4,6 +4,7 @@
 
 #include <algorithm>
 
+#include "common/config.h"
 #include "exec/exec_node.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/exec_env.h"
@@ -14,6 +15,7 @@
 namespace starrocks::pipeline {
 
 /// Operator.
+const int32_t Operator::s_pseudo_plan_node_id_for_export_sink = -97;
 const int32_t Operator::s_pseudo_plan_node_id_for_olap_table_sink = -98;
 const int32_t Operator::s_pseudo_plan_node_id_for_result_sink = -99;
 const int32_t Operator::s_pseudo_plan_node_id_upper_bound = -100;
@@ -55,6 +57,16 @@ Status Operator::prepare(RuntimeState* state) {
     _push_row_num_counter = ADD_COUNTER(_common_metrics, "PushRowNum", TUnit::UNIT);
     _pull_chunk_num_counter = ADD_COUNTER(_common_metrics, "PullChunkNum", TUnit::UNIT);
     _pull_row_num_counter = ADD_COUNTER(_common_metrics, "PullRowNum", TUnit::UNIT);
+
+    if (config::enable_pipeline_perf_event_counters) {
+        _enable_perf_event_counters = true;
+        static const std::string kHardwareCounters = "HardwareCounters";
+        ADD_COUNTER(_common_metrics, kHardwareCounters, TUnit::NONE);
+        for (int i = 0; i < PerfEventCounters::NUM_EVENTS; ++i) {
+            const char* name = PerfEventCounters::event_name(i);
+            _perf_event_counters[i] = ADD_CHILD_COUNTER(_common_metrics, name, TUnit::UNIT, kHardwareCounters);
+        }
+    }
     return Status::OK();
 }
 
@@ -133,7 +145,7 @@ Status Operator::eval_conjuncts_and_in_filters(const std::vector<ExprContext*>&
         SCOPED_TIMER(_conjuncts_timer);
         auto before = chunk->num_rows();
         _conjuncts_input_counter->update(before);
-        RETURN_IF_ERROR(starrocks::ExecNode::eval_conjuncts(_cached_conjuncts_and_in_filters, chunk, filter));
+        RETURN_IF_ERROR(_conjuncts_order.eval_conjuncts(&_cached_conjuncts_and_in_filters, chunk, filter));
         auto after = chunk->num_rows();
         _conjuncts_output_counter->update(after);
     }
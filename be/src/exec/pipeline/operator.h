@@ -4,11 +4,13 @@
 
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
+#include "exec/adaptive_conjuncts_order.h"
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exprs/vectorized/runtime_filter_bank.h"
 #include "gutil/casts.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/mem_tracker.h"
+#include "util/perf_event_counters.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -139,6 +141,7 @@ public:
     // for example, LocalExchangeSinkOperator, LocalExchangeSourceOperator
     // 2. (s_pseudo_plan_node_id_upper_bound, -1] is for operator which is in the query's plan
     // for example, ResultSink
+    static const int32_t s_pseudo_plan_node_id_for_export_sink;
     static const int32_t s_pseudo_plan_node_id_for_olap_table_sink;
     static const int32_t s_pseudo_plan_node_id_for_result_sink;
     static const int32_t s_pseudo_plan_node_id_upper_bound;
@@ -181,6 +184,8 @@ protected:
     std::shared_ptr<MemTracker> _mem_tracker = nullptr;
     bool _conjuncts_and_in_filters_is_cached = false;
     std::vector<ExprContext*> _cached_conjuncts_and_in_filters;
+    // Reorders _cached_conjuncts_and_in_filters by their measured cost and selectivity.
+    AdaptiveConjunctsOrder _conjuncts_order;
 
     vectorized::RuntimeBloomFilterEvalContext _bloom_filter_eval_context;
 
@@ -202,12 +207,19 @@ protected:
     RuntimeProfile::Counter* _conjuncts_timer = nullptr;
     RuntimeProfile::Counter* _conjuncts_input_counter = nullptr;
     RuntimeProfile::Counter* _conjuncts_output_counter = nullptr;
+    // The hardware counters of pushing and pulling chunks, only with config::enable_pipeline_perf_event_counters.
+    std::array<RuntimeProfile::Counter*, PerfEventCounters::NUM_EVENTS> _perf_event_counters{};
+    bool _enable_perf_event_counters = false;
 
     // Some extra cpu cost of this operator that not accounted by pipeline driver,
     // such as OlapScanOperator( use separated IO thread to execute the IO task)
     std::atomic_int64_t _last_growth_cpu_time_ns = 0;
 
 private:
+    // nullptr if the hardware counters are disabled, see ScopedPerfEventCounters.
+    RuntimeProfile::Counter* const* _perf_event_counters_or_null() const {
+        return _enable_perf_event_counters ? _perf_event_counters.data() : nullptr;
+    }
     void _init_rf_counters(bool init_bloom);
     void _init_conjuct_counters();
 };
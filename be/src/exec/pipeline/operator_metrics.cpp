@@ -0,0 +1,64 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/pipeline/operator_metrics.h"
+
+#include "util/starrocks_metrics.h"
+
+namespace starrocks::pipeline {
+
+// From 1us to about 17s.
+static constexpr int64_t kMinChunkTimeNs = 1000;
+static constexpr int kNumChunkTimeBuckets = 25;
+// From 1K rows/s to about 17G rows/s.
+static constexpr int64_t kMinRowsPerSecond = 1024;
+static constexpr int kNumRowsPerSecondBuckets = 25;
+// From 1 byte to 1M bytes.
+static constexpr int kNumBytesPerRowBuckets = 21;
+
+OperatorMetrics::OperatorMetrics()
+        : chunk_time_ns(MetricUnit::NANOSECONDS,
+                        IntHistogram::exponential_bounds(kMinChunkTimeNs, 2, kNumChunkTimeBuckets)),
+          rows_per_second(MetricUnit::ROWS,
+                          IntHistogram::exponential_bounds(kMinRowsPerSecond, 2, kNumRowsPerSecondBuckets)),
+          bytes_per_row(MetricUnit::BYTES, IntHistogram::exponential_bounds(1, 2, kNumBytesPerRowBuckets)) {}
+
+OperatorMetricsRegistry* OperatorMetricsRegistry::instance() {
+    static OperatorMetricsRegistry s_instance;
+    return &s_instance;
+}
+
+OperatorMetrics* OperatorMetricsRegistry::get(const std::string& operator_name) {
+    std::lock_guard<std::mutex> l(_mutex);
+    auto& metrics = _metrics[operator_name];
+    if (metrics == nullptr) {
+        metrics = std::make_unique<OperatorMetrics>();
+        MetricLabels labels;
+        labels.add("operator", operator_name);
+        auto* registry = StarRocksMetrics::instance()->metrics();
+        registry->register_metric("pipe_operator_chunk_time_ns", labels, &metrics->chunk_time_ns);
+        registry->register_metric("pipe_operator_rows_per_second", labels, &metrics->rows_per_second);
+        registry->register_metric("pipe_operator_bytes_per_row", labels, &metrics->bytes_per_row);
+    }
+    return metrics.get();
+}
+
+void OperatorMetricsRegistry::observe_pull(OperatorMetrics* metrics, int64_t time_ns, size_t num_rows,
+                                           size_t num_bytes) {
+    _observe_chunk_time(metrics, time_ns, num_rows);
+    if (num_rows > 0) {
+        metrics->bytes_per_row.observe(num_bytes / num_rows);
+    }
+}
+
+void OperatorMetricsRegistry::observe_push(OperatorMetrics* metrics, int64_t time_ns, size_t num_rows) {
+    _observe_chunk_time(metrics, time_ns, num_rows);
+}
+
+void OperatorMetricsRegistry::_observe_chunk_time(OperatorMetrics* metrics, int64_t time_ns, size_t num_rows) {
+    metrics->chunk_time_ns.observe(time_ns);
+    if (time_ns > 0) {
+        metrics->rows_per_second.observe(static_cast<int64_t>(num_rows * 1000000000.0 / time_ns));
+    }
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,49 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "util/metrics.h"
+
+namespace starrocks::pipeline {
+
+// The histograms of all the operators of a type, e.g. hash_join_probe, across the queries, which show the trends
+// the profiles of the individual queries can't. They are sampled from the chunks moved by the drivers, one of
+// every config::pipeline_operator_metrics_sample_interval chunks.
+struct OperatorMetrics {
+    OperatorMetrics();
+
+    // The time of pulling a chunk from or pushing a chunk to the operator.
+    IntHistogram chunk_time_ns;
+    // The rows of the chunk divided by chunk_time_ns.
+    IntHistogram rows_per_second;
+    // The memory usage of a chunk pulled from the operator divided by its rows.
+    IntHistogram bytes_per_row;
+};
+
+class OperatorMetricsRegistry {
+public:
+    static OperatorMetricsRegistry* instance();
+
+    // The metrics of the operators named |operator_name|, registered to StarRocksMetrics on the first call.
+    OperatorMetrics* get(const std::string& operator_name);
+
+    // The operator pulls a chunk of |num_rows| rows and |num_bytes| bytes in |time_ns|.
+    static void observe_pull(OperatorMetrics* metrics, int64_t time_ns, size_t num_rows, size_t num_bytes);
+    // The operator is pushed a chunk of |num_rows| rows in |time_ns|.
+    static void observe_push(OperatorMetrics* metrics, int64_t time_ns, size_t num_rows);
+
+private:
+    OperatorMetricsRegistry() = default;
+
+    static void _observe_chunk_time(OperatorMetrics* metrics, int64_t time_ns, size_t num_rows);
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::unique_ptr<OperatorMetrics>> _metrics;
+};
+
+} // namespace starrocks::pipeline
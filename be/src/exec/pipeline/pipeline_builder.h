@@ -64,9 +64,9 @@ public:
     // Whether the building pipeline `ops` need local shuffle for the next operator.
     bool need_local_shuffle(OpFactories ops) const;
 
-private:
     static constexpr int kLocalExchangeBufferChunks = 8;
 
+private:
     FragmentContext* _fragment_context;
     Pipelines _pipelines;
 
@@ -7,6 +7,7 @@
 
 #include "column/chunk.h"
 #include "common/statusor.h"
+#include "exec/pipeline/operator_metrics.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
 #include "exec/pipeline/scan/olap_scan_operator.h"
 #include "exec/pipeline/source_operator.h"
@@ -15,6 +16,7 @@
 #include "runtime/runtime_state.h"
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -162,9 +164,13 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                 // pull chunk from current operator and push the chunk onto next
                 // operator
                 StatusOr<vectorized::ChunkPtr> maybe_chunk;
+                bool sampled = _sample_operator_metrics();
+                int64_t pull_time_ns = sampled ? curr_op->_pull_timer->value() : 0;
                 {
                     SCOPED_TIMER(curr_op->_pull_timer);
                     QUERY_TRACE_SCOPED(curr_op->get_name(), "pull_chunk");
+                    ScopedPerfEventCounters perf_event_counters(curr_op->_perf_event_counters_or_null(),
+                                                                curr_op->_name);
                     maybe_chunk = curr_op->pull_chunk(runtime_state);
                 }
                 return_status = maybe_chunk.status();
@@ -182,11 +188,25 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                     if (maybe_chunk.value() && maybe_chunk.value()->num_rows() > 0) {
                         size_t row_num = maybe_chunk.value()->num_rows();
                         total_rows_moved += row_num;
+                        int64_t push_time_ns = 0;
+                        if (sampled) {
+                            OperatorMetricsRegistry::observe_pull(_get_operator_metrics(i),
+                                                                  curr_op->_pull_timer->value() - pull_time_ns,
+                                                                  row_num, maybe_chunk.value()->memory_usage());
+                            push_time_ns = next_op->_push_timer->value();
+                        }
                         {
                             SCOPED_TIMER(next_op->_push_timer);
                             QUERY_TRACE_SCOPED(next_op->get_name(), "push_chunk");
+                            ScopedPerfEventCounters perf_event_counters(next_op->_perf_event_counters_or_null(),
+                                                                        next_op->_name);
                             return_status = next_op->push_chunk(runtime_state, maybe_chunk.value());
                         }
+                        if (sampled) {
+                            OperatorMetricsRegistry::observe_push(_get_operator_metrics(i + 1),
+                                                                  next_op->_push_timer->value() - push_time_ns,
+                                                                  row_num);
+                        }
 
                         if (!return_status.ok() && !return_status.is_end_of_file()) {
                             LOG(WARNING) << "push_chunk returns not ok status " << return_status.to_string();
@@ -512,6 +532,35 @@ Status PipelineDriver::_mark_operator_closed(OperatorPtr& op, RuntimeState* stat
     return Status::OK();
 }
 
+void PipelineDriver::_trace_driver_state() {
+    int64_t now = MonotonicMicros();
+    if (_state_start_ts >= 0) {
+        _trace_ctx.event_buffer->add(starrocks::debug::QueryTraceEvent::create_with_ctx(
+                ds_to_string(_state), "driver_state", -1, 'X', _state_start_ts - _trace_ctx.start_ts,
+                now - _state_start_ts, _trace_ctx));
+    }
+    _state_start_ts = now;
+}
+
+bool PipelineDriver::_sample_operator_metrics() {
+    int64_t interval = config::pipeline_operator_metrics_sample_interval;
+    if (interval <= 0 || ++_num_chunks_since_sampled < interval) {
+        return false;
+    }
+    _num_chunks_since_sampled = 0;
+    return true;
+}
+
+OperatorMetrics* PipelineDriver::_get_operator_metrics(size_t op_index) {
+    if (_operator_metrics.empty()) {
+        _operator_metrics.resize(_operators.size(), nullptr);
+    }
+    if (_operator_metrics[op_index] == nullptr) {
+        _operator_metrics[op_index] = OperatorMetricsRegistry::instance()->get(_operators[op_index]->_name);
+    }
+    return _operator_metrics[op_index];
+}
+
 void PipelineDriver::_update_statistics(size_t total_chunks_moved, size_t total_rows_moved, size_t time_spent) {
     driver_acct().increment_schedule_times();
     driver_acct().update_last_chunks_moved(total_chunks_moved);
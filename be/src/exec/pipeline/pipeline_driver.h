@@ -24,6 +24,7 @@ namespace starrocks {
 namespace pipeline {
 
 class PipelineDriver;
+struct OperatorMetrics;
 using DriverPtr = std::shared_ptr<PipelineDriver>;
 using Drivers = std::vector<DriverPtr>;
 
@@ -175,6 +176,9 @@ public:
         if (state == _state) {
             return;
         }
+        if (_trace_ctx.event_buffer != nullptr) {
+            _trace_driver_state();
+        }
 
         switch (_state) {
         case DriverState::INPUT_EMPTY: {
@@ -220,6 +224,9 @@ public:
         _state = state;
     }
 
+    // Set by QueryTrace when the query is traced, then the states of the driver are traced.
+    void set_trace_context(const starrocks::debug::QueryTraceContext& ctx) { _trace_ctx = ctx; }
+
     Operators& operators() { return _operators; }
     ScanOperator* source_scan_operator() {
         return _operators.empty() ? nullptr : dynamic_cast<ScanOperator*>(_operators.front().get());
@@ -351,6 +358,9 @@ public:
 
     size_t get_driver_queue_level() const { return _driver_queue_level; }
     void set_driver_queue_level(size_t driver_queue_level) { _driver_queue_level = driver_queue_level; }
+    // The local queue of WorkStealingDriverQueue which the driver is put to.
+    size_t get_driver_local_queue() const { return _driver_local_queue.load(std::memory_order_relaxed); }
+    void set_driver_local_queue(size_t idx) { _driver_local_queue.store(idx, std::memory_order_relaxed); }
 
     inline bool is_in_ready_queue() const { return _in_ready_queue.load(std::memory_order_acquire); }
     void set_in_ready_queue(bool v) { _in_ready_queue.store(v, std::memory_order_release); }
@@ -376,6 +386,13 @@ private:
     void _update_statistics(size_t total_chunks_moved, size_t total_rows_moved, size_t time_spent);
     void _update_overhead_timer();
 
+    // Add the event of the current state, which lasts from the last transition until now.
+    void _trace_driver_state();
+
+    // Whether the chunk to move is sampled into the operator metrics, see OperatorMetrics.
+    bool _sample_operator_metrics();
+    OperatorMetrics* _get_operator_metrics(size_t op_index);
+
     RuntimeState* _runtime_state = nullptr;
     Operators _operators;
     DriverDependencies _dependencies;
@@ -407,8 +424,18 @@ private:
     workgroup::WorkGroupPtr _workgroup = nullptr;
     // The index of QuerySharedDriverQueue._queues which this driver belongs to.
     size_t _driver_queue_level = 0;
+    std::atomic<size_t> _driver_local_queue{0};
     std::atomic<bool> _in_ready_queue{false};
 
+    starrocks::debug::QueryTraceContext _trace_ctx;
+    // When the driver turns into the current state, in microseconds, -1 before the first transition traced.
+    int64_t _state_start_ts = -1;
+
+    // The chunks moved since the last one sampled into the operator metrics.
+    int64_t _num_chunks_since_sampled = 0;
+    // The metrics of each operator, resolved when the first chunk of the operator is sampled.
+    std::vector<OperatorMetrics*> _operator_metrics;
+
     // metrics
     RuntimeProfile::Counter* _total_timer = nullptr;
     RuntimeProfile::Counter* _active_timer = nullptr;
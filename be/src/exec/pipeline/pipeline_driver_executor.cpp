@@ -4,6 +4,8 @@
 
 #include <memory>
 
+#include "common/config.h"
+#include "exec/pipeline/numa_placement.h"
 #include "exec/workgroup/work_group.h"
 #include "gen_cpp/Types_types.h"
 #include "gutil/strings/substitute.h"
@@ -13,12 +15,21 @@
 
 namespace starrocks::pipeline {
 
+static std::unique_ptr<DriverQueue> create_driver_queue(bool enable_resource_group, int max_num_threads) {
+    if (enable_resource_group) {
+        return std::make_unique<WorkGroupDriverQueue>();
+    }
+    if (config::pipeline_enable_work_stealing) {
+        return std::make_unique<WorkStealingDriverQueue>(max_num_threads, num_placement_numa_nodes());
+    }
+    return std::make_unique<QuerySharedDriverQueue>();
+}
+
 GlobalDriverExecutor::GlobalDriverExecutor(std::string name, std::unique_ptr<ThreadPool> thread_pool,
                                            bool enable_resource_group)
         : Base(name),
           _enable_resource_group(enable_resource_group),
-          _driver_queue(enable_resource_group ? std::unique_ptr<DriverQueue>(std::make_unique<WorkGroupDriverQueue>())
-                                              : std::make_unique<QuerySharedDriverQueue>()),
+          _driver_queue(create_driver_queue(enable_resource_group, thread_pool->max_threads())),
           _thread_pool(std::move(thread_pool)),
           _blocked_driver_poller(new PipelineDriverPoller(_driver_queue.get())),
           _exec_state_reporter(new ExecStateReporter()) {}
@@ -75,6 +86,7 @@ void GlobalDriverExecutor::_finalize_driver(DriverRawPtr driver, RuntimeState* r
 
 void GlobalDriverExecutor::_worker_thread() {
     const int worker_id = _next_id++;
+    _driver_queue->bind_worker(worker_id);
     while (true) {
         if (_num_threads_setter.should_shrink()) {
             break;
@@ -83,6 +95,7 @@ void GlobalDriverExecutor::_worker_thread() {
         CurrentThread::current().set_query_id({});
         CurrentThread::current().set_fragment_instance_id({});
         CurrentThread::current().set_pipeline_driver_id(0);
+        starrocks::debug::tls_trace_ctx.reset();
 
         auto maybe_driver = this->_driver_queue->take();
         if (maybe_driver.status().is_cancelled()) {
@@ -172,6 +185,10 @@ void GlobalDriverExecutor::_worker_thread() {
 }
 
 void GlobalDriverExecutor::submit(DriverRawPtr driver) {
+    if (auto* source = driver->source_operator(); source->supports_ready_notification()) {
+        auto* poller = _blocked_driver_poller.get();
+        source->set_ready_observer([poller, driver] { poller->notify(driver); });
+    }
     if (driver->is_precondition_block()) {
         driver->set_driver_state(DriverState::PRECONDITION_BLOCK);
         driver->mark_precondition_not_ready();
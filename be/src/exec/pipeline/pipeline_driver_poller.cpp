@@ -2,7 +2,12 @@
 
 #include "pipeline_driver_poller.h"
 
+#include <algorithm>
 #include <chrono>
+
+#include "common/config.h"
+#include "util/stopwatch.hpp"
+
 namespace starrocks::pipeline {
 
 void PipelineDriverPoller::start() {
@@ -28,26 +33,48 @@ void PipelineDriverPoller::shutdown() {
 void PipelineDriverPoller::run_internal() {
     this->_is_polling_thread_initialized.store(true, std::memory_order_release);
     DriverList local_blocked_drivers;
+    // The drivers waiting for a notification, they are not checked in every polling round.
+    std::unordered_set<DriverRawPtr> event_driven_drivers;
+    std::unordered_set<DriverRawPtr> notified_drivers;
+    MonotonicStopWatch sweep_watch;
+    sweep_watch.start();
     int spin_count = 0;
     std::vector<DriverRawPtr> ready_drivers;
     while (!_is_shutdown.load(std::memory_order_acquire)) {
+        const int64_t sweep_interval_ns = config::pipeline_poller_event_sweep_interval_ms * 1000000L;
+        const int64_t sweep_elapsed_ns = sweep_watch.elapsed_time();
+        bool need_sweep = !event_driven_drivers.empty() && sweep_elapsed_ns >= sweep_interval_ns;
         {
             std::unique_lock<std::mutex> lock(this->_mutex);
-            local_blocked_drivers.splice(local_blocked_drivers.end(), _blocked_drivers);
-            if (local_blocked_drivers.empty() && _blocked_drivers.empty()) {
-                std::cv_status cv_status = std::cv_status::no_timeout;
-                while (!_is_shutdown.load(std::memory_order_acquire) && this->_blocked_drivers.empty()) {
-                    cv_status = _cond.wait_for(lock, std::chrono::milliseconds(10));
-                }
-                if (cv_status == std::cv_status::timeout) {
-                    continue;
-                }
-                if (_is_shutdown.load(std::memory_order_acquire)) {
-                    break;
+            if (local_blocked_drivers.empty() && !need_sweep) {
+                auto wait_time = std::chrono::nanoseconds(10000000L);
+                if (!event_driven_drivers.empty()) {
+                    wait_time = std::min(wait_time, std::chrono::nanoseconds(sweep_interval_ns - sweep_elapsed_ns));
                 }
-                local_blocked_drivers.splice(local_blocked_drivers.end(), _blocked_drivers);
+                _cond.wait_for(lock, wait_time, [this] {
+                    return _is_shutdown.load(std::memory_order_acquire) || !_blocked_drivers.empty() ||
+                           !_notified_drivers.empty();
+                });
+            }
+            local_blocked_drivers.splice(local_blocked_drivers.end(), _blocked_drivers);
+            notified_drivers.swap(_notified_drivers);
+        }
+        if (_is_shutdown.load(std::memory_order_acquire)) {
+            break;
+        }
+
+        for (auto* driver : notified_drivers) {
+            if (event_driven_drivers.erase(driver) > 0) {
+                local_blocked_drivers.push_back(driver);
             }
         }
+        notified_drivers.clear();
+        if (need_sweep) {
+            local_blocked_drivers.insert(local_blocked_drivers.end(), event_driven_drivers.begin(),
+                                         event_driven_drivers.end());
+            event_driven_drivers.clear();
+            sweep_watch.reset();
+        }
 
         auto driver_it = local_blocked_drivers.begin();
         while (driver_it != local_blocked_drivers.end()) {
@@ -107,6 +134,10 @@ void PipelineDriverPoller::run_internal() {
                 driver->set_driver_state(DriverState::READY);
                 remove_blocked_driver(local_blocked_drivers, driver_it);
                 ready_drivers.emplace_back(driver);
+            } else if (is_event_driven(driver)) {
+                // Keep waiting without being polled, the pending timer goes on.
+                event_driven_drivers.insert(driver);
+                driver_it = local_blocked_drivers.erase(driver_it);
             } else {
                 ++driver_it;
             }
@@ -143,6 +174,18 @@ void PipelineDriverPoller::add_blocked_driver(const DriverRawPtr driver) {
     _cond.notify_one();
 }
 
+void PipelineDriverPoller::notify(DriverRawPtr driver) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_notified_drivers.insert(driver).second) {
+        _cond.notify_one();
+    }
+}
+
+bool PipelineDriverPoller::is_event_driven(DriverRawPtr driver) {
+    return config::pipeline_poller_event_sweep_interval_ms > 0 && driver->driver_state() == DriverState::INPUT_EMPTY &&
+           driver->source_operator()->supports_ready_notification();
+}
+
 void PipelineDriverPoller::remove_blocked_driver(DriverList& local_blocked_drivers, DriverList::iterator& driver_it) {
     auto& driver = *driver_it;
     driver->_pending_timer->update(driver->_pending_timer_sw->elapsed_time());
@@ -7,6 +7,7 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <unordered_set>
 
 #include "pipeline_driver.h"
 #include "pipeline_driver_queue.h"
@@ -36,6 +37,9 @@ public:
     void add_blocked_driver(const DriverRawPtr driver);
     // remove blocked driver from poller
     void remove_blocked_driver(DriverList& local_blocked_drivers, DriverList::iterator& driver_it);
+    // notify the poller that the source operator of the driver may be ready, see SourceOperator::notify_ready().
+    // The driver is only used as a key here, so it's fine to notify a driver that isn't in the poller.
+    void notify(DriverRawPtr driver);
     // only used for collect metrics
     size_t blocked_driver_queue_len() const {
         std::unique_lock<std::mutex> guard(_mutex);
@@ -44,6 +48,10 @@ public:
 
 private:
     void run_internal();
+    // Drivers blocked on a source operator that supports ready notification are only checked after being
+    // notified, or when all of them are swept every config::pipeline_poller_event_sweep_interval_ms,
+    // which catches the cancellation and expiration of their fragments.
+    static bool is_event_driven(DriverRawPtr driver);
     PipelineDriverPoller(const PipelineDriverPoller&) = delete;
     PipelineDriverPoller& operator=(const PipelineDriverPoller&) = delete;
 
@@ -51,6 +59,8 @@ private:
     mutable std::mutex _mutex;
     std::condition_variable _cond;
     DriverList _blocked_drivers;
+    // The drivers notified since the last polling round.
+    std::unordered_set<DriverRawPtr> _notified_drivers;
     DriverQueue* _driver_queue;
     scoped_refptr<Thread> _polling_thread;
     std::atomic<bool> _is_polling_thread_initialized;
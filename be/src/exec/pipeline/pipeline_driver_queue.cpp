@@ -2,6 +2,9 @@
 
 #include "exec/pipeline/pipeline_driver_queue.h"
 
+#include "exec/pipeline/fragment_context.h"
+#include "exec/pipeline/numa_placement.h"
+#include "exec/workgroup/cpu_isolation.h"
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
@@ -181,6 +184,210 @@ DriverRawPtr SubQuerySharedDriverQueue::take() {
     return nullptr;
 }
 
+/// WorkStealingDriverQueue.
+// The local queue of the calling executor thread, see bind_worker().
+static thread_local int tls_worker_id = -1;
+
+WorkStealingDriverQueue::WorkStealingDriverQueue(size_t num_local_queues, int num_numa_nodes)
+        : _num_numa_nodes(std::max(1, num_numa_nodes)),
+          // Every NUMA node has at least one local queue.
+          _num_local_queues(std::max<size_t>(_num_numa_nodes, num_local_queues)),
+          _local_queues(new LocalQueue[_num_local_queues]),
+          _numa_nodes(new NumaNode[_num_numa_nodes]) {
+    // Use the same factors and time slices as QuerySharedDriverQueue.
+    double factor = 1;
+    for (int i = QUEUE_SIZE - 1; i >= 0; --i) {
+        _level_factors[i] = factor;
+        factor *= QuerySharedDriverQueue::RATIO_OF_ADJACENT_QUEUE;
+    }
+
+    int64_t time_slice = 0;
+    for (int i = 0; i < QUEUE_SIZE; ++i) {
+        time_slice += LEVEL_TIME_SLICE_BASE_NS * (i + 1);
+        _level_time_slices[i] = time_slice;
+        _level_accu_time[i] = 0;
+    }
+}
+
+void WorkStealingDriverQueue::close() {
+    _is_closed = true;
+    for (int i = 0; i < _num_numa_nodes; ++i) {
+        std::lock_guard<std::mutex> lock(_numa_nodes[i].park_mutex);
+        _numa_nodes[i].park_cv.notify_all();
+    }
+}
+
+void WorkStealingDriverQueue::bind_worker(int worker_id) {
+    tls_worker_id = worker_id;
+    if (_num_numa_nodes > 1) {
+        bind_current_thread_to_numa_node(_numa_node_of_queue(_local_queue_of_this_thread()));
+    }
+}
+
+size_t WorkStealingDriverQueue::_local_queue_of_this_thread() const {
+    return tls_worker_id < 0 ? 0 : tls_worker_id % _num_local_queues;
+}
+
+int WorkStealingDriverQueue::_numa_node_of_driver(const DriverRawPtr driver) const {
+    if (_num_numa_nodes <= 1 || driver->fragment_ctx() == nullptr) {
+        return 0;
+    }
+    return numa_node_of_fragment_instance(driver->fragment_ctx()->fragment_instance_id()) % _num_numa_nodes;
+}
+
+void WorkStealingDriverQueue::_put(size_t queue_idx, const DriverRawPtr driver) {
+    int level = _compute_driver_level(driver);
+    driver->set_driver_queue_level(level);
+    auto& local_queue = _local_queues[queue_idx];
+    {
+        std::lock_guard<std::mutex> lock(local_queue.mutex);
+        local_queue.levels[level].put(driver);
+        driver->set_driver_local_queue(queue_idx);
+        driver->set_in_ready_queue(true);
+        local_queue.num_drivers++;
+    }
+    _numa_nodes[_numa_node_of_queue(queue_idx)].num_drivers++;
+    _num_drivers++;
+}
+
+void WorkStealingDriverQueue::_notify_parked(int numa_node) {
+    // num_drivers is increased before reading num_parked, and a parking thread increases num_parked
+    // before reading num_drivers, so either the driver is seen by the thread or the thread is notified.
+    auto& node = _numa_nodes[numa_node];
+    if (node.num_parked.load() > 0) {
+        std::lock_guard<std::mutex> lock(node.park_mutex);
+        node.park_cv.notify_one();
+    }
+}
+
+void WorkStealingDriverQueue::_put_in_turn(const DriverRawPtr driver) {
+    int numa_node = _numa_node_of_driver(driver);
+    size_t nth = _next_local_queue.fetch_add(1, std::memory_order_relaxed) % _num_queues_of_numa_node(numa_node);
+    _put(numa_node + nth * _num_numa_nodes, driver);
+    _notify_parked(numa_node);
+}
+
+void WorkStealingDriverQueue::put_back(const DriverRawPtr driver) {
+    _put_in_turn(driver);
+}
+
+void WorkStealingDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
+    for (auto* driver : drivers) {
+        _put_in_turn(driver);
+    }
+}
+
+void WorkStealingDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
+    size_t queue_idx = _local_queue_of_this_thread();
+    int numa_node = _numa_node_of_queue(queue_idx);
+    if (numa_node != _numa_node_of_driver(driver)) {
+        // The thread isn't an executor thread of the node of the driver, e.g. a test thread.
+        _put_in_turn(driver);
+        return;
+    }
+    // The current thread takes it again soon unless the other threads are idle,
+    // so a parked thread is still notified to steal it.
+    _put(queue_idx, driver);
+    _notify_parked(numa_node);
+}
+
+DriverRawPtr WorkStealingDriverQueue::_try_take(size_t queue_idx) {
+    auto& local_queue = _local_queues[queue_idx];
+    if (local_queue.num_drivers.load(std::memory_order_acquire) == 0) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(local_queue.mutex);
+    // Find the level with the smallest execution time.
+    int level = -1;
+    double target_accu_time = 0;
+    for (int i = 0; i < QUEUE_SIZE; ++i) {
+        if (!local_queue.levels[i].empty()) {
+            double local_target_time = _level_accu_time[i].load(std::memory_order_relaxed) / _level_factors[i];
+            if (level < 0 || local_target_time < target_accu_time) {
+                target_accu_time = local_target_time;
+                level = i;
+            }
+        }
+    }
+    if (level < 0) {
+        return nullptr;
+    }
+    DriverRawPtr driver = local_queue.levels[level].take();
+    if (driver == nullptr) {
+        return nullptr;
+    }
+    driver->set_in_ready_queue(false);
+    local_queue.num_drivers--;
+    _numa_nodes[_numa_node_of_queue(queue_idx)].num_drivers--;
+    _num_drivers--;
+    return driver;
+}
+
+StatusOr<DriverRawPtr> WorkStealingDriverQueue::take() {
+    const size_t local_idx = _local_queue_of_this_thread();
+    const int numa_node = _numa_node_of_queue(local_idx);
+    auto& node = _numa_nodes[numa_node];
+    const size_t num_node_queues = _num_queues_of_numa_node(numa_node);
+    const size_t local_nth = local_idx / _num_numa_nodes;
+    while (true) {
+        if (_is_closed) {
+            return Status::Cancelled("Shutdown");
+        }
+
+        if (auto* driver = _try_take(local_idx); driver != nullptr) {
+            return driver;
+        }
+        // Only steal from the local queues of the same NUMA node, starting from the next one.
+        for (size_t i = 1; i < num_node_queues; ++i) {
+            size_t victim = numa_node + (local_nth + i) % num_node_queues * _num_numa_nodes;
+            if (auto* driver = _try_take(victim); driver != nullptr) {
+                return driver;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(node.park_mutex);
+        node.num_parked++;
+        if (!_is_closed && node.num_drivers.load() == 0) {
+            node.park_cv.wait(lock);
+        }
+        node.num_parked--;
+    }
+}
+
+void WorkStealingDriverQueue::cancel(DriverRawPtr driver) {
+    if (_is_closed) {
+        return;
+    }
+    const size_t queue_idx = driver->get_driver_local_queue();
+    auto& local_queue = _local_queues[queue_idx];
+    {
+        std::lock_guard<std::mutex> lock(local_queue.mutex);
+        // The driver may have been taken, or put back to another local queue.
+        if (!driver->is_in_ready_queue() || driver->get_driver_local_queue() != queue_idx) {
+            return;
+        }
+        local_queue.levels[driver->get_driver_queue_level()].cancel(driver);
+    }
+    _notify_parked(_numa_node_of_queue(queue_idx));
+}
+
+void WorkStealingDriverQueue::update_statistics(const DriverRawPtr driver) {
+    _level_accu_time[driver->get_driver_queue_level()].fetch_add(driver->driver_acct().get_last_time_spent(),
+                                                                 std::memory_order_relaxed);
+}
+
+int WorkStealingDriverQueue::_compute_driver_level(const DriverRawPtr driver) const {
+    int time_spent = driver->driver_acct().get_accumulated_time_spent();
+    for (int i = driver->get_driver_queue_level(); i < QUEUE_SIZE; ++i) {
+        if (time_spent < _level_time_slices[i]) {
+            return i;
+        }
+    }
+
+    return QUEUE_SIZE - 1;
+}
+
 /// WorkGroupDriverQueue.
 bool WorkGroupDriverQueue::WorkGroupDriverSchedEntityComparator::operator()(
         const WorkGroupDriverSchedEntityPtr& lhs, const WorkGroupDriverSchedEntityPtr& rhs) const {
@@ -188,30 +395,31 @@ bool WorkGroupDriverQueue::WorkGroupDriverSchedEntityComparator::operator()(
 }
 
 void WorkGroupDriverQueue::close() {
-    std::lock_guard<std::mutex> lock(_global_mutex);
+    std::lock_guard lock(_global_mutex);
     _is_closed = true;
     _cv.notify_all();
+    _sq_cv.notify_all();
 }
 
 void WorkGroupDriverQueue::put_back(const DriverRawPtr driver) {
-    std::lock_guard<std::mutex> lock(_global_mutex);
+    std::lock_guard lock(_global_mutex);
     _put_back<false>(driver);
 }
 
 void WorkGroupDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
-    std::lock_guard<std::mutex> lock(_global_mutex);
+    std::lock_guard lock(_global_mutex);
     for (const auto driver : drivers) {
         _put_back<false>(driver);
     }
 }
 
 void WorkGroupDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
-    std::lock_guard<std::mutex> lock(_global_mutex);
+    std::lock_guard lock(_global_mutex);
     _put_back<true>(driver);
 }
 
 StatusOr<DriverRawPtr> WorkGroupDriverQueue::take() {
-    std::unique_lock<std::mutex> lock(_global_mutex);
+    std::unique_lock lock(_global_mutex);
 
     workgroup::WorkGroupDriverSchedEntity* wg_entity = nullptr;
     while (wg_entity == nullptr) {
@@ -221,7 +429,12 @@ StatusOr<DriverRawPtr> WorkGroupDriverQueue::take() {
 
         _update_bandwidth_control_period();
 
-        if (_wg_entities.empty()) {
+        if (workgroup::is_current_worker_sq_dedicated()) {
+            if (wg_entity = _take_next_wg(true); wg_entity == nullptr) {
+                // Wake up now and then, in case this thread is not dedicated anymore.
+                _sq_cv.wait_for(lock, std::chrono::nanoseconds(BANDWIDTH_CONTROL_PERIOD_NS));
+            }
+        } else if (_wg_entities.empty()) {
             _cv.wait(lock);
         } else if (wg_entity = _take_next_wg(); wg_entity == nullptr) {
             int64_t cur_ns = MonotonicNanos();
@@ -245,7 +458,7 @@ StatusOr<DriverRawPtr> WorkGroupDriverQueue::take() {
 }
 
 void WorkGroupDriverQueue::cancel(DriverRawPtr driver) {
-    std::lock_guard<std::mutex> lock(_global_mutex);
+    std::lock_guard lock(_global_mutex);
     if (_is_closed) {
         return;
     }
@@ -258,7 +471,7 @@ void WorkGroupDriverQueue::cancel(DriverRawPtr driver) {
 
 void WorkGroupDriverQueue::update_statistics(const DriverRawPtr driver) {
     // TODO: reduce the lock scope
-    std::lock_guard<std::mutex> lock(_global_mutex);
+    std::lock_guard lock(_global_mutex);
 
     int64_t runtime_ns = driver->driver_acct().get_last_time_spent();
     auto* wg_entity = driver->workgroup()->driver_sched_entity();
@@ -286,7 +499,7 @@ void WorkGroupDriverQueue::update_statistics(const DriverRawPtr driver) {
 
 size_t WorkGroupDriverQueue::size() const {
     // TODO: reduce the lock scope
-    std::lock_guard<std::mutex> lock(_global_mutex);
+    std::lock_guard lock(_global_mutex);
 
     size_t size = 0;
     for (auto wg_entity : _wg_entities) {
@@ -307,6 +520,10 @@ bool WorkGroupDriverQueue::should_yield(const DriverRawPtr driver, int64_t unacc
            _min_vruntime_ns.load() < wg_entity->vruntime_ns() + unaccounted_runtime_ns / wg_entity->cpu_limit();
 }
 
+void WorkGroupDriverQueue::bind_worker(int worker_id) {
+    workgroup::bind_worker_to_isolated_cores(worker_id);
+}
+
 bool WorkGroupDriverQueue::_throttled(const workgroup::WorkGroupDriverSchedEntity* wg_entity,
                                       int64_t unaccounted_runtime_ns) const {
     if (wg_entity->is_sq_wg()) {
@@ -331,6 +548,9 @@ void WorkGroupDriverQueue::_put_back(const DriverRawPtr driver) {
     }
 
     _cv.notify_one();
+    if (wg_entity->is_sq_wg()) {
+        _sq_cv.notify_one();
+    }
 }
 
 void WorkGroupDriverQueue::_update_min_wg() {
@@ -344,9 +564,12 @@ void WorkGroupDriverQueue::_update_min_wg() {
     }
 }
 
-workgroup::WorkGroupDriverSchedEntity* WorkGroupDriverQueue::_take_next_wg() {
+workgroup::WorkGroupDriverSchedEntity* WorkGroupDriverQueue::_take_next_wg(bool sq_only) {
     workgroup::WorkGroupDriverSchedEntity* min_unthrottled_wg_entity = nullptr;
     for (auto* wg_entity : _wg_entities) {
+        if (sq_only && !wg_entity->is_sq_wg()) {
+            continue;
+        }
         if (!_throttled(wg_entity)) {
             min_unthrottled_wg_entity = wg_entity;
             break;
@@ -2,11 +2,13 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <queue>
 
 #include "exec/pipeline/pipeline_driver.h"
 #include "exec/workgroup/work_group_fwd.h"
 #include "util/factory_method.h"
+#include "util/lock_contention_profiler.h"
 
 namespace starrocks {
 namespace pipeline {
@@ -27,6 +29,10 @@ public:
     virtual StatusOr<DriverRawPtr> take() = 0;
     virtual void cancel(DriverRawPtr driver) = 0;
 
+    // Called by each executor thread before taking any driver.
+    // The queues keeping per-thread state use |worker_id| to find the state of the calling thread.
+    virtual void bind_worker(int worker_id) {}
+
     // Update statistics of the driver's workgroup,
     // when yielding the driver in the executor thread.
     virtual void update_statistics(const DriverRawPtr driver) = 0;
@@ -131,6 +137,93 @@ private:
     bool _is_closed = false;
 };
 
+// WorkStealingDriverQueue has the same multilevel feedback scheduling as QuerySharedDriverQueue,
+// but the ready drivers are spread over a local queue per executor thread instead of one queue under
+// a global mutex:
+// - A driver yielded by an executor thread is put back to the local queue of this thread,
+//   and the drivers from the poller or new drivers are put to the local queues in turn.
+// - An executor thread takes drivers from its local queue first, and steals a driver from the
+//   local queues of the other threads when its own queue is empty.
+// - The accumulated time of each level is shared by all the local queues, so every thread picks
+//   the level by the same global statistics as QuerySharedDriverQueue.
+// An idle thread parks on a condition variable, which is only notified when some thread is parked.
+//
+// With |num_numa_nodes| > 1, the i-th local queue belongs to the NUMA node (i % num_numa_nodes), and an executor
+// thread is pinned to the node of its local queue. The drivers of a fragment instance are only put to the
+// local queues of its node, and are only stolen by the threads of the same node.
+class WorkStealingDriverQueue : public FactoryMethod<DriverQueue, WorkStealingDriverQueue> {
+    friend class FactoryMethod<DriverQueue, WorkStealingDriverQueue>;
+
+public:
+    explicit WorkStealingDriverQueue(size_t num_local_queues, int num_numa_nodes = 1);
+    ~WorkStealingDriverQueue() override = default;
+    void close() override;
+    void put_back(const DriverRawPtr driver) override;
+    void put_back(const std::vector<DriverRawPtr>& drivers) override;
+    void put_back_from_executor(const DriverRawPtr driver) override;
+
+    void update_statistics(const DriverRawPtr driver) override;
+
+    // Return cancelled status, if the queue is closed.
+    StatusOr<DriverRawPtr> take() override;
+
+    void cancel(DriverRawPtr driver) override;
+
+    void bind_worker(int worker_id) override;
+
+    size_t size() const override { return _num_drivers.load(std::memory_order_acquire); }
+
+    bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override { return false; }
+
+private:
+    struct LocalQueue {
+        std::mutex mutex;
+        SubQuerySharedDriverQueue levels[QuerySharedDriverQueue::QUEUE_SIZE];
+        // Used to skip the empty queues without locking them.
+        std::atomic<size_t> num_drivers = 0;
+    };
+
+    struct NumaNode {
+        std::mutex park_mutex;
+        std::condition_variable park_cv;
+        std::atomic<int> num_parked = 0;
+        std::atomic<size_t> num_drivers = 0;
+    };
+
+    int _compute_driver_level(const DriverRawPtr driver) const;
+    int _numa_node_of_driver(const DriverRawPtr driver) const;
+    int _numa_node_of_queue(size_t queue_idx) const { return queue_idx % _num_numa_nodes; }
+    // The local queues of a node are node, node + _num_numa_nodes, node + 2 * _num_numa_nodes, ...
+    size_t _num_queues_of_numa_node(int node) const {
+        return (_num_local_queues - node + _num_numa_nodes - 1) / _num_numa_nodes;
+    }
+    void _put(size_t queue_idx, const DriverRawPtr driver);
+    // Put the driver to a local queue of its NUMA node in turn, and notify a parked thread of the node.
+    void _put_in_turn(const DriverRawPtr driver);
+    void _notify_parked(int numa_node);
+    // Return nullptr if the local queue is empty.
+    DriverRawPtr _try_take(size_t queue_idx);
+    size_t _local_queue_of_this_thread() const;
+
+private:
+    static constexpr size_t QUEUE_SIZE = QuerySharedDriverQueue::QUEUE_SIZE;
+    static constexpr int64_t LEVEL_TIME_SLICE_BASE_NS = 200'000'000L;
+
+    const int _num_numa_nodes;
+    const size_t _num_local_queues;
+    std::unique_ptr<LocalQueue[]> _local_queues;
+    std::unique_ptr<NumaNode[]> _numa_nodes;
+    std::atomic<size_t> _next_local_queue = 0;
+
+    // The accumulated time and the normalization factor of each level, shared by all the local queues.
+    std::atomic<int64_t> _level_accu_time[QUEUE_SIZE];
+    double _level_factors[QUEUE_SIZE];
+    int64_t _level_time_slices[QUEUE_SIZE];
+
+    std::atomic<size_t> _num_drivers = 0;
+    std::atomic<bool> _is_closed = false;
+};
+
 // WorkGroupDriverQueue contains two levels of queues.
 // The first level is the work group queue, and the second level is the driver queue in a work group.
 class WorkGroupDriverQueue : public FactoryMethod<DriverQueue, WorkGroupDriverQueue> {
@@ -161,11 +254,14 @@ public:
 
     bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override;
 
+    void bind_worker(int worker_id) override;
+
 private:
     /// These methods should be guarded by the outside _global_mutex.
     template <bool from_executor>
     void _put_back(const DriverRawPtr driver);
-    workgroup::WorkGroupDriverSchedEntity* _take_next_wg();
+    // Only the short query workgroup is taken if |sq_only|, see exec/workgroup/cpu_isolation.h.
+    workgroup::WorkGroupDriverSchedEntity* _take_next_wg(bool sq_only = false);
     // _update_min_wg is invoked when an entity is enqueued or dequeued from _wg_entities.
     void _update_min_wg();
     // Apply hard bandwidth control to non-short-query workgroups, when there are queries of the short-query workgroup.
@@ -191,8 +287,10 @@ private:
     };
     using WorkgroupSet = std::set<workgroup::WorkGroupDriverSchedEntity*, WorkGroupDriverSchedEntityComparator>;
 
-    mutable std::mutex _global_mutex;
-    std::condition_variable _cv;
+    mutable ProfiledMutex<std::mutex> _global_mutex{"workgroup_driver_queue"};
+    std::condition_variable_any _cv;
+    // The threads dedicated to the short query workgroup wait on it.
+    std::condition_variable_any _sq_cv;
     bool _is_closed = false;
 
     // Contains the workgroups which include the drivers ready to be run.
@@ -3,10 +3,12 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exec/workgroup/work_group.h"
 #include "runtime/current_thread.h"
 #include "runtime/data_stream_mgr.h"
+#include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_filter_cache.h"
 #include "util/thread.h"
@@ -83,12 +85,12 @@ void QueryContext::init_mem_tracker(int64_t bytes_limit, MemTracker* parent) {
     });
 }
 
-Status QueryContext::init_query(workgroup::WorkGroup* wg) {
+Status QueryContext::init_query(workgroup::WorkGroup* wg, int64_t estimated_mem_bytes) {
     Status st = Status::OK();
     if (wg != nullptr) {
-        std::call_once(_init_query_once, [this, &st, wg]() {
+        std::call_once(_init_query_once, [this, &st, wg, estimated_mem_bytes]() {
             this->init_query_begin_time();
-            st = wg->try_incr_num_queries();
+            st = workgroup::WorkGroupManager::instance()->admit_query(wg, estimated_mem_bytes);
         });
     }
 
@@ -99,6 +101,15 @@ void QueryContext::set_query_trace(std::shared_ptr<starrocks::debug::QueryTrace>
     std::call_once(_query_trace_init_flag, [this, &query_trace]() { _query_trace = std::move(query_trace); });
 }
 
+MorselQueueStealPoolPtr QueryContext::morsel_queue_steal_pool(int32_t plan_node_id) {
+    std::lock_guard lock(_morsel_queue_steal_pools_mutex);
+    auto& pool = _morsel_queue_steal_pools[plan_node_id];
+    if (pool == nullptr) {
+        pool = std::make_shared<MorselQueueStealPool>();
+    }
+    return pool;
+}
+
 QueryContextManager::QueryContextManager(size_t log2_num_slots)
         : _num_slots(1 << log2_num_slots),
           _slot_mask(_num_slots - 1),
@@ -281,4 +292,42 @@ void QueryContextManager::clear() {
     _context_maps.clear();
 }
 
+StatusOr<CachedDescriptorTblPtr> QueryContextManager::get_desc_tbl(const TDescriptorTable& t_desc_tbl,
+                                                                  int32_t chunk_size) {
+    int64_t capacity = config::pipeline_desc_tbl_cache_capacity;
+    if (!t_desc_tbl.__isset.fingerprint || capacity <= 0) {
+        return nullptr;
+    }
+    for (const auto& t_table : t_desc_tbl.tableDescriptors) {
+        if (t_table.tableType != TTableType::OLAP_TABLE && t_table.tableType != TTableType::MATERIALIZED_VIEW) {
+            return nullptr;
+        }
+    }
+
+    DescTblKey key{t_desc_tbl.fingerprint, chunk_size};
+    {
+        std::lock_guard lock(_desc_tbl_cache_mutex);
+        if (auto it = _desc_tbl_cache.find(key); it != _desc_tbl_cache.end()) {
+            _desc_tbl_lru.splice(_desc_tbl_lru.begin(), _desc_tbl_lru, it->second.second);
+            return it->second.first;
+        }
+    }
+
+    // Create the table without holding the lock, the one created first wins if several are created concurrently.
+    auto cached = std::make_shared<CachedDescriptorTbl>();
+    RETURN_IF_ERROR(DescriptorTbl::create(&cached->pool, t_desc_tbl, &cached->desc_tbl, chunk_size));
+
+    std::lock_guard lock(_desc_tbl_cache_mutex);
+    if (auto it = _desc_tbl_cache.find(key); it != _desc_tbl_cache.end()) {
+        return it->second.first;
+    }
+    while (!_desc_tbl_lru.empty() && static_cast<int64_t>(_desc_tbl_cache.size()) >= capacity) {
+        _desc_tbl_cache.erase(_desc_tbl_lru.back());
+        _desc_tbl_lru.pop_back();
+    }
+    _desc_tbl_lru.push_front(key);
+    _desc_tbl_cache.emplace(key, std::make_pair(cached, _desc_tbl_lru.begin()));
+    return cached;
+}
+
 } // namespace starrocks::pipeline
@@ -4,11 +4,14 @@
 
 #include <atomic>
 #include <chrono>
+#include <list>
+#include <map>
 #include <mutex>
 #include <unordered_map>
 
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/pipeline_fwd.h"
+#include "gen_cpp/Descriptors_types.h"     // for TDescriptorTable
 #include "gen_cpp/InternalService_types.h" // for TQueryOptions
 #include "gen_cpp/Types_types.h"           // for TUniqueId
 #include "runtime/runtime_state.h"
@@ -23,6 +26,14 @@ using std::chrono::seconds;
 using std::chrono::milliseconds;
 using std::chrono::steady_clock;
 using std::chrono::duration_cast;
+
+// A descriptor table shared by the queries with the same plan fingerprint, see QueryContextManager::get_desc_tbl.
+struct CachedDescriptorTbl {
+    ObjectPool pool;
+    DescriptorTbl* desc_tbl = nullptr;
+};
+using CachedDescriptorTblPtr = std::shared_ptr<CachedDescriptorTbl>;
+
 // The context for all fragment of one query in one BE
 class QueryContext {
 public:
@@ -82,6 +93,11 @@ public:
         _desc_tbl = desc_tbl;
     }
 
+    // Keep |desc_tbl| alive as long as the query, since its fragments use it.
+    void hold_cached_desc_tbl(CachedDescriptorTblPtr desc_tbl) {
+        std::lock_guard lock(_cached_desc_tbls_mutex);
+        _cached_desc_tbls.emplace_back(std::move(desc_tbl));
+    }
     DescriptorTbl* desc_tbl() {
         DCHECK(_desc_tbl != nullptr);
         return _desc_tbl;
@@ -94,7 +110,8 @@ public:
     void init_mem_tracker(int64_t bytes_limit, MemTracker* parent);
     std::shared_ptr<MemTracker> mem_tracker() { return _mem_tracker; }
 
-    Status init_query(workgroup::WorkGroup* wg);
+    // Admit the query to |wg| once, see WorkGroupManager::admit_query.
+    Status init_query(workgroup::WorkGroup* wg, int64_t estimated_mem_bytes);
 
     // Some statistic about the query, including cpu, scan_rows, scan_bytes
     void incr_cpu_cost(int64_t cost) { _cur_cpu_cost_ns += cost; }
@@ -118,6 +135,9 @@ public:
 
     std::shared_ptr<starrocks::debug::QueryTrace> shared_query_trace() { return _query_trace; }
 
+    // The pool of the morsel queues of the scan node |plan_node_id| in the fragment instances of this query.
+    MorselQueueStealPoolPtr morsel_queue_steal_pool(int32_t plan_node_id);
+
 public:
     static constexpr int DEFAULT_EXPIRE_SECONDS = 300;
 
@@ -138,8 +158,12 @@ private:
     std::shared_ptr<MemTracker> _mem_tracker;
     ObjectPool _object_pool;
     DescriptorTbl* _desc_tbl = nullptr;
+    std::mutex _cached_desc_tbls_mutex;
+    std::vector<CachedDescriptorTblPtr> _cached_desc_tbls;
     std::once_flag _query_trace_init_flag;
     std::shared_ptr<starrocks::debug::QueryTrace> _query_trace;
+    std::mutex _morsel_queue_steal_pools_mutex;
+    std::unordered_map<int32_t, MorselQueueStealPoolPtr> _morsel_queue_steal_pools;
 
     std::once_flag _init_query_once;
     int64_t _query_begin_time = 0;
@@ -162,6 +186,12 @@ public:
     // used for graceful exit
     void clear();
 
+    // Return the descriptor table of |t_desc_tbl| cached across the queries, creating it if necessary, or nullptr
+    // if |t_desc_tbl| has no fingerprint or refers to tables other than OLAP tables, whose descriptors hold more
+    // than their thrift definitions. At most config::pipeline_desc_tbl_cache_capacity tables are cached, the least
+    // recently used one being evicted first.
+    StatusOr<CachedDescriptorTblPtr> get_desc_tbl(const TDescriptorTable& t_desc_tbl, int32_t chunk_size);
+
 private:
     static void _clean_func(QueryContextManager* manager);
     void _clean_query_contexts();
@@ -180,6 +210,12 @@ private:
     std::atomic<bool> _stop{false};
     std::shared_ptr<std::thread> _clean_thread;
 
+    // The cached descriptor tables, keyed by fingerprint and chunk size, and the keys by recency of use.
+    using DescTblKey = std::pair<int64_t, int32_t>;
+    std::mutex _desc_tbl_cache_mutex;
+    std::list<DescTblKey> _desc_tbl_lru;
+    std::map<DescTblKey, std::pair<CachedDescriptorTblPtr, std::list<DescTblKey>::iterator>> _desc_tbl_cache;
+
     inline static const char* _metric_name = "pip_query_ctx_cnt";
     std::unique_ptr<UIntGauge> _query_ctx_cnt;
 };
@@ -4,6 +4,7 @@
 
 #include "column/chunk.h"
 #include "exprs/expr.h"
+#include "runtime/arrow_result_writer.h"
 #include "runtime/buffer_control_block.h"
 #include "runtime/exec_env.h"
 #include "runtime/mysql_result_writer.h"
@@ -17,11 +18,18 @@ Status ResultSinkOperator::prepare(RuntimeState* state) {
 
     // Create profile
     _profile = std::make_unique<RuntimeProfile>("result sink");
+    if (_senders.empty()) {
+        return Status::InternalError("result sink has no sender");
+    }
+    _sender = _senders[_driver_sequence % _senders.size()].get();
 
     // Create writer based on sink type
     switch (_sink_type) {
     case TResultSinkType::MYSQL_PROTOCAL:
-        _writer = std::make_shared<MysqlResultWriter>(_sender.get(), _output_expr_ctxs, _profile.get());
+        _writer = std::make_shared<MysqlResultWriter>(_sender, _output_expr_ctxs, _profile.get());
+        break;
+    case TResultSinkType::ARROW:
+        _writer = std::make_shared<ArrowResultWriter>(_sender, _output_expr_ctxs, _profile.get());
         break;
     default:
         return Status::InternalError("Unknown result sink type");
@@ -39,12 +47,14 @@ void ResultSinkOperator::close(RuntimeState* state) {
         _num_written_rows.fetch_add(_writer->get_written_rows(), std::memory_order_relaxed);
     }
 
-    // Close the shared sender when the last result sink operator is closing.
+    // Close the shared senders when the last result sink operator is closing.
     if (_num_result_sinkers.fetch_sub(1, std::memory_order_acq_rel) == 1) {
-        if (_sender != nullptr) {
+        if (!_senders.empty()) {
+            // The statistics of the whole fragment instance are reported by the first partition only.
+            auto& sender = _senders[0];
             // Incrementing and reading _num_written_rows needn't memory barrier, because
             // the visibility of _num_written_rows is guaranteed by _num_result_sinkers.fetch_sub().
-            _sender->update_num_written_rows(_num_written_rows.load(std::memory_order_relaxed));
+            sender->update_num_written_rows(_num_written_rows.load(std::memory_order_relaxed));
 
             auto query_statistic = std::make_shared<QueryStatistics>();
             QueryContext* query_ctx = state->query_ctx();
@@ -52,13 +62,15 @@ void ResultSinkOperator::close(RuntimeState* state) {
             query_statistic->add_cpu_costs(query_ctx->cpu_cost());
             query_statistic->add_mem_costs(query_ctx->mem_cost_bytes());
             query_statistic->set_returned_rows(_num_written_rows);
-            _sender->set_query_statistics(query_statistic);
+            sender->set_query_statistics(query_statistic);
 
             Status final_status = _fragment_ctx->final_status();
             if (!st.ok() && final_status.ok()) {
                 final_status = st;
             }
-            _sender->close(final_status);
+            for (auto& partition_sender : _senders) {
+                partition_sender->close(final_status);
+            }
         }
 
         state->exec_env()->result_mgr()->cancel_at_time(time(nullptr) + config::result_buffer_cancelled_interval_time,
@@ -89,8 +101,7 @@ bool ResultSinkOperator::need_input() const {
         return true;
     }
 
-    auto* mysql_writer = down_cast<MysqlResultWriter*>(_writer.get());
-    auto status = mysql_writer->try_add_batch(_fetch_data_result);
+    auto status = _writer->try_add_batch(_fetch_data_result);
     if (status.ok()) {
         return status.value();
     } else {
@@ -114,11 +125,10 @@ Status ResultSinkOperator::push_chunk(RuntimeState* state, const vectorized::Chu
     }
     DCHECK(_fetch_data_result.empty());
 
-    auto* mysql_writer = down_cast<MysqlResultWriter*>(_writer.get());
-    auto status = mysql_writer->process_chunk_for_pipeline(chunk.get());
+    auto status = _writer->process_chunk_for_pipeline(chunk.get());
     if (status.ok()) {
         _fetch_data_result = std::move(status.value());
-        return mysql_writer->try_add_batch(_fetch_data_result).status();
+        return _writer->try_add_batch(_fetch_data_result).status();
     } else {
         return status.status();
     }
@@ -126,7 +136,10 @@ Status ResultSinkOperator::push_chunk(RuntimeState* state, const vectorized::Chu
 
 Status ResultSinkOperatorFactory::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(OperatorFactory::prepare(state));
-    RETURN_IF_ERROR(state->exec_env()->result_mgr()->create_sender(state->fragment_instance_id(), 1024, &_sender));
+    // The result queue is bounded by the number of rows, and an Arrow result has a single row for a whole chunk.
+    int buffer_size = _sink_type == TResultSinkType::ARROW ? ARROW_RESULT_BUFFER_SIZE : 1024;
+    RETURN_IF_ERROR(state->exec_env()->result_mgr()->create_senders(state->fragment_instance_id(),
+                                                                     _num_result_partitions, buffer_size, &_senders));
 
     RETURN_IF_ERROR(Expr::create_expr_trees(state->obj_pool(), _t_output_expr, &_output_expr_ctxs));
 
@@ -19,12 +19,13 @@ class ResultSinkOperator final : public Operator {
 public:
     ResultSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
                        TResultSinkType::type sink_type, const std::vector<ExprContext*>& output_expr_ctxs,
-                       const std::shared_ptr<BufferControlBlock>& sender, std::atomic<int32_t>& num_result_sinks,
+                       const std::vector<std::shared_ptr<BufferControlBlock>>& senders,
+                       std::atomic<int32_t>& num_result_sinks,
                        std::atomic<int64_t>& num_written_rows, FragmentContext* const fragment_ctx)
             : Operator(factory, id, "result_sink", plan_node_id, driver_sequence),
               _sink_type(sink_type),
               _output_expr_ctxs(output_expr_ctxs),
-              _sender(sender),
+              _senders(senders),
               _num_result_sinkers(num_result_sinks),
               _num_written_rows(num_written_rows),
               _fragment_ctx(fragment_ctx) {}
@@ -60,10 +61,12 @@ private:
 
     /// The following three fields are shared by all the ResultSinkOperators
     /// created by the same ResultSinkOperatorFactory.
-    const std::shared_ptr<BufferControlBlock>& _sender;
+    const std::vector<std::shared_ptr<BufferControlBlock>>& _senders;
     std::atomic<int32_t>& _num_result_sinkers;
     std::atomic<int64_t>& _num_written_rows;
 
+    // The result partition of this driver, one of _senders.
+    BufferControlBlock* _sender = nullptr;
     std::shared_ptr<ResultWriter> _writer;
     mutable TFetchDataResultPtrs _fetch_data_result;
 
@@ -77,10 +80,11 @@ private:
 
 class ResultSinkOperatorFactory final : public OperatorFactory {
 public:
-    ResultSinkOperatorFactory(int32_t id, TResultSinkType::type sink_type, std::vector<TExpr> t_output_expr,
-                              FragmentContext* const fragment_ctx)
+    ResultSinkOperatorFactory(int32_t id, TResultSinkType::type sink_type, int32_t num_result_partitions,
+                              std::vector<TExpr> t_output_expr, FragmentContext* const fragment_ctx)
             : OperatorFactory(id, "result_sink", Operator::s_pseudo_plan_node_id_for_result_sink),
               _sink_type(sink_type),
+              _num_result_partitions(num_result_partitions),
               _t_output_expr(std::move(t_output_expr)),
               _fragment_ctx(fragment_ctx) {}
 
@@ -93,7 +97,7 @@ public:
         // so it doesn't need memory barrier here.
         _increment_num_result_sinkers_no_barrier();
         return std::make_shared<ResultSinkOperator>(this, _id, _plan_node_id, driver_sequence, _sink_type,
-                                                    _output_expr_ctxs, _sender, _num_result_sinkers, _num_written_rows,
+                                                    _output_expr_ctxs, _senders, _num_result_sinkers, _num_written_rows,
                                                     _fragment_ctx);
     }
 
@@ -102,16 +106,21 @@ public:
     void close(RuntimeState* state) override;
 
 private:
+    // The number of the Arrow results, i.e. chunks, buffered for the fetch_data rpcs.
+    static constexpr int ARROW_RESULT_BUFFER_SIZE = 16;
+
     void _increment_num_result_sinkers_no_barrier() { _num_result_sinkers.fetch_add(1, std::memory_order_relaxed); }
 
     TResultSinkType::type _sink_type;
+    int32_t _num_result_partitions;
     std::vector<TExpr> _t_output_expr;
     std::vector<ExprContext*> _output_expr_ctxs;
 
     /// The followings are shared by all the ResultSinkOperators created by this ResultSinkOperatorFactory.
     // A fragment_instance_id can only have ONE sender, because result_mgr saves the mapping from fragment_instance_id
     // to sender. Therefore, sender is created in this factory and shared by all the ResultSinkOperator instances.
-    std::shared_ptr<BufferControlBlock> _sender;
+    // With multiple result partitions, the drivers are spread over the senders of the partitions.
+    std::vector<std::shared_ptr<BufferControlBlock>> _senders;
     std::atomic<int32_t> _num_result_sinkers = 0;
     std::atomic<int64_t> _num_written_rows = 0;
 
@@ -3,7 +3,6 @@
 #include "exec/pipeline/scan/balanced_chunk_buffer.h"
 
 #include "fmt/format.h"
-#include "util/blocking_queue.hpp"
 
 namespace starrocks::pipeline {
 
@@ -28,7 +27,7 @@ BalancedChunkBuffer::SubBuffer& BalancedChunkBuffer::_get_sub_buffer(int index)
 }
 
 size_t BalancedChunkBuffer::size(int buffer_index) const {
-    return _get_sub_buffer(buffer_index)->get_size();
+    return _get_sub_buffer(buffer_index)->size();
 }
 
 bool BalancedChunkBuffer::all_empty() const {
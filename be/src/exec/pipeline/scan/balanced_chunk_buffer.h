@@ -6,7 +6,7 @@
 
 #include "column/chunk.h"
 #include "exec/pipeline/scan/chunk_buffer_limiter.h"
-#include "util/blocking_queue.hpp"
+#include "util/lock_free_queue.h"
 
 namespace starrocks::pipeline {
 
@@ -35,7 +35,8 @@ public:
 
 private:
     using ChunkWithToken = std::pair<vectorized::ChunkPtr, ChunkBufferTokenPtr>;
-    using QueueT = UnboundedBlockingQueue<ChunkWithToken>;
+    // Put by the scan io threads and got by the scan operators, the buffered chunks are bounded by _limiter.
+    using QueueT = LockFreeQueue<ChunkWithToken>;
     using SubBuffer = std::unique_ptr<QueueT>;
 
     const SubBuffer& _get_sub_buffer(int index) const;
@@ -19,6 +19,7 @@ void DynamicChunkBufferLimiter::update_avg_row_bytes(size_t added_sum_row_bytes,
     if (avg_row_bytes == 0) {
         return;
     }
+    _avg_row_bytes = avg_row_bytes;
 
     size_t chunk_mem_usage = avg_row_bytes * max_chunk_rows;
     size_t new_capacity = std::max<size_t>(_mem_limit / chunk_mem_usage, 1);
@@ -32,6 +32,8 @@ public:
     // `added_sum_row_bytes` is the bytes of the new reading rows.
     // `added_num_rows` is the number of the new read rows.
     virtual void update_avg_row_bytes(size_t added_sum_row_bytes, size_t added_num_rows, size_t max_chunk_rows) {}
+    // The average bytes of the rows read so far, 0 if unknown.
+    virtual size_t avg_row_bytes() const { return 0; }
 
     // Pin a position in the buffer and return a token.
     // When desctructing the token, the position will be unpinned.
@@ -108,6 +110,7 @@ public:
     ~DynamicChunkBufferLimiter() override = default;
 
     void update_avg_row_bytes(size_t added_sum_row_bytes, size_t added_num_rows, size_t max_chunk_rows) override;
+    size_t avg_row_bytes() const override { return _avg_row_bytes; }
 
     ChunkBufferTokenPtr pin(int num_chunks) override;
 
@@ -123,6 +126,7 @@ private:
     std::mutex _mutex;
     size_t _sum_row_bytes = 0;
     size_t _num_rows = 0;
+    std::atomic<size_t> _avg_row_bytes = 0;
 
     size_t _capacity;
     const size_t _max_capacity;
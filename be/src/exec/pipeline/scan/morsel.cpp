@@ -2,6 +2,8 @@
 
 #include "exec/pipeline/scan/morsel.h"
 
+#include <algorithm>
+
 #include "exec/olap_utils.h"
 #include "storage/chunk_helper.h"
 #include "storage/range.h"
@@ -29,6 +31,15 @@ size_t SharedMorselQueueFactory::num_original_morsels() const {
     return _queue->num_original_morsels();
 }
 
+bool SharedMorselQueueFactory::can_steal_morsels() const {
+    return dynamic_cast<FixedMorselQueue*>(_queue.get()) != nullptr;
+}
+
+void SharedMorselQueueFactory::enable_morsel_stealing(MorselQueueStealPoolPtr pool) {
+    DCHECK(can_steal_morsels());
+    _queue = std::make_unique<StealingMorselQueue>(std::move(_queue), std::move(pool));
+}
+
 size_t IndividualMorselQueueFactory::num_original_morsels() const {
     size_t total = 0;
     for (const auto& queue : _queue_per_driver_seq) {
@@ -617,6 +628,54 @@ ShortKeyIndexGroupIterator LogicalSplitMorselQueue::_upper_bound_ordinal(const v
     return end_iter;
 }
 
+void MorselQueueStealPool::add(MorselQueue* queue) {
+    std::lock_guard lock(_mutex);
+    _queues.emplace_back(queue);
+}
+
+void MorselQueueStealPool::remove(MorselQueue* queue) {
+    std::lock_guard lock(_mutex);
+    _queues.erase(std::remove(_queues.begin(), _queues.end(), queue), _queues.end());
+}
+
+bool MorselQueueStealPool::empty() const {
+    std::lock_guard lock(_mutex);
+    return std::all_of(_queues.begin(), _queues.end(), [](const auto* queue) { return queue->empty(); });
+}
+
+StatusOr<MorselPtr> MorselQueueStealPool::try_steal() {
+    // The queues are removed under the lock before being destroyed, and try_get() of a FixedMorselQueue does
+    // not block, so it is called under the lock.
+    std::lock_guard lock(_mutex);
+    for (auto* queue : _queues) {
+        if (queue->empty()) {
+            continue;
+        }
+        ASSIGN_OR_RETURN(auto morsel, queue->try_get());
+        if (morsel != nullptr) {
+            return std::move(morsel);
+        }
+    }
+    return nullptr;
+}
+
+StealingMorselQueue::StealingMorselQueue(MorselQueuePtr queue, MorselQueueStealPoolPtr pool)
+        : _queue(std::move(queue)), _pool(std::move(pool)) {
+    _pool->add(_queue.get());
+}
+
+StealingMorselQueue::~StealingMorselQueue() {
+    _pool->remove(_queue.get());
+}
+
+StatusOr<MorselPtr> StealingMorselQueue::try_get() {
+    ASSIGN_OR_RETURN(auto morsel, _queue->try_get());
+    if (morsel != nullptr) {
+        return std::move(morsel);
+    }
+    return _pool->try_steal();
+}
+
 MorselQueuePtr create_empty_morsel_queue() {
     return std::make_unique<FixedMorselQueue>(std::vector<MorselPtr>{});
 }
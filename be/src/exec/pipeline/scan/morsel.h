@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <optional>
 
 #include "gen_cpp/InternalService_types.h"
@@ -48,6 +49,8 @@ using MorselQueueMap = std::unordered_map<int32_t, MorselQueuePtr>;
 class MorselQueueFactory;
 using MorselQueueFactoryPtr = std::unique_ptr<MorselQueueFactory>;
 using MorselQueueFactoryMap = std::unordered_map<int32_t, MorselQueueFactoryPtr>;
+class MorselQueueStealPool;
+using MorselQueueStealPoolPtr = std::shared_ptr<MorselQueueStealPool>;
 
 /// Morsel.
 class Morsel {
@@ -128,6 +131,11 @@ public:
     bool is_shared() const override { return true; }
     bool need_local_shuffle() const override { return true; }
 
+    // Only the morsels of a FixedMorselQueue are whole scan ranges, which any fragment instance can read.
+    bool can_steal_morsels() const;
+    // Let the queue steal the morsels of the other queues of |pool|, once it runs out of its own.
+    void enable_morsel_stealing(MorselQueueStealPoolPtr pool);
+
 private:
     MorselQueuePtr _queue;
     const int _size;
@@ -350,6 +358,44 @@ private:
     ShortKeyIndexGroupIterator _next_lower_block_iter;
 };
 
+// The shared morsel queues of a scan node in the fragment instances of a query on this BE.
+// A queue of StealingMorselQueue is added to the pool when created and removed when destroyed.
+class MorselQueueStealPool {
+public:
+    void add(MorselQueue* queue);
+    void remove(MorselQueue* queue);
+
+    bool empty() const;
+    // Return nullptr, if the queues are empty.
+    StatusOr<MorselPtr> try_steal();
+
+private:
+    mutable std::mutex _mutex;
+    std::vector<MorselQueue*> _queues;
+};
+
+// A morsel queue which steals the morsels of the other fragment instances of the same scan node, once it runs
+// out of its own, so that an instance assigned fewer or lighter scan ranges does not wait for
+// the others having more of them.
+class StealingMorselQueue final : public MorselQueue {
+public:
+    StealingMorselQueue(MorselQueuePtr queue, MorselQueueStealPoolPtr pool);
+    ~StealingMorselQueue() override;
+
+    std::vector<TInternalScanRange*> olap_scan_ranges() const override { return _queue->olap_scan_ranges(); }
+
+    size_t num_original_morsels() const override { return _queue->num_original_morsels(); }
+    size_t max_degree_of_parallelism() const override { return _queue->max_degree_of_parallelism(); }
+    bool empty() const override { return _queue->empty() && _pool->empty(); }
+    StatusOr<MorselPtr> try_get() override;
+
+    std::string name() const override { return "stealing_morsel_queue"; }
+
+private:
+    MorselQueuePtr _queue;
+    MorselQueueStealPoolPtr _pool;
+};
+
 MorselQueuePtr create_empty_morsel_queue();
 
 } // namespace pipeline
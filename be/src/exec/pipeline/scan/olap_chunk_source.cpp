@@ -10,6 +10,7 @@
 #include "exec/vectorized/olap_scan_prepare.h"
 #include "exec/workgroup/work_group.h"
 #include "exprs/vectorized/runtime_filter.h"
+#include "exprs/vectorized/runtime_filter_bank.h"
 #include "gutil/map_util.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
@@ -17,6 +18,7 @@
 #include "runtime/primitive_type.h"
 #include "storage/chunk_helper.h"
 #include "storage/column_predicate_rewriter.h"
+#include "storage/data_dir.h"
 #include "storage/predicate_parser.h"
 #include "storage/projection_iterator.h"
 #include "storage/storage_engine.h"
@@ -38,8 +40,9 @@ OlapChunkSource::~OlapChunkSource() {
 }
 
 void OlapChunkSource::close(RuntimeState* state) {
-    if (_reader) {
+    if (_reader || _shared_scan_iter) {
         _update_counter();
+        _tablet->read_heat().record(_reader_stats().bytes_read);
     }
     if (_prj_iter) {
         _prj_iter->close();
@@ -47,7 +50,9 @@ void OlapChunkSource::close(RuntimeState* state) {
     if (_reader) {
         _reader.reset();
     }
+    _shared_scan_iter.reset();
     _predicate_free_pool.clear();
+    _release_cached_chunks();
 }
 
 Status OlapChunkSource::prepare(RuntimeState* state) {
@@ -115,6 +120,15 @@ void OlapChunkSource::_init_counter(RuntimeState* state) {
 
     // IOTime
     _io_timer = ADD_TIMER(_runtime_profile, "IOTime");
+
+    if (_scan_node->thrift_olap_scan_node().__isset.scan_cache_digest) {
+        _cache_hit_counter = ADD_COUNTER(_runtime_profile, "ScanResultCacheHitTablets", TUnit::UNIT);
+        _cache_incremental_hit_counter =
+                ADD_COUNTER(_runtime_profile, "ScanResultCacheIncrementalHitTablets", TUnit::UNIT);
+    }
+    if (config::enable_shared_tablet_scan) {
+        _shared_scan_counter = ADD_COUNTER(_runtime_profile, "SharedScanTablets", TUnit::UNIT);
+    }
 }
 
 Status OlapChunkSource::_get_tablet(const TInternalScanRange* scan_range) {
@@ -130,7 +144,9 @@ void OlapChunkSource::_decide_chunk_size() {
         // Improve for select * from table limit x, x is small
         _params.chunk_size = _limit;
     } else {
-        _params.chunk_size = _runtime_state->chunk_size();
+        // The chunks read by the former chunk sources of this scan tell the width of its rows.
+        _params.chunk_size = ChunkHelper::chunk_size_for_row_bytes(
+                _runtime_state->chunk_size(), _chunk_buffer.limiter()->avg_row_bytes());
     }
 }
 
@@ -145,6 +161,9 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
     _params.profile = _runtime_profile;
     _params.runtime_state = _runtime_state;
     _params.use_page_cache = !config::disable_storage_page_cache;
+    const int64_t sequential_scan_rows = config::storage_page_cache_sequential_scan_rows;
+    _params.sequential_scan = _limit == -1 && sequential_scan_rows > 0 &&
+                              static_cast<int64_t>(_tablet->num_rows()) >= sequential_scan_rows;
     _morsel->init_tablet_reader_params(&_params);
     _decide_chunk_size();
 
@@ -160,6 +179,11 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
         _predicate_free_pool.emplace_back(std::move(p));
     }
 
+    _init_runtime_range_pruner();
+    if (!_runtime_range_pruner.empty()) {
+        _params.runtime_range_pruner = &_runtime_range_pruner;
+    }
+
     {
         vectorized::ConjunctivePredicatesRewriter not_pushdown_predicate_rewriter(_not_push_down_predicates,
                                                                                   *_params.global_dictmaps);
@@ -200,6 +224,83 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
     return Status::OK();
 }
 
+void OlapChunkSource::_init_runtime_range_pruner() {
+    if (config::enable_topn_runtime_filter) {
+        _init_topn_runtime_filters();
+    }
+    const auto* runtime_filters = _scan_ctx->conjuncts_manager().runtime_filters;
+    if (runtime_filters == nullptr) {
+        return;
+    }
+    for (const auto& [_, desc] : runtime_filters->descriptors()) {
+        // The arrived runtime filters have been pushed down by OlapScanConjunctsManager.
+        SlotId slot_id;
+        if (desc->runtime_filter() != nullptr || !desc->is_probe_slot_ref(&slot_id)) {
+            continue;
+        }
+        auto slot_iter = std::find_if(_slots->begin(), _slots->end(),
+                                      [slot_id](const SlotDescriptor* slot) { return slot->id() == slot_id; });
+        if (slot_iter == _slots->end()) {
+            continue;
+        }
+        const SlotDescriptor* slot = *slot_iter;
+        int32_t index = _tablet->field_index(slot->col_name());
+        if (index < 0) {
+            continue;
+        }
+        _runtime_range_pruner.add_runtime_filter(
+                index, [desc = desc]() { return desc->runtime_filter() != nullptr; },
+                [this, desc = desc, slot](RuntimeRangePruner::PredicateList* preds) -> Status {
+                    PredicateParser parser(_tablet->tablet_schema());
+                    std::vector<PredicatePtr> rf_preds;
+                    RETURN_IF_ERROR(OlapScanConjunctsManager::get_runtime_filter_predicates(
+                            *slot, desc->runtime_filter(), &parser, &rf_preds));
+                    for (auto& p : rf_preds) {
+                        // The value columns of the aggregate tables can't be filtered before aggregation.
+                        if (parser.can_pushdown(p.get())) {
+                            preds->push_back(p.get());
+                            _predicate_free_pool.emplace_back(std::move(p));
+                        }
+                    }
+                    return Status::OK();
+                });
+    }
+}
+
+void OlapChunkSource::_init_topn_runtime_filters() {
+    const auto& global_dict_map = _runtime_state->get_query_global_dict_map();
+    for (const auto& filter : _scan_node->topn_runtime_filters()) {
+        SlotId slot_id = filter->slot_id();
+        auto slot_iter = std::find_if(_slots->begin(), _slots->end(),
+                                      [slot_id](const SlotDescriptor* slot) { return slot->id() == slot_id; });
+        // The sort of the dictionary codes doesn't give a boundary of the strings stored.
+        if (slot_iter == _slots->end() || global_dict_map.count(slot_id) > 0) {
+            continue;
+        }
+        const SlotDescriptor* slot = *slot_iter;
+        int32_t index = _tablet->field_index(slot->col_name());
+        if (index < 0) {
+            continue;
+        }
+        _runtime_range_pruner.add_versioned_filter(
+                index, [filter = filter]() { return filter->version(); },
+                [this, filter = filter, slot](RuntimeRangePruner::PredicateList* preds) -> Status {
+                    PredicateParser parser(_tablet->tablet_schema());
+                    std::vector<PredicatePtr> topn_preds;
+                    RETURN_IF_ERROR(OlapScanConjunctsManager::get_topn_filter_predicates(*slot, *filter, &parser,
+                                                                                         &topn_preds));
+                    for (auto& p : topn_preds) {
+                        // The value columns of the aggregate tables can't be filtered before aggregation.
+                        if (parser.can_pushdown(p.get())) {
+                            preds->push_back(p.get());
+                            _predicate_free_pool.emplace_back(std::move(p));
+                        }
+                    }
+                    return Status::OK();
+                });
+    }
+}
+
 Status OlapChunkSource::_init_scanner_columns(std::vector<uint32_t>& scanner_columns) {
     for (auto slot : *_slots) {
         DCHECK(slot->is_materialized());
@@ -251,17 +352,33 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
     RETURN_IF_ERROR(_init_unused_output_columns(thrift_olap_scan_node.unused_output_column_name));
     RETURN_IF_ERROR(_init_scanner_columns(scanner_columns));
     RETURN_IF_ERROR(_init_reader_params(_scan_ctx->key_ranges(), scanner_columns, reader_columns));
+    _init_scan_result_cache();
+    if (_cache_entry != nullptr && _start_version > _version) {
+        // All the chunks are cached.
+        return Status::OK();
+    }
     const TabletSchema& tablet_schema = _tablet->tablet_schema();
-    starrocks::vectorized::Schema child_schema =
-            ChunkHelper::convert_schema_to_format_v2(tablet_schema, reader_columns);
-
-    _reader = std::make_shared<TabletReader>(_tablet, Version(0, _version), std::move(child_schema));
+    ChunkIteratorPtr child_iter;
+    if (_can_share_tablet_scan()) {
+        ASSIGN_OR_RETURN(auto shared_scan,
+                         SharedTabletScanManager::instance()->get_or_create(
+                                 _tablet, _version, _params.skip_aggregation, reader_columns, _params.chunk_size));
+        _shared_scan_iter =
+                std::make_shared<SharedTabletScanIterator>(std::move(shared_scan), runtime_state, _params.predicates);
+        child_iter = _shared_scan_iter;
+        COUNTER_UPDATE(_shared_scan_counter, 1);
+    } else {
+        starrocks::vectorized::Schema child_schema =
+                ChunkHelper::convert_schema_to_format_v2(tablet_schema, reader_columns);
+        _reader = std::make_shared<TabletReader>(_tablet, Version(_start_version, _version), std::move(child_schema));
+        child_iter = _reader;
+    }
     if (reader_columns.size() == scanner_columns.size()) {
-        _prj_iter = _reader;
+        _prj_iter = child_iter;
     } else {
         starrocks::vectorized::Schema output_schema =
                 ChunkHelper::convert_schema_to_format_v2(tablet_schema, scanner_columns);
-        _prj_iter = new_projection_iterator(output_schema, _reader);
+        _prj_iter = new_projection_iterator(output_schema, child_iter);
     }
 
     if (!_scan_ctx->not_push_down_conjuncts().empty() || !_not_push_down_predicates.empty()) {
@@ -272,15 +389,133 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
     RETURN_IF_ERROR(_prj_iter->init_encoded_schema(*_params.global_dictmaps));
     RETURN_IF_ERROR(_prj_iter->init_output_schema(*_params.unused_output_column_ids));
 
-    RETURN_IF_ERROR(_reader->prepare());
-    RETURN_IF_ERROR(_reader->open(_params));
+    if (_reader != nullptr) {
+        RETURN_IF_ERROR(_reader->prepare());
+        RETURN_IF_ERROR(_reader->open(_params));
+    }
 
     return Status::OK();
 }
 
+bool OlapChunkSource::_can_share_tablet_scan() const {
+    // The counter is added only if enable_shared_tablet_scan is on.
+    if (_shared_scan_counter == nullptr || _limit != -1 || _start_version != 0) {
+        return false;
+    }
+    // The rows of the shared units are neither merged nor aggregated, nor decoded by the global dicts of a query.
+    KeysType keys_type = _tablet->keys_type();
+    if (keys_type != PRIMARY_KEYS && keys_type != DUP_KEYS && !(keys_type == UNIQUE_KEYS && _params.skip_aggregation)) {
+        return false;
+    }
+    if (!_params.global_dictmaps->empty()) {
+        return false;
+    }
+    // Only the morsels of whole tablets without key ranges, which would read all the units anyway.
+    return _params.rowid_range_option == nullptr && _params.short_key_ranges.empty() && _params.start_key.empty();
+}
+
+const OlapReaderStatistics& OlapChunkSource::_reader_stats() const {
+    return _reader != nullptr ? _reader->stats() : _shared_scan_iter->stats();
+}
+
 Status OlapChunkSource::_read_chunk(RuntimeState* state, ChunkPtr* chunk) {
-    chunk->reset(ChunkHelper::new_chunk_pooled(_prj_iter->output_schema(), _runtime_state->chunk_size(), true));
-    return _read_chunk_from_storage(_runtime_state, (*chunk).get());
+    if (_cache_entry != nullptr && _next_cached_chunk < _cache_entry->chunks.size()) {
+        return _read_chunk_from_cache(chunk);
+    }
+    chunk->reset(ChunkHelper::new_chunk_pooled(_prj_iter->output_schema(), _params.chunk_size, true));
+    Status status = _read_chunk_from_storage(_runtime_state, (*chunk).get());
+    if (_populate_cache && (status.ok() || status.is_end_of_file())) {
+        _cache_chunk(*chunk, status.is_end_of_file());
+    }
+    return status;
+}
+
+void OlapChunkSource::_init_scan_result_cache() {
+    const TOlapScanNode& thrift_olap_scan_node = _scan_node->thrift_olap_scan_node();
+    // Besides the digest, the chunks depend on the runtime filters and the global dicts of the query, and on
+    // the part of the tablet taken by the morsel.
+    if (!thrift_olap_scan_node.__isset.scan_cache_digest || config::scan_result_cache_capacity <= 0 || _limit != -1 ||
+        _scan_ctx->has_runtime_filters() || !_params.global_dictmaps->empty() ||
+        _params.rowid_range_option != nullptr || !_params.short_key_ranges.empty()) {
+        return;
+    }
+
+    auto entry = ScanResultCache::instance()->lookup(thrift_olap_scan_node.scan_cache_digest, _tablet->tablet_id());
+    if (entry == nullptr) {
+        _populate_cache = true;
+    } else if (entry->version == _version) {
+        COUNTER_UPDATE(_cache_hit_counter, 1);
+        _start_version = _version + 1;
+        _cache_entry = std::move(entry);
+    } else if (entry->version < _version) {
+        _populate_cache = true;
+        if (_can_read_incrementally(entry->version)) {
+            COUNTER_UPDATE(_cache_incremental_hit_counter, 1);
+            _start_version = entry->version + 1;
+            _chunks_to_cache = entry->chunks;
+            _bytes_to_cache = entry->bytes;
+            _cache_entry = std::move(entry);
+        }
+    }
+    // Otherwise the entry is newer than this scan, and is kept.
+}
+
+bool OlapChunkSource::_can_read_incrementally(int64_t cached_version) const {
+    // The rowsets of a duplicate key tablet only add rows, unless they come with delete predicates.
+    if (_tablet->keys_type() != KeysType::DUP_KEYS) {
+        return false;
+    }
+    std::shared_lock l(_tablet->get_header_lock());
+    for (const auto& delete_predicate : _tablet->delete_predicates()) {
+        if (delete_predicate.version() > cached_version) {
+            return false;
+        }
+    }
+    // The rowsets before |cached_version| may have been compacted with the later ones.
+    std::vector<Version> version_path;
+    return _tablet->capture_consistent_versions(Version(cached_version + 1, _version), &version_path).ok();
+}
+
+Status OlapChunkSource::_read_chunk_from_cache(ChunkPtr* chunk) {
+    const ChunkPtr& cached_chunk = _cache_entry->chunks[_next_cached_chunk++];
+    *chunk = cached_chunk->clone_unique();
+    _num_rows_read += (*chunk)->num_rows();
+    if (_prj_iter == nullptr && _next_cached_chunk == _cache_entry->chunks.size()) {
+        return Status::EndOfFile("read all the cached chunks");
+    }
+    return Status::OK();
+}
+
+void OlapChunkSource::_cache_chunk(const ChunkPtr& chunk, bool is_last_chunk) {
+    // The cached chunks outlive the query, so they are not charged to it.
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(nullptr);
+    // An entry keeps at least one chunk, which comes with the end of file when it is read back.
+    if (chunk->num_rows() > 0 || (is_last_chunk && _chunks_to_cache.empty())) {
+        ChunkPtr cached_chunk = chunk->clone_unique();
+        _bytes_to_cache += cached_chunk->memory_usage();
+        _chunks_to_cache.emplace_back(std::move(cached_chunk));
+    }
+    if (_bytes_to_cache > config::scan_result_cache_entry_max_bytes) {
+        _populate_cache = false;
+        _chunks_to_cache.clear();
+        return;
+    }
+    if (is_last_chunk) {
+        auto entry = std::make_shared<ScanResultCacheEntry>();
+        entry->version = _version;
+        entry->chunks = std::move(_chunks_to_cache);
+        entry->bytes = _bytes_to_cache;
+        ScanResultCache::instance()->insert(_scan_node->thrift_olap_scan_node().scan_cache_digest,
+                                            _tablet->tablet_id(), std::move(entry));
+        _populate_cache = false;
+        _chunks_to_cache.clear();
+    }
+}
+
+void OlapChunkSource::_release_cached_chunks() {
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(nullptr);
+    _chunks_to_cache.clear();
+    _cache_entry.reset();
 }
 
 // mapping a slot-column-id to schema-columnid
@@ -348,7 +583,7 @@ Status OlapChunkSource::_read_chunk_from_storage(RuntimeState* state, vectorized
 }
 
 void OlapChunkSource::_update_realtime_counter(vectorized::Chunk* chunk) {
-    auto& stats = _reader->stats();
+    auto& stats = _reader_stats();
     _num_rows_read += chunk->num_rows();
     _scan_rows_num = stats.raw_rows_read;
     _scan_bytes = stats.bytes_read;
@@ -366,70 +601,75 @@ void OlapChunkSource::_update_realtime_counter(vectorized::Chunk* chunk) {
 }
 
 void OlapChunkSource::_update_counter() {
-    COUNTER_UPDATE(_create_seg_iter_timer, _reader->stats().create_segment_iter_ns);
+    if (_tablet != nullptr && _tablet->data_dir() != nullptr) {
+        const auto& stats = _reader_stats();
+        _tablet->data_dir()->compaction_io_throttle()->update_scan_latency(
+                stats.io_ns, stats.total_pages_num - stats.cached_pages_num);
+    }
+    COUNTER_UPDATE(_create_seg_iter_timer, _reader_stats().create_segment_iter_ns);
     COUNTER_UPDATE(_rows_read_counter, _num_rows_read);
 
-    COUNTER_UPDATE(_io_timer, _reader->stats().io_ns);
-    COUNTER_UPDATE(_read_compressed_counter, _reader->stats().compressed_bytes_read);
-    COUNTER_UPDATE(_decompress_timer, _reader->stats().decompress_ns);
-    COUNTER_UPDATE(_read_uncompressed_counter, _reader->stats().uncompressed_bytes_read);
-    COUNTER_UPDATE(_bytes_read_counter, _reader->stats().bytes_read);
+    COUNTER_UPDATE(_io_timer, _reader_stats().io_ns);
+    COUNTER_UPDATE(_read_compressed_counter, _reader_stats().compressed_bytes_read);
+    COUNTER_UPDATE(_decompress_timer, _reader_stats().decompress_ns);
+    COUNTER_UPDATE(_read_uncompressed_counter, _reader_stats().uncompressed_bytes_read);
+    COUNTER_UPDATE(_bytes_read_counter, _reader_stats().bytes_read);
 
-    COUNTER_UPDATE(_block_load_timer, _reader->stats().block_load_ns);
-    COUNTER_UPDATE(_block_load_counter, _reader->stats().blocks_load);
-    COUNTER_UPDATE(_block_fetch_timer, _reader->stats().block_fetch_ns);
-    COUNTER_UPDATE(_block_seek_timer, _reader->stats().block_seek_ns);
+    COUNTER_UPDATE(_block_load_timer, _reader_stats().block_load_ns);
+    COUNTER_UPDATE(_block_load_counter, _reader_stats().blocks_load);
+    COUNTER_UPDATE(_block_fetch_timer, _reader_stats().block_fetch_ns);
+    COUNTER_UPDATE(_block_seek_timer, _reader_stats().block_seek_ns);
 
-    COUNTER_UPDATE(_chunk_copy_timer, _reader->stats().vec_cond_chunk_copy_ns);
-    COUNTER_UPDATE(_seg_init_timer, _reader->stats().segment_init_ns);
+    COUNTER_UPDATE(_chunk_copy_timer, _reader_stats().vec_cond_chunk_copy_ns);
+    COUNTER_UPDATE(_seg_init_timer, _reader_stats().segment_init_ns);
 
-    COUNTER_UPDATE(_raw_rows_counter, _reader->stats().raw_rows_read);
+    COUNTER_UPDATE(_raw_rows_counter, _reader_stats().raw_rows_read);
 
     int64_t cond_evaluate_ns = 0;
-    cond_evaluate_ns += _reader->stats().vec_cond_evaluate_ns;
-    cond_evaluate_ns += _reader->stats().branchless_cond_evaluate_ns;
-    cond_evaluate_ns += _reader->stats().expr_cond_evaluate_ns;
+    cond_evaluate_ns += _reader_stats().vec_cond_evaluate_ns;
+    cond_evaluate_ns += _reader_stats().branchless_cond_evaluate_ns;
+    cond_evaluate_ns += _reader_stats().expr_cond_evaluate_ns;
     // In order to avoid exposing too detailed metrics, we still record these infos on `_pred_filter_timer`
     // When we support metric classification, we can disassemble it again.
     COUNTER_UPDATE(_pred_filter_timer, cond_evaluate_ns);
-    COUNTER_UPDATE(_pred_filter_counter, _reader->stats().rows_vec_cond_filtered);
-    COUNTER_UPDATE(_del_vec_filter_counter, _reader->stats().rows_del_vec_filtered);
+    COUNTER_UPDATE(_pred_filter_counter, _reader_stats().rows_vec_cond_filtered);
+    COUNTER_UPDATE(_del_vec_filter_counter, _reader_stats().rows_del_vec_filtered);
 
-    COUNTER_UPDATE(_seg_zm_filtered_counter, _reader->stats().segment_stats_filtered);
-    COUNTER_UPDATE(_zm_filtered_counter, _reader->stats().rows_stats_filtered);
-    COUNTER_UPDATE(_bf_filtered_counter, _reader->stats().rows_bf_filtered);
-    COUNTER_UPDATE(_sk_filtered_counter, _reader->stats().rows_key_range_filtered);
-    COUNTER_UPDATE(_index_load_timer, _reader->stats().index_load_ns);
+    COUNTER_UPDATE(_seg_zm_filtered_counter, _reader_stats().segment_stats_filtered);
+    COUNTER_UPDATE(_zm_filtered_counter, _reader_stats().rows_stats_filtered);
+    COUNTER_UPDATE(_bf_filtered_counter, _reader_stats().rows_bf_filtered);
+    COUNTER_UPDATE(_sk_filtered_counter, _reader_stats().rows_key_range_filtered);
+    COUNTER_UPDATE(_index_load_timer, _reader_stats().index_load_ns);
 
-    COUNTER_UPDATE(_read_pages_num_counter, _reader->stats().total_pages_num);
-    COUNTER_UPDATE(_cached_pages_num_counter, _reader->stats().cached_pages_num);
+    COUNTER_UPDATE(_read_pages_num_counter, _reader_stats().total_pages_num);
+    COUNTER_UPDATE(_cached_pages_num_counter, _reader_stats().cached_pages_num);
 
-    COUNTER_UPDATE(_bi_filtered_counter, _reader->stats().rows_bitmap_index_filtered);
-    COUNTER_UPDATE(_bi_filter_timer, _reader->stats().bitmap_index_filter_timer);
-    COUNTER_UPDATE(_block_seek_counter, _reader->stats().block_seek_num);
+    COUNTER_UPDATE(_bi_filtered_counter, _reader_stats().rows_bitmap_index_filtered);
+    COUNTER_UPDATE(_bi_filter_timer, _reader_stats().bitmap_index_filter_timer);
+    COUNTER_UPDATE(_block_seek_counter, _reader_stats().block_seek_num);
 
-    COUNTER_UPDATE(_rowsets_read_count, _reader->stats().rowsets_read_count);
-    COUNTER_UPDATE(_segments_read_count, _reader->stats().segments_read_count);
-    COUNTER_UPDATE(_total_columns_data_page_count, _reader->stats().total_columns_data_page_count);
+    COUNTER_UPDATE(_rowsets_read_count, _reader_stats().rowsets_read_count);
+    COUNTER_UPDATE(_segments_read_count, _reader_stats().segments_read_count);
+    COUNTER_UPDATE(_total_columns_data_page_count, _reader_stats().total_columns_data_page_count);
 
     COUNTER_SET(_pushdown_predicates_counter, (int64_t)_params.predicates.size());
 
     StarRocksMetrics::instance()->query_scan_bytes.increment(_scan_bytes);
     StarRocksMetrics::instance()->query_scan_rows.increment(_scan_rows_num);
 
-    if (_reader->stats().decode_dict_ns > 0) {
+    if (_reader_stats().decode_dict_ns > 0) {
         RuntimeProfile::Counter* c = ADD_TIMER(_runtime_profile, "DictDecode");
-        COUNTER_UPDATE(c, _reader->stats().decode_dict_ns);
+        COUNTER_UPDATE(c, _reader_stats().decode_dict_ns);
     }
-    if (_reader->stats().late_materialize_ns > 0) {
+    if (_reader_stats().late_materialize_ns > 0) {
         RuntimeProfile::Counter* c = ADD_TIMER(_runtime_profile, "LateMaterialize");
-        COUNTER_UPDATE(c, _reader->stats().late_materialize_ns);
+        COUNTER_UPDATE(c, _reader_stats().late_materialize_ns);
     }
-    if (_reader->stats().del_filter_ns > 0) {
+    if (_reader_stats().del_filter_ns > 0) {
         RuntimeProfile::Counter* c1 = ADD_TIMER(_runtime_profile, "DeleteFilter");
         RuntimeProfile::Counter* c2 = ADD_COUNTER(_runtime_profile, "DeleteFilterRows", TUnit::UNIT);
-        COUNTER_UPDATE(c1, _reader->stats().del_filter_ns);
-        COUNTER_UPDATE(c2, _reader->stats().rows_del_filtered);
+        COUNTER_UPDATE(c1, _reader_stats().del_filter_ns);
+        COUNTER_UPDATE(c2, _reader_stats().rows_del_filtered);
     }
 }
 
@@ -7,6 +7,8 @@
 #include "exec/olap_common.h"
 #include "exec/olap_utils.h"
 #include "exec/pipeline/scan/chunk_source.h"
+#include "exec/pipeline/scan/scan_result_cache.h"
+#include "exec/pipeline/scan/shared_tablet_scan.h"
 #include "exec/vectorized/olap_scan_prepare.h"
 #include "exec/workgroup/work_group_fwd.h"
 #include "exprs/expr.h"
@@ -14,6 +16,7 @@
 #include "gen_cpp/InternalService_types.h"
 #include "runtime/runtime_state.h"
 #include "storage/conjunctive_predicates.h"
+#include "storage/runtime_range_pruner.h"
 #include "storage/tablet.h"
 #include "storage/tablet_reader.h"
 
@@ -49,7 +52,17 @@ private:
     Status _init_olap_reader(RuntimeState* state);
     void _init_counter(RuntimeState* state);
     Status _init_global_dicts(vectorized::TabletReaderParams* params);
+    void _init_runtime_range_pruner();
+    void _init_topn_runtime_filters();
     Status _read_chunk_from_storage([[maybe_unused]] RuntimeState* state, vectorized::Chunk* chunk);
+    void _init_scan_result_cache();
+    bool _can_read_incrementally(int64_t cached_version) const;
+    Status _read_chunk_from_cache(ChunkPtr* chunk);
+    void _cache_chunk(const ChunkPtr& chunk, bool is_last_chunk);
+    void _release_cached_chunks();
+    bool _can_share_tablet_scan() const;
+    // The statistics of |_reader|, or of |_shared_scan_iter| if the tablet scan is shared.
+    const OlapReaderStatistics& _reader_stats() const;
     void _update_counter();
     void _update_realtime_counter(vectorized::Chunk* chunk);
     void _decide_chunk_size();
@@ -76,8 +89,13 @@ private:
     using PredicatePtr = std::unique_ptr<vectorized::ColumnPredicate>;
     std::vector<PredicatePtr> _predicate_free_pool;
 
+    // The predicates of the runtime filters arrived after opening |_reader| are put into |_predicate_free_pool|.
+    vectorized::RuntimeRangePruner _runtime_range_pruner;
+
     // NOTE: _reader may reference the _predicate_free_pool, it should be released before the _predicate_free_pool
     std::shared_ptr<vectorized::TabletReader> _reader;
+    // Instead of |_reader|, if the scan of the tablet is shared with the other queries, see SharedTabletScan.
+    std::shared_ptr<SharedTabletScanIterator> _shared_scan_iter;
     // projection iterator, doing the job of choosing |_scanner_columns| from |_reader_columns|.
     std::shared_ptr<vectorized::ChunkIterator> _prj_iter;
 
@@ -87,6 +105,17 @@ private:
     // slot descriptors for each one of |output_columns|.
     std::vector<SlotDescriptor*> _query_slots;
 
+    // The chunks read before |_start_version| are served from |_cache_entry|, then the rest from |_reader|,
+    // or nothing is read from |_reader| if |_cache_entry| has all the chunks of |_version|.
+    ScanResultCacheEntryPtr _cache_entry;
+    size_t _next_cached_chunk = 0;
+    int64_t _start_version = 0;
+    // Whether the chunks of |_version| are put into ScanResultCache at the end of the scan, which is given up
+    // once they exceed scan_result_cache_entry_max_bytes.
+    bool _populate_cache = false;
+    std::vector<ChunkPtr> _chunks_to_cache;
+    size_t _bytes_to_cache = 0;
+
     // The following are profile meatures
     int64_t _num_rows_read = 0;
 
@@ -131,6 +160,9 @@ private:
     RuntimeProfile::Counter* _rowsets_read_count = nullptr;
     RuntimeProfile::Counter* _segments_read_count = nullptr;
     RuntimeProfile::Counter* _total_columns_data_page_count = nullptr;
+    RuntimeProfile::Counter* _cache_hit_counter = nullptr;
+    RuntimeProfile::Counter* _cache_incremental_hit_counter = nullptr;
+    RuntimeProfile::Counter* _shared_scan_counter = nullptr;
 };
 } // namespace pipeline
 } // namespace starrocks
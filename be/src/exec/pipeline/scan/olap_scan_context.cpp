@@ -50,6 +50,9 @@ Status OlapScanContext::parse_conjuncts(RuntimeState* state, const std::vector<E
     // Get _conjunct_ctxs.
     _conjunct_ctxs = _scan_node->conjunct_ctxs();
     _conjunct_ctxs.insert(_conjunct_ctxs.end(), runtime_in_filters.begin(), runtime_in_filters.end());
+    _has_runtime_filters = !runtime_in_filters.empty() ||
+                           (runtime_bloom_filters != nullptr && !runtime_bloom_filters->empty()) ||
+                           !_scan_node->topn_runtime_filters().empty();
 
     // eval_const_conjuncts.
     Status status;
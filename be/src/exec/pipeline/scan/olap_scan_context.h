@@ -46,6 +46,8 @@ public:
     vectorized::OlapScanConjunctsManager& conjuncts_manager() { return _conjuncts_manager; }
     const std::vector<ExprContext*>& not_push_down_conjuncts() const { return _not_push_down_conjuncts; }
     const std::vector<std::unique_ptr<OlapScanRange>>& key_ranges() const { return _key_ranges; }
+    // Whether the scan is filtered by runtime filters, which may differ between the queries.
+    bool has_runtime_filters() const { return _has_runtime_filters; }
     BalancedChunkBuffer& get_chunk_buffer() { return _chunk_buffer; }
 
     // Shared scan states
@@ -64,6 +66,7 @@ private:
     // The conjuncts couldn't push down to storage engine
     std::vector<ExprContext*> _not_push_down_conjuncts;
     std::vector<std::unique_ptr<OlapScanRange>> _key_ranges;
+    bool _has_runtime_filters = false;
     vectorized::DictOptimizeParser _dict_optimize_parser;
     ObjectPool _obj_pool;
 
@@ -5,8 +5,10 @@
 #include <util/time.h>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exec/pipeline/chunk_accumulate_operator.h"
 #include "exec/pipeline/limit_operator.h"
+#include "exec/pipeline/numa_placement.h"
 #include "exec/pipeline/pipeline_builder.h"
 #include "exec/pipeline/scan/connector_scan_operator.h"
 #include "exec/vectorized/olap_scan_node.h"
@@ -27,6 +29,7 @@ ScanOperator::ScanOperator(OperatorFactory* factory, int32_t id, int32_t driver_
           _scan_node(scan_node),
           _dop(dop),
           _io_tasks_per_scan_operator(scan_node->io_tasks_per_scan_operator()),
+          _max_running_io_tasks(config::enable_adaptive_scan_io_tasks ? 1 : _io_tasks_per_scan_operator),
           _chunk_source_profiles(_io_tasks_per_scan_operator),
           _is_io_task_running(_io_tasks_per_scan_operator),
           _chunk_sources(_io_tasks_per_scan_operator) {
@@ -57,6 +60,7 @@ Status ScanOperator::prepare(RuntimeState* state) {
     _morsels_counter = ADD_COUNTER(_unique_metrics, "MorselsCount", TUnit::UNIT);
     _buffer_unplug_counter = ADD_COUNTER(_unique_metrics, "BufferUnplugCount", TUnit::UNIT);
     _submit_task_counter = ADD_COUNTER(_unique_metrics, "SubmitTaskCount", TUnit::UNIT);
+    _peak_io_tasks_counter = _unique_metrics->AddHighWaterMarkCounter("PeakIOTasks", TUnit::UNIT);
 
     RETURN_IF_ERROR(do_prepare(state));
 
@@ -126,7 +130,7 @@ bool ScanOperator::has_output() const {
     if (is_buffer_full() && num_buffered_chunks() > 0) {
         return true;
     }
-    if (_num_running_io_tasks >= _io_tasks_per_scan_operator || is_buffer_full()) {
+    if (_num_running_io_tasks >= _max_running_io_tasks || is_buffer_full()) {
         return false;
     }
 
@@ -192,6 +196,9 @@ StatusOr<vectorized::ChunkPtr> ScanOperator::pull_chunk(RuntimeState* state) {
     RETURN_IF_ERROR(_try_to_trigger_next_scan(state));
 
     vectorized::ChunkPtr res = get_chunk_from_buffer();
+    if (config::enable_adaptive_scan_io_tasks) {
+        _adapt_max_running_io_tasks(res == nullptr);
+    }
     if (res == nullptr) {
         return nullptr;
     }
@@ -208,8 +215,19 @@ int64_t ScanOperator::global_rf_wait_timeout_ns() const {
     return 1000'000L * global_rf_collector->scan_wait_timeout_ms();
 }
 
+void ScanOperator::_adapt_max_running_io_tasks(bool is_buffer_drained) {
+    if (is_buffer_drained) {
+        if (_max_running_io_tasks < _io_tasks_per_scan_operator && _num_running_io_tasks >= _max_running_io_tasks &&
+            !_morsel_queue->empty()) {
+            ++_max_running_io_tasks;
+        }
+    } else if (_max_running_io_tasks > 1 && is_buffer_full()) {
+        --_max_running_io_tasks;
+    }
+}
+
 Status ScanOperator::_try_to_trigger_next_scan(RuntimeState* state) {
-    if (_num_running_io_tasks >= _io_tasks_per_scan_operator) {
+    if (_num_running_io_tasks >= _max_running_io_tasks) {
         return Status::OK();
     }
     if (_unpluging && num_buffered_chunks() >= _buffer_unplug_threshold()) {
@@ -219,7 +237,7 @@ Status ScanOperator::_try_to_trigger_next_scan(RuntimeState* state) {
     // Avoid uneven distribution when io tasks execute very fast, so we start
     // traverse the chunk_source array from last visit idx
     int cnt = _io_tasks_per_scan_operator;
-    while (--cnt >= 0) {
+    while (--cnt >= 0 && _num_running_io_tasks < _max_running_io_tasks) {
         _chunk_source_idx = (_chunk_source_idx + 1) % _io_tasks_per_scan_operator;
         int i = _chunk_source_idx;
         if (_is_io_task_running[i]) {
@@ -278,6 +296,8 @@ void ScanOperator::_finish_chunk_source_task(RuntimeState* state, int chunk_sour
         }
 
         _is_io_task_running[chunk_source_index] = false;
+        // Notify under the lock, since the operator may be closed once no I/O task is running.
+        notify_ready();
     }
 }
 
@@ -290,6 +310,7 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
     COUNTER_UPDATE(_submit_task_counter, 1);
     _chunk_sources[chunk_source_index]->pin_chunk_token(std::move(buffer_token));
     _num_running_io_tasks++;
+    _peak_io_tasks_counter->set(_num_running_io_tasks);
     _is_io_task_running[chunk_source_index] = true;
 
     // to avoid holding mutex in bthread, we choose to initialize lazily here instead of in prepare
@@ -304,6 +325,7 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
     task.workgroup = _workgroup.get();
     // TODO: consider more factors, such as scan bytes and i/o time.
     task.priority = vectorized::OlapScanNode::compute_priority(_submit_task_counter->value());
+    task.numa_node = numa_node_of_fragment_instance(state->fragment_instance_id());
     const auto io_task_start_nano = MonotonicNanos();
     task.work_function = [wp = _query_ctx, this, state, chunk_source_index, query_trace_ctx, driver_id,
                           io_task_start_nano]() {
@@ -315,7 +337,16 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
 
             SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(state->instance_mem_tracker());
 
-            [[maybe_unused]] std::string category = "chunk_source_" + std::to_string(chunk_source_index);
+            std::string category;
+            if (query_trace_ctx.event_buffer != nullptr) {
+                category = "chunk_source_" + std::to_string(chunk_source_index);
+                // The time the task waits in the queue of the scan executor.
+                query_trace_ctx.event_buffer->add(starrocks::debug::QueryTraceEvent::create(
+                        "io_task_pending", category, query_trace_ctx.id, 'b',
+                        io_task_start_nano / 1000 - query_trace_ctx.start_ts, -1,
+                        query_trace_ctx.fragment_instance_id, query_trace_ctx.driver, {}));
+                QUERY_TRACE_ASYNC_FINISH("io_task_pending", category, query_trace_ctx);
+            }
             QUERY_TRACE_ASYNC_START("io_task", category, query_trace_ctx);
 
             auto& chunk_source = _chunk_sources[chunk_source_index];
@@ -337,9 +368,12 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
             }
 
             int64_t delta_cpu_time = chunk_source->get_cpu_time_spent() - prev_cpu_time;
+            int64_t delta_scan_bytes = chunk_source->get_scan_bytes() - prev_scan_bytes;
+            if (_workgroup != nullptr) {
+                _workgroup->incr_scan_bytes(delta_scan_bytes);
+            }
             _finish_chunk_source_task(state, chunk_source_index, delta_cpu_time,
-                                      chunk_source->get_scan_rows() - prev_scan_rows,
-                                      chunk_source->get_scan_bytes() - prev_scan_bytes);
+                                      chunk_source->get_scan_rows() - prev_scan_rows, delta_scan_bytes);
 
             QUERY_TRACE_ASYNC_FINISH("io_task", category, query_trace_ctx);
         }
@@ -34,6 +34,9 @@ public:
 
     bool has_output() const override;
 
+    // Notified when an I/O task finishes.
+    bool supports_ready_notification() const override { return true; }
+
     bool pending_finish() const override;
 
     bool is_finished() const override;
@@ -93,6 +96,10 @@ private:
         }
     }
 
+    // Run one more io task if the chunk buffer is drained while all the io tasks are running and there are
+    // morsels left, or one fewer if the chunk buffer is full.
+    void _adapt_max_running_io_tasks(bool is_buffer_drained);
+
     inline Status _get_scan_status() const {
         std::lock_guard<SpinLock> l(_scan_status_mutex);
         return _scan_status;
@@ -115,6 +122,9 @@ private:
     int32_t _io_task_retry_cnt = 0;
     workgroup::ScanExecutor* _scan_executor = nullptr;
     std::atomic<int> _num_running_io_tasks = 0;
+    // The max number of running io tasks, adapted to the consumption of the chunk buffer if
+    // config::enable_adaptive_scan_io_tasks, otherwise _io_tasks_per_scan_operator.
+    int _max_running_io_tasks;
 
     mutable std::shared_mutex _task_mutex; // Protects the chunk-source from concurrent close and read
     std::vector<std::atomic<bool>> _is_io_task_running;
@@ -141,6 +151,7 @@ private:
     RuntimeProfile::Counter* _morsels_counter = nullptr;
     RuntimeProfile::Counter* _buffer_unplug_counter = nullptr;
     RuntimeProfile::Counter* _submit_task_counter = nullptr;
+    RuntimeProfile::HighWaterMarkCounter* _peak_io_tasks_counter = nullptr;
 };
 
 class ScanOperatorFactory : public SourceOperatorFactory {
@@ -0,0 +1,45 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/pipeline/scan/scan_result_cache.h"
+
+#include <cstring>
+
+#include "common/config.h"
+#include "runtime/current_thread.h"
+
+namespace starrocks::pipeline {
+
+ScanResultCache::ScanResultCache(size_t capacity) : _cache(new_lru_cache(capacity)) {}
+
+ScanResultCache* ScanResultCache::instance() {
+    static ScanResultCache s_instance(config::scan_result_cache_capacity);
+    return &s_instance;
+}
+
+std::string ScanResultCache::_cache_key(const std::string& digest, int64_t tablet_id) {
+    std::string key(digest);
+    key.append(reinterpret_cast<const char*>(&tablet_id), sizeof(tablet_id));
+    return key;
+}
+
+ScanResultCacheEntryPtr ScanResultCache::lookup(const std::string& digest, int64_t tablet_id) {
+    Cache::Handle* handle = _cache->lookup(_cache_key(digest, tablet_id));
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    ScanResultCacheEntryPtr entry = *reinterpret_cast<ScanResultCacheEntryPtr*>(_cache->value(handle));
+    _cache->release(handle);
+    return entry;
+}
+
+void ScanResultCache::insert(const std::string& digest, int64_t tablet_id, ScanResultCacheEntryPtr entry) {
+    auto deleter = [](const CacheKey& key, void* value) { delete reinterpret_cast<ScanResultCacheEntryPtr*>(value); };
+    size_t charge = entry->bytes;
+    auto* value = new ScanResultCacheEntryPtr(std::move(entry));
+    // The entries outlive the queries, so neither the insertion nor the evictions are charged to the query.
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(nullptr);
+    Cache::Handle* handle = _cache->insert(_cache_key(digest, tablet_id), value, charge, deleter);
+    _cache->release(handle);
+}
+
+} // namespace starrocks::pipeline
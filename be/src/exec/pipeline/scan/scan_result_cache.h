@@ -0,0 +1,51 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "util/lru_cache.h"
+
+namespace starrocks::pipeline {
+
+// The chunks read from a tablet at a version by the olap chunk sources of a scan node.
+struct ScanResultCacheEntry {
+    int64_t version = 0;
+    std::vector<vectorized::ChunkPtr> chunks;
+    size_t bytes = 0;
+};
+using ScanResultCacheEntryPtr = std::shared_ptr<const ScanResultCacheEntry>;
+
+// A BE-wide LRU cache of the chunks read from the tablets, keyed by the digest of the scan node computed by FE,
+// i.e. the table, the output columns and the predicates, and the tablet id.
+//
+// An entry holds the chunks read at some version of the tablet, which serve the scans of the same version
+// without touching the storage, and the scans of a later version of a duplicate key tablet, which read only
+// the rowsets after it. The chunks in the cache are never modified, a reader should copy them before use.
+class ScanResultCache {
+public:
+    explicit ScanResultCache(size_t capacity);
+    ~ScanResultCache() = default;
+
+    // Created with the capacity scan_result_cache_capacity on the first call.
+    static ScanResultCache* instance();
+
+    // Return nullptr, if the scan node |digest| has no entry for |tablet_id|.
+    ScanResultCacheEntryPtr lookup(const std::string& digest, int64_t tablet_id);
+
+    // Replace the entry of the scan node |digest| for |tablet_id| with |entry|.
+    void insert(const std::string& digest, int64_t tablet_id, ScanResultCacheEntryPtr entry);
+
+    size_t capacity() { return _cache->get_capacity(); }
+    size_t memory_usage() { return _cache->get_memory_usage(); }
+
+private:
+    static std::string _cache_key(const std::string& digest, int64_t tablet_id);
+
+    std::unique_ptr<Cache> _cache;
+};
+
+} // namespace starrocks::pipeline
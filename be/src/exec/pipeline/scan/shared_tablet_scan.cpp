@@ -0,0 +1,262 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/pipeline/scan/shared_tablet_scan.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+
+#include "column/chunk.h"
+#include "common/config.h"
+#include "runtime/current_thread.h"
+#include "storage/chunk_helper.h"
+#include "storage/rowset/rowid_range_option.h"
+#include "storage/rowset/rowset.h"
+#include "storage/rowset/segment.h"
+#include "storage/tablet.h"
+#include "storage/tablet_reader.h"
+#include "util/defer_op.h"
+
+namespace starrocks::pipeline {
+
+static void add_reader_statistics(const OlapReaderStatistics& src, OlapReaderStatistics* dst) {
+    dst->create_segment_iter_ns += src.create_segment_iter_ns;
+    dst->io_ns += src.io_ns;
+    dst->compressed_bytes_read += src.compressed_bytes_read;
+    dst->decompress_ns += src.decompress_ns;
+    dst->uncompressed_bytes_read += src.uncompressed_bytes_read;
+    dst->bytes_read += src.bytes_read;
+    dst->block_load_ns += src.block_load_ns;
+    dst->blocks_load += src.blocks_load;
+    dst->block_fetch_ns += src.block_fetch_ns;
+    dst->block_seek_num += src.block_seek_num;
+    dst->block_seek_ns += src.block_seek_ns;
+    dst->block_convert_ns += src.block_convert_ns;
+    dst->decode_dict_ns += src.decode_dict_ns;
+    dst->late_materialize_ns += src.late_materialize_ns;
+    dst->raw_rows_read += src.raw_rows_read;
+    dst->rows_vec_cond_filtered += src.rows_vec_cond_filtered;
+    dst->vec_cond_ns += src.vec_cond_ns;
+    dst->vec_cond_evaluate_ns += src.vec_cond_evaluate_ns;
+    dst->vec_cond_chunk_copy_ns += src.vec_cond_chunk_copy_ns;
+    dst->branchless_cond_evaluate_ns += src.branchless_cond_evaluate_ns;
+    dst->expr_cond_evaluate_ns += src.expr_cond_evaluate_ns;
+    dst->segment_init_ns += src.segment_init_ns;
+    dst->segment_create_chunk_ns += src.segment_create_chunk_ns;
+    dst->segment_stats_filtered += src.segment_stats_filtered;
+    dst->rows_key_range_filtered += src.rows_key_range_filtered;
+    dst->rows_stats_filtered += src.rows_stats_filtered;
+    dst->rows_bf_filtered += src.rows_bf_filtered;
+    dst->rows_del_filtered += src.rows_del_filtered;
+    dst->del_filter_ns += src.del_filter_ns;
+    dst->index_load_ns += src.index_load_ns;
+    dst->total_pages_num += src.total_pages_num;
+    dst->cached_pages_num += src.cached_pages_num;
+    dst->rows_bitmap_index_filtered += src.rows_bitmap_index_filtered;
+    dst->bitmap_index_filter_timer += src.bitmap_index_filter_timer;
+    dst->rows_del_vec_filtered += src.rows_del_vec_filtered;
+    dst->rowsets_read_count += src.rowsets_read_count;
+    dst->segments_read_count += src.segments_read_count;
+    dst->total_columns_data_page_count += src.total_columns_data_page_count;
+}
+
+// ========== SharedTabletScan ==========
+
+SharedTabletScan::SharedTabletScan(TabletSharedPtr tablet, int64_t version, bool skip_aggregation,
+                                   vectorized::Schema schema, int chunk_size)
+        : _tablet(std::move(tablet)),
+          _version(version),
+          _skip_aggregation(skip_aggregation),
+          _schema(std::move(schema)),
+          _chunk_size(chunk_size) {}
+
+Status SharedTabletScan::init() {
+    {
+        std::shared_lock l(_tablet->get_header_lock());
+        RETURN_IF_ERROR(_tablet->capture_consistent_rowsets(Version(0, _version), &_rowsets));
+    }
+    const auto unit_rows = static_cast<rowid_t>(std::max<int64_t>(1, config::shared_tablet_scan_unit_rows));
+    for (const auto& rowset : _rowsets) {
+        RETURN_IF_ERROR(rowset->load());
+        for (const auto& segment : rowset->segments()) {
+            for (rowid_t begin = 0; begin < segment->num_rows(); begin += unit_rows) {
+                rowid_t end = std::min<rowid_t>(begin + unit_rows, segment->num_rows());
+                _unit_ranges.push_back({rowset->rowset_id(), segment->id(), vectorized::Range(begin, end)});
+            }
+        }
+    }
+    return Status::OK();
+}
+
+size_t SharedTabletScan::latest_unit() const {
+    std::lock_guard lock(_mutex);
+    return _latest_unit;
+}
+
+StatusOr<SharedScanUnitPtr> SharedTabletScan::get_unit(size_t unit_idx, RuntimeState* state,
+                                                       OlapReaderStatistics* stats) {
+    DCHECK_LT(unit_idx, _unit_ranges.size());
+    // The units are shared by the queries, so they are not charged to any of them.
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(nullptr);
+    SharedScanUnitPtr unit;
+    {
+        std::lock_guard lock(_mutex);
+        auto it = std::find_if(_kept_units.begin(), _kept_units.end(),
+                               [unit_idx](const auto& kept_unit) { return kept_unit.first == unit_idx; });
+        if (it != _kept_units.end()) {
+            unit = it->second;
+        } else {
+            unit = std::make_shared<SharedScanUnit>();
+            _kept_units.emplace_front(unit_idx, unit);
+            _latest_unit = unit_idx;
+            auto max_kept_units = static_cast<size_t>(std::max<int64_t>(1, config::shared_tablet_scan_kept_units));
+            while (_kept_units.size() > max_kept_units) {
+                _kept_units.pop_back();
+            }
+        }
+    }
+
+    // The chunk sources which need a unit being read wait for it, rather than read it again.
+    std::call_once(unit->read_once, [&]() { unit->status = _read_unit(unit_idx, state, unit.get(), stats); });
+    if (!unit->status.ok()) {
+        std::lock_guard lock(_mutex);
+        _kept_units.remove_if([&unit](const auto& kept_unit) { return kept_unit.second == unit; });
+        return unit->status;
+    }
+    return unit;
+}
+
+Status SharedTabletScan::_read_unit(size_t unit_idx, RuntimeState* state, SharedScanUnit* unit,
+                                    OlapReaderStatistics* stats) {
+    const UnitRange& unit_range = _unit_ranges[unit_idx];
+    vectorized::TabletReaderParams params;
+    params.reader_type = READER_QUERY;
+    params.is_pipeline = true;
+    params.skip_aggregation = _skip_aggregation;
+    params.runtime_state = state;
+    params.use_page_cache = !config::disable_storage_page_cache;
+    params.chunk_size = _chunk_size;
+    params.rowid_range_option = std::make_shared<vectorized::RowidRangeOption>(
+            unit_range.rowset_id, unit_range.segment_id, vectorized::SparseRange(unit_range.rows));
+
+    vectorized::TabletReader reader(_tablet, Version(0, _version), _schema);
+    DeferOp defer([&]() {
+        add_reader_statistics(reader.stats(), stats);
+        reader.close();
+    });
+    RETURN_IF_ERROR(reader.prepare());
+    RETURN_IF_ERROR(reader.open(params));
+    while (true) {
+        auto chunk = ChunkHelper::new_chunk(_schema, _chunk_size);
+        Status status = reader.get_next(chunk.get());
+        if (status.is_end_of_file()) {
+            break;
+        }
+        RETURN_IF_ERROR(status);
+        unit->chunks.emplace_back(std::move(chunk));
+    }
+    return Status::OK();
+}
+
+// ========== SharedTabletScanManager ==========
+
+SharedTabletScanManager* SharedTabletScanManager::instance() {
+    static SharedTabletScanManager s_instance;
+    return &s_instance;
+}
+
+StatusOr<SharedTabletScanPtr> SharedTabletScanManager::get_or_create(const TabletSharedPtr& tablet, int64_t version,
+                                                                     bool skip_aggregation,
+                                                                     const std::vector<uint32_t>& reader_columns,
+                                                                     int chunk_size) {
+    std::string key = fmt::format("{}:{}:{}:{}", tablet->tablet_id(), version, skip_aggregation,
+                                  fmt::join(reader_columns, ","));
+    std::lock_guard lock(_mutex);
+    auto& weak_scan = _scans[key];
+    if (auto scan = weak_scan.lock(); scan != nullptr) {
+        return scan;
+    }
+    // Drop the scans no chunk source uses anymore.
+    for (auto it = _scans.begin(); it != _scans.end();) {
+        if (it->second.expired() && it->first != key) {
+            it = _scans.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    auto schema = ChunkHelper::convert_schema_to_format_v2(tablet->tablet_schema(), reader_columns);
+    auto scan = std::make_shared<SharedTabletScan>(tablet, version, skip_aggregation, std::move(schema), chunk_size);
+    RETURN_IF_ERROR(scan->init());
+    _scans[key] = scan;
+    return scan;
+}
+
+// ========== SharedTabletScanIterator ==========
+
+SharedTabletScanIterator::SharedTabletScanIterator(SharedTabletScanPtr scan, RuntimeState* state,
+                                                   const std::vector<const vectorized::ColumnPredicate*>& predicates)
+        : ChunkIterator(scan->schema()), _scan(std::move(scan)), _state(state), _start_unit(_scan->latest_unit()) {
+    for (const auto* predicate : predicates) {
+        // Such a predicate only tells which rows the indexes may skip, not which rows pass.
+        if (!predicate->is_index_filter_only()) {
+            _predicates.add(predicate);
+        }
+    }
+}
+
+SharedTabletScanIterator::~SharedTabletScanIterator() {
+    close();
+}
+
+void SharedTabletScanIterator::close() {
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(nullptr);
+    _unit.reset();
+    _scan.reset();
+}
+
+Status SharedTabletScanIterator::do_get_next(vectorized::Chunk* chunk) {
+    DCHECK(_scan != nullptr);
+    const size_t num_units = _scan->num_units();
+    while (true) {
+        if (_unit == nullptr || _next_chunk >= _unit->chunks.size()) {
+            if (_num_visited_units >= num_units) {
+                return Status::EndOfFile("end of the shared tablet scan");
+            }
+            size_t unit_idx = (_start_unit + _num_visited_units++) % num_units;
+            {
+                SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(nullptr);
+                _unit.reset();
+            }
+            ASSIGN_OR_RETURN(_unit, _scan->get_unit(unit_idx, _state, &_stats));
+            _next_chunk = 0;
+            continue;
+        }
+
+        const vectorized::Chunk* src = _unit->chunks[_next_chunk++].get();
+        size_t num_rows = src->num_rows();
+        _selection.assign(num_rows, 1);
+        if (!_predicates.empty()) {
+            RETURN_IF_ERROR(_predicates.evaluate(src, _selection.data()));
+        }
+        vectorized::Buffer<uint32_t> indexes;
+        indexes.reserve(num_rows);
+        for (uint32_t i = 0; i < num_rows; ++i) {
+            if (_selection[i]) {
+                indexes.push_back(i);
+            }
+        }
+        if (indexes.empty()) {
+            continue;
+        }
+
+        // The units are never modified, the rows passing the predicates are copied to |chunk|.
+        const auto& fields = output_schema().fields();
+        for (size_t i = 0; i < fields.size(); ++i) {
+            chunk->get_column_by_index(i)->append_selective(*src->get_column_by_id(fields[i]->id()), indexes);
+        }
+        return Status::OK();
+    }
+}
+
+} // namespace starrocks::pipeline
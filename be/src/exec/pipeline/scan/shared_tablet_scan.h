@@ -0,0 +1,133 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+#include "storage/chunk_iterator.h"
+#include "storage/conjunctive_predicates.h"
+#include "storage/olap_common.h"
+#include "storage/range.h"
+
+namespace starrocks {
+
+class RuntimeState;
+class Tablet;
+using TabletSharedPtr = std::shared_ptr<Tablet>;
+class Rowset;
+using RowsetSharedPtr = std::shared_ptr<Rowset>;
+
+namespace pipeline {
+
+// The chunks read from a range of the rows of a segment, by the first chunk source which needs them.
+struct SharedScanUnit {
+    std::once_flag read_once;
+    Status status;
+    std::vector<vectorized::ChunkPtr> chunks;
+};
+using SharedScanUnitPtr = std::shared_ptr<SharedScanUnit>;
+
+// A scan of the columns |schema| of a tablet at a version, shared by the concurrent chunk sources of the
+// queries reading them, see SharedTabletScanManager.
+//
+// The rows of the tablet are divided into units of at most shared_tablet_scan_unit_rows rows of a segment, read
+// without any predicate. A chunk source reads all the units circularly, from the unit read most recently by the
+// others, and the last few units read are kept for the chunk sources which follow, so the concurrent chunk
+// sources read a unit from storage only once as long as they go at a similar pace, and each of them applies
+// its own predicates to the rows of the units.
+class SharedTabletScan {
+public:
+    SharedTabletScan(TabletSharedPtr tablet, int64_t version, bool skip_aggregation, vectorized::Schema schema,
+                     int chunk_size);
+
+    // Capture the rowsets and divide their segments into units.
+    Status init();
+
+    const vectorized::Schema& schema() const { return _schema; }
+    size_t num_units() const { return _unit_ranges.size(); }
+    // The unit a new chunk source starts from.
+    size_t latest_unit() const;
+
+    // Read the unit |unit_idx| with |state|, unless it is kept, and add the statistics of the read to |stats|.
+    StatusOr<SharedScanUnitPtr> get_unit(size_t unit_idx, RuntimeState* state, OlapReaderStatistics* stats);
+
+private:
+    struct UnitRange {
+        RowsetId rowset_id;
+        uint64_t segment_id;
+        vectorized::Range rows;
+    };
+
+    Status _read_unit(size_t unit_idx, RuntimeState* state, SharedScanUnit* unit, OlapReaderStatistics* stats);
+
+    const TabletSharedPtr _tablet;
+    const int64_t _version;
+    const bool _skip_aggregation;
+    const vectorized::Schema _schema;
+    const int _chunk_size;
+
+    // Keep the rowsets of the units from being garbage collected.
+    std::vector<RowsetSharedPtr> _rowsets;
+    std::vector<UnitRange> _unit_ranges;
+
+    mutable std::mutex _mutex;
+    // The units kept, the most recent first.
+    std::list<std::pair<size_t, SharedScanUnitPtr>> _kept_units;
+    size_t _latest_unit = 0;
+};
+using SharedTabletScanPtr = std::shared_ptr<SharedTabletScan>;
+
+// The shared scans of the tablets being read, each of which lives as long as a chunk source uses it.
+class SharedTabletScanManager {
+public:
+    static SharedTabletScanManager* instance();
+
+    // Return the scan of |reader_columns| of |tablet| at |version| shared with the other chunk sources,
+    // created if there is none.
+    StatusOr<SharedTabletScanPtr> get_or_create(const TabletSharedPtr& tablet, int64_t version, bool skip_aggregation,
+                                                const std::vector<uint32_t>& reader_columns, int chunk_size);
+
+private:
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::weak_ptr<SharedTabletScan>> _scans;
+};
+
+// The iterator of a chunk source over a shared scan, which returns the rows of all the units passing
+// |predicates|, from the latest unit of the scan.
+class SharedTabletScanIterator final : public vectorized::ChunkIterator {
+public:
+    SharedTabletScanIterator(SharedTabletScanPtr scan, RuntimeState* state,
+                             const std::vector<const vectorized::ColumnPredicate*>& predicates);
+    ~SharedTabletScanIterator() override;
+
+    void close() override;
+
+    // The statistics of the units read from storage by this iterator.
+    const OlapReaderStatistics& stats() const { return _stats; }
+
+protected:
+    Status do_get_next(vectorized::Chunk* chunk) override;
+
+private:
+    SharedTabletScanPtr _scan;
+    RuntimeState* _state;
+    vectorized::ConjunctivePredicates _predicates;
+    std::vector<uint8_t> _selection;
+
+    const size_t _start_unit;
+    size_t _num_visited_units = 0;
+    SharedScanUnitPtr _unit;
+    size_t _next_chunk = 0;
+
+    OlapReaderStatistics _stats;
+};
+
+} // namespace pipeline
+} // namespace starrocks
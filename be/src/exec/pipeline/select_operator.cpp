@@ -3,6 +3,7 @@
 #include "exec/pipeline/select_operator.h"
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exprs/expr.h"
 #include "runtime/runtime_state.h"
 
@@ -73,13 +74,26 @@ bool SelectOperator::need_input() const {
 }
 
 Status SelectOperator::push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) {
-    RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, chunk.get()));
+    if (_common_exprs->empty() || chunk->is_empty()) {
+        RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, chunk.get()));
+    } else {
+        // The columns of the shared subexpressions are filtered together with the chunk by the conjuncts.
+        RETURN_IF_ERROR(_common_exprs->evaluate(chunk.get()));
+        Status st = eval_conjuncts_and_in_filters(_conjunct_ctxs, chunk.get());
+        _common_exprs->remove_columns(chunk.get());
+        RETURN_IF_ERROR(st);
+    }
     _curr_chunk = chunk;
     return Status::OK();
 }
 
 Status SelectOperatorFactory::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(OperatorFactory::prepare(state));
+    if (config::enable_common_expr_elimination) {
+        RETURN_IF_ERROR(_common_exprs.rewrite(state->obj_pool(), _conjunct_ctxs, state->desc_tbl().max_slot_id() + 1));
+    }
+    RETURN_IF_ERROR(_common_exprs.prepare(state));
+    RETURN_IF_ERROR(_common_exprs.open(state));
     RETURN_IF_ERROR(Expr::prepare(_conjunct_ctxs, state));
     RETURN_IF_ERROR(Expr::open(_conjunct_ctxs, state));
     return Status::OK();
@@ -87,6 +101,7 @@ Status SelectOperatorFactory::prepare(RuntimeState* state) {
 
 void SelectOperatorFactory::close(RuntimeState* state) {
     Expr::close(_conjunct_ctxs, state);
+    _common_exprs.close(state);
     OperatorFactory::close(state);
 }
 
@@ -4,6 +4,7 @@
 
 #include "column/vectorized_fwd.h"
 #include "exec/pipeline/operator.h"
+#include "exprs/vectorized/common_expr_eliminator.h"
 #include "runtime/descriptors.h"
 
 namespace starrocks {
@@ -13,8 +14,10 @@ namespace pipeline {
 class SelectOperator final : public Operator {
 public:
     SelectOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
-                   const std::vector<ExprContext*>& conjunct_ctxs)
-            : Operator(factory, id, "select", plan_node_id, driver_sequence), _conjunct_ctxs(conjunct_ctxs) {}
+                   const std::vector<ExprContext*>& conjunct_ctxs, vectorized::CommonExprEliminator* common_exprs)
+            : Operator(factory, id, "select", plan_node_id, driver_sequence),
+              _conjunct_ctxs(conjunct_ctxs),
+              _common_exprs(common_exprs) {}
 
     ~SelectOperator() override = default;
     Status prepare(RuntimeState* state) override;
@@ -39,6 +42,8 @@ private:
     vectorized::ChunkPtr _pre_output_chunk = nullptr;
 
     const std::vector<ExprContext*>& _conjunct_ctxs;
+    // The subexpressions shared by |_conjunct_ctxs|, owned by the factory.
+    vectorized::CommonExprEliminator* _common_exprs;
 
     bool _is_finished = false;
 };
@@ -51,7 +56,8 @@ public:
     ~SelectOperatorFactory() override = default;
 
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
-        return std::make_shared<SelectOperator>(this, _id, _plan_node_id, driver_sequence, _conjunct_ctxs);
+        return std::make_shared<SelectOperator>(this, _id, _plan_node_id, driver_sequence, _conjunct_ctxs,
+                                                &_common_exprs);
     }
 
     Status prepare(RuntimeState* state) override;
@@ -59,6 +65,7 @@ public:
 
 private:
     std::vector<ExprContext*> _conjunct_ctxs;
+    vectorized::CommonExprEliminator _common_exprs;
 };
 
 } // namespace pipeline
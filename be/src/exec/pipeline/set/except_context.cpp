@@ -44,7 +44,7 @@ StatusOr<vectorized::ChunkPtr> ExceptContext::pull_chunk(RuntimeState* state) {
     _remained_keys.resize(state->chunk_size());
     while (_next_processed_iter != _hash_set->end() && num_remained_keys < state->chunk_size()) {
         if (!_next_processed_iter->deleted) {
-            _remained_keys[num_remained_keys++] = _next_processed_iter->slice;
+            _remained_keys[num_remained_keys++] = _next_processed_iter->key.slice();
         }
         ++_next_processed_iter;
     }
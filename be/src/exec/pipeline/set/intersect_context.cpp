@@ -43,7 +43,7 @@ StatusOr<vectorized::ChunkPtr> IntersectContext::pull_chunk(RuntimeState* state)
     _remained_keys.resize(state->chunk_size());
     while (_next_processed_iter != _hash_set->end() && num_remained_keys < state->chunk_size()) {
         if (_next_processed_iter->hit_times == _intersect_times) {
-            _remained_keys[num_remained_keys++] = _next_processed_iter->slice;
+            _remained_keys[num_remained_keys++] = _next_processed_iter->key.slice();
         }
         ++_next_processed_iter;
     }
@@ -19,7 +19,7 @@ void LocalMergeSortSourceOperator::close(RuntimeState* state) {
 }
 
 StatusOr<vectorized::ChunkPtr> LocalMergeSortSourceOperator::pull_chunk(RuntimeState* state) {
-    return _sort_context->pull_chunk();
+    return _sort_context->pull_chunk(_driver_sequence);
 }
 
 Status LocalMergeSortSourceOperator::set_finishing(RuntimeState* state) {
@@ -32,11 +32,11 @@ Status LocalMergeSortSourceOperator::set_finished(RuntimeState* state) {
 }
 
 bool LocalMergeSortSourceOperator::has_output() const {
-    return _sort_context->is_partition_sort_finished() && !_sort_context->is_output_finished();
+    return _sort_context->has_output(_driver_sequence);
 }
 
 bool LocalMergeSortSourceOperator::is_finished() const {
-    return _sort_context->is_partition_sort_finished() && _sort_context->is_output_finished();
+    return _sort_context->is_output_finished(_driver_sequence);
 }
 OperatorPtr LocalMergeSortSourceOperatorFactory::create(int32_t degree_of_parallelism, int32_t driver_sequence) {
     auto sort_context = _sort_context_factory->create(driver_sequence);
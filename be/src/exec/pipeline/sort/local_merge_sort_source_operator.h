@@ -15,6 +15,8 @@ class SortContext;
  * LocalMergeSortSourceOperator is used to merge multiple sorted datas from partion sort sink operator.
  * It is one instance and Execute in single threaded mode,  
  * It completely depends on SortContext with a heap to Dynamically filter out the smallest or largest data.
+ * For a full sort, there could be several instances, each merging a key range, and the first one outputs
+ * the merged ranges in order.
  */
 class LocalMergeSortSourceOperator final : public SourceOperator {
 public:
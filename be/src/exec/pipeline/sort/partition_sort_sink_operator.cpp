@@ -51,9 +51,8 @@ Status PartitionSortSinkOperator::set_finishing(RuntimeState* state) {
 
     // Current partition sort is ended, and
     // the last call will drive LocalMergeSortSourceOperator to work.
-    _sort_context->finish_partition(_chunks_sorter->get_output_rows());
     _is_finished = true;
-    return Status::OK();
+    return _sort_context->finish_partition(_chunks_sorter->get_output_rows());
 }
 
 Status PartitionSortSinkOperatorFactory::prepare(RuntimeState* state) {
@@ -78,10 +77,15 @@ OperatorPtr PartitionSortSinkOperatorFactory::create(int32_t dop, int32_t driver
                     runtime_state(), &(_sort_exec_exprs.lhs_ordering_expr_ctxs()), &_is_asc_order, &_is_null_first,
                     _sort_keys, _offset, _limit, _topn_type, max_buffered_chunks);
         }
+        chunks_sorter->set_topn_runtime_filter(_topn_runtime_filter);
     } else {
-        chunks_sorter = std::make_unique<vectorized::ChunksSorterFullSort>(runtime_state(),
-                                                                           &(_sort_exec_exprs.lhs_ordering_expr_ctxs()),
-                                                                           &_is_asc_order, &_is_null_first, _sort_keys);
+        auto full_sorter = std::make_unique<vectorized::ChunksSorterFullSort>(
+                runtime_state(), &(_sort_exec_exprs.lhs_ordering_expr_ctxs()), &_is_asc_order, &_is_null_first,
+                _sort_keys);
+        if (runtime_state()->enable_spill()) {
+            full_sorter->enable_spill();
+        }
+        chunks_sorter = std::move(full_sorter);
     }
     auto sort_context = _sort_context_factory->create(driver_sequence);
 
@@ -112,6 +112,8 @@ public:
     Status prepare(RuntimeState* state) override;
     void close(RuntimeState* state) override;
 
+    void set_topn_runtime_filter(vectorized::TopnRuntimeFilterPtr filter) { _topn_runtime_filter = std::move(filter); }
+
 private:
     std::shared_ptr<SortContextFactory> _sort_context_factory;
     // _sort_exec_exprs contains the ordering expressions
@@ -131,6 +133,8 @@ private:
     const RowDescriptor& _parent_node_row_desc;
     const RowDescriptor& _parent_node_child_row_desc;
     std::vector<ExprContext*> _analytic_partition_exprs;
+    // Shared by the top-n sorters of all the drivers.
+    vectorized::TopnRuntimeFilterPtr _topn_runtime_filter;
 };
 
 } // namespace pipeline
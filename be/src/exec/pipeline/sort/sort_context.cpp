@@ -12,6 +12,7 @@ namespace starrocks::pipeline {
 
 using vectorized::Permutation;
 using vectorized::Columns;
+using vectorized::SortedRun;
 using vectorized::SortedRuns;
 
 void SortContext::close(RuntimeState* state) {
@@ -22,20 +23,60 @@ void SortContext::add_partition_chunks_sorter(std::shared_ptr<ChunksSorter> chun
     _chunks_sorter_partitions.push_back(chunks_sorter);
 }
 
-void SortContext::finish_partition(uint64_t partition_rows) {
+Status SortContext::finish_partition(uint64_t partition_rows) {
     _total_rows.fetch_add(partition_rows, std::memory_order_relaxed);
+    // The ranges are split before the partition sort is seen finished by the mergers.
+    if (_num_mergers > 1 &&
+        _num_partition_arrived.fetch_add(1, std::memory_order_acq_rel) + 1 == _num_partition_sinkers) {
+        Status st = _split_ranges();
+        if (!st.ok()) {
+            _num_partition_finished.fetch_add(1, std::memory_order_release);
+            return st;
+        }
+    }
     _num_partition_finished.fetch_add(1, std::memory_order_release);
+    return Status::OK();
 }
 
 bool SortContext::is_partition_sort_finished() const {
     return _num_partition_finished.load(std::memory_order_acquire) == _num_partition_sinkers;
 }
 
-bool SortContext::is_output_finished() const {
-    return is_partition_sort_finished() && _merger_inited && _required_rows == 0;
+bool SortContext::has_output(int32_t driver_sequence) const {
+    if (!is_partition_sort_finished() || is_output_finished(driver_sequence)) {
+        return false;
+    }
+    if (_range_merged == nullptr || driver_sequence != 0) {
+        return true;
+    }
+    // The merger 0 merges its own range first, then waits for each range to be merged before outputting it.
+    return !_is_range_merged(0) || _is_range_merged(_output_range);
+}
+
+bool SortContext::is_output_finished(int32_t driver_sequence) const {
+    if (!is_partition_sort_finished()) {
+        return false;
+    }
+    if (_range_merged == nullptr) {
+        return driver_sequence != 0 || (_merger_inited && _required_rows == 0);
+    }
+    if (driver_sequence != 0) {
+        return static_cast<size_t>(driver_sequence) >= _ranges.size() || _is_range_merged(driver_sequence);
+    }
+    return _required_rows == 0;
 }
 
-StatusOr<ChunkPtr> SortContext::pull_chunk() {
+StatusOr<ChunkPtr> SortContext::pull_chunk(int32_t driver_sequence) {
+    if (_range_merged != nullptr) {
+        if (static_cast<size_t>(driver_sequence) < _ranges.size() && !_is_range_merged(driver_sequence)) {
+            RETURN_IF_ERROR(_merge_range(driver_sequence));
+        }
+        if (driver_sequence != 0) {
+            return nullptr;
+        }
+        return _pull_merged_ranges();
+    }
+    DCHECK_EQ(0, driver_sequence);
     _init_merger();
 
     while (_required_rows > 0 && !_merger.is_eos()) {
@@ -66,6 +107,73 @@ StatusOr<ChunkPtr> SortContext::pull_chunk() {
     return nullptr;
 }
 
+Status SortContext::_split_ranges() {
+    for (auto& partition_sorter : _chunks_sorter_partitions) {
+        if (partition_sorter->get_sorted_runs().num_rows() != partition_sorter->get_output_rows()) {
+            // Some rows are spilled, which could only be merged in a streaming way by _merger.
+            return Status::OK();
+        }
+    }
+
+    // Take the chunks out of the sorters, so that each of them is released once merged.
+    std::vector<SortedRuns> runs_batch(_chunks_sorter_partitions.size());
+    for (size_t i = 0; i < _chunks_sorter_partitions.size(); i++) {
+        bool eos = false;
+        while (!eos) {
+            ChunkPtr chunk;
+            RETURN_IF_ERROR(_chunks_sorter_partitions[i]->get_next(&chunk, &eos));
+            if (chunk != nullptr && !chunk->is_empty()) {
+                runs_batch[i].chunks.emplace_back(chunk, &_sort_exprs);
+            }
+        }
+    }
+    vectorized::split_sorted_runs(_sort_desc, runs_batch, _num_mergers, &_ranges);
+    _merged_ranges.resize(_ranges.size());
+    _range_merged = std::make_unique<std::atomic<bool>[]>(_ranges.size());
+    _required_rows = _total_rows;
+    return Status::OK();
+}
+
+Status SortContext::_merge_range(size_t range) {
+    RETURN_IF_ERROR(vectorized::merge_sorted_chunks(_sort_desc, &_sort_exprs, _ranges[range],
+                                                    &_merged_ranges[range], 0));
+    _ranges[range].clear();
+    _range_merged[range].store(true, std::memory_order_release);
+    return Status::OK();
+}
+
+StatusOr<ChunkPtr> SortContext::_pull_merged_ranges() {
+    while (_required_rows > 0 && _output_range < _merged_ranges.size()) {
+        if (!_is_range_merged(_output_range)) {
+            return nullptr;
+        }
+        SortedRuns& runs = _merged_ranges[_output_range];
+        if (runs.num_chunks() == 0) {
+            _output_range++;
+            continue;
+        }
+        SortedRun& run = runs.front();
+        // Skip some rows before return it
+        size_t skipped_rows = std::min<size_t>(_offset, run.num_rows());
+        _offset -= skipped_rows;
+        size_t required_rows = std::min<size_t>(_required_rows, _state->chunk_size());
+        ChunkPtr chunk = run.steal_chunk(required_rows, skipped_rows);
+        if (run.empty()) {
+            runs.pop_front();
+        }
+        if (chunk == nullptr || chunk->is_empty()) {
+            continue;
+        }
+        RETURN_IF_ERROR(chunk->downgrade());
+        _required_rows -= chunk->num_rows();
+        return chunk;
+    }
+    if (_output_range == _merged_ranges.size()) {
+        _required_rows = 0;
+    }
+    return nullptr;
+}
+
 Status SortContext::_init_merger() {
     if (_merger_inited) {
         return Status::OK();
@@ -112,7 +220,8 @@ Status SortContext::_init_merger() {
 SortContextFactory::SortContextFactory(RuntimeState* state, const TTopNType::type topn_type, bool is_merging,
                                        int64_t offset, int64_t limit, int32_t num_right_sinkers,
                                        const std::vector<ExprContext*>& sort_exprs,
-                                       const std::vector<bool>& is_asc_order, const std::vector<bool>& is_null_first)
+                                       const std::vector<bool>& is_asc_order, const std::vector<bool>& is_null_first,
+                                       int32_t num_mergers)
         : _state(state),
           _topn_type(topn_type),
           _is_merging(is_merging),
@@ -121,7 +230,8 @@ SortContextFactory::SortContextFactory(RuntimeState* state, const TTopNType::typ
           _limit(limit),
           _num_right_sinkers(num_right_sinkers),
           _sort_exprs(sort_exprs),
-          _sort_descs(is_asc_order, is_null_first) {}
+          _sort_descs(is_asc_order, is_null_first),
+          _num_mergers(num_mergers) {}
 
 SortContextPtr SortContextFactory::create(int32_t idx) {
     size_t actual_idx = _is_merging ? 0 : idx;
@@ -130,7 +240,7 @@ SortContextPtr SortContextFactory::create(int32_t idx) {
     DCHECK_LE(actual_idx, _sort_contexts.size());
     if (!_sort_contexts[actual_idx]) {
         _sort_contexts[actual_idx] = std::make_shared<SortContext>(_state, _topn_type, _offset, _limit, num_sinkers,
-                                                                   _sort_exprs, _sort_descs);
+                                                                   _sort_exprs, _sort_descs, _num_mergers);
     }
     return _sort_contexts[actual_idx];
 }
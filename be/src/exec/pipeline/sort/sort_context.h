@@ -26,28 +26,39 @@ class SortContext final : public ContextWithDependency {
 public:
     explicit SortContext(RuntimeState* state, const TTopNType::type topn_type, int64_t offset, int64_t limit,
                          const int32_t num_right_sinkers, const std::vector<ExprContext*> sort_exprs,
-                         const SortDescs& sort_descs)
+                         const SortDescs& sort_descs, int32_t num_mergers = 1)
             : _state(state),
               _topn_type(topn_type),
               _offset(offset),
               _limit(limit),
               _num_partition_sinkers(num_right_sinkers),
               _sort_exprs(sort_exprs),
-              _sort_desc(sort_descs) {
+              _sort_desc(sort_descs),
+              _num_mergers(num_mergers) {
         _chunks_sorter_partitions.reserve(num_right_sinkers);
     }
 
     void close(RuntimeState* state) override;
 
     void add_partition_chunks_sorter(std::shared_ptr<ChunksSorter> chunks_sorter);
-    void finish_partition(uint64_t partition_rows);
+    Status finish_partition(uint64_t partition_rows);
     bool is_partition_sort_finished() const;
-    bool is_output_finished() const;
 
-    StatusOr<ChunkPtr> pull_chunk();
+    // With more than one merger, i.e. LocalMergeSortSourceOperator, the merger |driver_sequence| merges the
+    // |driver_sequence|-th key range and the merger 0 outputs the merged ranges in order, see _split_ranges().
+    // Otherwise, or if the ranges are not split, the merger 0 merges and outputs all the rows by _merger.
+    bool has_output(int32_t driver_sequence) const;
+    bool is_output_finished(int32_t driver_sequence) const;
+    StatusOr<ChunkPtr> pull_chunk(int32_t driver_sequence);
 
 private:
     Status _init_merger();
+    // Called by the last finished sinker. Split the sorted runs into a key range for each merger, only if all the
+    // rows are in memory, i.e. none of them is spilled.
+    Status _split_ranges();
+    bool _is_range_merged(size_t range) const { return _range_merged[range].load(std::memory_order_acquire); }
+    Status _merge_range(size_t range);
+    StatusOr<ChunkPtr> _pull_merged_ranges();
 
     RuntimeState* _state;
     const TTopNType::type _topn_type;
@@ -66,13 +77,23 @@ private:
     vectorized::ChunkSlice _current_chunk;
     int64_t _required_rows = 0;
     bool _merger_inited = false;
+
+    const int32_t _num_mergers;
+    std::atomic<int32_t> _num_partition_arrived = 0;
+    // The sorted runs of the sinkers split by key ranges, and the merged ranges, empty if not split.
+    std::vector<std::vector<vectorized::SortedRuns>> _ranges;
+    std::vector<vectorized::SortedRuns> _merged_ranges;
+    std::unique_ptr<std::atomic<bool>[]> _range_merged;
+    // The range being output by the merger 0.
+    size_t _output_range = 0;
 };
 
 class SortContextFactory {
 public:
     SortContextFactory(RuntimeState* state, const TTopNType::type topn_type, bool is_merging, int64_t offset,
                        int64_t limit, int32_t num_right_sinkers, const std::vector<ExprContext*>& sort_exprs,
-                       const std::vector<bool>& _is_asc_order, const std::vector<bool>& is_null_first);
+                       const std::vector<bool>& _is_asc_order, const std::vector<bool>& is_null_first,
+                       int32_t num_mergers = 1);
 
     SortContextPtr create(int32_t idx);
 
@@ -90,6 +111,8 @@ private:
     const int32_t _num_right_sinkers;
     const std::vector<ExprContext*> _sort_exprs;
     const SortDescs _sort_descs;
+    // The number of LocalMergeSortSourceOperators sharing a SortContext, only more than 1 if _is_merging.
+    const int32_t _num_mergers;
 };
 
 } // namespace starrocks::pipeline
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <functional>
+#include <mutex>
 #include <utility>
 
 #include "exec/pipeline/operator.h"
@@ -69,10 +71,33 @@ public:
 
     size_t degree_of_parallelism() const { return _source_factory()->degree_of_parallelism(); }
 
+    // Returning true means that this operator calls notify_ready() whenever has_output() or is_finished()
+    // may become true, e.g. a chunk arrives or the input ends. A driver blocked on such an operator is
+    // checked by PipelineDriverPoller only after being notified, instead of in every polling round.
+    virtual bool supports_ready_notification() const { return false; }
+
+    // The observer is set by the executor before the driver is blocked for the first time.
+    void set_ready_observer(std::function<void()> observer) {
+        std::lock_guard<std::mutex> l(_ready_observer_lock);
+        _ready_observer = std::move(observer);
+    }
+
+    // Can be called from any thread.
+    void notify_ready() {
+        std::lock_guard<std::mutex> l(_ready_observer_lock);
+        if (_ready_observer) {
+            _ready_observer();
+        }
+    }
+
 protected:
     const SourceOperatorFactory* _source_factory() const { return down_cast<const SourceOperatorFactory*>(_factory); }
 
     MorselQueue* _morsel_queue = nullptr;
+
+private:
+    std::mutex _ready_observer_lock;
+    std::function<void()> _ready_observer;
 };
 
 } // namespace pipeline
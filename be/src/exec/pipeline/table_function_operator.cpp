@@ -98,11 +98,13 @@ StatusOr<vectorized::ChunkPtr> TableFunctionOperator::pull_chunk(RuntimeState* s
         output_columns.emplace_back(_table_function_result.first[i]->clone_empty());
     }
 
+    //The rows of the table function result of an output chunk are contiguous, from the first one
+    uint32_t fn_result_start_offset = 0;
+    _outer_row_indexes.clear();
+
     //If _remain_repeat_times > 0, first use the remaining data of the previous chunk to construct this data
     while (_remain_repeat_times > 0 || _input_chunk_index < _input_chunk->num_rows()) {
-        bool has_remain_repeat_times = _remain_repeat_times > 0;
-
-        if (!has_remain_repeat_times) {
+        if (_remain_repeat_times == 0) {
             DCHECK_LT(_input_chunk_index + 1, _table_function_result.second->size());
             _remain_repeat_times = _table_function_result.second->get(_input_chunk_index + 1).get_int32() -
                                    _table_function_result.second->get(_input_chunk_index).get_int32();
@@ -113,29 +115,11 @@ StatusOr<vectorized::ChunkPtr> TableFunctionOperator::pull_chunk(RuntimeState* s
             continue;
         }
 
-        //Build outer data, repeat multiple times
-        for (size_t i = 0; i < _outer_slots.size(); ++i) {
-            vectorized::ColumnPtr& input_column_ptr = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
-            vectorized::Datum value = input_column_ptr->get(_input_chunk_index);
-            if (value.is_null()) {
-                DCHECK(output_columns[i]->is_nullable());
-                down_cast<vectorized::NullableColumn*>(output_columns[i].get())->append_nulls(repeat_times);
-            } else {
-                output_columns[i]->append_value_multiple_times(&value, repeat_times);
-            }
-        }
-        //Build table function result
-        for (size_t i = 0; i < _fn_result_slots.size(); ++i) {
-            uint32_t start_offset;
-            if (has_remain_repeat_times) {
-                start_offset =
-                        _table_function_result.second->get(_input_chunk_index + 1).get_int32() - _remain_repeat_times;
-            } else {
-                start_offset = _table_function_result.second->get(_input_chunk_index).get_int32();
-            }
-            output_columns[_outer_slots.size() + i]->append(*(_table_function_result.first[i]), start_offset,
-                                                            repeat_times);
+        if (_outer_row_indexes.empty()) {
+            fn_result_start_offset =
+                    _table_function_result.second->get(_input_chunk_index + 1).get_int32() - _remain_repeat_times;
         }
+        _outer_row_indexes.insert(_outer_row_indexes.end(), repeat_times, _input_chunk_index);
 
         remain_chunk_size -= repeat_times;
         _remain_repeat_times -= repeat_times;
@@ -149,6 +133,24 @@ StatusOr<vectorized::ChunkPtr> TableFunctionOperator::pull_chunk(RuntimeState* s
         }
     }
 
+    //Build outer data by one copy per column, rather than one per input row
+    size_t num_rows = _outer_row_indexes.size();
+    if (num_rows > 0) {
+        for (size_t i = 0; i < _outer_slots.size(); ++i) {
+            const vectorized::ColumnPtr& input_column = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
+            if (_outer_row_indexes.front() == _outer_row_indexes.back()) {
+                output_columns[i]->append_value_multiple_times(*input_column, _outer_row_indexes.front(), num_rows);
+            } else {
+                output_columns[i]->append_selective(*input_column, _outer_row_indexes.data(), 0, num_rows);
+            }
+        }
+        //Build table function result
+        for (size_t i = 0; i < _fn_result_slots.size(); ++i) {
+            output_columns[_outer_slots.size() + i]->append(*(_table_function_result.first[i]), fn_result_start_offset,
+                                                            num_rows);
+        }
+    }
+
     // Current input chunk has been processed, clean the state to be ready for next input chunk
     if (_remain_repeat_times == 0 && _input_chunk_index >= _input_chunk->num_rows()) {
         _input_chunk = nullptr;
@@ -56,6 +56,8 @@ private:
     size_t _input_chunk_index = 0;
     //The current outer line needs to be repeated several times
     size_t _remain_repeat_times = 0;
+    //The input row of each output row, to copy the outer columns once per output chunk
+    std::vector<uint32_t> _outer_row_indexes;
     //table function result
     std::pair<vectorized::Columns, vectorized::ColumnPtr> _table_function_result;
     //table function return result end ?
@@ -115,9 +115,11 @@ StatusOr<pipeline::MorselQueuePtr> ScanNode::convert_scan_range_to_morsel_queue(
         const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
         bool enable_tablet_internal_parallel, size_t num_total_scan_ranges) {
     pipeline::Morsels morsels;
-    // If this scan node does not accept non-empty scan ranges, create a placeholder one.
+    // If this scan node does not accept non-empty scan ranges, create the placeholder ones.
     if (!accept_empty_scan_ranges() && scan_ranges.empty()) {
-        morsels.emplace_back(std::make_unique<pipeline::ScanMorsel>(node_id, TScanRangeParams()));
+        for (const auto& scan_range : placeholder_scan_ranges()) {
+            morsels.emplace_back(std::make_unique<pipeline::ScanMorsel>(node_id, scan_range));
+        }
     } else {
         for (const auto& scan_range : scan_ranges) {
             morsels.emplace_back(std::make_unique<pipeline::ScanMorsel>(node_id, scan_range));
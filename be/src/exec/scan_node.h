@@ -78,6 +78,9 @@ public:
     // If this scan node accept empty scan ranges.
     virtual bool accept_empty_scan_ranges() const { return true; }
 
+    // The scan ranges created for a scan node which does not accept empty scan ranges, when FE sends none.
+    virtual std::vector<TScanRangeParams> placeholder_scan_ranges() const { return {TScanRangeParams()}; }
+
     bool is_scan_node() const override { return true; }
 
     RuntimeProfile::Counter* bytes_read_counter() const { return _bytes_read_counter; }
@@ -0,0 +1,102 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/spill/partitioned_spiller.h"
+
+#include "column/chunk.h"
+#include "column/column.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/runtime_state.h"
+#include "util/hash_util.hpp"
+
+namespace starrocks::spill {
+
+PartitionedSpiller::PartitionedSpiller(RuntimeState* state, std::string label, size_t num_partitions, int level,
+                                       SpillIOCounters* counters)
+        : _state(state),
+          _label(std::move(label)),
+          _num_partitions(num_partitions),
+          _level(level),
+          _counters(counters) {
+    DCHECK_GT(_num_partitions, 0);
+    _buffers.resize(_num_partitions);
+    _files.resize(_num_partitions);
+    _partition_rows.resize(_num_partitions);
+}
+
+Status PartitionedSpiller::spill(const vectorized::Chunk& chunk, const vectorized::Columns& hash_columns,
+                                 const uint8_t* selection) {
+    const uint32_t num_rows = chunk.num_rows();
+    if (num_rows == 0) {
+        return Status::OK();
+    }
+
+    _hash_values.assign(num_rows, 0);
+    for (const auto& column : hash_columns) {
+        DCHECK_EQ(column->size(), num_rows);
+        column->crc32_hash(_hash_values.data(), 0, num_rows);
+    }
+
+    // The crc32 hash is linear in its seed, so seeding it by level would map all the rows of a
+    // partition into the same sub-partition. Instead, every level mixes the hash differently.
+    const uint32_t level_salt = 0x9e3779b9U * static_cast<uint32_t>(_level + 1);
+    for (auto& rows : _partition_rows) {
+        rows.clear();
+    }
+    for (uint32_t i = 0; i < num_rows; i++) {
+        if (selection != nullptr && selection[i] == 0) {
+            continue;
+        }
+        uint32_t partition = HashUtil::fmix32(_hash_values[i] ^ level_salt) % _num_partitions;
+        _partition_rows[partition].push_back(i);
+    }
+
+    const size_t chunk_size = _state->chunk_size();
+    for (size_t p = 0; p < _num_partitions; p++) {
+        const auto& rows = _partition_rows[p];
+        uint32_t offset = 0;
+        while (offset < rows.size()) {
+            if (_buffers[p] == nullptr) {
+                _buffers[p] = chunk.clone_empty_with_tuple(chunk_size);
+            }
+            auto& buffer = _buffers[p];
+            uint32_t count = std::min<uint32_t>(rows.size() - offset, chunk_size - buffer->num_rows());
+            buffer->append_selective(chunk, rows.data(), offset, count);
+            offset += count;
+            if (buffer->num_rows() >= chunk_size) {
+                RETURN_IF_ERROR(_flush_partition(p));
+            }
+        }
+        _spilled_rows += rows.size();
+    }
+    return Status::OK();
+}
+
+Status PartitionedSpiller::_flush_partition(size_t partition) {
+    auto& buffer = _buffers[partition];
+    if (buffer == nullptr || buffer->is_empty()) {
+        return Status::OK();
+    }
+    auto& file = _files[partition];
+    if (file == nullptr) {
+        ASSIGN_OR_RETURN(file, SpillFile::create(_state, strings::Substitute("$0_l$1_p$2", _label, _level, partition),
+                                                 _counters));
+    }
+    int64_t old_size = file->file_size();
+    RETURN_IF_ERROR(file->append(*buffer));
+    _spilled_bytes += file->file_size() - old_size;
+    buffer.reset();
+    return Status::OK();
+}
+
+StatusOr<std::vector<std::unique_ptr<SpillFile>>> PartitionedSpiller::finish() {
+    for (size_t p = 0; p < _num_partitions; p++) {
+        RETURN_IF_ERROR(_flush_partition(p));
+        if (_files[p] != nullptr) {
+            RETURN_IF_ERROR(_files[p]->finish_write());
+        }
+    }
+    _buffers.clear();
+    return std::move(_files);
+}
+
+} // namespace starrocks::spill
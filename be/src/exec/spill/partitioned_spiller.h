@@ -0,0 +1,66 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+#include "exec/spill/spill_file.h"
+
+namespace starrocks {
+class RuntimeState;
+}
+
+namespace starrocks::spill {
+
+// PartitionedSpiller splits the rows of the incoming chunks into `num_partitions` spill files
+// by the hash of the given columns, so that the rows with the same key always land in the same
+// partition and each partition can be processed independently after spilling.
+//
+// `level` is the recursion depth of spilling: a partition that is still too big to be processed
+// in memory is spilled again with `level + 1`, which picks another hash function so that its
+// rows are spread across the new partitions.
+class PartitionedSpiller {
+public:
+    // |counters| is passed to the spill files, see `SpillFile::create()`.
+    PartitionedSpiller(RuntimeState* state, std::string label, size_t num_partitions, int level,
+                       SpillIOCounters* counters = nullptr);
+
+    // Append the rows of |chunk| whose |selection| is non-zero to the partition chosen by the hash
+    // of |hash_columns|. All rows are appended if |selection| is nullptr.
+    // |hash_columns| must have the same number of rows as |chunk|.
+    Status spill(const vectorized::Chunk& chunk, const vectorized::Columns& hash_columns, const uint8_t* selection);
+
+    // Flush the buffered rows and close all the partitions for reading. The i-th returned file holds
+    // the rows of partition i, and it is nullptr if no row is spilled into the partition.
+    StatusOr<std::vector<std::unique_ptr<SpillFile>>> finish();
+
+    int level() const { return _level; }
+    size_t num_partitions() const { return _num_partitions; }
+    int64_t spilled_rows() const { return _spilled_rows; }
+    int64_t spilled_bytes() const { return _spilled_bytes; }
+
+private:
+    Status _flush_partition(size_t partition);
+
+    RuntimeState* _state;
+    const std::string _label;
+    const size_t _num_partitions;
+    const int _level;
+    SpillIOCounters* _counters;
+    int64_t _spilled_rows = 0;
+    int64_t _spilled_bytes = 0;
+
+    // Rows are buffered per partition until a full chunk is accumulated,
+    // which avoids writing tiny chunks when the input is spread across many partitions.
+    std::vector<vectorized::ChunkUniquePtr> _buffers;
+    std::vector<std::unique_ptr<SpillFile>> _files;
+
+    std::vector<uint32_t> _hash_values;
+    std::vector<std::vector<uint32_t>> _partition_rows;
+};
+
+} // namespace starrocks::spill
@@ -0,0 +1,242 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/spill/spill_file.h"
+
+#include "common/config.h"
+#include "exec/spill/spill_manager.h"
+#include "fs/fs.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/runtime_state.h"
+#include "serde/column_array_serde.h"
+#include "util/compression/block_compression.h"
+#include "util/starrocks_metrics.h"
+#include "util/stopwatch.hpp"
+#include "util/threadpool.h"
+#include "util/uid_util.h"
+
+namespace starrocks::spill {
+
+static std::atomic<int64_t> s_spill_file_seq{0};
+
+SpillIOCounters::SpillIOCounters(RuntimeProfile* profile) {
+    write_bytes = ADD_COUNTER(profile, "SpillWriteBytes", TUnit::BYTES);
+    write_timer = ADD_TIMER(profile, "SpillWriteIOTime");
+    read_bytes = ADD_COUNTER(profile, "SpillReadBytes", TUnit::BYTES);
+    read_timer = ADD_TIMER(profile, "SpillReadIOTime");
+    auto* bytes = read_bytes;
+    auto* timer = read_timer;
+    profile->add_derived_counter(
+            "SpillReadRate", TUnit::BYTES_PER_SECOND,
+            [bytes, timer] {
+                int64_t ns = timer->value();
+                return ns == 0 ? 0 : static_cast<int64_t>(bytes->value() * 1000000000.0 / ns);
+            },
+            "");
+}
+
+StatusOr<std::unique_ptr<SpillFile>> SpillFile::create(RuntimeState* state, const std::string& label,
+                                                       SpillIOCounters* counters) {
+    ASSIGN_OR_RETURN(auto placement, SpillManager::instance()->allocate());
+
+    std::string path = strings::Substitute("$0/$1_$2_$3_$4", placement.dir, print_id(state->query_id()),
+                                           print_id(state->fragment_instance_id()), label,
+                                           s_spill_file_seq.fetch_add(1, std::memory_order_relaxed));
+    WritableFileOptions opts;
+    // Spill files are temporary and never read after a crash, so skip the fsync on close.
+    opts.sync_on_close = false;
+    opts.mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE;
+    ASSIGN_OR_RETURN(auto writer, FileSystem::Default()->new_writable_file(opts, path));
+    return std::make_unique<SpillFile>(std::move(path), state->query_id(), std::move(writer),
+                                       std::move(placement.io_token), counters);
+}
+
+SpillFile::SpillFile(std::string path, const TUniqueId& query_id, std::unique_ptr<WritableFile> writer,
+                     std::unique_ptr<ThreadPoolToken> io_token, SpillIOCounters* counters)
+        : _path(std::move(path)),
+          _query_id(query_id),
+          _writer(std::move(writer)),
+          _io_token(std::move(io_token)),
+          _counters(counters),
+          _codec(SpillManager::instance()->codec()) {}
+
+SpillFile::~SpillFile() {
+    // Drop the queued writes and wait for the running one, which may still access this file.
+    _io_token->shutdown();
+    _reader.reset();
+    if (_writer != nullptr) {
+        _writer->close();
+        _writer.reset();
+    }
+    auto st = FileSystem::Default()->delete_file(_path);
+    if (!st.ok()) {
+        LOG(WARNING) << "Failed to delete spill file " << _path << ": " << st;
+    }
+    if (_acquired_bytes > 0) {
+        SpillManager::instance()->release(_query_id, _acquired_bytes);
+    }
+}
+
+Status SpillFile::_io_status() {
+    std::lock_guard<std::mutex> l(_io_status_lock);
+    return _async_io_status;
+}
+
+void SpillFile::_write_block(const Block& block) {
+    {
+        std::lock_guard<std::mutex> l(_io_status_lock);
+        if (!_async_io_status.ok()) {
+            _pending_bytes -= block.size();
+            return;
+        }
+    }
+    MonotonicStopWatch watch;
+    watch.start();
+    Status st = _writer->append(Slice(block.data(), block.size()));
+    int64_t elapsed_ns = watch.elapsed_time();
+    if (!st.ok()) {
+        std::lock_guard<std::mutex> l(_io_status_lock);
+        _async_io_status = st;
+    }
+    if (_counters != nullptr) {
+        COUNTER_UPDATE(_counters->write_bytes, block.size());
+        COUNTER_UPDATE(_counters->write_timer, elapsed_ns);
+    }
+    StarRocksMetrics::instance()->spill_write_bytes_total.increment(block.size());
+    StarRocksMetrics::instance()->spill_write_duration_us.increment(elapsed_ns / 1000);
+    _pending_bytes -= block.size();
+}
+
+Status SpillFile::append(const vectorized::Chunk& chunk) {
+    DCHECK(_writer != nullptr);
+    if (chunk.is_empty()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_io_status());
+    if (_schema == nullptr) {
+        _schema = chunk.clone_empty_with_tuple(0);
+    }
+    DCHECK_EQ(_schema->num_columns(), chunk.num_columns());
+
+    int64_t max_size = 0;
+    for (const auto& column : chunk.columns()) {
+        int64_t size = serde::ColumnArraySerde::max_serialized_size(*column);
+        if (UNLIKELY(size == 0)) {
+            return Status::NotSupported(strings::Substitute("Spill does not support column $0", column->get_name()));
+        }
+        max_size += size;
+    }
+    _buffer.resize(max_size);
+
+    uint8_t* end = _buffer.data();
+    for (const auto& column : chunk.columns()) {
+        end = serde::ColumnArraySerde::serialize(*column, end);
+        if (UNLIKELY(end == nullptr)) {
+            return Status::InternalError("Failed to serialize spilled chunk");
+        }
+    }
+    Slice payload(_buffer.data(), end - _buffer.data());
+    uint64_t uncompressed_size = payload.size;
+
+    // The block is moved to the I/O thread, so it is allocated for every append.
+    auto block = std::make_shared<Block>();
+    if (_codec != nullptr && !_codec->exceed_max_input_size(payload.size)) {
+        block->resize(kBlockHeaderSize + _codec->max_compressed_len(payload.size));
+        Slice compressed(block->data() + kBlockHeaderSize, block->size() - kBlockHeaderSize);
+        RETURN_IF_ERROR(_codec->compress(payload, &compressed));
+        if (compressed.size < payload.size) {
+            block->resize(kBlockHeaderSize + compressed.size);
+        } else {
+            block->clear();
+        }
+    }
+    if (block->empty()) {
+        block->resize(kBlockHeaderSize + payload.size);
+        memcpy(block->data() + kBlockHeaderSize, payload.data, payload.size);
+    }
+    uint64_t stored_size = block->size() - kBlockHeaderSize;
+    memcpy(block->data(), &stored_size, sizeof(stored_size));
+    memcpy(block->data() + sizeof(stored_size), &uncompressed_size, sizeof(uncompressed_size));
+
+    int64_t block_size = block->size();
+    RETURN_IF_ERROR(SpillManager::instance()->acquire(_query_id, block_size));
+    _acquired_bytes += block_size;
+
+    _pending_bytes += block_size;
+    auto st = _io_token->submit_func([this, block] { _write_block(*block); });
+    if (!st.ok()) {
+        _pending_bytes -= block_size;
+        return st;
+    }
+    _num_chunks++;
+    _num_rows += chunk.num_rows();
+    _file_size += block_size;
+
+    // Bound the memory held by the queued blocks.
+    if (_pending_bytes > config::spill_file_max_pending_write_bytes) {
+        _io_token->wait();
+        RETURN_IF_ERROR(_io_status());
+    }
+    return Status::OK();
+}
+
+Status SpillFile::finish_write() {
+    DCHECK(_writer != nullptr);
+    _io_token->wait();
+    RETURN_IF_ERROR(_io_status());
+    RETURN_IF_ERROR(_writer->close());
+    _writer.reset();
+    // Release the serialization buffer, it will be reallocated by reading.
+    raw::RawVector<uint8_t>().swap(_buffer);
+    ASSIGN_OR_RETURN(_reader, FileSystem::Default()->new_sequential_file(_path));
+    return Status::OK();
+}
+
+StatusOr<vectorized::ChunkUniquePtr> SpillFile::read_next() {
+    DCHECK(_reader != nullptr);
+    MonotonicStopWatch watch;
+    watch.start();
+    uint64_t header[2] = {0, 0};
+    ASSIGN_OR_RETURN(auto nread, _reader->read(header, kBlockHeaderSize));
+    if (nread == 0) {
+        return nullptr;
+    }
+    if (UNLIKELY(nread != kBlockHeaderSize)) {
+        return Status::Corruption(strings::Substitute("Truncated block header in spill file $0", _path));
+    }
+    uint64_t stored_size = header[0];
+    uint64_t uncompressed_size = header[1];
+    _buffer.resize(stored_size);
+    RETURN_IF_ERROR(_reader->read_fully(_buffer.data(), stored_size));
+    int64_t elapsed_ns = watch.elapsed_time();
+    if (_counters != nullptr) {
+        COUNTER_UPDATE(_counters->read_bytes, kBlockHeaderSize + stored_size);
+        COUNTER_UPDATE(_counters->read_timer, elapsed_ns);
+    }
+    StarRocksMetrics::instance()->spill_read_bytes_total.increment(kBlockHeaderSize + stored_size);
+    StarRocksMetrics::instance()->spill_read_duration_us.increment(elapsed_ns / 1000);
+
+    const uint8_t* cur = _buffer.data();
+    if (stored_size != uncompressed_size) {
+        if (UNLIKELY(_codec == nullptr)) {
+            return Status::Corruption(strings::Substitute("Unexpected compressed block in spill file $0", _path));
+        }
+        _uncompressed_buffer.resize(uncompressed_size);
+        Slice output(_uncompressed_buffer.data(), uncompressed_size);
+        RETURN_IF_ERROR(_codec->decompress(Slice(_buffer.data(), stored_size), &output));
+        if (UNLIKELY(output.size != uncompressed_size)) {
+            return Status::Corruption(strings::Substitute("Failed to decompress block of spill file $0", _path));
+        }
+        cur = _uncompressed_buffer.data();
+    }
+
+    vectorized::ChunkUniquePtr chunk = _schema->clone_empty_with_tuple(0);
+    for (auto& column : chunk->columns()) {
+        cur = serde::ColumnArraySerde::deserialize(cur, column.get());
+        if (UNLIKELY(cur == nullptr)) {
+            return Status::Corruption(strings::Substitute("Failed to deserialize chunk from spill file $0", _path));
+        }
+    }
+    return chunk;
+}
+
+} // namespace starrocks::spill
@@ -0,0 +1,113 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "column/chunk.h"
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+#include "gen_cpp/Types_types.h"
+#include "util/raw_container.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+class BlockCompressionCodec;
+class RuntimeState;
+class SequentialFile;
+class ThreadPoolToken;
+class WritableFile;
+} // namespace starrocks
+
+namespace starrocks::spill {
+
+// The I/O counters of the spill files of an operator, shared by all its spill files.
+// The counters are updated by the I/O threads, which is fine since the counter values are atomic.
+struct SpillIOCounters {
+    explicit SpillIOCounters(RuntimeProfile* profile);
+
+    RuntimeProfile::Counter* write_bytes = nullptr;
+    RuntimeProfile::Counter* write_timer = nullptr;
+    RuntimeProfile::Counter* read_bytes = nullptr;
+    RuntimeProfile::Counter* read_timer = nullptr;
+};
+
+// SpillFile is an append-only local file holding a sequence of chunks that share the same layout.
+// Chunks are appended while spilling, and read back in the appending order after `finish_write()`.
+// The underlying file is removed when the SpillFile is destroyed.
+//
+// The file is placed by SpillManager, and the appended blocks are written by the I/O thread pool of
+// its directory, so `append()` only waits for the disk when too many bytes are pending.
+//
+// Each chunk is stored as a block:
+//   | stored size (uint64) | uncompressed size (uint64) | payload |
+// where the payload is the columns serialized by `serde::ColumnArraySerde`, compressed by the codec of
+// SpillManager if that makes it smaller. A block is not compressed if its two sizes are equal.
+class SpillFile {
+public:
+    // Create a new spill file for the fragment instance of |state|, |label| is used to
+    // distinguish the files from different operators of the same fragment instance.
+    // |counters| may be nullptr, and must outlive the file otherwise.
+    static StatusOr<std::unique_ptr<SpillFile>> create(RuntimeState* state, const std::string& label,
+                                                       SpillIOCounters* counters = nullptr);
+
+    SpillFile(std::string path, const TUniqueId& query_id, std::unique_ptr<WritableFile> writer,
+              std::unique_ptr<ThreadPoolToken> io_token, SpillIOCounters* counters);
+    ~SpillFile();
+
+    SpillFile(const SpillFile&) = delete;
+    SpillFile& operator=(const SpillFile&) = delete;
+
+    Status append(const vectorized::Chunk& chunk);
+
+    // Wait for the pending writes and close the writer, no more chunks can be appended after that.
+    Status finish_write();
+
+    // Return the next chunk, or nullptr if all the chunks have been read.
+    // REQUIRES: `finish_write()` has been called.
+    StatusOr<vectorized::ChunkUniquePtr> read_next();
+
+    const std::string& path() const { return _path; }
+    int64_t num_chunks() const { return _num_chunks; }
+    int64_t num_rows() const { return _num_rows; }
+    // The bytes on disk, after compression.
+    int64_t file_size() const { return _file_size; }
+
+private:
+    using Block = raw::RawVector<uint8_t>;
+
+    static constexpr size_t kBlockHeaderSize = 2 * sizeof(uint64_t);
+
+    // Runs on the I/O thread.
+    void _write_block(const Block& block);
+    Status _io_status();
+
+    const std::string _path;
+    const TUniqueId _query_id;
+    std::unique_ptr<WritableFile> _writer;
+    std::unique_ptr<SequentialFile> _reader;
+    std::unique_ptr<ThreadPoolToken> _io_token;
+    SpillIOCounters* _counters;
+    const BlockCompressionCodec* _codec;
+
+    std::mutex _io_status_lock;
+    Status _async_io_status;
+    std::atomic<int64_t> _pending_bytes{0};
+    // The spill quota acquired from SpillManager, released on destruction.
+    int64_t _acquired_bytes = 0;
+
+    // An empty chunk with the same columns and slot/tuple mapping as the spilled chunks,
+    // used to create the chunks read back.
+    vectorized::ChunkUniquePtr _schema;
+    raw::RawVector<uint8_t> _buffer;
+    raw::RawVector<uint8_t> _uncompressed_buffer;
+
+    int64_t _num_chunks = 0;
+    int64_t _num_rows = 0;
+    int64_t _file_size = 0;
+};
+
+} // namespace starrocks::spill
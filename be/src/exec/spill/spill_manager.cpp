@@ -0,0 +1,140 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/spill/spill_manager.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "fs/fs.h"
+#include "gutil/strings/substitute.h"
+#include "storage/data_dir.h"
+#include "storage/storage_engine.h"
+#include "util/compression/block_compression.h"
+#include "util/starrocks_metrics.h"
+#include "util/threadpool.h"
+
+namespace starrocks::spill {
+
+static CompressionTypePB parse_compression_type(std::string name) {
+    std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+    if (name == "LZ4") return CompressionTypePB::LZ4;
+    if (name == "LZ4_FRAME") return CompressionTypePB::LZ4_FRAME;
+    if (name == "SNAPPY") return CompressionTypePB::SNAPPY;
+    if (name == "ZSTD") return CompressionTypePB::ZSTD;
+    if (name == "ZLIB") return CompressionTypePB::ZLIB;
+    if (name == "NONE" || name == "NO_COMPRESSION") return CompressionTypePB::NO_COMPRESSION;
+    return CompressionTypePB::UNKNOWN_COMPRESSION;
+}
+
+SpillManager* SpillManager::instance() {
+    static SpillManager s_instance;
+    static std::once_flag s_init_flag;
+    std::call_once(s_init_flag, [] { s_instance._init_status = s_instance._init(); });
+    return &s_instance;
+}
+
+SpillManager::SpillManager() = default;
+
+SpillManager::~SpillManager() {
+    for (auto& dir : _dirs) {
+        if (dir.io_pool != nullptr) {
+            dir.io_pool->shutdown();
+        }
+    }
+}
+
+Status SpillManager::_init() {
+    auto type = parse_compression_type(config::spill_compression);
+    if (type == CompressionTypePB::UNKNOWN_COMPRESSION) {
+        LOG(WARNING) << "Unknown spill_compression " << config::spill_compression << ", spill without compression";
+        type = CompressionTypePB::NO_COMPRESSION;
+    }
+    RETURN_IF_ERROR(get_block_compression_codec(type, &_codec));
+
+    if (auto* engine = StorageEngine::instance(); engine != nullptr) {
+        for (DataDir* data_dir : engine->get_stores()) {
+            SpillDir dir;
+            dir.path = data_dir->path() + "/spill";
+            dir.data_dir = data_dir;
+            _dirs.emplace_back(std::move(dir));
+        }
+    }
+    if (_dirs.empty()) {
+        // The path is left empty, and config::spill_local_storage_dir is read on allocation.
+        _dirs.emplace_back();
+    }
+
+    int num_threads = std::max(1, config::spill_io_threads_per_disk);
+    for (size_t i = 0; i < _dirs.size(); i++) {
+        RETURN_IF_ERROR(ThreadPoolBuilder(strings::Substitute("spill_io_$0", i))
+                                .set_min_threads(0)
+                                .set_max_threads(num_threads)
+                                .set_idle_timeout(MonoDelta::FromMilliseconds(60000))
+                                .build(&_dirs[i].io_pool));
+    }
+    return Status::OK();
+}
+
+StatusOr<SpillManager::Placement> SpillManager::allocate() {
+    RETURN_IF_ERROR(_init_status);
+    size_t start = _next_dir.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < _dirs.size(); i++) {
+        auto& dir = _dirs[(start + i) % _dirs.size()];
+        if (dir.data_dir != nullptr && (!dir.data_dir->is_used() || dir.data_dir->capacity_limit_reached(0))) {
+            continue;
+        }
+        Placement placement;
+        placement.dir = dir.data_dir != nullptr ? dir.path : config::spill_local_storage_dir;
+        RETURN_IF_ERROR(FileSystem::Default()->create_dir_recursive(placement.dir));
+        placement.io_token = dir.io_pool->new_token(ThreadPool::ExecutionMode::SERIAL);
+        return placement;
+    }
+    return Status::ResourceBusy("No spill directory available, all the disks are full or unused");
+}
+
+Status SpillManager::acquire(const TUniqueId& query_id, int64_t bytes) {
+    std::lock_guard<std::mutex> l(_mutex);
+    int64_t global_limit = config::spill_max_bytes;
+    if (global_limit >= 0 && _total_bytes + bytes > global_limit) {
+        return Status::ResourceBusy(
+                strings::Substitute("Spill exceeds spill_max_bytes $0, spilled $1", global_limit, _total_bytes));
+    }
+    auto iter = _query_bytes.find(query_id);
+    int64_t query_bytes = iter == _query_bytes.end() ? 0 : iter->second;
+    int64_t query_limit = config::spill_query_max_bytes;
+    if (query_limit >= 0 && query_bytes + bytes > query_limit) {
+        return Status::ResourceBusy(
+                strings::Substitute("Spill exceeds spill_query_max_bytes $0, spilled $1", query_limit, query_bytes));
+    }
+    _query_bytes[query_id] = query_bytes + bytes;
+    _total_bytes += bytes;
+    StarRocksMetrics::instance()->spill_disk_bytes.set_value(_total_bytes);
+    return Status::OK();
+}
+
+void SpillManager::release(const TUniqueId& query_id, int64_t bytes) {
+    std::lock_guard<std::mutex> l(_mutex);
+    auto iter = _query_bytes.find(query_id);
+    DCHECK(iter != _query_bytes.end());
+    if (iter != _query_bytes.end()) {
+        iter->second -= bytes;
+        if (iter->second <= 0) {
+            _query_bytes.erase(iter);
+        }
+    }
+    _total_bytes -= bytes;
+    StarRocksMetrics::instance()->spill_disk_bytes.set_value(_total_bytes);
+}
+
+int64_t SpillManager::total_bytes() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _total_bytes;
+}
+
+int64_t SpillManager::query_bytes(const TUniqueId& query_id) const {
+    std::lock_guard<std::mutex> l(_mutex);
+    auto iter = _query_bytes.find(query_id);
+    return iter == _query_bytes.end() ? 0 : iter->second;
+}
+
+} // namespace starrocks::spill
@@ -0,0 +1,83 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/statusor.h"
+#include "gen_cpp/Types_types.h"
+#include "util/hash_util.hpp"
+
+namespace starrocks {
+class BlockCompressionCodec;
+class DataDir;
+class ThreadPool;
+class ThreadPoolToken;
+} // namespace starrocks
+
+namespace starrocks::spill {
+
+// SpillManager is shared by all the spillable operators of this BE. It decides which directory
+// a new spill file is placed on, runs the I/O of the spill files on a thread pool per directory,
+// and keeps the bytes on disk within `config::spill_max_bytes` and `config::spill_query_max_bytes`.
+//
+// The spill directories are the `spill` sub-directories of the storage paths of StorageEngine,
+// or `config::spill_local_storage_dir` if there is no StorageEngine (compute nodes and tests).
+class SpillManager {
+public:
+    static SpillManager* instance();
+
+    ~SpillManager();
+
+    SpillManager(const SpillManager&) = delete;
+    SpillManager& operator=(const SpillManager&) = delete;
+
+    struct Placement {
+        std::string dir;
+        // Runs the I/O of one spill file in order.
+        std::unique_ptr<ThreadPoolToken> io_token;
+    };
+
+    // Pick a directory for a new spill file. The directories are used in turn,
+    // skipping the ones whose disk is almost full.
+    StatusOr<Placement> allocate();
+
+    // Reserve |bytes| of spill quota for |query_id|, fail if the global or the query quota is exceeded.
+    Status acquire(const TUniqueId& query_id, int64_t bytes);
+    void release(const TUniqueId& query_id, int64_t bytes);
+
+    // The codec to compress the spilled blocks, nullptr means no compression.
+    const BlockCompressionCodec* codec() const { return _codec; }
+
+    int64_t total_bytes() const;
+    int64_t query_bytes(const TUniqueId& query_id) const;
+
+private:
+    SpillManager();
+
+    Status _init();
+
+    struct SpillDir {
+        // Empty if the directory is not on a storage path.
+        std::string path;
+        // nullptr if the directory is not on a storage path.
+        DataDir* data_dir = nullptr;
+        std::unique_ptr<ThreadPool> io_pool;
+    };
+
+    Status _init_status;
+    std::vector<SpillDir> _dirs;
+    std::atomic<size_t> _next_dir{0};
+    const BlockCompressionCodec* _codec = nullptr;
+
+    mutable std::mutex _mutex;
+    int64_t _total_bytes = 0;
+    std::unordered_map<TUniqueId, int64_t> _query_bytes;
+};
+
+} // namespace starrocks::spill
@@ -0,0 +1,20 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include "common/config.h"
+#include "runtime/mem_tracker.h"
+
+namespace starrocks::spill {
+
+// Whether the memory consumption of |tracker| reaches config::spill_mem_limit_threshold percent
+// of the lowest limit among it and its ancestors, which tells a spillable operator to start spilling.
+inline bool reach_spill_mem_threshold(const MemTracker* tracker) {
+    int64_t limit = tracker->lowest_limit();
+    if (limit <= 0) {
+        return false;
+    }
+    return tracker->spare_capacity() < limit * (100 - config::spill_mem_limit_threshold) / 100;
+}
+
+} // namespace starrocks::spill
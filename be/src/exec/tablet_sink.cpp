@@ -118,12 +118,13 @@ Status NodeChannel::init(RuntimeState* state) {
     }
     RETURN_IF_ERROR(get_block_compression_codec(_compress_type, &_compress_codec));
 
+    _max_parallel_request_size = config::load_default_parallel_request_size;
     if (state->query_options().__isset.load_dop) {
         _max_parallel_request_size = state->query_options().load_dop;
-        if (_max_parallel_request_size > config::max_load_dop || _max_parallel_request_size < 1) {
-            _err_st = Status::InternalError(fmt::format("load_dop should between [1-{}]", config::max_load_dop));
-            return _err_st;
-        }
+    }
+    if (_max_parallel_request_size > config::max_load_dop || _max_parallel_request_size < 1) {
+        _err_st = Status::InternalError(fmt::format("load_dop should between [1-{}]", config::max_load_dop));
+        return _err_st;
     }
 
     // init add_chunk request closure
@@ -132,6 +133,7 @@ Status NodeChannel::init(RuntimeState* state) {
         closure->ref();
         _add_batch_closures.emplace_back(closure);
     }
+    _add_batch_packet_seqs.assign(_max_parallel_request_size, -1);
 
     // for get global_dict
     _runtime_state = state;
@@ -160,10 +162,21 @@ void NodeChannel::_open(int64_t index_id, RefCountClosure<PTabletWriterOpenResul
     request.set_txn_trace_parent(_parent->_txn_trace_parent);
     request.set_allocated_schema(_parent->_schema->to_protobuf());
     request.set_is_lake_tablet(_parent->_is_lake_table);
+    request.set_is_replicated_storage(_parent->_enable_replicated_storage);
+    request.set_node_id(_node_id);
     for (auto& tablet : _index_tablets_map[index_id]) {
         auto ptablet = request.add_tablets();
         ptablet->set_partition_id(tablet.partition_id);
         ptablet->set_tablet_id(tablet.tablet_id);
+        if (_parent->_enable_replicated_storage) {
+            for (auto node_id : _parent->_location->find_tablet(tablet.tablet_id)->node_ids) {
+                auto node = _parent->_nodes_info->find_node(node_id);
+                auto replica = ptablet->add_replicas();
+                replica->set_host(node->host);
+                replica->set_port(node->brpc_port);
+                replica->set_node_id(node_id);
+            }
+        }
     }
     request.set_num_senders(_parent->_num_senders);
     request.set_need_gen_rollup(_parent->_need_gen_rollup);
@@ -474,8 +487,15 @@ Status NodeChannel::_send_request(bool eos) {
         }
     }
 
-    RETURN_IF_ERROR(_wait_one_prev_request());
+    if (UNLIKELY(eos)) {
+        // The receiver closes the sender once it gets the eos request, so the eos request must not overtake
+        // the in-flight requests.
+        RETURN_IF_ERROR(_wait_all_prev_request());
+    } else {
+        RETURN_IF_ERROR(_wait_one_prev_request());
+    }
 
+    _add_batch_packet_seqs[_current_request_index] = _next_packet_seq;
     _add_batch_closures[_current_request_index]->ref();
     _add_batch_closures[_current_request_index]->reset();
     _add_batch_closures[_current_request_index]->cntl.set_timeout_ms(_rpc_timeout_ms);
@@ -602,9 +622,13 @@ Status NodeChannel::_wait_one_prev_request() {
         }
     }
 
-    // 3. waiting one request
-    // TODO(meegoo): optimize to wait first finish request
+    // 3. waiting the oldest request, the receiver handles the requests in the order of packet_seq
     _current_request_index = 0;
+    for (size_t i = 1; i < _max_parallel_request_size; i++) {
+        if (_add_batch_packet_seqs[i] < _add_batch_packet_seqs[_current_request_index]) {
+            _current_request_index = i;
+        }
+    }
     RETURN_IF_ERROR(_wait_request(_add_batch_closures[_current_request_index]));
 
     return Status::OK();
@@ -615,7 +639,9 @@ Status NodeChannel::try_close() {
         return _err_st;
     }
 
-    if (_check_prev_request_done()) {
+    // the eos request is sent after all the in-flight requests finished, see _send_request()
+    bool ready = _request_queue.size() > 1 ? _check_prev_request_done() : _check_all_prev_request_done();
+    if (ready) {
         auto st = _send_request(true /* eos */);
         if (!st.ok()) {
             _cancelled = true;
@@ -742,6 +768,7 @@ Status OlapTableSink::init(const TDataSink& t_sink) {
     RETURN_IF_ERROR(_vectorized_partition->init());
     _location = _pool->add(new OlapTableLocationParam(table_sink.location));
     _nodes_info = _pool->add(new StarRocksNodesInfo(table_sink.nodes_info));
+    _enable_replicated_storage = config::enable_load_segment_replication && !_is_lake_table && !_colocate_mv_index;
 
     if (table_sink.__isset.load_channel_timeout_s) {
         _load_channel_timeout_s = table_sink.load_channel_timeout_s;
@@ -1160,7 +1187,11 @@ Status OlapTableSink::_send_chunk_by_node(vectorized::Chunk* chunk, IndexChannel
         _node_select_idx.reserve(selection_idx.size());
         for (unsigned short selection : selection_idx) {
             std::vector<int64_t>& be_ids = channel->_tablet_to_be.find(_tablet_ids[selection])->second;
-            if (std::find(be_ids.begin(), be_ids.end(), be_id) != be_ids.end()) {
+            if (_enable_replicated_storage) {
+                if (be_ids[0] == be_id) {
+                    _node_select_idx.emplace_back(selection);
+                }
+            } else if (std::find(be_ids.begin(), be_ids.end(), be_id) != be_ids.end()) {
                 _node_select_idx.emplace_back(selection);
             }
         }
@@ -229,6 +229,8 @@ private:
 
     size_t _max_parallel_request_size = 1;
     std::vector<ReusableClosure<PTabletWriterAddBatchResult>*> _add_batch_closures;
+    // the packet_seq of the last request sent by each closure, -1 if unused
+    std::vector<int64_t> _add_batch_packet_seqs;
     std::unique_ptr<vectorized::Chunk> _cur_chunk;
 
     PTabletWriterAddChunksRequest _rpc_request;
@@ -384,6 +386,9 @@ private:
     int _sender_id = -1;
     int _num_senders = -1;
     bool _is_lake_table = false;
+    // Only the primary replica, i.e. the first one in the location, of each tablet receives the chunks,
+    // and replicates its segments to the other replicas.
+    bool _enable_replicated_storage = false;
 
     // TODO(zc): think about cache this data
     std::shared_ptr<OlapTableSchemaParam> _schema;
@@ -4,6 +4,7 @@
 
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "column/column.h"
 #include "column/column_hash.h"
@@ -136,6 +137,37 @@ struct AggHashMapWithOneNumberKey {
         }
     }
 
+    // Only find the keys, set |not_founds| of the keys not in |hash_map|.
+    template <typename THashMap>
+    static void find_agg_prefetch(THashMap& hash_map, ColumnType* column, Buffer<AggDataPtr>* agg_states,
+                                  std::vector<uint8_t>* not_founds) {
+        AGG_HASH_MAP_PRECOMPUTE_HASH_VALUES(column, AGG_HASH_MAP_DEFAULT_PREFETCH_DIST);
+        for (size_t i = 0; i < column_size; i++) {
+            AGG_HASH_MAP_PREFETCH_HASH_VALUE();
+
+            FieldType key = column->get_data()[i];
+            if (auto iter = hash_map.find(key, hash_values[i]); iter != hash_map.end()) {
+                (*agg_states)[i] = iter->second;
+            } else {
+                (*not_founds)[i] = 1;
+            }
+        }
+    }
+
+    template <typename THashMap>
+    static void find_agg_noprefetch(THashMap& hash_map, ColumnType* column, Buffer<AggDataPtr>* agg_states,
+                                    std::vector<uint8_t>* not_founds) {
+        size_t num_rows = column->size();
+        for (size_t i = 0; i < num_rows; i++) {
+            FieldType key = column->get_data()[i];
+            if (auto iter = hash_map.find(key); iter != hash_map.end()) {
+                (*agg_states)[i] = iter->second;
+            } else {
+                (*not_founds)[i] = 1;
+            }
+        }
+    }
+
     template <typename Func>
     void compute_agg_states(size_t chunk_size, const Columns& key_columns, MemPool* pool, Func&& allocate_func,
                             Buffer<AggDataPtr>* agg_states) {
@@ -161,13 +193,10 @@ struct AggHashMapWithOneNumberKey {
         (*not_founds).assign(chunk_size, 0);
         auto column = down_cast<ColumnType*>(key_columns[0].get());
 
-        for (size_t i = 0; i < chunk_size; i++) {
-            FieldType key = column->get_data()[i];
-            if (auto iter = hash_map.find(key); iter != hash_map.end()) {
-                (*agg_states)[i] = iter->second;
-            } else {
-                (*not_founds)[i] = 1;
-            }
+        if (hash_map.bucket_count() < prefetch_threhold) {
+            find_agg_noprefetch(hash_map, column, agg_states, not_founds);
+        } else {
+            find_agg_prefetch(hash_map, column, agg_states, not_founds);
         }
     }
 
@@ -259,8 +288,12 @@ struct AggHashMapWithOneNullableNumberKey {
             auto* data_column = ColumnHelper::as_raw_column<ColumnType>(nullable_column->data_column());
 
             if (!nullable_column->has_null()) {
-                for (size_t i = 0; i < data_column->size(); i++) {
-                    _handle_data_key_column(data_column, i, agg_states, not_founds);
+                if (hash_map.bucket_count() < prefetch_threhold) {
+                    AggHashMapWithOneNumberKey<primitive_type, HashMap>::find_agg_noprefetch(hash_map, data_column,
+                                                                                            agg_states, not_founds);
+                } else {
+                    AggHashMapWithOneNumberKey<primitive_type, HashMap>::find_agg_prefetch(hash_map, data_column,
+                                                                                          agg_states, not_founds);
                 }
                 return;
             }
@@ -357,6 +390,36 @@ struct AggHashMapWithOneStringKey {
         }
     }
 
+    // Only find the keys, set |not_founds| of the keys not in |hash_map|.
+    template <typename THashMap>
+    static void find_agg_prefetch(THashMap& hash_map, BinaryColumn* column, Buffer<AggDataPtr>* agg_states,
+                                  std::vector<uint8_t>* not_founds) {
+        AGG_HASH_MAP_PRECOMPUTE_HASH_VALUES(column, AGG_HASH_MAP_DEFAULT_PREFETCH_DIST);
+        for (size_t i = 0; i < column_size; i++) {
+            AGG_HASH_MAP_PREFETCH_HASH_VALUE();
+            auto key = column->get_slice(i);
+            if (auto iter = hash_map.find(key, hash_values[i]); iter != hash_map.end()) {
+                (*agg_states)[i] = iter->second;
+            } else {
+                (*not_founds)[i] = 1;
+            }
+        }
+    }
+
+    template <typename THashMap>
+    static void find_agg_noprefetch(THashMap& hash_map, BinaryColumn* column, Buffer<AggDataPtr>* agg_states,
+                                    std::vector<uint8_t>* not_founds) {
+        size_t num_rows = column->size();
+        for (size_t i = 0; i < num_rows; i++) {
+            auto key = column->get_slice(i);
+            if (auto iter = hash_map.find(key); iter != hash_map.end()) {
+                (*agg_states)[i] = iter->second;
+            } else {
+                (*not_founds)[i] = 1;
+            }
+        }
+    }
+
     template <typename Func>
     void compute_agg_states(size_t chunk_size, const Columns& key_columns, MemPool* pool, Func&& allocate_func,
                             Buffer<AggDataPtr>* agg_states) {
@@ -380,13 +443,10 @@ struct AggHashMapWithOneStringKey {
         auto* column = ColumnHelper::as_raw_column<BinaryColumn>(key_columns[0]);
         not_founds->assign(chunk_size, 0);
 
-        for (size_t i = 0; i < chunk_size; i++) {
-            auto key = column->get_slice(i);
-            if (auto iter = hash_map.find(key); iter != hash_map.end()) {
-                (*agg_states)[i] = iter->second;
-            } else {
-                (*not_founds)[i] = 1;
-            }
+        if (hash_map.bucket_count() < prefetch_threhold) {
+            find_agg_noprefetch(hash_map, column, agg_states, not_founds);
+        } else {
+            find_agg_prefetch(hash_map, column, agg_states, not_founds);
         }
     }
 
@@ -471,8 +531,12 @@ struct AggHashMapWithOneNullableStringKey {
             DCHECK(data_column->is_binary());
 
             if (!nullable_column->has_null()) {
-                for (size_t i = 0; i < data_column->size(); i++) {
-                    _handle_data_key_column(data_column, i, agg_states, not_founds);
+                if (hash_map.bucket_count() < prefetch_threhold) {
+                    AggHashMapWithOneStringKey<HashMap>::find_agg_noprefetch(hash_map, data_column, agg_states,
+                                                                             not_founds);
+                } else {
+                    AggHashMapWithOneStringKey<HashMap>::find_agg_prefetch(hash_map, data_column, agg_states,
+                                                                           not_founds);
                 }
                 return;
             }
@@ -560,6 +624,41 @@ struct AggHashMapWithSerializedKey {
             key_column->serialize_batch(buffer, slice_sizes, chunk_size, max_one_row_size);
         }
 
+        if (hash_map.bucket_count() < prefetch_threhold) {
+            compute_agg_noprefetch(chunk_size, pool, allocate_func, agg_states);
+        } else {
+            compute_agg_prefetch(chunk_size, pool, allocate_func, agg_states);
+        }
+    }
+
+    template <typename Func>
+    void compute_agg_prefetch(size_t chunk_size, MemPool* pool, Func&& allocate_func, Buffer<AggDataPtr>* agg_states) {
+        size_t* hash_values = reinterpret_cast<size_t*>(agg_states->data());
+        for (size_t i = 0; i < chunk_size; ++i) {
+            hash_values[i] = hash_map.hash_function()(Slice{buffer + i * max_one_row_size, slice_sizes[i]});
+        }
+        size_t __prefetch_index = AGG_HASH_MAP_DEFAULT_PREFETCH_DIST;
+
+        for (size_t i = 0; i < chunk_size; ++i) {
+            if (__prefetch_index < chunk_size) {
+                hash_map.prefetch_hash(hash_values[__prefetch_index++]);
+            }
+            Slice key = {buffer + i * max_one_row_size, slice_sizes[i]};
+            auto iter = hash_map.lazy_emplace_with_hash(key, hash_values[i], [&](const auto& ctor) {
+                // we must persist the slice before insert
+                uint8_t* pos = pool->allocate(key.size);
+                strings::memcpy_inlined(pos, key.data, key.size);
+                Slice pk{pos, key.size};
+                AggDataPtr pv = allocate_func(pk);
+                ctor(pk, pv);
+            });
+            (*agg_states)[i] = iter->second;
+        }
+    }
+
+    template <typename Func>
+    void compute_agg_noprefetch(size_t chunk_size, MemPool* pool, Func&& allocate_func,
+                                Buffer<AggDataPtr>* agg_states) {
         for (size_t i = 0; i < chunk_size; ++i) {
             Slice key = {buffer + i * max_one_row_size, slice_sizes[i]};
             auto iter = hash_map.lazy_emplace(key, [&](const auto& ctor) {
@@ -594,9 +693,29 @@ struct AggHashMapWithSerializedKey {
         }
 
         not_founds->assign(chunk_size, 0);
+        if (hash_map.bucket_count() < prefetch_threhold) {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                Slice key = {buffer + i * max_one_row_size, slice_sizes[i]};
+                if (auto iter = hash_map.find(key); iter != hash_map.end()) {
+                    (*agg_states)[i] = iter->second;
+                } else {
+                    (*not_founds)[i] = 1;
+                }
+            }
+            return;
+        }
+
+        size_t* hash_values = reinterpret_cast<size_t*>(agg_states->data());
         for (size_t i = 0; i < chunk_size; ++i) {
+            hash_values[i] = hash_map.hash_function()(Slice{buffer + i * max_one_row_size, slice_sizes[i]});
+        }
+        size_t __prefetch_index = AGG_HASH_MAP_DEFAULT_PREFETCH_DIST;
+        for (size_t i = 0; i < chunk_size; ++i) {
+            if (__prefetch_index < chunk_size) {
+                hash_map.prefetch_hash(hash_values[__prefetch_index++]);
+            }
             Slice key = {buffer + i * max_one_row_size, slice_sizes[i]};
-            if (auto iter = hash_map.find(key); iter != hash_map.end()) {
+            if (auto iter = hash_map.find(key, hash_values[i]); iter != hash_map.end()) {
                 (*agg_states)[i] = iter->second;
             } else {
                 (*not_founds)[i] = 1;
@@ -821,4 +940,12 @@ struct AggHashMapWithSerializedKeyFixedSize {
     int32_t _chunk_size;
 };
 
+// Whether insert_keys_to_columns() of the hash map uses the scratch buffer `tmp_slices`,
+// so it can't be called concurrently.
+template <typename HashMapWithKey, typename = void>
+struct HasTmpSlices : std::false_type {};
+template <typename HashMapWithKey>
+struct HasTmpSlices<HashMapWithKey, std::void_t<decltype(std::declval<HashMapWithKey&>().tmp_slices)>>
+        : std::true_type {};
+
 } // namespace starrocks::vectorized
@@ -374,6 +374,13 @@ struct AggHashMapVariant {
         }
     }
 
+    // Release all the hash maps, `init()` must be called before using it again.
+    void reset() {
+#define M(NAME) NAME.reset();
+        APPLY_FOR_AGG_VARIANT_ALL(M)
+#undef M
+    }
+
     size_t capacity() const {
         switch (type) {
 #define M(NAME)      \
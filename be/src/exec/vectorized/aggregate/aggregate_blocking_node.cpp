@@ -4,6 +4,8 @@
 
 #include "exec/pipeline/aggregate/aggregate_blocking_sink_operator.h"
 #include "exec/pipeline/aggregate/aggregate_blocking_source_operator.h"
+#include "exec/pipeline/aggregate/sorted_aggregate_streaming_sink_operator.h"
+#include "exec/pipeline/aggregate/sorted_aggregate_streaming_source_operator.h"
 #include "exec/pipeline/chunk_accumulate_operator.h"
 #include "exec/pipeline/exchange/exchange_source_operator.h"
 #include "exec/pipeline/limit_operator.h"
@@ -173,7 +175,11 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory> > AggregateBlockingNode::
 
     OpFactories ops_with_sink = _children[0]->decompose_to_pipeline(context);
     auto& agg_node = _tnode.agg_node;
-    if (agg_node.need_finalize) {
+    // The groups of an input ordered by the group by keys are aggregated one after another, without a hash table.
+    // The planner only asks for it if the input of each driver is ordered, which a local shuffle would break.
+    const bool use_sort_agg = agg_node.__isset.use_sort_agg && agg_node.use_sort_agg &&
+                              agg_node.__isset.grouping_exprs && !agg_node.grouping_exprs.empty();
+    if (agg_node.need_finalize && !use_sort_agg) {
         // If finalize aggregate with group by clause, then it can be parallelized
         if (agg_node.__isset.grouping_exprs && !_tnode.agg_node.grouping_exprs.empty()) {
             if (context->need_local_shuffle(ops_with_sink)) {
@@ -195,16 +201,25 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory> > AggregateBlockingNode::
 
     // Create a shared RefCountedRuntimeFilterCollector
     auto&& rc_rf_probe_collector = std::make_shared<RcRfProbeCollector>(2, std::move(this->runtime_filter_collector()));
-    auto sink_operator = std::make_shared<AggregateBlockingSinkOperatorFactory>(context->next_operator_id(), id(),
-                                                                                aggregator_factory);
+    OpFactoryPtr sink_operator;
+    std::shared_ptr<SourceOperatorFactory> source_operator;
+    if (use_sort_agg) {
+        sink_operator = std::make_shared<SortedAggregateStreamingSinkOperatorFactory>(context->next_operator_id(),
+                                                                                      id(), aggregator_factory);
+        source_operator = std::make_shared<SortedAggregateStreamingSourceOperatorFactory>(context->next_operator_id(),
+                                                                                          id(), aggregator_factory);
+    } else {
+        sink_operator = std::make_shared<AggregateBlockingSinkOperatorFactory>(context->next_operator_id(), id(),
+                                                                               aggregator_factory);
+        source_operator = std::make_shared<AggregateBlockingSourceOperatorFactory>(context->next_operator_id(), id(),
+                                                                                   aggregator_factory);
+    }
     // Initialize OperatorFactory's fields involving runtime filters.
     this->init_runtime_filter_for_operator(sink_operator.get(), context, rc_rf_probe_collector);
     ops_with_sink.push_back(std::move(sink_operator));
     context->add_pipeline(ops_with_sink);
 
     OpFactories ops_with_source;
-    auto source_operator = std::make_shared<AggregateBlockingSourceOperatorFactory>(context->next_operator_id(), id(),
-                                                                                    aggregator_factory);
     // Initialize OperatorFactory's fields involving runtime filters.
     this->init_runtime_filter_for_operator(source_operator.get(), context, rc_rf_probe_collector);
     // Aggregator must be used by a pair of sink and source operators,
@@ -4,6 +4,8 @@
 
 #include "exec/pipeline/aggregate/aggregate_streaming_sink_operator.h"
 #include "exec/pipeline/aggregate/aggregate_streaming_source_operator.h"
+#include "exec/pipeline/aggregate/sorted_aggregate_streaming_sink_operator.h"
+#include "exec/pipeline/aggregate/sorted_aggregate_streaming_source_operator.h"
 #include "exec/pipeline/limit_operator.h"
 #include "exec/pipeline/operator.h"
 #include "exec/pipeline/pipeline_builder.h"
@@ -260,16 +262,28 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory> > AggregateStreamingNode:
 
     // Create a shared RefCountedRuntimeFilterCollector
     auto&& rc_rf_probe_collector = std::make_shared<RcRfProbeCollector>(2, std::move(this->runtime_filter_collector()));
-    auto sink_operator = std::make_shared<AggregateStreamingSinkOperatorFactory>(context->next_operator_id(), id(),
-                                                                                 aggregator_factory);
+    // The groups of an input ordered by the group by keys are aggregated one after another, without a hash table.
+    const bool use_sort_agg = _tnode.agg_node.__isset.use_sort_agg && _tnode.agg_node.use_sort_agg &&
+                              !_tnode.agg_node.grouping_exprs.empty();
+    OpFactoryPtr sink_operator;
+    std::shared_ptr<SourceOperatorFactory> source_operator;
+    if (use_sort_agg) {
+        sink_operator = std::make_shared<SortedAggregateStreamingSinkOperatorFactory>(context->next_operator_id(),
+                                                                                      id(), aggregator_factory);
+        source_operator = std::make_shared<SortedAggregateStreamingSourceOperatorFactory>(context->next_operator_id(),
+                                                                                          id(), aggregator_factory);
+    } else {
+        sink_operator = std::make_shared<AggregateStreamingSinkOperatorFactory>(context->next_operator_id(), id(),
+                                                                                aggregator_factory);
+        source_operator = std::make_shared<AggregateStreamingSourceOperatorFactory>(context->next_operator_id(), id(),
+                                                                                    aggregator_factory);
+    }
     // Initialize OperatorFactory's fields involving runtime filters.
     this->init_runtime_filter_for_operator(sink_operator.get(), context, rc_rf_probe_collector);
     operators_with_sink.emplace_back(sink_operator);
     context->add_pipeline(operators_with_sink);
 
     OpFactories operators_with_source;
-    auto source_operator = std::make_shared<AggregateStreamingSourceOperatorFactory>(context->next_operator_id(), id(),
-                                                                                     aggregator_factory);
     // Initialize OperatorFactory's fields involving runtime filters.
     this->init_runtime_filter_for_operator(source_operator.get(), context, rc_rf_probe_collector);
 
@@ -0,0 +1,96 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/vectorized/aggregate/streaming_preagg_controller.h"
+
+#include <algorithm>
+
+#include "column/column.h"
+#include "common/config.h"
+#include "util/hash_util.hpp"
+
+namespace starrocks::vectorized {
+
+StreamingPreaggController::StreamingPreaggController(RuntimeProfile* profile) {
+    _preaggregate_chunks = ADD_COUNTER(profile, "AdaptivePreaggregateChunks", TUnit::UNIT);
+    _selective_chunks = ADD_COUNTER(profile, "AdaptiveSelectiveChunks", TUnit::UNIT);
+    _pass_through_chunks = ADD_COUNTER(profile, "AdaptivePassThroughChunks", TUnit::UNIT);
+    _strategy_switches = ADD_COUNTER(profile, "AdaptiveStrategySwitches", TUnit::UNIT);
+}
+
+void StreamingPreaggController::_sample(const Columns& group_by_columns, size_t num_rows) {
+    _hashes.assign(num_rows, HashUtil::FNV_SEED);
+    for (const auto& column : group_by_columns) {
+        column->fnv_hash(_hashes.data(), 0, num_rows);
+    }
+    for (uint32_t hash : _hashes) {
+        // HyperLogLog needs a well distributed 64-bit hash.
+        _hll.update(HashUtil::murmur_hash64A(&hash, sizeof(hash), 0));
+    }
+    _sampled_rows += num_rows;
+}
+
+StreamingPreaggController::Strategy StreamingPreaggController::_decide(size_t ht_size) const {
+    double reduction = 1.0;
+    if (_sampled_rows > 0) {
+        reduction = static_cast<double>(_sampled_rows) / std::max<int64_t>(1, _hll.estimate_cardinality());
+    }
+    // A few sampled rows can't see the keys repeated over a long distance, which is observed from the hash table.
+    if (_window_inserted_rows > 0) {
+        size_t new_keys = ht_size > _window_start_ht_size ? ht_size - _window_start_ht_size : 0;
+        reduction = std::max(reduction, static_cast<double>(_window_inserted_rows) / std::max<size_t>(1, new_keys));
+    }
+    if (reduction < config::streaming_preagg_pass_through_reduction) {
+        return Strategy::PASS_THROUGH;
+    }
+    if (reduction >= config::streaming_preagg_expand_reduction) {
+        return Strategy::PREAGGREGATE;
+    }
+    return Strategy::LIMITED;
+}
+
+StreamingPreaggController::Mode StreamingPreaggController::next_mode(const Columns& group_by_columns,
+                                                                     size_t chunk_size, size_t ht_size,
+                                                                     size_t ht_bytes) {
+    if (_window_rows >= static_cast<size_t>(config::streaming_preagg_adaptive_window_rows)) {
+        auto strategy = _decide(ht_size);
+        if (strategy != _strategy) {
+            COUNTER_UPDATE(_strategy_switches, 1);
+            _strategy = strategy;
+        }
+        _window_rows = 0;
+        _window_inserted_rows = 0;
+        _window_start_ht_size = ht_size;
+        _sampled_rows = 0;
+        _hll = HyperLogLog();
+    }
+
+    size_t sample_limit = config::streaming_preagg_adaptive_sample_rows;
+    if (_sampled_rows < sample_limit) {
+        _sample(group_by_columns, std::min(chunk_size, sample_limit - _sampled_rows));
+    }
+    _window_rows += chunk_size;
+
+    Mode mode = Mode::PREAGGREGATE;
+    if (_strategy == Strategy::PASS_THROUGH) {
+        mode = Mode::PASS_THROUGH;
+    } else if (_strategy == Strategy::LIMITED &&
+               ht_bytes >= static_cast<size_t>(config::streaming_preagg_limited_ht_bytes)) {
+        mode = Mode::SELECTIVE;
+    }
+
+    switch (mode) {
+    case Mode::PREAGGREGATE:
+        _window_inserted_rows += chunk_size;
+        COUNTER_UPDATE(_preaggregate_chunks, 1);
+        break;
+    case Mode::SELECTIVE:
+        COUNTER_UPDATE(_selective_chunks, 1);
+        break;
+    case Mode::PASS_THROUGH:
+        COUNTER_UPDATE(_pass_through_chunks, 1);
+        break;
+    }
+    return mode;
+}
+
+} // namespace starrocks::vectorized
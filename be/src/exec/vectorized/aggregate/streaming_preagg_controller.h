@@ -0,0 +1,70 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "types/hll.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks::vectorized {
+
+// StreamingPreaggController decides how the streaming pre-aggregation processes the input chunks when
+// config::enable_adaptive_streaming_preaggregation is on and the mode of the plan is AUTO.
+//
+// The input is divided into windows of config::streaming_preagg_adaptive_window_rows rows. At the beginning
+// of each window, the group by keys of config::streaming_preagg_adaptive_sample_rows rows are hashed into a
+// HyperLogLog to estimate the reduction, i.e. the number of rows per distinct key. Together with the reduction
+// observed from the growth of the hash table in the last window, it decides the strategy of the next window:
+// - The keys are nearly unique: hashing them is wasted, so the rows are passed through.
+// - The keys are repeated a lot: the hash table is expanded freely to reduce the rows shuffled.
+// - Otherwise: the hash table grows up to config::streaming_preagg_limited_ht_bytes, which is supposed to stay
+//   in cache. After that, only the rows whose keys are already in the hash table are aggregated.
+class StreamingPreaggController {
+public:
+    // How to process an input chunk.
+    enum class Mode {
+        // Aggregate all the rows, and expand the hash table if needed.
+        PREAGGREGATE = 0,
+        // Aggregate the rows whose keys are in the hash table, and pass through the others.
+        SELECTIVE = 1,
+        // Pass through all the rows.
+        PASS_THROUGH = 2,
+    };
+
+    explicit StreamingPreaggController(RuntimeProfile* profile);
+
+    // Called before each input chunk is processed, with the evaluated group by columns of the chunk,
+    // and the number of keys and allocated bytes of the hash table.
+    Mode next_mode(const Columns& group_by_columns, size_t chunk_size, size_t ht_size, size_t ht_bytes);
+
+private:
+    enum class Strategy {
+        PREAGGREGATE = 0,
+        LIMITED = 1,
+        PASS_THROUGH = 2,
+    };
+
+    void _sample(const Columns& group_by_columns, size_t num_rows);
+    Strategy _decide(size_t ht_size) const;
+
+    Strategy _strategy = Strategy::LIMITED;
+
+    // The state of the current window.
+    size_t _window_rows = 0;
+    // The rows which are inserted into the hash table by PREAGGREGATE.
+    size_t _window_inserted_rows = 0;
+    size_t _window_start_ht_size = 0;
+    size_t _sampled_rows = 0;
+    HyperLogLog _hll;
+    std::vector<uint32_t> _hashes;
+
+    RuntimeProfile::Counter* _preaggregate_chunks = nullptr;
+    RuntimeProfile::Counter* _selective_chunks = nullptr;
+    RuntimeProfile::Counter* _pass_through_chunks = nullptr;
+    RuntimeProfile::Counter* _strategy_switches = nullptr;
+};
+
+} // namespace starrocks::vectorized
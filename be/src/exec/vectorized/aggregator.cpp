@@ -5,13 +5,16 @@
 #include <algorithm>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/status.h"
+#include "exec/spill/spill_util.h"
 #include "exprs/anyval_util.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
 #include "runtime/primitive_type.h"
 #include "udf/java/utils.h"
+#include "util/uid_util.h"
 
 namespace starrocks {
 namespace vectorized {
@@ -46,6 +49,10 @@ Status Aggregator::open(RuntimeState* state) {
         });
         RETURN_IF_ERROR(promise_st->get_future().get());
     }
+    if (_is_sorted_streaming && _has_udaf) {
+        // The states of the sorted groups are created while the chunks are aggregated, not in a pthread.
+        return Status::NotSupported("Sort aggregation does not support java UDAF");
+    }
 
     // AggregateFunction::create needs to call create in JNI,
     // but prepare is executed in bthread, which will cause the JNI code to crash
@@ -94,6 +101,8 @@ Status Aggregator::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile
 
     _limit = _tnode.limit;
     _needs_finalize = _tnode.agg_node.need_finalize;
+    _is_sorted_streaming = _tnode.agg_node.__isset.use_sort_agg && _tnode.agg_node.use_sort_agg &&
+                           !_tnode.agg_node.grouping_exprs.empty();
     _streaming_preaggregation_mode = _tnode.agg_node.streaming_preaggregation_mode;
     _intermediate_tuple_id = _tnode.agg_node.intermediate_tuple_id;
     _output_tuple_id = _tnode.agg_node.output_tuple_id;
@@ -204,7 +213,8 @@ Status Aggregator::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile
         _agg_intput_columns[i].resize(desc.nodes[0].num_children);
         _agg_input_raw_columns[i].resize(desc.nodes[0].num_children);
     }
-    _mem_pool = std::make_unique<MemPool>();
+    // The keys and the states of a large hash table are allocated from huge page chunks.
+    _mem_pool = std::make_unique<MemPool>(MemPool::LARGE_CHUNK_SIZE);
     // TODO: use hashtable key size as align
     // reserve size for hash table key
     _agg_states_total_size = 16;
@@ -238,6 +248,7 @@ Status Aggregator::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile
     _group_by_append_timer = ADD_TIMER(_runtime_profile, "ResultGroupByAppendTime");
     //TODO: split agg_compute_timer to cunstruct_ht_time + agg_func_compute_time
     _agg_compute_timer = ADD_TIMER(_runtime_profile, "AggComputeTime");
+    _hash_table_build_timer = ADD_TIMER(_runtime_profile, "HashTableBuildTime");
     _streaming_timer = ADD_TIMER(_runtime_profile, "StreamingTime");
     _expr_compute_timer = ADD_TIMER(_runtime_profile, "ExprComputeTime");
     _expr_release_timer = ADD_TIMER(_runtime_profile, "ExprReleaseTime");
@@ -291,6 +302,11 @@ void Aggregator::close(RuntimeState* state) {
         // _mem_pool is nullptr means prepare phase failed
         if (_mem_pool != nullptr) {
             // Note: we must free agg_states object before _mem_pool free_all;
+            for (auto* sorted_group_state : _sorted_group_states) {
+                for (int i = 0; i < _agg_functions.size(); i++) {
+                    _agg_functions[i]->destroy(_agg_fn_ctxs[i], sorted_group_state + _agg_states_offsets[i]);
+                }
+            }
             if (_single_agg_state != nullptr) {
                 for (int i = 0; i < _agg_functions.size(); i++) {
                     _agg_functions[i]->destroy(_agg_fn_ctxs[0], _single_agg_state + _agg_states_offsets[i]);
@@ -565,6 +581,125 @@ void Aggregator::output_chunk_by_streaming_with_selection(vectorized::ChunkPtr*
         return;                                                                                                        \
     }
 
+Status Aggregator::build_sorted_groups(size_t chunk_size, vectorized::ChunkPtr* chunk) {
+    DCHECK(_is_sorted_streaming);
+    if (chunk_size == 0) {
+        return Status::OK();
+    }
+
+    // A row starts a group if its key differs from the key of the previous row.
+    bool is_open_group_continued = !_sorted_group_key.empty();
+    for (size_t j = 0; j < _group_by_columns.size() && is_open_group_continued; j++) {
+        is_open_group_continued = _group_by_columns[j]->compare_at(0, 0, *_sorted_group_key[j], 1) == 0;
+    }
+    _is_sorted_group_start.assign(chunk_size, 0);
+    _is_sorted_group_start[0] = 1;
+    for (const auto& column : _group_by_columns) {
+        for (size_t i = 1; i < chunk_size; i++) {
+            _is_sorted_group_start[i] |= column->compare_at(i, i - 1, *column, 1) != 0;
+        }
+    }
+    _sorted_group_starts.clear();
+    for (uint32_t i = 0; i < chunk_size; i++) {
+        if (_is_sorted_group_start[i]) {
+            _sorted_group_starts.push_back(i);
+        }
+    }
+    const size_t num_groups = _sorted_group_starts.size();
+
+    // The first group of the chunk goes on in the state of the open group if their keys are equal,
+    // otherwise the groups of the chunk take the next states.
+    const size_t first_group_state = is_open_group_continued ? 0 : 1;
+    RETURN_IF_ERROR(_reserve_sorted_group_states(first_group_state + num_groups));
+    for (size_t g = 0; g < num_groups; g++) {
+        size_t end = g + 1 < num_groups ? _sorted_group_starts[g + 1] : chunk_size;
+        std::fill(_tmp_agg_states.begin() + _sorted_group_starts[g], _tmp_agg_states.begin() + end,
+                  _sorted_group_states[first_group_state + g]);
+    }
+    {
+        SCOPED_TIMER(_agg_compute_timer);
+        compute_batch_agg_states(chunk_size);
+    }
+
+    // Output the states before the one of the last group, including the open group if it has ended.
+    const bool is_open_group_ended = !_sorted_group_key.empty() && !is_open_group_continued;
+    const size_t output_begin = is_open_group_ended ? 0 : first_group_state;
+    const size_t last_group_state = first_group_state + num_groups - 1;
+    if (output_begin < last_group_state) {
+        SCOPED_TIMER(_get_results_timer);
+        vectorized::Columns group_by_columns = _create_group_by_columns();
+        vectorized::Columns agg_result_columns = _create_agg_result_columns();
+        for (size_t j = 0; j < _group_by_columns.size(); j++) {
+            if (is_open_group_ended) {
+                group_by_columns[j]->append(*_sorted_group_key[j], 0, 1);
+            }
+            group_by_columns[j]->append_selective(*_group_by_columns[j], _sorted_group_starts.data(), 0,
+                                                  num_groups - 1);
+        }
+        for (size_t s = output_begin; s < last_group_state; s++) {
+            if (_needs_finalize) {
+                _finalize_to_chunk(_sorted_group_states[s], agg_result_columns);
+            } else {
+                _serialize_to_chunk(_sorted_group_states[s], agg_result_columns);
+            }
+            _reset_sorted_group_state(_sorted_group_states[s]);
+        }
+        *chunk = _build_output_chunk(group_by_columns, agg_result_columns);
+        _num_rows_returned += last_group_state - output_begin;
+    }
+
+    // The last group becomes the open group, the state it replaces has been reset or never used.
+    std::swap(_sorted_group_states[0], _sorted_group_states[last_group_state]);
+    _sorted_group_key.resize(_group_by_columns.size());
+    for (size_t j = 0; j < _group_by_columns.size(); j++) {
+        _sorted_group_key[j] = _group_by_columns[j]->clone_empty();
+        _sorted_group_key[j]->append(*_group_by_columns[j], _sorted_group_starts.back(), 1);
+    }
+    return Status::OK();
+}
+
+Status Aggregator::finish_sorted_groups(vectorized::ChunkPtr* chunk) {
+    DCHECK(_is_sorted_streaming);
+    if (_sorted_group_key.empty()) {
+        return Status::OK();
+    }
+    SCOPED_TIMER(_get_results_timer);
+    vectorized::Columns group_by_columns = _create_group_by_columns();
+    vectorized::Columns agg_result_columns = _create_agg_result_columns();
+    for (size_t j = 0; j < _sorted_group_key.size(); j++) {
+        group_by_columns[j]->append(*_sorted_group_key[j], 0, 1);
+    }
+    if (_needs_finalize) {
+        _finalize_to_chunk(_sorted_group_states[0], agg_result_columns);
+    } else {
+        _serialize_to_chunk(_sorted_group_states[0], agg_result_columns);
+    }
+    _reset_sorted_group_state(_sorted_group_states[0]);
+    _sorted_group_key.clear();
+    *chunk = _build_output_chunk(group_by_columns, agg_result_columns);
+    ++_num_rows_returned;
+    return Status::OK();
+}
+
+Status Aggregator::_reserve_sorted_group_states(size_t num_states) {
+    while (_sorted_group_states.size() < num_states) {
+        vectorized::AggDataPtr state = _mem_pool->allocate_aligned(_agg_states_total_size, _max_agg_state_align_size);
+        RETURN_IF_UNLIKELY_NULL(state, Status::MemoryAllocFailed("alloc sorted agg state failed"));
+        for (int i = 0; i < _agg_functions.size(); i++) {
+            _agg_functions[i]->create(_agg_fn_ctxs[i], state + _agg_states_offsets[i]);
+        }
+        _sorted_group_states.push_back(state);
+    }
+    return Status::OK();
+}
+
+void Aggregator::_reset_sorted_group_state(vectorized::AggDataPtr state) {
+    for (int i = 0; i < _agg_functions.size(); i++) {
+        _agg_functions[i]->destroy(_agg_fn_ctxs[i], state + _agg_states_offsets[i]);
+        _agg_functions[i]->create(_agg_fn_ctxs[i], state + _agg_states_offsets[i]);
+    }
+}
+
 void Aggregator::try_convert_to_two_level_map() {
     if (_mem_tracker->consumption() > two_level_memory_threshold) {
         CONVERT_TO_TWO_LEVEL_MAP(phase1_slice_two_level, phase1_slice);
@@ -588,6 +723,150 @@ Status Aggregator::check_has_error() {
     return Status::OK();
 }
 
+void Aggregator::enable_spill() {
+    // Only the aggregate with group by and agg functions could be spilled.
+    if (_group_by_expr_ctxs.empty() || _is_only_group_by_columns) {
+        return;
+    }
+    _spill_enabled = true;
+    _spill_label = strings::Substitute("agg_$0", _tnode.node_id);
+    _spill_timer = ADD_TIMER(_runtime_profile, "SpillTime");
+    _spill_restore_timer = ADD_TIMER(_runtime_profile, "SpillRestoreTime");
+    _spilled_rows = ADD_COUNTER(_runtime_profile, "SpilledRows", TUnit::UNIT);
+    _spilled_bytes = ADD_COUNTER(_runtime_profile, "SpilledBytes", TUnit::BYTES);
+    _spilled_partitions_counter = ADD_COUNTER(_runtime_profile, "SpilledPartitions", TUnit::UNIT);
+    _spill_io_counters = std::make_unique<spill::SpillIOCounters>(_runtime_profile);
+}
+
+bool Aggregator::should_spill() const {
+    if (!_spill_enabled || _spilling_level() > config::spill_max_partition_level) {
+        return false;
+    }
+    return spill::reach_spill_mem_threshold(_mem_tracker);
+}
+
+Status Aggregator::spill_chunk(const vectorized::ChunkPtr& chunk) {
+    SCOPED_TIMER(_spill_timer);
+    DCHECK(_spill_enabled);
+    if (_spiller == nullptr) {
+        _spiller = std::make_unique<spill::PartitionedSpiller>(_state, _spill_label, config::spill_partition_num,
+                                                               _spilling_level(), _spill_io_counters.get());
+        VLOG_QUERY << "Aggregate node " << _spill_label << " of " << print_id(_state->fragment_instance_id())
+                   << " start spilling at level " << _spiller->level() << ", hash table size "
+                   << _hash_map_variant.size() << ", mem consumption " << _mem_tracker->consumption();
+    }
+
+    // The hash table doesn't accept new keys during spilling, so the rows of each key
+    // are either all aggregated in memory or all spilled.
+    const size_t chunk_size = chunk->num_rows();
+    if (false) {
+    }
+#define HASH_MAP_METHOD(NAME)                                                                               \
+    else if (_hash_map_variant.type == vectorized::AggHashMapVariant::Type::NAME) {                         \
+        TRY_CATCH_BAD_ALLOC(build_hash_map_with_selection<decltype(_hash_map_variant.NAME)::element_type>( \
+                *_hash_map_variant.NAME, chunk_size));                                                      \
+    }
+    APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+    compute_batch_agg_states_with_selection(chunk_size);
+
+    int64_t old_rows = _spiller->spilled_rows();
+    int64_t old_bytes = _spiller->spilled_bytes();
+    RETURN_IF_ERROR(_spiller->spill(*chunk, _group_by_columns, _streaming_selection.data()));
+    COUNTER_UPDATE(_spilled_rows, _spiller->spilled_rows() - old_rows);
+    COUNTER_UPDATE(_spilled_bytes, _spiller->spilled_bytes() - old_bytes);
+    return Status::OK();
+}
+
+Status Aggregator::finish_spill() {
+    if (_spiller == nullptr) {
+        return Status::OK();
+    }
+    SCOPED_TIMER(_spill_timer);
+    int level = _spiller->level();
+    int64_t old_bytes = _spiller->spilled_bytes();
+    ASSIGN_OR_RETURN(auto partitions, _spiller->finish());
+    COUNTER_UPDATE(_spilled_bytes, _spiller->spilled_bytes() - old_bytes);
+    _spiller.reset();
+    for (auto& file : partitions) {
+        if (file != nullptr) {
+            COUNTER_UPDATE(_spilled_partitions_counter, 1);
+            _spilled_partitions.push_back({std::move(file), level});
+        }
+    }
+    return Status::OK();
+}
+
+void Aggregator::prepare_parallel_output() {
+    // A batch of agg states mustn't exceed the chunk size.
+    if (!config::enable_aggregate_parallel_output || is_none_group_by_exprs() || _has_udaf || has_spilled_data() ||
+        _state->chunk_size() < HashTableKeyAllocator::alloc_batch_size) {
+        return;
+    }
+    _num_output_batches = _state_allocator.vecs.size();
+    _next_output_batch = 0;
+    _is_null_key_output = false;
+    _is_parallel_output = true;
+}
+
+Status Aggregator::restore_spilled_chunk() {
+    DCHECK(_is_ht_eos && has_spilled_data());
+    SCOPED_TIMER(_spill_restore_timer);
+    if (_restoring_partition.file == nullptr) {
+        // The in-memory hash table has been drained, release it before loading the next partition.
+        RETURN_IF_ERROR(_reset_hash_map());
+        _restoring_partition = std::move(_spilled_partitions.front());
+        _spilled_partitions.pop_front();
+    }
+
+    ASSIGN_OR_RETURN(vectorized::ChunkPtr chunk, _restoring_partition.file->read_next());
+    if (chunk == nullptr) {
+        // Queue the rows spilled again while loading this partition.
+        RETURN_IF_ERROR(finish_spill());
+        _restoring_partition = SpilledPartition();
+        _it_hash = _state_allocator.begin();
+        _is_ht_eos = _hash_map_variant.size() == 0;
+        return Status::OK();
+    }
+
+    RETURN_IF_ERROR(evaluate_exprs(chunk.get()));
+    if (is_spilling() || should_spill()) {
+        RETURN_IF_ERROR(spill_chunk(chunk));
+    } else {
+        const size_t chunk_size = chunk->num_rows();
+        if (false) {
+        }
+#define HASH_MAP_METHOD(NAME)                                                                                    \
+    else if (_hash_map_variant.type == vectorized::AggHashMapVariant::Type::NAME) {                              \
+        TRY_CATCH_BAD_ALLOC(                                                                                     \
+                build_hash_map<decltype(_hash_map_variant.NAME)::element_type>(*_hash_map_variant.NAME, chunk_size)); \
+    }
+        APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+        _mem_tracker->set(_hash_map_variant.reserved_memory_usage(_mem_pool.get()));
+        TRY_CATCH_BAD_ALLOC(try_convert_to_two_level_map());
+        compute_batch_agg_states(chunk_size);
+    }
+    return check_has_error();
+}
+
+Status Aggregator::_reset_hash_map() {
+    if (false) {
+    }
+#define HASH_MAP_METHOD(NAME)                                                     \
+    else if (_hash_map_variant.type == vectorized::AggHashMapVariant::Type::NAME) \
+            _release_agg_memory<decltype(_hash_map_variant.NAME)::element_type>(_hash_map_variant.NAME.get());
+    APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+    _hash_map_variant.reset();
+    _state_allocator.vecs.clear();
+    // The agg states and the keys are all allocated from _mem_pool, and they have been destroyed.
+    _mem_pool->free_all();
+    TRY_CATCH_BAD_ALLOC(_init_agg_hash_variant(_hash_map_variant));
+    _mem_tracker->set(_hash_map_variant.reserved_memory_usage(_mem_pool.get()));
+    return Status::OK();
+}
+
 #undef CONVERT_TO_TWO_LEVEL
 
 // When need finalize, create column by result type
@@ -622,6 +901,21 @@ vectorized::Columns Aggregator::_create_group_by_columns() {
     return group_by_columns;
 }
 
+vectorized::ChunkPtr Aggregator::_build_output_chunk(const vectorized::Columns& group_by_columns,
+                                                     const vectorized::Columns& agg_result_columns) {
+    vectorized::ChunkPtr result_chunk = std::make_shared<vectorized::Chunk>();
+    // For different agg phase, we should use different TupleDescriptor
+    auto* tuple_desc = _needs_finalize ? _output_tuple_desc : _intermediate_tuple_desc;
+    for (size_t i = 0; i < group_by_columns.size(); i++) {
+        result_chunk->append_column(group_by_columns[i], tuple_desc->slots()[i]->id());
+    }
+    for (size_t i = 0; i < agg_result_columns.size(); i++) {
+        size_t id = group_by_columns.size() + i;
+        result_chunk->append_column(agg_result_columns[i], tuple_desc->slots()[id]->id());
+    }
+    return result_chunk;
+}
+
 void Aggregator::_serialize_to_chunk(vectorized::ConstAggDataPtr __restrict state,
                                      const vectorized::Columns& agg_result_columns) {
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
@@ -6,6 +6,7 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <mutex>
 #include <queue>
 #include <utility>
@@ -16,6 +17,7 @@
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
 #include "exec/pipeline/context_with_dependency.h"
+#include "exec/spill/partitioned_spiller.h"
 #include "exec/vectorized/aggregate/agg_hash_variant.h"
 #include "exprs/agg/aggregate_factory.h"
 #include "exprs/expr.h"
@@ -162,6 +164,7 @@ public:
     const vectorized::AggHashSetVariant& hash_set_variant() { return _hash_set_variant; }
     std::any& it_hash() { return _it_hash; }
     const std::vector<uint8_t>& streaming_selection() { return _streaming_selection; }
+    const vectorized::Columns& group_by_columns() const { return _group_by_columns; }
     RuntimeProfile::Counter* get_results_timer() { return _get_results_timer; }
     RuntimeProfile::Counter* agg_compute_timer() { return _agg_compute_timer; }
     RuntimeProfile::Counter* streaming_timer() { return _streaming_timer; }
@@ -201,6 +204,17 @@ public:
     // selection[1] = 1: not found in hash table
     void output_chunk_by_streaming_with_selection(vectorized::ChunkPtr* chunk);
 
+    // The input is ordered by the group by keys, so the rows of a group are consecutive and the groups are
+    // aggregated one after another instead of in a hash table.
+    bool is_sorted_streaming() const { return _is_sorted_streaming; }
+
+    // Aggregate the rows of the evaluated chunk group by group, and output the groups ended in this chunk
+    // to |chunk|. The last group is kept open, since its rows may go on in the next chunk.
+    Status build_sorted_groups(size_t chunk_size, vectorized::ChunkPtr* chunk);
+
+    // Output the group left open by the last chunk, if any.
+    Status finish_sorted_groups(vectorized::ChunkPtr* chunk);
+
     // At first, we use single hash map, if hash map is too big,
     // we convert the single hash map to two level hash map.
     // two level hash map is better in large data set.
@@ -209,6 +223,43 @@ public:
 
     Status check_has_error();
 
+    // Spill support, only used by the blocking aggregate of pipeline engine.
+    // Once the memory usage approaches the limit, the keys already in the hash table keep being
+    // aggregated in memory, while the rows with new keys are spilled to disk, partitioned by the
+    // hash of the group by keys. After the in-memory hash table is drained, the spilled partitions
+    // are loaded and aggregated one by one, and a partition that is still too big is spilled again.
+    void enable_spill();
+    bool is_spill_enabled() const { return _spill_enabled; }
+    bool is_spilling() const { return _spiller != nullptr; }
+    bool should_spill() const;
+    // Aggregate the rows whose keys are in the hash table and spill the others.
+    // REQUIRES: the exprs have been evaluated on |chunk|.
+    Status spill_chunk(const vectorized::ChunkPtr& chunk);
+    // Close the current spiller and queue the partitions written by it.
+    Status finish_spill();
+    // Whether there are spilled partitions that haven't been output.
+    bool has_spilled_data() const { return !_spilled_partitions.empty() || _restoring_partition.file != nullptr; }
+
+    // Parallel output of the blocking aggregate in pipeline engine. The batches of agg states in
+    // _state_allocator are claimed by the source operator of this aggregator and the idle source operators
+    // of the other aggregators of the same AggregatorFactory, so a big hash table left after a skewed
+    // shuffle isn't output by a single driver. Enabled by `config::enable_aggregate_parallel_output`,
+    // for the group by aggregate without udaf and spill.
+    // REQUIRES: called by the sink operator before `sink_complete()`.
+    void prepare_parallel_output();
+    // Whether the hash table is output by convert_hash_map_batches_to_chunk().
+    // REQUIRES: `is_sink_complete()`.
+    bool is_parallel_output() const { return _is_parallel_output; }
+    // Whether there are batches of agg states not claimed by any source operator.
+    // REQUIRES: `is_sink_complete()`.
+    bool has_unclaimed_output() const {
+        return _is_parallel_output && _next_output_batch.load(std::memory_order_relaxed) < _num_output_batches;
+    }
+    // Load one chunk of the next spilled partition into the hash table. After the whole partition
+    // is loaded, `is_ht_eos()` becomes false and the hash table can be output as usual.
+    // REQUIRES: `is_ht_eos() && has_spilled_data()`.
+    Status restore_spilled_chunk();
+
 #ifdef NDEBUG
     static constexpr size_t two_level_memory_threshold = 33554432; // 32M, L3 Cache
     static constexpr size_t streaming_hash_table_size_threshold = 10000000;
@@ -310,8 +361,42 @@ private:
 
     bool _has_udaf = false;
 
+    // Used by parallel output, see prepare_parallel_output().
+    bool _is_parallel_output = false;
+    size_t _num_output_batches = 0;
+    std::atomic<size_t> _next_output_batch{0};
+    bool _is_null_key_output = false;
+    std::mutex _parallel_output_lock;
+
+    struct SpilledPartition {
+        std::unique_ptr<spill::SpillFile> file;
+        // The level of the spiller which wrote this partition.
+        int level = 0;
+    };
+    bool _spill_enabled = false;
+    std::string _spill_label;
+    // Must outlive _spiller and the spilled partitions, whose writes update it on the I/O threads.
+    std::unique_ptr<spill::SpillIOCounters> _spill_io_counters;
+    std::unique_ptr<spill::PartitionedSpiller> _spiller;
+    std::deque<SpilledPartition> _spilled_partitions;
+    // The partition being loaded into the hash table.
+    SpilledPartition _restoring_partition;
+
+    // Used by the sorted streaming aggregation, see build_sorted_groups().
+    bool _is_sorted_streaming = false;
+    // The states of the groups of the current chunk, the first one is the state of the open group.
+    std::vector<vectorized::AggDataPtr> _sorted_group_states;
+    // The key of the open group, a column of one row for each group by column, or empty if there is none.
+    vectorized::Columns _sorted_group_key;
+    // The first row of each group of the current chunk.
+    vectorized::Buffer<uint32_t> _sorted_group_starts;
+    std::vector<uint8_t> _is_sorted_group_start;
+
     RuntimeProfile::Counter* _get_results_timer{};
     RuntimeProfile::Counter* _agg_compute_timer{};
+    // The time of probing and inserting the group by keys into the hash table, which is mostly spent on the
+    // cache misses of the buckets once the hash table outgrows the caches.
+    RuntimeProfile::Counter* _hash_table_build_timer{};
     RuntimeProfile::Counter* _streaming_timer{};
     RuntimeProfile::Counter* _input_row_count{};
     RuntimeProfile::Counter* _rows_returned_counter;
@@ -322,6 +407,11 @@ private:
     RuntimeProfile::Counter* _pass_through_row_count{};
     RuntimeProfile::Counter* _expr_compute_timer{};
     RuntimeProfile::Counter* _expr_release_timer{};
+    RuntimeProfile::Counter* _spill_timer{};
+    RuntimeProfile::Counter* _spill_restore_timer{};
+    RuntimeProfile::Counter* _spilled_rows{};
+    RuntimeProfile::Counter* _spilled_bytes{};
+    RuntimeProfile::Counter* _spilled_partitions_counter{};
 
 public:
     template <typename HashMapWithKey>
@@ -334,23 +424,27 @@ public:
                 _streaming_selection.assign(chunk_size, 0);
             }
         }
+        SCOPED_TIMER(_hash_table_build_timer);
         hash_map_with_key.compute_agg_states(chunk_size, _group_by_columns, _mem_pool.get(),
                                              AllocateState<HashMapWithKey>(this), &_tmp_agg_states);
     }
 
     template <typename HashMapWithKey>
     void build_hash_map_with_selection(HashMapWithKey& hash_map_with_key, size_t chunk_size) {
+        SCOPED_TIMER(_hash_table_build_timer);
         hash_map_with_key.compute_agg_states(chunk_size, _group_by_columns, AllocateState<HashMapWithKey>(this),
                                              &_tmp_agg_states, &_streaming_selection);
     }
 
     template <typename HashSetWithKey>
     void build_hash_set(HashSetWithKey& hash_set, size_t chunk_size) {
+        SCOPED_TIMER(_hash_table_build_timer);
         hash_set.build_set(chunk_size, _group_by_columns, _mem_pool.get());
     }
 
     template <typename HashSetWithKey>
     void build_hash_set_with_selection(HashSetWithKey& hash_set, size_t chunk_size) {
+        SCOPED_TIMER(_hash_table_build_timer);
         hash_set.build_set(chunk_size, _group_by_columns, &_streaming_selection);
     }
 
@@ -426,27 +520,105 @@ public:
 
         _it_hash = it;
 
-        vectorized::ChunkPtr _result_chunk = std::make_shared<vectorized::Chunk>();
-        // For different agg phase, we should use different TupleDescriptor
-        if (_needs_finalize) {
-            for (size_t i = 0; i < group_by_columns.size(); i++) {
-                _result_chunk->append_column(group_by_columns[i], _output_tuple_desc->slots()[i]->id());
+        _num_rows_returned += read_index;
+        *chunk = _build_output_chunk(group_by_columns, agg_result_columns);
+    }
+
+    // Output the batches of agg states claimed by the caller, see prepare_parallel_output().
+    // It may be called concurrently by the source operator of this aggregator (|is_owner|)
+    // and the source operators of the other aggregators. Only the owner outputs the null key
+    // and sets `is_ht_eos()`, and `num_rows_returned()` is left to the caller.
+    template <typename HashMapWithKey>
+    void convert_hash_map_batches_to_chunk(HashMapWithKey& hash_map_with_key, int32_t chunk_size,
+                                           vectorized::ChunkPtr* chunk, bool is_owner) {
+        SCOPED_TIMER(_get_results_timer);
+        DCHECK(_is_parallel_output);
+
+        const size_t num_batches = std::max<size_t>(1, chunk_size / HashTableKeyAllocator::alloc_batch_size);
+        const size_t begin = std::min(_next_output_batch.fetch_add(num_batches), _num_output_batches);
+        const size_t end = std::min(begin + num_batches, _num_output_batches);
+
+        // The keys and states buffers of the hash map and the aggregator are used by the owner
+        // in the serial output, the claimed batches are read into the local ones.
+        typename HashMapWithKey::ResultVector keys;
+        vectorized::Buffer<vectorized::AggDataPtr> agg_states;
+        int32_t read_index = 0;
+        {
+            SCOPED_TIMER(_iter_timer);
+            size_t num_states = 0;
+            for (size_t x = begin; x < end; ++x) {
+                num_states += _state_allocator.vecs[x].second;
             }
-            for (size_t i = 0; i < agg_result_columns.size(); i++) {
-                size_t id = group_by_columns.size() + i;
-                _result_chunk->append_column(agg_result_columns[i], _output_tuple_desc->slots()[id]->id());
+            keys.resize(num_states);
+            agg_states.resize(num_states);
+            for (size_t x = begin; x < end; ++x) {
+                auto* batch = static_cast<uint8_t*>(_state_allocator.vecs[x].first);
+                for (int y = 0; y < _state_allocator.vecs[x].second; ++y) {
+                    auto* value = batch + _state_allocator.aggregate_key_size * y;
+                    keys[read_index] = *reinterpret_cast<typename HashMapWithKey::KeyType*>(value);
+                    agg_states[read_index] = value;
+                    ++read_index;
+                }
             }
-        } else {
-            for (size_t i = 0; i < group_by_columns.size(); i++) {
-                _result_chunk->append_column(group_by_columns[i], _intermediate_tuple_desc->slots()[i]->id());
+        }
+
+        vectorized::Columns group_by_columns = _create_group_by_columns();
+        vectorized::Columns agg_result_columns = _create_agg_result_columns();
+
+        {
+            SCOPED_TIMER(_group_by_append_timer);
+            if constexpr (vectorized::HasTmpSlices<HashMapWithKey>::value) {
+                // tmp_slices of the hash map is shared by all the callers.
+                std::lock_guard<std::mutex> l(_parallel_output_lock);
+                hash_map_with_key.insert_keys_to_columns(keys, group_by_columns, read_index);
+            } else {
+                hash_map_with_key.insert_keys_to_columns(keys, group_by_columns, read_index);
             }
-            for (size_t i = 0; i < agg_result_columns.size(); i++) {
-                size_t id = group_by_columns.size() + i;
-                _result_chunk->append_column(agg_result_columns[i], _intermediate_tuple_desc->slots()[id]->id());
+        }
+
+        {
+            SCOPED_TIMER(_agg_append_timer);
+            if (_needs_finalize) {
+                for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+                    _agg_functions[i]->batch_finalize(_agg_fn_ctxs[i], read_index, agg_states,
+                                                      _agg_states_offsets[i], agg_result_columns[i].get());
+                }
+            } else {
+                for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+                    _agg_functions[i]->batch_serialize(_agg_fn_ctxs[i], read_index, agg_states,
+                                                       _agg_states_offsets[i], agg_result_columns[i].get());
+                }
             }
         }
-        _num_rows_returned += read_index;
-        *chunk = std::move(_result_chunk);
+
+        if (is_owner && end == _num_output_batches) {
+            _is_ht_eos = true;
+            // If there is null key, output it last
+            if constexpr (HashMapWithKey::has_single_null_key) {
+                if (hash_map_with_key.null_key_data != nullptr && !_is_null_key_output) {
+                    // The output chunk size couldn't larger than _state->chunk_size()
+                    if (read_index < _state->chunk_size()) {
+                        DCHECK(group_by_columns.size() == 1);
+                        DCHECK(group_by_columns[0]->is_nullable());
+                        group_by_columns[0]->append_default();
+
+                        if (_needs_finalize) {
+                            _finalize_to_chunk(hash_map_with_key.null_key_data, agg_result_columns);
+                        } else {
+                            _serialize_to_chunk(hash_map_with_key.null_key_data, agg_result_columns);
+                        }
+
+                        ++read_index;
+                        _is_null_key_output = true;
+                    } else {
+                        // Output null key in next round
+                        _is_ht_eos = false;
+                    }
+                }
+            }
+        }
+
+        *chunk = _build_output_chunk(group_by_columns, agg_result_columns);
     }
 
     template <typename HashSetWithKey>
@@ -518,6 +690,9 @@ private:
     // Create new aggregate function result column by type
     vectorized::Columns _create_agg_result_columns();
     vectorized::Columns _create_group_by_columns();
+    // Build the output chunk of the hash table, by the tuple descriptor of the agg phase.
+    vectorized::ChunkPtr _build_output_chunk(const vectorized::Columns& group_by_columns,
+                                             const vectorized::Columns& agg_result_columns);
 
     void _serialize_to_chunk(vectorized::ConstAggDataPtr __restrict state,
                              const vectorized::Columns& agg_result_columns);
@@ -525,6 +700,15 @@ private:
                             const vectorized::Columns& agg_result_columns);
 
     void _reset_exprs(vectorized::Chunk* chunk);
+
+    // Create states until there are |num_states| of them for the sorted groups.
+    Status _reserve_sorted_group_states(size_t num_states);
+    void _reset_sorted_group_state(vectorized::AggDataPtr state);
+
+    // The level of spiller to create for the next spilling.
+    int _spilling_level() const { return _restoring_partition.file == nullptr ? 0 : _restoring_partition.level + 1; }
+    // Release all the agg states and keys and create an empty hash map.
+    Status _reset_hash_map();
     Status _evaluate_exprs(vectorized::Chunk* chunk);
 
     // Choose different agg hash map/set by different group by column's count, type, nullable
@@ -593,6 +777,10 @@ public:
         return aggregator;
     }
 
+    // All the aggregators created, used by the source operators to output the hash tables of each other.
+    // REQUIRES: get_or_create() isn't called anymore, i.e. all the drivers have been created.
+    const std::unordered_map<size_t, AggregatorPtr>& aggregators() const { return _aggregators; }
+
 private:
     const TPlanNode& _tnode;
     std::unordered_map<size_t, AggregatorPtr> _aggregators;
@@ -124,10 +124,16 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
             _need_partition_materializing = true;
         }
 
-        if (fn.name.function_name == "sum" || fn.name.function_name == "avg" || fn.name.function_name == "count") {
-            if (state->enable_pipeline_engine()) {
-                _support_cumulative_algo = true;
-            }
+        // The sliding frames are evaluated incrementally only if every function supports it.
+        if (i == 0) {
+            _support_cumulative_algo = state->enable_pipeline_engine();
+        }
+        const std::string& fn_name = fn.name.function_name;
+        if (fn_name == "max" || fn_name == "min") {
+            _support_cumulative_algo = _support_cumulative_algo && !fn.arg_types.empty() &&
+                                       !TypeDescriptor::from_thrift(fn.arg_types[0]).is_string_type();
+        } else if (fn_name != "sum" && fn_name != "avg" && fn_name != "count") {
+            _support_cumulative_algo = false;
         }
 
         bool is_input_nullable = false;
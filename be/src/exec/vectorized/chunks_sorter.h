@@ -6,6 +6,7 @@
 #include "exec/sort_exec_exprs.h"
 #include "exec/vectorized/sorting/sort_permute.h"
 #include "exec/vectorized/sorting/sorting.h"
+#include "exec/vectorized/topn_runtime_filter.h"
 #include "exprs/expr_context.h"
 #include "runtime/descriptors.h"
 #include "util/runtime_profile.h"
@@ -112,9 +113,19 @@ public:
 
     virtual int64_t mem_usage() const = 0;
 
+    // The top-n sorters publish their boundary to |filter|.
+    void set_topn_runtime_filter(TopnRuntimeFilterPtr filter) { _topn_runtime_filter = std::move(filter); }
+
 protected:
     size_t _get_number_of_order_by_columns() const { return _sort_exprs->size(); }
 
+    // Called with the first sort column when the sorter keeps enough rows and |row| is the last of them.
+    void _update_topn_runtime_filter(const ColumnPtr& column, size_t row) {
+        if (_topn_runtime_filter != nullptr) {
+            _topn_runtime_filter->update(*column, row);
+        }
+    }
+
     RuntimeState* _state;
 
     // sort rules
@@ -133,6 +144,8 @@ protected:
     RuntimeProfile::Counter* _output_timer = nullptr;
 
     std::atomic<bool> _is_sink_complete = false;
+
+    TopnRuntimeFilterPtr _topn_runtime_filter;
 };
 
 } // namespace starrocks::vectorized
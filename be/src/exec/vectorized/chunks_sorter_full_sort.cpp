@@ -2,11 +2,14 @@
 
 #include "chunks_sorter_full_sort.h"
 
+#include "exec/spill/spill_util.h"
 #include "exec/vectorized/sorting/merge.h"
 #include "exec/vectorized/sorting/sort_permute.h"
 #include "exec/vectorized/sorting/sorting.h"
 #include "exprs/expr.h"
+#include "runtime/chunk_cursor.h"
 #include "runtime/runtime_state.h"
+#include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
 
 namespace starrocks::vectorized {
@@ -18,9 +21,27 @@ ChunksSorterFullSort::ChunksSorterFullSort(RuntimeState* state, const std::vecto
 
 ChunksSorterFullSort::~ChunksSorterFullSort() = default;
 
+void ChunksSorterFullSort::setup_runtime(RuntimeProfile* profile) {
+    ChunksSorter::setup_runtime(profile);
+    if (_spill_enabled) {
+        _spill_timer = ADD_TIMER(profile, "SpillTime");
+        _spilled_rows_counter = ADD_COUNTER(profile, "SpilledRows", TUnit::UNIT);
+        _spilled_bytes_counter = ADD_COUNTER(profile, "SpilledBytes", TUnit::BYTES);
+        _spilled_runs_counter = ADD_COUNTER(profile, "SpilledRuns", TUnit::UNIT);
+        _spill_io_counters = std::make_unique<spill::SpillIOCounters>(profile);
+    }
+}
+
 Status ChunksSorterFullSort::update(RuntimeState* state, const ChunkPtr& chunk) {
-    _merge_unsorted(state, chunk);
-    _partial_sort(state, false);
+    RETURN_IF_ERROR(_merge_unsorted(state, chunk));
+    RETURN_IF_ERROR(_partial_sort(state, false));
+
+    // Only the full-sized partially sorted chunks are spilled, to avoid writing lots of tiny runs
+    // which make the final merge deep.
+    if (_spill_enabled && !_sorted_chunks.empty() &&
+        spill::reach_spill_mem_threshold(state->instance_mem_tracker())) {
+        RETURN_IF_ERROR(_spill_sorted_chunks(state));
+    }
 
     return Status::OK();
 }
@@ -76,14 +97,133 @@ Status ChunksSorterFullSort::_merge_sorted(RuntimeState* state) {
     return Status::OK();
 }
 
+Status ChunksSorterFullSort::_spill_sorted_chunks(RuntimeState* state) {
+    SCOPED_TIMER(_spill_timer);
+
+    SortedRuns runs;
+    SortDescs sort_desc(_sort_order_flag, _null_first_flag);
+    RETURN_IF_ERROR(merge_sorted_chunks(sort_desc, _sort_exprs, _sorted_chunks, &runs, 0));
+    _sorted_chunks.clear();
+
+    ASSIGN_OR_RETURN(auto file, spill::SpillFile::create(state, "sort", _spill_io_counters.get()));
+    size_t chunk_size = state->chunk_size();
+    while (runs.num_chunks() > 0) {
+        SortedRun& run = runs.front();
+        ChunkPtr chunk = run.steal_chunk(chunk_size);
+        if (chunk != nullptr) {
+            RETURN_IF_ERROR(chunk->downgrade());
+            RETURN_IF_ERROR(file->append(*chunk));
+        }
+        if (run.empty()) {
+            runs.pop_front();
+        }
+    }
+    RETURN_IF_ERROR(file->finish_write());
+
+    _spilled_rows += file->num_rows();
+    COUNTER_UPDATE(_spilled_rows_counter, file->num_rows());
+    COUNTER_UPDATE(_spilled_bytes_counter, file->file_size());
+    COUNTER_UPDATE(_spilled_runs_counter, 1);
+    _spilled_runs.push_back(std::move(file));
+    return Status::OK();
+}
+
+Status ChunksSorterFullSort::_init_spilled_runs_merger() {
+    std::vector<std::unique_ptr<SimpleChunkSortCursor>> cursors;
+    for (auto& spilled_run : _spilled_runs) {
+        spill::SpillFile* file = spilled_run.get();
+        ChunkProvider provider = [this, file](ChunkUniquePtr* out_chunk, bool* eos) -> bool {
+            // data ready
+            if (out_chunk == nullptr || eos == nullptr) {
+                return true;
+            }
+            auto chunk = file->read_next();
+            if (!chunk.ok()) {
+                _spill_status = chunk.status();
+                *eos = true;
+                return false;
+            }
+            if (chunk.value() == nullptr) {
+                *eos = true;
+                return false;
+            }
+            *out_chunk = std::move(chunk).value();
+            return true;
+        };
+        cursors.push_back(std::make_unique<SimpleChunkSortCursor>(std::move(provider), _sort_exprs));
+    }
+    if (_merged_runs.num_chunks() > 0) {
+        ChunkProvider provider = [this](ChunkUniquePtr* out_chunk, bool* eos) -> bool {
+            // data ready
+            if (out_chunk == nullptr || eos == nullptr) {
+                return true;
+            }
+            if (_merged_runs.num_chunks() == 0) {
+                *eos = true;
+                return false;
+            }
+            SortedRun& run = _merged_runs.front();
+            ChunkPtr chunk = run.steal_chunk(_state->chunk_size());
+            if (run.empty()) {
+                _merged_runs.pop_front();
+            }
+            if (chunk == nullptr) {
+                return false;
+            }
+            // The spilled runs have been downgraded, so the columns could be merged.
+            Status st = chunk->downgrade();
+            if (!st.ok()) {
+                _spill_status = st;
+                *eos = true;
+                return false;
+            }
+            *out_chunk = chunk->clone_unique();
+            return true;
+        };
+        cursors.push_back(std::make_unique<SimpleChunkSortCursor>(std::move(provider), _sort_exprs));
+    }
+
+    SortDescs sort_desc(_sort_order_flag, _null_first_flag);
+    RETURN_IF_ERROR(_spilled_runs_merger.init(sort_desc, std::move(cursors)));
+    CHECK(_spilled_runs_merger.is_data_ready()) << "data must be ready";
+    return Status::OK();
+}
+
 Status ChunksSorterFullSort::done(RuntimeState* state) {
     RETURN_IF_ERROR(_partial_sort(state, true));
     RETURN_IF_ERROR(_merge_sorted(state));
+    if (!_spilled_runs.empty()) {
+        RETURN_IF_ERROR(_init_spilled_runs_merger());
+    }
+    return Status::OK();
+}
+
+Status ChunksSorterFullSort::_get_next_from_spilled_runs(ChunkPtr* chunk, bool* eos) {
+    while (_merged_chunk.empty()) {
+        RETURN_IF_ERROR(_spill_status);
+        if (_spilled_runs_merger.is_eos()) {
+            *chunk = nullptr;
+            *eos = true;
+            return Status::OK();
+        }
+        SCOPED_TIMER(_merge_timer);
+        auto merged = _spilled_runs_merger.try_get_next();
+        if (merged != nullptr) {
+            _merged_chunk.reset(std::move(merged));
+        }
+    }
+    RETURN_IF_ERROR(_spill_status);
+    *chunk = _merged_chunk.cutoff(_state->chunk_size());
+    RETURN_IF_ERROR((*chunk)->downgrade());
+    *eos = false;
     return Status::OK();
 }
 
 Status ChunksSorterFullSort::get_next(ChunkPtr* chunk, bool* eos) {
     SCOPED_TIMER(_output_timer);
+    if (!_spilled_runs.empty()) {
+        return _get_next_from_spilled_runs(chunk, eos);
+    }
     if (_merged_runs.num_chunks() == 0) {
         *chunk = nullptr;
         *eos = true;
@@ -107,7 +247,7 @@ SortedRuns ChunksSorterFullSort::get_sorted_runs() {
 }
 
 size_t ChunksSorterFullSort::get_output_rows() const {
-    return _merged_runs.num_rows();
+    return _merged_runs.num_rows() + _spilled_rows;
 }
 
 int64_t ChunksSorterFullSort::mem_usage() const {
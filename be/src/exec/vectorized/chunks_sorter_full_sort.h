@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "column/column_helper.h"
+#include "exec/spill/spill_file.h"
 #include "exec/vectorized/chunks_sorter.h"
 #include "exec/vectorized/sorting/merge.h"
 #include "gtest/gtest_prod.h"
@@ -25,11 +27,18 @@ public:
                          const std::string& sort_keys);
     ~ChunksSorterFullSort() override;
 
+    // Write the partially sorted chunks to disk as sorted runs when the memory consumption reaches
+    // config::spill_mem_limit_threshold, and merge them in a streaming way in get_next().
+    // Must be called before setup_runtime().
+    void enable_spill() { _spill_enabled = true; }
+    void setup_runtime(RuntimeProfile* profile) override;
+
     // Append a Chunk for sort.
     Status update(RuntimeState* state, const ChunkPtr& chunk) override;
     Status done(RuntimeState* state) override;
     Status get_next(ChunkPtr* chunk, bool* eos) override;
 
+    // Only the in-memory runs are returned, the spilled runs can only be read by get_next().
     SortedRuns get_sorted_runs() override;
     size_t get_output_rows() const override;
 
@@ -44,12 +53,33 @@ private:
     Status _partial_sort(RuntimeState* state, bool done);
     Status _merge_sorted(RuntimeState* state);
 
+    // Merge the partially sorted chunks into a sorted run, and write it to a spill file.
+    Status _spill_sorted_chunks(RuntimeState* state);
+    // Merge the spilled runs and the in-memory run by cursors.
+    Status _init_spilled_runs_merger();
+    Status _get_next_from_spilled_runs(ChunkPtr* chunk, bool* eos);
+
     size_t _total_rows = 0;               // Total rows of sorting data
     Permutation _sort_permutation;        // Temp permutation for sorting
     ChunkPtr _unsorted_chunk;             // Unsorted chunk, accumulate it to a larger chunk
     std::vector<ChunkPtr> _sorted_chunks; // Partial sorted, but not merged
     SortedRuns _merged_runs;              // After merge
 
+    bool _spill_enabled = false;
+    size_t _spilled_rows = 0;
+    // Outlives _spilled_runs.
+    std::unique_ptr<spill::SpillIOCounters> _spill_io_counters;
+    std::vector<std::unique_ptr<spill::SpillFile>> _spilled_runs;
+    MergeCursorsCascade _spilled_runs_merger;
+    ChunkSlice _merged_chunk;
+    // The error met when reading the spilled runs in the cursors of _spilled_runs_merger.
+    Status _spill_status;
+
+    RuntimeProfile::Counter* _spill_timer = nullptr;
+    RuntimeProfile::Counter* _spilled_rows_counter = nullptr;
+    RuntimeProfile::Counter* _spilled_bytes_counter = nullptr;
+    RuntimeProfile::Counter* _spilled_runs_counter = nullptr;
+
     // TODO: further tunning the buffer parameter
     static constexpr size_t kMaxBufferedChunkSize = 1024000;   // Max buffer 1024000 rows
     static constexpr size_t kMaxBufferedChunkBytes = 16 << 20; // Max buffer 16MB bytes
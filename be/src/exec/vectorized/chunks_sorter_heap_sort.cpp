@@ -94,6 +94,10 @@ Status ChunksSorterHeapSort::update(RuntimeState* state, const ChunkPtr& chunk)
             }
         }
     }
+    if (_sort_heap->size() == _number_of_rows_to_sort()) {
+        const auto& top_cursor = _sort_heap->top();
+        _update_topn_runtime_filter(top_cursor.data_segment()->order_by_columns[0], top_cursor.row_id());
+    }
     // TODO: merge chunk if necessary
     return Status::OK();
 }
@@ -334,6 +334,10 @@ Status ChunksSorterTopn::_merge_sort_data_as_merged_segment(RuntimeState* state,
         RETURN_IF_ERROR(_hybrid_sort_first_time(state, new_permutation.second, segments));
         _init_merged_segment = true;
     }
+    size_t rows_to_sort = _get_number_of_rows_to_sort();
+    if (rows_to_sort > 0 && _merged_segment.chunk->num_rows() >= rows_to_sort) {
+        _update_topn_runtime_filter(_merged_segment.order_by_columns[0], rows_to_sort - 1);
+    }
 
     // Include release memory's time in _merge_timer.
     Permutation().swap(new_permutation.first);
@@ -523,13 +523,13 @@ Status ConnectorScanNode::close(RuntimeState* state) {
 }
 
 Status ConnectorScanNode::set_scan_ranges(const std::vector<TScanRangeParams>& scan_ranges) {
-    _scan_ranges = scan_ranges;
+    _scan_ranges = _data_source_provider->split_scan_ranges(scan_ranges);
     if (!accept_empty_scan_ranges() && scan_ranges.size() == 0) {
         // If scan ranges size is zero,
         // it means data source provider does not support reading by scan ranges.
-        // So here we insert a single placeholder, to force data source provider
+        // So here we insert the placeholders, to force data source provider
         // to create at least one data source
-        _scan_ranges.emplace_back(TScanRangeParams());
+        _scan_ranges = placeholder_scan_ranges();
     }
     return Status::OK();
 }
@@ -538,6 +538,18 @@ bool ConnectorScanNode::accept_empty_scan_ranges() const {
     return _data_source_provider->accept_empty_scan_ranges();
 }
 
+std::vector<TScanRangeParams> ConnectorScanNode::placeholder_scan_ranges() const {
+    return _data_source_provider->placeholder_scan_ranges();
+}
+
+StatusOr<pipeline::MorselQueuePtr> ConnectorScanNode::convert_scan_range_to_morsel_queue(
+        const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
+        bool enable_tablet_internal_parallel, size_t num_total_scan_ranges) {
+    return ScanNode::convert_scan_range_to_morsel_queue(_data_source_provider->split_scan_ranges(scan_ranges),
+                                                        node_id, pipeline_dop, enable_tablet_internal_parallel,
+                                                        num_total_scan_ranges);
+}
+
 void ConnectorScanNode::_init_counter() {
     _profile.scanner_queue_timer = ADD_TIMER(_runtime_profile, "ScannerQueueTime");
     _profile.scanner_queue_counter = ADD_COUNTER(_runtime_profile, "ScannerQueueCounter", TUnit::UNIT);
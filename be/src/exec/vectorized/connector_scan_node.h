@@ -28,6 +28,10 @@ public:
     Status close(RuntimeState* state) override;
     Status set_scan_ranges(const std::vector<TScanRangeParams>& scan_ranges) override;
     bool accept_empty_scan_ranges() const override;
+    std::vector<TScanRangeParams> placeholder_scan_ranges() const override;
+    StatusOr<pipeline::MorselQueuePtr> convert_scan_range_to_morsel_queue(
+            const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
+            bool enable_tablet_internal_parallel, size_t num_total_scan_ranges) override;
 
     // for pipline APIs
     std::vector<std::shared_ptr<pipeline::OperatorFactory>> decompose_to_pipeline(
@@ -138,16 +138,24 @@ StatusOr<ChunkPtr> CSVScanner::get_next() {
                 return st;
             }
 
+            // The range before reads the records starting at or before |start_offset|. If |start_offset| is
+            // in the middle of a multi-byte record delimiter, the first record found from |start_offset|
+            // ends at the next delimiter, and the record following the delimiter at |start_offset| is lost.
+            // So start |record delimiter length - 1| bytes earlier, the delimiter of the first record found
+            // from there, which is skipped, always ends after |start_offset|.
+            int64_t backoff = 0;
+            if (range_desc.start_offset > 0) {
+                backoff = std::min<int64_t>(range_desc.start_offset, _record_delimiter.size() - 1);
+            }
             _curr_reader = std::make_unique<ScannerCSVReader>(file, _record_delimiter, _field_delimiter);
             _curr_reader->set_counter(_counter);
-            if (_scan_range.ranges[_curr_file_index].size > 0 &&
-                _scan_range.ranges[_curr_file_index].format_type == TFileFormatType::FORMAT_CSV_PLAIN) {
+            if (range_desc.size > 0 && range_desc.format_type == TFileFormatType::FORMAT_CSV_PLAIN) {
                 // Does not set limit for compressed file.
-                _curr_reader->set_limit(_scan_range.ranges[_curr_file_index].size);
+                _curr_reader->set_limit(range_desc.size + backoff);
             }
-            if (_scan_range.ranges[_curr_file_index].start_offset > 0) {
-                // Skip the first record started from |start_offset|.
-                auto status = file->skip(_scan_range.ranges[_curr_file_index].start_offset);
+            if (range_desc.start_offset > 0) {
+                // Skip the first record started from |start_offset - backoff|.
+                auto status = file->skip(range_desc.start_offset - backoff);
                 if (status.is_time_out()) {
                     // open this file next time
                     --_curr_file_index;
@@ -191,7 +199,6 @@ Status CSVScanner::_parse_csv(Chunk* chunk) {
     DCHECK_EQ(0, chunk->num_rows());
     Status status;
     CSVReader::Record record;
-    CSVReader::Fields fields;
 
     int num_columns = chunk->num_columns();
     _column_raw_ptrs.resize(num_columns);
@@ -199,63 +206,99 @@ Status CSVScanner::_parse_csv(Chunk* chunk) {
         _column_raw_ptrs[i] = chunk->get_column_by_index(i).get();
     }
 
-    csv::Converter::Options options{.invalid_field_as_null = !_strict_mode};
-
-    for (size_t num_rows = chunk->num_rows(); num_rows < capacity; /**/) {
-        status = _curr_reader->next_record(&record);
-        if (status.is_end_of_file()) {
-            break;
-        } else if (!status.ok()) {
-            return status;
-        } else if (record.empty()) {
+    _records.clear();
+    _fields.clear();
+    while (chunk->num_rows() + _records.size() < capacity) {
+        if (!_curr_reader->next_buffered_record(&record)) {
+            // next_record() may move the data in the buffer, so convert the records read first.
+            _convert_records(chunk);
+            status = _curr_reader->next_record(&record);
+            if (status.is_end_of_file()) {
+                break;
+            } else if (!status.ok()) {
+                return status;
+            }
+        }
+        if (record.empty()) {
             // always skip blank lines.
             continue;
         }
 
-        fields.clear();
-        _curr_reader->split_record(record, &fields);
+        size_t num_fields = _fields.size();
+        _curr_reader->split_record(record, &_fields);
 
-        if (fields.size() != _num_fields_in_csv) {
+        if (_fields.size() - num_fields != _num_fields_in_csv) {
             if (_counter->num_rows_filtered++ < 50) {
                 std::stringstream error_msg;
                 error_msg << "Value count does not match column count. "
-                          << "Expect " << _num_fields_in_csv << ", but got " << fields.size();
+                          << "Expect " << _num_fields_in_csv << ", but got " << _fields.size() - num_fields;
                 _report_error(record.to_string(), error_msg.str());
             }
+            _fields.resize(num_fields);
             continue;
         }
         if (!validate_utf8(record.data, record.size)) {
             if (_counter->num_rows_filtered++ < 50) {
                 _report_error(record.to_string(), "Invalid UTF-8 row");
             }
+            _fields.resize(num_fields);
             continue;
         }
+        _records.emplace_back(record);
+    }
+    _convert_records(chunk);
+    return chunk->num_rows() > 0 ? Status::OK() : Status::EndOfFile("");
+}
 
-        SCOPED_RAW_TIMER(&_counter->fill_ns);
-        bool has_error = false;
-        for (int j = 0, k = 0; j < _num_fields_in_csv; j++) {
-            auto slot = _src_slot_descriptors[j];
-            if (slot == nullptr) {
+void CSVScanner::_convert_records(Chunk* chunk) {
+    const size_t n = _records.size();
+    if (n == 0) {
+        return;
+    }
+    SCOPED_RAW_TIMER(&_counter->fill_ns);
+    const size_t num_rows = chunk->num_rows();
+    csv::Converter::Options options{.invalid_field_as_null = !_strict_mode};
+    _invalid_rows.assign(n, 0);
+    size_t num_invalid_rows = 0;
+    for (int j = 0, k = 0; j < _num_fields_in_csv; j++) {
+        auto slot = _src_slot_descriptors[j];
+        if (slot == nullptr) {
+            continue;
+        }
+        options.type_desc = &(slot->type());
+        _column_invalids.assign(n, 0);
+        size_t num_invalids = _converters[k]->read_strings(_column_raw_ptrs[k], &_fields[j], _num_fields_in_csv, n,
+                                                           options, _column_invalids.data());
+        for (size_t i = 0; num_invalids > 0 && i < n; i++) {
+            if (!_column_invalids[i]) {
                 continue;
             }
-            const Slice& field = fields[j];
-            options.type_desc = &(slot->type());
-            if (!_converters[k]->read_string(_column_raw_ptrs[k], field, options)) {
-                chunk->set_num_rows(num_rows);
-                if (_counter->num_rows_filtered++ < 50) {
-                    std::stringstream error_msg;
-                    error_msg << "Value '" << field.to_string() << "' is out of range. "
-                              << "The type of '" << slot->col_name() << "' is " << slot->type().debug_string();
-                    _report_error(record.to_string(), error_msg.str());
-                }
-                has_error = true;
-                break;
+            num_invalids--;
+            // Only the first invalid field of a row is reported.
+            if (_invalid_rows[i]) {
+                continue;
+            }
+            _invalid_rows[i] = 1;
+            num_invalid_rows++;
+            if (_counter->num_rows_filtered++ < 50) {
+                const Slice& field = _fields[i * _num_fields_in_csv + j];
+                std::stringstream error_msg;
+                error_msg << "Value '" << field.to_string() << "' is out of range. "
+                          << "The type of '" << slot->col_name() << "' is " << slot->type().debug_string();
+                _report_error(_records[i].to_string(), error_msg.str());
             }
-            k++;
         }
-        num_rows += !has_error;
+        k++;
     }
-    return chunk->num_rows() > 0 ? Status::OK() : Status::EndOfFile("");
+    if (num_invalid_rows > 0) {
+        Filter filter(num_rows + n, 1);
+        for (size_t i = 0; i < n; i++) {
+            filter[num_rows + i] = !_invalid_rows[i];
+        }
+        chunk->filter(filter);
+    }
+    _records.clear();
+    _fields.clear();
 }
 
 ChunkPtr CSVScanner::_create_chunk(const std::vector<SlotDescriptor*>& slots) {
@@ -50,6 +50,9 @@ private:
     ChunkPtr _create_chunk(const std::vector<SlotDescriptor*>& slots);
 
     Status _parse_csv(Chunk* chunk);
+    // Convert the fields of |_records| to the columns of |chunk| column by column, the rows of the invalid
+    // fields are removed. |_records| and |_fields| are cleared.
+    void _convert_records(Chunk* chunk);
     StatusOr<ChunkPtr> _materialize(ChunkPtr& src_chunk);
     void _report_error(const std::string& line, const std::string& err_msg);
 
@@ -64,6 +67,12 @@ private:
     int _curr_file_index = -1;
     CSVReaderPtr _curr_reader;
     std::vector<ConverterPtr> _converters;
+    // The records in the buffer of |_curr_reader| to convert.
+    std::vector<CSVReader::Record> _records;
+    // The fields of |_records|, |_num_fields_in_csv| fields per record.
+    CSVReader::Fields _fields;
+    std::vector<uint8_t> _invalid_rows;
+    std::vector<uint8_t> _column_invalids;
 };
 
 } // namespace starrocks::vectorized
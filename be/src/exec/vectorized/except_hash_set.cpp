@@ -26,9 +26,14 @@ void ExceptHashSet<HashSet>::build_set(RuntimeState* state, const ChunkPtr& chun
     for (size_t i = 0; i < chunk_size; ++i) {
         ExceptSliceFlag key(_buffer + i * _max_one_row_size, _slice_sizes[i]);
         _hash_set->lazy_emplace(key, [&](const auto& ctor) {
-            uint8_t* pos = pool->allocate(key.slice.size);
-            memcpy(pos, key.slice.data, key.slice.size);
-            ctor(pos, key.slice.size);
+            // The inline key is copied with the flag, the others are persisted before inserted.
+            if (key.key.is_inline()) {
+                ctor(key);
+                return;
+            }
+            uint8_t* pos = pool->allocate(key.key.size());
+            memcpy(pos, key.key.data(), key.key.size());
+            ctor(pos, key.key.size());
         });
     }
 }
@@ -4,6 +4,7 @@
 
 #include "column/chunk.h"
 #include "column/column_hash.h"
+#include "column/hash_set.h"
 #include "exprs/expr_context.h"
 #include "runtime/mem_pool.h"
 #include "util/phmap/phmap.h"
@@ -18,24 +19,20 @@ struct ExceptSliceFlagHash;
 
 class ExceptSliceFlag {
 public:
-    ExceptSliceFlag(const uint8_t* d, size_t n) : slice(d, n), deleted(false) {}
+    ExceptSliceFlag(const uint8_t* d, size_t n) : key(d, n), deleted(false) {}
 
-    Slice slice;
+    // The serialized key, the key of the fixed size columns is kept inline.
+    InlinableSlice key;
     mutable bool deleted;
 };
 
 struct ExceptSliceFlagEqual {
-    bool operator()(const ExceptSliceFlag& x, const ExceptSliceFlag& y) const {
-        return memequal(x.slice.data, x.slice.size, y.slice.data, y.slice.size);
-    }
+    bool operator()(const ExceptSliceFlag& x, const ExceptSliceFlag& y) const { return x.key == y.key; }
 };
 
 struct ExceptSliceFlagHash {
     static const uint32_t CRC_SEED = 0x811C9DC5;
-    std::size_t operator()(const ExceptSliceFlag& sliceMayUnneed) const {
-        const Slice& slice = sliceMayUnneed.slice;
-        return crc_hash_64(slice.data, slice.size, CRC_SEED);
-    }
+    std::size_t operator()(const ExceptSliceFlag& flag) const { return flag.key.hash(CRC_SEED); }
 };
 
 template <typename HashSet>
@@ -6,6 +6,7 @@
 #include <sstream>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exec/vectorized/csv_scanner.h"
 #include "exec/vectorized/json_scanner.h"
 #include "exec/vectorized/orc_scanner.h"
@@ -14,7 +15,9 @@
 #include "fs/fs.h"
 #include "fs/fs_broker.h"
 #include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "runtime/stream_load/load_stream_mgr.h"
 #include "util/defer_op.h"
 #include "util/runtime_profile.h"
 #include "util/thread.h"
@@ -78,13 +81,84 @@ Status FileScanNode::_start_scanners() {
     {
         std::unique_lock<std::mutex> l(_chunk_queue_lock);
 
-        _num_running_scanners = 1;
-        _scanner_threads.emplace_back(&FileScanNode::_scanner_worker, this, 0, _scan_ranges.size());
-        Thread::set_thread_name(_scanner_threads.back(), "file_scanner");
+        _split_scan_ranges();
+        int num_scanners = std::min<int>(config::file_scan_max_scanner_num, _scan_ranges.size());
+        num_scanners = std::max(1, num_scanners);
+        _num_running_scanners = num_scanners;
+        for (int i = 0; i < num_scanners; i++) {
+            _scanner_threads.emplace_back(&FileScanNode::_scanner_worker, this);
+            Thread::set_thread_name(_scanner_threads.back(), "file_scanner");
+        }
     }
     return Status::OK();
 }
 
+void FileScanNode::_split_scan_ranges() {
+    const int64_t split_size = config::file_scan_csv_split_size;
+    if (split_size <= 0 && !config::enable_stream_load_parallel_scan) {
+        return;
+    }
+    std::vector<TScanRangeParams> scan_ranges;
+    for (auto& scan_range : _scan_ranges) {
+        auto& broker_scan_range = scan_range.scan_range.broker_scan_range;
+        if (config::enable_stream_load_parallel_scan && _split_stream_scan_range(scan_range, &scan_ranges)) {
+            continue;
+        }
+        if (split_size <= 0) {
+            scan_ranges.emplace_back(std::move(scan_range));
+            continue;
+        }
+        std::vector<TBrokerRangeDesc> ranges;
+        ranges.swap(broker_scan_range.ranges);
+        for (auto& range : ranges) {
+            // the size of the range of a stream is -1.
+            if (range.format_type != TFileFormatType::FORMAT_CSV_PLAIN || !range.splittable ||
+                range.file_type == TFileType::FILE_STREAM || range.size < 2 * split_size) {
+                broker_scan_range.ranges.emplace_back(std::move(range));
+                continue;
+            }
+            // The CSVScanner of a range skips the record across its start and reads the record across its end.
+            for (int64_t offset = 0; offset < range.size; offset += split_size) {
+                TScanRangeParams split(scan_range);
+                split.scan_range.broker_scan_range.ranges = {range};
+                auto& split_range = split.scan_range.broker_scan_range.ranges.back();
+                split_range.start_offset = range.start_offset + offset;
+                split_range.size = std::min(split_size, range.size - offset);
+                scan_ranges.emplace_back(std::move(split));
+            }
+        }
+        if (!broker_scan_range.ranges.empty()) {
+            scan_ranges.emplace_back(std::move(scan_range));
+        }
+    }
+    _scan_ranges.swap(scan_ranges);
+}
+
+bool FileScanNode::_split_stream_scan_range(const TScanRangeParams& scan_range,
+                                            std::vector<TScanRangeParams>* scan_ranges) {
+    const auto& broker_scan_range = scan_range.scan_range.broker_scan_range;
+    const auto& params = broker_scan_range.params;
+    if (broker_scan_range.ranges.size() != 1 || (params.__isset.non_blocking_read && params.non_blocking_read) ||
+        (params.__isset.multi_row_delimiter && params.multi_row_delimiter.size() != 1)) {
+        return false;
+    }
+    const auto& range = broker_scan_range.ranges[0];
+    if (range.file_type != TFileType::FILE_STREAM || range.format_type != TFileFormatType::FORMAT_CSV_PLAIN) {
+        return false;
+    }
+    auto pipe = runtime_state()->exec_env()->load_stream_mgr()->get(range.load_id);
+    if (pipe == nullptr) {
+        return false;
+    }
+    // Each scanner reads whole records from the pipe and parses them.
+    char row_delimiter = params.__isset.multi_row_delimiter ? params.multi_row_delimiter[0] : params.row_delimiter;
+    pipe->set_record_delimiter(row_delimiter);
+    for (int i = 0; i < std::max(1, config::file_scan_max_scanner_num); i++) {
+        scan_ranges->emplace_back(scan_range);
+    }
+    return true;
+}
+
 Status FileScanNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
     SCOPED_TIMER(_runtime_profile->total_time_counter());
     // check if CANCELLED.
@@ -268,7 +342,7 @@ Status FileScanNode::_scanner_scan(const TBrokerScanRange& scan_range, const std
     return Status::OK();
 }
 
-void FileScanNode::_scanner_worker(int start_idx, int length) {
+void FileScanNode::_scanner_worker() {
     SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(runtime_state()->instance_mem_tracker());
 
     // Clone expr context
@@ -280,8 +354,8 @@ void FileScanNode::_scanner_worker(int start_idx, int length) {
         LOG(WARNING) << "Clone conjuncts failed.";
     } else {
         ScannerCounter counter;
-        for (int i = 0; i < length; ++i) {
-            const TBrokerScanRange& scan_range = _scan_ranges[start_idx + i].scan_range.broker_scan_range;
+        for (size_t i = _next_scan_range++; i < _scan_ranges.size(); i = _next_scan_range++) {
+            const TBrokerScanRange& scan_range = _scan_ranges[i].scan_range.broker_scan_range;
 
             // remove range desc with empty file
             TBrokerScanRange new_scan_range(scan_range);
@@ -298,8 +372,7 @@ void FileScanNode::_scanner_worker(int start_idx, int length) {
 
             // todo: break if failed ?
             if (!status.ok() && !status.is_end_of_file()) {
-                LOG(WARNING) << "FileScanner[" << start_idx + i
-                             << "] process failed. status=" << status.get_error_msg();
+                LOG(WARNING) << "FileScanner[" << i << "] process failed. status=" << status.get_error_msg();
                 break;
             }
         }
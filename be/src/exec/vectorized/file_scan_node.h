@@ -61,8 +61,15 @@ private:
     // Create scanners to do scan job
     Status _start_scanners();
 
-    // One scanner worker, This scanner will handle 'length' ranges start from start_idx
-    void _scanner_worker(int start_idx, int length);
+    // Split the large plain CSV files of |_scan_ranges| into ranges of file_scan_csv_split_size, so that
+    // one file is scanned by several scanners.
+    void _split_scan_ranges();
+    // Copy the scan range of a csv stream load to |scan_ranges| for each scanner, which parse the records of
+    // the stream concurrently. Return false if the scan range is not such one.
+    bool _split_stream_scan_range(const TScanRangeParams& scan_range, std::vector<TScanRangeParams>* scan_ranges);
+
+    // One scanner worker, This scanner will handle the ranges not taken by other scanners
+    void _scanner_worker();
 
     // Scan one range
     Status _scanner_scan(const TBrokerScanRange& scan_range, const std::vector<ExprContext*>& conjunct_ctxs,
@@ -73,6 +80,8 @@ private:
     TupleId _tuple_id;
     TupleDescriptor* _tuple_desc = nullptr;
     std::vector<TScanRangeParams> _scan_ranges;
+    // The index of the next range in |_scan_ranges| to scan
+    std::atomic<size_t> _next_scan_range{0};
 
     std::mutex _chunk_queue_lock;
     std::condition_variable _queue_reader_cond;
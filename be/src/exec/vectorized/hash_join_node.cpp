@@ -144,6 +144,7 @@ Status HashJoinNode::prepare(RuntimeState* state) {
     _where_conjunct_evaluate_timer = ADD_CHILD_TIMER(_runtime_profile, "8-WhereConjunctEvaluateTime", "ProbeTime");
 
     _probe_rows_counter = ADD_COUNTER(_runtime_profile, "ProbeRows", TUnit::UNIT);
+    _prefetch_probe_rows = ADD_COUNTER(_runtime_profile, "PrefetchProbeRows", TUnit::UNIT);
     _build_rows_counter = ADD_COUNTER(_runtime_profile, "BuildRows", TUnit::UNIT);
     _build_buckets_counter = ADD_COUNTER(_runtime_profile, "BuildBuckets", TUnit::UNIT);
     _push_down_expr_num = ADD_COUNTER(_runtime_profile, "PushDownExprNum", TUnit::UNIT);
@@ -176,6 +177,7 @@ void HashJoinNode::_init_hash_table_param(HashTableParam* param) {
     param->output_build_column_timer = _output_build_column_timer;
     param->output_probe_column_timer = _output_probe_column_timer;
     param->output_tuple_column_timer = _output_tuple_column_timer;
+    param->prefetch_probe_rows = _prefetch_probe_rows;
 
     param->output_slots = _output_slots;
     std::set<SlotId> predicate_slots;
@@ -4,11 +4,14 @@
 
 #include <runtime/runtime_state.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
+#include "exec/spill/spill_util.h"
 #include "exprs/expr.h"
 #include "exprs/vectorized/column_ref.h"
 #include "exprs/vectorized/in_const_predicate.hpp"
@@ -19,12 +22,14 @@
 #include "simd/simd.h"
 #include "util/debug_util.h"
 #include "util/runtime_profile.h"
+#include "util/uid_util.h"
 
 namespace starrocks::vectorized {
 
 HashJoiner::HashJoiner(const HashJoinerParam& param, const std::vector<HashJoinerPtr>& read_only_join_probers)
         : _hash_join_node(param._hash_join_node),
           _pool(param._pool),
+          _node_id(param._node_id),
           _join_type(param._hash_join_node.join_op),
           _is_null_safes(param._is_null_safes),
           _build_expr_ctxs(param._build_expr_ctxs),
@@ -73,8 +78,27 @@ Status HashJoiner::prepare_builder(RuntimeState* state, RuntimeProfile* runtime_
     _build_runtime_filter_timer = ADD_TIMER(runtime_profile, "RuntimeFilterBuildTime");
     _build_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "BuildConjunctEvaluateTime");
     _build_buckets_counter = ADD_COUNTER(runtime_profile, "BuildBuckets", TUnit::UNIT);
+    _heavy_hitter_keys_counter = ADD_COUNTER(runtime_profile, "HeavyHitterKeys", TUnit::UNIT);
+    _heavy_hitter_build_rows_counter = ADD_COUNTER(runtime_profile, "HeavyHitterBuildRows", TUnit::UNIT);
+    _build_runtime_profile = runtime_profile;
     _runtime_filter_num = ADD_COUNTER(runtime_profile, "RuntimeFilterNum", TUnit::UNIT);
 
+    // The read-only probers of broadcast join share the hash table of the builder, so it can't be spilled.
+    // For null-aware left anti join, a null in any part of the right table affects all the left rows.
+    _spill_enabled = state->enable_spill() && _read_only_join_probers.empty() &&
+                     _hash_join_node.distribution_mode != TJoinDistributionMode::BROADCAST &&
+                     _join_type != TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN;
+    if (_spill_enabled) {
+        _spill_label = strings::Substitute("join_$0", _node_id);
+        _spill_timer = ADD_TIMER(runtime_profile, "SpillTime");
+        _spill_restore_timer = ADD_TIMER(runtime_profile, "SpillRestoreTime");
+        _spilled_build_rows_counter = ADD_COUNTER(runtime_profile, "SpilledBuildRows", TUnit::UNIT);
+        _spilled_probe_rows_counter = ADD_COUNTER(runtime_profile, "SpilledProbeRows", TUnit::UNIT);
+        _spilled_bytes_counter = ADD_COUNTER(runtime_profile, "SpilledBytes", TUnit::BYTES);
+        _spilled_partitions_counter = ADD_COUNTER(runtime_profile, "SpilledPartitions", TUnit::UNIT);
+        _spill_io_counters = std::make_unique<spill::SpillIOCounters>(runtime_profile);
+    }
+
     HashTableParam param;
     _init_hash_table_param(&param);
     _ht.create(param);
@@ -99,6 +123,7 @@ Status HashJoiner::prepare_prober(RuntimeState* state, RuntimeProfile* runtime_p
     _output_build_column_timer = ADD_TIMER(runtime_profile, "OutputBuildColumnTime");
     _output_probe_column_timer = ADD_TIMER(runtime_profile, "OutputProbeColumnTime");
     _output_tuple_column_timer = ADD_TIMER(runtime_profile, "OutputTupleColumnTime");
+    _prefetch_probe_rows = ADD_COUNTER(runtime_profile, "PrefetchProbeRows", TUnit::UNIT);
     _probe_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "ProbeConjunctEvaluateTime");
     _other_join_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "OtherJoinConjunctEvaluateTime");
     _where_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "WhereConjunctEvaluateTime");
@@ -118,6 +143,7 @@ void HashJoiner::_init_hash_table_param(HashTableParam* param) {
     param->output_build_column_timer = _output_build_column_timer;
     param->output_probe_column_timer = _output_probe_column_timer;
     param->output_tuple_column_timer = _output_tuple_column_timer;
+    param->prefetch_probe_rows = _prefetch_probe_rows;
 
     param->output_slots = _output_slots;
     std::set<SlotId> predicate_slots;
@@ -149,25 +175,37 @@ Status HashJoiner::append_chunk_to_ht(RuntimeState* state, const ChunkPtr& chunk
     if (!chunk || chunk->is_empty()) {
         return Status::OK();
     }
-    if (UNLIKELY(_ht.get_row_count() + chunk->num_rows() >= UINT32_MAX)) {
+    if (UNLIKELY(!_spilled && _ht.get_row_count() + chunk->num_rows() >= UINT32_MAX)) {
         return Status::NotSupported(strings::Substitute("row count of right table in hash join > $0", UINT32_MAX));
     }
     {
         SCOPED_TIMER(_build_conjunct_evaluate_timer);
         _prepare_key_columns(_key_columns, chunk, _build_expr_ctxs);
     }
+    if (_spilled) {
+        return _spill_build_chunk(chunk, _key_columns);
+    }
     {
         // copy chunk of right table
         SCOPED_TIMER(_copy_right_table_chunk_timer);
         TRY_CATCH_BAD_ALLOC(_ht.append_chunk(state, chunk, _key_columns));
     }
+    if (_spill_enabled && spill::reach_spill_mem_threshold(state->instance_mem_tracker())) {
+        _spilled = true;
+        RETURN_IF_ERROR(_spill_hash_table(state, 0));
+    }
     return Status::OK();
 }
 
 Status HashJoiner::build_ht(RuntimeState* state) {
     if (_phase == HashJoinPhase::BUILD) {
+        if (_spilled) {
+            // The hash table of each partition is built after all the left rows are spilled too.
+            return _finish_spiller(_build_spiller, &_spilled_build_files);
+        }
         RETURN_IF_ERROR(_build(state));
         COUNTER_SET(_build_buckets_counter, static_cast<int64_t>(_ht.get_bucket_size()));
+        _report_heavy_hitters(state);
     }
 
     return Status::OK();
@@ -197,17 +235,25 @@ bool HashJoiner::has_output() const {
     return false;
 }
 
-void HashJoiner::push_chunk(RuntimeState* state, ChunkPtr&& chunk) {
+Status HashJoiner::push_chunk(RuntimeState* state, ChunkPtr&& chunk) {
     DCHECK(chunk && !chunk->is_empty());
     DCHECK(!_probe_input_chunk);
 
+    if (_spilled) {
+        return _spill_probe_chunk(state, chunk);
+    }
+
     _probe_input_chunk = std::move(chunk);
     _ht_has_remain = true;
     _prepare_probe_key_columns();
+    return Status::OK();
 }
 
 StatusOr<ChunkPtr> HashJoiner::pull_chunk(RuntimeState* state) {
     DCHECK(_phase != HashJoinPhase::BUILD);
+    if (_spilled && _phase == HashJoinPhase::POST_PROBE) {
+        return _pull_spilled_output_chunk(state);
+    }
     return _pull_probe_output_chunk(state);
 }
 
@@ -218,15 +264,7 @@ StatusOr<ChunkPtr> HashJoiner::_pull_probe_output_chunk(RuntimeState* state) {
 
     if (_phase == HashJoinPhase::PROBE || _probe_input_chunk != nullptr) {
         DCHECK(_ht_has_remain && _probe_input_chunk);
-
-        TRY_CATCH_BAD_ALLOC(
-                RETURN_IF_ERROR(_ht.probe(state, _key_columns, &_probe_input_chunk, &chunk, &_ht_has_remain)));
-        if (!_ht_has_remain) {
-            _probe_input_chunk = nullptr;
-        }
-
-        RETURN_IF_ERROR(_filter_probe_output_chunk(chunk));
-
+        RETURN_IF_ERROR(_probe_input(state, &chunk));
         return chunk;
     }
 
@@ -236,21 +274,36 @@ StatusOr<ChunkPtr> HashJoiner::_pull_probe_output_chunk(RuntimeState* state) {
             return chunk;
         }
 
-        TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_ht.probe_remain(state, &chunk, &_ht_has_remain)));
+        RETURN_IF_ERROR(_probe_remain(state, &chunk));
         if (!_ht_has_remain) {
             enter_eos_phase();
         }
-
-        RETURN_IF_ERROR(_filter_post_probe_output_chunk(chunk));
-
         return chunk;
     }
 
     return chunk;
 }
 
+Status HashJoiner::_probe_input(RuntimeState* state, ChunkPtr* chunk) {
+    TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_ht.probe(state, _key_columns, &_probe_input_chunk, chunk, &_ht_has_remain)));
+    if (!_ht_has_remain) {
+        _probe_input_chunk = nullptr;
+    }
+    return _filter_probe_output_chunk(*chunk);
+}
+
+Status HashJoiner::_probe_remain(RuntimeState* state, ChunkPtr* chunk) {
+    TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_ht.probe_remain(state, chunk, &_ht_has_remain)));
+    return _filter_post_probe_output_chunk(*chunk);
+}
+
 void HashJoiner::close(RuntimeState* state) {
     _ht.close();
+    _build_spiller.reset();
+    _probe_spiller.reset();
+    _spilled_build_files.clear();
+    _spilled_partitions.clear();
+    _restoring_partition = SpilledPartitionPair();
 }
 
 Status HashJoiner::create_runtime_filters(RuntimeState* state) {
@@ -266,7 +319,7 @@ Status HashJoiner::create_runtime_filters(RuntimeState* state) {
     if (_is_push_down) {
         if (_probe_node_type == TPlanNodeType::EXCHANGE_NODE && _build_node_type == TPlanNodeType::EXCHANGE_NODE) {
             _is_push_down = false;
-        } else if (_ht.get_row_count() > runtime_join_filter_pushdown_limit) {
+        } else if (get_ht_row_count() > runtime_join_filter_pushdown_limit) {
             _is_push_down = false;
         }
 
@@ -285,7 +338,8 @@ Status HashJoiner::create_runtime_filters(RuntimeState* state) {
 
 void HashJoiner::reference_hash_table(HashJoiner* src_join_builder) {
     _ht = src_join_builder->_ht.clone_readable_table();
-    _ht.set_probe_profile(_search_ht_timer, _output_probe_column_timer, _output_tuple_column_timer);
+    _ht.set_probe_profile(_search_ht_timer, _output_probe_column_timer, _output_tuple_column_timer,
+                          _prefetch_probe_rows);
 
     _probe_column_count = src_join_builder->_probe_column_count;
     _build_column_count = src_join_builder->_build_column_count;
@@ -319,6 +373,302 @@ Status HashJoiner::_build(RuntimeState* state) {
     return Status::OK();
 }
 
+void HashJoiner::_report_heavy_hitters(RuntimeState* state) {
+    // At most this many heavy hitters are shown in the profile.
+    constexpr size_t kMaxHeavyHitters = 8;
+    double min_ratio = config::join_heavy_hitter_min_ratio;
+    size_t row_count = _ht.get_row_count();
+    if (min_ratio <= 0 || row_count < state->chunk_size()) {
+        return;
+    }
+    auto min_rows = static_cast<uint32_t>(std::max<double>(min_ratio * row_count, state->chunk_size()));
+    std::vector<JoinHeavyHitter> heavy_hitters = _ht.find_heavy_hitters(kMaxHeavyHitters, min_rows);
+    if (heavy_hitters.empty()) {
+        return;
+    }
+
+    // Each heavy hitter is shown as key:rows, e.g. "(1, abc):100000".
+    const Columns& key_columns = _ht.get_key_columns();
+    std::string keys;
+    int64_t num_rows = 0;
+    for (const auto& heavy_hitter : heavy_hitters) {
+        if (!keys.empty()) {
+            keys.append(", ");
+        }
+        keys.append(key_columns.size() > 1 ? "(" : "");
+        for (size_t i = 0; i < key_columns.size(); i++) {
+            keys.append(i > 0 ? ", " : "");
+            keys.append(key_columns[i]->debug_item(heavy_hitter.row));
+        }
+        keys.append(key_columns.size() > 1 ? ")" : "");
+        keys.append(":" + std::to_string(heavy_hitter.num_rows));
+        num_rows += heavy_hitter.num_rows;
+    }
+    COUNTER_SET(_heavy_hitter_keys_counter, static_cast<int64_t>(heavy_hitters.size()));
+    COUNTER_SET(_heavy_hitter_build_rows_counter, num_rows);
+    _build_runtime_profile->add_info_string("HeavyHitters", keys);
+}
+
+void HashJoiner::_reset_hash_table() {
+    _ht.close();
+    HashTableParam param;
+    _init_hash_table_param(&param);
+    _ht.create(param);
+}
+
+Status HashJoiner::_spill(spill::PartitionedSpiller* spiller, const ChunkPtr& chunk, const Columns& key_columns,
+                          RuntimeProfile::Counter* rows_counter) {
+    SCOPED_TIMER(_spill_timer);
+    int64_t old_bytes = spiller->spilled_bytes();
+    RETURN_IF_ERROR(spiller->spill(*chunk, key_columns, nullptr));
+    COUNTER_UPDATE(rows_counter, chunk->num_rows());
+    COUNTER_UPDATE(_spilled_bytes_counter, spiller->spilled_bytes() - old_bytes);
+    return Status::OK();
+}
+
+Status HashJoiner::_spill_build_chunk(const ChunkPtr& chunk, const Columns& key_columns) {
+    if (_phase == HashJoinPhase::BUILD) {
+        // Only the rows of the right table are counted, rather than the rows spilled again in POST_PROBE phase.
+        _spilled_build_rows += chunk->num_rows();
+        _append_spilled_rf_key_columns(key_columns);
+    }
+    return _spill(_build_spiller.get(), chunk, key_columns, _spilled_build_rows_counter);
+}
+
+Status HashJoiner::_spill_hash_table(RuntimeState* state, int level) {
+    DCHECK(_build_spiller == nullptr);
+    VLOG_QUERY << "Hash join " << _spill_label << " of " << print_id(state->fragment_instance_id())
+               << " start spilling right table at level " << level << ", hash table rows " << _ht.get_row_count()
+               << ", mem usage " << _ht.mem_usage();
+    _build_spiller = std::make_unique<spill::PartitionedSpiller>(
+            state, _spill_label + "_build", config::spill_partition_num, level, _spill_io_counters.get());
+    if (_phase == HashJoinPhase::BUILD) {
+        _spilled_rf_key_columns.assign(_build_expr_ctxs.size(), nullptr);
+        for (auto* rf_desc : _build_runtime_filters) {
+            if (!rf_desc->has_consumer()) {
+                continue;
+            }
+            int expr_order = rf_desc->build_expr_order();
+            if (_spilled_rf_key_columns[expr_order] == nullptr) {
+                auto column = ColumnHelper::create_column(_build_expr_ctxs[expr_order]->root()->type(), false);
+                column->append_default();
+                _spilled_rf_key_columns[expr_order] = std::move(column);
+            }
+        }
+    }
+
+    // Skip the reserved row of the hash table.
+    const ChunkPtr& build_chunk = _ht.get_build_chunk();
+    const size_t num_rows = _ht.get_row_count();
+    const size_t chunk_size = state->chunk_size();
+    Columns key_columns;
+    for (size_t offset = kHashJoinKeyColumnOffset; offset <= num_rows; offset += chunk_size) {
+        size_t count = std::min(chunk_size, num_rows + kHashJoinKeyColumnOffset - offset);
+        ChunkPtr chunk = build_chunk->clone_empty(count);
+        chunk->append(*build_chunk, offset, count);
+        _prepare_key_columns(key_columns, chunk, _build_expr_ctxs);
+        RETURN_IF_ERROR(_spill_build_chunk(chunk, key_columns));
+    }
+    _reset_hash_table();
+    return Status::OK();
+}
+
+void HashJoiner::_append_spilled_rf_key_columns(const Columns& key_columns) {
+    for (size_t i = 0; i < _spilled_rf_key_columns.size(); i++) {
+        auto& column = _spilled_rf_key_columns[i];
+        if (column == nullptr) {
+            continue;
+        }
+        if (!column->is_nullable() && key_columns[i]->is_nullable()) {
+            column = NullableColumn::create(column, NullColumn::create(column->size(), 0));
+        }
+        column->append(*key_columns[i]);
+    }
+}
+
+Status HashJoiner::_spill_probe_chunk(RuntimeState* state, const ChunkPtr& chunk) {
+    if (_probe_spiller == nullptr) {
+        _probe_spiller = std::make_unique<spill::PartitionedSpiller>(
+                state, _spill_label + "_probe", config::spill_partition_num, 0, _spill_io_counters.get());
+    }
+    {
+        SCOPED_TIMER(_probe_conjunct_evaluate_timer);
+        _prepare_key_columns(_key_columns, chunk, _probe_expr_ctxs);
+    }
+    return _spill(_probe_spiller.get(), chunk, _key_columns, _spilled_probe_rows_counter);
+}
+
+Status HashJoiner::_finish_spiller(std::unique_ptr<spill::PartitionedSpiller>& spiller,
+                                   std::vector<std::unique_ptr<spill::SpillFile>>* files) {
+    if (spiller == nullptr) {
+        return Status::OK();
+    }
+    SCOPED_TIMER(_spill_timer);
+    int64_t old_bytes = spiller->spilled_bytes();
+    ASSIGN_OR_RETURN(*files, spiller->finish());
+    COUNTER_UPDATE(_spilled_bytes_counter, spiller->spilled_bytes() - old_bytes);
+    spiller.reset();
+    return Status::OK();
+}
+
+Status HashJoiner::_add_spilled_partitions(int level) {
+    std::vector<std::unique_ptr<spill::SpillFile>> build_files = std::move(_spilled_build_files);
+    std::vector<std::unique_ptr<spill::SpillFile>> probe_files;
+    RETURN_IF_ERROR(_finish_spiller(_build_spiller, &build_files));
+    RETURN_IF_ERROR(_finish_spiller(_probe_spiller, &probe_files));
+
+    const size_t num_partitions = std::max(build_files.size(), probe_files.size());
+    build_files.resize(num_partitions);
+    probe_files.resize(num_partitions);
+    // Push the partitions to the front, so that a repartitioned partition is finished before the others.
+    for (size_t i = num_partitions; i > 0; i--) {
+        if (build_files[i - 1] == nullptr && probe_files[i - 1] == nullptr) {
+            continue;
+        }
+        _spilled_partitions.push_front({std::move(build_files[i - 1]), std::move(probe_files[i - 1]), level});
+        COUNTER_UPDATE(_spilled_partitions_counter, 1);
+    }
+    return Status::OK();
+}
+
+StatusOr<ChunkPtr> HashJoiner::_pull_spilled_output_chunk(RuntimeState* state) {
+    auto chunk = std::make_shared<Chunk>();
+    if (!_spilled_partitions_ready) {
+        RETURN_IF_ERROR(_add_spilled_partitions(0));
+        _spilled_partitions_ready = true;
+        return chunk;
+    }
+
+    switch (_spill_stage) {
+    case SpillStage::NEXT_PARTITION:
+        RETURN_IF_ERROR(_next_spilled_partition(state));
+        break;
+    case SpillStage::LOAD_BUILD:
+        RETURN_IF_ERROR(_load_spilled_build_chunk(state));
+        break;
+    case SpillStage::REPARTITION_PROBE:
+        RETURN_IF_ERROR(_repartition_spilled_probe_chunk(state));
+        break;
+    case SpillStage::PROBE:
+        if (_probe_input_chunk == nullptr) {
+            RETURN_IF_ERROR(_read_spilled_probe_chunk(state));
+        }
+        if (_probe_input_chunk != nullptr) {
+            RETURN_IF_ERROR(_probe_input(state, &chunk));
+        }
+        break;
+    case SpillStage::PROBE_REMAIN:
+        if (_need_post_probe()) {
+            RETURN_IF_ERROR(_probe_remain(state, &chunk));
+        } else {
+            _ht_has_remain = false;
+        }
+        if (!_ht_has_remain) {
+            _restoring_partition = SpilledPartitionPair();
+            _spill_stage = SpillStage::NEXT_PARTITION;
+        }
+        break;
+    }
+    return chunk;
+}
+
+Status HashJoiner::_next_spilled_partition(RuntimeState* state) {
+    while (!_spilled_partitions.empty()) {
+        auto partition = std::move(_spilled_partitions.front());
+        _spilled_partitions.pop_front();
+        // The same cases as the short-circuit break, or any join type without post probe has nothing to output
+        // without left rows.
+        if (partition.build_file == nullptr &&
+            (_join_type == TJoinOp::INNER_JOIN || _join_type == TJoinOp::LEFT_SEMI_JOIN ||
+             _join_type == TJoinOp::RIGHT_SEMI_JOIN || _join_type == TJoinOp::RIGHT_ANTI_JOIN ||
+             _join_type == TJoinOp::RIGHT_OUTER_JOIN)) {
+            continue;
+        }
+        if (partition.probe_file == nullptr && !_need_post_probe()) {
+            continue;
+        }
+        _restoring_partition = std::move(partition);
+        _reset_hash_table();
+        _spill_stage = SpillStage::LOAD_BUILD;
+        return Status::OK();
+    }
+    enter_eos_phase();
+    return Status::OK();
+}
+
+Status HashJoiner::_load_spilled_build_chunk(RuntimeState* state) {
+    SCOPED_TIMER(_spill_restore_timer);
+    ChunkPtr chunk;
+    if (_restoring_partition.build_file != nullptr) {
+        ASSIGN_OR_RETURN(chunk, _restoring_partition.build_file->read_next());
+    }
+    if (chunk == nullptr) {
+        _restoring_partition.build_file.reset();
+        if (_build_spiller != nullptr) {
+            // The right rows of this partition don't fit in memory, so its left rows are partitioned again.
+            _probe_spiller = std::make_unique<spill::PartitionedSpiller>(
+                    state, _spill_label + "_probe", config::spill_partition_num, _restoring_partition.level + 1,
+                    _spill_io_counters.get());
+            _spill_stage = SpillStage::REPARTITION_PROBE;
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(_build(state));
+        _spill_stage = SpillStage::PROBE;
+        return Status::OK();
+    }
+
+    {
+        SCOPED_TIMER(_build_conjunct_evaluate_timer);
+        _prepare_key_columns(_key_columns, chunk, _build_expr_ctxs);
+    }
+    if (_build_spiller == nullptr && _restoring_partition.level < config::spill_max_partition_level &&
+        spill::reach_spill_mem_threshold(state->instance_mem_tracker())) {
+        RETURN_IF_ERROR(_spill_hash_table(state, _restoring_partition.level + 1));
+    }
+    if (_build_spiller != nullptr) {
+        return _spill_build_chunk(chunk, _key_columns);
+    }
+    if (UNLIKELY(_ht.get_row_count() + chunk->num_rows() >= UINT32_MAX)) {
+        return Status::NotSupported(strings::Substitute("row count of right table in hash join > $0", UINT32_MAX));
+    }
+    SCOPED_TIMER(_copy_right_table_chunk_timer);
+    TRY_CATCH_BAD_ALLOC(_ht.append_chunk(state, chunk, _key_columns));
+    return Status::OK();
+}
+
+Status HashJoiner::_repartition_spilled_probe_chunk(RuntimeState* state) {
+    SCOPED_TIMER(_spill_restore_timer);
+    ChunkPtr chunk;
+    if (_restoring_partition.probe_file != nullptr) {
+        ASSIGN_OR_RETURN(chunk, _restoring_partition.probe_file->read_next());
+    }
+    if (chunk == nullptr) {
+        RETURN_IF_ERROR(_add_spilled_partitions(_restoring_partition.level + 1));
+        _restoring_partition = SpilledPartitionPair();
+        _spill_stage = SpillStage::NEXT_PARTITION;
+        return Status::OK();
+    }
+    return _spill_probe_chunk(state, chunk);
+}
+
+Status HashJoiner::_read_spilled_probe_chunk(RuntimeState* state) {
+    SCOPED_TIMER(_spill_restore_timer);
+    ChunkPtr chunk;
+    if (_restoring_partition.probe_file != nullptr) {
+        ASSIGN_OR_RETURN(chunk, _restoring_partition.probe_file->read_next());
+    }
+    if (chunk == nullptr) {
+        _restoring_partition.probe_file.reset();
+        _ht_has_remain = true;
+        _spill_stage = SpillStage::PROBE_REMAIN;
+        return Status::OK();
+    }
+    _probe_input_chunk = std::move(chunk);
+    _ht_has_remain = true;
+    _prepare_probe_key_columns();
+    return Status::OK();
+}
+
 Status HashJoiner::_calc_filter_for_other_conjunct(ChunkPtr* chunk, Column::Filter& filter, bool& filter_all,
                                                    bool& hit_all) {
     filter_all = false;
@@ -2,12 +2,15 @@
 
 #pragma once
 
+#include <deque>
+
 #include "column/chunk.h"
 #include "column/fixed_length_column.h"
 #include "common/statusor.h"
 #include "exec/exec_node.h"
 #include "exec/pipeline/context_with_dependency.h"
 #include "exec/pipeline/runtime_filter_types.h"
+#include "exec/spill/partitioned_spiller.h"
 #include "exec/vectorized/hash_join_node.h"
 #include "exec/vectorized/join_hash_map.h"
 #include "exprs/vectorized/in_const_predicate.hpp"
@@ -37,6 +40,11 @@ using HashJoinerPtr = std::shared_ptr<HashJoiner>;
 //   processed.
 // 4.DONE: all input streams have been processed.
 //
+// When spilling is enabled and the right table doesn't fit in memory, the hash table is partitioned into spill
+// files by the hash of the join keys in BUILD phase, and all the chunks from left child are partitioned in the same
+// way in PROBE phase. Then in POST_PROBE phase, the pairs of partitions are joined one by one, and a partition
+// whose right rows still don't fit in memory is partitioned again with another hash function.
+//
 enum HashJoinPhase {
     BUILD = 0,
     PROBE = 1,
@@ -137,7 +145,7 @@ public:
     Status append_chunk_to_ht(RuntimeState* state, const ChunkPtr& chunk);
     Status build_ht(RuntimeState* state);
     // probe phase
-    void push_chunk(RuntimeState* state, ChunkPtr&& chunk);
+    Status push_chunk(RuntimeState* state, ChunkPtr&& chunk);
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state);
 
     pipeline::RuntimeInFilters& get_runtime_in_filters() { return _runtime_in_filters; }
@@ -145,7 +153,7 @@ public:
     pipeline::OptRuntimeBloomFilterBuildParams& get_runtime_bloom_filter_build_params() {
         return _runtime_bloom_filter_build_params;
     }
-    size_t get_ht_row_count() { return _ht.get_row_count(); }
+    size_t get_ht_row_count() { return _spilled ? _spilled_build_rows : _ht.get_row_count(); }
 
     Status create_runtime_filters(RuntimeState* state);
 
@@ -198,7 +206,7 @@ private:
         }
 
         // special cases of short-circuit break.
-        if (_ht.get_row_count() == 0 &&
+        if (get_ht_row_count() == 0 &&
             (_join_type == TJoinOp::INNER_JOIN || _join_type == TJoinOp::LEFT_SEMI_JOIN ||
              _join_type == TJoinOp::RIGHT_SEMI_JOIN || _join_type == TJoinOp::RIGHT_ANTI_JOIN ||
              _join_type == TJoinOp::RIGHT_OUTER_JOIN)) {
@@ -223,10 +231,34 @@ private:
     }
 
     Status _build(RuntimeState* state);
+    // Report the keys of the hash table of at least join_heavy_hitter_min_ratio of the rows to the profile.
+    void _report_heavy_hitters(RuntimeState* state);
     Status _probe(RuntimeState* state, ScopedTimer<MonotonicStopWatch>& probe_timer, ChunkPtr* chunk, bool& eos);
+    Status _probe_input(RuntimeState* state, ChunkPtr* chunk);
+    Status _probe_remain(RuntimeState* state, ChunkPtr* chunk);
 
     StatusOr<ChunkPtr> _pull_probe_output_chunk(RuntimeState* state);
 
+    // Spilling.
+    void _reset_hash_table();
+    Status _spill(spill::PartitionedSpiller* spiller, const ChunkPtr& chunk, const Columns& key_columns,
+                  RuntimeProfile::Counter* rows_counter);
+    Status _spill_build_chunk(const ChunkPtr& chunk, const Columns& key_columns);
+    // Move all the rows of the hash table into a new build spiller of |level|, and the following right rows
+    // are spilled too.
+    Status _spill_hash_table(RuntimeState* state, int level);
+    void _append_spilled_rf_key_columns(const Columns& key_columns);
+    Status _spill_probe_chunk(RuntimeState* state, const ChunkPtr& chunk);
+    Status _finish_spiller(std::unique_ptr<spill::PartitionedSpiller>& spiller,
+                           std::vector<std::unique_ptr<spill::SpillFile>>* files);
+    Status _add_spilled_partitions(int level);
+
+    StatusOr<ChunkPtr> _pull_spilled_output_chunk(RuntimeState* state);
+    Status _next_spilled_partition(RuntimeState* state);
+    Status _load_spilled_build_chunk(RuntimeState* state);
+    Status _repartition_spilled_probe_chunk(RuntimeState* state);
+    Status _read_spilled_probe_chunk(RuntimeState* state);
+
     Status _calc_filter_for_other_conjunct(ChunkPtr* chunk, Column::Filter& filter, bool& filter_all, bool& hit_all);
     static void _process_row_for_other_conjunct(ChunkPtr* chunk, size_t start_column, size_t column_count,
                                                 bool filter_all, bool hit_all, const Column::Filter& filter);
@@ -267,7 +299,8 @@ private:
     Status _create_runtime_in_filters(RuntimeState* state) {
         SCOPED_TIMER(_build_runtime_filter_timer);
 
-        if (_ht.get_row_count() > 1024) {
+        // The key columns of the spilled right rows aren't kept for in-filters.
+        if (_spilled || _ht.get_row_count() > 1024) {
             return Status::OK();
         }
 
@@ -313,13 +346,13 @@ private:
                 _runtime_bloom_filter_build_params.emplace_back();
                 continue;
             }
-            if (!rf_desc->has_remote_targets() && _ht.get_row_count() > limit) {
+            if (!rf_desc->has_remote_targets() && get_ht_row_count() > limit) {
                 _runtime_bloom_filter_build_params.emplace_back();
                 continue;
             }
 
             int expr_order = rf_desc->build_expr_order();
-            ColumnPtr column = _ht.get_key_columns()[expr_order];
+            ColumnPtr column = _spilled ? _spilled_rf_key_columns[expr_order] : _ht.get_key_columns()[expr_order];
             bool eq_null = _is_null_safes[expr_order];
             _runtime_bloom_filter_build_params.emplace_back(pipeline::RuntimeBloomFilterBuildParam(eq_null, column));
         }
@@ -329,6 +362,7 @@ private:
 private:
     const THashJoinNode& _hash_join_node;
     ObjectPool* _pool;
+    const TPlanNodeId _node_id;
 
     RuntimeState* _runtime_state = nullptr;
 
@@ -382,18 +416,61 @@ private:
     const std::vector<HashJoinerPtr>& _read_only_join_probers;
     std::atomic<size_t> _num_unfinished_probers = 0;
 
+    // A pair of partitions spilled from both sides, whose rows are in the same partition of the same level.
+    struct SpilledPartitionPair {
+        std::unique_ptr<spill::SpillFile> build_file;
+        std::unique_ptr<spill::SpillFile> probe_file;
+        int level = 0;
+    };
+    enum class SpillStage {
+        NEXT_PARTITION = 0,
+        LOAD_BUILD = 1,
+        REPARTITION_PROBE = 2,
+        PROBE = 3,
+        PROBE_REMAIN = 4,
+    };
+
+    bool _spill_enabled = false;
+    // Whether the right table has been spilled, and all chunks from left child are spilled after that.
+    bool _spilled = false;
+    std::string _spill_label;
+    size_t _spilled_build_rows = 0;
+    // Build key columns of the spilled right rows used by runtime bloom filters, indexed by expr order.
+    // Like the key columns of the hash table, the first row of each column is reserved, so the runtime filters
+    // can be built from the whole right table after spilling.
+    Columns _spilled_rf_key_columns;
+    // Shared by the spillers and the spilled files below, so it is declared before them.
+    std::unique_ptr<spill::SpillIOCounters> _spill_io_counters;
+    std::unique_ptr<spill::PartitionedSpiller> _build_spiller;
+    std::unique_ptr<spill::PartitionedSpiller> _probe_spiller;
+    std::vector<std::unique_ptr<spill::SpillFile>> _spilled_build_files;
+    bool _spilled_partitions_ready = false;
+    std::deque<SpilledPartitionPair> _spilled_partitions;
+    SpilledPartitionPair _restoring_partition;
+    SpillStage _spill_stage = SpillStage::NEXT_PARTITION;
+
     // Profile for hash join builder.
+    RuntimeProfile* _build_runtime_profile = nullptr;
     RuntimeProfile::Counter* _build_ht_timer = nullptr;
     RuntimeProfile::Counter* _copy_right_table_chunk_timer = nullptr;
     RuntimeProfile::Counter* _build_runtime_filter_timer = nullptr;
     RuntimeProfile::Counter* _output_build_column_timer = nullptr;
     RuntimeProfile::Counter* _build_buckets_counter = nullptr;
+    RuntimeProfile::Counter* _heavy_hitter_keys_counter = nullptr;
+    RuntimeProfile::Counter* _heavy_hitter_build_rows_counter = nullptr;
     RuntimeProfile::Counter* _runtime_filter_num = nullptr;
+    RuntimeProfile::Counter* _spill_timer = nullptr;
+    RuntimeProfile::Counter* _spill_restore_timer = nullptr;
+    RuntimeProfile::Counter* _spilled_build_rows_counter = nullptr;
+    RuntimeProfile::Counter* _spilled_probe_rows_counter = nullptr;
+    RuntimeProfile::Counter* _spilled_bytes_counter = nullptr;
+    RuntimeProfile::Counter* _spilled_partitions_counter = nullptr;
 
     // Profile for hash join prober.
     RuntimeProfile::Counter* _search_ht_timer = nullptr;
     RuntimeProfile::Counter* _output_probe_column_timer = nullptr;
     RuntimeProfile::Counter* _output_tuple_column_timer = nullptr;
+    RuntimeProfile::Counter* _prefetch_probe_rows = nullptr;
     RuntimeProfile::Counter* _build_conjunct_evaluate_timer = nullptr;
     RuntimeProfile::Counter* _probe_conjunct_evaluate_timer = nullptr;
     RuntimeProfile::Counter* _other_join_conjunct_evaluate_timer = nullptr;
@@ -6,6 +6,8 @@
 
 #include "column/column_helper.h"
 #include "exec/exec_node.h"
+#include "io/cache_input_stream.h"
+#include "io/data_cache.h"
 
 namespace starrocks::vectorized {
 
@@ -156,6 +158,7 @@ void HdfsScanner::close(RuntimeState* runtime_state) noexcept {
     update_counter();
     do_close(runtime_state);
     _file.reset(nullptr);
+    _cache_input_stream.reset();
     _raw_file.reset(nullptr);
     if (_opened && _scanner_params.open_limit != nullptr) {
         _scanner_params.open_limit->fetch_sub(1, std::memory_order_relaxed);
@@ -179,8 +182,17 @@ uint64_t HdfsScanner::exit_pending_queue() {
 Status HdfsScanner::open_random_access_file() {
     CHECK(_file == nullptr) << "File has already been opened";
     ASSIGN_OR_RETURN(_raw_file, _scanner_params.fs->new_random_access_file(_scanner_params.path))
-    _file = std::make_unique<RandomAccessFile>(
-            std::make_shared<CountedSeekableInputStream>(_raw_file->stream(), &_stats), _raw_file->filename());
+    std::shared_ptr<io::SeekableInputStream> stream =
+            std::make_shared<CountedSeekableInputStream>(_raw_file->stream(), &_stats);
+    // the file is cached only if its modification time is known, to never hit a rewritten file.
+    const THdfsScanRange* scan_range = _scanner_params.scan_ranges[0];
+    if (auto* data_cache = io::DataCache::instance(); data_cache != nullptr && scan_range->__isset.modification_time) {
+        auto file_key = io::DataCache::file_key(_scanner_params.path, scan_range->modification_time);
+        auto* cache = data_cache->cache_of(file_key);
+        _cache_input_stream = std::make_shared<io::CacheInputStream>(std::move(stream), std::move(file_key), cache);
+        stream = _cache_input_stream;
+    }
+    _file = std::make_unique<RandomAccessFile>(std::move(stream), _raw_file->filename());
     return Status::OK();
 }
 
@@ -203,6 +215,28 @@ void HdfsScanner::update_hdfs_counter(HdfsScanProfile* profile) {
     }
 }
 
+void HdfsScanner::update_datacache_counter(HdfsScanProfile* profile) {
+    static const char* const kDataCacheProfileSectionPrefix = "DataCache";
+    if (_cache_input_stream == nullptr) return;
+
+    const auto& stats = _cache_input_stream->stats();
+    _stats.datacache_hit_count = stats.hit_count;
+    _stats.datacache_hit_bytes = stats.hit_bytes;
+    _stats.datacache_miss_count = stats.miss_count;
+    _stats.datacache_miss_bytes = stats.miss_bytes;
+
+    RuntimeProfile* runtime_profile = profile->runtime_profile;
+    ADD_TIMER(runtime_profile, kDataCacheProfileSectionPrefix);
+    auto* hit_count = ADD_CHILD_COUNTER(runtime_profile, "HitCount", TUnit::UNIT, kDataCacheProfileSectionPrefix);
+    auto* hit_bytes = ADD_CHILD_COUNTER(runtime_profile, "HitBytes", TUnit::BYTES, kDataCacheProfileSectionPrefix);
+    auto* miss_count = ADD_CHILD_COUNTER(runtime_profile, "MissCount", TUnit::UNIT, kDataCacheProfileSectionPrefix);
+    auto* miss_bytes = ADD_CHILD_COUNTER(runtime_profile, "MissBytes", TUnit::BYTES, kDataCacheProfileSectionPrefix);
+    COUNTER_UPDATE(hit_count, _stats.datacache_hit_count);
+    COUNTER_UPDATE(hit_bytes, _stats.datacache_hit_bytes);
+    COUNTER_UPDATE(miss_count, _stats.datacache_miss_count);
+    COUNTER_UPDATE(miss_bytes, _stats.datacache_miss_bytes);
+}
+
 void HdfsScanner::do_update_counter(HdfsScanProfile* profile) {}
 
 void HdfsScanner::update_counter() {
@@ -210,6 +244,7 @@ void HdfsScanner::update_counter() {
     if (profile == nullptr) return;
 
     update_hdfs_counter(profile);
+    update_datacache_counter(profile);
 
     COUNTER_UPDATE(profile->reader_init_timer, _stats.reader_init_ns);
     COUNTER_UPDATE(profile->rows_read_counter, _stats.raw_rows_read);
@@ -14,6 +14,9 @@
 #include "runtime/runtime_state.h"
 #include "util/runtime_profile.h"
 
+namespace starrocks::io {
+class CacheInputStream;
+}
 namespace starrocks::parquet {
 class FileReader;
 }
@@ -31,14 +34,24 @@ struct HdfsScanStats {
     int64_t column_read_ns = 0;
     int64_t column_convert_ns = 0;
     int64_t reader_init_ns = 0;
+    // data cache, in blocks
+    int64_t datacache_hit_count = 0;
+    int64_t datacache_hit_bytes = 0;
+    int64_t datacache_miss_count = 0;
+    int64_t datacache_miss_bytes = 0;
 
     // parquet only!
     // read & decode
     int64_t level_decode_ns = 0;
     int64_t value_decode_ns = 0;
     int64_t page_read_ns = 0;
+    // part of page_read_ns
+    int64_t page_decompress_ns = 0;
     // reader init
     int64_t footer_read_ns = 0;
+    int64_t footer_cache_hit = 0;
+    int64_t page_index_read_ns = 0;
+    int64_t bloom_filter_read_ns = 0;
     int64_t column_reader_init_ns = 0;
     // dict filter
     int64_t group_chunk_read_ns = 0;
@@ -208,6 +221,7 @@ public:
     int64_t raw_rows_read() const { return _stats.raw_rows_read; }
     int64_t num_rows_read() const { return _stats.num_rows_read; }
     int64_t cpu_time_spent() const { return _stats.get_cpu_time_ns(); }
+    const HdfsScanStats& stats() const { return _stats; }
     void set_keep_priority(bool v) { _keep_priority = v; }
     bool keep_priority() const { return _keep_priority; }
     void update_counter();
@@ -254,6 +268,7 @@ private:
     Status _build_scanner_context();
     MonotonicStopWatch _pending_queue_sw;
     void update_hdfs_counter(HdfsScanProfile* profile);
+    void update_datacache_counter(HdfsScanProfile* profile);
 
 protected:
     std::atomic_bool _pending_token = false;
@@ -272,6 +287,8 @@ protected:
     std::vector<ExprContext*> _min_max_conjunct_ctxs;
     std::unique_ptr<RandomAccessFile> _raw_file;
     std::unique_ptr<RandomAccessFile> _file;
+    // The stream reading |_file| through the data cache, nullptr if the file is not cached.
+    std::shared_ptr<io::CacheInputStream> _cache_input_stream;
 };
 
 } // namespace starrocks::vectorized
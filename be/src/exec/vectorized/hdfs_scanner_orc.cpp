@@ -2,9 +2,11 @@
 
 #include "exec/vectorized/hdfs_scanner_orc.h"
 
+#include <functional>
 #include <utility>
 
 #include "exec/exec_node.h"
+#include "formats/file_metadata_cache.h"
 #include "formats/orc/orc_chunk_reader.h"
 #include "fs/fs.h"
 #include "gen_cpp/orc_proto.pb.h"
@@ -142,8 +144,9 @@ public:
     bool filterOnOpeningStripe(uint64_t stripeIndex, const orc::proto::StripeInformation* stripeInformation) override;
     bool filterOnPickRowGroup(size_t rowGroupIdx, const std::unordered_map<uint64_t, orc::proto::RowIndex>& rowIndexes,
                               const std::map<uint32_t, orc::BloomFilterIndex>& bloomFilters) override;
-    bool filterMinMax(size_t rowGroupIdx, const std::unordered_map<uint64_t, orc::proto::RowIndex>& rowIndexes,
-                      const std::map<uint32_t, orc::BloomFilterIndex>& bloomFilter);
+    bool filterOnStripeStatistics(uint64_t stripeIndex, const orc::proto::StripeStatistics& stripeStats) override;
+    // |stats_of| returns the statistics of a column index, or nullptr if there are no statistics.
+    bool filterMinMax(const std::function<const orc::proto::ColumnStatistics*(int32_t)>& stats_of);
     bool filterOnPickStringDictionary(const std::unordered_map<uint64_t, orc::StringDictionary*>& sdicts) override;
 
     bool is_slot_evaluated(SlotId id) { return _dict_filter_eval_cache.find(id) != _dict_filter_eval_cache.end(); }
@@ -216,9 +219,8 @@ bool OrcRowReaderFilter::filterOnOpeningStripe(uint64_t stripeIndex,
     return true;
 }
 
-bool OrcRowReaderFilter::filterMinMax(size_t rowGroupIdx,
-                                      const std::unordered_map<uint64_t, orc::proto::RowIndex>& rowIndexes,
-                                      const std::map<uint32_t, orc::BloomFilterIndex>& bloomFilter) {
+bool OrcRowReaderFilter::filterMinMax(
+        const std::function<const orc::proto::ColumnStatistics*(int32_t)>& stats_of) {
     const TupleDescriptor* min_max_tuple_desc = _scanner_params.min_max_tuple_desc;
     ChunkPtr min_chunk = ChunkHelper::new_chunk(*min_max_tuple_desc, 0);
     ChunkPtr max_chunk = ChunkHelper::new_chunk(*min_max_tuple_desc, 0);
@@ -226,17 +228,16 @@ bool OrcRowReaderFilter::filterMinMax(size_t rowGroupIdx,
         SlotDescriptor* slot = min_max_tuple_desc->slots()[i];
         int32_t column_index = _reader->get_column_id_by_name(slot->col_name());
         if (column_index >= 0) {
-            auto row_idx_iter = rowIndexes.find(column_index);
+            const orc::proto::ColumnStatistics* stats = stats_of(column_index);
             // there is no column stats, skip filter process.
-            if (row_idx_iter == rowIndexes.end()) {
+            if (stats == nullptr) {
                 return false;
             }
-            const orc::proto::ColumnStatistics& stats = row_idx_iter->second.entry(rowGroupIdx).statistics();
             ColumnPtr min_col = min_chunk->columns()[i];
             ColumnPtr max_col = max_chunk->columns()[i];
             DCHECK(!min_col->is_constant() && !max_col->is_constant());
             int64_t tz_offset_in_seconds = _reader->tzoffset_in_seconds() - _writer_tzoffset_in_seconds;
-            Status st = _reader->decode_min_max_value(slot, stats, min_col, max_col, tz_offset_in_seconds);
+            Status st = _reader->decode_min_max_value(slot, *stats, min_col, max_col, tz_offset_in_seconds);
             if (!st.ok()) {
                 return false;
             }
@@ -262,8 +263,8 @@ bool OrcRowReaderFilter::filterMinMax(size_t rowGroupIdx,
         }
     }
 
-    VLOG_FILE << "stripe = " << _current_stripe_index << ", row_group = " << rowGroupIdx
-              << ", min_chunk = " << min_chunk->debug_row(0) << ", max_chunk = " << max_chunk->debug_row(0);
+    VLOG_FILE << "stripe = " << _current_stripe_index << ", min_chunk = " << min_chunk->debug_row(0)
+              << ", max_chunk = " << max_chunk->debug_row(0);
     for (auto& min_max_conjunct_ctx : _scanner_ctx.min_max_conjunct_ctxs) {
         // TODO: add a warning log here
         auto min_col = EVALUATE_NULL_IF_ERROR(min_max_conjunct_ctx, min_max_conjunct_ctx->root(), min_chunk.get());
@@ -280,7 +281,14 @@ bool OrcRowReaderFilter::filterOnPickRowGroup(size_t rowGroupIdx,
                                               const std::unordered_map<uint64_t, orc::proto::RowIndex>& rowIndexes,
                                               const std::map<uint32_t, orc::BloomFilterIndex>& bloomFilters) {
     if (_scanner_params.min_max_tuple_desc != nullptr) {
-        if (filterMinMax(rowGroupIdx, rowIndexes, bloomFilters)) {
+        auto stats_of = [&](int32_t column_index) -> const orc::proto::ColumnStatistics* {
+            auto row_idx_iter = rowIndexes.find(column_index);
+            if (row_idx_iter == rowIndexes.end()) {
+                return nullptr;
+            }
+            return &row_idx_iter->second.entry(rowGroupIdx).statistics();
+        };
+        if (filterMinMax(stats_of)) {
             VLOG_FILE << "OrcRowReaderFilter: skip row group " << rowGroupIdx << ", stripe " << _current_stripe_index;
             return true;
         }
@@ -288,6 +296,24 @@ bool OrcRowReaderFilter::filterOnPickRowGroup(size_t rowGroupIdx,
     return false;
 }
 
+bool OrcRowReaderFilter::filterOnStripeStatistics(uint64_t stripeIndex,
+                                                  const orc::proto::StripeStatistics& stripeStats) {
+    if (!config::orc_stripe_filter_enable || _scanner_params.min_max_tuple_desc == nullptr) {
+        return false;
+    }
+    auto stats_of = [&](int32_t column_index) -> const orc::proto::ColumnStatistics* {
+        if (column_index >= stripeStats.colstats_size()) {
+            return nullptr;
+        }
+        return &stripeStats.colstats(column_index);
+    };
+    if (filterMinMax(stats_of)) {
+        VLOG_FILE << "OrcRowReaderFilter: skip stripe by stripe statistics, stripe " << stripeIndex;
+        return true;
+    }
+    return false;
+}
+
 // Hive ORC char type will pad trailing spaces.
 // https://docs.cloudera.com/documentation/enterprise/6/6.3/topics/impala_char.html
 static inline size_t remove_trailing_spaces(const char* s, size_t size) {
@@ -414,10 +440,28 @@ Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
     RETURN_IF_ERROR(open_random_access_file());
     auto input_stream = std::make_unique<ORCHdfsFileStream>(_file.get(), _scanner_params.scan_ranges[0]->file_length);
     SCOPED_RAW_TIMER(&_stats.reader_init_ns);
+    // the file tail is cached only if the modification time of the file is known, to never hit a rewritten file.
+    const THdfsScanRange* scan_range = _scanner_params.scan_ranges[0];
+    FileMetadataCache* cache = FileMetadataCache::instance();
+    std::string cache_key;
+    std::shared_ptr<const std::string> file_tail;
+    if (cache != nullptr && scan_range->__isset.modification_time) {
+        cache_key = FileMetadataCache::key("orc", _scanner_params.path, scan_range->file_length,
+                                           scan_range->modification_time);
+        file_tail = cache->lookup<std::string>(cache_key);
+    }
     std::unique_ptr<orc::Reader> reader;
     try {
         orc::ReaderOptions options;
+        if (file_tail != nullptr) {
+            options.setSerializedFileTail(*file_tail);
+        }
         reader = orc::createReader(std::move(input_stream), options);
+        if (file_tail == nullptr && !cache_key.empty()) {
+            auto tail = std::make_shared<const std::string>(reader->getSerializedFileTail());
+            size_t charge = tail->size();
+            cache->insert(cache_key, std::move(tail), charge);
+        }
     } catch (std::exception& e) {
         auto s = strings::Substitute("HdfsOrcScanner::do_open failed. reason = $0", e.what());
         LOG(WARNING) << s;
@@ -17,9 +17,13 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     RuntimeProfile::Counter* level_decode_timer = nullptr;
     RuntimeProfile::Counter* value_decode_timer = nullptr;
     RuntimeProfile::Counter* page_read_timer = nullptr;
+    RuntimeProfile::Counter* page_decompress_timer = nullptr;
 
     // reader init
     RuntimeProfile::Counter* footer_read_timer = nullptr;
+    RuntimeProfile::Counter* footer_cache_hit_counter = nullptr;
+    RuntimeProfile::Counter* page_index_read_timer = nullptr;
+    RuntimeProfile::Counter* bloom_filter_read_timer = nullptr;
     RuntimeProfile::Counter* column_reader_init_timer = nullptr;
 
     // dict filter
@@ -33,7 +37,12 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     value_decode_timer = ADD_CHILD_TIMER(root, "ValueDecodeTime", kParquetProfileSectionPrefix);
 
     page_read_timer = ADD_CHILD_TIMER(root, "PageReadTime", kParquetProfileSectionPrefix);
+    page_decompress_timer = ADD_CHILD_TIMER(root, "PageDecompressTime", "PageReadTime");
     footer_read_timer = ADD_CHILD_TIMER(root, "ReaderInitFooterRead", kParquetProfileSectionPrefix);
+    footer_cache_hit_counter =
+            ADD_CHILD_COUNTER(root, "ReaderInitFooterCacheHit", TUnit::UNIT, kParquetProfileSectionPrefix);
+    page_index_read_timer = ADD_CHILD_TIMER(root, "ReaderInitPageIndexRead", kParquetProfileSectionPrefix);
+    bloom_filter_read_timer = ADD_CHILD_TIMER(root, "ReaderInitBloomFilterRead", kParquetProfileSectionPrefix);
     column_reader_init_timer = ADD_CHILD_TIMER(root, "ReaderInitColumnReaderInit", kParquetProfileSectionPrefix);
 
     group_chunk_read_timer = ADD_CHILD_TIMER(root, "GroupChunkRead", kParquetProfileSectionPrefix);
@@ -43,7 +52,11 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     COUNTER_UPDATE(value_decode_timer, _stats.value_decode_ns);
     COUNTER_UPDATE(level_decode_timer, _stats.level_decode_ns);
     COUNTER_UPDATE(page_read_timer, _stats.page_read_ns);
+    COUNTER_UPDATE(page_decompress_timer, _stats.page_decompress_ns);
     COUNTER_UPDATE(footer_read_timer, _stats.footer_read_ns);
+    COUNTER_UPDATE(footer_cache_hit_counter, _stats.footer_cache_hit);
+    COUNTER_UPDATE(page_index_read_timer, _stats.page_index_read_ns);
+    COUNTER_UPDATE(bloom_filter_read_timer, _stats.bloom_filter_read_ns);
     COUNTER_UPDATE(column_reader_init_timer, _stats.column_reader_init_ns);
     COUNTER_UPDATE(group_chunk_read_timer, _stats.group_chunk_read_ns);
     COUNTER_UPDATE(group_dict_filter_timer, _stats.group_dict_filter_ns);
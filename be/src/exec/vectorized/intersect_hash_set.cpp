@@ -34,10 +34,14 @@ void IntersectHashSet<HashSet>::build_set(RuntimeState* state, const ChunkPtr& c
     for (size_t i = 0; i < chunk_size; ++i) {
         IntersectSliceFlag key(_buffer + i * _max_one_row_size, _slice_sizes[i]);
         _hash_set->lazy_emplace(key, [&](const auto& ctor) {
-            // we must persist the slice before insert
-            uint8_t* pos = pool->allocate(key.slice.size);
-            memcpy(pos, key.slice.data, key.slice.size);
-            ctor(pos, key.slice.size);
+            // The inline key is copied with the flag, the others are persisted before inserted.
+            if (key.key.is_inline()) {
+                ctor(key);
+                return;
+            }
+            uint8_t* pos = pool->allocate(key.key.size());
+            memcpy(pos, key.key.data(), key.key.size());
+            ctor(pos, key.key.size());
         });
     }
 }
@@ -4,6 +4,7 @@
 
 #include "column/chunk.h"
 #include "column/column_hash.h"
+#include "column/hash_set.h"
 #include "exprs/expr_context.h"
 #include "runtime/mem_pool.h"
 #include "util/phmap/phmap.h"
@@ -16,24 +17,20 @@ struct IntersectSliceFlagEqual;
 
 class IntersectSliceFlag {
 public:
-    IntersectSliceFlag(const uint8_t* d, size_t n) : slice(d, n), hit_times(0) {}
+    IntersectSliceFlag(const uint8_t* d, size_t n) : key(d, n), hit_times(0) {}
 
-    Slice slice;
+    // The serialized key, the key of the fixed size columns is kept inline.
+    InlinableSlice key;
     mutable uint16_t hit_times;
 };
 
 struct IntersectSliceFlagEqual {
-    bool operator()(const IntersectSliceFlag& x, const IntersectSliceFlag& y) const {
-        return memequal(x.slice.data, x.slice.size, y.slice.data, y.slice.size);
-    }
+    bool operator()(const IntersectSliceFlag& x, const IntersectSliceFlag& y) const { return x.key == y.key; }
 };
 
 struct IntersectSliceFlagHash {
     static const uint32_t CRC_SEED = 0x811C9DC5;
-    std::size_t operator()(const IntersectSliceFlag& sliceMayUnneed) const {
-        const Slice& slice = sliceMayUnneed.slice;
-        return crc_hash_64(slice.data, slice.size, CRC_SEED);
-    }
+    std::size_t operator()(const IntersectSliceFlag& flag) const { return flag.key.hash(CRC_SEED); }
 };
 
 template <typename HashSet>
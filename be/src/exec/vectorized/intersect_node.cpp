@@ -165,7 +165,7 @@ Status IntersectNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos)
     _remained_keys.resize(runtime_state()->chunk_size());
     while (_hash_set_iterator != _hash_set->end() && read_index < runtime_state()->chunk_size()) {
         if (_hash_set_iterator->hit_times == _intersect_times) {
-            _remained_keys[read_index] = _hash_set_iterator->slice;
+            _remained_keys[read_index] = _hash_set_iterator->key.slice();
             ++read_index;
         }
         ++_hash_set_iterator;
@@ -2,22 +2,149 @@
 
 #include "exec/vectorized/join_hash_map.h"
 
+#include <algorithm>
 #include <column/chunk.h>
+#include <cstring>
 #include <gen_cpp/PlanNodes_types.h>
+#include <limits>
 #include <runtime/descriptors.h>
 
+#include "common/config.h"
 #include "exec/vectorized/hash_join_node.h"
+#include "gutil/strings/fastmem.h"
+#include "runtime/exec_env.h"
 #include "serde/column_array_serde.h"
 #include "simd/simd.h"
+#include "util/threadpool.h"
 
 namespace starrocks::vectorized {
 
+ThreadPool* JoinHashMapHelper::parallel_build_pool(uint32_t row_count) {
+    if (config::join_parallel_build_min_rows <= 0 || row_count < config::join_parallel_build_min_rows) {
+        return nullptr;
+    }
+    ThreadPool* pool = ExecEnv::GetInstance()->join_build_thread_pool();
+    if (pool == nullptr || pool->max_threads() <= 1) {
+        return nullptr;
+    }
+    return pool;
+}
+
+size_t JoinHashMapHelper::_parallel_build_dop(ThreadPool* pool) {
+    return std::max(1, pool->max_threads());
+}
+
+void JoinHashMapHelper::run_in_parallel(ThreadPool* pool, size_t num_tasks, const std::function<void(size_t)>& task) {
+    auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+    for (size_t i = 1; i < num_tasks; i++) {
+        if (!token->submit_func([&task, i] { task(i); }).ok()) {
+            task(i);
+        }
+    }
+    task(0);
+    token->wait();
+}
+
+bool JoinHashMapHelper::need_prefetch_probe(const JoinHashTableItems& table_items, size_t key_size) {
+    if (config::join_probe_prefetch_min_bytes < 0) {
+        return false;
+    }
+    // The probe touches a bucket of |first|, and a key and an entry of |next| for each row of a chain.
+    int64_t table_bytes = static_cast<int64_t>(table_items.bucket_size) * sizeof(uint32_t) +
+                          static_cast<int64_t>(table_items.row_count + 1) * (key_size + sizeof(uint32_t));
+    return table_bytes >= config::join_probe_prefetch_min_bytes;
+}
+
+void JoinHashMapHelper::lookup_chain_heads(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
+                                           const uint8_t* is_nulls) {
+    const uint32_t row_count = probe_state->probe_row_count;
+    const uint32_t* buckets = probe_state->buckets.data();
+    const uint32_t* first = table_items.first.data();
+    uint32_t* next = probe_state->next.data();
+
+    if (!probe_state->prefetch_probe) {
+        for (uint32_t i = 0; i < row_count; i++) {
+            next[i] = (is_nulls == nullptr || is_nulls[i] == 0) ? first[buckets[i]] : 0;
+        }
+        return;
+    }
+
+    // The bucket numbers of the null rows may be garbage, so they are never prefetched.
+    const uint32_t prefetch_end = row_count > PROBE_PREFETCH_DISTANCE ? row_count - PROBE_PREFETCH_DISTANCE : 0;
+    for (uint32_t i = 0; i < std::min<uint32_t>(row_count, PROBE_PREFETCH_DISTANCE); i++) {
+        if (is_nulls == nullptr || is_nulls[i] == 0) {
+            __builtin_prefetch(first + buckets[i]);
+        }
+    }
+    for (uint32_t i = 0; i < row_count; i++) {
+        if (i < prefetch_end && (is_nulls == nullptr || is_nulls[i + PROBE_PREFETCH_DISTANCE] == 0)) {
+            __builtin_prefetch(first + buckets[i + PROBE_PREFETCH_DISTANCE]);
+        }
+        next[i] = (is_nulls == nullptr || is_nulls[i] == 0) ? first[buckets[i]] : 0;
+    }
+    if (probe_state->prefetch_probe_rows != nullptr) {
+        COUNTER_UPDATE(probe_state->prefetch_probe_rows, row_count);
+    }
+}
+
+size_t JoinHashMapHelper::serialize_packed_string_key(const Column& key_column, int32_t max_length, uint8_t* dst,
+                                                      size_t byte_offset, size_t byte_interval, uint32_t start,
+                                                      uint32_t count) {
+    const uint8_t* nulls = nullptr;
+    if (key_column.is_nullable()) {
+        nulls = down_cast<const NullableColumn&>(key_column).null_column()->get_data().data();
+    }
+    const size_t null_size = nulls != nullptr ? 1 : 0;
+    const size_t packed_size = null_size + 1 + max_length;
+    const auto* binary_column = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(&key_column));
+
+    uint8_t* buf = dst + byte_offset;
+    for (uint32_t i = start; i < start + count; i++, buf += byte_interval) {
+        // The bytes past a shorter string are cleared, the key column may be reused.
+        memset(buf, 0, packed_size);
+        if (nulls != nullptr && nulls[i] != 0) {
+            buf[0] = 1;
+            continue;
+        }
+        Slice value = binary_column->get_slice(i);
+        if (value.size <= static_cast<size_t>(max_length)) {
+            buf[null_size] = static_cast<uint8_t>(value.size);
+            strings::memcpy_inlined(buf + null_size + 1, value.data, value.size);
+        }
+    }
+    return packed_size;
+}
+
+void JoinHashMapHelper::mark_unpacked_string_keys(const Columns& key_columns,
+                                                  const std::vector<int32_t>& key_string_max_lengths, uint32_t count,
+                                                  uint8_t* is_nulls) {
+    for (size_t i = 0; i < key_columns.size(); i++) {
+        if (key_string_max_lengths[i] < 0) {
+            continue;
+        }
+        const uint8_t* nulls = nullptr;
+        if (key_columns[i]->is_nullable()) {
+            nulls = down_cast<const NullableColumn*>(key_columns[i].get())->null_column()->get_data().data();
+        }
+        const auto* binary_column =
+                down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(key_columns[i].get()));
+        const auto& offsets = binary_column->get_offset();
+        const auto max_length = static_cast<uint32_t>(key_string_max_lengths[i]);
+        for (uint32_t j = 0; j < count; j++) {
+            // A null of a null safe key is packed as the null flag, whatever the string under it is.
+            bool unpacked = offsets[j + 1] - offsets[j] > max_length && (nulls == nullptr || nulls[j] == 0);
+            is_nulls[j] |= unpacked;
+        }
+    }
+}
+
 void SerializedJoinBuildFunc::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
     table_items->first.resize(table_items->bucket_size, 0);
     table_items->next.resize(table_items->row_count + 1, 0);
     table_items->build_slice.resize(table_items->row_count + 1);
-    table_items->build_pool = std::make_unique<MemPool>();
+    // The serialized keys of a large build side are allocated from huge page chunks.
+    table_items->build_pool = std::make_unique<MemPool>(MemPool::LARGE_CHUNK_SIZE);
 }
 
 void SerializedJoinBuildFunc::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
@@ -161,9 +288,7 @@ void SerializedJoinProbeFunc::_probe_column(const JoinHashTableItems& table_item
         ptr += probe_state->probe_slice[i].size;
     }
 
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_chain_heads(table_items, probe_state, nullptr);
 }
 
 void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& table_items,
@@ -191,11 +316,10 @@ void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& t
         if (probe_state->is_nulls[i] == 0) {
             probe_state->buckets[i] =
                     JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-        } else {
-            probe_state->next[i] = 0;
         }
     }
+
+    JoinHashMapHelper::lookup_chain_heads(table_items, probe_state, probe_state->is_nulls.data());
 }
 
 JoinHashTable JoinHashTable::clone_readable_table() {
@@ -225,10 +349,12 @@ JoinHashTable JoinHashTable::clone_readable_table() {
 
 void JoinHashTable::set_probe_profile(RuntimeProfile::Counter* search_ht_timer,
                                       RuntimeProfile::Counter* output_probe_column_timer,
-                                      RuntimeProfile::Counter* output_tuple_column_timer) {
+                                      RuntimeProfile::Counter* output_tuple_column_timer,
+                                      RuntimeProfile::Counter* prefetch_probe_rows) {
     _probe_state->search_ht_timer = search_ht_timer;
     _probe_state->output_probe_column_timer = output_probe_column_timer;
     _probe_state->output_tuple_column_timer = output_tuple_column_timer;
+    _probe_state->prefetch_probe_rows = prefetch_probe_rows;
 }
 
 void JoinHashTable::close() {
@@ -264,6 +390,7 @@ void JoinHashTable::create(const HashTableParam& param) {
     _probe_state->search_ht_timer = param.search_ht_timer;
     _probe_state->output_probe_column_timer = param.output_probe_column_timer;
     _probe_state->output_tuple_column_timer = param.output_tuple_column_timer;
+    _probe_state->prefetch_probe_rows = param.prefetch_probe_rows;
 
     const auto& probe_desc = *param.probe_row_desc;
     for (const auto& tuple_desc : probe_desc.tuple_descriptors()) {
@@ -330,6 +457,74 @@ void JoinHashTable::create(const HashTableParam& param) {
     }
 }
 
+std::vector<JoinHeavyHitter> JoinHashTable::find_heavy_hitters(size_t max_keys, uint32_t min_rows) const {
+    std::vector<JoinHeavyHitter> heavy_hitters;
+    const auto& first = _table_items->first;
+    const auto& next = _table_items->next;
+    min_rows = std::max<uint32_t>(min_rows, 1);
+    if (max_keys == 0 || _table_items->row_count < min_rows || first.empty()) {
+        return heavy_hitters;
+    }
+
+    // A key has no more rows than its bucket chain, so only the chains of at least min_rows rows are counted.
+    std::vector<std::pair<uint32_t, uint32_t>> chains; // (rows, bucket)
+    for (uint32_t bucket = 0; bucket < first.size(); bucket++) {
+        uint32_t num_rows = 0;
+        for (uint32_t i = first[bucket]; i != 0; i = next[i]) {
+            num_rows++;
+        }
+        if (num_rows >= min_rows) {
+            chains.emplace_back(num_rows, bucket);
+        }
+    }
+    std::sort(chains.begin(), chains.end(), std::greater<>());
+
+    const Columns& key_columns = _table_items->key_columns;
+    auto key_equals = [&](uint32_t lhs, uint32_t rhs) {
+        for (const auto& column : key_columns) {
+            if (column->compare_at(lhs, rhs, *column, 1) != 0) {
+                return false;
+            }
+        }
+        return true;
+    };
+    std::vector<uint32_t> rows;
+    for (const auto& [chain_rows, bucket] : chains) {
+        // The keys of this and the shorter chains can't have more rows than the found ones.
+        if (heavy_hitters.size() >= max_keys && chain_rows <= heavy_hitters.back().num_rows) {
+            break;
+        }
+        rows.clear();
+        for (uint32_t i = first[bucket]; i != 0; i = next[i]) {
+            rows.push_back(i);
+        }
+        // Count the rows of each of the keys of the chain, which are few unless the hash collides a lot.
+        // The chain is in the reverse order of the rows, so the last row is the first one of its key.
+        while (!rows.empty()) {
+            uint32_t key_row = rows.back();
+            uint32_t num_rows = 0;
+            size_t num_remaining = 0;
+            for (uint32_t row : rows) {
+                if (key_equals(row, key_row)) {
+                    num_rows++;
+                } else {
+                    rows[num_remaining++] = row;
+                }
+            }
+            rows.resize(num_remaining);
+            if (num_rows >= min_rows) {
+                heavy_hitters.push_back(JoinHeavyHitter{key_row, num_rows});
+            }
+        }
+        std::stable_sort(heavy_hitters.begin(), heavy_hitters.end(),
+                         [](const auto& lhs, const auto& rhs) { return lhs.num_rows > rhs.num_rows; });
+        if (heavy_hitters.size() > max_keys) {
+            heavy_hitters.resize(max_keys);
+        }
+    }
+    return heavy_hitters;
+}
+
 int64_t JoinHashTable::mem_usage() {
     int64_t usage = 0;
     if (_table_items->build_chunk != nullptr) {
@@ -337,6 +532,7 @@ int64_t JoinHashTable::mem_usage() {
     }
     usage += _table_items->first.capacity() * sizeof(uint32_t);
     usage += _table_items->next.capacity() * sizeof(uint32_t);
+    usage += _table_items->key_bitset.capacity();
     if (_table_items->build_pool != nullptr) {
         usage += _table_items->build_pool->total_reserved_bytes();
     }
@@ -545,6 +741,16 @@ JoinHashMapType JoinHashTable::_choose_join_hash_map() {
     }
 
     if (size == 1 && !_table_items->join_keys[0].is_null_safe_equal) {
+        bool is_semi_or_anti = (_table_items->join_type == TJoinOp::LEFT_SEMI_JOIN ||
+                                _table_items->join_type == TJoinOp::LEFT_ANTI_JOIN) &&
+                               !_table_items->with_other_conjunct;
+        if (is_semi_or_anti && _table_items->join_keys[0].type->type == TYPE_INT && _init_key_bitset<TYPE_INT>()) {
+            return JoinHashMapType::bitset32;
+        }
+        if (is_semi_or_anti && _table_items->join_keys[0].type->type == TYPE_BIGINT &&
+            _init_key_bitset<TYPE_BIGINT>()) {
+            return JoinHashMapType::bitset64;
+        }
         switch (_table_items->join_keys[0].type->type) {
         case PrimitiveType::TYPE_BOOLEAN:
             return JoinHashMapType::keyboolean;
@@ -585,17 +791,37 @@ JoinHashMapType JoinHashTable::_choose_join_hash_map() {
     }
 
     size_t total_size_in_byte = 0;
+    // The short string keys are packed into the fixed size keys as well, by the max length of the build keys.
+    std::vector<int32_t> key_string_max_lengths(size, -1);
+    bool has_string_key = false;
 
-    for (auto& join_key : _table_items->join_keys) {
+    for (size_t i = 0; i < size; i++) {
+        const auto& join_key = _table_items->join_keys[i];
         if (join_key.is_null_safe_equal) {
             total_size_in_byte += 1;
         }
         size_t s = _get_size_of_fixed_and_contiguous_type(join_key.type->type);
         if (s > 0) {
             total_size_in_byte += s;
-        } else {
+            continue;
+        }
+        // The length byte and the bytes of the strings.
+        int32_t max_length = total_size_in_byte + 1 < sizeof(int128_t)
+                                     ? _get_max_string_key_length(i, sizeof(int128_t) - total_size_in_byte - 1)
+                                     : -1;
+        if (max_length < 0) {
             return JoinHashMapType::slice;
         }
+        key_string_max_lengths[i] = max_length;
+        has_string_key = true;
+        total_size_in_byte += 1 + max_length;
+    }
+
+    if (total_size_in_byte > sizeof(int128_t)) {
+        return JoinHashMapType::slice;
+    }
+    if (has_string_key) {
+        _table_items->key_string_max_lengths = std::move(key_string_max_lengths);
     }
 
     if (total_size_in_byte <= 4) {
@@ -611,6 +837,80 @@ JoinHashMapType JoinHashTable::_choose_join_hash_map() {
     return JoinHashMapType::slice;
 }
 
+template <PrimitiveType PT>
+bool JoinHashTable::_init_key_bitset() {
+    using ColumnType = typename RunTimeTypeTraits<PT>::ColumnType;
+    // Bounded so that the bit offsets fit the signed 32 bits lanes of the probe.
+    const auto max_bytes = std::min<int64_t>(config::semi_join_bitset_max_bytes, 1L << 28);
+    if (max_bytes <= 0) {
+        return false;
+    }
+
+    const ColumnPtr& key_column = _table_items->key_columns[0];
+    const auto& data = down_cast<const ColumnType*>(ColumnHelper::get_data_column(key_column.get()))->get_data();
+    const uint8_t* nulls = nullptr;
+    if (key_column->is_nullable()) {
+        nulls = down_cast<const NullableColumn*>(key_column.get())->null_column()->get_data().data();
+    }
+    // The row 0 is not a build row.
+    int64_t min_value = std::numeric_limits<int64_t>::max();
+    int64_t max_value = std::numeric_limits<int64_t>::min();
+    for (size_t i = 1; i < _table_items->row_count + 1; i++) {
+        if (nulls == nullptr || nulls[i] == 0) {
+            min_value = std::min<int64_t>(min_value, data[i]);
+            max_value = std::max<int64_t>(max_value, data[i]);
+        }
+    }
+    if (min_value > max_value) {
+        // All the keys are null, nothing matches.
+        min_value = max_value = 0;
+    }
+
+    // Computed as unsigned, which doesn't overflow for the full range of BIGINT.
+    uint64_t max_offset = static_cast<uint64_t>(max_value) - static_cast<uint64_t>(min_value);
+    if (max_offset >= static_cast<uint64_t>(max_bytes) * 8) {
+        return false;
+    }
+    uint64_t range = max_offset + 1;
+    uint64_t hash_table_bytes =
+            (JoinHashMapHelper::calc_bucket_size(_table_items->row_count + 1) + _table_items->row_count + 1) *
+            sizeof(uint32_t);
+    if ((range + 7) / 8 > hash_table_bytes) {
+        return false;
+    }
+    _table_items->key_bitset_min = min_value;
+    _table_items->key_bitset_range = range;
+    return true;
+}
+
+int32_t JoinHashTable::_get_max_string_key_length(size_t key_index, size_t limit) {
+    PrimitiveType type = _table_items->join_keys[key_index].type->type;
+    if (type != TYPE_VARCHAR && type != TYPE_CHAR) {
+        return -1;
+    }
+    const ColumnPtr& key_column = _table_items->key_columns[key_index];
+    const Column* data_column = ColumnHelper::get_data_column(key_column.get());
+    if (data_column->is_large_binary()) {
+        return -1;
+    }
+    const auto& offsets = down_cast<const BinaryColumn*>(data_column)->get_offset();
+    const uint8_t* nulls = nullptr;
+    if (key_column->is_nullable()) {
+        nulls = down_cast<const NullableColumn*>(key_column.get())->null_column()->get_data().data();
+    }
+    // The row 0 is not a build row, and the null rows are not packed by their strings.
+    uint32_t max_length = 0;
+    for (size_t i = 1; i < _table_items->row_count + 1; i++) {
+        if (nulls == nullptr || nulls[i] == 0) {
+            max_length = std::max<uint32_t>(max_length, offsets[i + 1] - offsets[i]);
+            if (max_length > limit) {
+                return -1;
+            }
+        }
+    }
+    return static_cast<int32_t>(max_length);
+}
+
 size_t JoinHashTable::_get_size_of_fixed_and_contiguous_type(PrimitiveType data_type) {
     switch (data_type) {
     case PrimitiveType::TYPE_BOOLEAN:
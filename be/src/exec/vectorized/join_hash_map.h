@@ -7,6 +7,7 @@
 #include <runtime/runtime_state.h>
 
 #include <cstdint>
+#include <functional>
 
 #include "column/chunk.h"
 #include "column/column_hash.h"
@@ -16,6 +17,13 @@
 #if defined(__aarch64__)
 #include "arm_acle.h"
 #endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+namespace starrocks {
+class ThreadPool;
+} // namespace starrocks
+
 namespace starrocks::vectorized {
 
 class ColumnRef;
@@ -40,7 +48,9 @@ class ColumnRef;
     M(slice)                       \
     M(fixed32)                     \
     M(fixed64)                     \
-    M(fixed128)
+    M(fixed128)                    \
+    M(bitset32)                    \
+    M(bitset64)
 
 enum class JoinHashMapType {
     empty,
@@ -61,8 +71,10 @@ enum class JoinHashMapType {
     keydecimal128,
     slice,
     fixed32, // 4 bytes
-    fixed64, // 8 bytes
-    fixed128 // 16 bytes
+    fixed64,  // 8 bytes
+    fixed128, // 16 bytes
+    bitset32, // left semi/anti join on a 4 bytes key of small range
+    bitset64  // left semi/anti join on a 8 bytes key of small range
 };
 
 enum class JoinMatchFlag { NORMAL, ALL_NOT_MATCH, ALL_MATCH_ONE, MOST_MATCH_ONE };
@@ -98,6 +110,11 @@ struct JoinHashTableItems {
     Buffer<uint32_t> next;
     Buffer<Slice> build_slice;
     ColumnPtr build_key_column;
+    // The bitset of the build keys of the bitset hash maps instead of "first" and "next": the bit i is set if
+    // key_bitset_min + i is a build key, for i in [0, key_bitset_range). It's padded to be read 4 bytes at a time.
+    Buffer<uint8_t> key_bitset;
+    int64_t key_bitset_min = 0;
+    uint64_t key_bitset_range = 0;
     uint32_t bucket_size = 0;
     uint32_t row_count = 0; // real row count
     size_t build_column_count = 0;
@@ -112,6 +129,9 @@ struct JoinHashTableItems {
 
     std::unique_ptr<MemPool> build_pool = nullptr;
     std::vector<JoinKeyDesc> join_keys;
+    // The max length of the build keys of each string key packed into the fixed size keys, and -1 for the other
+    // keys. Empty if no string key is packed.
+    std::vector<int32_t> key_string_max_lengths;
 
     RuntimeProfile::Counter* output_build_column_timer = nullptr;
 };
@@ -152,11 +172,16 @@ struct HashTableProbeState {
     uint32_t cur_probe_index = 0;
     uint32_t cur_row_match_count = 0;
 
+    // Whether the buckets and the chain heads are prefetched ahead of the probe,
+    // it's decided by the size of the hash table and the type of the hash map.
+    bool prefetch_probe = false;
+
     std::unique_ptr<MemPool> probe_pool = nullptr;
 
     RuntimeProfile::Counter* search_ht_timer = nullptr;
     RuntimeProfile::Counter* output_probe_column_timer = nullptr;
     RuntimeProfile::Counter* output_tuple_column_timer = nullptr;
+    RuntimeProfile::Counter* prefetch_probe_rows = nullptr;
 
     HashTableProbeState() = default;
     ~HashTableProbeState() = default;
@@ -181,10 +206,12 @@ struct HashTableProbeState {
               has_remain(rhs.has_remain),
               cur_probe_index(rhs.cur_probe_index),
               cur_row_match_count(rhs.cur_row_match_count),
+              prefetch_probe(rhs.prefetch_probe),
               probe_pool(rhs.probe_pool == nullptr ? nullptr : std::make_unique<MemPool>()),
               search_ht_timer(rhs.search_ht_timer),
               output_probe_column_timer(rhs.output_probe_column_timer),
-              output_tuple_column_timer(rhs.output_tuple_column_timer) {}
+              output_tuple_column_timer(rhs.output_tuple_column_timer),
+              prefetch_probe_rows(rhs.prefetch_probe_rows) {}
 
     // Disable copy assignment.
     HashTableProbeState& operator=(const HashTableProbeState& rhs) = delete;
@@ -208,6 +235,7 @@ struct HashTableParam {
     RuntimeProfile::Counter* output_build_column_timer = nullptr;
     RuntimeProfile::Counter* output_probe_column_timer = nullptr;
     RuntimeProfile::Counter* output_tuple_column_timer = nullptr;
+    RuntimeProfile::Counter* prefetch_probe_rows = nullptr;
 };
 
 template <class T>
@@ -283,8 +311,11 @@ public:
 
     // combine keys into fixed size key by column.
     template <PrimitiveType PT>
+    // The i-th key is a string packed by serialize_packed_string_key if key_string_max_lengths[i] >= 0,
+    // see JoinHashTableItems::key_string_max_lengths.
     static void serialize_fixed_size_key_column(const Columns& key_columns, Column* fixed_size_key_column,
-                                                uint32_t start, uint32_t count) {
+                                                uint32_t start, uint32_t count,
+                                                const std::vector<int32_t>& key_string_max_lengths = {}) {
         using CppType = typename RunTimeTypeTraits<PT>::CppType;
         using ColumnType = typename RunTimeTypeTraits<PT>::ColumnType;
 
@@ -293,13 +324,159 @@ public:
 
         const size_t byte_interval = sizeof(CppType);
         size_t byte_offset = 0;
-        for (const auto& key_col : key_columns) {
-            size_t offset = key_col->serialize_batch_at_interval(buf, byte_offset, byte_interval, start, count);
+        for (size_t i = 0; i < key_columns.size(); i++) {
+            const auto& key_col = key_columns[i];
+            size_t offset;
+            if (i < key_string_max_lengths.size() && key_string_max_lengths[i] >= 0) {
+                offset = serialize_packed_string_key(*key_col, key_string_max_lengths[i], buf, byte_offset,
+                                                     byte_interval, start, count);
+            } else {
+                offset = key_col->serialize_batch_at_interval(buf, byte_offset, byte_interval, start, count);
+            }
             byte_offset += offset;
         }
     }
+
+    // Serialize the strings of the rows [start, start + count) of |key_column| as the length byte followed by the
+    // bytes zero-padded to |max_length|, so that two packed keys are equal iff the strings are. A string longer
+    // than |max_length| is left zeros and must not be linked or probed, see mark_unpacked_string_keys.
+    // A nullable |key_column|, i.e. a null safe key, is prefixed with the null flag. Return the packed size.
+    static size_t serialize_packed_string_key(const Column& key_column, int32_t max_length, uint8_t* dst,
+                                              size_t byte_offset, size_t byte_interval, uint32_t start,
+                                              uint32_t count);
+
+    // Set is_nulls[i] of the rows [0, count) whose string keys are too long to be packed, which match no build key.
+    static void mark_unpacked_string_keys(const Columns& key_columns,
+                                          const std::vector<int32_t>& key_string_max_lengths, uint32_t count,
+                                          uint8_t* is_nulls);
+
+    // The bucket number of a row which isn't linked into the hash table, e.g. a row with null keys.
+    static constexpr uint32_t NULL_BUCKET = UINT32_MAX;
+
+    // Return the pool to construct the hash table of |row_count| rows in parallel,
+    // or nullptr if it's too small to be worth it.
+    static ThreadPool* parallel_build_pool(uint32_t row_count);
+
+    // Run task(0), ..., task(num_tasks - 1) on |pool| and the calling thread, and wait for all of them.
+    static void run_in_parallel(ThreadPool* pool, size_t num_tasks, const std::function<void(size_t)>& task);
+
+    // Link the rows [1, row_count] into the bucket chains with the threads of |pool|, which is a radix build:
+    // 1. The rows are split into ranges, and the task of each range calculates the bucket numbers of its rows by
+    //    |calc_buckets(start, count, buckets)| and counts the rows of each partition, which is decided by the high
+    //    bits of the bucket number. Then the row indexes are scattered by partition.
+    // 2. The task of each partition links its rows. The partitions own disjoint ranges of buckets, and the rows
+    //    are linked in ascending order, so the bucket chains are the same as the ones built by a single thread.
+    // All the memory is allocated by the calling thread.
+    template <typename CalcBucketsFunc>
+    static void parallel_link_bucket_chains(ThreadPool* pool, JoinHashTableItems* table_items,
+                                            const CalcBucketsFunc& calc_buckets);
+
+    // The prefetching probe loads the bucket of a row this many rows ahead.
+    static constexpr size_t PROBE_PREFETCH_DISTANCE = 16;
+
+    // Whether the buckets and the build keys of |table_items| are so much larger than the cache
+    // that the probe is bound by the memory latency and is worth prefetching.
+    static bool need_prefetch_probe(const JoinHashTableItems& table_items, size_t key_size);
+
+    // Set probe_state->next[i] to the head of the chain of probe_state->buckets[i], or 0 if is_nulls[i] is set.
+    // |is_nulls| may be nullptr.
+    static void lookup_chain_heads(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
+                                   const uint8_t* is_nulls);
+
+    // Prefetch the build keys and the next chain entries of the chain heads in probe_state->next,
+    // so that the chain walk following it doesn't wait for the memory row by row.
+    template <typename CppType>
+    static void prefetch_chain_heads(const JoinHashTableItems& table_items, const HashTableProbeState& probe_state,
+                                     const Buffer<CppType>& build_data);
+
+private:
+    static size_t _parallel_build_dop(ThreadPool* pool);
 };
 
+template <typename CppType>
+void JoinHashMapHelper::prefetch_chain_heads(const JoinHashTableItems& table_items,
+                                             const HashTableProbeState& probe_state,
+                                             const Buffer<CppType>& build_data) {
+    const uint32_t* next = probe_state.next.data();
+    for (size_t i = 0; i < probe_state.probe_row_count; i++) {
+        if (next[i] != 0) {
+            __builtin_prefetch(build_data.data() + next[i]);
+            __builtin_prefetch(table_items.next.data() + next[i]);
+        }
+    }
+}
+
+template <typename CalcBucketsFunc>
+void JoinHashMapHelper::parallel_link_bucket_chains(ThreadPool* pool, JoinHashTableItems* table_items,
+                                                    const CalcBucketsFunc& calc_buckets) {
+    const uint32_t row_count = table_items->row_count;
+    const uint32_t bucket_size = table_items->bucket_size;
+    const size_t num_ranges = _parallel_build_dop(pool);
+    const uint32_t range_size = (row_count + num_ranges - 1) / num_ranges;
+    // Both bucket_size and num_partitions are powers of two.
+    size_t num_partitions = 1;
+    while (num_partitions < num_ranges && num_partitions < bucket_size) {
+        num_partitions <<= 1;
+    }
+    const int partition_shift = __builtin_ctz(bucket_size) - __builtin_ctz(num_partitions);
+
+    Buffer<uint32_t> bucket_nums(row_count + 1);
+    // The rows of partition p from range r are put at [offsets[r * num_partitions + p], ...).
+    std::vector<uint32_t> offsets(num_ranges * num_partitions, 0);
+    run_in_parallel(pool, num_ranges, [&](size_t range) {
+        uint32_t start = 1 + range * range_size;
+        if (start > row_count) {
+            return;
+        }
+        uint32_t count = std::min(range_size, row_count + 1 - start);
+        calc_buckets(start, count, bucket_nums.data() + start);
+        uint32_t* counts = offsets.data() + range * num_partitions;
+        for (uint32_t i = start; i < start + count; i++) {
+            if (bucket_nums[i] != NULL_BUCKET) {
+                counts[bucket_nums[i] >> partition_shift]++;
+            }
+        }
+    });
+
+    std::vector<uint32_t> partition_begins(num_partitions + 1, 0);
+    uint32_t offset = 0;
+    for (size_t p = 0; p < num_partitions; p++) {
+        partition_begins[p] = offset;
+        for (size_t r = 0; r < num_ranges; r++) {
+            uint32_t count = offsets[r * num_partitions + p];
+            offsets[r * num_partitions + p] = offset;
+            offset += count;
+        }
+    }
+    partition_begins[num_partitions] = offset;
+
+    Buffer<uint32_t> partitioned_rows(offset);
+    run_in_parallel(pool, num_ranges, [&](size_t range) {
+        uint32_t start = 1 + range * range_size;
+        if (start > row_count) {
+            return;
+        }
+        uint32_t end = std::min(start + range_size, row_count + 1);
+        uint32_t* range_offsets = offsets.data() + range * num_partitions;
+        for (uint32_t i = start; i < end; i++) {
+            if (bucket_nums[i] != NULL_BUCKET) {
+                partitioned_rows[range_offsets[bucket_nums[i] >> partition_shift]++] = i;
+            }
+        }
+    });
+
+    run_in_parallel(pool, num_partitions, [&](size_t partition) {
+        auto* first = table_items->first.data();
+        auto* next = table_items->next.data();
+        for (uint32_t j = partition_begins[partition]; j < partition_begins[partition + 1]; j++) {
+            uint32_t i = partitioned_rows[j];
+            uint32_t bucket_num = bucket_nums[i];
+            next[i] = first[bucket_num];
+            first[bucket_num] = i;
+        }
+    });
+}
+
 template <PrimitiveType PT>
 class JoinBuildFunc {
 public:
@@ -324,6 +501,25 @@ public:
                                      HashTableProbeState* probe_state);
 };
 
+// The build of the LEFT SEMI and LEFT ANTI joins without other conjuncts on an integer key of small range, which
+// only needs to know whether a key exists, so a bit per key in JoinHashTableItems::key_bitset replaces the buckets.
+template <PrimitiveType PT>
+class BitsetJoinBuildFunc {
+public:
+    using CppType = typename RunTimeTypeTraits<PT>::CppType;
+    using ColumnType = typename RunTimeTypeTraits<PT>::ColumnType;
+
+    // The bytes read past the bits of the bitset by the gather of BitsetJoinProbeFunc.
+    static constexpr size_t BITSET_PADDING = 4;
+
+    static void prepare(RuntimeState* runtime, JoinHashTableItems* table_items);
+    static const Buffer<CppType>& get_key_data(const JoinHashTableItems& table_items) {
+        return DirectMappingJoinBuildFunc<PT>::get_key_data(table_items);
+    }
+    static void construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                     HashTableProbeState* probe_state);
+};
+
 template <PrimitiveType PT>
 class FixedSizeJoinBuildFunc {
 public:
@@ -369,6 +565,9 @@ public:
     using CppType = typename RunTimeTypeTraits<PT>::CppType;
     using ColumnType = typename RunTimeTypeTraits<PT>::ColumnType;
 
+    // Whether the probe may prefetch the buckets, see JoinHashMapHelper::need_prefetch_probe.
+    static constexpr bool support_prefetch = true;
+
     static void prepare(RuntimeState* state, HashTableProbeState* probe_state) {}
     static void lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state);
     static const Buffer<CppType>& get_key_data(const HashTableProbeState& probe_state);
@@ -381,18 +580,43 @@ public:
     using CppType = typename RunTimeTypeTraits<PT>::CppType;
     using ColumnType = typename RunTimeTypeTraits<PT>::ColumnType;
 
+    // The table of a direct mapping is small enough to stay in cache.
+    static constexpr bool support_prefetch = false;
+
     static void prepare(RuntimeState* state, HashTableProbeState* probe_state) {}
     static void lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state);
     static const Buffer<CppType>& get_key_data(const HashTableProbeState& probe_state);
     static bool equal(const CppType& x, const CppType& y) { return true; }
 };
 
+// Set the chain head of a probe row to 1 if its key is in the bitset, and 0 otherwise. Any key of the chain
+// matches, so the semi/anti probes stop at the head and never follow "next".
+template <PrimitiveType PT>
+class BitsetJoinProbeFunc {
+public:
+    using CppType = typename RunTimeTypeTraits<PT>::CppType;
+    using ColumnType = typename RunTimeTypeTraits<PT>::ColumnType;
+
+    // The bitset is small enough to stay in cache.
+    static constexpr bool support_prefetch = false;
+
+    static void prepare(RuntimeState* state, HashTableProbeState* probe_state) {}
+    // Look up 8 keys at a time by gathering the bytes of their bits with AVX2.
+    static void lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state);
+    static const Buffer<CppType>& get_key_data(const HashTableProbeState& probe_state) {
+        return DirectMappingJoinProbeFunc<PT>::get_key_data(probe_state);
+    }
+    static bool equal(const CppType& x, const CppType& y) { return true; }
+};
+
 template <PrimitiveType PT>
 class FixedSizeJoinProbeFunc {
 public:
     using CppType = typename RunTimeTypeTraits<PT>::CppType;
     using ColumnType = typename RunTimeTypeTraits<PT>::ColumnType;
 
+    static constexpr bool support_prefetch = true;
+
     static void prepare(RuntimeState* state, HashTableProbeState* probe_state) {
         probe_state->is_nulls.resize(state->chunk_size());
         probe_state->probe_key_column = ColumnType::create(state->chunk_size());
@@ -416,6 +640,8 @@ private:
 
 class SerializedJoinProbeFunc {
 public:
+    static constexpr bool support_prefetch = true;
+
     static const Buffer<Slice>& get_key_data(const HashTableProbeState& probe_state) { return probe_state.probe_slice; }
 
     static void prepare(RuntimeState* state, HashTableProbeState* probe_state) {
@@ -647,6 +873,14 @@ private:
 #define JoinHashMapForDirectMapping(PT) JoinHashMap<PT, DirectMappingJoinBuildFunc<PT>, DirectMappingJoinProbeFunc<PT>>
 #define JoinHashMapForFixedSizeKey(PT) JoinHashMap<PT, FixedSizeJoinBuildFunc<PT>, FixedSizeJoinProbeFunc<PT>>
 #define JoinHashMapForSerializedKey(PT) JoinHashMap<PT, SerializedJoinBuildFunc, SerializedJoinProbeFunc>
+#define JoinHashMapForBitset(PT) JoinHashMap<PT, BitsetJoinBuildFunc<PT>, BitsetJoinProbeFunc<PT>>
+
+// A join key of many build rows, which a probe row of it is joined with all of.
+struct JoinHeavyHitter {
+    // The first build row of the key.
+    uint32_t row;
+    uint32_t num_rows;
+};
 
 class JoinHashTable {
 public:
@@ -664,7 +898,8 @@ public:
     // and the different probe state from this.
     JoinHashTable clone_readable_table();
     void set_probe_profile(RuntimeProfile::Counter* search_ht_timer, RuntimeProfile::Counter* output_probe_column_timer,
-                           RuntimeProfile::Counter* output_tuple_column_timer);
+                           RuntimeProfile::Counter* output_tuple_column_timer,
+                           RuntimeProfile::Counter* prefetch_probe_rows);
 
     void create(const HashTableParam& param);
     void close();
@@ -684,12 +919,24 @@ public:
 
     void remove_duplicate_index(Column::Filter* filter);
 
+    // At most |max_keys| build keys of the most rows and at least |min_rows| rows each, in the descending
+    // order of the rows, found by counting the keys of the longest bucket chains.
+    std::vector<JoinHeavyHitter> find_heavy_hitters(size_t max_keys, uint32_t min_rows) const;
+
     int64_t mem_usage();
 
 private:
     JoinHashMapType _choose_join_hash_map();
+    // Whether the single key of a LEFT SEMI or LEFT ANTI join takes a bitset no larger than
+    // semi_join_bitset_max_bytes and the hash table, if so the range of the bitset is set to _table_items.
+    template <PrimitiveType PT>
+    bool _init_key_bitset();
     static size_t _get_size_of_fixed_and_contiguous_type(PrimitiveType data_type);
 
+    // The max length of the build keys of the string key |key_index|, or -1 if it's not a string key or any of
+    // them is longer than |limit|.
+    int32_t _get_max_string_key_length(size_t key_index, size_t limit);
+
     Status _upgrade_key_columns_if_overflow();
 
     void _remove_duplicate_index_for_left_outer_join(Column::Filter* filter);
@@ -720,6 +967,8 @@ private:
     std::unique_ptr<JoinHashMapForFixedSizeKey(TYPE_INT)> _fixed32 = nullptr;
     std::unique_ptr<JoinHashMapForFixedSizeKey(TYPE_BIGINT)> _fixed64 = nullptr;
     std::unique_ptr<JoinHashMapForFixedSizeKey(TYPE_LARGEINT)> _fixed128 = nullptr;
+    std::unique_ptr<JoinHashMapForBitset(TYPE_INT)> _bitset32 = nullptr;
+    std::unique_ptr<JoinHashMapForBitset(TYPE_BIGINT)> _bitset64 = nullptr;
 
     JoinHashMapType _hash_map_type = JoinHashMapType::empty;
     bool _need_create_tuple_columns = true;
@@ -36,6 +36,23 @@ template <PrimitiveType PT>
 void JoinBuildFunc<PT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                              HashTableProbeState* probe_state) {
     auto& data = get_key_data(*table_items);
+    if (auto* pool = JoinHashMapHelper::parallel_build_pool(table_items->row_count); pool != nullptr) {
+        const uint8_t* nulls = nullptr;
+        if (table_items->key_columns[0]->is_nullable()) {
+            auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
+            nulls = nullable_column->null_column()->get_data().data();
+        }
+        const uint32_t bucket_size = table_items->bucket_size;
+        JoinHashMapHelper::parallel_link_bucket_chains(
+                pool, table_items, [&](uint32_t start, uint32_t count, uint32_t* buckets) {
+                    for (uint32_t i = 0; i < count; i++) {
+                        buckets[i] = (nulls != nullptr && nulls[start + i] != 0)
+                                             ? JoinHashMapHelper::NULL_BUCKET
+                                             : JoinHashMapHelper::calc_bucket_num<CppType>(data[start + i], bucket_size);
+                    }
+                });
+        return;
+    }
     if (table_items->key_columns[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
         auto& null_array = nullable_column->null_column()->get_data();
@@ -100,6 +117,31 @@ void DirectMappingJoinBuildFunc<PT>::construct_hash_table(RuntimeState* state, J
     }
 }
 
+template <PrimitiveType PT>
+void BitsetJoinBuildFunc<PT>::prepare(RuntimeState* runtime, JoinHashTableItems* table_items) {
+    table_items->key_bitset.resize((table_items->key_bitset_range + 7) / 8 + BITSET_PADDING, 0);
+}
+
+template <PrimitiveType PT>
+void BitsetJoinBuildFunc<PT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                                   HashTableProbeState* probe_state) {
+    auto& data = get_key_data(*table_items);
+    const uint8_t* nulls = nullptr;
+    if (table_items->key_columns[0]->is_nullable()) {
+        auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
+        nulls = nullable_column->null_column()->get_data().data();
+    }
+    const auto min_value = static_cast<uint64_t>(table_items->key_bitset_min);
+    uint8_t* bitset = table_items->key_bitset.data();
+    for (size_t i = 1; i < table_items->row_count + 1; i++) {
+        if (nulls == nullptr || nulls[i] == 0) {
+            uint64_t offset = static_cast<uint64_t>(static_cast<int64_t>(data[i])) - min_value;
+            DCHECK_LT(offset, table_items->key_bitset_range);
+            bitset[offset >> 3] |= 1 << (offset & 7);
+        }
+    }
+}
+
 template <PrimitiveType PT>
 void FixedSizeJoinBuildFunc<PT>::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
@@ -130,6 +172,29 @@ void FixedSizeJoinBuildFunc<PT>::construct_hash_table(RuntimeState* state, JoinH
         }
     }
 
+    if (auto* pool = JoinHashMapHelper::parallel_build_pool(row_count); pool != nullptr) {
+        const uint32_t bucket_size = table_items->bucket_size;
+        JoinHashMapHelper::parallel_link_bucket_chains(
+                pool, table_items, [&](uint32_t start, uint32_t count, uint32_t* buckets) {
+                    JoinHashMapHelper::serialize_fixed_size_key_column<PT>(
+                            data_columns, table_items->build_key_column.get(), start, count,
+                            table_items->key_string_max_lengths);
+                    const auto& data = get_key_data(*table_items);
+                    for (uint32_t i = 0; i < count; i++) {
+                        buckets[i] = JoinHashMapHelper::calc_bucket_num<CppType>(data[start + i], bucket_size);
+                    }
+                    for (const auto& null_column : null_columns) {
+                        const auto& nulls = null_column->get_data();
+                        for (uint32_t i = 0; i < count; i++) {
+                            if (nulls[start + i] != 0) {
+                                buckets[i] = JoinHashMapHelper::NULL_BUCKET;
+                            }
+                        }
+                    }
+                });
+        return;
+    }
+
     // serialize and build hash table
     uint32_t quo = row_count / state->chunk_size();
     uint32_t rem = row_count % state->chunk_size();
@@ -153,7 +218,7 @@ template <PrimitiveType PT>
 void FixedSizeJoinBuildFunc<PT>::_build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
                                                 const Columns& data_columns, uint32_t start, uint32_t count) {
     JoinHashMapHelper::serialize_fixed_size_key_column<PT>(data_columns, table_items->build_key_column.get(), start,
-                                                           count);
+                                                           count, table_items->key_string_max_lengths);
 
     const auto& data = get_key_data(*table_items);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
@@ -179,7 +244,7 @@ void FixedSizeJoinBuildFunc<PT>::_build_nullable_columns(JoinHashTableItems* tab
     }
 
     JoinHashMapHelper::serialize_fixed_size_key_column<PT>(data_columns, table_items->build_key_column.get(), start,
-                                                           count);
+                                                           count, table_items->key_string_max_lengths);
     const auto& data = get_key_data(*table_items);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
 
@@ -238,8 +303,56 @@ const Buffer<typename DirectMappingJoinProbeFunc<PT>::CppType>& DirectMappingJoi
 }
 
 template <PrimitiveType PT>
-void JoinProbeFunc<PT>::lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state) {
+void BitsetJoinProbeFunc<PT>::lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state) {
     size_t probe_row_count = probe_state->probe_row_count;
+    auto& data = get_key_data(*probe_state);
+    uint32_t* next = probe_state->next.data();
+    const uint8_t* bitset = table_items.key_bitset.data();
+    const auto min_value = static_cast<uint64_t>(table_items.key_bitset_min);
+    const uint64_t range = table_items.key_bitset_range;
+
+    size_t i = 0;
+#ifdef __AVX2__
+    if constexpr (sizeof(CppType) == 4) {
+        // The offsets are compared with the range as unsigned, by comparing them as signed with the sign bits
+        // flipped. The keys below the min wrap around to the large offsets.
+        const __m256i sign_bits = _mm256_set1_epi32(INT32_MIN);
+        const __m256i min_values = _mm256_set1_epi32(static_cast<int32_t>(min_value));
+        const __m256i ranges = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int32_t>(range)), sign_bits);
+        const __m256i sevens = _mm256_set1_epi32(7);
+        const __m256i ones = _mm256_set1_epi32(1);
+        for (; i + 8 <= probe_row_count; i += 8) {
+            __m256i keys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.data() + i));
+            __m256i offsets = _mm256_sub_epi32(keys, min_values);
+            __m256i in_range = _mm256_cmpgt_epi32(ranges, _mm256_xor_si256(offsets, sign_bits));
+            // The lanes out of the range gather the first bytes, and are masked out.
+            __m256i byte_offsets = _mm256_and_si256(_mm256_srli_epi32(offsets, 3), in_range);
+            __m256i words = _mm256_i32gather_epi32(reinterpret_cast<const int*>(bitset), byte_offsets, 1);
+            __m256i bits = _mm256_and_si256(_mm256_srlv_epi32(words, _mm256_and_si256(offsets, sevens)), ones);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(next + i), _mm256_and_si256(bits, in_range));
+        }
+    }
+#endif
+    for (; i < probe_row_count; i++) {
+        uint64_t offset = static_cast<uint64_t>(static_cast<int64_t>(data[i])) - min_value;
+        next[i] = offset < range ? (bitset[offset >> 3] >> (offset & 7)) & 1 : 0;
+    }
+
+    probe_state->null_array = nullptr;
+    if ((*probe_state->key_columns)[0]->is_nullable()) {
+        auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>((*probe_state->key_columns)[0]);
+        if (nullable_column->has_null()) {
+            auto& null_array = nullable_column->null_column()->get_data();
+            for (i = 0; i < probe_row_count; i++) {
+                next[i] &= null_array[i] == 0;
+            }
+            probe_state->null_array = &null_array;
+        }
+    }
+}
+
+template <PrimitiveType PT>
+void JoinProbeFunc<PT>::lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state) {
     auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, data.size());
 
@@ -248,26 +361,16 @@ void JoinProbeFunc<PT>::lookup_init(const JoinHashTableItems& table_items, HashT
 
         if (nullable_column->has_null()) {
             auto& null_array = nullable_column->null_column()->get_data();
-            for (size_t i = 0; i < probe_row_count; i++) {
-                if (null_array[i] == 0) {
-                    probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-                } else {
-                    probe_state->next[i] = 0;
-                }
-            }
+            JoinHashMapHelper::lookup_chain_heads(table_items, probe_state, null_array.data());
             probe_state->null_array = &nullable_column->null_column()->get_data();
         } else {
-            for (size_t i = 0; i < probe_row_count; i++) {
-                probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-            }
+            JoinHashMapHelper::lookup_chain_heads(table_items, probe_state, nullptr);
             probe_state->null_array = nullptr;
         }
         return;
     }
 
-    for (size_t i = 0; i < probe_row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_chain_heads(table_items, probe_state, nullptr);
     probe_state->null_array = nullptr;
 }
 
@@ -308,8 +411,8 @@ void FixedSizeJoinProbeFunc<PT>::lookup_init(const JoinHashTableItems& table_ite
         }
     }
 
-    // serialize and init search
-    if (!null_columns.empty()) {
+    // serialize and init search, the rows of the strings too long to be packed are excluded as the null rows.
+    if (!null_columns.empty() || !table_items.key_string_max_lengths.empty()) {
         _probe_nullable_column(table_items, probe_state, data_columns, null_columns);
     } else {
         _probe_column(table_items, probe_state, data_columns);
@@ -322,13 +425,11 @@ void FixedSizeJoinProbeFunc<PT>::_probe_column(const JoinHashTableItems& table_i
     uint32_t row_count = probe_state->probe_row_count;
 
     JoinHashMapHelper::serialize_fixed_size_key_column<PT>(data_columns, probe_state->probe_key_column.get(), 0,
-                                                           row_count);
+                                                           row_count, table_items.key_string_max_lengths);
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
 
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_chain_heads(table_items, probe_state, nullptr);
 }
 
 template <PrimitiveType PT>
@@ -337,27 +438,29 @@ void FixedSizeJoinProbeFunc<PT>::_probe_nullable_column(const JoinHashTableItems
                                                         const NullColumns& null_columns) {
     uint32_t row_count = probe_state->probe_row_count;
 
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->is_nulls[i] = null_columns[0]->get_data()[i];
+    if (null_columns.empty()) {
+        memset(probe_state->is_nulls.data(), 0, row_count);
+    } else {
+        for (uint32_t i = 0; i < row_count; i++) {
+            probe_state->is_nulls[i] = null_columns[0]->get_data()[i];
+        }
     }
     for (uint32_t i = 1; i < null_columns.size(); i++) {
         for (uint32_t j = 0; j < row_count; j++) {
             probe_state->is_nulls[j] |= null_columns[i]->get_data()[j];
         }
     }
+    if (!table_items.key_string_max_lengths.empty()) {
+        JoinHashMapHelper::mark_unpacked_string_keys(data_columns, table_items.key_string_max_lengths, row_count,
+                                                     probe_state->is_nulls.data());
+    }
 
     JoinHashMapHelper::serialize_fixed_size_key_column<PT>(data_columns, probe_state->probe_key_column.get(), 0,
-                                                           row_count);
+                                                           row_count, table_items.key_string_max_lengths);
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
 
-    for (uint32_t i = 0; i < row_count; i++) {
-        if (probe_state->is_nulls[i] == 0) {
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-        } else {
-            probe_state->next[i] = 0;
-        }
-    }
+    JoinHashMapHelper::lookup_chain_heads(table_items, probe_state, probe_state->is_nulls.data());
 }
 
 template <PrimitiveType PT, class BuildFunc, class ProbeFunc>
@@ -382,6 +485,10 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::probe_prepare(RuntimeState* state) {
     }
 
     ProbeFunc().prepare(state, _probe_state);
+
+    // build_prepare has sized the buckets, so the size of the hash table is known here.
+    _probe_state->prefetch_probe =
+            ProbeFunc::support_prefetch && JoinHashMapHelper::need_prefetch_probe(*_table_items, sizeof(CppType));
 }
 
 template <PrimitiveType PT, class BuildFunc, class ProbeFunc>
@@ -745,6 +852,9 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_search_ht(RuntimeState* state, Chun
 
         auto& build_data = BuildFunc().get_key_data(*_table_items);
         auto& probe_data = ProbeFunc().get_key_data(*_probe_state);
+        if (_probe_state->prefetch_probe) {
+            JoinHashMapHelper::prefetch_chain_heads<CppType>(*_table_items, *_probe_state, build_data);
+        }
         _search_ht_impl<true>(state, build_data, probe_data);
     } else {
         auto& build_data = BuildFunc().get_key_data(*_table_items);
@@ -477,26 +477,20 @@ Status JsonReader::_read_rows(Chunk* chunk, int32_t rows_to_read, int32_t* rows_
 }
 
 Status JsonReader::_construct_row_in_object_order(simdjson::ondemand::object* row, Chunk* chunk) {
-    // make a copy for _slot_desc_dict.
-    auto slot_desc_dict(_slot_desc_dict);
+    _slot_found.assign(_slot_descs.size(), 0);
+    size_t num_found = 0;
     try {
-        std::ostringstream oss;
-
         for (auto field : *row) {
-            // TODO:This is ugly, but there's no good way to convert json field key to std::string.
-            // convert field key to std::string.
-            simdjson::ondemand::raw_json_string raw_key = field.key();
-            oss << raw_key;
-            auto key = oss.str();
-            oss.str("");
-
-            // look up key in the slot dict.
-            auto itr = slot_desc_dict.find(key);
-            if (itr == slot_desc_dict.end()) {
+            std::string_view key = field.unescaped_key();
+
+            // look up key in the slot dict, the duplicated keys are skipped.
+            auto itr = _slot_desc_dict.find(key);
+            if (itr == _slot_desc_dict.end() || _slot_found[itr->second]) {
                 continue;
             }
 
-            auto slot_desc = itr->second;
+            size_t slot_idx = itr->second;
+            auto slot_desc = _slot_descs[slot_idx];
 
             auto column = chunk->get_column_by_slot_id(slot_desc->id());
             const auto& col_name = slot_desc->col_name();
@@ -506,8 +500,11 @@ Status JsonReader::_construct_row_in_object_order(simdjson::ondemand::object* ro
             // construct column with value.
             RETURN_IF_ERROR(_construct_column(val, column.get(), slot_desc->type(), col_name));
 
-            // delete the written column.
-            slot_desc_dict.erase(key);
+            _slot_found[slot_idx] = 1;
+            // The rest fields of the object are not needed if all the columns are constructed.
+            if (++num_found == _slot_desc_dict.size()) {
+                break;
+            }
         }
     } catch (simdjson::simdjson_error& e) {
         auto err_msg = strings::Substitute("construct row in object order failed, error: $0",
@@ -516,13 +513,15 @@ Status JsonReader::_construct_row_in_object_order(simdjson::ondemand::object* ro
     }
 
     // append null to the column without data.
-    for (auto& pair : slot_desc_dict) {
-        auto col_name = pair.first;
-        auto slot_desc = pair.second;
+    for (size_t i = 0; i < _slot_descs.size() && num_found < _slot_desc_dict.size(); i++) {
+        auto slot_desc = _slot_descs[i];
+        if (slot_desc == nullptr || _slot_found[i]) {
+            continue;
+        }
 
         auto column = chunk->get_column_by_slot_id(slot_desc->id());
 
-        if (col_name == "__op") {
+        if (slot_desc->col_name() == "__op") {
             // special treatment for __op column, fill default value '0' rather than null
             if (column->is_binary()) {
                 column->append_strings(std::vector{Slice{"0"}});
@@ -571,9 +570,9 @@ Status JsonReader::_construct_row_in_slot_order(simdjson::ondemand::object* row,
 Status JsonReader::_construct_row(simdjson::ondemand::object* row, Chunk* chunk) {
     if (_scanner->_json_paths.empty()) {
         // No json path.
-        // if size of _slot_desc is much more than (2x) number of object fields,
-        // using object as driven table to look up field key in _slot_desc_dict may get better performance.
-        if (_slot_descs.size() > row->count_fields() * 2) {
+        // Counting the fields of each object costs a scan of the object, so the way is chosen by the first
+        // object in _build_slot_descs.
+        if (_construct_in_object_order) {
             return _construct_row_in_object_order(row, chunk);
         } else {
             return _construct_row_in_slot_order(row, chunk);
@@ -639,38 +638,32 @@ Status JsonReader::_construct_row(simdjson::ondemand::object* row, Chunk* chunk)
 }
 
 Status JsonReader::_build_slot_descs() {
-    // build _slot_desc_dict.
+    std::unordered_map<std::string, SlotDescriptor*> slot_desc_dict;
     for (const auto& desc : _slot_descs) {
         if (desc == nullptr) {
             continue;
         }
-        _slot_desc_dict.emplace(desc->col_name(), desc);
+        slot_desc_dict.emplace(desc->col_name(), desc);
     }
 
-    // copy for modifying.
-    auto slot_desc_dict(_slot_desc_dict);
-
     std::vector<SlotDescriptor*> ordered_slot_descs;
     ordered_slot_descs.reserve(_slot_descs.size());
 
     // get the first row of json.
     simdjson::ondemand::object obj;
     RETURN_IF_ERROR(_parser->get_current(&obj));
-    std::ostringstream oss;
-    simdjson::ondemand::raw_json_string json_str;
+    size_t num_fields = 0;
 
     // Sort the column in the slot_descs as the key order in json document.
     for (auto field : obj) {
+        std::string key;
         try {
-            json_str = field.key();
+            key = field.unescaped_key().value();
         } catch (simdjson::simdjson_error& e) {
             // Nothing would be done if got any error.
             return Status::DataQualityError(Slice{simdjson::error_message(e.error())});
         }
-
-        oss << json_str;
-        auto key = oss.str();
-        oss.str("");
+        num_fields++;
 
         // Find the SlotDescriptor with the json document key.
         // Duplicated key in json would be skipped since the key has been erased before.
@@ -691,6 +684,15 @@ Status JsonReader::_build_slot_descs() {
 
     std::swap(ordered_slot_descs, _slot_descs);
 
+    for (size_t i = 0; i < _slot_descs.size(); i++) {
+        _slot_desc_dict.emplace(_slot_descs[i]->col_name(), i);
+    }
+    // If size of _slot_desc is much more than (2x) number of object fields, using object as driven table to
+    // look up field key in _slot_desc_dict may get better performance. Otherwise the fields are found in
+    // the order of _slot_descs, which is the key order of the first object, i.e. one pass over the object if
+    // the key order of the objects is stable.
+    _construct_in_object_order = _slot_descs.size() > num_fields * 2;
+
     return Status::OK();
 }
 
@@ -717,19 +719,20 @@ Status JsonReader::_read_and_parse_json() {
         SCOPED_RAW_TIMER(&_counter->file_read_ns);
         ASSIGN_OR_RETURN(_parser_buf, stream_file->pipe()->read());
 
-        if (_parser_buf->capacity < _parser_buf->remaining() + simdjson::SIMDJSON_PADDING) {
+        length = _parser_buf->remaining();
+        if (_parser_buf->capacity < length + simdjson::SIMDJSON_PADDING) {
             // For efficiency reasons, simdjson requires a string with a few bytes (simdjson::SIMDJSON_PADDING) at the end.
-            // Hence, a re-allocation is needed if the space is not enough.
-            auto buf = ByteBuffer::allocate(_parser_buf->remaining() + simdjson::SIMDJSON_PADDING);
-            buf->put_bytes(_parser_buf->ptr, _parser_buf->remaining());
-            buf->flip();
-            std::swap(buf, _parser_buf);
+            // Hence, a copy is needed if the space is not enough, to a buffer reused by the following messages.
+            if (_padded_buf.size() < length + simdjson::SIMDJSON_PADDING) {
+                _padded_buf.resize(std::max(_padded_buf.size() * 2, length + simdjson::SIMDJSON_PADDING));
+            }
+            memcpy(_padded_buf.data(), _parser_buf->ptr, length);
+            data = reinterpret_cast<uint8_t*>(_padded_buf.data());
+        } else {
+            data = reinterpret_cast<uint8_t*>(_parser_buf->ptr);
         }
     }
 
-    data = reinterpret_cast<uint8_t*>(_parser_buf->ptr);
-    length = _parser_buf->remaining();
-
 #endif
 
     // Check the content formart accroding to the first non-space character.
@@ -9,6 +9,7 @@
 #include "fs/fs.h"
 #include "runtime/stream_load/load_stream_mgr.h"
 #include "simdjson.h"
+#include "util/phmap/phmap.h"
 #include "util/raw_container.h"
 #include "util/slice.h"
 
@@ -91,7 +92,8 @@ private:
     Status _construct_column(simdjson::ondemand::value& value, Column* column, const TypeDescriptor& type_desc,
                              const std::string& col_name);
 
-    // _build_slot_descs builds _slot_descs as the order of first json object and builds _slot_desc_dict;
+    // _build_slot_descs builds _slot_descs as the order of first json object and builds _slot_desc_dict,
+    // and chooses the way to construct the rows by the first json object.
     Status _build_slot_descs();
 
 private:
@@ -103,12 +105,20 @@ private:
     std::shared_ptr<SequentialFile> _file;
     bool _closed;
     std::vector<SlotDescriptor*> _slot_descs;
-    std::unordered_map<std::string, SlotDescriptor*> _slot_desc_dict;
+    // column name -> index in _slot_descs, built by _build_slot_descs.
+    phmap::flat_hash_map<std::string, size_t> _slot_desc_dict;
+    // Whether to construct the rows by looking up the keys of the json object in _slot_desc_dict, instead
+    // of finding the fields of _slot_descs in the json object.
+    bool _construct_in_object_order = false;
+    // Whether the i-th slot of _slot_descs is found in the current json object.
+    std::vector<uint8_t> _slot_found;
 
     // For performance reason, the simdjson parser should be reused over several files.
     //https://github.com/simdjson/simdjson/blob/master/doc/performance.md
     simdjson::ondemand::parser _simdjson_parser;
     ByteBufferPtr _parser_buf;
+    // The buffer of the json messages without enough padding for simdjson, reused across messages.
+    raw::RawVector<char> _padded_buf;
     bool _is_ndjson = false;
 
     std::unique_ptr<JsonParser> _parser;
@@ -12,6 +12,7 @@
 #include "exec/scan_node.h"
 #include "exec/vectorized/olap_scan_prepare.h"
 #include "exec/vectorized/tablet_scanner.h"
+#include "exec/vectorized/topn_runtime_filter.h"
 #include "runtime/global_dict/parser.h"
 
 namespace starrocks {
@@ -74,6 +75,10 @@ public:
 
     const TOlapScanNode& thrift_olap_scan_node() const { return _olap_scan_node; }
 
+    // Added by the top-n sort above this node before decomposing it to pipeline.
+    void add_topn_runtime_filter(TopnRuntimeFilterPtr filter) { _topn_runtime_filters.emplace_back(std::move(filter)); }
+    const std::vector<TopnRuntimeFilterPtr>& topn_runtime_filters() const { return _topn_runtime_filters; }
+
     int estimated_max_concurrent_chunks() const;
 
     static StatusOr<TabletSharedPtr> get_tablet(const TInternalScanRange* scan_range);
@@ -146,6 +151,7 @@ private:
     std::vector<std::unique_ptr<TInternalScanRange>> _scan_ranges;
     TupleDescriptor* _tuple_desc = nullptr;
     OlapScanConjunctsManager _conjuncts_manager;
+    std::vector<TopnRuntimeFilterPtr> _topn_runtime_filters;
     DictOptimizeParser _dict_optimize_parser;
     const Schema* _chunk_schema = nullptr;
     ObjectPool _obj_pool;
@@ -6,6 +6,7 @@
 
 #include "column/type_traits.h"
 #include "exprs/expr_context.h"
+#include "exec/vectorized/topn_runtime_filter.h"
 #include "exprs/vectorized/dictmapping_expr.h"
 #include "exprs/vectorized/in_const_predicate.hpp"
 #include "gutil/map_util.h"
@@ -384,6 +385,16 @@ void OlapScanConjunctsManager::normalize_join_runtime_filter(const SlotDescripto
         if (!desc->is_probe_slot_ref(&slot_id) || slot_id != slot.id()) continue;
 
         const RuntimeBloomFilter<SlotType>* filter = down_cast<const RuntimeBloomFilter<SlotType>*>(rf);
+        // The build side is small and all its values are known, push them down as an IN predicate,
+        // which is able to filter rows before decoding them, besides the zone map and the bitmap index.
+        if (filter->has_in_values() && !filter->in_values().empty()) {
+            std::set<RangeValueType> values;
+            for (const auto& value : filter->in_values()) {
+                values.insert(static_cast<RangeValueType>(value));
+            }
+            range->add_fixed_values(FILTER_IN, values);
+            continue;
+        }
         // If this column doesn't have other filter, we use join runtime filter
         // to fast comput row range in storage engine
         if (range->is_init_state()) {
@@ -528,6 +539,100 @@ struct ColumnRangeBuilder {
     }
 };
 
+struct RuntimeFilterRangeBuilder {
+    template <PrimitiveType ptype>
+    std::nullptr_t operator()(const SlotDescriptor* slot, const JoinRuntimeFilter* rf,
+                              std::vector<TCondition>* filters) {
+        if constexpr (ptype == TYPE_TIME || ptype == TYPE_NULL || ptype == TYPE_JSON || pt_is_float<ptype>) {
+            return nullptr;
+        } else {
+            // Same as ColumnRangeBuilder.
+            constexpr PrimitiveType limit_type = ptype == TYPE_TINYINT || ptype == TYPE_BOOLEAN ? TYPE_INT : ptype;
+            constexpr PrimitiveType mapping_type = ptype == TYPE_CHAR ? TYPE_VARCHAR : ptype;
+            using value_type = typename RunTimeTypeLimits<limit_type>::value_type;
+
+            ColumnValueRange<value_type> range(slot->col_name(), ptype, RunTimeTypeLimits<ptype>::min_value(),
+                                               RunTimeTypeLimits<ptype>::max_value());
+            if constexpr (pt_is_decimal<limit_type>) {
+                range.set_precision(slot->type().precision);
+                range.set_scale(slot->type().scale);
+            }
+            const auto* filter = down_cast<const RuntimeBloomFilter<mapping_type>*>(rf);
+            range.set_index_filter_only(true);
+            range.add_range(to_olap_filter_type(TExprOpcode::GE, false), static_cast<value_type>(filter->min_value()));
+            range.add_range(to_olap_filter_type(TExprOpcode::LE, false), static_cast<value_type>(filter->max_value()));
+            range.to_olap_filter(*filters);
+            return nullptr;
+        }
+    }
+};
+
+Status OlapScanConjunctsManager::get_runtime_filter_predicates(const SlotDescriptor& slot, const JoinRuntimeFilter* rf,
+                                                               PredicateParser* parser,
+                                                               std::vector<std::unique_ptr<ColumnPredicate>>* preds) {
+    // The null rows pass a runtime filter with null, but they are out of any zone map range.
+    if (rf == nullptr || rf->has_null()) {
+        return Status::OK();
+    }
+    std::vector<TCondition> filters;
+    type_dispatch_predicate<std::nullptr_t>(slot.type().type, false, RuntimeFilterRangeBuilder(), &slot, rf,
+                                            &filters);
+    for (auto& f : filters) {
+        std::unique_ptr<ColumnPredicate> p(parser->parse_thrift_cond(f));
+        RETURN_IF(!p, Status::RuntimeError("invalid filter"));
+        p->set_index_filter_only(f.is_index_filter_only);
+        preds->emplace_back(std::move(p));
+    }
+    return Status::OK();
+}
+
+struct TopnFilterRangeBuilder {
+    template <PrimitiveType ptype>
+    std::nullptr_t operator()(const SlotDescriptor* slot, const TopnRuntimeFilter* filter, const Column* boundary,
+                              std::vector<TCondition>* filters) {
+        if constexpr (ptype == TYPE_TIME || ptype == TYPE_NULL || ptype == TYPE_JSON || pt_is_float<ptype>) {
+            return nullptr;
+        } else {
+            // Same as RuntimeFilterRangeBuilder.
+            constexpr PrimitiveType limit_type = ptype == TYPE_TINYINT || ptype == TYPE_BOOLEAN ? TYPE_INT : ptype;
+            constexpr PrimitiveType mapping_type = ptype == TYPE_CHAR ? TYPE_VARCHAR : ptype;
+            using value_type = typename RunTimeTypeLimits<limit_type>::value_type;
+
+            ColumnValueRange<value_type> range(slot->col_name(), ptype, RunTimeTypeLimits<ptype>::min_value(),
+                                               RunTimeTypeLimits<ptype>::max_value());
+            if constexpr (pt_is_decimal<limit_type>) {
+                range.set_precision(slot->type().precision);
+                range.set_scale(slot->type().scale);
+            }
+            auto value = static_cast<value_type>(boundary->get(0).get<RunTimeCppType<mapping_type>>());
+            range.set_index_filter_only(true);
+            TExprOpcode::type op = filter->is_asc_order() ? TExprOpcode::LE : TExprOpcode::GE;
+            range.add_range(to_olap_filter_type(op, false), value);
+            range.to_olap_filter(*filters);
+            return nullptr;
+        }
+    }
+};
+
+Status OlapScanConjunctsManager::get_topn_filter_predicates(const SlotDescriptor& slot,
+                                                            const TopnRuntimeFilter& filter, PredicateParser* parser,
+                                                            std::vector<std::unique_ptr<ColumnPredicate>>* preds) {
+    ColumnPtr boundary = filter.boundary();
+    if (boundary == nullptr) {
+        return Status::OK();
+    }
+    std::vector<TCondition> filters;
+    type_dispatch_predicate<std::nullptr_t>(slot.type().type, false, TopnFilterRangeBuilder(), &slot, &filter,
+                                            boundary.get(), &filters);
+    for (auto& f : filters) {
+        std::unique_ptr<ColumnPredicate> p(parser->parse_thrift_cond(f));
+        RETURN_IF(!p, Status::RuntimeError("invalid filter"));
+        p->set_index_filter_only(f.is_index_filter_only);
+        preds->emplace_back(std::move(p));
+    }
+    return Status::OK();
+}
+
 Status OlapScanConjunctsManager::normalize_conjuncts() {
     // Note: _normalized_conjuncts size must be equal to _conjunct_ctxs size,
     // but HashJoinNode will push down predicate to OlapScanNode's _conjunct_ctxs,
@@ -12,6 +12,8 @@ class RuntimeState;
 namespace vectorized {
 
 class RuntimeFilterProbeCollector;
+class JoinRuntimeFilter;
+class TopnRuntimeFilter;
 class PredicateParser;
 class ColumnPredicate;
 
@@ -47,6 +49,17 @@ public:
     Status parse_conjuncts(bool scan_keys_unlimited, int32_t max_scan_key_num,
                            bool enable_column_expr_predicate = false);
 
+    // Build the index-only predicates of the min/max of the join runtime filter |rf| on |slot|,
+    // which prune the zone maps of an in-flight scan when |rf| arrives after parsing the conjuncts.
+    static Status get_runtime_filter_predicates(const SlotDescriptor& slot, const JoinRuntimeFilter* rf,
+                                                PredicateParser* parser,
+                                                std::vector<std::unique_ptr<ColumnPredicate>>* preds);
+
+    // Build the index-only predicate of the current boundary of the top-n runtime filter |filter| on |slot|.
+    static Status get_topn_filter_predicates(const SlotDescriptor& slot, const TopnRuntimeFilter& filter,
+                                             PredicateParser* parser,
+                                             std::vector<std::unique_ptr<ColumnPredicate>>* preds);
+
 private:
     friend struct ColumnRangeBuilder;
     friend class ConjunctiveTestFixture;
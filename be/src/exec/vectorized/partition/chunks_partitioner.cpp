@@ -2,6 +2,7 @@
 
 #include "exec/vectorized/partition/chunks_partitioner.h"
 
+#include "common/config.h"
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
 #include "runtime/primitive_type.h"
@@ -44,9 +45,19 @@ Status ChunksPartitioner::offer(const ChunkPtr& chunk) {
     APPLY_FOR_PARTITION_VARIANT_ALL(HASH_MAP_METHOD)
 #undef HASH_MAP_METHOD
 
+    if (!_is_downgrade) {
+        TRY_CATCH_BAD_ALLOC(_try_convert_to_two_level_map());
+    }
+
     return Status::OK();
 }
 
+void ChunksPartitioner::_try_convert_to_two_level_map() {
+    if (_hash_map_variant.memory_usage() > config::partition_topn_two_level_hash_map_bytes) {
+        _hash_map_variant.convert_to_two_level(_state);
+    }
+}
+
 ChunkPtr ChunksPartitioner::consume_from_downgrade_buffer() {
     vectorized::ChunkPtr chunk = nullptr;
     if (_downgrade_buffer.empty()) {
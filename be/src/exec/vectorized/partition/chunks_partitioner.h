@@ -79,6 +79,8 @@ private:
                                           const std::vector<PartitionColumnType>& partition_types, size_t* max_size,
                                           bool* has_null);
     void _init_hash_map_variant();
+    // Large one level hash maps are slow to resize and probe, so they are converted into the two level ones.
+    void _try_convert_to_two_level_map();
 
     template <typename HashMapWithKey>
     void _split_chunk_by_partition(HashMapWithKey& hash_map_with_key, const ChunkPtr& chunk) {
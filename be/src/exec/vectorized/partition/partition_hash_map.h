@@ -8,6 +8,7 @@
 #include "column/hash_set.h"
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/mem_pool.h"
 #include "util/phmap/phmap.h"
@@ -58,6 +59,22 @@ template <PhmapSeed seed>
 using FixedSize16SlicePartitionHashMap =
         phmap::flat_hash_map<SliceKey16, PartitionChunks*, FixedSizeSliceKeyHash<SliceKey16, seed>>;
 
+// =====================
+// two level partition hash map
+// The two level hash maps have 2 ^ 4 = 16 sub maps, the same as SliceAggTwoLevelHashMap.
+static constexpr uint8_t PARTITION_PHMAPN = 4;
+template <PhmapSeed seed>
+using Int32TwoLevelPartitionHashMap =
+        phmap::parallel_flat_hash_map<int32_t, PartitionChunks*, StdHashWithSeed<int32_t, seed>>;
+template <PhmapSeed seed>
+using Int64TwoLevelPartitionHashMap =
+        phmap::parallel_flat_hash_map<int64_t, PartitionChunks*, StdHashWithSeed<int64_t, seed>>;
+template <PhmapSeed seed>
+using SliceTwoLevelPartitionHashMap =
+        phmap::parallel_flat_hash_map<Slice, PartitionChunks*, SliceHashWithSeed<seed>, SliceEqual,
+                                      phmap::priv::Allocator<phmap::priv::Pair<const Slice, PartitionChunks*>>,
+                                      PARTITION_PHMAPN>;
+
 struct PartitionHashMapBase {
     const int32_t chunk_size;
     bool is_downgrade = false;
@@ -92,8 +109,9 @@ protected:
         if (is_downgrade) {
             return;
         }
-        auto partition_num = hash_map.size();
-        if (partition_num > 512 && total_num_rows < 10000 * partition_num) {
+        auto partition_num = static_cast<int64_t>(hash_map.size());
+        if (partition_num > config::partition_topn_downgrade_min_partitions &&
+            total_num_rows < config::partition_topn_downgrade_min_rows_per_partition * partition_num) {
             is_downgrade = true;
         }
     }
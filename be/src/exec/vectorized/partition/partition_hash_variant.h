@@ -23,7 +23,10 @@ namespace starrocks::vectorized {
     M(phase1_slice)                             \
     M(phase1_slice_fx4)                         \
     M(phase1_slice_fx8)                         \
-    M(phase1_slice_fx16)
+    M(phase1_slice_fx16)                        \
+    M(phase1_int32_two_level)                   \
+    M(phase1_int64_two_level)                   \
+    M(phase1_string_two_level)
 
 #define APPLY_FOR_PARTITION_VARIANT_NULL(M) \
     M(phase1_null_uint8)                    \
@@ -37,7 +40,10 @@ namespace starrocks::vectorized {
     M(phase1_null_decimal128)               \
     M(phase1_null_date)                     \
     M(phase1_null_timestamp)                \
-    M(phase1_null_string)
+    M(phase1_null_string)                   \
+    M(phase1_null_int32_two_level)          \
+    M(phase1_null_int64_two_level)          \
+    M(phase1_null_string_two_level)
 
 #define APPLY_FOR_PARTITION_VARIANT_ALL(M) \
     M(phase1_uint8)                        \
@@ -67,7 +73,13 @@ namespace starrocks::vectorized {
     M(phase1_null_string)                  \
     M(phase1_slice_fx4)                    \
     M(phase1_slice_fx8)                    \
-    M(phase1_slice_fx16)
+    M(phase1_slice_fx16)                   \
+    M(phase1_int32_two_level)              \
+    M(phase1_int64_two_level)              \
+    M(phase1_string_two_level)             \
+    M(phase1_null_int32_two_level)         \
+    M(phase1_null_int64_two_level)         \
+    M(phase1_null_string_two_level)
 
 // Hash maps for phase1
 template <PhmapSeed seed>
@@ -156,6 +168,25 @@ template <PhmapSeed seed>
 using SerializedKeyFixedSize16PartitionHashMap =
         PartitionHashMapWithSerializedKeyFixedSize<FixedSize16SlicePartitionHashMap<seed>>;
 
+// Two level hash maps for the partition columns of high cardinality.
+template <PhmapSeed seed>
+using Int32TwoLevelPartitionHashMapWithOneNumberKey =
+        PartitionHashMapWithOneNumberKey<TYPE_INT, Int32TwoLevelPartitionHashMap<seed>>;
+template <PhmapSeed seed>
+using Int64TwoLevelPartitionHashMapWithOneNumberKey =
+        PartitionHashMapWithOneNumberKey<TYPE_BIGINT, Int64TwoLevelPartitionHashMap<seed>>;
+template <PhmapSeed seed>
+using OneStringTwoLevelPartitionHashMap = PartitionHashMapWithOneStringKey<SliceTwoLevelPartitionHashMap<seed>>;
+template <PhmapSeed seed>
+using NullInt32TwoLevelPartitionHashMapWithOneNumberKey =
+        PartitionHashMapWithOneNullableNumberKey<TYPE_INT, Int32TwoLevelPartitionHashMap<seed>>;
+template <PhmapSeed seed>
+using NullInt64TwoLevelPartitionHashMapWithOneNumberKey =
+        PartitionHashMapWithOneNullableNumberKey<TYPE_BIGINT, Int64TwoLevelPartitionHashMap<seed>>;
+template <PhmapSeed seed>
+using NullOneStringTwoLevelPartitionHashMap =
+        PartitionHashMapWithOneNullableStringKey<SliceTwoLevelPartitionHashMap<seed>>;
+
 // For different partition columns type, size, cardinality, volume, we should choose different
 // hash functions and different hashmaps.
 // When runtime, we will only have one hashmap.
@@ -193,6 +224,12 @@ struct PartitionHashMapVariant {
         phase1_slice_fx8,
         phase1_slice_fx16,
 
+        phase1_int32_two_level,
+        phase1_int64_two_level,
+        phase1_string_two_level,
+        phase1_null_int32_two_level,
+        phase1_null_int64_two_level,
+        phase1_null_string_two_level,
     };
     Type type = Type::phase1_slice;
 
@@ -230,6 +267,13 @@ struct PartitionHashMapVariant {
     std::unique_ptr<SerializedKeyFixedSize8PartitionHashMap<PhmapSeed1>> phase1_slice_fx8;
     std::unique_ptr<SerializedKeyFixedSize16PartitionHashMap<PhmapSeed1>> phase1_slice_fx16;
 
+    std::unique_ptr<Int32TwoLevelPartitionHashMapWithOneNumberKey<PhmapSeed1>> phase1_int32_two_level;
+    std::unique_ptr<Int64TwoLevelPartitionHashMapWithOneNumberKey<PhmapSeed1>> phase1_int64_two_level;
+    std::unique_ptr<OneStringTwoLevelPartitionHashMap<PhmapSeed1>> phase1_string_two_level;
+    std::unique_ptr<NullInt32TwoLevelPartitionHashMapWithOneNumberKey<PhmapSeed1>> phase1_null_int32_two_level;
+    std::unique_ptr<NullInt64TwoLevelPartitionHashMapWithOneNumberKey<PhmapSeed1>> phase1_null_int64_two_level;
+    std::unique_ptr<NullOneStringTwoLevelPartitionHashMap<PhmapSeed1>> phase1_null_string_two_level;
+
     void init(RuntimeState* state, Type type_) {
         type = type_;
         switch (type_) {
@@ -242,6 +286,44 @@ struct PartitionHashMapVariant {
         }
     }
 
+    // Convert the one level hash map into the two level one of the same key, if there is such one.
+    // Return whether it's converted.
+    bool convert_to_two_level(RuntimeState* state) {
+        switch (type) {
+#define CONVERT_TO_TWO_LEVEL(SRC, DST)                                            \
+    case Type::SRC:                                                               \
+        DST = std::make_unique<decltype(DST)::element_type>(state->chunk_size()); \
+        DST->hash_map.reserve(SRC->hash_map.capacity());                          \
+        DST->hash_map.insert(SRC->hash_map.begin(), SRC->hash_map.end());         \
+        DST->is_downgrade = SRC->is_downgrade;                                    \
+        DST->total_num_rows = SRC->total_num_rows;                                \
+        type = Type::DST;                                                         \
+        SRC.reset();                                                              \
+        return true;
+#define CONVERT_TO_TWO_LEVEL_NULLABLE(SRC, DST)                                   \
+    case Type::SRC:                                                               \
+        DST = std::make_unique<decltype(DST)::element_type>(state->chunk_size()); \
+        DST->hash_map.reserve(SRC->hash_map.capacity());                          \
+        DST->hash_map.insert(SRC->hash_map.begin(), SRC->hash_map.end());         \
+        DST->null_key_value = std::move(SRC->null_key_value);                     \
+        DST->is_downgrade = SRC->is_downgrade;                                    \
+        DST->total_num_rows = SRC->total_num_rows;                                \
+        type = Type::DST;                                                         \
+        SRC.reset();                                                              \
+        return true;
+            CONVERT_TO_TWO_LEVEL(phase1_int32, phase1_int32_two_level)
+            CONVERT_TO_TWO_LEVEL(phase1_int64, phase1_int64_two_level)
+            CONVERT_TO_TWO_LEVEL(phase1_string, phase1_string_two_level)
+            CONVERT_TO_TWO_LEVEL_NULLABLE(phase1_null_int32, phase1_null_int32_two_level)
+            CONVERT_TO_TWO_LEVEL_NULLABLE(phase1_null_int64, phase1_null_int64_two_level)
+            CONVERT_TO_TWO_LEVEL_NULLABLE(phase1_null_string, phase1_null_string_two_level)
+#undef CONVERT_TO_TWO_LEVEL_NULLABLE
+#undef CONVERT_TO_TWO_LEVEL
+        default:
+            return false;
+        }
+    }
+
     size_t capacity() const {
         switch (type) {
 #define M(NAME)      \
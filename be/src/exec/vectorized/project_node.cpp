@@ -208,6 +208,20 @@ Status ProjectNode::close(RuntimeState* state) {
     return ExecNode::close(state);
 }
 
+bool ProjectNode::is_child_slot_copy(SlotId slot_id, SlotId* child_slot_id) const {
+    for (size_t i = 0; i < _slot_ids.size(); i++) {
+        if (_slot_ids[i] == slot_id) {
+            Expr* expr = _expr_ctxs[i]->root();
+            if (!expr->is_slotref()) {
+                return false;
+            }
+            *child_slot_id = down_cast<ColumnRef*>(expr)->slot_id();
+            return true;
+        }
+    }
+    return false;
+}
+
 void ProjectNode::push_down_predicate(RuntimeState* state, std::list<ExprContext*>* expr_ctxs) {
     for (const auto& ctx : (*expr_ctxs)) {
         if (!ctx->root()->is_bound(_tuple_ids)) {
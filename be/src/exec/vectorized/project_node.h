@@ -31,6 +31,9 @@ public:
     std::vector<std::shared_ptr<pipeline::OperatorFactory>> decompose_to_pipeline(
             pipeline::PipelineBuilderContext* context) override;
 
+    // Return true and set |child_slot_id| if the output slot |slot_id| is a copy of a slot of the child.
+    bool is_child_slot_copy(SlotId slot_id, SlotId* child_slot_id) const;
+
 private:
     std::vector<SlotId> _slot_ids;
     std::vector<ExprContext*> _expr_ctxs;
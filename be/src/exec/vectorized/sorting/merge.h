@@ -157,6 +157,12 @@ Status merge_sorted_chunks(const SortDescs& descs, const std::vector<ExprContext
 Status merge_sorted_chunks(const SortDescs& descs, const std::vector<ExprContext*>* sort_exprs,
                            const std::vector<SortedRuns>& runs_batch, SortedRuns* output, size_t limit);
 
+// Split the sorted runs of |runs_batch| into at most |num_ranges| disjoint key ranges by splitters sampled from
+// them, (*ranges)[i] holds the slices of the runs in the i-th range. The rows equal to a splitter are all in the
+// same range, so merging each range independently and concatenating the results gives a total order.
+void split_sorted_runs(const SortDescs& sort_desc, const std::vector<SortedRuns>& runs_batch, size_t num_ranges,
+                       std::vector<std::vector<SortedRuns>>* ranges);
+
 // ColumnWise merge streaming merge
 Status merge_sorted_cursor_two_way(const SortDescs& sort_desc, std::unique_ptr<SimpleChunkSortCursor> left_cursor,
                                    std::unique_ptr<SimpleChunkSortCursor> right_cursor, ChunkConsumer output);
@@ -95,6 +95,10 @@ StatusOr<ChunkUniquePtr> MergeTwoCursor::next() {
     if (move_cursor()) {
         return ChunkUniquePtr();
     }
+    // Wait for the next chunk of the cursor that hasn't arrived, the rows of the other one can't be output before it.
+    if ((_left_run.empty() && !_left_cursor->is_eos()) || (_right_run.empty() && !_right_cursor->is_eos())) {
+        return ChunkUniquePtr();
+    }
     return merge_sorted_cursor_two_way();
 }
 
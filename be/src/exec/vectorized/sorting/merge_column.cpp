@@ -1,5 +1,6 @@
 // This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
 
+#include <algorithm>
 #include <numeric>
 
 #include "column/array_column.h"
@@ -438,6 +439,121 @@ ChunkPtr SortedRuns::assemble() const {
     return result;
 }
 
+// The rows of a SortedRuns numbered from 0 in order, mapped back to the run and the row in its chunk.
+class SortedRunsRows {
+public:
+    explicit SortedRunsRows(const SortedRuns& runs) : _runs(runs), _ends(runs.num_chunks()) {
+        size_t rows = 0;
+        for (size_t i = 0; i < runs.num_chunks(); i++) {
+            rows += runs.chunks[i].num_rows();
+            _ends[i] = rows;
+        }
+    }
+
+    size_t num_rows() const { return _ends.empty() ? 0 : _ends.back(); }
+
+    std::pair<const SortedRun*, size_t> get(size_t pos) const {
+        size_t i = std::upper_bound(_ends.begin(), _ends.end(), pos) - _ends.begin();
+        const SortedRun& run = _runs.chunks[i];
+        return {&run, run.start_index() + pos - (_ends[i] - run.num_rows())};
+    }
+
+    // The position of the first row not less than |row| of |run|.
+    size_t lower_bound(const SortDescs& sort_desc, const SortedRun& run, size_t row) const {
+        size_t first = 0;
+        size_t count = num_rows();
+        while (count > 0) {
+            size_t step = count / 2;
+            auto [mid_run, mid_row] = get(first + step);
+            if (mid_run->compare_row(sort_desc, run, mid_row, row) < 0) {
+                first += step + 1;
+                count -= step + 1;
+            } else {
+                count = step;
+            }
+        }
+        return first;
+    }
+
+    // Append the rows in [begin, end) to |output|, as slices of the runs.
+    void slice(size_t begin, size_t end, SortedRuns* output) const {
+        for (size_t i = 0; i < _runs.num_chunks() && begin < end; i++) {
+            size_t run_begin = _ends[i] - _runs.chunks[i].num_rows();
+            if (_ends[i] <= begin) {
+                continue;
+            }
+            const SortedRun& run = _runs.chunks[i];
+            size_t slice_end = std::min(end, _ends[i]);
+            output->chunks.emplace_back(run, run.start_index() + begin - run_begin,
+                                        run.start_index() + slice_end - run_begin);
+            begin = slice_end;
+        }
+    }
+
+private:
+    const SortedRuns& _runs;
+    std::vector<size_t> _ends;
+};
+
+void split_sorted_runs(const SortDescs& sort_desc, const std::vector<SortedRuns>& runs_batch, size_t num_ranges,
+                       std::vector<std::vector<SortedRuns>>* ranges) {
+    // The number of samples taken for each range, more samples make the ranges closer in size.
+    constexpr size_t kSamplesPerRange = 32;
+
+    std::vector<SortedRunsRows> batch_rows;
+    size_t total_rows = 0;
+    for (const auto& runs : runs_batch) {
+        batch_rows.emplace_back(runs);
+        total_rows += batch_rows.back().num_rows();
+    }
+    ranges->clear();
+    if (num_ranges <= 1 || total_rows == 0) {
+        ranges->push_back(runs_batch);
+        return;
+    }
+
+    // Sample the rows at the same interval in all the runs, so the samples of a run are proportional to its rows.
+    std::vector<std::pair<const SortedRun*, size_t>> samples;
+    size_t interval = std::max<size_t>(1, total_rows / (num_ranges * kSamplesPerRange));
+    for (const auto& rows : batch_rows) {
+        for (size_t pos = interval / 2; pos < rows.num_rows(); pos += interval) {
+            samples.push_back(rows.get(pos));
+        }
+    }
+    if (samples.empty()) {
+        ranges->push_back(runs_batch);
+        return;
+    }
+    auto less = [&](const std::pair<const SortedRun*, size_t>& lhs, const std::pair<const SortedRun*, size_t>& rhs) {
+        return lhs.first->compare_row(sort_desc, *rhs.first, lhs.second, rhs.second) < 0;
+    };
+    std::sort(samples.begin(), samples.end(), less);
+
+    // The splitters are distinct, so that the rows equal to one are all in the same range.
+    std::vector<std::pair<const SortedRun*, size_t>> splitters;
+    for (size_t i = 1; i < num_ranges; i++) {
+        const auto& sample = samples[i * samples.size() / num_ranges];
+        if (splitters.empty() || less(splitters.back(), sample)) {
+            splitters.push_back(sample);
+        }
+    }
+
+    ranges->resize(splitters.size() + 1);
+    for (const auto& rows : batch_rows) {
+        size_t begin = 0;
+        for (size_t i = 0; i <= splitters.size(); i++) {
+            size_t end = i < splitters.size() ? rows.lower_bound(sort_desc, *splitters[i].first, splitters[i].second)
+                                              : rows.num_rows();
+            SortedRuns part;
+            rows.slice(begin, end, &part);
+            if (part.num_chunks() > 0) {
+                (*ranges)[i].push_back(std::move(part));
+            }
+            begin = end;
+        }
+    }
+}
+
 Status merge_sorted_chunks_two_way(const SortDescs& sort_desc, const SortedRun& left, const SortedRun& right,
                                    Permutation* output) {
     return MergeTwoChunk::merge_sorted_chunks_two_way(sort_desc, left, right, output);
@@ -452,7 +568,7 @@ Status merge_sorted_chunks_two_way(const SortDescs& sort_desc, const std::vector
                 if (output) {
                     if (++left_index < left.num_chunks()) {
                         // TODO: avoid copy
-                        *output = left.get_chunk(left_index)->clone_unique();
+                        *output = left.chunks[left_index].clone_slice();
                         return true;
                     } else {
                         *eos = true;
@@ -466,7 +582,7 @@ Status merge_sorted_chunks_two_way(const SortDescs& sort_desc, const std::vector
             [&](ChunkUniquePtr* output, bool* eos) {
                 if (output) {
                     if (++right_index < right.num_chunks()) {
-                        *output = right.get_chunk(right_index)->clone_unique();
+                        *output = right.chunks[right_index].clone_slice();
                         return true;
                     } else {
                         *eos = true;
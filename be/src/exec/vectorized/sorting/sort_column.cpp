@@ -15,6 +15,7 @@
 #include "exec/vectorized/sorting/sort_helper.h"
 #include "exec/vectorized/sorting/sort_permute.h"
 #include "exec/vectorized/sorting/sorting.h"
+#include "util/german_string.h"
 #include "util/orlp/pdqsort.h"
 
 namespace starrocks::vectorized {
@@ -68,12 +69,13 @@ public:
     template <typename T>
     Status do_visit(const vectorized::BinaryColumnBase<T>& column) {
         DCHECK_GE(column.size(), _permutation.size());
-        using ItemType = InlinePermuteItem<Slice>;
+        // Most comparisons are decided by the length and the prefix inlined in the views.
+        using ItemType = InlinePermuteItem<GermanString>;
         auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
             return lhs.inline_value.compare(rhs.inline_value);
         };
 
-        auto inlined = create_inline_permutation<Slice>(_permutation, column.get_data());
+        auto inlined = create_inline_permutation<GermanString>(_permutation, column.get_data());
         RETURN_IF_ERROR(sort_and_tie_helper(_cancel, &column, _is_asc_order, inlined, _tie, cmp, _range, _build_tie));
         restore_inline_permutation(inlined, _permutation);
 
@@ -178,7 +180,8 @@ public:
         using ColumnType = BinaryColumnBase<T>;
 
         if (_need_inline_value()) {
-            using ItemType = CompactChunkItem<Slice>;
+            // Most comparisons are decided by the length and the prefix inlined in the views.
+            using ItemType = CompactChunkItem<GermanString>;
             using Container = std::vector<Slice>;
 
             auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
@@ -191,7 +194,7 @@ public:
                 containers.push_back(&real->get_data());
             }
 
-            auto inlined = _create_inlined_permutation<Slice>(containers);
+            auto inlined = _create_inlined_permutation<GermanString>(containers);
             RETURN_IF_ERROR(sort_and_tie_helper(_cancel, &column, _is_asc_order, inlined, _tie, cmp, _range, _build_tie,
                                                 _limit, &_pruned_limit));
             _restore_inlined_permutation(inlined);
@@ -368,6 +371,15 @@ Status sort_and_tie_columns(const bool cancel, const Columns& columns, const std
         return Status::OK();
     }
     size_t num_rows = columns[0]->size();
+    std::vector<Columns> vertical_chunks{columns};
+    if (can_sort_by_normalized_key(vertical_chunks)) {
+        permutation->resize(num_rows);
+        for (uint32_t i = 0; i < num_rows; i++) {
+            (*permutation)[i] = PermutationItem(0, i);
+        }
+        return sort_by_normalized_key(cancel, vertical_chunks, sort_orders, null_firsts, *permutation, num_rows);
+    }
+
     Tie tie(num_rows, 1);
     std::pair<int, int> range{0, num_rows};
     SmallPermutation small_perm = create_small_permutation(num_rows);
@@ -453,6 +465,12 @@ Status sort_vertical_chunks(const std::atomic<bool>& cancel, const std::vector<C
     DCHECK_EQ(num_columns, sort_orders.size());
     DCHECK_EQ(num_columns, null_firsts.size());
 
+    // The rank needs the ties to find the rows equal to the last one.
+    if (!is_limit_by_rank && can_sort_by_normalized_key(vertical_chunks)) {
+        return sort_by_normalized_key(cancel.load(std::memory_order_acquire), vertical_chunks, sort_orders,
+                                      null_firsts, perm, limit);
+    }
+
     for (int col = 0; col < num_columns; col++) {
         // TODO: use the flag directly
         bool is_asc_order = (sort_orders[col] == 1);
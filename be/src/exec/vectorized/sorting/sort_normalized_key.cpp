@@ -0,0 +1,202 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include <algorithm>
+#include <type_traits>
+#include <typeinfo>
+
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "exec/vectorized/sorting/sorting.h"
+#include "util/orlp/pdqsort.h"
+
+namespace starrocks::vectorized {
+
+// The rows are sorted by an unsigned integer key, into which the sort columns are encoded one after another
+// from the most significant bits. Each value is mapped to an unsigned integer of the same width keeping its
+// order, a descending column has its bits inverted, and a nullable column has one more bit before the value
+// to put the nulls first or last.
+template <class Key>
+struct NormalizedKeyItem {
+    Key key;
+    uint32_t index;
+};
+
+template <class Key>
+using NormalizedKeyItems = std::vector<NormalizedKeyItem<Key>>;
+
+// The width in bits of the encoded values of a column, or 0 if the column cannot be encoded.
+static int normalized_value_bits(const Column* data_column) {
+    if (dynamic_cast<const Int8Column*>(data_column) != nullptr ||
+        dynamic_cast<const BooleanColumn*>(data_column) != nullptr) {
+        return 8;
+    }
+    if (dynamic_cast<const Int16Column*>(data_column) != nullptr) {
+        return 16;
+    }
+    if (dynamic_cast<const Int32Column*>(data_column) != nullptr ||
+        dynamic_cast<const DateColumn*>(data_column) != nullptr) {
+        return 32;
+    }
+    if (dynamic_cast<const Int64Column*>(data_column) != nullptr ||
+        dynamic_cast<const TimestampColumn*>(data_column) != nullptr) {
+        return 64;
+    }
+    return 0;
+}
+
+template <class T>
+static auto normalized_value(T value) {
+    if constexpr (std::is_same_v<T, DateValue>) {
+        return normalized_value(value.julian());
+    } else if constexpr (std::is_same_v<T, TimestampValue>) {
+        return normalized_value(value.timestamp());
+    } else if constexpr (std::is_signed_v<T>) {
+        using U = std::make_unsigned_t<T>;
+        return static_cast<U>(static_cast<U>(value) ^ (U(1) << (sizeof(T) * 8 - 1)));
+    } else {
+        return value;
+    }
+}
+
+template <class Key>
+static inline Key shift_in(Key key, int bits, Key part) {
+    // Shift in two steps, shifting by the width of the key is undefined.
+    return ((key << (bits - 1)) << 1) | part;
+}
+
+template <class Key, class ColumnType>
+static void encode_column(const std::vector<const Column*>& columns, const Permutation& perm, bool is_asc_order,
+                          bool is_null_first, bool nullable, NormalizedKeyItems<Key>* items) {
+    using T = typename ColumnType::ValueType;
+    constexpr int bits = sizeof(T) * 8;
+    std::vector<const T*> values(columns.size());
+    std::vector<const uint8_t*> nulls(columns.size(), nullptr);
+    for (size_t i = 0; i < columns.size(); i++) {
+        values[i] = down_cast<const ColumnType*>(ColumnHelper::get_data_column(columns[i]))->get_data().data();
+        if (columns[i]->is_nullable()) {
+            nulls[i] = down_cast<const NullableColumn*>(columns[i])->immutable_null_column_data().data();
+        }
+    }
+    const Key null_bit = is_null_first ? 0 : 1;
+    for (size_t i = 0; i < perm.size(); i++) {
+        uint32_t chunk = perm[i].chunk_index;
+        uint32_t row = perm[i].index_in_chunk;
+        Key& key = (*items)[i].key;
+        bool is_null = nulls[chunk] != nullptr && nulls[chunk][row];
+        if (nullable) {
+            key = shift_in<Key>(key, 1, is_null ? null_bit : 1 - null_bit);
+        }
+        if (is_null) {
+            // All the nulls are equal, whatever is stored under them.
+            key = shift_in<Key>(key, bits, 0);
+        } else {
+            auto part = normalized_value(values[chunk][row]);
+            key = shift_in<Key>(key, bits, is_asc_order ? part : static_cast<decltype(part)>(~part));
+        }
+    }
+}
+
+template <class Key>
+static void encode_column(const std::vector<const Column*>& columns, const Permutation& perm, bool is_asc_order,
+                          bool is_null_first, bool nullable, NormalizedKeyItems<Key>* items) {
+    const Column* data_column = ColumnHelper::get_data_column(columns[0]);
+#define ENCODE_IF(ColumnType)                                                                                          \
+    if (dynamic_cast<const ColumnType*>(data_column) != nullptr) {                                                     \
+        return encode_column<Key, ColumnType>(columns, perm, is_asc_order, is_null_first, nullable, items);            \
+    }
+    ENCODE_IF(Int8Column);
+    ENCODE_IF(BooleanColumn);
+    ENCODE_IF(Int16Column);
+    ENCODE_IF(Int32Column);
+    ENCODE_IF(DateColumn);
+    ENCODE_IF(Int64Column);
+    ENCODE_IF(TimestampColumn);
+#undef ENCODE_IF
+    DCHECK(false) << "unsupported column " << data_column->get_name();
+}
+
+template <class Key>
+static Status sort_by_key(const bool& cancel, const std::vector<Columns>& vertical_chunks,
+                          const std::vector<int>& sort_orders, const std::vector<int>& null_firsts,
+                          const std::vector<bool>& nullables, Permutation& perm, size_t limit) {
+    NormalizedKeyItems<Key> items(perm.size());
+    for (uint32_t i = 0; i < perm.size(); i++) {
+        items[i].key = 0;
+        items[i].index = i;
+    }
+    std::vector<const Column*> columns(vertical_chunks.size());
+    for (size_t col = 0; col < sort_orders.size(); col++) {
+        for (size_t i = 0; i < vertical_chunks.size(); i++) {
+            columns[i] = vertical_chunks[i][col].get();
+        }
+        bool is_asc_order = (sort_orders[col] == 1);
+        bool is_null_first = is_asc_order ? (null_firsts[col] == -1) : (null_firsts[col] == 1);
+        encode_column<Key>(columns, perm, is_asc_order, is_null_first, nullables[col], &items);
+    }
+    if (UNLIKELY(cancel)) {
+        return Status::Cancelled("Sort cancelled");
+    }
+
+    auto less = [](const NormalizedKeyItem<Key>& lhs, const NormalizedKeyItem<Key>& rhs) {
+        return lhs.key < rhs.key;
+    };
+    if (limit < items.size()) {
+        std::nth_element(items.begin(), items.begin() + limit, items.end(), less);
+        items.resize(limit);
+    }
+    ::pdqsort(cancel, items.begin(), items.end(), less);
+
+    Permutation sorted(items.size());
+    for (size_t i = 0; i < items.size(); i++) {
+        sorted[i] = perm[items[i].index];
+    }
+    perm.swap(sorted);
+    return Status::OK();
+}
+
+// The number of bits of the key encoding the sort columns, or 0 if they cannot be encoded.
+static int normalized_key_bits(const std::vector<Columns>& vertical_chunks, std::vector<bool>* nullables) {
+    if (vertical_chunks.empty() || vertical_chunks[0].empty()) {
+        return 0;
+    }
+    size_t num_columns = vertical_chunks[0].size();
+    int total_bits = 0;
+    nullables->assign(num_columns, false);
+    for (size_t col = 0; col < num_columns; col++) {
+        const Column* first = ColumnHelper::get_data_column(vertical_chunks[0][col].get());
+        int bits = normalized_value_bits(first);
+        if (bits == 0) {
+            return 0;
+        }
+        for (const auto& columns : vertical_chunks) {
+            const Column* column = columns[col].get();
+            if (column->is_constant() || typeid(*ColumnHelper::get_data_column(column)) != typeid(*first)) {
+                return 0;
+            }
+            (*nullables)[col] = (*nullables)[col] || column->is_nullable();
+        }
+        total_bits += bits + (*nullables)[col];
+    }
+    return total_bits <= 128 ? total_bits : 0;
+}
+
+bool can_sort_by_normalized_key(const std::vector<Columns>& vertical_chunks) {
+    std::vector<bool> nullables;
+    return normalized_key_bits(vertical_chunks, &nullables) > 0;
+}
+
+Status sort_by_normalized_key(const bool& cancel, const std::vector<Columns>& vertical_chunks,
+                              const std::vector<int>& sort_orders, const std::vector<int>& null_firsts,
+                              Permutation& perm, size_t limit) {
+    std::vector<bool> nullables;
+    int bits = normalized_key_bits(vertical_chunks, &nullables);
+    DCHECK_GT(bits, 0);
+    DCHECK_EQ(sort_orders.size(), nullables.size());
+    if (bits <= 64) {
+        return sort_by_key<uint64_t>(cancel, vertical_chunks, sort_orders, null_firsts, nullables, perm, limit);
+    }
+    return sort_by_key<unsigned __int128>(cancel, vertical_chunks, sort_orders, null_firsts, nullables, perm, limit);
+}
+
+} // namespace starrocks::vectorized
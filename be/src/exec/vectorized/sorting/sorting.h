@@ -42,6 +42,18 @@ Status sort_vertical_chunks(const std::atomic<bool>& cancel, const std::vector<C
                             const std::vector<int>& sort_orders, const std::vector<int>& null_firsts, Permutation& perm,
                             const size_t limit, const bool is_limit_by_rank = false);
 
+// Whether the sort columns of |vertical_chunks| are all integers, booleans, dates or datetimes whose
+// normalized key, see sort_by_normalized_key, is at most 128 bits wide.
+bool can_sort_by_normalized_key(const std::vector<Columns>& vertical_chunks);
+
+// Sort the rows of |perm| by encoding the sort columns of each row into one memcmp-comparable integer, so
+// the rows are sorted in one pass without comparing column by column, and keep the first |limit| rows.
+// The order of the equal rows is not defined.
+// REQUIRES: can_sort_by_normalized_key(vertical_chunks)
+Status sort_by_normalized_key(const bool& cancel, const std::vector<Columns>& vertical_chunks,
+                              const std::vector<int>& sort_orders, const std::vector<int>& null_firsts,
+                              Permutation& perm, size_t limit);
+
 // Compare the column with the `rhs_value`, which must have the some type with column.
 // @param cmp_result compare result is written into this array, value must within -1,0,1
 // @param rhs_value the compare value
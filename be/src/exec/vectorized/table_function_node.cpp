@@ -119,13 +119,8 @@ Status TableFunctionNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* e
         //Build outer data, repeat multiple times
         for (int outer_idx = 0; outer_idx < _outer_slots.size(); ++outer_idx) {
             ColumnPtr& input_column_ptr = _input_chunk_ptr->get_column_by_slot_id(_outer_slots[outer_idx]);
-            Datum value = input_column_ptr->get(_input_chunk_seek_rows);
-            if (value.is_null()) {
-                //The output_columns[outer_idx] is must Nullable, if value has null
-                down_cast<NullableColumn*>(output_columns[outer_idx].get())->append_nulls(repeat_times);
-            } else {
-                output_columns[outer_idx]->append_value_multiple_times(&value, repeat_times);
-            }
+            output_columns[outer_idx]->append_value_multiple_times(*input_column_ptr, _input_chunk_seek_rows,
+                                                                   repeat_times);
         }
         //Build table function result
         for (int result_idx = 0; result_idx < _fn_result_slots.size(); ++result_idx) {
@@ -167,13 +162,8 @@ Status TableFunctionNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* e
             //Build outer data, repeat multiple times
             for (int outer_idx = 0; outer_idx < _outer_slots.size(); ++outer_idx) {
                 ColumnPtr& input_column_ptr = _input_chunk_ptr->get_column_by_slot_id(_outer_slots[outer_idx]);
-                Datum value = input_column_ptr->get(_input_chunk_seek_rows);
-                if (value.is_null()) {
-                    //The output_columns[outer_idx] is must Nullable, if value has null
-                    down_cast<NullableColumn*>(output_columns[outer_idx].get())->append_nulls(repeat_times);
-                } else {
-                    output_columns[outer_idx]->append_value_multiple_times(&value, repeat_times);
-                }
+                output_columns[outer_idx]->append_value_multiple_times(*input_column_ptr, _input_chunk_seek_rows,
+                                                                       repeat_times);
             }
             //Build table function result
             for (int result_idx = 0; result_idx < _fn_result_slots.size(); ++result_idx) {
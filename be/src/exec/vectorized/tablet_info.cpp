@@ -2,9 +2,12 @@
 
 #include "exec/vectorized/tablet_info.h"
 
+#include <algorithm>
+
 #include "column/binary_column.h"
 #include "column/chunk.h"
 #include "column/column_helper.h"
+#include "column/nullable_column.h"
 #include "exprs/expr.h"
 #include "runtime/mem_pool.h"
 #include "types/constexpr.h"
@@ -97,6 +100,11 @@ Status OlapTablePartitionParam::init() {
         _partitions.emplace_back(part);
         _partitions_map.emplace(&part->end_key, part);
     }
+    _sorted_partitions.reserve(_partitions_map.size());
+    for (auto& [key, part] : _partitions_map) {
+        (void)key;
+        _sorted_partitions.emplace_back(part);
+    }
 
     return Status::OK();
 }
@@ -215,6 +223,12 @@ Status OlapTablePartitionParam::find_tablets(Chunk* chunk, std::vector<OlapTable
             }
         }
 
+        if (partition_columns.size() == 1 &&
+            _find_partitions_by_fixed_key(partition_columns[0].get(), partitions, indexes, selection,
+                                          invalid_row_index)) {
+            return Status::OK();
+        }
+
         ChunkRow row;
         row.columns = &partition_columns;
         row.index = 0;
@@ -253,6 +267,88 @@ Status OlapTablePartitionParam::find_tablets(Chunk* chunk, std::vector<OlapTable
     return Status::OK();
 }
 
+bool OlapTablePartitionParam::_find_partitions_by_fixed_key(const Column* column,
+                                                            std::vector<OlapTablePartition*>* partitions,
+                                                            std::vector<uint32_t>* indexes,
+                                                            std::vector<uint8_t>* selection, int* invalid_row_index) {
+    if (column->is_constant()) {
+        return false;
+    }
+    if (column->is_nullable()) {
+        // null is the minimum value, leave it to the general path
+        if (column->has_null()) {
+            return false;
+        }
+        column = down_cast<const NullableColumn*>(column)->data_column().get();
+    }
+    switch (_partition_slot_descs[0]->type().type) {
+    case TYPE_TINYINT:
+        return _find_partitions_by_fixed_key<Int8Column>(column, partitions, indexes, selection, invalid_row_index);
+    case TYPE_SMALLINT:
+        return _find_partitions_by_fixed_key<Int16Column>(column, partitions, indexes, selection, invalid_row_index);
+    case TYPE_INT:
+        return _find_partitions_by_fixed_key<Int32Column>(column, partitions, indexes, selection, invalid_row_index);
+    case TYPE_BIGINT:
+        return _find_partitions_by_fixed_key<Int64Column>(column, partitions, indexes, selection, invalid_row_index);
+    case TYPE_LARGEINT:
+        return _find_partitions_by_fixed_key<Int128Column>(column, partitions, indexes, selection, invalid_row_index);
+    case TYPE_DATE:
+        return _find_partitions_by_fixed_key<DateColumn>(column, partitions, indexes, selection, invalid_row_index);
+    case TYPE_DATETIME:
+        return _find_partitions_by_fixed_key<TimestampColumn>(column, partitions, indexes, selection,
+                                                              invalid_row_index);
+    default:
+        return false;
+    }
+}
+
+template <typename ColumnType>
+bool OlapTablePartitionParam::_find_partitions_by_fixed_key(const Column* column,
+                                                            std::vector<OlapTablePartition*>* partitions,
+                                                            std::vector<uint32_t>* indexes,
+                                                            std::vector<uint8_t>* selection, int* invalid_row_index) {
+    using ValueType = typename ColumnType::ValueType;
+    // The partition keys are parsed by the types of the literals, check them as well as the input column.
+    auto keys_column = dynamic_cast<const ColumnType*>(_partition_columns[0].get());
+    auto input_column = dynamic_cast<const ColumnType*>(column);
+    if (keys_column == nullptr || input_column == nullptr) {
+        return false;
+    }
+    const auto& keys = keys_column->get_data();
+    const auto& values = input_column->get_data();
+
+    // Only the last partition may have no end key, which means the upper bound is boundless.
+    std::vector<ValueType> end_keys;
+    end_keys.reserve(_sorted_partitions.size());
+    for (auto part : _sorted_partitions) {
+        if (part->end_key.columns != nullptr) {
+            end_keys.emplace_back(keys[part->end_key.index]);
+        }
+    }
+
+    size_t num_rows = values.size();
+    for (size_t i = 0; i < num_rows; ++i) {
+        if (!(*selection)[i]) {
+            continue;
+        }
+        const ValueType& value = values[i];
+        size_t pos = std::upper_bound(end_keys.begin(), end_keys.end(), value) - end_keys.begin();
+        OlapTablePartition* part = pos < _sorted_partitions.size() ? _sorted_partitions[pos] : nullptr;
+        if (LIKELY(part != nullptr &&
+                   (part->start_key.columns == nullptr || !(value < keys[part->start_key.index])))) {
+            (*partitions)[i] = part;
+            (*indexes)[i] = (*indexes)[i] % part->num_buckets;
+        } else {
+            (*partitions)[i] = nullptr;
+            (*selection)[i] = 0;
+            if (invalid_row_index != nullptr) {
+                *invalid_row_index = i;
+            }
+        }
+    }
+    return true;
+}
+
 void OlapTablePartitionParam::_compute_hashes(Chunk* chunk, std::vector<uint32_t>* indexes) {
     size_t num_rows = chunk->num_rows();
     indexes->assign(num_rows, 0);
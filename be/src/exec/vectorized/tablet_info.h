@@ -77,6 +77,18 @@ private:
 
     void _compute_hashes(Chunk* chunk, std::vector<uint32_t>* indexes);
 
+    // The fast path of find_tablets for a single partition column of fixed length, which binary searches the
+    // values of the column over the end keys of the partitions instead of comparing the rows by
+    // Column::compare_at through _partitions_map. Returns false if |column| is not supported.
+    bool _find_partitions_by_fixed_key(const Column* column, std::vector<OlapTablePartition*>* partitions,
+                                       std::vector<uint32_t>* indexes, std::vector<uint8_t>* selection,
+                                       int* invalid_row_index);
+
+    template <typename ColumnType>
+    bool _find_partitions_by_fixed_key(const Column* column, std::vector<OlapTablePartition*>* partitions,
+                                       std::vector<uint32_t>* indexes, std::vector<uint8_t>* selection,
+                                       int* invalid_row_index);
+
     // check if this partition contain this key
     bool _part_contains(OlapTablePartition* part, ChunkRow* key) const {
         if (part->start_key.columns == nullptr) {
@@ -99,6 +111,8 @@ private:
     ObjectPool _obj_pool;
     std::vector<OlapTablePartition*> _partitions;
     std::map<ChunkRow*, OlapTablePartition*, PartionKeyComparator> _partitions_map;
+    // The partitions in the order of _partitions_map, i.e. the ascending order of the end keys.
+    std::vector<OlapTablePartition*> _sorted_partitions;
 };
 } // namespace vectorized
 } // namespace starrocks
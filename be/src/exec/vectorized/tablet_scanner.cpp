@@ -128,6 +128,9 @@ Status TabletScanner::_init_reader_params(const std::vector<OlapScanRange*>* key
     // to avoid the unnecessary SerDe and improve query performance
     _params.need_agg_finalize = _need_agg_finalize;
     _params.use_page_cache = !config::disable_storage_page_cache;
+    const int64_t sequential_scan_rows = config::storage_page_cache_sequential_scan_rows;
+    _params.sequential_scan = _parent->_limit == -1 && sequential_scan_rows > 0 &&
+                              static_cast<int64_t>(_tablet->num_rows()) >= sequential_scan_rows;
     // Improve for select * from table limit x, x is small
     if (_parent->_limit != -1 && _parent->_limit < runtime_state()->chunk_size()) {
         _params.chunk_size = _parent->_limit;
@@ -6,6 +6,7 @@
 #include <memory>
 
 #include "column/column_helper.h"
+#include "common/config.h"
 #include "exec/pipeline/exchange/local_exchange_source_operator.h"
 #include "exec/pipeline/limit_operator.h"
 #include "exec/pipeline/pipeline_builder.h"
@@ -19,6 +20,9 @@
 #include "exec/vectorized/chunks_sorter_full_sort.h"
 #include "exec/vectorized/chunks_sorter_heap_sort.h"
 #include "exec/vectorized/chunks_sorter_topn.h"
+#include "exec/vectorized/olap_scan_node.h"
+#include "exec/vectorized/project_node.h"
+#include "exprs/vectorized/column_ref.h"
 #include "gutil/casts.h"
 #include "runtime/current_thread.h"
 
@@ -191,13 +195,85 @@ Status TopNNode::_consume_chunks(RuntimeState* state, ExecNode* child) {
     return Status::OK();
 }
 
+// Return the OLAP scan whose rows reach |node| only filtered or projected, and map |slot_id| to the slot of
+// the scan it's a copy of, or return nullptr if there is no such scan.
+static OlapScanNode* find_source_olap_scan(ExecNode* node, SlotId* slot_id) {
+    while (true) {
+        switch (node->type()) {
+        case TPlanNodeType::OLAP_SCAN_NODE:
+            return dynamic_cast<OlapScanNode*>(node);
+        case TPlanNodeType::PROJECT_NODE: {
+            auto* project = dynamic_cast<ProjectNode*>(node);
+            if (project == nullptr || !project->is_child_slot_copy(*slot_id, slot_id)) {
+                return nullptr;
+            }
+            break;
+        }
+        case TPlanNodeType::SELECT_NODE:
+            break;
+        default:
+            return nullptr;
+        }
+        if (node->children().size() != 1) {
+            return nullptr;
+        }
+        node = node->child(0);
+    }
+}
+
+TopnRuntimeFilterPtr TopNNode::_build_topn_runtime_filter() {
+    if (!config::enable_topn_runtime_filter || _limit <= 0 || !_tnode.sort_node.use_top_n) {
+        return nullptr;
+    }
+    Expr* order_by = _sort_exec_exprs.lhs_ordering_expr_ctxs()[0]->root();
+    if (!order_by->is_slotref()) {
+        return nullptr;
+    }
+    SlotId slot_id = down_cast<ColumnRef*>(order_by)->slot_id();
+    const auto& slot_exprs = _sort_exec_exprs.sort_tuple_slot_expr_ctxs();
+    if (!slot_exprs.empty()) {
+        // The sort column is materialized from the input by the slot expr of the same position.
+        const auto& slots = _materialized_tuple_desc->slots();
+        auto iter = std::find_if(slots.begin(), slots.end(),
+                                 [slot_id](const SlotDescriptor* slot) { return slot->id() == slot_id; });
+        if (iter == slots.end() || !slot_exprs[iter - slots.begin()]->root()->is_slotref()) {
+            return nullptr;
+        }
+        slot_id = down_cast<ColumnRef*>(slot_exprs[iter - slots.begin()]->root())->slot_id();
+    }
+
+    OlapScanNode* scan = find_source_olap_scan(_children[0], &slot_id);
+    if (scan == nullptr) {
+        return nullptr;
+    }
+    const TupleDescriptor* tuple_desc =
+            runtime_state()->desc_tbl().get_tuple_descriptor(scan->thrift_olap_scan_node().tuple_id);
+    if (tuple_desc == nullptr) {
+        return nullptr;
+    }
+    const auto& scan_slots = tuple_desc->slots();
+    auto slot = std::find_if(scan_slots.begin(), scan_slots.end(),
+                             [slot_id](const SlotDescriptor* slot) { return slot->id() == slot_id; });
+    // The nulls ordered first can't be filtered by a zone map predicate.
+    if (slot == scan_slots.end() || ((*slot)->is_nullable() && _is_null_first[0])) {
+        return nullptr;
+    }
+    auto filter = std::make_shared<TopnRuntimeFilter>(slot_id, _is_asc_order[0]);
+    scan->add_topn_runtime_filter(filter);
+    return filter;
+}
+
 pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderContext* context) {
     using namespace pipeline;
 
-    OpFactories operators_sink_with_sort = _children[0]->decompose_to_pipeline(context);
     bool is_partition = _tnode.sort_node.__isset.partition_exprs && !_tnode.sort_node.partition_exprs.empty();
     bool is_rank_topn_type = _tnode.sort_node.__isset.topn_type && _tnode.sort_node.topn_type != TTopNType::ROW_NUMBER;
     bool is_merging = _analytic_partition_exprs.empty();
+    TopnRuntimeFilterPtr topn_runtime_filter;
+    if (!is_partition && is_merging) {
+        topn_runtime_filter = _build_topn_runtime_filter();
+    }
+    OpFactories operators_sink_with_sort = _children[0]->decompose_to_pipeline(context);
     int64_t partition_limit = -1;
     if (is_partition) {
         partition_limit = _tnode.sort_node.partition_limit;
@@ -211,6 +287,11 @@ pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderC
 
     auto degree_of_parallelism =
             down_cast<SourceOperatorFactory*>(operators_sink_with_sort[0].get())->degree_of_parallelism();
+    // A full sort could be merged by a LocalMergeSortSourceOperator for each sinker, see SortContext.
+    int32_t num_mergers = 1;
+    if (!is_partition && is_merging && _limit < 0 && config::enable_parallel_local_merge) {
+        num_mergers = degree_of_parallelism;
+    }
     std::any context_factory;
     if (is_partition) {
         context_factory = std::make_shared<LocalPartitionTopnContextFactory>(
@@ -220,7 +301,7 @@ pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderC
     } else {
         context_factory = std::make_shared<SortContextFactory>(
                 runtime_state(), _tnode.sort_node.topn_type, is_merging, _offset, _limit, degree_of_parallelism,
-                _sort_exec_exprs.lhs_ordering_expr_ctxs(), _is_asc_order, _is_null_first);
+                _sort_exec_exprs.lhs_ordering_expr_ctxs(), _is_asc_order, _is_null_first, num_mergers);
     }
 
     // Create a shared RefCountedRuntimeFilterCollector
@@ -237,6 +318,7 @@ pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderC
                 context->next_operator_id(), id(), sort_context_factory, _sort_exec_exprs, _is_asc_order,
                 _is_null_first, _sort_keys, _offset, _limit, _tnode.sort_node.topn_type, _order_by_types,
                 _materialized_tuple_desc, child(0)->row_desc(), _row_descriptor, _analytic_partition_exprs);
+        down_cast<PartitionSortSinkOperatorFactory*>(sink_operator.get())->set_topn_runtime_filter(topn_runtime_filter);
     }
     // Initialize OperatorFactory's fields involving runtime filters.
     this->init_runtime_filter_for_operator(sink_operator.get(), context, rc_rf_probe_collector);
@@ -262,8 +344,8 @@ pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderC
         if (is_partition) {
             source_operator->set_degree_of_parallelism(degree_of_parallelism);
         } else {
-            // source_operator's instance count must be 1
-            source_operator->set_degree_of_parallelism(1);
+            // Only the first source_operator outputs, the others merge a key range for it
+            source_operator->set_degree_of_parallelism(num_mergers);
         }
     } else {
         // Each PartitionSortSinkOperator has an independent LocalMergeSortSinkOperator respectively
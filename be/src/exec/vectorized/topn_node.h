@@ -4,6 +4,7 @@
 
 #include "exec/exec_node.h"
 #include "exec/sort_exec_exprs.h"
+#include "exec/vectorized/topn_runtime_filter.h"
 
 namespace starrocks::vectorized {
 
@@ -31,6 +32,9 @@ public:
 
 private:
     Status _consume_chunks(RuntimeState* state, ExecNode* child);
+    // Build the runtime filter of the boundary of the sort and add it to the OLAP scan below, or return
+    // nullptr if the first sort column does not come from such a scan.
+    TopnRuntimeFilterPtr _build_topn_runtime_filter();
     const TPlanNode& _tnode;
 
     // Only used for profile
@@ -0,0 +1,70 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "column/column.h"
+#include "column/column_helper.h"
+#include "common/global_types.h"
+
+namespace starrocks::vectorized {
+
+// TopnRuntimeFilter publishes the boundary of a top-n sort, i.e. the last row kept by one of its sorters,
+// to the scan feeding the sort. Since that sorter already keeps enough rows ordered before the boundary,
+// a row ordered strictly after it cannot be in the result, and the scan may skip the pages whose zone
+// map is entirely after the boundary.
+//
+// Only the first sort column is published, and only if its nulls are ordered last, so the nulls which
+// are not in the zone map ranges are after the boundary as well.
+class TopnRuntimeFilter {
+public:
+    TopnRuntimeFilter(SlotId slot_id, bool is_asc_order) : _slot_id(slot_id), _is_asc_order(is_asc_order) {}
+
+    SlotId slot_id() const { return _slot_id; }
+    // The rows greater than the boundary are filtered if true, otherwise the rows less than it.
+    bool is_asc_order() const { return _is_asc_order; }
+
+    // Called by a sorter keeping enough rows, |column| is its first sort column and |row| the last row.
+    // The boundary is only replaced by a tighter one.
+    void update(const Column& column, size_t row) {
+        if (column.is_null(row)) {
+            return;
+        }
+        const Column* data_column = ColumnHelper::get_data_column(&column);
+        std::lock_guard<std::mutex> l(_mutex);
+        if (_boundary != nullptr) {
+            int cmp = data_column->compare_at(row, 0, *_boundary, 1);
+            if (_is_asc_order ? cmp >= 0 : cmp <= 0) {
+                return;
+            }
+        }
+        ColumnPtr boundary = data_column->clone_empty();
+        boundary->append(*data_column, row, 1);
+        _boundary = std::move(boundary);
+        _version.fetch_add(1, std::memory_order_release);
+    }
+
+    // The number of times the boundary has been tightened, 0 if there is no boundary yet.
+    int64_t version() const { return _version.load(std::memory_order_acquire); }
+
+    // The not null column with the boundary as its only row, or nullptr if there is no boundary yet.
+    ColumnPtr boundary() const {
+        std::lock_guard<std::mutex> l(_mutex);
+        return _boundary;
+    }
+
+private:
+    const SlotId _slot_id;
+    const bool _is_asc_order;
+
+    mutable std::mutex _mutex;
+    ColumnPtr _boundary;
+    std::atomic<int64_t> _version{0};
+};
+
+using TopnRuntimeFilterPtr = std::shared_ptr<TopnRuntimeFilter>;
+
+} // namespace starrocks::vectorized
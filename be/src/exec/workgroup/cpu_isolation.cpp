@@ -0,0 +1,71 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/workgroup/cpu_isolation.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "exec/workgroup/work_group.h"
+#include "util/cpu_info.h"
+
+namespace starrocks::workgroup {
+
+// The worker id of the calling thread, -1 if it is not bound, see bind_worker_to_isolated_cores().
+static thread_local int tls_worker_id = -1;
+// The number of dedicated workers when the calling thread was last pinned, -1 if it has never been pinned.
+static thread_local int tls_bound_num_dedicated_workers = -1;
+
+int num_sq_dedicated_workers() {
+    if (!config::enable_workgroup_cpu_isolation) {
+        return 0;
+    }
+    // At least a core is left to the other workgroups.
+    int max_dedicated_workers = CpuInfo::num_cores() - 1;
+    auto sq_cpu_limit = static_cast<int>(WorkGroupManager::instance()->sq_workgroup_cpu_limit());
+    return std::max(0, std::min(sq_cpu_limit, max_dedicated_workers));
+}
+
+void bind_worker_to_isolated_cores(int worker_id) {
+    tls_worker_id = worker_id;
+    tls_bound_num_dedicated_workers = -1;
+}
+
+static void pin_current_thread(int begin_core, int end_core) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int core = begin_core; core < end_core; ++core) {
+        CPU_SET(core, &cpu_set);
+    }
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (ret != 0) {
+        LOG(WARNING) << "Failed to bind thread to cores [" << begin_core << ", " << end_core << "), error=" << ret;
+    }
+}
+
+bool is_current_worker_sq_dedicated() {
+    if (tls_worker_id < 0) {
+        return false;
+    }
+    int num_dedicated_workers = num_sq_dedicated_workers();
+    bool dedicated = tls_worker_id < num_dedicated_workers;
+    if (num_dedicated_workers != tls_bound_num_dedicated_workers) {
+        // A thread never pinned needn't be unpinned.
+        if (num_dedicated_workers > 0 || tls_bound_num_dedicated_workers > 0) {
+            if (num_dedicated_workers == 0) {
+                pin_current_thread(0, CpuInfo::num_cores());
+            } else if (dedicated) {
+                pin_current_thread(0, num_dedicated_workers);
+            } else {
+                pin_current_thread(num_dedicated_workers, CpuInfo::num_cores());
+            }
+        }
+        tls_bound_num_dedicated_workers = num_dedicated_workers;
+    }
+    return dedicated;
+}
+
+} // namespace starrocks::workgroup
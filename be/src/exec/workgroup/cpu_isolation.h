@@ -0,0 +1,29 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+namespace starrocks::workgroup {
+
+// Hard CPU isolation of the short query workgroup, enabled by config::enable_workgroup_cpu_isolation.
+//
+// The first cores of the BE, as many as the cpu limit of the short query workgroup, are dedicated to it.
+// The executor threads and the scan threads of the workgroups with the first worker ids are pinned to these
+// cores and only run the drivers and the scan tasks of the short query workgroup, while the other threads are
+// pinned to the rest of the cores. So the heavy queries of the other workgroups cannot take the cores of the
+// short queries, and the short queries may still use the other threads when their own are busy.
+//
+// Each executor or scan thread keeps the binding in a thread local, and rebinds itself when the cpu limit of
+// the short query workgroup changes.
+
+// Return the number of threads of an executor dedicated to the short query workgroup, 0 if the isolation is
+// disabled or there is no short query workgroup.
+int num_sq_dedicated_workers();
+
+// Called by each executor or scan thread of the workgroups before taking any driver or task.
+void bind_worker_to_isolated_cores(int worker_id);
+
+// Return true if the calling thread is dedicated to the short query workgroup, and pin it to the cores of its
+// side if the number of dedicated workers has changed since it was last pinned.
+bool is_current_worker_sq_dedicated();
+
+} // namespace starrocks::workgroup
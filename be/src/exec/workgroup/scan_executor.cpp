@@ -32,6 +32,7 @@ void ScanExecutor::change_num_threads(int32_t num_threads) {
 }
 
 void ScanExecutor::worker_thread() {
+    _task_queue->bind_worker(_next_id++);
     while (true) {
         if (_num_threads_setter.should_shrink()) {
             break;
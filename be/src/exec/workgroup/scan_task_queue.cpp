@@ -2,7 +2,10 @@
 
 #include "exec/workgroup/scan_task_queue.h"
 
+#include "common/config.h"
 #include "common/status.h"
+#include "exec/pipeline/numa_placement.h"
+#include "exec/workgroup/cpu_isolation.h"
 #include "exec/workgroup/work_group.h"
 #include "exec/workgroup/work_group_fwd.h"
 
@@ -24,6 +27,55 @@ bool PriorityScanTaskQueue::try_offer(ScanTask task) {
     return _queue.blocking_put(std::move(task));
 }
 
+/// NumaPartitionedScanTaskQueue.
+// The NUMA node of the calling scan thread, see bind_worker().
+static thread_local int tls_numa_node = 0;
+
+NumaPartitionedScanTaskQueue::NumaPartitionedScanTaskQueue(std::vector<std::unique_ptr<ScanTaskQueue>> node_queues)
+        : _node_queues(std::move(node_queues)) {
+    DCHECK(!_node_queues.empty());
+}
+
+void NumaPartitionedScanTaskQueue::close() {
+    for (auto& queue : _node_queues) {
+        queue->close();
+    }
+}
+
+ScanTaskQueue* NumaPartitionedScanTaskQueue::_queue_of_this_thread() const {
+    return _node_queues[tls_numa_node % _node_queues.size()].get();
+}
+
+StatusOr<ScanTask> NumaPartitionedScanTaskQueue::take() {
+    return _queue_of_this_thread()->take();
+}
+
+bool NumaPartitionedScanTaskQueue::try_offer(ScanTask task) {
+    auto& queue = _node_queues[task.numa_node % _node_queues.size()];
+    return queue->try_offer(std::move(task));
+}
+
+size_t NumaPartitionedScanTaskQueue::size() const {
+    size_t size = 0;
+    for (const auto& queue : _node_queues) {
+        size += queue->size();
+    }
+    return size;
+}
+
+void NumaPartitionedScanTaskQueue::update_statistics(WorkGroup* wg, int64_t runtime_ns) {
+    _queue_of_this_thread()->update_statistics(wg, runtime_ns);
+}
+
+bool NumaPartitionedScanTaskQueue::should_yield(const WorkGroup* wg, int64_t unaccounted_runtime_ns) const {
+    return _queue_of_this_thread()->should_yield(wg, unaccounted_runtime_ns);
+}
+
+void NumaPartitionedScanTaskQueue::bind_worker(int worker_id) {
+    tls_numa_node = worker_id % _node_queues.size();
+    pipeline::bind_current_thread_to_numa_node(tls_numa_node);
+}
+
 /// WorkGroupScanTaskQueue.
 bool WorkGroupScanTaskQueue::WorkGroupScanSchedEntityComparator::operator()(
         const WorkGroupScanSchedEntityPtr& lhs, const WorkGroupScanSchedEntityPtr& rhs) const {
@@ -39,6 +91,7 @@ void WorkGroupScanTaskQueue::close() {
 
     _is_closed = true;
     _cv.notify_all();
+    _sq_cv.notify_all();
 }
 
 StatusOr<ScanTask> WorkGroupScanTaskQueue::take() {
@@ -52,7 +105,12 @@ StatusOr<ScanTask> WorkGroupScanTaskQueue::take() {
 
         _update_bandwidth_control_period();
 
-        if (_wg_entities.empty()) {
+        if (is_current_worker_sq_dedicated()) {
+            if (wg_entity = _take_next_wg(true); wg_entity == nullptr) {
+                // Wake up now and then, in case this thread is not dedicated anymore.
+                _sq_cv.wait_for(lock, std::chrono::nanoseconds(BANDWIDTH_CONTROL_PERIOD_NS));
+            }
+        } else if (_wg_entities.empty()) {
             _cv.wait(lock);
         } else if (wg_entity = _take_next_wg(); wg_entity == nullptr) {
             int64_t cur_ns = MonotonicNanos();
@@ -90,6 +148,9 @@ bool WorkGroupScanTaskQueue::try_offer(ScanTask task) {
 
     _num_tasks++;
     _cv.notify_one();
+    if (wg_entity->is_sq_wg()) {
+        _sq_cv.notify_one();
+    }
     return true;
 }
 
@@ -98,6 +159,12 @@ void WorkGroupScanTaskQueue::update_statistics(WorkGroup* wg, int64_t runtime_ns
 
     auto* wg_entity = wg->scan_sched_entity();
 
+    // Consume the I/O tokens by the bytes read since the last update.
+    auto* io_bucket = wg_entity->io_token_bucket();
+    int64_t scan_bytes = wg->scan_bytes();
+    io_bucket->tokens -= scan_bytes - io_bucket->accounted_bytes;
+    io_bucket->accounted_bytes = scan_bytes;
+
     // Update bandwidth control information.
     _update_bandwidth_control_period();
     if (!wg_entity->is_sq_wg()) {
@@ -128,6 +195,10 @@ bool WorkGroupScanTaskQueue::should_yield(const WorkGroup* wg, int64_t unaccount
            _min_vruntime_ns.load() < wg_entity->vruntime_ns() + unaccounted_runtime_ns / wg_entity->cpu_limit();
 }
 
+void WorkGroupScanTaskQueue::bind_worker(int worker_id) {
+    bind_worker_to_isolated_cores(worker_id);
+}
+
 bool WorkGroupScanTaskQueue::_throttled(const workgroup::WorkGroupScanSchedEntity* wg_entity,
                                         int64_t unaccounted_runtime_ns) const {
     if (wg_entity->is_sq_wg()) {
@@ -152,16 +223,42 @@ void WorkGroupScanTaskQueue::_update_min_wg() {
     }
 }
 
-workgroup::WorkGroupScanSchedEntity* WorkGroupScanTaskQueue::_take_next_wg() {
-    workgroup::WorkGroupScanSchedEntity* min_unthrottled_wg_entity = nullptr;
+bool WorkGroupScanTaskQueue::_io_throttled(workgroup::WorkGroupScanSchedEntity* wg_entity, int64_t now_ns) {
+    // The bandwidth is shared by the workgroups with ready tasks, according to their cpu limits.
+    double bandwidth = double(config::scan_io_bandwidth_bytes_per_second) * wg_entity->cpu_limit() / _sum_cpu_limit;
+    auto capacity = static_cast<int64_t>(bandwidth * IO_BURST_PERIOD_NS / NANOS_PER_SEC);
+
+    auto* io_bucket = wg_entity->io_token_bucket();
+    if (io_bucket->last_refill_ns == 0) {
+        io_bucket->tokens = capacity;
+    } else {
+        auto refilled = static_cast<int64_t>(bandwidth * (now_ns - io_bucket->last_refill_ns) / NANOS_PER_SEC);
+        io_bucket->tokens = std::min(capacity, io_bucket->tokens + refilled);
+    }
+    io_bucket->last_refill_ns = now_ns;
+    return io_bucket->tokens < 0;
+}
+
+workgroup::WorkGroupScanSchedEntity* WorkGroupScanTaskQueue::_take_next_wg(bool sq_only) {
+    // A workgroup which has read more than its I/O bandwidth is only taken if all the others have as well, so that
+    // the I/O bandwidth isn't wasted.
+    bool io_control = config::scan_io_bandwidth_bytes_per_second > 0;
+    int64_t now_ns = io_control ? MonotonicNanos() : 0;
+    workgroup::WorkGroupScanSchedEntity* min_io_throttled_wg_entity = nullptr;
     for (const auto& wg_entity : _wg_entities) {
-        if (!_throttled(wg_entity)) {
-            min_unthrottled_wg_entity = wg_entity;
-            break;
+        if ((sq_only && !wg_entity->is_sq_wg()) || _throttled(wg_entity)) {
+            continue;
+        }
+        if (io_control && _io_throttled(wg_entity, now_ns)) {
+            if (min_io_throttled_wg_entity == nullptr) {
+                min_io_throttled_wg_entity = wg_entity;
+            }
+            continue;
         }
+        return wg_entity;
     }
 
-    return min_unthrottled_wg_entity;
+    return min_io_throttled_wg_entity;
 }
 
 void WorkGroupScanTaskQueue::_enqueue_workgroup(workgroup::WorkGroupScanSchedEntity* wg_entity) {
@@ -8,6 +8,7 @@
 #include <queue>
 #include <set>
 #include <unordered_set>
+#include <vector>
 
 #include "common/statusor.h"
 #include "exec/workgroup/work_group_fwd.h"
@@ -40,6 +41,8 @@ public:
     WorkGroup* workgroup;
     WorkFunction work_function;
     int priority = 0;
+    // Used by NumaPartitionedScanTaskQueue, see exec/pipeline/numa_placement.h.
+    int numa_node = 0;
 };
 
 class ScanTaskQueue {
@@ -57,6 +60,9 @@ public:
 
     virtual void update_statistics(WorkGroup* wg, int64_t runtime_ns) = 0;
     virtual bool should_yield(const WorkGroup* wg, int64_t unaccounted_runtime_ns) const = 0;
+
+    // Called by each scan thread before taking any task.
+    virtual void bind_worker(int worker_id) {}
 };
 
 class PriorityScanTaskQueue final : public ScanTaskQueue {
@@ -78,6 +84,31 @@ private:
     BlockingPriorityQueue<ScanTask> _queue;
 };
 
+// NumaPartitionedScanTaskQueue has a sub-queue per NUMA node. A task is offered to the sub-queue of its
+// numa_node, and a scan thread is pinned to a node and only takes the tasks from the sub-queue of this node.
+class NumaPartitionedScanTaskQueue final : public ScanTaskQueue {
+public:
+    explicit NumaPartitionedScanTaskQueue(std::vector<std::unique_ptr<ScanTaskQueue>> node_queues);
+    ~NumaPartitionedScanTaskQueue() override = default;
+
+    void close() override;
+
+    StatusOr<ScanTask> take() override;
+    bool try_offer(ScanTask task) override;
+
+    size_t size() const override;
+
+    void update_statistics(WorkGroup* wg, int64_t runtime_ns) override;
+    bool should_yield(const WorkGroup* wg, int64_t unaccounted_runtime_ns) const override;
+
+    void bind_worker(int worker_id) override;
+
+private:
+    ScanTaskQueue* _queue_of_this_thread() const;
+
+    std::vector<std::unique_ptr<ScanTaskQueue>> _node_queues;
+};
+
 class WorkGroupScanTaskQueue final : public ScanTaskQueue {
 public:
     WorkGroupScanTaskQueue() = default;
@@ -93,13 +124,18 @@ public:
     void update_statistics(WorkGroup* wg, int64_t runtime_ns) override;
     bool should_yield(const WorkGroup* wg, int64_t unaccounted_runtime_ns) const override;
 
+    void bind_worker(int worker_id) override;
+
 private:
     /// These methods should be guarded by the outside _global_mutex.
-    workgroup::WorkGroupScanSchedEntity* _take_next_wg();
+    // Only the short query workgroup is taken if |sq_only|, see exec/workgroup/cpu_isolation.h.
+    workgroup::WorkGroupScanSchedEntity* _take_next_wg(bool sq_only = false);
     // _update_min_wg is invoked when an entity is enqueued or dequeued from _wg_entities.
     void _update_min_wg();
     // Apply hard bandwidth control to non-short-query workgroups, when there are queries of the short-query workgroup.
     bool _throttled(const workgroup::WorkGroupScanSchedEntity* wg_entity, int64_t unaccounted_runtime_ns = 0) const;
+    // Refill the I/O tokens of the workgroup, and return true if it has read more than its I/O bandwidth.
+    bool _io_throttled(workgroup::WorkGroupScanSchedEntity* wg_entity, int64_t now_ns);
     // _update_bandwidth_control_period resets period_end_ns and period_usage_ns, when a new period comes.
     // It is invoked when taking a task to execute or an executed task is finished.
     void _update_bandwidth_control_period();
@@ -113,6 +149,8 @@ private:
 private:
     static constexpr int64_t SCHEDULE_PERIOD_PER_WG_NS = 100'000'000;
     static constexpr int64_t BANDWIDTH_CONTROL_PERIOD_NS = 100'000'000;
+    // A workgroup may read at most this period of its I/O bandwidth in a burst.
+    static constexpr int64_t IO_BURST_PERIOD_NS = 100'000'000;
 
     struct WorkGroupScanSchedEntityComparator {
         using WorkGroupScanSchedEntityPtr = workgroup::WorkGroupScanSchedEntity*;
@@ -122,6 +160,8 @@ private:
 
     mutable std::mutex _global_mutex;
     std::condition_variable _cv;
+    // The threads dedicated to the short query workgroup wait on it.
+    std::condition_variable _sq_cv;
     bool _is_closed = false;
 
     // Contains the workgroups which include the tasks ready to be run.
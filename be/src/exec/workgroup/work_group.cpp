@@ -156,6 +156,27 @@ Status WorkGroup::try_incr_num_queries() {
 void WorkGroup::decr_num_queries() {
     int64_t old = _num_running_queries.fetch_sub(1);
     DCHECK_GT(old, 0);
+    WorkGroupManager::instance()->notify_queued_queries();
+}
+
+Status WorkGroup::check_admission(int64_t estimated_mem_bytes) const {
+    int64_t num_running_queries = _num_running_queries;
+    if (num_running_queries == 0) {
+        return Status::OK();
+    }
+    if (_concurrency_limit != ABSENT_CONCURRENCY_LIMIT && num_running_queries >= _concurrency_limit) {
+        return Status::TooManyTasks(fmt::format("Exceed concurrency limit: {}", _concurrency_limit));
+    }
+    int64_t mem_limit = _mem_tracker->limit();
+    if (mem_limit > 0) {
+        auto mem_threshold = static_cast<int64_t>(mem_limit * config::query_queue_mem_used_pct_limit);
+        int64_t mem_used = _mem_tracker->consumption();
+        if (mem_used + estimated_mem_bytes > mem_threshold) {
+            return Status::TooManyTasks(fmt::format("Exceed memory threshold: used {} and estimated {} bytes, limit {}",
+                                                    mem_used, estimated_mem_bytes, mem_threshold));
+        }
+    }
+    return Status::OK();
 }
 
 Status WorkGroup::check_big_query(const QueryContext& query_context) {
@@ -185,6 +206,7 @@ void WorkGroup::copy_metrics(const WorkGroup& rhs) {
     _num_total_queries = rhs.num_total_queries();
     _concurrency_overflow_count = rhs.concurrency_overflow_count();
     _bigquery_count = rhs.bigquery_count();
+    _queue_timeout_count = rhs.queue_timeout_count();
 }
 
 /// WorkGroupManager.
@@ -268,6 +290,23 @@ void WorkGroupManager::add_metrics_unlocked(const WorkGroupPtr& wg, UniqueLockTy
                 "resource_group_bigquery_count", MetricLabels().add("name", wg->name()),
                 resource_group_bigquery_count.get());
 
+        // queued queries
+        auto resource_group_queued_queries = std::make_unique<IntGauge>(MetricUnit::NOUNIT);
+        bool queued_registered = StarRocksMetrics::instance()->metrics()->register_metric(
+                "resource_group_queued_queries", MetricLabels().add("name", wg->name()),
+                resource_group_queued_queries.get());
+
+        // queue timeout count
+        auto resource_group_queue_timeout_count = std::make_unique<IntGauge>(MetricUnit::NOUNIT);
+        bool queue_timeout_registered = StarRocksMetrics::instance()->metrics()->register_metric(
+                "resource_group_queue_timeout_count", MetricLabels().add("name", wg->name()),
+                resource_group_queue_timeout_count.get());
+
+        // scan bytes
+        auto resource_group_scan_bytes = std::make_unique<IntGauge>(MetricUnit::BYTES);
+        bool scan_bytes_registered = StarRocksMetrics::instance()->metrics()->register_metric(
+                "resource_group_scan_bytes", MetricLabels().add("name", wg->name()), resource_group_scan_bytes.get());
+
         unique_lock.lock();
         if (cpu_limit_registered) _wg_cpu_limit_metrics.emplace(wg->name(), std::move(resource_group_cpu_limit_ratio));
         if (cpu_ratio_registered) _wg_cpu_metrics.emplace(wg->name(), std::move(resource_group_cpu_use_ratio));
@@ -279,6 +318,10 @@ void WorkGroupManager::add_metrics_unlocked(const WorkGroupPtr& wg, UniqueLockTy
         if (concurrency_registered)
             _wg_concurrency_overflow_count.emplace(wg->name(), std::move(resource_group_concurrency_overflow));
         if (bigquery_registered) _wg_bigquery_count.emplace(wg->name(), std::move(resource_group_bigquery_count));
+        if (queued_registered) _wg_queued_queries.emplace(wg->name(), std::move(resource_group_queued_queries));
+        if (queue_timeout_registered)
+            _wg_queue_timeout_count.emplace(wg->name(), std::move(resource_group_queue_timeout_count));
+        if (scan_bytes_registered) _wg_scan_bytes.emplace(wg->name(), std::move(resource_group_scan_bytes));
     }
     _wg_metrics[wg->name()] = wg->unique_id();
 }
@@ -312,6 +355,9 @@ void WorkGroupManager::update_metrics_unlocked() {
             _wg_total_queries[name]->set_value(wg->num_total_queries());
             _wg_concurrency_overflow_count[name]->set_value(wg->concurrency_overflow_count());
             _wg_bigquery_count[name]->set_value(wg->bigquery_count());
+            _wg_queued_queries[name]->set_value(wg->num_queued_queries());
+            _wg_queue_timeout_count[name]->set_value(wg->queue_timeout_count());
+            _wg_scan_bytes[name]->set_value(wg->scan_bytes());
         } else {
             VLOG(2) << "workgroup update_metrics " << name << ", workgroup not exists so cleanup metrics";
 
@@ -324,10 +370,96 @@ void WorkGroupManager::update_metrics_unlocked() {
             _wg_total_queries[name]->set_value(0);
             _wg_concurrency_overflow_count[name]->set_value(0);
             _wg_bigquery_count[name]->set_value(0);
+            _wg_queued_queries[name]->set_value(0);
+            _wg_queue_timeout_count[name]->set_value(0);
+            _wg_scan_bytes[name]->set_value(0);
         }
     }
 }
 
+Status WorkGroupManager::admit_query(WorkGroup* wg, int64_t estimated_mem_bytes) {
+    int64_t timeout_ms = config::query_queue_timeout_ms;
+    if (timeout_ms <= 0) {
+        return wg->try_incr_num_queries();
+    }
+
+    // The conditions are re-checked periodically as well, since releasing memory or drivers does not notify.
+    static constexpr auto kRecheckInterval = std::chrono::milliseconds(100);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+    std::unique_lock lock(_queue_mutex);
+    auto query = _queued_queries.insert(_queued_queries.end(), QueuedQuery{wg, estimated_mem_bytes});
+    ++_num_queued_queries;
+    wg->incr_num_queued_queries();
+
+    Status st;
+    while (true) {
+        st = _check_admission_unlocked(query);
+        if (st.ok()) {
+            st = wg->try_incr_num_queries();
+            if (st.ok()) {
+                break;
+            }
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            wg->incr_queue_timeout_count();
+            st = Status::TooManyTasks(
+                    fmt::format("Wait for admission timeout after {}ms: {}", timeout_ms, st.get_error_msg()));
+            break;
+        }
+        _queue_cv.wait_until(lock, std::min(deadline, now + kRecheckInterval));
+    }
+
+    _queued_queries.erase(query);
+    --_num_queued_queries;
+    wg->decr_num_queued_queries();
+    if (st.ok() && !_queued_queries.empty()) {
+        // Another workgroup may be the next one to admit a query now.
+        _queue_cv.notify_all();
+    }
+    return st;
+}
+
+Status WorkGroupManager::_check_admission_unlocked(QueuedQueryIterator query) const {
+    // The driver backlog is shared by all the workgroups.
+    auto* driver_limiter = ExecEnv::GetInstance()->driver_limiter();
+    auto driver_threshold =
+            static_cast<int64_t>(driver_limiter->max_num_drivers() * config::query_queue_driver_high_water_ratio);
+    if (driver_limiter->num_total_drivers() > driver_threshold) {
+        return Status::TooManyTasks(
+                fmt::format("BE has overloaded with {} pipeline drivers", driver_limiter->num_total_drivers()));
+    }
+    RETURN_IF_ERROR(query->wg->check_admission(query->estimated_mem_bytes));
+
+    // Fairness across workgroups: a queued query that can be admitted as well goes first, if its workgroup runs fewer
+    // queries relative to its cpu limit, or as many and it arrived earlier.
+    auto running_share = [](const WorkGroup* wg) {
+        return double(wg->num_running_queries()) / std::max<size_t>(wg->cpu_limit(), 1);
+    };
+    double share = running_share(query->wg);
+    bool is_earlier = true;
+    for (auto it = _queued_queries.begin(); it != _queued_queries.end(); ++it) {
+        if (it == query) {
+            is_earlier = false;
+            continue;
+        }
+        double other_share = running_share(it->wg);
+        bool other_first = other_share < share || (other_share == share && is_earlier);
+        if (other_first && it->wg->check_admission(it->estimated_mem_bytes).ok()) {
+            return Status::TooManyTasks(fmt::format("Queued behind the queries of resource group {}", it->wg->name()));
+        }
+    }
+    return Status::OK();
+}
+
+void WorkGroupManager::notify_queued_queries() {
+    if (_num_queued_queries > 0) {
+        std::lock_guard lock(_queue_mutex);
+        _queue_cv.notify_all();
+    }
+}
+
 void WorkGroupManager::update_metrics() {
     std::unique_lock write_lock(_mutex);
     update_metrics_unlocked();
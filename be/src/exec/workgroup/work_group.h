@@ -2,6 +2,8 @@
 
 #pragma once
 #include <atomic>
+#include <condition_variable>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -56,6 +58,16 @@ public:
     int64_t runtime_ns() const { return _vruntime_ns * cpu_limit(); }
     void incr_runtime_ns(int64_t runtime_ns) { _vruntime_ns += runtime_ns / cpu_limit(); }
 
+    // The token bucket of the I/O bandwidth of this group, used by WorkGroupScanTaskQueue.
+    struct IOTokenBucket {
+        // The bytes this group may still read, negative when it has read more than its share.
+        int64_t tokens = 0;
+        int64_t last_refill_ns = 0;
+        // WorkGroup::scan_bytes() when the tokens were last consumed.
+        int64_t accounted_bytes = 0;
+    };
+    IOTokenBucket* io_token_bucket() { return &_io_token_bucket; }
+
 private:
     WorkGroup* _workgroup; // The workgroup owning this entity.
 
@@ -63,6 +75,7 @@ private:
     Q* _in_queue = nullptr;                 // The queue on which this entity is queued.
 
     int64_t _vruntime_ns = 0;
+    IOTokenBucket _io_token_bucket;
 };
 
 using WorkGroupDriverSchedEntity = WorkGroupSchedEntity<pipeline::DriverQueue>;
@@ -140,9 +153,20 @@ public:
     Status check_big_query(const QueryContext& query_context);
     Status try_incr_num_queries();
     void decr_num_queries();
+    // Return non-ok status if a new query using |estimated_mem_bytes| bytes should wait to be admitted, because
+    // this workgroup runs out of concurrency or memory. A workgroup without running queries admits any query.
+    Status check_admission(int64_t estimated_mem_bytes) const;
+    void incr_num_queued_queries() { ++_num_queued_queries; }
+    void decr_num_queued_queries() { --_num_queued_queries; }
+    void incr_queue_timeout_count() { ++_queue_timeout_count; }
     int64_t num_running_queries() const { return _num_running_queries; }
     int64_t num_total_queries() const { return _num_total_queries; }
     int64_t concurrency_overflow_count() const { return _concurrency_overflow_count; }
+    int64_t num_queued_queries() const { return _num_queued_queries; }
+    int64_t queue_timeout_count() const { return _queue_timeout_count; }
+    // The bytes read by the scan tasks of this workgroup.
+    void incr_scan_bytes(int64_t bytes) { _scan_bytes += bytes; }
+    int64_t scan_bytes() const { return _scan_bytes; }
     int64_t bigquery_count() const { return _bigquery_count; }
 
     int64_t big_query_mem_limit() const { return _big_query_mem_limit; }
@@ -189,6 +213,9 @@ private:
     std::atomic<int64_t> _num_total_queries = 0;
     std::atomic<int64_t> _concurrency_overflow_count = 0;
     std::atomic<int64_t> _bigquery_count = 0;
+    std::atomic<int64_t> _num_queued_queries = 0;
+    std::atomic<int64_t> _queue_timeout_count = 0;
+    std::atomic<int64_t> _scan_bytes = 0;
 };
 
 // WorkGroupManager is a singleton used to manage WorkGroup instances in BE, it has an io queue and a cpu queues for
@@ -212,6 +239,15 @@ public:
     void decr_num_running_sq_drivers() { _num_running_sq_drivers--; }
     bool is_sq_wg_running() const { return _num_running_sq_drivers > 0; }
     size_t normal_workgroup_cpu_hard_limit() const;
+    size_t sq_workgroup_cpu_limit() const { return _rt_cpu_limit; }
+
+    // Admit a new query using |estimated_mem_bytes| bytes to |wg|, and increase the number of running queries of |wg|.
+    // If |wg| or the BE is overloaded, the query waits in a queue shared by all the workgroups for at most
+    // config::query_queue_timeout_ms, and the next query admitted is the one of the workgroup running the fewest
+    // queries relative to its cpu limit. Return TooManyTasks if the query is not admitted.
+    Status admit_query(WorkGroup* wg, int64_t estimated_mem_bytes);
+    // Wake up the queued queries, called when a query finishes.
+    void notify_queued_queries();
 
     void update_metrics();
 
@@ -228,6 +264,14 @@ private:
     void add_metrics_unlocked(const WorkGroupPtr& wg, UniqueLockType& unique_lock);
     void update_metrics_unlocked();
 
+    struct QueuedQuery {
+        WorkGroup* wg;
+        int64_t estimated_mem_bytes;
+    };
+    using QueuedQueryIterator = std::list<QueuedQuery>::iterator;
+    // Return the reason the query cannot be admitted yet, _queue_mutex is held.
+    Status _check_admission_unlocked(QueuedQueryIterator query) const;
+
 private:
     std::shared_mutex _mutex;
     std::unordered_map<int128_t, WorkGroupPtr> _workgroups;
@@ -238,6 +282,12 @@ private:
     std::atomic<size_t> _sum_cpu_limit = 0;
     std::atomic<size_t> _rt_cpu_limit = 0;
 
+    // The queries waiting for admission, in the order they arrive.
+    std::mutex _queue_mutex;
+    std::condition_variable _queue_cv;
+    std::list<QueuedQuery> _queued_queries;
+    std::atomic<size_t> _num_queued_queries = 0;
+
     std::once_flag init_metrics_once_flag;
     std::unordered_map<std::string, int128_t> _wg_metrics;
 
@@ -250,6 +300,9 @@ private:
     std::unordered_map<std::string, std::unique_ptr<starrocks::IntGauge>> _wg_total_queries;
     std::unordered_map<std::string, std::unique_ptr<starrocks::IntGauge>> _wg_concurrency_overflow_count;
     std::unordered_map<std::string, std::unique_ptr<starrocks::IntGauge>> _wg_bigquery_count;
+    std::unordered_map<std::string, std::unique_ptr<starrocks::IntGauge>> _wg_queued_queries;
+    std::unordered_map<std::string, std::unique_ptr<starrocks::IntGauge>> _wg_queue_timeout_count;
+    std::unordered_map<std::string, std::unique_ptr<starrocks::IntGauge>> _wg_scan_bytes;
 };
 
 class DefaultWorkGroupInitialization {
@@ -69,6 +69,9 @@ public:
     template <PrimitiveType PT>
     static AggregateFunctionPtr MakeCountDistinctAggregateFunctionV2();
 
+    template <PrimitiveType PT>
+    static AggregateFunctionPtr MakeCountDistinctAggregateFunctionV3();
+
     template <PrimitiveType PT>
     static AggregateFunctionPtr MakeGroupConcatAggregateFunction();
 
@@ -123,6 +126,8 @@ public:
 
     static AggregateFunctionPtr MakePercentileApproxAggregateFunction();
 
+    static AggregateFunctionPtr MakePercentileApproxKllAggregateFunction();
+
     static AggregateFunctionPtr MakePercentileUnionAggregateFunction();
 
     template <PrimitiveType PT>
@@ -207,6 +212,11 @@ AggregateFunctionPtr AggregateFactory::MakeCountDistinctAggregateFunctionV2() {
     return std::make_shared<DistinctAggregateFunctionV2<PT, AggDistinctType::COUNT>>();
 }
 
+template <PrimitiveType PT>
+AggregateFunctionPtr AggregateFactory::MakeCountDistinctAggregateFunctionV3() {
+    return std::make_shared<DistinctAggregateFunctionV3<PT, AggDistinctType::COUNT>>();
+}
+
 template <PrimitiveType PT>
 AggregateFunctionPtr AggregateFactory::MakeGroupConcatAggregateFunction() {
     return std::make_shared<GroupConcatAggregateFunction<PT>>();
@@ -307,6 +317,10 @@ AggregateFunctionPtr AggregateFactory::MakePercentileApproxAggregateFunction() {
     return std::make_shared<PercentileApproxAggregateFunction>();
 }
 
+AggregateFunctionPtr AggregateFactory::MakePercentileApproxKllAggregateFunction() {
+    return std::make_shared<PercentileApproxKllAggregateFunction>();
+}
+
 AggregateFunctionPtr AggregateFactory::MakePercentileUnionAggregateFunction() {
     return std::make_shared<PercentileUnionAggregateFunction>();
 }
@@ -493,6 +507,8 @@ public:
         //so here are the separate processing function percentile_approx
         if (name == "percentile_approx") {
             return AggregateFactory::MakePercentileApproxAggregateFunction();
+        } else if (name == "percentile_approx_kll") {
+            return AggregateFactory::MakePercentileApproxKllAggregateFunction();
         }
 
         return nullptr;
@@ -614,6 +630,10 @@ public:
                 auto distinct = AggregateFactory::MakeCountDistinctAggregateFunctionV2<ArgPT>();
                 return AggregateFactory::MakeNullableAggregateFunctionUnary<
                         DistinctAggregateStateV2<ArgPT, SumResultPT<ArgPT>>, IsWindowFunc>(distinct);
+            } else if (name == "multi_distinct_count3") {
+                auto distinct = AggregateFactory::MakeCountDistinctAggregateFunctionV3<ArgPT>();
+                return AggregateFactory::MakeNullableAggregateFunctionUnary<
+                        DistinctAggregateStateV3<ArgPT, SumResultPT<ArgPT>>, IsWindowFunc>(distinct);
             } else if (name == "multi_distinct_sum") {
                 auto distinct = AggregateFactory::MakeSumDistinctAggregateFunction<ArgPT>();
                 return AggregateFactory::MakeNullableAggregateFunctionUnary<
@@ -663,6 +683,8 @@ public:
                 return AggregateFactory::MakeCountDistinctAggregateFunction<ArgPT>();
             } else if (name == "multi_distinct_count2") {
                 return AggregateFactory::MakeCountDistinctAggregateFunctionV2<ArgPT>();
+            } else if (name == "multi_distinct_count3") {
+                return AggregateFactory::MakeCountDistinctAggregateFunctionV3<ArgPT>();
             } else if (name == "multi_distinct_sum") {
                 return AggregateFactory::MakeSumDistinctAggregateFunction<ArgPT>();
             } else if (name == "multi_distinct_sum2") {
@@ -740,6 +762,10 @@ public:
                 auto distinct = AggregateFactory::MakeCountDistinctAggregateFunctionV2<ArgPT>();
                 return AggregateFactory::MakeNullableAggregateFunctionUnary<
                         DistinctAggregateStateV2<ArgPT, SumResultPT<ArgPT>>, IsWindowFunc>(distinct);
+            } else if (name == "multi_distinct_count3") {
+                auto distinct = AggregateFactory::MakeCountDistinctAggregateFunctionV3<ArgPT>();
+                return AggregateFactory::MakeNullableAggregateFunctionUnary<
+                        DistinctAggregateStateV3<ArgPT, SumResultPT<ArgPT>>, IsWindowFunc>(distinct);
             } else if (name == "group_concat") {
                 auto group_count = AggregateFactory::MakeGroupConcatAggregateFunction<ArgPT>();
                 return AggregateFactory::MakeNullableAggregateFunctionVariadic<GroupConcatAggregateState>(group_count);
@@ -767,6 +793,8 @@ public:
                 return AggregateFactory::MakeCountDistinctAggregateFunction<ArgPT>();
             } else if (name == "multi_distinct_count2") {
                 return AggregateFactory::MakeCountDistinctAggregateFunctionV2<ArgPT>();
+            } else if (name == "multi_distinct_count3") {
+                return AggregateFactory::MakeCountDistinctAggregateFunctionV3<ArgPT>();
             } else if (name == "group_concat") {
                 return AggregateFactory::MakeGroupConcatAggregateFunction<ArgPT>();
             } else if (name == "any_value") {
@@ -906,6 +934,23 @@ AggregateFuncResolver::AggregateFuncResolver() {
     add_aggregate_mapping<TYPE_DECIMAL64, TYPE_BIGINT>("multi_distinct_count2");
     add_aggregate_mapping<TYPE_DECIMAL128, TYPE_BIGINT>("multi_distinct_count2");
 
+    add_aggregate_mapping<TYPE_BOOLEAN, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_TINYINT, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_SMALLINT, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_INT, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_BIGINT, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_LARGEINT, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_FLOAT, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_DOUBLE, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_CHAR, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_VARCHAR, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_DECIMALV2, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_DATETIME, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_DATE, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_DECIMAL32, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_DECIMAL64, TYPE_BIGINT>("multi_distinct_count3");
+    add_aggregate_mapping<TYPE_DECIMAL128, TYPE_BIGINT>("multi_distinct_count3");
+
     add_aggregate_mapping<TYPE_BOOLEAN, TYPE_BIGINT>("multi_distinct_sum2");
     add_aggregate_mapping<TYPE_TINYINT, TYPE_BIGINT>("multi_distinct_sum2");
     add_aggregate_mapping<TYPE_SMALLINT, TYPE_BIGINT>("multi_distinct_sum2");
@@ -1120,6 +1165,8 @@ AggregateFuncResolver::AggregateFuncResolver() {
 
     add_object_mapping<TYPE_BIGINT, TYPE_DOUBLE>("percentile_approx");
     add_object_mapping<TYPE_DOUBLE, TYPE_DOUBLE>("percentile_approx");
+    add_object_mapping<TYPE_BIGINT, TYPE_DOUBLE>("percentile_approx_kll");
+    add_object_mapping<TYPE_DOUBLE, TYPE_DOUBLE>("percentile_approx_kll");
 
     add_object_mapping<TYPE_PERCENTILE, TYPE_PERCENTILE>("percentile_union");
 
@@ -1163,6 +1210,10 @@ static const AggregateFunction* get_function(const std::string& name, PrimitiveT
             func_name = "multi_distinct_count2";
         }
     }
+    // The partitioned state of multi_distinct_count3 is serialized in a different format.
+    if (func_version > 4 && name == "multi_distinct_count") {
+        func_name = "multi_distinct_count3";
+    }
 
     auto is_decimal_type = [](PrimitiveType pt) {
         return pt == TYPE_DECIMAL32 || pt == TYPE_DECIMAL64 || pt == TYPE_DECIMAL128;
@@ -10,23 +10,27 @@
 
 namespace starrocks::vectorized {
 
+// The bitmaps are unioned lazily, and the state is repaired only once it is serialized or finalized.
 class BitmapUnionAggregateFunction final
         : public AggregateFunctionBatchHelper<BitmapValue, BitmapUnionAggregateFunction> {
 public:
     void update(FunctionContext* ctx, const Column** columns, AggDataPtr state, size_t row_num) const override {
         const BitmapColumn* col = down_cast<const BitmapColumn*>(columns[0]);
-        this->data(state) |= *(col->get_object(row_num));
+        this->data(state).lazy_union(*(col->get_object(row_num)));
     }
 
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         const BitmapColumn* col = down_cast<const BitmapColumn*>(column);
         DCHECK(col->is_object());
-        this->data(state) |= *(col->get_object(row_num));
+        this->data(state).lazy_union(*(col->get_object(row_num)));
     }
 
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         BitmapColumn* col = down_cast<BitmapColumn*>(to);
         BitmapValue& bitmap = const_cast<BitmapValue&>(this->data(state));
+        bitmap.repair_after_lazy_union();
+        // The run containers make a dense intermediate bitmap much smaller to be sent.
+        bitmap.compress();
         col->append(std::move(bitmap));
     }
 
@@ -38,6 +42,7 @@ public:
     void finalize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         BitmapColumn* col = down_cast<BitmapColumn*>(to);
         BitmapValue& bitmap = const_cast<BitmapValue&>(this->data(state));
+        bitmap.repair_after_lazy_union();
         col->append(std::move(bitmap));
     }
 
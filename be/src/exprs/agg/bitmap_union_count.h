@@ -10,6 +10,7 @@
 
 namespace starrocks::vectorized {
 
+// The bitmaps are unioned lazily, and the state is repaired only once its count is taken or it is serialized.
 class BitmapUnionCountAggregateFunction final
         : public AggregateFunctionBatchHelper<BitmapValue, BitmapUnionCountAggregateFunction> {
 public:
@@ -19,12 +20,12 @@ public:
 
     void update(FunctionContext* ctx, const Column** columns, AggDataPtr state, size_t row_num) const override {
         const BitmapColumn* col = down_cast<const BitmapColumn*>(columns[0]);
-        this->data(state) |= *(col->get_object(row_num));
+        this->data(state).lazy_union(*(col->get_object(row_num)));
     }
 
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         const BitmapColumn* col = down_cast<const BitmapColumn*>(column);
-        this->data(state) |= *(col->get_object(row_num));
+        this->data(state).lazy_union(*(col->get_object(row_num)));
     }
 
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
@@ -32,7 +33,7 @@ public:
                                               int64_t frame_end) const override {
         const BitmapColumn* col = down_cast<const BitmapColumn*>(columns[0]);
         for (size_t i = frame_start; i < frame_end; ++i) {
-            this->data(state) |= *(col->get_object(i));
+            this->data(state).lazy_union(*(col->get_object(i)));
         }
     }
 
@@ -40,14 +41,19 @@ public:
                     size_t end) const override {
         Int64Column* column = down_cast<Int64Column*>(dst);
         auto& value = const_cast<BitmapValue&>(this->data(state));
+        value.repair_after_lazy_union();
+        int64_t cardinality = value.cardinality();
         for (size_t i = start; i < end; ++i) {
-            column->get_data()[i] = value.cardinality();
+            column->get_data()[i] = cardinality;
         }
     }
 
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         BitmapColumn* col = down_cast<BitmapColumn*>(to);
         auto& value = const_cast<BitmapValue&>(this->data(state));
+        value.repair_after_lazy_union();
+        // The run containers make a dense intermediate bitmap much smaller to be sent.
+        value.compress();
         col->append(std::move(value));
     }
 
@@ -58,7 +64,10 @@ public:
 
     void finalize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         DCHECK(to->is_numeric());
-        down_cast<Int64Column*>(to)->append(this->data(state).cardinality());
+        // Only the count is needed, the repaired bitmap is not moved out.
+        auto& value = const_cast<BitmapValue&>(this->data(state));
+        value.repair_after_lazy_union();
+        down_cast<Int64Column*>(to)->append(value.cardinality());
     }
 
     std::string get_name() const override { return "bitmap_union_count"; }
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "column/object_column.h"
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
@@ -24,15 +26,26 @@ public:
         }
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        DCHECK((*columns[0]).is_numeric());
+        if constexpr (std::is_integral_v<T>) {
+            const auto& data = static_cast<const InputColumnType&>(*columns[0]).get_data();
+            std::vector<uint64_t> values(data.begin(), data.begin() + chunk_size);
+            this->data(state).add_many(values.size(), values.data());
+        }
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(column->is_object());
         const BitmapColumn* col = down_cast<const BitmapColumn*>(column);
-        this->data(state) |= *(col->get_object(row_num));
+        this->data(state).lazy_union(*(col->get_object(row_num)));
     }
 
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         BitmapColumn* col = down_cast<BitmapColumn*>(to);
         auto& value = const_cast<BitmapValue&>(this->data(state));
+        value.repair_after_lazy_union();
         col->append(std::move(value));
     }
 
@@ -50,7 +63,9 @@ public:
 
     void finalize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         DCHECK(to->is_numeric());
-        down_cast<Int64Column*>(to)->append(this->data(state).cardinality());
+        auto& value = const_cast<BitmapValue&>(this->data(state));
+        value.repair_after_lazy_union();
+        down_cast<Int64Column*>(to)->append(value.cardinality());
     }
 
     std::string get_name() const override { return "bitmap_union_int"; }
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <limits>
 #include <string>
@@ -260,6 +261,232 @@ struct DistinctAggregateStateV2<PT, SumPT, FixedLengthPTGuard<PT>> {
 template <PrimitiveType PT, PrimitiveType SumPT>
 struct DistinctAggregateStateV2<PT, SumPT, BinaryPTGuard<PT>> : public DistinctAggregateState<PT, SumPT> {};
 
+// A set radix-partitioned by the hash of its keys, each partition being an independent phmap set. A set of
+// a high NDV grows, and is merged, one partition at a time instead of at once.
+//
+// The serialized partitions are preceded by a header of the end offset of each of them, so a partition
+// could be read, and merged, without the others.
+template <typename HashSetType>
+class PartitionedHashSet {
+public:
+    static constexpr size_t kPartitionBits = 4;
+    static constexpr size_t kNumPartitions = 1 << kPartitionBits;
+    static constexpr size_t kHeaderSize = kNumPartitions * sizeof(uint64_t);
+
+    // The partition is taken from the high bits of the hash mixed again, the bits used by phmap to find the
+    // slot are then still spread in each partition.
+    static size_t partition_of(size_t hash) {
+        return static_cast<uint64_t>(hash * 0x9E3779B97F4A7C15ULL) >> (64 - kPartitionBits);
+    }
+
+    auto hash_function() const { return _partitions[0].hash_function(); }
+    void prefetch_hash(size_t hash) { _partitions[partition_of(hash)].prefetch_hash(hash); }
+
+    HashSetType& partition(size_t i) { return _partitions[i]; }
+    const HashSetType& partition(size_t i) const { return _partitions[i]; }
+    HashSetType& partition_of_hash(size_t hash) { return _partitions[partition_of(hash)]; }
+
+    size_t size() const {
+        size_t size = 0;
+        for (const auto& partition : _partitions) {
+            size += partition.size();
+        }
+        return size;
+    }
+
+    // Write the header of the partitions of |sizes| bytes, followed by the partitions written by the caller.
+    static uint8_t* write_header(uint8_t* dst, const std::array<size_t, kNumPartitions>& sizes) {
+        uint64_t end = 0;
+        for (size_t i = 0; i < kNumPartitions; i++) {
+            end += sizes[i];
+            memcpy(dst + i * sizeof(uint64_t), &end, sizeof(end));
+        }
+        return dst + kHeaderSize;
+    }
+
+    // The |partition|-th serialized partition in the |len| bytes of |src|.
+    static Slice serialized_partition(const uint8_t* src, size_t len, size_t partition) {
+        DCHECK_GE(len, kHeaderSize);
+        uint64_t begin = 0;
+        uint64_t end = 0;
+        if (partition > 0) {
+            memcpy(&begin, src + (partition - 1) * sizeof(uint64_t), sizeof(begin));
+        }
+        memcpy(&end, src + partition * sizeof(uint64_t), sizeof(end));
+        DCHECK_LE(kHeaderSize + end, len);
+        return {src + kHeaderSize + begin, end - begin};
+    }
+
+private:
+    std::array<HashSetType, kNumPartitions> _partitions;
+};
+
+// DistinctAggregateStateV3 keeps the keys in a PartitionedHashSet, and merges a serialized state partition by
+// partition.
+template <PrimitiveType PT, PrimitiveType SumPT, typename = guard::Guard>
+struct DistinctAggregateStateV3 {};
+
+template <PrimitiveType PT, PrimitiveType SumPT>
+struct DistinctAggregateStateV3<PT, SumPT, FixedLengthPTGuard<PT>> {
+    using T = RunTimeCppType<PT>;
+    using SumType = RunTimeCppType<SumPT>;
+    using MyHashSet = PartitionedHashSet<HashSet<T>>;
+    static constexpr size_t item_size = phmap::item_serialize_size<HashSet<T>>::value;
+
+    size_t update(T key) { return update_with_hash(nullptr, key, set.hash_function()(key)); }
+
+    size_t update_with_hash([[maybe_unused]] MemPool* mempool, T key, size_t hash) {
+        auto pair = set.partition_of_hash(hash).emplace_with_hash(hash, key);
+        return pair.second * item_size;
+    }
+
+    int64_t disctint_count() const { return set.size(); }
+
+    size_t serialize_size() const { return MyHashSet::kHeaderSize + set.size() * sizeof(T); }
+
+    void serialize(uint8_t* dst) const {
+        std::array<size_t, MyHashSet::kNumPartitions> sizes;
+        for (size_t i = 0; i < MyHashSet::kNumPartitions; i++) {
+            sizes[i] = set.partition(i).size() * sizeof(T);
+        }
+        dst = MyHashSet::write_header(dst, sizes);
+        for (size_t i = 0; i < MyHashSet::kNumPartitions; i++) {
+            for (auto& key : set.partition(i)) {
+                memcpy(dst, &key, sizeof(T));
+                dst += sizeof(T);
+            }
+        }
+    }
+
+    size_t deserialize_and_merge(const uint8_t* src, size_t len) {
+        size_t mem_usage = 0;
+        for (size_t i = 0; i < MyHashSet::kNumPartitions; i++) {
+            mem_usage += merge_partition(MyHashSet::serialized_partition(src, len, i));
+        }
+        return mem_usage;
+    }
+
+    // Merge a partition serialized by serialize().
+    size_t merge_partition(const Slice& data) {
+        DCHECK_EQ(0, data.size % sizeof(T));
+        size_t num_keys = data.size / sizeof(T);
+        size_t old_size = set.size();
+        const auto* src = reinterpret_cast<const uint8_t*>(data.data);
+        auto hasher = set.hash_function();
+        for (size_t i = 0; i < num_keys; i++) {
+            T key;
+            memcpy(&key, src + i * sizeof(T), sizeof(T));
+            size_t hash = hasher(key);
+            set.partition_of_hash(hash).emplace_with_hash(hash, key);
+        }
+        return (set.size() - old_size) * item_size;
+    }
+
+    SumType sum_distinct() const {
+        SumType sum{};
+        // Sum distinct doesn't support timestamp and date type
+        if constexpr (IsDateTime<SumType>) {
+            return sum;
+        }
+
+        for (size_t i = 0; i < MyHashSet::kNumPartitions; i++) {
+            for (auto& key : set.partition(i)) {
+                sum += key;
+            }
+        }
+        return sum;
+    }
+
+    MyHashSet set;
+};
+
+template <PrimitiveType PT, PrimitiveType SumPT>
+struct DistinctAggregateStateV3<PT, SumPT, BinaryPTGuard<PT>> {
+    using KeyType = typename SliceHashSet::key_type;
+    using MyHashSet = PartitionedHashSet<SliceHashSet>;
+
+    size_t update(MemPool* mem_pool, Slice raw_key) { return _emplace(mem_pool, KeyType(raw_key)); }
+
+    size_t update_with_hash(MemPool* mem_pool, Slice raw_key, size_t hash) {
+        return _emplace(mem_pool, KeyType(reinterpret_cast<uint8_t*>(raw_key.data), raw_key.size, hash));
+    }
+
+    int64_t disctint_count() const { return set.size(); }
+
+    size_t serialize_size() const {
+        size_t size = MyHashSet::kHeaderSize;
+        for (size_t i = 0; i < MyHashSet::kNumPartitions; i++) {
+            size += _partition_serialize_size(i);
+        }
+        return size;
+    }
+
+    void serialize(uint8_t* dst) const {
+        std::array<size_t, MyHashSet::kNumPartitions> sizes;
+        for (size_t i = 0; i < MyHashSet::kNumPartitions; i++) {
+            sizes[i] = _partition_serialize_size(i);
+        }
+        dst = MyHashSet::write_header(dst, sizes);
+        for (size_t i = 0; i < MyHashSet::kNumPartitions; i++) {
+            for (auto& key : set.partition(i)) {
+                uint32_t size = (uint32_t)key.size;
+                memcpy(dst, &size, sizeof(uint32_t));
+                dst += sizeof(uint32_t);
+                memcpy(dst, key.data, key.size);
+                dst += key.size;
+            }
+        }
+    }
+
+    size_t deserialize_and_merge(MemPool* mem_pool, const uint8_t* src, size_t len) {
+        size_t mem_usage = 0;
+        for (size_t i = 0; i < MyHashSet::kNumPartitions; i++) {
+            mem_usage += merge_partition(mem_pool, MyHashSet::serialized_partition(src, len, i));
+        }
+        return mem_usage;
+    }
+
+    // Merge a partition serialized by serialize().
+    size_t merge_partition(MemPool* mem_pool, const Slice& data) {
+        size_t mem_usage = 0;
+        const auto* src = reinterpret_cast<const uint8_t*>(data.data);
+        const uint8_t* end = src + data.size;
+        while (src < end) {
+            uint32_t size = 0;
+            memcpy(&size, src, sizeof(uint32_t));
+            src += sizeof(uint32_t);
+            mem_usage += _emplace(mem_pool, KeyType(Slice(src, size)));
+            src += size;
+        }
+        DCHECK(src == end);
+        return mem_usage;
+    }
+
+    MyHashSet set;
+
+private:
+    // we only memcpy when the key is new
+    size_t _emplace(MemPool* mem_pool, const KeyType& key) {
+        size_t ret = 0;
+        set.partition_of_hash(key.hash).lazy_emplace_with_hash(key, key.hash, [&](const auto& ctor) {
+            uint8_t* pos = mem_pool->allocate(key.size);
+            assert(pos != nullptr);
+            memcpy(pos, key.data, key.size);
+            ctor(pos, key.size, key.hash);
+            ret = phmap::item_serialize_size<SliceHashSet>::value;
+        });
+        return ret;
+    }
+
+    size_t _partition_serialize_size(size_t i) const {
+        size_t size = 0;
+        for (auto& key : set.partition(i)) {
+            size += key.size + sizeof(uint32_t);
+        }
+        return size;
+    }
+};
+
 // Dear god this template class as template parameter kills me!
 template <PrimitiveType PT, PrimitiveType SumPT,
           template <PrimitiveType X, PrimitiveType Y, typename = guard::Guard> class TDistinctAggState,
@@ -447,6 +674,10 @@ template <PrimitiveType PT, AggDistinctType DistinctType, typename T = RunTimeCp
 class DistinctAggregateFunctionV2
         : public TDistinctAggregateFunction<PT, SumResultPT<PT>, DistinctAggregateStateV2, DistinctType, T> {};
 
+template <PrimitiveType PT, AggDistinctType DistinctType, typename T = RunTimeCppType<PT>>
+class DistinctAggregateFunctionV3
+        : public TDistinctAggregateFunction<PT, SumResultPT<PT>, DistinctAggregateStateV3, DistinctType, T> {};
+
 template <PrimitiveType PT, AggDistinctType DistinctType, typename T = RunTimeCppType<PT>>
 class DecimalDistinctAggregateFunction
         : public TDistinctAggregateFunction<PT, TYPE_DECIMAL128, DistinctAggregateStateV2, DistinctType, T> {};
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "column/binary_column.h"
 #include "column/object_column.h"
 #include "column/type_traits.h"
@@ -44,6 +46,33 @@ public:
         }
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        const ColumnType* column = down_cast<const ColumnType*>(columns[0]);
+
+        // Hash the whole column first, so that the registers are updated in one tight loop.
+        std::vector<uint64_t> values;
+        values.reserve(chunk_size);
+        if constexpr (pt_is_binary<PT>) {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                Slice s = column->get_slice(i);
+                uint64_t value = HashUtil::murmur_hash64A(s.data, s.size, HashUtil::MURMUR_SEED);
+                if (value != 0) {
+                    values.emplace_back(value);
+                }
+            }
+        } else {
+            const auto& v = column->get_data();
+            for (size_t i = 0; i < chunk_size; ++i) {
+                uint64_t value = HashUtil::murmur_hash64A(&v[i], sizeof(v[i]), HashUtil::MURMUR_SEED);
+                if (value != 0) {
+                    values.emplace_back(value);
+                }
+            }
+        }
+        this->data(state).update_batch(values.data(), values.size());
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
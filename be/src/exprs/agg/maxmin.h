@@ -195,6 +195,34 @@ public:
         }
     }
 
+    // The state only keeps the extreme value of the previous frame, so the current frame is scanned again
+    // if that value is the one leaving the frame, otherwise the value entering the frame is simply added.
+    void update_state_removable_cumulatively(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                             int64_t current_row_position, int64_t partition_start,
+                                             int64_t partition_end, int64_t rows_start_offset, int64_t rows_end_offset,
+                                             bool ignore_subtraction, bool ignore_addition) const override {
+        const auto* column = down_cast<const InputColumnType*>(columns[0]);
+        const auto* data = column->get_data().data();
+
+        const int64_t previous_frame_first_position = current_row_position - 1 + rows_start_offset;
+        const int64_t current_frame_last_position = current_row_position + rows_end_offset;
+        if (!ignore_subtraction && previous_frame_first_position >= partition_start &&
+            previous_frame_first_position < partition_end &&
+            data[previous_frame_first_position] == this->data(state).result) {
+            const int64_t frame_start = std::max(current_row_position + rows_start_offset, partition_start);
+            const int64_t frame_end = std::min(current_row_position + rows_end_offset + 1, partition_end);
+            this->data(state).reset();
+            for (int64_t i = frame_start; i < frame_end; ++i) {
+                OP()(this->data(state), data[i]);
+            }
+            return;
+        }
+        if (!ignore_addition && current_frame_last_position >= partition_start &&
+            current_frame_last_position < partition_end) {
+            OP()(this->data(state), data[current_frame_last_position]);
+        }
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(!column->is_nullable() && !column->is_binary());
         const auto* input_column = down_cast<const InputColumnType*>(column);
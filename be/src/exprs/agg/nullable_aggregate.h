@@ -26,6 +26,16 @@ constexpr bool IsWindowFunctionSliceState<MaxAggregateData<TYPE_VARCHAR>> = true
 template <>
 constexpr bool IsWindowFunctionSliceState<MinAggregateData<TYPE_VARCHAR>> = true;
 
+// The states keeping only the extreme value of a frame, which scan the frame again when that value leaves it.
+template <typename T>
+constexpr bool IsWindowFunctionExtremeState = false;
+
+template <PrimitiveType PT>
+constexpr bool IsWindowFunctionExtremeState<MaxAggregateData<PT>> = true;
+
+template <PrimitiveType PT>
+constexpr bool IsWindowFunctionExtremeState<MinAggregateData<PT>> = true;
+
 struct NullableAggregateWindowFunctionState {
     // The following two fields are only used in "update_state_removable_cumulatively"
     bool is_frame_init = false;
@@ -198,6 +208,7 @@ public:
 
     void merge_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column* column,
                      AggDataPtr* states) const override {
+        column = _skip_null_column_if_no_null(column);
         for (size_t i = 0; i < chunk_size; ++i) {
             merge(ctx, column, states[i] + state_offset, i);
         }
@@ -205,6 +216,7 @@ public:
 
     void merge_batch_selectively(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column* column,
                                  AggDataPtr* states, const std::vector<uint8_t>& filter) const override {
+        column = _skip_null_column_if_no_null(column);
         for (size_t i = 0; i < chunk_size; i++) {
             // TODO: optimize with simd ?
             if (filter[i] == 0) {
@@ -215,12 +227,22 @@ public:
 
     void merge_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column* column,
                                   AggDataPtr __restrict state) const override {
+        column = _skip_null_column_if_no_null(column);
         for (size_t i = 0; i < chunk_size; ++i) {
             merge(ctx, column, state, i);
         }
     }
 
 protected:
+    // The data column of a nullable column without null, so that the rows are processed without reading
+    // the null map, otherwise the column itself.
+    static const Column* _skip_null_column_if_no_null(const Column* column) {
+        if (column->is_nullable() && !column->has_null()) {
+            return down_cast<const NullableColumn*>(column)->data_column().get();
+        }
+        return column;
+    }
+
     NestedAggregateFunctionPtr nested_function;
 };
 
@@ -242,7 +264,9 @@ public:
                       AggDataPtr* states) const override {
         // Scalar function compute will return non-nullable column
         // for nullable column when the real whole chunk data all not-null.
-        if (columns[0]->is_nullable()) {
+        // A nullable column without null is processed as its data column.
+        const Column* column0 = this->_skip_null_column_if_no_null(columns[0]);
+        if (column0->is_nullable()) {
             const auto* column = down_cast<const NullableColumn*>(columns[0]);
             const Column* data_column = &column->data_column_ref();
             const uint8_t* f_data = column->null_column()->raw_data();
@@ -300,8 +324,8 @@ public:
         } else {
             for (size_t i = 0; i < chunk_size; ++i) {
                 this->data(states[i] + state_offset).is_null = false;
-                this->nested_function->update(ctx, columns, this->data(states[i] + state_offset).mutable_nest_state(),
-                                              i);
+                this->nested_function->update(ctx, &column0,
+                                              this->data(states[i] + state_offset).mutable_nest_state(), i);
             }
         }
     }
@@ -310,7 +334,9 @@ public:
                                   AggDataPtr* states, const std::vector<uint8_t>& selection) const override {
         // Scalar function compute will return non-nullable column
         // for nullable column when the real whole chunk data all not-null.
-        if (columns[0]->is_nullable()) {
+        // A nullable column without null is processed as its data column.
+        const Column* column0 = this->_skip_null_column_if_no_null(columns[0]);
+        if (column0->is_nullable()) {
             const auto* column = down_cast<const NullableColumn*>(columns[0]);
             const Column* data_column = &column->data_column_ref();
             const uint8_t* f_data = column->null_column()->raw_data();
@@ -395,7 +421,7 @@ public:
             for (size_t i = 0; i < chunk_size; ++i) {
                 if (!selection[i]) {
                     this->data(states[i] + state_offset).is_null = false;
-                    this->nested_function->update(ctx, columns,
+                    this->nested_function->update(ctx, &column0,
                                                   this->data(states[i] + state_offset).mutable_nest_state(), i);
                 }
             }
@@ -561,6 +587,13 @@ public:
                 }
 
                 const uint8_t* f_data = column->null_column()->raw_data();
+                if constexpr (IsWindowFunctionExtremeState<typename State::NestedState>) {
+                    // The nested function would scan the values under the nulls as well, so the frame
+                    // is built again without them.
+                    this->data(state).is_frame_init = false;
+                    this->data(state).null_count = 0;
+                    this->nested_function->reset(ctx, {}, this->data(state).mutable_nest_state());
+                }
                 if (this->data(state).is_frame_init) {
                     // Since frame has been evaluated, we only need to update the boundary
                     const int64_t previous_frame_first_position = current_row_position - 1 + rows_start_offset;
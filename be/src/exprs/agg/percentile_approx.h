@@ -7,6 +7,7 @@
 #include "column/vectorized_fwd.h"
 #include "exprs/agg/aggregate.h"
 #include "gutil/casts.h"
+#include "util/kll_sketch.h"
 #include "util/percentile_value.h"
 #include "util/tdigest.h"
 
@@ -167,4 +168,139 @@ public:
 
     std::string get_name() const override { return "percentile_approx"; }
 };
+
+struct PercentileApproxKllState {
+    KllSketch sketch;
+    double targetQuantile = -1.0;
+    bool is_null = true;
+};
+
+// percentile_approx_kll is a variant of percentile_approx keeping a KLL sketch instead of a t-digest,
+// it takes the same arguments but its intermediate state is serialized differently.
+class PercentileApproxKllAggregateFunction final
+        : public AggregateFunctionBatchHelper<PercentileApproxKllState, PercentileApproxKllAggregateFunction> {
+public:
+    void update(FunctionContext* ctx, const Column** columns, AggDataPtr state, size_t row_num) const override {
+        if (columns[0]->is_null(row_num)) {
+            return;
+        }
+        const auto* input = down_cast<const DoubleColumn*>(ColumnHelper::get_data_column(columns[0]));
+        DCHECK(!columns[1]->only_null());
+        data(state).sketch.add(input->get_data()[row_num]);
+        data(state).targetQuantile = columns[1]->get(0).get_double();
+        data(state).is_null = false;
+    }
+
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        if (columns[0]->has_null()) {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                update(ctx, columns, state, i);
+            }
+            return;
+        }
+        if (chunk_size == 0) {
+            return;
+        }
+        const auto* input = down_cast<const DoubleColumn*>(ColumnHelper::get_data_column(columns[0]));
+        DCHECK(!columns[1]->only_null());
+        data(state).sketch.add_batch(input->get_data().data(), chunk_size);
+        data(state).targetQuantile = columns[1]->get(0).get_double();
+        data(state).is_null = false;
+    }
+
+    void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
+        if (column->is_null(row_num)) {
+            return;
+        }
+        Slice src = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(column))->get_slice(row_num);
+        double quantile;
+        memcpy(&quantile, src.data, sizeof(double));
+
+        KllSketch sketch;
+        if (!sketch.deserialize(Slice(src.data + sizeof(double), src.size - sizeof(double)))) {
+            DCHECK(false) << "invalid kll sketch";
+            return;
+        }
+        data(state).sketch.merge(sketch);
+        data(state).targetQuantile = quantile;
+        data(state).is_null = false;
+    }
+
+    void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        if (to->is_nullable()) {
+            auto* column = down_cast<NullableColumn*>(to);
+            if (data(state).is_null) {
+                column->append_default();
+                return;
+            }
+            _serialize(data(state).sketch, data(state).targetQuantile,
+                       down_cast<BinaryColumn*>(column->data_column().get()));
+            column->null_column_data().push_back(0);
+        } else {
+            _serialize(data(state).sketch, data(state).targetQuantile, down_cast<BinaryColumn*>(to));
+        }
+    }
+
+    void convert_to_serialize_format(FunctionContext* ctx, const Columns& src, size_t chunk_size,
+                                     ColumnPtr* dst) const override {
+        const auto* input = down_cast<const DoubleColumn*>(ColumnHelper::get_data_column(src[0].get()));
+        BinaryColumn* result = nullptr;
+        if ((*dst)->is_nullable()) {
+            auto* dst_nullable_column = down_cast<NullableColumn*>((*dst).get());
+            result = down_cast<BinaryColumn*>(dst_nullable_column->data_column().get());
+            if (src[0]->is_nullable()) {
+                dst_nullable_column->null_column_data() =
+                        down_cast<const NullableColumn*>(src[0].get())->immutable_null_column_data();
+                dst_nullable_column->set_has_null(src[0]->has_null());
+            } else {
+                dst_nullable_column->null_column_data().resize(chunk_size, 0);
+            }
+        } else {
+            result = down_cast<BinaryColumn*>((*dst).get());
+        }
+
+        DCHECK(src[1]->is_constant());
+        double quantile = src[1]->get(0).get_double();
+        for (size_t i = 0; i < chunk_size; ++i) {
+            KllSketch sketch;
+            if (!src[0]->is_null(i)) {
+                sketch.add(input->get_data()[i]);
+            }
+            _serialize(sketch, quantile, result);
+        }
+    }
+
+    void finalize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        if (to->is_nullable()) {
+            auto* nullable_column = down_cast<NullableColumn*>(to);
+            if (data(state).is_null) {
+                nullable_column->append_default();
+                return;
+            }
+            double result = data(state).sketch.quantile(data(state).targetQuantile);
+            down_cast<DoubleColumn*>(nullable_column->data_column().get())->append(result);
+            nullable_column->null_column_data().push_back(0);
+        } else {
+            if (data(state).is_null) {
+                return;
+            }
+            double result = data(state).sketch.quantile(data(state).targetQuantile);
+            down_cast<DoubleColumn*>(to)->append(result);
+        }
+    }
+
+    std::string get_name() const override { return "percentile_approx_kll"; }
+
+private:
+    // The target quantile followed by the sketch.
+    static void _serialize(const KllSketch& sketch, double quantile, BinaryColumn* column) {
+        Bytes& bytes = column->get_bytes();
+        size_t old_size = bytes.size();
+        bytes.resize(old_size + sizeof(double) + sketch.serialize_size());
+        memcpy(bytes.data() + old_size, &quantile, sizeof(double));
+        sketch.serialize(bytes.data() + old_size + sizeof(double));
+        column->get_offset().emplace_back(bytes.size());
+    }
+};
 } // namespace starrocks::vectorized
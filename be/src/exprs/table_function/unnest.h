@@ -10,6 +10,7 @@
 #include "exprs/table_function/table_function.h"
 #include "exprs/vectorized/function_helper.h"
 #include "runtime/runtime_state.h"
+#include "simd/simd.h"
 
 namespace starrocks::vectorized {
 /**
@@ -26,28 +27,37 @@ public:
         auto* col_array = down_cast<ArrayColumn*>(ColumnHelper::get_data_column(arg0));
         Columns result;
         if (arg0->has_null()) {
-            NullableColumn* nullable_array_column = down_cast<NullableColumn*>(arg0);
-
-            auto offset_column = col_array->offsets_column();
-            ColumnPtr compacted_offset_column = offset_column->clone_empty();
-            compacted_offset_column->append_datum(Datum(0));
+            const auto* nullable_array_column = down_cast<NullableColumn*>(arg0);
+            const auto& null_data = nullable_array_column->immutable_null_column_data();
+            const auto& offsets = col_array->offsets().get_data();
+            const size_t num_rows = nullable_array_column->size();
 
+            // The elements of the null arrays are dropped, and the elements of every run of not null arrays
+            // are copied at once.
+            auto compacted_offset_column = UInt32Column::create();
+            auto& compacted_offsets = compacted_offset_column->get_data();
+            compacted_offsets.resize(num_rows + 1);
+            compacted_offsets[0] = 0;
             ColumnPtr compacted_array_elements = col_array->elements_column()->clone_empty();
-            int compact_offset = 0;
+            const Column& elements = *col_array->elements_column();
 
-            for (int row_idx = 0; row_idx < nullable_array_column->size(); ++row_idx) {
-                if (nullable_array_column->is_null(row_idx)) {
-                    compact_offset +=
-                            offset_column->get(row_idx + 1).get_int32() - offset_column->get(row_idx).get_int32();
-                    int32 offset = offset_column->get(row_idx + 1).get_int32();
-                    compacted_offset_column->append_datum(offset - compact_offset);
+            size_t row_idx = 0;
+            uint32_t compact_offset = 0;
+            while (row_idx < num_rows) {
+                size_t run_end = null_data[row_idx] ? SIMD::find_zero(null_data, row_idx, num_rows - row_idx)
+                                                    : SIMD::find_nonzero(null_data, row_idx, num_rows - row_idx);
+                uint32_t run_size = offsets[run_end] - offsets[row_idx];
+                if (null_data[row_idx]) {
+                    // a null array has no element once compacted
+                    for (; row_idx < run_end; ++row_idx) {
+                        compacted_offsets[row_idx + 1] = compacted_offsets[row_idx];
+                    }
+                    compact_offset += run_size;
                 } else {
-                    int32 offset = offset_column->get(row_idx + 1).get_int32();
-                    compacted_offset_column->append_datum(offset - compact_offset);
-
-                    compacted_array_elements->append(
-                            *(col_array->elements_column()), offset_column->get(row_idx).get_int32(),
-                            offset_column->get(row_idx + 1).get_int32() - offset_column->get(row_idx).get_int32());
+                    compacted_array_elements->append(elements, offsets[row_idx], run_size);
+                    for (; row_idx < run_end; ++row_idx) {
+                        compacted_offsets[row_idx + 1] = offsets[row_idx + 1] - compact_offset;
+                    }
                 }
             }
 
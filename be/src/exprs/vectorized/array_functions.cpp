@@ -5,6 +5,7 @@
 #include "column/array_column.h"
 #include "column/column_hash.h"
 #include "column/type_traits.h"
+#include "simd/simd.h"
 #include "util/raw_container.h"
 
 namespace starrocks::vectorized {
@@ -486,6 +487,11 @@ private:
         auto targets_ptr = (const ValueType*)(targets.raw_data());
         auto& first_target = *targets_ptr;
 
+        if constexpr (ConstTarget && !NullableTarget && !std::is_same_v<ArrayColumn, ElementColumn> &&
+                      std::is_arithmetic_v<ValueType>) {
+            return _process_const_target<NullableElement>(elements_ptr, offsets, first_target, null_map_elements);
+        }
+
         [[maybe_unused]] auto is_null = [](const NullColumn::Container* null_map, size_t idx) -> bool {
             return (*null_map)[idx] != 0;
         };
@@ -535,6 +541,44 @@ private:
         return result;
     }
 
+    // A constant target is compared with the flat elements of all the arrays at once, in a loop vectorized by
+    // the compiler, then every array looks for the first match within its range of elements with memchr.
+    template <bool NullableElement, typename ValueType>
+    static ColumnPtr _process_const_target(const ValueType* elements_ptr, const UInt32Column& offsets,
+                                           ValueType target, const NullColumn::Container* null_map_elements) {
+        const size_t num_array = offsets.size() - 1;
+        auto offsets_ptr = offsets.get_data().data();
+        const size_t num_elements = offsets_ptr[num_array];
+
+        std::vector<uint8_t> matches(num_elements);
+        uint8_t* matches_ptr = matches.data();
+        for (size_t i = 0; i < num_elements; i++) {
+            matches_ptr[i] = elements_ptr[i] == target;
+        }
+        if constexpr (NullableElement) {
+            // A null element never matches a not null target.
+            const uint8_t* null_ptr = null_map_elements->data();
+            for (size_t i = 0; i < num_elements; i++) {
+                matches_ptr[i] &= !null_ptr[i];
+            }
+        }
+
+        auto result = ReturnType::create();
+        result->resize(num_array);
+        auto* result_ptr = result->get_data().data();
+        for (size_t i = 0; i < num_array; i++) {
+            size_t offset = offsets_ptr[i];
+            size_t array_size = offsets_ptr[i + 1] - offset;
+            size_t pos = SIMD::find_nonzero(matches, offset, array_size);
+            if constexpr (PositionEnabled) {
+                result_ptr[i] = pos < offset + array_size ? pos - offset + 1 : 0;
+            } else {
+                result_ptr[i] = pos < offset + array_size;
+            }
+        }
+        return result;
+    }
+
     template <bool NullableElement, bool NullableTarget, bool ConstTarget>
     static ColumnPtr _array_contains(const Column& array_elements, const UInt32Column& array_offsets,
                                      const Column& argument) {
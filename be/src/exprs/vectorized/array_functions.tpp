@@ -493,9 +493,11 @@ private:
             }
         }
 
+        FlatArrays lhs = _flat_arrays(src_columns[0]);
+        FlatArrays rhs = _flat_arrays(src_columns[1]);
         HashSet hash_set;
         for (size_t i = 0; i < chunk_size; i++) {
-            _array_overlap_item<HashSet>(src_columns, i, &hash_set,
+            _array_overlap_item<HashSet>(lhs, rhs, i, &hash_set,
                                          static_cast<BooleanColumn*>(result_column.get())->get_data().data());
             hash_set.clear();
         }
@@ -507,43 +509,64 @@ private:
         return result_column;
     }
 
+    using ElementColumn = RunTimeColumnType<PT>;
+
+    // The arrays are read straight from their offsets and their flat elements, without building datums.
+    struct FlatArrays {
+        const uint32_t* offsets;
+        const ElementColumn* elements;
+        // nullptr if no element is null.
+        const uint8_t* null_elements;
+
+        bool is_null(size_t idx) const { return null_elements != nullptr && null_elements[idx]; }
+
+        CppType value(size_t idx) const {
+            if constexpr (pt_is_binary<PT>) {
+                return elements->get_slice(idx);
+            } else {
+                return elements->get_data()[idx];
+            }
+        }
+    };
+
+    static FlatArrays _flat_arrays(const ArrayColumn* array) {
+        const Column* elements = &array->elements();
+        const uint8_t* null_elements = nullptr;
+        if (elements->is_nullable()) {
+            const auto* nullable_elements = down_cast<const NullableColumn*>(elements);
+            if (nullable_elements->has_null()) {
+                null_elements = nullable_elements->immutable_null_column_data().data();
+            }
+            elements = nullable_elements->data_column().get();
+        }
+        return {array->offsets().get_data().data(), down_cast<const ElementColumn*>(elements), null_elements};
+    }
+
     template <typename HashSet>
-    static void _array_overlap_item(const std::vector<ArrayColumn*>& columns, size_t index, HashSet* hash_set,
+    static void _array_overlap_item(const FlatArrays& lhs, const FlatArrays& rhs, size_t index, HashSet* hash_set,
                                     uint8_t* data) {
         bool has_null = false;
-
-        {
-            Datum v = columns[0]->get(index);
-            const auto& items = v.get<DatumArray>();
-            for (const auto& item : items) {
-                if (item.is_null()) {
-                    has_null = true;
-                } else {
-                    hash_set->emplace(item.get<CppType>());
-                }
+        for (size_t i = lhs.offsets[index]; i < lhs.offsets[index + 1]; i++) {
+            if (lhs.is_null(i)) {
+                has_null = true;
+            } else {
+                hash_set->emplace(lhs.value(i));
             }
         }
 
-        {
-            Datum v = columns[1]->get(index);
-            const auto& items = v.get<DatumArray>();
-            for (const auto& item : items) {
-                if (item.is_null()) {
-                    if (has_null) {
-                        data[index] = 1;
-                        return;
-                    }
-                } else {
-                    auto iter = hash_set->find(item.get<CppType>());
-                    if (iter != hash_set->end()) {
-                        data[index] = 1;
-                        return;
-                    }
+        for (size_t i = rhs.offsets[index]; i < rhs.offsets[index + 1]; i++) {
+            if (rhs.is_null(i)) {
+                if (has_null) {
+                    data[index] = 1;
+                    return;
                 }
+            } else if (hash_set->find(rhs.value(i)) != hash_set->end()) {
+                data[index] = 1;
+                return;
             }
-
-            data[index] = 0;
         }
+
+        data[index] = 0;
     }
 };
 
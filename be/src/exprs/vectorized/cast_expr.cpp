@@ -456,6 +456,43 @@ ColumnPtr cast_int_from_string_fn(ColumnPtr& column) {
 
 template <PrimitiveType FromType, PrimitiveType ToType, bool AllowThrowException>
 ColumnPtr cast_float_from_string_fn(ColumnPtr& column) {
+    if (!column->is_constant() && !column->only_null()) {
+        // Parse into the data column directly, the null column is only built if some row is null.
+        int sz = column->size();
+        auto res_data_column = RunTimeColumnType<ToType>::create();
+        res_data_column->resize(sz);
+        auto& res_data = res_data_column->get_data();
+        const BinaryColumn* data_column = ColumnHelper::get_binary_column(column.get());
+        NullColumnPtr null_column;
+        if (column->is_nullable()) {
+            null_column = ColumnHelper::as_column<NullColumn>(
+                    down_cast<NullableColumn*>(column.get())->null_column()->clone());
+        }
+        StringParser::ParseResult result;
+        for (int i = 0; i < sz; ++i) {
+            if (null_column != nullptr && null_column->get_data()[i]) {
+                continue;
+            }
+            auto slice = data_column->get_slice(i);
+            RunTimeCppType<ToType> r =
+                    StringParser::string_to_float<RunTimeCppType<ToType>>(slice.data, slice.size, &result);
+            res_data[i] = r;
+            if (UNLIKELY(result != StringParser::PARSE_SUCCESS || std::isnan(r) || std::isinf(r))) {
+                if constexpr (AllowThrowException) {
+                    THROW_RUNTIME_ERROR_WITH_TYPES_AND_VALUE(FromType, ToType, slice.to_string());
+                }
+                if (null_column == nullptr) {
+                    null_column = NullColumn::create(sz, 0);
+                }
+                null_column->get_data()[i] = 1;
+            }
+        }
+        if (null_column == nullptr) {
+            return res_data_column;
+        }
+        return NullableColumn::create(std::move(res_data_column), std::move(null_column));
+    }
+
     ColumnViewer<TYPE_VARCHAR> viewer(column);
     ColumnBuilder<ToType> builder(viewer.size());
 
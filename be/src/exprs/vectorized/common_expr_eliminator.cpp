@@ -0,0 +1,147 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exprs/vectorized/common_expr_eliminator.h"
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "exprs/vectorized/column_ref.h"
+#include "exprs/vectorized/literal.h"
+
+namespace starrocks::vectorized {
+
+// Keep the same as the non-deterministic functions of the FE.
+static bool is_nondeterministic(const Expr* expr) {
+    const std::string& name = expr->fn().name.function_name;
+    return name == "rand" || name == "random" || name == "uuid" || name == "sleep";
+}
+
+std::string CommonExprEliminator::_fingerprint(Expr* expr, std::unordered_map<std::string, int>* counts,
+                                               std::unordered_map<Expr*, std::string>* fingerprints) {
+    std::string children_fingerprint;
+    bool shareable = true;
+    for (Expr* child : expr->children()) {
+        std::string fingerprint = _fingerprint(child, counts, fingerprints);
+        shareable &= !fingerprint.empty();
+        children_fingerprint.append(fingerprint).append(",");
+    }
+    if (!shareable) {
+        return {};
+    }
+
+    std::string fingerprint = std::to_string(expr->node_type()) + ":" + expr->type().debug_string();
+    if (auto* ref = dynamic_cast<ColumnRef*>(expr); ref != nullptr) {
+        return fingerprint + ":" + std::to_string(ref->slot_id());
+    }
+    if (dynamic_cast<VectorizedLiteral*>(expr) != nullptr) {
+        return fingerprint + ":" + expr->debug_string();
+    }
+    switch (expr->node_type()) {
+    case TExprNodeType::FUNCTION_CALL:
+    case TExprNodeType::COMPUTE_FUNCTION_CALL:
+        if (expr->fn().binary_type == TFunctionBinaryType::SRJAR || is_nondeterministic(expr)) {
+            return {};
+        }
+        fingerprint.append(":").append(expr->fn().name.function_name);
+        break;
+    case TExprNodeType::CAST_EXPR:
+    case TExprNodeType::ARITHMETIC_EXPR:
+        fingerprint.append(":").append(std::to_string(expr->op()));
+        break;
+    default:
+        return {};
+    }
+    fingerprint.append("(").append(children_fingerprint).append(")");
+    if (!expr->is_constant()) {
+        (*counts)[fingerprint]++;
+        (*fingerprints)[expr] = fingerprint;
+    }
+    return fingerprint;
+}
+
+void CommonExprEliminator::_replace_children(ObjectPool* pool, Expr* expr,
+                                             const std::unordered_map<std::string, int>& counts,
+                                             const std::unordered_map<Expr*, std::string>& fingerprints,
+                                             std::unordered_map<std::string, SlotId>* slots,
+                                             SlotId* next_slot_id) {
+    std::vector<Expr*> children = expr->children();
+    bool replaced = false;
+    for (auto& child : children) {
+        auto iter = fingerprints.find(child);
+        if (iter == fingerprints.end() || counts.at(iter->second) < 2) {
+            _replace_children(pool, child, counts, fingerprints, slots, next_slot_id);
+            continue;
+        }
+        auto [slot, inserted] = slots->emplace(iter->second, *next_slot_id);
+        if (inserted) {
+            // The first occurrence is moved to the context evaluating the shared subexpression.
+            _common_expr_ctxs.emplace_back(pool->add(new ExprContext(child)));
+            _common_slot_ids.emplace_back(slot->second);
+            (*next_slot_id)++;
+        }
+        child = pool->add(new ColumnRef(child->type(), slot->second));
+        replaced = true;
+    }
+    if (replaced) {
+        expr->clear_children();
+        for (Expr* child : children) {
+            expr->add_child(child);
+        }
+    }
+}
+
+Status CommonExprEliminator::rewrite(ObjectPool* pool, const std::vector<ExprContext*>& expr_ctxs,
+                                     SlotId first_slot_id) {
+    std::unordered_map<std::string, int> counts;
+    std::unordered_map<Expr*, std::string> fingerprints;
+    for (ExprContext* ctx : expr_ctxs) {
+        _fingerprint(ctx->root(), &counts, &fingerprints);
+    }
+    bool has_common = false;
+    for (const auto& [fingerprint, count] : counts) {
+        has_common |= count > 1;
+    }
+    if (!has_common) {
+        return Status::OK();
+    }
+
+    std::unordered_map<std::string, SlotId> slots;
+    SlotId next_slot_id = first_slot_id;
+    for (ExprContext* ctx : expr_ctxs) {
+        _replace_children(pool, ctx->root(), counts, fingerprints, &slots, &next_slot_id);
+    }
+    return Status::OK();
+}
+
+Status CommonExprEliminator::prepare(RuntimeState* state) {
+    return Expr::prepare(_common_expr_ctxs, state);
+}
+
+Status CommonExprEliminator::open(RuntimeState* state) {
+    return Expr::open(_common_expr_ctxs, state);
+}
+
+void CommonExprEliminator::close(RuntimeState* state) {
+    Expr::close(_common_expr_ctxs, state);
+}
+
+Status CommonExprEliminator::evaluate(Chunk* chunk) {
+    for (size_t i = 0; i < _common_expr_ctxs.size(); i++) {
+        ASSIGN_OR_RETURN(ColumnPtr column, _common_expr_ctxs[i]->evaluate(chunk));
+        // Unfold the const columns, which are filtered together with the chunk.
+        column = ColumnHelper::unfold_const_column(_common_expr_ctxs[i]->root()->type(), chunk->num_rows(), column);
+        DCHECK(!chunk->is_slot_exist(_common_slot_ids[i])) << _common_slot_ids[i];
+        chunk->append_column(std::move(column), _common_slot_ids[i]);
+    }
+    RETURN_IF_HAS_ERROR(_common_expr_ctxs);
+    return Status::OK();
+}
+
+void CommonExprEliminator::remove_columns(Chunk* chunk) {
+    for (SlotId slot_id : _common_slot_ids) {
+        chunk->remove_column_by_slot_id(slot_id);
+    }
+}
+
+} // namespace starrocks::vectorized
@@ -0,0 +1,68 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/global_types.h"
+#include "common/object_pool.h"
+#include "common/status.h"
+
+namespace starrocks {
+
+class Expr;
+class ExprContext;
+class RuntimeState;
+
+namespace vectorized {
+
+// CommonExprEliminator evaluates the subexpressions shared by several expressions, e.g. the conjuncts
+// `upper(c1) = 'A' OR upper(c1) = 'B'` and `upper(c1) != 'C'`, only once per chunk.
+//
+// rewrite() replaces every identical subtree appearing more than once in the expressions by a ColumnRef
+// of a new slot, and evaluate() appends the columns of these slots to a chunk before the rewritten
+// expressions are evaluated. Only the subtrees made of function calls, casts and arithmetic expressions
+// over slots and literals are considered, the non-deterministic functions and the constant subtrees are
+// left untouched. Only the largest shared subtrees are replaced, a shared subtree inside them is still
+// evaluated by each of them.
+class CommonExprEliminator {
+public:
+    CommonExprEliminator() = default;
+    ~CommonExprEliminator() = default;
+
+    // Rewrite |expr_ctxs|, which are not prepared yet. The new slots start from |first_slot_id|, which
+    // must be larger than the id of any slot of the chunks to evaluate.
+    Status rewrite(ObjectPool* pool, const std::vector<ExprContext*>& expr_ctxs, SlotId first_slot_id);
+
+    // Whether rewrite() found no shared subexpression.
+    bool empty() const { return _common_expr_ctxs.empty(); }
+
+    Status prepare(RuntimeState* state);
+    Status open(RuntimeState* state);
+    void close(RuntimeState* state);
+
+    // Evaluate the shared subexpressions of |chunk| and append their columns to |chunk|.
+    Status evaluate(Chunk* chunk);
+
+    // Remove the columns appended by evaluate() from |chunk|.
+    void remove_columns(Chunk* chunk);
+
+private:
+    // Return the fingerprint of the subtree |expr|, or an empty string if the subtree is not allowed to
+    // be shared. |counts| is increased for every subtree of |expr| which could be shared.
+    static std::string _fingerprint(Expr* expr, std::unordered_map<std::string, int>* counts,
+                                    std::unordered_map<Expr*, std::string>* fingerprints);
+
+    void _replace_children(ObjectPool* pool, Expr* expr, const std::unordered_map<std::string, int>& counts,
+                           const std::unordered_map<Expr*, std::string>& fingerprints,
+                           std::unordered_map<std::string, SlotId>* slots, SlotId* next_slot_id);
+
+    std::vector<ExprContext*> _common_expr_ctxs;
+    std::vector<SlotId> _common_slot_ids;
+};
+
+} // namespace vectorized
+} // namespace starrocks
@@ -8,6 +8,22 @@
 #include "runtime/primitive_type.h"
 
 namespace starrocks::vectorized {
+
+// Return n such that every value of |data| is in [-2^n, 2^n].
+template <typename CppType>
+static inline int decimal_magnitude_bits(const CppType* data, size_t size) {
+    // x ^ (x >> (bits - 1)) is x for a non-negative x and -x - 1 for a negative one.
+    CppType bits = 0;
+    for (size_t i = 0; i < size; ++i) {
+        bits |= data[i] ^ (data[i] >> (sizeof(CppType) * 8 - 1));
+    }
+    int n = 0;
+    for (; bits != 0; bits >>= 1) {
+        ++n;
+    }
+    return n;
+}
+
 template <bool check_overflow, typename Op>
 struct DecimalBinaryFunction {
     // Adjust the scale of lhs operand, then evaluate binary operation, the rules about operand
@@ -86,6 +102,30 @@ struct DecimalBinaryFunction {
         return false;
     }
 
+    // Whether the add, sub or mul of the values of |lhs| and |rhs| could overflow ResultCppType. The
+    // magnitudes of the operands of a chunk are bounded at once, so the chunks whose values are small
+    // enough, which hold most of the real data, are evaluated without checking every element.
+    template <PrimitiveType LhsType, PrimitiveType RhsType, typename ResultCppType>
+    static inline bool may_overflow(const ColumnPtr& lhs, const ColumnPtr& rhs, int adjust_scale) {
+        const auto& lhs_data = ColumnHelper::cast_to_raw<LhsType>(lhs)->get_data();
+        const auto& rhs_data = ColumnHelper::cast_to_raw<RhsType>(rhs)->get_data();
+        int lhs_bits = decimal_magnitude_bits(lhs_data.data(), lhs_data.size());
+        int rhs_bits = decimal_magnitude_bits(rhs_data.data(), rhs_data.size());
+        // The operand of the smaller scale is scaled up by 10^adjust_scale before the add and sub.
+        if (adjust_scale > 0) {
+            ResultCppType scale_factor = get_scale_factor<ResultCppType>(adjust_scale);
+            int scale_bits = decimal_magnitude_bits(&scale_factor, 1);
+            if (ColumnHelper::cast_to_raw<LhsType>(lhs)->scale() < ColumnHelper::cast_to_raw<RhsType>(rhs)->scale()) {
+                lhs_bits += scale_bits;
+            } else {
+                rhs_bits += scale_bits;
+            }
+        }
+        int result_bits = is_mul_op<Op> ? lhs_bits + rhs_bits : std::max(lhs_bits, rhs_bits) + 1;
+        // The values in [-2^(N-2), 2^(N-2)] fit in N bits with a margin.
+        return result_bits > static_cast<int>(sizeof(ResultCppType) * 8) - 2;
+    }
+
     template <bool lhs_is_const, bool rhs_is_const, PrimitiveType LhsType, PrimitiveType RhsType,
               PrimitiveType ResultType>
     static inline ColumnPtr evaluate(const ColumnPtr& lhs, const ColumnPtr& rhs) {
@@ -102,6 +142,13 @@ struct DecimalBinaryFunction {
         const auto rhs_scale = rhs_column->scale();
         auto [precision, scale, adjust_scale] = compute_decimal_result_type<ResultCppType, Op>(lhs_scale, rhs_scale);
 
+        if constexpr (check_overflow && (is_add_op<Op> || is_sub_op<Op> || is_mul_op<Op>)) {
+            if (!may_overflow<LhsType, RhsType, ResultCppType>(lhs, rhs, adjust_scale)) {
+                return DecimalBinaryFunction<false, Op>::template evaluate<lhs_is_const, rhs_is_const, LhsType,
+                                                                           RhsType, ResultType>(lhs, rhs);
+            }
+        }
+
         auto result_column = ResultColumnType::create(precision, scale, num_rows);
         auto result_data = &ColumnHelper::cast_to_raw<ResultType>(result_column)->get_data().front();
         NullColumnPtr null_column;
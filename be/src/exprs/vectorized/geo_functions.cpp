@@ -294,6 +294,8 @@ struct StContainsState {
     }
     bool is_null{false};
     GeoShape* shapes[2];
+    // Built if shapes[0] is a constant polygon or circle, to test the points of the non-constant rhs.
+    std::unique_ptr<GeoContainsPointIndex> point_index;
 };
 
 Status GeoFunctions::st_contains_close(FunctionContext* ctx, FunctionContext::FunctionStateScope scope) {
@@ -329,6 +331,9 @@ Status GeoFunctions::st_contains_prepare(FunctionContext* ctx, FunctionContext::
             }
         }
     }
+    if (!contains_ctx->is_null && contains_ctx->shapes[0] != nullptr && !ctx->is_constant_column(1)) {
+        contains_ctx->point_index = GeoContainsPointIndex::create(contains_ctx->shapes[0]);
+    }
 
     ctx->set_function_state(scope, contains_ctx);
     return Status::OK();
@@ -346,12 +351,23 @@ ColumnPtr GeoFunctions::st_contains(FunctionContext* context, const Columns& col
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_BOOLEAN> result(size);
+    // The rhs points are decoded into one point rather than a new shape each row.
+    const GeoContainsPointIndex* point_index = state != nullptr ? state->point_index.get() : nullptr;
+    GeoPoint rhs_point;
     for (int row = 0; row < size; ++row) {
         if (lhs_viewer.is_null(row) || rhs_viewer.is_null(row)) {
             result.append_null();
             continue;
         }
 
+        if (point_index != nullptr) {
+            auto rhs_value = rhs_viewer.value(row);
+            if (rhs_point.decode_from(rhs_value.data, rhs_value.size)) {
+                result.append(point_index->contains(*rhs_point.point()));
+                continue;
+            }
+        }
+
         GeoShape* shapes[2] = {nullptr, nullptr};
         auto lhs_value = lhs_viewer.value(row);
         auto rhs_value = rhs_viewer.value(row);
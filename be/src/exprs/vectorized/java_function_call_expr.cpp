@@ -41,13 +41,39 @@
 
 namespace starrocks::vectorized {
 
+// The types passed to evaluateBatch as the raw data of FixedLengthColumn, whose layout Java reads and writes by the
+// ByteBuffers in the native byte order.
+static bool is_batch_evaluable_type(PrimitiveType type) {
+    switch (type) {
+    case TYPE_BOOLEAN:
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_FLOAT:
+    case TYPE_DOUBLE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static constexpr const char* kEvaluateBatchSignature =
+        "(I[Ljava/nio/ByteBuffer;[Ljava/nio/ByteBuffer;Ljava/nio/ByteBuffer;Ljava/nio/ByteBuffer;)V";
+
 struct UDFFunctionCallHelper {
     JavaUDFContext* fn_desc;
     JavaMethodDescriptor* call_desc;
+    // Not null if the UDF is called by evaluateBatch.
+    JavaMethodDescriptor* batch_call_desc = nullptr;
+    std::vector<TypeDescriptor> arg_types;
+    TypeDescriptor return_type;
     std::vector<std::string> _data_buffer;
 
-    // Now we don't support primitive type function
     ColumnPtr call(FunctionContext* ctx, Columns& columns, size_t size) {
+        if (batch_call_desc != nullptr) {
+            return call_batch(ctx, columns, size);
+        }
         auto& helper = JVMFunctionHelper::getInstance();
         JNIEnv* env = helper.getEnv();
         std::vector<DirectByteBuffer> buffers;
@@ -81,6 +107,55 @@ struct UDFFunctionCallHelper {
         return result_cols;
     }
 
+    // Pass the null maps and the data of the columns to evaluateBatch by the direct ByteBuffers wrapping them, and let
+    // it write the result into the buffers of the result column, so neither the values are boxed nor copied.
+    ColumnPtr call_batch(FunctionContext* ctx, Columns& columns, size_t size) {
+        auto res = ColumnHelper::create_column(return_type, true);
+        if (size == 0) {
+            return res;
+        }
+        auto& helper = JVMFunctionHelper::getInstance();
+        JNIEnv* env = helper.getEnv();
+        const int num_cols = columns.size();
+        for (int i = 0; i < num_cols; ++i) {
+            if (columns[i]->only_null()) {
+                columns[i] = ColumnHelper::create_column(arg_types[i], true);
+                columns[i]->append_nulls(size);
+            } else if (columns[i]->is_constant()) {
+                columns[i] = ColumnHelper::unpack_and_duplicate_const_column(size, columns[i]);
+            }
+        }
+        res->resize(size);
+        auto* nullable_res = down_cast<NullableColumn*>(res.get());
+
+        // two arrays and two buffers of each input column, and two buffers of the result column
+        env->PushLocalFrame(num_cols * 2 + 4);
+        jclass buffer_class = helper.direct_buffer_class();
+        jobjectArray arg_nulls = env->NewObjectArray(num_cols, buffer_class, nullptr);
+        jobjectArray arg_data = env->NewObjectArray(num_cols, buffer_class, nullptr);
+        for (int i = 0; i < num_cols; ++i) {
+            // The null buffer of a non-nullable column is null.
+            if (columns[i]->is_nullable()) {
+                auto* nulls = down_cast<NullableColumn*>(columns[i].get())->mutable_null_column();
+                env->SetObjectArrayElement(arg_nulls, i, env->NewDirectByteBuffer(nulls->mutable_raw_data(), size));
+            }
+            auto* data = ColumnHelper::get_data_column(columns[i].get());
+            env->SetObjectArrayElement(arg_data, i,
+                                       env->NewDirectByteBuffer(data->mutable_raw_data(), size * data->type_size()));
+        }
+        auto* res_nulls = nullable_res->mutable_null_column();
+        auto* res_data = nullable_res->mutable_data_column();
+        jobject res_nulls_buffer = env->NewDirectByteBuffer(res_nulls->mutable_raw_data(), size);
+        jobject res_data_buffer = env->NewDirectByteBuffer(res_data->mutable_raw_data(), size * res_data->type_size());
+
+        env->CallVoidMethod(fn_desc->udf_handle.handle(), batch_call_desc->get_method_id(), static_cast<jint>(size),
+                            arg_nulls, arg_data, res_nulls_buffer, res_data_buffer);
+        CHECK_UDF_CALL_EXCEPTION(env, ctx);
+        env->PopLocalFrame(nullptr);
+        nullable_res->update_has_null();
+        return res;
+    }
+
     ColumnPtr get_boxed_result(FunctionContext* ctx, jobject result, size_t num_rows) {
         if (result == nullptr) {
             return ColumnHelper::create_const_null_column(num_rows);
@@ -206,6 +281,12 @@ Status JavaFunctionCallExpr::open(RuntimeState* state, ExprContext* context,
         // RETURN_IF_ERROR(add_method("prepare", &_func_desc->prepare));
         // RETURN_IF_ERROR(add_method("method_close", &_func_desc->close));
         RETURN_IF_ERROR(add_method("evaluate", &_func_desc->evaluate));
+        RETURN_IF_ERROR(add_method("evaluateBatch", &_func_desc->evaluate_batch));
+        if (_func_desc->evaluate_batch != nullptr && _func_desc->evaluate_batch->signature != kEvaluateBatchSignature) {
+            return Status::InternalError(fmt::format("Unexpected signature {} of evaluateBatch in {}, expect {}",
+                                                     _func_desc->evaluate_batch->signature, _fn.scalar_fn.symbol,
+                                                     kEvaluateBatchSignature));
+        }
 
         // create UDF function instance
         ASSIGN_OR_RETURN(_func_desc->udf_handle, _func_desc->udf_class.newInstance());
@@ -228,6 +309,16 @@ Status JavaFunctionCallExpr::open(RuntimeState* state, ExprContext* context,
         _call_helper = std::make_shared<UDFFunctionCallHelper>();
         _call_helper->fn_desc = _func_desc.get();
         _call_helper->call_desc = _func_desc->evaluate.get();
+        _call_helper->return_type = _type;
+        bool batch_evaluable = is_batch_evaluable_type(_type.type);
+        for (const auto* child : _children) {
+            _call_helper->arg_types.emplace_back(child->type());
+            batch_evaluable &= is_batch_evaluable_type(child->type().type);
+        }
+        // The other types are always called by the boxed evaluate.
+        if (batch_evaluable) {
+            _call_helper->batch_call_desc = _func_desc->evaluate_batch.get();
+        }
 
         if (_func_desc->prepare != nullptr) {
             // we only support fragment local scope to call prepare
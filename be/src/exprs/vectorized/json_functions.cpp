@@ -381,14 +381,21 @@ ColumnPtr JsonFunctions::_json_string_unescaped(FunctionContext* context, const
 
 //////////////////////////// User visiable functions /////////////////////////////////
 
-static StatusOr<JsonPath*> get_prepared_or_parse(FunctionContext* context, Slice slice, JsonPath* out) {
+// Return the path prepared for a const path, otherwise parse |slice| into |out|. The path |out| parsed from
+// |out_string| is reused if |slice| is the same, the adjacent rows usually share their path.
+static StatusOr<JsonPath*> get_prepared_or_parse(FunctionContext* context, Slice slice, JsonPath* out,
+                                                 std::string* out_string) {
     JsonPath* prepared = reinterpret_cast<JsonPath*>(context->get_function_state(FunctionContext::FRAGMENT_LOCAL));
     if (prepared != nullptr) {
         return prepared;
     }
+    if (!out->paths.empty() && slice == Slice(*out_string)) {
+        return out;
+    }
     auto res = JsonPath::parse(slice);
     RETURN_IF(!res.ok(), res.status());
     out->reset(std::move(res.value()));
+    out_string->assign(slice.data, slice.size);
     return out;
 }
 
@@ -462,6 +469,7 @@ ColumnPtr JsonFunctions::_json_query_impl(FunctionContext* context, const Column
     ColumnBuilder<ResultType> result(num_rows);
 
     JsonPath stored_path;
+    std::string stored_path_string;
     vpack::Builder builder;
     for (int row = 0; row < num_rows; ++row) {
         if (json_viewer.is_null(row) || path_viewer.is_null(row)) {
@@ -471,7 +479,7 @@ ColumnPtr JsonFunctions::_json_query_impl(FunctionContext* context, const Column
         JsonValue* json_value = json_viewer.value(row);
         auto path_value = path_viewer.value(row);
 
-        auto jsonpath = get_prepared_or_parse(context, path_value, &stored_path);
+        auto jsonpath = get_prepared_or_parse(context, path_value, &stored_path, &stored_path_string);
         if (!jsonpath.ok()) {
             VLOG(2) << "parse json path failed: " << path_value;
             result.append_null();
@@ -496,6 +504,8 @@ ColumnPtr JsonFunctions::json_exists(FunctionContext* context, const Columns& co
     ColumnBuilder<TYPE_BOOLEAN> result(num_rows);
 
     JsonPath stored_path;
+    std::string stored_path_string;
+    vpack::Builder builder;
     for (int row = 0; row < num_rows; row++) {
         if (json_viewer.is_null(row) || json_viewer.value(row) == nullptr || path_viewer.is_null(row)) {
             result.append_null();
@@ -504,7 +514,7 @@ ColumnPtr JsonFunctions::json_exists(FunctionContext* context, const Columns& co
 
         JsonValue* json_value = json_viewer.value(row);
         Slice path_str = path_viewer.value(row);
-        auto jsonpath = get_prepared_or_parse(context, path_str, &stored_path);
+        auto jsonpath = get_prepared_or_parse(context, path_str, &stored_path, &stored_path_string);
 
         if (!jsonpath.ok()) {
             result.append_null();
@@ -512,7 +522,7 @@ ColumnPtr JsonFunctions::json_exists(FunctionContext* context, const Columns& co
             continue;
         }
         VLOG(2) << "json_exists for  " << path_str << " of " << json_value->to_string().value();
-        vpack::Builder builder;
+        builder.clear();
         vpack::Slice slice = JsonPath::extract(json_value, *jsonpath.value(), &builder);
         result.append(!slice.isNone());
     }
@@ -49,6 +49,7 @@ Status LikePredicate::hs_compile_and_alloc_scratch(const std::string& pattern, L
         return Status::InvalidArgument(error.str());
     }
 
+    state->required_literal = RegexUtils::required_literal(pattern);
     return Status::OK();
 }
 
@@ -331,11 +332,23 @@ ColumnPtr LikePredicate::_predicate_const_regex(FunctionContext* context, Column
                                                 const ColumnPtr& value_column) {
     auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
 
-    hs_scratch_t* scratch = nullptr;
     hs_error_t status;
-    if ((status = hs_clone_scratch(state->scratch, &scratch)) != HS_SUCCESS) {
-        CHECK(false) << "ERROR: Unable to clone scratch space."
-                     << " status: " << status;
+    hs_scratch_t* scratch = state->driver_scratches.get(state->scratch);
+    hs_scratch_t* local_scratch = nullptr;
+    if (scratch == nullptr) {
+        if ((status = hs_clone_scratch(state->scratch, &local_scratch)) != HS_SUCCESS) {
+            CHECK(false) << "ERROR: Unable to clone scratch space."
+                         << " status: " << status;
+        }
+        scratch = local_scratch;
+    }
+
+    // Only the rows containing the required literal are scanned.
+    Column::Filter candidates;
+    bool has_candidates = !state->required_literal.empty() && !value_column->is_constant();
+    if (has_candidates) {
+        const auto* haystack = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(value_column.get()));
+        RegexUtils::find_candidates(*haystack, state->required_literal, &candidates);
     }
 
     for (int row = 0; row < value_viewer.size(); ++row) {
@@ -343,6 +356,10 @@ ColumnPtr LikePredicate::_predicate_const_regex(FunctionContext* context, Column
             result->append_null();
             continue;
         }
+        if (has_candidates && !candidates[row]) {
+            result->append(false);
+            continue;
+        }
 
         bool v = false;
         auto value_size = value_viewer.value(row).size;
@@ -361,7 +378,7 @@ ColumnPtr LikePredicate::_predicate_const_regex(FunctionContext* context, Column
         result->append(v);
     }
 
-    if ((status = hs_free_scratch(scratch)) != HS_SUCCESS) {
+    if (local_scratch != nullptr && (status = hs_free_scratch(local_scratch)) != HS_SUCCESS) {
         CHECK(false) << "ERROR: free scratch space failure"
                      << " status: " << status;
     }
@@ -13,6 +13,7 @@
 #include "column/column_viewer.h"
 #include "exprs/vectorized/builtin_functions.h"
 #include "exprs/vectorized/function_helper.h"
+#include "exprs/vectorized/regex_utils.h"
 
 namespace starrocks {
 namespace vectorized {
@@ -184,6 +185,11 @@ private:
         // A Hyperscan scratch space, Used to call hs_scan,
         // one scratch space per thread, or concurrent caller, is required
         hs_scratch_t* scratch = nullptr;
+        // The clones of |scratch| used by the pipeline drivers.
+        HyperscanScratches driver_scratches;
+        // A literal contained by every string matching the hyperscan database, the strings without it are
+        // not scanned.
+        std::string required_literal;
 
         LikePredicateState() {}
 
@@ -0,0 +1,202 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exprs/vectorized/regex_utils.h"
+
+#include <cstring>
+
+#include "column/binary_column.h"
+#include "glog/logging.h"
+#include "runtime/Volnitsky.h"
+#include "runtime/current_thread.h"
+
+namespace starrocks::vectorized {
+
+// The escapes standing for a single character or a character class, which only end a literal.
+static bool is_single_char_escape(char c) {
+    return strchr("dDwWsSbBAzntrfva", c) != nullptr;
+}
+
+std::string RegexUtils::required_literal(const std::string& pattern) {
+    std::string longest;
+    std::string run;
+    // The start of the last character of |run|, which is removed again if a quantifier makes it optional.
+    size_t last_char = std::string::npos;
+    auto end_run = [&]() {
+        if (run.size() > longest.size()) {
+            longest = run;
+        }
+        run.clear();
+        last_char = std::string::npos;
+    };
+    auto drop_last_char = [&]() {
+        if (last_char != std::string::npos) {
+            run.resize(last_char);
+        }
+        end_run();
+    };
+
+    int depth = 0;
+    size_t n = pattern.size();
+    size_t i = 0;
+    while (i < n) {
+        char c = pattern[i];
+        switch (c) {
+        case '\\': {
+            if (i + 1 >= n) {
+                return {};
+            }
+            char escaped = pattern[i + 1];
+            i += 2;
+            if (isalnum(static_cast<unsigned char>(escaped))) {
+                // The escapes with arguments, e.g. \x41, \pN or \Q...\E, are not parsed.
+                if (!is_single_char_escape(escaped)) {
+                    return {};
+                }
+                end_run();
+            } else if (depth == 0) {
+                last_char = run.size();
+                run.push_back(escaped);
+            }
+            continue;
+        }
+        case '[': {
+            size_t j = i + 1;
+            if (j < n && pattern[j] == '^') {
+                j++;
+            }
+            if (j < n && pattern[j] == ']') {
+                j++;
+            }
+            while (j < n && pattern[j] != ']') {
+                if (pattern[j] == '\\') {
+                    j += 2;
+                } else if (pattern[j] == '[' && j + 1 < n && pattern[j + 1] == ':') {
+                    size_t class_end = pattern.find(":]", j + 2);
+                    if (class_end == std::string::npos) {
+                        return {};
+                    }
+                    j = class_end + 2;
+                } else {
+                    j++;
+                }
+            }
+            if (j >= n) {
+                return {};
+            }
+            i = j + 1;
+            end_run();
+            continue;
+        }
+        case '(':
+            // Only the non-capturing groups are allowed, `(?` also starts the inline flags and named groups.
+            if (i + 1 < n && pattern[i + 1] == '?' && (i + 2 >= n || pattern[i + 2] != ':')) {
+                return {};
+            }
+            depth++;
+            end_run();
+            break;
+        case ')':
+            if (--depth < 0) {
+                return {};
+            }
+            end_run();
+            break;
+        case '|':
+            if (depth == 0) {
+                return {};
+            }
+            break;
+        case '*':
+        case '?':
+            drop_last_char();
+            break;
+        case '{': {
+            // A repetition could be {0} or {0,n}.
+            size_t close = pattern.find('}', i + 1);
+            if (close == std::string::npos) {
+                return {};
+            }
+            drop_last_char();
+            i = close + 1;
+            continue;
+        }
+        case '+':
+        case '.':
+        case '^':
+        case '$':
+            end_run();
+            break;
+        default:
+            if (depth == 0) {
+                // The continuation bytes of a UTF-8 character belong to the same character.
+                if ((static_cast<unsigned char>(c) & 0xC0) != 0x80) {
+                    last_char = run.size();
+                }
+                run.push_back(c);
+            }
+            break;
+        }
+        i++;
+    }
+    if (depth != 0) {
+        return {};
+    }
+    end_run();
+    return longest;
+}
+
+void RegexUtils::find_candidates(const BinaryColumn& column, const std::string& literal,
+                                 Column::Filter* candidates) {
+    size_t num_rows = column.size();
+    if (literal.empty()) {
+        candidates->assign(num_rows, 1);
+        return;
+    }
+    candidates->assign(num_rows, 0);
+
+    const std::vector<uint32_t>& offsets = column.get_offset();
+    const char* begin = reinterpret_cast<const char*>(column.get_bytes().data());
+    const char* pos = begin;
+    const char* end = pos + column.get_bytes().size();
+
+    /// Current index in the array of strings.
+    size_t i = 0;
+
+    auto searcher = VolnitskyUTF8(literal.data(), literal.size(), end - pos);
+    /// We will search for the next occurrence in all strings at once.
+    while (pos < end && end != (pos = searcher.search(pos, end - pos))) {
+        /// Determine which index it refers to.
+        while (begin + offsets[i + 1] <= pos) {
+            ++i;
+        }
+        /// We check that the entry does not pass through the boundaries of strings.
+        (*candidates)[i] = pos + literal.size() <= begin + offsets[i + 1];
+        pos = begin + offsets[i + 1];
+        ++i;
+    }
+}
+
+HyperscanScratches::~HyperscanScratches() {
+    for (auto& [driver_id, scratch] : _driver_scratches) {
+        hs_free_scratch(scratch);
+    }
+}
+
+hs_scratch_t* HyperscanScratches::get(hs_scratch_t* prototype) {
+    int32_t driver_id = CurrentThread::current().get_driver_id();
+    if (driver_id == 0) {
+        return nullptr;
+    }
+    hs_scratch_t* res = nullptr;
+    _driver_scratches.lazy_emplace_l(
+            driver_id, [&](hs_scratch_t* value) { res = value; },
+            [&](auto build) {
+                hs_error_t status = hs_clone_scratch(prototype, &res);
+                CHECK(status == HS_SUCCESS) << "ERROR: Unable to clone scratch space."
+                                            << " status: " << status;
+                build(driver_id, res);
+            });
+    return res;
+}
+
+} // namespace starrocks::vectorized
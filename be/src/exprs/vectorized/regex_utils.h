@@ -0,0 +1,50 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <hs/hs.h>
+
+#include <mutex>
+#include <string>
+
+#include "column/column.h"
+#include "column/vectorized_fwd.h"
+#include "common/constexpr.h"
+#include "util/phmap/phmap.h"
+
+namespace starrocks::vectorized {
+
+class RegexUtils {
+public:
+    // Return a literal contained by every string matching the RE2 |pattern|, or an empty string if no such
+    // literal is found. The extraction is conservative: only the literals outside of groups and character
+    // classes are considered, and nothing is returned for a pattern with a top-level alternation or with
+    // inline flags, e.g. `(?i)`, which could change the meaning of the literals.
+    static std::string required_literal(const std::string& pattern);
+
+    // Set |candidates|[i] to 1 if the i-th string of |column| contains |literal|, and to 0 otherwise.
+    // The bytes of |column| are scanned at once instead of row by row, the rows left out cannot match
+    // a regex whose required_literal() is |literal|.
+    static void find_candidates(const BinaryColumn& column, const std::string& literal, Column::Filter* candidates);
+};
+
+// HyperscanScratches keeps a clone of a Hyperscan scratch space for each pipeline driver. A scratch space
+// cannot be used by two hs_scan calls at the same time and the function states are shared by the drivers,
+// so the scratch space would otherwise be cloned for each chunk.
+class HyperscanScratches {
+public:
+    HyperscanScratches() = default;
+    ~HyperscanScratches();
+
+    // Return the scratch space of the current pipeline driver cloned from |prototype|, or nullptr if the
+    // current thread does not run a pipeline driver, in which case the caller has to clone its own.
+    hs_scratch_t* get(hs_scratch_t* prototype);
+
+private:
+    using DriverMap = phmap::parallel_flat_hash_map<int32_t, hs_scratch_t*, phmap::Hash<int32_t>,
+                                                    phmap::EqualTo<int32_t>, phmap::Allocator<int32_t>,
+                                                    NUM_LOCK_SHARD_LOG, std::mutex>;
+    DriverMap _driver_scratches;
+};
+
+} // namespace starrocks::vectorized
@@ -7,6 +7,7 @@
 #include "column/const_column.h"
 #include "column/nullable_column.h"
 #include "column/type_traits.h"
+#include "common/config.h"
 #include "common/global_types.h"
 #include "common/object_pool.h"
 #include "gen_cpp/PlanNodes_types.h"
@@ -220,6 +221,11 @@ public:
     virtual size_t max_serialized_size() const;
     virtual size_t serialize(uint8_t* data) const;
     virtual size_t deserialize(const uint8_t* data);
+    // The build values kept by small filters are serialized after the filter. They are optional,
+    // so a filter serialized by an older version is still accepted.
+    virtual size_t max_in_values_serialized_size() const { return 0; }
+    virtual size_t serialize_in_values(uint8_t* data) const { return 0; }
+    virtual size_t deserialize_in_values(const uint8_t* data) { return 0; }
     virtual void merge(const JoinRuntimeFilter* rf) {
         _has_null |= rf->_has_null;
         _bf.merge(rf->_bf);
@@ -251,6 +257,9 @@ public:
     using CppType = RunTimeCppType<Type>;
     using ColumnType = RunTimeColumnType<Type>;
 
+    // Only the fixed-length values are kept, the slices may refer to the memory of the build side.
+    static constexpr bool support_in_values = !IsSlice<CppType> && !std::is_pointer_v<CppType>;
+
     RuntimeBloomFilter() { init_min_max(); }
     ~RuntimeBloomFilter() override = default;
 
@@ -289,6 +298,12 @@ public:
     void init(size_t hash_table_size) override {
         _size = hash_table_size;
         _bf.init(_size);
+        // The build side is small enough to keep all the values, so the scan can push them down
+        // into the storage as an IN predicate.
+        _has_in_values = support_in_values && hash_table_size <= config::max_pushdown_conditions_per_column;
+        if (_has_in_values) {
+            _in_values.reserve(hash_table_size);
+        }
     }
 
     size_t compute_hash(CppType value) const {
@@ -310,12 +325,24 @@ public:
 
         _min = std::min(*value, _min);
         _max = std::max(*value, _max);
+
+        if (_has_in_values) {
+            if (_in_values.size() < config::max_pushdown_conditions_per_column) {
+                _in_values.push_back(*value);
+            } else {
+                _clear_in_values();
+            }
+        }
     }
 
     CppType min_value() const { return _min; }
 
     CppType max_value() const { return _max; }
 
+    // Whether all the values inserted into this filter are kept in in_values(), which may contain duplicates.
+    bool has_in_values() const { return _has_in_values; }
+    const std::vector<CppType>& in_values() const { return _in_values; }
+
     bool test_data(CppType value) const {
         if constexpr (!IsSlice<CppType>) {
             if (value < _min || value > _max) {
@@ -375,6 +402,11 @@ public:
         }
         case TRuntimeFilterBuildJoinMode::PARTITIONED:
         case TRuntimeFilterBuildJoinMode::SHUFFLE_HASH_BUCKET: {
+            // every row is routed to the only partition, skip hashing the shuffle keys.
+            if (_num_hash_partitions == 1) {
+                hash_values.assign(num_rows, 0);
+                break;
+            }
             hash_values.assign(num_rows, HashUtil::FNV_SEED);
             compute_hash(&Column::fnv_hash, _num_hash_partitions, !running_ctx->compatibility);
             break;
@@ -468,11 +500,32 @@ public:
     void merge(const JoinRuntimeFilter* rf) override {
         JoinRuntimeFilter::merge(rf);
         merge_min_max(down_cast<const RuntimeBloomFilter*>(rf));
+        merge_in_values(down_cast<const RuntimeBloomFilter*>(rf));
     }
 
     void concat(JoinRuntimeFilter* rf) override {
         JoinRuntimeFilter::concat(rf);
         merge_min_max(down_cast<const RuntimeBloomFilter*>(rf));
+        if (_num_hash_partitions == 1) {
+            // the first partition of a filter created by create_empty().
+            const auto* bf = down_cast<const RuntimeBloomFilter*>(rf);
+            _has_in_values = bf->_has_in_values;
+            _in_values = bf->_in_values;
+        } else {
+            merge_in_values(down_cast<const RuntimeBloomFilter*>(rf));
+        }
+    }
+
+    void merge_in_values(const RuntimeBloomFilter* bf) {
+        if (!_has_in_values) {
+            return;
+        }
+        if (!bf->_has_in_values ||
+            _in_values.size() + bf->_in_values.size() > config::max_pushdown_conditions_per_column) {
+            _clear_in_values();
+            return;
+        }
+        _in_values.insert(_in_values.end(), bf->_in_values.begin(), bf->_in_values.end());
     }
 
     void merge_min_max(const RuntimeBloomFilter* bf) {
@@ -609,6 +662,38 @@ public:
         return offset;
     }
 
+    // in values format = | num_values(uint32_t) | values |
+    size_t max_in_values_serialized_size() const override {
+        if (!_has_in_values) {
+            return 0;
+        }
+        return sizeof(uint32_t) + _in_values.size() * sizeof(CppType);
+    }
+
+    size_t serialize_in_values(uint8_t* data) const override {
+        if (!_has_in_values) {
+            return 0;
+        }
+        auto num_values = static_cast<uint32_t>(_in_values.size());
+        memcpy(data, &num_values, sizeof(num_values));
+        memcpy(data + sizeof(num_values), _in_values.data(), num_values * sizeof(CppType));
+        return sizeof(num_values) + num_values * sizeof(CppType);
+    }
+
+    size_t deserialize_in_values(const uint8_t* data) override {
+        if constexpr (!support_in_values) {
+            DCHECK(false) << "unexpected in values of runtime filter type " << Type;
+            return 0;
+        } else {
+            uint32_t num_values = 0;
+            memcpy(&num_values, data, sizeof(num_values));
+            _in_values.resize(num_values);
+            memcpy(_in_values.data(), data + sizeof(num_values), num_values * sizeof(CppType));
+            _has_in_values = true;
+            return sizeof(num_values) + num_values * sizeof(CppType);
+        }
+    }
+
     bool check_equal(const JoinRuntimeFilter& base_rf) const override {
         if (!JoinRuntimeFilter::check_equal(base_rf)) return false;
         const auto& rf = static_cast<const RuntimeBloomFilter<Type>&>(base_rf);
@@ -632,11 +717,18 @@ public:
     }
 
 private:
+    void _clear_in_values() {
+        _has_in_values = false;
+        std::vector<CppType>().swap(_in_values);
+    }
+
     CppType _min;
     CppType _max;
     std::string _slice_min;
     std::string _slice_max;
     bool _has_min_max = true;
+    bool _has_in_values = false;
+    std::vector<CppType> _in_values;
 };
 
 } // namespace vectorized
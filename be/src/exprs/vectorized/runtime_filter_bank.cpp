@@ -42,6 +42,7 @@ JoinRuntimeFilter* RuntimeFilterHelper::create_join_runtime_filter(ObjectPool* p
 size_t RuntimeFilterHelper::max_runtime_filter_serialized_size(const JoinRuntimeFilter* rf) {
     size_t size = sizeof(RF_VERSION);
     size += rf->max_serialized_size();
+    size += rf->max_in_values_serialized_size();
     return size;
 }
 size_t RuntimeFilterHelper::serialize_runtime_filter(const JoinRuntimeFilter* rf, uint8_t* data) {
@@ -50,6 +51,7 @@ size_t RuntimeFilterHelper::serialize_runtime_filter(const JoinRuntimeFilter* rf
     memcpy(data + offset, &RF_VERSION, sizeof(RF_VERSION));
     offset += sizeof(RF_VERSION);
     offset += rf->serialize(data + offset);
+    offset += rf->serialize_in_values(data + offset);
     return offset;
 }
 
@@ -75,6 +77,9 @@ void RuntimeFilterHelper::deserialize_runtime_filter(ObjectPool* pool, JoinRunti
     DCHECK(filter != nullptr);
     if (filter != nullptr) {
         offset += filter->deserialize(data + offset);
+        if (offset < size) {
+            offset += filter->deserialize_in_values(data + offset);
+        }
         DCHECK(offset == size);
         *rf = filter;
     }
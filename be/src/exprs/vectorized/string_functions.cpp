@@ -19,6 +19,7 @@
 #include "common/status.h"
 #include "exprs/vectorized/binary_function.h"
 #include "exprs/vectorized/math_functions.h"
+#include "exprs/vectorized/regex_utils.h"
 #include "exprs/vectorized/unary_function.h"
 #include "gutil/strings/fastmem.h"
 #include "gutil/strings/substitute.h"
@@ -2543,6 +2544,12 @@ struct StringFunctionsState {
     // A Hyperscan scratch space, Used to call hs_scan,
     // one scratch space per thread, or concurrent caller, is required
     hs_scratch_t* scratch = nullptr;
+    // The clones of |scratch| used by the pipeline drivers.
+    HyperscanScratches driver_scratches;
+
+    // A literal contained by every string matching the const pattern, the regex is only run on the strings
+    // containing it.
+    std::string required_literal;
 
     StringFunctionsState() : regex(), options() {}
 
@@ -2631,6 +2638,7 @@ Status StringFunctions::regexp_extract_prepare(starrocks_udf::FunctionContext* c
         return Status::InvalidArgument(error.str());
     }
 
+    state->required_literal = RegexUtils::required_literal(state->pattern);
     return Status::OK();
 }
 
@@ -2677,6 +2685,7 @@ Status StringFunctions::regexp_replace_prepare(starrocks_udf::FunctionContext* c
         }
     }
 
+    state->required_literal = RegexUtils::required_literal(state->pattern);
     return Status::OK();
 }
 
@@ -2738,10 +2747,29 @@ static ColumnPtr regexp_extract_general(FunctionContext* context, re2::RE2::Opti
     return result.build(ColumnHelper::is_all_const(columns));
 }
 
-static ColumnPtr regexp_extract_const(re2::RE2* const_re, const Columns& columns) {
+// Find the rows of |column| containing |required_literal|, the other rows cannot match the regex.
+// Return false if every row has to be matched.
+static bool regexp_find_candidates(const std::string& required_literal, const ColumnPtr& column,
+                                   Column::Filter* candidates) {
+    if (required_literal.empty() || column->is_constant()) {
+        return false;
+    }
+    const auto* binary = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(column.get()));
+    RegexUtils::find_candidates(*binary, required_literal, candidates);
+    return true;
+}
+
+static ColumnPtr regexp_extract_const(re2::RE2* const_re, const std::string& required_literal,
+                                      const Columns& columns) {
     auto content_viewer = ColumnViewer<TYPE_VARCHAR>(columns[0]);
     auto field_viewer = ColumnViewer<TYPE_BIGINT>(columns[2]);
 
+    Column::Filter candidates;
+    bool has_candidates = regexp_find_candidates(required_literal, columns[0], &candidates);
+
+    int max_matches = 1 + const_re->NumberOfCapturingGroups();
+    std::vector<re2::StringPiece> matches(max_matches);
+
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
     for (int row = 0; row < size; ++row) {
@@ -2751,20 +2779,13 @@ static ColumnPtr regexp_extract_const(re2::RE2* const_re, const Columns& columns
         }
 
         auto field_value = field_viewer.value(row);
-        if (field_value < 0) {
-            result.append(Slice("", 0));
-            continue;
-        }
-
-        int max_matches = 1 + const_re->NumberOfCapturingGroups();
-        if (field_value >= max_matches) {
+        if (field_value < 0 || field_value >= max_matches || (has_candidates && !candidates[row])) {
             result.append(Slice("", 0));
             continue;
         }
 
         auto str_value = content_viewer.value(row);
         re2::StringPiece str_sp(str_value.get_data(), str_value.get_size());
-        std::vector<re2::StringPiece> matches(max_matches);
         bool success = const_re->Match(str_sp, 0, str_value.get_size(), re2::RE2::UNANCHORED, &matches[0], max_matches);
         if (!success) {
             result.append(Slice("", 0));
@@ -2783,7 +2804,7 @@ ColumnPtr StringFunctions::regexp_extract(FunctionContext* context, const Column
 
     if (state->const_pattern) {
         re2::RE2* const_re = state->get_or_prepare_regex();
-        return regexp_extract_const(const_re, columns);
+        return regexp_extract_const(const_re, state->required_literal, columns);
     }
 
     re2::RE2::Options* options = state->options.get();
@@ -2822,10 +2843,14 @@ static ColumnPtr regexp_replace_general(FunctionContext* context, re2::RE2::Opti
     return result.build(ColumnHelper::is_all_const(columns));
 }
 
-static ColumnPtr regexp_replace_const(re2::RE2* const_re, const Columns& columns) {
+static ColumnPtr regexp_replace_const(re2::RE2* const_re, const std::string& required_literal,
+                                      const Columns& columns) {
     auto str_viewer = ColumnViewer<TYPE_VARCHAR>(columns[0]);
     auto rpl_viewer = ColumnViewer<TYPE_VARCHAR>(columns[2]);
 
+    Column::Filter candidates;
+    bool has_candidates = regexp_find_candidates(required_literal, columns[0], &candidates);
+
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
     for (int row = 0; row < size; ++row) {
@@ -2833,6 +2858,10 @@ static ColumnPtr regexp_replace_const(re2::RE2* const_re, const Columns& columns
             result.append_null();
             continue;
         }
+        if (has_candidates && !candidates[row]) {
+            result.append(str_viewer.value(row));
+            continue;
+        }
 
         auto rpl_value = rpl_viewer.value(row);
         re2::StringPiece rpl_str = re2::StringPiece(rpl_value.get_data(), rpl_value.get_size());
@@ -2849,13 +2878,20 @@ static ColumnPtr regexp_replace_use_hyperscan(StringFunctionsState* state, const
     auto str_viewer = ColumnViewer<TYPE_VARCHAR>(columns[0]);
     auto rpl_viewer = ColumnViewer<TYPE_VARCHAR>(columns[2]);
 
-    hs_scratch_t* scratch = nullptr;
     hs_error_t status;
-    if ((status = hs_clone_scratch(state->scratch, &scratch)) != HS_SUCCESS) {
-        CHECK(false) << "ERROR: Unable to clone scratch space."
-                     << " status: " << status;
+    hs_scratch_t* scratch = state->driver_scratches.get(state->scratch);
+    hs_scratch_t* local_scratch = nullptr;
+    if (scratch == nullptr) {
+        if ((status = hs_clone_scratch(state->scratch, &local_scratch)) != HS_SUCCESS) {
+            CHECK(false) << "ERROR: Unable to clone scratch space."
+                         << " status: " << status;
+        }
+        scratch = local_scratch;
     }
 
+    Column::Filter candidates;
+    bool has_candidates = regexp_find_candidates(state->required_literal, columns[0], &candidates);
+
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
 
@@ -2867,6 +2903,10 @@ static ColumnPtr regexp_replace_use_hyperscan(StringFunctionsState* state, const
             result.append_null();
             continue;
         }
+        if (has_candidates && !candidates[row]) {
+            result.append(str_viewer.value(row));
+            continue;
+        }
         match_info_chain.info_chain.clear();
         match_info_chain.last_to = 0;
 
@@ -2909,6 +2949,10 @@ static ColumnPtr regexp_replace_use_hyperscan(StringFunctionsState* state, const
         result.append(Slice(result_str.data(), result_str.size()));
     }
 
+    if (local_scratch != nullptr && (status = hs_free_scratch(local_scratch)) != HS_SUCCESS) {
+        CHECK(false) << "ERROR: free scratch space failure"
+                     << " status: " << status;
+    }
     return result.build(ColumnHelper::is_all_const(columns));
 }
 
@@ -2920,7 +2964,7 @@ ColumnPtr StringFunctions::regexp_replace(FunctionContext* context, const Column
             return regexp_replace_use_hyperscan(state, columns);
         } else {
             re2::RE2* const_re = state->get_or_prepare_regex();
-            return regexp_replace_const(const_re, columns);
+            return regexp_replace_const(const_re, state->required_literal, columns);
         }
     }
 
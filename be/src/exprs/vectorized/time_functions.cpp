@@ -12,6 +12,7 @@
 #include "runtime/runtime_state.h"
 #include "types/date_value.h"
 #include "udf/udf_internal.h"
+#include "util/timezone_utils.h"
 
 namespace starrocks::vectorized {
 // index as day of week(1: Sunday, 2: Monday....), value as distance of this day and first day(Monday) of this week.
@@ -212,6 +213,8 @@ ColumnPtr TimeFunctions::convert_tz_general(FunctionContext* context, const Colu
 ColumnPtr TimeFunctions::convert_tz_const(FunctionContext* context, const Columns& columns, const cctz::time_zone& from,
                                           const cctz::time_zone& to) {
     auto time_viewer = ColumnViewer<TYPE_DATETIME>(columns[0]);
+    TimezoneOffsetCache from_offsets(from);
+    TimezoneOffsetCache to_offsets(to);
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_DATETIME> result(size);
@@ -221,28 +224,10 @@ ColumnPtr TimeFunctions::convert_tz_const(FunctionContext* context, const Column
             continue;
         }
 
-        auto datetime_value = time_viewer.value(row);
-
-        int year, month, day, hour, minute, second, usec;
-        datetime_value.to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
-        DateTimeValue ts_value(TIME_DATETIME, year, month, day, hour, minute, second, usec);
-
-        int64_t timestamp;
-        // TODO find a better approach to replace datetime_value.unix_timestamp
-        if (!ts_value.unix_timestamp(&timestamp, from)) {
-            result.append_null();
-            continue;
-        }
-        DateTimeValue ts_value2;
-        // TODO find a better approach to replace datetime_value.from_unixtime
-        if (!ts_value2.from_unixtime(timestamp, to)) {
-            result.append_null();
-            continue;
-        }
-
+        // The microseconds are dropped.
+        int64_t timestamp = from_offsets.local_to_utc(time_viewer.value(row).to_unix_second());
         TimestampValue ts;
-        ts.from_timestamp(ts_value2.year(), ts_value2.month(), ts_value2.day(), ts_value2.hour(), ts_value2.minute(),
-                          ts_value2.second(), 0);
+        ts.from_unix_second(to_offsets.utc_to_local(timestamp));
         result.append(ts);
     }
 
@@ -969,6 +954,7 @@ ColumnPtr TimeFunctions::from_unix_to_datetime(FunctionContext* context, const C
     RETURN_IF_COLUMNS_ONLY_NULL(columns);
 
     ColumnViewer<TYPE_INT> data_column(columns[0]);
+    TimezoneOffsetCache offsets(context->impl()->state()->timezone_obj());
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
@@ -984,14 +970,11 @@ ColumnPtr TimeFunctions::from_unix_to_datetime(FunctionContext* context, const C
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->impl()->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        TimestampValue ts;
+        ts.from_unix_second(offsets.utc_to_local(date));
         char buf[64];
-        dtv.to_string(buf);
-        result.append(Slice(buf));
+        int len = ts.to_string(buf, sizeof(buf));
+        result.append(Slice(buf, len));
     }
 
     return result.build(ColumnHelper::is_all_const(columns));
@@ -2,6 +2,7 @@
 
 #include "formats/csv/converter.h"
 
+#include "column/column.h"
 #include "formats/csv/array_converter.h"
 #include "formats/csv/binary_converter.h"
 #include "formats/csv/boolean_converter.h"
@@ -17,6 +18,22 @@
 
 namespace starrocks::vectorized::csv {
 
+size_t Converter::read_strings(Column* column, const Slice* fields, size_t stride, size_t n,
+                               const Options& options, uint8_t* invalids) const {
+    size_t num_invalids = 0;
+    for (size_t i = 0; i < n; i++) {
+        size_t size = column->size();
+        if (!read_string(column, fields[i * stride], options)) {
+            // a failed read_string() may have appended a part of the value, e.g. the elements of an array.
+            column->resize(size);
+            column->append_default();
+            invalids[i] = 1;
+            num_invalids++;
+        }
+    }
+    return num_invalids;
+}
+
 static std::unique_ptr<Converter> get_converter(const TypeDescriptor& t) {
     switch (t.type) {
     case TYPE_BOOLEAN:
@@ -84,6 +84,15 @@ public:
 
     virtual bool read_quoted_string(Column* column, Slice s, const Options& options) const = 0;
 
+    // Read the |n| fields |fields[0]|, |fields[stride]|, ..., |fields[(n - 1) * stride]| into |column|.
+    // For an invalid field, a default value is appended instead and the element of |invalids| is set to 1,
+    // the other elements of |invalids| are not changed.
+    // Return the number of invalid fields.
+    // The default implementation calls read_string() for each field, converters override it to convert
+    // the fields in a tight loop.
+    virtual size_t read_strings(Column* column, const Slice* fields, size_t stride, size_t n,
+                                const Options& options, uint8_t* invalids) const;
+
 protected:
     template <char quote>
     static inline bool remove_enclosing_quotes(Slice* s) {
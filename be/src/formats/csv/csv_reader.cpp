@@ -4,13 +4,33 @@
 
 namespace starrocks::vectorized {
 
+char* CSVReader::_find_row_delimiter(size_t pos) {
+    // memchr is much faster than memmem for the common single-byte delimiter.
+    return _row_delimiter_length == 1 ? _buff.find(_row_delimiter[0], pos) : _buff.find(_row_delimiter, pos);
+}
+
+bool CSVReader::next_buffered_record(Record* record) {
+    if (_limit > 0 && _parsed_bytes > _limit) {
+        return false;
+    }
+    char* d = _find_row_delimiter(0);
+    if (d == nullptr) {
+        return false;
+    }
+    size_t l = d - _buff.position();
+    *record = Record(_buff.position(), l);
+    _buff.skip(l + _row_delimiter_length);
+    _parsed_bytes += l + _row_delimiter_length;
+    return true;
+}
+
 Status CSVReader::next_record(Record* record) {
     if (_limit > 0 && _parsed_bytes > _limit) {
         return Status::EndOfFile("Reached limit");
     }
     char* d;
     size_t pos = 0;
-    while ((d = _buff.find(_row_delimiter, pos)) == nullptr) {
+    while ((d = _find_row_delimiter(pos)) == nullptr) {
         pos = _buff.available();
         _buff.compact();
         if (_buff.free_space() == 0) {
@@ -47,12 +67,12 @@ void CSVReader::split_record(const Record& record, Fields* fields) const {
     const size_t size = record.size;
 
     if (_column_separator_length == 1) {
-        for (size_t i = 0; i < size; ++i, ++ptr) {
-            if (*ptr == _column_separator[0]) {
-                fields->emplace_back(value, ptr - value);
-                value = ptr + 1;
-            }
+        const char* const end = record.data + size;
+        while ((ptr = static_cast<const char*>(memchr(value, _column_separator[0], end - value))) != nullptr) {
+            fields->emplace_back(value, ptr - value);
+            value = ptr + 1;
         }
+        ptr = end;
     } else {
         const auto* const base = ptr;
 
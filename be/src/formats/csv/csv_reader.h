@@ -84,6 +84,11 @@ public:
 
     Status next_record(Record* record);
 
+    // Read the next record if it is in the buffer already. Unlike next_record(), which may move the
+    // data in the buffer, the records read before stay valid.
+    // Return false if there is no complete record in the buffer, or the limit is reached.
+    bool next_buffered_record(Record* record);
+
     void set_limit(size_t limit) { _limit = limit; }
 
     void split_record(const Record& record, Fields* fields) const;
@@ -99,6 +104,9 @@ protected:
     virtual Status _fill_buffer() { return Status::InternalError("unsupported csv reader!"); }
 
 private:
+    // Find the first row delimiter in the buffer, search begins at |pos|.
+    char* _find_row_delimiter(size_t pos);
+
     Status _expand_buffer();
 
     size_t _parsed_bytes = 0;
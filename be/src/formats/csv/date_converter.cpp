@@ -31,6 +31,24 @@ bool DateConverter::read_string(Column* column, Slice s, const Options& options)
     return r;
 }
 
+size_t DateConverter::read_strings(Column* column, const Slice* fields, size_t stride, size_t n,
+                                   const Options& options, uint8_t* invalids) const {
+    auto& data = down_cast<FixedLengthColumn<DateValue>*>(column)->get_data();
+    size_t offset = data.size();
+    data.resize(offset + n);
+    DateValue* values = data.data() + offset;
+    size_t num_invalids = 0;
+    for (size_t i = 0; i < n; i++) {
+        const Slice& s = fields[i * stride];
+        if (UNLIKELY(!values[i].from_string(s.data, s.size))) {
+            values[i] = DateValue{};
+            invalids[i] = 1;
+            num_invalids++;
+        }
+    }
+    return num_invalids;
+}
+
 bool DateConverter::read_quoted_string(Column* column, Slice s, const Options& options) const {
     if (!remove_enclosing_quotes<'"'>(&s)) {
         return false;
@@ -31,6 +31,27 @@ bool FloatConverter<T>::read_string(Column* column, Slice s, const Options& opti
     return r == StringParser::PARSE_SUCCESS;
 }
 
+template <typename T>
+size_t FloatConverter<T>::read_strings(Column* column, const Slice* fields, size_t stride, size_t n,
+                                       const Options& options, uint8_t* invalids) const {
+    auto& data = down_cast<FixedLengthColumn<DataType>*>(column)->get_data();
+    size_t offset = data.size();
+    data.resize(offset + n);
+    DataType* values = data.data() + offset;
+    size_t num_invalids = 0;
+    for (size_t i = 0; i < n; i++) {
+        const Slice& s = fields[i * stride];
+        StringParser::ParseResult r;
+        values[i] = StringParser::string_to_float<DataType>(s.data, s.size, &r);
+        if (UNLIKELY(r != StringParser::PARSE_SUCCESS)) {
+            values[i] = DataType();
+            invalids[i] = 1;
+            num_invalids++;
+        }
+    }
+    return num_invalids;
+}
+
 template <typename T>
 bool FloatConverter<T>::read_quoted_string(Column* column, Slice s, const Options& options) const {
     return read_string(column, s, options);
@@ -47,6 +47,32 @@ bool NullableConverter::read_string(Column* column, Slice s, const Options& opti
     }
 }
 
+size_t NullableConverter::read_strings(Column* column, const Slice* fields, size_t stride, size_t n,
+                                       const Options& options, uint8_t* invalids) const {
+    auto* nullable = down_cast<NullableColumn*>(column);
+    // The null literals are read by the base converter too, they are invalid fields of most types.
+    std::vector<uint8_t> base_invalids(n, 0);
+    auto* data = nullable->data_column().get();
+    size_t num_base_invalids = _base_converter->read_strings(data, fields, stride, n, options, base_invalids.data());
+    auto& nulls = nullable->null_column()->get_data();
+    size_t offset = nulls.size();
+    nulls.resize(offset + n);
+    size_t num_invalids = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint8_t is_null = fields[i * stride] == "\\N";
+        if (num_base_invalids > 0 && base_invalids[i] && !is_null) {
+            if (!options.invalid_field_as_null) {
+                invalids[i] = 1;
+                num_invalids++;
+            }
+            is_null = 1;
+        }
+        nulls[offset + i] = is_null;
+    }
+    nullable->update_has_null();
+    return num_invalids;
+}
+
 bool NullableConverter::read_quoted_string(Column* column, Slice s, const Options& options) const {
     auto* nullable = down_cast<NullableColumn*>(column);
     auto* data = nullable->data_column().get();
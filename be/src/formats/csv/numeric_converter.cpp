@@ -26,11 +26,10 @@ Status NumericConverter<T>::write_quoted_string(OutputStream* os, const Column&
 }
 
 template <typename T>
-bool NumericConverter<T>::read_string(Column* column, Slice s, const Options& options) const {
+bool NumericConverter<T>::parse(const Slice& s, DataType* v) {
     StringParser::ParseResult r;
-    DataType v = StringParser::string_to_int<DataType>(s.data, s.size, &r);
+    *v = StringParser::string_to_int<DataType>(s.data, s.size, &r);
     if (r == StringParser::PARSE_SUCCESS) {
-        down_cast<FixedLengthColumn<DataType>*>(column)->append(v);
         return true;
     } else if (r != StringParser::PARSE_OVERFLOW && r != StringParser::PARSE_UNDERFLOW) {
         if constexpr (sizeof(DataType) <= sizeof(int32_t)) {
@@ -45,7 +44,7 @@ bool NumericConverter<T>::read_string(Column* column, Slice s, const Options& op
                 if (implicit_cast<double>(n) != d) {
                     return false;
                 } else {
-                    down_cast<FixedLengthColumn<DataType>*>(column)->append(n);
+                    *v = n;
                     return true;
                 }
             } else {
@@ -57,7 +56,7 @@ bool NumericConverter<T>::read_string(Column* column, Slice s, const Options& op
                 return false;
             } else {
                 int64_t n = decimal.int_value();
-                down_cast<FixedLengthColumn<DataType>*>(column)->append(implicit_cast<DataType>(n));
+                *v = implicit_cast<DataType>(n);
                 return true;
             }
         }
@@ -66,6 +65,34 @@ bool NumericConverter<T>::read_string(Column* column, Slice s, const Options& op
     }
 }
 
+template <typename T>
+bool NumericConverter<T>::read_string(Column* column, Slice s, const Options& options) const {
+    DataType v;
+    if (!parse(s, &v)) {
+        return false;
+    }
+    down_cast<FixedLengthColumn<DataType>*>(column)->append(v);
+    return true;
+}
+
+template <typename T>
+size_t NumericConverter<T>::read_strings(Column* column, const Slice* fields, size_t stride, size_t n,
+                                         const Options& options, uint8_t* invalids) const {
+    auto& data = down_cast<FixedLengthColumn<DataType>*>(column)->get_data();
+    size_t offset = data.size();
+    data.resize(offset + n);
+    DataType* values = data.data() + offset;
+    size_t num_invalids = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (UNLIKELY(!parse(fields[i * stride], &values[i]))) {
+            values[i] = DataType();
+            invalids[i] = 1;
+            num_invalids++;
+        }
+    }
+    return num_invalids;
+}
+
 template <typename T>
 bool NumericConverter<T>::read_quoted_string(Column* column, Slice s, const Options& options) const {
     return read_string(column, s, options);
@@ -18,6 +18,11 @@ public:
                                const Options& options) const override;
     bool read_string(Column* column, Slice s, const Options& options) const override;
     bool read_quoted_string(Column* column, Slice s, const Options& options) const override;
+    size_t read_strings(Column* column, const Slice* fields, size_t stride, size_t n, const Options& options,
+                        uint8_t* invalids) const override;
+
+private:
+    static bool parse(const Slice& s, DataType* v);
 };
 
 } // namespace starrocks::vectorized::csv
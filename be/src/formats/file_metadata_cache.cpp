@@ -0,0 +1,52 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "formats/file_metadata_cache.h"
+
+#include <fmt/format.h>
+
+#include "common/config.h"
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+static void metadata_deleter(const CacheKey& key, void* value) {
+    delete static_cast<std::shared_ptr<const void>*>(value);
+}
+
+FileMetadataCache* FileMetadataCache::instance() {
+    static FileMetadataCache* cache =
+            config::file_metadata_cache_capacity > 0 ? new FileMetadataCache(config::file_metadata_cache_capacity)
+                                                     : nullptr;
+    return cache;
+}
+
+FileMetadataCache::FileMetadataCache(size_t capacity) : _cache(new_lru_cache(capacity)) {}
+
+FileMetadataCache::~FileMetadataCache() = default;
+
+std::string FileMetadataCache::key(std::string_view format, std::string_view path, int64_t size,
+                                   int64_t modification_time) {
+    return fmt::format("{}:{}:{}:{}", format, size, modification_time, path);
+}
+
+std::shared_ptr<const void> FileMetadataCache::_lookup(std::string_view key) {
+    Cache::Handle* handle = _cache->lookup(CacheKey(key.data(), key.size()));
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    auto metadata = *static_cast<std::shared_ptr<const void>*>(_cache->value(handle));
+    _cache->release(handle);
+    return metadata;
+}
+
+void FileMetadataCache::insert(std::string_view key, std::shared_ptr<const void> metadata, size_t charge) {
+    auto* value = new std::shared_ptr<const void>(std::move(metadata));
+    Cache::Handle* handle = _cache->insert(CacheKey(key.data(), key.size()), value, charge, metadata_deleter);
+    _cache->release(handle);
+}
+
+size_t FileMetadataCache::memory_usage() {
+    return _cache->get_memory_usage();
+}
+
+} // namespace starrocks
@@ -0,0 +1,53 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "gutil/macros.h"
+
+namespace starrocks {
+
+class Cache;
+
+// FileMetadataCache caches the parsed metadata of the files of external tables, e.g. the footers of
+// Parquet files, to save the reads and the parsing of them when the files are scanned again. It's
+// shared by all scanners and bounded by the memory of the metadata.
+//
+// An entry is keyed by the path, the size and the modification time of the file, so a rewritten file
+// never hits the metadata of its old version.
+class FileMetadataCache {
+public:
+    // nullptr if the cache is disabled.
+    static FileMetadataCache* instance();
+
+    explicit FileMetadataCache(size_t capacity);
+
+    ~FileMetadataCache();
+
+    DISALLOW_COPY(FileMetadataCache);
+
+    // The key of the metadata of |format|, e.g. "parquet", of the file.
+    static std::string key(std::string_view format, std::string_view path, int64_t size, int64_t modification_time);
+
+    // Return the cached metadata of |key|, or nullptr if not cached. The metadata must be of type T.
+    template <typename T>
+    std::shared_ptr<const T> lookup(std::string_view key) {
+        return std::static_pointer_cast<const T>(_lookup(key));
+    }
+
+    // Cache |metadata| of |key| whose memory usage is |charge| bytes.
+    void insert(std::string_view key, std::shared_ptr<const void> metadata, size_t charge);
+
+    size_t memory_usage();
+
+private:
+    std::shared_ptr<const void> _lookup(std::string_view key);
+
+    std::unique_ptr<Cache> _cache;
+};
+
+} // namespace starrocks
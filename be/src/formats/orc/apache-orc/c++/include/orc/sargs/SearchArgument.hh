@@ -32,6 +32,7 @@ namespace orc {
 
 namespace proto {
 class StripeInformation;
+class StripeStatistics;
 class RowIndex;
 } // namespace proto
 class BloomFilterIndex;
@@ -42,6 +43,10 @@ public:
     virtual bool filterOnOpeningStripe(uint64_t stripeIndex, const proto::StripeInformation* stripeInformation) {
         return false;
     }
+    // stripeStats.colstats is indexed by column index, return true to skip the whole stripe
+    virtual bool filterOnStripeStatistics(uint64_t stripeIndex, const proto::StripeStatistics& stripeStats) {
+        return false;
+    }
     virtual void onStartingPickRowGroups() {}
     virtual void onEndingPickRowGroups() {}
     // rowIndexes and bloomFilters key is column index
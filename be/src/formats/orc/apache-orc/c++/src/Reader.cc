@@ -1060,14 +1060,21 @@ void RowReaderImpl::startNextStripe() {
                 goto end;
             }
 
-            // read row group statistics and bloom filters of current stripe
-            loadStripeIndex();
-
             if (sargsApplier->getRowReaderFilter()) {
                 sargsApplier->getRowReaderFilter()->setWriterTimezone(
                         currentStripeFooter.has_writertimezone() ? currentStripeFooter.writertimezone() : "");
+                // skip this stripe before reading its row indexes if stripe stats fail to satisfy the filter
+                if (contents->metadata &&
+                    sargsApplier->getRowReaderFilter()->filterOnStripeStatistics(
+                            currentStripe, contents->metadata->stripestats(static_cast<int>(currentStripe)))) {
+                    skipStripe = true;
+                    goto end;
+                }
             }
 
+            // read row group statistics and bloom filters of current stripe
+            loadStripeIndex();
+
             // select row groups to read in the current stripe
             sargsApplier->pickRowGroups(rowsInCurrentStripe, rowIndexes, bloomFilterIndex);
             if (!sargsApplier->hasSelectedFrom(currentRowInStripe)) {
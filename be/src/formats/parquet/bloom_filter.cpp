@@ -0,0 +1,72 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "formats/parquet/bloom_filter.h"
+
+#include <cstring>
+
+#include "fs/fs.h"
+#include "gutil/strings/substitute.h"
+#include "storage/rowset/block_split_bloom_filter.h"
+#include "storage/rowset/bloom_filter.h"
+#include "util/thrift_util.h"
+#define XXH_INLINE_ALL
+#include "util/xxhash.h"
+
+namespace starrocks::parquet {
+
+// The header is about 20 bytes, so is read with the head of the bitset.
+static constexpr size_t kBloomFilterInitReadSize = 4096;
+
+Status ParquetBloomFilter::read(RandomAccessFile* file, int64_t file_size, const tparquet::ColumnMetaData& column_meta,
+                                std::unique_ptr<ParquetBloomFilter>* bf) {
+    bf->reset();
+    DCHECK(column_meta.__isset.bloom_filter_offset);
+    int64_t offset = column_meta.bloom_filter_offset;
+    if (offset < 0 || offset >= file_size) {
+        return Status::Corruption(
+                strings::Substitute("Invalid parquet bloom filter offset $0 of file $1", offset, file->filename()));
+    }
+
+    size_t nbytes = std::min<int64_t>(kBloomFilterInitReadSize, file_size - offset);
+    std::unique_ptr<uint8_t[]> buffer(new uint8_t[nbytes]);
+    RETURN_IF_ERROR(file->read_at_fully(offset, buffer.get(), nbytes));
+
+    tparquet::BloomFilterHeader header;
+    auto header_length = static_cast<uint32_t>(nbytes);
+    RETURN_IF_ERROR(deserialize_thrift_msg(buffer.get(), &header_length, TProtocolType::COMPACT, &header));
+    if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED) {
+        return Status::OK();
+    }
+    uint32_t num_bytes = header.numBytes;
+    if (num_bytes < BlockSplitBloomFilter::BYTES_PER_BLOCK || num_bytes > BloomFilter::MAXIMUM_BYTES ||
+        (num_bytes & (num_bytes - 1)) != 0 || offset + header_length + num_bytes > file_size) {
+        return Status::Corruption(strings::Substitute("Invalid parquet bloom filter size $0 of file $1",
+                                                      header.numBytes, file->filename()));
+    }
+
+    std::unique_ptr<uint32_t[]> bitset(new uint32_t[num_bytes / sizeof(uint32_t)]);
+    if (header_length + num_bytes <= nbytes) {
+        memcpy(bitset.get(), buffer.get() + header_length, num_bytes);
+    } else {
+        RETURN_IF_ERROR(file->read_at_fully(offset + header_length, bitset.get(), num_bytes));
+    }
+    *bf = std::make_unique<ParquetBloomFilter>(std::move(bitset), num_bytes);
+    return Status::OK();
+}
+
+uint64_t ParquetBloomFilter::hash(const void* data, size_t size) {
+    return XXH64(data, size, 0);
+}
+
+ParquetBloomFilter::ParquetBloomFilter(std::unique_ptr<uint32_t[]> bitset, uint32_t num_bytes)
+        : _bitset(std::move(bitset)), _num_blocks(num_bytes / BlockSplitBloomFilter::BYTES_PER_BLOCK) {}
+
+bool ParquetBloomFilter::test_hash(uint64_t hash) const {
+    // unlike BlockSplitBloomFilter, the block is selected by the most significant 32 bits multiplied
+    // by the number of blocks.
+    auto block_index = static_cast<uint32_t>(((hash >> 32) * _num_blocks) >> 32);
+    const uint32_t* block = _bitset.get() + block_index * (BlockSplitBloomFilter::BYTES_PER_BLOCK / sizeof(uint32_t));
+    return BlockSplitBloomFilter::test_block(block, static_cast<uint32_t>(hash));
+}
+
+} // namespace starrocks::parquet
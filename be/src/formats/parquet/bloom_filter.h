@@ -0,0 +1,42 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "common/status.h"
+#include "gen_cpp/parquet_types.h"
+
+namespace starrocks {
+class RandomAccessFile;
+} // namespace starrocks
+
+namespace starrocks::parquet {
+
+// The split block Bloom filter of a column chunk, which hashes the plain encoded values by xxHash64.
+// refer: https://github.com/apache/parquet-format/blob/master/BloomFilter.md
+class ParquetBloomFilter {
+public:
+    // Read the Bloom filter of the column chunk |column_meta| from |file| of |file_size| bytes. |*bf| is set
+    // to nullptr if the algorithm, the hash or the compression of the Bloom filter is not supported.
+    static Status read(RandomAccessFile* file, int64_t file_size, const tparquet::ColumnMetaData& column_meta,
+                       std::unique_ptr<ParquetBloomFilter>* bf);
+
+    // The hash of the plain encoded value |data|. The bytes of a BYTE_ARRAY value are hashed
+    // without the length.
+    static uint64_t hash(const void* data, size_t size);
+
+    ParquetBloomFilter(std::unique_ptr<uint32_t[]> bitset, uint32_t num_bytes);
+
+    // Whether the value of |hash| may be in the column chunk.
+    bool test_hash(uint64_t hash) const;
+
+    bool test_bytes(const void* data, size_t size) const { return test_hash(hash(data, size)); }
+
+private:
+    std::unique_ptr<uint32_t[]> _bitset;
+    uint32_t _num_blocks;
+};
+
+} // namespace starrocks::parquet
@@ -137,6 +137,7 @@ Status ColumnChunkReader::_read_and_decompress_page_data(uint32_t compressed_siz
 
         _reserve_uncompress_buf(uncompressed_size);
         _data = Slice(_uncompressed_buf.get(), uncompressed_size);
+        SCOPED_RAW_TIMER(&_opts.stats->page_decompress_ns);
         RETURN_IF_ERROR(_compress_codec->decompress(com_slice, &_data));
     } else {
         _data.size = uncompressed_size;
@@ -83,6 +83,9 @@ public:
         return _cur_decoder->next_batch(n, content_type, dst);
     }
 
+    // Skip n non-null values of the current page, NotSupported if the decoder can't skip values.
+    Status skip_values(size_t n) { return _cur_decoder->skip(n); }
+
     const tparquet::ColumnMetaData& metadata() const { return _chunk_metadata->meta_data; }
 
     Status get_dict_values(vectorized::Column* column) {
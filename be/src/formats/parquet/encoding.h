@@ -71,6 +71,10 @@ public:
     virtual Status next_batch(size_t count, uint8_t* dst) {
         return Status::NotSupported("next_batch is not supported");
     }
+
+    // Skip the next |count| values without decoding them.
+    // It will return ERROR if caller wants to skip out-of-bound data.
+    virtual Status skip(size_t count) { return Status::NotSupported("skip is not supported"); }
 };
 
 class EncodingInfo {
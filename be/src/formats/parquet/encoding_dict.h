@@ -8,6 +8,8 @@
 #include "column/column_helper.h"
 #include "common/status.h"
 #include "formats/parquet/encoding.h"
+#include "gutil/strings/substitute.h"
+#include "simd/gather.h"
 #include "util/coding.h"
 #include "util/rle_encoding.h"
 #include "util/slice.h"
@@ -97,7 +99,9 @@ public:
     }
 
     Status next_batch(size_t count, ColumnContentType content_type, vectorized::Column* dst) override {
-        _indexes.reserve(count);
+        if (_indexes.size() < count) {
+            _indexes.resize(count);
+        }
         _index_batch_decoder.GetBatch(&_indexes[0], count);
 
         if (dst->is_nullable()) {
@@ -107,9 +111,7 @@ public:
             size_t cur_size = data_column->size();
             data_column->resize_uninitialized(cur_size + count);
 
-            for (int i = 0; i < count; i++) {
-                data_column->get_data()[cur_size + i] = _dict[_indexes[i]];
-            }
+            vectorized::SIMDGather::gather(&data_column->get_data()[cur_size], _dict.data(), _indexes.data(), count);
 
             nullable_column->null_column()->append_default(count);
         } else {
@@ -118,14 +120,23 @@ public:
             size_t cur_size = data_column->size();
             data_column->resize_uninitialized(cur_size + count);
 
-            for (int i = 0; i < count; i++) {
-                data_column->get_data()[cur_size + i] = _dict[_indexes[i]];
-            }
+            vectorized::SIMDGather::gather(&data_column->get_data()[cur_size], _dict.data(), _indexes.data(), count);
         }
 
         return Status::OK();
     }
 
+    Status skip(size_t count) override {
+        while (count > 0) {
+            size_t n = std::min(count, _indexes.size());
+            if (n == 0 || _index_batch_decoder.GetBatch(&_indexes[0], n) != static_cast<int32_t>(n)) {
+                return Status::InternalError(strings::Substitute("going to skip out-of-bounds data, count=$0", count));
+            }
+            count -= n;
+        }
+        return Status::OK();
+    }
+
 private:
     enum { SIZE_OF_TYPE = sizeof(T) };
 
@@ -229,6 +240,17 @@ public:
         return Status::OK();
     }
 
+    Status skip(size_t count) override {
+        while (count > 0) {
+            size_t n = std::min(count, _indexes.size());
+            if (n == 0 || _index_batch_decoder.GetBatch(&_indexes[0], n) != static_cast<int32_t>(n)) {
+                return Status::InternalError(strings::Substitute("going to skip out-of-bounds data, count=$0", count));
+            }
+            count -= n;
+        }
+        return Status::OK();
+    }
+
 private:
     enum { SIZE_OF_DICT_CODE_TYPE = sizeof(int32_t) };
     std::unordered_map<Slice, int32_t, SliceHasher> _dict_code_by_value;
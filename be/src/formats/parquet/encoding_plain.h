@@ -121,6 +121,16 @@ public:
         return Status::OK();
     }
 
+    Status skip(size_t count) override {
+        size_t max_skip = count * SIZE_OF_TYPE;
+        if (max_skip + _offset > _data.size) {
+            return Status::InternalError(strings::Substitute(
+                    "going to skip out-of-bounds data, offset=$0,count=$1,size=$2", _offset, count, _data.size));
+        }
+        _offset += max_skip;
+        return Status::OK();
+    }
+
 private:
     enum { SIZE_OF_TYPE = sizeof(T) };
 
@@ -186,6 +196,20 @@ public:
         return Status::OK();
     }
 
+    Status skip(size_t count) override {
+        size_t num_skipped = 0;
+        while (num_skipped < count && _offset < _data.size) {
+            uint32_t length = decode_fixed32_le(reinterpret_cast<const uint8_t*>(_data.data) + _offset);
+            _offset += sizeof(int32_t) + length;
+            num_skipped++;
+        }
+        if (num_skipped < count || _offset > _data.size) {
+            return Status::InternalError(strings::Substitute(
+                    "going to skip out-of-bounds data, offset=$0,count=$1,size=$2", _offset, count, _data.size));
+        }
+        return Status::OK();
+    }
+
 private:
     Slice _data;
     size_t _offset = 0;
@@ -357,6 +381,15 @@ public:
         return Status::OK();
     }
 
+    Status skip(size_t count) override {
+        if (_offset + _type_length * count > _data.size) {
+            return Status::InternalError(strings::Substitute(
+                    "going to skip out-of-bounds data, offset=$0,count=$1,size=$2", _offset, count, _data.size));
+        }
+        _offset += _type_length * count;
+        return Status::OK();
+    }
+
 private:
     Slice _data;
     size_t _type_length;
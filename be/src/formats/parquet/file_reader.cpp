@@ -7,9 +7,13 @@
 #include "exec/vectorized/hdfs_scanner.h"
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
+#include "exprs/vectorized/in_const_predicate.hpp"
 #include "exprs/vectorized/runtime_filter_bank.h"
+#include "formats/file_metadata_cache.h"
+#include "formats/parquet/bloom_filter.h"
 #include "formats/parquet/encoding_plain.h"
 #include "formats/parquet/metadata.h"
+#include "formats/parquet/page_index_reader.h"
 #include "fs/fs.h"
 #include "gen_cpp/parquet_types.h"
 #include "gutil/strings/substitute.h"
@@ -22,6 +26,8 @@
 namespace starrocks::parquet {
 
 static constexpr uint32_t kFooterSize = 8;
+// The estimated ratio of the memory of a parsed footer to the size of the serialized one.
+static constexpr uint32_t kParsedFooterExpansion = 4;
 
 FileReader::FileReader(int chunk_size, RandomAccessFile* file, uint64_t file_size)
         : _chunk_size(chunk_size), _file(file), _file_size(file_size) {}
@@ -45,6 +51,20 @@ Status FileReader::init(vectorized::HdfsScannerContext* ctx) {
 }
 
 Status FileReader::_parse_footer() {
+    // the footer is cached only if the modification time of the file is known, to never hit a rewritten file.
+    FileMetadataCache* cache = FileMetadataCache::instance();
+    std::string cache_key;
+    if (cache != nullptr && !_scanner_ctx->scan_ranges.empty() &&
+        _scanner_ctx->scan_ranges[0]->__isset.modification_time) {
+        cache_key = FileMetadataCache::key("parquet", _file->filename(), _file_size,
+                                           _scanner_ctx->scan_ranges[0]->modification_time);
+        _file_metadata = cache->lookup<FileMetaData>(cache_key);
+        if (_file_metadata != nullptr) {
+            _scanner_ctx->stats->footer_cache_hit++;
+            return Status::OK();
+        }
+    }
+
     // try with buffer on stack
     constexpr uint64_t footer_buf_size = 16 * 1024;
     uint8_t local_buf[footer_buf_size];
@@ -86,8 +106,12 @@ Status FileReader::_parse_footer() {
     // deserialize footer
     RETURN_IF_ERROR(deserialize_thrift_msg(footer_buf + to_read - 8 - footer_size, &footer_size, TProtocolType::COMPACT,
                                            &t_metadata));
-    _file_metadata.reset(new FileMetaData());
-    RETURN_IF_ERROR(_file_metadata->init(t_metadata));
+    auto file_metadata = std::make_shared<FileMetaData>();
+    RETURN_IF_ERROR(file_metadata->init(t_metadata));
+    _file_metadata = file_metadata;
+    if (!cache_key.empty()) {
+        cache->insert(cache_key, _file_metadata, static_cast<size_t>(footer_size) * kParsedFooterExpansion);
+    }
 
     return Status::OK();
 }
@@ -170,9 +194,260 @@ StatusOr<bool> FileReader::_filter_group(const tparquet::RowGroup& row_group) {
         }
     }
 
+    // filter by bloom filters.
+    if (config::parquet_bloom_filter_enable && !_scanner_ctx->conjunct_ctxs_by_slot.empty()) {
+        return _filter_group_by_bloom_filter(row_group);
+    }
+
     return false;
 }
 
+// append the plain encoded |datum| of |type| to |values|, return false if the column of |type| is not
+// stored as |physical_type| without conversion.
+static bool append_plain_value(PrimitiveType type, tparquet::Type::type physical_type,
+                               const vectorized::Datum& datum, std::vector<std::string>* values) {
+    switch (type) {
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT: {
+        if (physical_type != tparquet::Type::type::INT32) {
+            return false;
+        }
+        int32_t value = type == TYPE_TINYINT    ? datum.get_int8()
+                        : type == TYPE_SMALLINT ? datum.get_int16()
+                                                : datum.get_int32();
+        values->emplace_back(reinterpret_cast<const char*>(&value), sizeof(value));
+        return true;
+    }
+    case TYPE_BIGINT: {
+        if (physical_type != tparquet::Type::type::INT64) {
+            return false;
+        }
+        int64_t value = datum.get_int64();
+        values->emplace_back(reinterpret_cast<const char*>(&value), sizeof(value));
+        return true;
+    }
+    case TYPE_VARCHAR: {
+        if (physical_type != tparquet::Type::type::BYTE_ARRAY) {
+            return false;
+        }
+        const Slice& value = datum.get_slice();
+        values->emplace_back(value.data, value.size);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+template <PrimitiveType Type>
+static bool get_in_predicate_values(const Expr* root, tparquet::Type::type physical_type,
+                                    std::vector<std::string>* values) {
+    const auto* pred = down_cast<const vectorized::VectorizedInConstPredicate<Type>*>(root);
+    if (pred->is_join_runtime_filter() || pred->is_not_in() || pred->null_in_set() ||
+        pred->hash_set().size() > config::max_pushdown_conditions_per_column) {
+        return false;
+    }
+    for (const auto& value : pred->hash_set()) {
+        if (!append_plain_value(Type, physical_type, vectorized::Datum(value), values)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool is_slot_ref_of(const Expr* expr, const SlotDescriptor& slot) {
+    std::vector<SlotId> slot_ids;
+    return expr->is_slotref() && expr->type().type == slot.type().type && expr->get_slot_ids(&slot_ids) == 1 &&
+           slot_ids[0] == slot.id();
+}
+
+// get the plain encoded values of conjunct |ctx| like 'slot = value' or 'slot in (values)',
+// return false if |ctx| is not such a conjunct.
+static bool get_bloom_filter_values(const SlotDescriptor& slot, tparquet::Type::type physical_type,
+                                    ExprContext* ctx, std::vector<std::string>* values) {
+    const Expr* root = ctx->root();
+    if (root->op() == TExprOpcode::FILTER_IN) {
+        if (root->get_num_children() == 0 || !is_slot_ref_of(root->get_child(0), slot)) {
+            return false;
+        }
+        switch (slot.type().type) {
+        case TYPE_TINYINT:
+            return get_in_predicate_values<TYPE_TINYINT>(root, physical_type, values);
+        case TYPE_SMALLINT:
+            return get_in_predicate_values<TYPE_SMALLINT>(root, physical_type, values);
+        case TYPE_INT:
+            return get_in_predicate_values<TYPE_INT>(root, physical_type, values);
+        case TYPE_BIGINT:
+            return get_in_predicate_values<TYPE_BIGINT>(root, physical_type, values);
+        case TYPE_VARCHAR:
+            return get_in_predicate_values<TYPE_VARCHAR>(root, physical_type, values);
+        default:
+            return false;
+        }
+    }
+
+    if (root->op() != TExprOpcode::EQ || root->get_num_children() != 2) {
+        return false;
+    }
+    Expr* l = root->get_child(0);
+    Expr* r = root->get_child(1);
+    if (!r->is_constant()) {
+        std::swap(l, r);
+    }
+    if (!is_slot_ref_of(l, slot) || !r->is_constant()) {
+        return false;
+    }
+    ColumnPtr column = EVALUATE_NULL_IF_ERROR(ctx, r, nullptr);
+    if (column->size() == 0 || column->is_null(0)) {
+        return false;
+    }
+    return append_plain_value(slot.type().type, physical_type, column->get(0), values);
+}
+
+StatusOr<bool> FileReader::_filter_group_by_bloom_filter(const tparquet::RowGroup& row_group) {
+    std::vector<std::string> values;
+    for (const auto& column : _scanner_ctx->materialized_columns) {
+        auto it = _scanner_ctx->conjunct_ctxs_by_slot.find(column.slot_id);
+        if (it == _scanner_ctx->conjunct_ctxs_by_slot.end()) {
+            continue;
+        }
+        const auto* column_meta = _get_column_meta(row_group, column.col_name);
+        if (column_meta == nullptr || !column_meta->__isset.bloom_filter_offset) {
+            continue;
+        }
+
+        // the bloom filter is read at the first conjunct that can be tested by it.
+        std::unique_ptr<ParquetBloomFilter> bf;
+        bool bf_read = false;
+        for (ExprContext* ctx : it->second) {
+            values.clear();
+            if (!get_bloom_filter_values(*column.slot_desc, column_meta->type, ctx, &values)) {
+                continue;
+            }
+            if (!bf_read) {
+                SCOPED_RAW_TIMER(&_scanner_ctx->stats->bloom_filter_read_ns);
+                RETURN_IF_ERROR(ParquetBloomFilter::read(_file, _file_size, *column_meta, &bf));
+                bf_read = true;
+            }
+            if (bf == nullptr) {
+                break;
+            }
+            bool hit = false;
+            for (const auto& value : values) {
+                if (bf->test_bytes(value.data(), value.size())) {
+                    hit = true;
+                    break;
+                }
+            }
+            if (!hit) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+Status FileReader::_filter_pages(const tparquet::RowGroup& row_group, vectorized::SparseRange* row_ranges) {
+    *row_ranges = vectorized::SparseRange(0, row_group.num_rows);
+    if (!config::parquet_page_index_enable || _scanner_ctx->min_max_conjunct_ctxs.empty()) {
+        return Status::OK();
+    }
+    const vectorized::HdfsScannerContext& ctx = *_scanner_ctx;
+
+    // only the conjuncts on a single slot can be evaluated on the pages of its column.
+    std::vector<SlotDescriptor*> slots;
+    std::vector<std::vector<ExprContext*>> slot_conjunct_ctxs;
+    std::vector<const tparquet::ColumnChunk*> column_chunks;
+    for (SlotDescriptor* slot : ctx.min_max_tuple_desc->slots()) {
+        const auto* column_chunk = _get_column_chunk(row_group, slot->col_name());
+        if (column_chunk == nullptr || !PageIndexReader::has_page_index(*column_chunk)) {
+            continue;
+        }
+        std::vector<ExprContext*> conjunct_ctxs;
+        for (ExprContext* conjunct_ctx : ctx.min_max_conjunct_ctxs) {
+            std::vector<SlotId> slot_ids;
+            conjunct_ctx->root()->get_slot_ids(&slot_ids);
+            if (slot_ids.size() == 1 && slot_ids[0] == slot->id()) {
+                conjunct_ctxs.emplace_back(conjunct_ctx);
+            }
+        }
+        if (conjunct_ctxs.empty()) {
+            continue;
+        }
+        slots.emplace_back(slot);
+        slot_conjunct_ctxs.emplace_back(std::move(conjunct_ctxs));
+        column_chunks.emplace_back(column_chunk);
+    }
+    if (slots.empty()) {
+        return Status::OK();
+    }
+
+    std::vector<tparquet::ColumnIndex> column_indexes;
+    std::vector<tparquet::OffsetIndex> offset_indexes;
+    {
+        SCOPED_RAW_TIMER(&ctx.stats->page_index_read_ns);
+        RETURN_IF_ERROR(PageIndexReader::read(_file, column_chunks, &column_indexes, &offset_indexes));
+    }
+
+    std::vector<SlotDescriptor*> min_max_slots(1);
+    for (size_t i = 0; i < slots.size(); i++) {
+        const tparquet::ColumnIndex& column_index = column_indexes[i];
+        size_t num_pages = column_index.null_pages.size();
+        const ParquetField* field = _file_metadata->schema().resolve_by_name(slots[i]->col_name());
+        const tparquet::ColumnOrder* column_order = nullptr;
+        if (_file_metadata->t_metadata().__isset.column_orders) {
+            const auto& column_orders = _file_metadata->t_metadata().column_orders;
+            int column_idx = field->physical_column_index;
+            column_order = column_idx < column_orders.size() ? &column_orders[column_idx] : nullptr;
+        }
+
+        // decode the min/max values of each page as the statistics of column chunk.
+        min_max_slots[0] = slots[i];
+        auto min_chunk = ChunkHelper::new_chunk(min_max_slots, num_pages);
+        auto max_chunk = ChunkHelper::new_chunk(min_max_slots, num_pages);
+        tparquet::ColumnMetaData page_meta = column_chunks[i]->meta_data;
+        page_meta.statistics = tparquet::Statistics();
+        page_meta.statistics.__isset.min_value = true;
+        page_meta.statistics.__isset.max_value = true;
+        bool decode_ok = true;
+        for (size_t page = 0; page < num_pages && decode_ok; page++) {
+            if (column_index.null_pages[page]) {
+                min_chunk->columns()[0]->append_default();
+                max_chunk->columns()[0]->append_default();
+                continue;
+            }
+            page_meta.statistics.min_value = column_index.min_values[page];
+            page_meta.statistics.max_value = column_index.max_values[page];
+            RETURN_IF_ERROR(_decode_min_max_column(*field, ctx.timezone, slots[i]->type(), page_meta, column_order,
+                                                   &min_chunk->columns()[0], &max_chunk->columns()[0], &decode_ok));
+        }
+        if (!decode_ok) {
+            continue;
+        }
+
+        // the null pages are always selected as the min/max conjuncts are not evaluated on nulls.
+        std::vector<uint8_t> selected(num_pages, 1);
+        for (ExprContext* conjunct_ctx : slot_conjunct_ctxs[i]) {
+            ASSIGN_OR_RETURN(auto min_column, conjunct_ctx->evaluate(min_chunk.get()));
+            ASSIGN_OR_RETURN(auto max_column, conjunct_ctx->evaluate(max_chunk.get()));
+            for (size_t page = 0; page < num_pages; page++) {
+                if (column_index.null_pages[page] || min_column->is_null(page) || max_column->is_null(page)) {
+                    continue;
+                }
+                if (min_column->get(page).get_int8() == 0 && max_column->get(page).get_int8() == 0) {
+                    selected[page] = 0;
+                }
+            }
+        }
+        *row_ranges &= PageIndexReader::page_row_ranges(offset_indexes[i], row_group.num_rows, selected);
+        if (row_ranges->empty()) {
+            break;
+        }
+    }
+    return Status::OK();
+}
+
 Status FileReader::_read_min_max_chunk(const tparquet::RowGroup& row_group, const std::vector<SlotDescriptor*>& slots,
                                        vectorized::ChunkPtr* min_chunk, vectorized::ChunkPtr* max_chunk,
                                        bool* exist) const {
@@ -425,7 +700,15 @@ Status FileReader::_init_group_readers() {
                 continue;
             }
 
+            vectorized::SparseRange row_ranges;
+            RETURN_IF_ERROR(_filter_pages(_file_metadata->t_metadata().row_groups[i], &row_ranges));
+            if (row_ranges.empty()) {
+                LOG(INFO) << "row group " << i << " of file has been filtered by page index";
+                continue;
+            }
+
             auto row_group_reader = std::make_shared<GroupReader>(_group_reader_param, i);
+            row_group_reader->set_row_ranges(row_ranges);
             _row_group_readers.emplace_back(row_group_reader);
             _total_row_count += _file_metadata->t_metadata().row_groups[i].num_rows;
         } else {
@@ -507,10 +790,16 @@ Status FileReader::_exec_only_partition_scan(vectorized::ChunkPtr* chunk) {
 
 const tparquet::ColumnMetaData* FileReader::_get_column_meta(const tparquet::RowGroup& row_group,
                                                              const std::string& col_name) {
+    const auto* column = _get_column_chunk(row_group, col_name);
+    return column != nullptr ? &column->meta_data : nullptr;
+}
+
+const tparquet::ColumnChunk* FileReader::_get_column_chunk(const tparquet::RowGroup& row_group,
+                                                           const std::string& col_name) {
     for (const auto& column : row_group.columns) {
         // TODO: support not scalar type
         if (column.meta_data.path_in_schema[0] == col_name) {
-            return &column.meta_data;
+            return &column;
         }
     }
     return nullptr;
@@ -10,6 +10,7 @@
 #include "formats/parquet/group_reader.h"
 #include "gen_cpp/parquet_types.h"
 #include "runtime/runtime_state.h"
+#include "storage/range.h"
 #include "util/buffered_stream.h"
 #include "util/runtime_profile.h"
 
@@ -49,6 +50,13 @@ private:
     // filter row group by min/max conjuncts
     StatusOr<bool> _filter_group(const tparquet::RowGroup& row_group);
 
+    // filter row group by bloom filters of column chunks with equal or in conjuncts
+    StatusOr<bool> _filter_group_by_bloom_filter(const tparquet::RowGroup& row_group);
+
+    // select the rows of row group by min/max conjuncts on the min/max values of pages in page index.
+    // all rows are selected if no page index can be used.
+    Status _filter_pages(const tparquet::RowGroup& row_group, vectorized::SparseRange* row_ranges);
+
     // get row group to read
     // if scan range conatain the first byte in the row group, will be read
     // TODO: later modify the larger block should be read
@@ -87,6 +95,8 @@ private:
     // find column meta according column name
     static const tparquet::ColumnMetaData* _get_column_meta(const tparquet::RowGroup& row_group,
                                                             const std::string& col_name);
+    static const tparquet::ColumnChunk* _get_column_chunk(const tparquet::RowGroup& row_group,
+                                                          const std::string& col_name);
 
     // get the data page start offset in parquet file
     static int64_t _get_row_group_start_offset(const tparquet::RowGroup& row_group);
@@ -94,7 +104,7 @@ private:
     RandomAccessFile* _file = nullptr;
     uint64_t _file_size = 0;
 
-    std::shared_ptr<FileMetaData> _file_metadata;
+    std::shared_ptr<const FileMetaData> _file_metadata;
     vector<std::shared_ptr<GroupReader>> _row_group_readers;
     size_t _cur_row_group_idx = 0;
     size_t _row_group_size = 0;
@@ -38,11 +38,16 @@ Status GroupReader::get_next(vectorized::ChunkPtr* chunk, size_t* row_count) {
     }
 
     _read_chunk->reset();
-    size_t count = *row_count;
+    size_t count = std::min(*row_count, _chunk_size);
     bool has_dict_filter = !_dict_filter_preds.empty();
     bool has_more_filter = !_left_conjunct_ctxs.empty();
     Status status;
 
+    // the pages out of the rows selected by page index are skipped when reading active columns,
+    // and default values are filled as their rows.
+    vectorized::Filter row_ranges_filter;
+    bool has_row_ranges_filter = _fill_row_ranges_filter(count, &row_ranges_filter);
+
     vectorized::ChunkPtr active_chunk = _create_read_chunk(_active_column_indices);
     {
         int rows_to_skip = _column_reader_opts.context->rows_to_skip;
@@ -50,9 +55,10 @@ Status GroupReader::get_next(vectorized::ChunkPtr* chunk, size_t* row_count) {
 
         SCOPED_RAW_TIMER(&_param.stats->group_chunk_read_ns);
         // read data into active_chunk
-        _column_reader_opts.context->filter = nullptr;
+        _column_reader_opts.context->filter = has_row_ranges_filter ? &row_ranges_filter : nullptr;
         status = _read(_active_column_indices, &count, &active_chunk);
         _param.stats->raw_rows_read += count;
+        _next_row += count;
         if (!status.ok() && !status.is_end_of_file()) {
             return status;
         }
@@ -71,6 +77,14 @@ Status GroupReader::get_next(vectorized::ChunkPtr* chunk, size_t* row_count) {
         has_filter = true;
     }
 
+    // filter the rows not selected by page index, must be after dict filter which overwrites the filter.
+    if (has_row_ranges_filter) {
+        for (size_t i = 0; i < count; i++) {
+            chunk_filter[i] &= row_ranges_filter[i];
+        }
+        has_filter = true;
+    }
+
     // other filter that not dict
     if (has_more_filter) {
         SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
@@ -236,6 +250,21 @@ void GroupReader::collect_io_ranges(std::vector<SharedBufferedInputStream::IORan
     *end_offset = end;
 }
 
+bool GroupReader::_fill_row_ranges_filter(size_t count, vectorized::Filter* filter) {
+    if (_row_ranges.empty()) {
+        return false;
+    }
+    vectorized::SparseRange rows = _row_ranges.intersection(vectorized::SparseRange(_next_row, _next_row + count));
+    if (rows.span_size() == count) {
+        return false;
+    }
+    filter->assign(count, 0);
+    for (size_t i = 0; i < rows.size(); i++) {
+        memset(filter->data() + rows[i].begin() - _next_row, 1, rows[i].span_size());
+    }
+    return true;
+}
+
 void GroupReader::_collect_field_io_range(const ParquetField& field,
                                           std::vector<SharedBufferedInputStream::IORange>* ranges,
                                           int64_t* end_offset) {
@@ -392,7 +421,18 @@ void GroupReader::_init_read_chunk() {
         read_slots.emplace_back(slots[chunk_index]);
     }
 
-    size_t chunk_size = _param.chunk_size;
+    // The uncompressed size of the row group tells the width of its rows, a chunk of wide rows has fewer rows.
+    size_t row_bytes = 0;
+    if (_row_group_metadata->num_rows > 0) {
+        size_t total_bytes = 0;
+        for (const auto& column : _param.read_cols) {
+            total_bytes += _row_group_metadata->columns[column.col_idx_in_parquet].meta_data.total_uncompressed_size;
+        }
+        row_bytes = total_bytes / _row_group_metadata->num_rows;
+    }
+    _chunk_size = ChunkHelper::chunk_size_for_row_bytes(_param.chunk_size, row_bytes);
+
+    size_t chunk_size = _chunk_size;
     _read_chunk = ChunkHelper::new_chunk(read_slots, chunk_size);
 
     // replace dict filter column
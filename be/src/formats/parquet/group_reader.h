@@ -9,6 +9,7 @@
 #include "gen_cpp/parquet_types.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
+#include "storage/range.h"
 #include "storage/vectorized_column_predicate.h"
 #include "util/buffered_stream.h"
 #include "util/runtime_profile.h"
@@ -59,7 +60,7 @@ struct GroupReaderParam {
 
     RandomAccessFile* file = nullptr;
 
-    FileMetaData* file_metadata = nullptr;
+    const FileMetaData* file_metadata = nullptr;
 
     bool case_sensitive = false;
 };
@@ -74,6 +75,8 @@ public:
     void close();
     void collect_io_ranges(std::vector<SharedBufferedInputStream::IORange>* ranges, int64_t* end_offset);
     void set_end_offset(int64_t value) { _end_offset = value; }
+    // set the rows selected by page index, the pages of the other rows are skipped without decoding.
+    void set_row_ranges(vectorized::SparseRange row_ranges) { _row_ranges = std::move(row_ranges); }
 
 private:
     using SlotIdExprContextsMap = std::unordered_map<int, std::vector<ExprContext*>>;
@@ -94,6 +97,8 @@ private:
     Status _lazy_skip_rows(const std::vector<int>& read_columns, vectorized::ChunkPtr chunk, size_t chunk_size);
     void _dict_filter(vectorized::ChunkPtr* chunk, vectorized::Filter* filter_ptr);
     Status _dict_decode(vectorized::ChunkPtr* chunk);
+    // fill the selected rows of the next |count| rows into |filter|, return false if all of them are selected.
+    bool _fill_row_ranges_filter(size_t count, vectorized::Filter* filter);
     void _collect_field_io_range(const ParquetField& field, std::vector<SharedBufferedInputStream::IORange>* ranges,
                                  int64_t* end_offset);
 
@@ -122,7 +127,14 @@ private:
     // dict value is empty after conjunct eval, file group can be skipped
     bool _is_group_filtered = false;
 
+    // rows selected by page index, empty means all rows are selected.
+    vectorized::SparseRange _row_ranges;
+    // the row of row group to read next
+    size_t _next_row = 0;
+
     vectorized::ChunkPtr _read_chunk;
+    // the max number of rows read by get_next, no more than _param.chunk_size.
+    size_t _chunk_size = 0;
 
     // param for read row group
     GroupReaderParam& _param;
@@ -22,7 +22,7 @@ Status LevelDecoder::parse(tparquet::Encoding::type encoding, level_t max_level,
         if (num_bytes > slice->size - 4) {
             return Status::InternalError("");
         }
-        _rle_decoder = RleDecoder<level_t>(data + 4, num_bytes, _bit_width);
+        _rle_decoder = RleBatchDecoder<level_t>(data + 4, num_bytes, _bit_width);
 
         slice->data += 4 + num_bytes;
         slice->size -= 4 + num_bytes;
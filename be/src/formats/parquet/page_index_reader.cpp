@@ -0,0 +1,83 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "formats/parquet/page_index_reader.h"
+
+#include <memory>
+
+#include "fs/fs.h"
+#include "gutil/strings/substitute.h"
+#include "util/thrift_util.h"
+
+namespace starrocks::parquet {
+
+bool PageIndexReader::has_page_index(const tparquet::ColumnChunk& column_chunk) {
+    return column_chunk.__isset.column_index_offset && column_chunk.__isset.column_index_length &&
+           column_chunk.__isset.offset_index_offset && column_chunk.__isset.offset_index_length;
+}
+
+Status PageIndexReader::read(RandomAccessFile* file, const std::vector<const tparquet::ColumnChunk*>& column_chunks,
+                             std::vector<tparquet::ColumnIndex>* column_indexes,
+                             std::vector<tparquet::OffsetIndex>* offset_indexes) {
+    size_t total_size = 0;
+    for (const auto* column_chunk : column_chunks) {
+        DCHECK(has_page_index(*column_chunk));
+        if (column_chunk->column_index_length <= 0 || column_chunk->offset_index_length <= 0) {
+            return Status::Corruption(
+                    strings::Substitute("Invalid parquet page index, column_index_length=$0, offset_index_length=$1",
+                                        column_chunk->column_index_length, column_chunk->offset_index_length));
+        }
+        total_size += column_chunk->column_index_length + column_chunk->offset_index_length;
+    }
+
+    // the column indexes of a row group are usually written side by side, so are the offset indexes,
+    // the batch read merges them into a few reads.
+    std::unique_ptr<uint8_t[]> buffer(new uint8_t[total_size]);
+    std::vector<io::ReadRequest> requests;
+    requests.reserve(column_chunks.size() * 2);
+    uint8_t* data = buffer.get();
+    for (const auto* column_chunk : column_chunks) {
+        requests.push_back({column_chunk->column_index_offset, data, column_chunk->column_index_length});
+        data += column_chunk->column_index_length;
+        requests.push_back({column_chunk->offset_index_offset, data, column_chunk->offset_index_length});
+        data += column_chunk->offset_index_length;
+    }
+    RETURN_IF_ERROR(file->read_at_fully_batch(requests));
+
+    column_indexes->resize(column_chunks.size());
+    offset_indexes->resize(column_chunks.size());
+    for (size_t i = 0; i < column_chunks.size(); i++) {
+        const auto& column_index_request = requests[i * 2];
+        const auto& offset_index_request = requests[i * 2 + 1];
+        auto len = static_cast<uint32_t>(column_index_request.count);
+        RETURN_IF_ERROR(deserialize_thrift_msg(static_cast<const uint8_t*>(column_index_request.data), &len,
+                                               TProtocolType::COMPACT, &(*column_indexes)[i]));
+        len = static_cast<uint32_t>(offset_index_request.count);
+        RETURN_IF_ERROR(deserialize_thrift_msg(static_cast<const uint8_t*>(offset_index_request.data), &len,
+                                               TProtocolType::COMPACT, &(*offset_indexes)[i]));
+        const auto& column_index = (*column_indexes)[i];
+        size_t num_pages = column_index.null_pages.size();
+        if (column_index.min_values.size() != num_pages || column_index.max_values.size() != num_pages ||
+            (*offset_indexes)[i].page_locations.size() != num_pages) {
+            return Status::Corruption(strings::Substitute("Unmatched parquet page index, pages=$0 vs $1",
+                                                          num_pages, (*offset_indexes)[i].page_locations.size()));
+        }
+    }
+    return Status::OK();
+}
+
+vectorized::SparseRange PageIndexReader::page_row_ranges(const tparquet::OffsetIndex& offset_index, int64_t num_rows,
+                                                         const std::vector<uint8_t>& selected) {
+    vectorized::SparseRange ranges;
+    const auto& locations = offset_index.page_locations;
+    DCHECK_EQ(locations.size(), selected.size());
+    for (size_t i = 0; i < locations.size(); i++) {
+        if (!selected[i]) {
+            continue;
+        }
+        int64_t end = i + 1 < locations.size() ? locations[i + 1].first_row_index : num_rows;
+        ranges.add(vectorized::Range(locations[i].first_row_index, end));
+    }
+    return ranges;
+}
+
+} // namespace starrocks::parquet
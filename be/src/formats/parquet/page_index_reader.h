@@ -0,0 +1,37 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "common/status.h"
+#include "gen_cpp/parquet_types.h"
+#include "storage/range.h"
+
+namespace starrocks {
+class RandomAccessFile;
+} // namespace starrocks
+
+namespace starrocks::parquet {
+
+// Used to read the page index, i.e. the ColumnIndex and the OffsetIndex, of column chunks, which
+// hold the min/max values and the first row of each data page.
+// refer: https://github.com/apache/parquet-format/blob/master/PageIndex.md
+class PageIndexReader {
+public:
+    // Whether |column_chunk| has both the ColumnIndex and the OffsetIndex.
+    static bool has_page_index(const tparquet::ColumnChunk& column_chunk);
+
+    // Read the page indexes of |column_chunks| from |file| by one batch read. Each of the column
+    // chunks must have the page index.
+    static Status read(RandomAccessFile* file, const std::vector<const tparquet::ColumnChunk*>& column_chunks,
+                       std::vector<tparquet::ColumnIndex>* column_indexes,
+                       std::vector<tparquet::OffsetIndex>* offset_indexes);
+
+    // Return the rows of the pages selected by |selected|, |num_rows| is the number of rows in the row group.
+    static vectorized::SparseRange page_row_ranges(const tparquet::OffsetIndex& offset_index, int64_t num_rows,
+                                                   const std::vector<uint8_t>& selected);
+};
+
+} // namespace starrocks::parquet
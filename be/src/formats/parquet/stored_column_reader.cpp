@@ -376,7 +376,22 @@ Status OptionalStoredColumnReader::_read_records_only(size_t* num_records, Colum
         }
 
         size_t repeated_count = _reader->def_level_decoder().next_repeated_count();
-        if (repeated_count > 0) {
+        if (has_unselected_rows(records_to_read)) {
+            {
+                SCOPED_RAW_TIMER(&_opts.stats->level_decode_ns);
+                if (records_to_read > _levels_capacity) {
+                    _levels_capacity = BitUtil::next_power_of_two(records_to_read);
+                    _def_levels.resize(_levels_capacity);
+                }
+                _reader->decode_def_levels(records_to_read, &_def_levels[0]);
+                _is_nulls.resize(records_to_read);
+                for (size_t i = 0; i < records_to_read; ++i) {
+                    _is_nulls[i] = _def_levels[i] < _field->max_def_level();
+                }
+            }
+            SCOPED_RAW_TIMER(&_opts.stats->value_decode_ns);
+            RETURN_IF_ERROR(decode_selected_values(records_to_read, &_is_nulls[0], content_type, dst));
+        } else if (repeated_count > 0) {
             records_to_read = std::min(records_to_read, repeated_count);
             level_t def_level = 0;
             {
@@ -472,7 +487,11 @@ Status RequiredStoredColumnReader::read_records(size_t* num_records, ColumnConte
         if (records_to_read == 0) {
             break;
         }
-        RETURN_IF_ERROR(_reader->decode_values(records_to_read, content_type, dst));
+        if (has_unselected_rows(records_to_read)) {
+            RETURN_IF_ERROR(decode_selected_values(records_to_read, nullptr, content_type, dst));
+        } else {
+            RETURN_IF_ERROR(_reader->decode_values(records_to_read, content_type, dst));
+        }
         records_read += records_to_read;
         _num_values_left_in_cur_page -= records_to_read;
         update_read_context(records_to_read);
@@ -597,6 +616,58 @@ bool StoredColumnReader::page_selected(size_t num_values) {
     return SIMD::find_nonzero(*filter, start_row) <= end_row;
 }
 
+bool StoredColumnReader::has_unselected_rows(size_t num_rows) const {
+    auto filter = _opts.context->filter;
+    if (!filter) {
+        return false;
+    }
+    size_t start_row = _opts.context->next_row;
+    if (start_row + num_rows > filter->size()) {
+        return true;
+    }
+    return SIMD::count_nonzero(filter->data() + start_row, num_rows) < num_rows;
+}
+
+Status StoredColumnReader::decode_selected_values(size_t num_rows, const uint8_t* is_nulls,
+                                                  ColumnContentType content_type, vectorized::Column* dst) {
+    const auto& filter = *_opts.context->filter;
+    const size_t start_row = _opts.context->next_row;
+    auto is_null = [&](size_t i) { return is_nulls != nullptr && is_nulls[i]; };
+    auto is_selected = [&](size_t i) { return start_row + i < filter.size() && filter[start_row + i]; };
+
+    // decode the runs of the rows with the same nullness and selection, the runs of nulls are not split.
+    size_t i = 0;
+    while (i < num_rows) {
+        bool null = is_null(i);
+        bool selected = is_selected(i);
+        size_t j = i + 1;
+        while (j < num_rows && is_null(j) == null && (null || is_selected(j) == selected)) {
+            j++;
+        }
+        if (null) {
+            dst->append_nulls(j - i);
+        } else if (selected) {
+            RETURN_IF_ERROR(_reader->decode_values(j - i, content_type, dst));
+        } else {
+            RETURN_IF_ERROR(_skip_values(j - i, content_type, *dst));
+            dst->append_default(j - i);
+        }
+        i = j;
+    }
+    return Status::OK();
+}
+
+Status StoredColumnReader::_skip_values(size_t num_values, ColumnContentType content_type,
+                                        const vectorized::Column& dst) {
+    Status st = _reader->skip_values(num_values);
+    if (!st.is_not_supported()) {
+        return st;
+    }
+    // the decoder can't skip values, e.g. the bit-packed booleans, decode them into a temporary column.
+    auto temp_column = dst.clone_empty();
+    return _reader->decode_values(num_values, content_type, temp_column.get());
+}
+
 void StoredColumnReader::update_read_context(size_t records_read) {
     if (_opts.context->rows_to_skip > 0) {
         _opts.context->rows_to_skip -= records_read;
@@ -67,6 +67,15 @@ protected:
 
     void update_read_context(size_t records_read);
 
+    // Whether some of the next |num_rows| rows are not selected by the filter of the context.
+    bool has_unselected_rows(size_t num_rows) const;
+
+    // Decode the values of the next |num_rows| rows of the current page, whose nulls are |is_nulls| if it's not
+    // nullptr. The values of the rows not selected by the filter of the context are skipped without decoding,
+    // and appended to |dst| as defaults, which are dropped by the filter afterwards.
+    Status decode_selected_values(size_t num_rows, const uint8_t* is_nulls, ColumnContentType content_type,
+                                  vectorized::Column* dst);
+
     std::unique_ptr<ColumnChunkReader> _reader;
     size_t _num_values_left_in_cur_page = 0;
     size_t _num_values_skip_in_cur_page = 0;
@@ -77,6 +86,8 @@ private:
                                vectorized::Column* dst);
 
     Status _lazy_load_page_rows(size_t batch_size, ColumnContentType content_type, vectorized::Column* dst);
+
+    Status _skip_values(size_t num_values, ColumnContentType content_type, const vectorized::Column& dst);
 };
 
 } // namespace starrocks::parquet
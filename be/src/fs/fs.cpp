@@ -87,6 +87,17 @@ StatusOr<std::unique_ptr<FileSystem>> FileSystem::CreateUniqueFromString(std::st
     return Status::NotSupported(fmt::format("No FileSystem associated with {}", uri));
 }
 
+Status FileSystem::delete_files(const std::vector<std::string>& fnames) {
+    Status ret;
+    for (const auto& fname : fnames) {
+        auto st = delete_file(fname);
+        if (!st.ok() && !st.is_not_found() && ret.ok()) {
+            ret = std::move(st);
+        }
+    }
+    return ret;
+}
+
 StatusOr<std::shared_ptr<FileSystem>> FileSystem::CreateSharedFromString(std::string_view uri) {
     if (is_posix_uri(uri)) {
         return get_tls_fs_posix();
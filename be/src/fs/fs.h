@@ -173,6 +173,10 @@ public:
     // FIXME: If the named file does not exist, OK or NOT_FOUND is returned, depend on the implementation.
     virtual Status delete_file(const std::string& fname) = 0;
 
+    // Delete the named files, which may be batched into fewer requests by the object storages.
+    // The files that do not exist are ignored. Returns the first error if any file failed to be deleted.
+    virtual Status delete_files(const std::vector<std::string>& fnames);
+
     // Create the specified directory.
     // NOTE: It will return error if the path already exist(not necessarily as a directory)
     virtual Status create_dir(const std::string& dirname) = 0;
@@ -224,6 +228,10 @@ public:
 
 struct RandomAccessFileOptions {
     RandomAccessFileOptions() = default;
+
+    // Map the file into memory if the file system supports it, so that it supports `peek_at()`, see
+    // io::MmapInputStream. Ignored by the file systems other than the local one.
+    bool use_mmap = false;
 };
 
 // Creation-time options for WritableFile
@@ -29,6 +29,8 @@
 #include "gutil/strings/substitute.h"
 #include "gutil/strings/util.h"
 #include "io/fd_input_stream.h"
+#include "io/mmap_input_stream.h"
+#include "runtime/exec_env.h"
 #include "util/errno.h"
 #include "util/slice.h"
 
@@ -303,6 +305,21 @@ public:
 
     StatusOr<std::unique_ptr<RandomAccessFile>> new_random_access_file(const RandomAccessFileOptions& opts,
                                                                        const std::string& fname) override {
+        if (opts.use_mmap) {
+            int fd;
+            RETRY_ON_EINTR(fd, ::open(fname.c_str(), O_RDONLY));
+            if (fd < 0) {
+                return io_error(fname, errno);
+            }
+            // The mapping doesn't need the file descriptor once it's created.
+            auto stream_or = io::MmapInputStream::open(fd, ExecEnv::GetInstance()->mmap_mem_tracker());
+            int res;
+            RETRY_ON_EINTR(res, ::close(fd));
+            if (stream_or.ok()) {
+                return std::make_unique<RandomAccessFile>(std::move(stream_or).value(), fname);
+            }
+            LOG(WARNING) << "Fail to mmap " << fname << ", read it without mmap: " << stream_or.status();
+        }
         if (config::file_descriptor_cache_capacity > 0 && enable_fd_cache(fname)) {
             FdCache::Handle* h = FdCache::Instance()->lookup(fname);
             if (h == nullptr) {
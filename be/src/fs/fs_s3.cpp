@@ -20,6 +20,7 @@
 #include <time.h>
 
 #include <limits>
+#include <map>
 
 #include "common/config.h"
 #include "common/s3_uri.h"
@@ -224,6 +225,8 @@ public:
 
     Status delete_file(const std::string& path) override;
 
+    Status delete_files(const std::vector<std::string>& paths) override;
+
     Status create_dir(const std::string& dirname) override;
 
     Status create_dir_if_missing(const std::string& dirname, bool* created) override;
@@ -310,7 +313,8 @@ StatusOr<std::unique_ptr<WritableFile>> S3FileSystem::new_writable_file(const Wr
     auto client = new_s3client(uri, _options);
     auto ostream = std::make_unique<io::S3OutputStream>(std::move(client), uri.bucket(), uri.key(),
                                                         config::experimental_s3_max_single_part_size,
-                                                        config::experimental_s3_min_upload_part_size);
+                                                        config::experimental_s3_min_upload_part_size,
+                                                        config::experimental_s3_max_concurrent_upload_parts);
     return std::make_unique<OutputStreamAdapter>(std::move(ostream), fname);
 }
 
@@ -566,6 +570,50 @@ Status S3FileSystem::delete_file(const std::string& path) {
     }
 }
 
+Status S3FileSystem::delete_files(const std::vector<std::string>& paths) {
+    // At most 1000 keys can be deleted by a DeleteObjects request.
+    constexpr size_t kMaxKeysPerRequest = 1000;
+    // The objects to delete grouped by the buckets, with the URI of the first object of each bucket.
+    std::map<std::string, std::pair<S3URI, Aws::Vector<Aws::S3::Model::ObjectIdentifier>>> bucket_objects;
+    for (const auto& path : paths) {
+        S3URI uri;
+        if (!uri.parse(path)) {
+            return Status::InvalidArgument(fmt::format("Invalid S3 URI {}", path));
+        }
+        if (UNLIKELY(uri.key().empty() || uri.key().back() == '/')) {
+            return Status::InvalidArgument(fmt::format("object key empty or ended with slash: {}", path));
+        }
+        auto [iter, inserted] = bucket_objects.try_emplace(uri.bucket());
+        if (inserted) {
+            iter->second.first = uri;
+        }
+        iter->second.second.emplace_back().SetKey(uri.key());
+    }
+
+    for (auto& [bucket, uri_objects] : bucket_objects) {
+        auto& [uri, objects] = uri_objects;
+        auto client = new_s3client(uri, _options);
+        for (size_t start = 0; start < objects.size(); start += kMaxKeysPerRequest) {
+            size_t end = std::min(objects.size(), start + kMaxKeysPerRequest);
+            Aws::S3::Model::Delete d;
+            d.WithObjects(Aws::Vector<Aws::S3::Model::ObjectIdentifier>(objects.begin() + start, objects.begin() + end))
+                    .WithQuiet(true);
+            Aws::S3::Model::DeleteObjectsRequest request;
+            request.WithBucket(bucket).WithDelete(std::move(d));
+            // NOTE: The keys that do not exist are reported as deleted, the same as DeleteObject.
+            auto outcome = client->DeleteObjects(request);
+            if (!outcome.IsSuccess()) {
+                return to_status(outcome.GetError().GetErrorType(), outcome.GetError().GetMessage());
+            }
+            if (!outcome.GetResult().GetErrors().empty()) {
+                auto&& e = outcome.GetResult().GetErrors()[0];
+                return Status::IOError(fmt::format("fail to delete {}: {}", e.GetKey(), e.GetMessage()));
+            }
+        }
+    }
+    return Status::OK();
+}
+
 Status S3FileSystem::delete_dir(const std::string& dirname) {
     S3URI uri;
     if (!uri.parse(dirname)) {
@@ -18,6 +18,8 @@
 #include "common/config.h"
 #include "fs/output_stream_adapter.h"
 #include "gutil/strings/util.h"
+#include "io/block_cache.h"
+#include "io/cache_input_stream.h"
 #include "io/input_stream.h"
 #include "io/output_stream.h"
 #include "io/seekable_input_stream.h"
@@ -197,7 +199,11 @@ public:
         if (!file_st.ok()) {
             return to_status(file_st.status());
         }
-        auto istream = std::make_shared<StarletInputStream>(std::move(*file_st));
+        std::shared_ptr<io::SeekableInputStream> istream = std::make_shared<StarletInputStream>(std::move(*file_st));
+        // The segment files of lake tablets are immutable.
+        if (auto* cache = io::BlockCache::instance(); cache != nullptr) {
+            istream = std::make_shared<io::CacheInputStream>(std::move(istream), path, cache);
+        }
         return std::make_unique<RandomAccessFile>(std::move(istream), path);
     }
 
@@ -2,13 +2,24 @@
 
 #include "fs/fs_util.h"
 
+#include <fcntl.h>
 #include <fmt/format.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <iomanip>
 #include <set>
 #include <sstream>
+#include <thread>
 
+#include "util/defer_op.h"
 #include "util/md5.h"
+#include "util/stopwatch.hpp"
 
 namespace starrocks::fs {
 
@@ -56,4 +67,95 @@ StatusOr<std::string> md5sum(const std::string& path) {
     return ss.str();
 }
 
+static Status io_error(const std::string& context, const std::string& path) {
+    return Status::IOError(fmt::format("{} {}: {}", context, path, std::strerror(errno)));
+}
+
+// Copy at most |len| bytes from the offsets of |src_fd| to |dst_fd| in the kernel, return -1 with errno on failure.
+static ssize_t copy_file_range_once(int src_fd, int dst_fd, size_t len) {
+#ifdef SYS_copy_file_range
+    return syscall(SYS_copy_file_range, src_fd, nullptr, dst_fd, nullptr, len, 0);
+#else
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+Status copy_local_file(const std::string& src_path, const std::string& dst_path, int64_t max_bytes_per_second) {
+    int src_fd = ::open(src_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (src_fd < 0) {
+        return io_error("open", src_path);
+    }
+    DeferOp close_src([src_fd]() { ::close(src_fd); });
+    int dst_fd = ::open(dst_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (dst_fd < 0) {
+        return io_error("open", dst_path);
+    }
+    DeferOp close_dst([dst_fd]() { ::close(dst_fd); });
+
+#ifdef FICLONE
+    // A clone shares the extents of the source file, there is nothing to throttle.
+    if (ioctl(dst_fd, FICLONE, src_fd) == 0) {
+        if (fsync(dst_fd) != 0) {
+            return io_error("fsync", dst_path);
+        }
+        return Status::OK();
+    }
+#endif
+
+    // Throttled files are copied in small chunks, so that the rate is even.
+    const size_t chunk_size =
+            max_bytes_per_second > 0 ? std::clamp<int64_t>(max_bytes_per_second / 10, 4096, 8 << 20) : (8 << 20);
+    std::unique_ptr<char[]> buf;
+    bool use_copy_file_range = true;
+    int64_t copied = 0;
+    MonotonicStopWatch watch;
+    watch.start();
+    while (true) {
+        ssize_t n;
+        if (use_copy_file_range) {
+            n = copy_file_range_once(src_fd, dst_fd, chunk_size);
+            // Not supported by the kernel or between the file systems, fall back to read and write.
+            if (n < 0 && copied == 0 &&
+                (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP)) {
+                use_copy_file_range = false;
+                continue;
+            }
+            if (n < 0) {
+                return io_error("copy_file_range to", dst_path);
+            }
+        } else {
+            if (buf == nullptr) {
+                buf.reset(new char[chunk_size]);
+            }
+            n = ::read(src_fd, buf.get(), chunk_size);
+            if (n < 0) {
+                return io_error("read", src_path);
+            }
+            for (ssize_t written = 0; written < n;) {
+                ssize_t res = ::write(dst_fd, buf.get() + written, n - written);
+                if (res < 0) {
+                    return io_error("write", dst_path);
+                }
+                written += res;
+            }
+        }
+        if (n == 0) {
+            break;
+        }
+        copied += n;
+        if (max_bytes_per_second > 0) {
+            int64_t expected_ns = copied * 1000000000 / max_bytes_per_second;
+            int64_t elapsed_ns = watch.elapsed_time();
+            if (expected_ns > elapsed_ns) {
+                std::this_thread::sleep_for(std::chrono::nanoseconds(expected_ns - elapsed_ns));
+            }
+        }
+    }
+    if (fsync(dst_fd) != 0) {
+        return io_error("fsync", dst_path);
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks::fs
@@ -110,6 +110,12 @@ inline Status copy_file(const std::string& src_path, const std::string& dst_path
     return Status::OK();
 }
 
+// Copy the local file |src_path| to |dst_path| and sync it, overwriting the existing file, at most
+// |max_bytes_per_second| bytes per second if it is positive.
+// The file is cloned, if the file system supports reflinks, or copied in the kernel by copy_file_range(2),
+// so its bytes never go through the user space.
+Status copy_local_file(const std::string& src_path, const std::string& dst_path, int64_t max_bytes_per_second = 0);
+
 inline Status canonicalize(const std::string& path, std::string* real_path) {
     ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(path));
     return fs->canonicalize(path, real_path);
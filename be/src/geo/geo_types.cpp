@@ -22,6 +22,8 @@
 #include "geo/geo_types.h"
 
 #include <s2/s2cap.h>
+#include <s2/s2cell_id.h>
+#include <s2/s2cell_union.h>
 
 #include "common/compiler_util.h"
 DIAGNOSTIC_PUSH
@@ -33,6 +35,7 @@ DIAGNOSTIC_POP
 #include <s2/s2latlng.h>
 #include <s2/s2polygon.h>
 #include <s2/s2polyline.h>
+#include <s2/s2region_coverer.h>
 #include <s2/util/coding/coder.h>
 #include <s2/util/units/length-units.h>
 
@@ -553,4 +556,39 @@ bool GeoMultiPolygon::contains(const GeoShape* rhs) {
 }
 #endif
 
+std::unique_ptr<GeoContainsPointIndex> GeoContainsPointIndex::create(const GeoShape* shape) {
+    const S2Region* region = nullptr;
+    if (shape->type() == GEO_SHAPE_POLYGON) {
+        region = ((const GeoPolygon*)shape)->polygon();
+    } else if (shape->type() == GEO_SHAPE_CIRCLE) {
+        region = ((const GeoCircle*)shape)->cap();
+    }
+    if (region == nullptr) {
+        return nullptr;
+    }
+    return std::unique_ptr<GeoContainsPointIndex>(new GeoContainsPointIndex(region));
+}
+
+GeoContainsPointIndex::GeoContainsPointIndex(const S2Region* region) : _region(region) {
+    // More cells hug the boundary tighter, at the cost of a longer binary search of each point.
+    S2RegionCoverer::Options options;
+    options.set_max_cells(64);
+    S2RegionCoverer coverer(options);
+    _covering = std::make_unique<S2CellUnion>(coverer.GetCovering(*region));
+    _interior_covering = std::make_unique<S2CellUnion>(coverer.GetInteriorCovering(*region));
+}
+
+GeoContainsPointIndex::~GeoContainsPointIndex() = default;
+
+bool GeoContainsPointIndex::contains(const S2Point& point) const {
+    S2CellId cell_id(point);
+    if (!_covering->Contains(cell_id)) {
+        return false;
+    }
+    if (_interior_covering->Contains(cell_id)) {
+        return true;
+    }
+    return _region->Contains(point);
+}
+
 } // namespace starrocks
@@ -31,6 +31,8 @@
 class S2Polyline;
 class S2Polygon;
 class S2Cap;
+class S2CellUnion;
+class S2Region;
 
 template <typename T>
 class Vector3;
@@ -143,6 +145,8 @@ public:
 
     GeoShapeType type() const override { return GEO_SHAPE_CIRCLE; }
 
+    const S2Cap* cap() const { return _cap.get(); }
+
     bool contains(const GeoShape* rhs) const override;
     std::string as_wkt() const override;
 
@@ -154,6 +158,26 @@ private:
     std::unique_ptr<S2Cap> _cap;
 };
 
+// The cell coverings of a polygon or a circle, to test whether it contains many points without the exact test of
+// most of them: a point in a cell of the interior covering is contained, and a point not in any cell of the
+// covering is not, only the points near the boundary fall back to the exact test of the shape.
+class GeoContainsPointIndex {
+public:
+    // Return nullptr if |shape| is neither a polygon nor a circle. |shape| must outlive the index.
+    static std::unique_ptr<GeoContainsPointIndex> create(const GeoShape* shape);
+
+    ~GeoContainsPointIndex();
+
+    bool contains(const S2Point& point) const;
+
+private:
+    explicit GeoContainsPointIndex(const S2Region* region);
+
+    const S2Region* _region;
+    std::unique_ptr<S2CellUnion> _covering;
+    std::unique_ptr<S2CellUnion> _interior_covering;
+};
+
 #if 0
 class GeoMultiPoint : public GeoShape {
 public:
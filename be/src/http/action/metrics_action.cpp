@@ -25,6 +25,7 @@
 #include <string>
 
 #include "common/tracer.h"
+#include "gutil/casts.h"
 #include "http/http_channel.h"
 #include "http/http_headers.h"
 #include "http/http_request.h"
@@ -48,6 +49,10 @@ public:
 
 private:
     void _visit_simple_metric(const std::string& name, const MetricLabels& labels, Metric* metric);
+    void _visit_histogram_metric(const std::string& name, const MetricLabels& labels, IntHistogram* metric);
+    // Output the labels, followed by the label of |extra_name| if it isn't empty.
+    void _output_labels(const MetricLabels& labels, const std::string& extra_name = "",
+                        const std::string& extra_value = "");
 
 private:
     std::stringstream _ss;
@@ -100,6 +105,11 @@ void PrometheusMetricsVisitor::visit(const std::string& prefix, const std::strin
             _visit_simple_metric(metric_name, it.first, (Metric*)it.second);
         }
         break;
+    case MetricType::HISTOGRAM:
+        for (auto& it : collector->metrics()) {
+            _visit_histogram_metric(metric_name, it.first, down_cast<IntHistogram*>(it.second));
+        }
+        break;
     default:
         break;
     }
@@ -108,19 +118,52 @@ void PrometheusMetricsVisitor::visit(const std::string& prefix, const std::strin
 void PrometheusMetricsVisitor::_visit_simple_metric(const std::string& name, const MetricLabels& labels,
                                                     Metric* metric) {
     _ss << name;
-    // labels
-    if (!labels.empty()) {
-        _ss << "{";
-        int i = 0;
-        for (auto& label : labels.labels) {
-            if (i++ > 0) {
-                _ss << ",";
-            }
-            _ss << label.name << "=\"" << label.value << "\"";
+    _output_labels(labels);
+    _ss << " " << metric->to_string() << "\n";
+}
+
+// eg:
+// starrocks_be_pipe_operator_chunk_time_ns_bucket{operator="project",le="1024"} 12
+// starrocks_be_pipe_operator_chunk_time_ns_bucket{operator="project",le="+Inf"} 20
+// starrocks_be_pipe_operator_chunk_time_ns_sum{operator="project"} 40960
+// starrocks_be_pipe_operator_chunk_time_ns_count{operator="project"} 20
+void PrometheusMetricsVisitor::_visit_histogram_metric(const std::string& name, const MetricLabels& labels,
+                                                       IntHistogram* metric) {
+    const auto& bounds = metric->bounds();
+    std::vector<int64_t> counts = metric->cumulative_counts();
+    for (size_t i = 0; i < counts.size(); i++) {
+        _ss << name << "_bucket";
+        _output_labels(labels, "le", i < bounds.size() ? std::to_string(bounds[i]) : "+Inf");
+        _ss << " " << counts[i] << "\n";
+    }
+    _ss << name << "_sum";
+    _output_labels(labels);
+    _ss << " " << metric->sum() << "\n";
+    _ss << name << "_count";
+    _output_labels(labels);
+    _ss << " " << counts.back() << "\n";
+}
+
+void PrometheusMetricsVisitor::_output_labels(const MetricLabels& labels, const std::string& extra_name,
+                                              const std::string& extra_value) {
+    if (labels.empty() && extra_name.empty()) {
+        return;
+    }
+    _ss << "{";
+    int i = 0;
+    for (auto& label : labels.labels) {
+        if (i++ > 0) {
+            _ss << ",";
         }
-        _ss << "}";
+        _ss << label.name << "=\"" << label.value << "\"";
     }
-    _ss << " " << metric->to_string() << "\n";
+    if (!extra_name.empty()) {
+        if (i > 0) {
+            _ss << ",";
+        }
+        _ss << extra_name << "=\"" << extra_value << "\"";
+    }
+    _ss << "}";
 }
 
 void SimpleCoreMetricsVisitor::visit(const std::string& prefix, const std::string& name, MetricCollector* collector) {
@@ -171,6 +214,7 @@ void JsonMetricsVisitor::visit(const std::string& prefix, const std::string& nam
     switch (collector->type()) {
     case MetricType::COUNTER:
     case MetricType::GAUGE:
+    case MetricType::HISTOGRAM:
         for (auto& it : collector->metrics()) {
             const MetricLabels& labels = it.first;
             Metric* metric = reinterpret_cast<Metric*>(it.second);
@@ -25,6 +25,7 @@
 #include <gperftools/malloc_extension.h>
 #include <gperftools/profiler.h>
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <mutex>
@@ -40,6 +41,8 @@
 #include "http/http_request.h"
 #include "http/http_response.h"
 #include "util/bfd_parser.h"
+#include "util/lock_contention_profiler.h"
+#include "util/mem_alloc_profiler.h"
 
 namespace starrocks {
 
@@ -144,6 +147,41 @@ void ProfileAction::handle(HttpRequest* req) {
 #endif
 }
 
+void ContentionAction::handle(HttpRequest* req) {
+    size_t max_stacks = 10;
+    const std::string& stacks_str = req->param("stacks");
+    if (!stacks_str.empty()) {
+        max_stacks = std::max(0, std::atoi(stacks_str.c_str()));
+    }
+    std::stringstream ss;
+    LockContentionProfiler::instance()->write_report(ss, max_stacks);
+    if (req->param("reset") == "true") {
+        LockContentionProfiler::instance()->reset();
+    }
+    std::string str = ss.str();
+    HttpChannel::send_reply(req, str);
+}
+
+void MemAllocAction::handle(HttpRequest* req) {
+    const std::string& label = req->param("label");
+    std::stringstream ss;
+    if (req->param("format") == "pprof") {
+        MemAllocProfiler::instance()->write_pprof(ss, label);
+    } else {
+        size_t max_stacks = 10;
+        const std::string& stacks_str = req->param("stacks");
+        if (!stacks_str.empty()) {
+            max_stacks = std::max(0, std::atoi(stacks_str.c_str()));
+        }
+        MemAllocProfiler::instance()->write_report(ss, label, max_stacks);
+    }
+    if (req->param("reset") == "true") {
+        MemAllocProfiler::instance()->reset();
+    }
+    std::string str = ss.str();
+    HttpChannel::send_reply(req, str);
+}
+
 void CmdlineAction::handle(HttpRequest* req) {
     FILE* fp = fopen("/proc/self/cmdline", "r");
     if (fp == nullptr) {
@@ -58,12 +58,27 @@ public:
     void handle(HttpRequest* req) override {}
 };
 
+// Report the lock statistics of the ProfiledMutex sites, see enable_lock_contention_profile.
+// Parameters: "stacks", the number of the sampled stacks reported of each site, 10 by default, and "reset=true" to
+// clear the statistics after reported.
 class ContentionAction : public HttpHandler {
 public:
     ContentionAction() = default;
     ~ContentionAction() override = default;
 
-    void handle(HttpRequest* req) override {}
+    void handle(HttpRequest* req) override;
+};
+
+// Report the sampled allocations by the MemTracker labels, see enable_mem_alloc_profile.
+// Parameters: "label", only the labels containing it are reported, "format=pprof" to write the legacy heap profile
+// format read by pprof instead of the text report, "stacks", the number of the stacks reported of each label in the
+// text report, 10 by default, and "reset=true" to clear the samples after reported.
+class MemAllocAction : public HttpHandler {
+public:
+    MemAllocAction() = default;
+    ~MemAllocAction() override = default;
+
+    void handle(HttpRequest* req) override;
 };
 
 class CmdlineAction : public HttpHandler {
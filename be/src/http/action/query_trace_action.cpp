@@ -0,0 +1,72 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "http/action/query_trace_action.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "exec/pipeline/query_context.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "runtime/exec_env.h"
+#include "util/debug/query_trace.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+const static std::string HEADER_JSON = "application/json";
+const static std::string QUERY_ID_KEY = "query_id";
+
+// Parse the query id printed by print_id(), i.e. the uuid whose first 8 bytes are hi and last 8 bytes are lo.
+static bool parse_query_id(const std::string& str, TUniqueId* query_id) {
+    std::string hex;
+    for (char c : str) {
+        if (c != '-') {
+            hex.push_back(c);
+        }
+    }
+    if (hex.size() != 32 || hex.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos) {
+        return false;
+    }
+    *query_id = UniqueId(std::string_view(hex).substr(0, 16), std::string_view(hex).substr(16)).to_thrift();
+    return true;
+}
+
+void QueryTraceAction::handle(HttpRequest* req) {
+    TUniqueId query_id;
+    if (!parse_query_id(req->param(QUERY_ID_KEY), &query_id)) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, "invalid query_id: " + req->param(QUERY_ID_KEY));
+        return;
+    }
+
+    std::stringstream ss;
+    auto query_ctx = _exec_env->query_context_mgr()->get(query_id);
+    if (query_ctx != nullptr) {
+        // Keep the trace even if the query finishes meanwhile.
+        auto query_trace = query_ctx->shared_query_trace();
+        query_ctx.reset();
+        if (query_trace == nullptr || !query_trace->is_enable()) {
+            HttpChannel::send_reply(req, HttpStatus::NOT_FOUND, "the query is not traced: " + print_id(query_id));
+            return;
+        }
+        Status st = query_trace->write_json(ss);
+        if (!st.ok()) {
+            HttpChannel::send_reply(req, HttpStatus::INTERNAL_SERVER_ERROR, st.to_string());
+            return;
+        }
+    } else {
+        std::ifstream file(debug::QueryTrace::dump_file_path(query_id), std::ios::in | std::ios::binary);
+        if (!file) {
+            HttpChannel::send_reply(req, HttpStatus::NOT_FOUND, "no trace of the query: " + print_id(query_id));
+            return;
+        }
+        ss << file.rdbuf();
+    }
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.c_str());
+    HttpChannel::send_reply(req, HttpStatus::OK, ss.str());
+}
+
+} // namespace starrocks
@@ -0,0 +1,25 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include "http/http_handler.h"
+
+namespace starrocks {
+
+class ExecEnv;
+
+// Download the debug trace of a query in the chrome trace json format, e.g.
+//   curl http://<be_host>:<be_http_port>/api/query_trace?query_id=<query_id> -o trace.json
+// The trace of a running query is taken from its query context, otherwise from the file it is dumped to.
+class QueryTraceAction : public HttpHandler {
+public:
+    explicit QueryTraceAction(ExecEnv* exec_env) : _exec_env(exec_env) {}
+    ~QueryTraceAction() override = default;
+
+    void handle(HttpRequest* req) override;
+
+private:
+    ExecEnv* _exec_env;
+};
+
+} // namespace starrocks
@@ -0,0 +1,115 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "http/action/scan_heat_action.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include "fmt/format.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "storage/read_heat.h"
+#include "storage/storage_engine.h"
+#include "storage/tablet.h"
+#include "storage/tablet_manager.h"
+#include "util/json_util.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+const static std::string HEADER_JSON = "application/json";
+const static std::string PARAM_LIMIT = "limit";
+const static std::string PARAM_TABLET_ID = "tablet_id";
+static constexpr size_t kDefaultLimit = 100;
+
+static void add_read_heat(const ReadHeat& heat, int64_t now_ms, rapidjson::Value* obj,
+                          rapidjson::Document::AllocatorType& allocator) {
+    obj->AddMember("reads", heat.reads(now_ms), allocator);
+    obj->AddMember("bytes", heat.bytes(now_ms), allocator);
+    obj->AddMember("total_reads", heat.total_reads(), allocator);
+    obj->AddMember("total_bytes", heat.total_bytes(), allocator);
+    obj->AddMember("last_read_ms", heat.last_read_ms(), allocator);
+}
+
+Status ScanHeatAction::_handle(HttpRequest* req, std::string* json_result) {
+    int64_t now_ms = UnixMillis();
+    auto* tablet_manager = StorageEngine::instance()->tablet_manager();
+    rapidjson::Document root;
+    root.SetObject();
+    auto& allocator = root.GetAllocator();
+
+    const std::string& tablet_id_str = req->param(PARAM_TABLET_ID);
+    if (!tablet_id_str.empty()) {
+        int64_t tablet_id = 0;
+        try {
+            tablet_id = std::stoll(tablet_id_str);
+        } catch (const std::exception& e) {
+            return Status::InvalidArgument(fmt::format("invalid argument.tablet_id:{}", tablet_id_str));
+        }
+        TabletSharedPtr tablet = tablet_manager->get_tablet(tablet_id);
+        if (tablet == nullptr) {
+            return Status::NotFound(fmt::format("tablet {} not found", tablet_id));
+        }
+        root.AddMember("tablet_id", tablet_id, allocator);
+        add_read_heat(tablet->read_heat(), now_ms, &root, allocator);
+
+        // The rowsets of the primary key tablets are not listed, which would wait for the pending versions.
+        rapidjson::Value rowsets(rapidjson::kArrayType);
+        std::vector<RowsetSharedPtr> tablet_rowsets;
+        if (tablet->updates() == nullptr) {
+            RETURN_IF_ERROR(tablet->capture_consistent_rowsets(Version(0, tablet->max_version().second),
+                                                             &tablet_rowsets));
+        }
+        for (auto& rowset : tablet_rowsets) {
+            rapidjson::Value obj(rapidjson::kObjectType);
+            std::string rowset_id = rowset->rowset_id().to_string();
+            obj.AddMember("rowset_id", rapidjson::Value(rowset_id.c_str(), allocator), allocator);
+            obj.AddMember("start_version", rowset->start_version(), allocator);
+            obj.AddMember("end_version", rowset->end_version(), allocator);
+            obj.AddMember("num_segments", rowset->num_segments(), allocator);
+            add_read_heat(rowset->read_heat(), now_ms, &obj, allocator);
+            rowsets.PushBack(obj, allocator);
+        }
+        root.AddMember("rowsets", rowsets, allocator);
+    } else {
+        size_t limit = kDefaultLimit;
+        const std::string& limit_str = req->param(PARAM_LIMIT);
+        if (!limit_str.empty()) {
+            try {
+                limit = std::stoull(limit_str);
+            } catch (const std::exception& e) {
+                return Status::InvalidArgument(fmt::format("invalid argument.limit:{}", limit_str));
+            }
+        }
+        rapidjson::Value tablets(rapidjson::kArrayType);
+        for (auto& tablet : tablet_manager->get_hottest_tablets(limit)) {
+            rapidjson::Value obj(rapidjson::kObjectType);
+            obj.AddMember("tablet_id", tablet->tablet_id(), allocator);
+            add_read_heat(tablet->read_heat(), now_ms, &obj, allocator);
+            tablets.PushBack(obj, allocator);
+        }
+        root.AddMember("tablets", tablets, allocator);
+    }
+
+    rapidjson::StringBuffer strbuf;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
+    root.Accept(writer);
+    *json_result = std::string(strbuf.GetString());
+    return Status::OK();
+}
+
+void ScanHeatAction::handle(HttpRequest* req) {
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.c_str());
+    std::string json_result;
+    Status st = _handle(req, &json_result);
+    if (!st.ok()) {
+        HttpChannel::send_reply(req, HttpStatus::OK, to_json(st));
+    } else {
+        HttpChannel::send_reply(req, HttpStatus::OK, json_result);
+    }
+}
+
+} // namespace starrocks
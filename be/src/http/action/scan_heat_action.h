@@ -0,0 +1,26 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <string>
+
+#include "common/status.h"
+#include "http/http_handler.h"
+
+namespace starrocks {
+
+// Show the decayed reads and scanned bytes of the tablets by the queries, see ReadHeat.
+// GET /api/scan_heat?limit=<n>: the hottest n tablets, 100 by default.
+// GET /api/scan_heat?tablet_id=<id>: the tablet and its rowsets.
+class ScanHeatAction : public HttpHandler {
+public:
+    ScanHeatAction() = default;
+    ~ScanHeatAction() override = default;
+
+    void handle(HttpRequest* req) override;
+
+private:
+    Status _handle(HttpRequest* req, std::string* json_result);
+};
+
+} // namespace starrocks
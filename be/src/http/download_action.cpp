@@ -21,9 +21,13 @@
 
 #include "http/download_action.h"
 
+#include <event2/bufferevent.h>
+#include <event2/http.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <atomic>
 #include <sstream>
 #include <string>
 
@@ -47,6 +51,43 @@ const std::string DB_PARAMETER = "db";
 const std::string LABEL_PARAMETER = "label";
 const std::string TOKEN_PARAMETER = "token";
 
+// The count of the files being sent by all the download actions.
+static std::atomic<int32_t> s_num_sending_files{0};
+
+// The handler context of a file being sent, which holds a slot of download_max_concurrent_files and limits the
+// speed of the connection by download_max_send_speed_kbps until the response is sent.
+class SendingFileCtx {
+public:
+    explicit SendingFileCtx(HttpRequest* req) {
+        s_num_sending_files++;
+        int64_t max_speed_kbps = config::download_max_send_speed_kbps;
+        if (max_speed_kbps > 0) {
+            auto* conn = evhttp_request_get_connection(req->get_evhttp_request());
+            _bev = conn != nullptr ? evhttp_connection_get_bufferevent(conn) : nullptr;
+        }
+        if (_bev != nullptr) {
+            ev_ssize_t rate = std::min<int64_t>(max_speed_kbps * 1024, EV_RATE_LIMIT_MAX);
+            _rate_limit = ev_token_bucket_cfg_new(EV_RATE_LIMIT_MAX, EV_RATE_LIMIT_MAX, rate, rate, nullptr);
+            if (_rate_limit == nullptr || bufferevent_set_rate_limit(_bev, _rate_limit) != 0) {
+                LOG(WARNING) << "Fail to limit the speed of download to " << max_speed_kbps << "KB/s";
+            }
+        }
+    }
+
+    ~SendingFileCtx() {
+        // The connection may be kept alive for the other requests, which are not limited.
+        if (_rate_limit != nullptr) {
+            bufferevent_set_rate_limit(_bev, nullptr);
+            ev_token_bucket_cfg_free(_rate_limit);
+        }
+        s_num_sending_files--;
+    }
+
+private:
+    bufferevent* _bev = nullptr;
+    ev_token_bucket_cfg* _rate_limit = nullptr;
+};
+
 DownloadAction::DownloadAction(ExecEnv* exec_env, const std::vector<std::string>& allow_dirs)
         : _exec_env(exec_env), _download_type(NORMAL) {
     for (auto& dir : allow_dirs) {
@@ -88,9 +129,18 @@ void DownloadAction::handle_normal(HttpRequest* req, const std::string& file_par
     }
     if (*is_dir) {
         do_dir_response(file_param, req);
-    } else {
-        do_file_response(file_param, req);
+        return;
     }
+    if (req->method() != HttpMethod::HEAD) {
+        int32_t max_files = config::download_max_concurrent_files;
+        if (max_files > 0 && s_num_sending_files >= max_files) {
+            LOG(WARNING) << "Reject to download " << file_param << ", " << max_files << " files are being sent";
+            HttpChannel::send_reply(req, HttpStatus::SERVICE_UNAVAILABLE, "too many files are being downloaded");
+            return;
+        }
+        req->set_handler_ctx(new SendingFileCtx(req));
+    }
+    do_file_response(file_param, req);
 }
 
 void DownloadAction::handle_error_log(HttpRequest* req, const std::string& file_param) {
@@ -140,6 +190,10 @@ void DownloadAction::handle(HttpRequest* req) {
               << MonotonicMillis() - start << "ms";
 }
 
+void DownloadAction::free_handler_ctx(void* handler_ctx) {
+    delete static_cast<SendingFileCtx*>(handler_ctx);
+}
+
 Status DownloadAction::check_token(HttpRequest* req) {
     const std::string& token_str = req->param(TOKEN_PARAMETER);
     if (token_str.empty()) {
@@ -27,8 +27,10 @@ class ExecEnv;
 
 // A simple handler that serves incoming HTTP requests of file-download to send their respective HTTP responses.
 //
-// TODO(lingbin): implements two useful header ('If-Modified-Since' and 'RANGE') to reduce
-// transmission consumption.
+// The files are sent by sendfile, either whole or the range of the 'Range' header, at most
+// download_max_concurrent_files at the same time and download_max_send_speed_kbps each.
+//
+// TODO(lingbin): implements the useful header 'If-Modified-Since' to reduce transmission consumption.
 // We use parameter named 'file' to specify the static resource path, it is an absolute path.
 class DownloadAction : public HttpHandler {
 public:
@@ -41,6 +43,8 @@ public:
 
     void handle(HttpRequest* req) override;
 
+    void free_handler_ctx(void* handler_ctx) override;
+
 private:
     enum DOWNLOAD_TYPE {
         NORMAL = 1,
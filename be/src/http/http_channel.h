@@ -44,7 +44,8 @@ public:
 
     static void send_reply(HttpRequest* request, HttpStatus status, const std::string& content);
 
-    static void send_file(HttpRequest* request, int fd, size_t off, size_t size);
+    // The file is sent by sendfile if the platform supports it, and |fd| is closed after it's sent.
+    static void send_file(HttpRequest* request, int fd, size_t off, size_t size, HttpStatus status = HttpStatus::OK);
 };
 
 } // namespace starrocks
@@ -17,6 +17,8 @@
 
 #include "http/http_client.h"
 
+#include <memory>
+
 #include "common/config.h"
 
 namespace starrocks {
@@ -168,7 +170,7 @@ Status HttpClient::execute(const std::function<bool(const void* data, size_t len
     return Status::OK();
 }
 
-Status HttpClient::download(const std::string& local_path) {
+Status HttpClient::download(const std::string& local_path, int64_t max_speed_kbps) {
     // set method to GET
     set_method(GET);
 
@@ -176,7 +178,10 @@ Status HttpClient::download(const std::string& local_path) {
     // at system level
     curl_easy_setopt(_curl, CURLOPT_LOW_SPEED_LIMIT, config::download_low_speed_limit_kbps * 1024);
     curl_easy_setopt(_curl, CURLOPT_LOW_SPEED_TIME, config::download_low_speed_time);
-    curl_easy_setopt(_curl, CURLOPT_MAX_RECV_SPEED_LARGE, config::max_download_speed_kbps * 1024);
+    if (max_speed_kbps <= 0) {
+        max_speed_kbps = config::max_download_speed_kbps;
+    }
+    curl_easy_setopt(_curl, CURLOPT_MAX_RECV_SPEED_LARGE, static_cast<curl_off_t>(max_speed_kbps * 1024));
 
     auto fp_closer = [](FILE* fp) { fclose(fp); };
     std::unique_ptr<FILE, decltype(fp_closer)> fp(fopen(local_path.c_str(), "w"), fp_closer);
@@ -213,12 +218,30 @@ const char* HttpClient::_to_errmsg(CURLcode code) {
     return _error_buf;
 }
 
+// The client of the thread reused by execute_with_retry, and whether it's being used by a callback.
+static thread_local std::unique_ptr<HttpClient> tls_reused_client;
+static thread_local bool tls_reused_client_in_use = false;
+
 Status HttpClient::execute_with_retry(int retry_times, int sleep_time,
                                       const std::function<Status(HttpClient*)>& callback) {
     Status status;
     for (int i = 0; i < retry_times; ++i) {
-        HttpClient client;
-        status = callback(&client);
+        // The first attempt reuses the client of the thread, whose curl handle keeps the connections alive, and
+        // init() keeps them too. The retries take new clients, in case the kept connections are broken.
+        if (i == 0 && config::http_client_reuse_connections && !tls_reused_client_in_use) {
+            if (tls_reused_client == nullptr) {
+                tls_reused_client = std::make_unique<HttpClient>();
+            }
+            tls_reused_client_in_use = true;
+            status = callback(tls_reused_client.get());
+            tls_reused_client_in_use = false;
+            if (!status.ok()) {
+                tls_reused_client.reset();
+            }
+        } else {
+            HttpClient client;
+            status = callback(&client);
+        }
         if (status.ok()) {
             return status;
         }
@@ -109,8 +109,8 @@ public:
     }
 
     // helper function to download a file, you can call this function to downlaod
-    // a file to local_path
-    Status download(const std::string& local_path);
+    // a file to local_path, at most |max_speed_kbps| KB/s, or max_download_speed_kbps if it is not positive
+    Status download(const std::string& local_path, int64_t max_speed_kbps = 0);
 
     Status execute_post_request(const std::string& payload, std::string* response);
 
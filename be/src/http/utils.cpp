@@ -24,6 +24,9 @@
 #include <fcntl.h>
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <string_view>
+
 #include "common/logging.h"
 #include "common/status.h"
 #include "common/utils.h"
@@ -34,6 +37,7 @@
 #include "http/http_headers.h"
 #include "http/http_request.h"
 #include "util/path_util.h"
+#include "util/string_parser.hpp"
 #include "util/url_coding.h"
 
 namespace starrocks {
@@ -135,24 +139,80 @@ void do_file_response(const std::string& file_path, HttpRequest* req) {
     }
 
     int64_t file_size = st.st_size;
+    int64_t offset = 0;
+    int64_t length = file_size;
+    HttpStatus status = HttpStatus::OK;
 
     // TODO(lingbin): process "IF_MODIFIED_SINCE" header
-    // TODO(lingbin): process "RANGE" header
     const std::string& range_header = req->header(HttpHeaders::RANGE);
     if (!range_header.empty()) {
-        // analyse range header
+        if (!parse_range_header(range_header, file_size, &offset, &length)) {
+            close(fd);
+            req->add_output_header(HttpHeaders::CONTENT_RANGE, ("bytes */" + std::to_string(file_size)).c_str());
+            HttpChannel::send_error(req, HttpStatus::REQUESTED_RANGE_NOT_SATISFIED);
+            return;
+        }
+        status = HttpStatus::PARTIAL_CONTENT;
+        std::string content_range = "bytes " + std::to_string(offset) + "-" + std::to_string(offset + length - 1) +
+                                    "/" + std::to_string(file_size);
+        req->add_output_header(HttpHeaders::CONTENT_RANGE, content_range.c_str());
     }
 
     req->add_output_header(HttpHeaders::CONTENT_TYPE, get_content_type(file_path).c_str());
+    req->add_output_header(HttpHeaders::ACCEPT_RANGES, "bytes");
 
     if (req->method() == HttpMethod::HEAD) {
         close(fd);
-        req->add_output_header(HttpHeaders::CONTENT_LENGTH, std::to_string(file_size).c_str());
-        HttpChannel::send_reply(req);
+        req->add_output_header(HttpHeaders::CONTENT_LENGTH, std::to_string(length).c_str());
+        HttpChannel::send_reply(req, status);
         return;
     }
 
-    HttpChannel::send_file(req, fd, 0, file_size);
+    HttpChannel::send_file(req, fd, offset, length, status);
+}
+
+bool parse_range_header(const std::string& range_header, int64_t file_size, int64_t* offset, int64_t* length) {
+    static const std::string kBytesUnit = "bytes=";
+    if (range_header.compare(0, kBytesUnit.size(), kBytesUnit) != 0 || file_size <= 0) {
+        return false;
+    }
+    std::string_view spec(range_header);
+    spec.remove_prefix(kBytesUnit.size());
+    size_t dash = spec.find('-');
+    // The multiple ranges are not supported.
+    if (dash == std::string_view::npos || spec.find(',') != std::string_view::npos) {
+        return false;
+    }
+    auto parse = [](std::string_view str, int64_t* value) {
+        StringParser::ParseResult result;
+        *value = StringParser::string_to_int<int64_t>(str.data(), str.size(), &result);
+        return !str.empty() && result == StringParser::PARSE_SUCCESS && *value >= 0;
+    };
+    std::string_view first = spec.substr(0, dash);
+    std::string_view last = spec.substr(dash + 1);
+    int64_t start = 0;
+    int64_t end = file_size - 1;
+    if (first.empty()) {
+        // The suffix of |last| bytes.
+        int64_t suffix_length = 0;
+        if (!parse(last, &suffix_length) || suffix_length == 0) {
+            return false;
+        }
+        start = std::max<int64_t>(0, file_size - suffix_length);
+    } else {
+        if (!parse(first, &start) || start >= file_size) {
+            return false;
+        }
+        if (!last.empty()) {
+            if (!parse(last, &end) || end < start) {
+                return false;
+            }
+            end = std::min(end, file_size - 1);
+        }
+    }
+    *offset = start;
+    *length = end - start + 1;
+    return true;
 }
 
 void do_dir_response(const std::string& dir_path, HttpRequest* req) {
@@ -35,8 +35,13 @@ bool parse_basic_auth(const HttpRequest& req, std::string* user, std::string* pa
 
 bool parse_basic_auth(const HttpRequest& req, AuthInfo* auth);
 
+// Send the file, or the range of it requested by the "Range" header.
 void do_file_response(const std::string& dir_path, HttpRequest* req);
 
+// Parse a "Range" header of a single byte range, e.g. "bytes=0-99", "bytes=100-" or "bytes=-100", into the
+// |offset| and |length| in a file of |file_size| bytes. Return false if it's malformed or not satisfiable.
+bool parse_range_header(const std::string& range_header, int64_t file_size, int64_t* offset, int64_t* length);
+
 void do_dir_response(const std::string& dir_path, HttpRequest* req);
 
 std::string get_content_type(const std::string& file_name);
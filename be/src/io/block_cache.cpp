@@ -0,0 +1,277 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "io/block_cache.h"
+
+#include <fmt/format.h>
+
+#include "common/logging.h"
+#include "fs/fs.h"
+#include "fs/fs_util.h"
+#include "gutil/strings/util.h"
+#include "util/coding.h"
+#include "util/hash_util.hpp"
+#include "util/lru_cache.h"
+#include "util/starrocks_metrics.h"
+#include "util/threadpool.h"
+
+namespace starrocks::io {
+
+BlockCache* BlockCache::_s_instance = nullptr;
+
+// The suffix of a block file being written, which is removed at startup.
+static const std::string kTmpSuffix = ".tmp";
+
+namespace {
+
+// The value of an entry in the disk index.
+struct DiskBlock {
+    std::string file_path;
+    const std::atomic<bool>* closing;
+};
+
+void delete_mem_block(const CacheKey& /*key*/, void* value) {
+    delete static_cast<std::string*>(value);
+}
+
+void delete_disk_block(const CacheKey& /*key*/, void* value) {
+    auto* block = static_cast<DiskBlock*>(value);
+    if (!block->closing->load(std::memory_order_acquire)) {
+        auto st = FileSystem::Default()->delete_file(block->file_path);
+        LOG_IF(WARNING, !st.ok() && !st.is_not_found()) << "Fail to delete block file " << block->file_path << ": "
+                                                        << st;
+    }
+    delete block;
+}
+
+} // namespace
+
+Status BlockCache::create_global_cache(const BlockCacheOptions& options) {
+    DCHECK(_s_instance == nullptr);
+    auto cache = std::make_unique<BlockCache>(options);
+    RETURN_IF_ERROR(cache->init());
+    _s_instance = cache.release();
+    return Status::OK();
+}
+
+void BlockCache::release_global_cache() {
+    delete _s_instance;
+    _s_instance = nullptr;
+}
+
+BlockCache::BlockCache(BlockCacheOptions options) : _options(std::move(options)) {}
+
+BlockCache::~BlockCache() {
+    if (_disk_writers != nullptr) {
+        _disk_writers->shutdown();
+    }
+    _closing.store(true, std::memory_order_release);
+    _disk_index.reset();
+    _mem_cache.reset();
+}
+
+Status BlockCache::init() {
+    if (_options.block_size <= 0) {
+        return Status::InvalidArgument(fmt::format("Invalid block size of block cache: {}", _options.block_size));
+    }
+    if (_options.mem_size > 0) {
+        _mem_cache.reset(new_lru_cache(_options.mem_size));
+    }
+    if (_options.disk_size <= 0) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(ThreadPoolBuilder("block_cache_writer")
+                            .set_min_threads(0)
+                            .set_max_threads(2)
+                            .set_max_queue_size(1024)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_disk_writers));
+    _disk_index.reset(new_lru_cache(_options.disk_size));
+    RETURN_IF_ERROR(fs::create_directories(_options.disk_path));
+    return load_disk_blocks();
+}
+
+std::string BlockCache::encode_key(const std::string& path, int64_t block_index) {
+    std::string key(path);
+    put_fixed64_le(&key, block_index);
+    return key;
+}
+
+std::string BlockCache::block_file_path(const std::string& key) const {
+    uint64_t hash = HashUtil::hash64(key.data(), key.size(), 0);
+    return fmt::format("{}/{:016x}", _options.disk_path, hash);
+}
+
+// A block file is the length of the key in 4 bytes, the key, then the data of the block.
+Status BlockCache::load_disk_blocks() {
+    std::vector<std::string> names;
+    RETURN_IF_ERROR(FileSystem::Default()->get_children(_options.disk_path, &names));
+    int64_t num_blocks = 0;
+    for (const auto& name : names) {
+        auto file_path = fmt::format("{}/{}", _options.disk_path, name);
+        if (HasSuffixString(name, kTmpSuffix)) {
+            (void)FileSystem::Default()->delete_file(file_path);
+            continue;
+        }
+        auto st = [&]() -> Status {
+            ASSIGN_OR_RETURN(auto file, fs::new_random_access_file(file_path));
+            ASSIGN_OR_RETURN(auto file_size, file->get_size());
+            uint8_t buf[sizeof(uint32_t)];
+            if (file_size < static_cast<int64_t>(sizeof(buf))) {
+                return Status::Corruption("too small block file");
+            }
+            RETURN_IF_ERROR(file->read_at_fully(0, buf, sizeof(buf)));
+            const int64_t header_size = sizeof(buf) + decode_fixed32_le(buf);
+            if (file_size < header_size) {
+                return Status::Corruption("too small block file");
+            }
+            std::string key(header_size - sizeof(buf), '\0');
+            RETURN_IF_ERROR(file->read_at_fully(sizeof(buf), key.data(), key.size()));
+            if (block_file_path(key) != file_path) {
+                return Status::Corruption("mismatched block file name");
+            }
+            auto* block = new DiskBlock{file_path, &_closing};
+            _disk_index->release(_disk_index->insert(key, block, file_size - header_size, delete_disk_block));
+            return Status::OK();
+        }();
+        if (!st.ok()) {
+            LOG(WARNING) << "Remove invalid block file " << file_path << ": " << st;
+            (void)FileSystem::Default()->delete_file(file_path);
+            continue;
+        }
+        num_blocks++;
+    }
+    LOG(INFO) << "Loaded " << num_blocks << " blocks of block cache from " << _options.disk_path;
+    return Status::OK();
+}
+
+Status BlockCache::read_block(const std::string& path, int64_t block_index, std::string* data) {
+    StarRocksMetrics::instance()->block_cache_lookup_total.increment(1);
+    auto key = encode_key(path, block_index);
+    if (auto* handle = _mem_cache != nullptr ? _mem_cache->lookup(key) : nullptr; handle != nullptr) {
+        *data = *static_cast<std::string*>(_mem_cache->value(handle));
+        _mem_cache->release(handle);
+        StarRocksMetrics::instance()->block_cache_mem_hit_total.increment(1);
+        return Status::OK();
+    }
+    if (auto st = read_disk_block(key, data); !st.ok()) {
+        return st;
+    }
+    StarRocksMetrics::instance()->block_cache_disk_hit_total.increment(1);
+    insert_mem_block(key, *data);
+    return Status::OK();
+}
+
+Status BlockCache::read_disk_block(const std::string& key, std::string* data) {
+    if (_disk_index == nullptr) {
+        return Status::NotFound("block not cached");
+    }
+    auto* handle = _disk_index->lookup(key);
+    if (handle == nullptr) {
+        return Status::NotFound("block not cached");
+    }
+    auto file_path = static_cast<DiskBlock*>(_disk_index->value(handle))->file_path;
+    _disk_index->release(handle);
+
+    auto st = [&]() -> Status {
+        ASSIGN_OR_RETURN(auto file, fs::new_random_access_file(file_path));
+        ASSIGN_OR_RETURN(auto file_size, file->get_size());
+        const int64_t header_size = sizeof(uint32_t) + key.size();
+        if (file_size < header_size) {
+            return Status::NotFound("block file is replaced");
+        }
+        std::string buf(file_size, '\0');
+        RETURN_IF_ERROR(file->read_at_fully(0, buf.data(), file_size));
+        // The file may be replaced by another block with the same hash, whose entry is erased below, so the
+        // file is deleted and both blocks miss afterwards.
+        if (decode_fixed32_le(reinterpret_cast<const uint8_t*>(buf.data())) != key.size() ||
+            buf.compare(sizeof(uint32_t), key.size(), key) != 0) {
+            return Status::NotFound("block file is replaced");
+        }
+        data->assign(buf, header_size, std::string::npos);
+        return Status::OK();
+    }();
+    if (!st.ok()) {
+        LOG_IF(WARNING, !st.is_not_found()) << "Fail to read block file " << file_path << ": " << st;
+        std::lock_guard l(_disk_lock);
+        _disk_index->erase(key);
+        return Status::NotFound("block not cached");
+    }
+    return Status::OK();
+}
+
+void BlockCache::write_block(const std::string& path, int64_t block_index, std::string data) {
+    auto key = encode_key(path, block_index);
+    if (_disk_writers != nullptr) {
+        {
+            std::lock_guard l(_pending_lock);
+            if (!_pending_keys.insert(key).second) {
+                // Being written by another reader.
+                insert_mem_block(key, std::move(data));
+                return;
+            }
+        }
+        auto task = [this, key, data]() {
+            write_disk_block(key, data);
+            std::lock_guard l(_pending_lock);
+            _pending_keys.erase(key);
+        };
+        if (auto st = _disk_writers->submit_func(std::move(task)); !st.ok()) {
+            VLOG(2) << "Skip writing block cache to disk: " << st;
+            std::lock_guard l(_pending_lock);
+            _pending_keys.erase(key);
+        }
+    }
+    insert_mem_block(key, std::move(data));
+}
+
+void BlockCache::write_disk_block(const std::string& key, const std::string& data) {
+    if (auto* handle = _disk_index->lookup(key); handle != nullptr) {
+        _disk_index->release(handle);
+        return;
+    }
+    auto file_path = block_file_path(key);
+    auto tmp_path = file_path + kTmpSuffix;
+    auto st = [&]() -> Status {
+        ASSIGN_OR_RETURN(auto file, fs::new_writable_file(tmp_path));
+        std::string header;
+        put_fixed32_le(&header, key.size());
+        header.append(key);
+        Slice slices[2] = {Slice(header), Slice(data)};
+        RETURN_IF_ERROR(file->appendv(slices, 2));
+        return file->close();
+    }();
+    if (!st.ok()) {
+        LOG(WARNING) << "Fail to write block file " << tmp_path << ": " << st;
+        (void)FileSystem::Default()->delete_file(tmp_path);
+        return;
+    }
+
+    // A block file of another key with the same hash is replaced here, which is detected by the key in
+    // the file at read.
+    std::lock_guard l(_disk_lock);
+    st = FileSystem::Default()->rename_file(tmp_path, file_path);
+    if (!st.ok()) {
+        LOG(WARNING) << "Fail to rename block file " << tmp_path << ": " << st;
+        (void)FileSystem::Default()->delete_file(tmp_path);
+        return;
+    }
+    auto* block = new DiskBlock{file_path, &_closing};
+    _disk_index->release(_disk_index->insert(key, block, data.size(), delete_disk_block));
+}
+
+void BlockCache::insert_mem_block(const std::string& key, std::string data) {
+    if (_mem_cache == nullptr) {
+        return;
+    }
+    size_t charge = data.size();
+    auto* value = new std::string(std::move(data));
+    _mem_cache->release(_mem_cache->insert(key, value, charge, delete_mem_block));
+}
+
+void BlockCache::TEST_wait_for_disk_writes() {
+    if (_disk_writers != nullptr) {
+        _disk_writers->wait();
+    }
+}
+
+} // namespace starrocks::io
@@ -0,0 +1,101 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+#include "common/status.h"
+
+namespace starrocks {
+class Cache;
+class ThreadPool;
+} // namespace starrocks
+
+namespace starrocks::io {
+
+struct BlockCacheOptions {
+    // The local directory of the disk tier, which is created if not exists.
+    std::string disk_path;
+    int64_t disk_size = 0;
+    int64_t mem_size = 0;
+    int64_t block_size = 1024 * 1024;
+};
+
+// BlockCache caches the fixed-size blocks of the remote files, e.g. the segments of the lake tablets, in a
+// memory tier and a local disk tier, both evicted by LRU.
+//
+// A block is keyed by the path of the file and its index in the file, i.e. offset / block_size, so only the
+// immutable files can be cached. Each block of the disk tier is a file under |disk_path|, named by the hash
+// of the key, which is also written at the head of the file to detect the hash collisions. The files are
+// loaded at startup, so the disk tier survives restarts.
+//
+// Thread-safe.
+class BlockCache {
+public:
+    // Create the global instance, which must be called before instance().
+    static Status create_global_cache(const BlockCacheOptions& options);
+
+    static void release_global_cache();
+
+    // Returns nullptr if the global instance is not created, i.e. the block cache is disabled.
+    static BlockCache* instance() { return _s_instance; }
+
+    explicit BlockCache(BlockCacheOptions options);
+
+    ~BlockCache();
+
+    BlockCache(const BlockCache&) = delete;
+    void operator=(const BlockCache&) = delete;
+
+    // Create the disk directory and load the blocks in it.
+    Status init();
+
+    int64_t block_size() const { return _options.block_size; }
+
+    // Read the block |block_index| of |path| into |data|, looking up the memory tier first.
+    // Returns NotFound on a miss.
+    Status read_block(const std::string& path, int64_t block_index, std::string* data);
+
+    // Cache |data| as the block |block_index| of |path|. The memory tier is populated at once, while the disk
+    // tier is populated asynchronously, and the block is dropped from the disk tier if the writers are busy.
+    void write_block(const std::string& path, int64_t block_index, std::string data);
+
+    // Wait until the pending disk writes finished.
+    void TEST_wait_for_disk_writes();
+
+private:
+    static std::string encode_key(const std::string& path, int64_t block_index);
+
+    std::string block_file_path(const std::string& key) const;
+
+    Status load_disk_blocks();
+
+    Status read_disk_block(const std::string& key, std::string* data);
+
+    void write_disk_block(const std::string& key, const std::string& data);
+
+    void insert_mem_block(const std::string& key, std::string data);
+
+    static BlockCache* _s_instance;
+
+    const BlockCacheOptions _options;
+    std::unique_ptr<Cache> _mem_cache;
+    // The index of the blocks of the disk tier, whose deleter removes the block files on eviction.
+    std::unique_ptr<Cache> _disk_index;
+    std::unique_ptr<ThreadPool> _disk_writers;
+
+    // Serializes the publishing of the block files into the disk index.
+    std::mutex _disk_lock;
+    // The keys being written to the disk tier, to avoid writing a block twice concurrently.
+    std::mutex _pending_lock;
+    std::unordered_set<std::string> _pending_keys;
+
+    // Set when the cache is destroyed, so the block files are kept for the next startup.
+    std::atomic<bool> _closing{false};
+};
+
+} // namespace starrocks::io
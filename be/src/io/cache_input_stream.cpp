@@ -0,0 +1,75 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "io/cache_input_stream.h"
+
+#include <fmt/format.h>
+
+#include <cstring>
+
+#include "io/block_cache.h"
+
+namespace starrocks::io {
+
+CacheInputStream::CacheInputStream(std::shared_ptr<SeekableInputStream> stream, std::string path,
+                                   BlockCache* cache)
+        : _stream(std::move(stream)), _path(std::move(path)), _cache(cache) {}
+
+StatusOr<int64_t> CacheInputStream::read(void* data, int64_t count) {
+    ASSIGN_OR_RETURN(auto nread, read_at(_offset, data, count));
+    _offset += nread;
+    return nread;
+}
+
+Status CacheInputStream::seek(int64_t offset) {
+    if (offset < 0) return Status::InvalidArgument(fmt::format("Invalid offset {}", offset));
+    _offset = offset;
+    return Status::OK();
+}
+
+StatusOr<int64_t> CacheInputStream::get_size() {
+    if (_size < 0) {
+        ASSIGN_OR_RETURN(_size, _stream->get_size());
+    }
+    return _size;
+}
+
+StatusOr<int64_t> CacheInputStream::read_at(int64_t offset, void* out, int64_t count) {
+    if (offset < 0) return Status::InvalidArgument(fmt::format("Invalid offset {}", offset));
+    ASSIGN_OR_RETURN(auto size, get_size());
+    count = std::min(count, std::max<int64_t>(size - offset, 0));
+    const int64_t block_size = _cache->block_size();
+    auto* dst = static_cast<char*>(out);
+    std::string block;
+    for (int64_t pos = offset, end = offset + count; pos < end;) {
+        const int64_t block_index = pos / block_size;
+        const int64_t block_offset = block_index * block_size;
+        if (_cache->read_block(_path, block_index, &block).ok()) {
+            _stats.hit_count++;
+            _stats.hit_bytes += block.size();
+        } else {
+            block.resize(std::min(block_size, size - block_offset));
+            RETURN_IF_ERROR(_stream->read_at_fully(block_offset, block.data(), block.size()));
+            _cache->write_block(_path, block_index, block);
+            _stats.miss_count++;
+            _stats.miss_bytes += block.size();
+        }
+        const int64_t n = std::min<int64_t>(end, block_offset + block.size()) - pos;
+        if (n <= 0) {
+            return Status::Corruption(fmt::format("Mismatched block size of {} in block cache", _path));
+        }
+        memcpy(dst, block.data() + (pos - block_offset), n);
+        dst += n;
+        pos += n;
+    }
+    return count;
+}
+
+Status CacheInputStream::read_at_fully(int64_t offset, void* out, int64_t count) {
+    ASSIGN_OR_RETURN(auto nread, read_at(offset, out, count));
+    if (nread != count) {
+        return Status::IOError(fmt::format("cannot read fully {} bytes from {} at offset {}", count, _path, offset));
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks::io
@@ -0,0 +1,61 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "io/seekable_input_stream.h"
+
+namespace starrocks::io {
+
+class BlockCache;
+
+// CacheInputStream reads the blocks of an immutable remote file through a BlockCache. The blocks missed are
+// read from |stream| as a whole, and written into the cache.
+class CacheInputStream final : public SeekableInputStream {
+public:
+    // The blocks read, which are hit or missed in the cache.
+    struct Stats {
+        int64_t hit_count = 0;
+        int64_t hit_bytes = 0;
+        int64_t miss_count = 0;
+        int64_t miss_bytes = 0;
+    };
+
+    explicit CacheInputStream(std::shared_ptr<SeekableInputStream> stream, std::string path, BlockCache* cache);
+
+    ~CacheInputStream() override = default;
+
+    // Disallow copy and assignment
+    CacheInputStream(const CacheInputStream&) = delete;
+    void operator=(const CacheInputStream&) = delete;
+
+    StatusOr<int64_t> read(void* data, int64_t count) override;
+
+    Status seek(int64_t offset) override;
+
+    StatusOr<int64_t> position() override { return _offset; }
+
+    StatusOr<int64_t> read_at(int64_t offset, void* out, int64_t count) override;
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override;
+
+    StatusOr<int64_t> get_size() override;
+
+    StatusOr<std::unique_ptr<NumericStatistics>> get_numeric_statistics() override {
+        return _stream->get_numeric_statistics();
+    }
+
+    const Stats& stats() const { return _stats; }
+
+private:
+    std::shared_ptr<SeekableInputStream> _stream;
+    std::string _path;
+    BlockCache* _cache;
+    int64_t _offset = 0;
+    int64_t _size = -1;
+    Stats _stats;
+};
+
+} // namespace starrocks::io
@@ -0,0 +1,51 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "io/data_cache.h"
+
+#include <fmt/format.h>
+
+#include "common/logging.h"
+#include "io/block_cache.h"
+#include "util/hash_util.hpp"
+
+namespace starrocks::io {
+
+DataCache* DataCache::_s_instance = nullptr;
+
+Status DataCache::create_global_cache(const std::vector<std::string>& dirs, int64_t disk_size_per_dir,
+                                      int64_t block_size) {
+    DCHECK(_s_instance == nullptr);
+    if (dirs.empty() || disk_size_per_dir <= 0) {
+        return Status::InvalidArgument("data cache needs the directories and the disk size");
+    }
+    auto data_cache = std::make_unique<DataCache>();
+    for (const auto& dir : dirs) {
+        BlockCacheOptions options;
+        options.disk_path = dir;
+        options.disk_size = disk_size_per_dir;
+        options.block_size = block_size;
+        auto cache = std::make_unique<BlockCache>(options);
+        RETURN_IF_ERROR(cache->init());
+        data_cache->_caches.emplace_back(std::move(cache));
+    }
+    _s_instance = data_cache.release();
+    return Status::OK();
+}
+
+void DataCache::release_global_cache() {
+    delete _s_instance;
+    _s_instance = nullptr;
+}
+
+DataCache::~DataCache() = default;
+
+std::string DataCache::file_key(const std::string& path, int64_t modification_time) {
+    return fmt::format("{}@{}", path, modification_time);
+}
+
+BlockCache* DataCache::cache_of(const std::string& file_key) const {
+    uint32_t hash = HashUtil::hash(file_key.data(), file_key.size(), 0);
+    return _caches[hash % _caches.size()].get();
+}
+
+} // namespace starrocks::io
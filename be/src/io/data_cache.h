@@ -0,0 +1,50 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+
+namespace starrocks::io {
+
+class BlockCache;
+
+// DataCache caches the blocks of the remote files of external tables, e.g. the parquet files of hive tables
+// on HDFS or S3, on the local disks. Each storage directory has a disk-only BlockCache of |disk_size_per_dir|
+// bytes, evicted by LRU, and the files are spread on the directories by the hash of their keys.
+//
+// The files of external tables may be rewritten, so a file is keyed by its path and modification time.
+class DataCache {
+public:
+    // Create the global instance with the caches under |dirs|, which must be called before instance().
+    static Status create_global_cache(const std::vector<std::string>& dirs, int64_t disk_size_per_dir,
+                                      int64_t block_size);
+
+    static void release_global_cache();
+
+    // Returns nullptr if the global instance is not created, i.e. the data cache is disabled.
+    static DataCache* instance() { return _s_instance; }
+
+    DataCache() = default;
+
+    ~DataCache();
+
+    DataCache(const DataCache&) = delete;
+    void operator=(const DataCache&) = delete;
+
+    // The key of the blocks of the file |path| last modified at |modification_time|.
+    static std::string file_key(const std::string& path, int64_t modification_time);
+
+    // The cache of the blocks of the file |file_key|.
+    BlockCache* cache_of(const std::string& file_key) const;
+
+private:
+    static DataCache* _s_instance;
+
+    std::vector<std::unique_ptr<BlockCache>> _caches;
+};
+
+} // namespace starrocks::io
@@ -6,9 +6,11 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "gutil/macros.h"
 #include "io/io_error.h"
+#include "io/io_uring.h"
 
 namespace starrocks::io {
 
@@ -49,6 +51,16 @@ StatusOr<int64_t> FdInputStream::read(void* data, int64_t count) {
     return res;
 }
 
+Status FdInputStream::read_at_fully_batch(const std::vector<ReadRequest>& requests) {
+    CHECK_IS_CLOSED(_is_closed);
+    if (requests.size() > 1 && config::enable_io_uring) {
+        if (auto* ring = IoUring::thread_local_instance(); ring != nullptr) {
+            return ring->read_fully(_fd, requests.data(), requests.size());
+        }
+    }
+    return SeekableInputStream::read_at_fully_batch(requests);
+}
+
 StatusOr<int64_t> FdInputStream::get_size() {
     CHECK_IS_CLOSED(_is_closed);
     struct stat st;
@@ -22,6 +22,10 @@ public:
 
     StatusOr<int64_t> get_size() override;
 
+    // Submit the reads by the io_uring of the calling thread if `config::enable_io_uring` is true,
+    // otherwise or if io_uring is not available, fall back to pread one by one.
+    Status read_at_fully_batch(const std::vector<ReadRequest>& requests) override;
+
     StatusOr<int64_t> position() override { return _offset; }
 
     Status seek(int64_t offset) override;
@@ -0,0 +1,247 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "io/io_uring.h"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "common/logging.h"
+#include "gutil/macros.h"
+#include "io/io_error.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define STARROCKS_HAVE_IO_URING 1
+#endif
+
+namespace starrocks::io {
+
+// pread |count| bytes at |offset| fully.
+static Status pread_fully(int fd, char* data, int64_t count, int64_t offset) {
+    while (count > 0) {
+        ssize_t res;
+        RETRY_ON_EINTR(res, ::pread(fd, data, count, offset));
+        if (UNLIKELY(res < 0)) {
+            return io_error("pread", errno);
+        }
+        if (res == 0) {
+            return Status::IOError("cannot read fully");
+        }
+        data += res;
+        count -= res;
+        offset += res;
+    }
+    return Status::OK();
+}
+
+#ifdef STARROCKS_HAVE_IO_URING
+
+static constexpr uint32_t kRingEntries = 64;
+
+// Set once io_uring_setup fails for the kernel or the permission, so the other threads don't retry.
+static std::atomic<bool> s_io_uring_unavailable{false};
+
+IoUring* IoUring::thread_local_instance() {
+    thread_local std::unique_ptr<IoUring> t_ring;
+    thread_local bool t_initialized = false;
+    if (!t_initialized && !s_io_uring_unavailable.load(std::memory_order_relaxed)) {
+        t_initialized = true;
+        std::unique_ptr<IoUring> ring(new IoUring());
+        if (ring->_init(kRingEntries)) {
+            t_ring = std::move(ring);
+        }
+    }
+    return t_ring.get();
+}
+
+bool IoUring::_init(uint32_t entries) {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0) {
+        int err = errno;
+        if (err == ENOSYS || err == EPERM || err == EACCES) {
+            if (!s_io_uring_unavailable.exchange(true)) {
+                LOG(WARNING) << "io_uring is not available, fall back to pread: " << std::strerror(err);
+            }
+        }
+        return false;
+    }
+    _ring_fd = fd;
+    _sq_entries = params.sq_entries;
+
+    _sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    _cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        _sq_ring_size = _cq_ring_size = std::max(_sq_ring_size, _cq_ring_size);
+    }
+
+    void* ptr = ::mmap(nullptr, _sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                       IORING_OFF_SQ_RING);
+    if (ptr == MAP_FAILED) {
+        return false;
+    }
+    _sq_ptr = ptr;
+    if (single_mmap) {
+        _cq_ptr = _sq_ptr;
+    } else {
+        ptr = ::mmap(nullptr, _cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                     IORING_OFF_CQ_RING);
+        if (ptr == MAP_FAILED) {
+            return false;
+        }
+        _cq_ptr = ptr;
+    }
+    _sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    ptr = ::mmap(nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (ptr == MAP_FAILED) {
+        return false;
+    }
+    _sqes = ptr;
+
+    auto* sq = static_cast<char*>(_sq_ptr);
+    _sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    _sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    _sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    _sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    auto* cq = static_cast<char*>(_cq_ptr);
+    _cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    _cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    _cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    _cqes = cq + params.cq_off.cqes;
+    return true;
+}
+
+IoUring::~IoUring() {
+    if (_sqes != nullptr) {
+        ::munmap(_sqes, _sqes_size);
+    }
+    if (_cq_ptr != nullptr && _cq_ptr != _sq_ptr) {
+        ::munmap(_cq_ptr, _cq_ring_size);
+    }
+    if (_sq_ptr != nullptr) {
+        ::munmap(_sq_ptr, _sq_ring_size);
+    }
+    if (_ring_fd >= 0) {
+        ::close(_ring_fd);
+    }
+}
+
+Status IoUring::_submit_and_wait(int fd, const ReadRequest* requests, size_t num_requests) {
+    DCHECK_LE(num_requests, _sq_entries);
+    std::vector<iovec> iovs(num_requests);
+    std::vector<int64_t> results(num_requests, 0);
+
+    // Only this thread produces the submission queue.
+    unsigned tail = *_sq_tail;
+    for (size_t i = 0; i < num_requests; i++) {
+        unsigned index = tail & *_sq_mask;
+        auto* sqe = static_cast<io_uring_sqe*>(_sqes) + index;
+        memset(sqe, 0, sizeof(*sqe));
+        iovs[i].iov_base = requests[i].data;
+        iovs[i].iov_len = requests[i].count;
+        // IORING_OP_READV is supported since the first version of io_uring.
+        sqe->opcode = IORING_OP_READV;
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<uint64_t>(&iovs[i]);
+        sqe->len = 1;
+        sqe->off = requests[i].offset;
+        sqe->user_data = i;
+        _sq_array[index] = index;
+        tail++;
+    }
+    __atomic_store_n(_sq_tail, tail, __ATOMIC_RELEASE);
+
+    Status st;
+    size_t num_to_submit = num_requests;
+    size_t submitted = 0;
+    size_t completed = 0;
+    while (submitted < num_to_submit || completed < submitted) {
+        int ret = static_cast<int>(::syscall(__NR_io_uring_enter, _ring_fd, num_to_submit - submitted, 1,
+                                             IORING_ENTER_GETEVENTS, nullptr, 0));
+        if (ret < 0) {
+            int err = errno;
+            if (err != EINTR && err != EAGAIN && err != EBUSY) {
+                if (submitted < num_to_submit) {
+                    // Drop the requests not consumed by the kernel, and wait for the in-flight ones,
+                    // whose buffers are still written.
+                    __atomic_store_n(_sq_tail, __atomic_load_n(_sq_head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+                    num_to_submit = submitted;
+                }
+                st = io_error("io_uring_enter", err);
+            }
+        } else {
+            submitted += ret;
+        }
+
+        unsigned head = *_cq_head;
+        while (head != __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE)) {
+            const auto* cqe = static_cast<const io_uring_cqe*>(_cqes) + (head & *_cq_mask);
+            results[cqe->user_data] = cqe->res;
+            head++;
+            completed++;
+        }
+        __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+    }
+    RETURN_IF_ERROR(st);
+
+    for (size_t i = 0; i < num_requests; i++) {
+        const auto& req = requests[i];
+        int64_t res = results[i];
+        if (res < 0) {
+            // The file doesn't support io_uring reads, e.g. some FUSE file systems.
+            if (res != -EINVAL && res != -EOPNOTSUPP) {
+                return io_error("io_uring read", static_cast<int>(-res));
+            }
+            res = 0;
+        }
+        if (res < req.count) {
+            // Complete the short read.
+            RETURN_IF_ERROR(pread_fully(fd, static_cast<char*>(req.data) + res, req.count - res, req.offset + res));
+        }
+    }
+    return Status::OK();
+}
+
+Status IoUring::read_fully(int fd, const ReadRequest* requests, size_t num_requests) {
+    for (size_t i = 0; i < num_requests; i += _sq_entries) {
+        RETURN_IF_ERROR(_submit_and_wait(fd, requests + i, std::min<size_t>(_sq_entries, num_requests - i)));
+    }
+    return Status::OK();
+}
+
+#else
+
+IoUring* IoUring::thread_local_instance() {
+    return nullptr;
+}
+
+bool IoUring::_init(uint32_t entries) {
+    return false;
+}
+
+IoUring::~IoUring() = default;
+
+Status IoUring::_submit_and_wait(int fd, const ReadRequest* requests, size_t num_requests) {
+    return Status::NotSupported("io_uring is not supported");
+}
+
+Status IoUring::read_fully(int fd, const ReadRequest* requests, size_t num_requests) {
+    for (size_t i = 0; i < num_requests; i++) {
+        RETURN_IF_ERROR(pread_fully(fd, static_cast<char*>(requests[i].data), requests[i].count, requests[i].offset));
+    }
+    return Status::OK();
+}
+
+#endif
+
+} // namespace starrocks::io
@@ -0,0 +1,62 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "common/status.h"
+#include "io/seekable_input_stream.h"
+
+namespace starrocks::io {
+
+// IoUring submits a batch of reads of the calling thread to the kernel at once by io_uring, so a scan
+// thread keeps many outstanding reads on the device without more threads. The syscalls are used
+// directly, there is no liburing dependency.
+//
+// Each thread has its own ring, created at the first use. The ring is not available if the kernel
+// doesn't support io_uring or it's forbidden (e.g. by seccomp), the callers should fall back to pread.
+class IoUring {
+public:
+    // The ring of the calling thread, nullptr if io_uring is not available.
+    static IoUring* thread_local_instance();
+
+    ~IoUring();
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    // Read every request of |requests| fully from |fd|, like `pread` in loop.
+    // Returns IOError if a request reaches the end of file.
+    Status read_fully(int fd, const ReadRequest* requests, size_t num_requests);
+
+private:
+    IoUring() = default;
+
+    // Returns false if io_uring is not available.
+    bool _init(uint32_t entries);
+
+    // Submit the reads of |requests| and wait for all of them, |num_requests| <= _sq_entries.
+    Status _submit_and_wait(int fd, const ReadRequest* requests, size_t num_requests);
+
+    int _ring_fd = -1;
+
+    void* _sq_ptr = nullptr;
+    size_t _sq_ring_size = 0;
+    void* _cq_ptr = nullptr;
+    size_t _cq_ring_size = 0;
+    void* _sqes = nullptr;
+    size_t _sqes_size = 0;
+
+    uint32_t _sq_entries = 0;
+    unsigned* _sq_head = nullptr;
+    unsigned* _sq_tail = nullptr;
+    unsigned* _sq_mask = nullptr;
+    unsigned* _sq_array = nullptr;
+    unsigned* _cq_head = nullptr;
+    unsigned* _cq_tail = nullptr;
+    unsigned* _cq_mask = nullptr;
+    void* _cqes = nullptr;
+};
+
+} // namespace starrocks::io
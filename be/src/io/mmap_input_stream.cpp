@@ -0,0 +1,109 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "io/mmap_input_stream.h"
+
+#include <fmt/format.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/logging.h"
+#include "io/io_error.h"
+#include "runtime/mem_tracker.h"
+
+namespace starrocks::io {
+
+StatusOr<std::unique_ptr<MmapInputStream>> MmapInputStream::open(int fd, MemTracker* mem_tracker) {
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        return io_error("fstat", errno);
+    }
+    char* data = nullptr;
+    if (st.st_size > 0) {
+        // Private and writable, so that a reader writing to a page by mistake gets a copy of it rather than
+        // a segmentation fault, the file is never changed.
+        void* ptr = ::mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (ptr == MAP_FAILED) {
+            return io_error("mmap", errno);
+        }
+        data = static_cast<char*>(ptr);
+        if (mem_tracker != nullptr) {
+            mem_tracker->consume(st.st_size);
+        }
+    }
+    return std::unique_ptr<MmapInputStream>(new MmapInputStream(data, st.st_size, mem_tracker));
+}
+
+MmapInputStream::~MmapInputStream() {
+    if (_data == nullptr) {
+        return;
+    }
+    if (::munmap(_data, _size) != 0) {
+        PLOG(ERROR) << "munmap() failed";
+    }
+    if (_mem_tracker != nullptr) {
+        _mem_tracker->release(_size);
+    }
+}
+
+StatusOr<int64_t> MmapInputStream::read(void* data, int64_t count) {
+    ASSIGN_OR_RETURN(auto n, read_at(_offset, data, count));
+    _offset += n;
+    return n;
+}
+
+StatusOr<int64_t> MmapInputStream::read_at(int64_t offset, void* out, int64_t count) {
+    if (offset < 0 || count < 0) {
+        return Status::InvalidArgument(fmt::format("Invalid offset {} or count {}", offset, count));
+    }
+    if (offset >= _size) {
+        return 0;
+    }
+    int64_t n = std::min(count, _size - offset);
+    memcpy(out, _data + offset, n);
+    return n;
+}
+
+Status MmapInputStream::read_at_fully_batch(const std::vector<ReadRequest>& requests) {
+    for (const auto& r : requests) {
+        will_need(r.offset, r.count);
+    }
+    return SeekableInputStream::read_at_fully_batch(requests);
+}
+
+StatusOr<std::string_view> MmapInputStream::peek(int64_t nbytes) {
+    int64_t n = std::max<int64_t>(std::min(_size - _offset, nbytes), 0);
+    return std::string_view(_data + _offset, n);
+}
+
+StatusOr<std::string_view> MmapInputStream::peek_at(int64_t offset, int64_t count) {
+    if (offset < 0 || count < 0 || offset + count > _size) {
+        return Status::EndOfFile(fmt::format("Invalid range [{}, {}) of the file of {} bytes", offset,
+                                             offset + count, _size));
+    }
+    return std::string_view(_data + offset, count);
+}
+
+void MmapInputStream::will_need(int64_t offset, int64_t count) {
+    if (offset < 0 || count <= 0 || offset >= _size) {
+        return;
+    }
+    // madvise() requires the address aligned to the page.
+    static const int64_t kPageSize = ::sysconf(_SC_PAGESIZE);
+    int64_t begin = offset / kPageSize * kPageSize;
+    int64_t end = std::min(offset + count, _size);
+    if (::madvise(_data + begin, end - begin, MADV_WILLNEED) != 0) {
+        VLOG(3) << "fail to madvise will need, errno=" << errno;
+    }
+}
+
+Status MmapInputStream::seek(int64_t offset) {
+    if (offset < 0) return Status::InvalidArgument(fmt::format("Invalid offset {}", offset));
+    _offset = offset;
+    return Status::OK();
+}
+
+} // namespace starrocks::io
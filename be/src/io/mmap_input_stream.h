@@ -0,0 +1,67 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <memory>
+
+#include "io/seekable_input_stream.h"
+
+namespace starrocks {
+class MemTracker;
+} // namespace starrocks
+
+namespace starrocks::io {
+
+// A RandomAccessFile which reads from a file mapped into memory. It supports the zero-copy reads by `peek_at()`,
+// whose views are valid as long as the stream, so the hot files are read from the OS page cache directly
+// instead of being copied into the buffers of the readers.
+class MmapInputStream : public SeekableInputStream {
+public:
+    // Map the whole file of |fd|, which may be closed once this returns. The mapped bytes are consumed from
+    // |mem_tracker| until the stream is destroyed, if it's not nullptr.
+    static StatusOr<std::unique_ptr<MmapInputStream>> open(int fd, MemTracker* mem_tracker);
+
+    ~MmapInputStream() override;
+
+    MmapInputStream(const MmapInputStream&) = delete;
+    MmapInputStream(MmapInputStream&&) = delete;
+    void operator=(const MmapInputStream&) = delete;
+    void operator=(MmapInputStream&&) = delete;
+
+    StatusOr<int64_t> read(void* data, int64_t count) override;
+
+    // Not changing the position, so it's safe to be called concurrently.
+    StatusOr<int64_t> read_at(int64_t offset, void* out, int64_t count) override;
+
+    // Advise the kernel to read ahead all the requests before copying them one by one.
+    Status read_at_fully_batch(const std::vector<ReadRequest>& requests) override;
+
+    bool allows_peek() const override { return true; }
+
+    StatusOr<std::string_view> peek(int64_t nbytes) override;
+
+    bool allows_peek_at() const override { return true; }
+
+    StatusOr<std::string_view> peek_at(int64_t offset, int64_t count) override;
+
+    // madvise(MADV_WILLNEED) of the range.
+    void will_need(int64_t offset, int64_t count) override;
+
+    StatusOr<int64_t> get_size() override { return _size; }
+
+    StatusOr<int64_t> position() override { return _offset; }
+
+    Status seek(int64_t offset) override;
+
+private:
+    MmapInputStream(char* data, int64_t size, MemTracker* mem_tracker)
+            : _data(data), _size(size), _offset(0), _mem_tracker(mem_tracker) {}
+
+    // nullptr if the file is empty.
+    char* _data;
+    int64_t _size;
+    int64_t _offset;
+    MemTracker* _mem_tracker;
+};
+
+} // namespace starrocks::io
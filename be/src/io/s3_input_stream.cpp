@@ -8,6 +8,12 @@
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <fmt/format.h>
 
+#include <algorithm>
+
+#include "common/config.h"
+#include "util/countdown_latch.h"
+#include "util/threadpool.h"
+
 namespace starrocks::io {
 
 inline Status make_error_status(const Aws::S3::S3Error& error) {
@@ -49,6 +55,83 @@ StatusOr<int64_t> S3InputStream::position() {
     return _offset;
 }
 
+// The pool issuing the GETs of the batch reads in parallel, which mostly wait for the network.
+static ThreadPool* batch_read_pool() {
+    static std::unique_ptr<ThreadPool> pool = []() {
+        std::unique_ptr<ThreadPool> p;
+        auto st = ThreadPoolBuilder("s3_batch_read")
+                          .set_min_threads(0)
+                          .set_max_threads(std::max(1, config::s3_batch_read_threads))
+                          .set_max_queue_size(1024)
+                          .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                          .build(&p);
+        LOG_IF(WARNING, !st.ok()) << "Fail to create s3_batch_read pool: " << st;
+        return p;
+    }();
+    return pool.get();
+}
+
+Status S3InputStream::read_coalesced(const std::vector<ReadRequest>& requests, const CoalescedRead& read) {
+    if (read.count <= 0) {
+        return Status::OK();
+    }
+    Aws::S3::Model::GetObjectRequest request;
+    request.SetBucket(_bucket);
+    request.SetKey(_object);
+    request.SetRange(fmt::format("bytes={}-{}", read.offset, read.offset + read.count - 1));
+
+    Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
+    if (!outcome.IsSuccess()) {
+        return make_error_status(outcome.GetError());
+    }
+    Aws::IOStream& body = outcome.GetResult().GetBody();
+    int64_t pos = read.offset;
+    for (size_t i = read.begin; i < read.end; i++) {
+        const auto& r = requests[i];
+        if (r.offset > pos) {
+            body.ignore(r.offset - pos);
+        }
+        body.read(static_cast<char*>(r.data), r.count);
+        if (body.gcount() != r.count) {
+            return Status::IOError(fmt::format("cannot read fully {} bytes of {}/{} at offset {}", r.count, _bucket,
+                                               _object, r.offset));
+        }
+        pos = r.offset + r.count;
+    }
+    return Status::OK();
+}
+
+Status S3InputStream::read_at_fully_batch(const std::vector<ReadRequest>& requests) {
+    if (requests.size() <= 1) {
+        return SeekableInputStream::read_at_fully_batch(requests);
+    }
+    std::vector<ReadRequest> sorted(requests);
+    std::sort(sorted.begin(), sorted.end(), [](const ReadRequest& a, const ReadRequest& b) {
+        return a.offset < b.offset;
+    });
+    auto reads = coalesce_reads(sorted, config::s3_coalesce_read_max_gap_bytes, config::s3_coalesce_read_max_bytes);
+
+    // The first read is issued by the current thread, the others are issued by the pool if possible.
+    std::vector<Status> statuses(reads.size());
+    CountDownLatch latch(reads.size() - 1);
+    auto* pool = batch_read_pool();
+    for (size_t i = 1; i < reads.size(); i++) {
+        auto task = [&, i]() {
+            statuses[i] = read_coalesced(sorted, reads[i]);
+            latch.count_down();
+        };
+        if (pool == nullptr || !pool->submit_func(task).ok()) {
+            task();
+        }
+    }
+    statuses[0] = read_coalesced(sorted, reads[0]);
+    latch.wait();
+    for (auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
 StatusOr<int64_t> S3InputStream::get_size() {
     if (_size == -1) {
         Aws::S3::Model::HeadObjectRequest request;
@@ -40,7 +40,15 @@ public:
 
     StatusOr<int64_t> get_size() override;
 
+    // The requests are coalesced by `coalesce_reads()`, with config::s3_coalesce_read_max_gap_bytes and
+    // config::s3_coalesce_read_max_bytes, and the coalesced reads are issued in parallel. The data are
+    // read into the buffers of the requests with the gaps skipped, i.e. without an extra copy.
+    Status read_at_fully_batch(const std::vector<ReadRequest>& requests) override;
+
 private:
+    // Read the requests [read.begin, read.end) of |requests| by one GET.
+    Status read_coalesced(const std::vector<ReadRequest>& requests, const CoalescedRead& read);
+
     std::shared_ptr<Aws::S3::S3Client> _s3client;
     std::string _bucket;
     std::string _object;
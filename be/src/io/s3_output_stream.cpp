@@ -9,23 +9,45 @@
 #include <aws/s3/model/UploadPartRequest.h>
 #include <fmt/format.h>
 
+#include "common/config.h"
 #include "common/logging.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
+// The pool uploading the parts of the multipart uploads in the background.
+static ThreadPool* upload_pool() {
+    static std::unique_ptr<ThreadPool> pool = []() {
+        std::unique_ptr<ThreadPool> p;
+        auto st = ThreadPoolBuilder("s3_upload")
+                          .set_min_threads(0)
+                          .set_max_threads(std::max(1, config::s3_upload_threads))
+                          .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                          .build(&p);
+        LOG_IF(WARNING, !st.ok()) << "Fail to create s3_upload pool: " << st;
+        return p;
+    }();
+    return pool.get();
+}
+
 S3OutputStream::S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::string bucket, std::string object,
-                               int64_t max_single_part_size, int64_t min_upload_part_size)
+                               int64_t max_single_part_size, int64_t min_upload_part_size, int max_concurrent_parts)
         : _client(std::move(client)),
           _bucket(std::move(bucket)),
           _object(std::move(object)),
           _max_single_part_size(max_single_part_size),
           _min_upload_part_size(min_upload_part_size),
+          _max_concurrent_parts(max_concurrent_parts),
           _buffer(),
           _upload_id(),
           _etags() {
     CHECK(_client != nullptr);
 }
 
+S3OutputStream::~S3OutputStream() {
+    (void)wait_for_parts(1);
+}
+
 Status S3OutputStream::write(const void* data, int64_t size) {
     _buffer.append(static_cast<const char*>(data), size);
     if (_upload_id.empty() && _buffer.size() > _max_single_part_size) {
@@ -68,6 +90,7 @@ Status S3OutputStream::close() {
         RETURN_IF_ERROR(singlepart_upload());
     } else {
         RETURN_IF_ERROR(multipart_upload());
+        RETURN_IF_ERROR(wait_for_parts(1));
         RETURN_IF_ERROR(complete_multipart_upload());
     }
     _client = nullptr;
@@ -110,22 +133,59 @@ Status S3OutputStream::multipart_upload() {
     if (_buffer.empty()) {
         return Status::OK();
     }
+    // Back pressure on the memory of the parts in flight.
+    RETURN_IF_ERROR(wait_for_parts(_max_concurrent_parts));
+    const int64_t size = static_cast<int64_t>(_buffer.size());
+    auto body = std::make_shared<Aws::StringStream>(_buffer);
+    _buffer.clear();
+    int part_number;
+    {
+        std::lock_guard l(_lock);
+        _etags.emplace_back();
+        part_number = static_cast<int>(_etags.size());
+        _inflight_parts++;
+    }
+    auto* pool = _max_concurrent_parts > 1 ? upload_pool() : nullptr;
+    auto task = [this, part_number, body, size]() {
+        auto st = upload_part(part_number, body, size);
+        std::lock_guard l(_lock);
+        if (!st.ok() && _upload_status.ok()) {
+            _upload_status = st;
+        }
+        _inflight_parts--;
+        _cond.notify_all();
+    };
+    if (pool == nullptr || !pool->submit_func(task).ok()) {
+        task();
+    }
+    std::lock_guard l(_lock);
+    return _upload_status;
+}
+
+Status S3OutputStream::upload_part(int part_number, const std::shared_ptr<Aws::StringStream>& body, int64_t size) {
     Aws::S3::Model::UploadPartRequest req;
     req.SetBucket(_bucket);
     req.SetKey(_object);
-    req.SetPartNumber(static_cast<int>(_etags.size() + 1));
+    req.SetPartNumber(part_number);
     req.SetUploadId(_upload_id);
-    req.SetContentLength(static_cast<int64_t>(_buffer.size()));
-    req.SetBody(std::make_shared<Aws::StringStream>(_buffer));
+    req.SetContentLength(size);
+    req.SetBody(body);
     auto outcome = _client->UploadPart(req);
     if (outcome.IsSuccess()) {
-        _etags.push_back(outcome.GetResult().GetETag());
+        std::lock_guard l(_lock);
+        _etags[part_number - 1] = outcome.GetResult().GetETag();
         return Status::OK();
     }
     return Status::IOError(
             fmt::format("S3: Fail to upload part of {}/{}: {}", _bucket, _object, outcome.GetError().GetMessage()));
 }
 
+Status S3OutputStream::wait_for_parts(int max_parts) {
+    std::unique_lock l(_lock);
+    _cond.wait(l, [&]() { return _inflight_parts < std::max(1, max_parts); });
+    return _upload_status;
+}
+
 Status S3OutputStream::complete_multipart_upload() {
     VLOG(12) << "Completing multipart upload s3://" << _bucket << "/" << _object;
     DCHECK(!_upload_id.empty());
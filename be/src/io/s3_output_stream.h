@@ -4,16 +4,25 @@
 
 #include <aws/s3/S3Client.h>
 
+#include <condition_variable>
+#include <mutex>
+
 #include "io/output_stream.h"
 
 namespace starrocks::io {
 
+// The parts of a multipart upload are uploaded in the background while the following data is written, and at
+// most |max_concurrent_parts| parts are in flight, i.e. a `write()` blocks until the buffered parts are less
+// than it. So the memory of a stream is bounded by about max_concurrent_parts * min_upload_part_size.
+// A |max_concurrent_parts| not greater than 1 means uploading the parts synchronously.
 class S3OutputStream : public OutputStream {
 public:
     explicit S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::string bucket, std::string object,
-                            int64_t max_single_part_size, int64_t min_upload_part_size);
+                            int64_t max_single_part_size, int64_t min_upload_part_size,
+                            int max_concurrent_parts = 1);
 
-    ~S3OutputStream() override = default;
+    // Wait for the parts in flight, without completing the upload.
+    ~S3OutputStream() override;
 
     // Disallow copy and assignment
     S3OutputStream(const S3OutputStream&) = delete;
@@ -42,15 +51,26 @@ private:
     Status multipart_upload();
     Status singlepart_upload();
     Status complete_multipart_upload();
+    Status upload_part(int part_number, const std::shared_ptr<Aws::StringStream>& body, int64_t size);
+    // Wait until the parts in flight are less than |max_parts|, and returns the error of the finished parts.
+    Status wait_for_parts(int max_parts);
 
     std::shared_ptr<Aws::S3::S3Client> _client;
     const Aws::String _bucket;
     const Aws::String _object;
     const int64_t _max_single_part_size;
     const int64_t _min_upload_part_size;
+    const int _max_concurrent_parts;
     Aws::String _buffer;
     Aws::String _upload_id;
+
+    // Protects the following members, which are updated by the parts uploaded in the background.
+    std::mutex _lock;
+    std::condition_variable _cond;
+    // Indexed by part number - 1.
     std::vector<Aws::String> _etags;
+    int _inflight_parts = 0;
+    Status _upload_status;
 };
 
 } // namespace starrocks::io
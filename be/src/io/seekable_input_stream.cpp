@@ -16,6 +16,33 @@ Status SeekableInputStream::read_at_fully(int64_t offset, void* data, int64_t co
     return read_fully(data, count);
 }
 
+Status SeekableInputStream::read_at_fully_batch(const std::vector<ReadRequest>& requests) {
+    for (const auto& r : requests) {
+        RETURN_IF_ERROR(read_at_fully(r.offset, r.data, r.count));
+    }
+    return Status::OK();
+}
+
+std::vector<CoalescedRead> coalesce_reads(const std::vector<ReadRequest>& requests, int64_t max_gap,
+                                          int64_t max_size) {
+    std::vector<CoalescedRead> reads;
+    for (size_t i = 0; i < requests.size(); i++) {
+        const auto& r = requests[i];
+        if (!reads.empty()) {
+            auto& last = reads.back();
+            const int64_t last_end = last.offset + last.count;
+            const int64_t gap = r.offset - last_end;
+            if (gap >= 0 && gap <= max_gap && r.offset + r.count - last.offset <= max_size) {
+                last.count = r.offset + r.count - last.offset;
+                last.end = i + 1;
+                continue;
+            }
+        }
+        reads.push_back({r.offset, r.count, i, i + 1});
+    }
+    return reads;
+}
+
 Status SeekableInputStream::skip(int64_t count) {
     ASSIGN_OR_RETURN(auto pos, position());
     return seek(pos + count);
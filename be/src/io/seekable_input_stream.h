@@ -2,10 +2,33 @@
 
 #pragma once
 
+#include <vector>
+
 #include "io/input_stream.h"
 
 namespace starrocks::io {
 
+// A read of |count| bytes at |offset| into |data|.
+struct ReadRequest {
+    int64_t offset;
+    void* data;
+    int64_t count;
+};
+
+// A read covering the requests [begin, end) of a batch, including the gaps between them.
+struct CoalescedRead {
+    int64_t offset;
+    int64_t count;
+    size_t begin;
+    size_t end;
+};
+
+// Merge the adjacent |requests|, which are sorted by offset, into the reads whose gaps between the requests
+// are at most |max_gap| bytes, and whose sizes are at most |max_size| bytes unless a single request is larger.
+// The overlapped requests are never merged.
+std::vector<CoalescedRead> coalesce_reads(const std::vector<ReadRequest>& requests, int64_t max_gap,
+                                          int64_t max_size);
+
 class SeekableInputStream : public InputStream {
 public:
     ~SeekableInputStream() override = default;
@@ -45,6 +68,34 @@ public:
     // ```
     virtual Status read_at_fully(int64_t offset, void* out, int64_t count);
 
+    // Read every request of |requests| fully like `read_at_fully`, the implementation may issue
+    // them concurrently. If an error is returned, the content of all the |data| buffers is unspecified.
+    // The position of the stream is unspecified after this call.
+    //
+    // Default implementation:
+    // ```
+    //    for (const auto& r : requests) {
+    //        RETURN_IF_ERROR(read_at_fully(r.offset, r.data, r.count));
+    //    }
+    //    return Status::OK();
+    // ```
+    virtual Status read_at_fully_batch(const std::vector<ReadRequest>& requests);
+
+    // Returns true if the stream supports `peek_at()`, e.g. a file mapped into memory.
+    virtual bool allows_peek_at() const { return false; }
+
+    // Return a zero-copy view of the |count| bytes at |offset|, which is valid as long as the stream, unlike
+    // `peek()`. Do not modify the position of the stream.
+    //
+    // Returns an error if the range is out of the stream, or NotSupported if `allows_peek_at()` is false.
+    virtual StatusOr<std::string_view> peek_at(int64_t offset, int64_t count) {
+        return Status::NotSupported("SeekableInputStream::peek_at");
+    }
+
+    // Hint that the |count| bytes at |offset| will be read soon, so that the implementation may prefetch them.
+    // Does nothing by default.
+    virtual void will_need(int64_t offset, int64_t count) {}
+
     // Return the total file size in bytes, or error.
     virtual StatusOr<int64_t> get_size() = 0;
 
@@ -98,6 +149,18 @@ public:
         return _impl->read_at_fully(offset, out, count);
     }
 
+    Status read_at_fully_batch(const std::vector<ReadRequest>& requests) override {
+        return _impl->read_at_fully_batch(requests);
+    }
+
+    bool allows_peek_at() const override { return _impl->allows_peek_at(); }
+
+    StatusOr<std::string_view> peek_at(int64_t offset, int64_t count) override {
+        return _impl->peek_at(offset, count);
+    }
+
+    void will_need(int64_t offset, int64_t count) override { _impl->will_need(offset, count); }
+
     StatusOr<int64_t> get_size() override { return _impl->get_size(); }
 
     Status seek(int64_t offset) override { return _impl->seek(offset); }
@@ -0,0 +1,116 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "runtime/arrow_result_writer.h"
+
+#include <arrow/memory_pool.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+
+#include "column/chunk.h"
+#include "exprs/expr.h"
+#include "gen_cpp/InternalService_types.h"
+#include "runtime/buffer_control_block.h"
+#include "runtime/current_thread.h"
+#include "util/arrow/row_batch.h"
+#include "util/arrow/starrocks_column_to_arrow.h"
+
+namespace starrocks {
+
+ArrowResultWriter::ArrowResultWriter(BufferControlBlock* sinker, const std::vector<ExprContext*>& output_expr_ctxs,
+                                     RuntimeProfile* parent_profile)
+        : _sinker(sinker), _output_expr_ctxs(output_expr_ctxs), _parent_profile(parent_profile) {}
+
+ArrowResultWriter::~ArrowResultWriter() = default;
+
+Status ArrowResultWriter::init(RuntimeState* state) {
+    _init_profile();
+    if (nullptr == _sinker) {
+        return Status::InternalError("sinker is NULL pointer.");
+    }
+    return convert_to_arrow_schema(_output_expr_ctxs, &_arrow_schema);
+}
+
+void ArrowResultWriter::_init_profile() {
+    _append_chunk_timer = ADD_TIMER(_parent_profile, "AppendChunkTime");
+    _convert_batch_timer = ADD_CHILD_TIMER(_parent_profile, "ArrowConvertTime", "AppendChunkTime");
+    _serialize_batch_timer = ADD_CHILD_TIMER(_parent_profile, "ArrowSerializeTime", "AppendChunkTime");
+    _result_send_timer = ADD_CHILD_TIMER(_parent_profile, "ResultSendTime", "AppendChunkTime");
+    _sent_rows_counter = ADD_COUNTER(_parent_profile, "NumSentRows", TUnit::UNIT);
+    _sent_bytes_counter = ADD_COUNTER(_parent_profile, "NumSentBytes", TUnit::BYTES);
+}
+
+StatusOr<TFetchDataResultPtr> ArrowResultWriter::_process_chunk(vectorized::Chunk* chunk) {
+    SCOPED_TIMER(_append_chunk_timer);
+    std::shared_ptr<arrow::RecordBatch> record_batch;
+    {
+        SCOPED_TIMER(_convert_batch_timer);
+        RETURN_IF_ERROR(vectorized::convert_chunk_to_arrow_batch(chunk, _output_expr_ctxs, _arrow_schema,
+                                                                 arrow::default_memory_pool(), &record_batch));
+    }
+
+    auto result = std::make_unique<TFetchDataResult>();
+    auto& result_rows = result->result_batch.rows;
+    result_rows.resize(1);
+    {
+        SCOPED_TIMER(_serialize_batch_timer);
+        RETURN_IF_ERROR(serialize_record_batch(*record_batch, &result_rows[0]));
+    }
+    COUNTER_UPDATE(_sent_bytes_counter, result_rows[0].size());
+    return result;
+}
+
+Status ArrowResultWriter::append_chunk(vectorized::Chunk* chunk) {
+    if (nullptr == chunk || 0 == chunk->num_rows()) {
+        return Status::OK();
+    }
+    ASSIGN_OR_RETURN(auto result, _process_chunk(chunk));
+
+    SCOPED_TIMER(_result_send_timer);
+    auto status = _sinker->add_batch(result);
+    if (status.ok()) {
+        _written_rows += chunk->num_rows();
+    } else {
+        LOG(WARNING) << "append result batch to sink failed: status=" << status.to_string();
+    }
+    return status;
+}
+
+Status ArrowResultWriter::close() {
+    COUNTER_SET(_sent_rows_counter, _written_rows);
+    return Status::OK();
+}
+
+StatusOr<TFetchDataResultPtrs> ArrowResultWriter::process_chunk_for_pipeline(vectorized::Chunk* chunk) {
+    DCHECK_EQ(0, _num_pending_rows);
+    TFetchDataResultPtrs results;
+    if (nullptr == chunk || 0 == chunk->num_rows()) {
+        return results;
+    }
+
+    TRY_CATCH_ALLOC_SCOPE_START()
+    ASSIGN_OR_RETURN(auto result, _process_chunk(chunk));
+    results.emplace_back(std::move(result));
+    _num_pending_rows = chunk->num_rows();
+    TRY_CATCH_ALLOC_SCOPE_END()
+    return results;
+}
+
+StatusOr<bool> ArrowResultWriter::try_add_batch(TFetchDataResultPtrs& results) {
+    SCOPED_TIMER(_result_send_timer);
+    auto status = _sinker->try_add_batch(results);
+    if (status.ok()) {
+        // success in add result to ResultQueue of _sinker
+        if (status.value()) {
+            _written_rows += _num_pending_rows;
+            _num_pending_rows = 0;
+            results.clear();
+        }
+    } else {
+        _num_pending_rows = 0;
+        results.clear();
+        LOG(WARNING) << "Append result batch to sink failed: status=" << status.status().to_string();
+    }
+    return status;
+}
+
+} // namespace starrocks
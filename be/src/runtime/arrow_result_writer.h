@@ -0,0 +1,70 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "runtime/result_writer.h"
+#include "runtime/runtime_state.h"
+
+namespace arrow {
+class Schema;
+} // namespace arrow
+
+namespace starrocks {
+
+class ExprContext;
+class BufferControlBlock;
+class RuntimeProfile;
+
+// ArrowResultWriter sends the results as Arrow record batches instead of MySQL rows. Each chunk is converted
+// column by column into a record batch, which is serialized as a whole Arrow IPC stream, i.e. with its schema,
+// into the single row of a TFetchDataResult. So a client decodes every fetched batch on its own, and can fetch
+// the results of the fragment instances in parallel.
+class ArrowResultWriter final : public ResultWriter {
+public:
+    ArrowResultWriter(BufferControlBlock* sinker, const std::vector<ExprContext*>& output_expr_ctxs,
+                      RuntimeProfile* parent_profile);
+
+    ~ArrowResultWriter() override;
+
+    Status init(RuntimeState* state) override;
+
+    Status append_chunk(vectorized::Chunk* chunk) override;
+
+    Status close() override;
+
+    StatusOr<TFetchDataResultPtrs> process_chunk_for_pipeline(vectorized::Chunk* chunk) override;
+
+    StatusOr<bool> try_add_batch(TFetchDataResultPtrs& results) override;
+
+private:
+    void _init_profile();
+
+    StatusOr<TFetchDataResultPtr> _process_chunk(vectorized::Chunk* chunk);
+
+    BufferControlBlock* _sinker;
+    std::vector<ExprContext*> _output_expr_ctxs;
+    std::shared_ptr<arrow::Schema> _arrow_schema;
+
+    RuntimeProfile* _parent_profile; // parent profile from result sink. not owned
+    // total time cost on append chunk operation
+    RuntimeProfile::Counter* _append_chunk_timer = nullptr;
+    // arrow convert timer, child timer of _append_chunk_timer
+    RuntimeProfile::Counter* _convert_batch_timer = nullptr;
+    // ipc serialize timer, child timer of _append_chunk_timer
+    RuntimeProfile::Counter* _serialize_batch_timer = nullptr;
+    // result send timer, child timer of _append_chunk_timer
+    RuntimeProfile::Counter* _result_send_timer = nullptr;
+    // number of sent rows
+    RuntimeProfile::Counter* _sent_rows_counter = nullptr;
+    // number of sent bytes
+    RuntimeProfile::Counter* _sent_bytes_counter = nullptr;
+
+    // the rows of the results returned by process_chunk_for_pipeline but not added yet. Unlike a MySQL
+    // result, an Arrow result has a single row for all the rows of a chunk.
+    int64_t _num_pending_rows = 0;
+};
+
+} // namespace starrocks
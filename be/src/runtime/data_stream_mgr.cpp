@@ -21,6 +21,7 @@
 
 #include "runtime/data_stream_mgr.h"
 
+#include <atomic>
 #include <iostream>
 #include <utility>
 
@@ -30,6 +31,7 @@
 #include "runtime/raw_value.h"
 #include "runtime/runtime_state.h"
 #include "util/starrocks_metrics.h"
+#include "util/time.h"
 
 namespace starrocks {
 
@@ -123,7 +125,66 @@ Status DataStreamMgr::transmit_data(const PTransmitDataParams* request, ::google
     return Status::OK();
 }
 
+namespace {
+// Shares the closure of one RPC among the requests batched into it, the closure is run when all of them are done.
+class BatchedRequestsClosure final : public ::google::protobuf::Closure {
+public:
+    BatchedRequestsClosure(::google::protobuf::Closure* done, int32_t refs) : _done(done), _refs(refs) {}
+
+    void Run() override {
+        if (_refs.fetch_sub(1) == 1) {
+            _done->Run();
+            delete this;
+        }
+    }
+
+    // Drop the reference of the caller. If nobody else holds the closure, the caller gets |done| back.
+    ::google::protobuf::Closure* release() {
+        int32_t expected = 1;
+        if (_refs.compare_exchange_strong(expected, 0)) {
+            auto* done = _done;
+            delete this;
+            return done;
+        }
+        Run();
+        return nullptr;
+    }
+
+private:
+    ::google::protobuf::Closure* _done;
+    std::atomic<int32_t> _refs;
+};
+} // namespace
+
 Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done) {
+    if (request.batched_requests_size() == 0 || done == nullptr || *done == nullptr) {
+        return _transmit_single_chunk_request(request, done);
+    }
+
+    // One reference for each request and one for the caller, which keeps |request| alive until all of them are
+    // processed.
+    auto* closure = new BatchedRequestsClosure(*done, request.batched_requests_size() + 2);
+    Status status;
+    auto transmit = [&](const PTransmitChunkParams& sub_request) {
+        ::google::protobuf::Closure* sub_done = closure;
+        Status st = _transmit_single_chunk_request(sub_request, &sub_done);
+        if (sub_done != nullptr) {
+            sub_done->Run();
+        }
+        if (!st.ok() && status.ok()) {
+            status = st;
+        }
+    };
+    transmit(request);
+    for (const auto& sub_request : request.batched_requests()) {
+        transmit(sub_request);
+    }
+    *done = closure->release();
+    return status;
+}
+
+Status DataStreamMgr::_transmit_single_chunk_request(const PTransmitChunkParams& request,
+                                                     ::google::protobuf::Closure** done) {
     const PUniqueId& finst_id = request.finst_id();
     // TODO(zc): Use PUniqueId directly
     // We can use PUniqueId directly, because old version StarRocks has already use
@@ -217,6 +278,55 @@ void DataStreamMgr::cancel(const TUniqueId& fragment_instance_id) {
     }
 }
 
+// How long a receiver finished early is remembered, which is long enough for its senders to send the next requests.
+static constexpr int64_t kFinishedEarlyRecvrKeepMs = 10 * 60 * 1000;
+
+void DataStreamMgr::mark_recvr_finished_early(const TUniqueId& fragment_instance_id, PlanNodeId node_id) {
+    uint32_t bucket = get_bucket(fragment_instance_id);
+    int64_t now_ms = MonotonicMillis();
+    std::lock_guard<Mutex> l(_lock[bucket]);
+    auto& finished_recvrs = _finished_early_recvrs[bucket];
+    for (auto iter = finished_recvrs.begin(); iter != finished_recvrs.end();) {
+        auto& node_recvrs = iter->second;
+        for (auto sub_iter = node_recvrs.begin(); sub_iter != node_recvrs.end();) {
+            if (sub_iter->second <= now_ms) {
+                node_recvrs.erase(sub_iter++);
+            } else {
+                ++sub_iter;
+            }
+        }
+        if (node_recvrs.empty()) {
+            finished_recvrs.erase(iter++);
+        } else {
+            ++iter;
+        }
+    }
+    finished_recvrs[fragment_instance_id][node_id] = now_ms + kFinishedEarlyRecvrKeepMs;
+}
+
+bool DataStreamMgr::is_recvr_finished_early(const TUniqueId& fragment_instance_id, PlanNodeId node_id) {
+    uint32_t bucket = get_bucket(fragment_instance_id);
+    std::lock_guard<Mutex> l(_lock[bucket]);
+    auto& finished_recvrs = _finished_early_recvrs[bucket];
+    auto iter = finished_recvrs.find(fragment_instance_id);
+    return iter != finished_recvrs.end() && iter->second.contains(node_id);
+}
+
+void DataStreamMgr::collect_finished_recvrs(const PTransmitChunkParams& request, PTransmitChunkResult* response) {
+    auto collect = [&](const PTransmitChunkParams& params) {
+        TUniqueId finst_id;
+        finst_id.hi = params.finst_id().hi();
+        finst_id.lo = params.finst_id().lo();
+        if (is_recvr_finished_early(finst_id, params.node_id())) {
+            *response->add_finished_finst_ids() = params.finst_id();
+        }
+    };
+    collect(request);
+    for (const auto& sub_request : request.batched_requests()) {
+        collect(sub_request);
+    }
+}
+
 void DataStreamMgr::prepare_pass_through_chunk_buffer(const TUniqueId& query_id) {
     _pass_through_chunk_buffer_manager.open_fragment_instance(query_id);
 }
@@ -92,16 +92,24 @@ public:
 
     Status transmit_data(const PTransmitDataParams* request, ::google::protobuf::Closure** done);
 
+    // The requests batched into |request| are transmitted too, and |done| is run after all of them are consumed.
     Status transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done);
     // Closes all receivers registered for fragment_instance_id immediately.
     void cancel(const TUniqueId& fragment_instance_id);
 
+    // Add the destinations of |request| and its batched requests whose receivers have finished early, see
+    // mark_recvr_finished_early(), to |response|.
+    void collect_finished_recvrs(const PTransmitChunkParams& request, PTransmitChunkResult* response);
+
     void prepare_pass_through_chunk_buffer(const TUniqueId& query_id);
     void destroy_pass_through_chunk_buffer(const TUniqueId& query_id);
     PassThroughChunkBuffer* get_pass_through_chunk_buffer(const TUniqueId& query_id);
 
 private:
     friend class DataStreamRecvr;
+
+    Status _transmit_single_chunk_request(const PTransmitChunkParams& request, ::google::protobuf::Closure** done);
+
     static const uint32_t BUCKET_NUM = 127;
 
     // protects all fields below
@@ -114,6 +122,9 @@ private:
     typedef phmap::flat_hash_map<PlanNodeId, std::shared_ptr<DataStreamRecvr>> RecvrMap;
     typedef phmap::flat_hash_map<TUniqueId, std::shared_ptr<RecvrMap>> StreamMap;
     StreamMap _receiver_map[BUCKET_NUM];
+    // The receivers finished early of each bucket, with the time in milliseconds when they are forgotten.
+    typedef phmap::flat_hash_map<PlanNodeId, int64_t> FinishedRecvrMap;
+    phmap::flat_hash_map<TUniqueId, FinishedRecvrMap> _finished_early_recvrs[BUCKET_NUM];
     std::atomic<uint32_t> _fragment_count{0};
     std::atomic<uint32_t> _receiver_count{0};
 
@@ -124,6 +135,11 @@ private:
     // Remove receiver block for fragment_instance_id/node_id from the map.
     Status deregister_recvr(const TUniqueId& fragment_instance_id, PlanNodeId node_id);
 
+    // Remember that the receiver of fragment_instance_id/node_id is closed while some senders are still sending,
+    // so that they are told to stop by the responses of their next requests.
+    void mark_recvr_finished_early(const TUniqueId& fragment_instance_id, PlanNodeId node_id);
+    bool is_recvr_finished_early(const TUniqueId& fragment_instance_id, PlanNodeId node_id);
+
     inline uint32_t get_bucket(const TUniqueId& fragment_instance_id);
 
     PassThroughChunkBufferManager _pass_through_chunk_buffer_manager;
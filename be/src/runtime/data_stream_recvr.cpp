@@ -32,7 +32,9 @@
 #include <utility>
 
 #include "column/chunk.h"
+#include "column/column_helper.h"
 #include "exec/sort_exec_exprs.h"
+#include "exec/vectorized/sorting/merge.h"
 #include "gen_cpp/data.pb.h"
 #include "runtime/current_thread.h"
 #include "runtime/data_stream_mgr.h"
@@ -90,30 +92,37 @@ Status DataStreamRecvr::create_merger_for_pipeline(RuntimeState* state, const So
                                                    const std::vector<bool>* is_asc,
                                                    const std::vector<bool>* is_null_first) {
     DCHECK(_is_merging);
-    _chunks_merger = std::make_unique<vectorized::SortedChunksMerger>(state, _keep_order);
-    vectorized::ChunkSuppliers chunk_suppliers;
-    for (SenderQueue* q : _sender_queues) {
-        // we willn't use chunk_supplier in pipeline.
-        auto f = [q](vectorized::Chunk** chunk) -> Status { return Status::OK(); };
-        chunk_suppliers.emplace_back(std::move(f));
-    }
-    vectorized::ChunkProbeSuppliers chunk_probe_suppliers;
-    for (SenderQueue* q : _sender_queues) {
-        // we use chunk_probe_supplier in pipeline.
-        auto f = [q](vectorized::Chunk** chunk) -> bool { return q->try_get_chunk(chunk); };
-        chunk_probe_suppliers.emplace_back(std::move(f));
-    }
-    vectorized::ChunkHasSuppliers chunk_has_suppliers;
-    for (SenderQueue* q : _sender_queues) {
-        // we use chunk_has_supplier in pipeline.
-        auto f = [q]() -> bool { return q->has_chunk(); };
-        chunk_has_suppliers.emplace_back(std::move(f));
+    DCHECK(_is_pipeline);
+    _cascade_merger = std::make_unique<vectorized::MergeCursorsCascade>();
+    _merged_chunk = std::make_unique<vectorized::ChunkSlice>();
+    _chunk_size = state->chunk_size();
+    _merge_timer = ADD_TIMER(_profile, "MergeSortedChunks");
+
+    std::vector<std::unique_ptr<vectorized::SimpleChunkSortCursor>> cursors;
+    cursors.reserve(_sender_queues.size());
+    for (int i = 0; i < _sender_queues.size(); i++) {
+        auto* q = static_cast<PipelineSenderQueue*>(_sender_queues[i]);
+        vectorized::ChunkProvider provider = [this, i, q](ChunkUniquePtr* out_chunk, bool* eos) -> bool {
+            // data ready
+            if (out_chunk == nullptr || eos == nullptr) {
+                return q->has_chunk();
+            }
+            vectorized::Chunk* chunk = nullptr;
+            if (q->try_get_chunk(&chunk)) {
+                out_chunk->reset(chunk);
+                return true;
+            }
+            // The chunks are enqueued before the sender is removed, so there are no more chunks once it's finished.
+            *eos = q->is_finished();
+            if (!*eos) {
+                _starved_senders.push_back(i);
+            }
+            return false;
+        };
+        cursors.push_back(std::make_unique<vectorized::SimpleChunkSortCursor>(std::move(provider),
+                                                                              &exprs->lhs_ordering_expr_ctxs()));
     }
-
-    RETURN_IF_ERROR(_chunks_merger->init_for_pipeline(chunk_suppliers, chunk_probe_suppliers, chunk_has_suppliers,
-                                                      &(exprs->lhs_ordering_expr_ctxs()), is_asc, is_null_first));
-    _chunks_merger->set_profile(_profile.get());
-    return Status::OK();
+    return _cascade_merger->init(vectorized::SortDescs(*is_asc, *is_null_first), std::move(cursors));
 }
 
 DataStreamRecvr::DataStreamRecvr(DataStreamMgr* stream_mgr, RuntimeState* runtime_state, const RowDescriptor& row_desc,
@@ -177,12 +186,47 @@ Status DataStreamRecvr::get_next(vectorized::ChunkPtr* chunk, bool* eos) {
 }
 
 Status DataStreamRecvr::get_next_for_pipeline(vectorized::ChunkPtr* chunk, std::atomic<bool>* eos, bool* should_exit) {
-    DCHECK(_chunks_merger.get() != nullptr);
-    return _chunks_merger->get_next_for_pipeline(chunk, eos, should_exit);
+    DCHECK(_cascade_merger != nullptr);
+    SCOPED_TIMER(_merge_timer);
+    *chunk = std::make_shared<vectorized::Chunk>();
+    if (_merged_chunk->empty()) {
+        // Because compute thread couldn't block in pipeline, it exits this operator if the chunks of the senders
+        // the merger waits for haven't come, and comes back when they have.
+        if (!is_data_ready()) {
+            *should_exit = true;
+            return Status::OK();
+        }
+        _starved_senders.clear();
+        auto merged = _cascade_merger->try_get_next();
+        if (merged == nullptr) {
+            *eos = _cascade_merger->is_eos();
+            *should_exit = !*eos;
+            return Status::OK();
+        }
+        if (merged->num_rows() <= _chunk_size) {
+            *chunk = std::move(merged);
+            return Status::OK();
+        }
+        _merged_chunk->reset(std::move(merged));
+    }
+    *chunk = _merged_chunk->cutoff(_chunk_size);
+    return Status::OK();
 }
 
 bool DataStreamRecvr::is_data_ready() {
-    return _chunks_merger->is_data_ready();
+    if (!_merged_chunk->empty()) {
+        return true;
+    }
+    // The merger is ready once every sender has the first chunk, then it's blocked only by the starved senders.
+    if (!_cascade_merger->is_data_ready()) {
+        return false;
+    }
+    for (int i : _starved_senders) {
+        if (!_sender_queues[i]->has_chunk()) {
+            return false;
+        }
+    }
+    return true;
 }
 
 Status DataStreamRecvr::add_chunks(const PTransmitChunkParams& request, ::google::protobuf::Closure** done) {
@@ -195,34 +239,73 @@ Status DataStreamRecvr::add_chunks(const PTransmitChunkParams& request, ::google
     int use_sender_id = _is_merging ? request.sender_id() : 0;
     // Add all batches to the same queue if _is_merging is false.
 
+    Status st;
     if (_keep_order) {
         DCHECK(_is_pipeline);
-        return _sender_queues[use_sender_id]->add_chunks_and_keep_order(request, done);
+        st = _sender_queues[use_sender_id]->add_chunks_and_keep_order(request, done);
     } else {
-        return _sender_queues[use_sender_id]->add_chunks(request, done);
+        st = _sender_queues[use_sender_id]->add_chunks(request, done);
     }
+    _notify_ready_observers();
+    return st;
 }
 
 void DataStreamRecvr::remove_sender(int sender_id, int be_number) {
     int use_sender_id = _is_merging ? sender_id : 0;
     _sender_queues[use_sender_id]->decrement_senders(be_number);
+    _notify_ready_observers();
 }
 
 void DataStreamRecvr::cancel_stream() {
     for (auto& _sender_queue : _sender_queues) {
         _sender_queue->cancel();
     }
+    _notify_ready_observers();
+}
+
+void DataStreamRecvr::set_ready_observer_for_pipeline(int32_t driver_sequence, std::function<void()> observer) {
+    DCHECK(_is_pipeline);
+    std::lock_guard<std::mutex> l(_ready_observers_lock);
+    if (_ready_observers.size() <= driver_sequence) {
+        _ready_observers.resize(driver_sequence + 1);
+    }
+    _ready_observers[driver_sequence] = std::move(observer);
+}
+
+void DataStreamRecvr::_notify_ready_observers() {
+    if (!_is_pipeline) {
+        return;
+    }
+    // Chunks of a non pipeline-level shuffle are shared by all the drivers, so notify all of them.
+    std::lock_guard<std::mutex> l(_ready_observers_lock);
+    for (auto& observer : _ready_observers) {
+        if (observer) {
+            observer();
+        }
+    }
 }
 
 void DataStreamRecvr::close() {
+    // The pipeline receiver is closed before all the senders sent eos if the operators reading it finished early,
+    // e.g. by reaching the limit, then the senders are told to stop.
+    bool finished_early = false;
+    if (_is_pipeline) {
+        for (auto* sender_queue : _sender_queues) {
+            finished_early |= !static_cast<PipelineSenderQueue*>(sender_queue)->is_finished();
+        }
+    }
     for (auto& _sender_queue : _sender_queues) {
         _sender_queue->close();
     }
+    if (finished_early) {
+        _mgr->mark_recvr_finished_early(fragment_instance_id(), dest_node_id());
+    }
     // Remove this receiver from the DataStreamMgr that created it.
     // TODO: log error msg
     _mgr->deregister_recvr(fragment_instance_id(), dest_node_id());
     _mgr = nullptr;
     _chunks_merger.reset();
+    _cascade_merger.reset();
 
     _closure_block_timer->update(_closure_block_timer->value() / std::max(1, _degree_of_parallelism));
 }
@@ -21,6 +21,9 @@
 
 #pragma once
 
+#include <functional>
+#include <mutex>
+
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
 #include "common/status.h"
@@ -37,8 +40,10 @@ class Closure;
 namespace starrocks {
 
 namespace vectorized {
+class MergeCursorsCascade;
 class SortedChunksMerger;
-}
+struct ChunkSlice;
+} // namespace vectorized
 
 class DataStreamMgr;
 class MemTracker;
@@ -112,6 +117,10 @@ public:
 
     bool is_data_ready();
 
+    // Set the observer of the driver |driver_sequence|, called when chunks are received or the stream
+    // ends, see SourceOperator::notify_ready(). Set nullptr to remove it before the operator is closed.
+    void set_ready_observer_for_pipeline(int32_t driver_sequence, std::function<void()> observer);
+
 private:
     friend class DataStreamMgr;
     class SenderQueue;
@@ -138,6 +147,8 @@ private:
     // total buffer limit.
     bool exceeds_limit(int chunk_size) { return _num_buffered_bytes + chunk_size > _total_buffer_limit; }
 
+    void _notify_ready_observers();
+
     // DataStreamMgr instance used to create this recvr. (Not owned)
     DataStreamMgr* _mgr;
 
@@ -169,6 +180,16 @@ private:
     // vectorized::SortedChunksMerger merges chunks from different senders.
     std::unique_ptr<vectorized::SortedChunksMerger> _chunks_merger;
 
+    // vectorized::MergeCursorsCascade merges chunks from different senders in pipeline.
+    std::unique_ptr<vectorized::MergeCursorsCascade> _cascade_merger;
+    // The rest of the last merged chunk, which is returned in chunks of at most _chunk_size rows.
+    std::unique_ptr<vectorized::ChunkSlice> _merged_chunk;
+    int _chunk_size = 0;
+    // The indexes of the sender queues which were empty when the merger asked for their next chunks,
+    // the merger can't make progress until all of them have chunks or finish.
+    std::vector<int> _starved_senders;
+    RuntimeProfile::Counter* _merge_timer = nullptr;
+
     // Pool of sender queues.
     ObjectPool _sender_queue_pool;
 
@@ -215,6 +236,10 @@ private:
     // if _keep_order is set to true, then receiver will keep the order according sequence
     bool _keep_order;
     PassThroughContext _pass_through_context;
+
+    // Indexed by driver sequence, only used by pipeline.
+    std::mutex _ready_observers_lock;
+    std::vector<std::function<void()>> _ready_observers;
 };
 
 } // end namespace starrocks
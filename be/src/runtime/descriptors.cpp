@@ -21,6 +21,7 @@
 
 #include "runtime/descriptors.h"
 
+#include <algorithm>
 #include <boost/algorithm/string/join.hpp>
 #include <ios>
 #include <sstream>
@@ -649,6 +650,14 @@ SlotDescriptor* DescriptorTbl::get_slot_descriptor(SlotId id) const {
     }
 }
 
+SlotId DescriptorTbl::max_slot_id() const {
+    SlotId max_id = -1;
+    for (const auto& [id, slot] : _slot_desc_map) {
+        max_id = std::max(max_id, id);
+    }
+    return max_id;
+}
+
 // return all registered tuple descriptors
 void DescriptorTbl::get_tuple_descs(std::vector<TupleDescriptor*>* descs) const {
     descs->clear();
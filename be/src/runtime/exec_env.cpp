@@ -29,9 +29,11 @@
 #include "common/config.h"
 #include "common/logging.h"
 #include "exec/pipeline/driver_limiter.h"
+#include "exec/pipeline/numa_placement.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
 #include "exec/pipeline/query_context.h"
 #include "exec/workgroup/scan_executor.h"
+#include "exec/workgroup/scan_task_queue.h"
 #include "exec/workgroup/work_group.h"
 #include "exec/workgroup/work_group_fwd.h"
 #include "gen_cpp/BackendService.h"
@@ -39,6 +41,8 @@
 #include "gen_cpp/HeartbeatService_types.h"
 #include "gen_cpp/TFileBrokerService.h"
 #include "gutil/strings/substitute.h"
+#include "io/block_cache.h"
+#include "io/data_cache.h"
 #include "runtime/broker_mgr.h"
 #include "runtime/client_cache.h"
 #include "runtime/data_stream_mgr.h"
@@ -124,6 +128,20 @@ static int64_t calc_max_consistency_memory(int64_t process_mem_limit) {
     return std::min<int64_t>(limit, process_mem_limit * percent / 100);
 }
 
+// With NUMA-aware placement, each NUMA node has its own queue of scan tasks.
+static std::unique_ptr<workgroup::ScanTaskQueue> create_priority_scan_task_queue() {
+    int num_nodes = pipeline::num_placement_numa_nodes();
+    if (num_nodes <= 1) {
+        return std::make_unique<workgroup::PriorityScanTaskQueue>(config::pipeline_scan_thread_pool_queue_size);
+    }
+    std::vector<std::unique_ptr<workgroup::ScanTaskQueue>> node_queues;
+    for (int i = 0; i < num_nodes; ++i) {
+        node_queues.emplace_back(
+                std::make_unique<workgroup::PriorityScanTaskQueue>(config::pipeline_scan_thread_pool_queue_size));
+    }
+    return std::make_unique<workgroup::NumaPartitionedScanTaskQueue>(std::move(node_queues));
+}
+
 Status ExecEnv::init(ExecEnv* env, const std::vector<StorePath>& store_paths) {
     return env->_init(store_paths);
 }
@@ -156,6 +174,18 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths) {
     _pipeline_prepare_pool =
             new PriorityThreadPool("pip_prepare", num_prepare_threads, config::pipeline_prepare_thread_pool_queue_size);
 
+    int num_join_build_threads = config::join_parallel_build_thread_num;
+    if (num_join_build_threads <= 0) {
+        num_join_build_threads = std::thread::hardware_concurrency();
+    }
+    std::unique_ptr<ThreadPool> join_build_thread_pool;
+    RETURN_IF_ERROR(ThreadPoolBuilder("join_build") // parallel construction of join hash tables
+                            .set_min_threads(0)
+                            .set_max_threads(num_join_build_threads)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&join_build_thread_pool));
+    _join_build_thread_pool = join_build_thread_pool.release();
+
     std::unique_ptr<ThreadPool> driver_executor_thread_pool;
     _max_executor_threads = std::thread::hardware_concurrency();
     if (config::pipeline_exec_thread_pool_thread_num > 0) {
@@ -220,8 +250,7 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths) {
                                 .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                                 .build(&scan_worker_thread_pool_without_workgroup));
         _scan_executor_without_workgroup = new workgroup::ScanExecutor(
-                std::move(scan_worker_thread_pool_without_workgroup),
-                std::make_unique<workgroup::PriorityScanTaskQueue>(config::pipeline_scan_thread_pool_queue_size));
+                std::move(scan_worker_thread_pool_without_workgroup), create_priority_scan_task_queue());
         _scan_executor_without_workgroup->initialize(num_io_threads);
 
         std::unique_ptr<ThreadPool> scan_worker_thread_pool_with_workgroup;
@@ -247,8 +276,7 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths) {
                                 .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                                 .build(&connector_scan_worker_thread_pool_without_workgroup));
         _connector_scan_executor_without_workgroup = new workgroup::ScanExecutor(
-                std::move(connector_scan_worker_thread_pool_without_workgroup),
-                std::make_unique<workgroup::PriorityScanTaskQueue>(config::pipeline_scan_thread_pool_queue_size));
+                std::move(connector_scan_worker_thread_pool_without_workgroup), create_priority_scan_task_queue());
         _connector_scan_executor_without_workgroup->initialize(connector_num_io_threads);
 
         std::unique_ptr<ThreadPool> connector_scan_worker_thread_pool_with_workgroup;
@@ -274,6 +302,22 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths) {
         _lake_location_provider = new lake::StarletLocationProvider();
 #endif
         _lake_tablet_manager = new lake::TabletManager(_lake_location_provider, config::lake_metadata_cache_limit);
+        if (config::block_cache_enable) {
+            io::BlockCacheOptions options;
+            options.disk_path = config::block_cache_disk_path;
+            options.disk_size = config::block_cache_disk_size;
+            options.mem_size = config::block_cache_mem_size;
+            options.block_size = config::block_cache_block_size;
+            RETURN_IF_ERROR(io::BlockCache::create_global_cache(options));
+        }
+        if (config::datacache_enable) {
+            std::vector<std::string> dirs;
+            for (const auto& store_path : _store_paths) {
+                dirs.emplace_back(store_path.path + "/datacache");
+            }
+            RETURN_IF_ERROR(io::DataCache::create_global_cache(dirs, config::datacache_disk_size_per_dir,
+                                                               config::block_cache_block_size));
+        }
 
         // agent_server is not needed for cn
         _agent_server = new AgentServer(this);
@@ -357,6 +401,7 @@ Status ExecEnv::init_mem_tracker() {
     _clone_mem_tracker = new MemTracker(-1, "clone", _mem_tracker);
     int64_t consistency_mem_limit = calc_max_consistency_memory(_mem_tracker->limit());
     _consistency_mem_tracker = new MemTracker(consistency_mem_limit, "consistency", _mem_tracker);
+    _mmap_mem_tracker = new MemTracker(-1, "mmap", nullptr);
 
     ChunkAllocator::init_instance(_chunk_allocator_mem_tracker, config::chunk_reserved_bytes_limit);
 
@@ -461,6 +506,11 @@ void ExecEnv::_destroy() {
         delete _pipeline_prepare_pool;
         _pipeline_prepare_pool = nullptr;
     }
+    if (_join_build_thread_pool) {
+        _join_build_thread_pool->shutdown();
+        delete _join_build_thread_pool;
+        _join_build_thread_pool = nullptr;
+    }
     if (_scan_executor_without_workgroup) {
         delete _scan_executor_without_workgroup;
         _scan_executor_without_workgroup = nullptr;
@@ -493,6 +543,10 @@ void ExecEnv::_destroy() {
         delete _consistency_mem_tracker;
         _consistency_mem_tracker = nullptr;
     }
+    if (_mmap_mem_tracker) {
+        delete _mmap_mem_tracker;
+        _mmap_mem_tracker = nullptr;
+    }
     if (_clone_mem_tracker) {
         delete _clone_mem_tracker;
         _clone_mem_tracker = nullptr;
@@ -578,6 +632,8 @@ void ExecEnv::_destroy() {
         delete _lake_tablet_manager;
         _lake_tablet_manager = nullptr;
     }
+    io::BlockCache::release_global_cache();
+    io::DataCache::release_global_cache();
     if (_lake_location_provider) {
         delete _lake_location_provider;
         _lake_location_provider = nullptr;
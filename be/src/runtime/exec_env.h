@@ -134,6 +134,7 @@ public:
     MemTracker* chunk_allocator_mem_tracker() { return _chunk_allocator_mem_tracker; }
     MemTracker* clone_mem_tracker() { return _clone_mem_tracker; }
     MemTracker* consistency_mem_tracker() { return _consistency_mem_tracker; }
+    MemTracker* mmap_mem_tracker() { return _mmap_mem_tracker; }
 
     ThreadResourceMgr* thread_mgr() { return _thread_mgr; }
     PriorityThreadPool* thread_pool() { return _thread_pool; }
@@ -148,6 +149,7 @@ public:
 
     PriorityThreadPool* udf_call_pool() { return _udf_call_pool; }
     PriorityThreadPool* pipeline_prepare_pool() { return _pipeline_prepare_pool; }
+    ThreadPool* join_build_thread_pool() { return _join_build_thread_pool; }
     FragmentMgr* fragment_mgr() { return _fragment_mgr; }
     starrocks::pipeline::DriverExecutor* driver_executor() { return _driver_executor; }
     starrocks::pipeline::DriverExecutor* wg_driver_executor() { return _wg_driver_executor; }
@@ -237,6 +239,10 @@ private:
 
     MemTracker* _consistency_mem_tracker = nullptr;
 
+    // The bytes of the files mapped into memory, which are backed by the OS page cache rather than allocated,
+    // so they are not counted by the process memory tracker.
+    MemTracker* _mmap_mem_tracker = nullptr;
+
     ThreadResourceMgr* _thread_mgr = nullptr;
     PriorityThreadPool* _thread_pool = nullptr;
 
@@ -247,6 +253,7 @@ private:
 
     PriorityThreadPool* _udf_call_pool = nullptr;
     PriorityThreadPool* _pipeline_prepare_pool = nullptr;
+    ThreadPool* _join_build_thread_pool = nullptr;
     FragmentMgr* _fragment_mgr = nullptr;
     pipeline::QueryContextManager* _query_context_mgr = nullptr;
     pipeline::DriverExecutor* _driver_executor = nullptr;
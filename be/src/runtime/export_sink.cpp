@@ -82,12 +82,15 @@ Status ExportSink::open(RuntimeState* state) {
     // Prepare the exprs to run.
     RETURN_IF_ERROR(Expr::open(_output_expr_ctxs, state));
     // open broker
-    int query_timeout = state->query_options().query_timeout;
-    int timeout_ms = query_timeout > 3600 ? 3600000 : query_timeout * 1000;
-    RETURN_IF_ERROR(open_file_writer(timeout_ms));
+    RETURN_IF_ERROR(open_file_writer(file_write_timeout_ms(state)));
     return Status::OK();
 }
 
+int ExportSink::file_write_timeout_ms(RuntimeState* state) {
+    int query_timeout = state->query_options().query_timeout;
+    return query_timeout > 3600 ? 3600000 : query_timeout * 1000;
+}
+
 Status ExportSink::close(RuntimeState* state, Status exec_status) {
     Expr::close(_output_expr_ctxs, state);
     if (_file_builder != nullptr) {
@@ -99,27 +102,49 @@ Status ExportSink::close(RuntimeState* state, Status exec_status) {
 }
 
 Status ExportSink::open_file_writer(int timeout_ms) {
+    std::string file_path;
+    ASSIGN_OR_RETURN(_file_builder, create_file_builder(_t_export_sink, _output_expr_ctxs, 0, timeout_ms, &file_path));
+    _state->add_export_output_file(file_path);
+    return Status::OK();
+}
+
+// TODO(lingbin): add some other info to file name, like partition
+static Status gen_file_name(const TExportSink& t_export_sink, int32_t file_number, std::string* file_name) {
+    if (!t_export_sink.__isset.file_name_prefix) {
+        return Status::InternalError("file name prefix is not set");
+    }
+
+    std::stringstream file_name_ss;
+    // <file-name-prefix>_<file-number>.csv.<timestamp>
+    file_name_ss << t_export_sink.file_name_prefix << file_number << ".csv." << UnixMillis();
+    *file_name = file_name_ss.str();
+    return Status::OK();
+}
+
+StatusOr<std::unique_ptr<FileBuilder>> ExportSink::create_file_builder(
+        const TExportSink& t_export_sink, const std::vector<ExprContext*>& output_expr_ctxs, int32_t file_number,
+        int timeout_ms, std::string* file_path) {
     std::unique_ptr<WritableFile> output_file;
     std::string file_name;
-    RETURN_IF_ERROR(gen_file_name(&file_name));
-    std::string file_path = _t_export_sink.export_path + "/" + file_name;
+    RETURN_IF_ERROR(gen_file_name(t_export_sink, file_number, &file_name));
+    *file_path = t_export_sink.export_path + "/" + file_name;
     WritableFileOptions options{.sync_on_close = false, .mode = FileSystem::MUST_CREATE};
 
-    const auto& file_type = _t_export_sink.file_type;
+    const auto& file_type = t_export_sink.file_type;
     switch (file_type) {
     case TFileType::FILE_LOCAL: {
-        ASSIGN_OR_RETURN(output_file, FileSystem::Default()->new_writable_file(options, file_path));
+        ASSIGN_OR_RETURN(output_file, FileSystem::Default()->new_writable_file(options, *file_path));
         break;
     }
     case TFileType::FILE_BROKER: {
-        if (_t_export_sink.__isset.use_broker && !_t_export_sink.use_broker) {
-            ASSIGN_OR_RETURN(auto fs, FileSystem::CreateUniqueFromString(file_path, FSOptions(&_t_export_sink)));
-            ASSIGN_OR_RETURN(output_file, fs->new_writable_file(options, file_path));
+        if (t_export_sink.__isset.use_broker && !t_export_sink.use_broker) {
+            ASSIGN_OR_RETURN(auto fs, FileSystem::CreateUniqueFromString(*file_path, FSOptions(&t_export_sink)));
+            ASSIGN_OR_RETURN(output_file, fs->new_writable_file(options, *file_path));
             break;
         } else {
-            const TNetworkAddress& broker_addr = _t_export_sink.broker_addresses[0];
-            BrokerFileSystem fs_broker(broker_addr, _t_export_sink.properties, timeout_ms);
-            ASSIGN_OR_RETURN(output_file, fs_broker.new_writable_file(options, file_path));
+            const TNetworkAddress& broker_addr = t_export_sink.broker_addresses[0];
+            BrokerFileSystem fs_broker(broker_addr, t_export_sink.properties, timeout_ms);
+            ASSIGN_OR_RETURN(output_file, fs_broker.new_writable_file(options, *file_path));
             break;
         }
     }
@@ -127,27 +152,10 @@ Status ExportSink::open_file_writer(int timeout_ms) {
         return Status::NotSupported(strings::Substitute("Unsupported file type $0", file_type));
     }
 
-    _file_builder = std::make_unique<PlainTextBuilder>(
-            PlainTextBuilderOptions{.column_terminated_by = _t_export_sink.column_separator,
-                                    .line_terminated_by = _t_export_sink.row_delimiter},
-            std::move(output_file), _output_expr_ctxs);
-
-    _state->add_export_output_file(file_path);
-    return Status::OK();
-}
-
-// TODO(lingbin): add some other info to file name, like partition
-Status ExportSink::gen_file_name(std::string* file_name) {
-    if (!_t_export_sink.__isset.file_name_prefix) {
-        return Status::InternalError("file name prefix is not set");
-    }
-
-    std::stringstream file_name_ss;
-    // now file-number is 0.
-    // <file-name-prefix>_<file-number>.csv.<timestamp>
-    file_name_ss << _t_export_sink.file_name_prefix << "0.csv." << UnixMillis();
-    *file_name = file_name_ss.str();
-    return Status::OK();
+    return std::make_unique<PlainTextBuilder>(
+            PlainTextBuilderOptions{.column_terminated_by = t_export_sink.column_separator,
+                                    .line_terminated_by = t_export_sink.row_delimiter},
+            std::move(output_file), output_expr_ctxs);
 }
 
 Status ExportSink::send_chunk(RuntimeState*, vectorized::Chunk* chunk) {
@@ -60,9 +60,23 @@ public:
 
     RuntimeProfile* profile() override { return _profile; }
 
+    const TExportSink& t_export_sink() const { return _t_export_sink; }
+
+    const std::vector<TExpr>& output_exprs() const { return _t_output_expr; }
+
+    // Create the builder of the export file |file_number|, i.e. <file-name-prefix><file-number>.csv.<timestamp>
+    // under the export path, whose path is returned in |file_path|.
+    // The export sink operators of the pipeline engine write one file per driver by it.
+    static StatusOr<std::unique_ptr<FileBuilder>> create_file_builder(const TExportSink& t_export_sink,
+                                                                      const std::vector<ExprContext*>& output_expr_ctxs,
+                                                                      int32_t file_number, int timeout_ms,
+                                                                      std::string* file_path);
+
+    // The timeout of the writes to the broker.
+    static int file_write_timeout_ms(RuntimeState* state);
+
 private:
     Status open_file_writer(int timeout_ms);
-    Status gen_file_name(std::string* file_name);
 
     RuntimeState* _state;
 
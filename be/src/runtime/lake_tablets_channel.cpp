@@ -52,6 +52,9 @@ public:
 
     void cancel() override;
 
+    void add_segment(const PTabletWriterAddSegmentRequest& request, butil::IOBuf* data,
+                     PTabletWriterAddSegmentResult* response) override;
+
     MemTracker* mem_tracker() { return _mem_tracker; }
 
 private:
@@ -348,6 +351,12 @@ void LakeTabletsChannel::cancel() {
     }
 }
 
+void LakeTabletsChannel::add_segment(const PTabletWriterAddSegmentRequest& request, butil::IOBuf* data,
+                                     PTabletWriterAddSegmentResult* response) {
+    response->mutable_status()->set_status_code(TStatusCode::NOT_IMPLEMENTED_ERROR);
+    response->mutable_status()->add_error_msgs("lake tablets do not support segment replication");
+}
+
 StatusOr<std::unique_ptr<LakeTabletsChannel::WriteContext>> LakeTabletsChannel::_create_write_context(
         vectorized::Chunk* chunk, const PTabletWriterAddChunkRequest& request, PTabletWriterAddBatchResult* response) {
     if (chunk == nullptr && !request.eos()) {
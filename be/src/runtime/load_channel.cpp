@@ -161,6 +161,18 @@ void LoadChannel::add_chunks(const PTabletWriterAddChunksRequest& req, PTabletWr
     }
 }
 
+void LoadChannel::add_segment(const PTabletWriterAddSegmentRequest& request, butil::IOBuf* data,
+                              PTabletWriterAddSegmentResult* response) {
+    _last_updated_time.store(time(nullptr), std::memory_order_relaxed);
+    auto channel = get_tablets_channel(request.index_id());
+    if (channel == nullptr) {
+        response->mutable_status()->set_status_code(TStatusCode::INTERNAL_ERROR);
+        response->mutable_status()->add_error_msgs("cannot find the tablets channel associated with the index id");
+        return;
+    }
+    channel->add_segment(request, data, response);
+}
+
 void LoadChannel::cancel() {
     _span->AddEvent("cancel");
     auto scoped = trace::Scope(_span);
@@ -47,6 +47,10 @@ namespace brpc {
 class Controller;
 }
 
+namespace butil {
+class IOBuf;
+}
+
 namespace starrocks {
 
 class Cache;
@@ -75,6 +79,9 @@ public:
 
     void add_chunks(const PTabletWriterAddChunksRequest& request, PTabletWriterAddBatchResult* response);
 
+    void add_segment(const PTabletWriterAddSegmentRequest& request, butil::IOBuf* data,
+                     PTabletWriterAddSegmentResult* response);
+
     void cancel();
 
     time_t last_updated_time() const { return _last_updated_time.load(std::memory_order_relaxed); }
@@ -129,6 +129,18 @@ void LoadChannelMgr::add_chunks(const PTabletWriterAddChunksRequest& request, PT
     }
 }
 
+void LoadChannelMgr::add_segment(const PTabletWriterAddSegmentRequest& request, butil::IOBuf* data,
+                                 PTabletWriterAddSegmentResult* response) {
+    UniqueId load_id(request.id());
+    auto channel = _find_load_channel(load_id);
+    if (channel != nullptr) {
+        channel->add_segment(request, data, response);
+    } else {
+        response->mutable_status()->set_status_code(TStatusCode::INTERNAL_ERROR);
+        response->mutable_status()->add_error_msgs("no associated load channel");
+    }
+}
+
 void LoadChannelMgr::cancel(brpc::Controller* cntl, const PTabletWriterCancelRequest& request,
                             PTabletWriterCancelResult* response, google::protobuf::Closure* done) {
     ClosureGuard done_guard(done);
@@ -69,6 +69,9 @@ public:
 
     void add_chunks(const PTabletWriterAddChunksRequest& request, PTabletWriterAddBatchResult* response);
 
+    void add_segment(const PTabletWriterAddSegmentRequest& request, butil::IOBuf* data,
+                     PTabletWriterAddSegmentResult* response);
+
     void cancel(brpc::Controller* cntl, const PTabletWriterCancelRequest& request, PTabletWriterCancelResult* response,
                 google::protobuf::Closure* done);
 
@@ -68,6 +68,9 @@ public:
 
     void cancel() override;
 
+    void add_segment(const PTabletWriterAddSegmentRequest& request, butil::IOBuf* data,
+                     PTabletWriterAddSegmentResult* response) override;
+
     MemTracker* mem_tracker() { return _mem_tracker; }
 
 private:
@@ -178,6 +181,8 @@ private:
     std::unordered_set<int64_t> _partition_ids;
 
     std::unordered_map<int64_t, uint32_t> _tablet_id_to_sorted_indexes;
+    // Shared by the delta writers, so must be destroyed after them.
+    std::unique_ptr<vectorized::SharedWriteBuffer> _shared_write_buffer;
     // tablet_id -> TabletChannel
     std::unordered_map<int64_t, std::unique_ptr<AsyncDeltaWriter>> _delta_writers;
 
@@ -442,6 +447,10 @@ Status LocalTabletsChannel::_open_all_writers(const PTabletWriterOpenRequest& pa
         }
     }
 
+    if (config::load_shared_write_buffer_size > 0) {
+        _shared_write_buffer = std::make_unique<vectorized::SharedWriteBuffer>(config::load_shared_write_buffer_size);
+    }
+
     std::vector<int64_t> tablet_ids;
     tablet_ids.reserve(params.tablets_size());
     for (const PTabletWithPartition& tablet : params.tablets()) {
@@ -454,6 +463,14 @@ Status LocalTabletsChannel::_open_all_writers(const PTabletWriterOpenRequest& pa
         options.slots = index_slots;
         options.global_dicts = &_global_dicts;
         options.parent_span = _load_channel->get_span();
+        options.shared_write_buffer = _shared_write_buffer.get();
+        options.index_id = _index_id;
+        if (params.is_replicated_storage() && tablet.replicas_size() > 0) {
+            options.replicas.assign(tablet.replicas().begin(), tablet.replicas().end());
+            options.replica_state = tablet.replicas(0).node_id() == params.node_id()
+                                            ? vectorized::ReplicaState::Primary
+                                            : vectorized::ReplicaState::Secondary;
+        }
 
         auto res = AsyncDeltaWriter::open(options, _mem_tracker);
         RETURN_IF_ERROR(res.status());
@@ -485,6 +502,18 @@ void LocalTabletsChannel::cancel() {
               << " tablet_ids:" << tablet_id_list_str;
 }
 
+void LocalTabletsChannel::add_segment(const PTabletWriterAddSegmentRequest& request, butil::IOBuf* data,
+                                      PTabletWriterAddSegmentResult* response) {
+    auto it = _delta_writers.find(request.tablet_id());
+    if (UNLIKELY(it == _delta_writers.end())) {
+        response->mutable_status()->set_status_code(TStatusCode::INVALID_ARGUMENT);
+        response->mutable_status()->add_error_msgs(
+                fmt::format("no tablet {} in PTabletWriterAddSegmentRequest", request.tablet_id()));
+        return;
+    }
+    it->second->write_segment(request, data).to_protobuf(response->mutable_status());
+}
+
 StatusOr<std::shared_ptr<LocalTabletsChannel::WriteContext>> LocalTabletsChannel::_create_write_context(
         vectorized::Chunk* chunk, const PTabletWriterAddChunkRequest& request, PTabletWriterAddBatchResult* response) {
     if (chunk == nullptr && !request.eos()) {
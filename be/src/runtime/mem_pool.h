@@ -93,9 +93,15 @@ class MemTracker;
 ///    delete p;
 class MemPool {
 public:
-    MemPool()
+    MemPool() : MemPool(MAX_CHUNK_SIZE) {}
+
+    /// The chunk sizes double up to |max_chunk_size| instead of MAX_CHUNK_SIZE, e.g.
+    /// LARGE_CHUNK_SIZE for a pool expected to grow large, so that it allocates fewer
+    /// chunks, each of them counted once against the MemTracker.
+    explicit MemPool(int max_chunk_size)
             : current_chunk_idx_(-1),
               next_chunk_size_(INITIAL_CHUNK_SIZE),
+              max_chunk_size_(std::max(max_chunk_size, static_cast<int>(INITIAL_CHUNK_SIZE))),
               total_allocated_bytes_(0),
               total_reserved_bytes_(0),
               peak_allocated_bytes_(0) {}
@@ -144,6 +150,10 @@ public:
 
     static const int DEFAULT_ALIGNMENT = 16;
 
+    /// The size of a huge page, the chunks of this size may be backed by transparent huge pages,
+    /// see config::madvise_huge_pages.
+    static const int LARGE_CHUNK_SIZE = 2 * 1024 * 1024;
+
 private:
     friend class MemPoolTest;
     static const int INITIAL_CHUNK_SIZE = 4 * 1024;
@@ -234,6 +244,9 @@ private:
     /// The size of the next chunk to allocate.
     int next_chunk_size_;
 
+    /// The size up to which the chunk sizes double.
+    int max_chunk_size_;
+
     /// sum of allocated_bytes_
     int64_t total_allocated_bytes_;
 
@@ -21,8 +21,10 @@
 
 #include "runtime/memory/chunk_allocator.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
+#include <utility>
 
 #include "gutil/dynamic_annotations.h"
 #include "runtime/current_thread.h"
@@ -90,6 +92,24 @@ public:
         return true;
     }
 
+    // Pop free chunks of at least |bytes| in total, or all of them, the largest chunks first.
+    // Return the bytes popped.
+    size_t pop_free_chunks(size_t bytes, std::vector<std::pair<uint8_t*, size_t>>* chunks) {
+        size_t popped_bytes = 0;
+        std::lock_guard<SpinLock> l(_lock);
+        for (int i = 63; i >= 0 && popped_bytes < bytes; --i) {
+            size_t size = (uint64_t)1 << i;
+            auto& free_list = _chunk_lists[i];
+            while (!free_list.empty() && popped_bytes < bytes) {
+                ASAN_UNPOISON_MEMORY_REGION(free_list.back(), size);
+                chunks->emplace_back(free_list.back(), size);
+                free_list.pop_back();
+                popped_bytes += size;
+            }
+        }
+        return popped_bytes;
+    }
+
     void push_free_chunk(uint8_t* ptr, size_t size) {
         int idx = BitUtil::Log2Ceiling64(size);
         // Poison this chunk to make asan can detect invalid access
@@ -130,18 +150,33 @@ ChunkAllocator::ChunkAllocator(MemTracker* mem_tracker, size_t reserve_limit)
     for (auto& _arena : _arenas) {
         _arena = std::make_unique<ChunkArena>(_mem_tracker);
     }
+
+    int num_cores = _arenas.size();
+    _fallback_cores.resize(num_cores);
+    for (int core_id = 0; core_id < num_cores; ++core_id) {
+        auto& cores = _fallback_cores[core_id];
+        for (int i = 1; i < num_cores; ++i) {
+            cores.push_back((core_id + i) % num_cores);
+        }
+        int numa_node = CpuInfo::get_numa_node_of_core(core_id);
+        std::stable_partition(cores.begin(), cores.end(), [numa_node](int other) {
+            return CpuInfo::get_numa_node_of_core(other) == numa_node;
+        });
+    }
 }
 
+// The free chunks are counted against _mem_tracker, and the allocated chunks against the tracker of the thread.
+// The thread side goes through the thread local cache of CurrentThread, so that allocating a chunk neither
+// flushes the cache nor touches the trackers shared by the other threads, most of the time. The thread tracker
+// is only switched to _mem_tracker around the system calls, for them to be counted against it.
 bool ChunkAllocator::allocate(size_t size, Chunk* chunk) {
     bool ret = true;
 #ifndef BE_TEST
-    MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(_mem_tracker);
     DeferOp op([&] {
         if (ret) {
             _mem_tracker->release(chunk->size);
-            prev_tracker->consume(chunk->size);
+            tls_thread_status.mem_consume(chunk->size);
         }
-        tls_thread_status.set_mem_tracker(prev_tracker);
     });
 #endif
 
@@ -157,14 +192,13 @@ bool ChunkAllocator::allocate(size_t size, Chunk* chunk) {
         return ret;
     }
     if (_reserved_bytes > size) {
-        // try to allocate from other core's arena
-        ++core_id;
-        for (int i = 1; i < _arenas.size(); ++i, ++core_id) {
-            if (_arenas[core_id % _arenas.size()]->pop_free_chunk(size, &chunk->data)) {
+        // try to allocate from other core's arena, the ones of the same NUMA node first
+        for (int other_core_id : _fallback_cores[core_id]) {
+            if (_arenas[other_core_id]->pop_free_chunk(size, &chunk->data)) {
                 _reserved_bytes.fetch_sub(size);
                 other_core_alloc_count.increment(1);
                 // reset chunk's core_id to other
-                chunk->core_id = core_id % _arenas.size();
+                chunk->core_id = other_core_id;
                 ret = true;
                 return ret;
             }
@@ -174,6 +208,9 @@ bool ChunkAllocator::allocate(size_t size, Chunk* chunk) {
     int64_t cost_ns = 0;
     {
         SCOPED_RAW_TIMER(&cost_ns);
+#ifndef BE_TEST
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+#endif
         // allocate from system allocator
         chunk->data = SystemAllocator::allocate(_mem_tracker, size);
     }
@@ -189,13 +226,8 @@ bool ChunkAllocator::allocate(size_t size, Chunk* chunk) {
 
 void ChunkAllocator::free(const Chunk& chunk) {
 #ifndef BE_TEST
-    MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(_mem_tracker);
-    DeferOp op([&] {
-        int64_t chunk_size = chunk.size;
-        prev_tracker->release(chunk_size);
-        _mem_tracker->consume(chunk_size);
-        tls_thread_status.set_mem_tracker(prev_tracker);
-    });
+    tls_thread_status.mem_release(chunk.size);
+    _mem_tracker->consume(chunk.size);
 #endif
 
     int64_t old_reserved_bytes = _reserved_bytes;
@@ -206,6 +238,9 @@ void ChunkAllocator::free(const Chunk& chunk) {
             int64_t cost_ns = 0;
             {
                 SCOPED_RAW_TIMER(&cost_ns);
+#ifndef BE_TEST
+                SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+#endif
                 SystemAllocator::free(_mem_tracker, chunk.data, chunk.size);
             }
             system_free_count.increment(1);
@@ -218,4 +253,29 @@ void ChunkAllocator::free(const Chunk& chunk) {
     _arenas[chunk.core_id]->push_free_chunk(chunk.data, chunk.size);
 }
 
+size_t ChunkAllocator::release_free_chunks(size_t bytes) {
+    std::vector<std::pair<uint8_t*, size_t>> chunks;
+    size_t popped_bytes = 0;
+    for (auto& arena : _arenas) {
+        if (popped_bytes >= bytes) {
+            break;
+        }
+        popped_bytes += arena->pop_free_chunks(bytes - popped_bytes, &chunks);
+    }
+
+    size_t released_bytes = 0;
+    {
+#ifndef BE_TEST
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+#endif
+        for (const auto& [ptr, size] : chunks) {
+            SystemAllocator::free(_mem_tracker, ptr, size);
+            released_bytes += size;
+        }
+    }
+    _reserved_bytes.fetch_sub(released_bytes);
+    system_free_count.increment(chunks.size());
+    return released_bytes;
+}
+
 } // namespace starrocks
@@ -74,6 +74,14 @@ public:
 
     void set_mem_tracker(MemTracker* mem_tracker) { _mem_tracker = mem_tracker; }
 
+    // The bytes of the free chunks kept for the next allocations.
+    int64_t reserved_bytes() const { return _reserved_bytes.load(); }
+
+    // Return free chunks of at least |bytes| in total, or all of them, to the system, the largest chunks of
+    // each arena first.
+    // Return the bytes released.
+    size_t release_free_chunks(size_t bytes);
+
 private:
     static ChunkAllocator* _s_instance;
 
@@ -82,6 +90,9 @@ private:
     std::atomic<int64_t> _reserved_bytes;
     // each core has a ChunkArena
     std::vector<std::unique_ptr<ChunkArena>> _arenas;
+    // For each core, the other cores in the order their arenas are searched when its own arena is empty:
+    // the cores of the same NUMA node first, so that a chunk is mostly reused by the node it was touched by.
+    std::vector<std::vector<int>> _fallback_cores;
 };
 
 } // namespace starrocks
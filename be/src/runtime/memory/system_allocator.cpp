@@ -23,6 +23,7 @@
 
 #include <sys/mman.h>
 
+#include <cerrno>
 #include <cstdlib>
 #include <cstring>
 
@@ -33,6 +34,26 @@
 namespace starrocks {
 
 #define PAGE_SIZE (4 * 1024) // 4K
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024) // 2M
+
+// Ask for transparent huge pages to back the allocations spanning whole huge pages,
+// which are mostly the large chunks of the hash tables and the aggregate states.
+static bool use_huge_pages(size_t length) {
+#ifdef MADV_HUGEPAGE
+    return config::madvise_huge_pages && length >= HUGE_PAGE_SIZE && length % HUGE_PAGE_SIZE == 0;
+#else
+    return false;
+#endif
+}
+
+static void madvise_huge_pages(uint8_t* ptr, size_t length) {
+#ifdef MADV_HUGEPAGE
+    if (madvise(ptr, length, MADV_HUGEPAGE) != 0) {
+        // It is only a hint.
+        VLOG(3) << "fail to madvise huge pages, errno=" << errno;
+    }
+#endif
+}
 
 uint8_t* SystemAllocator::allocate(MemTracker* mem_tracker, size_t length) {
     if (config::use_mmap_allocate_chunk) {
@@ -58,12 +79,16 @@ void SystemAllocator::free(MemTracker* mem_tracker, uint8_t* ptr, size_t length)
 
 uint8_t* SystemAllocator::allocate_via_malloc(size_t length) {
     void* ptr = nullptr;
+    bool huge_pages = use_huge_pages(length);
     // try to use a whole page instead of parts of one page
-    int res = posix_memalign(&ptr, PAGE_SIZE, length);
+    int res = posix_memalign(&ptr, huge_pages ? HUGE_PAGE_SIZE : PAGE_SIZE, length);
     if (res != 0) {
         PLOG(ERROR) << "fail to allocate mem via posix_memalign, res=" << res;
         return nullptr;
     }
+    if (huge_pages) {
+        madvise_huge_pages((uint8_t*)ptr, length);
+    }
     return (uint8_t*)ptr;
 }
 
@@ -73,6 +98,9 @@ uint8_t* SystemAllocator::allocate_via_mmap(MemTracker* mem_tracker, size_t leng
         PLOG(ERROR) << "fail to allocate memory via mmap";
         return nullptr;
     }
+    if (use_huge_pages(length)) {
+        madvise_huge_pages(ptr, length);
+    }
     if (mem_tracker != nullptr) {
         mem_tracker->consume(length);
     }
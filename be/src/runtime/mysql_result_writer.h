@@ -31,8 +31,6 @@ class ExprContext;
 class MysqlRowBuffer;
 class BufferControlBlock;
 class RuntimeProfile;
-using TFetchDataResultPtr = std::unique_ptr<TFetchDataResult>;
-using TFetchDataResultPtrs = std::vector<TFetchDataResultPtr>;
 // convert the row batch to mysql protocol row
 class MysqlResultWriter final : public ResultWriter {
 public:
@@ -55,11 +53,11 @@ public:
     // we may split a chunk into multiple TFetchDataResults
     // In order not to affect the current implementation of the non-pipeline engine,
     // we only implement it for the pipeline engine
-    StatusOr<TFetchDataResultPtrs> process_chunk_for_pipeline(vectorized::Chunk* chunk);
+    StatusOr<TFetchDataResultPtrs> process_chunk_for_pipeline(vectorized::Chunk* chunk) override;
 
     // try to add result into _sinker if ResultQueue is not full and this operation is
     // non-blocking. return true on success, false in case of that ResultQueue is full.
-    StatusOr<bool> try_add_batch(TFetchDataResultPtrs& results);
+    StatusOr<bool> try_add_batch(TFetchDataResultPtrs& results) override;
 
 private:
     void _init_profile();
@@ -0,0 +1,128 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "runtime/point_lookup.h"
+
+#include <numeric>
+
+#include "column/chunk.h"
+#include "fmt/format.h"
+#include "serde/protobuf_serde.h"
+#include "storage/chunk_helper.h"
+#include "storage/primary_key_encoder.h"
+#include "storage/storage_engine.h"
+#include "storage/tablet.h"
+#include "storage/tablet_manager.h"
+#include "storage/tablet_updates.h"
+
+namespace starrocks {
+
+static StatusOr<vectorized::Chunk> deserialize_keys(const vectorized::Schema& pkey_schema, const ChunkPB& keys_pb) {
+    size_t num_key_columns = pkey_schema.num_fields();
+    if (keys_pb.is_nulls_size() != num_key_columns || keys_pb.is_consts_size() != num_key_columns) {
+        return Status::InvalidArgument(fmt::format("lookup keys should have {} columns", num_key_columns));
+    }
+    if (keys_pb.has_compress_type() && keys_pb.compress_type() != CompressionTypePB::NO_COMPRESSION) {
+        return Status::InvalidArgument("lookup keys should not be compressed");
+    }
+
+    serde::ProtobufChunkMeta meta;
+    for (size_t i = 0; i < num_key_columns; ++i) {
+        if (keys_pb.is_nulls(i) || keys_pb.is_consts(i)) {
+            return Status::InvalidArgument("lookup keys should be neither nullable nor const");
+        }
+        meta.types.emplace_back(TypeDescriptor::from_storage_type_info(pkey_schema.field(i)->type().get()));
+        meta.is_nulls.emplace_back(false);
+        meta.is_consts.emplace_back(false);
+        meta.slot_id_to_index[i] = i;
+    }
+    serde::ProtobufChunkDeserializer deserializer(meta);
+    return deserializer.deserialize(keys_pb.data());
+}
+
+static Status append_encoded_keys(const PLookupRequest& request, vectorized::Column* pk_column) {
+    if (pk_column->is_binary()) {
+        vectorized::Buffer<Slice> keys;
+        keys.reserve(request.encoded_keys_size());
+        for (const auto& key : request.encoded_keys()) {
+            keys.emplace_back(key);
+        }
+        if (!pk_column->append_strings(keys)) {
+            return Status::InvalidArgument("invalid encoded lookup keys");
+        }
+        return Status::OK();
+    }
+    // A single key column of a fixed length type is encoded as its values.
+    const size_t key_size = pk_column->type_size();
+    pk_column->reserve(request.encoded_keys_size());
+    for (const auto& key : request.encoded_keys()) {
+        if (key.size() != key_size) {
+            return Status::InvalidArgument(fmt::format("encoded lookup key should have {} bytes", key_size));
+        }
+        (void)pk_column->append_numbers(key.data(), key.size());
+    }
+    return Status::OK();
+}
+
+Status lookup_rows(const PLookupRequest& request, PLookupResult* result) {
+    auto tablet = StorageEngine::instance()->tablet_manager()->get_tablet(request.tablet_id());
+    if (tablet == nullptr) {
+        return Status::NotFound(fmt::format("tablet {} not found", request.tablet_id()));
+    }
+    if (tablet->keys_type() != PRIMARY_KEYS || tablet->updates() == nullptr) {
+        return Status::NotSupported("point lookup is only supported by primary key tablets");
+    }
+    const auto& tablet_schema = tablet->tablet_schema();
+
+    std::vector<uint32_t> pk_columns(tablet_schema.num_key_columns());
+    std::iota(pk_columns.begin(), pk_columns.end(), 0);
+    auto pkey_schema = ChunkHelper::convert_schema_to_format_v2(tablet_schema, pk_columns);
+    std::unique_ptr<vectorized::Column> pk_column;
+    RETURN_IF_ERROR(PrimaryKeyEncoder::create_column(pkey_schema, &pk_column));
+    if (request.encoded_keys_size() > 0) {
+        if (request.has_keys()) {
+            return Status::InvalidArgument("lookup keys should be either encoded or not");
+        }
+        RETURN_IF_ERROR(append_encoded_keys(request, pk_column.get()));
+    } else {
+        ASSIGN_OR_RETURN(auto keys, deserialize_keys(pkey_schema, request.keys()));
+        PrimaryKeyEncoder::encode(pkey_schema, keys, 0, keys.num_rows(), pk_column.get());
+    }
+
+    std::vector<uint32_t> column_ids;
+    for (int32_t column_id : request.column_ids()) {
+        if (column_id < 0 || static_cast<size_t>(column_id) >= tablet_schema.num_columns()) {
+            return Status::InvalidArgument(fmt::format("invalid column id {} of tablet {}", column_id,
+                                                       request.tablet_id()));
+        }
+        column_ids.emplace_back(column_id);
+    }
+    auto read_schema = ChunkHelper::convert_schema_to_format_v2(tablet_schema, column_ids);
+    std::vector<std::unique_ptr<vectorized::Column>> columns;
+    for (size_t i = 0; i < column_ids.size(); ++i) {
+        columns.emplace_back(ChunkHelper::column_from_field(*read_schema.field(i))->clone_empty());
+    }
+
+    std::vector<bool> found;
+    int64_t version = 0;
+    RETURN_IF_ERROR(tablet->updates()->get_rows_by_keys(*pk_column, column_ids, &found, &columns, &version));
+    if (request.has_version() && version < request.version()) {
+        return Status::ServiceUnavailable(fmt::format("tablet {} has applied version {}, lower than {}",
+                                                      request.tablet_id(), version, request.version()));
+    }
+
+    vectorized::Columns rows_columns;
+    vectorized::Chunk::SlotHashMap slot_map;
+    for (size_t i = 0; i < columns.size(); ++i) {
+        rows_columns.emplace_back(std::move(columns[i]));
+        slot_map[i] = i;
+    }
+    vectorized::Chunk rows(std::move(rows_columns), slot_map);
+    ASSIGN_OR_RETURN(*result->mutable_rows(), serde::ProtobufChunkSerde::serialize(rows));
+    for (bool is_found : found) {
+        result->add_found(is_found);
+    }
+    result->set_version(version);
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,15 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include "common/status.h"
+#include "gen_cpp/internal_service.pb.h"
+
+namespace starrocks {
+
+// Look up the rows of a primary key tablet by their keys, through the primary index and the column iterators of
+// the segments, without planning and executing a fragment. The keys, unless they are already encoded by
+// PrimaryKeyEncoder, and the rows are serialized by ProtobufChunkSerde, without compression.
+Status lookup_rows(const PLookupRequest& request, PLookupResult* result);
+
+} // namespace starrocks
@@ -38,7 +38,11 @@ ResultBufferMgr::ResultBufferMgr() {
     // actual size of all BufferControlBlock.
     REGISTER_GAUGE_STARROCKS_METRIC(result_buffer_block_count, [this]() {
         std::lock_guard<std::mutex> l(_lock);
-        return _buffer_map.size();
+        size_t count = 0;
+        for (const auto& [_, blocks] : _buffer_map) {
+            count += blocks.size();
+        }
+        return count;
     });
 }
 
@@ -55,35 +59,50 @@ Status ResultBufferMgr::init() {
 
 Status ResultBufferMgr::create_sender(const TUniqueId& query_id, int buffer_size,
                                       std::shared_ptr<BufferControlBlock>* sender) {
-    *sender = find_control_block(query_id);
-    if (*sender != nullptr) {
-        LOG(WARNING) << "already have buffer control block for this instance " << query_id;
+    std::vector<std::shared_ptr<BufferControlBlock>> senders;
+    RETURN_IF_ERROR(create_senders(query_id, 1, buffer_size, &senders));
+    *sender = senders[0];
+    return Status::OK();
+}
+
+Status ResultBufferMgr::create_senders(const TUniqueId& fragment_id, int num_partitions, int buffer_size,
+                                       std::vector<std::shared_ptr<BufferControlBlock>>* senders) {
+    DCHECK_GT(num_partitions, 0);
+    std::lock_guard<std::mutex> l(_lock);
+    BufferMap::iterator iter = _buffer_map.find(fragment_id);
+    if (_buffer_map.end() != iter) {
+        LOG(WARNING) << "already have buffer control block for this instance " << fragment_id;
+        if (iter->second.size() != static_cast<size_t>(num_partitions)) {
+            return Status::InternalError("mismatched number of result partitions");
+        }
+        *senders = iter->second;
         return Status::OK();
     }
 
-    std::shared_ptr<BufferControlBlock> control_block(new BufferControlBlock(query_id, buffer_size));
-    {
-        std::lock_guard<std::mutex> l(_lock);
-        _buffer_map.insert(std::make_pair(query_id, control_block));
+    senders->clear();
+    senders->reserve(num_partitions);
+    for (int i = 0; i < num_partitions; ++i) {
+        senders->emplace_back(std::make_shared<BufferControlBlock>(fragment_id, buffer_size));
     }
-    *sender = control_block;
+    _buffer_map.emplace(fragment_id, *senders);
     return Status::OK();
 }
 
-std::shared_ptr<BufferControlBlock> ResultBufferMgr::find_control_block(const TUniqueId& query_id) {
+std::shared_ptr<BufferControlBlock> ResultBufferMgr::find_control_block(const TUniqueId& query_id,
+                                                                        int32_t partition) {
     // TODO(zhaochun): this lock can be bottleneck?
     std::lock_guard<std::mutex> l(_lock);
     BufferMap::iterator iter = _buffer_map.find(query_id);
 
-    if (_buffer_map.end() != iter) {
-        return iter->second;
+    if (_buffer_map.end() != iter && partition >= 0 && static_cast<size_t>(partition) < iter->second.size()) {
+        return iter->second[partition];
     }
 
     return std::shared_ptr<BufferControlBlock>();
 }
 
-Status ResultBufferMgr::fetch_data(const TUniqueId& query_id, TFetchDataResult* result) {
-    std::shared_ptr<BufferControlBlock> cb = find_control_block(query_id);
+Status ResultBufferMgr::fetch_data(const TUniqueId& query_id, int32_t partition, TFetchDataResult* result) {
+    std::shared_ptr<BufferControlBlock> cb = find_control_block(query_id, partition);
 
     if (nullptr == cb) {
         // the sender tear down its buffer block
@@ -93,13 +112,13 @@ Status ResultBufferMgr::fetch_data(const TUniqueId& query_id, TFetchDataResult*
     return cb->get_batch(result);
 }
 
-void ResultBufferMgr::fetch_data(const PUniqueId& finst_id, GetResultBatchCtx* ctx) {
+void ResultBufferMgr::fetch_data(const PUniqueId& finst_id, int32_t partition, GetResultBatchCtx* ctx) {
     TUniqueId tid;
     tid.__set_hi(finst_id.hi());
     tid.__set_lo(finst_id.lo());
-    std::shared_ptr<BufferControlBlock> cb = find_control_block(tid);
+    std::shared_ptr<BufferControlBlock> cb = find_control_block(tid, partition);
     if (cb == nullptr) {
-        LOG(WARNING) << "no result for this query, id=" << tid;
+        LOG(WARNING) << "no result for this query, id=" << tid << ", partition=" << partition;
         ctx->on_failure(Status::InternalError("no result for this query"));
         return;
     }
@@ -111,7 +130,9 @@ Status ResultBufferMgr::cancel(const TUniqueId& query_id) {
     BufferMap::iterator iter = _buffer_map.find(query_id);
 
     if (_buffer_map.end() != iter) {
-        iter->second->cancel();
+        for (auto& control_block : iter->second) {
+            control_block->cancel();
+        }
         _buffer_map.erase(iter);
     }
 
@@ -49,22 +49,27 @@ public:
     // the returned sender do not need release
     // sender is not used when call cancel or unregister
     Status create_sender(const TUniqueId& query_id, int buffer_size, std::shared_ptr<BufferControlBlock>* sender);
+    // create |num_partitions| result senders for this fragment instance, each one fetched with its own
+    // partition, so that the results of an instance can be fetched in parallel.
+    Status create_senders(const TUniqueId& fragment_id, int num_partitions, int buffer_size,
+                          std::vector<std::shared_ptr<BufferControlBlock>>* senders);
     // fetch data, used by RPC
-    Status fetch_data(const TUniqueId& fragment_id, TFetchDataResult* result);
+    Status fetch_data(const TUniqueId& fragment_id, int32_t partition, TFetchDataResult* result);
 
-    void fetch_data(const PUniqueId& finst_id, GetResultBatchCtx* ctx);
+    void fetch_data(const PUniqueId& finst_id, int32_t partition, GetResultBatchCtx* ctx);
 
-    // cancel
+    // cancel all the partitions of the fragment instance
     Status cancel(const TUniqueId& fragment_id);
 
     // cancel one query at a future time.
     Status cancel_at_time(time_t cancel_time, const TUniqueId& query_id);
 
 private:
-    typedef std::unordered_map<TUniqueId, std::shared_ptr<BufferControlBlock>> BufferMap;
+    // the result senders of a fragment instance, indexed by partition
+    typedef std::unordered_map<TUniqueId, std::vector<std::shared_ptr<BufferControlBlock>>> BufferMap;
     typedef std::map<time_t, std::vector<TUniqueId>> TimeoutMap;
 
-    std::shared_ptr<BufferControlBlock> find_control_block(const TUniqueId& query_id);
+    std::shared_ptr<BufferControlBlock> find_control_block(const TUniqueId& query_id, int32_t partition);
 
     // used to erase the buffer that fe not clears
     // when fe crush, this thread clear the buffer avoid memory leak in this backend
@@ -25,6 +25,7 @@
 
 #include "common/config.h"
 #include "exprs/expr.h"
+#include "runtime/arrow_result_writer.h"
 #include "runtime/buffer_control_block.h"
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
@@ -47,6 +48,9 @@ ResultSink::ResultSink(const RowDescriptor& row_desc, const std::vector<TExpr>&
     } else {
         _sink_type = sink.type;
     }
+    if (sink.__isset.num_result_partitions && sink.num_result_partitions > 1) {
+        _num_result_partitions = sink.num_result_partitions;
+    }
 
     if (_sink_type == TResultSinkType::FILE) {
         CHECK(sink.__isset.file_options);
@@ -93,6 +97,9 @@ Status ResultSink::prepare(RuntimeState* state) {
     case TResultSinkType::VARIABLE:
         _writer.reset(new (std::nothrow) vectorized::VariableResultWriter(_sender.get(), _output_expr_ctxs, _profile));
         break;
+    case TResultSinkType::ARROW:
+        _writer.reset(new (std::nothrow) ArrowResultWriter(_sender.get(), _output_expr_ctxs, _profile));
+        break;
     default:
         return Status::InternalError("Unknown result sink type");
     }
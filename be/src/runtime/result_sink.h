@@ -60,11 +60,15 @@ public:
 
     TResultSinkType::type get_sink_type() const { return _sink_type; }
 
+    int32_t get_num_result_partitions() const { return _num_result_partitions; }
+
     const std::vector<TExpr>& get_output_exprs() const { return _t_output_expr; }
 
 private:
     Status prepare_exprs(RuntimeState* state);
     TResultSinkType::type _sink_type;
+    // the number of result buffers, only used by the pipeline engine
+    int32_t _num_result_partitions = 1;
     // set file options when sink type is FILE
     std::unique_ptr<ResultFileOptions> _file_opts;
 
@@ -21,8 +21,13 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "column/vectorized_fwd.h"
 #include "common/status.h"
+#include "common/statusor.h"
+#include "gen_cpp/InternalService_types.h"
 #include "gen_cpp/PlanNodes_types.h"
 
 namespace starrocks {
@@ -30,6 +35,9 @@ namespace starrocks {
 class Status;
 class RuntimeState;
 
+using TFetchDataResultPtr = std::unique_ptr<TFetchDataResult>;
+using TFetchDataResultPtrs = std::vector<TFetchDataResultPtr>;
+
 // abstract class of the result writer
 class ResultWriter {
 public:
@@ -46,6 +54,16 @@ public:
 
     virtual Status close() = 0;
 
+    // The pipeline engine decomposes append_chunk into process_chunk_for_pipeline and try_add_batch
+    // so as not to block on a full result queue, see MysqlResultWriter.
+    virtual StatusOr<TFetchDataResultPtrs> process_chunk_for_pipeline(vectorized::Chunk* chunk) {
+        return Status::NotSupported("process_chunk_for_pipeline is not supported");
+    }
+
+    virtual StatusOr<bool> try_add_batch(TFetchDataResultPtrs& results) {
+        return Status::NotSupported("try_add_batch is not supported");
+    }
+
     int64_t get_written_rows() const { return _written_rows; }
 
 protected:
@@ -27,6 +27,7 @@
 
 #include "common/status.h"
 #include "gutil/strings/split.h"
+#include "runtime/routine_load/kafka_consumer_pipe.h"
 #include "runtime/small_file_mgr.h"
 #include "service/backend_options.h"
 #include "util/defer_op.h"
@@ -175,7 +176,8 @@ Status KafkaDataConsumer::assign_topic_partitions(const std::map<int32_t, int64_
     return Status::OK();
 }
 
-Status KafkaDataConsumer::group_consume(TimedBlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms) {
+Status KafkaDataConsumer::group_consume(TimedBlockingQueue<KafkaMessageBatch*>* queue, int64_t max_running_time_ms,
+                                        bool is_json, char row_delimiter) {
     _last_visit_time = time(nullptr);
     int64_t left_time = max_running_time_ms;
     LOG(INFO) << "start kafka consumer: " << _id << ", grp: " << _grp_id << ", max running time(ms): " << left_time;
@@ -186,6 +188,34 @@ Status KafkaDataConsumer::group_consume(TimedBlockingQueue<RdKafka::Message*>* q
     MonotonicStopWatch consumer_watch;
     MonotonicStopWatch watch;
     watch.start();
+
+    // The msgs are put to queue in batches of about kBatchBytes, and a msg waits in the batch at most
+    // routine_load_kafka_batch_max_wait_ms.
+    constexpr int64_t kBatchBytes = 64 * 1024;
+    std::unique_ptr<KafkaMessageBatch> batch;
+    int64_t batch_start_ms = 0;
+    // Return false if queue is shutdown.
+    auto put_batch = [&]() {
+        if (batch == nullptr) {
+            return true;
+        }
+        int64_t num_messages = batch->num_messages();
+        if (!queue->blocking_put(batch.get())) {
+            batch.reset();
+            return false;
+        }
+        put_rows += num_messages;
+        batch.release(); // release the ownership, batch will be deleted after being processed
+        return true;
+    };
+    auto get_batch = [&]() {
+        if (batch == nullptr) {
+            batch = std::make_unique<KafkaMessageBatch>();
+            batch_start_ms = watch.elapsed_time() / 1000 / 1000;
+        }
+        return batch.get();
+    };
+
     while (true) {
         {
             std::unique_lock<std::mutex> l(_lock);
@@ -202,20 +232,31 @@ Status KafkaDataConsumer::group_consume(TimedBlockingQueue<RdKafka::Message*>* q
         // consume 1 message at a time
         consumer_watch.start();
         int64_t consume_timeout = std::min<int64_t>(left_time, config::routine_load_kafka_timeout_second * 1000);
+        if (batch != nullptr) {
+            int64_t batch_left_time = batch_start_ms + config::routine_load_kafka_batch_max_wait_ms -
+                                      watch.elapsed_time() / 1000 / 1000;
+            consume_timeout = std::max<int64_t>(0, std::min(consume_timeout, batch_left_time));
+        }
         std::unique_ptr<RdKafka::Message> msg(_k_consumer->consume(consume_timeout /* timeout, ms */));
         consumer_watch.stop();
         switch (msg->err()) {
-        case RdKafka::ERR_NO_ERROR:
-            if (!queue->blocking_put(msg.get())) {
-                // queue is shutdown
-                done = true;
+        case RdKafka::ERR_NO_ERROR: {
+            auto* b = get_batch();
+            if (is_json) {
+                b->append_json(static_cast<const char*>(msg->payload()), msg->len());
             } else {
-                ++put_rows;
-                msg.release(); // release the ownership, msg will be deleted after being processed
+                b->append_with_row_delimiter(static_cast<const char*>(msg->payload()), msg->len(), row_delimiter);
             }
+            b->cmt_offset()[msg->partition()] = msg->offset();
             ++received_rows;
+            VLOG(3) << "consume partition[" << msg->partition() << " - " << msg->offset() << "]";
             break;
+        }
         case RdKafka::ERR__TIMED_OUT: {
+            if (batch != nullptr) {
+                // The batch has waited long enough.
+                break;
+            }
             // leave the status as OK, because this may happened
             // if there is no data in kafka.
             std::stringstream ss;
@@ -238,15 +279,18 @@ Status KafkaDataConsumer::group_consume(TimedBlockingQueue<RdKafka::Message*>* q
             // so we use the offset of eof to compute the last offset.
             //
             // The last offset of partition = `offset of eof` - 1
-            // The goal of put the EOF msg to queue is that:
-            // we will calculate the last offset of the partition using offset of EOF msg
-            if (!queue->blocking_put(msg.get())) {
-                done = true;
-            } else if (_non_eof_partition_count <= 0) {
-                msg.release();
+            //
+            // if msg->offset == 0, don't record into cmt_offset,
+            // because the fe will +1 and then consume the next msg.
+            //
+            // Our offset recorded in the kafka is the offset of last consumed msg,
+            // but the standard usage is to record the last offset + 1.
+            if (msg->offset() > 0) {
+                get_batch()->cmt_offset()[msg->partition()] = msg->offset() - 1;
+            }
+            // Put the EOF to queue at once, so that the consumer group knows the last offset of the partition.
+            if (!put_batch() || _non_eof_partition_count <= 0) {
                 done = true;
-            } else {
-                msg.release();
             }
             break;
         }
@@ -258,10 +302,17 @@ Status KafkaDataConsumer::group_consume(TimedBlockingQueue<RdKafka::Message*>* q
         }
 
         left_time = max_running_time_ms - watch.elapsed_time() / 1000 / 1000;
+        if (!done && batch != nullptr &&
+            (batch->message_bytes() >= kBatchBytes ||
+             watch.elapsed_time() / 1000 / 1000 - batch_start_ms >= config::routine_load_kafka_batch_max_wait_ms ||
+             left_time <= 0)) {
+            done = !put_batch();
+        }
         if (done) {
             break;
         }
     }
+    put_batch();
 
     LOG(INFO) << "kafka consume done: " << _id << ", grp: " << _grp_id << ". cancelled: " << _cancelled
               << ", left time(ms): " << left_time << ", total cost(ms): " << watch.elapsed_time() / 1000 / 1000
@@ -33,6 +33,7 @@
 namespace starrocks {
 
 class KafkaConsumerPipe;
+class KafkaMessageBatch;
 class Status;
 class StreamLoadPipe;
 
@@ -131,8 +132,10 @@ public:
     Status assign_topic_partitions(const std::map<int32_t, int64_t>& begin_partition_offset, const std::string& topic,
                                    StreamLoadContext* ctx);
 
-    // start the consumer and put msgs to queue
-    Status group_consume(TimedBlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms);
+    // start the consumer and put the msgs to queue in batches, the msgs are json documents if |is_json|, or csv
+    // rows delimited by |row_delimiter| otherwise
+    Status group_consume(TimedBlockingQueue<KafkaMessageBatch*>* queue, int64_t max_running_time_ms, bool is_json,
+                         char row_delimiter);
 
     // get the partitions ids of the topic
     Status get_partition_meta(std::vector<int32_t>* partition_ids, int timeout);
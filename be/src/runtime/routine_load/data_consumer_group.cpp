@@ -55,10 +55,9 @@ KafkaDataConsumerGroup::~KafkaDataConsumerGroup() {
     // clean the msgs left in queue
     _queue.shutdown();
     while (true) {
-        RdKafka::Message* msg;
-        if (_queue.blocking_get(&msg)) {
-            delete msg;
-            msg = nullptr;
+        KafkaMessageBatch* batch;
+        if (_queue.blocking_get(&batch)) {
+            delete batch;
         } else {
             break;
         }
@@ -67,10 +66,25 @@ KafkaDataConsumerGroup::~KafkaDataConsumerGroup() {
 }
 
 Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
+    bool is_json = ctx->format == TFileFormatType::FORMAT_JSON;
+    char row_delimiter = '\n';
+    if (!is_json) {
+        auto& per_node_scan_ranges = ctx->put_result.params.params.per_node_scan_ranges;
+
+        if (!per_node_scan_ranges.empty()) {
+            DCHECK_GE(per_node_scan_ranges.begin()->second.size(), 1);
+
+            auto& scan_range = per_node_scan_ranges.begin()->second[0].scan_range;
+            auto& params = scan_range.broker_scan_range.params;
+            row_delimiter = static_cast<char>(params.row_delimiter);
+        }
+    }
+
     Status result_st = Status::OK();
     // start all consumers
     for (auto& consumer : _consumers) {
-        if (!_thread_pool.offer([this, consumer, capture0 = &_queue, capture1 = ctx->max_interval_s * 1000,
+        if (!_thread_pool.offer([this, consumer, is_json, row_delimiter, capture0 = &_queue,
+                                 capture1 = ctx->max_interval_s * 1000,
                                  capture2 = [this, &result_st](const Status& st) {
                                      std::unique_lock<std::mutex> lock(_mutex);
                                      _counter--;
@@ -83,7 +97,9 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
                                      if (result_st.ok() && !st.ok()) {
                                          result_st = st;
                                      }
-                                 }] { actual_consume(consumer, capture0, capture1, capture2); })) {
+                                 }] {
+                actual_consume(consumer, capture0, capture1, is_json, row_delimiter, capture2);
+            })) {
             LOG(WARNING) << "failed to submit data consumer: " << consumer->id() << ", group id: " << _grp_id;
             return Status::InternalError("failed to submit data consumer");
         } else {
@@ -104,24 +120,6 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
     // copy one
     std::map<int32_t, int64_t> cmt_offset = ctx->kafka_info->cmt_offset;
 
-    //improve performance
-    Status (KafkaConsumerPipe::*append_data)(const char* data, size_t size, char row_delimiter);
-    char row_delimiter = '\n';
-    if (ctx->format == TFileFormatType::FORMAT_JSON) {
-        append_data = &KafkaConsumerPipe::append_json;
-    } else {
-        append_data = &KafkaConsumerPipe::append_with_row_delimiter;
-        auto& per_node_scan_ranges = ctx->put_result.params.params.per_node_scan_ranges;
-
-        if (!per_node_scan_ranges.empty()) {
-            DCHECK_GE(per_node_scan_ranges.begin()->second.size(), 1);
-
-            auto& scan_range = per_node_scan_ranges.begin()->second[0].scan_range;
-            auto& params = scan_range.broker_scan_range.params;
-            row_delimiter = static_cast<char>(params.row_delimiter);
-        }
-    }
-
     MonotonicStopWatch watch;
     watch.start();
     bool eos = false;
@@ -175,48 +173,33 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
             }
         }
 
-        RdKafka::Message* msg;
-        bool res = _queue.blocking_get(&msg);
+        KafkaMessageBatch* batch;
+        bool res = _queue.blocking_get(&batch);
         if (res) {
-            VLOG(3) << "get kafka message"
-                    << ", partition: " << msg->partition() << ", offset: " << msg->offset() << ", len: " << msg->len();
-
-            if (msg->err() == RdKafka::ERR__PARTITION_EOF) {
-                // For transaction producer, producer will append one control msg to the group of msgs,
-                // but the control msg will not return to consumer,
-                // so we use the offset of eof to compute the last offset.
-                // The last offset of partition = `offset of eof` - 1
-                //
-                // if msg->offset == 0, don't record into cmt_offset,
-                // because the fe will +1 and then consume the next msg.
-                //
-                // Our offset recorded in the kafka is the offset of last consumed msg,
-                // but the standard usage is to record the last offset + 1.
-                if (msg->offset() > 0) {
-                    cmt_offset[msg->partition()] = msg->offset() - 1;
+            std::unique_ptr<KafkaMessageBatch> batch_guard(batch);
+            VLOG(3) << "get kafka message batch, msgs: " << batch->num_messages()
+                    << ", bytes: " << batch->message_bytes();
+
+            // The buffers of the batch are moved to the pipe, rather than copied.
+            Status st = kafka_pipe->append_batch(batch);
+            if (st.ok()) {
+                received_rows += batch->num_messages();
+                left_bytes -= batch->message_bytes();
+                // The consumer of a partition has already computed its offset to commit, see group_consume().
+                for (const auto& [partition, offset] : batch->cmt_offset()) {
+                    cmt_offset[partition] = offset;
                 }
             } else {
-                Status st = (kafka_pipe.get()->*append_data)(static_cast<const char*>(msg->payload()),
-                                                             static_cast<size_t>(msg->len()), row_delimiter);
-                if (st.ok()) {
-                    received_rows++;
-                    left_bytes -= msg->len();
-                    cmt_offset[msg->partition()] = msg->offset();
-                    VLOG(3) << "consume partition[" << msg->partition() << " - " << msg->offset() << "]";
-                } else {
-                    // failed to append this msg, we must stop
-                    LOG(WARNING) << "failed to append msg to pipe. grp: " << _grp_id
-                                 << ", errmsg=" << st.get_error_msg();
-                    eos = true;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        if (result_st.ok()) {
-                            result_st = st;
-                        }
+                // failed to append this msg, we must stop
+                LOG(WARNING) << "failed to append msg to pipe. grp: " << _grp_id << ", errmsg=" << st.get_error_msg();
+                eos = true;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    if (result_st.ok()) {
+                        result_st = st;
                     }
                 }
             }
-            delete msg;
         } else {
             // queue is empty and shutdown
             eos = true;
@@ -229,9 +212,10 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
 }
 
 void KafkaDataConsumerGroup::actual_consume(const std::shared_ptr<DataConsumer>& consumer,
-                                            TimedBlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms,
-                                            const ConsumeFinishCallback& cb) {
-    Status st = std::static_pointer_cast<KafkaDataConsumer>(consumer)->group_consume(queue, max_running_time_ms);
+                                            TimedBlockingQueue<KafkaMessageBatch*>* queue, int64_t max_running_time_ms,
+                                            bool is_json, char row_delimiter, const ConsumeFinishCallback& cb) {
+    Status st = std::static_pointer_cast<KafkaDataConsumer>(consumer)->group_consume(queue, max_running_time_ms,
+                                                                                     is_json, row_delimiter);
     cb(st);
 }
 
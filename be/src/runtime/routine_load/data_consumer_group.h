@@ -67,7 +67,7 @@ protected:
 // for kafka
 class KafkaDataConsumerGroup : public DataConsumerGroup {
 public:
-    KafkaDataConsumerGroup(size_t sz) : DataConsumerGroup(sz), _queue(500) {}
+    KafkaDataConsumerGroup(size_t sz) : DataConsumerGroup(sz), _queue(100) {}
 
     ~KafkaDataConsumerGroup() override;
 
@@ -77,12 +77,13 @@ public:
 
 private:
     // start a single consumer
-    void actual_consume(const std::shared_ptr<DataConsumer>& consumer, TimedBlockingQueue<RdKafka::Message*>* queue,
-                        int64_t max_running_time_ms, const ConsumeFinishCallback& cb);
+    void actual_consume(const std::shared_ptr<DataConsumer>& consumer, TimedBlockingQueue<KafkaMessageBatch*>* queue,
+                        int64_t max_running_time_ms, bool is_json, char row_delimiter,
+                        const ConsumeFinishCallback& cb);
 
 private:
-    // blocking queue to receive msgs from all consumers
-    TimedBlockingQueue<RdKafka::Message*> _queue;
+    // blocking queue to receive the batches of msgs from all consumers
+    TimedBlockingQueue<KafkaMessageBatch*> _queue;
 };
 
 } // end namespace starrocks
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <map>
 #include <string>
@@ -33,6 +34,69 @@
 
 namespace starrocks {
 
+// The messages consumed by a KafkaDataConsumer, in the format of the pipe, which are put to a KafkaConsumerPipe
+// together. A consumer copies its messages into a batch in its own thread, so that the consumer group thread
+// puts the buffers of the batches into the pipe without copying them.
+class KafkaMessageBatch {
+public:
+    explicit KafkaMessageBatch(size_t min_chunk_size = 64 * 1024) : _min_chunk_size(min_chunk_size) {}
+
+    // Concatenate the csv message and the row delimiter to the last buffer.
+    void append_with_row_delimiter(const char* data, size_t size, char row_delimiter) {
+        if (_write_buf == nullptr || _write_buf->capacity - _write_buf->pos < size + 1) {
+            _seal_write_buf();
+            _write_buf = ByteBuffer::allocate(BitUtil::RoundUpToPowerOfTwo(std::max(_min_chunk_size, size + 1)));
+        }
+        _write_buf->put_bytes(data, size);
+        _write_buf->put_bytes(&row_delimiter, 1);
+        _add_message(size);
+    }
+
+    // Put the json message in a buffer of its own.
+    void append_json(const char* data, size_t size) {
+        // For efficiency reasons, simdjson requires a string with a few bytes (simdjson::SIMDJSON_PADDING) at the end.
+        auto buf = ByteBuffer::allocate(size + simdjson::SIMDJSON_PADDING);
+        buf->put_bytes(data, size);
+        buf->flip();
+        _bufs.emplace_back(std::move(buf));
+        _add_message(size);
+    }
+
+    // Seal the last buffer and return all the buffers.
+    std::vector<ByteBufferPtr>& bufs() {
+        _seal_write_buf();
+        return _bufs;
+    }
+
+    // The offsets to commit of the partitions, updated by the messages in the batch and by the EOFs.
+    std::map<int32_t, int64_t>& cmt_offset() { return _cmt_offset; }
+
+    int64_t num_messages() const { return _num_messages; }
+    // The bytes of the messages, without the row delimiters and the paddings.
+    int64_t message_bytes() const { return _message_bytes; }
+
+private:
+    void _add_message(size_t size) {
+        ++_num_messages;
+        _message_bytes += size;
+    }
+
+    void _seal_write_buf() {
+        if (_write_buf != nullptr) {
+            _write_buf->flip();
+            _bufs.emplace_back(std::move(_write_buf));
+            _write_buf.reset();
+        }
+    }
+
+    const size_t _min_chunk_size;
+    std::vector<ByteBufferPtr> _bufs;
+    ByteBufferPtr _write_buf;
+    std::map<int32_t, int64_t> _cmt_offset;
+    int64_t _num_messages = 0;
+    int64_t _message_bytes = 0;
+};
+
 class KafkaConsumerPipe : public StreamLoadPipe {
 public:
     KafkaConsumerPipe(size_t max_buffered_bytes = 1024 * 1024, size_t min_chunk_size = 64 * 1024)
@@ -58,6 +122,13 @@ public:
         buf->flip();
         return append(std::move(buf));
     }
+
+    Status append_batch(KafkaMessageBatch* batch) {
+        for (auto& buf : batch->bufs()) {
+            RETURN_IF_ERROR(append(std::move(buf)));
+        }
+        return Status::OK();
+    }
 };
 
 } // end namespace starrocks
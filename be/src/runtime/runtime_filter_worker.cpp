@@ -218,6 +218,10 @@ void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& par
     }
 
     int64_t now = UnixMillis();
+    _drop_stale_runtime_filters(now);
+    if (status->stop) {
+        return;
+    }
     if (status->recv_first_filter_ts == 0) {
         status->recv_first_filter_ts = now;
     }
@@ -254,6 +258,24 @@ void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& par
     _send_total_runtime_filter(filter_id, rpc_closure);
 }
 
+void RuntimeFilterMerger::_drop_stale_runtime_filters(int64_t now) {
+    int64_t timeout_ms = config::runtime_filter_merge_timeout_ms;
+    if (timeout_ms <= 0) {
+        return;
+    }
+    for (auto& [filter_id, status] : _statuses) {
+        if (status.stop || status.recv_first_filter_ts == 0 || now - status.recv_first_filter_ts <= timeout_ms) {
+            continue;
+        }
+        VLOG_FILE << "RuntimeFilterMerger::merge_runtime_filter. stop building since timeout. filter_id = "
+                  << filter_id << ", received = " << status.filters.size() << "/" << status.expect_number;
+        _exec_env->add_rf_event({_query_id.to_proto(), filter_id, "", "DROP_STALE_PART_RF"});
+        status.stop = true;
+        status.filters.clear();
+        status.pool.clear();
+    }
+}
+
 void RuntimeFilterMerger::_send_total_runtime_filter(int32_t filter_id, RuntimeFilterRpcClosure* rpc_closure) {
     auto status_it = _statuses.find(filter_id);
     DCHECK(status_it != _statuses.end());
@@ -419,13 +441,36 @@ public:
 
 static_assert(std::is_move_assignable<RuntimeFilterWorkerEvent>::value);
 
-RuntimeFilterWorker::RuntimeFilterWorker(ExecEnv* env) : _exec_env(env), _thread([this] { execute(); }) {
-    Thread::set_thread_name(_thread, "runtime_filter");
+RuntimeFilterWorker::RuntimeFilterWorker(ExecEnv* env) : _exec_env(env) {
+    size_t num_shards = std::max<int32_t>(1, config::runtime_filter_worker_num);
+    for (size_t i = 0; i < num_shards; i++) {
+        _shards.emplace_back(std::make_unique<Shard>());
+    }
+    // Start the threads after all the shards are created, the events may be put to any of them.
+    for (size_t i = 0; i < num_shards; i++) {
+        _shards[i]->thread = std::thread([this, i] { execute(i); });
+        Thread::set_thread_name(_shards[i]->thread, "runtime_filter");
+    }
 }
 
 RuntimeFilterWorker::~RuntimeFilterWorker() {
-    _queue.shutdown();
-    _thread.join();
+    for (auto& shard : _shards) {
+        shard->queue.shutdown();
+    }
+    for (auto& shard : _shards) {
+        shard->thread.join();
+    }
+}
+
+void RuntimeFilterWorker::_put_event(int32_t filter_id, RuntimeFilterWorkerEvent&& ev) {
+    size_t shard_index = static_cast<uint32_t>(filter_id) % _shards.size();
+    _shards[shard_index]->queue.put(std::move(ev));
+}
+
+void RuntimeFilterWorker::_put_event_to_all_shards(const RuntimeFilterWorkerEvent& ev) {
+    for (auto& shard : _shards) {
+        shard->queue.put(ev);
+    }
 }
 
 void RuntimeFilterWorker::open_query(const TUniqueId& query_id, const TQueryOptions& query_options,
@@ -437,7 +482,7 @@ void RuntimeFilterWorker::open_query(const TUniqueId& query_id, const TQueryOpti
     ev.query_options = query_options;
     ev.create_rf_merger_request = params;
     ev.is_opened_by_pipeline = is_pipeline;
-    _queue.put(std::move(ev));
+    _put_event_to_all_shards(ev);
 }
 
 void RuntimeFilterWorker::close_query(const TUniqueId& query_id) {
@@ -445,7 +490,7 @@ void RuntimeFilterWorker::close_query(const TUniqueId& query_id) {
     RuntimeFilterWorkerEvent ev;
     ev.type = CLOSE_QUERY;
     ev.query_id = query_id;
-    _queue.put(std::move(ev));
+    _put_event_to_all_shards(ev);
 }
 
 void RuntimeFilterWorker::send_part_runtime_filter(PTransmitRuntimeFilterParams&& params,
@@ -456,7 +501,8 @@ void RuntimeFilterWorker::send_part_runtime_filter(PTransmitRuntimeFilterParams&
     ev.transmit_timeout_ms = timeout_ms;
     ev.transmit_addrs = addrs;
     ev.transmit_rf_request = std::move(params);
-    _queue.put(std::move(ev));
+    int32_t filter_id = ev.transmit_rf_request.filter_id();
+    _put_event(filter_id, std::move(ev));
 }
 
 void RuntimeFilterWorker::send_broadcast_runtime_filter(PTransmitRuntimeFilterParams&& params,
@@ -468,7 +514,8 @@ void RuntimeFilterWorker::send_broadcast_runtime_filter(PTransmitRuntimeFilterPa
     ev.transmit_timeout_ms = timeout_ms;
     ev.destinations = destinations;
     ev.transmit_rf_request = std::move(params);
-    _queue.put(std::move(ev));
+    int32_t filter_id = ev.transmit_rf_request.filter_id();
+    _put_event(filter_id, std::move(ev));
 }
 
 void RuntimeFilterWorker::receive_runtime_filter(const PTransmitRuntimeFilterParams& params) {
@@ -488,7 +535,7 @@ void RuntimeFilterWorker::receive_runtime_filter(const PTransmitRuntimeFilterPar
     ev.query_id.hi = params.query_id().hi();
     ev.query_id.lo = params.query_id().lo();
     ev.transmit_rf_request = params;
-    _queue.put(std::move(ev));
+    _put_event(params.filter_id(), std::move(ev));
 }
 // receive total runtime filter in pipeline engine.
 static inline Status receive_total_runtime_filter_pipeline(
@@ -730,15 +777,17 @@ void RuntimeFilterWorker::_deliver_broadcast_runtime_filter_local(PTransmitRunti
     _receive_total_runtime_filter(param, nullptr);
 }
 
-void RuntimeFilterWorker::execute() {
-    LOG(INFO) << "RuntimeFilterWorker start working.";
+void RuntimeFilterWorker::execute(size_t shard_index) {
+    LOG(INFO) << "RuntimeFilterWorker start working. shard = " << shard_index;
+    auto& queue = _shards[shard_index]->queue;
+    auto& mergers = _shards[shard_index]->mergers;
     RuntimeFilterRpcClosure* rpc_closure = new RuntimeFilterRpcClosure();
     rpc_closure->ref();
     DeferOp deferop([&] { rpc_closure->Run(); });
 
     for (;;) {
         RuntimeFilterWorkerEvent ev;
-        if (!_queue.blocking_get(&ev)) {
+        if (!queue.blocking_get(&ev)) {
             break;
         }
         switch (ev.type) {
@@ -748,16 +797,16 @@ void RuntimeFilterWorker::execute() {
         }
 
         case CLOSE_QUERY: {
-            auto it = _mergers.find(ev.query_id);
-            if (it != _mergers.end()) {
-                _mergers.erase(it);
+            auto it = mergers.find(ev.query_id);
+            if (it != mergers.end()) {
+                mergers.erase(it);
             }
             break;
         }
 
         case OPEN_QUERY: {
-            auto it = _mergers.find(ev.query_id);
-            if (it != _mergers.end()) {
+            auto it = mergers.find(ev.query_id);
+            if (it != mergers.end()) {
                 VLOG_QUERY << "open query: rf merger already existed. query_id = " << ev.query_id;
                 break;
             }
@@ -767,13 +816,13 @@ void RuntimeFilterWorker::execute() {
                 VLOG_QUERY << "open query: rf merger initialization failed. error = " << st.get_error_msg();
                 break;
             }
-            _mergers.insert(std::make_pair(ev.query_id, std::move(merger)));
+            mergers.insert(std::make_pair(ev.query_id, std::move(merger)));
             break;
         }
 
         case RECEIVE_PART_RF: {
-            auto it = _mergers.find(ev.query_id);
-            if (it == _mergers.end()) {
+            auto it = mergers.find(ev.query_id);
+            if (it == mergers.end()) {
                 VLOG_QUERY << "receive part rf: rf merger not existed. query_id = " << ev.query_id;
                 break;
             }
@@ -4,7 +4,9 @@
 
 #include <atomic>
 #include <map>
+#include <memory>
 #include <thread>
+#include <vector>
 
 #include "common/global_types.h"
 #include "common/object_pool.h"
@@ -87,6 +89,9 @@ public:
     void merge_runtime_filter(PTransmitRuntimeFilterParams& params, RuntimeFilterRpcClosure* rpc_closure);
 
 private:
+    // Stop merging the filters whose first partitioned RF arrived runtime_filter_merge_timeout_ms before |now|
+    // and release what they have received, the probe side has most likely finished without them.
+    void _drop_stale_runtime_filters(int64_t now);
     void _send_total_runtime_filter(int32_t filter_id, RuntimeFilterRpcClosure* rpc_closure);
     // filter_id -> where this filter should send to
     std::map<int32_t, std::vector<TRuntimeFilterProberParams>> _targets;
@@ -97,9 +102,14 @@ private:
     const bool _is_pipeline;
 };
 
-// RuntimeFilterWorker works in a separated thread, and does following jobs:
+// RuntimeFilterWorker works in runtime_filter_worker_num separated threads, and does following jobs:
 // 1. deserialize runtime filters.
 // 2. merge runtime filters.
+//
+// Each thread has its own event queue and runtime filter mergers, and the events of a runtime filter always go to
+// the thread of filter_id % runtime_filter_worker_num, so the partitioned RFs of a filter are merged by one thread
+// without locks, while the different filters are merged and sent in parallel. The queries are opened and closed
+// in all the threads.
 
 // it works in a event-driven way, and possible events are:
 // - create a runtime filter merger for a query
@@ -117,7 +127,7 @@ public:
                     bool is_pipeline);
     void close_query(const TUniqueId& query_id);
     void receive_runtime_filter(const PTransmitRuntimeFilterParams& params);
-    void execute();
+    void execute(size_t shard_index);
     void send_part_runtime_filter(PTransmitRuntimeFilterParams&& params,
                                   const std::vector<starrocks::TNetworkAddress>& addrs, int timeout_ms);
     void send_broadcast_runtime_filter(PTransmitRuntimeFilterParams&& params,
@@ -136,11 +146,17 @@ private:
     void _deliver_broadcast_runtime_filter_local(PTransmitRuntimeFilterParams& params,
                                                  const TRuntimeFilterDestination& destinations);
 
-    UnboundedBlockingQueue<RuntimeFilterWorkerEvent> _queue;
-    std::unordered_map<TUniqueId, RuntimeFilterMerger> _mergers;
+    struct Shard {
+        UnboundedBlockingQueue<RuntimeFilterWorkerEvent> queue;
+        std::unordered_map<TUniqueId, RuntimeFilterMerger> mergers;
+        std::thread thread;
+    };
+
+    void _put_event(int32_t filter_id, RuntimeFilterWorkerEvent&& ev);
+    void _put_event_to_all_shards(const RuntimeFilterWorkerEvent& ev);
+
     ExecEnv* _exec_env;
-    std::atomic<bool> _stop;
-    std::thread _thread;
+    std::vector<std::unique_ptr<Shard>> _shards;
 };
 
 }; // namespace starrocks
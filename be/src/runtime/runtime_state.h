@@ -371,6 +371,8 @@ private:
     int64_t _load_job_id = 0;
 
     std::string _error_log_file_path;
+    // Lock protecting _error_log_file, which is written by the scanners of a scan node concurrently
+    std::mutex _error_log_file_lock;
     std::ofstream* _error_log_file = nullptr; // error file path, absolute path
     std::vector<TTabletCommitInfo> _tablet_commit_infos;
 
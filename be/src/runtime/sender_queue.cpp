@@ -3,6 +3,7 @@
 #include "runtime/sender_queue.h"
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "gen_cpp/data.pb.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "runtime/current_thread.h"
@@ -639,7 +640,8 @@ Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkPara
 
         auto& chunk_queues = _buffered_chunk_queues[be_number];
 
-        if (!chunks.empty() && done != nullptr && _recvr->exceeds_limit(total_chunk_bytes)) {
+        if (!chunks.empty() && done != nullptr && _recvr->exceeds_limit(total_chunk_bytes) &&
+            !in_prefetch_window()) {
             chunks.back().closure = *done;
             chunks.back().queue_enter_time = MonotonicNanos();
             COUNTER_UPDATE(_recvr->_closure_block_counter, 1);
@@ -687,7 +689,8 @@ Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkPara
             }
             iter++;
         }
-        if (!chunks.empty() && done != nullptr && _recvr->exceeds_limit(total_chunk_bytes)) {
+        if (!chunks.empty() && done != nullptr && _recvr->exceeds_limit(total_chunk_bytes) &&
+            !in_prefetch_window()) {
             chunks.back().closure = *done;
             chunks.back().queue_enter_time = MonotonicNanos();
             COUNTER_UPDATE(_recvr->_closure_block_counter, 1);
@@ -767,6 +770,10 @@ bool DataStreamRecvr::PipelineSenderQueue::has_output(const int32_t driver_seque
     return chunk_queue_state.blocked_closure_num > 0;
 }
 
+bool DataStreamRecvr::PipelineSenderQueue::in_prefetch_window() const {
+    return _recvr->_is_merging && _total_chunks < config::exchg_merge_prefetch_chunks;
+}
+
 bool DataStreamRecvr::PipelineSenderQueue::is_finished() const {
     return _is_cancelled || (_num_remaining_senders == 0 && _total_chunks == 0);
 }
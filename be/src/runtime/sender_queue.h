@@ -4,6 +4,7 @@
 #include "column/vectorized_fwd.h"
 #include "runtime/data_stream_recvr.h"
 #include "serde/protobuf_serde.h"
+#include "util/lock_contention_profiler.h"
 #include "util/moodycamel/concurrentqueue.h"
 #include "util/spinlock.h"
 
@@ -189,6 +190,10 @@ private:
 
     void clean_buffer_queues();
 
+    // Whether the chunks of this sender are still in the prefetch window of the merging receiver, which are acked
+    // even if the buffer is full, so that the merge isn't blocked by a sender waiting for the chunks of the others.
+    bool in_prefetch_window() const;
+
     StatusOr<ChunkList> get_chunks_from_pass_through(const int32_t sender_id, size_t& total_chunk_bytes);
 
     template <bool need_deserialization>
@@ -204,8 +209,8 @@ private:
     std::atomic<bool> _is_cancelled{false};
     std::atomic<int> _num_remaining_senders;
 
-    typedef SpinLock Mutex;
-    Mutex _lock;
+    typedef ProfiledMutex<SpinLock> Mutex;
+    Mutex _lock{"pipeline_sender_queue"};
 
     // if _is_pipeline_level_shuffle=true, we will create a queue for each driver sequence to avoid competition
     // otherwise, we will only use the first item
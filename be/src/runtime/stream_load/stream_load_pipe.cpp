@@ -21,6 +21,10 @@
 
 #include "runtime/stream_load/stream_load_pipe.h"
 
+#include <fmt/format.h>
+
+#include <cstring>
+
 namespace starrocks {
 
 Status StreamLoadPipe::append(ByteBufferPtr&& buf) {
@@ -115,6 +119,9 @@ StatusOr<ByteBufferPtr> StreamLoadPipe::no_block_read() {
 }
 
 Status StreamLoadPipe::read(uint8_t* data, size_t* data_size, bool* eof) {
+    if (_read_records) {
+        return _read_whole_records(data, data_size, eof);
+    }
     if (_non_blocking_read) {
         return no_block_read(data, data_size, eof);
     }
@@ -152,6 +159,58 @@ Status StreamLoadPipe::read(uint8_t* data, size_t* data_size, bool* eof) {
     return Status::OK();
 }
 
+Status StreamLoadPipe::_read_whole_records(uint8_t* data, size_t* data_size, bool* eof) {
+    std::lock_guard<std::mutex> records_lock(_records_lock);
+    while (true) {
+        const char* begin = _records.data() + _records_pos;
+        size_t available = _records.size() - _records_pos;
+        // Return the complete records which fit in |data|, or the last record without a delimiter.
+        size_t n = std::min(*data_size, available);
+        const auto* last = static_cast<const char*>(memrchr(begin, _record_delimiter, n));
+        if (last != nullptr || (_records_eof && available > 0 && available <= *data_size)) {
+            n = last != nullptr ? last - begin + 1 : available;
+            memcpy(data, begin, n);
+            _records_pos += n;
+            *data_size = n;
+            *eof = false;
+            return Status::OK();
+        }
+        if (available >= *data_size) {
+            // The record would be split between two readers.
+            return Status::InternalError(
+                    fmt::format("a record of stream load is larger than the read buffer of {} bytes", *data_size));
+        }
+        if (_records_eof) {
+            *data_size = 0;
+            *eof = true;
+            return Status::OK();
+        }
+
+        ByteBufferPtr buf;
+        {
+            std::unique_lock<std::mutex> l(_lock);
+            _get_cond.wait(l, [&]() { return _cancelled || _finished || !_buf_queue.empty(); });
+            // cancelled
+            if (_cancelled) {
+                return _err_st.ok() ? Status::Cancelled("stream load pipe is closed") : _err_st;
+            }
+            // finished
+            if (_buf_queue.empty()) {
+                DCHECK(_finished);
+                _records_eof = true;
+                continue;
+            }
+            buf = std::move(_buf_queue.front());
+            _buf_queue.pop_front();
+            _buffered_bytes -= buf->limit;
+        }
+        _put_cond.notify_one();
+        _records.erase(0, _records_pos);
+        _records_pos = 0;
+        _records.append(buf->ptr + buf->pos, buf->remaining());
+    }
+}
+
 Status StreamLoadPipe::no_block_read(uint8_t* data, size_t* data_size, bool* eof) {
     size_t bytes_read = 0;
     while (bytes_read < *data_size) {
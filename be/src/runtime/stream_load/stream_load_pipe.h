@@ -24,6 +24,7 @@
 #include <condition_variable>
 #include <deque>
 #include <mutex>
+#include <string>
 
 #include "io/input_stream.h"
 #include "runtime/message_body_sink.h"
@@ -69,9 +70,19 @@ public:
 
     void set_non_blocking_read() { _non_blocking_read = true; }
 
+    // Let the concurrent readers of the pipe read whole records delimited by |record_delimiter|, so that each of
+    // them parses a part of the data. Must be called before the pipe is read.
+    void set_record_delimiter(char record_delimiter) {
+        _read_records = true;
+        _record_delimiter = record_delimiter;
+    }
+
 private:
     Status _append(const ByteBufferPtr& buf);
 
+    // read() for the concurrent readers of whole records.
+    Status _read_whole_records(uint8_t* data, size_t* data_size, bool* eof);
+
     // Called when `no_block_read(uint8_t* data, size_t* data_size, bool* eof)`
     // timeout in the mid of read, we will push the read data back to the _buf_queue.
     // The lock is already acquired before calling this function
@@ -94,6 +105,15 @@ private:
     ByteBufferPtr _write_buf;
     ByteBufferPtr _read_buf;
     Status _err_st = Status::OK();
+
+    bool _read_records{false};
+    char _record_delimiter{'\n'};
+    // Protect the records read from |_buf_queue| but not returned yet, i.e. |_records[_records_pos:]|.
+    std::mutex _records_lock;
+    std::string _records;
+    size_t _records_pos{0};
+    // All the records have been returned.
+    bool _records_eof{false};
 };
 
 // TODO: Make `StreamLoadPipe` as a derived class of `io::InputStream`.
@@ -17,6 +17,10 @@ namespace brpc {
 class Controller;
 }
 
+namespace butil {
+class IOBuf;
+}
+
 namespace google::protobuf {
 class Closure;
 };
@@ -28,6 +32,8 @@ class OlapTableSchemaParam;
 class PTabletWriterOpenRequest;
 class PTabletWriterAddBatchResult;
 class PTabletWriterAddChunkRequest;
+class PTabletWriterAddSegmentRequest;
+class PTabletWriterAddSegmentResult;
 
 class TabletsChannel {
 public:
@@ -41,6 +47,10 @@ public:
                            PTabletWriterAddBatchResult* response) = 0;
 
     virtual void cancel() = 0;
+
+    // Receive a file of the rowset replicated from the primary replica of a tablet, |data| is the content.
+    virtual void add_segment(const PTabletWriterAddSegmentRequest& request, butil::IOBuf* data,
+                             PTabletWriterAddSegmentResult* response) = 0;
 };
 
 struct TabletsChannelKey {
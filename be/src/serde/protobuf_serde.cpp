@@ -22,7 +22,11 @@ int64_t ProtobufChunkSerde::max_serialized_size(const vectorized::Chunk& chunk)
 StatusOr<ChunkPB> ProtobufChunkSerde::serialize(const vectorized::Chunk& chunk) {
     StatusOr<ChunkPB> res = serialize_without_meta(chunk);
     if (!res.ok()) return res.status();
+    serialize_meta(chunk, &res.value());
+    return res;
+}
 
+void ProtobufChunkSerde::serialize_meta(const vectorized::Chunk& chunk, ChunkPB* res) {
     const auto& slot_id_to_index = chunk.get_slot_id_to_index_map();
     const auto& tuple_id_to_index = chunk.get_tuple_id_to_index_map();
     const auto& columns = chunk.columns();
@@ -50,27 +54,34 @@ StatusOr<ChunkPB> ProtobufChunkSerde::serialize(const vectorized::Chunk& chunk)
     }
 
     DCHECK_EQ(columns.size(), tuple_id_to_index.size() + slot_id_to_index.size());
-    return res;
 }
 
 StatusOr<ChunkPB> ProtobufChunkSerde::serialize_without_meta(const vectorized::Chunk& chunk) {
     ChunkPB chunk_pb;
-    chunk_pb.set_compress_type(CompressionTypePB::NO_COMPRESSION);
-
     std::string* serialized_data = chunk_pb.mutable_data();
-    raw::stl_string_resize_uninitialized(serialized_data, ProtobufChunkSerde::max_serialized_size(chunk));
-    auto* buff = reinterpret_cast<uint8_t*>(serialized_data->data());
-    encode_fixed32_le(buff + 0, 1);
-    encode_fixed32_le(buff + 4, chunk.num_rows());
-    buff = buff + 8;
+    int64_t size = ProtobufChunkSerde::max_serialized_size(chunk);
+    raw::stl_string_resize_uninitialized(serialized_data, size);
+    RETURN_IF_ERROR(serialize_data(chunk, reinterpret_cast<uint8_t*>(serialized_data->data()), size, &chunk_pb));
+    return std::move(chunk_pb);
+}
+
+Status ProtobufChunkSerde::serialize_data(const vectorized::Chunk& chunk, uint8_t* buff, int64_t size,
+                                          ChunkPB* chunk_pb) {
+    DCHECK_EQ(size, max_serialized_size(chunk));
+    chunk_pb->set_compress_type(CompressionTypePB::NO_COMPRESSION);
+
+    uint8_t* cur = buff;
+    encode_fixed32_le(cur + 0, 1);
+    encode_fixed32_le(cur + 4, chunk.num_rows());
+    cur = cur + 8;
 
     for (const auto& column : chunk.columns()) {
-        buff = ColumnArraySerde::serialize(*column, buff);
-        if (UNLIKELY(buff == nullptr)) return Status::InternalError("has unsupported column");
+        cur = ColumnArraySerde::serialize(*column, cur);
+        if (UNLIKELY(cur == nullptr)) return Status::InternalError("has unsupported column");
     }
-    chunk_pb.set_serialized_size(buff - reinterpret_cast<const uint8_t*>(serialized_data->data()));
-    chunk_pb.set_uncompressed_size(serialized_data->size());
-    return std::move(chunk_pb);
+    chunk_pb->set_serialized_size(cur - buff);
+    chunk_pb->set_uncompressed_size(size);
+    return Status::OK();
 }
 
 StatusOr<vectorized::Chunk> ProtobufChunkSerde::deserialize(const RowDescriptor& row_desc, const ChunkPB& chunk_pb) {
@@ -31,6 +31,13 @@ public:
     //  - is_consts()
     static StatusOr<ChunkPB> serialize_without_meta(const vectorized::Chunk& chunk);
 
+    // Fill the fields of |chunk_pb| left unfilled by `serialize_without_meta()`.
+    static void serialize_meta(const vectorized::Chunk& chunk, ChunkPB* chunk_pb);
+
+    // Like `serialize_without_meta()` but write the data to |buff| of |size| bytes instead of ChunkPB::data(),
+    // |size| must be `max_serialized_size(chunk)`. The data of |chunk_pb| is left unset.
+    static Status serialize_data(const vectorized::Chunk& chunk, uint8_t* buff, int64_t size, ChunkPB* chunk_pb);
+
     // REQUIRE: the following fields of |chunk_pb| must be non-empty:
     //  - slot_id_map()
     //  - tuple_id_map()
@@ -109,7 +109,8 @@ void BackendServiceBase::transmit_data(TTransmitDataResult& return_val, const TT
 
 void BackendServiceBase::fetch_data(TFetchDataResult& return_val, const TFetchDataParams& params) {
     // maybe hang in this function
-    Status status = _exec_env->result_mgr()->fetch_data(params.fragment_instance_id, &return_val);
+    int32_t partition = params.__isset.partition ? params.partition : 0;
+    Status status = _exec_env->result_mgr()->fetch_data(params.fragment_instance_id, partition, &return_val);
     status.set_t_status(&return_val);
 }
 
@@ -39,6 +39,7 @@
 #include "runtime/routine_load/routine_load_task_executor.h"
 #include "runtime/runtime_filter_worker.h"
 #include "service/brpc.h"
+#include "util/raw_container.h"
 #include "util/stopwatch.hpp"
 #include "util/thrift_util.h"
 #include "util/uid_util.h"
@@ -105,14 +106,24 @@ void PInternalServiceImplBase<T>::transmit_chunk(google::protobuf::RpcController
     if (cntl->request_attachment().size() > 0) {
         const butil::IOBuf& io_buf = cntl->request_attachment();
         size_t offset = 0;
-        for (size_t i = 0; i < req->chunks().size(); ++i) {
-            auto chunk = req->mutable_chunks(i);
-            io_buf.copy_to(chunk->mutable_data(), chunk->data_size(), offset);
-            offset += chunk->data_size();
+        auto copy_chunks = [&](PTransmitChunkParams* params) {
+            for (size_t i = 0; i < params->chunks().size(); ++i) {
+                auto chunk = params->mutable_chunks(i);
+                // The data is overwritten by the copy, so there is no need to zero it first.
+                raw::stl_string_resize_uninitialized(chunk->mutable_data(), chunk->data_size());
+                io_buf.copy_to(chunk->mutable_data()->data(), chunk->data_size(), offset);
+                offset += chunk->data_size();
+            }
+        };
+        copy_chunks(req);
+        // The data of the batched requests follow the data of this request.
+        for (size_t i = 0; i < req->batched_requests().size(); ++i) {
+            copy_chunks(req->mutable_batched_requests(i));
         }
     }
     Status st;
     st.to_protobuf(response->mutable_status());
+    _exec_env->stream_mgr()->collect_finished_recvrs(*request, response);
     st = _exec_env->stream_mgr()->transmit_chunk(*request, &done);
     if (!st.ok()) {
         LOG(WARNING) << "transmit_data failed, message=" << st.get_error_msg()
@@ -221,6 +232,22 @@ void PInternalServiceImplBase<T>::tablet_writer_cancel(google::protobuf::RpcCont
                                                        PTabletWriterCancelResult* response,
                                                        google::protobuf::Closure* done) {}
 
+template <typename T>
+void PInternalServiceImplBase<T>::tablet_writer_add_segment(google::protobuf::RpcController* cntl_base,
+                                                            const PTabletWriterAddSegmentRequest* request,
+                                                            PTabletWriterAddSegmentResult* response,
+                                                            google::protobuf::Closure* done) {
+    ClosureGuard closure_guard(done);
+    response->mutable_status()->set_status_code(TStatusCode::NOT_IMPLEMENTED_ERROR);
+}
+
+template <typename T>
+void PInternalServiceImplBase<T>::lookup(google::protobuf::RpcController* controller, const PLookupRequest* request,
+                                         PLookupResult* response, google::protobuf::Closure* done) {
+    ClosureGuard closure_guard(done);
+    response->mutable_status()->set_status_code(TStatusCode::NOT_IMPLEMENTED_ERROR);
+}
+
 template <typename T>
 Status PInternalServiceImplBase<T>::_exec_plan_fragment(brpc::Controller* cntl) {
     auto ser_request = cntl->request_attachment().to_string();
@@ -378,7 +405,7 @@ void PInternalServiceImplBase<T>::fetch_data(google::protobuf::RpcController* cn
                                              google::protobuf::Closure* done) {
     brpc::Controller* cntl = static_cast<brpc::Controller*>(cntl_base);
     GetResultBatchCtx* ctx = new GetResultBatchCtx(cntl, result, done);
-    _exec_env->result_mgr()->fetch_data(request->finst_id(), ctx);
+    _exec_env->result_mgr()->fetch_data(request->finst_id(), request->partition(), ctx);
 }
 
 template <typename T>
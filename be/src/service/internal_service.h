@@ -92,6 +92,13 @@ public:
     void tablet_writer_cancel(google::protobuf::RpcController* controller, const PTabletWriterCancelRequest* request,
                               PTabletWriterCancelResult* response, google::protobuf::Closure* done) override;
 
+    void tablet_writer_add_segment(google::protobuf::RpcController* controller,
+                                   const PTabletWriterAddSegmentRequest* request,
+                                   PTabletWriterAddSegmentResult* response, google::protobuf::Closure* done) override;
+
+    void lookup(google::protobuf::RpcController* controller, const PLookupRequest* request, PLookupResult* response,
+                google::protobuf::Closure* done) override;
+
     void trigger_profile_report(google::protobuf::RpcController* controller,
                                 const PTriggerProfileReportRequest* request, PTriggerProfileReportResult* result,
                                 google::protobuf::Closure* done) override;
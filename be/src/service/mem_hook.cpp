@@ -16,6 +16,7 @@
 #ifndef BE_TEST
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
+#include "util/mem_alloc_profiler.h"
 #endif
 
 #define ALIAS(my_fn) __attribute__((alias(#my_fn), used))
@@ -202,8 +203,20 @@ void operator delete[](void* p, size_t size, std::align_val_t al) noexcept {
 #endif
 
 #ifndef BE_TEST
+// Sample the allocation by the label of the MemTracker of the thread, see MemAllocProfiler.
+// |size| is only evaluated when the profile is enabled.
+#define MEM_ALLOC_PROFILE(size)                                                                          \
+    do {                                                                                                 \
+        if (UNLIKELY(starrocks::MemAllocProfiler::is_enabled()) &&                                       \
+            starrocks::MemAllocProfiler::should_sample(size)) {                                          \
+            starrocks::MemAllocProfiler::instance()->sample(                                             \
+                    starrocks::tls_mem_tracker != nullptr ? starrocks::tls_mem_tracker->label().c_str()  \
+                                                          : "process");                                  \
+        }                                                                                                \
+    } while (0)
 #define MEMORY_CONSUME_SIZE(size)                                      \
     do {                                                               \
+        MEM_ALLOC_PROFILE(size);                                       \
         if (LIKELY(starrocks::tls_is_thread_status_init)) {            \
             starrocks::tls_thread_status.mem_consume(size);            \
         } else {                                                       \
@@ -222,6 +235,7 @@ void operator delete[](void* p, size_t size, std::align_val_t al) noexcept {
 #define MEMORY_RELEASE_PTR(ptr) MEMORY_RELEASE_SIZE(STARROCKS_MALLOC_SIZE(ptr))
 #define TRY_MEM_CONSUME(size, err_ret)                                                                   \
     do {                                                                                                 \
+        MEM_ALLOC_PROFILE(size);                                                                         \
         if (LIKELY(starrocks::tls_is_thread_status_init)) {                                              \
             RETURN_IF_UNLIKELY(!starrocks::tls_thread_status.try_mem_consume(size), err_ret);            \
         } else {                                                                                         \
@@ -30,9 +30,11 @@
 #include "http/action/meta_action.h"
 #include "http/action/metrics_action.h"
 #include "http/action/pprof_actions.h"
+#include "http/action/query_trace_action.h"
 #include "http/action/reload_tablet_action.h"
 #include "http/action/restore_tablet_action.h"
 #include "http/action/runtime_filter_cache_action.h"
+#include "http/action/scan_heat_action.h"
 #include "http/action/snapshot_action.h"
 #include "http/action/stream_load.h"
 #include "http/action/transaction_stream_load.h"
@@ -139,6 +141,10 @@ Status HttpServiceBE::start() {
     _ev_http_server->register_handler(HttpMethod::GET, "/pprof/contention", contention_action);
     _http_handlers.emplace_back(contention_action);
 
+    MemAllocAction* mem_alloc_action = new MemAllocAction();
+    _ev_http_server->register_handler(HttpMethod::GET, "/pprof/mem_alloc", mem_alloc_action);
+    _http_handlers.emplace_back(mem_alloc_action);
+
     CmdlineAction* cmdline_action = new CmdlineAction();
     _ev_http_server->register_handler(HttpMethod::GET, "/pprof/cmdline", cmdline_action);
     _http_handlers.emplace_back(cmdline_action);
@@ -209,6 +215,14 @@ Status HttpServiceBE::start() {
                                       runtime_filter_cache_action);
     _http_handlers.emplace_back(runtime_filter_cache_action);
 
+    QueryTraceAction* query_trace_action = new QueryTraceAction(_env);
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/query_trace", query_trace_action);
+    _http_handlers.emplace_back(query_trace_action);
+
+    ScanHeatAction* scan_heat_action = new ScanHeatAction();
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/scan_heat", scan_heat_action);
+    _http_handlers.emplace_back(scan_heat_action);
+
     CompactRocksDbMetaAction* compact_rocksdb_meta_action = new CompactRocksDbMetaAction(_env);
     _ev_http_server->register_handler(HttpMethod::POST, "/api/compact_rocksdb_meta", compact_rocksdb_meta_action);
     _http_handlers.emplace_back(compact_rocksdb_meta_action);
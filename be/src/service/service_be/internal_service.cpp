@@ -30,6 +30,7 @@
 #include "runtime/data_stream_mgr.h"
 #include "runtime/fragment_mgr.h"
 #include "runtime/load_channel_mgr.h"
+#include "runtime/point_lookup.h"
 #include "runtime/result_buffer_mgr.h"
 #include "runtime/routine_load/routine_load_task_executor.h"
 #include "runtime/runtime_filter_worker.h"
@@ -89,6 +90,27 @@ void BackendInternalServiceImpl<T>::tablet_writer_cancel(google::protobuf::RpcCo
                                                                        *request, response, done);
 }
 
+template <typename T>
+void BackendInternalServiceImpl<T>::tablet_writer_add_segment(google::protobuf::RpcController* cntl_base,
+                                                              const PTabletWriterAddSegmentRequest* request,
+                                                              PTabletWriterAddSegmentResult* response,
+                                                              google::protobuf::Closure* done) {
+    ClosureGuard closure_guard(done);
+    VLOG_RPC << "tablet writer add segment, id=" << print_id(request->id()) << ", index_id=" << request->index_id()
+             << ", tablet_id=" << request->tablet_id() << ", eos=" << request->eos();
+    auto cntl = static_cast<brpc::Controller*>(cntl_base);
+    PInternalServiceImplBase<T>::_exec_env->load_channel_mgr()->add_segment(*request, &cntl->request_attachment(),
+                                                                            response);
+}
+
+template <typename T>
+void BackendInternalServiceImpl<T>::lookup(google::protobuf::RpcController* controller, const PLookupRequest* request,
+                                           PLookupResult* response, google::protobuf::Closure* done) {
+    ClosureGuard closure_guard(done);
+    // A lookup reads a few rows, so it is executed in the bthread directly instead of a thread pool.
+    lookup_rows(*request, response).to_protobuf(response->mutable_status());
+}
+
 template class BackendInternalServiceImpl<PInternalService>;
 template class BackendInternalServiceImpl<doris::PBackendService>;
 } // namespace starrocks
@@ -56,6 +56,13 @@ public:
 
     void tablet_writer_cancel(google::protobuf::RpcController* controller, const PTabletWriterCancelRequest* request,
                               PTabletWriterCancelResult* response, google::protobuf::Closure* done) override;
+
+    void tablet_writer_add_segment(google::protobuf::RpcController* controller,
+                                   const PTabletWriterAddSegmentRequest* request,
+                                   PTabletWriterAddSegmentResult* response, google::protobuf::Closure* done) override;
+
+    void lookup(google::protobuf::RpcController* controller, const PLookupRequest* request, PLookupResult* response,
+                google::protobuf::Closure* done) override;
 };
 
 } // namespace starrocks
@@ -75,11 +75,15 @@ static void thrift_output(const char* x) {
 } // namespace starrocks
 
 extern int meta_tool_main(int argc, char** argv);
+extern int fragment_bench_main(int argc, char** argv);
 
 int main(int argc, char** argv) {
     if (argc > 1 && strcmp(argv[1], "meta_tool") == 0) {
         return meta_tool_main(argc - 1, argv + 1);
     }
+    if (argc > 1 && strcmp(argv[1], "fragment_bench") == 0) {
+        return fragment_bench_main(argc - 1, argv + 1);
+    }
     bool as_cn = false;
     // Check if print version or help or cn.
     if (argc > 1) {
@@ -53,5 +53,33 @@ struct SIMDGather {
             c++;
         }
     }
+
+    // dst[i] = table[indexes[i]]
+    // The values of 4 or 8 bytes are gathered by AVX2, e.g. the dictionary values of parquet.
+    template <class T>
+    static void gather(T* dst, const T* table, const uint32_t* indexes, size_t num_rows) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        size_t i = 0;
+#ifdef __AVX2__
+        if constexpr (sizeof(T) == 4) {
+            for (; i + 8 <= num_rows; i += 8) {
+                __m256i loaded = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indexes + i));
+                __m256i gathered = _mm256_i32gather_epi32(reinterpret_cast<const int32_t*>(table), loaded, 4);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), gathered);
+            }
+            _mm256_zeroupper();
+        } else if constexpr (sizeof(T) == 8) {
+            for (; i + 4 <= num_rows; i += 4) {
+                __m128i loaded = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indexes + i));
+                __m256i gathered = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(table), loaded, 8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), gathered);
+            }
+            _mm256_zeroupper();
+        }
+#endif
+        for (; i < num_rows; i++) {
+            dst[i] = table[indexes[i]];
+        }
+    }
 };
 } // namespace starrocks::vectorized
\ No newline at end of file
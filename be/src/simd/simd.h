@@ -115,6 +115,10 @@ inline size_t find_nonzero(const std::vector<uint8_t>& list, size_t start, size_
     return find_byte<uint8_t>(list, start, count, 1);
 }
 
+inline size_t find_zero(const std::vector<uint8_t>& list, size_t start, size_t count) {
+    return find_byte<uint8_t>(list, start, count, 0);
+}
+
 inline size_t find_zero(const std::vector<int8_t>& list, size_t start) {
     return find_byte<int8_t>(list, start, 0);
 }
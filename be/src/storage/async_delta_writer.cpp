@@ -108,6 +108,9 @@ void AsyncDeltaWriter::commit(AsyncDeltaWriterCallback* cb) {
 }
 
 void AsyncDeltaWriter::abort(bool with_log) {
+    // Wake up the commit task waiting for the primary replica, which blocks the queue.
+    _writer->cancel_replication();
+
     Task task;
     task.abort = true;
     task.abort_with_log = with_log;
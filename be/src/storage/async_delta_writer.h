@@ -57,6 +57,13 @@ public:
     // [thread-safe and wait-free]
     void abort(bool with_log = true);
 
+    // Write a segment replicated from the primary replica, see DeltaWriter::write_segment. It's not queued,
+    // because the commit task of a secondary replica is blocked until the last segment.
+    // [thread-safe]
+    Status write_segment(const PTabletWriterAddSegmentRequest& request, butil::IOBuf* data) {
+        return _writer->write_segment(request, *data);
+    }
+
     int64_t partition_id() const { return _writer->partition_id(); }
 
 private:
@@ -1,6 +1,7 @@
 // This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
 #include "storage/base_and_cumulative_compaction_policy.h"
 
+#include <cmath>
 #include <sstream>
 #include <vector>
 
@@ -17,6 +18,18 @@ namespace starrocks {
 bool BaseAndCumulativeCompactionPolicy::need_compaction() {
     _compaction_context->cumulative_score = _get_cumulative_compaction_score();
     _compaction_context->base_score = _get_base_compaction_score();
+    // Among the tablets needing compaction, the ones read more by the queries are compacted first. Only the scores
+    // above the threshold are raised, so that whether a tablet needs compaction does not depend on its reads.
+    if (config::compaction_read_heat_weight > 0) {
+        double boost = 1 + config::compaction_read_heat_weight *
+                                   std::log2(1 + _compaction_context->tablet->read_heat().reads());
+        if (_compaction_context->cumulative_score > COMPACTION_SCORE_THRESHOLD) {
+            _compaction_context->cumulative_score *= boost;
+        }
+        if (_compaction_context->base_score > COMPACTION_SCORE_THRESHOLD) {
+            _compaction_context->base_score *= boost;
+        }
+    }
 
     VLOG(2) << "need_compaction compaction context:" << _compaction_context->to_string();
     // for max_compaction_score is double type, use 0.999 instead of 1
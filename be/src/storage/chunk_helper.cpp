@@ -2,12 +2,15 @@
 
 #include "storage/chunk_helper.h"
 
+#include <algorithm>
+
 #include "column/array_column.h"
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/column_pool.h"
 #include "column/schema.h"
 #include "column/type_traits.h"
+#include "common/config.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
 #include "simd/simd.h"
@@ -235,6 +238,16 @@ vectorized::ColumnPtr column_from_pool(const vectorized::Field& field, size_t ch
                                       scale);
 }
 
+size_t ChunkHelper::chunk_size_for_row_bytes(size_t chunk_size, size_t row_bytes) {
+    // Too small chunks do not amortize the per chunk overhead, whatever their width.
+    static constexpr size_t kMinChunkSize = 128;
+    const auto target_bytes = static_cast<size_t>(std::max<int64_t>(config::chunk_target_bytes, 0));
+    if (target_bytes == 0 || row_bytes == 0 || chunk_size <= kMinChunkSize) {
+        return chunk_size;
+    }
+    return std::clamp(target_bytes / row_bytes, kMinChunkSize, chunk_size);
+}
+
 vectorized::Chunk* ChunkHelper::new_chunk_pooled(const vectorized::Schema& schema, size_t chunk_size, bool force) {
     vectorized::Columns columns;
     columns.reserve(schema.num_fields());
@@ -50,6 +50,10 @@ public:
 
     static vectorized::Chunk* new_chunk_pooled(const vectorized::Schema& schema, size_t n, bool force = true);
 
+    // The number of rows of a chunk, at most |chunk_size|, for its memory usage to be about
+    // config::chunk_target_bytes if its rows are |row_bytes| wide. |row_bytes| is 0 if unknown.
+    static size_t chunk_size_for_row_bytes(size_t chunk_size, size_t row_bytes);
+
     // Create a vectorized column from field .
     // REQUIRE: |type| must be scalar type.
     static std::shared_ptr<vectorized::Column> column_from_field_type(FieldType type, bool nullable);
@@ -13,6 +13,8 @@
 #include "runtime/descriptors.h"
 #include "runtime/primitive_type.h"
 #include "runtime/runtime_state.h"
+#include "storage/rowset/bloom_filter.h"
+#include "storage/rowset/inverted_index_tokenizer.h"
 #include "storage/vectorized_column_predicate.h"
 
 namespace starrocks::vectorized {
@@ -24,6 +26,7 @@ ColumnExprPredicate::ColumnExprPredicate(TypeInfoPtr type_info, ColumnId column_
     // so here we have to clone one to keep thread safe.
     _add_expr_ctx(expr_ctx);
     _is_expr_predicate = true;
+    _init_required_substrings();
 }
 
 ColumnExprPredicate::~ColumnExprPredicate() {
@@ -58,6 +61,167 @@ void ColumnExprPredicate::_add_expr_ctx(ExprContext* expr_ctx) {
     }
 }
 
+// Evaluate the constant |expr|, return nullptr if it's not a constant or fails.
+static ColumnPtr evaluate_const(ExprContext* ctx, Expr* expr) {
+    if (!expr->is_constant()) {
+        return nullptr;
+    }
+    auto res = ctx->evaluate(expr, nullptr);
+    if (!res.ok() || res.value()->size() == 0) {
+        return nullptr;
+    }
+    return std::move(res).value();
+}
+
+static bool is_const_zero(ExprContext* ctx, Expr* expr) {
+    ColumnPtr column = evaluate_const(ctx, expr);
+    if (column == nullptr || column->only_null()) {
+        return false;
+    }
+    Datum value = column->get(0);
+    if (value.is_null()) {
+        return false;
+    }
+    switch (expr->type().type) {
+    case TYPE_INT:
+        return value.get_int32() == 0;
+    case TYPE_BIGINT:
+        return value.get_int64() == 0;
+    default:
+        return false;
+    }
+}
+
+// Split the LIKE |pattern| into the literal parts between the wildcards.
+static void split_like_pattern(const Slice& pattern, std::vector<std::string>* literals) {
+    std::string literal;
+    for (size_t i = 0; i < pattern.size; i++) {
+        char c = pattern.data[i];
+        if (c == '\\' && i + 1 < pattern.size) {
+            literal.push_back(pattern.data[++i]);
+        } else if (c == '%' || c == '_') {
+            if (!literal.empty()) {
+                literals->emplace_back(std::move(literal));
+                literal.clear();
+            }
+        } else {
+            literal.push_back(c);
+        }
+    }
+    if (!literal.empty()) {
+        literals->emplace_back(std::move(literal));
+    }
+}
+
+// Collect the tokens of |pattern| which must be the whole tokens of every matched value, i.e. the runs of
+// the token chars bounded by the literal delimiters. |wildcard[i]| tells whether pattern[i] is a wildcard,
+// and |anchored| tells whether the pattern matches the whole value, so its ends are bounds too.
+static void collect_whole_tokens(const std::string& pattern, const std::vector<bool>& wildcard, bool anchored,
+                                 std::vector<std::string>* tokens) {
+    auto is_bound = [&](size_t i) { return !wildcard[i] && !inverted_index::is_token_char(pattern[i]); };
+    size_t begin = 0;
+    while (begin < pattern.size()) {
+        if (wildcard[begin] || !inverted_index::is_token_char(pattern[begin])) {
+            begin++;
+            continue;
+        }
+        size_t end = begin;
+        while (end < pattern.size() && !wildcard[end] && inverted_index::is_token_char(pattern[end])) {
+            end++;
+        }
+        bool left_bounded = begin == 0 ? anchored : is_bound(begin - 1);
+        bool right_bounded = end == pattern.size() ? anchored : is_bound(end);
+        if (left_bounded && right_bounded) {
+            tokens->emplace_back(pattern.substr(begin, end - begin));
+        }
+        begin = end;
+    }
+}
+
+static void collect_like_pattern_tokens(const Slice& pattern, std::vector<std::string>* tokens) {
+    std::string chars;
+    std::vector<bool> wildcard;
+    for (size_t i = 0; i < pattern.size; i++) {
+        char c = pattern.data[i];
+        if (c == '\\' && i + 1 < pattern.size) {
+            chars.push_back(pattern.data[++i]);
+            wildcard.push_back(false);
+        } else {
+            chars.push_back(c);
+            wildcard.push_back(c == '%' || c == '_');
+        }
+    }
+    collect_whole_tokens(chars, wildcard, true, tokens);
+}
+
+void ColumnExprPredicate::_init_required_substrings() {
+    // The n-grams are of the stored values, so no cast is allowed.
+    if (_expr_ctxs.size() != 1) {
+        return;
+    }
+    ExprContext* ctx = _expr_ctxs[0];
+    Expr* root = ctx->root();
+    if (root->get_num_children() != 2) {
+        return;
+    }
+    Expr* str_expr = nullptr;
+    Expr* substr_expr = nullptr;
+    bool is_like = false;
+    if (root->node_type() == TExprNodeType::FUNCTION_CALL && root->fn().name.function_name == "like") {
+        str_expr = root->get_child(0);
+        substr_expr = root->get_child(1);
+        is_like = true;
+    } else if (root->op() == TExprOpcode::GT && root->get_child(0)->node_type() == TExprNodeType::FUNCTION_CALL &&
+               root->get_child(0)->get_num_children() == 2) {
+        // locate(substr, col) > 0 or instr(col, substr) > 0
+        if (!is_const_zero(ctx, root->get_child(1))) {
+            return;
+        }
+        Expr* fn = root->get_child(0);
+        const std::string& fn_name = fn->fn().name.function_name;
+        if (fn_name == "locate") {
+            substr_expr = fn->get_child(0);
+            str_expr = fn->get_child(1);
+        } else if (fn_name == "instr") {
+            str_expr = fn->get_child(0);
+            substr_expr = fn->get_child(1);
+        }
+    }
+    if (str_expr == nullptr || !str_expr->is_slotref()) {
+        return;
+    }
+    ColumnPtr column = evaluate_const(ctx, substr_expr);
+    if (column == nullptr || column->only_null()) {
+        return;
+    }
+    Datum substr = column->get(0);
+    if (substr.is_null()) {
+        return;
+    }
+    if (is_like) {
+        split_like_pattern(substr.get_slice(), &_required_substrings);
+        collect_like_pattern_tokens(substr.get_slice(), &_inverted_index_tokens);
+    } else if (substr.get_slice().size > 0) {
+        _required_substrings.emplace_back(substr.get_slice().to_string());
+        std::string chars = substr.get_slice().to_string();
+        collect_whole_tokens(chars, std::vector<bool>(chars.size(), false), false, &_inverted_index_tokens);
+    }
+}
+
+bool ColumnExprPredicate::ngram_bloom_filter(const BloomFilter* bf, size_t gram_num) const {
+    for (const std::string& substr : _required_substrings) {
+        bool found = true;
+        for_each_ngram(Slice(substr), gram_num, [&](const Slice& gram) {
+            found = found && bf->test_bytes(gram.data, gram.size);
+        });
+        if (!found) {
+            VLOG_FILE << "ColumnExprPredicate: ngram_bloom_filter succeeded, substring = " << substr;
+            return false;
+        }
+    }
+    return true;
+}
+
 Status ColumnExprPredicate::evaluate(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const {
     // Does not support range evaluatation.
     DCHECK(from == 0);
@@ -12,6 +12,7 @@ class SlotDescriptor;
 class SparseRange;
 class ExprContext;
 class BitmapIndexIterator;
+class BloomFilter;
 class ObjectPool;
 } // namespace starrocks
 
@@ -43,6 +44,11 @@ public:
 
     bool zone_map_filter(const ZoneMapDetail& detail) const override;
     bool support_bloom_filter() const override { return false; }
+    bool support_ngram_bloom_filter() const override { return !_required_substrings.empty(); }
+    bool ngram_bloom_filter(const BloomFilter* bf, size_t gram_num) const override;
+    void get_inverted_index_tokens(std::vector<std::string>* tokens) const override {
+        tokens->insert(tokens->end(), _inverted_index_tokens.begin(), _inverted_index_tokens.end());
+    }
     PredicateType type() const override { return PredicateType::kExpr; }
     bool can_vectorized() const override { return true; }
 
@@ -68,11 +74,17 @@ private:
     // Share the ownership, is necessary to clone it
     void _add_expr_ctx(ExprContext* expr_ctx);
 
+    // Collect the substrings of the column every satisfying value contains, for `col LIKE pattern`,
+    // `locate(substr, col) > 0` and `instr(col, substr) > 0`, and the whole tokens of them for the inverted index.
+    void _init_required_substrings();
+
     RuntimeState* _state;
     std::vector<ExprContext*> _expr_ctxs;
     const SlotDescriptor* _slot_desc;
     bool _monotonic;
     mutable std::vector<uint8_t> _tmp_select;
+    std::vector<std::string> _required_substrings;
+    std::vector<std::string> _inverted_index_tokens;
 };
 
 class ColumnTruePredicate : public ColumnPredicate {
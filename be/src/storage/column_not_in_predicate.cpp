@@ -80,8 +80,23 @@ public:
 
     bool zone_map_filter(const ZoneMapDetail& detail) const override { return true; }
 
+    // All the non-null entries of the dictionary except the ones of the values.
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange* range) const override {
-        return Status::Cancelled("not-equal predicate not support bitmap index");
+        range->clear();
+        range->add(Range(0, iter->bitmap_nums() - iter->has_null_bitmap()));
+        SparseRange matched;
+        for (auto value : _values) {
+            bool exact_match = false;
+            Status s = iter->seek_dictionary(&value, &exact_match);
+            if (s.ok() && exact_match) {
+                rowid_t seeked_ordinal = iter->current_ordinal();
+                matched.add(Range(seeked_ordinal, seeked_ordinal + 1));
+            } else if (!s.ok() && !s.is_not_found()) {
+                return s;
+            }
+        }
+        *range -= matched;
+        return Status::OK();
     }
 
     PredicateType type() const override { return PredicateType::kNotInList; }
@@ -220,8 +235,24 @@ public:
 
     bool zone_map_filter(const ZoneMapDetail& detail) const override { return true; }
 
+    // All the non-null entries of the dictionary except the ones of the values.
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange* range) const override {
-        return Status::Cancelled("not-equal predicate not support bitmap index");
+        range->clear();
+        range->add(Range(0, iter->bitmap_nums() - iter->has_null_bitmap()));
+        SparseRange matched;
+        for (const std::string& s : _zero_padded_strs) {
+            Slice padded_value(s);
+            bool exact_match = false;
+            Status st = iter->seek_dictionary(&padded_value, &exact_match);
+            if (st.ok() && exact_match) {
+                rowid_t seeked_ordinal = iter->current_ordinal();
+                matched.add(Range(seeked_ordinal, seeked_ordinal + 1));
+            } else if (!st.ok() && !st.is_not_found()) {
+                return st;
+            }
+        }
+        *range -= matched;
+        return Status::OK();
     }
 
     bool can_vectorized() const override { return false; }
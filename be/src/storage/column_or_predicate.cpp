@@ -6,6 +6,16 @@
 
 namespace starrocks::vectorized {
 
+Status ColumnOrPredicate::seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange* range) const {
+    range->clear();
+    for (const ColumnPredicate* child : _child) {
+        SparseRange r;
+        RETURN_IF_ERROR(child->seek_bitmap_dictionary(iter, &r));
+        *range |= r;
+    }
+    return Status::OK();
+}
+
 Status ColumnOrPredicate::evaluate(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const {
     return _evaluate(column, selection, from, to);
 }
@@ -34,6 +34,10 @@ public:
 
     bool zone_map_filter(const ZoneMapDetail& detail) const override;
 
+    // The union of the dictionary entries of the children, cancelled if any of them doesn't support bitmap
+    // index, in which case the whole predicate is evaluated on the data.
+    Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange* range) const override;
+
     bool can_vectorized() const override { return false; }
 
     PredicateType type() const override { return PredicateType::kOr; }
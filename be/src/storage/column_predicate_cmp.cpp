@@ -11,6 +11,7 @@
 #include "storage/range.h"
 #include "storage/rowset/bitmap_index_reader.h"
 #include "storage/rowset/bloom_filter.h"
+#include "storage/rowset/inverted_index_tokenizer.h"
 #include "storage/types.h"
 #include "storage/vectorized_column_predicate.h"
 #include "storage/zone_map_detail.h"
@@ -433,8 +434,21 @@ public:
 
     bool zone_map_filter(const ZoneMapDetail& detail) const override { return true; }
 
+    // All the non-null entries of the dictionary except the one of the value.
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange* range) const override {
-        return Status::Cancelled("not-equal predicate not support bitmap index");
+        range->clear();
+        range->add(Range(0, iter->bitmap_nums() - iter->has_null_bitmap()));
+        bool exact_match = false;
+        Status s = iter->seek_dictionary(&this->_value, &exact_match);
+        if (s.ok()) {
+            if (exact_match) {
+                rowid_t ordinal = iter->current_ordinal();
+                *range -= SparseRange(ordinal, ordinal + 1);
+            }
+        } else if (!s.is_not_found()) {
+            return s;
+        }
+        return Status::OK();
     }
 
     Status convert_to(const ColumnPredicate** output, const TypeInfoPtr& target_type_info,
@@ -533,6 +547,12 @@ public:
 
     bool support_bloom_filter() const override { return false; }
 
+    void get_inverted_index_tokens(std::vector<std::string>* tokens) const override {
+        if (_predicate_type == PredicateType::kEQ) {
+            inverted_index::for_each_token(_value, [&](const Slice& token) { tokens->emplace_back(token.to_string()); });
+        }
+    }
+
     Status convert_to(const ColumnPredicate** output, const TypeInfoPtr& target_type_info,
                       ObjectPool* obj_pool) const override {
         const auto to_type = target_type_info->type();
@@ -741,8 +761,23 @@ public:
 
     bool zone_map_filter(const ZoneMapDetail& detail) const override { return true; }
 
+    // All the non-null entries of the dictionary except the one of the value.
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange* range) const override {
-        return Status::Cancelled("not-equal predicate not support bitmap index");
+        // see the comment in `predicate_parser.cpp`.
+        Slice padded_value(Base::_zero_padded_str);
+        range->clear();
+        range->add(Range(0, iter->bitmap_nums() - iter->has_null_bitmap()));
+        bool exact_match = false;
+        Status s = iter->seek_dictionary(&padded_value, &exact_match);
+        if (s.ok()) {
+            if (exact_match) {
+                rowid_t ordinal = iter->current_ordinal();
+                *range -= SparseRange(ordinal, ordinal + 1);
+            }
+        } else if (!s.is_not_found()) {
+            return s;
+        }
+        return Status::OK();
     }
 };
 
@@ -87,7 +87,8 @@ Status Compaction::do_compaction_impl() {
               << ", columns per group=" << config::vertical_compaction_max_columns_per_group;
 
     RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(_tablet.get(), max_rows_per_segment, algorithm,
-                                                                    _output_version, &_output_rs_writer));
+                                                                    _output_version, &_output_rs_writer,
+                                                                    _input_rowsets));
     TRACE("prepare finished");
 
     Statistics stats;
@@ -0,0 +1,81 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/compaction_io_throttle.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "common/config.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+static constexpr int64_t kNanosPerSecond = 1000L * 1000 * 1000;
+
+int64_t CompactionIOThrottle::_max_rate() const {
+    return std::max<int64_t>(0, _is_ssd ? config::compaction_ssd_io_bytes_per_second
+                                        : config::compaction_hdd_io_bytes_per_second);
+}
+
+void CompactionIOThrottle::_adjust(int64_t now_ns) {
+    if (now_ns - _last_adjust_ns < kNanosPerSecond) {
+        return;
+    }
+    _last_adjust_ns = now_ns;
+    const int64_t target_us = config::compaction_io_throttle_scan_latency_us;
+    if (target_us > 0 && _scan_reported && _scan_latency_us > target_us) {
+        _ratio = std::max(kMinRatio, _ratio / 2);
+    } else {
+        _ratio = std::min(1.0, _ratio + kMinRatio);
+    }
+    _scan_reported = false;
+}
+
+void CompactionIOThrottle::acquire(int64_t bytes) {
+    int64_t wait_ns = 0;
+    {
+        std::lock_guard l(_lock);
+        const int64_t now = MonotonicNanos();
+        _adjust(now);
+        const double rate = _max_rate() * _ratio;
+        if (rate <= 0) {
+            return;
+        }
+        // Allow a burst of one second at most.
+        _tokens = std::min(rate, _tokens + rate * (now - _last_refill_ns) / kNanosPerSecond);
+        _last_refill_ns = now;
+        _tokens -= bytes;
+        if (_tokens < 0) {
+            wait_ns = static_cast<int64_t>(-_tokens / rate * kNanosPerSecond);
+        }
+    }
+    if (wait_ns > 0) {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(wait_ns));
+    }
+}
+
+void CompactionIOThrottle::update_scan_latency(int64_t io_ns, int64_t io_count) {
+    if (io_count <= 0) {
+        return;
+    }
+    const double latency_us = static_cast<double>(io_ns) / io_count / 1000;
+    std::lock_guard l(_lock);
+    _scan_latency_us = _scan_latency_us > 0 ? 0.8 * _scan_latency_us + 0.2 * latency_us : latency_us;
+    _scan_reported = true;
+    _adjust(MonotonicNanos());
+}
+
+bool CompactionIOThrottle::is_busy() {
+    std::lock_guard l(_lock);
+    _adjust(MonotonicNanos());
+    return _max_rate() > 0 && _ratio < 1.0;
+}
+
+int64_t CompactionIOThrottle::rate() {
+    std::lock_guard l(_lock);
+    _adjust(MonotonicNanos());
+    return static_cast<int64_t>(_max_rate() * _ratio);
+}
+
+} // namespace starrocks
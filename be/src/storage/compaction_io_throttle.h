@@ -0,0 +1,51 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+
+namespace starrocks {
+
+// CompactionIOThrottle is a token bucket limiting the bytes read and written by the compaction tasks of a
+// data dir per second, which is configured by the storage medium of the dir.
+//
+// The budget adapts to the foreground scans on the dir: it's halved down to kMinRatio of the configured
+// rate while the average latency of the page reads of scans exceeds compaction_io_throttle_scan_latency_us,
+// and regained step by step once the latency recovers or no scan is reported.
+class CompactionIOThrottle {
+public:
+    static constexpr double kMinRatio = 0.1;
+
+    explicit CompactionIOThrottle(bool is_ssd) : _is_ssd(is_ssd) {}
+
+    // Take |bytes| from the bucket, blocks the calling compaction thread if the budget is overdrawn.
+    void acquire(int64_t bytes);
+
+    // Report that a scan on the dir read |io_count| pages from the disk in |io_ns|.
+    void update_scan_latency(int64_t io_ns, int64_t io_count);
+
+    // Whether the budget is reduced for the scans, the disk-bound compactions should go to other dirs.
+    bool is_busy();
+
+    // The bytes per second allowed now, 0 means unlimited.
+    int64_t rate();
+
+private:
+    int64_t _max_rate() const;
+    // Adjust |_ratio| by the scan latency at most once per second, |_lock| is held.
+    void _adjust(int64_t now_ns);
+
+    const bool _is_ssd;
+
+    std::mutex _lock;
+    double _tokens = 0;
+    int64_t _last_refill_ns = 0;
+    double _ratio = 1.0;
+    int64_t _last_adjust_ns = 0;
+    // The exponential moving average of the latency of the page reads of scans.
+    double _scan_latency_us = 0;
+    bool _scan_reported = false;
+};
+
+} // namespace starrocks
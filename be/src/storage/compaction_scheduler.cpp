@@ -186,6 +186,16 @@ bool CompactionScheduler::_can_do_compaction(const CompactionCandidate& candidat
         return false;
     }
 
+    // Size-tiered: leave the disk-bound tasks of the disks busy with queries to the idle disks, the
+    // candidate is rescheduled and picked again once the disk becomes idle.
+    if (tmp_task->input_rowsets_size() >= config::compaction_disk_bound_input_bytes &&
+        data_dir->compaction_io_throttle()->is_busy()) {
+        VLOG(2) << "skip tablet:" << tablet->tablet_id() << " because the compaction io of disk " << data_dir->path()
+                << " is throttled for queries. input rowsets size:" << tmp_task->input_rowsets_size();
+        tablet->reset_compaction(candidate.type);
+        return false;
+    }
+
     bool can_do = _can_do_compaction_task(tablet.get(), tmp_task.get());
     if (can_do) {
         *compaction_task = std::move(tmp_task);
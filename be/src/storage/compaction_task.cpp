@@ -5,6 +5,7 @@
 #include "runtime/mem_tracker.h"
 #include "storage/compaction_manager.h"
 #include "storage/compaction_scheduler.h"
+#include "storage/rowset/rowset_writer.h"
 #include "storage/storage_engine.h"
 #include "util/scoped_cleanup.h"
 #include "util/starrocks_metrics.h"
@@ -114,6 +115,48 @@ bool CompactionTask::should_stop() const {
            BackgroundTask::should_stop();
 }
 
+StatusOr<bool> CompactionTask::_try_link_segments(Statistics* statistics) {
+    if (!config::enable_compaction_link_segments || _task_info.compaction_type != CUMULATIVE_COMPACTION ||
+        _input_rowsets.size() < 2 || _task_info.input_segments_num == 0) {
+        return false;
+    }
+    int64_t avg_segment_size = _task_info.input_rowsets_size / _task_info.input_segments_num;
+    if (avg_segment_size < config::compaction_link_segments_min_bytes) {
+        return false;
+    }
+    for (const auto& rowset : _input_rowsets) {
+        if (rowset->rowset_meta()->has_delete_predicate()) {
+            return false;
+        }
+    }
+    // The duplicate keys are kept by the merge anyway.
+    bool allow_equal_keys = _tablet->keys_type() == DUP_KEYS;
+    const auto& schema = _tablet->tablet_schema();
+    ASSIGN_OR_RETURN(bool ordered, CompactionUtils::segments_in_key_order(schema, _input_rowsets, allow_equal_keys));
+    if (!ordered) {
+        return false;
+    }
+    TRACE("[Compaction] start to link segments");
+
+    int64_t max_rows_per_segment = CompactionUtils::get_segment_max_rows(
+            config::max_segment_file_size, _task_info.input_rows_num, _task_info.input_rowsets_size);
+    std::unique_ptr<RowsetWriter> output_rs_writer;
+    RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(_tablet.get(), max_rows_per_segment,
+                                                                    HORIZONTAL_COMPACTION, _task_info.output_version,
+                                                                    &output_rs_writer));
+    for (const auto& rowset : _input_rowsets) {
+        RETURN_IF_ERROR(output_rs_writer->add_rowset(rowset));
+    }
+    ASSIGN_OR_RETURN(_output_rowset, output_rs_writer->build());
+    _task_info.output_num_rows = _output_rowset->num_rows();
+    _task_info.output_segments_num = _output_rowset->num_segments();
+    _task_info.output_rowset_size = _output_rowset->data_disk_size();
+    statistics->output_rows = _output_rowset->num_rows();
+    TRACE_COUNTER_INCREMENT("output_segments_num", _output_rowset->num_segments());
+    TRACE("[Compaction] segments linked");
+    return true;
+}
+
 void CompactionTask::_success_callback() {
     set_compaction_task_state(COMPACTION_SUCCESS);
     // for compatible, update compaction time
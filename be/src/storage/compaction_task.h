@@ -257,6 +257,10 @@ protected:
                   << ", input rowsets:" << input_stream_info.str() << ", input rowsets size:" << _input_rowsets.size();
     }
 
+    // Build the output rowset by linking the segments of the inputs if a cumulative compaction needs no merge,
+    // i.e. the inputs are sorted by key and have no delete predicate. Returns false if the inputs must be merged.
+    StatusOr<bool> _try_link_segments(Statistics* statistics);
+
     void _success_callback();
 
     void _failure_callback();
@@ -2,12 +2,22 @@
 
 #include "storage/compaction_utils.h"
 
+#include <numeric>
+
+#include "column/chunk.h"
 #include "common/config.h"
 #include "storage/base_and_cumulative_compaction_policy.h"
+#include "storage/chunk_helper.h"
+#include "storage/olap_common.h"
 #include "storage/row_source_mask.h"
+#include "storage/rowset/column_iterator.h"
+#include "storage/rowset/column_reader.h"
+#include "storage/rowset/encoding_info.h"
+#include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_writer.h"
 #include "storage/rowset/rowset_writer_context.h"
+#include "storage/rowset/segment.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet.h"
 
@@ -41,7 +51,8 @@ int32_t CompactionUtils::get_read_chunk_size(int64_t mem_limit, int32_t config_c
 
 Status CompactionUtils::construct_output_rowset_writer(Tablet* tablet, uint32_t max_rows_per_segment,
                                                        CompactionAlgorithm algorithm, Version version,
-                                                       std::unique_ptr<RowsetWriter>* output_rowset_writer) {
+                                                       std::unique_ptr<RowsetWriter>* output_rowset_writer,
+                                                       const std::vector<RowsetSharedPtr>& input_rowsets) {
     RowsetWriterContext context;
     context.rowset_id = StorageEngine::instance()->next_rowset_id();
     context.tablet_uid = tablet->tablet_uid();
@@ -56,6 +67,9 @@ Status CompactionUtils::construct_output_rowset_writer(Tablet* tablet, uint32_t
     context.max_rows_per_segment = max_rows_per_segment;
     context.writer_type =
             (algorithm == VERTICAL_COMPACTION ? RowsetWriterType::kVertical : RowsetWriterType::kHorizontal);
+    if (config::compaction_inherit_string_encoding) {
+        context.string_encodings = common_string_encodings(tablet->tablet_schema(), input_rowsets);
+    }
     Status st = RowsetFactory::create_rowset_writer(context, output_rowset_writer);
     if (!st.ok()) {
         std::stringstream ss;
@@ -66,6 +80,100 @@ Status CompactionUtils::construct_output_rowset_writer(Tablet* tablet, uint32_t
     return Status::OK();
 }
 
+std::unordered_map<uint32_t, EncodingTypePB> CompactionUtils::common_string_encodings(
+        const TabletSchema& schema, const std::vector<RowsetSharedPtr>& rowsets) {
+    std::unordered_map<uint32_t, EncodingTypePB> encodings;
+    if (rowsets.empty()) {
+        return encodings;
+    }
+    for (const auto& rowset : rowsets) {
+        // Loaded by the compaction anyway.
+        if (!rowset->load().ok()) {
+            return {};
+        }
+    }
+    for (size_t cid = 0; cid < schema.num_columns(); cid++) {
+        const auto& column = schema.column(cid);
+        if (column.type() != OLAP_FIELD_TYPE_CHAR && column.type() != OLAP_FIELD_TYPE_VARCHAR) {
+            continue;
+        }
+        EncodingTypePB common = DEFAULT_ENCODING;
+        bool decided = true;
+        for (const auto& rowset : rowsets) {
+            for (const auto& segment : rowset->segments()) {
+                const ColumnReader* reader = cid < segment->num_columns() ? segment->column(cid) : nullptr;
+                EncodingTypePB encoding = DEFAULT_ENCODING;
+                if (reader != nullptr && reader->encoding_info() != nullptr) {
+                    encoding = reader->encoding_info()->encoding();
+                    if (encoding == DICT_ENCODING && !(reader->has_all_dict_encoded() && reader->all_dict_encoded())) {
+                        // Some pages fell back to plain encoding.
+                        encoding = DEFAULT_ENCODING;
+                    }
+                }
+                if (encoding == DEFAULT_ENCODING || (common != DEFAULT_ENCODING && common != encoding)) {
+                    decided = false;
+                    break;
+                }
+                common = encoding;
+            }
+            if (!decided) {
+                break;
+            }
+        }
+        if (decided && (common == DICT_ENCODING || common == PLAIN_ENCODING)) {
+            encodings.emplace(column.unique_id(), common);
+        }
+    }
+    return encodings;
+}
+
+StatusOr<bool> CompactionUtils::segments_in_key_order(const TabletSchema& schema,
+                                                      const std::vector<RowsetSharedPtr>& rowsets,
+                                                      bool allow_equal_keys) {
+    std::vector<ColumnId> key_cids(schema.num_key_columns());
+    std::iota(key_cids.begin(), key_cids.end(), 0);
+    auto key_schema = ChunkHelper::convert_schema_to_format_v2(schema, key_cids);
+    // The first and the last keys of the segments in order.
+    auto keys = ChunkHelper::new_chunk(key_schema, 2 * rowsets.size());
+    OlapReaderStatistics stats;
+    for (const auto& rowset : rowsets) {
+        if (rowset->num_segments() > 1 && rowset->rowset_meta()->segments_overlap() != NONOVERLAPPING) {
+            return false;
+        }
+        RETURN_IF_ERROR(rowset->load());
+        for (const auto& segment : rowset->segments()) {
+            if (segment->num_rows() == 0) {
+                continue;
+            }
+            ASSIGN_OR_RETURN(auto read_file, segment->file_system()->new_random_access_file(segment->file_name()));
+            ColumnIteratorOptions iter_opts;
+            iter_opts.read_file = read_file.get();
+            iter_opts.stats = &stats;
+            rowid_t rowids[2] = {0, segment->num_rows() - 1};
+            size_t first = keys->num_rows();
+            for (size_t i = 0; i < key_cids.size(); i++) {
+                ColumnIterator* raw_iter = nullptr;
+                RETURN_IF_ERROR(segment->new_column_iterator(key_cids[i], &raw_iter));
+                std::unique_ptr<ColumnIterator> iter(raw_iter);
+                RETURN_IF_ERROR(iter->init(iter_opts));
+                RETURN_IF_ERROR(iter->fetch_values_by_rowid(rowids, 2, keys->get_column_by_index(i).get()));
+            }
+            if (first == 0) {
+                continue;
+            }
+            int cmp = 0;
+            for (size_t i = 0; i < key_cids.size() && cmp == 0; i++) {
+                const auto& column = keys->get_column_by_index(i);
+                cmp = column->compare_at(first - 1, first, *column, -1);
+            }
+            if (cmp > 0 || (cmp == 0 && !allow_equal_keys)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 uint32_t CompactionUtils::get_segment_max_rows(int64_t max_segment_file_size, int64_t input_row_num,
                                                int64_t input_rowsets_size) {
     // The range of config::max_segment_file_size is between [1, INT64_MAX]
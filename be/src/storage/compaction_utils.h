@@ -4,16 +4,22 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include "common/status.h"
+#include "common/statusor.h"
+#include "gen_cpp/segment.pb.h"
 #include "storage/olap_common.h"
 
 namespace starrocks {
 
 class CompactionPolicy;
 class CompactionContext;
+class Rowset;
 class RowsetWriter;
 class Tablet;
+class TabletSchema;
 
 enum CompactionAlgorithm {
     // compaction by all columns together.
@@ -37,9 +43,24 @@ public:
     static int32_t get_read_chunk_size(int64_t mem_limit, int32_t config_chunk_size, int64_t total_num_rows,
                                        int64_t total_mem_footprint, size_t source_num);
 
+    // The string columns of the output keep the encodings shared by all segments of |input_rowsets|.
     static Status construct_output_rowset_writer(Tablet* tablet, uint32_t max_rows_per_segment,
                                                  CompactionAlgorithm algorithm, Version version,
-                                                 std::unique_ptr<RowsetWriter>* output_rowset_writer);
+                                                 std::unique_ptr<RowsetWriter>* output_rowset_writer,
+                                                 const std::vector<std::shared_ptr<Rowset>>& input_rowsets = {});
+
+    // The encodings of the string columns of |schema| shared by all segments of |rowsets|, by unique id.
+    // A column is DICT_ENCODING if all of its pages are dict encoded in every segment, or PLAIN_ENCODING
+    // if it's plain encoded in every segment, and not decided otherwise.
+    static std::unordered_map<uint32_t, EncodingTypePB> common_string_encodings(
+            const TabletSchema& schema, const std::vector<std::shared_ptr<Rowset>>& rowsets);
+
+    // Whether the segments of |rowsets| in order are sorted by the key columns of |schema|, i.e. the first
+    // key of each segment is greater than the last key of the previous one, or not less than it if
+    // |allow_equal_keys|. Only the first and the last row of each segment are read.
+    static StatusOr<bool> segments_in_key_order(const TabletSchema& schema,
+                                                const std::vector<std::shared_ptr<Rowset>>& rowsets,
+                                                bool allow_equal_keys);
 
     static uint32_t get_segment_max_rows(int64_t max_segment_file_size, int64_t input_row_num, int64_t input_size);
 
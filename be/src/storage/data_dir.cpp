@@ -52,6 +52,7 @@
 #include "util/errno.h"
 #include "util/monotime.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 
 using strings::Substitute;
 
@@ -70,6 +71,8 @@ DataDir::DataDir(const std::string& path, TStorageMedium::type storage_medium, T
           _tablet_manager(tablet_manager),
           _txn_manager(txn_manager),
           _cluster_id_mgr(std::make_shared<ClusterIdMgr>(path)),
+          _compaction_io_throttle(storage_medium == TStorageMedium::SSD),
+          _file_syncer(path),
           _current_shard(0) {}
 
 DataDir::~DataDir() {
@@ -254,31 +257,71 @@ Status DataDir::load() {
         LOG(INFO) << "load rowset from meta finished, data dir: " << _path;
     }
 
+    // The tablets and the rowsets are loaded by a pool of threads, in batches submitted while walking the meta.
+    // A batch is loaded by the walking thread itself once the queue of the pool is full.
+    const int num_load_threads = std::max(1, config::load_tablet_threads_per_data_dir);
+    std::unique_ptr<ThreadPool> load_pool;
+    RETURN_IF_ERROR(ThreadPoolBuilder("load_tablet")
+                            .set_min_threads(num_load_threads)
+                            .set_max_threads(num_load_threads)
+                            .set_max_queue_size(num_load_threads * 2)
+                            .build(&load_pool));
+    auto run_in_load_pool = [&load_pool](std::function<void()> func) {
+        if (!load_pool->submit_func(func).ok()) {
+            func();
+        }
+    };
+    static constexpr size_t kLoadBatchSize = 1024;
+
     // load tablet
     // create tablet from tablet meta and add it to tablet mgr
     LOG(INFO) << "begin loading tablet from meta";
+    struct TabletMetaEntry {
+        int64_t tablet_id;
+        int32_t schema_hash;
+        std::string value;
+    };
+    std::mutex tablet_ids_mutex;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](int64_t tablet_id, int32_t schema_hash,
-                                                                    std::string_view value) -> bool {
-        Status st =
-                _tablet_manager->load_tablet_from_meta(this, tablet_id, schema_hash, value, false, false, false, false);
-        if (!st.ok() && !st.is_not_found()) {
-            // load_tablet_from_meta() may return NotFound which means the tablet status is DELETED
-            // This may happen when the tablet was just deleted before the BE restarted,
-            // but it has not been cleared from rocksdb. At this time, restarting the BE
-            // will read the tablet in the DELETE state from rocksdb. These tablets have been
-            // added to the garbage collection queue and will be automatically deleted afterwards.
-            // Therefore, we believe that this situation is not a failure.
-            LOG(WARNING) << "load tablet from header failed. status:" << st.to_string() << ", tablet=" << tablet_id
-                         << "." << schema_hash;
-            failed_tablet_ids.insert(tablet_id);
-        } else {
-            tablet_ids.insert(tablet_id);
+    auto load_tablets = [this, &tablet_ids_mutex, &tablet_ids,
+                         &failed_tablet_ids](const std::vector<TabletMetaEntry>& entries) {
+        for (const auto& entry : entries) {
+            Status st = _tablet_manager->load_tablet_from_meta(this, entry.tablet_id, entry.schema_hash, entry.value,
+                                                               false, false, false, false);
+            std::lock_guard l(tablet_ids_mutex);
+            if (!st.ok() && !st.is_not_found()) {
+                // load_tablet_from_meta() may return NotFound which means the tablet status is DELETED
+                // This may happen when the tablet was just deleted before the BE restarted,
+                // but it has not been cleared from rocksdb. At this time, restarting the BE
+                // will read the tablet in the DELETE state from rocksdb. These tablets have been
+                // added to the garbage collection queue and will be automatically deleted afterwards.
+                // Therefore, we believe that this situation is not a failure.
+                LOG(WARNING) << "load tablet from header failed. status:" << st.to_string()
+                             << ", tablet=" << entry.tablet_id << "." << entry.schema_hash;
+                failed_tablet_ids.insert(entry.tablet_id);
+            } else {
+                tablet_ids.insert(entry.tablet_id);
+            }
+        }
+    };
+    auto tablet_batch = std::make_shared<std::vector<TabletMetaEntry>>();
+    auto submit_tablet_batch = [&]() {
+        run_in_load_pool([&load_tablets, batch = std::move(tablet_batch)]() { load_tablets(*batch); });
+        tablet_batch = std::make_shared<std::vector<TabletMetaEntry>>();
+    };
+    auto load_tablet_func = [&](int64_t tablet_id, int32_t schema_hash, std::string_view value) -> bool {
+        tablet_batch->push_back({tablet_id, schema_hash, std::string(value)});
+        if (tablet_batch->size() >= kLoadBatchSize) {
+            submit_tablet_batch();
         }
         return true;
     };
     Status load_tablet_status = TabletMetaManager::walk(_kv_store, load_tablet_func);
+    if (!tablet_batch->empty()) {
+        submit_tablet_batch();
+    }
+    load_pool->wait();
     if (failed_tablet_ids.size() != 0) {
         LOG(ERROR) << "load tablets from header failed"
                    << ", loaded tablet: " << tablet_ids.size() << ", error tablet: " << failed_tablet_ids.size()
@@ -301,54 +344,58 @@ Status DataDir::load() {
     // 1. add committed rowset to txn map
     // 2. add visible rowset to tablet
     // ignore any errors when load tablet or rowset, because fe will repair them after report
-    for (const auto& rowset_meta : dir_rowset_metas) {
-        TabletSharedPtr tablet = _tablet_manager->get_tablet(rowset_meta->tablet_id(), false);
-        // tablet maybe dropped, but not drop related rowset meta
-        if (tablet == nullptr) {
-            // LOG(WARNING) << "could not find tablet id: " << rowset_meta->tablet_id()
-            //              << ", schema hash: " << rowset_meta->tablet_schema_hash()
-            //              << ", for rowset: " << rowset_meta->rowset_id() << ", skip this rowset";
-            continue;
-        }
-        RowsetSharedPtr rowset;
-        Status create_status = RowsetFactory::create_rowset(&tablet->tablet_schema(), tablet->schema_hash_path(),
-                                                            rowset_meta, &rowset);
-        if (!create_status.ok()) {
-            LOG(WARNING) << "Fail to create rowset from rowsetmeta,"
-                         << " rowset=" << rowset_meta->rowset_id() << " state=" << rowset_meta->rowset_state();
-            continue;
-        }
-        if (rowset_meta->rowset_state() == RowsetStatePB::COMMITTED &&
-            rowset_meta->tablet_uid() == tablet->tablet_uid()) {
-            Status commit_txn_status = _txn_manager->commit_txn(
-                    _kv_store, rowset_meta->partition_id(), rowset_meta->txn_id(), rowset_meta->tablet_id(),
-                    rowset_meta->tablet_schema_hash(), rowset_meta->tablet_uid(), rowset_meta->load_id(), rowset, true);
-            if (!commit_txn_status.ok() && !commit_txn_status.is_already_exist()) {
-                LOG(WARNING) << "Fail to add committed rowset=" << rowset_meta->rowset_id()
-                             << " tablet=" << rowset_meta->tablet_id() << " txn_id: " << rowset_meta->txn_id();
-            } else {
-                LOG(INFO) << "Added committed rowset=" << rowset_meta->rowset_id()
-                          << " tablet=" << rowset_meta->tablet_id()
-                          << " schema hash=" << rowset_meta->tablet_schema_hash()
-                          << " txn_id: " << rowset_meta->txn_id();
-            }
-        } else if (rowset_meta->rowset_state() == RowsetStatePB::VISIBLE &&
-                   rowset_meta->tablet_uid() == tablet->tablet_uid()) {
-            Status publish_status = tablet->add_rowset(rowset, false);
-            if (!publish_status.ok() && !publish_status.is_already_exist()) {
-                LOG(WARNING) << "Fail to add visible rowset=" << rowset->rowset_id()
-                             << " to tablet=" << rowset_meta->tablet_id() << " txn id=" << rowset_meta->txn_id()
-                             << " start version=" << rowset_meta->version().first
-                             << " end version=" << rowset_meta->version().second;
+    for (size_t begin = 0; begin < dir_rowset_metas.size(); begin += kLoadBatchSize) {
+        size_t end = std::min(begin + kLoadBatchSize, dir_rowset_metas.size());
+        run_in_load_pool([this, &dir_rowset_metas, begin, end]() {
+            for (size_t i = begin; i < end; ++i) {
+                _load_rowset(dir_rowset_metas[i]);
             }
+        });
+    }
+    load_pool->wait();
+    return Status::OK();
+}
+
+void DataDir::_load_rowset(const RowsetMetaSharedPtr& rowset_meta) {
+    TabletSharedPtr tablet = _tablet_manager->get_tablet(rowset_meta->tablet_id(), false);
+    // tablet maybe dropped, but not drop related rowset meta
+    if (tablet == nullptr) {
+        return;
+    }
+    RowsetSharedPtr rowset;
+    Status create_status = RowsetFactory::create_rowset(&tablet->tablet_schema(), tablet->schema_hash_path(),
+                                                        rowset_meta, &rowset);
+    if (!create_status.ok()) {
+        LOG(WARNING) << "Fail to create rowset from rowsetmeta,"
+                     << " rowset=" << rowset_meta->rowset_id() << " state=" << rowset_meta->rowset_state();
+        return;
+    }
+    if (rowset_meta->rowset_state() == RowsetStatePB::COMMITTED && rowset_meta->tablet_uid() == tablet->tablet_uid()) {
+        Status commit_txn_status = _txn_manager->commit_txn(
+                _kv_store, rowset_meta->partition_id(), rowset_meta->txn_id(), rowset_meta->tablet_id(),
+                rowset_meta->tablet_schema_hash(), rowset_meta->tablet_uid(), rowset_meta->load_id(), rowset, true);
+        if (!commit_txn_status.ok() && !commit_txn_status.is_already_exist()) {
+            LOG(WARNING) << "Fail to add committed rowset=" << rowset_meta->rowset_id()
+                         << " tablet=" << rowset_meta->tablet_id() << " txn_id: " << rowset_meta->txn_id();
         } else {
-            LOG(WARNING) << "Found invalid rowset=" << rowset_meta->rowset_id()
-                         << " tablet id=" << rowset_meta->tablet_id() << " tablet uid=" << rowset_meta->tablet_uid()
-                         << " schema hash=" << rowset_meta->tablet_schema_hash() << " txn_id: " << rowset_meta->txn_id()
-                         << " current valid tablet uid=" << tablet->tablet_uid();
+            LOG(INFO) << "Added committed rowset=" << rowset_meta->rowset_id() << " tablet=" << rowset_meta->tablet_id()
+                      << " schema hash=" << rowset_meta->tablet_schema_hash() << " txn_id: " << rowset_meta->txn_id();
         }
+    } else if (rowset_meta->rowset_state() == RowsetStatePB::VISIBLE &&
+               rowset_meta->tablet_uid() == tablet->tablet_uid()) {
+        Status publish_status = tablet->add_rowset(rowset, false);
+        if (!publish_status.ok() && !publish_status.is_already_exist()) {
+            LOG(WARNING) << "Fail to add visible rowset=" << rowset->rowset_id()
+                         << " to tablet=" << rowset_meta->tablet_id() << " txn id=" << rowset_meta->txn_id()
+                         << " start version=" << rowset_meta->version().first
+                         << " end version=" << rowset_meta->version().second;
+        }
+    } else {
+        LOG(WARNING) << "Found invalid rowset=" << rowset_meta->rowset_id() << " tablet id=" << rowset_meta->tablet_id()
+                     << " tablet uid=" << rowset_meta->tablet_uid()
+                     << " schema hash=" << rowset_meta->tablet_schema_hash() << " txn_id: " << rowset_meta->txn_id()
+                     << " current valid tablet uid=" << tablet->tablet_uid();
     }
-    return Status::OK();
 }
 
 // gc unused tablet schemahash dir
@@ -23,6 +23,7 @@
 
 #include <condition_variable>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <shared_mutex>
@@ -33,12 +34,16 @@
 #include "gen_cpp/Types_types.h"
 #include "gen_cpp/olap_file.pb.h"
 #include "storage/cluster_id_mgr.h"
+#include "storage/compaction_io_throttle.h"
+#include "storage/group_commit_syncer.h"
 #include "storage/kv_store.h"
 #include "storage/olap_common.h"
 #include "storage/rowset/rowset_id_generator.h"
 
 namespace starrocks {
 
+class RowsetMeta;
+using RowsetMetaSharedPtr = std::shared_ptr<RowsetMeta>;
 class Tablet;
 class TabletManager;
 class TxnManager;
@@ -88,6 +93,10 @@ public:
 
     TStorageMedium::type storage_medium() const { return _storage_medium; }
 
+    CompactionIOThrottle* compaction_io_throttle() { return &_compaction_io_throttle; }
+
+    GroupCommitSyncer* file_syncer() { return &_file_syncer; }
+
     void register_tablet(Tablet* tablet);
     void deregister_tablet(Tablet* tablet);
     void clear_tablets(std::vector<TabletInfo>* tablet_infos);
@@ -129,6 +138,9 @@ private:
 
     void _process_garbage_path(const std::string& path);
 
+    // Add the rowset of |rowset_meta| to its tablet or to the txn manager, called by load().
+    void _load_rowset(const RowsetMetaSharedPtr& rowset_meta);
+
     bool _stop_bg_worker = false;
 
     std::shared_ptr<FileSystem> _fs;
@@ -144,6 +156,8 @@ private:
     TabletManager* _tablet_manager;
     TxnManager* _txn_manager;
     std::shared_ptr<ClusterIdMgr> _cluster_id_mgr;
+    CompactionIOThrottle _compaction_io_throttle;
+    GroupCommitSyncer _file_syncer;
 
     // used to protect _current_shard and _tablet_set
     std::mutex _mutex;
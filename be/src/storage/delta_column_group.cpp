@@ -0,0 +1,287 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/delta_column_group.h"
+
+#include <algorithm>
+#include <filesystem>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "fs/fs.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/exec_env.h"
+#include "storage/chunk_helper.h"
+#include "storage/olap_common.h"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_writer.h"
+#include "storage/tablet_schema.h"
+
+namespace starrocks {
+
+static int32_t find_column_by_unique_id(const TabletSchema& tablet_schema, uint32_t unique_id) {
+    for (size_t cid = 0; cid < tablet_schema.num_columns(); cid++) {
+        if (static_cast<uint32_t>(tablet_schema.column(cid).unique_id()) == unique_id) {
+            return static_cast<int32_t>(cid);
+        }
+    }
+    return -1;
+}
+
+DeltaColumnGroup::DeltaColumnGroup(const DeltaColumnGroupPB& pb)
+        : _version(pb.version()),
+          _file_name(pb.file_name()),
+          _column_unique_ids(pb.column_unique_ids().begin(), pb.column_unique_ids().end()),
+          _num_rows(pb.num_rows()) {}
+
+std::string DeltaColumnGroup::file_name(const RowsetId& rowset_id, uint32_t segment_id, int64_t version) {
+    return strings::Substitute("$0_$1_$2.cols", rowset_id.to_string(), segment_id, version);
+}
+
+StatusOr<std::shared_ptr<TabletSchema>> DeltaColumnGroup::file_schema(const TabletSchema& tablet_schema,
+                                                                      const std::vector<uint32_t>& column_unique_ids) {
+    TabletSchemaPB schema_pb;
+    tablet_schema.to_schema_pb(&schema_pb);
+    schema_pb.clear_column();
+    schema_pb.set_keys_type(DUP_KEYS);
+    schema_pb.set_num_short_key_columns(1);
+
+    ColumnPB* rowid_column = schema_pb.add_column();
+    rowid_column->set_unique_id(kRowidColumnUniqueId);
+    rowid_column->set_name("__rowid");
+    rowid_column->set_type("INT");
+    rowid_column->set_is_key(true);
+    rowid_column->set_is_nullable(false);
+    rowid_column->set_length(sizeof(int32_t));
+    rowid_column->set_index_length(sizeof(int32_t));
+    rowid_column->set_aggregation("NONE");
+    for (uint32_t unique_id : column_unique_ids) {
+        int32_t cid = find_column_by_unique_id(tablet_schema, unique_id);
+        if (cid < 0) {
+            return Status::NotFound(strings::Substitute("column unique id $0 not found in tablet schema", unique_id));
+        }
+        ColumnPB* column = schema_pb.add_column();
+        tablet_schema.column(cid).to_schema_pb(column);
+        column->set_is_key(false);
+    }
+    return std::make_shared<TabletSchema>(schema_pb);
+}
+
+Status DeltaColumnGroup::write(const std::string& path, const TabletSchema& tablet_schema,
+                               const std::vector<uint32_t>& column_unique_ids, const std::vector<rowid_t>& rowids,
+                               const std::vector<std::unique_ptr<vectorized::Column>>& columns) {
+    DCHECK_EQ(column_unique_ids.size(), columns.size());
+    DCHECK(std::is_sorted(rowids.begin(), rowids.end()));
+    ASSIGN_OR_RETURN(auto schema, file_schema(tablet_schema, column_unique_ids));
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(path));
+    WritableFileOptions wopts{.sync_on_close = true, .mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE};
+    ASSIGN_OR_RETURN(auto wfile, fs->new_writable_file(wopts, path));
+
+    SegmentWriterOptions opts;
+    SegmentWriter writer(std::move(wfile), 0, schema.get(), opts);
+    RETURN_IF_ERROR(writer.init());
+
+    auto chunk_schema = ChunkHelper::convert_schema_to_format_v2(*schema);
+    auto chunk = ChunkHelper::new_chunk(chunk_schema, rowids.size());
+    static_assert(sizeof(rowid_t) == sizeof(int32_t));
+    (void)chunk->get_column_by_index(0)->append_numbers(rowids.data(), rowids.size() * sizeof(rowid_t));
+    for (size_t i = 0; i < columns.size(); i++) {
+        DCHECK_EQ(rowids.size(), columns[i]->size());
+        chunk->get_column_by_index(i + 1)->append(*columns[i]);
+    }
+    RETURN_IF_ERROR(writer.append_chunk(*chunk));
+    uint64_t file_size = 0;
+    uint64_t index_size = 0;
+    uint64_t footer_position = 0;
+    return writer.finalize(&file_size, &index_size, &footer_position);
+}
+
+int DeltaColumnGroup::column_index(uint32_t unique_id) const {
+    auto iter = std::find(_column_unique_ids.begin(), _column_unique_ids.end(), unique_id);
+    return iter == _column_unique_ids.end() ? -1 : static_cast<int>(iter - _column_unique_ids.begin());
+}
+
+void DeltaColumnGroup::to_pb(DeltaColumnGroupPB* pb) const {
+    pb->set_version(_version);
+    pb->set_file_name(_file_name);
+    pb->mutable_column_unique_ids()->Clear();
+    for (uint32_t unique_id : _column_unique_ids) {
+        pb->add_column_unique_ids(unique_id);
+    }
+    pb->set_num_rows(_num_rows);
+}
+
+Status DeltaColumnGroup::load(const std::string& dir, const TabletSchema& tablet_schema) {
+    std::lock_guard<std::mutex> l(_load_lock);
+    if (_loaded) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_do_load(dir, tablet_schema));
+    _loaded = true;
+    return Status::OK();
+}
+
+Status DeltaColumnGroup::_do_load(const std::string& dir, const TabletSchema& tablet_schema) {
+    std::string path = dir + "/" + _file_name;
+    ASSIGN_OR_RETURN(std::shared_ptr<const TabletSchema> schema, file_schema(tablet_schema, _column_unique_ids));
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(path));
+    ASSIGN_OR_RETURN(auto segment,
+                     Segment::open(ExecEnv::GetInstance()->tablet_meta_mem_tracker(), fs, path, 0, schema));
+    if (segment->num_rows() != _num_rows) {
+        return Status::Corruption(strings::Substitute("bad delta column group $0: #rows $1 != $2", path,
+                                                      segment->num_rows(), _num_rows));
+    }
+    ASSIGN_OR_RETURN(auto read_file, fs->new_random_access_file(path));
+    OlapReaderStatistics stats;
+    ColumnIteratorOptions iter_opts;
+    iter_opts.stats = &stats;
+    iter_opts.read_file = read_file.get();
+
+    auto chunk_schema = ChunkHelper::convert_schema_to_format_v2(*schema);
+    std::vector<std::unique_ptr<vectorized::Column>> columns(schema->num_columns());
+    for (uint32_t cid = 0; cid < schema->num_columns(); cid++) {
+        ColumnIterator* raw_iter = nullptr;
+        RETURN_IF_ERROR(segment->new_column_iterator(cid, &raw_iter));
+        std::unique_ptr<ColumnIterator> iter(raw_iter);
+        RETURN_IF_ERROR(iter->init(iter_opts));
+        RETURN_IF_ERROR(iter->seek_to_first());
+        columns[cid] = ChunkHelper::column_from_field(*chunk_schema.field(cid))->clone_empty();
+        columns[cid]->reserve(_num_rows);
+        size_t n = _num_rows;
+        RETURN_IF_ERROR(iter->next_batch(&n, columns[cid].get()));
+        if (n != _num_rows) {
+            return Status::Corruption(strings::Substitute("bad delta column group $0: read $1 of $2 rows", path, n,
+                                                          _num_rows));
+        }
+    }
+    const auto& rowid_data = down_cast<const vectorized::Int32Column*>(columns[0].get())->get_data();
+    _rowids.resize(_num_rows);
+    memcpy(_rowids.data(), rowid_data.data(), _num_rows * sizeof(rowid_t));
+    _columns.clear();
+    for (size_t i = 1; i < columns.size(); i++) {
+        _columns.emplace_back(std::move(columns[i]));
+    }
+    return Status::OK();
+}
+
+size_t DeltaColumnGroup::memory_usage() const {
+    size_t size = sizeof(*this) + _file_name.size() + _rowids.capacity() * sizeof(rowid_t);
+    for (const auto& column : _columns) {
+        size += column->memory_usage();
+    }
+    return size;
+}
+
+bool is_column_updated(const DeltaColumnGroupList& dcgs, uint32_t unique_id) {
+    return std::any_of(dcgs.begin(), dcgs.end(), [&](const auto& dcg) { return dcg->column_index(unique_id) >= 0; });
+}
+
+Status DeltaColumnIterator::wrap(const Segment& segment, uint32_t cid, const DeltaColumnGroupList& dcgs,
+                                 ColumnIterator** iter) {
+    std::unique_ptr<ColumnIterator> base(*iter);
+    *iter = nullptr;
+    auto unique_id = static_cast<uint32_t>(segment.tablet_schema().column(cid).unique_id());
+    std::vector<std::pair<DeltaColumnGroupPtr, size_t>> groups;
+    std::string dir;
+    for (const auto& dcg : dcgs) {
+        int idx = dcg->column_index(unique_id);
+        if (idx < 0) {
+            continue;
+        }
+        if (dir.empty()) {
+            dir = std::filesystem::path(segment.file_name()).parent_path().string();
+        }
+        RETURN_IF_ERROR(dcg->load(dir, segment.tablet_schema()));
+        groups.emplace_back(dcg, idx);
+    }
+    if (groups.empty()) {
+        *iter = base.release();
+    } else {
+        *iter = new DeltaColumnIterator(std::move(base), segment.num_rows(), std::move(groups));
+    }
+    return Status::OK();
+}
+
+DeltaColumnIterator::DeltaColumnIterator(std::unique_ptr<ColumnIterator> base, uint32_t num_rows,
+                                         std::vector<std::pair<DeltaColumnGroupPtr, size_t>> groups)
+        : _base(std::move(base)), _num_rows(num_rows), _groups(std::move(groups)) {}
+
+Status DeltaColumnIterator::init(const ColumnIteratorOptions& opts) {
+    RETURN_IF_ERROR(ColumnIterator::init(opts));
+    // The dictionary codes don't cover the updated values.
+    ColumnIteratorOptions base_opts = opts;
+    base_opts.check_dict_encoding = false;
+    return _base->init(base_opts);
+}
+
+Status DeltaColumnIterator::next_batch(size_t* n, vectorized::Column* dst) {
+    auto from = static_cast<rowid_t>(_base->get_current_ordinal());
+    size_t dst_offset = dst->size();
+    RETURN_IF_ERROR(_base->next_batch(n, dst));
+    return _overlay(from, from + *n, dst_offset, dst);
+}
+
+Status DeltaColumnIterator::next_batch(const vectorized::SparseRange& range, vectorized::Column* dst) {
+    size_t dst_offset = dst->size();
+    RETURN_IF_ERROR(_base->next_batch(range, dst));
+    DCHECK_EQ(dst_offset + range.span_size(), dst->size());
+    for (size_t i = 0; i < range.size(); i++) {
+        const auto& r = range[i];
+        RETURN_IF_ERROR(_overlay(r.begin(), r.end(), dst_offset, dst));
+        dst_offset += r.span_size();
+    }
+    return Status::OK();
+}
+
+Status DeltaColumnIterator::get_row_ranges_by_zone_map(
+        const std::vector<const vectorized::ColumnPredicate*>& predicates,
+        const vectorized::ColumnPredicate* del_predicate, vectorized::SparseRange* row_ranges) {
+    row_ranges->add(vectorized::Range(0, _num_rows));
+    return Status::OK();
+}
+
+Status DeltaColumnIterator::fetch_values_by_rowid(const rowid_t* rowids, size_t size, vectorized::Column* values) {
+    size_t dst_offset = values->size();
+    RETURN_IF_ERROR(_base->fetch_values_by_rowid(rowids, size, values));
+    std::vector<uint32_t> positions;
+    for (const auto& [group, idx] : _groups) {
+        // Both |rowids| and the rowids of the group are ascending.
+        const auto& group_rowids = group->rowids();
+        positions.clear();
+        _indexes.clear();
+        size_t j = 0;
+        for (size_t i = 0; i < size && j < group_rowids.size(); i++) {
+            j = std::lower_bound(group_rowids.begin() + j, group_rowids.end(), rowids[i]) - group_rowids.begin();
+            if (j < group_rowids.size() && group_rowids[j] == rowids[i]) {
+                positions.push_back(j);
+                _indexes.push_back(dst_offset + i);
+            }
+        }
+        if (!positions.empty()) {
+            auto src = group->column(idx).clone_empty();
+            src->append_selective(group->column(idx), positions.data(), 0, positions.size());
+            RETURN_IF_ERROR(values->update_rows(*src, _indexes.data()));
+        }
+    }
+    return Status::OK();
+}
+
+Status DeltaColumnIterator::_overlay(rowid_t from, rowid_t to, size_t dst_offset, vectorized::Column* dst) {
+    for (const auto& [group, idx] : _groups) {
+        const auto& group_rowids = group->rowids();
+        auto begin = std::lower_bound(group_rowids.begin(), group_rowids.end(), from);
+        auto end = std::lower_bound(begin, group_rowids.end(), to);
+        if (begin == end) {
+            continue;
+        }
+        _indexes.resize(end - begin);
+        for (auto iter = begin; iter != end; ++iter) {
+            _indexes[iter - begin] = dst_offset + (*iter - from);
+        }
+        auto src = group->column(idx).clone_empty();
+        src->append(group->column(idx), begin - group_rowids.begin(), end - begin);
+        RETURN_IF_ERROR(dst->update_rows(*src, _indexes.data()));
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,143 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "column/column.h"
+#include "common/status.h"
+#include "common/statusor.h"
+#include "gen_cpp/olap_file.pb.h"
+#include "storage/olap_common.h"
+#include "storage/rowset/column_iterator.h"
+
+namespace starrocks {
+
+class Segment;
+class TabletSchema;
+
+// A DeltaColumnGroup holds the values of some columns of a segment, which are updated by a column mode
+// partial update at |version|. They are written into a file of the tablet directory instead of the segment,
+// so the other columns of the updated rows are neither read nor rewritten.
+//
+// The file is a segment whose first column is the ascending rowids of the updated rows in the updated
+// segment, followed by the updated columns. It's named by the rowset of the updated segment, i.e.
+// `<rowset id>_<segment id>_<version>.cols`, so it's garbage collected with the rowset.
+class DeltaColumnGroup {
+public:
+    // The unique id of the rowid column in the file, which never collides with a tablet column.
+    static constexpr int32_t kRowidColumnUniqueId = std::numeric_limits<int32_t>::max();
+
+    explicit DeltaColumnGroup(const DeltaColumnGroupPB& pb);
+
+    static std::string file_name(const RowsetId& rowset_id, uint32_t segment_id, int64_t version);
+
+    // The schema of the file of the columns |column_unique_ids| of |tablet_schema|.
+    static StatusOr<std::shared_ptr<TabletSchema>> file_schema(const TabletSchema& tablet_schema,
+                                                               const std::vector<uint32_t>& column_unique_ids);
+
+    // Write the file to |path|, |columns| are the values of the columns |column_unique_ids| of the rows
+    // |rowids|, which are ascending.
+    static Status write(const std::string& path, const TabletSchema& tablet_schema,
+                        const std::vector<uint32_t>& column_unique_ids, const std::vector<rowid_t>& rowids,
+                        const std::vector<std::unique_ptr<vectorized::Column>>& columns);
+
+    int64_t version() const { return _version; }
+
+    const std::string& file_name() const { return _file_name; }
+
+    const std::vector<uint32_t>& column_unique_ids() const { return _column_unique_ids; }
+
+    // Returns the index of |unique_id| in column_unique_ids(), or -1 if the column is not updated.
+    int column_index(uint32_t unique_id) const;
+
+    void to_pb(DeltaColumnGroupPB* pb) const;
+
+    // Load the rowids and the values from the file in |dir| at the first call. |tablet_schema| is the schema
+    // of the updated segment. Thread-safe.
+    Status load(const std::string& dir, const TabletSchema& tablet_schema);
+
+    // The following methods are available after load().
+    const std::vector<rowid_t>& rowids() const { return _rowids; }
+
+    const vectorized::Column& column(size_t idx) const { return *_columns[idx]; }
+
+    size_t memory_usage() const;
+
+private:
+    Status _do_load(const std::string& dir, const TabletSchema& tablet_schema);
+
+    int64_t _version = 0;
+    std::string _file_name;
+    std::vector<uint32_t> _column_unique_ids;
+    uint32_t _num_rows = 0;
+
+    std::mutex _load_lock;
+    bool _loaded = false;
+    std::vector<rowid_t> _rowids;
+    std::vector<std::unique_ptr<vectorized::Column>> _columns;
+};
+
+using DeltaColumnGroupPtr = std::shared_ptr<DeltaColumnGroup>;
+// The delta column groups of a segment, in the ascending order of version.
+using DeltaColumnGroupList = std::vector<DeltaColumnGroupPtr>;
+
+// Whether the column |unique_id| is updated by any of |dcgs|.
+bool is_column_updated(const DeltaColumnGroupList& dcgs, uint32_t unique_id);
+
+// DeltaColumnIterator reads a column of a segment by |base|, and replaces the values of the rows
+// updated by the delta column groups. The later group wins if a row is updated more than once.
+//
+// The zone maps and the dictionary codes of the segment are stale for the updated rows, so they are not
+// exposed, i.e. no page is pruned and the values are always decoded.
+class DeltaColumnIterator final : public ColumnIterator {
+public:
+    // |groups| are the loaded groups updating this column in the ascending order of version, with the index
+    // of this column in each group.
+    DeltaColumnIterator(std::unique_ptr<ColumnIterator> base, uint32_t num_rows,
+                        std::vector<std::pair<DeltaColumnGroupPtr, size_t>> groups);
+
+    ~DeltaColumnIterator() override = default;
+
+    // Replace |*iter|, a new iterator of the column |cid| of |segment|, by a DeltaColumnIterator owning it
+    // if the column is updated by |dcgs|, which are loaded on demand. |*iter| is not initialized yet.
+    // |*iter| is deleted and set to nullptr on error.
+    static Status wrap(const Segment& segment, uint32_t cid, const DeltaColumnGroupList& dcgs, ColumnIterator** iter);
+
+    Status init(const ColumnIteratorOptions& opts) override;
+
+    Status seek_to_first() override { return _base->seek_to_first(); }
+
+    Status seek_to_ordinal(ordinal_t ord) override { return _base->seek_to_ordinal(ord); }
+
+    Status next_batch(size_t* n, ColumnBlockView* dst, bool* has_null) override {
+        return Status::NotSupported("DeltaColumnIterator does not support ColumnBlockView");
+    }
+
+    Status next_batch(size_t* n, vectorized::Column* dst) override;
+
+    Status next_batch(const vectorized::SparseRange& range, vectorized::Column* dst) override;
+
+    ordinal_t get_current_ordinal() const override { return _base->get_current_ordinal(); }
+
+    Status get_row_ranges_by_zone_map(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                      const vectorized::ColumnPredicate* del_predicate,
+                                      vectorized::SparseRange* row_ranges) override;
+
+    Status fetch_values_by_rowid(const rowid_t* rowids, size_t size, vectorized::Column* values) override;
+
+private:
+    // Replace the values of the rows [from, to), which are at |dst_offset| of |dst|.
+    Status _overlay(rowid_t from, rowid_t to, size_t dst_offset, vectorized::Column* dst);
+
+    std::unique_ptr<ColumnIterator> _base;
+    uint32_t _num_rows;
+    std::vector<std::pair<DeltaColumnGroupPtr, size_t>> _groups;
+    std::vector<uint32_t> _indexes;
+};
+
+} // namespace starrocks
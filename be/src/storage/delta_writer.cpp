@@ -2,8 +2,19 @@
 
 #include "storage/delta_writer.h"
 
+#include "common/compiler_util.h"
+DIAGNOSTIC_PUSH
+DIAGNOSTIC_IGNORE("-Wclass-memaccess")
+#include <brpc/controller.h>
+DIAGNOSTIC_POP
+
+#include <chrono>
+
+#include "fs/fs.h"
+#include "gen_cpp/doris_internal_service.pb.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "storage/memtable.h"
 #include "storage/memtable_flush_executor.h"
 #include "storage/memtable_rowset_writer_sink.h"
@@ -13,9 +24,18 @@
 #include "storage/tablet_updates.h"
 #include "storage/txn_manager.h"
 #include "storage/update_manager.h"
+#include "util/brpc_stub_cache.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks::vectorized {
 
+// The memtables being written by all the loads on this BE, by which the memtables to flush ahead are chosen,
+// its capacity is never used.
+static SharedWriteBuffer* all_memtables() {
+    static SharedWriteBuffer s_all_memtables(0);
+    return &s_all_memtables;
+}
+
 StatusOr<std::unique_ptr<DeltaWriter>> DeltaWriter::open(const DeltaWriterOptions& opt, MemTracker* mem_tracker) {
     std::unique_ptr<DeltaWriter> writer(new DeltaWriter(opt, mem_tracker, StorageEngine::instance()));
     SCOPED_THREAD_LOCAL_MEM_SETTER(mem_tracker, false);
@@ -53,6 +73,7 @@ DeltaWriter::~DeltaWriter() {
         _garbage_collection();
         break;
     }
+    _update_shared_write_buffer(0);
     _mem_table.reset();
     _mem_table_sink.reset();
     _rowset_writer.reset();
@@ -183,6 +204,9 @@ Status DeltaWriter::_init() {
     writer_context.load_id = _opt.load_id;
     writer_context.segments_overlap = OVERLAPPING;
     writer_context.global_dicts = _opt.global_dicts;
+    if (config::enable_load_group_commit_sync) {
+        writer_context.file_syncer = _tablet->data_dir()->file_syncer();
+    }
     Status st = RowsetFactory::create_rowset_writer(writer_context, &_rowset_writer);
     if (!st.ok()) {
         _set_state(kAborted);
@@ -210,8 +234,13 @@ Status DeltaWriter::write(const Chunk& chunk, const uint32_t* indexes, uint32_t
         return Status::InternalError(
                 fmt::format("Fail to prepare. tablet_id: {}, state: {}", _opt.tablet_id, _state_name(state)));
     }
+    if (UNLIKELY(_opt.replica_state == ReplicaState::Secondary)) {
+        return Status::InternalError(
+                fmt::format("Secondary replica does not accept chunks. tablet_id: {}", _opt.tablet_id));
+    }
     Status st;
     bool full = _mem_table->insert(chunk, indexes, from, size);
+    _update_shared_write_buffer(_mem_table->write_buffer_size());
     if (_mem_tracker->limit_exceeded()) {
         VLOG(2) << "Flushing memory table due to memory limit exceeded";
         st = _flush_memtable();
@@ -220,7 +249,13 @@ Status DeltaWriter::write(const Chunk& chunk, const uint32_t* indexes, uint32_t
         VLOG(2) << "Flushing memory table due to parent memory limit exceeded";
         st = _flush_memtable();
         _reset_mem_table();
-    } else if (full) {
+    } else if (full || (_opt.shared_write_buffer != nullptr &&
+                        _opt.shared_write_buffer->should_flush(_shared_write_buffer_bytes))) {
+        st = _flush_memtable_async();
+        _reset_mem_table();
+    } else if (_should_flush_ahead()) {
+        VLOG(2) << "Flushing memory table ahead due to load memory close to the limit";
+        StarRocksMetrics::instance()->memtable_flush_ahead_total.increment(1);
         st = _flush_memtable_async();
         _reset_mem_table();
     }
@@ -257,7 +292,13 @@ Status DeltaWriter::_flush_memtable_async() {
     if (_mem_table == nullptr) {
         return Status::OK();
     }
+    _update_shared_write_buffer(0);
     RETURN_IF_ERROR(_mem_table->finalize());
+    // At most memtable_max_flushing_per_tablet memtables wait for or are being flushed, so the memory of a load
+    // ingesting faster than the disks can flush is bounded.
+    if (config::memtable_max_flushing_per_tablet > 0) {
+        RETURN_IF_ERROR(_flush_token->wait_for_pending(config::memtable_max_flushing_per_tablet - 1));
+    }
     return _flush_token->submit(std::move(_mem_table));
 }
 
@@ -275,6 +316,25 @@ void DeltaWriter::_reset_mem_table() {
                                             _mem_table_sink.get(), _mem_tracker);
 }
 
+void DeltaWriter::_update_shared_write_buffer(int64_t bytes) {
+    if (_opt.shared_write_buffer != nullptr) {
+        _opt.shared_write_buffer->update(_shared_write_buffer_bytes, bytes);
+    }
+    all_memtables()->update(_shared_write_buffer_bytes, bytes);
+    _shared_write_buffer_bytes = bytes;
+}
+
+bool DeltaWriter::_should_flush_ahead() const {
+    MemTracker* load_mem_tracker = _mem_tracker->parent();
+    if (config::memtable_flush_ahead_percent <= 0 || load_mem_tracker == nullptr || !load_mem_tracker->has_limit()) {
+        return false;
+    }
+    if (load_mem_tracker->consumption() < load_mem_tracker->limit() / 100 * config::memtable_flush_ahead_percent) {
+        return false;
+    }
+    return all_memtables()->not_smaller_than_average(_shared_write_buffer_bytes);
+}
+
 Status DeltaWriter::commit() {
     Span span;
     if (_opt.parent_span) {
@@ -299,13 +359,23 @@ Status DeltaWriter::commit() {
         break;
     }
 
+    if (_opt.replica_state == ReplicaState::Secondary) {
+        if (auto st = _wait_primary_rowset(); UNLIKELY(!st.ok())) {
+            LOG(WARNING) << st;
+            _set_state(kAborted);
+            return st;
+        }
+    }
+
     if (auto st = _flush_token->wait(); UNLIKELY(!st.ok())) {
         LOG(WARNING) << st;
         _set_state(kAborted);
         return st;
     }
 
-    if (auto res = _rowset_writer->build(); res.ok()) {
+    auto res = _opt.replica_state == ReplicaState::Secondary ? _rowset_writer->build_replica(*_primary_rowset_meta)
+                                                             : _rowset_writer->build();
+    if (res.ok()) {
         _cur_rowset = std::move(res).value();
     } else {
         LOG(WARNING) << res.status();
@@ -313,6 +383,12 @@ Status DeltaWriter::commit() {
         return res.status();
     }
 
+    if (_opt.replica_state == ReplicaState::Primary) {
+        // A secondary replica failed here times out at commit, which fails only that replica.
+        auto st = _replicate_rowset();
+        LOG_IF(WARNING, !st.ok()) << "Fail to replicate rowset. tablet_id: " << _opt.tablet_id << ", " << st;
+    }
+
     _cur_rowset->set_schema(&_tablet->tablet_schema());
     if (_tablet->keys_type() == KeysType::PRIMARY_KEYS) {
         auto st = _storage_engine->update_manager()->on_rowset_finished(_tablet.get(), _cur_rowset.get());
@@ -352,6 +428,122 @@ void DeltaWriter::abort(bool with_log) {
     }
 }
 
+Status DeltaWriter::write_segment(const PTabletWriterAddSegmentRequest& request, const butil::IOBuf& data) {
+    SCOPED_THREAD_LOCAL_MEM_SETTER(_mem_tracker, false);
+    if (_opt.replica_state != ReplicaState::Secondary) {
+        return Status::InternalError(fmt::format("Not a secondary replica. tablet_id: {}", _opt.tablet_id));
+    }
+    auto state = _get_state();
+    if (state != kWriting && state != kClosed) {
+        return Status::InternalError(
+                fmt::format("Fail to write segment. tablet_id: {}, state: {}", _opt.tablet_id, _state_name(state)));
+    }
+    std::lock_guard l(_replication_lock);
+    if (_primary_rowset_meta != nullptr) {
+        return Status::InternalError(fmt::format("Segment after eos. tablet_id: {}", _opt.tablet_id));
+    }
+    if (request.has_segment()) {
+        RETURN_IF_ERROR(_rowset_writer->flush_segment(request.segment(), data));
+    }
+    if (request.eos()) {
+        _primary_rowset_meta = std::make_unique<RowsetMetaPB>(request.rowset_meta());
+        _replication_cond.notify_all();
+    }
+    return Status::OK();
+}
+
+void DeltaWriter::cancel_replication() {
+    std::lock_guard l(_replication_lock);
+    _replication_cancelled = true;
+    _replication_cond.notify_all();
+}
+
+Status DeltaWriter::_wait_primary_rowset() {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(config::load_segment_replication_timeout_s);
+    std::unique_lock l(_replication_lock);
+    while (_primary_rowset_meta == nullptr && !_replication_cancelled) {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            return Status::TimedOut(fmt::format("Timeout waiting for the rowset of the primary replica. tablet_id: {}",
+                                                _opt.tablet_id));
+        }
+        _replication_cond.wait_for(l, std::chrono::duration_cast<std::chrono::microseconds>(deadline - now).count());
+    }
+    if (_primary_rowset_meta == nullptr) {
+        return Status::Cancelled(fmt::format("Replication cancelled. tablet_id: {}", _opt.tablet_id));
+    }
+    return Status::OK();
+}
+
+Status DeltaWriter::_replicate_rowset() {
+    std::vector<doris::PBackendService_Stub*> stubs;
+    for (size_t i = 1; i < _opt.replicas.size(); i++) {
+        const auto& replica = _opt.replicas[i];
+        auto stub = ExecEnv::GetInstance()->brpc_stub_cache()->get_stub(replica.host(), replica.port());
+        if (stub == nullptr) {
+            LOG(WARNING) << "Fail to get brpc stub of " << replica.host() << ":" << replica.port();
+            continue;
+        }
+        stubs.emplace_back(stub);
+    }
+
+    PTabletWriterAddSegmentRequest request;
+    request.mutable_id()->CopyFrom(_opt.load_id);
+    request.set_index_id(_opt.index_id);
+    request.set_tablet_id(_opt.tablet_id);
+    request.set_txn_id(_opt.txn_id);
+    // Send |request| to all the secondary replicas, the failed ones are skipped afterwards.
+    auto send = [&](const butil::IOBuf& data) {
+        for (auto it = stubs.begin(); it != stubs.end();) {
+            brpc::Controller cntl;
+            cntl.set_timeout_ms(config::load_segment_replication_timeout_s * 1000);
+            cntl.request_attachment() = data;
+            PTabletWriterAddSegmentResult result;
+            (*it)->tablet_writer_add_segment(&cntl, &request, &result, nullptr);
+            Status st = cntl.Failed() ? Status::InternalError(cntl.ErrorText()) : Status(result.status());
+            if (!st.ok()) {
+                LOG(WARNING) << "Fail to replicate segment to " << butil::endpoint2str(cntl.remote_side()).c_str()
+                             << ". tablet_id: " << _opt.tablet_id << ", " << st;
+                it = stubs.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    };
+
+    const auto& meta = _cur_rowset->rowset_meta();
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(_cur_rowset->rowset_path()));
+    auto send_file = [&](int64_t id, bool delete_file) -> Status {
+        auto path = delete_file ? Rowset::segment_del_file_path(_cur_rowset->rowset_path(), meta->rowset_id(), id)
+                                : Rowset::segment_file_path(_cur_rowset->rowset_path(), meta->rowset_id(), id);
+        ASSIGN_OR_RETURN(auto rfile, fs->new_random_access_file(path));
+        ASSIGN_OR_RETURN(auto size, rfile->get_size());
+        std::string content(size, '\0');
+        RETURN_IF_ERROR(rfile->read_at_fully(0, content.data(), size));
+        butil::IOBuf data;
+        data.append(content.data(), content.size());
+        auto segment = request.mutable_segment();
+        segment->set_segment_id(id);
+        segment->set_data_size(size);
+        segment->set_delete_file(delete_file);
+        send(data);
+        return Status::OK();
+    };
+    for (int64_t i = 0; i < meta->num_segments() && !stubs.empty(); i++) {
+        RETURN_IF_ERROR(send_file(i, false));
+    }
+    for (int64_t i = 0; i < meta->get_num_delete_files() && !stubs.empty(); i++) {
+        RETURN_IF_ERROR(send_file(i, true));
+    }
+
+    request.clear_segment();
+    request.set_eos(true);
+    meta->to_rowset_pb(request.mutable_rowset_meta());
+    send(butil::IOBuf());
+    return stubs.size() + 1 == _opt.replicas.size() ? Status::OK()
+                                                     : Status::InternalError("Fail to replicate to some replicas");
+}
+
 int64_t DeltaWriter::partition_id() const {
     return _opt.partition_id;
 }
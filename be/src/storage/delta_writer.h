@@ -2,6 +2,15 @@
 
 #pragma once
 
+#include <atomic>
+
+#include "common/compiler_util.h"
+DIAGNOSTIC_PUSH
+DIAGNOSTIC_IGNORE("-Wclass-memaccess")
+#include <bthread/condition_variable.h>
+#include <bthread/mutex.h>
+DIAGNOSTIC_POP
+
 #include "column/chunk.h"
 #include "column/vectorized_fwd.h"
 #include "common/tracer.h"
@@ -10,6 +19,10 @@
 #include "storage/rowset/rowset_writer.h"
 #include "storage/tablet.h"
 
+namespace butil {
+class IOBuf;
+}
+
 namespace starrocks {
 
 class FlushToken;
@@ -24,6 +37,54 @@ namespace vectorized {
 class MemTable;
 class MemTableSink;
 
+// SharedWriteBuffer accounts the memtables of the DeltaWriters of an index in a load. Instead of flushing
+// a memtable only when itself is full, a DeltaWriter flushes its memtable when the shared buffer is full
+// and its memtable is not smaller than the average, so the small memtables keep accumulating rows.
+// [thread-safe]
+class SharedWriteBuffer {
+public:
+    explicit SharedWriteBuffer(int64_t capacity) : _capacity(capacity) {}
+
+    DISALLOW_COPY_AND_MOVE(SharedWriteBuffer);
+
+    int64_t capacity() const { return _capacity; }
+
+    int64_t usage() const { return _usage.load(std::memory_order_relaxed); }
+
+    // Update the accounted size of a memtable from |old_bytes| to |new_bytes|, 0 means no memtable.
+    void update(int64_t old_bytes, int64_t new_bytes) {
+        _usage.fetch_add(new_bytes - old_bytes, std::memory_order_relaxed);
+        _num_memtables.fetch_add((new_bytes > 0) - (old_bytes > 0), std::memory_order_relaxed);
+    }
+
+    // Whether a memtable of |bytes| should be flushed.
+    bool should_flush(int64_t bytes) const {
+        return _usage.load(std::memory_order_relaxed) >= _capacity && not_smaller_than_average(bytes);
+    }
+
+    // Whether a memtable of |bytes| is not smaller than the average of the memtables accounted.
+    bool not_smaller_than_average(int64_t bytes) const {
+        int64_t usage = _usage.load(std::memory_order_relaxed);
+        return bytes > 0 && bytes * _num_memtables.load(std::memory_order_relaxed) >= usage;
+    }
+
+private:
+    const int64_t _capacity;
+    std::atomic<int64_t> _usage{0};
+    std::atomic<int64_t> _num_memtables{0};
+};
+
+
+// The role of a replica in a load replicating segments, see PTabletWriterOpenRequest.is_replicated_storage.
+enum class ReplicaState {
+    // Builds the segments by the chunks received, like the other replicas.
+    Peer,
+    // Builds the segments by the chunks received and replicates them to the secondary replicas.
+    Primary,
+    // Receives no chunk, but the segments built by the primary replica.
+    Secondary
+};
+
 struct DeltaWriterOptions {
     int64_t tablet_id;
     int32_t schema_hash;
@@ -34,6 +95,12 @@ struct DeltaWriterOptions {
     const std::vector<SlotDescriptor*>* slots;
     vectorized::GlobalDictByNameMaps* global_dicts = nullptr;
     Span parent_span;
+    // Not owned, nullptr means the memtable is flushed only when itself is full.
+    SharedWriteBuffer* shared_write_buffer = nullptr;
+    int64_t index_id = 0;
+    ReplicaState replica_state = ReplicaState::Peer;
+    // The replicas of the tablet if replica_state is not Peer, the first one is the primary replica.
+    std::vector<PNetworkAddress> replicas;
 };
 
 // Writer for a particular (load, index, tablet).
@@ -67,6 +134,15 @@ public:
     // the related txn.
     void abort(bool with_log = true);
 
+    // Write a file of the rowset replicated from the primary replica, and save the meta of the rowset at
+    // the eos request, which is waited by `commit()`. Only for the secondary replica.
+    // [thread-safe]
+    [[nodiscard]] Status write_segment(const PTabletWriterAddSegmentRequest& request, const butil::IOBuf& data);
+
+    // Stop the secondary replica waiting for the rowset of the primary replica in `commit()`.
+    // [thread-safe]
+    void cancel_replication();
+
     int64_t txn_id() const { return _opt.txn_id; }
 
     const PUniqueId& load_id() const { return _opt.load_id; }
@@ -110,6 +186,19 @@ private:
 
     void _reset_mem_table();
 
+    // Wait until the eos request of the primary replica is received.
+    Status _wait_primary_rowset();
+
+    // Send the files and the meta of the committed rowset to the secondary replicas.
+    Status _replicate_rowset();
+
+    // Update the size of _mem_table accounted in the shared write buffer, 0 if _mem_table is released.
+    void _update_shared_write_buffer(int64_t bytes);
+
+    // Whether to flush _mem_table before it is full, because the memory of the loads on this BE is close to
+    // its limit, and _mem_table is one of the larger memtables being written.
+    bool _should_flush_ahead() const;
+
     State _get_state() { return _state.load(std::memory_order_acquire); }
     void _set_state(State state) { _state.store(state, std::memory_order_release); }
 
@@ -125,10 +214,17 @@ private:
     Schema _vectorized_schema;
     std::unique_ptr<MemTable> _mem_table;
     std::unique_ptr<MemTableSink> _mem_table_sink;
+    int64_t _shared_write_buffer_bytes = 0;
     const TabletSchema* _tablet_schema;
 
     std::unique_ptr<FlushToken> _flush_token;
     bool _with_rollback_log;
+
+    // Used by the secondary replica.
+    bthread::Mutex _replication_lock;
+    bthread::ConditionVariable _replication_cond;
+    std::unique_ptr<RowsetMetaPB> _primary_rowset_meta;
+    bool _replication_cancelled = false;
 };
 
 } // namespace vectorized
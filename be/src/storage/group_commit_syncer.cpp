@@ -0,0 +1,70 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/group_commit_syncer.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "common/logging.h"
+#include "gutil/strings/substitute.h"
+
+namespace starrocks {
+
+GroupCommitSyncer::~GroupCommitSyncer() {
+    if (_fd >= 0) {
+        ::close(_fd);
+    }
+}
+
+Status GroupCommitSyncer::sync() {
+    std::unique_lock l(_lock);
+    int64_t seq = ++_requested_seq;
+    while (_synced_seq < seq) {
+        if (_syncing) {
+            _cv.wait(l);
+            continue;
+        }
+        // Lead a round covering all the calls arrived so far.
+        _syncing = true;
+        int64_t round_seq = _requested_seq;
+        l.unlock();
+        Status st = _sync_file_system();
+        l.lock();
+        _syncing = false;
+        _synced_seq = round_seq;
+        _num_rounds.fetch_add(1, std::memory_order_relaxed);
+        if (!st.ok() && _status.ok()) {
+            _status = st;
+        }
+        _cv.notify_all();
+    }
+    return _status;
+}
+
+// Called by the leader of a round without |_lock|.
+Status GroupCommitSyncer::_sync_file_system() {
+    if (_fd < 0) {
+        int fd = ::open(_path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd < 0) {
+            return Status::IOError(strings::Substitute("fail to open $0: $1", _path, std::strerror(errno)));
+        }
+        _fd = fd;
+    }
+#if defined(__linux__)
+    int ret = ::syncfs(_fd);
+#else
+    ::sync();
+    int ret = 0;
+#endif
+    if (ret != 0) {
+        auto st = Status::IOError(strings::Substitute("fail to sync $0: $1", _path, std::strerror(errno)));
+        LOG(ERROR) << st;
+        return st;
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks
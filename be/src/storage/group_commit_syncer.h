@@ -0,0 +1,53 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "common/status.h"
+
+namespace starrocks {
+
+// GroupCommitSyncer makes the files written to a data dir durable for the concurrent loads together.
+//
+// A writer starts the writeback of each file it closes without waiting, by sync_file_range, and calls sync()
+// once before its rowset is committed. The first waiting writer leads a round: it syncs the whole file system
+// of the dir with one syncfs(), which covers the data and the metadata, e.g. the directory entries, of the
+// files written by every writer waiting for the round, and then wakes them all. The writers arriving during a
+// round wait for the next one, so one barrier is issued per round instead of one fsync per file.
+//
+// Once a round fails the error is sticky, the written pages may have been dropped by the kernel and retrying
+// can't tell whether they reached the disk.
+class GroupCommitSyncer {
+public:
+    explicit GroupCommitSyncer(std::string path) : _path(std::move(path)) {}
+
+    ~GroupCommitSyncer();
+
+    // Block until all the data written to the files of the dir before the call is durable.
+    Status sync();
+
+    // The number of the rounds finished, i.e. the file system syncs issued.
+    int64_t num_rounds() const { return _num_rounds.load(std::memory_order_relaxed); }
+
+private:
+    Status _sync_file_system();
+
+    const std::string _path;
+    int _fd = -1;
+
+    std::mutex _lock;
+    std::condition_variable _cv;
+    // The sequence of the last sync() called, and of the last one covered by a finished round.
+    int64_t _requested_seq = 0;
+    int64_t _synced_seq = 0;
+    bool _syncing = false;
+    std::atomic<int64_t> _num_rounds{0};
+    Status _status;
+};
+
+} // namespace starrocks
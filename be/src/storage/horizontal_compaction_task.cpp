@@ -7,6 +7,7 @@
 #include "common/statusor.h"
 #include "runtime/current_thread.h"
 #include "storage/chunk_helper.h"
+#include "storage/data_dir.h"
 #include "storage/olap_common.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_writer.h"
@@ -21,7 +22,10 @@ namespace starrocks {
 
 Status HorizontalCompactionTask::run_impl() {
     Statistics statistics;
-    RETURN_IF_ERROR(_horizontal_compact_data(&statistics));
+    ASSIGN_OR_RETURN(bool linked, _try_link_segments(&statistics));
+    if (!linked) {
+        RETURN_IF_ERROR(_horizontal_compact_data(&statistics));
+    }
 
     TRACE_COUNTER_INCREMENT("merged_rows", statistics.merged_rows);
     TRACE_COUNTER_INCREMENT("filtered_rows", statistics.filtered_rows);
@@ -43,8 +47,9 @@ Status HorizontalCompactionTask::_horizontal_compact_data(Statistics* statistics
             config::max_segment_file_size, _task_info.input_rows_num, _task_info.input_rowsets_size);
 
     std::unique_ptr<RowsetWriter> output_rs_writer;
-    RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(
-            _tablet.get(), max_rows_per_segment, _task_info.algorithm, _task_info.output_version, &output_rs_writer));
+    RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(_tablet.get(), max_rows_per_segment,
+                                                                    _task_info.algorithm, _task_info.output_version,
+                                                                    &output_rs_writer, _input_rowsets));
 
     vectorized::Schema schema = ChunkHelper::convert_schema_to_format_v2(_tablet->tablet_schema());
     vectorized::TabletReader reader(std::static_pointer_cast<Tablet>(_tablet->shared_from_this()),
@@ -110,6 +115,8 @@ StatusOr<size_t> HorizontalCompactionTask::_compact_data(int32_t chunk_size, vec
     size_t output_rows = 0;
     auto char_field_indexes = ChunkHelper::get_char_field_indexes(schema);
     auto chunk = ChunkHelper::new_chunk(schema, chunk_size);
+    auto* io_throttle = _tablet->data_dir()->compaction_io_throttle();
+    int64_t bytes_read = 0;
     while (LIKELY(!should_stop())) {
 #ifndef BE_TEST
         status = tls_thread_status.mem_tracker()->check_mem_limit("Compaction");
@@ -134,6 +141,9 @@ StatusOr<size_t> HorizontalCompactionTask::_compact_data(int32_t chunk_size, vec
         ChunkHelper::padding_char_columns(char_field_indexes, schema, _tablet->tablet_schema(), chunk.get());
 
         RETURN_IF_ERROR(output_rs_writer->add_chunk(*chunk));
+        // The output is about the size of the input, so charge the bytes read twice for reading and writing.
+        io_throttle->acquire(2 * (reader.stats().compressed_bytes_read - bytes_read));
+        bytes_read = reader.stats().compressed_bytes_read;
         output_rows += chunk->num_rows();
         _task_info.output_num_rows = output_rows;
         _task_info.filtered_rows = reader.stats().rows_del_filtered;
@@ -69,6 +69,9 @@ Status KVStore::init(bool read_only) {
     options.IncreaseParallelism();
     options.create_if_missing = true;
     options.create_missing_column_families = true;
+    // The concurrent writes of the tablets are committed by groups, let the WAL write of a group overlap with
+    // the memtable write of the previous one.
+    options.enable_pipelined_write = true;
     std::string db_path = _root_path + META_POSTFIX;
 
     // The index of each column family must be consistent with the enum `ColumnFamilyIndex`
@@ -4,10 +4,10 @@
 
 #include "column/chunk.h"
 #include "column/column.h"
-#include "gutil/strings/util.h"
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
 #include "runtime/mem_tracker.h"
+#include "storage/lake/filenames.h"
 #include "storage/lake/tablet.h"
 #include "storage/lake/tablet_manager.h"
 #include "storage/lake/tablet_writer.h"
@@ -37,12 +37,26 @@ public:
         return _writer->flush();
     }
 
-    Status flush_chunk_with_deletes(const Chunk& /*upserts*/, const Column& /*deletes*/) override {
-        return Status::NotSupported("TabletWriterSink::flush_chunk_with_deletes");
+    // The deletes are applied after all the upserts when published, so once a chunk with deletes is flushed,
+    // the subsequent chunks can only have deletes, the same as HorizontalBetaRowsetWriter.
+    Status flush_chunk_with_deletes(const Chunk& upserts, const Column& deletes) override {
+        if (deletes.empty()) {
+            return flush_chunk(upserts);
+        }
+        if (!upserts.is_empty() && _has_deletes) {
+            return Status::Cancelled("upserts after deletes in one load are not supported by the lake tablet");
+        }
+        _has_deletes = true;
+        RETURN_IF_ERROR(_writer->flush_del_file(deletes));
+        if (!upserts.is_empty()) {
+            return flush_chunk(upserts);
+        }
+        return Status::OK();
     }
 
 private:
     TabletWriter* _writer;
+    bool _has_deletes = false;
 };
 
 /// DeltaWriterImpl
@@ -184,10 +198,6 @@ Status DeltaWriterImpl::write(const Chunk& chunk, const uint32_t* indexes, uint3
 Status DeltaWriterImpl::finish() {
     SCOPED_THREAD_LOCAL_MEM_SETTER(_mem_tracker, false);
 
-    // TODO: move file type checking to a common place
-    auto is_seg_file = [](const std::string& name) -> bool { return HasSuffixString(name, ".dat"); };
-    auto is_del_file = [](const std::string& name) -> bool { return HasSuffixString(name, ".del"); };
-
     RETURN_IF_ERROR(flush());
     RETURN_IF_ERROR(_tablet_writer->finish());
     ASSIGN_OR_RETURN(auto tablet, ExecEnv::GetInstance()->lake_tablet_manager()->get_tablet(_tablet_id));
@@ -196,9 +206,9 @@ Status DeltaWriterImpl::finish() {
     txn_log->set_txn_id(_txn_id);
     auto op_write = txn_log->mutable_op_write();
     for (auto& f : _tablet_writer->files()) {
-        if (is_seg_file(f)) {
+        if (is_segment(f)) {
             op_write->mutable_rowset()->add_segments(std::move(f));
-        } else if (is_del_file(f)) {
+        } else if (is_del(f)) {
             op_write->add_deletes(std::move(f));
         } else {
             return Status::InternalError(fmt::format("unknown file {}", f));
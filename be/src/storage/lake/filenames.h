@@ -19,6 +19,16 @@ inline bool is_segment(std::string_view file_name) {
     return HasSuffixString(file_name, ".dat");
 }
 
+// The primary keys deleted by a load of a primary key tablet.
+inline bool is_del(std::string_view file_name) {
+    return HasSuffixString(file_name, ".del");
+}
+
+// The delete vector of a segment of a primary key tablet.
+inline bool is_delvec(std::string_view file_name) {
+    return HasSuffixString(file_name, ".delvec");
+}
+
 inline bool is_txn_log(std::string_view file_name) {
     return HasPrefixString(file_name, "txn_");
 }
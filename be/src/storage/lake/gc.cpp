@@ -64,25 +64,56 @@ Status metadata_gc(std::string_view root_location, TabletManager* tablet_mgr) {
         return iter_st;
     }
 
+    // The versions to delete of each tablet.
+    std::vector<std::pair<int64_t, std::vector<int64_t>>> expired_versions;
+    // The obsolete files of the versions next to the expired ones, which can be deleted with the expired versions.
+    std::vector<std::string> obsolete_files;
     for (auto& [tablet_id, versions] : tablet_metadatas) {
         if (versions.size() <= max_versions) {
             continue;
         }
-        // TODO: batch delete
         // Keep the latest 10 versions.
         // If the tablet metadata is locked, the correspoding version will be kept.
         std::sort(versions.begin(), versions.end());
+        auto locked_iter = locked_tablet_metadatas.find(tablet_id);
+        bool locked_before = false;
+        auto& expired = expired_versions.emplace_back(tablet_id, std::vector<int64_t>()).second;
         for (size_t i = 0, sz = versions.size() - max_versions; i < sz; i++) {
-            if (locked_tablet_metadatas.count(tablet_id)) {
-                const auto& locked_tablet_metadata = locked_tablet_metadatas[tablet_id];
-                if (locked_tablet_metadata.count(versions[i])) {
-                    continue;
-                }
+            if (locked_iter != locked_tablet_metadatas.end() && locked_iter->second.count(versions[i])) {
+                locked_before = true;
+                continue;
             }
-            VLOG(5) << "Deleting " << tablet_metadata_filename(tablet_id, versions[i]);
-            auto st = tablet_mgr->delete_tablet_metadata(tablet_id, versions[i]);
+            expired.push_back(versions[i]);
+            // The files obsoleted by the next version are referenced by no other version once this one is deleted,
+            // unless a previous version is kept by the lock, then they're left to the segment GC.
+            if (locked_before || versions[i + 1] != versions[i] + 1) {
+                continue;
+            }
+            auto res = tablet_mgr->get_tablet_metadata(
+                    join_path(root_location, tablet_metadata_filename(tablet_id, versions[i + 1])), false);
+            if (!res.ok()) {
+                LOG_IF(WARNING, !res.status().is_not_found())
+                        << "Fail to get " << tablet_metadata_filename(tablet_id, versions[i + 1]) << ": "
+                        << res.status();
+                continue;
+            }
+            for (const auto& file : (*res)->obsolete_files()) {
+                obsolete_files.emplace_back(join_path(root_location, file));
+            }
+        }
+    }
+
+    // The obsolete files are deleted before the versions, if it failed the versions are kept and retried later.
+    if (!obsolete_files.empty()) {
+        VLOG(5) << "Deleting " << obsolete_files.size() << " obsolete files in " << root_location;
+        RETURN_IF_ERROR(fs->delete_files(obsolete_files));
+    }
+    for (const auto& [tablet_id, versions] : expired_versions) {
+        for (auto version : versions) {
+            VLOG(5) << "Deleting " << tablet_metadata_filename(tablet_id, version);
+            auto st = tablet_mgr->delete_tablet_metadata(tablet_id, version);
             LOG_IF(WARNING, !st.ok() && !st.is_not_found())
-                    << "Fail to delete " << tablet_metadata_filename(tablet_id, versions[i]) << ": " << st;
+                    << "Fail to delete " << tablet_metadata_filename(tablet_id, version) << ": " << st;
         }
     }
     return Status::OK();
@@ -102,7 +133,8 @@ Status segment_gc(std::string_view root_location, TabletManager* tablet_mgr) {
             tablet_metadatas.emplace_back(name);
         } else if (is_txn_log(name) || is_txn_vlog(name)) {
             txn_logs.emplace_back(name);
-        } else if (is_segment(name)) {
+        } else if (is_segment(name) || is_del(name) || is_delvec(name)) {
+            // The delete files and the delete vectors are collected the same as the segments.
             segments.emplace(name);
         }
         return true;
@@ -125,6 +157,9 @@ Status segment_gc(std::string_view root_location, TabletManager* tablet_mgr) {
         for (const auto& seg : rowset.segments()) {
             segments.erase(seg);
         }
+        for (const auto& del_vec : rowset.del_vectors()) {
+            segments.erase(del_vec);
+        }
     };
 
     for (const auto& filename : tablet_metadatas) {
@@ -154,6 +189,9 @@ Status segment_gc(std::string_view root_location, TabletManager* tablet_mgr) {
         auto txn_log = std::move(res).value();
         if (txn_log->has_op_write()) {
             check_rowset(txn_log->op_write().rowset());
+            for (const auto& del : txn_log->op_write().deletes()) {
+                segments.erase(del);
+            }
         }
         if (txn_log->has_op_compaction()) {
             // No need to check input rowsets
@@ -7,6 +7,7 @@
 #include "column/chunk.h"
 #include "common/config.h"
 #include "fs/fs_util.h"
+#include "serde/column_array_serde.h"
 #include "storage/rowset/segment_writer.h"
 #include "util/uid_util.h"
 
@@ -37,6 +38,20 @@ Status GeneralTabletWriter::flush() {
     return flush_segment_writer();
 }
 
+Status GeneralTabletWriter::flush_del_file(const vectorized::Column& deletes) {
+    auto name = fmt::format("{}.del", generate_uuid_string());
+    ASSIGN_OR_RETURN(auto of, fs::new_writable_file(_tablet.segment_location(name)));
+    size_t sz = serde::ColumnArraySerde::max_serialized_size(deletes);
+    std::vector<uint8_t> content(sz);
+    if (serde::ColumnArraySerde::serialize(deletes, content.data()) == nullptr) {
+        return Status::InternalError("deletes column serialize failed");
+    }
+    RETURN_IF_ERROR(of->append(Slice(content.data(), content.size())));
+    RETURN_IF_ERROR(of->close());
+    _files.emplace_back(std::move(name));
+    return Status::OK();
+}
+
 Status GeneralTabletWriter::finish() {
     RETURN_IF_ERROR(flush_segment_writer());
     _finished = true;
@@ -82,4 +97,141 @@ Status GeneralTabletWriter::flush_segment_writer() {
     return Status::OK();
 }
 
+VerticalGeneralTabletWriter::VerticalGeneralTabletWriter(Tablet tablet, uint32_t max_rows_per_segment)
+        : _tablet(std::move(tablet)), _max_rows_per_segment(max_rows_per_segment) {}
+
+VerticalGeneralTabletWriter::~VerticalGeneralTabletWriter() {
+    for (auto& segment_writer : _segment_writers) {
+        segment_writer.reset();
+    }
+    _segment_writers.clear();
+}
+
+Status VerticalGeneralTabletWriter::open() {
+    DCHECK(_schema == nullptr);
+    ASSIGN_OR_RETURN(_schema, _tablet.get_schema());
+    return Status::OK();
+}
+
+Status VerticalGeneralTabletWriter::write_columns(const starrocks::vectorized::Chunk& data,
+                                                  const std::vector<uint32_t>& column_indexes, bool is_key) {
+    const size_t chunk_num_rows = data.num_rows();
+    if (_segment_writers.empty()) {
+        if (!is_key) {
+            return Status::InternalError("key columns must be written before the other columns");
+        }
+        ASSIGN_OR_RETURN(auto segment_writer, create_segment_writer(column_indexes, is_key));
+        _segment_writers.emplace_back(std::move(segment_writer));
+        _current_writer_index = 0;
+        RETURN_IF_ERROR(_segment_writers[_current_writer_index]->append_chunk(data));
+    } else if (is_key) {
+        // key columns
+        if (_segment_writers[_current_writer_index]->num_rows_written() + chunk_num_rows >= _max_rows_per_segment) {
+            RETURN_IF_ERROR(flush_columns(&_segment_writers[_current_writer_index]));
+            ASSIGN_OR_RETURN(auto segment_writer, create_segment_writer(column_indexes, is_key));
+            _segment_writers.emplace_back(std::move(segment_writer));
+            ++_current_writer_index;
+        }
+        RETURN_IF_ERROR(_segment_writers[_current_writer_index]->append_chunk(data));
+    } else {
+        // non key columns
+        uint32_t num_rows_written = _segment_writers[_current_writer_index]->num_rows_written();
+        uint32_t segment_num_rows = _segment_writers[_current_writer_index]->num_rows();
+        DCHECK_LE(num_rows_written, segment_num_rows);
+
+        if (_current_writer_index == 0 && num_rows_written == 0) {
+            RETURN_IF_ERROR(_segment_writers[_current_writer_index]->init(column_indexes, is_key));
+        }
+
+        if (num_rows_written + chunk_num_rows <= segment_num_rows) {
+            RETURN_IF_ERROR(_segment_writers[_current_writer_index]->append_chunk(data));
+        } else {
+            // split into multi chunks and write into multi segments
+            auto write_chunk = data.clone_empty();
+            size_t num_left_rows = chunk_num_rows;
+            size_t offset = 0;
+            while (num_left_rows > 0) {
+                if (segment_num_rows == num_rows_written) {
+                    RETURN_IF_ERROR(flush_columns(&_segment_writers[_current_writer_index]));
+                    ++_current_writer_index;
+                    RETURN_IF_ERROR(_segment_writers[_current_writer_index]->init(column_indexes, is_key));
+                    num_rows_written = _segment_writers[_current_writer_index]->num_rows_written();
+                    segment_num_rows = _segment_writers[_current_writer_index]->num_rows();
+                }
+
+                size_t write_size = std::min<size_t>(segment_num_rows - num_rows_written, num_left_rows);
+                write_chunk->append(data, offset, write_size);
+                RETURN_IF_ERROR(_segment_writers[_current_writer_index]->append_chunk(*write_chunk));
+                write_chunk->reset();
+                num_left_rows -= write_size;
+                offset += write_size;
+                num_rows_written = _segment_writers[_current_writer_index]->num_rows_written();
+            }
+            DCHECK_EQ(0, num_left_rows);
+            DCHECK_EQ(offset, chunk_num_rows);
+        }
+    }
+
+    if (is_key) {
+        _num_rows += chunk_num_rows;
+    }
+    return Status::OK();
+}
+
+Status VerticalGeneralTabletWriter::flush_columns() {
+    if (_segment_writers.empty()) {
+        return Status::OK();
+    }
+
+    DCHECK(_segment_writers[_current_writer_index]);
+    RETURN_IF_ERROR(flush_columns(&_segment_writers[_current_writer_index]));
+    _current_writer_index = 0;
+    return Status::OK();
+}
+
+Status VerticalGeneralTabletWriter::finish() {
+    for (auto& segment_writer : _segment_writers) {
+        uint64_t segment_size = 0;
+        uint64_t footer_position = 0;
+        RETURN_IF_ERROR(segment_writer->finalize_footer(&segment_size, &footer_position));
+        _data_size += segment_size;
+        segment_writer.reset();
+    }
+    _segment_writers.clear();
+    _finished = true;
+    return Status::OK();
+}
+
+void VerticalGeneralTabletWriter::close() {
+    if (!_finished && !_files.empty()) {
+        // Delete files
+        auto maybe_fs = FileSystem::CreateSharedFromString(_tablet.root_location());
+        if (maybe_fs.ok()) {
+            auto fs = std::move(maybe_fs).value();
+            for (const auto& name : _files) {
+                auto path = _tablet.segment_location(name);
+                (void)fs->delete_file(path);
+            }
+        }
+    }
+    std::vector<std::string> tmp;
+    std::swap(tmp, _files);
+}
+
+StatusOr<std::unique_ptr<SegmentWriter>> VerticalGeneralTabletWriter::create_segment_writer(
+        const std::vector<uint32_t>& column_indexes, bool is_key) {
+    auto name = fmt::format("{}.dat", generate_uuid_string());
+    ASSIGN_OR_RETURN(auto of, fs::new_writable_file(_tablet.segment_location(name)));
+    SegmentWriterOptions opts;
+    auto w = std::make_unique<SegmentWriter>(std::move(of), _segment_writers.size(), _schema.get(), opts);
+    RETURN_IF_ERROR(w->init(column_indexes, is_key));
+    _files.emplace_back(std::move(name));
+    return w;
+}
+
+Status VerticalGeneralTabletWriter::flush_columns(std::unique_ptr<SegmentWriter>* segment_writer) {
+    uint64_t index_size = 0;
+    return (*segment_writer)->finalize_columns(&index_size);
+}
+
 } // namespace starrocks::lake
@@ -30,8 +30,19 @@ public:
 
     Status write(const starrocks::vectorized::Chunk& data) override;
 
+    Status write_columns(const starrocks::vectorized::Chunk& data, const std::vector<uint32_t>& column_indexes,
+                         bool is_key) override {
+        return Status::NotSupported("GeneralTabletWriter write_columns not support");
+    }
+
     Status flush() override;
 
+    Status flush_columns() override {
+        return Status::NotSupported("GeneralTabletWriter flush_columns not support");
+    }
+
+    Status flush_del_file(const starrocks::vectorized::Column& deletes) override;
+
     Status finish() override;
 
     void close() override;
@@ -56,4 +67,59 @@ private:
     bool _finished = false;
 };
 
+// Writes the columns of a segment group by group, the key columns first, see `TabletWriter::write_columns()`.
+class VerticalGeneralTabletWriter : public TabletWriter {
+public:
+    explicit VerticalGeneralTabletWriter(Tablet tablet, uint32_t max_rows_per_segment);
+
+    ~VerticalGeneralTabletWriter() override;
+
+    DISALLOW_COPY(VerticalGeneralTabletWriter);
+
+    int64_t tablet_id() const override { return _tablet.id(); }
+
+    Status open() override;
+
+    Status write(const starrocks::vectorized::Chunk& data) override {
+        return Status::NotSupported("VerticalGeneralTabletWriter write not support");
+    }
+
+    Status write_columns(const starrocks::vectorized::Chunk& data, const std::vector<uint32_t>& column_indexes,
+                         bool is_key) override;
+
+    Status flush() override { return Status::NotSupported("VerticalGeneralTabletWriter flush not support"); }
+
+    Status flush_columns() override;
+
+    Status flush_del_file(const starrocks::vectorized::Column& deletes) override {
+        return Status::NotSupported("VerticalGeneralTabletWriter flush_del_file not support");
+    }
+
+    Status finish() override;
+
+    void close() override;
+
+    std::vector<std::string> files() const override { return _files; }
+
+    int64_t data_size() const override { return _data_size; }
+
+    int64_t num_rows() const override { return _num_rows; }
+
+private:
+    StatusOr<std::unique_ptr<SegmentWriter>> create_segment_writer(const std::vector<uint32_t>& column_indexes,
+                                                                   bool is_key);
+
+    Status flush_columns(std::unique_ptr<SegmentWriter>* segment_writer);
+
+    Tablet _tablet;
+    std::shared_ptr<const TabletSchema> _schema;
+    uint32_t _max_rows_per_segment;
+    std::vector<std::unique_ptr<SegmentWriter>> _segment_writers;
+    size_t _current_writer_index = 0;
+    std::vector<std::string> _files;
+    int64_t _num_rows = 0;
+    int64_t _data_size = 0;
+    bool _finished = false;
+};
+
 } // namespace starrocks::lake
@@ -4,6 +4,7 @@
 
 #include "storage/chunk_helper.h"
 #include "storage/chunk_iterator.h"
+#include "storage/del_vector.h"
 #include "storage/delete_predicates.h"
 #include "storage/empty_iterator.h"
 #include "storage/lake/tablet.h"
@@ -22,9 +23,7 @@ Rowset::Rowset(Tablet* tablet, RowsetMetadataPtr rowset_metadata, int index)
 
 Rowset::~Rowset() = default;
 
-// TODO: support
-//  1. primary key table
-//  2. rowid range and short key range
+// TODO: support rowid range and short key range
 StatusOr<ChunkIteratorPtr> Rowset::read(const vectorized::Schema& schema, const RowsetReadOptions& options) {
     vectorized::SegmentReadOptions seg_options;
     ASSIGN_OR_RETURN(seg_options.fs, FileSystem::CreateSharedFromString(_tablet->root_location()));
@@ -33,11 +32,13 @@ StatusOr<ChunkIteratorPtr> Rowset::read(const vectorized::Schema& schema, const
     seg_options.predicates = options.predicates;
     seg_options.predicates_for_zone_map = options.predicates_for_zone_map;
     seg_options.use_page_cache = options.use_page_cache;
+    seg_options.sequential_scan = options.sequential_scan;
     seg_options.profile = options.profile;
     seg_options.reader_type = options.reader_type;
     seg_options.chunk_size = options.chunk_size;
     seg_options.global_dictmaps = options.global_dictmaps;
     seg_options.unused_output_column_ids = options.unused_output_column_ids;
+    seg_options.runtime_range_pruner = options.runtime_range_pruner;
     if (options.delete_predicates != nullptr) {
         seg_options.delete_predicates = options.delete_predicates->get_predicates(_index);
     }
@@ -69,7 +70,8 @@ StatusOr<ChunkIteratorPtr> Rowset::read(const vectorized::Schema& schema, const
 
     std::vector<SegmentPtr> segments;
     RETURN_IF_ERROR(load_segments(&segments));
-    for (auto& seg_ptr : segments) {
+    for (int i = 0, sz = segments.size(); i < sz; i++) {
+        auto& seg_ptr = segments[i];
         if (seg_ptr->num_rows() == 0) {
             continue;
         }
@@ -78,6 +80,7 @@ StatusOr<ChunkIteratorPtr> Rowset::read(const vectorized::Schema& schema, const
             continue;
         }
 
+        RETURN_IF_ERROR(load_del_vector(i, &seg_options));
         auto res = seg_ptr->new_iterator(*segment_schema, seg_options);
         if (res.status().is_end_of_file()) {
             continue;
@@ -102,6 +105,40 @@ StatusOr<ChunkIteratorPtr> Rowset::read(const vectorized::Schema& schema, const
     }
 }
 
+StatusOr<std::vector<ChunkIteratorPtr>> Rowset::get_each_segment_iterator(const vectorized::Schema& schema,
+                                                                          OlapReaderStatistics* stats) {
+    vectorized::SegmentReadOptions seg_options;
+    ASSIGN_OR_RETURN(seg_options.fs, FileSystem::CreateSharedFromString(_tablet->root_location()));
+    seg_options.stats = stats;
+
+    std::vector<SegmentPtr> segments;
+    RETURN_IF_ERROR(load_segments(&segments));
+    std::vector<ChunkIteratorPtr> seg_iterators(segments.size());
+    for (int i = 0, sz = segments.size(); i < sz; i++) {
+        if (segments[i]->num_rows() == 0) {
+            continue;
+        }
+        RETURN_IF_ERROR(load_del_vector(i, &seg_options));
+        auto res = segments[i]->new_iterator(schema, seg_options);
+        if (res.status().is_end_of_file()) {
+            continue;
+        }
+        if (!res.ok()) {
+            return res.status();
+        }
+        seg_iterators[i] = std::move(res).value();
+    }
+    return seg_iterators;
+}
+
+Status Rowset::load_del_vector(int seg_index, vectorized::SegmentReadOptions* seg_options) {
+    seg_options->del_vec.reset();
+    if (seg_index < _rowset_metadata->del_vectors_size() && !_rowset_metadata->del_vectors(seg_index).empty()) {
+        ASSIGN_OR_RETURN(seg_options->del_vec, _tablet->load_del_vector(_rowset_metadata->del_vectors(seg_index)));
+    }
+    return Status::OK();
+}
+
 Status Rowset::load_segments(std::vector<SegmentPtr>* segments) {
     size_t footer_size_hint = 16 * 1024;
     uint32_t seg_id = 0;
@@ -6,6 +6,13 @@
 #include "gen_cpp/lake_types.pb.h"
 #include "storage/lake/types_fwd.h"
 
+namespace starrocks {
+struct OlapReaderStatistics;
+namespace vectorized {
+class SegmentReadOptions;
+} // namespace vectorized
+} // namespace starrocks
+
 namespace starrocks::lake {
 class Rowset {
 public:
@@ -15,6 +22,11 @@ public:
 
     [[nodiscard]] StatusOr<ChunkIteratorPtr> read(const vectorized::Schema& schema, const RowsetReadOptions& options);
 
+    // The iterators of each segment of this rowset, the ones of the empty or all deleted segments are nullptr.
+    // Used to load the primary index, the i-th segment's rssid is `id() + i`.
+    [[nodiscard]] StatusOr<std::vector<ChunkIteratorPtr>> get_each_segment_iterator(const vectorized::Schema& schema,
+                                                                                     OlapReaderStatistics* stats);
+
     [[nodiscard]] bool is_overlapped() const { return metadata().overlapped(); }
 
     [[nodiscard]] int64_t num_segments() const { return metadata().segments_size(); }
@@ -32,6 +44,9 @@ public:
 private:
     [[nodiscard]] Status load_segments(std::vector<SegmentPtr>* segments);
 
+    // Set the delete vector of the |seg_index|-th segment into |seg_options|, if any.
+    [[nodiscard]] Status load_del_vector(int seg_index, vectorized::SegmentReadOptions* seg_options);
+
     // _tablet is owned by TabletReader
     Tablet* _tablet;
     RowsetMetadataPtr _rowset_metadata;
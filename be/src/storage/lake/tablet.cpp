@@ -2,9 +2,13 @@
 
 #include "storage/lake/tablet.h"
 
+#include <fmt/format.h>
+
 #include "column/schema.h"
 #include "fs/fs.h"
+#include "fs/fs_util.h"
 #include "runtime/exec_env.h"
+#include "storage/del_vector.h"
 #include "storage/lake/general_tablet_writer.h"
 #include "storage/lake/metadata_iterator.h"
 #include "storage/lake/rowset.h"
@@ -12,6 +16,8 @@
 #include "storage/lake/tablet_reader.h"
 #include "storage/lake/txn_log.h"
 #include "storage/rowset/segment.h"
+#include "util/raw_container.h"
+#include "util/uid_util.h"
 
 namespace starrocks::lake {
 
@@ -63,8 +69,11 @@ Status Tablet::delete_tablet_metadata_lock(int64_t version, int64_t expire_time)
     return _mgr->delete_tablet_metadata_lock(_id, version, expire_time);
 }
 
-StatusOr<std::unique_ptr<TabletWriter>> Tablet::new_writer() {
+StatusOr<std::unique_ptr<TabletWriter>> Tablet::new_writer(WriterType type, uint32_t max_rows_per_segment) {
     // TODO: check tablet type
+    if (type == kVertical) {
+        return std::make_unique<VerticalGeneralTabletWriter>(*this, max_rows_per_segment);
+    }
     return std::make_unique<GeneralTabletWriter>(*this);
 }
 
@@ -122,10 +131,38 @@ std::string Tablet::segment_location(std::string_view segment_name) const {
     return _mgr->segment_location(_id, segment_name);
 }
 
+UpdateManager* Tablet::update_mgr() const {
+    return _mgr->update_mgr();
+}
+
 std::string Tablet::root_location() const {
     return _mgr->tablet_root_location(_id);
 }
 
+StatusOr<std::shared_ptr<DelVector>> Tablet::load_del_vector(std::string_view name) {
+    auto location = segment_location(name);
+    if (auto delvec = _mgr->lookup_del_vector(location); delvec != nullptr) {
+        return delvec;
+    }
+    ASSIGN_OR_RETURN(auto rf, fs::new_random_access_file(location));
+    ASSIGN_OR_RETURN(auto size, rf->get_size());
+    std::string buf;
+    raw::stl_string_resize_uninitialized(&buf, size);
+    RETURN_IF_ERROR(rf->read_at_fully(0, buf.data(), size));
+    auto delvec = std::make_shared<DelVector>();
+    RETURN_IF_ERROR(delvec->load(0, buf.data(), size));
+    _mgr->cache_del_vector(location, delvec);
+    return delvec;
+}
+
+StatusOr<std::string> Tablet::put_del_vector(const DelVector& delvec) {
+    auto name = fmt::format("{}.delvec", generate_uuid_string());
+    ASSIGN_OR_RETURN(auto wf, fs::new_writable_file(segment_location(name)));
+    RETURN_IF_ERROR(wf->append(delvec.save()));
+    RETURN_IF_ERROR(wf->close());
+    return name;
+}
+
 Status Tablet::delete_data(int64_t txn_id, const DeletePredicatePB& delete_predicate) {
     auto txn_log = std::make_shared<lake::TxnLog>();
     txn_log->set_tablet_id(_id);
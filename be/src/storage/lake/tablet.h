@@ -12,10 +12,12 @@
 #include "storage/lake/rowset.h"
 #include "storage/lake/tablet_metadata.h"
 #include "storage/lake/txn_log.h"
+#include "storage/lake/types_fwd.h"
 
 namespace starrocks {
+class DelVector;
 class TabletSchema;
-}
+} // namespace starrocks
 
 namespace starrocks::vectorized {
 class Schema;
@@ -26,6 +28,7 @@ namespace starrocks::lake {
 class TabletManager;
 class TabletReader;
 class TabletWriter;
+class UpdateManager;
 template <typename T>
 class MetadataIterator;
 using TabletMetadataIter = MetadataIterator<TabletMetadataPtr>;
@@ -48,6 +51,8 @@ public:
 
     [[nodiscard]] std::string root_location() const;
 
+    UpdateManager* update_mgr() const;
+
     Status put_metadata(const TabletMetadata& metadata);
 
     Status put_metadata(TabletMetadataPtr metadata);
@@ -72,7 +77,9 @@ public:
 
     Status delete_tablet_metadata_lock(int64_t version, int64_t expire_time);
 
-    StatusOr<std::unique_ptr<TabletWriter>> new_writer();
+    // |max_rows_per_segment| is only used by the vertical writer.
+    StatusOr<std::unique_ptr<TabletWriter>> new_writer(WriterType type = kHorizontal,
+                                                       uint32_t max_rows_per_segment = 0);
 
     StatusOr<std::shared_ptr<TabletReader>> new_reader(int64_t version, vectorized::Schema schema);
 
@@ -91,6 +98,13 @@ public:
 
     [[nodiscard]] std::string segment_location(std::string_view segment_name) const;
 
+    // The delete vector of a segment of a primary key tablet, which is immutable once written, so it's cached
+    // by |name| like the segments.
+    StatusOr<std::shared_ptr<DelVector>> load_del_vector(std::string_view name);
+
+    // Write |delvec| into a new file and return the file name.
+    StatusOr<std::string> put_del_vector(const DelVector& delvec);
+
     Status delete_data(int64_t txn_id, const DeletePredicatePB& delete_predicate);
 
     StatusOr<bool> has_delete_predicates(int64_t version);
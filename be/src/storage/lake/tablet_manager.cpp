@@ -2,6 +2,9 @@
 
 #include "storage/lake/tablet_manager.h"
 
+#include <algorithm>
+#include <mutex>
+#include <unordered_set>
 #include <variant>
 
 #include "common/compiler_util.h"
@@ -19,24 +22,32 @@ DIAGNOSTIC_POP
 #include "gutil/strings/join.h"
 #include "gutil/strings/util.h"
 #include "runtime/exec_env.h"
+#include "storage/compaction_utils.h"
+#include "storage/del_vector.h"
 #include "storage/lake/compaction_policy.h"
 #include "storage/lake/gc.h"
 #include "storage/lake/horizontal_compaction_task.h"
 #include "storage/lake/join_path.h"
 #include "storage/lake/location_provider.h"
+#include "storage/lake/rowset.h"
 #include "storage/lake/tablet.h"
 #include "storage/lake/tablet_metadata.h"
 #include "storage/lake/txn_log.h"
+#include "storage/lake/update_manager.h"
+#include "storage/lake/vertical_compaction_task.h"
 #include "storage/metadata_util.h"
 #include "storage/rowset/segment.h"
 #include "storage/tablet_schema_map.h"
 #include "util/lru_cache.h"
+#include "util/countdown_latch.h"
+#include "util/defer_op.h"
 #include "util/raw_container.h"
 #include "util/threadpool.h"
 
 namespace starrocks::lake {
 
-static Status apply_txn_log(const TxnLog& log, TabletMetadata* metadata);
+static Status apply_txn_log(const TxnLog& log, Tablet* tablet, UpdateManager::IndexEntry* index_entry,
+                            TabletMetadata* metadata);
 static Status publish(Tablet* tablet, int64_t base_version, int64_t new_version, const int64_t* txns, int txns_size);
 static void* metadata_gc_trigger(void* arg);
 static void* segment_gc_trigger(void* arg);
@@ -44,6 +55,7 @@ static void* segment_gc_trigger(void* arg);
 TabletManager::TabletManager(LocationProvider* location_provider, int64_t cache_capacity)
         : _location_provider(location_provider),
           _metacache(new_lru_cache(cache_capacity)),
+          _update_mgr(std::make_unique<UpdateManager>(config::lake_primary_index_cache_limit)),
           _metadata_gc_tid(INVALID_BTHREAD),
           _segment_gc_tid(INVALID_BTHREAD) {}
 
@@ -151,6 +163,23 @@ void TabletManager::cache_segment(std::string_view key, SegmentPtr segment) {
     (void)fill_metacache(key, value.release(), (int)mem_cost);
 }
 
+std::shared_ptr<DelVector> TabletManager::lookup_del_vector(std::string_view key) {
+    auto handle = _metacache->lookup(CacheKey(key));
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    auto value = static_cast<CacheValue*>(_metacache->value(handle));
+    auto delvec = std::get<std::shared_ptr<DelVector>>(*value);
+    _metacache->release(handle);
+    return delvec;
+}
+
+void TabletManager::cache_del_vector(std::string_view key, std::shared_ptr<DelVector> delvec) {
+    auto mem_cost = delvec->memory_usage();
+    auto value = std::make_unique<CacheValue>(std::move(delvec));
+    (void)fill_metacache(key, value.release(), (int)mem_cost);
+}
+
 void TabletManager::erase_metacache(std::string_view key) {
     _metacache->erase(CacheKey(key));
 }
@@ -445,6 +474,74 @@ StatusOr<TabletSchemaPtr> TabletManager::get_tablet_schema(int64_t tablet_id) {
     return schema;
 }
 
+// The pool loading the metadata of the tablets to scan in the background.
+static ThreadPool* prefetch_pool() {
+    static std::unique_ptr<ThreadPool> pool = []() {
+        std::unique_ptr<ThreadPool> p;
+        auto st = ThreadPoolBuilder("lake_prefetch")
+                          .set_min_threads(0)
+                          .set_max_threads(std::max(1, config::lake_metadata_prefetch_threads))
+                          .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                          .build(&p);
+        LOG_IF(WARNING, !st.ok()) << "Fail to create lake_prefetch pool: " << st;
+        return p;
+    }();
+    return pool.get();
+}
+
+Status TabletManager::prefetch_tablet(int64_t tablet_id, int64_t version, bool load_segments) {
+    ASSIGN_OR_RETURN(auto metadata, get_tablet_metadata(tablet_id, version));
+    // Take the schema from the metadata just loaded instead of listing the metadata of the tablet.
+    auto cache_key = tablet_schema_cache_key(tablet_id);
+    if (lookup_tablet_schema(cache_key) == nullptr) {
+        auto [schema, inserted] = GlobalTabletSchemaMap::Instance()->emplace(metadata->schema());
+        if (UNLIKELY(schema == nullptr)) {
+            return Status::InternalError(
+                    fmt::format("tablet schema {} failed to emplace in TabletSchemaMap", tablet_id));
+        }
+        auto cache_value = std::make_unique<CacheValue>(schema);
+        auto cache_size = inserted ? (int)schema->mem_usage() : 0;
+        (void)fill_metacache(cache_key, cache_value.release(), cache_size);
+    }
+    if (!load_segments) {
+        return Status::OK();
+    }
+    ASSIGN_OR_RETURN(auto tablet, get_tablet(tablet_id));
+    ASSIGN_OR_RETURN(auto rowsets, tablet.get_rowsets(version));
+    for (const auto& rowset : rowsets) {
+        std::vector<SegmentPtr> segments;
+        RETURN_IF_ERROR(rowset->load_segments(&segments));
+    }
+    return Status::OK();
+}
+
+Status TabletManager::prefetch_metadata(const std::vector<std::pair<int64_t, int64_t>>& tablets, bool load_segments) {
+    if (tablets.empty()) {
+        return Status::OK();
+    }
+    std::mutex lock;
+    Status status;
+    CountDownLatch latch(static_cast<int>(tablets.size()));
+    auto* pool = prefetch_pool();
+    for (const auto& [tablet_id, version] : tablets) {
+        auto task = [&, tablet_id = tablet_id, version = version]() {
+            auto st = prefetch_tablet(tablet_id, version, load_segments);
+            if (!st.ok()) {
+                std::lock_guard l(lock);
+                if (status.ok()) {
+                    status = st;
+                }
+            }
+            latch.count_down();
+        };
+        if (pool == nullptr || !pool->submit_func(task).ok()) {
+            task();
+        }
+    }
+    latch.wait();
+    return status;
+}
+
 Status TabletManager::publish_version(int64_t tablet_id, int64_t base_version, int64_t new_version, const int64_t* txns,
                                       int txns_size) {
     ASSIGN_OR_RETURN(auto tablet, get_tablet(tablet_id));
@@ -564,9 +661,36 @@ static Status apply_schema_change_log(const TxnLogPB_OpSchemaChange& op_schema_c
     return Status::OK();
 }
 
-Status apply_txn_log(const TxnLog& log, TabletMetadata* metadata) {
+// Record the segments and the delete vectors of |base_metadata| which are not referenced by |new_metadata|.
+static void collect_obsolete_files(const TabletMetadata& base_metadata, TabletMetadata* new_metadata) {
+    std::unordered_set<std::string_view> files;
+    for (const auto& rowset : new_metadata->rowsets()) {
+        files.insert(rowset.segments().begin(), rowset.segments().end());
+        files.insert(rowset.del_vectors().begin(), rowset.del_vectors().end());
+    }
+    auto check_file = [&](const std::string& file) {
+        if (!file.empty() && files.count(file) == 0) {
+            new_metadata->add_obsolete_files(file);
+        }
+    };
+    for (const auto& rowset : base_metadata.rowsets()) {
+        std::for_each(rowset.segments().begin(), rowset.segments().end(), check_file);
+        std::for_each(rowset.del_vectors().begin(), rowset.del_vectors().end(), check_file);
+    }
+}
+
+// |index_entry| is the primary index of |tablet| if it's a primary key tablet, otherwise nullptr.
+Status apply_txn_log(const TxnLog& log, Tablet* tablet, UpdateManager::IndexEntry* index_entry,
+                     TabletMetadata* metadata) {
     if (log.has_op_write()) {
         RETURN_IF_ERROR(apply_write_log(log.op_write(), metadata));
+        if (index_entry != nullptr) {
+            RETURN_IF_ERROR(tablet->update_mgr()->apply_write_log(log.op_write(), tablet, index_entry, metadata));
+        }
+        // The delete files are only read when the deletes are applied.
+        for (const auto& del : log.op_write().deletes()) {
+            metadata->add_obsolete_files(del);
+        }
     }
 
     if (log.has_op_compaction()) {
@@ -597,6 +721,19 @@ Status publish(Tablet* tablet, int64_t base_version, int64_t new_version, const
     // make a copy of metadata
     auto new_metadata = std::make_shared<TabletMetadata>(*base_metadata);
     new_metadata->set_version(new_version);
+    new_metadata->clear_obsolete_files();
+
+    // The primary index of the primary key tablet, which is kept of |new_version| only if published successfully.
+    UpdateManager::IndexEntry* index_entry = nullptr;
+    int64_t index_version = -1;
+    if (base_metadata->schema().keys_type() == PRIMARY_KEYS) {
+        ASSIGN_OR_RETURN(index_entry, tablet->update_mgr()->prepare_primary_index(tablet, *base_metadata));
+    }
+    DeferOp release_index([&]() {
+        if (index_entry != nullptr) {
+            tablet->update_mgr()->release_primary_index(index_entry, index_version);
+        }
+    });
 
     // Apply txn logs
     int64_t alter_version = -1;
@@ -617,7 +754,7 @@ Status publish(Tablet* tablet, int64_t base_version, int64_t new_version, const
             alter_version = txn_log->op_schema_change().alter_version();
         }
 
-        auto st = apply_txn_log(*txn_log, new_metadata.get());
+        auto st = apply_txn_log(*txn_log, tablet, index_entry, new_metadata.get());
         if (!st.ok()) {
             LOG(WARNING) << "Fail to apply " << tablet->txn_log_location(txn_id) << ": " << st;
             return st;
@@ -640,7 +777,7 @@ Status publish(Tablet* tablet, int64_t base_version, int64_t new_version, const
                 return txn_vlog.status();
             }
 
-            auto st = apply_txn_log(**txn_vlog, new_metadata.get());
+            auto st = apply_txn_log(**txn_vlog, tablet, index_entry, new_metadata.get());
             if (!st.ok()) {
                 LOG(WARNING) << "Fail to apply " << tablet->txn_vlog_location(v) << ": " << st;
                 return st;
@@ -648,11 +785,14 @@ Status publish(Tablet* tablet, int64_t base_version, int64_t new_version, const
         }
     }
 
+    collect_obsolete_files(*base_metadata, new_metadata.get());
+
     // Save new metadata
     if (auto st = tablet->put_metadata(new_metadata); !st.ok()) {
         LOG(WARNING) << "Fail to put " << tablet->metadata_location(new_version) << ": " << st;
         return st;
     }
+    index_version = new_version;
 
     // Delete txn logs
     for (int i = 0; i < txns_size; i++) {
@@ -675,6 +815,17 @@ StatusOr<CompactionTaskPtr> TabletManager::compact(int64_t tablet_id, int64_t ve
     auto tablet_ptr = std::make_shared<Tablet>(tablet);
     ASSIGN_OR_RETURN(auto compaction_policy, CompactionPolicy::create_compaction_policy(tablet_ptr));
     ASSIGN_OR_RETURN(auto input_rowsets, compaction_policy->pick_rowsets(version));
+    ASSIGN_OR_RETURN(auto tablet_schema, tablet_ptr->get_schema());
+    size_t num_input_segments = 0;
+    for (auto& rowset : input_rowsets) {
+        num_input_segments += rowset->is_overlapped() ? rowset->num_segments() : 1;
+    }
+    auto algorithm = CompactionUtils::choose_compaction_algorithm(
+            tablet_schema->num_columns(), config::vertical_compaction_max_columns_per_group, num_input_segments);
+    if (algorithm == VERTICAL_COMPACTION) {
+        return std::make_shared<VerticalCompactionTask>(txn_id, version, std::move(tablet_ptr),
+                                                        std::move(input_rowsets));
+    }
     return std::make_shared<HorizontalCompactionTask>(txn_id, version, std::move(tablet_ptr), std::move(input_rowsets));
 }
 
@@ -695,6 +846,10 @@ void TabletManager::abort_txn(int64_t tablet_id, const int64_t* txns, int txns_s
                 auto st = delete_segment(tablet_id, segment);
                 LOG_IF(WARNING, !st.ok() && !st.is_not_found()) << "Fail to delete " << segment << ": " << st;
             }
+            for (const auto& del : txn_log->op_write().deletes()) {
+                auto st = delete_segment(tablet_id, del);
+                LOG_IF(WARNING, !st.ok() && !st.is_not_found()) << "Fail to delete " << del << ": " << st;
+            }
         }
         if (txn_log->has_op_compaction()) {
             for (const auto& segment : txn_log->op_compaction().output_rowset().segments()) {
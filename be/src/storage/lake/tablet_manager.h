@@ -16,6 +16,7 @@
 namespace starrocks {
 class Cache;
 class CacheKey;
+class DelVector;
 class Segment;
 class TCreateTabletReq;
 } // namespace starrocks
@@ -27,6 +28,8 @@ class MetadataIterator;
 using TabletMetadataIter = MetadataIterator<TabletMetadataPtr>;
 using TxnLogIter = MetadataIterator<TxnLogPtr>;
 
+class UpdateManager;
+
 class TabletManager {
     friend class Tablet;
 
@@ -64,6 +67,11 @@ public:
 
     StatusOr<TabletMetadataIter> list_tablet_metadata(int64_t tablet_id, bool filter_tablet);
 
+    // Load the metadata and the schemas of the (tablet id, version) pairs |tablets| into the metadata cache
+    // in parallel, and open their segments, i.e. read the footers, if |load_segments| is true. Blocks until
+    // all tablets are done and returns the first error, the loaded ones are cached anyway.
+    Status prefetch_metadata(const std::vector<std::pair<int64_t, int64_t>>& tablets, bool load_segments);
+
     Status delete_tablet_metadata(int64_t tablet_id, int64_t version);
 
     Status put_txn_log(const TxnLog& log);
@@ -114,16 +122,21 @@ public:
 
     const LocationProvider* location_provider() const { return _location_provider; }
 
+    UpdateManager* update_mgr() { return _update_mgr.get(); }
+
     void start_gc();
 
 private:
-    using CacheValue = std::variant<TabletMetadataPtr, TxnLogPtr, TabletSchemaPtr, SegmentPtr>;
+    using CacheValue =
+            std::variant<TabletMetadataPtr, TxnLogPtr, TabletSchemaPtr, SegmentPtr, std::shared_ptr<DelVector>>;
 
     static std::string tablet_schema_cache_key(int64_t tablet_id);
     static void cache_value_deleter(const CacheKey& /*key*/, void* value) { delete static_cast<CacheValue*>(value); }
 
     StatusOr<TabletSchemaPtr> get_tablet_schema(int64_t tablet_id);
 
+    Status prefetch_tablet(int64_t tablet_id, int64_t version, bool load_segments);
+
     StatusOr<TabletMetadataPtr> load_tablet_metadata(const std::string& metadata_location);
     StatusOr<TxnLogPtr> load_txn_log(const std::string& txn_log_location);
 
@@ -136,9 +149,12 @@ private:
     TabletSchemaPtr lookup_tablet_schema(std::string_view key);
     SegmentPtr lookup_segment(std::string_view key);
     void cache_segment(std::string_view key, SegmentPtr segment);
+    std::shared_ptr<DelVector> lookup_del_vector(std::string_view key);
+    void cache_del_vector(std::string_view key, std::shared_ptr<DelVector> delvec);
 
     LocationProvider* _location_provider;
     std::unique_ptr<Cache> _metacache;
+    std::unique_ptr<UpdateManager> _update_mgr;
 
     bthread_t _metadata_gc_tid;
     bthread_t _segment_gc_tid;
@@ -48,6 +48,19 @@ TabletReader::TabletReader(Tablet tablet, int64_t version, Schema schema, bool i
     DCHECK(_mask_buffer);
 }
 
+TabletReader::TabletReader(Tablet tablet, int64_t version, Schema schema, const std::vector<RowsetPtr>& rowsets,
+                           bool is_key, RowSourceMaskBuffer* mask_buffer)
+        : ChunkIterator(std::move(schema)),
+          _tablet(std::move(tablet)),
+          _version(version),
+          _rowsets_inited(true),
+          _rowsets(rowsets),
+          _is_vertical_merge(true),
+          _is_key(is_key),
+          _mask_buffer(mask_buffer) {
+    DCHECK(_mask_buffer);
+}
+
 TabletReader::~TabletReader() {
     close();
 }
@@ -114,9 +127,11 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
     rs_opts.runtime_state = params.runtime_state;
     rs_opts.profile = params.profile;
     rs_opts.use_page_cache = params.use_page_cache;
+    rs_opts.sequential_scan = params.sequential_scan;
     rs_opts.tablet_schema = _tablet_schema.get();
     rs_opts.global_dictmaps = params.global_dictmaps;
     rs_opts.unused_output_column_ids = params.unused_output_column_ids;
+    rs_opts.runtime_range_pruner = params.runtime_range_pruner;
 
     SCOPED_RAW_TIMER(&_stats.create_segment_iter_ns);
     for (auto& rowset : _rowsets) {
@@ -9,6 +9,7 @@
 
 namespace starrocks::vectorized {
 class Chunk;
+class Column;
 } // namespace starrocks::vectorized
 
 namespace starrocks::lake {
@@ -33,11 +34,26 @@ public:
     // arranged in ascending order.
     virtual Status write(const starrocks::vectorized::Chunk& data) = 0;
 
+    // Writes the columns |column_indexes| of the rows in |data|, used by the vertical writer only.
+    //
+    // All the key columns are written first, as the first group, which decides the rows of each segment.
+    // Then the other groups are written in the same order of rows, each group is followed by a
+    // `flush_columns()`.
+    virtual Status write_columns(const starrocks::vectorized::Chunk& data, const std::vector<uint32_t>& column_indexes,
+                                 bool is_key) = 0;
+
+    // Flushes the columns written since the last `flush_columns()`, used by the vertical writer only.
+    virtual Status flush_columns() = 0;
+
     // Flushes this writer and forces any buffered bytes to be written out to segment files.
     // There is no order guarantee between the data written before a `flush()`
     // and the data written after it.
     virtual Status flush() = 0;
 
+    // Writes the *encoded* primary keys |deletes| into a new delete file, used by the primary key tablets only.
+    // The deletes are applied after all the segments of this writer when published.
+    virtual Status flush_del_file(const starrocks::vectorized::Column& deletes) = 0;
+
     // This method is called at the end of data processing.
     virtual Status finish() = 0;
 
@@ -27,6 +27,10 @@ using SegmentPtr = std::shared_ptr<starrocks::Segment>;
 using TabletSchemaPtr = std::shared_ptr<const starrocks::TabletSchema>;
 using CompactionTaskPtr = std::shared_ptr<CompactionTask>;
 
+// The horizontal writer writes all columns of each chunk, the vertical one writes a group of columns
+// of all the rows at a time, which is used by the vertical compaction.
+enum WriterType : int { kHorizontal = 0, kVertical = 1 };
+
 } // namespace lake
 
 } // namespace starrocks
\ No newline at end of file
@@ -0,0 +1,208 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/lake/update_manager.h"
+
+#include <fmt/format.h>
+
+#include <unordered_map>
+
+#include "column/chunk.h"
+#include "fs/fs_util.h"
+#include "serde/column_array_serde.h"
+#include "storage/chunk_helper.h"
+#include "storage/chunk_iterator.h"
+#include "storage/del_vector.h"
+#include "storage/lake/rowset.h"
+#include "storage/lake/tablet.h"
+#include "storage/olap_common.h"
+#include "storage/primary_index.h"
+#include "storage/primary_key_encoder.h"
+#include "storage/tablet_schema.h"
+#include "util/stopwatch.hpp"
+
+namespace starrocks::lake {
+
+static vectorized::Schema primary_key_schema(const TabletSchema& tablet_schema) {
+    std::vector<ColumnId> pk_columns(tablet_schema.num_key_columns());
+    for (auto i = 0; i < tablet_schema.num_key_columns(); i++) {
+        pk_columns[i] = (ColumnId)i;
+    }
+    return ChunkHelper::convert_schema_to_format_v2(tablet_schema, pk_columns);
+}
+
+// Read the *encoded* primary keys of all the rows of |iter| into |pk_column|, and their rowids into |rowids| if
+// it's not nullptr.
+static Status read_primary_keys(const vectorized::Schema& pkey_schema, vectorized::ChunkIterator* iter,
+                                vectorized::Column* pk_column, std::vector<uint32_t>* rowids) {
+    auto chunk_shared_ptr = ChunkHelper::new_chunk(pkey_schema, 4096);
+    auto chunk = chunk_shared_ptr.get();
+    std::vector<uint32_t> chunk_rowids;
+    while (true) {
+        chunk->reset();
+        chunk_rowids.clear();
+        auto st = rowids != nullptr ? iter->get_next(chunk, &chunk_rowids) : iter->get_next(chunk);
+        if (st.is_end_of_file()) {
+            break;
+        } else if (!st.ok()) {
+            return st;
+        }
+        PrimaryKeyEncoder::encode(pkey_schema, *chunk, 0, chunk->num_rows(), pk_column);
+        if (rowids != nullptr) {
+            rowids->insert(rowids->end(), chunk_rowids.begin(), chunk_rowids.end());
+        }
+    }
+    iter->close();
+    return Status::OK();
+}
+
+UpdateManager::UpdateManager(int64_t index_cache_capacity) : _index_cache(std::max<int64_t>(0, index_cache_capacity)) {}
+
+UpdateManager::~UpdateManager() {
+    _index_cache.clear();
+}
+
+StatusOr<UpdateManager::IndexEntry*> UpdateManager::prepare_primary_index(Tablet* tablet,
+                                                                          const TabletMetadata& base_metadata) {
+    auto index_entry = _index_cache.get_or_create(tablet->id());
+    auto& index = index_entry->value();
+    index.lock.lock();
+    if (index.version == base_metadata.version() && index.index != nullptr) {
+        return index_entry;
+    }
+    index.version = -1;
+    index.index.reset();
+    auto st = _load_primary_index(tablet, base_metadata, &index);
+    if (!st.ok()) {
+        LOG(WARNING) << "Fail to load the primary index of tablet " << tablet->id() << " version "
+                     << base_metadata.version() << ": " << st;
+        release_primary_index(index_entry, -1);
+        return st;
+    }
+    _index_cache.update_object_size(index_entry, index.index->memory_usage());
+    return index_entry;
+}
+
+Status UpdateManager::_load_primary_index(Tablet* tablet, const TabletMetadata& metadata, LakePrimaryIndex* index) {
+    MonotonicStopWatch timer;
+    timer.start();
+    ASSIGN_OR_RETURN(auto tablet_schema, tablet->get_schema());
+    auto pkey_schema = primary_key_schema(*tablet_schema);
+    auto primary_index = std::make_unique<PrimaryIndex>(pkey_schema);
+    std::unique_ptr<vectorized::Column> pk_column;
+    RETURN_IF_ERROR(PrimaryKeyEncoder::create_column(pkey_schema, &pk_column));
+
+    int64_t num_rows = 0;
+    for (int i = 0, sz = metadata.rowsets_size(); i < sz; i++) {
+        Rowset rowset(tablet, std::make_shared<const RowsetMetadata>(metadata.rowsets(i)), i);
+        OlapReaderStatistics stats;
+        ASSIGN_OR_RETURN(auto iters, rowset.get_each_segment_iterator(pkey_schema, &stats));
+        for (uint32_t j = 0; j < iters.size(); j++) {
+            if (iters[j] == nullptr) {
+                continue;
+            }
+            std::vector<uint32_t> rowids;
+            pk_column->reset_column();
+            RETURN_IF_ERROR(read_primary_keys(pkey_schema, iters[j].get(), pk_column.get(), &rowids));
+            RETURN_IF_ERROR(primary_index->insert(rowset.id() + j, rowids, *pk_column));
+            num_rows += rowids.size();
+        }
+    }
+    index->index = std::move(primary_index);
+    index->version = metadata.version();
+    LOG(INFO) << "Loaded the primary index of tablet " << tablet->id() << " version " << metadata.version()
+              << " rows: " << num_rows << " memory: " << index->index->memory_usage()
+              << " cost: " << timer.elapsed_time() / 1000000 << "ms";
+    return Status::OK();
+}
+
+Status UpdateManager::apply_write_log(const TxnLogPB_OpWrite& op_write, Tablet* tablet, IndexEntry* index_entry,
+                                      TabletMetadata* metadata) {
+    auto& index = index_entry->value();
+    DCHECK(index.index != nullptr);
+    ASSIGN_OR_RETURN(auto tablet_schema, tablet->get_schema());
+    auto pkey_schema = primary_key_schema(*tablet_schema);
+    std::unique_ptr<vectorized::Column> pk_column;
+    RETURN_IF_ERROR(PrimaryKeyEncoder::create_column(pkey_schema, &pk_column));
+
+    PrimaryIndex::DeletesMap deletes;
+    // 1. The upserts of the segments in order, the rowset of |op_write| has been appended to |metadata|.
+    if (op_write.has_rowset() && op_write.rowset().num_rows() > 0) {
+        int rowset_index = metadata->rowsets_size() - 1;
+        Rowset rowset(tablet, std::make_shared<const RowsetMetadata>(metadata->rowsets(rowset_index)), rowset_index);
+        OlapReaderStatistics stats;
+        ASSIGN_OR_RETURN(auto iters, rowset.get_each_segment_iterator(pkey_schema, &stats));
+        for (uint32_t i = 0; i < iters.size(); i++) {
+            if (iters[i] == nullptr) {
+                continue;
+            }
+            pk_column->reset_column();
+            RETURN_IF_ERROR(read_primary_keys(pkey_schema, iters[i].get(), pk_column.get(), nullptr));
+            index.index->upsert(rowset.id() + i, 0, *pk_column, &deletes);
+        }
+    }
+    // 2. The deletes after all the upserts.
+    for (const auto& del : op_write.deletes()) {
+        ASSIGN_OR_RETURN(auto rf, fs::new_random_access_file(tablet->segment_location(del)));
+        ASSIGN_OR_RETURN(auto size, rf->get_size());
+        std::vector<uint8_t> read_buffer(size);
+        RETURN_IF_ERROR(rf->read_at_fully(0, read_buffer.data(), read_buffer.size()));
+        auto keys = pk_column->clone_empty();
+        if (serde::ColumnArraySerde::deserialize(read_buffer.data(), keys.get()) == nullptr) {
+            return Status::Corruption(fmt::format("failed to deserialize the deletes {}", del));
+        }
+        index.index->erase(*keys, &deletes);
+    }
+    if (deletes.empty()) {
+        return Status::OK();
+    }
+
+    // 3. The new delete vectors of the segments whose rows are replaced or removed.
+    std::unordered_map<uint32_t, std::pair<int, int>> segment_positions;
+    for (int i = 0, sz = metadata->rowsets_size(); i < sz; i++) {
+        const auto& rowset = metadata->rowsets(i);
+        for (int j = 0; j < rowset.segments_size(); j++) {
+            segment_positions[rowset.id() + j] = {i, j};
+        }
+    }
+    for (auto& [rssid, rowids] : deletes) {
+        auto iter = segment_positions.find(rssid);
+        if (UNLIKELY(iter == segment_positions.end())) {
+            return Status::InternalError(fmt::format("segment {} of the primary index not found in tablet {}", rssid,
+                                                     tablet->id()));
+        }
+        auto [rowset_index, segment_index] = iter->second;
+        auto rowset = metadata->mutable_rowsets(rowset_index);
+        DelVector empty_delvec;
+        DelVectorPtr old_delvec;
+        if (segment_index < rowset->del_vectors_size() && !rowset->del_vectors(segment_index).empty()) {
+            ASSIGN_OR_RETURN(old_delvec, tablet->load_del_vector(rowset->del_vectors(segment_index)));
+        }
+        DelVectorPtr new_delvec;
+        (old_delvec != nullptr ? *old_delvec : empty_delvec)
+                .add_dels_as_new_version(rowids, metadata->version(), &new_delvec);
+        ASSIGN_OR_RETURN(auto name, tablet->put_del_vector(*new_delvec));
+        while (rowset->del_vectors_size() < rowset->segments_size()) {
+            rowset->add_del_vectors();
+        }
+        rowset->set_del_vectors(segment_index, name);
+    }
+    return Status::OK();
+}
+
+void UpdateManager::release_primary_index(IndexEntry* index_entry, int64_t version) {
+    auto& index = index_entry->value();
+    size_t memory_usage = 0;
+    if (version < 0) {
+        // Not removed from the cache, which may be pinned by the other publishes of the tablet waiting for it.
+        index.version = -1;
+        index.index.reset();
+    } else {
+        index.version = version;
+        memory_usage = index.index->memory_usage();
+    }
+    index.lock.unlock();
+    _index_cache.update_object_size(index_entry, memory_usage);
+    _index_cache.release(index_entry);
+}
+
+} // namespace starrocks::lake
@@ -0,0 +1,64 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include "common/statusor.h"
+#include "gen_cpp/lake_types.pb.h"
+#include "storage/lake/tablet_metadata.h"
+#include "storage/lake/types_fwd.h"
+#include "util/dynamic_cache.h"
+
+namespace starrocks {
+class PrimaryIndex;
+} // namespace starrocks
+
+namespace starrocks::lake {
+
+// The primary index of a lake primary key tablet of |version|, -1 if it's not loaded.
+struct LakePrimaryIndex {
+    std::mutex lock;
+    int64_t version = -1;
+    std::unique_ptr<PrimaryIndex> index;
+};
+
+// Applies the loads of the primary key tablets when they are published: the upserts replace the rows of the
+// same keys and the deletes remove them, and the replaced and removed rows are marked in the delete vectors of
+// their segments, which are saved as files alongside the segments and referenced by the new tablet metadata.
+//
+// The primary index of a tablet is kept by the compute node only as a cache of the latest version it published.
+// It's rebuilt from the segments and the delete vectors of the base version whenever the cached one is of another
+// version, e.g. after a restart or when the previous version was published by another compute node, so the compute
+// nodes keep nothing required for recovery.
+class UpdateManager {
+public:
+    using IndexEntry = DynamicCache<int64_t, LakePrimaryIndex>::Entry;
+
+    explicit UpdateManager(int64_t index_cache_capacity);
+
+    ~UpdateManager();
+
+    // Pin and lock the primary index of |tablet|, which is loaded of |base_metadata| if the cached one is of
+    // another version. Must be paired with `release_primary_index()`.
+    StatusOr<IndexEntry*> prepare_primary_index(Tablet* tablet, const TabletMetadata& base_metadata);
+
+    // Apply the upserts and the deletes of |op_write| to |index_entry| and |metadata|, after |op_write| has been
+    // applied to |metadata| as the other tablets, i.e. its rowset, if any, is the last one of |metadata|.
+    Status apply_write_log(const TxnLogPB_OpWrite& op_write, Tablet* tablet, IndexEntry* index_entry,
+                           TabletMetadata* metadata);
+
+    // Unlock and unpin |index_entry|. If |version| is -1, i.e. the publish failed, the index may be partially
+    // updated and is dropped, otherwise it's kept as of |version|.
+    void release_primary_index(IndexEntry* index_entry, int64_t version);
+
+    size_t index_cache_size() const { return _index_cache.size(); }
+
+private:
+    Status _load_primary_index(Tablet* tablet, const TabletMetadata& metadata, LakePrimaryIndex* index);
+
+    DynamicCache<int64_t, LakePrimaryIndex> _index_cache;
+};
+
+} // namespace starrocks::lake
@@ -0,0 +1,136 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/lake/vertical_compaction_task.h"
+
+#include "runtime/current_thread.h"
+#include "storage/chunk_helper.h"
+#include "storage/compaction_utils.h"
+#include "storage/data_dir.h"
+#include "storage/lake/rowset.h"
+#include "storage/lake/tablet.h"
+#include "storage/lake/tablet_reader.h"
+#include "storage/lake/tablet_writer.h"
+#include "storage/lake/txn_log.h"
+#include "storage/row_source_mask.h"
+#include "storage/storage_engine.h"
+#include "storage/tablet_reader_params.h"
+#include "util/defer_op.h"
+
+namespace starrocks::lake {
+
+VerticalCompactionTask::~VerticalCompactionTask() = default;
+
+Status VerticalCompactionTask::execute() {
+    ASSIGN_OR_RETURN(_tablet_schema, _tablet->get_schema());
+    const KeysType keys_type = _tablet_schema->keys_type();
+    if (keys_type == PRIMARY_KEYS) {
+        return Status::NotSupported("primary key compaction not supported");
+    }
+    for (auto& rowset : _input_rowsets) {
+        _total_num_rows += rowset->num_rows();
+        _total_data_size += rowset->data_size();
+        _total_input_segs += rowset->is_overlapped() ? rowset->num_segments() : 1;
+    }
+
+    std::vector<std::vector<uint32_t>> column_groups;
+    CompactionUtils::split_column_into_groups(_tablet_schema->num_columns(), _tablet_schema->num_key_columns(),
+                                              config::vertical_compaction_max_columns_per_group, &column_groups);
+
+    uint32_t max_rows_per_segment =
+            CompactionUtils::get_segment_max_rows(config::max_segment_file_size, _total_num_rows, _total_data_size);
+    ASSIGN_OR_RETURN(auto writer, _tablet->new_writer(kVertical, max_rows_per_segment));
+    RETURN_IF_ERROR(writer->open());
+    DeferOp defer([&]() { writer->close(); });
+
+    // The masks are spilled to the local storage, the input and output segments are in the remote storage.
+    auto stores = StorageEngine::instance()->get_stores();
+    if (stores.empty()) {
+        return Status::InternalError("no local storage for the row source masks of vertical compaction");
+    }
+    auto mask_buffer = std::make_unique<vectorized::RowSourceMaskBuffer>(_tablet->id(), stores[0]->path());
+    auto source_masks = std::make_unique<std::vector<vectorized::RowSourceMask>>();
+    for (size_t i = 0; i < column_groups.size(); ++i) {
+        if (UNLIKELY(StorageEngine::instance()->bg_worker_stopped())) {
+            return Status::Cancelled("background worker stopped");
+        }
+        bool is_key = (i == 0);
+        if (!is_key) {
+            // read mask buffer from the beginning
+            RETURN_IF_ERROR(mask_buffer->flip_to_read());
+        }
+        RETURN_IF_ERROR(
+                compact_column_group(is_key, column_groups[i], writer.get(), mask_buffer.get(), source_masks.get()));
+    }
+    RETURN_IF_ERROR(writer->finish());
+
+    auto txn_log = std::make_shared<TxnLog>();
+    auto op_compaction = txn_log->mutable_op_compaction();
+    txn_log->set_tablet_id(_tablet->id());
+    txn_log->set_txn_id(_txn_id);
+    for (auto& rowset : _input_rowsets) {
+        op_compaction->add_input_rowsets(rowset->id());
+    }
+    for (auto& file : writer->files()) {
+        op_compaction->mutable_output_rowset()->add_segments(file);
+    }
+    op_compaction->mutable_output_rowset()->set_num_rows(writer->num_rows());
+    op_compaction->mutable_output_rowset()->set_data_size(writer->data_size());
+    op_compaction->mutable_output_rowset()->set_overlapped(false);
+    return _tablet->put_txn_log(std::move(txn_log));
+}
+
+Status VerticalCompactionTask::compact_column_group(bool is_key, const std::vector<uint32_t>& column_group,
+                                                    TabletWriter* writer, vectorized::RowSourceMaskBuffer* mask_buffer,
+                                                    std::vector<vectorized::RowSourceMask>* source_masks) {
+    const int32_t chunk_size = calculate_chunk_size_for_column_group(column_group);
+    vectorized::Schema schema = ChunkHelper::convert_schema_to_format_v2(*_tablet_schema, column_group);
+    TabletReader reader(*_tablet, _version, schema, _input_rowsets, is_key, mask_buffer);
+    RETURN_IF_ERROR(reader.prepare());
+    vectorized::TabletReaderParams reader_params;
+    reader_params.reader_type = READER_CUMULATIVE_COMPACTION;
+    reader_params.chunk_size = chunk_size;
+    reader_params.profile = nullptr;
+    reader_params.use_page_cache = false;
+    RETURN_IF_ERROR(reader.open(reader_params));
+
+    auto chunk = ChunkHelper::new_chunk(schema, chunk_size);
+    auto char_field_indexes = ChunkHelper::get_char_field_indexes(schema);
+
+    while (true) {
+        if (UNLIKELY(StorageEngine::instance()->bg_worker_stopped())) {
+            return Status::Cancelled("background worker stopped");
+        }
+#ifndef BE_TEST
+        RETURN_IF_ERROR(tls_thread_status.mem_tracker()->check_mem_limit("Compaction"));
+#endif
+        if (auto st = reader.get_next(chunk.get(), source_masks); st.is_end_of_file()) {
+            break;
+        } else if (!st.ok()) {
+            return st;
+        }
+        ChunkHelper::padding_char_columns(char_field_indexes, schema, *_tablet_schema, chunk.get());
+        RETURN_IF_ERROR(writer->write_columns(*chunk, column_group, is_key));
+        chunk->reset();
+
+        if (is_key && !source_masks->empty()) {
+            RETURN_IF_ERROR(mask_buffer->write(*source_masks));
+        }
+        source_masks->clear();
+    }
+    RETURN_IF_ERROR(writer->flush_columns());
+
+    if (is_key) {
+        RETURN_IF_ERROR(mask_buffer->flush());
+    }
+    return Status::OK();
+}
+
+int32_t VerticalCompactionTask::calculate_chunk_size_for_column_group(const std::vector<uint32_t>& column_group) {
+    // The footprint of the columns is not in the rowset metadata, so estimate it by the share of the columns.
+    int64_t mem_footprint = _total_data_size * static_cast<int64_t>(column_group.size()) /
+                            std::max<int64_t>(1, _tablet_schema->num_columns());
+    return CompactionUtils::get_read_chunk_size(config::compaction_memory_limit_per_worker, config::vector_chunk_size,
+                                                _total_num_rows, mem_footprint, _total_input_segs);
+}
+
+} // namespace starrocks::lake
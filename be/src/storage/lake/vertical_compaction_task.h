@@ -0,0 +1,58 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/lake/compaction_task.h"
+
+namespace starrocks {
+class TabletSchema;
+} // namespace starrocks
+
+namespace starrocks::vectorized {
+class RowSourceMask;
+class RowSourceMaskBuffer;
+} // namespace starrocks::vectorized
+
+namespace starrocks::lake {
+
+class Rowset;
+class Tablet;
+class TabletWriter;
+
+// VerticalCompactionTask merges the key columns of the input rowsets first, and records the source of each
+// output row into a RowSourceMaskBuffer. Then the other columns are merged group by group according to the
+// masks, so only a group of columns is in memory at a time.
+class VerticalCompactionTask : public CompactionTask {
+public:
+    explicit VerticalCompactionTask(int64_t txn_id, int64_t version, std::shared_ptr<Tablet> tablet,
+                                    std::vector<std::shared_ptr<Rowset>> input_rowsets)
+            : _txn_id(txn_id),
+              _version(version),
+              _tablet(std::move(tablet)),
+              _input_rowsets(std::move(input_rowsets)) {}
+
+    ~VerticalCompactionTask() override;
+
+    Status execute() override;
+
+private:
+    Status compact_column_group(bool is_key, const std::vector<uint32_t>& column_group, TabletWriter* writer,
+                                vectorized::RowSourceMaskBuffer* mask_buffer,
+                                std::vector<vectorized::RowSourceMask>* source_masks);
+
+    int32_t calculate_chunk_size_for_column_group(const std::vector<uint32_t>& column_group);
+
+    int64_t _txn_id;
+    int64_t _version;
+    std::shared_ptr<Tablet> _tablet;
+    std::vector<std::shared_ptr<Rowset>> _input_rowsets;
+    std::shared_ptr<const TabletSchema> _tablet_schema;
+    int64_t _total_num_rows = 0;
+    int64_t _total_data_size = 0;
+    int64_t _total_input_segs = 0;
+};
+
+} // namespace starrocks::lake
@@ -3,9 +3,11 @@
 #include "storage/memtable.h"
 
 #include <memory>
+#include <numeric>
 
 #include "column/json_column.h"
 #include "common/logging.h"
+#include "exec/vectorized/sorting/merge.h"
 #include "exec/vectorized/sorting/sorting.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
@@ -81,6 +83,7 @@ size_t MemTable::memory_usage() const {
     // used for sort
     size += sizeof(PermutationItem) * _permutations.size();
     size += sizeof(uint32_t) * _selective_values.size();
+    size += sizeof(uint32_t) * (_sorted_run_ends.size() + _insert_indexes.size());
 
     // _result_chunk is the final result before flush
     if (_result_chunk != nullptr && _result_chunk->num_rows() > 0) {
@@ -110,6 +113,9 @@ bool MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uint32_t from
     }
 
     size_t cur_row_count = _chunk->num_rows();
+    if (_incremental_sort && size > 0) {
+        _sort_rows_to_insert(chunk, &indexes, &from, size);
+    }
     if (_slot_descs != nullptr) {
         // For schema change, FE will construct a shadow column.
         // The shadow column is not exist in _vectorized_schema
@@ -132,6 +138,9 @@ bool MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uint32_t from
         _chunk_memory_usage += chunk.memory_usage() * size / chunk.num_rows();
         _chunk_bytes_usage += _chunk->bytes_usage(cur_row_count, size);
     }
+    if (_incremental_sort && size > 0) {
+        _sorted_run_ends.push_back(_chunk->num_rows());
+    }
 
     // if memtable is full, push it to the flush executor,
     // and create a new memtable for incoming data
@@ -284,9 +293,15 @@ void MemTable::_aggregate(bool is_final) {
 }
 
 void MemTable::_sort(bool is_final) {
-    SmallPermutation perm = create_small_permutation(static_cast<uint32_t>(_chunk->num_rows()));
-    std::swap(perm, _permutations);
-    _sort_column_inc();
+    // _chunk is not a sequence of sorted runs if it's the results of the aggregator
+    if (!_sorted_run_ends.empty() && _sorted_run_ends.back() == _chunk->num_rows()) {
+        _merge_sorted_runs();
+    } else {
+        SmallPermutation perm = create_small_permutation(static_cast<uint32_t>(_chunk->num_rows()));
+        std::swap(perm, _permutations);
+        _sort_column_inc();
+    }
+    _sorted_run_ends.clear();
 
     if (is_final) {
         // No need to reserve, it will be reserve in IColumn::append_selective(),
@@ -371,4 +386,98 @@ void MemTable::_sort_column_inc() {
     CHECK(st.ok());
 }
 
+void MemTable::_sort_rows_to_insert(const Chunk& chunk, const uint32_t** indexes, uint32_t* from, uint32_t size) {
+    Columns columns;
+    std::vector<int> sort_orders;
+    std::vector<int> null_firsts;
+    for (int i = 0; i < _vectorized_schema->num_key_fields(); i++) {
+        const ColumnPtr& src = _slot_descs != nullptr ? chunk.get_column_by_slot_id((*_slot_descs)[i]->id())
+                                                      : chunk.get_column_by_index(i);
+        auto column = src->clone_empty();
+        column->append_selective(*src, *indexes, *from, size);
+        columns.push_back(std::move(column));
+        // Ascending, null first
+        sort_orders.push_back(1);
+        null_firsts.push_back(-1);
+    }
+    SmallPermutation perm = create_small_permutation(size);
+    Status st = stable_sort_and_tie_columns(false, columns, sort_orders, null_firsts, &perm);
+    CHECK(st.ok());
+
+    _insert_indexes.resize(size);
+    for (uint32_t i = 0; i < size; i++) {
+        _insert_indexes[i] = (*indexes)[*from + perm[i].index_in_chunk];
+    }
+    *indexes = _insert_indexes.data();
+    *from = 0;
+}
+
+// The adjacent runs are merged level by level, so the rows of the equal keys keep the order of insertion
+// as the stable sort does, which the aggregation of the REPLACE columns relies on.
+void MemTable::_merge_sorted_runs() {
+    const size_t num_keys = _vectorized_schema->num_key_fields();
+    SortDescs sort_descs(std::vector<int>(num_keys, 1), std::vector<int>(num_keys, -1));
+    // the keys of each run, and the rows of _chunk they are from
+    std::vector<SortedRun> runs;
+    std::vector<std::vector<uint32_t>> run_rows;
+    uint32_t start = 0;
+    for (uint32_t end : _sorted_run_ends) {
+        if (end == start) {
+            continue;
+        }
+        Columns keys;
+        for (size_t i = 0; i < num_keys; i++) {
+            const ColumnPtr& column = _chunk->get_column_by_index(i);
+            auto key = column->clone_empty();
+            key->append(*column, start, end - start);
+            keys.push_back(std::move(key));
+        }
+        runs.emplace_back(std::make_shared<Chunk>(keys, Chunk::SlotHashMap()), keys);
+        run_rows.emplace_back(end - start);
+        std::iota(run_rows.back().begin(), run_rows.back().end(), start);
+        start = end;
+    }
+
+    Permutation perm;
+    while (runs.size() > 1) {
+        std::vector<SortedRun> next_runs;
+        std::vector<std::vector<uint32_t>> next_run_rows;
+        for (size_t i = 0; i + 1 < runs.size(); i += 2) {
+            perm.clear();
+            Status st = merge_sorted_chunks_two_way(sort_descs, runs[i], runs[i + 1], &perm);
+            CHECK(st.ok());
+            std::vector<uint32_t> rows(perm.size());
+            for (size_t j = 0; j < perm.size(); j++) {
+                // chunk_index is 0 for the left run and 1 for the right run
+                rows[j] = run_rows[i + perm[j].chunk_index][perm[j].index_in_chunk];
+            }
+            Columns keys;
+            // the keys of the last merge are not needed
+            if (runs.size() > 2) {
+                for (size_t c = 0; c < num_keys; c++) {
+                    auto key = runs[i].orderby[c]->clone_empty();
+                    append_by_permutation(key.get(), {runs[i].orderby[c], runs[i + 1].orderby[c]}, perm);
+                    keys.push_back(std::move(key));
+                }
+            }
+            next_runs.emplace_back(std::make_shared<Chunk>(keys, Chunk::SlotHashMap()), keys);
+            next_run_rows.emplace_back(std::move(rows));
+        }
+        if (runs.size() % 2 == 1) {
+            next_runs.emplace_back(runs.back());
+            next_run_rows.emplace_back(std::move(run_rows.back()));
+        }
+        runs.swap(next_runs);
+        run_rows.swap(next_run_rows);
+    }
+
+    _permutations.resize(_chunk->num_rows());
+    if (!run_rows.empty()) {
+        DCHECK_EQ(run_rows[0].size(), _permutations.size());
+        for (size_t i = 0; i < _permutations.size(); i++) {
+            _permutations[i].index_in_chunk = run_rows[0][i];
+        }
+    }
+}
+
 } // namespace starrocks::vectorized
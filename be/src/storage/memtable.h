@@ -54,6 +54,10 @@ private:
 
     void _sort(bool is_final);
     void _sort_column_inc();
+    // Sort the rows to insert by the keys, |*indexes| is replaced by the sorted ones.
+    void _sort_rows_to_insert(const Chunk& chunk, const uint32_t** indexes, uint32_t* from, uint32_t size);
+    // Merge the sorted runs of _chunk into _permutations.
+    void _merge_sorted_runs();
     void _append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final);
 
     void _init_aggregator_if_needed();
@@ -68,6 +72,12 @@ private:
     SmallPermutation _permutations;
     std::vector<uint32_t> _selective_values;
 
+    // for incremental sort, the rows of each insert are sorted, and _chunk is a sequence of sorted runs
+    // ending at _sorted_run_ends.
+    bool _incremental_sort = config::enable_memtable_incremental_sort;
+    std::vector<uint32_t> _sorted_run_ends;
+    std::vector<uint32_t> _insert_indexes;
+
     int64_t _tablet_id;
 
     const Schema* _vectorized_schema;
@@ -25,6 +25,7 @@
 
 #include "runtime/current_thread.h"
 #include "storage/memtable.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks {
 
@@ -33,7 +34,8 @@ public:
     MemtableFlushTask(FlushToken* flush_token, std::unique_ptr<vectorized::MemTable> memtable)
             : _flush_token(flush_token), _memtable(std::move(memtable)) {}
 
-    ~MemtableFlushTask() override = default;
+    // The task is released after it runs, and when it's dropped by the cancel of the token.
+    ~MemtableFlushTask() override { _flush_token->_finish_pending(); }
 
     void run() override {
         SCOPED_THREAD_LOCAL_MEM_SETTER(_memtable->mem_tracker(), false);
@@ -51,7 +53,8 @@ private:
 
 std::ostream& operator<<(std::ostream& os, const FlushStatistic& stat) {
     os << "(flush time(ms)=" << stat.flush_time_ns / 1000 / 1000 << ", flush count=" << stat.flush_count << ")"
-       << ", flush flush_size_bytes = " << stat.flush_size_bytes;
+       << ", flush flush_size_bytes = " << stat.flush_size_bytes
+       << ", stall time(ms)=" << stat.stall_time_ns / 1000 / 1000;
     return os;
 }
 
@@ -60,6 +63,10 @@ Status FlushToken::submit(std::unique_ptr<vectorized::MemTable> memtable) {
     // Does not acount the size of MemtableFlushTask into any memory tracker
     SCOPED_THREAD_LOCAL_MEM_SETTER(nullptr, false);
     auto task = std::make_shared<MemtableFlushTask>(this, std::move(memtable));
+    {
+        std::lock_guard l(_pending_lock);
+        _num_pending++;
+    }
     return _flush_token->submit(std::move(task));
 }
 
@@ -73,6 +80,26 @@ Status FlushToken::wait() {
     return _status;
 }
 
+Status FlushToken::wait_for_pending(int max_pending) {
+    std::unique_lock l(_pending_lock);
+    if (_num_pending > max_pending) {
+        MonotonicStopWatch timer;
+        timer.start();
+        _pending_cond.wait(l, [&]() { return _num_pending <= max_pending; });
+        int64_t stall_ns = timer.elapsed_time();
+        _stats.stall_time_ns += stall_ns;
+        StarRocksMetrics::instance()->memtable_flush_stall_total.increment(1);
+        StarRocksMetrics::instance()->memtable_flush_stall_duration_us.increment(stall_ns / 1000);
+    }
+    return status();
+}
+
+void FlushToken::_finish_pending() {
+    std::lock_guard l(_pending_lock);
+    _num_pending--;
+    _pending_cond.notify_all();
+}
+
 void FlushToken::_flush_memtable(vectorized::MemTable* memtable) {
     // If previous flush has failed, return directly
     if (!status().ok()) return;
@@ -22,7 +22,9 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "common/status.h"
@@ -46,6 +48,8 @@ struct FlushStatistic {
     int64_t flush_count = 0;
     int64_t flush_size_bytes = 0;
     int64_t cur_flush_count = 0;
+    // The time waiting in wait_for_pending().
+    int64_t stall_time_ns = 0;
 };
 
 std::ostream& operator<<(std::ostream& os, const FlushStatistic& stat);
@@ -71,6 +75,10 @@ public:
     // wait all tasks in token to be completed.
     Status wait();
 
+    // Wait until at most |max_pending| memtables submitted are not flushed yet, the time waiting is
+    // recorded in the statistics and the metrics as a write stall.
+    Status wait_for_pending(int max_pending);
+
     // get flush operations' statistics
     const FlushStatistic& get_stats() const { return _stats; }
 
@@ -90,8 +98,15 @@ private:
 
     void _flush_memtable(vectorized::MemTable* mem_table);
 
+    void _finish_pending();
+
     std::unique_ptr<ThreadPoolToken> _flush_token;
 
+    std::mutex _pending_lock;
+    std::condition_variable _pending_cond;
+    // The memtables submitted but not flushed yet.
+    int _num_pending = 0;
+
     mutable SpinLock _status_lock;
     // Records the current flush status of the tablet.
     // Note: Once its value is set to Failed, it cannot return to OK.
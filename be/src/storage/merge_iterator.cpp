@@ -71,12 +71,8 @@ public:
     size_t last_row_less_than(const ComparableChunk& rhs, size_t limit_num) {
         // As we previously pop this chunk from the heap top, `_compared_row` in this chunk
         // must be less than all rows in rhs, thus here we start comparision from _compared_row + 1;
-        size_t next_compare_row = _compared_row + 1;
         size_t upper_bound = std::min(_compared_row + limit_num, _chunk->num_rows());
-        while (next_compare_row < upper_bound && less_than(next_compare_row, rhs)) {
-            next_compare_row++;
-        }
-        return next_compare_row;
+        return gallop_lower_bound(_compared_row + 1, upper_bound, [&](size_t row) { return less_than(row, rhs); });
     }
 
     bool less_than(size_t lhs_row, const ComparableChunk& rhs) {
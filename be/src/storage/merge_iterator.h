@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 #include "storage/chunk_iterator.h"
@@ -24,6 +25,33 @@ namespace starrocks::vectorized {
 //
 ChunkIteratorPtr new_heap_merge_iterator(const std::vector<ChunkIteratorPtr>& children);
 
+// Return the first index in [begin, end) for which |less| is false, or |end| if none, where |less| is true for a
+// prefix of the range, e.g. the rows of a sorted chunk less than the head of another one.
+// It probes begin, begin + 1, begin + 3, ... before a binary search in the last step, so that a run of n rows takes
+// O(log n) comparisons, while a run of one row takes one comparison as a linear scan does.
+template <typename Less>
+size_t gallop_lower_bound(size_t begin, size_t end, Less&& less) {
+    size_t step = 1;
+    while (begin < end) {
+        size_t probe = std::min(begin + step - 1, end - 1);
+        if (!less(probe)) {
+            end = probe;
+            break;
+        }
+        begin = probe + 1;
+        step *= 2;
+    }
+    while (begin < end) {
+        size_t mid = begin + (end - begin) / 2;
+        if (less(mid)) {
+            begin = mid + 1;
+        } else {
+            end = mid;
+        }
+    }
+    return begin;
+}
+
 // new_mask_merge_iterator create a merge iterator based on source masks.
 // the order of rows is determined by mask sequence.
 ChunkIteratorPtr new_mask_merge_iterator(const std::vector<ChunkIteratorPtr>& children,
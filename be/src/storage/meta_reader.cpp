@@ -2,6 +2,7 @@
 
 #include "storage/meta_reader.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "column/array_column.h"
@@ -18,7 +19,7 @@
 
 namespace starrocks::vectorized {
 
-std::vector<std::string> SegmentMetaCollecter::support_collect_fields = {"dict_merge", "max", "min"};
+std::vector<std::string> SegmentMetaCollecter::support_collect_fields = {"dict_merge", "max", "min", "count"};
 
 Status SegmentMetaCollecter::parse_field_and_colname(const std::string& item, std::string* field,
                                                      std::string* col_name) {
@@ -84,6 +85,11 @@ Status MetaReader::_build_collect_context(const MetaReaderParams& read_params) {
             return Status::InternalError(ss.str());
         }
 
+        // The rows of the segments are the rows of the tablet only if they are neither merged nor deleted.
+        if (collect_field == "count" && _tablet->keys_type() != DUP_KEYS) {
+            return Status::NotSupported("collect count of the tablets not of duplicate keys");
+        }
+
         // get column type
         FieldType type = _tablet->tablet_schema().column(index).type();
         _collect_context.seg_collecter_params.field_type.emplace_back(type);
@@ -145,7 +151,12 @@ Status MetaReader::_get_segments(const TabletSharedPtr& tablet, const Version& v
     }
     Rowset::acquire_readers(_rowsets);
 
+    const auto& fields = _collect_context.seg_collecter_params.fields;
+    bool collect_count = std::find(fields.begin(), fields.end(), "count") != fields.end();
     for (auto& rowset : _rowsets) {
+        if (collect_count && rowset->rowset_meta()->has_delete_predicate()) {
+            return Status::NotSupported("collect count of the tablets with delete predicates");
+        }
         RETURN_IF_ERROR(rowset->load());
         for (auto seg : rowset->segments()) {
             segments->emplace_back(seg);
@@ -284,6 +295,8 @@ Status SegmentMetaCollecter::_collect(const std::string& name, ColumnId cid, vec
         return _collect_max(cid, column, type);
     } else if (name == "min") {
         return _collect_min(cid, column, type);
+    } else if (name == "count") {
+        return _collect_count(column);
     }
     return Status::NotSupported("Not Support Collect Meta: " + name);
 }
@@ -329,6 +342,12 @@ Status SegmentMetaCollecter::_collect_min(ColumnId cid, vectorized::Column* colu
     return __collect_max_or_min<false>(cid, column, type);
 }
 
+// collect the rows of the segment, which a count(*) of the tablet sums up without reading any page
+Status SegmentMetaCollecter::_collect_count(vectorized::Column* column) {
+    column->append_datum(vectorized::Datum(static_cast<int64_t>(_segment->num_rows())));
+    return Status::OK();
+}
+
 template <bool is_max>
 Status SegmentMetaCollecter::__collect_max_or_min(ColumnId cid, vectorized::Column* column, FieldType type) {
     if (cid >= _segment->num_columns()) {
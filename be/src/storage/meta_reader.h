@@ -53,6 +53,7 @@ struct SegmentMetaCollecterParams {
 // MetaReader will implements
 // 1. read meta info from segment footer
 // 2. read dict info from dict page if column is dict encoding type
+// 3. read the number of rows from segment footer, for the tablets of duplicate keys without delete predicates
 class MetaReader {
 public:
     MetaReader();
@@ -123,6 +124,7 @@ private:
     Status _collect_dict(ColumnId cid, vectorized::Column* column, FieldType type);
     Status _collect_max(ColumnId cid, vectorized::Column* column, FieldType type);
     Status _collect_min(ColumnId cid, vectorized::Column* column, FieldType type);
+    Status _collect_count(vectorized::Column* column);
     template <bool is_max>
     Status __collect_max_or_min(ColumnId cid, vectorized::Column* column, FieldType type);
     SegmentSharedPtr _segment;
@@ -23,18 +23,31 @@
 
 #include <malloc.h>
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "runtime/current_thread.h"
 #include "runtime/mem_tracker.h"
 #include "util/defer_op.h"
 #include "util/metrics.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks {
 
+// The tiers are adjusted once every this many lookups.
+static constexpr int64_t kAdjustTiersLookups = 16384;
+// The ratio of the capacity moved between the tiers by one adjustment.
+static constexpr double kAdjustTiersStep = 0.05;
+// The bounds of the ratio of the capacity for the compressed tier.
+static constexpr double kMinCompressedRatio = 0.05;
+static constexpr double kMaxCompressedRatio = 0.9;
+
 StoragePageCache* StoragePageCache::_s_instance = nullptr;
 
 void StoragePageCache::create_global_cache(MemTracker* mem_tracker, size_t capacity) {
     if (_s_instance == nullptr) {
-        _s_instance = new StoragePageCache(mem_tracker, capacity);
+        _s_instance = new StoragePageCache(mem_tracker, capacity, config::storage_page_cache_protected_ratio,
+                                           config::storage_page_cache_compressed_ratio);
     }
 }
 
@@ -45,21 +58,63 @@ void StoragePageCache::release_global_cache() {
     }
 }
 
-StoragePageCache::StoragePageCache(MemTracker* mem_tracker, size_t capacity)
-        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity)) {}
+StoragePageCache::StoragePageCache(MemTracker* mem_tracker, size_t capacity, double protected_ratio,
+                                   double compressed_ratio)
+        : _mem_tracker(mem_tracker), _capacity(capacity) {
+    size_t compressed_capacity = 0;
+    if (compressed_ratio > 0) {
+        compressed_ratio = std::clamp(compressed_ratio, kMinCompressedRatio, kMaxCompressedRatio);
+        compressed_capacity = capacity * compressed_ratio;
+        _compressed_cache.reset(new_lru_cache(compressed_capacity, protected_ratio));
+    }
+    _cache.reset(new_lru_cache(capacity - compressed_capacity, protected_ratio));
+    StarRocksMetrics::instance()->page_cache_capacity.set_value(capacity - compressed_capacity);
+    StarRocksMetrics::instance()->compressed_page_cache_capacity.set_value(compressed_capacity);
+}
 
 StoragePageCache::~StoragePageCache() {}
 
-bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle) {
-    auto* lru_handle = _cache->lookup(key.encode());
+bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle, CacheAccessMode mode) {
+    StarRocksMetrics::instance()->page_cache_lookup_total.increment(1);
+    if (_compressed_cache != nullptr && (_num_lookups.fetch_add(1) + 1) % kAdjustTiersLookups == 0) {
+        _adjust_tiers();
+    }
+    auto* lru_handle = _cache->lookup(key.encode(), mode);
     if (lru_handle == nullptr) {
         return false;
     }
+    StarRocksMetrics::instance()->page_cache_hit_total.increment(1);
+    _num_hits.fetch_add(1, std::memory_order_relaxed);
     *handle = PageCacheHandle(_cache.get(), lru_handle);
     return true;
 }
 
-void StoragePageCache::insert(const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory) {
+bool StoragePageCache::lookup_compressed(const CacheKey& key, PageCacheHandle* handle, CacheAccessMode mode) {
+    DCHECK(_compressed_cache != nullptr);
+    StarRocksMetrics::instance()->compressed_page_cache_lookup_total.increment(1);
+    auto* lru_handle = _compressed_cache->lookup(key.encode(), mode);
+    if (lru_handle == nullptr) {
+        return false;
+    }
+    StarRocksMetrics::instance()->compressed_page_cache_hit_total.increment(1);
+    _num_compressed_hits.fetch_add(1, std::memory_order_relaxed);
+    *handle = PageCacheHandle(_compressed_cache.get(), lru_handle);
+    return true;
+}
+
+void StoragePageCache::insert(const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory,
+                              CacheAccessMode mode) {
+    _insert(_cache.get(), key, data, handle, in_memory, mode);
+}
+
+void StoragePageCache::insert_compressed(const CacheKey& key, const Slice& data, PageCacheHandle* handle,
+                                         bool in_memory, CacheAccessMode mode) {
+    DCHECK(_compressed_cache != nullptr);
+    _insert(_compressed_cache.get(), key, data, handle, in_memory, mode);
+}
+
+void StoragePageCache::_insert(Cache* cache, const CacheKey& key, const Slice& data, PageCacheHandle* handle,
+                               bool in_memory, CacheAccessMode mode) {
 #ifndef BE_TEST
     int64_t mem_size = malloc_usable_size(data.data);
     tls_thread_status.mem_release(mem_size);
@@ -75,8 +130,47 @@ void StoragePageCache::insert(const CacheKey& key, const Slice& data, PageCacheH
         priority = CachePriority::DURABLE;
     }
 
-    auto* lru_handle = _cache->insert(key.encode(), data.data, data.size, deleter, priority);
-    *handle = PageCacheHandle(_cache.get(), lru_handle);
+    auto* lru_handle = cache->insert(key.encode(), data.data, data.size, deleter, priority, mode);
+    *handle = PageCacheHandle(cache, lru_handle);
+}
+
+void StoragePageCache::_adjust_tiers() {
+    std::unique_lock l(_adjust_mutex, std::try_to_lock);
+    if (!l.owns_lock()) {
+        return;
+    }
+    const double hits = _num_hits.exchange(0);
+    const double compressed_hits = _num_compressed_hits.exchange(0);
+    const size_t old_compressed_capacity = _compressed_cache->get_capacity();
+    const size_t old_capacity = _capacity - old_compressed_capacity;
+    const size_t step = _capacity * kAdjustTiersStep;
+    size_t compressed_capacity = old_compressed_capacity;
+    // Compare the hits per byte of the tiers.
+    if (compressed_hits * old_capacity > hits * old_compressed_capacity) {
+        compressed_capacity = std::min<size_t>(old_compressed_capacity + step, _capacity * kMaxCompressedRatio);
+    } else if (hits * old_compressed_capacity > compressed_hits * old_capacity) {
+        compressed_capacity = std::max<size_t>(old_compressed_capacity - std::min(step, old_compressed_capacity),
+                                               _capacity * kMinCompressedRatio);
+    }
+    if (compressed_capacity == old_compressed_capacity) {
+        return;
+    }
+
+#ifndef BE_TEST
+    // The shrunk tier frees its evicted pages here.
+    MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(_mem_tracker);
+    DeferOp op([&] { tls_thread_status.set_mem_tracker(prev_tracker); });
+#endif
+    // Shrink first to not exceed the total capacity.
+    if (compressed_capacity < old_compressed_capacity) {
+        _compressed_cache->set_capacity(compressed_capacity);
+        _cache->set_capacity(_capacity - compressed_capacity);
+    } else {
+        _cache->set_capacity(_capacity - compressed_capacity);
+        _compressed_cache->set_capacity(compressed_capacity);
+    }
+    StarRocksMetrics::instance()->page_cache_capacity.set_value(_capacity - compressed_capacity);
+    StarRocksMetrics::instance()->compressed_page_cache_capacity.set_value(compressed_capacity);
 }
 
 } // namespace starrocks
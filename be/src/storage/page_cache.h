@@ -21,7 +21,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -38,7 +40,10 @@ class MemTracker;
 
 // Warpper around Cache, and used for cache page of column datas
 // in Segment.
-// TODO(zc): We should add some metric to see cache hit/miss rate.
+//
+// Besides the decompressed pages, it may have a second tier caching the raw compressed pages,
+// which holds several times more pages with the same memory and is decompressed on hit.
+// The capacity is split between the tiers adaptively by their hit rates, see _adjust_tiers().
 class StoragePageCache {
 public:
     virtual ~StoragePageCache();
@@ -70,7 +75,11 @@ public:
     // Client should call create_global_cache before.
     static StoragePageCache* instance() { return _s_instance; }
 
-    StoragePageCache(MemTracker* mem_tracker, size_t capacity);
+    // |protected_ratio| is the ratio of the capacity protected from the pages read once,
+    // see new_lru_cache().
+    // |compressed_ratio| is the initial ratio of the capacity for the compressed tier, 0 means no compressed tier.
+    StoragePageCache(MemTracker* mem_tracker, size_t capacity, double protected_ratio = 0,
+                     double compressed_ratio = 0);
 
     // Lookup the given page in the cache.
     //
@@ -79,22 +88,54 @@ public:
     // destructs.
     //
     // Return true if entry is found, otherwise return false.
-    bool lookup(const CacheKey& key, PageCacheHandle* handle);
+    bool lookup(const CacheKey& key, PageCacheHandle* handle, CacheAccessMode mode = CacheAccessMode::NORMAL);
 
     // Insert a page with key into this cache.
     // Given hanlde will be set to valid reference.
     // This function is thread-safe, and when two clients insert two same key
     // concurrently, this function can assure that only one page is cached.
     // The in_memory page will have higher priority.
-    void insert(const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory = false);
+    // The pages inserted by SEQUENTIAL accesses, e.g. by big scans, are evicted first.
+    void insert(const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory = false,
+                CacheAccessMode mode = CacheAccessMode::NORMAL);
+
+    bool has_compressed_tier() const { return _compressed_cache != nullptr; }
 
-    size_t memory_usage() const { return _cache->get_memory_usage(); }
+    // Like lookup() and insert(), but for the raw compressed pages in the compressed tier.
+    // REQUIRES: has_compressed_tier()
+    bool lookup_compressed(const CacheKey& key, PageCacheHandle* handle,
+                           CacheAccessMode mode = CacheAccessMode::NORMAL);
+    void insert_compressed(const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory = false,
+                           CacheAccessMode mode = CacheAccessMode::NORMAL);
+
+    size_t memory_usage() const {
+        return _cache->get_memory_usage() + (_compressed_cache != nullptr ? _compressed_cache->get_memory_usage() : 0);
+    }
+
+    size_t capacity() const { return _capacity; }
+    size_t compressed_capacity() const {
+        return _compressed_cache != nullptr ? _compressed_cache->get_capacity() : 0;
+    }
 
 private:
+    void _insert(Cache* cache, const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory,
+                 CacheAccessMode mode);
+
+    // Move a step of the capacity to the tier with more hits per byte in the last window of lookups.
+    void _adjust_tiers();
+
     static StoragePageCache* _s_instance;
 
     MemTracker* _mem_tracker = nullptr;
+    const size_t _capacity;
     std::unique_ptr<Cache> _cache = nullptr;
+    std::unique_ptr<Cache> _compressed_cache = nullptr;
+
+    // The statistics of the current window of lookups, to adjust the tiers.
+    std::atomic<int64_t> _num_lookups{0};
+    std::atomic<int64_t> _num_hits{0};
+    std::atomic<int64_t> _num_compressed_hits{0};
+    std::mutex _adjust_mutex;
 };
 
 // A handle for StoragePageCache entry. This class make it easy to handle
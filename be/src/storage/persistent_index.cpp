@@ -2,14 +2,18 @@
 
 #include "storage/persistent_index.h"
 
+#include <algorithm>
 #include <cstring>
 #include <numeric>
+#include <set>
 
+#include "common/config.h"
 #include "fs/fs.h"
 #include "gutil/strings/substitute.h"
 #include "storage/chunk_helper.h"
 #include "storage/chunk_iterator.h"
 #include "storage/primary_key_encoder.h"
+#include "storage/rowset/bloom_filter.h"
 #include "storage/rowset/rowset.h"
 #include "storage/tablet.h"
 #include "storage/tablet_meta_manager.h"
@@ -43,6 +47,11 @@ constexpr size_t kL0SnapshotSizeMax = 4 * 1024 * 1024;
 constexpr size_t kL0FlushSizeMin = 8 * 1024 * 1024;
 // perform l0 l1 merge compaction if l1_file_size / l0_memory >= this value and l0_memory > kL0SnapshotSizeMax
 constexpr size_t kL0L1MergeRatio = 10;
+// the false positive probability of the bloom filters of the l1 delta files
+constexpr double kL1DeltaBloomFilterFpp = 0.01;
+constexpr double kShardBloomFilterFpp = 0.05;
+const char* const kL1FilePrefix = "index.l1";
+const char* const kL1DeltaFilePrefix = "index.l1d";
 constexpr size_t kLongKeySize = 64;
 
 const char* const kIndexFileMagic = "IDX1";
@@ -477,9 +486,9 @@ public:
         }
     }
 
-    Status init(const string& dir, const EditVersion& version) {
+    Status init(const string& dir, const EditVersion& version, const char* file_prefix = kL1FilePrefix) {
         _version = version;
-        _idx_file_path = strings::Substitute("$0/index.l1.$1.$2", dir, version.major(), version.minor());
+        _idx_file_path = strings::Substitute("$0/$1.$2.$3", dir, file_prefix, version.major(), version.minor());
         _idx_file_path_tmp = _idx_file_path + ".tmp";
         ASSIGN_OR_RETURN(_fs, FileSystem::CreateSharedFromString(_idx_file_path_tmp));
         WritableFileOptions wblock_opts{.sync_on_close = true, .mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE};
@@ -508,6 +517,9 @@ public:
         RETURN_IF_ERROR(shard->write(*_wb));
         size_t pos_after = _wb->size();
         auto shard_meta = _meta.add_shards();
+        if (config::enable_persistent_index_bloom_filter && !kvs.empty()) {
+            RETURN_IF_ERROR(_write_bloom_filter(kvs, shard_meta->mutable_bloom_filter()));
+        }
         shard_meta->set_size(kvs.size());
         shard_meta->set_npage(shard->npage());
         shard_meta->set_key_size(key_size);
@@ -542,9 +554,9 @@ public:
 
     Status finish() {
         LOG(INFO) << strings::Substitute(
-                "finish writing immutable index $0 #shard:$1 #kv:$2 #moved:$3($4) bytes:$5 usage:$6",
+                "finish writing immutable index $0 #shard:$1 #kv:$2 #moved:$3($4) bytes:$5 usage:$6 bloom_filter:$7",
                 _idx_file_path_tmp, _nshard, _total, _total_moved, _total_moved * 1000 / std::max(_total, 1UL) / 1000.0,
-                _total_bytes, _total_kv_size * 1000 / std::max(_total_bytes, 1UL) / 1000.0);
+                _total_bytes, _total_kv_size * 1000 / std::max(_total_bytes, 1UL) / 1000.0, _total_bloom_filter_bytes);
         _version.to_pb(_meta.mutable_version());
         _meta.set_size(_total);
         //TODO(zhangqiang)
@@ -575,6 +587,20 @@ public:
     }
 
 private:
+    Status _write_bloom_filter(const std::vector<KVRef>& kvs, PagePointerPB* bf_meta) {
+        std::unique_ptr<BloomFilter> bf;
+        RETURN_IF_ERROR(BloomFilter::create(BLOCK_BLOOM_FILTER, &bf));
+        RETURN_IF_ERROR(bf->init(kvs.size(), kShardBloomFilterFpp, HASH_MURMUR3_X64_64));
+        for (const auto& kv : kvs) {
+            bf->add_hash(kv.hash);
+        }
+        bf_meta->set_offset(_wb->size());
+        bf_meta->set_size(bf->size());
+        RETURN_IF_ERROR(_wb->append(Slice(bf->data(), bf->size())));
+        _total_bloom_filter_bytes += bf->size();
+        return Status::OK();
+    }
+
     EditVersion _version;
     string _idx_file_path_tmp;
     string _idx_file_path;
@@ -588,6 +614,7 @@ private:
     size_t _total_moved = 0;
     size_t _total_kv_size = 0;
     size_t _total_bytes = 0;
+    size_t _total_bloom_filter_bytes = 0;
     ImmutableIndexMetaPB _meta;
 };
 
@@ -1088,9 +1115,33 @@ Status ImmutableIndex::_get_kvs_for_shard(std::vector<std::vector<KVRef>>& kvs_b
     }
 }
 
+static void add_not_found(const KeysInfo& keys_info, size_t i, KeysInfo* not_found) {
+    if (not_found != nullptr) {
+        not_found->key_idxes.emplace_back(keys_info.key_idxes[i]);
+        not_found->hashes.emplace_back(keys_info.hashes[i]);
+    }
+}
+
+// Split |keys_info| by the bloom filter |bf| of a shard, the keys filtered out are added to |not_found|
+// and their values are set to NullIndexValue.
+static void filter_by_bloom_filter(const BloomFilter& bf, const KeysInfo& keys_info, IndexValue* values,
+                                   KeysInfo* may_exist, KeysInfo* not_found) {
+    for (size_t i = 0; i < keys_info.size(); i++) {
+        if (bf.test_hash(keys_info.hashes[i])) {
+            may_exist->key_idxes.emplace_back(keys_info.key_idxes[i]);
+            may_exist->hashes.emplace_back(keys_info.hashes[i]);
+        } else {
+            if (values != nullptr) {
+                values[keys_info.key_idxes[i]] = NullIndexValue;
+            }
+            add_not_found(keys_info, i, not_found);
+        }
+    }
+}
+
 Status ImmutableIndex::_get_in_fixlen_shard(size_t shard_idx, size_t n, const Slice* keys, const KeysInfo& keys_info,
                                             IndexValue* values, size_t* num_found,
-                                            std::unique_ptr<ImmutableIndexShard>* shard) const {
+                                            std::unique_ptr<ImmutableIndexShard>* shard, KeysInfo* not_found) const {
     const auto& shard_info = _shards[shard_idx];
     size_t found = 0;
     uint8_t candidate_idxes[kBucketSizeMax];
@@ -1106,15 +1157,20 @@ Status ImmutableIndex::_get_in_fixlen_shard(size_t shard_idx, size_t n, const Sl
         const uint8_t* fixed_key_probe = (const uint8_t*)keys[key_idx].get_data();
         auto kv_pos = bucket_pos + pad(nele, kPackSize);
         values[key_idx] = NullIndexValue;
+        bool hit = false;
         for (size_t candidate_idx = 0; candidate_idx < ncandidates; candidate_idx++) {
             auto idx = candidate_idxes[candidate_idx];
             auto candidate_kv = kv_pos + (shard_info.key_size + shard_info.value_size) * idx;
             if (strings::memeq(candidate_kv, fixed_key_probe, shard_info.key_size)) {
                 values[key_idx] = UNALIGNED_LOAD64(candidate_kv + shard_info.key_size);
                 found++;
+                hit = true;
                 break;
             }
         }
+        if (!hit) {
+            add_not_found(keys_info, i, not_found);
+        }
     }
     *num_found += found;
     return Status::OK();
@@ -1122,7 +1178,7 @@ Status ImmutableIndex::_get_in_fixlen_shard(size_t shard_idx, size_t n, const Sl
 
 Status ImmutableIndex::_get_in_varlen_shard(size_t shard_idx, size_t n, const Slice* keys, const KeysInfo& keys_info,
                                             IndexValue* values, size_t* num_found,
-                                            std::unique_ptr<ImmutableIndexShard>* shard) const {
+                                            std::unique_ptr<ImmutableIndexShard>* shard, KeysInfo* not_found) const {
     const auto& shard_info = _shards[shard_idx];
     size_t found = 0;
     uint8_t candidate_idxes[kBucketSizeMax];
@@ -1138,6 +1194,7 @@ Status ImmutableIndex::_get_in_varlen_shard(size_t shard_idx, size_t n, const Sl
         const uint8_t* key_probe = reinterpret_cast<const uint8_t*>(keys[key_idx].get_data());
         auto offset_pos = bucket_pos + pad(nele, kPackSize);
         values[key_idx] = NullIndexValue;
+        bool hit = false;
         for (size_t candidate_idx = 0; candidate_idx < ncandidates; candidate_idx++) {
             auto idx = candidate_idxes[candidate_idx];
             auto kv_offset = UNALIGNED_LOAD16(offset_pos + sizeof(uint16_t) * idx);
@@ -1146,27 +1203,44 @@ Status ImmutableIndex::_get_in_varlen_shard(size_t shard_idx, size_t n, const Sl
             if (strings::memeq(candidate_kv, key_probe, kv_size - shard_info.value_size)) {
                 values[key_idx] = UNALIGNED_LOAD64(candidate_kv + kv_size - shard_info.value_size);
                 found++;
+                hit = true;
                 break;
             }
         }
+        if (!hit) {
+            add_not_found(keys_info, i, not_found);
+        }
     }
     *num_found += found;
     return Status::OK();
 }
 
 Status ImmutableIndex::_get_in_shard(size_t shard_idx, size_t n, const Slice* keys, const KeysInfo& keys_info,
-                                     IndexValue* values, size_t* num_found) const {
+                                     IndexValue* values, size_t* num_found, KeysInfo* not_found) const {
     const auto& shard_info = _shards[shard_idx];
     if (shard_info.size == 0 || shard_info.npage == 0 || keys_info.size() == 0) {
+        for (size_t i = 0; i < keys_info.size(); i++) {
+            add_not_found(keys_info, i, not_found);
+        }
         return Status::OK();
     }
+    // skip the read of the shard if none of the keys can be in it
+    const KeysInfo* checks = &keys_info;
+    KeysInfo may_exist;
+    if (_bloom_filters[shard_idx] != nullptr) {
+        filter_by_bloom_filter(*_bloom_filters[shard_idx], keys_info, values, &may_exist, not_found);
+        if (may_exist.size() == 0) {
+            return Status::OK();
+        }
+        checks = &may_exist;
+    }
     std::unique_ptr<ImmutableIndexShard> shard = std::make_unique<ImmutableIndexShard>(shard_info.npage);
     CHECK(shard->pages.size() * kPageSize == shard_info.bytes) << "illegal shard size";
     RETURN_IF_ERROR(_file->read_at_fully(shard_info.offset, shard->pages.data(), shard_info.bytes));
     if (shard_info.key_size != 0) {
-        return _get_in_fixlen_shard(shard_idx, n, keys, keys_info, values, num_found, &shard);
+        return _get_in_fixlen_shard(shard_idx, n, keys, *checks, values, num_found, &shard, not_found);
     } else {
-        return _get_in_varlen_shard(shard_idx, n, keys, keys_info, values, num_found, &shard);
+        return _get_in_varlen_shard(shard_idx, n, keys, *checks, values, num_found, &shard, not_found);
     }
 }
 
@@ -1233,13 +1307,23 @@ Status ImmutableIndex::_check_not_exist_in_shard(size_t shard_idx, size_t n, con
     if (shard_info.size == 0 || keys_info.size() == 0) {
         return Status::OK();
     }
+    // the new keys of a load mostly end here without a read of the shard
+    const KeysInfo* checks = &keys_info;
+    KeysInfo may_exist;
+    if (_bloom_filters[shard_idx] != nullptr) {
+        filter_by_bloom_filter(*_bloom_filters[shard_idx], keys_info, nullptr, &may_exist, nullptr);
+        if (may_exist.size() == 0) {
+            return Status::OK();
+        }
+        checks = &may_exist;
+    }
     std::unique_ptr<ImmutableIndexShard> shard = std::make_unique<ImmutableIndexShard>(shard_info.npage);
     CHECK(shard->pages.size() * kPageSize == shard_info.bytes) << "illegal shard size";
     RETURN_IF_ERROR(_file->read_at_fully(shard_info.offset, shard->pages.data(), shard_info.bytes));
     if (shard_info.key_size != 0) {
-        return _check_not_exist_in_fixlen_shard(shard_idx, n, keys, keys_info, &shard);
+        return _check_not_exist_in_fixlen_shard(shard_idx, n, keys, *checks, &shard);
     } else {
-        return _check_not_exist_in_varlen_shard(shard_idx, n, keys, keys_info, &shard);
+        return _check_not_exist_in_varlen_shard(shard_idx, n, keys, *checks, &shard);
     }
 }
 
@@ -1255,9 +1339,12 @@ static void split_keys_info_by_shard(const KeysInfo& keys_info, std::vector<Keys
 }
 
 Status ImmutableIndex::get(size_t n, const Slice* keys, const KeysInfo& keys_info, IndexValue* values,
-                           size_t* num_found, size_t key_size) const {
+                           size_t* num_found, size_t key_size, KeysInfo* not_found) const {
     auto iter = _shard_info_by_length.find(key_size);
     if (iter == _shard_info_by_length.end()) {
+        for (size_t i = 0; i < keys_info.size(); i++) {
+            add_not_found(keys_info, i, not_found);
+        }
         return Status::OK();
     }
     size_t found = 0;
@@ -1267,15 +1354,38 @@ Status ImmutableIndex::get(size_t n, const Slice* keys, const KeysInfo& keys_inf
         std::vector<KeysInfo> keys_info_by_shard(nshard);
         split_keys_info_by_shard(keys_info, keys_info_by_shard);
         for (size_t i = 0; i < nshard; i++) {
-            RETURN_IF_ERROR(_get_in_shard(shard_off + i, n, keys, keys_info_by_shard[i], values, &found));
+            RETURN_IF_ERROR(_get_in_shard(shard_off + i, n, keys, keys_info_by_shard[i], values, &found, not_found));
         }
     } else {
-        RETURN_IF_ERROR(_get_in_shard(shard_off, n, keys, keys_info, values, &found));
+        RETURN_IF_ERROR(_get_in_shard(shard_off, n, keys, keys_info, values, &found, not_found));
     }
     *num_found += found;
     return Status::OK();
 }
 
+Status ImmutableIndex::build_bloom_filter(std::unique_ptr<BloomFilter>* bf) const {
+    RETURN_IF_ERROR(BloomFilter::create(BLOCK_BLOOM_FILTER, bf));
+    RETURN_IF_ERROR((*bf)->init(std::max<size_t>(_size, 1), kL1DeltaBloomFilterFpp, HASH_MURMUR3_X64_64));
+    std::vector<std::vector<KVRef>> kvs(1);
+    for (size_t shard_idx = 0; shard_idx < _shards.size(); shard_idx++) {
+        std::unique_ptr<ImmutableIndexShard> shard;
+        RETURN_IF_ERROR(_get_kvs_for_shard(kvs, shard_idx, 0, &shard));
+        for (const auto& kv : kvs[0]) {
+            (*bf)->add_hash(kv.hash);
+        }
+        kvs[0].clear();
+    }
+    return Status::OK();
+}
+
+size_t ImmutableIndex::memory_usage() const {
+    size_t usage = 0;
+    for (const auto& bf : _bloom_filters) {
+        usage += bf != nullptr ? bf->size() : 0;
+    }
+    return usage;
+}
+
 Status ImmutableIndex::check_not_exist(size_t n, const Slice* keys, size_t key_size) {
     auto iter = _shard_info_by_length.find(key_size);
     if (iter == _shard_info_by_length.end()) {
@@ -1351,6 +1461,21 @@ StatusOr<std::unique_ptr<ImmutableIndex>> ImmutableIndex::load(std::unique_ptr<R
         dest.value_size = src.value_size();
         dest.nbucket = src.nbucket();
     }
+    // the files written without the bloom filters are read as before
+    idx->_bloom_filters.resize(nshard);
+    idx->_has_bloom_filter = true;
+    std::string bf_buff;
+    for (size_t i = 0; i < nshard; i++) {
+        const auto& src = meta.shards(i);
+        if (!src.has_bloom_filter() || src.bloom_filter().size() == 0) {
+            idx->_has_bloom_filter &= src.size() == 0;
+            continue;
+        }
+        raw::stl_string_resize_uninitialized(&bf_buff, src.bloom_filter().size());
+        RETURN_IF_ERROR(file->read_at_fully(src.bloom_filter().offset(), bf_buff.data(), bf_buff.size()));
+        RETURN_IF_ERROR(BloomFilter::create(BLOCK_BLOOM_FILTER, &idx->_bloom_filters[i]));
+        RETURN_IF_ERROR(idx->_bloom_filters[i]->init(bf_buff.data(), bf_buff.size(), HASH_MURMUR3_X64_64));
+    }
     size_t nlength = meta.shard_info_size();
     for (size_t i = 0; i < nlength; i++) {
         const auto& src = meta.shard_info(i);
@@ -1371,6 +1496,21 @@ PersistentIndex::~PersistentIndex() {
     if (_l1) {
         _l1->clear();
     }
+    for (auto& l1_delta : _l1_deltas) {
+        l1_delta->clear();
+    }
+}
+
+size_t PersistentIndex::memory_usage() const {
+    size_t usage = _l0 ? _l0->memory_usage() : 0;
+    if (_l1) {
+        usage += _l1->memory_usage();
+    }
+    for (size_t i = 0; i < _l1_deltas.size(); i++) {
+        usage += _l1_deltas[i] != nullptr ? _l1_deltas[i]->memory_usage() : 0;
+        usage += _l1_delta_bfs[i] != nullptr ? _l1_delta_bfs[i]->size() : 0;
+    }
+    return usage;
 }
 
 // Create a new empty PersistentIndex
@@ -1435,6 +1575,35 @@ Status PersistentIndex::_load(const PersistentIndexMetaPB& index_meta) {
         }
         _l1 = std::move(l1_st).value();
     }
+
+    // reuse the loaded deltas, whose bloom filters take a scan of the file to build
+    std::vector<EditVersion> l1_delta_versions;
+    std::vector<std::unique_ptr<ImmutableIndex>> l1_deltas;
+    std::vector<std::unique_ptr<BloomFilter>> l1_delta_bfs;
+    for (const auto& version_pb : index_meta.l1_delta_versions()) {
+        EditVersion version(version_pb);
+        auto it = std::find(_l1_delta_versions.begin(), _l1_delta_versions.end(), version);
+        if (it != _l1_delta_versions.end() && _l1_deltas[it - _l1_delta_versions.begin()] != nullptr) {
+            size_t idx = it - _l1_delta_versions.begin();
+            l1_deltas.emplace_back(std::move(_l1_deltas[idx]));
+            l1_delta_bfs.emplace_back(std::move(_l1_delta_bfs[idx]));
+        } else {
+            auto path = strings::Substitute("$0/$1.$2.$3", _path, kL1DeltaFilePrefix, version.major(), version.minor());
+            ASSIGN_OR_RETURN(auto rfile, _fs->new_random_access_file(path));
+            ASSIGN_OR_RETURN(auto l1_delta, ImmutableIndex::load(std::move(rfile)));
+            // a delta with the bloom filters of its shards needs no whole-file filter
+            std::unique_ptr<BloomFilter> bf;
+            if (!l1_delta->has_bloom_filter()) {
+                RETURN_IF_ERROR(l1_delta->build_bloom_filter(&bf));
+            }
+            l1_deltas.emplace_back(std::move(l1_delta));
+            l1_delta_bfs.emplace_back(std::move(bf));
+        }
+        l1_delta_versions.emplace_back(version);
+    }
+    _l1_delta_versions.swap(l1_delta_versions);
+    _l1_deltas.swap(l1_deltas);
+    _l1_delta_bfs.swap(l1_delta_bfs);
     return Status::OK();
 }
 
@@ -1457,6 +1626,7 @@ Status PersistentIndex::_build_commit(Tablet* tablet, PersistentIndexMetaPB& ind
     RETURN_IF_ERROR(_delete_expired_index_file(_version, _l1_version));
     _dump_snapshot = false;
     _flushed = false;
+    _flushed_l1_delta = false;
     return status;
 }
 
@@ -1714,7 +1884,8 @@ Status PersistentIndex::abort() {
 //   2. _merge_compaction
 //   3. _dump_snapshot
 //   4. _append_wal
-// both case1 and case2 will create a new l1 file and a new empty l0 file
+// both case1 and case2 will create a new l1 file and a new empty l0 file,
+// or a new l1 delta file and a new empty l0 file if the l0 is flushed as a delta
 // case3 will write a new snapshot l0
 // case4 will append wals into l0 file
 Status PersistentIndex::commit(PersistentIndexMetaPB* index_meta) {
@@ -1725,7 +1896,12 @@ Status PersistentIndex::commit(PersistentIndexMetaPB* index_meta) {
         // update PersistentIndexMetaPB
         index_meta->set_size(_size);
         _version.to_pb(index_meta->mutable_version());
-        _version.to_pb(index_meta->mutable_l1_version());
+        if (_flushed_l1_delta) {
+            _version.to_pb(index_meta->add_l1_delta_versions());
+        } else {
+            _version.to_pb(index_meta->mutable_l1_version());
+            index_meta->clear_l1_delta_versions();
+        }
         MutableIndexMetaPB* l0_meta = index_meta->mutable_l0_meta();
         RETURN_IF_ERROR(_l0->commit(l0_meta, _version, kFlush));
         // clear _l0 and reload _l1
@@ -1750,6 +1926,7 @@ Status PersistentIndex::on_commited() {
     }
     _dump_snapshot = false;
     _flushed = false;
+    _flushed_l1_delta = false;
     return Status::OK();
 }
 
@@ -1757,8 +1934,8 @@ Status PersistentIndex::get(size_t n, const Slice* keys, IndexValue* values) {
     KeysInfo l1_checks;
     size_t num_found = 0;
     RETURN_IF_ERROR(_l0->get(n, keys, values, &l1_checks, &num_found));
-    if (_l1) {
-        RETURN_IF_ERROR(_l1->get(n, keys, l1_checks, values, &num_found, _key_size));
+    if (_has_immutable_index()) {
+        RETURN_IF_ERROR(_get_from_immutable_index(n, keys, l1_checks, values, &num_found));
     }
     return Status::OK();
 }
@@ -1768,8 +1945,8 @@ Status PersistentIndex::upsert(size_t n, const Slice* keys, const IndexValue* va
     size_t num_found = 0;
     RETURN_IF_ERROR(_l0->upsert(n, keys, values, old_values, &l1_checks, &num_found));
     _dump_snapshot |= _can_dump_directly();
-    if (_l1) {
-        RETURN_IF_ERROR(_l1->get(n, keys, l1_checks, old_values, &num_found, _key_size));
+    if (_has_immutable_index()) {
+        RETURN_IF_ERROR(_get_from_immutable_index(n, keys, l1_checks, old_values, &num_found));
     }
     _size += (n - num_found);
     if (!_dump_snapshot) {
@@ -1780,7 +1957,20 @@ Status PersistentIndex::upsert(size_t n, const Slice* keys, const IndexValue* va
 
 Status PersistentIndex::insert(size_t n, const Slice* keys, const IndexValue* values, bool check_l1) {
     RETURN_IF_ERROR(_l0->insert(n, keys, values));
-    if (_l1 && check_l1) {
+    if (check_l1 && !_l1_deltas.empty()) {
+        // a key of l1 may be erased by a delta, so check by the lookups
+        KeysInfo keys_info;
+        for (size_t i = 0; i < n; i++) {
+            keys_info.key_idxes.emplace_back(i);
+            keys_info.hashes.emplace_back(key_index_hash(keys[i].get_data(), keys[i].get_size()));
+        }
+        std::vector<IndexValue> found_values(n, IndexValue(NullIndexValue));
+        size_t num_found = 0;
+        RETURN_IF_ERROR(_get_from_immutable_index(n, keys, keys_info, found_values.data(), &num_found));
+        if (num_found > 0) {
+            return Status::AlreadyExist(strings::Substitute("$0 keys already exist in l1", num_found));
+        }
+    } else if (_l1 && check_l1) {
         RETURN_IF_ERROR(_l1->check_not_exist(n, keys, _key_size));
     }
     _dump_snapshot |= _can_dump_directly();
@@ -1796,8 +1986,8 @@ Status PersistentIndex::erase(size_t n, const Slice* keys, IndexValue* old_value
     size_t num_erased = 0;
     RETURN_IF_ERROR(_l0->erase(n, keys, old_values, &l1_checks, &num_erased));
     _dump_snapshot |= _can_dump_directly();
-    if (_l1) {
-        RETURN_IF_ERROR(_l1->get(n, keys, l1_checks, old_values, &num_erased, _key_size));
+    if (_has_immutable_index()) {
+        RETURN_IF_ERROR(_get_from_immutable_index(n, keys, l1_checks, old_values, &num_erased));
     }
     CHECK(_size >= num_erased) << strings::Substitute("_size($0) < num_erased($1)", _size, num_erased);
     _size -= num_erased;
@@ -1868,6 +2058,55 @@ Status PersistentIndex::_flush_l0() {
     return writer.finish();
 }
 
+Status PersistentIndex::_flush_l0_as_l1_delta() {
+    size_t l0_size = _l0->size();
+    auto [nshard, npage_hint] = estimate_nshard_and_npage(kv_pair_size(), l0_size, kDefaultUsagePercent);
+    auto nbucket = estimate_nbucket(_key_size, l0_size, nshard, npage_hint);
+    // keep the tombstones, they hide the erased keys of the older levels
+    auto kv_ref_by_shard = _l0->get_kv_refs_by_shard(nshard, l0_size, false);
+    ImmutableIndexWriter writer;
+    RETURN_IF_ERROR(writer.init(_path, _version, kL1DeltaFilePrefix));
+    for (auto& kvs : kv_ref_by_shard) {
+        RETURN_IF_ERROR(writer.write_shard(_key_size, npage_hint, nbucket, kvs));
+    }
+    return writer.finish();
+}
+
+Status PersistentIndex::_get_from_immutable_index(size_t n, const Slice* keys, const KeysInfo& keys_info,
+                                                  IndexValue* values, size_t* num_found) const {
+    if (_l1_deltas.empty()) {
+        return _l1 ? _l1->get(n, keys, keys_info, values, num_found, _key_size) : Status::OK();
+    }
+    KeysInfo checks = keys_info;
+    for (size_t i = _l1_deltas.size(); i > 0 && checks.size() > 0; i--) {
+        const BloomFilter* bf = _l1_delta_bfs[i - 1].get();
+        KeysInfo may_exist;
+        KeysInfo not_found;
+        for (size_t k = 0; k < checks.size(); k++) {
+            KeysInfo& dst = (bf == nullptr || bf->test_hash(checks.hashes[k])) ? may_exist : not_found;
+            dst.key_idxes.emplace_back(checks.key_idxes[k]);
+            dst.hashes.emplace_back(checks.hashes[k]);
+        }
+        if (may_exist.size() > 0) {
+            size_t not_found_before = not_found.size();
+            size_t found = 0;
+            RETURN_IF_ERROR(_l1_deltas[i - 1]->get(n, keys, may_exist, values, &found, _key_size, &not_found));
+            size_t num_null = 0;
+            for (uint32_t key_idx : may_exist.key_idxes) {
+                num_null += values[key_idx].get_value() == NullIndexValue;
+            }
+            // the keys found with NullIndexValue are the tombstones
+            size_t num_tombstones = num_null - (not_found.size() - not_found_before);
+            *num_found += found - num_tombstones;
+        }
+        checks = std::move(not_found);
+    }
+    if (_l1 && checks.size() > 0) {
+        RETURN_IF_ERROR(_l1->get(n, keys, checks, values, num_found, _key_size));
+    }
+    return Status::OK();
+}
+
 Status PersistentIndex::_reload(const PersistentIndexMetaPB& index_meta) {
     auto l0_st = MutableIndex::create(_key_size, _path);
     if (!l0_st.ok()) {
@@ -1895,14 +2134,21 @@ Status PersistentIndex::_check_and_flush_l0() {
     if (_l1 != nullptr) {
         _l1->file_size(&l1_file_size);
     }
+    // with the l1 deltas, a flush doesn't rewrite l1, so it doesn't wait for l0 to grow with l1
+    bool flush_l1_delta = _l1 != nullptr && config::enable_persistent_index_l1_delta &&
+                          _l1_deltas.size() < static_cast<size_t>(config::persistent_index_max_l1_delta_num);
     if (l0_mem_size <= kL0FlushSizeMin &&
-        ((l0_mem_size <= kL0SnapshotSizeMax) || (l1_file_size / l0_mem_size > kL0L1MergeRatio))) {
+        ((l0_mem_size <= kL0SnapshotSizeMax) ||
+         (!flush_l1_delta && l1_file_size / l0_mem_size > kL0L1MergeRatio))) {
         return Status::OK();
     }
     _flushed = true;
+    _flushed_l1_delta = flush_l1_delta;
     // flush _l0
     if (_l1 == nullptr) {
         RETURN_IF_ERROR(_flush_l0());
+    } else if (flush_l1_delta) {
+        RETURN_IF_ERROR(_flush_l0_as_l1_delta());
     } else {
         RETURN_IF_ERROR(_merge_compaction());
     }
@@ -1923,12 +2169,19 @@ Status PersistentIndex::_delete_expired_index_file(const EditVersion& l0_version
     std::string l0_file_name = strings::Substitute("index.l0.$0.$1", l0_version.major(), l0_version.minor());
     std::string l1_file_name = strings::Substitute("index.l1.$0.$1", l1_version.major(), l1_version.minor());
     std::string l0_prefix("index.l0");
-    std::string l1_prefix("index.l1");
+    std::string l1_prefix(kL1FilePrefix);
+    std::set<std::string> l1_delta_file_names;
+    for (const auto& version : _l1_delta_versions) {
+        l1_delta_file_names.emplace(
+                strings::Substitute("$0.$1.$2", kL1DeltaFilePrefix, version.major(), version.minor()));
+    }
     std::string dir = _path;
     auto cb = [&](std::string_view name) -> bool {
         std::string full(name);
+        // the prefix of l1 is also the prefix of the l1 deltas
         if ((full.compare(0, l0_prefix.length(), l0_prefix) == 0 && full.compare(l0_file_name) != 0) ||
-            (full.compare(0, l1_prefix.length(), l1_prefix) == 0 && full.compare(l1_file_name) != 0)) {
+            (full.compare(0, l1_prefix.length(), l1_prefix) == 0 && full.compare(l1_file_name) != 0 &&
+             l1_delta_file_names.count(full) == 0)) {
             std::string path = dir + "/" + full;
             VLOG(1) << "delete expired index file " << path;
             Status st = FileSystem::Default()->delete_file(path);
@@ -2034,7 +2287,29 @@ Status PersistentIndex::_merge_compaction() {
     auto [nshard, npage_hint] = estimate_nshard_and_npage(kv_pair_size(), _size, kDefaultUsagePercent);
     auto nbucket = estimate_nbucket(_key_size, _size, nshard, npage_hint);
     size_t estimated_size_per_shard = _size / nshard;
+    std::vector<std::unique_ptr<ImmutableIndexShard>> l1_delta_shards;
     std::vector<std::vector<KVRef>> l0_kvs_by_shard = _l0->get_kv_refs_by_shard(nshard, _l0->size(), false);
+    if (!_l1_deltas.empty()) {
+        // the kvs of the l1 deltas, from the oldest to the newest, go before the kvs of l0 of each shard, so
+        // the newer ones override the older ones in merge_shard_kvs. The deltas are small, so all of their
+        // shards are kept in memory during the merge.
+        std::vector<std::vector<KVRef>> upper_kvs_by_shard(nshard);
+        uint32_t shard_bits = log2(nshard);
+        for (const auto& l1_delta : _l1_deltas) {
+            for (size_t shard_idx = 0; shard_idx < l1_delta->_shards.size(); shard_idx++) {
+                std::unique_ptr<ImmutableIndexShard> shard;
+                RETURN_IF_ERROR(l1_delta->_get_kvs_for_shard(upper_kvs_by_shard, shard_idx, shard_bits, &shard));
+                if (shard != nullptr) {
+                    l1_delta_shards.emplace_back(std::move(shard));
+                }
+            }
+        }
+        for (size_t i = 0; i < nshard; i++) {
+            upper_kvs_by_shard[i].insert(upper_kvs_by_shard[i].end(), l0_kvs_by_shard[i].begin(),
+                                         l0_kvs_by_shard[i].end());
+        }
+        l0_kvs_by_shard.swap(upper_kvs_by_shard);
+    }
     std::vector<std::vector<KVRef>> l1_kvs_by_shard(nshard);
     size_t nshard_l1 = _l1->_shards.size();
     size_t cur_shard_idx = 0;
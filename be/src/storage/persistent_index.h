@@ -16,6 +16,7 @@
 namespace starrocks {
 
 class Tablet;
+class BloomFilter;
 namespace vectorized {
 class Schema;
 class Column;
@@ -186,8 +187,17 @@ public:
     // |values|: value array for return values
     // |num_found|: add the number of keys found in L1 to this argument
     // |key_size|: the key size of keys array
+    // |not_found|: if not null, add the information of keys not found in this level to it
     Status get(size_t n, const Slice* keys, const KeysInfo& keys_info, IndexValue* values, size_t* num_found,
-               size_t key_size) const;
+               size_t key_size, KeysInfo* not_found = nullptr) const;
+
+    // build a bloom filter of the hashes of all the keys, by reading the whole file
+    Status build_bloom_filter(std::unique_ptr<BloomFilter>* bf) const;
+
+    // whether every shard of the file has a bloom filter
+    bool has_bloom_filter() const { return _has_bloom_filter; }
+
+    size_t memory_usage() const;
 
     // batch check key existence
     Status check_not_exist(size_t n, const Slice* keys, size_t key_size);
@@ -225,15 +235,15 @@ private:
                               std::unique_ptr<ImmutableIndexShard>* shard) const;
 
     Status _get_in_fixlen_shard(size_t shard_idx, size_t n, const Slice* keys, const KeysInfo& keys_info,
-                                IndexValue* values, size_t* num_found,
-                                std::unique_ptr<ImmutableIndexShard>* shard) const;
+                                IndexValue* values, size_t* num_found, std::unique_ptr<ImmutableIndexShard>* shard,
+                                KeysInfo* not_found) const;
 
     Status _get_in_varlen_shard(size_t shard_idx, size_t n, const Slice* keys, const KeysInfo& keys_info,
-                                IndexValue* values, size_t* num_found,
-                                std::unique_ptr<ImmutableIndexShard>* shard) const;
+                                IndexValue* values, size_t* num_found, std::unique_ptr<ImmutableIndexShard>* shard,
+                                KeysInfo* not_found) const;
 
     Status _get_in_shard(size_t shard_idx, size_t n, const Slice* keys, const KeysInfo& keys_info, IndexValue* values,
-                         size_t* num_found) const;
+                         size_t* num_found, KeysInfo* not_found) const;
 
     Status _check_not_exist_in_fixlen_shard(size_t shard_idx, size_t n, const Slice* keys, const KeysInfo& keys_info,
                                             std::unique_ptr<ImmutableIndexShard>* shard) const;
@@ -261,10 +271,18 @@ private:
 
     std::vector<ShardInfo> _shards;
     std::map<size_t, std::pair<size_t, size_t>> _shard_info_by_length;
+    // the bloom filters of the shards, empty if the file is written without them
+    std::vector<std::unique_ptr<BloomFilter>> _bloom_filters;
+    bool _has_bloom_filter = false;
 };
 
 // A persistent primary index contains an in-memory L0 and an on-SSD/NVMe L1,
 // this saves memory usage comparing to the orig all-in-memory implementation.
+// If enable_persistent_index_l1_delta is on, a flush of L0 writes a small L1 delta file, with the
+// tombstones of the erased keys, on top of the L1 file instead of rewriting the whole L1, so the cost
+// of a flush is proportional to L0 rather than the index. The lookups go through L0, the deltas from
+// the newest to the oldest, each skipped by its in-memory bloom filter, and then L1. When there are
+// persistent_index_max_l1_delta_num deltas, the next flush merges L0 and all the deltas into a new L1.
 // This is a internal class and is intended to be used by PrimaryIndex internally.
 // TODO: code skeleton currently, implementation in future PRs
 //
@@ -293,7 +311,7 @@ public:
 
     size_t size() const { return _size; }
     size_t capacity() const { return _l0 ? _l0->capacity() : 0; }
-    size_t memory_usage() const { return _l0 ? _l0->memory_usage() : 0; }
+    size_t memory_usage() const;
 
     EditVersion version() const { return _version; }
 
@@ -376,8 +394,16 @@ private:
     // check _l0 should dump as snapshot or not
     bool _can_dump_directly();
 
+    // the l1 delta files in |_l1_delta_versions| are kept too
     Status _delete_expired_index_file(const EditVersion& l0_version, const EditVersion& l1_version);
 
+    // get the keys of |keys_info| from the l1 delta files and then l1, a tombstone in a delta means the key
+    // is erased, it's not counted by |num_found| and the older levels are not checked
+    Status _get_from_immutable_index(size_t n, const Slice* keys, const KeysInfo& keys_info, IndexValue* values,
+                                     size_t* num_found) const;
+
+    bool _has_immutable_index() const { return _l1 != nullptr || !_l1_deltas.empty(); }
+
     // batch append wal
     // |n|: size of key/value array
     // |keys|: key array as raw buffer
@@ -388,7 +414,10 @@ private:
 
     Status _flush_l0();
 
-    // merge l0 and l1 into new l1, then clear l0
+    // flush _l0 into a new l1 delta file
+    Status _flush_l0_as_l1_delta();
+
+    // merge l0, the l1 deltas and l1 into new l1, then clear l0
     Status _merge_compaction();
 
     Status _load(const PersistentIndexMetaPB& index_meta);
@@ -411,10 +440,16 @@ private:
     EditVersion _l1_version;
     std::unique_ptr<MutableIndex> _l0;
     std::unique_ptr<ImmutableIndex> _l1;
+    // the l1 delta files from the oldest to the newest, and their bloom filters
+    std::vector<EditVersion> _l1_delta_versions;
+    std::vector<std::unique_ptr<ImmutableIndex>> _l1_deltas;
+    std::vector<std::unique_ptr<BloomFilter>> _l1_delta_bfs;
     std::shared_ptr<FileSystem> _fs;
 
     bool _dump_snapshot = false;
     bool _flushed = false;
+    // whether the flush of this commit writes an l1 delta file, valid if _flushed is true
+    bool _flushed_l1_delta = false;
 };
 
 } // namespace starrocks
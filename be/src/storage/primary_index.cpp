@@ -2,6 +2,7 @@
 
 #include "storage/primary_index.h"
 
+#include <functional>
 #include <mutex>
 
 #include "common/tracer.h"
@@ -15,6 +16,7 @@
 #include "storage/tablet_updates.h"
 #include "util/stack_util.h"
 #include "util/starrocks_metrics.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -39,6 +41,16 @@ public:
     // batch upsert a range [idx_begin, idx_end) of keys
     virtual void upsert(uint32_t rssid, uint32_t rowid_start, const vectorized::Column& pks, uint32_t idx_begin,
                         uint32_t idx_end, DeletesMap* deletes) = 0;
+    // batch upsert the keys of several segments in order, the segment i has the rssid |rssid_start| + i.
+    // the implementations with a sharded map may update the shards concurrently by |pool|.
+    virtual void upsert_segments(uint32_t rssid_start, const std::vector<const vectorized::Column*>& pks_list,
+                                 ThreadPool* pool, DeletesMap* deletes) {
+        for (uint32_t i = 0; i < pks_list.size(); i++) {
+            if (pks_list[i] != nullptr) {
+                upsert(rssid_start + i, 0, *pks_list[i], 0, pks_list[i]->size(), deletes);
+            }
+        }
+    }
     // TODO(qzc): maybe unused, remove it or refactor it with the methods in use by template after a period of time
     // batch try_replace a range [idx_begin, idx_end) of keys
     [[maybe_unused]] virtual void try_replace(uint32_t rssid, uint32_t rowid_start, const vectorized::Column& pks,
@@ -86,13 +98,34 @@ public:
 
 const uint32_t PREFETCHN = 8;
 
+// Run |func| by |token|, or in the calling thread if the pool refuses it, e.g. it's shutting down.
+static void submit_or_run(ThreadPoolToken* token, const std::function<void()>& func) {
+    if (!token->submit_func(func).ok()) {
+        func();
+    }
+}
+
+template <typename Key>
+using HashIndexMap =
+        phmap::parallel_flat_hash_map<Key, RowIdPack4, vectorized::StdHashWithSeed<Key, vectorized::PhmapSeed1>,
+                                      phmap::priv::hash_default_eq<Key>,
+                                      TraceAlloc<phmap::priv::Pair<const Key, RowIdPack4>>, 4, phmap::NullMutex, false>;
+
+// The map of HashIndexImpl. Each sub-map is only accessed by the keys hashed to it, so the different
+// sub-maps can be updated by different threads with phmap::NullMutex.
+template <typename Key>
+class ShardedHashMap : public HashIndexMap<Key> {
+    using Base = HashIndexMap<Key>;
+
+public:
+    using Base::subcnt;
+    using Base::subidx;
+};
+
 template <typename Key>
 class HashIndexImpl : public HashIndex {
 private:
-    phmap::parallel_flat_hash_map<Key, RowIdPack4, vectorized::StdHashWithSeed<Key, vectorized::PhmapSeed1>,
-                                  phmap::priv::hash_default_eq<Key>,
-                                  TraceAlloc<phmap::priv::Pair<const Key, RowIdPack4>>, 4, phmap::NullMutex, false>
-            _map;
+    ShardedHashMap<Key> _map;
 
 public:
     HashIndexImpl() = default;
@@ -148,6 +181,62 @@ public:
         }
     }
 
+    // 1. split the keys of each segment by the sub-maps, a task per segment.
+    // 2. upsert the keys of each sub-map, a task per sub-map. The task goes through the segments in order, so
+    //    the result of each key is the same as the serial upsert, and it doesn't wait for the other sub-maps.
+    void upsert_segments(uint32_t rssid_start, const std::vector<const vectorized::Column*>& pks_list,
+                         ThreadPool* pool, DeletesMap* deletes) override {
+        if (pool == nullptr) {
+            HashIndex::upsert_segments(rssid_start, pks_list, pool, deletes);
+            return;
+        }
+        const size_t num_shards = ShardedHashMap<Key>::subcnt();
+        const size_t num_segments = pks_list.size();
+        auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+
+        // shard_idxes[segment][shard] are the indexes of the keys of the segment in the sub-map.
+        std::vector<std::vector<std::vector<uint32_t>>> shard_idxes(num_segments);
+        for (size_t seg = 0; seg < num_segments; seg++) {
+            if (pks_list[seg] == nullptr) {
+                continue;
+            }
+            submit_or_run(token.get(), [&, seg]() {
+                auto* keys = reinterpret_cast<const Key*>(pks_list[seg]->raw_data());
+                const uint32_t n = pks_list[seg]->size();
+                auto& idxes = shard_idxes[seg];
+                idxes.resize(num_shards);
+                for (auto& v : idxes) {
+                    v.reserve(n / num_shards + 1);
+                }
+                for (uint32_t i = 0; i < n; i++) {
+                    idxes[ShardedHashMap<Key>::subidx(_map.hash(keys[i]))].push_back(i);
+                }
+            });
+        }
+        token->wait();
+
+        std::vector<DeletesMap> shard_deletes(num_shards);
+        for (size_t shard = 0; shard < num_shards; shard++) {
+            submit_or_run(token.get(), [&, shard]() {
+                for (size_t seg = 0; seg < num_segments; seg++) {
+                    if (pks_list[seg] == nullptr) {
+                        continue;
+                    }
+                    _upsert_indexes(rssid_start + seg, *pks_list[seg], shard_idxes[seg][shard],
+                                    &shard_deletes[shard]);
+                }
+            });
+        }
+        token->wait();
+
+        for (auto& shard_delete : shard_deletes) {
+            for (auto& [rssid, rowids] : shard_delete) {
+                auto& dst = (*deletes)[rssid];
+                dst.insert(dst.end(), rowids.begin(), rowids.end());
+            }
+        }
+    }
+
     [[maybe_unused]] void try_replace(uint32_t rssid, uint32_t rowid_start, const vectorized::Column& pks,
                                       const vector<uint32_t>& src_rssid, uint32_t idx_begin, uint32_t idx_end,
                                       vector<uint32_t>* failed) override {
@@ -215,6 +304,30 @@ public:
     std::size_t memory_usage() const final {
         return _map.capacity() * (1 + (sizeof(Key) + 3) / 4 * 4 + sizeof(RowIdPack4));
     }
+
+private:
+    // upsert the keys |idxes| of |pks|, the rowid of a key is its index.
+    void _upsert_indexes(uint32_t rssid, const vectorized::Column& pks, const std::vector<uint32_t>& idxes,
+                         DeletesMap* deletes) {
+        auto* keys = reinterpret_cast<const Key*>(pks.raw_data());
+        uint64_t base = (((uint64_t)rssid) << 32);
+        for (size_t k = 0; k < idxes.size(); k++) {
+            size_t prefetch_k = k + PREFETCHN;
+            if (LIKELY(prefetch_k < idxes.size())) _map.prefetch(keys[idxes[prefetch_k]]);
+            uint32_t i = idxes[k];
+            RowIdPack4 v(base + i);
+            auto p = _map.insert({keys[i], v});
+            if (!p.second) {
+                uint64_t old = p.first->second.value;
+                if ((old >> 32) == rssid) {
+                    LOG(ERROR) << "found duplicate in upsert data rssid:" << rssid << " key=" << keys[i] << " idx=" << i
+                               << " rowid=" << i;
+                }
+                (*deletes)[(uint32_t)(old >> 32)].push_back((uint32_t)(old & ROWID_MASK));
+                p.first->second = v;
+            }
+        }
+    }
 };
 
 template <size_t S>
@@ -1293,6 +1406,20 @@ void PrimaryIndex::try_replace(uint32_t rssid, uint32_t rowid_start, const vecto
     }
 }
 
+void PrimaryIndex::upsert(uint32_t rssid_start, const std::vector<const vectorized::Column*>& pks_list,
+                          ThreadPool* pool, DeletesMap* deletes) {
+    DCHECK(_status.ok() && (_pkey_to_rssid_rowid || _persistent_index));
+    if (_persistent_index != nullptr) {
+        for (uint32_t i = 0; i < pks_list.size(); i++) {
+            if (pks_list[i] != nullptr) {
+                _upsert_into_persistent_index(rssid_start + i, 0, *pks_list[i], deletes);
+            }
+        }
+    } else {
+        _pkey_to_rssid_rowid->upsert_segments(rssid_start, pks_list, pool, deletes);
+    }
+}
+
 void PrimaryIndex::erase(const vectorized::Column& key_col, DeletesMap* deletes) {
     DCHECK(_status.ok() && (_pkey_to_rssid_rowid || _persistent_index));
     if (_persistent_index != nullptr) {
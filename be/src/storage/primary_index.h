@@ -15,6 +15,7 @@ namespace starrocks {
 
 class Tablet;
 class HashIndex;
+class ThreadPool;
 
 const uint64_t ROWID_MASK = 0xffffffff;
 
@@ -56,6 +57,15 @@ public:
     // [not thread-safe]
     void upsert(uint32_t rssid, uint32_t rowid_start, const vectorized::Column& pks, DeletesMap* deletes);
 
+    // upsert the primary keys of the segments of a rowset, |pks_list[i]| are the keys of the segment whose
+    // rssid is |rssid_start| + i, nullptr if the segment has no upserts. The result is the same as upserting
+    // the segments one by one, except the order of the rowids in |deletes|.
+    // If |pool| is not null, the sub-maps of the in-memory index are updated concurrently by |pool|.
+    //
+    // [not thread-safe]
+    void upsert(uint32_t rssid_start, const std::vector<const vectorized::Column*>& pks_list, ThreadPool* pool,
+                DeletesMap* deletes);
+
     // TODO(qzc): maybe unused, remove it or refactor it with the methods in use by template after a period of time
     // used for compaction, try replace input rowsets' rowid with output segment's rowid, if
     // input rowsets' rowid doesn't exist, this indicates that the row of output rowset is
@@ -176,6 +176,11 @@ public:
 
     SparseRange& operator|=(const SparseRange& rhs);
 
+    // return a new range that represent the rows of |this| not in |rhs|.
+    SparseRange operator-(const SparseRange& rhs) const;
+
+    SparseRange& operator-=(const SparseRange& rhs);
+
 private:
     friend class SparseRangeIterator;
 
@@ -290,6 +295,31 @@ inline SparseRange& SparseRange::operator|=(const SparseRange& rhs) {
     return *this;
 }
 
+inline SparseRange SparseRange::operator-(const SparseRange& rhs) const {
+    SparseRange result;
+    size_t j = 0;
+    for (const auto& r : _ranges) {
+        // skip the ranges of |rhs| on the left side of |r|.
+        while (j < rhs._ranges.size() && rhs._ranges[j].end() <= r.begin()) {
+            j++;
+        }
+        rowid_t begin = r.begin();
+        // the last range of |rhs| intersected may also intersect with the next range of |this|, keep |j| on it.
+        for (size_t k = j; k < rhs._ranges.size() && rhs._ranges[k].begin() < r.end(); k++) {
+            result._add_uncheck(Range(begin, rhs._ranges[k].begin()));
+            begin = std::max(begin, rhs._ranges[k].end());
+        }
+        result._add_uncheck(Range(begin, r.end()));
+    }
+    return result;
+}
+
+inline SparseRange& SparseRange::operator-=(const SparseRange& rhs) {
+    SparseRange tmp = *this - rhs;
+    *this = std::move(tmp);
+    return *this;
+}
+
 inline SparseRangeIterator::SparseRangeIterator(const SparseRange* r) : _range(r), _index(0), _next_rowid(0) {
     if (!_range->_ranges.empty()) {
         _next_rowid = _range->_ranges[0].begin();
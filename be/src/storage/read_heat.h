@@ -0,0 +1,85 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+
+#include "common/config.h"
+#include "util/spinlock.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+// The read statistics of a tablet or a rowset by the queries, for the decisions of the page cache, the compaction and
+// the block cache. The reads and the scanned bytes are exponentially decayed, i.e. the ones scan_heat_half_life_sec
+// ago weigh half of the ones now, so that the recently hot data stand out.
+// It is recorded once per scan rather than per chunk, so a spin lock is cheap enough.
+class ReadHeat {
+public:
+    void record(int64_t bytes, int64_t now_ms = UnixMillis()) {
+        std::lock_guard l(_lock);
+        _decay_to(now_ms);
+        _reads += 1;
+        _bytes += bytes;
+        _total_reads++;
+        _total_bytes += bytes;
+        _last_read_ms = now_ms;
+    }
+
+    // The decayed reads until |now_ms|.
+    double reads(int64_t now_ms = UnixMillis()) const {
+        std::lock_guard l(_lock);
+        return _reads * _decay_factor(now_ms);
+    }
+
+    // The decayed scanned bytes until |now_ms|.
+    double bytes(int64_t now_ms = UnixMillis()) const {
+        std::lock_guard l(_lock);
+        return _bytes * _decay_factor(now_ms);
+    }
+
+    int64_t total_reads() const {
+        std::lock_guard l(_lock);
+        return _total_reads;
+    }
+
+    int64_t total_bytes() const {
+        std::lock_guard l(_lock);
+        return _total_bytes;
+    }
+
+    // The unix time in milliseconds of the last read, 0 if never read.
+    int64_t last_read_ms() const {
+        std::lock_guard l(_lock);
+        return _last_read_ms;
+    }
+
+private:
+    double _decay_factor(int64_t now_ms) const {
+        if (now_ms <= _decayed_ms || config::scan_heat_half_life_sec <= 0) {
+            return 1;
+        }
+        return std::exp2(-static_cast<double>(now_ms - _decayed_ms) / (config::scan_heat_half_life_sec * 1000));
+    }
+
+    void _decay_to(int64_t now_ms) {
+        double factor = _decay_factor(now_ms);
+        _reads *= factor;
+        _bytes *= factor;
+        _decayed_ms = std::max(_decayed_ms, now_ms);
+    }
+
+    mutable SpinLock _lock;
+    double _reads = 0;
+    double _bytes = 0;
+    // When _reads and _bytes are decayed to.
+    int64_t _decayed_ms = 0;
+    int64_t _total_reads = 0;
+    int64_t _total_bytes = 0;
+    int64_t _last_read_ms = 0;
+};
+
+} // namespace starrocks
@@ -27,4 +27,31 @@ static inline Roaring range2roaring(const SparseRange& range) {
     return roaring;
 }
 
+// Return the rows of |range| which are not in |roaring|, e.g. the rows of a scan range not in the delete vector.
+// Only the values of |roaring| inside |range| are visited, so the cost is proportional to them rather than to the
+// rows of |range|, as converting |range| to a bitmap and back would be.
+static inline SparseRange subtract_roaring(const SparseRange& range, const Roaring& roaring) {
+    SparseRange result;
+    roaring_uint32_iterator_t iter;
+    roaring_init_iterator(&roaring.roaring, &iter);
+    for (size_t i = 0; i < range.size(); i++) {
+        uint32_t begin = range[i].begin();
+        uint32_t end = range[i].end();
+        if (iter.has_value && iter.current_value < begin) {
+            roaring_move_uint32_iterator_equalorlarger(&iter, begin);
+        }
+        while (iter.has_value && iter.current_value < end) {
+            if (begin < iter.current_value) {
+                result.add(Range(begin, iter.current_value));
+            }
+            begin = iter.current_value + 1;
+            roaring_advance_uint32_iterator(&iter);
+        }
+        if (begin < end) {
+            result.add(Range(begin, end));
+        }
+    }
+    return result;
+}
+
 } // namespace starrocks::vectorized
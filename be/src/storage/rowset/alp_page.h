@@ -0,0 +1,367 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "column/column.h"
+#include "storage/range.h"
+#include "storage/rowset/options.h" // for PageBuilderOptions/PageDecoderOptions
+#include "storage/rowset/packed_integer.h"
+#include "storage/rowset/page_builder.h" // for PageBuilder
+#include "storage/rowset/page_decoder.h" // for PageDecoder
+#include "storage/type_traits.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+
+// ALP (Adaptive Lossless floating-Point) coding of FLOAT and DOUBLE. Most of the floating-point values
+// in the tables are decimals of a few digits, e.g. 12.5 or 0.031, which are the nearest doubles of
+// |Digits| / 10^|Exponent| for a small integer |Digits|. ALP stores the integers instead.
+//
+// AlpPage := Header, Body
+// Header := NumElements(uint32), Exponent(uint8), Width(uint8), NumExceptions(uint32), Base(int64)
+// Body := PackedDigits, ExceptionPositions, ExceptionValues, if Exponent is not kRawExponent
+//       | RawValues, otherwise
+// PackedDigits := (Digits - Base) of every element, packed to |Width| bytes by packed_integer::pack
+// ExceptionPositions := uint32 * NumExceptions
+// ExceptionValues := (float|double) * NumExceptions
+//
+// A value is encoded only if it's decoded to the same bits, so the coding is lossless. The others, e.g.
+// NaN, -0.0 and the values of more digits, are the exceptions patched after decoding. The builder picks
+// the exponent of the smallest page by a sample, and falls back to the raw values if ALP doesn't pay.
+//
+// The decoder restores the whole page in init() by a widening loop and a division loop, which are
+// vectorized by the compiler, so the reads after that are plain copies.
+namespace alp_page {
+
+static constexpr size_t kHeaderSize = 2 * sizeof(uint32_t) + 2 * sizeof(uint8_t) + sizeof(int64_t);
+static constexpr uint8_t kRawExponent = 0xFF;
+static constexpr size_t kSampleSize = 1024;
+
+template <typename T>
+struct AlpTraits {};
+
+template <>
+struct AlpTraits<double> {
+    static constexpr uint8_t kMaxExponent = 18;
+    static constexpr double kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8, 1e9,
+                                        1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+};
+
+template <>
+struct AlpTraits<float> {
+    static constexpr uint8_t kMaxExponent = 10;
+    static constexpr float kPow10[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+};
+
+template <typename T>
+inline T decode_value(int64_t digits, uint8_t exponent) {
+    return static_cast<T>(digits) / AlpTraits<T>::kPow10[exponent];
+}
+
+// Return false if |value| can't be restored from the digits of |exponent|.
+template <typename T>
+inline bool encode_value(T value, uint8_t exponent, int64_t* digits) {
+    T scaled = value * AlpTraits<T>::kPow10[exponent];
+    // also false for NaN and infinity.
+    if (!(std::abs(scaled) < static_cast<T>(1LL << 62))) {
+        return false;
+    }
+    *digits = std::llround(scaled);
+    T decoded = decode_value<T>(*digits, exponent);
+    return memcmp(&decoded, &value, sizeof(T)) == 0;
+}
+
+} // namespace alp_page
+
+template <FieldType Type>
+class AlpPageBuilder final : public PageBuilder {
+    using CppType = typename TypeTraits<Type>::CppType;
+    static_assert(std::is_floating_point_v<CppType>, "ALP encoding only supports the floating-point types");
+
+public:
+    explicit AlpPageBuilder(const PageBuilderOptions& options)
+            : _max_count(std::max<size_t>(1, options.data_page_size / sizeof(CppType))) {
+        _values.reserve(_max_count);
+    }
+
+    ~AlpPageBuilder() override = default;
+
+    bool is_page_full() override { return _values.size() >= _max_count; }
+
+    size_t add(const uint8_t* vals, size_t count) override {
+        DCHECK(!_finished);
+        size_t to_add = std::min<size_t>(_max_count - _values.size(), count);
+        size_t old_size = _values.size();
+        _values.resize(old_size + to_add);
+        memcpy(_values.data() + old_size, vals, to_add * sizeof(CppType));
+        return to_add;
+    }
+
+    faststring* finish() override {
+        DCHECK(!_finished);
+        _finished = true;
+        _encode();
+        return &_buf;
+    }
+
+    void reset() override {
+        _values.clear();
+        _buf.clear();
+        _finished = false;
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    // The upper bound before finish(), an AlpPage is never larger than the raw values and the header.
+    uint64_t size() const override {
+        return _finished ? _buf.size() : _values.size() * sizeof(CppType) + alp_page::kHeaderSize;
+    }
+
+    Status get_first_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.front(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.back(), sizeof(CppType));
+        return Status::OK();
+    }
+
+private:
+    // The estimated size of the page body, if the values of |step| are encoded by |exponent|.
+    size_t _estimate_size(uint8_t exponent, size_t step) const {
+        size_t num_sampled = 0;
+        size_t num_exceptions = 0;
+        int64_t min = std::numeric_limits<int64_t>::max();
+        int64_t max = std::numeric_limits<int64_t>::min();
+        for (size_t i = 0; i < _values.size(); i += step) {
+            num_sampled++;
+            int64_t digits;
+            if (alp_page::encode_value(_values[i], exponent, &digits)) {
+                min = std::min(min, digits);
+                max = std::max(max, digits);
+            } else {
+                num_exceptions++;
+            }
+        }
+        uint8_t width = min > max ? 0 : packed_integer::width_of(static_cast<uint64_t>(max) - min);
+        size_t sampled_size = num_sampled * width + num_exceptions * (sizeof(uint32_t) + sizeof(CppType));
+        return sampled_size * _values.size() / num_sampled;
+    }
+
+    void _encode() {
+        const size_t n = _values.size();
+        uint8_t exponent = alp_page::kRawExponent;
+        if (n > 0) {
+            const size_t step = std::max<size_t>(1, n / alp_page::kSampleSize);
+            size_t best_size = n * sizeof(CppType);
+            for (uint8_t e = 0; e <= alp_page::AlpTraits<CppType>::kMaxExponent; e++) {
+                size_t size = _estimate_size(e, step);
+                if (size < best_size) {
+                    best_size = size;
+                    exponent = e;
+                }
+            }
+        }
+        if (exponent != alp_page::kRawExponent && _encode_digits(exponent)) {
+            return;
+        }
+        _buf.clear();
+        _buf.resize(alp_page::kHeaderSize + n * sizeof(CppType));
+        _write_header(n, alp_page::kRawExponent, 0, 0, 0);
+        memcpy(_buf.data() + alp_page::kHeaderSize, _values.data(), n * sizeof(CppType));
+    }
+
+    // Return false if the page is not smaller than the raw values.
+    bool _encode_digits(uint8_t exponent) {
+        const size_t n = _values.size();
+        std::vector<uint64_t> digits(n);
+        std::vector<uint32_t> exception_positions;
+        std::vector<CppType> exception_values;
+        int64_t min = std::numeric_limits<int64_t>::max();
+        int64_t max = std::numeric_limits<int64_t>::min();
+        for (size_t i = 0; i < n; i++) {
+            int64_t d;
+            if (alp_page::encode_value(_values[i], exponent, &d)) {
+                digits[i] = static_cast<uint64_t>(d);
+                min = std::min(min, d);
+                max = std::max(max, d);
+            } else {
+                exception_positions.push_back(i);
+                exception_values.push_back(_values[i]);
+            }
+        }
+        if (min > max) {
+            min = max = 0;
+        }
+        for (uint32_t pos : exception_positions) {
+            digits[pos] = static_cast<uint64_t>(min);
+        }
+        const uint8_t width = packed_integer::width_of(static_cast<uint64_t>(max) - min);
+        const size_t num_exceptions = exception_positions.size();
+        const size_t body_size = n * width + num_exceptions * (sizeof(uint32_t) + sizeof(CppType));
+        if (body_size >= n * sizeof(CppType)) {
+            return false;
+        }
+
+        _buf.clear();
+        _buf.resize(alp_page::kHeaderSize + body_size);
+        _write_header(n, exponent, width, num_exceptions, min);
+        uint8_t* p = _buf.data() + alp_page::kHeaderSize;
+        packed_integer::pack(digits.data(), n, static_cast<uint64_t>(min), width, p);
+        p += n * width;
+        memcpy(p, exception_positions.data(), num_exceptions * sizeof(uint32_t));
+        p += num_exceptions * sizeof(uint32_t);
+        memcpy(p, exception_values.data(), num_exceptions * sizeof(CppType));
+        return true;
+    }
+
+    void _write_header(size_t n, uint8_t exponent, uint8_t width, size_t num_exceptions, int64_t base) {
+        uint8_t* p = _buf.data();
+        encode_fixed32_le(p, static_cast<uint32_t>(n));
+        p[4] = exponent;
+        p[5] = width;
+        encode_fixed32_le(p + 6, static_cast<uint32_t>(num_exceptions));
+        encode_fixed64_le(p + 10, static_cast<uint64_t>(base));
+    }
+
+    const size_t _max_count;
+    bool _finished = false;
+    std::vector<CppType> _values;
+    faststring _buf;
+};
+
+template <FieldType Type>
+class AlpPageDecoder final : public PageDecoder {
+    using CppType = typename TypeTraits<Type>::CppType;
+
+public:
+    AlpPageDecoder(Slice data, const PageDecoderOptions& options) : _data(data) {}
+
+    ~AlpPageDecoder() override = default;
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < alp_page::kHeaderSize) {
+            return Status::Corruption("ALP page is too small");
+        }
+        const auto* p = reinterpret_cast<const uint8_t*>(_data.data);
+        const size_t n = decode_fixed32_le(p);
+        const uint8_t exponent = p[4];
+        const uint8_t width = p[5];
+        const size_t num_exceptions = decode_fixed32_le(p + 6);
+        const auto base = static_cast<int64_t>(decode_fixed64_le(p + 10));
+        p += alp_page::kHeaderSize;
+
+        _values.resize(n);
+        if (exponent == alp_page::kRawExponent) {
+            if (_data.size != alp_page::kHeaderSize + n * sizeof(CppType)) {
+                return Status::Corruption("bad ALP page size");
+            }
+            memcpy(_values.data(), p, n * sizeof(CppType));
+            _parsed = true;
+            return Status::OK();
+        }
+        if (exponent > alp_page::AlpTraits<CppType>::kMaxExponent || !packed_integer::is_valid_width(width) ||
+            num_exceptions > n ||
+            _data.size != alp_page::kHeaderSize + n * width + num_exceptions * (sizeof(uint32_t) + sizeof(CppType))) {
+            return Status::Corruption("bad ALP page header");
+        }
+
+        std::vector<uint64_t> digits(n);
+        packed_integer::unpack(p, n, static_cast<uint64_t>(base), width, digits.data());
+        p += n * width;
+        CppType* values = _values.data();
+        const CppType factor = alp_page::AlpTraits<CppType>::kPow10[exponent];
+        for (size_t i = 0; i < n; i++) {
+            values[i] = static_cast<CppType>(static_cast<int64_t>(digits[i])) / factor;
+        }
+
+        const uint8_t* exception_values = p + num_exceptions * sizeof(uint32_t);
+        for (size_t i = 0; i < num_exceptions; i++) {
+            uint32_t pos;
+            memcpy(&pos, p + i * sizeof(uint32_t), sizeof(uint32_t));
+            if (pos >= n) {
+                return Status::Corruption("bad ALP exception position");
+            }
+            memcpy(&values[pos], exception_values + i * sizeof(CppType), sizeof(CppType));
+        }
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        DCHECK_LE(pos, _values.size()) << "Tried to seek to " << pos << " which is > number of elements ("
+                                       << _values.size() << ") in the block!";
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, ColumnBlockView* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (PREDICT_FALSE(*n == 0 || _cur_index >= _values.size())) {
+            *n = 0;
+            return Status::OK();
+        }
+        size_t to_fetch = std::min(*n, _values.size() - _cur_index);
+        memcpy(dst->data(), _values.data() + _cur_index, to_fetch * sizeof(CppType));
+        _cur_index += to_fetch;
+        *n = to_fetch;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::Column* dst) override {
+        vectorized::SparseRange read_range;
+        size_t begin = current_index();
+        read_range.add(vectorized::Range(begin, begin + *n));
+        RETURN_IF_ERROR(next_batch(read_range, dst));
+        *n = current_index() - begin;
+        return Status::OK();
+    }
+
+    Status next_batch(const vectorized::SparseRange& range, vectorized::Column* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (PREDICT_FALSE(range.span_size() == 0 || _cur_index >= _values.size())) {
+            return Status::OK();
+        }
+        size_t to_read = std::min(static_cast<size_t>(range.span_size()), _values.size() - _cur_index);
+        vectorized::SparseRangeIterator iter = range.new_iterator();
+        while (to_read > 0) {
+            _cur_index = iter.begin();
+            vectorized::Range r = iter.next(to_read);
+            size_t n = dst->append_numbers(_values.data() + _cur_index, r.span_size() * sizeof(CppType));
+            DCHECK_EQ(r.span_size(), n);
+            _cur_index += r.span_size();
+            to_read -= r.span_size();
+        }
+        return Status::OK();
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    size_t current_index() const override { return _cur_index; }
+
+    EncodingTypePB encoding_type() const override { return ALP_ENCODING; }
+
+private:
+    Slice _data;
+    bool _parsed = false;
+    size_t _cur_index = 0;
+    std::vector<CppType> _values;
+};
+
+} // namespace starrocks
@@ -20,7 +20,10 @@ Status ArrayColumnIterator::init(const ColumnIteratorOptions& opts) {
         RETURN_IF_ERROR(_null_iterator->init(opts));
     }
     RETURN_IF_ERROR(_array_size_iterator->init(opts));
-    RETURN_IF_ERROR(_element_iterator->init(opts));
+    // The ordinals of elements are not the row ordinals.
+    ColumnIteratorOptions element_opts = opts;
+    element_opts.read_ahead_range = nullptr;
+    RETURN_IF_ERROR(_element_iterator->init(element_opts));
 
     const TypeInfoPtr& null_type = get_type_info(FieldType::OLAP_FIELD_TYPE_TINYINT);
     RETURN_IF_ERROR(ColumnVectorBatch::create(opts.chunk_size, true, null_type, nullptr, &_null_batch));
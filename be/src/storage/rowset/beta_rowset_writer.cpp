@@ -21,6 +21,7 @@
 
 #include "storage/rowset/beta_rowset_writer.h"
 
+#include <butil/iobuf.h>
 #include <fmt/format.h>
 
 #include <ctime>
@@ -31,11 +32,13 @@
 #include "common/logging.h"
 #include "common/tracer.h"
 #include "fs/fs.h"
+#include "gen_cpp/internal_service.pb.h"
 #include "runtime/exec_env.h"
 #include "segment_options.h"
 #include "serde/column_array_serde.h"
 #include "storage/aggregate_iterator.h"
 #include "storage/chunk_helper.h"
+#include "storage/group_commit_syncer.h"
 #include "storage/merge_iterator.h"
 #include "storage/metadata_util.h"
 #include "storage/olap_define.h"
@@ -86,6 +89,8 @@ Status BetaRowsetWriter::init() {
 
     _writer_options.global_dicts = _context.global_dicts != nullptr ? _context.global_dicts : nullptr;
     _writer_options.referenced_column_ids = _context.referenced_column_ids;
+    _writer_options.string_encodings = _context.string_encodings;
+    _writer_options.start_writeback_on_close = _context.file_syncer != nullptr;
 
     if (_context.tablet_schema->keys_type() == KeysType::PRIMARY_KEYS && _context.partial_update_tablet_schema) {
         _rowset_txn_meta_pb = std::make_unique<RowsetTxnMetaPB>();
@@ -95,10 +100,37 @@ Status BetaRowsetWriter::init() {
     return Status::OK();
 }
 
-StatusOr<RowsetSharedPtr> BetaRowsetWriter::build() {
+StatusOr<std::unique_ptr<WritableFile>> BetaRowsetWriter::_new_rowset_file(const std::string& path) {
+    if (_context.file_syncer != nullptr) {
+        WritableFileOptions opts{.sync_on_close = false, .mode = FileSystem::MUST_CREATE};
+        return _fs->new_writable_file(opts, path);
+    }
+    return _fs->new_writable_file(path);
+}
+
+Status BetaRowsetWriter::_close_rowset_file(WritableFile* wfile) {
+    if (_context.file_syncer != nullptr) {
+        RETURN_IF_ERROR(wfile->flush(WritableFile::FLUSH_ASYNC));
+    }
+    return wfile->close();
+}
+
+Status BetaRowsetWriter::_sync_rowset_files() {
+    if (_context.file_syncer != nullptr) {
+        // The files were closed without sync, one round of the syncer covers both them and the directory.
+        if (_num_rows_written > 0 || _num_delfile > 0 || _num_segment > 0) {
+            return _context.file_syncer->sync();
+        }
+        return Status::OK();
+    }
     if (_num_rows_written > 0) {
-        RETURN_IF_ERROR(_fs->sync_dir(_context.rowset_path_prefix));
+        return _fs->sync_dir(_context.rowset_path_prefix);
     }
+    return Status::OK();
+}
+
+StatusOr<RowsetSharedPtr> BetaRowsetWriter::build() {
+    RETURN_IF_ERROR(_sync_rowset_files());
     _rowset_meta->set_num_rows(_num_rows_written);
     _rowset_meta->set_total_row_size(_total_row_size);
     _rowset_meta->set_total_disk_size(_total_data_size);
@@ -143,6 +175,73 @@ StatusOr<RowsetSharedPtr> BetaRowsetWriter::build() {
     return rowset;
 }
 
+Status BetaRowsetWriter::flush_segment(const SegmentPB& segment, const butil::IOBuf& data) {
+    std::lock_guard<std::mutex> l(_lock);
+    int next_id = segment.delete_file() ? _num_delfile : _num_segment;
+    if (segment.segment_id() != next_id) {
+        return Status::InternalError(fmt::format("unexpected segment id: {}, expected: {}, delete file: {}",
+                                                 segment.segment_id(), next_id, segment.delete_file()));
+    }
+    if (static_cast<size_t>(segment.data_size()) != data.size()) {
+        return Status::Corruption(
+                fmt::format("segment size mismatch. expected: {}, actual: {}", segment.data_size(), data.size()));
+    }
+    auto path = segment.delete_file()
+                        ? Rowset::segment_del_file_path(_context.rowset_path_prefix, _context.rowset_id, next_id)
+                        : Rowset::segment_file_path(_context.rowset_path_prefix, _context.rowset_id, next_id);
+    ASSIGN_OR_RETURN(auto wfile, _new_rowset_file(path));
+    for (size_t i = 0; i < data.backing_block_num(); i++) {
+        auto piece = data.backing_block(i);
+        RETURN_IF_ERROR(wfile->append(Slice(piece.data(), piece.size())));
+    }
+    RETURN_IF_ERROR(_close_rowset_file(wfile.get()));
+    if (segment.delete_file()) {
+        ++_num_delfile;
+    } else {
+        ++_num_segment;
+    }
+    return Status::OK();
+}
+
+StatusOr<RowsetSharedPtr> BetaRowsetWriter::build_replica(const RowsetMetaPB& primary_meta) {
+    if (_num_segment != primary_meta.num_segments() ||
+        _num_delfile != static_cast<int64_t>(primary_meta.num_delete_files())) {
+        return Status::InternalError(fmt::format(
+                "incomplete replicated rowset. segments: {}/{}, delete files: {}/{}", _num_segment,
+                primary_meta.num_segments(), _num_delfile, primary_meta.num_delete_files()));
+    }
+    if (_num_segment > 0 || _num_delfile > 0) {
+        if (_context.file_syncer != nullptr) {
+            RETURN_IF_ERROR(_context.file_syncer->sync());
+        } else {
+            RETURN_IF_ERROR(_fs->sync_dir(_context.rowset_path_prefix));
+        }
+    }
+    // The statistics, the segments overlap and the txn meta are the same as the primary replica, but the
+    // files are named by the rowset id of this replica.
+    auto rowset_meta = std::make_shared<RowsetMeta>();
+    if (!rowset_meta->init_from_pb(primary_meta)) {
+        return Status::Corruption("invalid rowset meta of the primary replica");
+    }
+    rowset_meta->set_rowset_id(_context.rowset_id);
+    rowset_meta->set_partition_id(_context.partition_id);
+    rowset_meta->set_tablet_id(_context.tablet_id);
+    rowset_meta->set_tablet_schema_hash(_context.tablet_schema_hash);
+    rowset_meta->set_tablet_uid(_context.tablet_uid);
+    rowset_meta->set_txn_id(_context.txn_id);
+    rowset_meta->set_load_id(_context.load_id);
+    rowset_meta->set_creation_time(time(nullptr));
+    rowset_meta->set_rowset_seg_id(0);
+    rowset_meta->set_rowset_state(_is_pending ? COMMITTED : VISIBLE);
+    _rowset_meta = std::move(rowset_meta);
+
+    RowsetSharedPtr rowset;
+    RETURN_IF_ERROR(
+            RowsetFactory::create_rowset(_context.tablet_schema, _context.rowset_path_prefix, _rowset_meta, &rowset));
+    _already_built = true;
+    return rowset;
+}
+
 HorizontalBetaRowsetWriter::HorizontalBetaRowsetWriter(const RowsetWriterContext& context)
         : BetaRowsetWriter(context), _segment_writer(nullptr) {}
 
@@ -220,7 +319,7 @@ StatusOr<std::unique_ptr<SegmentWriter>> HorizontalBetaRowsetWriter::_create_seg
         // temporary segment files.
         path = Rowset::segment_file_path(_context.rowset_path_prefix, _context.rowset_id, _num_segment);
     }
-    ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(path));
+    ASSIGN_OR_RETURN(auto wfile, _new_rowset_file(path));
     const auto* schema = _rowset_schema != nullptr ? _rowset_schema.get() : _context.tablet_schema;
     auto segment_writer = std::make_unique<SegmentWriter>(std::move(wfile), _num_segment, schema, _writer_options);
     RETURN_IF_ERROR(segment_writer->init());
@@ -284,15 +383,15 @@ Status HorizontalBetaRowsetWriter::_flush_chunk(const vectorized::Chunk& chunk)
 Status HorizontalBetaRowsetWriter::flush_chunk_with_deletes(const vectorized::Chunk& upserts,
                                                             const vectorized::Column& deletes) {
     auto flush_del_file = [&](const vectorized::Column& deletes) {
-        ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(Rowset::segment_del_file_path(
-                                             _context.rowset_path_prefix, _context.rowset_id, _num_delfile)));
+        ASSIGN_OR_RETURN(auto wfile, _new_rowset_file(Rowset::segment_del_file_path(_context.rowset_path_prefix,
+                                                                                    _context.rowset_id, _num_delfile)));
         size_t sz = serde::ColumnArraySerde::max_serialized_size(deletes);
         std::vector<uint8_t> content(sz);
         if (serde::ColumnArraySerde::serialize(deletes, content.data()) == nullptr) {
             return Status::InternalError("deletes column serialize failed");
         }
         RETURN_IF_ERROR(wfile->append(Slice(content.data(), content.size())));
-        RETURN_IF_ERROR(wfile->close());
+        RETURN_IF_ERROR(_close_rowset_file(wfile.get()));
         _num_delfile++;
         _num_rows_del += deletes.size();
         return Status::OK();
@@ -334,7 +433,8 @@ Status HorizontalBetaRowsetWriter::flush_chunk_with_deletes(const vectorized::Ch
 }
 
 Status HorizontalBetaRowsetWriter::add_rowset(RowsetSharedPtr rowset) {
-    RETURN_IF_ERROR(rowset->link_files_to(_context.rowset_path_prefix, _context.rowset_id));
+    // Appended after the segments written or added before.
+    RETURN_IF_ERROR(rowset->link_files_to(_context.rowset_path_prefix, _context.rowset_id, _num_segment));
     _num_rows_written += rowset->num_rows();
     _total_row_size += static_cast<int64_t>(rowset->total_row_size());
     _total_data_size += static_cast<int64_t>(rowset->rowset_meta()->data_disk_size());
@@ -873,8 +973,8 @@ Status VerticalBetaRowsetWriter::final_flush() {
 StatusOr<std::unique_ptr<SegmentWriter>> VerticalBetaRowsetWriter::_create_segment_writer(
         const std::vector<uint32_t>& column_indexes, bool is_key) {
     std::lock_guard<std::mutex> l(_lock);
-    ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(Rowset::segment_file_path(_context.rowset_path_prefix,
-                                                                                  _context.rowset_id, _num_segment)));
+    ASSIGN_OR_RETURN(auto wfile, _new_rowset_file(Rowset::segment_file_path(_context.rowset_path_prefix,
+                                                                            _context.rowset_id, _num_segment)));
     const auto* schema = _rowset_schema != nullptr ? _rowset_schema.get() : _context.tablet_schema;
     auto segment_writer = std::make_unique<SegmentWriter>(std::move(wfile), _num_segment, schema, _writer_options);
     RETURN_IF_ERROR(segment_writer->init(column_indexes, is_key));
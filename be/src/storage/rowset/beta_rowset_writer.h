@@ -47,6 +47,10 @@ public:
 
     StatusOr<RowsetSharedPtr> build() override;
 
+    Status flush_segment(const SegmentPB& segment, const butil::IOBuf& data) override;
+
+    StatusOr<RowsetSharedPtr> build_replica(const RowsetMetaPB& primary_meta) override;
+
     Version version() override { return _context.version; }
     int64_t num_rows() override { return _num_rows_written; }
     int64_t total_data_size() override { return _total_data_size; }
@@ -57,6 +61,13 @@ public:
     }
 
 protected:
+    // Create a segment or delete file of the rowset, which is not synced on close if there's a file syncer.
+    StatusOr<std::unique_ptr<WritableFile>> _new_rowset_file(const std::string& path);
+    // Close a file created by `_new_rowset_file()` and not owned by a SegmentWriter.
+    Status _close_rowset_file(WritableFile* wfile);
+    // Make the files of the rowset and their directory entries durable before the rowset is built.
+    Status _sync_rowset_files();
+
     RowsetWriterContext _context;
     std::shared_ptr<FileSystem> _fs;
     std::shared_ptr<RowsetMeta> _rowset_meta;
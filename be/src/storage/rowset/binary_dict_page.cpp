@@ -21,6 +21,7 @@
 
 #include "storage/rowset/binary_dict_page.h"
 
+#include <limits>
 #include <memory>
 #include <type_traits>
 
@@ -87,6 +88,11 @@ size_t BinaryDictPageBuilder::add(const uint8_t* vals, size_t count) {
             if (code_page->add_one(reinterpret_cast<const uint8_t*>(&value_code)) < 1) {
                 return i;
             }
+            _page_min_code = std::min(_page_min_code, value_code);
+            _page_max_code = std::max(_page_max_code, value_code);
+            if (value_code < kMaxBitmapDictCodes) {
+                _page_code_bitmap[value_code >> 3] |= static_cast<char>(1 << (value_code & 7));
+            }
         }
         return count;
     } else {
@@ -113,6 +119,9 @@ void BinaryDictPageBuilder::reset() {
     } else {
         _data_page_builder->reset();
     }
+    _page_min_code = std::numeric_limits<uint32_t>::max();
+    _page_max_code = 0;
+    _page_code_bitmap.assign(kMaxBitmapDictCodes / 8, 0);
     _finished = false;
 }
 
@@ -154,6 +163,20 @@ Status BinaryDictPageBuilder::get_last_value(void* value) const {
     return Status::OK();
 }
 
+bool BinaryDictPageBuilder::get_dict_codes(uint32_t* min_code, uint32_t* max_code, std::string* code_bitmap) const {
+    if (_encoding_type != DICT_ENCODING || _data_page_builder->count() == 0) {
+        return false;
+    }
+    *min_code = _page_min_code;
+    *max_code = _page_max_code;
+    if (_page_max_code < kMaxBitmapDictCodes) {
+        code_bitmap->assign(_page_code_bitmap, 0, _page_max_code / 8 + 1);
+    } else {
+        code_bitmap->clear();
+    }
+    return true;
+}
+
 bool BinaryDictPageBuilder::is_valid_global_dict(const vectorized::GlobalDictMap* global_dict) const {
     for (auto it = _dictionary.begin(); it != _dictionary.end(); ++it) {
         if (auto iter = global_dict->find(it->first); iter == global_dict->end()) {
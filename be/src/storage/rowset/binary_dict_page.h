@@ -79,6 +79,11 @@ public:
     // write, i.e, after `finish` has been called.
     bool all_dict_encoded() const override { return _encoding_type == DICT_ENCODING; }
 
+    bool get_dict_codes(uint32_t* min_code, uint32_t* max_code, std::string* code_bitmap) const override;
+
+    // The bitmap of the dictionary codes of a data page is kept only if its codes are less than this.
+    static constexpr uint32_t kMaxBitmapDictCodes = 1024;
+
 private:
     struct HashOfSlice {
         // Enable heterogeneous lookup.
@@ -109,6 +114,10 @@ private:
     // TODO(zc): rethink about this mem pool
     MemPool _pool;
     faststring _first_value;
+    // the dictionary codes of the current data page
+    uint32_t _page_min_code = 0;
+    uint32_t _page_max_code = 0;
+    std::string _page_code_bitmap;
 };
 
 template <FieldType Type>
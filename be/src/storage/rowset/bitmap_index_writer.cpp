@@ -32,6 +32,7 @@
 #include "storage/rowset/common.h"
 #include "storage/rowset/encoding_info.h"
 #include "storage/rowset/indexed_column_writer.h"
+#include "storage/rowset/inverted_index_tokenizer.h"
 #include "storage/type_traits.h"
 #include "storage/types.h"
 #include "util/faststring.h"
@@ -139,20 +140,7 @@ public:
     void add_values(const void* values, size_t count) override {
         auto p = reinterpret_cast<const CppType*>(values);
         for (size_t i = 0; i < count; ++i) {
-            const CppType& value = unaligned_load<CppType>(p);
-            auto it = _mem_index.find(value);
-            if (it != _mem_index.end()) {
-                it->second->roaring()->add(_rid);
-                if (it->second->update_estimate_size(&_reverted_index_size)) {
-                    _late_update_context_vector.push_back(it->second.get());
-                }
-            } else {
-                // new value, copy value and insert new key->bitmap pair
-                CppType new_value;
-                _typeinfo->deep_copy(&new_value, &value, &_pool);
-                _mem_index.emplace(new_value, std::make_unique<BitmapUpdateContext>(_rid));
-                BitmapUpdateContext::init_estimate_size(&_reverted_index_size);
-            }
+            _add_value(unaligned_load<CppType>(p));
             _rid++;
             p++;
         }
@@ -165,8 +153,46 @@ public:
 
     Status finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta) override {
         index_meta->set_type(BITMAP_INDEX);
-        BitmapIndexPB* meta = index_meta->mutable_bitmap_index();
+        return _write(wfile, index_meta->mutable_bitmap_index());
+    }
 
+    uint64_t size() const override {
+        uint64_t size = 0;
+        size += _null_bitmap.getSizeInBytes(false);
+        for (BitmapUpdateContext* update_context : _late_update_context_vector) {
+            update_context->late_update_size(&_reverted_index_size);
+        }
+        _late_update_context_vector.clear();
+        size += _reverted_index_size;
+        size += _mem_index.size() * sizeof(CppType);
+        size += _pool.total_allocated_bytes();
+        return size;
+    }
+
+protected:
+    // Add the current row id to the bitmap of |value|, and return false if it's already added.
+    bool _add_value(const CppType& value) {
+        auto it = _mem_index.find(value);
+        if (it != _mem_index.end()) {
+            Roaring* roaring = it->second->roaring();
+            if (roaring->contains(_rid)) {
+                return false;
+            }
+            roaring->add(_rid);
+            if (it->second->update_estimate_size(&_reverted_index_size)) {
+                _late_update_context_vector.push_back(it->second.get());
+            }
+        } else {
+            // new value, copy value and insert new key->bitmap pair
+            CppType new_value;
+            _typeinfo->deep_copy(&new_value, &value, &_pool);
+            _mem_index.emplace(new_value, std::make_unique<BitmapUpdateContext>(_rid));
+            BitmapUpdateContext::init_estimate_size(&_reverted_index_size);
+        }
+        return true;
+    }
+
+    Status _write(WritableFile* wfile, BitmapIndexPB* meta) {
         meta->set_bitmap_type(BitmapIndexPB::ROARING_BITMAP);
         meta->set_has_null(!_null_bitmap.isEmpty());
 
@@ -229,20 +255,6 @@ public:
         return Status::OK();
     }
 
-    uint64_t size() const override {
-        uint64_t size = 0;
-        size += _null_bitmap.getSizeInBytes(false);
-        for (BitmapUpdateContext* update_context : _late_update_context_vector) {
-            update_context->late_update_size(&_reverted_index_size);
-        }
-        _late_update_context_vector.clear();
-        size += _reverted_index_size;
-        size += _mem_index.size() * sizeof(CppType);
-        size += _pool.total_allocated_bytes();
-        return size;
-    }
-
-private:
     TypeInfoPtr _typeinfo;
     rowid_t _rid = 0;
 
@@ -257,6 +269,29 @@ private:
     mutable vector<BitmapUpdateContext*> _late_update_context_vector;
 };
 
+// Builder for inverted index, which is a bitmap index of the tokens of the string values,
+// see inverted_index_tokenizer.h. The bitmap of a token has the rows containing the token.
+class InvertedIndexWriter final : public BitmapIndexWriterImpl<OLAP_FIELD_TYPE_VARCHAR> {
+public:
+    InvertedIndexWriter() : BitmapIndexWriterImpl(get_type_info(OLAP_FIELD_TYPE_VARCHAR)) {}
+
+    ~InvertedIndexWriter() override = default;
+
+    void add_values(const void* values, size_t count) override {
+        auto p = reinterpret_cast<const Slice*>(values);
+        for (size_t i = 0; i < count; ++i) {
+            inverted_index::for_each_token(unaligned_load<Slice>(p), [this](const Slice& token) { _add_value(token); });
+            _rid++;
+            p++;
+        }
+    }
+
+    Status finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta) override {
+        index_meta->set_type(INVERTED_INDEX);
+        return _write(wfile, index_meta->mutable_inverted_index());
+    }
+};
+
 } // namespace
 
 struct BitmapIndexWriterBuilder {
@@ -273,4 +308,12 @@ Status BitmapIndexWriter::create(const TypeInfoPtr& typeinfo, std::unique_ptr<Bi
     return Status::OK();
 }
 
+Status BitmapIndexWriter::create_inverted_index(const TypeInfoPtr& typeinfo, std::unique_ptr<BitmapIndexWriter>* res) {
+    if (typeinfo->type() != OLAP_FIELD_TYPE_CHAR && typeinfo->type() != OLAP_FIELD_TYPE_VARCHAR) {
+        return Status::NotSupported("inverted index only supports CHAR and VARCHAR");
+    }
+    *res = std::make_unique<InvertedIndexWriter>();
+    return Status::OK();
+}
+
 } // namespace starrocks
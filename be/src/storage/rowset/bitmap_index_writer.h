@@ -39,6 +39,10 @@ class BitmapIndexWriter {
 public:
     static Status create(const TypeInfoPtr& type_info, std::unique_ptr<BitmapIndexWriter>* res);
 
+    // Create the writer of the inverted index of a CHAR or VARCHAR column, which indexes the tokens
+    // of the values instead of the values.
+    static Status create_inverted_index(const TypeInfoPtr& type_info, std::unique_ptr<BitmapIndexWriter>* res);
+
     BitmapIndexWriter() = default;
     virtual ~BitmapIndexWriter() = default;
 
@@ -32,12 +32,19 @@ namespace starrocks {
 // Bloom filter is 32 bytes to take advantage of 32-byte SIMD instruction.
 class BlockSplitBloomFilter : public BloomFilter {
 public:
+    // Bytes in a tiny Bloom filter block.
+    static const uint32_t BYTES_PER_BLOCK = 32;
+
     void add_hash(uint64_t hash) override;
 
     bool test_hash(uint64_t hash) const override;
 
+    // Test |key| in the tiny Bloom filter |block|. The blocks and the salts are the same as the
+    // split block Bloom filter of Parquet, so it's used to test the Bloom filters of Parquet files.
+    static bool test_block(const uint32_t* block, uint32_t key);
+
 private:
-    void _set_masks(uint32_t key, uint32_t* masks) const {
+    static void _set_masks(uint32_t key, uint32_t* masks) {
         for (int i = 0; i < BITS_SET_PER_BLOCK; ++i) {
             // add some salt to key
             masks[i] = key * SALT[i];
@@ -49,9 +56,6 @@ private:
     }
 
 private:
-    // Bytes in a tiny Bloom filter block.
-    static const uint32_t BYTES_PER_BLOCK = 32;
-
     // The number of bits to set in a tiny Bloom filter block
     static const int BITS_SET_PER_BLOCK = 8;
 
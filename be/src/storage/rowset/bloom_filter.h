@@ -30,6 +30,7 @@
 #include "gutil/strings/substitute.h"
 #include "storage/utils.h"
 #include "util/murmur_hash3.h"
+#include "util/slice.h"
 
 namespace starrocks {
 
@@ -37,8 +38,19 @@ struct BloomFilterOptions {
     // false positive probablity
     double fpp = 0.05;
     HashStrategyPB strategy = HASH_MURMUR3_X64_64;
+    // If it's not 0, the n-grams of |gram_num| bytes of the string values are added
+    // instead of the values.
+    uint32_t gram_num = 0;
 };
 
+// Call |func| with each n-gram of |gram_num| bytes of |value|, nothing if |value| is shorter.
+template <typename Func>
+inline void for_each_ngram(const Slice& value, size_t gram_num, Func&& func) {
+    for (size_t i = 0; i + gram_num <= value.size; i++) {
+        func(Slice(value.data + i, gram_num));
+    }
+}
+
 // Base class for bloom filter
 // To support null value, the size of bloom filter is optimize bytes + 1.
 // The last byte is for null value flag.
@@ -104,6 +104,19 @@ public:
 
     void add_values(const void* values, size_t count) override {
         const CppType* v = (const CppType*)values;
+        if constexpr (is_slice_type<field_type>()) {
+            if (_bf_options.gram_num > 0) {
+                for (int i = 0; i < count; ++i) {
+                    for_each_ngram(unaligned_load<Slice>(v), _bf_options.gram_num, [&](const Slice& gram) {
+                        if (_values.find(gram) == _values.end()) {
+                            _values.insert(get_value<field_type>(&gram, _typeinfo, &_pool));
+                        }
+                    });
+                    ++v;
+                }
+                return;
+            }
+        }
         for (int i = 0; i < count; ++i) {
             if (_values.find(unaligned_load<CppType>(v)) == _values.end()) {
                 _values.insert(get_value<field_type>(v, _typeinfo, &_pool));
@@ -132,8 +145,15 @@ public:
         if (!_values.empty()) {
             RETURN_IF_ERROR(flush());
         }
-        index_meta->set_type(BLOOM_FILTER_INDEX);
-        BloomFilterIndexPB* meta = index_meta->mutable_bloom_filter_index();
+        BloomFilterIndexPB* meta;
+        if (_bf_options.gram_num > 0) {
+            index_meta->set_type(NGRAM_BLOOM_FILTER_INDEX);
+            meta = index_meta->mutable_ngram_bloom_filter_index();
+            meta->set_gram_num(_bf_options.gram_num);
+        } else {
+            index_meta->set_type(BLOOM_FILTER_INDEX);
+            meta = index_meta->mutable_bloom_filter_index();
+        }
         meta->set_hash_strategy(_bf_options.strategy);
         meta->set_algorithm(BLOCK_BLOOM_FILTER);
 
@@ -184,6 +204,10 @@ struct BloomFilterBuilderFunctor {
 // TODO currently we don't support bloom filter index for tinyint/hll/float/double
 Status BloomFilterIndexWriter::create(const BloomFilterOptions& bf_options, const TypeInfoPtr& typeinfo,
                                       std::unique_ptr<BloomFilterIndexWriter>* res) {
+    if (bf_options.gram_num > 0 && typeinfo->type() != OLAP_FIELD_TYPE_CHAR &&
+        typeinfo->type() != OLAP_FIELD_TYPE_VARCHAR) {
+        return Status::NotSupported("n-gram bloom filter index only supports CHAR and VARCHAR");
+    }
     return field_type_dispatch_bloomfilter(typeinfo->type(), BloomFilterBuilderFunctor(), res, bf_options, typeinfo);
 }
 
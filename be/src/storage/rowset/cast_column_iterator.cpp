@@ -0,0 +1,148 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/rowset/cast_column_iterator.h"
+
+#include <fmt/format.h>
+
+#include <type_traits>
+
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "gutil/casts.h"
+#include "storage/chunk_helper.h"
+#include "storage/range.h"
+#include "storage/rowset/column_reader.h"
+#include "storage/rowset/segment.h"
+
+namespace starrocks {
+
+// The rank of the integer types, a type is widened to the types of a higher rank.
+static int integer_rank(FieldType type) {
+    switch (type) {
+    case OLAP_FIELD_TYPE_TINYINT:
+        return 1;
+    case OLAP_FIELD_TYPE_SMALLINT:
+        return 2;
+    case OLAP_FIELD_TYPE_INT:
+        return 3;
+    case OLAP_FIELD_TYPE_BIGINT:
+        return 4;
+    case OLAP_FIELD_TYPE_LARGEINT:
+        return 5;
+    default:
+        return 0;
+    }
+}
+
+bool CastColumnIterator::is_widening(FieldType from, FieldType to) {
+    if (from == OLAP_FIELD_TYPE_FLOAT && to == OLAP_FIELD_TYPE_DOUBLE) {
+        return true;
+    }
+    int from_rank = integer_rank(from);
+    return from_rank > 0 && integer_rank(to) > from_rank;
+}
+
+CastColumnIterator::CastColumnIterator(std::unique_ptr<ColumnIterator> base, uint32_t num_rows, FieldType from,
+                                       FieldType to, bool is_nullable)
+        : _base(std::move(base)),
+          _num_rows(num_rows),
+          _from(from),
+          _to(to),
+          _buffer(ChunkHelper::column_from_field_type(from, is_nullable)) {}
+
+Status CastColumnIterator::wrap(const Segment& segment, uint32_t cid, ColumnIterator** iter) {
+    const ColumnReader* reader = segment.column(cid);
+    const TabletColumn& column = segment.tablet_schema().column(cid);
+    // The other type mismatches are the types of the format v1, which are converted by the segment.
+    if (reader == nullptr || !is_widening(reader->column_type(), column.type())) {
+        return Status::OK();
+    }
+    std::unique_ptr<ColumnIterator> base(*iter);
+    *iter = new CastColumnIterator(std::move(base), segment.num_rows(), reader->column_type(), column.type(),
+                                   column.is_nullable());
+    return Status::OK();
+}
+
+Status CastColumnIterator::next_batch(size_t* n, vectorized::Column* dst) {
+    RETURN_IF_ERROR(_base->next_batch(n, _buffer.get()));
+    return _widen_buffer(dst);
+}
+
+Status CastColumnIterator::next_batch(const vectorized::SparseRange& range, vectorized::Column* dst) {
+    RETURN_IF_ERROR(_base->next_batch(range, _buffer.get()));
+    return _widen_buffer(dst);
+}
+
+Status CastColumnIterator::get_row_ranges_by_zone_map(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                                      const vectorized::ColumnPredicate* del_predicate,
+                                                      vectorized::SparseRange* row_ranges) {
+    row_ranges->add(vectorized::Range(0, _num_rows));
+    return Status::OK();
+}
+
+Status CastColumnIterator::fetch_values_by_rowid(const rowid_t* rowids, size_t size, vectorized::Column* values) {
+    RETURN_IF_ERROR(_base->fetch_values_by_rowid(rowids, size, _buffer.get()));
+    return _widen_buffer(values);
+}
+
+template <typename From>
+static Status widen_from(const vectorized::Column& src, FieldType to, vectorized::Column* dst) {
+    const auto& values = down_cast<const vectorized::FixedLengthColumn<From>&>(src).get_data();
+    auto append = [&](auto* column) {
+        auto& data = column->get_data();
+        size_t offset = data.size();
+        data.resize(offset + values.size());
+        for (size_t i = 0; i < values.size(); i++) {
+            data[offset + i] = static_cast<std::remove_reference_t<decltype(data[0])>>(values[i]);
+        }
+        return Status::OK();
+    };
+    switch (to) {
+    case OLAP_FIELD_TYPE_SMALLINT:
+        return append(down_cast<vectorized::Int16Column*>(dst));
+    case OLAP_FIELD_TYPE_INT:
+        return append(down_cast<vectorized::Int32Column*>(dst));
+    case OLAP_FIELD_TYPE_BIGINT:
+        return append(down_cast<vectorized::Int64Column*>(dst));
+    case OLAP_FIELD_TYPE_LARGEINT:
+        return append(down_cast<vectorized::Int128Column*>(dst));
+    case OLAP_FIELD_TYPE_DOUBLE:
+        return append(down_cast<vectorized::DoubleColumn*>(dst));
+    default:
+        return Status::NotSupported(fmt::format("cannot widen values to type {}", field_type_to_string(to)));
+    }
+}
+
+static Status widen(const vectorized::Column& src, FieldType from, FieldType to, vectorized::Column* dst) {
+    switch (from) {
+    case OLAP_FIELD_TYPE_TINYINT:
+        return widen_from<int8_t>(src, to, dst);
+    case OLAP_FIELD_TYPE_SMALLINT:
+        return widen_from<int16_t>(src, to, dst);
+    case OLAP_FIELD_TYPE_INT:
+        return widen_from<int32_t>(src, to, dst);
+    case OLAP_FIELD_TYPE_BIGINT:
+        return widen_from<int64_t>(src, to, dst);
+    case OLAP_FIELD_TYPE_FLOAT:
+        return widen_from<float>(src, to, dst);
+    default:
+        return Status::NotSupported(fmt::format("cannot widen values of type {}", field_type_to_string(from)));
+    }
+}
+
+Status CastColumnIterator::_widen_buffer(vectorized::Column* dst) {
+    Status st;
+    if (_buffer->is_nullable()) {
+        auto* nullable_dst = down_cast<vectorized::NullableColumn*>(dst);
+        auto* nullable_src = down_cast<vectorized::NullableColumn*>(_buffer.get());
+        nullable_dst->mutable_null_column()->append(*nullable_src->null_column());
+        nullable_dst->set_has_null(nullable_src->has_null());
+        st = widen(*nullable_src->data_column(), _from, _to, nullable_dst->mutable_data_column());
+    } else {
+        st = widen(*_buffer, _from, _to, dst);
+    }
+    _buffer->reset_column();
+    return st;
+}
+
+} // namespace starrocks
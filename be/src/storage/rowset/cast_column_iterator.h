@@ -0,0 +1,69 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <memory>
+
+#include "column/column.h"
+#include "storage/olap_common.h"
+#include "storage/rowset/column_iterator.h"
+
+namespace starrocks {
+
+class Segment;
+
+// CastColumnIterator reads a column whose values are stored as a narrower type than the type in the
+// tablet schema, e.g. an INT column widened to BIGINT by a linked schema change, and widens the values.
+//
+// The zone maps and the bloom filters of the segment are of the stored type, so they are not exposed,
+// i.e. no page is pruned.
+class CastColumnIterator final : public ColumnIterator {
+public:
+    // Whether the values stored as |from| can be read as |to| by a CastColumnIterator.
+    static bool is_widening(FieldType from, FieldType to);
+
+    CastColumnIterator(std::unique_ptr<ColumnIterator> base, uint32_t num_rows, FieldType from, FieldType to,
+                       bool is_nullable);
+
+    ~CastColumnIterator() override = default;
+
+    // Replace |*iter|, a new iterator of the column |cid| of |segment|, by a CastColumnIterator owning it
+    // if the column is stored as a narrower type than the tablet schema of |segment|. |*iter| is not
+    // initialized yet.
+    static Status wrap(const Segment& segment, uint32_t cid, ColumnIterator** iter);
+
+    Status init(const ColumnIteratorOptions& opts) override { return _base->init(opts); }
+
+    Status seek_to_first() override { return _base->seek_to_first(); }
+
+    Status seek_to_ordinal(ordinal_t ord) override { return _base->seek_to_ordinal(ord); }
+
+    Status next_batch(size_t* n, ColumnBlockView* dst, bool* has_null) override {
+        return Status::NotSupported("CastColumnIterator does not support ColumnBlockView");
+    }
+
+    Status next_batch(size_t* n, vectorized::Column* dst) override;
+
+    Status next_batch(const vectorized::SparseRange& range, vectorized::Column* dst) override;
+
+    ordinal_t get_current_ordinal() const override { return _base->get_current_ordinal(); }
+
+    Status get_row_ranges_by_zone_map(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                      const vectorized::ColumnPredicate* del_predicate,
+                                      vectorized::SparseRange* row_ranges) override;
+
+    Status fetch_values_by_rowid(const rowid_t* rowids, size_t size, vectorized::Column* values) override;
+
+private:
+    // Append the values in |_buffer| to |dst| and clear |_buffer|.
+    Status _widen_buffer(vectorized::Column* dst);
+
+    std::unique_ptr<ColumnIterator> _base;
+    uint32_t _num_rows;
+    FieldType _from;
+    FieldType _to;
+    // The values read by |_base|.
+    vectorized::ColumnPtr _buffer;
+};
+
+} // namespace starrocks
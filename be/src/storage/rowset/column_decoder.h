@@ -7,6 +7,7 @@
 #include "column/binary_column.h"
 #include "column/vectorized_fwd.h"
 #include "runtime/global_dict/types.h"
+#include "storage/range.h"
 #include "storage/rowset/column_iterator.h"
 
 namespace starrocks {
@@ -28,6 +29,16 @@ public:
         return _iter->fetch_values_by_rowid(rowids, values);
     }
 
+    // Read the values of the rows in |range|, the pages without any row in |range| are skipped.
+    Status decode_values_by_range(const vectorized::SparseRange& range, vectorized::Column* values) {
+        DCHECK(_iter != nullptr);
+        if (range.empty()) {
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(_iter->seek_to_ordinal(range.begin()));
+        return _iter->next_batch(range, values);
+    }
+
     void set_all_page_dict_encoded(bool all_page_dict_encoded) { _all_page_dict_encoded = all_page_dict_encoded; }
     void set_global_dict(vectorized::GlobalDictMap* global_dict) { _global_dict = global_dict; }
     // check global dict is superset of local dict
@@ -44,6 +44,8 @@ struct ColumnIteratorOptions {
     // reader statistics
     OlapReaderStatistics* stats = nullptr;
     bool use_page_cache = false;
+    // Access the page cache in CacheAccessMode::SEQUENTIAL.
+    bool sequential_scan = false;
 
     // check whether column pages are all dictionary encoding.
     bool check_dict_encoding = false;
@@ -59,6 +61,10 @@ struct ColumnIteratorOptions {
 
     ReaderType reader_type = READER_QUERY;
     int chunk_size = DEFAULT_CHUNK_SIZE;
+
+    // The row ordinals to be read, the pages without any of them are not read ahead.
+    // nullptr means all the rows are to be read. It must outlive the iterator.
+    const vectorized::SparseRange* read_ahead_range = nullptr;
 };
 
 // Base iterator to read one column data
@@ -109,6 +115,18 @@ public:
         return Status::OK();
     }
 
+    virtual Status get_row_ranges_by_ngram_bloom_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                                        vectorized::SparseRange* row_ranges) {
+        return Status::OK();
+    }
+
+    // Narrow |row_ranges| by the zone maps of the dictionary codes, |predicates| are the predicates
+    // rewritten to the dictionary codes.
+    virtual Status get_row_ranges_by_dict_code_zone_map(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                                        vectorized::SparseRange* row_ranges) {
+        return Status::OK();
+    }
+
     // return true iff all data pages of this column are encoded as dictionary encoding.
     // NOTE: the ColumnIterator must have been initialized with `check_dict_encoding`,
     // otherwise this method will always return false.
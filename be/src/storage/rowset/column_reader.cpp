@@ -99,6 +99,30 @@ ColumnReader::~ColumnReader() {
         size += _bloom_filter_index->mem_usage();
         _bloom_filter_index.reset(nullptr);
     }
+    if (_dict_code_zone_map_index_meta != nullptr) {
+        size += _dict_code_zone_map_index_meta->SpaceUsedLong();
+        _dict_code_zone_map_index_meta.reset(nullptr);
+    }
+    if (_dict_code_zone_map_index != nullptr) {
+        size += _dict_code_zone_map_index->mem_usage();
+        _dict_code_zone_map_index.reset(nullptr);
+    }
+    if (_ngram_bloom_filter_index_meta != nullptr) {
+        size += _ngram_bloom_filter_index_meta->SpaceUsedLong();
+        _ngram_bloom_filter_index_meta.reset(nullptr);
+    }
+    if (_ngram_bloom_filter_index != nullptr) {
+        size += _ngram_bloom_filter_index->mem_usage();
+        _ngram_bloom_filter_index.reset(nullptr);
+    }
+    if (_inverted_index_meta != nullptr) {
+        size += _inverted_index_meta->SpaceUsedLong();
+        _inverted_index_meta.reset(nullptr);
+    }
+    if (_inverted_index != nullptr) {
+        size += _inverted_index->mem_usage();
+        _inverted_index.reset(nullptr);
+    }
     mem_tracker()->release(size);
 }
 
@@ -149,6 +173,25 @@ Status ColumnReader::_init(ColumnMetaPB* meta) {
                 mem_tracker()->consume(_bloom_filter_index_meta->SpaceUsedLong());
                 mem_tracker()->consume(_bloom_filter_index->mem_usage());
                 break;
+            case DICT_CODE_ZONE_MAP_INDEX:
+                _dict_code_zone_map_index_meta.reset(index_meta->release_dict_code_zone_map_index());
+                _dict_code_zone_map_index = std::make_unique<ZoneMapIndexReader>();
+                mem_tracker()->consume(_dict_code_zone_map_index_meta->SpaceUsedLong());
+                mem_tracker()->consume(_dict_code_zone_map_index->mem_usage());
+                break;
+            case NGRAM_BLOOM_FILTER_INDEX:
+                _ngram_bloom_filter_index_meta.reset(index_meta->release_ngram_bloom_filter_index());
+                _ngram_bloom_filter_index = std::make_unique<BloomFilterIndexReader>();
+                _ngram_bloom_filter_gram_num = _ngram_bloom_filter_index_meta->gram_num();
+                mem_tracker()->consume(_ngram_bloom_filter_index_meta->SpaceUsedLong());
+                mem_tracker()->consume(_ngram_bloom_filter_index->mem_usage());
+                break;
+            case INVERTED_INDEX:
+                _inverted_index_meta.reset(index_meta->release_inverted_index());
+                _inverted_index = std::make_unique<BitmapIndexReader>();
+                mem_tracker()->consume(_inverted_index_meta->SpaceUsedLong());
+                mem_tracker()->consume(_inverted_index->mem_usage());
+                break;
             case UNKNOWN_INDEX_TYPE:
                 return Status::Corruption(fmt::format("Bad file {}: unknown index type", file_name()));
             }
@@ -208,20 +251,37 @@ Status ColumnReader::new_bitmap_index_iterator(BitmapIndexIterator** iterator) {
     return Status::OK();
 }
 
+Status ColumnReader::new_inverted_index_iterator(BitmapIndexIterator** iterator) {
+    RETURN_IF_ERROR(_load_inverted_index());
+    RETURN_IF_ERROR(_inverted_index->new_iterator(iterator));
+    return Status::OK();
+}
+
 Status ColumnReader::read_page(const ColumnIteratorOptions& iter_opts, const PagePointer& pp, PageHandle* handle,
                                Slice* page_body, PageFooterPB* footer) {
     iter_opts.sanity_check();
+    PageReadOptions opts = _page_read_options(iter_opts);
+    opts.page_pointer = pp;
+    return PageIO::read_and_decompress_page(opts, handle, page_body, footer);
+}
+
+Status ColumnReader::read_pages(const ColumnIteratorOptions& iter_opts, const std::vector<PagePointer>& pps,
+                                size_t max_gap, std::vector<PageIO::ReadPage>* pages) {
+    iter_opts.sanity_check();
+    return PageIO::read_and_decompress_pages(_page_read_options(iter_opts), pps, max_gap, pages);
+}
+
+PageReadOptions ColumnReader::_page_read_options(const ColumnIteratorOptions& iter_opts) const {
     PageReadOptions opts;
     opts.read_file = iter_opts.read_file;
-    opts.page_pointer = pp;
     opts.codec = _compress_codec;
     opts.stats = iter_opts.stats;
     opts.verify_checksum = true;
     opts.use_page_cache = iter_opts.use_page_cache;
     opts.encoding_type = _encoding_info->encoding();
     opts.kept_in_memory = keep_in_memory();
-
-    return PageIO::read_and_decompress_page(opts, handle, page_body, footer);
+    opts.sequential_scan = iter_opts.sequential_scan;
+    return opts;
 }
 
 Status ColumnReader::_calculate_row_ranges(const std::vector<uint32_t>& page_indexes,
@@ -234,15 +294,15 @@ Status ColumnReader::_calculate_row_ranges(const std::vector<uint32_t>& page_ind
     return Status::OK();
 }
 
-Status ColumnReader::_parse_zone_map(const ZoneMapPB& zm, vectorized::ZoneMapDetail* detail) const {
+Status ColumnReader::_parse_zone_map(const ZoneMapView& zm, vectorized::ZoneMapDetail* detail) const {
     // DECIMAL32/DECIMAL64/DECIMAL128 stored as INT32/INT64/INT128
     // The DECIMAL type will be delegated to INT type.
     TypeInfoPtr type_info = get_type_info(delegate_type(_column_type));
-    detail->set_has_null(zm.has_null());
+    detail->set_has_null(zm.has_null);
 
-    if (zm.has_not_null()) {
-        RETURN_IF_ERROR(vectorized::datum_from_string(type_info.get(), &(detail->min_value()), zm.min(), nullptr));
-        RETURN_IF_ERROR(vectorized::datum_from_string(type_info.get(), &(detail->max_value()), zm.max(), nullptr));
+    if (zm.has_not_null) {
+        RETURN_IF_ERROR(vectorized::datum_from_string(type_info.get(), &(detail->min_value()), zm.min, nullptr));
+        RETURN_IF_ERROR(vectorized::datum_from_string(type_info.get(), &(detail->max_value()), zm.max, nullptr));
     }
     detail->set_num_rows(static_cast<size_t>(num_rows()));
     return Status::OK();
@@ -255,20 +315,7 @@ Status ColumnReader::bloom_filter(const std::vector<const vectorized::ColumnPred
     vectorized::SparseRange bf_row_ranges;
     std::unique_ptr<BloomFilterIndexIterator> bf_iter;
     RETURN_IF_ERROR(_bloom_filter_index->new_iterator(&bf_iter));
-    size_t range_size = row_ranges->size();
-    // get covered page ids
-    std::set<int32_t> page_ids;
-    for (int i = 0; i < range_size; ++i) {
-        vectorized::Range r = (*row_ranges)[i];
-        int64_t idx = r.begin();
-        auto iter = _ordinal_index->seek_at_or_before(r.begin());
-        while (idx < r.end()) {
-            page_ids.insert(iter.page_index());
-            idx = static_cast<int>(iter.last_ordinal() + 1);
-            iter.next();
-        }
-    }
-    for (const auto& pid : page_ids) {
+    for (const auto& pid : _page_ids_of(*row_ranges)) {
         std::unique_ptr<BloomFilter> bf;
         RETURN_IF_ERROR(bf_iter->read_bloom_filter(pid, &bf));
         for (const auto* pred : predicates) {
@@ -282,6 +329,45 @@ Status ColumnReader::bloom_filter(const std::vector<const vectorized::ColumnPred
     return Status::OK();
 }
 
+// prerequisite: at least one predicate in |predicates| support n-gram bloom filter.
+Status ColumnReader::ngram_bloom_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                        vectorized::SparseRange* row_ranges) {
+    RETURN_IF_ERROR(_load_ngram_bloom_filter_index());
+    vectorized::SparseRange bf_row_ranges;
+    std::unique_ptr<BloomFilterIndexIterator> bf_iter;
+    RETURN_IF_ERROR(_ngram_bloom_filter_index->new_iterator(&bf_iter));
+    for (const auto& pid : _page_ids_of(*row_ranges)) {
+        std::unique_ptr<BloomFilter> bf;
+        RETURN_IF_ERROR(bf_iter->read_bloom_filter(pid, &bf));
+        auto filter = [&](const vectorized::ColumnPredicate* pred) {
+            return !pred->support_ngram_bloom_filter() ||
+                   pred->ngram_bloom_filter(bf.get(), _ngram_bloom_filter_gram_num);
+        };
+        if (std::all_of(predicates.begin(), predicates.end(), filter)) {
+            bf_row_ranges.add(vectorized::Range(_ordinal_index->get_first_ordinal(pid),
+                                                _ordinal_index->get_last_ordinal(pid) + 1));
+        }
+    }
+    *row_ranges = row_ranges->intersection(bf_row_ranges);
+    return Status::OK();
+}
+
+std::set<int32_t> ColumnReader::_page_ids_of(const vectorized::SparseRange& row_ranges) {
+    std::set<int32_t> page_ids;
+    size_t range_size = row_ranges.size();
+    for (int i = 0; i < range_size; ++i) {
+        vectorized::Range r = row_ranges[i];
+        int64_t idx = r.begin();
+        auto iter = _ordinal_index->seek_at_or_before(r.begin());
+        while (idx < r.end()) {
+            page_ids.insert(iter.page_index());
+            idx = static_cast<int>(iter.last_ordinal() + 1);
+            iter.next();
+        }
+    }
+    return page_ids;
+}
+
 Status ColumnReader::load_ordinal_index() {
     return _load_ordinal_index();
 }
@@ -321,6 +407,24 @@ Status ColumnReader::_load_zonemap_index() {
     return Status::OK();
 }
 
+Status ColumnReader::_load_dict_code_zone_map_index() {
+    if (_dict_code_zone_map_index == nullptr || _dict_code_zone_map_index->loaded()) return Status::OK();
+    SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
+    auto fs = file_system();
+    auto meta = _dict_code_zone_map_index_meta.get();
+    auto use_page_cache = !config::disable_storage_page_cache;
+    auto kept_in_memory = keep_in_memory();
+    int64_t unloaded_mem_usage = _dict_code_zone_map_index->mem_usage();
+    ASSIGN_OR_RETURN(auto first_load,
+                     _dict_code_zone_map_index->load(fs, file_name(), *meta, use_page_cache, kept_in_memory));
+    if (UNLIKELY(first_load)) {
+        mem_tracker()->consume(_dict_code_zone_map_index->mem_usage() - unloaded_mem_usage);
+        mem_tracker()->release(_dict_code_zone_map_index_meta->SpaceUsedLong());
+        _dict_code_zone_map_index_meta.reset();
+    }
+    return Status::OK();
+}
+
 Status ColumnReader::_load_bitmap_index() {
     if (_bitmap_index == nullptr || _bitmap_index->loaded()) return Status::OK();
     SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
@@ -356,6 +460,41 @@ Status ColumnReader::_load_bloom_filter_index() {
     return Status::OK();
 }
 
+Status ColumnReader::_load_ngram_bloom_filter_index() {
+    if (_ngram_bloom_filter_index == nullptr || _ngram_bloom_filter_index->loaded()) return Status::OK();
+    SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
+    auto fs = file_system();
+    auto meta = _ngram_bloom_filter_index_meta.get();
+    auto use_page_cache = !config::disable_storage_page_cache;
+    auto kept_in_memory = keep_in_memory();
+    int64_t unloaded_mem_usage = _ngram_bloom_filter_index->mem_usage();
+    ASSIGN_OR_RETURN(auto first_load,
+                     _ngram_bloom_filter_index->load(fs, file_name(), *meta, use_page_cache, kept_in_memory));
+    if (UNLIKELY(first_load)) {
+        mem_tracker()->consume(_ngram_bloom_filter_index->mem_usage() - unloaded_mem_usage);
+        mem_tracker()->release(_ngram_bloom_filter_index_meta->SpaceUsedLong());
+        _ngram_bloom_filter_index_meta.reset();
+    }
+    return Status::OK();
+}
+
+Status ColumnReader::_load_inverted_index() {
+    if (_inverted_index == nullptr || _inverted_index->loaded()) return Status::OK();
+    SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
+    auto fs = file_system();
+    auto meta = _inverted_index_meta.get();
+    auto use_page_cache = !config::disable_storage_page_cache;
+    auto kept_in_memory = keep_in_memory();
+    int64_t unloaded_mem_usage = _inverted_index->mem_usage();
+    ASSIGN_OR_RETURN(auto first_load, _inverted_index->load(fs, file_name(), *meta, use_page_cache, kept_in_memory));
+    if (UNLIKELY(first_load)) {
+        mem_tracker()->consume(_inverted_index->mem_usage() - unloaded_mem_usage);
+        mem_tracker()->release(_inverted_index_meta->SpaceUsedLong());
+        _inverted_index_meta.reset();
+    }
+    return Status::OK();
+}
+
 Status ColumnReader::seek_to_first(OrdinalPageIndexIterator* iter) {
     *iter = _ordinal_index->begin();
     if (!iter->valid()) {
@@ -387,12 +526,10 @@ Status ColumnReader::_zone_map_filter(const std::vector<const vectorized::Column
                                       const vectorized::ColumnPredicate* del_predicate,
                                       std::unordered_set<uint32_t>* del_partial_filtered_pages,
                                       std::vector<uint32_t>* pages) {
-    const std::vector<ZoneMapPB>& zone_maps = _zonemap_index->page_zone_maps();
     int32_t page_size = _zonemap_index->num_pages();
     for (int32_t i = 0; i < page_size; ++i) {
-        const ZoneMapPB& zm = zone_maps[i];
         vectorized::ZoneMapDetail detail;
-        _parse_zone_map(zm, &detail);
+        _parse_zone_map(_zonemap_index->page_zone_map(i), &detail);
         bool matched = true;
         for (const auto* predicate : predicates) {
             if (!predicate->zone_map_filter(detail)) {
@@ -412,12 +549,56 @@ Status ColumnReader::_zone_map_filter(const std::vector<const vectorized::Column
     return Status::OK();
 }
 
+// Return false if none of the codes of |predicate| is in |code_bitmap|.
+static bool dict_code_bitmap_filter(const vectorized::ColumnPredicate* predicate, const Slice& code_bitmap) {
+    for (const auto& value : predicate->values()) {
+        int32_t code = value.get_int32();
+        if (code >= 0 && static_cast<size_t>(code >> 3) < code_bitmap.size &&
+            (static_cast<uint8_t>(code_bitmap[code >> 3]) & (1 << (code & 7)))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Status ColumnReader::dict_code_zone_map_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                               vectorized::SparseRange* row_ranges) {
+    RETURN_IF_ERROR(_load_dict_code_zone_map_index());
+    TypeInfoPtr type_info = get_type_info(OLAP_FIELD_TYPE_INT);
+    int32_t page_size = _dict_code_zone_map_index->num_pages();
+    std::vector<uint32_t> page_indexes;
+    for (int32_t i = 0; i < page_size; ++i) {
+        ZoneMapView zm = _dict_code_zone_map_index->page_zone_map(i);
+        vectorized::ZoneMapDetail detail;
+        detail.set_has_null(zm.has_null);
+        if (zm.has_not_null) {
+            RETURN_IF_ERROR(vectorized::datum_from_string(type_info.get(), &(detail.min_value()), zm.min, nullptr));
+            RETURN_IF_ERROR(vectorized::datum_from_string(type_info.get(), &(detail.max_value()), zm.max, nullptr));
+        }
+        detail.set_num_rows(static_cast<size_t>(num_rows()));
+        bool matched = true;
+        for (const auto* predicate : predicates) {
+            bool by_bitmap = zm.has_dict_code_bitmap && (predicate->type() == vectorized::PredicateType::kEQ ||
+                                                          predicate->type() == vectorized::PredicateType::kInList);
+            if (by_bitmap ? !dict_code_bitmap_filter(predicate, zm.dict_code_bitmap)
+                          : !predicate->zone_map_filter(detail)) {
+                matched = false;
+                break;
+            }
+        }
+        if (matched) {
+            page_indexes.emplace_back(i);
+        }
+    }
+    return _calculate_row_ranges(page_indexes, row_ranges);
+}
+
 bool ColumnReader::segment_zone_map_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates) const {
     if (_segment_zone_map == nullptr) {
         return true;
     }
     vectorized::ZoneMapDetail detail;
-    _parse_zone_map(*_segment_zone_map, &detail);
+    _parse_zone_map(ZoneMapView::from_pb(*_segment_zone_map), &detail);
     auto filter = [&](const vectorized::ColumnPredicate* pred) { return pred->zone_map_filter(detail); };
     return std::all_of(predicates.begin(), predicates.end(), filter);
 }
@@ -26,6 +26,7 @@
 #include <cstddef> // for size_t
 #include <cstdint> // for uint32_t
 #include <memory>  // for unique_ptr
+#include <set>
 #include <utility>
 
 #include "column/datum.h"
@@ -40,6 +41,7 @@
 #include "storage/rowset/common.h"
 #include "storage/rowset/ordinal_page_index.h" // for OrdinalPageIndexIterator
 #include "storage/rowset/page_handle.h"
+#include "storage/rowset/page_io.h"
 #include "storage/rowset/segment.h"
 #include "storage/rowset/zone_map_index.h"
 #include "util/once.h"
@@ -98,6 +100,10 @@ public:
     // TODO: StatusOr<std::unique_ptr<ColumnIterator>> new_bitmap_index_iterator()
     Status new_bitmap_index_iterator(BitmapIndexIterator** iterator);
 
+    // Caller should free returned iterator after unused.
+    // The dictionary of the iterator has the tokens of the values, see inverted_index_tokenizer.h.
+    Status new_inverted_index_iterator(BitmapIndexIterator** iterator);
+
     // Seek to the first entry in the column.
     Status seek_to_first(OrdinalPageIndexIterator* iter);
     Status seek_at_or_before(ordinal_t ordinal, OrdinalPageIndexIterator* iter);
@@ -106,6 +112,10 @@ public:
     Status read_page(const ColumnIteratorOptions& iter_opts, const PagePointer& pp, PageHandle* handle,
                      Slice* page_body, PageFooterPB* footer);
 
+    // read several pages from file, the pages close to each other are read by one I/O
+    Status read_pages(const ColumnIteratorOptions& iter_opts, const std::vector<PagePointer>& pps, size_t max_gap,
+                      std::vector<PageIO::ReadPage>* pages);
+
     bool is_nullable() const { return _flags & kIsNullableMask; }
 
     const EncodingInfo* encoding_info() const { return _encoding_info; }
@@ -113,6 +123,9 @@ public:
     bool has_zone_map() const { return _zonemap_index != nullptr; }
     bool has_bitmap_index() const { return _bitmap_index != nullptr; }
     bool has_bloom_filter_index() const { return _bloom_filter_index != nullptr; }
+    bool has_dict_code_zone_map() const { return _dict_code_zone_map_index != nullptr; }
+    bool has_ngram_bloom_filter_index() const { return _ngram_bloom_filter_index != nullptr; }
+    bool has_inverted_index() const { return _inverted_index != nullptr; }
 
     ZoneMapPB* segment_zone_map() const { return _segment_zone_map.get(); }
 
@@ -140,10 +153,20 @@ public:
     // same as `match_condition`, used by vector engine.
     bool segment_zone_map_filter(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& predicates) const;
 
+    // page-level zone map filter by the dictionary codes, |predicates| are the predicates rewritten
+    // to the dictionary codes.
+    // prerequisite: has_dict_code_zone_map() is true.
+    Status dict_code_zone_map_filter(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& predicates,
+                                     vectorized::SparseRange* row_ranges);
+
     // prerequisite: at least one predicate in |predicates| support bloom filter.
     Status bloom_filter(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& p,
                         vectorized::SparseRange* ranges);
 
+    // prerequisite: at least one predicate in |predicates| support n-gram bloom filter.
+    Status ngram_bloom_filter(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& p,
+                              vectorized::SparseRange* ranges);
+
     Status load_ordinal_index();
 
     uint32_t num_rows() const { return _segment->num_rows(); }
@@ -178,11 +201,19 @@ private:
     Status _init(ColumnMetaPB* meta);
 
     Status _load_zonemap_index();
+    Status _load_dict_code_zone_map_index();
     Status _load_ordinal_index();
+
+    PageReadOptions _page_read_options(const ColumnIteratorOptions& iter_opts) const;
     Status _load_bitmap_index();
     Status _load_bloom_filter_index();
+    Status _load_ngram_bloom_filter_index();
+    Status _load_inverted_index();
+
+    // the data pages covered by |row_ranges|.
+    std::set<int32_t> _page_ids_of(const vectorized::SparseRange& row_ranges);
 
-    Status _parse_zone_map(const ZoneMapPB& zm, vectorized::ZoneMapDetail* detail) const;
+    Status _parse_zone_map(const ZoneMapView& zm, vectorized::ZoneMapDetail* detail) const;
 
     Status _calculate_row_ranges(const std::vector<uint32_t>& page_indexes, vectorized::SparseRange* row_ranges);
 
@@ -205,11 +236,18 @@ private:
     std::unique_ptr<OrdinalIndexPB> _ordinal_index_meta;
     std::unique_ptr<BitmapIndexPB> _bitmap_index_meta;
     std::unique_ptr<BloomFilterIndexPB> _bloom_filter_index_meta;
+    std::unique_ptr<ZoneMapIndexPB> _dict_code_zone_map_index_meta;
+    std::unique_ptr<BloomFilterIndexPB> _ngram_bloom_filter_index_meta;
+    std::unique_ptr<BitmapIndexPB> _inverted_index_meta;
 
     std::unique_ptr<ZoneMapIndexReader> _zonemap_index;
     std::unique_ptr<OrdinalIndexReader> _ordinal_index;
     std::unique_ptr<BitmapIndexReader> _bitmap_index;
     std::unique_ptr<BloomFilterIndexReader> _bloom_filter_index;
+    std::unique_ptr<ZoneMapIndexReader> _dict_code_zone_map_index;
+    std::unique_ptr<BloomFilterIndexReader> _ngram_bloom_filter_index;
+    uint32_t _ngram_bloom_filter_gram_num = 0;
+    std::unique_ptr<BitmapIndexReader> _inverted_index;
 
     std::unique_ptr<ZoneMapPB> _segment_zone_map;
 
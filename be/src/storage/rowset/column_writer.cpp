@@ -256,7 +256,8 @@ StatusOr<std::unique_ptr<ColumnWriter>> ColumnWriter::create(const ColumnWriterO
     if (is_string_type(delegate_type(column->type()))) {
         std::unique_ptr<Field> field_clone(FieldFactory::create(*column));
         ColumnWriterOptions str_opts = opts;
-        str_opts.need_speculate_encoding = true;
+        // Speculate on the data unless the encoding is given.
+        str_opts.need_speculate_encoding = opts.meta->encoding() == DEFAULT_ENCODING;
         auto column_writer = std::make_unique<ScalarColumnWriter>(str_opts, std::move(field_clone), wfile);
         return std::make_unique<StringColumnWriter>(str_opts, std::move(field), std::move(column_writer));
     } else if (is_scalar_field_type(delegate_type(column->type()))) {
@@ -376,11 +377,23 @@ Status ScalarColumnWriter::init() {
         _has_index_builder = true;
         RETURN_IF_ERROR(BitmapIndexWriter::create(get_field()->type_info(), &_bitmap_index_builder));
     }
+    if (_opts.need_inverted_index) {
+        _has_index_builder = true;
+        RETURN_IF_ERROR(
+                BitmapIndexWriter::create_inverted_index(get_field()->type_info(), &_inverted_index_builder));
+    }
     if (_opts.need_bloom_filter) {
         _has_index_builder = true;
         RETURN_IF_ERROR(BloomFilterIndexWriter::create(BloomFilterOptions(), get_field()->type_info(),
                                                        &_bloom_filter_index_builder));
     }
+    if (_opts.need_ngram_bloom_filter) {
+        _has_index_builder = true;
+        BloomFilterOptions bf_options;
+        bf_options.gram_num = config::ngram_bloom_filter_index_gram_num;
+        RETURN_IF_ERROR(BloomFilterIndexWriter::create(bf_options, get_field()->type_info(),
+                                                       &_ngram_bloom_filter_index_builder));
+    }
     return Status::OK();
 }
 
@@ -401,9 +414,18 @@ uint64_t ScalarColumnWriter::estimate_buffer_size() {
     if (_bitmap_index_builder != nullptr) {
         size += _bitmap_index_builder->size();
     }
+    if (_inverted_index_builder != nullptr) {
+        size += _inverted_index_builder->size();
+    }
     if (_bloom_filter_index_builder != nullptr) {
         size += _bloom_filter_index_builder->size();
     }
+    if (_ngram_bloom_filter_index_builder != nullptr) {
+        size += _ngram_bloom_filter_index_builder->size();
+    }
+    if (_dict_code_zone_map_index_builder != nullptr) {
+        size += _dict_code_zone_map_index_builder->size();
+    }
     return size;
 }
 
@@ -474,6 +496,11 @@ inline Status ScalarColumnWriter::set_encoding(const EncodingTypePB& encoding) {
     // because the default encoding of a data type can be changed in the future
     DCHECK_NE(_opts.meta->encoding(), DEFAULT_ENCODING);
     _page_builder.reset(page_builder);
+    if (_encoding_info->encoding() == DICT_ENCODING && config::enable_dict_code_zone_map) {
+        _dict_code_zone_map_index_builder = std::make_unique<DictCodeZoneMapIndexWriter>();
+    } else {
+        _dict_code_zone_map_index_builder.reset();
+    }
     return Status::OK();
 }
 
@@ -483,21 +510,30 @@ Status ScalarColumnWriter::write_ordinal_index() {
 
 Status ScalarColumnWriter::write_zone_map() {
     if (_zone_map_index_builder != nullptr) {
-        return _zone_map_index_builder->finish(_wfile, _opts.meta->add_indexes());
+        RETURN_IF_ERROR(_zone_map_index_builder->finish(_wfile, _opts.meta->add_indexes()));
+    }
+    if (_dict_code_zone_map_index_builder != nullptr) {
+        RETURN_IF_ERROR(_dict_code_zone_map_index_builder->finish(_wfile, _opts.meta->add_indexes()));
     }
     return Status::OK();
 }
 
 Status ScalarColumnWriter::write_bitmap_index() {
     if (_bitmap_index_builder != nullptr) {
-        return _bitmap_index_builder->finish(_wfile, _opts.meta->add_indexes());
+        RETURN_IF_ERROR(_bitmap_index_builder->finish(_wfile, _opts.meta->add_indexes()));
+    }
+    if (_inverted_index_builder != nullptr) {
+        RETURN_IF_ERROR(_inverted_index_builder->finish(_wfile, _opts.meta->add_indexes()));
     }
     return Status::OK();
 }
 
 Status ScalarColumnWriter::write_bloom_filter_index() {
     if (_bloom_filter_index_builder != nullptr) {
-        return _bloom_filter_index_builder->finish(_wfile, _opts.meta->add_indexes());
+        RETURN_IF_ERROR(_bloom_filter_index_builder->finish(_wfile, _opts.meta->add_indexes()));
+    }
+    if (_ngram_bloom_filter_index_builder != nullptr) {
+        RETURN_IF_ERROR(_ngram_bloom_filter_index_builder->finish(_wfile, _opts.meta->add_indexes()));
     }
     return Status::OK();
 }
@@ -523,11 +559,32 @@ Status ScalarColumnWriter::finish_current_page() {
         RETURN_IF_ERROR(_bloom_filter_index_builder->flush());
     }
 
+    if (_ngram_bloom_filter_index_builder != nullptr) {
+        RETURN_IF_ERROR(_ngram_bloom_filter_index_builder->flush());
+    }
+
     // build data page body : encoded values + [nullmap]
     std::vector<Slice> body;
     faststring* encoded_values = _page_builder->finish();
     body.emplace_back(*encoded_values);
 
+    if (_dict_code_zone_map_index_builder != nullptr && !_page_builder->all_dict_encoded()) {
+        // The codes of the pages before are useless once the dictionary is full.
+        _dict_code_zone_map_index_builder.reset();
+    }
+    if (_dict_code_zone_map_index_builder != nullptr) {
+        uint32_t min_code = 0;
+        uint32_t max_code = 0;
+        std::string code_bitmap;
+        bool has_not_null = _page_builder->get_dict_codes(&min_code, &max_code, &code_bitmap);
+        bool has_null = false;
+        if (is_nullable()) {
+            has_null = (_curr_page_format == 1) ? _null_map_builder_v1->has_null() : _null_map_builder_v2->has_null();
+        }
+        RETURN_IF_ERROR(
+                _dict_code_zone_map_index_builder->add_page(has_null, has_not_null, min_code, max_code, code_bitmap));
+    }
+
     OwnedSlice nullmap;
     if (is_nullable() && _curr_page_format == 1) {
         if (_null_map_builder_v1->has_null()) {
@@ -733,18 +790,24 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
                 if (is_null) {
                     INDEX_ADD_NULLS(_zone_map_index_builder, run);
                     INDEX_ADD_NULLS(_bitmap_index_builder, run);
+                    INDEX_ADD_NULLS(_inverted_index_builder, run);
                     INDEX_ADD_NULLS(_bloom_filter_index_builder, run);
+                    INDEX_ADD_NULLS(_ngram_bloom_filter_index_builder, run);
                 } else {
                     INDEX_ADD_VALUES(_zone_map_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bitmap_index_builder, pdata, run);
+                    INDEX_ADD_VALUES(_inverted_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bloom_filter_index_builder, pdata, run);
+                    INDEX_ADD_VALUES(_ngram_bloom_filter_index_builder, pdata, run);
                 }
                 pdata += get_field()->size() * run;
             }
         } else {
             INDEX_ADD_VALUES(_zone_map_index_builder, data, num_written);
             INDEX_ADD_VALUES(_bitmap_index_builder, data, num_written);
+            INDEX_ADD_VALUES(_inverted_index_builder, data, num_written);
             INDEX_ADD_VALUES(_bloom_filter_index_builder, data, num_written);
+            INDEX_ADD_VALUES(_ngram_bloom_filter_index_builder, data, num_written);
         }
 
         _next_rowid += num_written;
@@ -895,7 +958,9 @@ Status ArrayColumnWriter::finish_current_page() {
 
 StringColumnWriter::StringColumnWriter(const ColumnWriterOptions& opts, std::unique_ptr<Field> field,
                                        std::unique_ptr<ScalarColumnWriter> column_writer)
-        : ColumnWriter(std::move(field), opts.meta->is_nullable()), _scalar_column_writer(std::move(column_writer)) {}
+        : ColumnWriter(std::move(field), opts.meta->is_nullable()),
+          _scalar_column_writer(std::move(column_writer)),
+          _is_speculated(!opts.need_speculate_encoding) {}
 
 Status StringColumnWriter::append(const vectorized::Column& column) {
     RETURN_IF_ERROR(check_string_lengths(column));
@@ -58,6 +58,10 @@ struct ColumnWriterOptions {
     bool need_zone_map = false;
     bool need_bitmap_index = false;
     bool need_bloom_filter = false;
+    // build the bloom filters of the n-grams for LIKE predicates, only for CHAR and VARCHAR
+    bool need_ngram_bloom_filter = false;
+    // build the inverted index of the tokens for term search, only for CHAR and VARCHAR
+    bool need_inverted_index = false;
     // for char/varchar will speculate encoding in append
     // for others will decide encoding in init method
     bool need_speculate_encoding = false;
@@ -74,6 +78,7 @@ class NullFlagsBuilder;
 class OrdinalIndexWriter;
 class PageBuilder;
 class BloomFilterIndexWriter;
+class DictCodeZoneMapIndexWriter;
 class ZoneMapIndexWriter;
 
 class ColumnWriter {
@@ -233,8 +238,13 @@ private:
     std::unique_ptr<OrdinalIndexWriter> _ordinal_index_builder;
     std::unique_ptr<ZoneMapIndexWriter> _zone_map_index_builder;
     std::unique_ptr<BitmapIndexWriter> _bitmap_index_builder;
+    std::unique_ptr<BitmapIndexWriter> _inverted_index_builder;
     std::unique_ptr<BloomFilterIndexWriter> _bloom_filter_index_builder;
-    // _zone_map_index_builder != NULL || _bitmap_index_builder != NULL || _bloom_filter_index_builder != NULL
+    std::unique_ptr<BloomFilterIndexWriter> _ngram_bloom_filter_index_builder;
+    // Zone maps of the dict codes, dropped once a page falls back to plain encoding.
+    std::unique_ptr<DictCodeZoneMapIndexWriter> _dict_code_zone_map_index_builder;
+    // _zone_map_index_builder != NULL || _bitmap_index_builder != NULL || _bloom_filter_index_builder != NULL ||
+    // _ngram_bloom_filter_index_builder != NULL || _inverted_index_builder != NULL
     bool _has_index_builder = false;
     int64_t _element_ordinal = 0;
     int64_t _previous_ordinal = 0;
@@ -0,0 +1,324 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "column/column.h"
+#include "storage/range.h"
+#include "storage/rowset/options.h"      // for PageBuilderOptions/PageDecoderOptions
+#include "storage/rowset/packed_integer.h"
+#include "storage/rowset/page_builder.h" // for PageBuilder
+#include "storage/rowset/page_decoder.h" // for PageDecoder
+#include "storage/type_traits.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+
+// Delta and delta-of-delta coding of the 4-byte and 8-byte integer types, e.g. INT, BIGINT, DATE_V2
+// and DATETIME. It fits the monotonic values, e.g. the sorted keys, the auto increment ids and the
+// event timestamps, whose deltas (order 1) or deltas of deltas (order 2) are within a small range.
+//
+// DeltaPage := Header, PackedDeltas
+// Header := NumElements(uint32), Order(uint8), Width(uint8), FirstValue, FirstDelta, MinDelta
+// PackedDeltas := (Delta - MinDelta) of the elements after the first |Order| ones, packed to |Width| bytes
+//                 by packed_integer::pack.
+//
+// FirstValue, FirstDelta and MinDelta have the size of the type. The deltas are computed in the unsigned
+// type, so they wrap around instead of overflowing. The builder picks the order of the narrower width.
+//
+// The decoder restores the whole page in init() by a widening loop and prefix sums, both of which are
+// auto-vectorized by the compiler, so the reads after that are plain copies.
+namespace delta_page {
+
+static constexpr size_t kHeaderFixedSize = sizeof(uint32_t) + 2 * sizeof(uint8_t);
+
+template <typename T>
+inline constexpr size_t header_size() {
+    return kHeaderFixedSize + 3 * sizeof(T);
+}
+
+template <typename U>
+inline void prefix_sum(U* values, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+        values[i] += values[i - 1];
+    }
+}
+
+} // namespace delta_page
+
+template <FieldType Type>
+class DeltaPageBuilder final : public PageBuilder {
+    using CppType = typename TypeTraits<Type>::CppType;
+    using UnsignedType = std::make_unsigned_t<CppType>;
+    using SignedType = std::make_signed_t<CppType>;
+    static_assert(std::is_integral_v<CppType> && (sizeof(CppType) == 4 || sizeof(CppType) == 8),
+                  "delta encoding only supports the 4-byte and 8-byte integer types");
+
+public:
+    explicit DeltaPageBuilder(const PageBuilderOptions& options)
+            : _max_count(std::max<size_t>(1, options.data_page_size / sizeof(CppType))) {
+        _values.reserve(_max_count);
+    }
+
+    ~DeltaPageBuilder() override = default;
+
+    bool is_page_full() override { return _values.size() >= _max_count; }
+
+    size_t add(const uint8_t* vals, size_t count) override {
+        DCHECK(!_finished);
+        size_t to_add = std::min<size_t>(_max_count - _values.size(), count);
+        size_t old_size = _values.size();
+        _values.resize(old_size + to_add);
+        memcpy(_values.data() + old_size, vals, to_add * sizeof(CppType));
+        return to_add;
+    }
+
+    faststring* finish() override {
+        DCHECK(!_finished);
+        _finished = true;
+        _encode();
+        return &_buf;
+    }
+
+    void reset() override {
+        _values.clear();
+        _buf.clear();
+        _finished = false;
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    // The upper bound before finish(), a DeltaPage is never larger than the plain values and the header.
+    uint64_t size() const override {
+        return _finished ? _buf.size() : _values.size() * sizeof(CppType) + delta_page::header_size<CppType>();
+    }
+
+    Status get_first_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.front(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.back(), sizeof(CppType));
+        return Status::OK();
+    }
+
+private:
+    static uint8_t _width_of(const UnsignedType* deltas, size_t n, UnsignedType* min_delta) {
+        if (n == 0) {
+            *min_delta = 0;
+            return 0;
+        }
+        auto min = static_cast<SignedType>(deltas[0]);
+        auto max = min;
+        for (size_t i = 1; i < n; i++) {
+            auto d = static_cast<SignedType>(deltas[i]);
+            min = std::min(min, d);
+            max = std::max(max, d);
+        }
+        *min_delta = static_cast<UnsignedType>(min);
+        return packed_integer::width_of(static_cast<UnsignedType>(static_cast<UnsignedType>(max) - *min_delta));
+    }
+
+    void _encode() {
+        const size_t n = _values.size();
+        const auto* values = reinterpret_cast<const UnsignedType*>(_values.data());
+
+        // deltas[i] is the delta of values[i + 1].
+        std::vector<UnsignedType> deltas(n > 1 ? n - 1 : 0);
+        for (size_t i = 0; i < deltas.size(); i++) {
+            deltas[i] = values[i + 1] - values[i];
+        }
+        UnsignedType min_delta = 0;
+        uint8_t width = _width_of(deltas.data(), deltas.size(), &min_delta);
+        uint8_t order = 1;
+        UnsignedType first_delta = 0;
+
+        if (n > 2 && width > 0) {
+            std::vector<UnsignedType> delta_deltas(n - 2);
+            for (size_t i = 0; i < delta_deltas.size(); i++) {
+                delta_deltas[i] = deltas[i + 1] - deltas[i];
+            }
+            UnsignedType min_delta_delta = 0;
+            uint8_t width2 = _width_of(delta_deltas.data(), delta_deltas.size(), &min_delta_delta);
+            if (width2 < width) {
+                order = 2;
+                width = width2;
+                first_delta = deltas[0];
+                min_delta = min_delta_delta;
+                deltas.swap(delta_deltas);
+            }
+        }
+        DCHECK_EQ(deltas.size(), n > order ? n - order : 0);
+
+        const size_t header_size = delta_page::header_size<CppType>();
+        _buf.clear();
+        _buf.resize(header_size + deltas.size() * width);
+        uint8_t* p = _buf.data();
+        encode_fixed32_le(p, static_cast<uint32_t>(n));
+        p[4] = order;
+        p[5] = width;
+        p += delta_page::kHeaderFixedSize;
+        UnsignedType first_value = n > 0 ? values[0] : 0;
+        memcpy(p, &first_value, sizeof(UnsignedType));
+        memcpy(p + sizeof(UnsignedType), &first_delta, sizeof(UnsignedType));
+        memcpy(p + 2 * sizeof(UnsignedType), &min_delta, sizeof(UnsignedType));
+        p += 3 * sizeof(UnsignedType);
+
+        packed_integer::pack(deltas.data(), deltas.size(), min_delta, width, p);
+    }
+
+    const size_t _max_count;
+    bool _finished = false;
+    std::vector<CppType> _values;
+    faststring _buf;
+};
+
+template <FieldType Type>
+class DeltaPageDecoder final : public PageDecoder {
+    using CppType = typename TypeTraits<Type>::CppType;
+    using UnsignedType = std::make_unsigned_t<CppType>;
+
+public:
+    DeltaPageDecoder(Slice data, const PageDecoderOptions& options) : _data(data) {}
+
+    ~DeltaPageDecoder() override = default;
+
+    Status init() override {
+        CHECK(!_parsed);
+        const size_t header_size = delta_page::header_size<CppType>();
+        if (_data.size < header_size) {
+            return Status::Corruption("delta page is too small");
+        }
+        const auto* p = reinterpret_cast<const uint8_t*>(_data.data);
+        const size_t n = decode_fixed32_le(p);
+        const uint8_t order = p[4];
+        const uint8_t width = p[5];
+        if ((order != 1 && order != 2) || !packed_integer::is_valid_width(width)) {
+            return Status::Corruption("bad delta page header");
+        }
+        const size_t num_packed = n > order ? n - order : 0;
+        if (_data.size != header_size + num_packed * width) {
+            return Status::Corruption("bad delta page size");
+        }
+        p += delta_page::kHeaderFixedSize;
+        UnsignedType first_value;
+        UnsignedType first_delta;
+        UnsignedType min_delta;
+        memcpy(&first_value, p, sizeof(UnsignedType));
+        memcpy(&first_delta, p + sizeof(UnsignedType), sizeof(UnsignedType));
+        memcpy(&min_delta, p + 2 * sizeof(UnsignedType), sizeof(UnsignedType));
+        p += 3 * sizeof(UnsignedType);
+
+        _values.resize(n);
+        if (n > 0) {
+            UnsignedType* values = _values.data();
+            values[0] = first_value;
+            if (order == 2 && n > 1) {
+                values[1] = first_delta;
+            }
+            UnsignedType* dst = values + std::min<size_t>(n, order);
+            packed_integer::unpack(p, num_packed, min_delta, width, dst);
+            if (order == 2) {
+                // restore the deltas from the deltas of deltas, values[1] is the first delta.
+                delta_page::prefix_sum(values, 2, n);
+            }
+            delta_page::prefix_sum(values, 1, n);
+        }
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        DCHECK_LE(pos, _values.size()) << "Tried to seek to " << pos << " which is > number of elements ("
+                                       << _values.size() << ") in the block!";
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    Status seek_at_or_after_value(const void* value, bool* exact_match) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        CppType target;
+        memcpy(&target, value, sizeof(CppType));
+        const CppType* values = _typed_values();
+        // The values are sorted when a value seek is needed, e.g. the key columns.
+        const CppType* it = std::lower_bound(values, values + _values.size(), target);
+        if (it == values + _values.size()) {
+            return Status::NotFound("all value small than the value");
+        }
+        *exact_match = *it == target;
+        _cur_index = it - values;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, ColumnBlockView* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (PREDICT_FALSE(*n == 0 || _cur_index >= _values.size())) {
+            *n = 0;
+            return Status::OK();
+        }
+        size_t to_fetch = std::min(*n, _values.size() - _cur_index);
+        memcpy(dst->data(), _typed_values() + _cur_index, to_fetch * sizeof(CppType));
+        _cur_index += to_fetch;
+        *n = to_fetch;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::Column* dst) override {
+        vectorized::SparseRange read_range;
+        size_t begin = current_index();
+        read_range.add(vectorized::Range(begin, begin + *n));
+        RETURN_IF_ERROR(next_batch(read_range, dst));
+        *n = current_index() - begin;
+        return Status::OK();
+    }
+
+    Status next_batch(const vectorized::SparseRange& range, vectorized::Column* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (PREDICT_FALSE(range.span_size() == 0 || _cur_index >= _values.size())) {
+            return Status::OK();
+        }
+        size_t to_read = std::min(static_cast<size_t>(range.span_size()), _values.size() - _cur_index);
+        vectorized::SparseRangeIterator iter = range.new_iterator();
+        while (to_read > 0) {
+            _cur_index = iter.begin();
+            vectorized::Range r = iter.next(to_read);
+            size_t n = dst->append_numbers(_typed_values() + _cur_index, r.span_size() * sizeof(CppType));
+            DCHECK_EQ(r.span_size(), n);
+            _cur_index += r.span_size();
+            to_read -= r.span_size();
+        }
+        return Status::OK();
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    size_t current_index() const override { return _cur_index; }
+
+    EncodingTypePB encoding_type() const override { return DELTA_ENCODING; }
+
+private:
+    const CppType* _typed_values() const { return reinterpret_cast<const CppType*>(_values.data()); }
+
+    Slice _data;
+    bool _parsed = false;
+    size_t _cur_index = 0;
+    std::vector<UnsignedType> _values;
+};
+
+} // namespace starrocks
@@ -25,10 +25,12 @@
 
 #include "gutil/strings/substitute.h"
 #include "storage/olap_common.h"
+#include "storage/rowset/alp_page.h"
 #include "storage/rowset/binary_dict_page.h"
 #include "storage/rowset/binary_plain_page.h"
 #include "storage/rowset/binary_prefix_page.h"
 #include "storage/rowset/bitshuffle_page.h"
+#include "storage/rowset/delta_page.h"
 #include "storage/rowset/frame_of_reference_page.h"
 #include "storage/rowset/plain_page.h"
 #include "storage/rowset/rle_page.h"
@@ -130,6 +132,33 @@ struct TypeEncodingTraits<type, FOR_ENCODING, CppType,
     }
 };
 
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, DELTA_ENCODING, CppType,
+                          typename std::enable_if<std::is_integral<CppType>::value &&
+                                                  (sizeof(CppType) == 4 || sizeof(CppType) == 8)>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new DeltaPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts, PageDecoder** decoder) {
+        *decoder = new DeltaPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, ALP_ENCODING, CppType,
+                          typename std::enable_if<std::is_floating_point<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new AlpPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts, PageDecoder** decoder) {
+        *decoder = new AlpPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
 template <FieldType type>
 struct TypeEncodingTraits<type, PREFIX_ENCODING, Slice> {
     static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
@@ -199,10 +228,12 @@ EncodingInfoResolver::EncodingInfoResolver() {
 
     _add_map<OLAP_FIELD_TYPE_INT, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_INT, FOR_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_INT, DELTA_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_INT, PLAIN_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_BIGINT, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_BIGINT, FOR_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_BIGINT, DELTA_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_BIGINT, PLAIN_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_LARGEINT, BIT_SHUFFLE>();
@@ -211,9 +242,11 @@ EncodingInfoResolver::EncodingInfoResolver() {
 
     _add_map<OLAP_FIELD_TYPE_FLOAT, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_FLOAT, PLAIN_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_FLOAT, ALP_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_DOUBLE, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_DOUBLE, PLAIN_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_DOUBLE, ALP_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_CHAR, DICT_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_CHAR, PLAIN_ENCODING>();
@@ -234,14 +267,17 @@ EncodingInfoResolver::EncodingInfoResolver() {
     _add_map<OLAP_FIELD_TYPE_DATE_V2, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_DATE_V2, PLAIN_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_DATE_V2, FOR_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_DATE_V2, DELTA_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_DATETIME, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_DATETIME, PLAIN_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_DATETIME, FOR_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_DATETIME, DELTA_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_TIMESTAMP, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_TIMESTAMP, PLAIN_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_TIMESTAMP, FOR_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_TIMESTAMP, DELTA_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_DECIMAL, BIT_SHUFFLE, true>();
     _add_map<OLAP_FIELD_TYPE_DECIMAL, PLAIN_ENCODING>();
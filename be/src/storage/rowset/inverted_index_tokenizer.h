@@ -0,0 +1,38 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <cstdint>
+
+#include "util/slice.h"
+
+namespace starrocks::inverted_index {
+
+// The tokens of the inverted index are the maximal runs of ASCII letters, ASCII digits and non-ASCII
+// bytes, so the UTF-8 words are kept whole. All the other bytes are delimiters. The tokens are case
+// sensitive, the same as the string predicates.
+inline bool is_token_char(char c) {
+    auto u = static_cast<uint8_t>(c);
+    return u >= 0x80 || (u >= '0' && u <= '9') || (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z');
+}
+
+// Call |func| with each token of |text|, the same token may repeat.
+template <typename Func>
+inline void for_each_token(const Slice& text, Func&& func) {
+    size_t begin = 0;
+    while (begin < text.size) {
+        while (begin < text.size && !is_token_char(text.data[begin])) {
+            begin++;
+        }
+        size_t end = begin;
+        while (end < text.size && is_token_char(text.data[end])) {
+            end++;
+        }
+        if (end > begin) {
+            func(Slice(text.data + begin, end - begin));
+        }
+        begin = end;
+    }
+}
+
+} // namespace starrocks::inverted_index
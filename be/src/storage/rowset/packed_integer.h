@@ -0,0 +1,104 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace starrocks::packed_integer {
+
+// Pack the unsigned integers as (value - base), each written as a little-endian unsigned integer of
+// |width| bytes, where |width| is 0, 1, 2, 4 or 8. It's used by the page encodings whose values are
+// reduced to a small range of integers, e.g. DELTA_ENCODING and ALP_ENCODING.
+
+// The width of the unsigned |range|.
+template <typename U>
+inline uint8_t width_of(U range) {
+    if (range == 0) return 0;
+    if (range <= 0xFF) return 1;
+    if (range <= 0xFFFF) return 2;
+    if (range <= 0xFFFFFFFFULL) return 4;
+    return 8;
+}
+
+inline bool is_valid_width(uint8_t width) {
+    return width == 0 || width == 1 || width == 2 || width == 4 || width == 8;
+}
+
+// The packed values may be unaligned in the page, they are (un)packed through an aligned buffer,
+// so the loops are vectorized by the compiler.
+template <typename U, typename P>
+inline void pack(const U* values, size_t n, U base, uint8_t* dst) {
+    P packed[256];
+    while (n > 0) {
+        size_t batch = std::min<size_t>(n, 256);
+        for (size_t i = 0; i < batch; i++) {
+            packed[i] = static_cast<P>(values[i] - base);
+        }
+        memcpy(dst, packed, batch * sizeof(P));
+        values += batch;
+        dst += batch * sizeof(P);
+        n -= batch;
+    }
+}
+
+template <typename U, typename P>
+inline void unpack(const uint8_t* src, size_t n, U base, U* dst) {
+    P packed[256];
+    while (n > 0) {
+        size_t batch = std::min<size_t>(n, 256);
+        memcpy(packed, src, batch * sizeof(P));
+        for (size_t i = 0; i < batch; i++) {
+            dst[i] = base + static_cast<U>(packed[i]);
+        }
+        src += batch * sizeof(P);
+        dst += batch;
+        n -= batch;
+    }
+}
+
+// Write n * |width| bytes to |dst|.
+template <typename U>
+inline void pack(const U* values, size_t n, U base, uint8_t width, uint8_t* dst) {
+    switch (width) {
+    case 0:
+        break;
+    case 1:
+        pack<U, uint8_t>(values, n, base, dst);
+        break;
+    case 2:
+        pack<U, uint16_t>(values, n, base, dst);
+        break;
+    case 4:
+        pack<U, uint32_t>(values, n, base, dst);
+        break;
+    default:
+        pack<U, uint64_t>(values, n, base, dst);
+        break;
+    }
+}
+
+// Read n * |width| bytes from |src|.
+template <typename U>
+inline void unpack(const uint8_t* src, size_t n, U base, uint8_t width, U* dst) {
+    switch (width) {
+    case 0:
+        std::fill(dst, dst + n, base);
+        break;
+    case 1:
+        unpack<U, uint8_t>(src, n, base, dst);
+        break;
+    case 2:
+        unpack<U, uint16_t>(src, n, base, dst);
+        break;
+    case 4:
+        unpack<U, uint32_t>(src, n, base, dst);
+        break;
+    default:
+        unpack<U, uint64_t>(src, n, base, dst);
+        break;
+    }
+}
+
+} // namespace starrocks::packed_integer
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <vector>
 
 #include "common/status.h"
@@ -100,6 +101,15 @@ public:
     // this information is used for doing low-cardinality string column read optimization.
     virtual bool all_dict_encoded() const { return false; }
 
+    // Get the range of the dictionary codes of the current data page, and the bitmap of them
+    // if the codes are small enough, otherwise |code_bitmap| is cleared.
+    // Return false if the page is empty or not encoded by dict encoding.
+    // This method could only be called between finish() and reset().
+    // only `BinaryDictPageBuilder` needed to overload this method.
+    virtual bool get_dict_codes(uint32_t* min_code, uint32_t* max_code, std::string* code_bitmap) const {
+        return false;
+    }
+
 private:
     PageBuilder(const PageBuilder&) = delete;
     const PageBuilder& operator=(const PageBuilder&) = delete;
@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "gutil/macros.h" // for DISALLOW_COPY
 #include "storage/page_cache.h"
 #include "util/slice.h"
@@ -44,8 +46,13 @@ public:
     // cache_data to a invalid cache handle.
     explicit PageHandle(PageCacheHandle cache_data) : _cache_data(std::move(cache_data)) {}
 
+    // This class will reference the input data owned by |owner|, e.g. a page in a file mapped into memory,
+    // and keep |owner| alive until it deconstructs.
+    PageHandle(const Slice& data, std::shared_ptr<const void> owner) : _data(data), _owner(std::move(owner)) {}
+
     // Move constructor
-    PageHandle(PageHandle&& other) noexcept : _data(other._data), _cache_data(std::move(other._cache_data)) {
+    PageHandle(PageHandle&& other) noexcept
+            : _data(other._data), _cache_data(std::move(other._cache_data)), _owner(std::move(other._owner)) {
         // we can use std::exchange if we switch c++14 on
         std::swap(_is_data_owner, other._is_data_owner);
     }
@@ -54,6 +61,7 @@ public:
         std::swap(_is_data_owner, other._is_data_owner);
         _data = other._data;
         _cache_data = std::move(other._cache_data);
+        _owner = std::move(other._owner);
         return *this;
     }
 
@@ -74,7 +82,7 @@ public:
 
     // the return slice contains uncompressed page body, page footer, and footer size
     Slice data() const {
-        if (_is_data_owner) {
+        if (_is_data_owner || _owner != nullptr) {
             return _data;
         }
         return _cache_data.data();
@@ -90,10 +98,12 @@ public:
 
 private:
     // when this is true, it means this struct own data and _data is valid.
-    // otherwise _cache_data is valid, and data is belong to cache.
+    // otherwise _cache_data is valid, and data is belong to cache, unless _owner is set.
     bool _is_data_owner = false;
     Slice _data;
     PageCacheHandle _cache_data;
+    // The owner of _data if it's referenced, see the constructor.
+    std::shared_ptr<const void> _owner;
 
     // Don't allow copy and assign
     PageHandle(const PageHandle&) = delete;
@@ -26,6 +26,7 @@
 
 #include "column/column.h"
 #include "common/logging.h"
+#include "common/statusor.h"
 #include "fs/fs.h"
 #include "gutil/strings/substitute.h"
 #include "storage/page_cache.h"
@@ -115,48 +116,29 @@ Status PageIO::write_page(WritableFile* wfile, const std::vector<Slice>& body, c
     return Status::OK();
 }
 
-Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle* handle, Slice* body,
-                                        PageFooterPB* footer) {
-    // the function will be used by query or load, current load is not allowed to fail when memory reach the limit,
-    // so don't check when tls_thread_state.check is set to false
-    CHECK_MEM_LIMIT("read and decompress page");
-
-    opts.sanity_check();
-    opts.stats->total_pages_num++;
+static CacheAccessMode page_cache_access_mode(const PageReadOptions& opts) {
+    return opts.sequential_scan ? CacheAccessMode::SEQUENTIAL : CacheAccessMode::NORMAL;
+}
 
+// Insert a copy of the compressed page |page_slice| into the compressed tier of page cache.
+static void insert_compressed_page(const PageReadOptions& opts, const Slice& page_slice) {
     auto cache = StoragePageCache::instance();
-    PageCacheHandle cache_handle;
+    std::unique_ptr<char[]> page(new char[page_slice.size]);
+    memcpy(page.get(), page_slice.data, page_slice.size);
     StoragePageCache::CacheKey cache_key(opts.read_file->filename(), opts.page_pointer.offset);
-    if (opts.use_page_cache && cache->lookup(cache_key, &cache_handle)) {
-        // we find page in cache, use it
-        *handle = PageHandle(std::move(cache_handle));
-        opts.stats->cached_pages_num++;
-        // parse body and footer
-        Slice page_slice = handle->data();
-        uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
-        std::string footer_buf(page_slice.data + page_slice.size - 4 - footer_size, footer_size);
-        if (!footer->ParseFromString(footer_buf)) {
-            return Status::Corruption("Bad page: invalid footer");
-        }
-        *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
-        return Status::OK();
-    }
-
-    // every page contains 4 bytes footer length and 4 bytes checksum
-    const uint32_t page_size = opts.page_pointer.size;
-    if (page_size < 8) {
-        return Status::Corruption(strings::Substitute("Bad page: too small size ($0)", page_size));
-    }
+    PageCacheHandle cache_handle;
+    cache->insert_compressed(cache_key, Slice(page.get(), page_slice.size), &cache_handle, opts.kept_in_memory,
+                             page_cache_access_mode(opts));
+    page.release(); // memory now managed by cache
+}
 
-    // hold compressed page at first, reset to decompressed page later
-    // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
-    std::unique_ptr<char[]> page(new char[page_size + vectorized::Column::APPEND_OVERFLOW_MAX_SIZE]);
-    Slice page_slice(page.get(), page_size);
-    {
-        SCOPED_RAW_TIMER(&opts.stats->io_ns);
-        RETURN_IF_ERROR(opts.read_file->read_at_fully(opts.page_pointer.offset, page_slice.data, page_slice.size));
-        opts.stats->compressed_bytes_read += page_size;
-    }
+// Verify, decompress and decode the raw page |page_slice|, and insert it into page cache if required.
+// The compressed page is also inserted into the compressed tier of page cache if |insert_compressed|.
+// |page_slice| is in |page|, or in the mapping of `opts.read_file` if |page| is null, in which case it's
+// referenced by |handle| without a copy and not inserted into page cache unless it's decompressed or decoded.
+static Status parse_raw_page(const PageReadOptions& opts, std::unique_ptr<char[]> page, Slice page_slice,
+                             PageHandle* handle, Slice* body, PageFooterPB* footer, bool insert_compressed) {
+    DCHECK_EQ(opts.page_pointer.size, page_slice.size);
 
     if (opts.verify_checksum) {
         uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
@@ -180,6 +162,10 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
         if (opts.codec == nullptr) {
             return Status::Corruption("Bad page: page is compressed but codec is NO_COMPRESSION");
         }
+        if (insert_compressed && opts.use_page_cache && StoragePageCache::instance()->has_compressed_tier()) {
+            // Including the checksum, which has been verified.
+            insert_compressed_page(opts, Slice(page_slice.data, page_slice.size + 4));
+        }
         SCOPED_RAW_TIMER(&opts.stats->decompress_ns);
         // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
         std::unique_ptr<char[]> decompressed_page(
@@ -207,9 +193,17 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     RETURN_IF_ERROR(StoragePageDecoder::decode_page(footer, footer_size + 4, opts.encoding_type, &page, &page_slice));
 
     *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
+    if (page == nullptr) {
+        // Cached by the OS page cache instead of the page cache.
+        *handle = PageHandle(page_slice, opts.read_file->stream());
+        return Status::OK();
+    }
     if (opts.use_page_cache) {
         // insert this page into cache and return the cache handle
-        cache->insert(cache_key, page_slice, &cache_handle, opts.kept_in_memory);
+        auto cache = StoragePageCache::instance();
+        StoragePageCache::CacheKey cache_key(opts.read_file->filename(), opts.page_pointer.offset);
+        PageCacheHandle cache_handle;
+        cache->insert(cache_key, page_slice, &cache_handle, opts.kept_in_memory, page_cache_access_mode(opts));
         *handle = PageHandle(std::move(cache_handle));
     } else {
         *handle = PageHandle(page_slice);
@@ -218,4 +212,205 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     return Status::OK();
 }
 
+// Try to get the page from page cache.
+static StatusOr<bool> lookup_page_cache(const PageReadOptions& opts, PageHandle* handle, Slice* body,
+                                        PageFooterPB* footer) {
+    auto cache = StoragePageCache::instance();
+    PageCacheHandle cache_handle;
+    StoragePageCache::CacheKey cache_key(opts.read_file->filename(), opts.page_pointer.offset);
+    if (!opts.use_page_cache) {
+        return false;
+    }
+    if (!cache->lookup(cache_key, &cache_handle, page_cache_access_mode(opts))) {
+        if (!cache->has_compressed_tier() || !cache->lookup_compressed(cache_key, &cache_handle,
+                                                                       page_cache_access_mode(opts))) {
+            return false;
+        }
+        // Decompress the page hit in the compressed tier, and insert it into the decompressed tier.
+        Slice compressed = cache_handle.data();
+        // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
+        std::unique_ptr<char[]> page(new char[compressed.size + vectorized::Column::APPEND_OVERFLOW_MAX_SIZE]);
+        memcpy(page.get(), compressed.data, compressed.size);
+        PageReadOptions page_opts = opts;
+        page_opts.verify_checksum = false;
+        Slice page_slice(page.get(), compressed.size);
+        RETURN_IF_ERROR(parse_raw_page(page_opts, std::move(page), page_slice, handle, body, footer, false));
+        opts.stats->cached_pages_num++;
+        return true;
+    }
+    // we find page in cache, use it
+    *handle = PageHandle(std::move(cache_handle));
+    opts.stats->cached_pages_num++;
+    // parse body and footer
+    Slice page_slice = handle->data();
+    uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
+    std::string footer_buf(page_slice.data + page_slice.size - 4 - footer_size, footer_size);
+    if (!footer->ParseFromString(footer_buf)) {
+        return Status::Corruption("Bad page: invalid footer");
+    }
+    *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
+    return true;
+}
+
+// Parse the page of |opts| in place in the mapping of `opts.read_file` if it's mapped into memory,
+// see parse_raw_page. Return false if it's not mapped.
+static StatusOr<bool> read_mapped_page(const PageReadOptions& opts, PageHandle* handle, Slice* body,
+                                       PageFooterPB* footer) {
+    if (!opts.read_file->allows_peek_at()) {
+        return false;
+    }
+    const uint32_t page_size = opts.page_pointer.size;
+    // The APPEND_OVERFLOW_MAX_SIZE bytes past the page are read by append_strings_overflow, so they must be in
+    // the file as well, otherwise, e.g. for the last page of a file, the page is copied.
+    auto mapped_or = opts.read_file->peek_at(opts.page_pointer.offset,
+                                             page_size + vectorized::Column::APPEND_OVERFLOW_MAX_SIZE);
+    if (!mapped_or.ok()) {
+        return false;
+    }
+    opts.stats->compressed_bytes_read += page_size;
+    Slice page_slice(mapped_or.value().data(), page_size);
+    RETURN_IF_ERROR(parse_raw_page(opts, nullptr, page_slice, handle, body, footer, true));
+    return true;
+}
+
+// Read the page of |opts| which is not in the page cache, and parse it.
+static Status read_and_parse_page(const PageReadOptions& opts, PageHandle* handle, Slice* body,
+                                  PageFooterPB* footer) {
+    ASSIGN_OR_RETURN(bool mapped, read_mapped_page(opts, handle, body, footer));
+    if (mapped) {
+        return Status::OK();
+    }
+
+    // hold compressed page at first, reset to decompressed page later
+    // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
+    const uint32_t page_size = opts.page_pointer.size;
+    std::unique_ptr<char[]> page(new char[page_size + vectorized::Column::APPEND_OVERFLOW_MAX_SIZE]);
+    {
+        SCOPED_RAW_TIMER(&opts.stats->io_ns);
+        RETURN_IF_ERROR(opts.read_file->read_at_fully(opts.page_pointer.offset, page.get(), page_size));
+        opts.stats->compressed_bytes_read += page_size;
+    }
+    Slice page_slice(page.get(), page_size);
+    return parse_raw_page(opts, std::move(page), page_slice, handle, body, footer, true);
+}
+
+Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle* handle, Slice* body,
+                                        PageFooterPB* footer) {
+    // the function will be used by query or load, current load is not allowed to fail when memory reach the limit,
+    // so don't check when tls_thread_state.check is set to false
+    CHECK_MEM_LIMIT("read and decompress page");
+
+    opts.sanity_check();
+    opts.stats->total_pages_num++;
+
+    ASSIGN_OR_RETURN(bool cached, lookup_page_cache(opts, handle, body, footer));
+    if (cached) {
+        return Status::OK();
+    }
+
+    // every page contains 4 bytes footer length and 4 bytes checksum
+    const uint32_t page_size = opts.page_pointer.size;
+    if (page_size < 8) {
+        return Status::Corruption(strings::Substitute("Bad page: too small size ($0)", page_size));
+    }
+
+    return read_and_parse_page(opts, handle, body, footer);
+}
+
+Status PageIO::read_and_decompress_pages(const PageReadOptions& opts, const std::vector<PagePointer>& page_pointers,
+                                         size_t max_gap, std::vector<ReadPage>* pages) {
+    CHECK_MEM_LIMIT("read and decompress pages");
+
+    opts.sanity_check();
+    pages->clear();
+    pages->resize(page_pointers.size());
+
+    // Get the cached pages first, and collect the others to read.
+    std::vector<size_t> to_read;
+    for (size_t i = 0; i < page_pointers.size(); i++) {
+        PageReadOptions page_opts = opts;
+        page_opts.page_pointer = page_pointers[i];
+        opts.stats->total_pages_num++;
+        auto& page = (*pages)[i];
+        ASSIGN_OR_RETURN(bool cached, lookup_page_cache(page_opts, &page.handle, &page.body, &page.footer));
+        if (!cached) {
+            if (page_pointers[i].size < 8) {
+                return Status::Corruption(strings::Substitute("Bad page: too small size ($0)", page_pointers[i].size));
+            }
+            DCHECK(to_read.empty() || page_pointers[to_read.back()].offset + page_pointers[to_read.back()].size <=
+                                              page_pointers[i].offset);
+            to_read.push_back(i);
+        }
+    }
+
+    // Read the pages close to each other by one I/O, and submit all the I/Os at once.
+    struct PageGroup {
+        size_t begin;
+        size_t end;
+        uint64_t io_offset;
+        size_t buffer_offset;
+    };
+    std::vector<PageGroup> groups;
+    std::vector<io::ReadRequest> requests;
+    size_t buffer_size = 0;
+    for (size_t begin = 0; begin < to_read.size();) {
+        size_t end = begin + 1;
+        while (end < to_read.size()) {
+            const auto& prev = page_pointers[to_read[end - 1]];
+            if (prev.offset + prev.size + max_gap < page_pointers[to_read[end]].offset) {
+                break;
+            }
+            end++;
+        }
+        const auto& last = page_pointers[to_read[end - 1]];
+        const uint64_t io_offset = page_pointers[to_read[begin]].offset;
+        const uint64_t io_size = last.offset + last.size - io_offset;
+        groups.push_back({begin, end, io_offset, buffer_size});
+        requests.push_back({static_cast<int64_t>(io_offset), nullptr, static_cast<int64_t>(io_size)});
+        buffer_size += io_size;
+        begin = end;
+    }
+    if (requests.empty()) {
+        return Status::OK();
+    }
+    if (opts.read_file->allows_peek_at()) {
+        // Read ahead all the pages at once, then parse them in place in the mapping one by one.
+        for (const auto& request : requests) {
+            opts.read_file->will_need(request.offset, request.count);
+        }
+        for (size_t i : to_read) {
+            PageReadOptions page_opts = opts;
+            page_opts.page_pointer = page_pointers[i];
+            auto& read_page = (*pages)[i];
+            RETURN_IF_ERROR(read_and_parse_page(page_opts, &read_page.handle, &read_page.body, &read_page.footer));
+        }
+        return Status::OK();
+    }
+    std::unique_ptr<char[]> buffer(new char[buffer_size]);
+    for (size_t g = 0; g < groups.size(); g++) {
+        requests[g].data = buffer.get() + groups[g].buffer_offset;
+    }
+    {
+        SCOPED_RAW_TIMER(&opts.stats->io_ns);
+        RETURN_IF_ERROR(opts.read_file->read_at_fully_batch(requests));
+        opts.stats->compressed_bytes_read += buffer_size;
+    }
+    for (const auto& group : groups) {
+        const char* group_data = buffer.get() + group.buffer_offset;
+        for (size_t i = group.begin; i < group.end; i++) {
+            PageReadOptions page_opts = opts;
+            page_opts.page_pointer = page_pointers[to_read[i]];
+            const uint32_t page_size = page_opts.page_pointer.size;
+            // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
+            std::unique_ptr<char[]> page(new char[page_size + vectorized::Column::APPEND_OVERFLOW_MAX_SIZE]);
+            memcpy(page.get(), group_data + (page_opts.page_pointer.offset - group.io_offset), page_size);
+            auto& read_page = (*pages)[to_read[i]];
+            Slice page_slice(page.get(), page_size);
+            RETURN_IF_ERROR(parse_raw_page(page_opts, std::move(page), page_slice, &read_page.handle,
+                                           &read_page.body, &read_page.footer, true));
+        }
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -53,6 +53,8 @@ struct PageReadOptions {
     // if true, use DURABLE CachePriority in page cache
     // currently used for in memory olap table
     bool kept_in_memory = false;
+    // if true, use SEQUENTIAL CacheAccessMode in page cache, for the big scans
+    bool sequential_scan = false;
     // page encoding type
     EncodingTypePB encoding_type = UNKNOWN_ENCODING;
 
@@ -104,6 +106,19 @@ public:
     //     `footer' stores the page footer.
     static Status read_and_decompress_page(const PageReadOptions& opts, PageHandle* handle, Slice* body,
                                            PageFooterPB* footer);
+
+    struct ReadPage {
+        PageHandle handle;
+        Slice body;
+        PageFooterPB footer;
+    };
+
+    // Read and parse the pages of |page_pointers| like read_and_decompress_page(), with `opts.page_pointer` ignored.
+    // The pages not in page cache and at most |max_gap| bytes away from each other are read by one I/O,
+    // which saves the latency of the remote or cold storage.
+    // REQUIRES: |page_pointers| are sorted by offset and don't overlap.
+    static Status read_and_decompress_pages(const PageReadOptions& opts, const std::vector<PagePointer>& page_pointers,
+                                            size_t max_gap, std::vector<ReadPage>* pages);
 };
 
 } // namespace starrocks
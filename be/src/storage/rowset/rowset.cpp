@@ -233,9 +233,9 @@ Status Rowset::remove() {
     return result;
 }
 
-Status Rowset::link_files_to(const std::string& dir, RowsetId new_rowset_id) {
+Status Rowset::link_files_to(const std::string& dir, RowsetId new_rowset_id, int segment_offset) {
     for (int i = 0; i < num_segments(); ++i) {
-        std::string dst_link_path = segment_file_path(dir, new_rowset_id, i);
+        std::string dst_link_path = segment_file_path(dir, new_rowset_id, segment_offset + i);
         std::string src_file_path = segment_file_path(_rowset_path, rowset_id(), i);
         if (link(src_file_path.c_str(), dst_link_path.c_str()) != 0) {
             PLOG(WARNING) << "Fail to link " << src_file_path << " to " << dst_link_path;
@@ -253,7 +253,7 @@ Status Rowset::link_files_to(const std::string& dir, RowsetId new_rowset_id) {
     return Status::OK();
 }
 
-Status Rowset::copy_files_to(const std::string& dir) {
+Status Rowset::copy_files_to(const std::string& dir, int64_t max_bytes_per_second) {
     for (int i = 0; i < num_segments(); ++i) {
         std::string dst_path = segment_file_path(dir, rowset_id(), i);
         if (fs::path_exist(dst_path)) {
@@ -261,10 +261,10 @@ Status Rowset::copy_files_to(const std::string& dir) {
             return Status::AlreadyExist(fmt::format("Path already exist: {}", dst_path));
         }
         std::string src_path = segment_file_path(_rowset_path, rowset_id(), i);
-        if (!fs::copy_file(src_path, dst_path).ok()) {
-            LOG(WARNING) << "Error to copy file. src:" << src_path << ", dst:" << dst_path << ", errno=" << Errno::no();
+        if (Status st = fs::copy_local_file(src_path, dst_path, max_bytes_per_second); !st.ok()) {
+            LOG(WARNING) << "Error to copy file. src:" << src_path << ", dst:" << dst_path << ", error=" << st;
             return Status::IOError(fmt::format("Error to copy file. src: {}, dst: {}, error:{} ", src_path, dst_path,
-                                               std::strerror(Errno::no())));
+                                               st.get_error_msg()));
         }
     }
     for (int i = 0; i < num_delete_files(); ++i) {
@@ -275,11 +275,10 @@ Status Rowset::copy_files_to(const std::string& dir) {
                 LOG(WARNING) << "Path already exist: " << dst_path;
                 return Status::AlreadyExist(fmt::format("Path already exist: {}", dst_path));
             }
-            if (!fs::copy_file(src_path, dst_path).ok()) {
-                LOG(WARNING) << "Error to copy file. src:" << src_path << ", dst:" << dst_path
-                             << ", errno=" << Errno::no();
+            if (Status st = fs::copy_local_file(src_path, dst_path, max_bytes_per_second); !st.ok()) {
+                LOG(WARNING) << "Error to copy file. src:" << src_path << ", dst:" << dst_path << ", error=" << st;
                 return Status::IOError(fmt::format("Error to copy file. src: {}, dst: {}, error:{} ", src_path,
-                                                   dst_path, std::strerror(Errno::no())));
+                                                   dst_path, st.get_error_msg()));
             }
         }
     }
@@ -347,8 +346,12 @@ Status Rowset::get_segment_iterators(const vectorized::Schema& schema, const Row
     seg_options.predicates = options.predicates;
     seg_options.predicates_for_zone_map = options.predicates_for_zone_map;
     seg_options.use_page_cache = options.use_page_cache;
+    seg_options.sequential_scan = options.sequential_scan;
     seg_options.profile = options.profile;
     seg_options.reader_type = options.reader_type;
+    if (options.reader_type == READER_QUERY) {
+        seg_options.read_heat = &_read_heat;
+    }
     seg_options.chunk_size = options.chunk_size;
     seg_options.global_dictmaps = options.global_dictmaps;
     seg_options.unused_output_column_ids = options.unused_output_column_ids;
@@ -364,6 +367,7 @@ Status Rowset::get_segment_iterators(const vectorized::Schema& schema, const Row
     }
     seg_options.rowid_range_option = options.rowid_range_option;
     seg_options.short_key_ranges = options.short_key_ranges;
+    seg_options.runtime_range_pruner = options.runtime_range_pruner;
 
     auto segment_schema = schema;
     // Append the columns with delete condition to segment schema.
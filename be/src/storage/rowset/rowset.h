@@ -33,6 +33,7 @@
 #include "runtime/mem_tracker.h"
 #include "storage/olap_common.h"
 #include "storage/olap_define.h"
+#include "storage/read_heat.h"
 #include "storage/rowset/rowset_meta.h"
 #include "storage/rowset/segment.h"
 
@@ -162,6 +163,9 @@ public:
 
     std::vector<SegmentSharedPtr>& segments() { return _segments; }
 
+    // The reads of the segments of this rowset by the queries.
+    ReadHeat& read_heat() { return _read_heat; }
+
     // only used for updatable tablets' rowset
     // simply get iterators to iterate all rows without complex options like predicates
     // |schema| read schema
@@ -246,10 +250,11 @@ public:
     }
 
     // hard link all files in this rowset to `dir` to form a new rowset with id `new_rowset_id`.
-    Status link_files_to(const std::string& dir, RowsetId new_rowset_id);
+    // The segment i is linked as the segment `segment_offset + i` of the new rowset.
+    Status link_files_to(const std::string& dir, RowsetId new_rowset_id, int segment_offset = 0);
 
-    // copy all files to `dir`
-    Status copy_files_to(const std::string& dir);
+    // copy all files to `dir`, at most `max_bytes_per_second` bytes per second if it is positive
+    Status copy_files_to(const std::string& dir, int64_t max_bytes_per_second = 0);
 
     static std::string segment_file_path(const std::string& segment_dir, const RowsetId& rowset_id, int segment_id);
     static std::string segment_temp_file_path(const std::string& dir, const RowsetId& rowset_id, int segment_id);
@@ -352,6 +357,7 @@ protected:
 
 private:
     std::vector<SegmentSharedPtr> _segments;
+    ReadHeat _read_heat;
 };
 
 class RowsetReleaseGuard {
@@ -25,6 +25,7 @@ class ColumnPredicate;
 class DeletePredicates;
 struct RowidRangeOption;
 struct ShortKeyRangeOption;
+class RuntimeRangePruner;
 
 } // namespace vectorized
 
@@ -57,12 +58,15 @@ public:
     RuntimeState* runtime_state = nullptr;
     RuntimeProfile* profile = nullptr;
     bool use_page_cache = false;
+    bool sequential_scan = false;
 
     vectorized::ColumnIdToGlobalDictMap* global_dictmaps = &vectorized::EMPTY_GLOBAL_DICTMAPS;
     const std::unordered_set<uint32_t>* unused_output_column_ids = nullptr;
 
     RowidRangeOptionPtr rowid_range_option = nullptr;
     std::vector<ShortKeyRangeOptionPtr> short_key_ranges;
+
+    vectorized::RuntimeRangePruner* runtime_range_pruner = nullptr;
 };
 
 } // namespace starrocks
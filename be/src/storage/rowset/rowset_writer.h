@@ -29,8 +29,14 @@
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_writer_context.h"
 
+namespace butil {
+class IOBuf;
+}
+
 namespace starrocks {
 
+class SegmentPB;
+
 namespace vectorized {
 class Chunk;
 class Column;
@@ -117,6 +123,18 @@ public:
     // return nullptr when failed
     virtual StatusOr<RowsetSharedPtr> build() = 0;
 
+    // Write a segment file or a delete file of the rowset built by the primary replica, whose content
+    // is |data|. The files must be written in the order of the segment ids.
+    virtual Status flush_segment(const SegmentPB& segment, const butil::IOBuf& data) {
+        return Status::NotSupported("RowsetWriter::flush_segment");
+    }
+
+    // Build the rowset of the files written by flush_segment(), |primary_meta| is the meta of the rowset
+    // built by the primary replica.
+    virtual StatusOr<RowsetSharedPtr> build_replica(const RowsetMetaPB& primary_meta) {
+        return Status::NotSupported("RowsetWriter::build_replica");
+    }
+
     virtual Version version() = 0;
 
     virtual int64_t num_rows() = 0;
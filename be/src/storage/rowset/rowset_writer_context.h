@@ -21,13 +21,17 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "fs/fs.h"
 #include "gen_cpp/olap_file.pb.h"
+#include "gen_cpp/segment.pb.h"
 #include "runtime/global_dict/types_fwd_decl.h"
 #include "storage/type_utils.h"
 
 namespace starrocks {
 
+class GroupCommitSyncer;
 class TabletSchema;
 
 enum RowsetWriterType { kHorizontal = 0, kVertical = 1 };
@@ -68,7 +72,15 @@ public:
 
     vectorized::GlobalDictByNameMaps* global_dicts = nullptr;
 
+    // The encodings of the string columns by unique id which are known already, e.g. the ones shared by the
+    // inputs of a compaction, so the segment writers use them instead of speculating on the data.
+    std::unordered_map<uint32_t, EncodingTypePB> string_encodings;
+
     RowsetWriterType writer_type = kHorizontal;
+
+    // If set, the files of the rowset are closed without sync and made durable together with the files of the
+    // other writers of the data dir by one round of |file_syncer| when the rowset is built.
+    GroupCommitSyncer* file_syncer = nullptr;
 };
 
 } // namespace starrocks
@@ -21,6 +21,9 @@
 
 #include "storage/rowset/scalar_column_iterator.h"
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "storage/rowset/binary_dict_page.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/encoding_info.h"
@@ -292,11 +295,77 @@ Status ScalarColumnIterator::_do_init_dict_decoder() {
     return Status::OK();
 }
 
+// Whether any row in [begin, end) is in |range|.
+static bool overlaps(const vectorized::SparseRange& range, ordinal_t begin, ordinal_t end) {
+    size_t lo = 0;
+    size_t hi = range.size();
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (range[mid].end() <= begin) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo < range.size() && range[lo].begin() < end;
+}
+
+Status ScalarColumnIterator::_read_page(const OrdinalPageIndexIterator& iter, PageHandle* handle, Slice* page_body,
+                                        PageFooterPB* footer) {
+    // Drop the pages skipped by seeking forward.
+    while (!_read_ahead_pages.empty() && _read_ahead_pages.front().first < iter.page_index()) {
+        _read_ahead_pages.pop_front();
+    }
+    if (!_read_ahead_pages.empty() && _read_ahead_pages.front().first == iter.page_index()) {
+        auto& page = _read_ahead_pages.front().second;
+        *handle = std::move(page.handle);
+        *page_body = page.body;
+        *footer = std::move(page.footer);
+        _read_ahead_pages.pop_front();
+        return Status::OK();
+    }
+    _read_ahead_pages.clear();
+
+    const int32_t num_pages = config::column_page_read_ahead_num;
+    if (num_pages <= 1) {
+        return _reader->read_page(_opts, iter.page(), handle, page_body, footer);
+    }
+
+    // Collect the page of |iter| and the following pages with rows to read.
+    const vectorized::SparseRange* range = _opts.read_ahead_range;
+    std::vector<int32_t> page_indexes;
+    std::vector<PagePointer> page_pointers;
+    for (OrdinalPageIndexIterator it = iter; it.valid() && page_pointers.size() < static_cast<size_t>(num_pages);
+         it.next()) {
+        if (!page_pointers.empty() && range != nullptr) {
+            if (range->empty() || it.first_ordinal() >= range->end()) {
+                break;
+            }
+            if (!overlaps(*range, it.first_ordinal(), it.last_ordinal() + 1)) {
+                continue;
+            }
+        }
+        page_indexes.push_back(it.page_index());
+        page_pointers.push_back(it.page());
+    }
+
+    std::vector<PageIO::ReadPage> pages;
+    RETURN_IF_ERROR(_reader->read_pages(_opts, page_pointers,
+                                        std::max<int64_t>(0, config::column_page_read_ahead_max_gap_bytes), &pages));
+    *handle = std::move(pages[0].handle);
+    *page_body = pages[0].body;
+    *footer = std::move(pages[0].footer);
+    for (size_t i = 1; i < pages.size(); i++) {
+        _read_ahead_pages.emplace_back(page_indexes[i], std::move(pages[i]));
+    }
+    return Status::OK();
+}
+
 Status ScalarColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter) {
     PageHandle handle;
     Slice page_body;
     PageFooterPB footer;
-    RETURN_IF_ERROR(_reader->read_page(_opts, iter.page(), &handle, &page_body, &footer));
+    RETURN_IF_ERROR(_read_page(iter, &handle, &page_body, &footer));
     RETURN_IF_ERROR(parse_page(&_page, std::move(handle), page_body, footer.data_page_footer(),
                                _reader->encoding_info(), iter.page(), iter.page_index()));
 
@@ -324,6 +393,15 @@ Status ScalarColumnIterator::get_row_ranges_by_zone_map(
     return Status::OK();
 }
 
+Status ScalarColumnIterator::get_row_ranges_by_dict_code_zone_map(
+        const std::vector<const vectorized::ColumnPredicate*>& predicates, vectorized::SparseRange* row_ranges) {
+    RETURN_IF(!_reader->has_dict_code_zone_map() || predicates.empty(), Status::OK());
+    vectorized::SparseRange dict_code_row_ranges;
+    RETURN_IF_ERROR(_reader->dict_code_zone_map_filter(predicates, &dict_code_row_ranges));
+    *row_ranges = row_ranges->intersection(dict_code_row_ranges);
+    return Status::OK();
+}
+
 Status ScalarColumnIterator::get_row_ranges_by_bloom_filter(
         const std::vector<const vectorized::ColumnPredicate*>& predicates, vectorized::SparseRange* row_ranges) {
     RETURN_IF(!_reader->has_bloom_filter_index(), Status::OK());
@@ -336,6 +414,18 @@ Status ScalarColumnIterator::get_row_ranges_by_bloom_filter(
     return Status::OK();
 }
 
+Status ScalarColumnIterator::get_row_ranges_by_ngram_bloom_filter(
+        const std::vector<const vectorized::ColumnPredicate*>& predicates, vectorized::SparseRange* row_ranges) {
+    RETURN_IF(!_reader->has_ngram_bloom_filter_index(), Status::OK());
+    bool support = false;
+    for (const auto* pred : predicates) {
+        support = support | pred->support_ngram_bloom_filter();
+    }
+    RETURN_IF(!support, Status::OK());
+    RETURN_IF_ERROR(_reader->ngram_bloom_filter(predicates, row_ranges));
+    return Status::OK();
+}
+
 int ScalarColumnIterator::dict_lookup(const Slice& word) {
     DCHECK(all_page_dict_encoded());
     return (this->*_dict_lookup_func)(word);
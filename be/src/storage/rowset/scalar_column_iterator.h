@@ -21,11 +21,15 @@
 
 #pragma once
 
+#include <deque>
+#include <utility>
+
 #include "column/fixed_length_column.h"
 #include "storage/range.h"
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/ordinal_page_index.h"
 #include "storage/rowset/page_handle.h"
+#include "storage/rowset/page_io.h"
 #include "storage/rowset/parsed_page.h"
 
 namespace starrocks {
@@ -59,6 +63,12 @@ public:
     Status get_row_ranges_by_bloom_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
                                           vectorized::SparseRange* range) override;
 
+    Status get_row_ranges_by_ngram_bloom_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                                vectorized::SparseRange* range) override;
+
+    Status get_row_ranges_by_dict_code_zone_map(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                                vectorized::SparseRange* range) override;
+
     bool all_page_dict_encoded() const override { return _all_dict_encoded; }
 
     Status fetch_all_dict_words(std::vector<Slice>* words) const override;
@@ -113,6 +123,10 @@ private:
 
     Status _load_dict_page();
 
+    // Read the page of |iter|, and read ahead the following pages to be read in the same I/O.
+    Status _read_page(const OrdinalPageIndexIterator& iter, PageHandle* handle, Slice* page_body,
+                      PageFooterPB* footer);
+
     bool _contains_deleted_row(uint32_t page_index) const;
 
     ColumnReader* _reader;
@@ -136,6 +150,9 @@ private:
     // current value ordinal
     ordinal_t _current_ordinal = 0;
 
+    // The pages read ahead but not used yet, in the order of page index.
+    std::deque<std::pair<int32_t, PageIO::ReadPage>> _read_ahead_pages;
+
     // page indexes those are DEL_PARTIAL_SATISFIED
     std::unordered_set<uint32_t> _delete_partial_satisfied_pages;
 
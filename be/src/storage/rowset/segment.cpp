@@ -38,6 +38,7 @@
 #include "segment_iterator.h"
 #include "segment_options.h"
 #include "storage/column_predicate_rewriter.h"
+#include "storage/rowset/cast_column_iterator.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/default_value_column_iterator.h"
 #include "storage/rowset/page_io.h"
@@ -214,7 +215,10 @@ StatusOr<ChunkIteratorPtr> Segment::_new_iterator(const vectorized::Schema& sche
     // trying to prune the current segment by segment-level zone map
     for (const auto& pair : read_options.predicates_for_zone_map) {
         ColumnId column_id = pair.first;
-        if (_column_readers[column_id] == nullptr || !_column_readers[column_id]->has_zone_map()) {
+        const auto* reader = _column_readers[column_id].get();
+        // The zone map of a widened column is of the stored type.
+        if (reader == nullptr || !reader->has_zone_map() ||
+            CastColumnIterator::is_widening(reader->column_type(), _tablet_schema->column(column_id).type())) {
             continue;
         }
         if (!_column_readers[column_id]->segment_zone_map_filter(pair.second)) {
@@ -351,14 +355,24 @@ Status Segment::new_column_iterator(uint32_t cid, ColumnIterator** iter) {
         *iter = default_value_iter.release();
         return Status::OK();
     }
-    return _column_readers[cid]->new_iterator(iter);
+    RETURN_IF_ERROR(_column_readers[cid]->new_iterator(iter));
+    return CastColumnIterator::wrap(*this, cid, iter);
 }
 
 Status Segment::new_bitmap_index_iterator(uint32_t cid, BitmapIndexIterator** iter) {
-    if (_column_readers[cid] != nullptr && _column_readers[cid]->has_bitmap_index()) {
+    // The dictionary of the bitmap index is of the stored type.
+    if (_column_readers[cid] != nullptr && _column_readers[cid]->has_bitmap_index() &&
+        !CastColumnIterator::is_widening(_column_readers[cid]->column_type(), _tablet_schema->column(cid).type())) {
         return _column_readers[cid]->new_bitmap_index_iterator(iter);
     }
     return Status::OK();
 }
 
+Status Segment::new_inverted_index_iterator(uint32_t cid, BitmapIndexIterator** iter) {
+    if (_column_readers[cid] != nullptr && _column_readers[cid]->has_inverted_index()) {
+        return _column_readers[cid]->new_inverted_index_iterator(iter);
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -107,8 +107,13 @@ public:
 
     Status new_bitmap_index_iterator(uint32_t cid, BitmapIndexIterator** iter);
 
+    // |*iter| is nullptr if the column has no inverted index.
+    Status new_inverted_index_iterator(uint32_t cid, BitmapIndexIterator** iter);
+
     size_t num_short_keys() const { return _tablet_schema->num_short_key_columns(); }
 
+    const TabletSchema& tablet_schema() const { return *_tablet_schema; }
+
     uint32_t num_rows_per_block() const {
         DCHECK(invoked(_load_index_once));
         return _sk_index_decoder->num_rows_per_block();
@@ -27,9 +27,11 @@
 #include "storage/column_or_predicate.h"
 #include "storage/column_predicate_rewriter.h"
 #include "storage/del_vector.h"
+#include "storage/delta_column_group.h"
 #include "storage/projection_iterator.h"
 #include "storage/range.h"
 #include "storage/roaring2range.h"
+#include "storage/runtime_range_pruner.h"
 #include "storage/rowset/bitmap_index_reader.h"
 #include "storage/rowset/column_decoder.h"
 #include "storage/rowset/column_reader.h"
@@ -196,6 +198,10 @@ private:
     Status _get_row_ranges_by_zone_map();
     Status _get_row_ranges_by_bloom_filter();
     Status _get_row_ranges_by_rowid_range();
+    // Prune the data pages by the zone maps of the dictionary codes and the rewritten predicates.
+    Status _get_row_ranges_by_dict_code_zone_map();
+    // Prune the unread rows by the zone maps of the runtime filters arrived after the scan started.
+    Status _prune_range_by_runtime_filters();
 
     uint32_t segment_id() const { return _segment->id(); }
     uint32_t num_rows() const { return _segment->num_rows(); }
@@ -243,8 +249,16 @@ private:
 
     Status _apply_bitmap_index();
 
+    Status _apply_inverted_index();
+
     Status _apply_del_vector();
 
+    // Whether the column |cid| is updated by the delta column groups, whose indexes are stale.
+    bool _has_delta_column(ColumnId cid) const {
+        return !_dcgs.empty() &&
+               is_column_updated(_dcgs, static_cast<uint32_t>(_segment->tablet_schema().column(cid).unique_id()));
+    }
+
     Status _read(Chunk* chunk, vector<rowid_t>* rowid, size_t n);
 
     Status _read_by_column(size_t n, Chunk* result, vector<rowid_t>* rowids);
@@ -259,7 +273,8 @@ private:
     std::vector<BitmapIndexIterator*> _bitmap_index_iterators;
 
     DelVectorPtr _del_vec;
-    roaring_uint32_iterator_t _roaring_iter;
+    // the delta column groups of this segment visible at _opts.version, in the ascending order of version.
+    DeltaColumnGroupList _dcgs;
 
     std::unique_ptr<RandomAccessFile> _rfile;
 
@@ -294,7 +309,12 @@ private:
 
     int _late_materialization_ratio = 0;
 
+    // the number of the arrived runtime filters of |_opts.runtime_range_pruner| applied.
+    size_t _num_applied_runtime_filters = 0;
+
     bool _inited = false;
+    // The bytes read by this iterator, the stats may be shared with the other iterators of the same reader.
+    int64_t _bytes_read = 0;
     bool _has_bitmap_index = false;
 
     bool _context_switch_next_time = false;
@@ -310,7 +330,14 @@ SegmentIterator::SegmentIterator(std::shared_ptr<Segment> segment, vectorized::S
 
 Status SegmentIterator::_init() {
     SCOPED_RAW_TIMER(&_opts.stats->segment_init_ns);
-    if (_opts.is_primary_keys && _opts.version > 0) {
+    if (_opts.del_vec != nullptr) {
+        if (!_opts.del_vec->empty()) {
+            _del_vec = _opts.del_vec;
+        }
+        if (_del_vec && _segment->num_rows() == _del_vec->cardinality()) {
+            return Status::EndOfFile("all rows deleted");
+        }
+    } else if (_opts.is_primary_keys && _opts.version > 0) {
         TabletSegmentId tsid;
         tsid.tablet_id = _opts.tablet_id;
         tsid.segment_id = _opts.rowset_id + segment_id();
@@ -326,8 +353,9 @@ Status SegmentIterator::_init() {
             VLOG(1) << "seg_iter init delvec tablet:" << _opts.tablet_id << " rowset:" << _opts.rowset_id
                     << " seg:" << segment_id() << " version req:" << _opts.version << " actual:" << _del_vec->version()
                     << " " << _del_vec->cardinality() << "/" << _segment->num_rows();
-            roaring_init_iterator(&_del_vec->roaring()->roaring, &_roaring_iter);
         }
+        RETURN_IF_ERROR(StorageEngine::instance()->update_manager()->get_delta_column_groups(_opts.meta, tsid,
+                                                                                             _opts.version, &_dcgs));
     }
 
     if (config::enable_segment_overflow_read_chunk) {
@@ -340,7 +368,9 @@ Status SegmentIterator::_init() {
 
     StarRocksMetrics::instance()->segment_read_total.increment(1);
     // get file handle from file descriptor of segment
-    ASSIGN_OR_RETURN(_rfile, _opts.fs->new_random_access_file(_segment->file_name()));
+    RandomAccessFileOptions rfile_opts;
+    rfile_opts.use_mmap = config::enable_segment_mmap_read;
+    ASSIGN_OR_RETURN(_rfile, _opts.fs->new_random_access_file(rfile_opts, _segment->file_name()));
 
     /// the calling order matters, do not change unless you know why.
 
@@ -356,11 +386,13 @@ Status SegmentIterator::_init() {
     RETURN_IF_ERROR(_get_row_ranges_by_rowid_range());
     RETURN_IF_ERROR(_apply_del_vector());
     RETURN_IF_ERROR(_apply_bitmap_index());
+    RETURN_IF_ERROR(_apply_inverted_index());
     RETURN_IF_ERROR(_get_row_ranges_by_zone_map());
     RETURN_IF_ERROR(_get_row_ranges_by_bloom_filter());
     // rewrite stage
     // Rewriting predicates using segment dictionary codes
     RETURN_IF_ERROR(_rewrite_predicates());
+    RETURN_IF_ERROR(_get_row_ranges_by_dict_code_zone_map());
     RETURN_IF_ERROR(_init_context());
     _init_column_predicates();
     _range_iter = _scan_range.new_iterator();
@@ -398,14 +430,19 @@ Status SegmentIterator::_init_column_iterators(const Schema& schema) {
             }
 
             RETURN_IF_ERROR(_segment->new_column_iterator(cid, &_column_iterators[cid]));
+            if (!_dcgs.empty()) {
+                RETURN_IF_ERROR(DeltaColumnIterator::wrap(*_segment, cid, _dcgs, &_column_iterators[cid]));
+            }
 
             _obj_pool.add(_column_iterators[cid]);
             ColumnIteratorOptions iter_opts;
             iter_opts.stats = _opts.stats;
             iter_opts.use_page_cache = _opts.use_page_cache;
+            iter_opts.sequential_scan = _opts.sequential_scan;
             iter_opts.read_file = _rfile.get();
             iter_opts.check_dict_encoding = check_dict_enc;
             iter_opts.reader_type = _opts.reader_type;
+            iter_opts.read_ahead_range = &_scan_range;
             RETURN_IF_ERROR(_column_iterators[cid]->init(iter_opts));
 
             if constexpr (check_global_dict) {
@@ -588,6 +625,51 @@ Status SegmentIterator::_get_row_ranges_by_zone_map() {
     return Status::OK();
 }
 
+Status SegmentIterator::_get_row_ranges_by_dict_code_zone_map() {
+    std::vector<const ColumnPredicate*> code_preds;
+    for (const auto& [cid, preds] : _opts.predicates) {
+        if (_scan_range.empty()) {
+            break;
+        }
+        if (!_predicate_need_rewrite[cid]) {
+            continue;
+        }
+        code_preds.clear();
+        for (const ColumnPredicate* pred : preds) {
+            if (pred->type_info()->type() == kDictCodeType) {
+                code_preds.emplace_back(pred);
+            }
+        }
+        size_t prev_size = _scan_range.span_size();
+        RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_dict_code_zone_map(code_preds, &_scan_range));
+        _opts.stats->rows_stats_filtered += (prev_size - _scan_range.span_size());
+    }
+    return Status::OK();
+}
+
+Status SegmentIterator::_prune_range_by_runtime_filters() {
+    if (_opts.runtime_range_pruner == nullptr) {
+        return Status::OK();
+    }
+    return _opts.runtime_range_pruner->update_range_if_arrived(
+            &_num_applied_runtime_filters, [this](ColumnId cid, const PredicateList& preds) -> Status {
+                if (cid >= _column_iterators.size() || _column_iterators[cid] == nullptr) {
+                    return Status::OK();
+                }
+                SparseRange zm_range;
+                RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(preds, nullptr, &zm_range));
+                // Only the unread rows are pruned.
+                SparseRange unread_range;
+                SparseRangeIterator iter = _range_iter;
+                iter.next_range(_scan_range.end() - iter.begin(), &unread_range);
+                size_t prev_size = unread_range.span_size();
+                _scan_range = unread_range.intersection(zm_range);
+                _range_iter = _scan_range.new_iterator();
+                _opts.stats->rows_stats_filtered += (prev_size - _scan_range.span_size());
+                return Status::OK();
+            });
+}
+
 // if |lower| is true, return the first row in the range [0, end) that is not less than |key|,
 // or end if no such row is found.
 // if |lower| is false, return the first row in the range [0, end) that is greater than |key|,
@@ -775,10 +857,12 @@ Status SegmentIterator::do_get_next(Chunk* chunk) {
 
     DCHECK_EQ(0, chunk->num_rows());
 
+    const int64_t prev_bytes_read = _opts.stats->bytes_read;
     Status st;
     do {
         st = _do_get_next(chunk, nullptr);
     } while (st.ok() && chunk->num_rows() == 0);
+    _bytes_read += _opts.stats->bytes_read - prev_bytes_read;
     return st;
 }
 
@@ -790,10 +874,12 @@ Status SegmentIterator::do_get_next(Chunk* chunk, vector<uint32_t>* rowid) {
 
     DCHECK_EQ(0, chunk->num_rows());
 
+    const int64_t prev_bytes_read = _opts.stats->bytes_read;
     Status st;
     do {
         st = _do_get_next(chunk, rowid);
     } while (st.ok() && chunk->num_rows() == 0);
+    _bytes_read += _opts.stats->bytes_read - prev_bytes_read;
     return st;
 }
 
@@ -831,6 +917,10 @@ Status SegmentIterator::_do_get_next(Chunk* result, vector<rowid_t>* rowid) {
 
     if (LIKELY(!_context_switch_next_time)) {
         while ((chunk_start < chunk_capacity) & _range_iter.has_more()) {
+            RETURN_IF_ERROR(_prune_range_by_runtime_filters());
+            if (!_range_iter.has_more()) {
+                break;
+            }
             if (config::enable_segment_overflow_read_chunk) {
                 RETURN_IF_ERROR(_read(chunk, rowid, std::max(chunk_capacity - chunk_start, chunk_capacity / 4)));
             } else {
@@ -1389,6 +1479,22 @@ Status SegmentIterator::_finish_late_materialization(ScanContext* ctx) {
     ColumnPtr rowid_column = ctx->_dict_chunk->get_column_by_index(m - 1);
     const auto* ordinals = down_cast<FixedLengthColumn<rowid_t>*>(rowid_column.get());
 
+    // The ordinals are ascending, merge the consecutive ones into ranges.
+    const bool read_by_range = config::enable_late_materialization_by_range;
+    SparseRange range;
+    if (read_by_range) {
+        const auto& rowids = ordinals->get_data();
+        size_t i = 0;
+        while (i < rowids.size()) {
+            size_t j = i + 1;
+            while (j < rowids.size() && rowids[j] == rowids[j - 1] + 1) {
+                j++;
+            }
+            range.add(Range(rowids[i], rowids[j - 1] + 1));
+            i = j;
+        }
+    }
+
     const size_t n = _schema.num_fields();
     const size_t start_pos = ctx->_read_index_map.size();
     for (size_t i = m - 1, j = start_pos; i < n; i++, j++) {
@@ -1398,7 +1504,12 @@ Status SegmentIterator::_finish_late_materialization(ScanContext* ctx) {
         col->reserve(ordinals->size());
         col->resize(0);
 
-        RETURN_IF_ERROR(_column_decoders[cid].decode_values_by_rowid(*ordinals, col.get()));
+        // The global dict iterators decode the codes only when fetching by rowid.
+        if (read_by_range && !_can_using_global_dict(f)) {
+            RETURN_IF_ERROR(_column_decoders[cid].decode_values_by_range(range, col.get()));
+        } else {
+            RETURN_IF_ERROR(_column_decoders[cid].decode_values_by_rowid(*ordinals, col.get()));
+        }
         DCHECK_EQ(ordinals->size(), col->size());
         may_has_del_row |= (col->delete_state() != DEL_NOT_SATISFIED);
     }
@@ -1442,7 +1553,7 @@ Status SegmentIterator::_init_bitmap_index_iterators() {
     _bitmap_index_iterators.resize(ChunkHelper::max_column_id(_schema) + 1, nullptr);
     for (const auto& pair : _opts.predicates) {
         ColumnId cid = pair.first;
-        if (_bitmap_index_iterators[cid] == nullptr) {
+        if (_bitmap_index_iterators[cid] == nullptr && !_has_delta_column(cid)) {
             RETURN_IF_ERROR(_segment->new_bitmap_index_iterator(cid, &_bitmap_index_iterators[cid]));
             _has_bitmap_index |= (_bitmap_index_iterators[cid] != nullptr);
         }
@@ -1476,18 +1587,20 @@ Status SegmentIterator::_apply_bitmap_index() {
         }
         size_t cardinality = bitmap_iter->bitmap_nums();
         SparseRange selected(0, cardinality);
-        bool has_is_null = false;
         for (const ColumnPredicate* pred : pred_list) {
             SparseRange r;
+            // The ORs, INs and NOT INs are resolved to the union and the complement of the entries of their
+            // values here, the predicates not supporting bitmap index are evaluated on the data.
             Status st = pred->seek_bitmap_dictionary(bitmap_iter, &r);
             if (st.ok()) {
                 selected &= r;
                 erased_preds.emplace_back(pred);
-                has_is_null |= (pred->type() == PredicateType::kIsNull);
             } else if (!st.is_cancelled()) {
                 return st;
             }
         }
+        // The null entry is the last one of the dictionary, only selected by IS NULL or an OR containing it.
+        bool has_is_null = bitmap_iter->has_null_bitmap() && !selected.empty() && selected.end() == cardinality;
         if (selected.empty()) {
             _opts.stats->rows_bitmap_index_filtered += _scan_range.span_size();
             _scan_range.clear();
@@ -1545,14 +1658,65 @@ Status SegmentIterator::_apply_bitmap_index() {
     return Status::OK();
 }
 
-Status SegmentIterator::_apply_del_vector() {
-    if (_opts.is_primary_keys && _opts.version > 0 && _del_vec && !_del_vec->empty()) {
+// filter rows by the tokens every satisfying value of the column predicates contains, using inverted indexes.
+// the selected rows are a superset of the result, so the predicates are kept.
+Status SegmentIterator::_apply_inverted_index() {
+    RETURN_IF(_scan_range.empty(), Status::OK());
+    for (const auto& [cid, pred_list] : _opts.predicates) {
+        std::vector<std::string> tokens;
+        for (const ColumnPredicate* pred : pred_list) {
+            pred->get_inverted_index_tokens(&tokens);
+        }
+        if (tokens.empty() || _has_delta_column(cid)) {
+            continue;
+        }
+        BitmapIndexIterator* raw_iter = nullptr;
+        RETURN_IF_ERROR(_segment->new_inverted_index_iterator(cid, &raw_iter));
+        if (raw_iter == nullptr) {
+            continue;
+        }
+        std::unique_ptr<BitmapIndexIterator> inverted_iter(raw_iter);
+        SCOPED_RAW_TIMER(&_opts.stats->bitmap_index_filter_timer);
+        std::sort(tokens.begin(), tokens.end());
+        tokens.erase(std::unique(tokens.begin(), tokens.end()), tokens.end());
+
         Roaring row_bitmap = range2roaring(_scan_range);
         size_t input_rows = row_bitmap.cardinality();
-        row_bitmap -= *(_del_vec->roaring());
-        _scan_range = roaring2range(row_bitmap);
-        size_t filtered_rows = row_bitmap.cardinality();
-        _opts.stats->rows_del_vec_filtered += input_rows - filtered_rows;
+        for (const std::string& token : tokens) {
+            Slice value(token);
+            bool exact_match = false;
+            Status st = inverted_iter->seek_dictionary(&value, &exact_match);
+            if (st.is_not_found() || (st.ok() && !exact_match)) {
+                row_bitmap = Roaring();
+            } else if (!st.ok()) {
+                return st;
+            } else {
+                Roaring roaring;
+                RETURN_IF_ERROR(inverted_iter->read_bitmap(inverted_iter->current_ordinal(), &roaring));
+                row_bitmap &= roaring;
+            }
+            if (row_bitmap.isEmpty()) {
+                break;
+            }
+        }
+        if (row_bitmap.cardinality() < input_rows) {
+            _scan_range = roaring2range(row_bitmap);
+            _opts.stats->rows_bitmap_index_filtered += input_rows - _scan_range.span_size();
+        }
+        if (_scan_range.empty()) {
+            break;
+        }
+    }
+    return Status::OK();
+}
+
+Status SegmentIterator::_apply_del_vector() {
+    if (_del_vec && !_del_vec->empty()) {
+        // The deleted rows are excluded from the scan range, so their pages are skipped by the readers of all the
+        // columns, including the ones read after the predicates.
+        size_t input_rows = _scan_range.span_size();
+        _scan_range = subtract_roaring(_scan_range, *(_del_vec->roaring()));
+        _opts.stats->rows_del_vec_filtered += input_rows - _scan_range.span_size();
     }
     return Status::OK();
 }
@@ -1563,6 +1727,7 @@ Status SegmentIterator::_get_row_ranges_by_bloom_filter() {
     for (const auto& [cid, preds] : _opts.predicates) {
         ColumnIterator* column_iter = _column_iterators[cid];
         RETURN_IF_ERROR(column_iter->get_row_ranges_by_bloom_filter(preds, &_scan_range));
+        RETURN_IF_ERROR(column_iter->get_row_ranges_by_ngram_bloom_filter(preds, &_scan_range));
     }
     _opts.stats->rows_bf_filtered += prev_size - _scan_range.span_size();
     return Status::OK();
@@ -1578,6 +1743,10 @@ Status SegmentIterator::_get_row_ranges_by_rowid_range() {
 }
 
 void SegmentIterator::close() {
+    if (_opts.read_heat != nullptr && _inited) {
+        _opts.read_heat->record(_bytes_read);
+        _opts.read_heat = nullptr;
+    }
     _context_list[0].close();
     _context_list[1].close();
     _obj_pool.clear();
@@ -30,9 +30,11 @@ Status SegmentReadOptions::convert_to(SegmentReadOptions* dst, const std::vector
     dst->fs = fs;
     dst->stats = stats;
     dst->use_page_cache = use_page_cache;
+    dst->sequential_scan = sequential_scan;
     dst->profile = profile;
     dst->global_dictmaps = global_dictmaps;
     dst->rowid_range_option = rowid_range_option;
+    dst->read_heat = read_heat;
     dst->short_key_ranges = short_key_ranges;
 
     return Status::OK();
@@ -14,9 +14,11 @@
 namespace starrocks {
 class Condition;
 struct OlapReaderStatistics;
+class ReadHeat;
 class RuntimeProfile;
 class TabletSchema;
 class KVStore;
+class DelVector;
 } // namespace starrocks
 
 namespace starrocks::vectorized {
@@ -26,6 +28,7 @@ struct RowidRangeOption;
 using RowidRangeOptionPtr = std::shared_ptr<RowidRangeOption>;
 struct ShortKeyRangeOption;
 using ShortKeyRangeOptionPtr = std::shared_ptr<ShortKeyRangeOption>;
+class RuntimeRangePruner;
 
 class SegmentReadOptions {
 public:
@@ -46,6 +49,8 @@ public:
     uint32_t rowset_id = 0;
     int64_t version = 0;
     KVStore* meta = nullptr;
+    // The delete vector given by the caller rather than loaded from |meta|, e.g. of the lake tablets.
+    std::shared_ptr<DelVector> del_vec;
 
     // REQUIRED (null is not allowed)
     OlapReaderStatistics* stats = nullptr;
@@ -53,6 +58,7 @@ public:
     RuntimeProfile* profile = nullptr;
 
     bool use_page_cache = false;
+    bool sequential_scan = false;
 
     ReaderType reader_type = READER_QUERY;
     int chunk_size = DEFAULT_CHUNK_SIZE;
@@ -65,6 +71,13 @@ public:
     RowidRangeOptionPtr rowid_range_option = nullptr;
     std::vector<ShortKeyRangeOptionPtr> short_key_ranges;
 
+    // Not copied by convert_to(), the runtime filters are of the types of the latest schema.
+    RuntimeRangePruner* runtime_range_pruner = nullptr;
+
+    // The read heat of the rowset a query scans, which the segment iterator records a read and its bytes into when
+    // closed. nullptr if not recorded, e.g. by the compactions.
+    ReadHeat* read_heat = nullptr;
+
 public:
     Status convert_to(SegmentReadOptions* dst, const std::vector<FieldType>& new_types, ObjectPool* obj_pool) const;
 
@@ -26,6 +26,7 @@
 #include "column/chunk.h"
 #include "column/datum_tuple.h"
 #include "column/nullable_column.h"
+#include "common/config.h"
 #include "common/logging.h" // LOG
 #include "fs/fs.h"          // FileSystem
 #include "gen_cpp/segment.pb.h"
@@ -51,6 +52,29 @@ SegmentWriter::SegmentWriter(std::unique_ptr<WritableFile> wfile, uint32_t segme
 
 SegmentWriter::~SegmentWriter() {}
 
+// The encoding of the column chosen by the segment writer, DEFAULT_ENCODING to leave the choice to
+// the column writer.
+static EncodingTypePB preferred_encoding(uint32_t column_index, const TabletColumn& column) {
+    switch (column.type()) {
+    case OLAP_FIELD_TYPE_INT:
+    case OLAP_FIELD_TYPE_BIGINT:
+    case OLAP_FIELD_TYPE_DATE_V2:
+    case OLAP_FIELD_TYPE_DATETIME:
+    case OLAP_FIELD_TYPE_TIMESTAMP:
+        // The rows of a segment are sorted by the key columns, so the values of the first key column are
+        // non-decreasing, their deltas are small and regular.
+        if (config::enable_delta_encoding_for_sort_key && column_index == 0 && column.is_key()) {
+            return DELTA_ENCODING;
+        }
+        return DEFAULT_ENCODING;
+    case OLAP_FIELD_TYPE_FLOAT:
+    case OLAP_FIELD_TYPE_DOUBLE:
+        return config::enable_alp_encoding_for_float ? ALP_ENCODING : DEFAULT_ENCODING;
+    default:
+        return DEFAULT_ENCODING;
+    }
+}
+
 void SegmentWriter::_init_column_meta(ColumnMetaPB* meta, uint32_t column_id, const TabletColumn& column) {
     meta->set_column_id(column_id);
     meta->set_unique_id(column.unique_id());
@@ -123,6 +147,12 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
         } else {
             _init_column_meta(opts.meta, column_index, column);
         }
+        if (auto encoding = preferred_encoding(column_index, column); encoding != DEFAULT_ENCODING) {
+            opts.meta->set_encoding(encoding);
+        }
+        if (auto iter = _opts.string_encodings.find(column.unique_id()); iter != _opts.string_encodings.end()) {
+            opts.meta->set_encoding(iter->second);
+        }
 
         // now we create zone map for key columns
         // and not support zone map for array type.
@@ -135,7 +165,13 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
             opts.need_zone_map = false;
         }
         opts.need_bloom_filter = column.is_bf_column();
+        opts.need_ngram_bloom_filter = column.is_bf_column() && config::ngram_bloom_filter_index_gram_num > 0 &&
+                                       (column.type() == FieldType::OLAP_FIELD_TYPE_CHAR ||
+                                        column.type() == FieldType::OLAP_FIELD_TYPE_VARCHAR);
         opts.need_bitmap_index = column.has_bitmap_index();
+        opts.need_inverted_index = opts.need_bitmap_index && config::enable_inverted_index_for_bitmap_index_columns &&
+                                   (column.type() == FieldType::OLAP_FIELD_TYPE_CHAR ||
+                                    column.type() == FieldType::OLAP_FIELD_TYPE_VARCHAR);
         if (column.type() == FieldType::OLAP_FIELD_TYPE_ARRAY) {
             if (opts.need_bloom_filter) {
                 return Status::NotSupported("Do not support bloom filter for array type");
@@ -242,6 +278,9 @@ Status SegmentWriter::finalize_footer(uint64_t* segment_file_size, uint64_t* foo
     }
     RETURN_IF_ERROR(_write_footer());
     *segment_file_size = _wfile->size();
+    if (_opts.start_writeback_on_close) {
+        RETURN_IF_ERROR(_wfile->flush(WritableFile::FLUSH_ASYNC));
+    }
     return _wfile->close();
 }
 
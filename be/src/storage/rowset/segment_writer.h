@@ -24,6 +24,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common/status.h"
@@ -53,6 +54,12 @@ struct SegmentWriterOptions {
     uint32_t num_rows_per_block = 1024;
     vectorized::GlobalDictByNameMaps* global_dicts = nullptr;
     std::vector<int32_t> referenced_column_ids;
+    // The encodings of the columns by unique id, which override the default ones, e.g. those of the string
+    // columns kept by compaction, see RowsetWriterContext::string_encodings.
+    std::unordered_map<uint32_t, EncodingTypePB> string_encodings;
+    // Start the writeback of the file without waiting before closing it, the file is synced by the rowset
+    // writer later, see RowsetWriterContext::file_syncer.
+    bool start_writeback_on_close = false;
 };
 
 // SegmentWriter is responsible for writing data into single segment by all or partital columns.
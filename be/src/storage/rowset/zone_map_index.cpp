@@ -23,6 +23,7 @@
 
 #include <bthread/sys_futex.h>
 
+#include "common/config.h"
 #include "runtime/mem_pool.h"
 #include "runtime/mem_tracker.h"
 #include "storage/column_block.h"
@@ -51,17 +52,69 @@ struct ZoneMap {
     // has_not_null means whether zone has none-null value
     bool has_not_null = false;
 
+    // The aggregates of the not-null values of the numeric columns. has_int_sum is reset if int_sum overflows.
+    bool has_not_null_count = false;
+    bool has_int_sum = false;
+    bool has_float_sum = false;
+    int64_t not_null_count = 0;
+    int64_t int_sum = 0;
+    double float_sum = 0;
+
     void to_proto(ZoneMapPB* dst, Field* field) const {
         dst->set_min(field->to_zone_map_string(min_value));
         dst->set_max(field->to_zone_map_string(max_value));
         dst->set_has_null(has_null);
         dst->set_has_not_null(has_not_null);
+        if (has_not_null_count) {
+            dst->set_not_null_count(not_null_count);
+        }
+        if (has_int_sum) {
+            dst->set_int_sum(int_sum);
+        }
+        if (has_float_sum) {
+            dst->set_float_sum(float_sum);
+        }
+    }
+
+    // Merge the aggregates of a page into the ones of the segment, which are kept only if all pages have them.
+    void merge_aggregates(const ZoneMap& page) {
+        has_not_null_count &= page.has_not_null_count;
+        has_int_sum &= page.has_int_sum && !__builtin_add_overflow(int_sum, page.int_sum, &int_sum);
+        has_float_sum &= page.has_float_sum;
+        not_null_count += page.not_null_count;
+        float_sum += page.float_sum;
     }
 };
 
+// Write the serialized ZoneMapPB of each data page as an IndexedColumn.
+static Status write_page_zone_maps(WritableFile* wfile, const std::vector<std::string>& values,
+                                   IndexedColumnMetaPB* meta) {
+    TypeInfoPtr typeinfo = get_type_info(OLAP_FIELD_TYPE_OBJECT);
+    IndexedColumnWriterOptions options;
+    options.write_ordinal_index = true;
+    options.write_value_index = false;
+    options.encoding = EncodingInfo::get_default_encoding(OLAP_FIELD_TYPE_OBJECT, false);
+    options.compression = NO_COMPRESSION; // currently not compressed
+
+    IndexedColumnWriter writer(options, typeinfo, wfile);
+    RETURN_IF_ERROR(writer.init());
+
+    for (auto& value : values) {
+        Slice value_slice(value);
+        RETURN_IF_ERROR(writer.add(&value_slice));
+    }
+    return writer.finish(meta);
+}
+
 template <FieldType type>
 class ZoneMapIndexWriterImpl final : public ZoneMapIndexWriter {
     using CppType = typename TypeTraits<type>::CppType;
+    // The decimals are summed by their raw values.
+    static constexpr bool kHasIntSum = type == OLAP_FIELD_TYPE_BOOL || type == OLAP_FIELD_TYPE_TINYINT ||
+                                       type == OLAP_FIELD_TYPE_SMALLINT || type == OLAP_FIELD_TYPE_INT ||
+                                       type == OLAP_FIELD_TYPE_BIGINT || type == OLAP_FIELD_TYPE_DECIMAL32 ||
+                                       type == OLAP_FIELD_TYPE_DECIMAL64;
+    static constexpr bool kHasFloatSum = type == OLAP_FIELD_TYPE_FLOAT || type == OLAP_FIELD_TYPE_DOUBLE;
 
 public:
     explicit ZoneMapIndexWriterImpl(starrocks::Field* field);
@@ -84,6 +137,13 @@ private:
         _field->set_to_min(zone_map->max_value);
         zone_map->has_null = false;
         zone_map->has_not_null = false;
+        bool has_aggregates = config::enable_zone_map_aggregates;
+        zone_map->has_not_null_count = (kHasIntSum || kHasFloatSum) && has_aggregates;
+        zone_map->has_int_sum = kHasIntSum && has_aggregates;
+        zone_map->has_float_sum = kHasFloatSum && has_aggregates;
+        zone_map->not_null_count = 0;
+        zone_map->int_sum = 0;
+        zone_map->float_sum = 0;
     }
 
     Field* _field;
@@ -121,6 +181,25 @@ void ZoneMapIndexWriterImpl<type>::add_values(const void* values, size_t count)
         if (unaligned_load<CppType>(pmax) > unaligned_load<CppType>(_page_zone_map.max_value)) {
             _field->type_info()->direct_copy(_page_zone_map.max_value, pmax, nullptr);
         }
+        _page_zone_map.not_null_count += count;
+        if constexpr (kHasIntSum) {
+            if (_page_zone_map.has_int_sum) {
+                int64_t sum = _page_zone_map.int_sum;
+                bool overflow = false;
+                for (size_t i = 0; i < count; i++) {
+                    overflow |= __builtin_add_overflow(sum, static_cast<int64_t>(unaligned_load<CppType>(vals + i)),
+                                                       &sum);
+                }
+                _page_zone_map.int_sum = sum;
+                _page_zone_map.has_int_sum = !overflow;
+            }
+        } else if constexpr (kHasFloatSum) {
+            double sum = _page_zone_map.float_sum;
+            for (size_t i = 0; i < count; i++) {
+                sum += unaligned_load<CppType>(vals + i);
+            }
+            _page_zone_map.float_sum = sum;
+        }
     }
 }
 
@@ -139,6 +218,7 @@ Status ZoneMapIndexWriterImpl<type>::flush() {
     if (_page_zone_map.has_not_null) {
         _segment_zone_map.has_not_null = true;
     }
+    _segment_zone_map.merge_aggregates(_page_zone_map);
 
     ZoneMapPB zone_map_pb;
     _page_zone_map.to_proto(&zone_map_pb, _field);
@@ -172,22 +252,47 @@ Status ZoneMapIndexWriterImpl<type>::finish(WritableFile* wfile, ColumnIndexMeta
     // store segment zone map
     _segment_zone_map.to_proto(meta->mutable_segment_zone_map(), _field);
 
-    // write out zone map for each data pages
-    TypeInfoPtr typeinfo = get_type_info(OLAP_FIELD_TYPE_OBJECT);
-    IndexedColumnWriterOptions options;
-    options.write_ordinal_index = true;
-    options.write_value_index = false;
-    options.encoding = EncodingInfo::get_default_encoding(OLAP_FIELD_TYPE_OBJECT, false);
-    options.compression = NO_COMPRESSION; // currently not compressed
+    return write_page_zone_maps(wfile, _values, meta->mutable_page_zone_maps());
+}
 
-    IndexedColumnWriter writer(options, typeinfo, wfile);
-    RETURN_IF_ERROR(writer.init());
+Status DictCodeZoneMapIndexWriter::add_page(bool has_null, bool has_not_null, uint32_t min_code, uint32_t max_code,
+                                            const std::string& code_bitmap) {
+    ZoneMapPB zone_map_pb;
+    zone_map_pb.set_has_null(has_null);
+    zone_map_pb.set_has_not_null(has_not_null);
+    if (has_not_null) {
+        zone_map_pb.set_min(std::to_string(min_code));
+        zone_map_pb.set_max(std::to_string(max_code));
+        if (!code_bitmap.empty()) {
+            zone_map_pb.set_dict_code_bitmap(code_bitmap);
+        }
+        _segment_min_code = std::min(_segment_min_code, min_code);
+        _segment_max_code = std::max(_segment_max_code, max_code);
+    }
+    _segment_has_null |= has_null;
+    _segment_has_not_null |= has_not_null;
 
-    for (auto& value : _values) {
-        Slice value_slice(value);
-        RETURN_IF_ERROR(writer.add(&value_slice));
+    std::string serialized_zone_map;
+    if (!zone_map_pb.SerializeToString(&serialized_zone_map)) {
+        return Status::InternalError("serialize zone map failed");
     }
-    return writer.finish(meta->mutable_page_zone_maps());
+    _estimated_size += serialized_zone_map.size() + sizeof(uint32_t);
+    _values.push_back(std::move(serialized_zone_map));
+    return Status::OK();
+}
+
+Status DictCodeZoneMapIndexWriter::finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta) {
+    index_meta->set_type(DICT_CODE_ZONE_MAP_INDEX);
+    ZoneMapIndexPB* meta = index_meta->mutable_dict_code_zone_map_index();
+    // The segment zone map has no bitmap, the dictionary of the segment has all the codes.
+    ZoneMapPB* segment_zone_map = meta->mutable_segment_zone_map();
+    segment_zone_map->set_has_null(_segment_has_null);
+    segment_zone_map->set_has_not_null(_segment_has_not_null);
+    if (_segment_has_not_null) {
+        segment_zone_map->set_min(std::to_string(_segment_min_code));
+        segment_zone_map->set_max(std::to_string(_segment_max_code));
+    }
+    return write_page_zone_maps(wfile, _values, meta->mutable_page_zone_maps());
 }
 
 StatusOr<bool> ZoneMapIndexReader::load(FileSystem* fs, const std::string& filename, const ZoneMapIndexPB& meta,
@@ -203,7 +308,10 @@ Status ZoneMapIndexReader::do_load(FileSystem* fs, const std::string& filename,
     RETURN_IF_ERROR(reader.new_iterator(&iter));
 
     MemPool pool;
-    _page_zone_maps.resize(reader.num_values());
+    ZoneMapPB zone_map;
+    _offsets.reserve(kNumFields * reader.num_values() + 1);
+    _flags.reserve(reader.num_values());
+    bool has_aggregates = false;
 
     // read and cache all page zone maps
     for (int i = 0; i < reader.num_values(); ++i) {
@@ -219,20 +327,35 @@ Status ZoneMapIndexReader::do_load(FileSystem* fs, const std::string& filename,
         DCHECK(num_to_read == num_read);
 
         auto* value = reinterpret_cast<Slice*>(cvb->data());
-        if (!_page_zone_maps[i].ParseFromArray(value->data, value->size)) {
+        if (!zone_map.ParseFromArray(value->data, value->size)) {
             return Status::Corruption("Failed to parse zone map");
         }
+        for (const std::string* field : {&zone_map.min(), &zone_map.max(), &zone_map.dict_code_bitmap()}) {
+            _offsets.push_back(_buffer.size());
+            _buffer.append(*field);
+        }
+        _flags.push_back((zone_map.has_null() ? kHasNull : 0) | (zone_map.has_not_null() ? kHasNotNull : 0) |
+                         (zone_map.has_dict_code_bitmap() ? kHasDictCodeBitmap : 0) |
+                         (zone_map.has_not_null_count() ? kHasNotNullCount : 0) |
+                         (zone_map.has_int_sum() ? kHasIntSum : 0) | (zone_map.has_float_sum() ? kHasFloatSum : 0));
+        _aggregates.push_back({zone_map.not_null_count(), zone_map.int_sum(), zone_map.float_sum()});
+        has_aggregates |= zone_map.has_not_null_count();
         pool.clear();
     }
+    _offsets.push_back(_buffer.size());
+    _buffer.shrink_to_fit();
+    if (!has_aggregates) {
+        std::vector<PageAggregates>().swap(_aggregates);
+    }
     return Status::OK();
 }
 
 size_t ZoneMapIndexReader::mem_usage() const {
     size_t size = sizeof(ZoneMapIndexReader);
-    size += _page_zone_maps.capacity() * sizeof(_page_zone_maps[0]);
-    for (const auto& zone_map : _page_zone_maps) {
-        size += zone_map.SpaceUsedLong();
-    }
+    size += _buffer.capacity();
+    size += _offsets.capacity() * sizeof(_offsets[0]);
+    size += _flags.capacity() * sizeof(_flags[0]);
+    size += _aggregates.capacity() * sizeof(PageAggregates);
     return size;
 }
 
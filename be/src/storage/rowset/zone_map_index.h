@@ -21,11 +21,13 @@
 
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "common/logging.h"
 #include "common/status.h"
 #include "gen_cpp/segment.pb.h"
 #include "runtime/mem_pool.h"
@@ -62,6 +64,71 @@ public:
     virtual uint64_t size() const = 0;
 };
 
+// The zone maps of the dictionary codes of a dict-encoded column, stored like the zone map index.
+// The min and max of each ZoneMapPB are the codes of the data page, in the format of INT zone maps,
+// and the bitmap of the codes is stored too if the codes are small.
+//
+// The zone maps of the column values are not written for the non-key string columns, but the predicates
+// rewritten to the dictionary codes can still skip the data pages by these zone maps.
+class DictCodeZoneMapIndexWriter {
+public:
+    // Add the zone map of the next data page. |has_not_null| is false if the page is empty or all nulls,
+    // and the codes are ignored.
+    Status add_page(bool has_null, bool has_not_null, uint32_t min_code, uint32_t max_code,
+                    const std::string& code_bitmap);
+
+    Status finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta);
+
+    uint64_t size() const { return _estimated_size; }
+
+private:
+    bool _segment_has_null = false;
+    bool _segment_has_not_null = false;
+    uint32_t _segment_min_code = std::numeric_limits<uint32_t>::max();
+    uint32_t _segment_max_code = 0;
+    // serialized ZoneMapPB for each data page
+    std::vector<std::string> _values;
+    uint64_t _estimated_size = 0;
+};
+
+// The zone map of a page or a segment, whose slices point to the memory of its owner.
+struct ZoneMapView {
+    bool has_null = false;
+    bool has_not_null = false;
+    bool has_dict_code_bitmap = false;
+    Slice min;
+    Slice max;
+    Slice dict_code_bitmap;
+
+    // The aggregates of the not-null values, see ZoneMapPB.
+    bool has_not_null_count = false;
+    bool has_int_sum = false;
+    bool has_float_sum = false;
+    int64_t not_null_count = 0;
+    int64_t int_sum = 0;
+    double float_sum = 0;
+
+    static ZoneMapView from_pb(const ZoneMapPB& zm) {
+        ZoneMapView view;
+        view.has_null = zm.has_null();
+        view.has_not_null = zm.has_not_null();
+        view.has_dict_code_bitmap = zm.has_dict_code_bitmap();
+        view.min = Slice(zm.min());
+        view.max = Slice(zm.max());
+        view.dict_code_bitmap = Slice(zm.dict_code_bitmap());
+        view.has_not_null_count = zm.has_not_null_count();
+        view.has_int_sum = zm.has_int_sum();
+        view.has_float_sum = zm.has_float_sum();
+        view.not_null_count = zm.not_null_count();
+        view.int_sum = zm.int_sum();
+        view.float_sum = zm.float_sum();
+        return view;
+    }
+};
+
+// The page zone maps are kept in a compact form rather than one ZoneMapPB per page: the min, max and dict code
+// bitmap of all the pages are concatenated in one buffer, so an index of many pages costs a few bytes of offsets
+// and flags per page instead of a protobuf message and its strings.
 class ZoneMapIndexReader {
 public:
     ZoneMapIndexReader() : _load_once() {}
@@ -78,10 +145,31 @@ public:
                         bool kept_in_memory);
 
     // REQUIRES: the index data has been successfully `load()`ed into memory.
-    const std::vector<ZoneMapPB>& page_zone_maps() const { return _page_zone_maps; }
+    // The returned view is valid as long as this reader.
+    ZoneMapView page_zone_map(int32_t page) const {
+        DCHECK_LT(page, num_pages());
+        const uint32_t* offsets = _offsets.data() + kNumFields * page;
+        ZoneMapView view;
+        view.has_null = _flags[page] & kHasNull;
+        view.has_not_null = _flags[page] & kHasNotNull;
+        view.has_dict_code_bitmap = _flags[page] & kHasDictCodeBitmap;
+        view.min = Slice(_buffer.data() + offsets[0], offsets[1] - offsets[0]);
+        view.max = Slice(_buffer.data() + offsets[1], offsets[2] - offsets[1]);
+        view.dict_code_bitmap = Slice(_buffer.data() + offsets[2], offsets[3] - offsets[2]);
+        if (!_aggregates.empty()) {
+            const PageAggregates& aggregates = _aggregates[page];
+            view.has_not_null_count = _flags[page] & kHasNotNullCount;
+            view.has_int_sum = _flags[page] & kHasIntSum;
+            view.has_float_sum = _flags[page] & kHasFloatSum;
+            view.not_null_count = aggregates.not_null_count;
+            view.int_sum = aggregates.int_sum;
+            view.float_sum = aggregates.float_sum;
+        }
+        return view;
+    }
 
     // REQUIRES: the index data has been successfully `load()`ed into memory.
-    int32_t num_pages() const { return _page_zone_maps.size(); }
+    int32_t num_pages() const { return _flags.size(); }
 
     size_t mem_usage() const;
 
@@ -91,8 +179,29 @@ private:
     Status do_load(FileSystem* fs, const std::string& filename, const ZoneMapIndexPB& meta, bool use_page_cache,
                    bool kept_in_memory);
 
+    // The min, max and dict code bitmap of each page.
+    static constexpr int kNumFields = 3;
+    static constexpr uint8_t kHasNull = 1;
+    static constexpr uint8_t kHasNotNull = 2;
+    static constexpr uint8_t kHasDictCodeBitmap = 4;
+    static constexpr uint8_t kHasNotNullCount = 8;
+    static constexpr uint8_t kHasIntSum = 16;
+    static constexpr uint8_t kHasFloatSum = 32;
+
+    struct PageAggregates {
+        int64_t not_null_count = 0;
+        int64_t int_sum = 0;
+        double float_sum = 0;
+    };
+
     OnceFlag _load_once;
-    std::vector<ZoneMapPB> _page_zone_maps;
+    std::string _buffer;
+    // The fields of page i start at _offsets[kNumFields * i ...], and the last field ends at the start of the
+    // next page, so there is one more offset at the end.
+    std::vector<uint32_t> _offsets;
+    std::vector<uint8_t> _flags;
+    // The aggregates of each page, empty if no page has them, e.g. the indexes of the string columns.
+    std::vector<PageAggregates> _aggregates;
 };
 
 } // namespace starrocks
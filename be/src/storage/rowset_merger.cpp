@@ -194,38 +194,28 @@ public:
                 }
             }
 
-            auto start = top.pk_cur;
-            while (true) {
-                nrow++;
-                top.pk_cur++;
-                if (source_masks) {
-                    source_masks->emplace_back(RowSourceMask{top.order, false});
-                }
-                if (top.pk_cur > top.pk_last) {
-                    auto start_offset = top.offset(start);
-                    auto end_offset = top.offset(top.pk_cur);
-                    chunk->append(*top.chunk, start_offset, end_offset - start_offset);
-                    DCHECK(chunk->num_rows() == nrow);
-                    //LOG(INFO) << "  append " << end_offset - start_offset << "  get_next batch";
-                    return _fill_heap(&top);
-                }
-                if (nrow >= _chunk_size || !(*(top.pk_cur) < *(_heap.top()->pk_cur))) {
-                    auto start_offset = top.offset(start);
-                    auto end_offset = top.offset(top.pk_cur);
-                    chunk->append(*top.chunk, start_offset, end_offset - start_offset);
-                    DCHECK(chunk->num_rows() == nrow);
-                    //if (nrow >= _chunk_size) {
-                    //	LOG(INFO) << "  append " << end_offset - start_offset << "  chunk full";
-                    //} else {
-                    //	LOG(INFO) << "  append " << end_offset - start_offset
-                    //			  << "  other entry is smaller";
-                    //}
-                    _heap.push(&top);
-                    if (nrow >= _chunk_size) {
-                        return Status::OK();
-                    }
-                    break;
-                }
+            // Append the run of the keys of |top| less than the next entry at once, the current key comes first
+            // as the top, while the last key doesn't, which the check above tells, unless it's the current one.
+            size_t start_offset = top.offset(top.pk_cur);
+            size_t end_offset = std::max<size_t>(
+                    start_offset + 1, std::min<size_t>(top.offset(top.pk_last), start_offset + _chunk_size - nrow));
+            const T& next_key = *(_heap.top()->pk_cur);
+            end_offset = gallop_lower_bound(start_offset + 1, end_offset,
+                                            [&](size_t offset) { return top.pk_start[offset] < next_key; });
+            size_t nappend = end_offset - start_offset;
+            chunk->append(*top.chunk, start_offset, nappend);
+            nrow += nappend;
+            top.pk_cur += nappend;
+            DCHECK(chunk->num_rows() == nrow);
+            if (source_masks) {
+                source_masks->insert(source_masks->end(), nappend, RowSourceMask{top.order, false});
+            }
+            if (top.pk_cur > top.pk_last) {
+                return _fill_heap(&top);
+            }
+            _heap.push(&top);
+            if (nrow >= _chunk_size) {
+                return Status::OK();
             }
         }
         return Status::EndOfFile("merge end");
@@ -339,6 +329,11 @@ private:
                 }
             }
 
+            // Encode before padding, the same as reading the keys back from the output segments.
+            if (cfg.output_pks != nullptr) {
+                PrimaryKeyEncoder::encode(schema, *chunk, 0, chunk->num_rows(), cfg.output_pks);
+            }
+
             ChunkHelper::padding_char_columns(char_field_indexes, schema, tablet.tablet_schema(), chunk.get());
 
             *total_rows += chunk->num_rows();
@@ -13,6 +13,9 @@ namespace vectorized {
 struct MergeConfig {
     size_t chunk_size;
     CompactionAlgorithm algorithm = HORIZONTAL_COMPACTION;
+    // If not null, the encoded primary keys of the output rows are appended to it in the order of output,
+    // so the primary keys of the output rowset need not be read again.
+    Column* output_pks = nullptr;
 };
 
 // heap based rowset merger used for updatable tablet's compaction
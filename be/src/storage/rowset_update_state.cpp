@@ -2,6 +2,9 @@
 
 #include "rowset_update_state.h"
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "common/tracer.h"
 #include "gutil/strings/substitute.h"
 #include "serde/column_array_serde.h"
@@ -9,9 +12,12 @@
 #include "storage/primary_key_encoder.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_options.h"
+#include "storage/rowset/segment.h"
 #include "storage/rowset/segment_rewriter.h"
+#include "storage/storage_engine.h"
 #include "storage/tablet.h"
 #include "storage/tablet_meta_manager.h"
+#include "storage/update_manager.h"
 #include "util/defer_op.h"
 #include "util/phmap/phmap.h"
 #include "util/stack_util.h"
@@ -213,18 +219,10 @@ Status RowsetUpdateState::_prepare_partial_update_states(Tablet* tablet, Rowset*
         }
     }
 
-    auto read_column_schema = ChunkHelper::convert_schema_to_format_v2(tablet_schema, read_column_ids);
-    std::vector<std::unique_ptr<vectorized::Column>> read_columns(read_column_ids.size());
     size_t num_segments = rowset->num_segments();
     _partial_update_states.resize(num_segments);
     for (size_t i = 0; i < num_segments; i++) {
-        _partial_update_states[i].write_columns.resize(read_columns.size());
         _partial_update_states[i].src_rss_rowids.resize(_upserts[i]->size());
-        for (uint32_t j = 0; j < read_columns.size(); ++j) {
-            auto column = ChunkHelper::column_from_field(*read_column_schema.field(j).get());
-            read_columns[j] = column->clone_empty();
-            _partial_update_states[i].write_columns[j] = column->clone_empty();
-        }
     }
 
     int64_t t_read_index = MonotonicMillis();
@@ -239,30 +237,200 @@ Status RowsetUpdateState::_prepare_partial_update_states(Tablet* tablet, Rowset*
 
     int64_t t_read_values = MonotonicMillis();
     size_t total_rows = 0;
+    bool all_rows_exist = true;
+    for (size_t i = 0; i < num_segments; i++) {
+        const auto& src_rss_rowids = _partial_update_states[i].src_rss_rowids;
+        total_rows += src_rss_rowids.size();
+        all_rows_exist &= std::all_of(src_rss_rowids.begin(), src_rss_rowids.end(),
+                                      [](uint64_t v) { return (uint32_t)(v >> 32) != (uint32_t)-1; });
+    }
+    // The column mode only updates the existing rows, the new rows need the values of the other columns to be
+    // filled by defaults, i.e. a full row, so they go the row mode.
+    if (config::enable_column_mode_partial_update && rowset->num_delete_files() == 0 && all_rows_exist) {
+        _column_mode = true;
+        LOG(INFO) << Substitute(
+                "prepare PartialUpdateState in column mode tablet:$0 read_version:$1 #segment:$2 #row:$3 "
+                "time:$4ms(index:$5)",
+                _tablet_id, _read_version.to_string(), num_segments, total_rows, t_read_values - t_start,
+                t_read_values - t_read_index);
+        return Status::OK();
+    }
+
     // rows actually needed to be read, excluding rows with default values
     size_t total_nondefault_rows = 0;
-    for (size_t i = 0; i < num_segments; i++) {
+    RETURN_IF_ERROR(_read_partial_update_values(tablet, read_column_ids, &total_nondefault_rows));
+    int64_t t_end = MonotonicMillis();
+
+    LOG(INFO) << Substitute(
+            "prepare PartialUpdateState tablet:$0 read_version:$1 #segment:$2 #row:$3(#non-default:$4) #column:$5 "
+            "time:$6ms(index:$7/value:$8)",
+            _tablet_id, _read_version.to_string(), num_segments, total_rows, total_nondefault_rows,
+            read_column_ids.size(), t_end - t_start, t_read_values - t_read_index, t_end - t_read_values);
+    return Status::OK();
+}
+
+Status RowsetUpdateState::_read_partial_update_values(Tablet* tablet, const std::vector<uint32_t>& read_column_ids,
+                                                      size_t* total_nondefault_rows) {
+    auto read_column_schema = ChunkHelper::convert_schema_to_format_v2(tablet->tablet_schema(), read_column_ids);
+    *total_nondefault_rows = 0;
+    for (auto& state : _partial_update_states) {
+        std::vector<std::unique_ptr<vectorized::Column>> read_columns(read_column_ids.size());
+        state.write_columns.resize(read_column_ids.size());
+        for (uint32_t j = 0; j < read_column_ids.size(); ++j) {
+            auto column = ChunkHelper::column_from_field(*read_column_schema.field(j).get());
+            read_columns[j] = column->clone_empty();
+            state.write_columns[j] = column->clone_empty();
+        }
         size_t num_default = 0;
         std::map<uint32_t, std::vector<uint32_t>> rowids_by_rssid;
         vector<uint32_t> idxes;
-        plan_read_by_rssid(_partial_update_states[i].src_rss_rowids, &num_default, &rowids_by_rssid, &idxes);
-        total_rows += _partial_update_states[i].src_rss_rowids.size();
-        total_nondefault_rows += _partial_update_states[i].src_rss_rowids.size() - num_default;
+        plan_read_by_rssid(state.src_rss_rowids, &num_default, &rowids_by_rssid, &idxes);
+        *total_nondefault_rows += state.src_rss_rowids.size() - num_default;
         // get column values by rowid, also get default values if needed
+        std::vector<uint32_t> column_ids = read_column_ids;
         RETURN_IF_ERROR(
-                tablet->updates()->get_column_values(read_column_ids, num_default > 0, rowids_by_rssid, &read_columns));
+                tablet->updates()->get_column_values(column_ids, num_default > 0, rowids_by_rssid, &read_columns));
         for (size_t col_idx = 0; col_idx < read_column_ids.size(); col_idx++) {
-            _partial_update_states[i].write_columns[col_idx]->append_selective(*read_columns[col_idx], idxes.data(), 0,
-                                                                               idxes.size());
+            state.write_columns[col_idx]->append_selective(*read_columns[col_idx], idxes.data(), 0, idxes.size());
         }
     }
-    int64_t t_end = MonotonicMillis();
+    return Status::OK();
+}
 
+Status RowsetUpdateState::_apply_column_mode(Tablet* tablet, Rowset* rowset, uint32_t rowset_id,
+                                             const std::vector<uint32_t>& update_column_ids,
+                                             const PrimaryIndex& index, bool* applied) {
+    *applied = false;
+    int64_t t_start = MonotonicMillis();
+    uint32_t num_segments = _upserts.size();
+    // the rows may be moved by the rowsets and the compactions applied after load
+    std::vector<std::vector<uint64_t>> rss_rowids(num_segments);
+    for (uint32_t i = 0; i < num_segments; i++) {
+        rss_rowids[i].resize(_upserts[i]->size());
+        index.get(*_upserts[i], &rss_rowids[i]);
+        for (uint64_t v : rss_rowids[i]) {
+            if ((uint32_t)(v >> 32) == (uint32_t)-1) {
+                LOG(INFO) << Substitute(
+                        "apply PartialUpdateState in row mode since rows are deleted tablet:$0 rowset:$1", _tablet_id,
+                        rowset_id);
+                return Status::OK();
+            }
+        }
+    }
+    if (!tablet->updates()->try_begin_column_mode_apply()) {
+        LOG(INFO) << Substitute(
+                "apply PartialUpdateState in row mode since compaction is pending tablet:$0 rowset:$1", _tablet_id,
+                rowset_id);
+        return Status::OK();
+    }
+
+    const auto& tschema = tablet->tablet_schema();
+    // the key columns are not changed
+    std::vector<uint32_t> value_column_ids;
+    std::vector<uint32_t> unique_ids;
+    for (uint32_t cid : update_column_ids) {
+        if (cid >= tschema.num_key_columns()) {
+            value_column_ids.push_back(cid);
+            unique_ids.push_back(tschema.column(cid).unique_id());
+        }
+    }
+    auto value_schema = ChunkHelper::convert_schema_to_format_v2(tschema, value_column_ids);
+    std::vector<std::unique_ptr<vectorized::Column>> values(value_column_ids.size());
+    for (size_t j = 0; j < value_column_ids.size(); j++) {
+        values[j] = ChunkHelper::column_from_field(*value_schema.field(j).get())->clone_empty();
+    }
+
+    // (rowid, index in |values|) of the updated rows of each segment
+    std::map<uint32_t, std::vector<std::pair<uint32_t, uint32_t>>> updates_by_rssid;
+    uint32_t offset = 0;
+    RowsetReleaseGuard guard(rowset->shared_from_this());
+    RETURN_IF_ERROR(rowset->load());
+    OlapReaderStatistics stats;
+    for (uint32_t i = 0; i < num_segments; i++) {
+        const auto& segment = rowset->segments()[i];
+        if (!value_column_ids.empty() && segment->num_rows() > 0) {
+            ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(segment->file_name()));
+            ASSIGN_OR_RETURN(auto read_file, fs->new_random_access_file(segment->file_name()));
+            ColumnIteratorOptions iter_opts;
+            iter_opts.stats = &stats;
+            iter_opts.use_page_cache = false;
+            iter_opts.read_file = read_file.get();
+            for (size_t j = 0; j < value_column_ids.size(); j++) {
+                ColumnIterator* col_iter_raw_ptr = nullptr;
+                RETURN_IF_ERROR(segment->new_column_iterator(value_column_ids[j], &col_iter_raw_ptr));
+                std::unique_ptr<ColumnIterator> col_iter(col_iter_raw_ptr);
+                RETURN_IF_ERROR(col_iter->init(iter_opts));
+                RETURN_IF_ERROR(col_iter->seek_to_first());
+                size_t num_rows = segment->num_rows();
+                RETURN_IF_ERROR(col_iter->next_batch(&num_rows, values[j].get()));
+            }
+        }
+        for (uint32_t j = 0; j < rss_rowids[i].size(); j++) {
+            uint64_t v = rss_rowids[i][j];
+            updates_by_rssid[v >> 32].emplace_back(v & ROWID_MASK, offset + j);
+        }
+        offset += rss_rowids[i].size();
+    }
+    for (const auto& column : values) {
+        if (column->size() != offset) {
+            return Status::InternalError(Substitute("partial segment rows mismatch tablet:$0 rowset:$1 $2 vs $3",
+                                                    _tablet_id, rowset_id, column->size(), offset));
+        }
+    }
+
+    auto manager = StorageEngine::instance()->update_manager();
+    int64_t version = rowset->start_version();
+    if (!value_column_ids.empty()) {
+        for (auto& [rssid, updates] : updates_by_rssid) {
+            std::stable_sort(updates.begin(), updates.end(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+            std::vector<rowid_t> rowids;
+            std::vector<uint32_t> idxes;
+            for (size_t k = 0; k < updates.size(); k++) {
+                // the last one wins for the duplicate keys
+                if (k + 1 < updates.size() && updates[k + 1].first == updates[k].first) {
+                    continue;
+                }
+                rowids.push_back(updates[k].first);
+                idxes.push_back(updates[k].second);
+            }
+            std::vector<std::unique_ptr<vectorized::Column>> columns(values.size());
+            for (size_t j = 0; j < values.size(); j++) {
+                columns[j] = values[j]->clone_empty();
+                columns[j]->append_selective(*values[j], idxes.data(), 0, idxes.size());
+            }
+            RowsetSharedPtr target;
+            uint32_t segment_idx = 0;
+            RETURN_IF_ERROR(tablet->updates()->get_rowset_of_segment(rssid, &target, &segment_idx));
+            std::string file_name = DeltaColumnGroup::file_name(target->rowset_id(), segment_idx, version);
+            RETURN_IF_ERROR(DeltaColumnGroup::write(target->rowset_path() + "/" + file_name, tschema, unique_ids,
+                                                    rowids, columns));
+
+            DeltaColumnGroupPB dcg_pb;
+            dcg_pb.set_version(version);
+            dcg_pb.set_file_name(file_name);
+            for (uint32_t unique_id : unique_ids) {
+                dcg_pb.add_column_unique_ids(unique_id);
+            }
+            dcg_pb.set_num_rows(rowids.size());
+            DeltaColumnGroupList dcgs;
+            TabletSegmentId tsid(_tablet_id, rssid);
+            RETURN_IF_ERROR(manager->get_delta_column_groups(tablet->data_dir()->get_meta(), tsid, INT64_MAX, &dcgs));
+            // a retry of this apply, e.g. after a failed meta write
+            dcgs.erase(std::remove_if(dcgs.begin(), dcgs.end(),
+                                      [&](const DeltaColumnGroupPtr& dcg) { return dcg->version() >= version; }),
+                       dcgs.end());
+            dcgs.emplace_back(std::make_shared<DeltaColumnGroup>(dcg_pb));
+            _delta_column_groups.emplace_back(rssid, std::move(dcgs));
+        }
+    }
+    *applied = true;
+    int64_t t_end = MonotonicMillis();
     LOG(INFO) << Substitute(
-            "prepare PartialUpdateState tablet:$0 read_version:$1 #segment:$2 #row:$3(#non-default:$4) #column:$5 "
-            "time:$6ms(index:$7/value:$8)",
-            _tablet_id, _read_version.to_string(), num_segments, total_rows, total_nondefault_rows, read_columns.size(),
-            t_end - t_start, t_read_values - t_read_index, t_end - t_read_values);
+            "apply PartialUpdateState in column mode tablet:$0 rowset:$1 version:$2 #segment:$3 #updated-segment:$4 "
+            "#row:$5 #column:$6 time:$7ms",
+            _tablet_id, rowset_id, version, num_segments, updates_by_rssid.size(), offset, value_column_ids.size(),
+            t_end - t_start);
     return Status::OK();
 }
 
@@ -365,6 +533,22 @@ Status RowsetUpdateState::apply(Tablet* tablet, Rowset* rowset, uint32_t rowset_
         }
     }
 
+    if (_column_mode) {
+        bool applied = false;
+        RETURN_IF_ERROR(_apply_column_mode(tablet, rowset, rowset_id, update_colum_ids, index, &applied));
+        if (applied) {
+            return Status::OK();
+        }
+        // fall back to the row mode, read the values at the latest applied version
+        _column_mode = false;
+        for (size_t i = 0; i < _upserts.size(); i++) {
+            index.get(*_upserts[i], &_partial_update_states[i].src_rss_rowids);
+        }
+        size_t total_nondefault_rows = 0;
+        RETURN_IF_ERROR(_read_partial_update_values(tablet, read_column_ids, &total_nondefault_rows));
+        _read_version = latest_applied_version;
+    }
+
     size_t num_segments = rowset->num_segments();
     DCHECK(num_segments == _upserts.size());
     vector<std::pair<string, string>> rewrite_files;
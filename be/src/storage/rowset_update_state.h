@@ -5,6 +5,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "storage/delta_column_group.h"
 #include "storage/olap_common.h"
 #include "storage/primary_index.h"
 #include "storage/tablet_updates.h"
@@ -39,6 +40,16 @@ public:
 
     const std::vector<PartialUpdateState>& parital_update_states() { return _partial_update_states; }
 
+    // Whether the partial update is applied in column mode, see config::enable_column_mode_partial_update.
+    // In column mode the updated values are written to the delta column groups of the segments of the
+    // updated rows, and the rows of this rowset are not upserted into the primary index but all deleted.
+    bool is_column_mode() const { return _column_mode; }
+
+    // The delta column group lists of the segments updated by apply() in column mode, by rssid.
+    const std::vector<std::pair<uint32_t, DeltaColumnGroupList>>& delta_column_groups() const {
+        return _delta_column_groups;
+    }
+
     // call check conflict directly
     // only use for ut of partial update
     Status test_check_conflict(Tablet* tablet, Rowset* rowset, uint32_t rowset_id, EditVersion latest_applied_version,
@@ -51,6 +62,16 @@ private:
 
     Status _prepare_partial_update_states(Tablet* tablet, Rowset* rowset);
 
+    // Read the values of |read_column_ids| of the rows src_rss_rowids into write_columns.
+    Status _read_partial_update_values(Tablet* tablet, const std::vector<uint32_t>& read_column_ids,
+                                       size_t* total_nondefault_rows);
+
+    // Write the delta column groups of the updated segments. |*applied| is false if the rowset must be
+    // applied in row mode instead, e.g. some updated rows are deleted after load.
+    Status _apply_column_mode(Tablet* tablet, Rowset* rowset, uint32_t rowset_id,
+                              const std::vector<uint32_t>& update_column_ids, const PrimaryIndex& index,
+                              bool* applied);
+
     Status _check_and_resolve_conflict(Tablet* tablet, Rowset* rowset, uint32_t rowset_id,
                                        EditVersion latest_applied_version, std::vector<uint32_t>& read_column_ids,
                                        const PrimaryIndex& index);
@@ -73,6 +94,10 @@ private:
     // TODO: dump to disk if memory usage is too large
     std::vector<PartialUpdateState> _partial_update_states;
 
+    // states for column mode partial update
+    bool _column_mode = false;
+    std::vector<std::pair<uint32_t, DeltaColumnGroupList>> _delta_column_groups;
+
     RowsetUpdateState(const RowsetUpdateState&) = delete;
     const RowsetUpdateState& operator=(const RowsetUpdateState&) = delete;
 };
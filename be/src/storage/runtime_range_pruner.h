@@ -0,0 +1,100 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "common/status.h"
+#include "storage/olap_common.h"
+
+namespace starrocks::vectorized {
+
+class ColumnPredicate;
+
+// RuntimeRangePruner lets the segment iterators of an in-flight scan use the join runtime filters
+// arrived after the scan has been opened. An arrived runtime filter is converted into the predicates
+// of its column once, then each SegmentIterator prunes its unread rows by the zone maps of them.
+// A versioned filter, e.g. the boundary of a top-n sort, is tightened from time to time instead, it's
+// converted again for each new version and the predicates of the older versions are kept.
+//
+// It's not thread-safe, it must be used by the thread reading the TabletReader.
+class RuntimeRangePruner {
+public:
+    using PredicateList = std::vector<const ColumnPredicate*>;
+    // Whether the runtime filter has arrived.
+    using ArrivedFunc = std::function<bool()>;
+    // Convert the arrived runtime filter into predicates, which must outlive the pruner.
+    using PredicatesBuilder = std::function<Status(PredicateList*)>;
+    // Prune the rows by the predicates of a column.
+    using RangeUpdater = std::function<Status(ColumnId, const PredicateList&)>;
+    // The version of a versioned filter, 0 means not arrived.
+    using VersionFunc = std::function<int64_t()>;
+
+    void add_runtime_filter(ColumnId cid, ArrivedFunc arrived, PredicatesBuilder builder) {
+        _pending_filters.push_back({cid, std::move(arrived), std::move(builder)});
+    }
+
+    void add_versioned_filter(ColumnId cid, VersionFunc version, PredicatesBuilder builder) {
+        _versioned_filters.push_back({cid, std::move(version), std::move(builder), 0});
+    }
+
+    bool empty() const {
+        return _pending_filters.empty() && _versioned_filters.empty() && _arrived_predicates.empty();
+    }
+
+    // Call |updater| with the predicates of the runtime filters arrived since the last call.
+    // |num_applied| is the number of the arrived runtime filters applied by the caller, it starts from 0.
+    Status update_range_if_arrived(size_t* num_applied, const RangeUpdater& updater) {
+        for (auto it = _pending_filters.begin(); it != _pending_filters.end();) {
+            if (!it->arrived()) {
+                ++it;
+                continue;
+            }
+            PredicateList preds;
+            RETURN_IF_ERROR(it->builder(&preds));
+            if (!preds.empty()) {
+                _arrived_predicates.emplace_back(it->cid, std::move(preds));
+            }
+            it = _pending_filters.erase(it);
+        }
+        for (auto& filter : _versioned_filters) {
+            int64_t version = filter.version();
+            if (version == filter.built_version) {
+                continue;
+            }
+            PredicateList preds;
+            RETURN_IF_ERROR(filter.builder(&preds));
+            if (!preds.empty()) {
+                _arrived_predicates.emplace_back(filter.cid, std::move(preds));
+            }
+            filter.built_version = version;
+        }
+        for (; *num_applied < _arrived_predicates.size(); ++(*num_applied)) {
+            const auto& [cid, preds] = _arrived_predicates[*num_applied];
+            RETURN_IF_ERROR(updater(cid, preds));
+        }
+        return Status::OK();
+    }
+
+private:
+    struct PendingFilter {
+        ColumnId cid;
+        ArrivedFunc arrived;
+        PredicatesBuilder builder;
+    };
+
+    struct VersionedFilter {
+        ColumnId cid;
+        VersionFunc version;
+        PredicatesBuilder builder;
+        int64_t built_version;
+    };
+
+    std::vector<PendingFilter> _pending_filters;
+    std::vector<VersionedFilter> _versioned_filters;
+    std::vector<std::pair<ColumnId, PredicateList>> _arrived_predicates;
+};
+
+} // namespace starrocks::vectorized
@@ -775,6 +775,11 @@ Status SchemaChangeHandler::_do_process_alter_tablet_v2(const TAlterTabletReqV2&
             status = Status::NotSupported("schema change of primary key model do not support sorting.");
         } else {
             status = new_tablet->updates()->link_from(base_tablet.get(), request.alter_version);
+            if (status.is_not_supported()) {
+                // the segments updated in column mode are rewritten with their delta column groups
+                status = new_tablet->updates()->convert_from(base_tablet, request.alter_version,
+                                                             sc_params.chunk_changer.get());
+            }
         }
         if (!status.ok()) {
             LOG(WARNING) << "schema change new tablet load snapshot error: " << status.to_string();
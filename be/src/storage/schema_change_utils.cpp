@@ -3,7 +3,9 @@
 #include "storage/schema_change_utils.h"
 
 #include "column/datum_convert.h"
+#include "common/config.h"
 #include "storage/chunk_helper.h"
+#include "storage/rowset/cast_column_iterator.h"
 #include "storage/wrapper_field.h"
 #include "types/bitmap_value.h"
 #include "types/hll.h"
@@ -673,7 +675,9 @@ Status SchemaChangeUtils::parse_request(const TabletSchema& base_schema, const T
         } else {
             auto& new_column = new_schema.column(i);
             auto& ref_column = base_schema.column(column_mapping->ref_column);
-            if (new_column.type() != ref_column.type()) {
+            if (is_lazy_widening(ref_column, new_column, i >= new_schema.num_key_columns())) {
+                continue;
+            } else if (new_column.type() != ref_column.type()) {
                 *sc_directly = true;
                 return Status::OK();
             } else if (is_decimalv3_field_type(new_column.type()) &&
@@ -701,6 +705,20 @@ Status SchemaChangeUtils::parse_request(const TabletSchema& base_schema, const T
     return Status::OK();
 }
 
+bool SchemaChangeUtils::is_lazy_widening(const TabletColumn& ref_column, const TabletColumn& new_column,
+                                         bool is_value_column) {
+    if (!config::enable_lazy_schema_change_widening || new_column.is_bf_column() != ref_column.is_bf_column() ||
+        new_column.has_bitmap_index() != ref_column.has_bitmap_index()) {
+        return false;
+    }
+    if (new_column.type() == OLAP_FIELD_TYPE_VARCHAR && ref_column.type() == OLAP_FIELD_TYPE_VARCHAR) {
+        // The stored bytes do not depend on the length.
+        return new_column.length() > ref_column.length();
+    }
+    // The keys are encoded by the stored type in the short key index.
+    return is_value_column && CastColumnIterator::is_widening(ref_column.type(), new_column.type());
+}
+
 Status SchemaChangeUtils::init_column_mapping(ColumnMapping* column_mapping, const TabletColumn& column_schema,
                                               const std::string& value) {
     column_mapping->default_value = WrapperField::create(column_schema);
@@ -56,6 +56,11 @@ public:
                                 bool* sc_sorting, bool* sc_directly);
 
 private:
+    // Whether |ref_column| changed to |new_column| can be read from the segments of |ref_column| as they are,
+    // by widening the values at read time.
+    static bool is_lazy_widening(const TabletColumn& ref_column, const TabletColumn& new_column,
+                                 bool is_value_column);
+
     // default_value for new column is needed
     static Status init_column_mapping(ColumnMapping* column_mapping, const TabletColumn& column_schema,
                                       const std::string& value);
@@ -21,13 +21,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <string>
 #include <vector>
 
 #include "common/status.h"
 #include "gen_cpp/segment.pb.h"
+#include "gutil/endian.h"
 #include "util/debug_util.h"
 #include "util/faststring.h"
 #include "util/slice.h"
@@ -256,18 +259,33 @@ public:
     }
 
     int64_t mem_usage() const {
-        return sizeof(ShortKeyIndexDecoder) + sizeof(uint32_t) * _offsets.size() + _key_data.size +
-               _footer.ByteSizeLong() - sizeof(_footer);
+        return sizeof(ShortKeyIndexDecoder) + sizeof(uint32_t) * _offsets.size() +
+               sizeof(uint64_t) * _key_prefixes.size() + _key_data.size + _footer.ByteSizeLong() - sizeof(_footer);
     }
 
 private:
+    // The first 8 bytes of |key| as a big-endian integer, zero padded. It's monotone with Slice::compare, i.e.
+    // lhs < rhs implies key_prefix(lhs) <= key_prefix(rhs).
+    static uint64_t key_prefix(const Slice& key) {
+        uint64_t prefix = 0;
+        memcpy(&prefix, key.data, std::min<size_t>(key.size, sizeof(prefix)));
+        return BigEndian::FromHost64(prefix);
+    }
+
     template <bool lower_bound>
     ShortKeyIndexIterator seek(const Slice& key) const {
+        // Narrow the search to the items of the same prefix on the contiguous prefixes, then compare the full keys
+        // only among them.
+        uint64_t prefix = key_prefix(key);
+        auto first = std::lower_bound(_key_prefixes.begin(), _key_prefixes.end(), prefix);
+        auto last = std::upper_bound(first, _key_prefixes.end(), prefix);
+        ShortKeyIndexIterator first_iter(this, first - _key_prefixes.begin());
+        ShortKeyIndexIterator last_iter(this, last - _key_prefixes.begin());
         auto comparator = [](const Slice& lhs, const Slice& rhs) { return lhs.compare(rhs) < 0; };
         if (lower_bound) {
-            return std::lower_bound(begin(), end(), key, comparator);
+            return std::lower_bound(first_iter, last_iter, key, comparator);
         } else {
-            return std::upper_bound(begin(), end(), key, comparator);
+            return std::upper_bound(first_iter, last_iter, key, comparator);
         }
     }
 
@@ -276,6 +294,9 @@ private:
     // All following fields are only valid after parse has been executed successfully
     ShortKeyFooterPB _footer;
     std::vector<uint32_t> _offsets;
+    // The key_prefix of each item, searched before the keys, so that most probes of a seek read a contiguous
+    // array rather than chasing an offset and calling memcmp.
+    std::vector<uint64_t> _key_prefixes;
     Slice _key_data;
 };
 
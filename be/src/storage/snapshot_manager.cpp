@@ -29,6 +29,7 @@
 
 #include "fs/fs.h"
 #include "gen_cpp/Types_constants.h"
+#include "gen_cpp/olap_file.pb.h"
 #include "gutil/strings/join.h"
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
@@ -566,6 +567,18 @@ Status SnapshotManager::make_snapshot_on_tablet_meta(SnapshotTypePB snapshot_typ
                 DelVector* delvec = &snapshot_meta.delete_vectors()[new_segment_id];
                 RETURN_IF_ERROR(TabletMetaManager::get_del_vector(meta_store, tablet->tablet_id(), old_segment_id,
                                                                   snapshot_version, delvec, &dummy /*latest_version*/));
+                // the delta column groups are not in the snapshot, the segments must be compacted first
+                DeltaColumnGroupListPB dcgs;
+                auto dcg_st = TabletMetaManager::get_delta_column_groups(meta_store, tablet->tablet_id(),
+                                                                         old_segment_id, &dcgs);
+                if (!dcg_st.ok() && !dcg_st.is_not_found()) {
+                    return dcg_st;
+                }
+                if (dcg_st.ok() && dcgs.groups_size() > 0 && dcgs.groups(0).version() <= snapshot_version) {
+                    return Status::NotSupported(
+                            strings::Substitute("full snapshot of tablet $0 updated in column mode is not supported",
+                                                tablet->tablet_id()));
+                }
             }
             rowset_meta_pb.set_rowset_seg_id(new_rsid);
             new_rsid += std::max<uint32_t>(rowset_meta_pb.num_segments(), 1);
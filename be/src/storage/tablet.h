@@ -37,6 +37,7 @@
 #include "storage/base_tablet.h"
 #include "storage/data_dir.h"
 #include "storage/olap_define.h"
+#include "storage/read_heat.h"
 #include "storage/rowset/rowset.h"
 #include "storage/tablet_meta.h"
 #include "storage/tuple.h"
@@ -255,6 +256,9 @@ public:
 
     double compaction_score(CompactionType type) const;
 
+    // The scans of this tablet by the queries, see compaction_read_heat_weight.
+    ReadHeat& read_heat() { return _read_heat; }
+
     std::shared_ptr<CompactionTask> get_compaction(CompactionType type, bool create_if_not_exist);
 
     void stop_compaction();
@@ -334,6 +338,8 @@ private:
     // States used for updatable tablets only
     std::unique_ptr<TabletUpdates> _updates;
 
+    ReadHeat _read_heat;
+
     // compaction related
     std::unique_ptr<CompactionContext> _compaction_context;
     std::shared_ptr<CompactionTask> _base_compaction_task;
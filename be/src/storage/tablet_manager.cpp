@@ -28,6 +28,7 @@ DIAGNOSTIC_POP
 #include <fmt/format.h>
 #include <re2/re2.h>
 
+#include <algorithm>
 #include <ctime>
 #include <memory>
 
@@ -50,6 +51,7 @@ DIAGNOSTIC_POP
 #include "storage/utils.h"
 #include "util/path_util.h"
 #include "util/starrocks_metrics.h"
+#include "util/time.h"
 
 namespace starrocks {
 
@@ -1357,6 +1359,7 @@ Status TabletManager::create_tablet_from_meta_snapshot(DataDir* store, TTabletId
         LOG(WARNING) << "Fail to init cloned tablet " << tablet_id << ", try to clear meta store";
         wb.Clear();
         RETURN_IF_ERROR(TabletMetaManager::clear_del_vector(store, &wb, tablet_id));
+        RETURN_IF_ERROR(TabletMetaManager::clear_delta_column_group(store, &wb, tablet_id));
         RETURN_IF_ERROR(TabletMetaManager::clear_rowset(store, &wb, tablet_id));
         RETURN_IF_ERROR(TabletMetaManager::clear_log(store, &wb, tablet_id));
         RETURN_IF_ERROR(TabletMetaManager::remove_tablet_meta(store, &wb, tablet_id, schema_hash));
@@ -1417,4 +1420,27 @@ std::unordered_map<TTabletId, vector<pair<uint32_t, uint32_t>>> TabletManager::g
     return ret;
 }
 
+std::vector<TabletSharedPtr> TabletManager::get_hottest_tablets(size_t limit) {
+    int64_t now_ms = UnixMillis();
+    std::vector<std::pair<double, TabletSharedPtr>> tablets;
+    for (const auto& tablets_shard : _tablets_shards) {
+        std::shared_lock rlock(tablets_shard.lock);
+        for (const auto& [_, tablet_ptr] : tablets_shard.tablet_map) {
+            double reads = tablet_ptr->read_heat().reads(now_ms);
+            if (reads > 0) {
+                tablets.emplace_back(reads, tablet_ptr);
+            }
+        }
+    }
+    size_t num_tablets = std::min(limit, tablets.size());
+    std::partial_sort(tablets.begin(), tablets.begin() + num_tablets, tablets.end(),
+                      [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+    std::vector<TabletSharedPtr> result;
+    result.reserve(num_tablets);
+    for (size_t i = 0; i < num_tablets; i++) {
+        result.emplace_back(std::move(tablets[i].second));
+    }
+    return result;
+}
+
 } // end namespace starrocks
@@ -150,6 +150,9 @@ public:
     // return map<TabletId, vector<pair<rowsetid, segment file num>>>
     std::unordered_map<TTabletId, std::vector<std::pair<uint32_t, uint32_t>>> get_tablets_need_repair_compaction();
 
+    // Return at most |limit| tablets read by the queries, in the descending order of the decayed reads.
+    std::vector<TabletSharedPtr> get_hottest_tablets(size_t limit);
+
 private:
     using TabletMap = std::unordered_map<int64_t, TabletSharedPtr>;
     using TabletSet = std::unordered_set<int64_t>;
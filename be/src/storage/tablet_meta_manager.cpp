@@ -61,6 +61,7 @@ static const std::string TABLET_META_ROWSET_PREFIX = "trs_";
 static const std::string TABLET_META_PENDING_ROWSET_PREFIX = "tpr_";
 static const std::string TABLET_DELVEC_PREFIX = "dlv_";
 static const std::string TABLET_PERSISTENT_INDEX_META_PREFIX = "tpi_";
+static const std::string TABLET_DELTA_COLUMN_GROUP_PREFIX = "dcg_";
 
 static string encode_meta_log_key(TTabletId id, uint64_t logid);
 static bool decode_meta_log_key(std::string_view key, TTabletId* id, uint64_t* logid);
@@ -477,6 +478,9 @@ Status TabletMetaManager::build_primary_meta(DataDir* store, rapidjson::Document
     if (!clear_del_vector(store, &batch, tablet_id).ok()) {
         return Status::IOError("clear delvec add to batch failed");
     }
+    if (!clear_delta_column_group(store, &batch, tablet_id).ok()) {
+        return Status::IOError("clear delta column group add to batch failed");
+    }
     if (!clear_rowset(store, &batch, tablet_id).ok()) {
         return Status::IOError("clear rowset add to batch failed");
     }
@@ -678,6 +682,15 @@ void decode_del_vector_key(std::string_view enc_key, TTabletId* tablet_id, uint3
     *version = INT64_MAX - BigEndian::ToHost64(UNALIGNED_LOAD64(enc_key.data() + 16));
 }
 
+static std::string encode_delta_column_group_key(TTabletId tablet_id, uint32_t segment_id) {
+    std::string key;
+    key.reserve(TABLET_DELTA_COLUMN_GROUP_PREFIX.length() + sizeof(uint64_t) + sizeof(uint32_t));
+    key.append(TABLET_DELTA_COLUMN_GROUP_PREFIX);
+    put_fixed64_le(&key, BigEndian::FromHost64(tablet_id));
+    put_fixed32_le(&key, BigEndian::FromHost32(segment_id));
+    return key;
+}
+
 std::string encode_persistent_index_key(TTabletId tablet_id) {
     std::string key;
     key.reserve(TABLET_PERSISTENT_INDEX_META_PREFIX.length() + sizeof(uint64_t));
@@ -786,6 +799,11 @@ Status TabletMetaManager::rowset_delete(DataDir* store, TTabletId tablet_id, uin
         if (UNLIKELY(!st.ok())) {
             return Status::InternalError("remove delete vector failed");
         }
+        st = batch.DeleteRange(cf_meta, encode_delta_column_group_key(tablet_id, rowset_id + 0),
+                               encode_delta_column_group_key(tablet_id, rowset_id + segments));
+        if (UNLIKELY(!st.ok())) {
+            return Status::InternalError("remove delta column group failed");
+        }
     }
     return meta->write_batch(&batch);
 }
@@ -807,7 +825,8 @@ Status TabletMetaManager::rowset_iterate(DataDir* store, TTabletId tablet_id, co
 Status TabletMetaManager::apply_rowset_commit(DataDir* store, TTabletId tablet_id, int64_t logid,
                                               const EditVersion& version,
                                               vector<std::pair<uint32_t, DelVectorPtr>>& delvecs,
-                                              const PersistentIndexMetaPB& index_meta, bool enable_persistent_index) {
+                                              const PersistentIndexMetaPB& index_meta, bool enable_persistent_index,
+                                              const vector<std::pair<uint32_t, DeltaColumnGroupListPB>>& dcgs) {
     auto span = Tracer::Instance().start_trace_tablet("apply_save_meta", tablet_id);
     span->SetAttribute("version", version.to_string());
     WriteBatch batch;
@@ -843,6 +862,14 @@ Status TabletMetaManager::apply_rowset_commit(DataDir* store, TTabletId tablet_i
     span->SetAttribute("delvec_bytes", total_bytes);
     span->AddEvent("delvec_end");
 
+    for (const auto& [rssid, dcg_list] : dcgs) {
+        st = batch.Put(handle, encode_delta_column_group_key(tablet_id, rssid), dcg_list.SerializeAsString());
+        if (!st.ok()) {
+            LOG(WARNING) << "rowset_commit failed, rocksdb.batch.put failed";
+            return to_status(st);
+        }
+    }
+
     if (enable_persistent_index) {
         auto meta_key = encode_persistent_index_key(tsid.tablet_id);
         auto meta_value = index_meta.SerializeAsString();
@@ -957,6 +984,16 @@ StatusOr<DeleteVectorList> TabletMetaManager::list_del_vector(KVStore* meta, TTa
 
 Status TabletMetaManager::delete_del_vector_range(KVStore* meta, TTabletId tablet_id, uint32_t segment_id,
                                                   int64_t start_version, int64_t end_version) {
+    WriteBatch batch;
+    RETURN_IF_ERROR(delete_del_vector_range(meta, &batch, tablet_id, segment_id, start_version, end_version));
+    if (batch.Count() == 0) {
+        return Status::OK();
+    }
+    return meta->write_batch(&batch);
+}
+
+Status TabletMetaManager::delete_del_vector_range(KVStore* meta, WriteBatch* batch, TTabletId tablet_id,
+                                                  uint32_t segment_id, int64_t start_version, int64_t end_version) {
     if (start_version == end_version) {
         return Status::OK();
     }
@@ -967,12 +1004,18 @@ Status TabletMetaManager::delete_del_vector_range(KVStore* meta, TTabletId table
     std::string begin_key = encode_del_vector_key(tablet_id, segment_id, end_version - 1);
     std::string end_key = encode_del_vector_key(tablet_id, segment_id, start_version - 1);
     auto cf_handle = meta->handle(META_COLUMN_FAMILY_INDEX);
-    WriteBatch batch;
-    rocksdb::Status st = batch.DeleteRange(cf_handle, begin_key, end_key);
-    if (!st.ok()) {
-        return to_status(st);
+    return to_status(batch->DeleteRange(cf_handle, begin_key, end_key));
+}
+
+Status TabletMetaManager::get_delta_column_groups(KVStore* meta, TTabletId tablet_id, uint32_t segment_id,
+                                                  DeltaColumnGroupListPB* dcgs) {
+    std::string value;
+    RETURN_IF_ERROR(meta->get(META_COLUMN_FAMILY_INDEX, encode_delta_column_group_key(tablet_id, segment_id), &value));
+    if (!dcgs->ParseFromString(value)) {
+        return Status::Corruption(
+                strings::Substitute("bad delta column groups tablet:$0 segment:$1", tablet_id, segment_id));
     }
-    return meta->write_batch(&batch);
+    return Status::OK();
 }
 
 Status TabletMetaManager::put_rowset_meta(DataDir* store, WriteBatch* batch, TTabletId tablet_id,
@@ -1019,6 +1062,13 @@ Status TabletMetaManager::clear_del_vector(DataDir* store, WriteBatch* batch, TT
     return to_status(batch->DeleteRange(h, lower, upper));
 }
 
+Status TabletMetaManager::clear_delta_column_group(DataDir* store, WriteBatch* batch, TTabletId tablet_id) {
+    auto lower = encode_delta_column_group_key(tablet_id, 0);
+    auto upper = encode_delta_column_group_key(tablet_id, UINT32_MAX);
+    auto h = store->get_meta()->handle(META_COLUMN_FAMILY_INDEX);
+    return to_status(batch->DeleteRange(h, lower, upper));
+}
+
 Status TabletMetaManager::clear_persistent_index(DataDir* store, WriteBatch* batch, TTabletId tablet_id) {
     auto k = encode_persistent_index_key(tablet_id);
     auto h = store->get_meta()->handle(META_COLUMN_FAMILY_INDEX);
@@ -1224,6 +1274,9 @@ Status TabletMetaManager::remove(DataDir* store, TTabletId tablet_id) {
         if (!clear_del_vector(store, &batch, tablet_id).ok()) {
             LOG(WARNING) << "clear delvec add to batch failed";
         }
+        if (!clear_delta_column_group(store, &batch, tablet_id).ok()) {
+            LOG(WARNING) << "clear delta column group add to batch failed";
+        }
         if (!clear_rowset(store, &batch, tablet_id).ok()) {
             LOG(WARNING) << "clear rowset add to batch failed";
         }
@@ -43,6 +43,7 @@ class EditVersion;
 class EditVersionMetaPB;
 class RowsetMetaPB;
 class TabletMetaPB;
+class DeltaColumnGroupListPB;
 
 struct TabletMetaStats {
     TTabletId tablet_id = 0;
@@ -144,13 +145,15 @@ public:
     // Remove rowset meta from |store|, leave tablet meta unchanged.
     // |rowset_id| is the value returned from `RowsetMeta::get_rowset_seg_id`.
     // |segments| is the number of segments in the rowset, i.e, `Rowset::num_segments`.
-    // All delete vectors that associated with this rowset will be deleted too.
+    // All delete vectors and delta column groups that associated with this rowset will be deleted too.
     static Status rowset_delete(DataDir* store, TTabletId tablet_id, uint32_t rowset_id, uint32_t segments);
 
     // update meta after state of a rowset commit is applied
+    // |dcgs| are the whole new delta column group lists of the segments updated in column mode.
     static Status apply_rowset_commit(DataDir* store, TTabletId tablet_id, int64_t logid, const EditVersion& version,
                                       std::vector<std::pair<uint32_t, DelVectorPtr>>& delvecs,
-                                      const PersistentIndexMetaPB& index_meta, bool enable_persistent_index);
+                                      const PersistentIndexMetaPB& index_meta, bool enable_persistent_index,
+                                      const std::vector<std::pair<uint32_t, DeltaColumnGroupListPB>>& dcgs);
 
     // traverse all the op logs for a tablet
     static Status traverse_meta_logs(DataDir* store, TTabletId tablet_id,
@@ -171,6 +174,14 @@ public:
     static Status delete_del_vector_range(KVStore* meta, TTabletId tablet_id, uint32_t segment_id,
                                           int64_t start_version, int64_t end_version);
 
+    // Add the deletion of the range to |batch|, so that the ranges of many segments are deleted by one write.
+    static Status delete_del_vector_range(KVStore* meta, WriteBatch* batch, TTabletId tablet_id, uint32_t segment_id,
+                                          int64_t start_version, int64_t end_version);
+
+    // Return NotFound if the segment has no delta column group.
+    static Status get_delta_column_groups(KVStore* meta, TTabletId tablet_id, uint32_t segment_id,
+                                          DeltaColumnGroupListPB* dcgs);
+
     static Status put_rowset_meta(DataDir* store, WriteBatch* batch, TTabletId tablet_id,
                                   const RowsetMetaPB& rowset_meta);
 
@@ -192,6 +203,8 @@ public:
 
     static Status clear_del_vector(DataDir* store, WriteBatch* batch, TTabletId tablet_id);
 
+    static Status clear_delta_column_group(DataDir* store, WriteBatch* batch, TTabletId tablet_id);
+
     static Status clear_persistent_index(DataDir* store, WriteBatch* batch, TTabletId tablet_id);
 
     static Status remove_tablet_meta(DataDir* store, WriteBatch* batch, TTabletId tablet_id, TSchemaHash schema_hash);
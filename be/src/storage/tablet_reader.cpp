@@ -14,6 +14,7 @@
 #include "storage/empty_iterator.h"
 #include "storage/merge_iterator.h"
 #include "storage/predicate_parser.h"
+#include "storage/rowset/column_reader.h"
 #include "storage/rowset/rowid_range_option.h"
 #include "storage/seek_range.h"
 #include "storage/tablet.h"
@@ -111,6 +112,7 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
     rs_opts.runtime_state = params.runtime_state;
     rs_opts.profile = params.profile;
     rs_opts.use_page_cache = params.use_page_cache;
+    rs_opts.sequential_scan = params.sequential_scan;
     rs_opts.tablet_schema = &_tablet->tablet_schema();
     rs_opts.global_dictmaps = params.global_dictmaps;
     rs_opts.unused_output_column_ids = params.unused_output_column_ids;
@@ -121,6 +123,7 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
     }
     rs_opts.rowid_range_option = params.rowid_range_option;
     rs_opts.short_key_ranges = params.short_key_ranges;
+    rs_opts.runtime_range_pruner = params.runtime_range_pruner;
 
     SCOPED_RAW_TIMER(&_stats.create_segment_iter_ns);
     for (auto& rowset : _rowsets) {
@@ -129,10 +132,111 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
         }
 
         RETURN_IF_ERROR(rowset->get_segment_iterators(schema(), rs_opts, iters));
+        _iter_rowsets.resize(iters->size(), rowset.get());
     }
     return Status::OK();
 }
 
+// The range of the first key column of the rows of |rowset| from the zone maps of its segments, false if it's unknown.
+static bool get_first_key_range(Rowset* rowset, const TabletColumn& column, TypeInfo* type_info, Datum* min,
+                                Datum* max) {
+    bool has_range = false;
+    for (const auto& segment : rowset->segments()) {
+        if (segment->num_rows() == 0) {
+            continue;
+        }
+        const ColumnReader* reader = segment->num_columns() > 0 ? segment->column(0) : nullptr;
+        // The nulls are the smallest keys, which the zone map doesn't tell.
+        if (reader == nullptr || reader->column_type() != column.type() || reader->segment_zone_map() == nullptr ||
+            reader->segment_zone_map()->has_null() || !reader->segment_zone_map()->has_not_null()) {
+            return false;
+        }
+        Datum segment_min;
+        Datum segment_max;
+        if (!datum_from_string(type_info, &segment_min, reader->segment_zone_map()->min(), nullptr).ok() ||
+            !datum_from_string(type_info, &segment_max, reader->segment_zone_map()->max(), nullptr).ok()) {
+            return false;
+        }
+        if (!has_range || type_info->cmp(segment_min, *min) < 0) {
+            *min = segment_min;
+        }
+        if (!has_range || type_info->cmp(segment_max, *max) > 0) {
+            *max = segment_max;
+        }
+        has_range = true;
+    }
+    return has_range;
+}
+
+ChunkIteratorPtr TabletReader::_new_merge_iterator_of_overlapping_rowsets(
+        const TabletReaderParams& params, const std::vector<ChunkIteratorPtr>& seg_iters) {
+    // The compactions may rely on the merge iterator to record the sources of the rows.
+    if (!config::enable_union_non_overlapping_rowsets || params.reader_type != READER_QUERY || _is_vertical_merge ||
+        seg_iters.size() <= 1 || _iter_rowsets.size() != seg_iters.size()) {
+        return new_heap_merge_iterator(seg_iters);
+    }
+
+    // The ranges of the rowsets, the iterators of a rowset are adjacent.
+    struct RowsetRange {
+        size_t begin;
+        size_t end;
+        Datum min;
+        Datum max;
+    };
+    const TabletColumn& column = _tablet->tablet_schema().column(0);
+    TypeInfoPtr type_info = get_type_info(column);
+    std::vector<RowsetRange> ranges;
+    for (size_t i = 0; i < seg_iters.size(); i++) {
+        if (!ranges.empty() && _iter_rowsets[i] == _iter_rowsets[ranges.back().begin]) {
+            ranges.back().end = i + 1;
+            continue;
+        }
+        RowsetRange range{i, i + 1, {}, {}};
+        if (!get_first_key_range(_iter_rowsets[i], column, type_info.get(), &range.min, &range.max)) {
+            return new_heap_merge_iterator(seg_iters);
+        }
+        ranges.emplace_back(std::move(range));
+    }
+    std::stable_sort(ranges.begin(), ranges.end(), [&](const RowsetRange& lhs, const RowsetRange& rhs) {
+        return type_info->cmp(lhs.min, rhs.min) < 0;
+    });
+
+    // Each group of the overlapping rowsets is merged, and the groups are unioned in the order of the keys.
+    std::vector<ChunkIteratorPtr> group_iters;
+    std::vector<size_t> group;
+    Datum group_max;
+    auto finish_group = [&]() {
+        // The iterators are merged in the order of the versions, as the aggregation of the same keys requires.
+        std::sort(group.begin(), group.end());
+        if (group.size() == 1) {
+            group_iters.emplace_back(seg_iters[group[0]]);
+        } else {
+            std::vector<ChunkIteratorPtr> children;
+            for (size_t i : group) {
+                children.emplace_back(seg_iters[i]);
+            }
+            group_iters.emplace_back(new_heap_merge_iterator(children));
+        }
+        group.clear();
+    };
+    for (const auto& range : ranges) {
+        if (!group.empty() && type_info->cmp(range.min, group_max) > 0) {
+            finish_group();
+        }
+        if (group.empty() || type_info->cmp(range.max, group_max) > 0) {
+            group_max = range.max;
+        }
+        for (size_t i = range.begin; i < range.end; i++) {
+            group.push_back(i);
+        }
+    }
+    finish_group();
+    if (group_iters.size() == 1) {
+        return group_iters[0];
+    }
+    return new_union_iterator(std::move(group_iters));
+}
+
 Status TabletReader::_init_collector(const TabletReaderParams& params) {
     std::vector<ChunkIteratorPtr> seg_iters;
     RETURN_IF_ERROR(get_segment_iterators(params, &seg_iters));
@@ -210,7 +314,7 @@ Status TabletReader::_init_collector(const TabletReaderParams& params) {
             if (_is_vertical_merge && !_is_key) {
                 _collect_iter = new_mask_merge_iterator(seg_iters, _mask_buffer);
             } else {
-                _collect_iter = new_heap_merge_iterator(seg_iters);
+                _collect_iter = _new_merge_iterator_of_overlapping_rowsets(params, seg_iters);
             }
             _collect_iter = timed_chunk_iterator(_collect_iter, sort_timer);
             if (!_is_vertical_merge) {
@@ -223,7 +327,7 @@ Status TabletReader::_init_collector(const TabletReaderParams& params) {
             if (_is_vertical_merge && !_is_key) {
                 _collect_iter = new_mask_merge_iterator(seg_iters, _mask_buffer);
             } else {
-                _collect_iter = new_heap_merge_iterator(seg_iters);
+                _collect_iter = _new_merge_iterator_of_overlapping_rowsets(params, seg_iters);
             }
             if (!_is_vertical_merge) {
                 _collect_iter = new_aggregate_iterator(std::move(_collect_iter), 0);
@@ -59,6 +59,10 @@ private:
     Status _init_predicates(const TabletReaderParams& read_params);
     Status _init_delete_predicates(const TabletReaderParams& read_params, DeletePredicates* dels);
     Status _init_collector(const TabletReaderParams& read_params);
+    // Merge |seg_iters| like new_heap_merge_iterator, except that for the queries the rowsets whose ranges of the
+    // first key column don't overlap the others are unioned instead, which keeps the keys sorted without comparing.
+    ChunkIteratorPtr _new_merge_iterator_of_overlapping_rowsets(const TabletReaderParams& params,
+                                                                const std::vector<ChunkIteratorPtr>& seg_iters);
 
     static Status _to_seek_tuple(const TabletSchema& tablet_schema, const OlapTuple& input, SeekTuple* tuple,
                                  MemPool* mempool);
@@ -77,6 +81,8 @@ private:
     PredicateList _predicate_free_list;
 
     std::vector<RowsetSharedPtr> _rowsets;
+    // The rowset of each iterator returned by get_segment_iterators().
+    std::vector<Rowset*> _iter_rowsets;
     std::shared_ptr<ChunkIterator> _collect_iter;
 
     OlapReaderStatistics _stats;
@@ -23,6 +23,7 @@ struct RowidRangeOption;
 using RowidRangeOptionPtr = std::shared_ptr<RowidRangeOption>;
 struct ShortKeyRangeOption;
 using ShortKeyRangeOptionPtr = std::shared_ptr<ShortKeyRangeOption>;
+class RuntimeRangePruner;
 
 static inline std::unordered_set<uint32_t> EMPTY_FILTERED_COLUMN_IDS;
 
@@ -44,6 +45,9 @@ struct TabletReaderParams {
     // 2. when read column index page
     //     if config::disable_storage_page_cache is false, we use page cache
     bool use_page_cache = false;
+    // Whether it's a big scan unlikely to be repeated soon, its pages are accessed in
+    // CacheAccessMode::SEQUENTIAL to not wipe out the working set of the page cache.
+    bool sequential_scan = false;
 
     RangeStartOperation range = RangeStartOperation::GT;
     RangeEndOperation end_range = RangeEndOperation::LT;
@@ -63,6 +67,9 @@ struct TabletReaderParams {
     RowidRangeOptionPtr rowid_range_option = nullptr;
     std::vector<ShortKeyRangeOptionPtr> short_key_ranges;
 
+    // Prunes the scan by the runtime filters arrived after opening the reader.
+    RuntimeRangePruner* runtime_range_pruner = nullptr;
+
 public:
     std::string to_string() const;
 };
@@ -4,6 +4,7 @@
 
 #include <ctime>
 #include <memory>
+#include <numeric>
 
 #include "common/status.h"
 #include "common/tracer.h"
@@ -20,6 +21,8 @@
 #include "storage/chunk_iterator.h"
 #include "storage/compaction_utils.h"
 #include "storage/del_vector.h"
+#include "storage/delta_column_group.h"
+#include "storage/primary_key_encoder.h"
 #include "storage/rowset/default_value_column_iterator.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_meta_manager.h"
@@ -832,6 +835,7 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
     span->AddEvent("reslove_conflict");
     int64_t t_load = MonotonicMillis();
     EditVersion latest_applied_version;
+    DeferOp end_column_mode([&] { end_column_mode_apply(); });
     st = get_latest_applied_version(&latest_applied_version);
     if (st.ok()) {
         st = state.apply(&_tablet, rowset.get(), rowset_id, latest_applied_version, index);
@@ -855,11 +859,28 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
         new_deletes[rowset_id + i] = {};
     }
     auto& upserts = state.upserts();
+    std::vector<const vectorized::Column*> upsert_pks(upserts.size());
+    size_t upsert_rows = 0;
     for (uint32_t i = 0; i < upserts.size(); i++) {
-        if (upserts[i] != nullptr) {
-            index.upsert(rowset_id + i, 0, *upserts[i], &new_deletes);
-            manager->index_cache().update_object_size(index_entry, index.memory_usage());
+        upsert_pks[i] = upserts[i].get();
+        upsert_rows += upserts[i] != nullptr ? upserts[i]->size() : 0;
+    }
+    bool column_mode = state.is_column_mode();
+    if (column_mode) {
+        // the updated values are in the delta column groups of the existing rows, which keep their position
+        // in the primary index, so the rows of this rowset are all deleted
+        for (uint32_t i = 0; i < upserts.size(); i++) {
+            auto& del_ids = new_deletes[rowset_id + i];
+            del_ids.resize(upserts[i] != nullptr ? upserts[i]->size() : 0);
+            std::iota(del_ids.begin(), del_ids.end(), 0);
         }
+    } else {
+        ThreadPool* index_pool = nullptr;
+        if (static_cast<int64_t>(upsert_rows) >= config::update_apply_index_parallel_min_rows) {
+            index_pool = manager->apply_index_thread_pool();
+        }
+        index.upsert(rowset_id, upsert_pks, index_pool, &new_deletes);
+        manager->index_cache().update_object_size(index_entry, index.memory_usage());
     }
 
     for (const auto& one_delete : state.deletes()) {
@@ -887,6 +908,7 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
     }
 
     manager->index_cache().update_object_size(index_entry, index.memory_usage());
+    std::vector<std::pair<uint32_t, DeltaColumnGroupList>> new_dcgs = state.delta_column_groups();
     // release resource
     // update state only used once, so delete it
     manager->update_state_cache().remove(state_entry);
@@ -982,8 +1004,15 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
             return;
         }
         // 4. write meta
+        std::vector<std::pair<uint32_t, DeltaColumnGroupListPB>> new_dcg_pbs(new_dcgs.size());
+        for (size_t i = 0; i < new_dcgs.size(); i++) {
+            new_dcg_pbs[i].first = new_dcgs[i].first;
+            for (const auto& dcg : new_dcgs[i].second) {
+                dcg->to_pb(new_dcg_pbs[i].second.add_groups());
+            }
+        }
         st = TabletMetaManager::apply_rowset_commit(_tablet.data_dir(), tablet_id, _next_log_id, version, new_del_vecs,
-                                                    index_meta, enable_persistent_index);
+                                                    index_meta, enable_persistent_index, new_dcg_pbs);
         if (!st.ok()) {
             std::string msg = Substitute("_apply_rowset_commit error: write meta failed: $0 $1", st.to_string(),
                                          _debug_string(false));
@@ -998,6 +1027,10 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
             tsid.segment_id = delvec_pair.first;
             manager->set_cached_del_vec(tsid, delvec_pair.second);
         }
+        for (auto& [rssid, dcgs] : new_dcgs) {
+            tsid.segment_id = rssid;
+            manager->set_cached_delta_column_groups(tsid, std::move(dcgs));
+        }
         // 5. apply memory
         _next_log_id++;
         _apply_version_idx++;
@@ -1131,6 +1164,9 @@ Status TabletUpdates::_do_compaction(std::unique_ptr<CompactionInfo>* pinfo) {
             CompactionUtils::get_segment_max_rows(config::max_segment_file_size, input_row_num, input_rowsets_size);
     context.writer_type =
             (algorithm == VERTICAL_COMPACTION ? RowsetWriterType::kVertical : RowsetWriterType::kHorizontal);
+    if (config::compaction_inherit_string_encoding) {
+        context.string_encodings = CompactionUtils::common_string_encodings(_tablet.tablet_schema(), input_rowsets);
+    }
     std::unique_ptr<RowsetWriter> rowset_writer;
     Status st = RowsetFactory::create_rowset_writer(context, &rowset_writer);
     if (!st.ok()) {
@@ -1139,16 +1175,26 @@ Status TabletUpdates::_do_compaction(std::unique_ptr<CompactionInfo>* pinfo) {
         LOG(WARNING) << ss.str();
         return Status::InternalError(ss.str());
     }
+    // Collect the primary keys of the output by the merge for the compaction state, which would read the key
+    // columns of the output rowset again otherwise.
+    std::unique_ptr<vectorized::Column> output_pks;
+    {
+        vector<uint32_t> pk_columns(_tablet.num_key_columns());
+        std::iota(pk_columns.begin(), pk_columns.end(), 0);
+        auto pkey_schema = ChunkHelper::convert_schema_to_format_v2(_tablet.tablet_schema(), pk_columns);
+        RETURN_IF_ERROR(PrimaryKeyEncoder::create_column(pkey_schema, &output_pks));
+    }
     vectorized::MergeConfig cfg;
     cfg.chunk_size = config::vector_chunk_size;
     cfg.algorithm = algorithm;
+    cfg.output_pks = output_pks.get();
     RETURN_IF_ERROR(vectorized::compaction_merge_rowsets(_tablet, info->start_version.major(), input_rowsets,
                                                          rowset_writer.get(), cfg));
     auto output_rowset = rowset_writer->build();
     if (!output_rowset.ok()) return output_rowset.status();
     // 4. commit compaction
     EditVersion version;
-    RETURN_IF_ERROR(_commit_compaction(pinfo, *output_rowset, &version));
+    RETURN_IF_ERROR(_commit_compaction(pinfo, *output_rowset, std::move(output_pks), &version));
     // already committed, so we can ignore timeout error here
     std::unique_lock<std::mutex> ul(_lock);
     _wait_for_version(version, 120000, ul);
@@ -1156,11 +1202,12 @@ Status TabletUpdates::_do_compaction(std::unique_ptr<CompactionInfo>* pinfo) {
 }
 
 Status TabletUpdates::_commit_compaction(std::unique_ptr<CompactionInfo>* pinfo, const RowsetSharedPtr& rowset,
-                                         EditVersion* commit_version) {
+                                         std::unique_ptr<vectorized::Column> output_pks, EditVersion* commit_version) {
     auto span = Tracer::Instance().start_trace_tablet("commit_compaction", _tablet.tablet_id());
     auto scoped_span = trace::Scope(span);
     _compaction_state = std::make_unique<vectorized::CompactionState>();
-    const auto status = _compaction_state->load(rowset.get());
+    const auto status = output_pks != nullptr ? _compaction_state->load(rowset.get(), std::move(output_pks))
+                                              : _compaction_state->load(rowset.get());
     if (!status.ok()) {
         _compaction_state.reset();
         std::string msg = Substitute("_commit_compaction error: load compaction state failed: $0 $1",
@@ -1195,6 +1242,30 @@ Status TabletUpdates::_commit_compaction(std::unique_ptr<CompactionInfo>* pinfo,
     }
     CHECK(inputs.size() <= ors.size()) << Substitute("compaction input size($0) > rowset size($1) tablet:$2",
                                                      inputs.size(), ors.size(), _tablet.tablet_id());
+    // The inputs are read at the start version, so the values updated in column mode after it would be lost.
+    bool column_updated = _column_mode_applying;
+    auto manager = StorageEngine::instance()->update_manager();
+    for (size_t i = 0; i < inputs.size() && !column_updated; i++) {
+        auto input_rowset = _get_rowset(inputs[i]);
+        for (uint32_t j = 0; input_rowset != nullptr && j < input_rowset->num_segments() && !column_updated; j++) {
+            DeltaColumnGroupList dcgs;
+            auto dcg_st = manager->get_delta_column_groups(_tablet.data_dir()->get_meta(),
+                                                           TabletSegmentId{_tablet.tablet_id(), inputs[i] + j},
+                                                           INT64_MAX, &dcgs);
+            if (!dcg_st.ok()) {
+                _compaction_state.reset();
+                return dcg_st;
+            }
+            column_updated = !dcgs.empty() && dcgs.back()->version() > (*pinfo)->start_version.major();
+        }
+    }
+    if (column_updated) {
+        _compaction_state.reset();
+        auto msg = Substitute("compaction inputs are updated in column mode after $0 tablet:$1",
+                              (*pinfo)->start_version.to_string(), _tablet.tablet_id());
+        LOG(WARNING) << msg;
+        return Status::Cancelled(msg);
+    }
     std::vector<uint32_t> nrs = modify(ors, &rowsetid, &rowsetid + 1, inputs.begin(), inputs.end());
     if (nrs.size() <= 16) {
         // full copy
@@ -1381,7 +1452,7 @@ void TabletUpdates::_apply_compaction_commit(const EditVersionInfo& version_info
         }
         // 3. write meta
         st = TabletMetaManager::apply_rowset_commit(_tablet.data_dir(), tablet_id, _next_log_id, version_info.version,
-                                                    delvecs, index_meta, enable_persistent_index);
+                                                    delvecs, index_meta, enable_persistent_index, {});
         if (!st.ok()) {
             manager->index_cache().release(index_entry);
             std::string msg = Substitute("_apply_compaction_commit error: write meta failed: $0 $1", st.to_string(),
@@ -1559,13 +1630,20 @@ void TabletUpdates::remove_expired_versions(int64_t expire_time) {
         size_t n_delvec_range = 0;
         auto res = TabletMetaManager::list_del_vector(meta_store, tablet_id, max_expired_version + 1);
         if (res.ok()) {
+            // The ranges of all the segments are deleted by one write.
+            rocksdb::WriteBatch wb;
             for (const auto& elem : *res) {
                 auto segment_id = elem.first;
                 auto end_version = elem.second;
-                (void)TabletMetaManager::delete_del_vector_range(meta_store, tablet_id, segment_id, 0, end_version);
+                (void)TabletMetaManager::delete_del_vector_range(meta_store, &wb, tablet_id, segment_id, 0,
+                                                                 end_version);
                 VLOG(1) << "Removed delete vector tablet_id=" << tablet_id << " segment_id=" << segment_id
                         << " start_version=0 end_version=" << end_version;
             }
+            if (wb.Count() > 0) {
+                auto st = meta_store->write_batch(&wb);
+                LOG_IF(WARNING, !st.ok()) << "Fail to remove delete vectors of tablet " << tablet_id << ": " << st;
+            }
             n_delvec_range = (*res).size();
         } else {
             LOG(WARNING) << "Fail to list delete vector: " << res.status();
@@ -2242,6 +2320,20 @@ Status TabletUpdates::link_from(Tablet* base_tablet, int64_t request_version) {
                      << " version:" << request_version << " reason:" << st;
         return st;
     }
+    // the delta column groups are not linked, the caller converts the rowsets instead
+    for (const auto& rowset : rowsets) {
+        for (uint32_t i = 0; i < rowset->num_segments(); i++) {
+            DeltaColumnGroupList dcgs;
+            RETURN_IF_ERROR(StorageEngine::instance()->update_manager()->get_delta_column_groups(
+                    base_tablet->data_dir()->get_meta(),
+                    TabletSegmentId{base_tablet->tablet_id(), rowset->rowset_meta()->get_rowset_seg_id() + i},
+                    version.major(), &dcgs));
+            if (!dcgs.empty()) {
+                LOG(INFO) << "link_from: base tablet is updated in column mode tablet:" << base_tablet->tablet_id();
+                return Status::NotSupported("link_from: base tablet is updated in column mode");
+            }
+        }
+    }
 
     // disable compaction temporarily when tablet just loaded
     _last_compaction_time_ms = UnixMillis();
@@ -2316,6 +2408,7 @@ Status TabletUpdates::link_from(Tablet* base_tablet, int64_t request_version) {
     RETURN_IF_ERROR(TabletMetaManager::clear_log(data_dir, &wb, tablet_id));
     RETURN_IF_ERROR(TabletMetaManager::clear_rowset(data_dir, &wb, tablet_id));
     RETURN_IF_ERROR(TabletMetaManager::clear_del_vector(data_dir, &wb, tablet_id));
+    RETURN_IF_ERROR(TabletMetaManager::clear_delta_column_group(data_dir, &wb, tablet_id));
     RETURN_IF_ERROR(TabletMetaManager::clear_persistent_index(data_dir, &wb, tablet_id));
     // do not clear pending rowsets, because these pending rowsets should be committed after schemachange is done
     RETURN_IF_ERROR(TabletMetaManager::put_tablet_meta(data_dir, &wb, meta_pb));
@@ -2476,6 +2569,7 @@ Status TabletUpdates::convert_from(const std::shared_ptr<Tablet>& base_tablet, i
     RETURN_IF_ERROR(TabletMetaManager::clear_log(data_dir, &wb, tablet_id));
     RETURN_IF_ERROR(TabletMetaManager::clear_rowset(data_dir, &wb, tablet_id));
     RETURN_IF_ERROR(TabletMetaManager::clear_del_vector(data_dir, &wb, tablet_id));
+    RETURN_IF_ERROR(TabletMetaManager::clear_delta_column_group(data_dir, &wb, tablet_id));
     RETURN_IF_ERROR(TabletMetaManager::clear_persistent_index(data_dir, &wb, tablet_id));
     // do not clear pending rowsets, because these pending rowsets should be committed after schemachange is done
     RETURN_IF_ERROR(TabletMetaManager::put_tablet_meta(data_dir, &wb, meta_pb));
@@ -2846,14 +2940,15 @@ Status TabletUpdates::load_snapshot(const SnapshotMeta& snapshot_meta) {
 }
 
 void TabletUpdates::_clear_rowset_del_vec_cache(const Rowset& rowset) {
-    StorageEngine::instance()->update_manager()->clear_cached_del_vec([&]() {
-        std::vector<TabletSegmentId> tsids;
-        tsids.reserve(rowset.num_segments());
-        for (auto i = 0; i < rowset.num_segments(); i++) {
-            tsids.emplace_back(TabletSegmentId{_tablet.tablet_id(), rowset.rowset_meta()->get_rowset_seg_id() + i});
-        }
-        return tsids;
-    }());
+    std::vector<TabletSegmentId> tsids;
+    tsids.reserve(rowset.num_segments());
+    for (auto i = 0; i < rowset.num_segments(); i++) {
+        tsids.emplace_back(TabletSegmentId{_tablet.tablet_id(), rowset.rowset_meta()->get_rowset_seg_id() + i});
+    }
+    auto manager = StorageEngine::instance()->update_manager();
+    manager->clear_cached_del_vec(tsids);
+    // the delta column groups are attached to the segments like the delete vectors.
+    manager->clear_cached_delta_column_groups(tsids);
 }
 
 Status TabletUpdates::clear_meta() {
@@ -2876,6 +2971,7 @@ Status TabletUpdates::clear_meta() {
     TabletMetaManager::clear_pending_rowset(data_store, &wb, _tablet.tablet_id());
     TabletMetaManager::clear_rowset(data_store, &wb, _tablet.tablet_id());
     TabletMetaManager::clear_del_vector(data_store, &wb, _tablet.tablet_id());
+    TabletMetaManager::clear_delta_column_group(data_store, &wb, _tablet.tablet_id());
     TabletMetaManager::clear_log(data_store, &wb, _tablet.tablet_id());
     TabletMetaManager::clear_persistent_index(data_store, &wb, _tablet.tablet_id());
     TabletMetaManager::remove_tablet_meta(data_store, &wb, _tablet.tablet_id(), _tablet.schema_hash());
@@ -2977,9 +3073,16 @@ Status TabletUpdates::get_column_values(std::vector<uint32_t>& column_ids, bool
         iter_opts.stats = &stats;
         ASSIGN_OR_RETURN(auto read_file, fs->new_random_access_file((*segment)->file_name()));
         iter_opts.read_file = read_file.get();
+        // the latest values, including the ones updated in column mode.
+        DeltaColumnGroupList dcgs;
+        RETURN_IF_ERROR(StorageEngine::instance()->update_manager()->get_delta_column_groups(
+                _tablet.data_dir()->get_meta(), TabletSegmentId{_tablet.tablet_id(), rssid}, INT64_MAX, &dcgs));
         for (auto i = 0; i < column_ids.size(); ++i) {
             ColumnIterator* col_iter_raw_ptr = nullptr;
             RETURN_IF_ERROR((*segment)->new_column_iterator(column_ids[i], &col_iter_raw_ptr));
+            if (!dcgs.empty()) {
+                RETURN_IF_ERROR(DeltaColumnIterator::wrap(**segment, column_ids[i], dcgs, &col_iter_raw_ptr));
+            }
             std::unique_ptr<ColumnIterator> col_iter(col_iter_raw_ptr);
             RETURN_IF_ERROR(col_iter->init(iter_opts));
             RETURN_IF_ERROR(col_iter->fetch_values_by_rowid(rowids.data(), rowids.size(), (*columns)[i].get()));
@@ -2988,6 +3091,84 @@ Status TabletUpdates::get_column_values(std::vector<uint32_t>& column_ids, bool
     return Status::OK();
 }
 
+Status TabletUpdates::get_rows_by_keys(const vectorized::Column& pks, const std::vector<uint32_t>& column_ids,
+                                       std::vector<bool>* found, vector<std::unique_ptr<vectorized::Column>>* columns,
+                                       int64_t* version) {
+    // Hold the index lock until the values are read, so that the rowids are not changed by an apply.
+    std::lock_guard lg(_index_lock);
+    {
+        std::lock_guard wl(_lock);
+        if (_edit_version_infos.empty()) {
+            string msg = Substitute("tablet deleted when get_rows_by_keys tablet:$0", _tablet.tablet_id());
+            LOG(WARNING) << msg;
+            return Status::InternalError(msg);
+        }
+        *version = _edit_version_infos[_apply_version_idx]->version.major();
+    }
+
+    auto manager = StorageEngine::instance()->update_manager();
+    auto index_entry = manager->index_cache().get_or_create(_tablet.tablet_id());
+    index_entry->update_expire_time(MonotonicMillis() + manager->get_cache_expire_ms());
+    auto& index = index_entry->value();
+    auto st = index.load(&_tablet);
+    manager->index_cache().update_object_size(index_entry, index.memory_usage());
+    if (!st.ok()) {
+        manager->index_cache().remove(index_entry);
+        std::string msg = Substitute("get_rows_by_keys error: load primary index failed: $0 $1", st.to_string(),
+                                     debug_string());
+        LOG(WARNING) << msg;
+        return Status::InternalError(msg);
+    }
+    std::vector<uint64_t> rss_rowids(pks.size());
+    index.get(pks, &rss_rowids);
+    manager->index_cache().release(index_entry);
+
+    // The values are read segment by segment, in the order of the rowids.
+    std::map<uint32_t, std::vector<std::pair<uint32_t, uint32_t>>> rowid_and_pos_by_rssid;
+    found->assign(pks.size(), false);
+    uint32_t num_found = 0;
+    for (uint32_t i = 0; i < rss_rowids.size(); ++i) {
+        if (rss_rowids[i] == NullIndexValue) {
+            continue;
+        }
+        (*found)[i] = true;
+        auto rssid = static_cast<uint32_t>(rss_rowids[i] >> 32);
+        auto rowid = static_cast<uint32_t>(rss_rowids[i] & ROWID_MASK);
+        rowid_and_pos_by_rssid[rssid].emplace_back(rowid, num_found++);
+    }
+    if (num_found == 0) {
+        return Status::OK();
+    }
+
+    std::map<uint32_t, std::vector<uint32_t>> rowids_by_rssid;
+    // The position of each value read in the result.
+    std::vector<uint32_t> positions;
+    positions.reserve(num_found);
+    for (auto& [rssid, rowid_and_pos] : rowid_and_pos_by_rssid) {
+        std::sort(rowid_and_pos.begin(), rowid_and_pos.end());
+        auto& rowids = rowids_by_rssid[rssid];
+        for (const auto& [rowid, pos] : rowid_and_pos) {
+            rowids.push_back(rowid);
+            positions.push_back(pos);
+        }
+    }
+    std::vector<uint32_t> column_ids_copy = column_ids;
+    vector<std::unique_ptr<vectorized::Column>> read_columns(columns->size());
+    for (size_t i = 0; i < columns->size(); ++i) {
+        read_columns[i] = (*columns)[i]->clone_empty();
+    }
+    RETURN_IF_ERROR(get_column_values(column_ids_copy, false, rowids_by_rssid, &read_columns));
+
+    std::vector<uint32_t> indexes(num_found);
+    for (uint32_t i = 0; i < num_found; ++i) {
+        indexes[positions[i]] = i;
+    }
+    for (size_t i = 0; i < columns->size(); ++i) {
+        (*columns)[i]->append_selective(*read_columns[i], indexes.data(), 0, num_found);
+    }
+    return Status::OK();
+}
+
 Status TabletUpdates::prepare_partial_update_states(Tablet* tablet, const std::vector<ColumnUniquePtr>& upserts,
                                                     EditVersion* read_version, uint32_t* next_rowset_id,
                                                     std::vector<std::vector<uint64_t>*>* rss_rowids) {
@@ -3137,4 +3318,29 @@ Status TabletUpdates::get_rowsets_for_incremental_snapshot(const std::vector<int
     return Status::OK();
 }
 
+Status TabletUpdates::get_rowset_of_segment(uint32_t rssid, RowsetSharedPtr* rowset, uint32_t* segment_idx) {
+    std::lock_guard<std::mutex> l(_rowsets_lock);
+    for (const auto& [rowset_seg_id, rs] : _rowsets) {
+        if (rowset_seg_id <= rssid && rssid < rowset_seg_id + rs->num_segments()) {
+            *rowset = rs;
+            *segment_idx = rssid - rowset_seg_id;
+            return Status::OK();
+        }
+    }
+    std::string msg = Substitute("rowset of segment not found tablet:$0 rssid:$1", _tablet.tablet_id(), rssid);
+    LOG(WARNING) << msg;
+    return Status::NotFound(msg);
+}
+
+bool TabletUpdates::try_begin_column_mode_apply() {
+    std::lock_guard wl(_lock);
+    for (size_t i = _apply_version_idx + 1; i < _edit_version_infos.size(); i++) {
+        if (_edit_version_infos[i]->compaction) {
+            return false;
+        }
+    }
+    _column_mode_applying = true;
+    return true;
+}
+
 } // namespace starrocks
@@ -220,6 +220,13 @@ public:
                              std::map<uint32_t, std::vector<uint32_t>>& rowids_by_rssid,
                              vector<std::unique_ptr<vectorized::Column>>* columns);
 
+    // Look up the primary keys |pks|, encoded by PrimaryKeyEncoder, at the latest applied version, which is
+    // returned in |version|. |found| tells whether each key is found, and the values of |column_ids| of the rows
+    // found are appended to |columns| in the order of |pks|.
+    Status get_rows_by_keys(const vectorized::Column& pks, const std::vector<uint32_t>& column_ids,
+                            std::vector<bool>* found, vector<std::unique_ptr<vectorized::Column>>* columns,
+                            int64_t* version);
+
     Status prepare_partial_update_states(Tablet* tablet, const std::vector<ColumnUniquePtr>& upserts,
                                          EditVersion* read_version, uint32_t* next_rowset_id,
                                          std::vector<std::vector<uint64_t>*>* rss_rowids);
@@ -229,6 +236,16 @@ public:
     Status get_rowsets_for_incremental_snapshot(const std::vector<int64_t>& missing_version_ranges,
                                                 std::vector<RowsetSharedPtr>& rowsets);
 
+    // Find the rowset of the segment |rssid| and the index of the segment in it.
+    Status get_rowset_of_segment(uint32_t rssid, RowsetSharedPtr* rowset, uint32_t* segment_idx);
+
+    // A column mode partial update writes delta column groups for the segments, which a compaction reading
+    // its inputs at an older version would lose. Returns false if a compaction commit is pending to be
+    // applied, otherwise the compaction commits are refused until end_column_mode_apply().
+    bool try_begin_column_mode_apply();
+
+    void end_column_mode_apply() { _column_mode_applying = false; }
+
 private:
     friend class Tablet;
     friend class PrimaryIndex;
@@ -287,8 +304,9 @@ private:
     // assuming _lock already hold
     Status _wait_for_version(const EditVersion& version, int64_t timeout_ms, std::unique_lock<std::mutex>& lock);
 
+    // |output_pks| are the encoded primary keys of |rowset| collected by the merge, or null to read them.
     Status _commit_compaction(std::unique_ptr<CompactionInfo>* info, const RowsetSharedPtr& rowset,
-                              EditVersion* commit_version);
+                              std::unique_ptr<vectorized::Column> output_pks, EditVersion* commit_version);
 
     // Find all but the latest already-applied versions whose creation time is less than or
     // equal to |expire_time|, then append them into |expire_list| and erase them from the
@@ -373,6 +391,8 @@ private:
     BlockingQueue<RowsetSharedPtr> _unused_rowsets;
 
     std::atomic<bool> _compaction_running{false};
+    // a column mode partial update is being applied, see try_begin_column_mode_apply()
+    std::atomic<bool> _column_mode_applying{false};
     int64_t _last_compaction_time_ms = 0;
     std::atomic<int64_t> _last_compaction_success_millis{0};
     std::atomic<int64_t> _last_compaction_failure_millis{0};
@@ -24,8 +24,11 @@
 #include <fmt/format.h>
 #include <sys/stat.h>
 
+#include <atomic>
 #include <filesystem>
+#include <mutex>
 #include <set>
+#include <thread>
 
 #include "agent/finish_task.h"
 #include "agent/master_info.h"
@@ -44,10 +47,12 @@
 #include "service/backend_options.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_factory.h"
+#include "storage/rowset/segment.h"
 #include "storage/snapshot_manager.h"
 #include "storage/tablet_updates.h"
 #include "util/defer_op.h"
 #include "util/string_parser.hpp"
+#include "util/thread.h"
 #include "util/thrift_rpc_helper.h"
 
 using std::set;
@@ -65,6 +70,14 @@ const uint32_t DOWNLOAD_FILE_MAX_RETRY = 3;
 const uint32_t LIST_REMOTE_FILE_TIMEOUT = 15;
 const uint32_t GET_LENGTH_TIMEOUT = 10;
 
+// Check the magic number and the checksum of the footer of the segment file |path|.
+static Status check_segment_footer(const std::string& path) {
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(path));
+    ASSIGN_OR_RETURN(auto read_file, fs->new_random_access_file(path));
+    SegmentFooterPB footer;
+    return Segment::parse_segment_footer(read_file.get(), &footer, nullptr, nullptr);
+}
+
 void run_clone_task(std::shared_ptr<TAgentTaskRequest> agent_task_req, TaskWorkerPool* clone_task_worker_pool) {
     const TCloneReq& clone_req = agent_task_req->clone_req;
     AgentStatus status = STARROCKS_SUCCESS;
@@ -579,10 +592,17 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
     }
 
     // Get copy from remote
-    uint64_t total_file_size = 0;
+    std::atomic<uint64_t> total_file_size = 0;
     MonotonicStopWatch watch;
     watch.start();
-    for (int i = 0; i < file_name_list.size(); ++i) {
+    const int num_streams = std::max(1, config::clone_download_streams);
+    // The streams of a clone share max_download_speed_kbps evenly, so the parallel download takes no more
+    // bandwidth than a serial one.
+    const int64_t stream_max_speed_kbps = std::max<int64_t>(1, config::max_download_speed_kbps / num_streams);
+    auto download_file = [&](int i) -> Status {
+        if (StorageEngine::instance()->bg_worker_stopped()) {
+            return Status::InternalError("Process is going to quit. The download will stop.");
+        }
         std::string& file_name = file_name_list[i];
         auto remote_file_url = remote_url_prefix + file_name;
 
@@ -610,16 +630,19 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
         if (estimate_timeout < config::download_low_speed_time) {
             estimate_timeout = config::download_low_speed_time;
         }
+        // A stream is slower than a serial download.
+        estimate_timeout = std::max<uint64_t>(estimate_timeout, file_size / 1024 / stream_max_speed_kbps * 2);
 
         std::string local_file_path = local_path + file_name;
 
         VLOG(1) << "Downloading " << remote_file_url << " to " << local_path << ". bytes=" << file_size
                 << " timeout=" << estimate_timeout;
 
-        auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path, file_size](HttpClient* client) {
+        auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path, file_size,
+                            stream_max_speed_kbps](HttpClient* client) {
             RETURN_IF_ERROR(client->init(remote_file_url));
             client->set_timeout_ms(estimate_timeout * 1000);
-            RETURN_IF_ERROR(client->download(local_file_path));
+            RETURN_IF_ERROR(client->download(local_file_path, stream_max_speed_kbps));
 
             // Check file length
             uint64_t local_file_size = std::filesystem::file_size(local_file_path);
@@ -628,11 +651,50 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
                              << file_size;
                 return Status::InternalError("mismatched file size");
             }
+            // The pages of a segment are checked by their own checksums when read, check its footer here,
+            // so that a broken download is retried rather than loaded.
+            if (StringPiece(local_file_path).ends_with(".dat")) {
+                if (Status st = check_segment_footer(local_file_path); !st.ok()) {
+                    LOG(WARNING) << "Fail to download " << remote_file_url << ": " << st;
+                    return st;
+                }
+            }
             chmod(local_file_path.c_str(), S_IRUSR | S_IWUSR);
             return Status::OK();
         };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
-    } // Clone files from remote backend
+        return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+    };
+
+    // The files but the last header file are downloaded by |num_streams| threads in parallel.
+    const int num_parallel_files = static_cast<int>(file_name_list.size()) - 1;
+    std::atomic<int> next_file = 0;
+    std::mutex status_mutex;
+    Status download_status;
+    auto download_files = [&]() {
+        for (int i = next_file++; i < num_parallel_files; i = next_file++) {
+            Status st = download_file(i);
+            if (!st.ok()) {
+                std::lock_guard l(status_mutex);
+                download_status = std::move(st);
+                // Let the other threads stop.
+                next_file = num_parallel_files;
+                return;
+            }
+        }
+    };
+    std::vector<std::thread> download_threads;
+    for (int i = 1; i < std::min(num_streams, num_parallel_files); ++i) {
+        download_threads.emplace_back(download_files);
+        Thread::set_thread_name(download_threads.back(), "clone_download");
+    }
+    download_files();
+    for (auto& thread : download_threads) {
+        thread.join();
+    }
+    RETURN_IF_ERROR(download_status);
+    if (!file_name_list.empty()) {
+        RETURN_IF_ERROR(download_file(file_name_list.size() - 1));
+    }
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
@@ -23,10 +23,16 @@
 
 #include <fmt/format.h>
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "common/config.h"
 #include "runtime/exec_env.h"
 #include "storage/snapshot_manager.h"
 #include "storage/tablet_meta_manager.h"
 #include "util/defer_op.h"
+#include "util/thread.h"
 
 namespace starrocks {
 
@@ -336,17 +342,38 @@ void EngineStorageMigrationTask::_generate_new_header(DataDir* store, const uint
 Status EngineStorageMigrationTask::_copy_index_and_data_files(
         const string& schema_hash_path, const TabletSharedPtr& ref_tablet,
         const std::vector<RowsetSharedPtr>& consistent_rowsets) const {
+    // The rowsets are copied by |num_streams| threads, which share storage_migration_max_speed_kbps evenly.
+    const int num_streams = std::max(1, config::storage_migration_copy_streams);
+    const int64_t stream_max_speed = int64_t(config::storage_migration_max_speed_kbps) * 1024 / num_streams;
+    const int num_rowsets = static_cast<int>(consistent_rowsets.size());
+    std::atomic<int> next_rowset = 0;
+    std::mutex status_mutex;
     Status status = Status::OK();
-    for (const auto& rs : consistent_rowsets) {
-        bool bg_worker_stopped = StorageEngine::instance()->bg_worker_stopped();
-        if (bg_worker_stopped) {
-            status = Status::InternalError("Process is going to quit.");
-            break;
-        }
-        status = rs->copy_files_to(schema_hash_path);
-        if (!status.ok()) {
-            break;
+    auto copy_rowsets = [&]() {
+        for (int i = next_rowset++; i < num_rowsets; i = next_rowset++) {
+            Status st;
+            if (StorageEngine::instance()->bg_worker_stopped()) {
+                st = Status::InternalError("Process is going to quit.");
+            } else {
+                st = consistent_rowsets[i]->copy_files_to(schema_hash_path, stream_max_speed);
+            }
+            if (!st.ok()) {
+                std::lock_guard l(status_mutex);
+                status = std::move(st);
+                // Let the other threads stop.
+                next_rowset = num_rowsets;
+                return;
+            }
         }
+    };
+    std::vector<std::thread> copy_threads;
+    for (int i = 1; i < std::min(num_streams, num_rowsets); ++i) {
+        copy_threads.emplace_back(copy_rowsets);
+        Thread::set_thread_name(copy_threads.back(), "migration_copy");
+    }
+    copy_rowsets();
+    for (auto& thread : copy_threads) {
+        thread.join();
     }
     return status;
 }
@@ -2,6 +2,8 @@
 
 #include "storage/update_compaction_state.h"
 
+#include <fmt/format.h>
+
 #include "storage/chunk_helper.h"
 #include "storage/primary_key_encoder.h"
 #include "storage/rowset/rowset.h"
@@ -38,8 +40,64 @@ Status CompactionState::load(Rowset* rowset) {
     return _status;
 }
 
+Status CompactionState::load(Rowset* rowset, std::unique_ptr<Column> pks) {
+    if (UNLIKELY(!_status.ok())) {
+        return _status;
+    }
+    std::call_once(_load_once_flag, [&] {
+        _status = _do_load(rowset, std::move(pks));
+        LOG_IF(WARNING, !_status.ok()) << "load CompactionState error: " << _status
+                                       << " tablet:" << rowset->rowset_meta()->tablet_id();
+    });
+    return _status;
+}
+
 static const size_t large_compaction_memory_threshold = 1000000000;
 
+Status CompactionState::_do_load(Rowset* rowset, std::unique_ptr<Column> pks) {
+    RowsetReleaseGuard guard(rowset->shared_from_this());
+    RETURN_IF_ERROR(rowset->load());
+    size_t offset = 0;
+    for (const auto& segment : rowset->segments()) {
+        offset += segment->num_rows();
+    }
+    if (offset != pks->size()) {
+        return Status::InternalError(
+                fmt::format("mismatched primary keys of rowset: {} != {}", pks->size(), offset));
+    }
+    pk_cols.resize(rowset->num_segments());
+    if (pk_cols.size() == 1) {
+        pk_cols[0] = std::move(pks);
+    } else {
+        offset = 0;
+        for (size_t i = 0; i < pk_cols.size(); i++) {
+            auto num_rows = rowset->segments()[i]->num_rows();
+            auto col = pks->clone_empty();
+            col->append(*pks, offset, num_rows);
+            offset += num_rows;
+            pk_cols[i] = std::move(col);
+        }
+    }
+    _track_memory(rowset);
+    return Status::OK();
+}
+
+void CompactionState::_track_memory(Rowset* rowset) {
+    auto update_manager = StorageEngine::instance()->update_manager();
+    auto tracker = update_manager->compaction_state_mem_tracker();
+    for (const auto& col : pk_cols) {
+        _memory_usage += col->memory_usage();
+        tracker->consume(col->memory_usage());
+    }
+    if (tracker->any_limit_exceeded()) {
+        // currently we can only log error here, and allow memory over usage
+        LOG(ERROR) << " memory limit exceeded when loading compaction state pk tablet_id:"
+                   << rowset->rowset_meta()->tablet_id() << " rowset #rows:" << rowset->num_rows()
+                   << " size:" << rowset->data_disk_size() << " memory:" << _memory_usage
+                   << " stats:" << update_manager->memory_stats();
+    }
+}
+
 Status CompactionState::_do_load(Rowset* rowset) {
     auto& schema = rowset->schema();
     vector<uint32_t> pk_columns;
@@ -25,12 +25,18 @@ public:
 
     Status load(Rowset* rowset);
 
+    // Load the state from |pks|, the encoded primary keys of all rows of |rowset| in order, which are collected
+    // when |rowset| is written, instead of reading its segments.
+    Status load(Rowset* rowset, std::unique_ptr<Column> pks);
+
     size_t memory_usage() const { return _memory_usage; }
 
     std::vector<ColumnPtr> pk_cols;
 
 private:
     Status _do_load(Rowset* rowset);
+    Status _do_load(Rowset* rowset, std::unique_ptr<Column> pks);
+    void _track_memory(Rowset* rowset);
 
     std::once_flag _load_once_flag;
     Status _status;
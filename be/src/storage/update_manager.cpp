@@ -2,10 +2,12 @@
 
 #include "storage/update_manager.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <numeric>
 
+#include "common/config.h"
 #include "gutil/endian.h"
 #include "storage/chunk_helper.h"
 #include "storage/del_vector.h"
@@ -38,6 +40,9 @@ UpdateManager::~UpdateManager() {
         // should be shutdown.
         _apply_thread_pool->shutdown();
     }
+    if (_apply_index_thread_pool != nullptr) {
+        _apply_index_thread_pool->shutdown();
+    }
     clear_cache();
     if (_compaction_state_mem_tracker) {
         _compaction_state_mem_tracker.reset();
@@ -54,8 +59,31 @@ UpdateManager::~UpdateManager() {
 }
 
 Status UpdateManager::init() {
-    auto st = ThreadPoolBuilder("update_apply").build(&_apply_thread_pool);
-    return st;
+    RETURN_IF_ERROR(ThreadPoolBuilder("update_apply").build(&_apply_thread_pool));
+    if (config::update_apply_index_num_threads > 0) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("update_apply_idx")
+                                .set_max_threads(config::update_apply_index_num_threads)
+                                .build(&_apply_index_thread_pool));
+    }
+    _update_index_cache_capacity();
+    return Status::OK();
+}
+
+void UpdateManager::_update_index_cache_capacity() {
+    size_t capacity = std::numeric_limits<size_t>::max();
+    int64_t limit = _update_mem_tracker != nullptr ? _update_mem_tracker->limit() : -1;
+    int32_t percent = config::update_index_cache_capacity_percent;
+    if (limit > 0 && percent > 0) {
+        capacity = limit * std::min(percent, 100) / 100;
+    }
+    if (capacity != _index_cache.capacity()) {
+        LOG(INFO) << "set capacity of primary index cache to " << capacity;
+        if (!_index_cache.set_capacity(capacity)) {
+            LOG(WARNING) << Substitute("primary index cache size $0 exceeds capacity $1 after eviction",
+                                       PrettyPrinter::print_bytes(_index_cache.size()),
+                                       PrettyPrinter::print_bytes(capacity));
+        }
+    }
 }
 
 Status UpdateManager::get_del_vec_in_meta(KVStore* meta, const TabletSegmentId& tsid, int64_t version,
@@ -122,6 +150,10 @@ void UpdateManager::clear_cache() {
         StarRocksMetrics::instance()->update_del_vector_num.set_value(0);
         StarRocksMetrics::instance()->update_del_vector_bytes_total.set_value(0);
     }
+    {
+        std::lock_guard<std::mutex> lg(_dcg_cache_lock);
+        _dcg_cache.clear();
+    }
 }
 
 void UpdateManager::clear_cached_del_vec(const std::vector<TabletSegmentId>& tsids) {
@@ -135,7 +167,58 @@ void UpdateManager::clear_cached_del_vec(const std::vector<TabletSegmentId>& tsi
     }
 }
 
+void UpdateManager::clear_cached_delta_column_groups(const std::vector<TabletSegmentId>& tsids) {
+    std::lock_guard<std::mutex> lg(_dcg_cache_lock);
+    for (const auto& tsid : tsids) {
+        _dcg_cache.erase(tsid);
+    }
+}
+
+Status UpdateManager::get_delta_column_groups(KVStore* meta, const TabletSegmentId& tsid, int64_t version,
+                                              DeltaColumnGroupList* dcgs) {
+    dcgs->clear();
+    DeltaColumnGroupList all;
+    bool cached = false;
+    {
+        std::lock_guard<std::mutex> lg(_dcg_cache_lock);
+        auto itr = _dcg_cache.find(tsid);
+        if (itr != _dcg_cache.end()) {
+            all = itr->second;
+            cached = true;
+        }
+    }
+    if (!cached) {
+        DeltaColumnGroupListPB list_pb;
+        auto st = TabletMetaManager::get_delta_column_groups(meta, tsid.tablet_id, tsid.segment_id, &list_pb);
+        if (!st.ok() && !st.is_not_found()) {
+            return st;
+        }
+        for (const auto& dcg_pb : list_pb.groups()) {
+            all.emplace_back(std::make_shared<DeltaColumnGroup>(dcg_pb));
+        }
+        std::lock_guard<std::mutex> lg(_dcg_cache_lock);
+        // keep the groups set by an apply in the meanwhile, which are newer.
+        auto [itr, inserted] = _dcg_cache.emplace(tsid, all);
+        if (!inserted) {
+            all = itr->second;
+        }
+    }
+    for (auto& dcg : all) {
+        if (dcg->version() <= version) {
+            dcgs->emplace_back(std::move(dcg));
+        }
+    }
+    return Status::OK();
+}
+
+void UpdateManager::set_cached_delta_column_groups(const TabletSegmentId& tsid, DeltaColumnGroupList dcgs) {
+    std::lock_guard<std::mutex> lg(_dcg_cache_lock);
+    _dcg_cache[tsid] = std::move(dcgs);
+}
+
 void UpdateManager::expire_cache() {
+    // pick up the change of update_index_cache_capacity_percent
+    _update_index_cache_capacity();
     StarRocksMetrics::instance()->update_primary_index_num.set_value(_index_cache.object_size());
     StarRocksMetrics::instance()->update_primary_index_bytes_total.set_value(_index_cache.size());
     {
@@ -162,8 +245,9 @@ void UpdateManager::expire_cache() {
 }
 
 string UpdateManager::memory_stats() {
-    return Substitute("index:$0 rowset:$1 compaction:$2 delvec:$3 total:$4/$5",
+    return Substitute("index:$0/$1 rowset:$2 compaction:$3 delvec:$4 total:$5/$6",
                       PrettyPrinter::print_bytes(_index_cache_mem_tracker->consumption()),
+                      PrettyPrinter::print_bytes(_index_cache.capacity()),
                       PrettyPrinter::print_bytes(_update_state_mem_tracker->consumption()),
                       PrettyPrinter::print_bytes(_compaction_state_mem_tracker->consumption()),
                       PrettyPrinter::print_bytes(_del_vec_cache_mem_tracker->consumption()),
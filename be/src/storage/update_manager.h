@@ -5,6 +5,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "storage/delta_column_group.h"
 #include "storage/olap_common.h"
 #include "storage/primary_index.h"
 #include "util/dynamic_cache.h"
@@ -22,8 +23,8 @@ class RowsetUpdateState;
 class Tablet;
 
 // UpdateManager maintain update feature related data structures, including
-// PrimaryIndexe cache, RowsetUpdateState cache, DelVector cache and
-// async apply thread pool.
+// PrimaryIndexe cache, RowsetUpdateState cache, DelVector cache,
+// DeltaColumnGroup cache and async apply thread pool.
 class UpdateManager {
 public:
     UpdateManager(MemTracker* mem_tracker);
@@ -46,12 +47,25 @@ public:
 
     Status set_cached_del_vec(const TabletSegmentId& tsid, const DelVectorPtr& delvec);
 
+    // Get the delta column groups of segment |tsid| whose versions are not greater than |version|,
+    // in the ascending order of version. |dcgs| is empty if the segment has no delta column group.
+    Status get_delta_column_groups(KVStore* meta, const TabletSegmentId& tsid, int64_t version,
+                                   DeltaColumnGroupList* dcgs);
+
+    // Replace the cached delta column groups of segment |tsid| by all of its groups, after they are
+    // written to the meta.
+    void set_cached_delta_column_groups(const TabletSegmentId& tsid, DeltaColumnGroupList dcgs);
+
     Status on_rowset_finished(Tablet* tablet, Rowset* rowset);
 
     void on_rowset_cancel(Tablet* tablet, Rowset* rowset);
 
     ThreadPool* apply_thread_pool() { return _apply_thread_pool.get(); }
 
+    // The pool to update the sub-maps of a primary index concurrently in an apply, nullptr if it's disabled.
+    // It's separated from apply_thread_pool, whose tasks wait for it.
+    ThreadPool* apply_index_thread_pool() { return _apply_index_thread_pool.get(); }
+
     DynamicCache<uint64_t, PrimaryIndex>& index_cache() { return _index_cache; }
 
     DynamicCache<string, RowsetUpdateState>& update_state_cache() { return _update_state_cache; }
@@ -62,6 +76,8 @@ public:
 
     void clear_cached_del_vec(const std::vector<TabletSegmentId>& tsids);
 
+    void clear_cached_delta_column_groups(const std::vector<TabletSegmentId>& tsids);
+
     void expire_cache();
 
     MemTracker* mem_tracker() const { return _update_mem_tracker; }
@@ -73,6 +89,9 @@ public:
     string topn_memory_stats(size_t topn);
 
 private:
+    // set the capacity of _index_cache by update_index_cache_capacity_percent
+    void _update_index_cache_capacity();
+
     // default 6min
     int64_t _cache_expire_ms = 360000;
 
@@ -93,7 +112,12 @@ private:
     std::unordered_map<TabletSegmentId, DelVectorPtr> _del_vec_cache;
     std::unique_ptr<MemTracker> _del_vec_cache_mem_tracker;
 
+    // DeltaColumnGroup related states, all the groups of a segment, an empty list if it has none.
+    std::mutex _dcg_cache_lock;
+    std::unordered_map<TabletSegmentId, DeltaColumnGroupList> _dcg_cache;
+
     std::unique_ptr<ThreadPool> _apply_thread_pool;
+    std::unique_ptr<ThreadPool> _apply_index_thread_pool;
 
     UpdateManager(const UpdateManager&) = delete;
     const UpdateManager& operator=(const UpdateManager&) = delete;
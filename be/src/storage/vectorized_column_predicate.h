@@ -3,6 +3,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -143,6 +144,17 @@ public:
     // Return false to filter out a data page.
     virtual bool bloom_filter(const BloomFilter* bf) const { return true; }
 
+    // Whether the values satisfying this predicate must contain some known substrings,
+    // e.g. `LIKE '%error%'`.
+    virtual bool support_ngram_bloom_filter() const { return false; }
+
+    // Return false to filter out a data page, |bf| has the n-grams of |gram_num| bytes of the page.
+    virtual bool ngram_bloom_filter(const BloomFilter* bf, size_t gram_num) const { return true; }
+
+    // Append the tokens of the inverted index which every value satisfying this predicate has,
+    // see inverted_index_tokenizer.h.
+    virtual void get_inverted_index_tokens(std::vector<std::string>* tokens) const {}
+
     virtual Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange* range) const {
         return Status::Cancelled("not implemented");
     }
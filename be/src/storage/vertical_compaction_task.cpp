@@ -8,6 +8,7 @@
 #include "runtime/current_thread.h"
 #include "storage/chunk_helper.h"
 #include "storage/compaction_utils.h"
+#include "storage/data_dir.h"
 #include "storage/olap_common.h"
 #include "storage/row_source_mask.h"
 #include "storage/rowset/column_reader.h"
@@ -23,7 +24,10 @@ namespace starrocks {
 
 Status VerticalCompactionTask::run_impl() {
     Statistics statistics;
-    RETURN_IF_ERROR(_vertical_compaction_data(&statistics));
+    ASSIGN_OR_RETURN(bool linked, _try_link_segments(&statistics));
+    if (!linked) {
+        RETURN_IF_ERROR(_vertical_compaction_data(&statistics));
+    }
     TRACE_COUNTER_INCREMENT("merged_rows", statistics.merged_rows);
     TRACE_COUNTER_INCREMENT("filtered_rows", statistics.filtered_rows);
     TRACE_COUNTER_INCREMENT("output_rows", statistics.output_rows);
@@ -43,8 +47,9 @@ Status VerticalCompactionTask::_vertical_compaction_data(Statistics* statistics)
             config::max_segment_file_size, _task_info.input_rows_num, _task_info.input_rowsets_size);
 
     std::unique_ptr<RowsetWriter> output_rs_writer;
-    RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(
-            _tablet.get(), max_rows_per_segment, _task_info.algorithm, _task_info.output_version, &output_rs_writer));
+    RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(_tablet.get(), max_rows_per_segment,
+                                                                    _task_info.algorithm, _task_info.output_version,
+                                                                    &output_rs_writer, _input_rowsets));
 
     std::vector<std::vector<uint32_t>> column_groups;
     CompactionUtils::split_column_into_groups(_tablet->num_columns(), _tablet->num_key_columns(),
@@ -181,6 +186,8 @@ StatusOr<size_t> VerticalCompactionTask::_compact_data(bool is_key, int32_t chun
     Status status = Status::OK();
     size_t column_group_del_filtered_rows = 0;
     size_t column_group_merged_rows = 0;
+    auto* io_throttle = _tablet->data_dir()->compaction_io_throttle();
+    int64_t bytes_read = 0;
     while (LIKELY(!should_stop())) {
 #ifndef BE_TEST
         status = tls_thread_status.mem_tracker()->check_mem_limit("Compaction");
@@ -205,6 +212,9 @@ StatusOr<size_t> VerticalCompactionTask::_compact_data(bool is_key, int32_t chun
         ChunkHelper::padding_char_columns(char_field_indexes, schema, _tablet->tablet_schema(), chunk.get());
 
         RETURN_IF_ERROR(output_rs_writer->add_columns(*chunk, column_group, is_key));
+        // The output is about the size of the input, so charge the bytes read twice for reading and writing.
+        io_throttle->acquire(2 * (reader->stats().compressed_bytes_read - bytes_read));
+        bytes_read = reader->stats().compressed_bytes_read;
 
         _task_info.total_output_num_rows += chunk->num_rows();
         _task_info.total_del_filtered_rows += reader->stats().rows_del_filtered - column_group_del_filtered_rows;
@@ -0,0 +1,261 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+// Replay the fragments captured from the production, i.e. the serialized TExecPlanFragmentParams of the
+// exec_plan_fragment rpc, on the tablets of a local storage root path, without FE.
+//
+// Each of the clients runs the plans one after another in turn through FragmentExecutor, with a new query id and
+// fragment instance id for each run, and fetches the result like FE does. The latency and the cpu time of the
+// queries are reported at the end, so that the changes of the scheduler can be compared on the same plans.
+//
+// The plans must consist of a single fragment instance reading local data, i.e. without any exchange with the
+// other instances. The fragment instances report their state to the coordinator of the captured plans when they
+// finish, which fails without FE, only a warning is logged.
+
+#include <gflags/gflags.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/config.h"
+#include "common/daemon.h"
+#include "common/status.h"
+#include "common/statusor.h"
+#include "exec/pipeline/fragment_executor.h"
+#include "exec/pipeline/query_context.h"
+#include "gen_cpp/InternalService_types.h"
+#include "gutil/strings/split.h"
+#include "runtime/exec_env.h"
+#include "runtime/result_buffer_mgr.h"
+#include "service/backend_options.h"
+#include "storage/options.h"
+#include "storage/storage_engine.h"
+#include "util/stopwatch.hpp"
+#include "util/thrift_util.h"
+#include "util/uid_util.h"
+
+DEFINE_string(plan_files, "", "comma separated files of the serialized TExecPlanFragmentParams to replay");
+DEFINE_string(conf_file, "", "the config file of BE, $STARROCKS_HOME/conf/be.conf if empty");
+DEFINE_string(data_dir, "", "the storage root path of the tablets the plans read, storage_root_path if empty");
+DEFINE_int32(concurrency, 1, "the number of the clients running the queries concurrently");
+DEFINE_int32(num_queries, 100, "the number of the queries run by each client");
+DEFINE_int32(num_warmup_queries, 1, "the number of the queries run by each client before the measurement");
+
+namespace starrocks {
+
+struct QueryStatistics {
+    int64_t latency_ns = 0;
+    int64_t cpu_ns = 0;
+    int64_t num_rows = 0;
+};
+
+static StatusOr<TExecPlanFragmentParams> load_plan(const std::string& plan_file) {
+    std::ifstream in(plan_file, std::ios::binary);
+    if (!in) {
+        return Status::NotFound("fail to open the plan file " + plan_file);
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string serialized = buffer.str();
+
+    TExecPlanFragmentParams plan;
+    auto len = static_cast<uint32_t>(serialized.size());
+    RETURN_IF_ERROR(deserialize_thrift_msg(reinterpret_cast<const uint8_t*>(serialized.data()), &len,
+                                           TProtocolType::BINARY, &plan));
+    if (!plan.__isset.is_pipeline || !plan.is_pipeline) {
+        return Status::NotSupported("the plan is not executed by the pipeline engine: " + plan_file);
+    }
+    return plan;
+}
+
+// Run |plan| as a new query and wait for all its drivers to finish.
+static StatusOr<QueryStatistics> run_query(ExecEnv* exec_env, const TExecPlanFragmentParams& plan) {
+    TExecPlanFragmentParams request = plan;
+    TUniqueId query_id = UniqueId::gen_uid().to_thrift();
+    TUniqueId fragment_instance_id = UniqueId::gen_uid().to_thrift();
+    request.params.__set_query_id(query_id);
+    request.params.__set_fragment_instance_id(fragment_instance_id);
+
+    QueryStatistics statistics;
+    MonotonicStopWatch watch;
+    watch.start();
+    pipeline::FragmentExecutor fragment_executor;
+    RETURN_IF_ERROR(fragment_executor.prepare(exec_env, request, request));
+    // Keep the query context until the query finishes.
+    pipeline::QueryContextPtr query_ctx = exec_env->query_context_mgr()->get(query_id);
+    if (query_ctx == nullptr) {
+        return Status::InternalError("the query context is not found after prepared");
+    }
+    RETURN_IF_ERROR(fragment_executor.execute(exec_env));
+
+    if (request.fragment.__isset.output_sink && request.fragment.output_sink.type == TDataSinkType::RESULT_SINK) {
+        while (true) {
+            TFetchDataResult result;
+            RETURN_IF_ERROR(exec_env->result_mgr()->fetch_data(fragment_instance_id, 0, &result));
+            statistics.num_rows += result.result_batch.rows.size();
+            if (result.eos) {
+                break;
+            }
+        }
+    }
+    while (!query_ctx->has_no_active_instances()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    statistics.latency_ns = watch.elapsed_time();
+    statistics.cpu_ns = query_ctx->cpu_cost();
+    return statistics;
+}
+
+static int64_t percentile(const std::vector<int64_t>& sorted_values, double percent) {
+    if (sorted_values.empty()) {
+        return 0;
+    }
+    auto index = static_cast<size_t>(percent / 100 * (sorted_values.size() - 1));
+    return sorted_values[index];
+}
+
+static void print_report(const std::vector<QueryStatistics>& statistics, int64_t elapsed_ns, int64_t num_failed) {
+    std::vector<int64_t> latencies;
+    int64_t total_cpu_ns = 0;
+    int64_t total_rows = 0;
+    for (const auto& query : statistics) {
+        latencies.push_back(query.latency_ns);
+        total_cpu_ns += query.cpu_ns;
+        total_rows += query.num_rows;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    size_t num_queries = std::max<size_t>(1, statistics.size());
+    constexpr double kNsPerMs = 1000.0 * 1000.0;
+
+    std::cout << "queries: " << statistics.size() << ", failed: " << num_failed
+              << ", concurrency: " << FLAGS_concurrency << std::endl;
+    std::cout << "qps: " << statistics.size() * 1e9 / std::max<int64_t>(1, elapsed_ns) << std::endl;
+    std::cout << "latency(ms): p50=" << percentile(latencies, 50) / kNsPerMs
+              << ", p90=" << percentile(latencies, 90) / kNsPerMs << ", p99=" << percentile(latencies, 99) / kNsPerMs
+              << ", max=" << percentile(latencies, 100) / kNsPerMs << std::endl;
+    std::cout << "cpu per query(ms): " << total_cpu_ns / num_queries / kNsPerMs << std::endl;
+    std::cout << "rows per query: " << total_rows / num_queries << std::endl;
+}
+
+static int replay(ExecEnv* exec_env, const std::vector<TExecPlanFragmentParams>& plans) {
+    std::vector<std::vector<QueryStatistics>> client_statistics(FLAGS_concurrency);
+    std::atomic<int64_t> num_failed = 0;
+    std::atomic<int> num_warmed_up_clients = 0;
+    MonotonicStopWatch watch;
+
+    std::vector<std::thread> clients;
+    for (int client = 0; client < FLAGS_concurrency; client++) {
+        clients.emplace_back([&, client]() {
+            for (int i = 0; i < FLAGS_num_warmup_queries + FLAGS_num_queries; i++) {
+                if (i == FLAGS_num_warmup_queries) {
+                    // The measurement starts when all the clients have warmed up.
+                    if (++num_warmed_up_clients == FLAGS_concurrency) {
+                        watch.start();
+                    }
+                    while (num_warmed_up_clients < FLAGS_concurrency) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                }
+                const auto& plan = plans[(client + i) % plans.size()];
+                auto statistics = run_query(exec_env, plan);
+                if (!statistics.ok()) {
+                    LOG(WARNING) << "fail to run the query: " << statistics.status();
+                    num_failed++;
+                } else if (i >= FLAGS_num_warmup_queries) {
+                    client_statistics[client].push_back(statistics.value());
+                }
+            }
+        });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+
+    std::vector<QueryStatistics> statistics;
+    for (const auto& queries : client_statistics) {
+        statistics.insert(statistics.end(), queries.begin(), queries.end());
+    }
+    print_report(statistics, watch.elapsed_time(), num_failed);
+    return num_failed == 0 ? 0 : -1;
+}
+
+} // namespace starrocks
+
+int fragment_bench_main(int argc, char** argv) {
+    using namespace starrocks;
+
+    gflags::SetUsageMessage("replay the plan fragments on the local tablets.\nUsage: " + std::string(argv[0]) +
+                            " --plan_files=<file>[,<file>...] [--data_dir=<path>] [--concurrency=<n>]" +
+                            " [--num_queries=<n>] [--num_warmup_queries=<n>]");
+    google::ParseCommandLineFlags(&argc, &argv, false);
+    if (FLAGS_plan_files.empty() || FLAGS_concurrency <= 0 || FLAGS_num_queries <= 0) {
+        std::cout << gflags::ProgramUsage() << std::endl;
+        return -1;
+    }
+
+    std::string conf_file = FLAGS_conf_file;
+    if (conf_file.empty()) {
+        if (getenv("STARROCKS_HOME") == nullptr) {
+            std::cout << "you need set STARROCKS_HOME environment variable or --conf_file" << std::endl;
+            return -1;
+        }
+        conf_file = std::string(getenv("STARROCKS_HOME")) + "/conf/be.conf";
+    }
+    if (!config::init(conf_file.c_str(), true)) {
+        std::cout << "error read config file " << conf_file << std::endl;
+        return -1;
+    }
+    if (!FLAGS_data_dir.empty()) {
+        config::storage_root_path = FLAGS_data_dir;
+    }
+
+    std::vector<TExecPlanFragmentParams> plans;
+    for (const auto& plan_file : strings::Split(FLAGS_plan_files, ",", strings::SkipWhitespace())) {
+        auto plan = load_plan(std::string(plan_file));
+        if (!plan.ok()) {
+            std::cout << "fail to load the plan: " << plan.status() << std::endl;
+            return -1;
+        }
+        plans.emplace_back(std::move(plan).value());
+    }
+
+    std::vector<StorePath> paths;
+    if (auto st = parse_conf_store_paths(config::storage_root_path, &paths); !st.ok()) {
+        std::cout << "invalid storage root path " << config::storage_root_path << ": " << st << std::endl;
+        return -1;
+    }
+
+    auto daemon = std::make_unique<Daemon>();
+    daemon->init(argc, argv, paths);
+    if (!BackendOptions::init()) {
+        return -1;
+    }
+    auto* exec_env = ExecEnv::GetInstance();
+    EXIT_IF_ERROR(exec_env->init_mem_tracker());
+
+    EngineOptions options;
+    options.store_paths = paths;
+    options.backend_uid = UniqueId::gen_uid();
+    options.tablet_meta_mem_tracker = exec_env->tablet_meta_mem_tracker();
+    options.schema_change_mem_tracker = exec_env->schema_change_mem_tracker();
+    options.compaction_mem_tracker = exec_env->compaction_mem_tracker();
+    options.update_mem_tracker = exec_env->update_mem_tracker();
+    options.conf_path = conf_file.substr(0, conf_file.rfind('/') + 1);
+    StorageEngine* engine = nullptr;
+    EXIT_IF_ERROR(StorageEngine::open(options, &engine));
+    EXIT_IF_ERROR(ExecEnv::init(exec_env, paths));
+
+    int ret = replay(exec_env, plans);
+
+    daemon->stop();
+    engine->stop();
+    delete engine;
+    ExecEnv::destroy(exec_env);
+    gflags::ShutDownCommandLineFlags();
+    return ret;
+}
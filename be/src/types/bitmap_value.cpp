@@ -46,9 +46,14 @@ static void get_only_value_to_set_and_common_value_to_bitmap(const phmap::flat_h
 BitmapValue::BitmapValue() {}
 
 BitmapValue::BitmapValue(BitmapValue&& other) noexcept
-        : _bitmap(std::move(other._bitmap)), _set(std::move(other._set)), _sv(other._sv), _type(other._type) {
+        : _bitmap(std::move(other._bitmap)),
+          _set(std::move(other._set)),
+          _sv(other._sv),
+          _type(other._type),
+          _lazy_union(other._lazy_union) {
     other._sv = 0;
     other._type = EMPTY;
+    other._lazy_union = false;
 }
 
 BitmapValue& BitmapValue::operator=(BitmapValue&& other) noexcept {
@@ -57,8 +62,10 @@ BitmapValue& BitmapValue::operator=(BitmapValue&& other) noexcept {
         this->_set = std::move(other._set);
         this->_sv = other._sv;
         this->_type = other._type;
+        this->_lazy_union = other._lazy_union;
         other._sv = 0;
         other._type = EMPTY;
+        other._lazy_union = false;
     }
     return *this;
 }
@@ -80,7 +87,8 @@ BitmapValue::BitmapValue(const BitmapValue& other)
         : _bitmap(other._bitmap == nullptr ? nullptr : std::make_shared<detail::Roaring64Map>(*other._bitmap)),
           _set(other._set == nullptr ? nullptr : std::make_unique<phmap::flat_hash_set<uint64_t>>(*other._set)),
           _sv(other._sv),
-          _type(other._type) {}
+          _type(other._type),
+          _lazy_union(other._lazy_union) {}
 
 BitmapValue& BitmapValue::operator=(const BitmapValue& other) {
     if (this != &other) {
@@ -88,6 +96,7 @@ BitmapValue& BitmapValue::operator=(const BitmapValue& other) {
         this->_set = other._set == nullptr ? nullptr : std::make_unique<phmap::flat_hash_set<uint64_t>>(*other._set);
         this->_sv = other._sv;
         this->_type = other._type;
+        this->_lazy_union = other._lazy_union;
     }
     return *this;
 }
@@ -139,6 +148,17 @@ void BitmapValue::add(uint64_t value) {
     }
 }
 
+void BitmapValue::add_many(size_t n, const uint64_t* values) {
+    // A small bitmap is kept as a single value or a set, until it becomes a roaring bitmap.
+    size_t i = 0;
+    for (; i < n && _type != BITMAP; i++) {
+        add(values[i]);
+    }
+    if (i < n) {
+        _bitmap->addMany(n - i, values + i);
+    }
+}
+
 void BitmapValue::_from_set_to_bitmap() {
     _bitmap = std::make_shared<detail::Roaring64Map>();
     for (auto x : *_set) {
@@ -217,6 +237,25 @@ BitmapValue& BitmapValue::operator|=(const BitmapValue& rhs) {
     return *this;
 }
 
+void BitmapValue::lazy_union(const BitmapValue& rhs) {
+    if (_type == BITMAP && rhs._type == BITMAP) {
+        _bitmap->lazyOrInplace(*rhs._bitmap);
+        _lazy_union = true;
+    } else {
+        *this |= rhs;
+        _lazy_union = _lazy_union || rhs._lazy_union;
+    }
+}
+
+void BitmapValue::repair_after_lazy_union() {
+    if (_lazy_union) {
+        if (_type == BITMAP) {
+            _bitmap->repairAfterLazy();
+        }
+        _lazy_union = false;
+    }
+}
+
 // Note: rhs BitmapValue is only readable after this method
 // Compute the intersection between the current bitmap and the provided bitmap.
 // Possible type transitions are:
@@ -574,6 +613,7 @@ bool BitmapValue::contains(uint64_t x) {
 
 // TODO should the return type be uint64_t?
 int64_t BitmapValue::cardinality() const {
+    DCHECK(!_lazy_union);
     switch (_type) {
     case EMPTY:
         return 0;
@@ -636,6 +676,7 @@ std::optional<uint64_t> BitmapValue::min() const {
 // Return how many bytes are required to serialize this bitmap.
 // See BitmapTypeCode for the serialized format.
 size_t BitmapValue::getSizeInBytes() const {
+    DCHECK(!_lazy_union);
     size_t res = 0;
     switch (_type) {
     case EMPTY:
@@ -837,6 +878,7 @@ void BitmapValue::clear() {
     }
     _set.reset();
     _sv = 0;
+    _lazy_union = false;
 }
 
 void BitmapValue::_convert_to_smaller_type() {
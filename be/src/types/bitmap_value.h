@@ -71,6 +71,9 @@ public:
 
     void add(uint64_t value);
 
+    // Add |n| values at once, which is faster than add() each of them once the bitmap has many elements.
+    void add_many(size_t n, const uint64_t* values);
+
     // Note: rhs BitmapValue is only readable after this method
     // Compute the union between the current bitmap and the provided bitmap.
     // Possible type transitions are:
@@ -79,6 +82,12 @@ public:
     // SINGLE -> BITMAP
     BitmapValue& operator|=(const BitmapValue& rhs);
 
+    // Like operator|=, but the union of two roaring bitmaps is not completed until repair_after_lazy_union(),
+    // which has to be called before the bitmap is read or serialized. Many bitmaps are unioned faster by
+    // lazy_union() and a single repair_after_lazy_union() at last.
+    void lazy_union(const BitmapValue& rhs);
+    void repair_after_lazy_union();
+
     // Note: rhs BitmapValue is only readable after this method
     // Compute the intersection between the current bitmap and the provided bitmap.
     // Possible type transitions are:
@@ -146,6 +155,8 @@ private:
     std::unique_ptr<phmap::flat_hash_set<uint64_t>> _set;
     uint64_t _sv = 0; // store the single value when _type == SINGLE
     BitmapDataType _type{EMPTY};
+    // Whether _bitmap has been lazily unioned and not repaired yet.
+    bool _lazy_union = false;
 };
 
 } // namespace starrocks
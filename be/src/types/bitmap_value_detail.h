@@ -148,9 +148,19 @@ public:
         }
     }
     void addMany(size_t n_args, const uint64_t* vals) {
-        for (size_t lcv = 0; lcv < n_args; lcv++) {
-            roarings[highBytes(vals[lcv])].add(lowBytes(vals[lcv]));
-            roarings[highBytes(vals[lcv])].setCopyOnWrite(copyOnWrite);
+        // The consecutive values sharing the high bytes are added to their Roaring at once.
+        constexpr size_t kBatchSize = 256;
+        uint32_t low_bytes[kBatchSize];
+        size_t lcv = 0;
+        while (lcv < n_args) {
+            uint32_t high_bytes = highBytes(vals[lcv]);
+            size_t n = 0;
+            while (lcv < n_args && n < kBatchSize && highBytes(vals[lcv]) == high_bytes) {
+                low_bytes[n++] = lowBytes(vals[lcv++]);
+            }
+            Roaring& roaring = roarings[high_bytes];
+            roaring.addMany(n, low_bytes);
+            roaring.setCopyOnWrite(copyOnWrite);
         }
     }
 
@@ -256,6 +266,34 @@ public:
         return *this;
     }
 
+    /**
+     * Like operator|=, but the cardinalities of the containers are not computed
+     * and their types are not optimized. repairAfterLazy() has to be called
+     * before any other use of the bitmap. It is faster to union many bitmaps
+     * lazily and repair the result once.
+     */
+    Roaring64Map& lazyOrInplace(const Roaring64Map& r) {
+        for (const auto& map_entry : r.roarings) {
+            auto iter = roarings.find(map_entry.first);
+            if (iter == roarings.end()) {
+                roarings[map_entry.first] = map_entry.second;
+                roarings[map_entry.first].setCopyOnWrite(copyOnWrite);
+            } else {
+                roaring_bitmap_lazy_or_inplace(&iter->second.roaring, &map_entry.second.roaring, true);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * Complete the unions done by lazyOrInplace().
+     */
+    void repairAfterLazy() {
+        for (auto& map_entry : roarings) {
+            roaring_bitmap_repair_after_lazy(&map_entry.second.roaring);
+        }
+    }
+
     /**
      * Compute the symmetric union between the current bitmap and the provided
      * bitmap,
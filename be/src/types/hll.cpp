@@ -25,6 +25,7 @@
 #include <immintrin.h>
 #endif
 
+#include <array>
 #include <cmath>
 #include <map>
 
@@ -160,6 +161,17 @@ void HyperLogLog::update(uint64_t hash_value) {
     }
 }
 
+void HyperLogLog::update_batch(const uint64_t* hash_values, size_t num_values) {
+    size_t i = 0;
+    // Only the first values may change _type, the rest go to the registers directly.
+    for (; i < num_values && (_type == HLL_DATA_EMPTY || _type == HLL_DATA_EXPLICIT); ++i) {
+        update(hash_values[i]);
+    }
+    for (; i < num_values; ++i) {
+        _update_registers(hash_values[i]);
+    }
+}
+
 void HyperLogLog::merge(const HyperLogLog& other) {
     // fast path
     if (other._type == HLL_DATA_EMPTY) {
@@ -407,6 +419,15 @@ bool HyperLogLog::deserialize(const Slice& slice) {
     return true;
 }
 
+// 2^-k for each value k of a register, powf(2.0f, -k) is too slow to be called for every register.
+static const std::array<float, 256> kRegisterInversePowers = [] {
+    std::array<float, 256> powers{};
+    for (int k = 0; k < 256; ++k) {
+        powers[k] = std::ldexp(1.0f, -k);
+    }
+    return powers;
+}();
+
 int64_t HyperLogLog::estimate_cardinality() const {
     if (_type == HLL_DATA_EMPTY) {
         return 0;
@@ -433,7 +454,7 @@ int64_t HyperLogLog::estimate_cardinality() const {
     int num_zero_registers = 0;
 
     for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
-        harmonic_mean += powf(2.0f, -_registers.data[i]);
+        harmonic_mean += kRegisterInversePowers[_registers.data[i]];
 
         if (_registers.data[i] == 0) {
             ++num_zero_registers;
@@ -494,6 +515,17 @@ void HyperLogLog::_merge_registers(uint8_t* other_registers) {
         src += 32;
         dst += 32;
     }
+#elif defined(__SSE2__)
+    int loop = HLL_REGISTERS_COUNT / 16;
+    uint8_t* dst = _registers.data;
+    const uint8_t* src = other_registers;
+    for (int i = 0; i < loop; i++) {
+        __m128i xa = _mm_loadu_si128((const __m128i*)dst);
+        __m128i xb = _mm_loadu_si128((const __m128i*)src);
+        _mm_storeu_si128((__m128i*)dst, _mm_max_epu8(xa, xb));
+        src += 16;
+        dst += 16;
+    }
 #else
     for (int i = 0; i < HLL_REGISTERS_COUNT; i++) {
         _registers.data[i] = std::max(_registers.data[i], other_registers[i]);
@@ -100,6 +100,10 @@ public:
     // NOTE: input must be a hash_value
     void update(uint64_t hash_value);
 
+    // Add |num_values| hash values, the same as calling update() for each of them
+    // but without checking the type of this HLL value for every value.
+    void update_batch(const uint64_t* hash_values, size_t num_values);
+
     void merge(const HyperLogLog& other);
 
     // Return max size of serialized binary
@@ -119,6 +119,7 @@ public:
     void clear(DirectByteBuffer* buffer, FunctionContext* ctx);
 
     jclass object_class() { return _object_class; }
+    jclass direct_buffer_class() { return _direct_buffer_class; }
 
     JVMClass& function_state_clazz();
 
@@ -432,6 +433,9 @@ struct JavaUDFContext {
     // Java Method
     std::unique_ptr<JavaMethodDescriptor> prepare;
     std::unique_ptr<JavaMethodDescriptor> evaluate;
+    // The optional vectorized `void evaluateBatch(int numRows, ByteBuffer[] argNulls, ByteBuffer[] argData,
+    // ByteBuffer resultNulls, ByteBuffer resultData)`, called once per chunk instead of boxing the values.
+    std::unique_ptr<JavaMethodDescriptor> evaluate_batch;
     std::unique_ptr<JavaMethodDescriptor> close;
 };
 
@@ -133,6 +133,20 @@ Status convert_to_arrow_schema(const RowDescriptor& row_desc,
     return Status::OK();
 }
 
+Status convert_to_arrow_schema(const std::vector<ExprContext*>& output_expr_ctxs,
+                               std::shared_ptr<arrow::Schema>* result) {
+    std::vector<std::shared_ptr<arrow::Field>> fields;
+    fields.reserve(output_expr_ctxs.size());
+    for (size_t i = 0; i < output_expr_ctxs.size(); ++i) {
+        Expr* expr = output_expr_ctxs[i]->root();
+        std::shared_ptr<arrow::Field> field;
+        RETURN_IF_ERROR(convert_to_arrow_field(expr->type(), std::to_string(i), expr->is_nullable(), &field));
+        fields.push_back(field);
+    }
+    *result = arrow::schema(std::move(fields));
+    return Status::OK();
+}
+
 Status serialize_record_batch(const arrow::RecordBatch& record_batch, std::string* result) {
     // create sink memory buffer outputstream with the computed capacity
     int64_t capacity;
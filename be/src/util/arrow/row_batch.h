@@ -47,6 +47,10 @@ Status convert_to_arrow_schema(const RowDescriptor& row_desc,
                                std::shared_ptr<arrow::Schema>* result,
                                const std::vector<ExprContext*>& output_expr_ctxs);
 
+// Convert the types of |output_expr_ctxs| to Arrow Schema, the fields are named by their positions.
+Status convert_to_arrow_schema(const std::vector<ExprContext*>& output_expr_ctxs,
+                               std::shared_ptr<arrow::Schema>* result);
+
 Status serialize_record_batch(const arrow::RecordBatch& record_batch, std::string* result);
 
 } // namespace starrocks
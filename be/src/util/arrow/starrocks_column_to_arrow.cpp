@@ -288,7 +288,8 @@ private:
 Status convert_chunk_to_arrow_batch(Chunk* chunk, std::vector<ExprContext*>& _output_expr_ctxs,
                                     const std::shared_ptr<arrow::Schema>& schema, arrow::MemoryPool* pool,
                                     std::shared_ptr<arrow::RecordBatch>* result) {
-    if (chunk->num_columns() != schema->num_fields()) {
+    // The fields are the results of the exprs, the chunk may have other columns than their inputs.
+    if (_output_expr_ctxs.size() != schema->num_fields()) {
         return Status::InvalidArgument("number fields not match");
     }
 
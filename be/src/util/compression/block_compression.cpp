@@ -59,6 +59,14 @@ Status BlockCompressionCodec::compress(const std::vector<Slice>& inputs, Slice*
     return compress(buf, output, use_compression_buffer, uncompressed_size, compressed_body1, compressed_body2);
 }
 
+Status BlockCompressionCodec::decompress_batch(const std::vector<Slice>& inputs, std::vector<Slice>* outputs) const {
+    DCHECK_EQ(inputs.size(), outputs->size());
+    for (size_t i = 0; i < inputs.size(); i++) {
+        RETURN_IF_ERROR(decompress(inputs[i], &(*outputs)[i]));
+    }
+    return Status::OK();
+}
+
 class Lz4BlockCompression : public BlockCompressionCodec {
 public:
     Lz4BlockCompression() : BlockCompressionCodec(CompressionTypePB::LZ4) {}
@@ -371,6 +379,22 @@ public:
 
     Status decompress(const Slice& input, Slice* output) const override { return _decompress(input, output); }
 
+    Status decompress_batch(const std::vector<Slice>& inputs, std::vector<Slice>* outputs) const override {
+        DCHECK_EQ(inputs.size(), outputs->size());
+        if (inputs.empty()) {
+            return Status::OK();
+        }
+        StatusOr<compression::LZ4F_DCtx_Pool::Ref> ref = compression::getLZ4F_DCtx();
+        Status status = ref.status();
+        if (!status.ok()) {
+            return status;
+        }
+        for (size_t i = 0; i < inputs.size(); i++) {
+            RETURN_IF_ERROR(_decompress(ref.value().get(), inputs[i], &(*outputs)[i]));
+        }
+        return Status::OK();
+    }
+
     size_t max_compressed_len(size_t len) const override {
         return std::max(LZ4F_compressBound(len, &_s_preferences), LZ4F_compressFrameBound(len, &_s_preferences));
     }
@@ -466,7 +490,10 @@ private:
         if (!status.ok()) {
             return status;
         }
-        compression::LZ4FDecompressContext* context = ref.value().get();
+        return _decompress(ref.value().get(), input, output);
+    }
+
+    Status _decompress(compression::LZ4FDecompressContext* context, const Slice& input, Slice* output) const {
         LZ4F_decompressionContext_t ctx = context->ctx;
 
         size_t input_size = input.size;
@@ -728,6 +755,22 @@ public:
 
     Status decompress(const Slice& input, Slice* output) const override { return _decompress(input, output); }
 
+    Status decompress_batch(const std::vector<Slice>& inputs, std::vector<Slice>* outputs) const override {
+        DCHECK_EQ(inputs.size(), outputs->size());
+        if (inputs.empty()) {
+            return Status::OK();
+        }
+        StatusOr<compression::ZSTD_DCtx_Pool::Ref> ref = compression::getZSTD_DCtx();
+        Status status = ref.status();
+        if (!status.ok()) {
+            return status;
+        }
+        for (size_t i = 0; i < inputs.size(); i++) {
+            RETURN_IF_ERROR(_decompress(ref.value().get(), inputs[i], &(*outputs)[i]));
+        }
+        return Status::OK();
+    }
+
     size_t max_compressed_len(size_t len) const override { return ZSTD_compressBound(len); }
 
 private:
@@ -831,7 +874,10 @@ private:
         if (!status.ok()) {
             return status;
         }
-        compression::ZSTDDecompressContext* context = ref.value().get();
+        return _decompress(ref.value().get(), input, output);
+    }
+
+    Status _decompress(compression::ZSTDDecompressContext* context, const Slice& input, Slice* output) const {
         ZSTD_DCtx* ctx = context->ctx;
 
         if (output->data == nullptr) {
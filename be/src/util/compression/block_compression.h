@@ -71,6 +71,11 @@ public:
     // output's size.
     virtual Status decompress(const Slice& input, Slice* output) const = 0;
 
+    // Decompress each of inputs into the output of the same index, like decompress(Slice), e.g. all the pages of
+    // a column read at once. The default implementation decompresses them one by one, the codecs decompressing
+    // by a pooled context take it once for the whole batch.
+    virtual Status decompress_batch(const std::vector<Slice>& inputs, std::vector<Slice>* outputs) const;
+
     // Returns an upper bound on the max compressed length.
     virtual size_t max_compressed_len(size_t len) const = 0;
 
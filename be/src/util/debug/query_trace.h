@@ -25,6 +25,9 @@
 // }
 // It should be noted that these QUERY_TRACE_* macros rely on thread local trace context to read some information,
 // remember to set it before use.
+// A counter event is added by QUERY_TRACE_COUNTERS with the names and the values of the counters, e.g.
+//     std::vector<std::pair<std::string, std::string>> counters{{"counter_a", "1"}, {"counter_b", "2"}};
+//     QUERY_TRACE_COUNTERS("name", "category", std::move(counters));
 // The async event is a bit different, It may record the start and finish in different threads.
 // Each event needs to be identified with a different id, so you need to pass a context when using it.
 // In many cases, you can directly use the pointer address of an object as id, because it must be unique within the same process.
@@ -42,10 +45,14 @@
 //    QUERY_TRACE_ASYNC_FINISH("category", "name", ctx);
 // }
 
-#ifdef ENABLE_QUERY_DEBUG_TRACE
+// The trace of a query is enabled by the session variable enable_query_debug_trace. The trace points of the
+// queries not traced cost a check of the thread local trace context, the names and the categories of the events
+// are not evaluated.
+// The trace is dumped to config::query_debug_trace_dir when the query finishes, and can be downloaded by
+// the http action /api/query_trace?query_id=<query_id> while the query is running or after it finishes.
 #define SET_THREAD_LOCAL_QUERY_TRACE_CONTEXT(query_trace, fragment_instance_id, driver_ptr) \
     starrocks::debug::QueryTrace::set_tls_trace_context(query_trace, fragment_instance_id,  \
-                                                        reinterpret_cast<std::uintptr_t>(driver))
+                                                        reinterpret_cast<std::uintptr_t>(driver_ptr))
 
 #define QUERY_TRACE_BEGIN(name, category)        \
     INTERNAL_ADD_EVENT_INTO_THREAD_LOCAL_BUFFER( \
@@ -55,7 +62,14 @@
     INTERNAL_ADD_EVENT_INTO_THREAD_LOCAL_BUFFER( \
             INTERNAL_CREATE_EVENT_WITH_CTX(name, category, 'E', starrocks::debug::tls_trace_ctx))
 
-#define QUERY_TRACE_SCOPED(name, category) starrocks::debug::ScopedTracer _scoped_tracer(name, category)
+#define QUERY_TRACE_SCOPED(name, category)                                                            \
+    starrocks::debug::ScopedTracer _scoped_tracer(                                                    \
+            starrocks::debug::tls_trace_ctx.event_buffer != nullptr ? std::string(name) : std::string(), \
+            starrocks::debug::tls_trace_ctx.event_buffer != nullptr ? std::string(category) : std::string())
+
+#define QUERY_TRACE_COUNTERS(name, category, args) \
+    INTERNAL_ADD_EVENT_INTO_THREAD_LOCAL_BUFFER(   \
+            INTERNAL_CREATE_COUNTER_EVENT_WITH_CTX(name, category, args, starrocks::debug::tls_trace_ctx))
 
 #define QUERY_TRACE_ASYNC_START(name, category, ctx)                                                            \
     do {                                                                                                        \
@@ -68,11 +82,3 @@
         INTERNAL_ADD_EVENT_INFO_BUFFER(ctx.event_buffer,                                                        \
                                        INTERNAL_CREATE_ASYNC_EVENT_WITH_CTX(name, category, ctx.id, 'e', ctx)); \
     } while (0);
-#else
-#define SET_THREAD_LOCAL_QUERY_TRACE_CONTEXT(query_trace, fragment_instance_id, driver_ptr)
-#define QUERY_TRACE_BEGIN(name, category)
-#define QUERY_TRACE_END(name, category)
-#define QUERY_TRACE_SCOPED(name, category)
-#define QUERY_TRACE_ASYNC_START(name, category, ctx)
-#define QUERY_TRACE_ASYNC_FINISH(name, category, ctx)
-#endif
\ No newline at end of file
@@ -43,6 +43,13 @@ QueryTraceEvent QueryTraceEvent::create_with_ctx(const std::string& name, const
     return create(name, category, id, phase, start_ts, duration, ctx.fragment_instance_id, ctx.driver, {});
 }
 
+QueryTraceEvent QueryTraceEvent::create_counters_with_ctx(const std::string& name, const std::string& category,
+                                                          std::vector<std::pair<std::string, std::string>>&& args,
+                                                          const QueryTraceContext& ctx) {
+    return create(name, category, -1, 'C', MonotonicMicros() - ctx.start_ts, -1, ctx.fragment_instance_id, ctx.driver,
+                  std::move(args));
+}
+
 static const char* kSimpleEventFormat =
         "{\"cat\":\"%s\",\"name\":\"%s\",\"pid\":\"%ld\",\"tid\":\"%ld\",\"id\":\"%ld\",\"ts\":%ld,\"ph\":\"%c\","
         "\"args\":%s}";
@@ -50,7 +57,7 @@ static const char* kCompleteEventFormat =
         "{\"cat\":\"%s\",\"name\":\"%s\",\"pid\":\"%ld\",\"tid\":\"%ld\",\"id\":\"%ld\",\"ts\":%ld,\"dur\":%ld,\"ph\":"
         "\"%c\",\"args\":%s}";
 
-std::string QueryTraceEvent::to_string() {
+std::string QueryTraceEvent::to_string() const {
     std::string args_str = args_to_string();
     if (phase == 'X') {
         return fmt::sprintf(kCompleteEventFormat, category.c_str(), name.c_str(), instance_id, (int64_t)driver, id,
@@ -61,15 +68,17 @@ std::string QueryTraceEvent::to_string() {
     }
 }
 
-std::string QueryTraceEvent::args_to_string() {
+std::string QueryTraceEvent::args_to_string() const {
     if (args.empty()) {
         return "{}";
     }
+    // The values of a counter event are numbers.
+    const char* arg_format = phase == 'C' ? "\"%s\":%s" : "\"%s\":\"%s\"";
     std::ostringstream oss;
     oss << "{";
-    oss << fmt::sprintf("\"%s\":\"%s\"", args[0].first.c_str(), args[0].second.c_str());
+    oss << fmt::sprintf(arg_format, args[0].first.c_str(), args[0].second.c_str());
     for (size_t i = 1; i < args.size(); i++) {
-        oss << fmt::sprintf(",\"%s\":\"%s\"", args[i].first.c_str(), args[i].second.c_str());
+        oss << "," << fmt::sprintf(arg_format, args[i].first.c_str(), args[i].second.c_str());
     }
     oss << "}";
     return oss.str();
@@ -77,19 +86,34 @@ std::string QueryTraceEvent::args_to_string() {
 
 void EventBuffer::add(QueryTraceEvent&& event) {
     std::lock_guard<SpinLock> l(_mutex);
-    _buffer.emplace_back(std::move(event));
+    if (_buffer.size() < _capacity) {
+        _buffer.emplace_back(std::move(event));
+        return;
+    }
+    _buffer[_next] = std::move(event);
+    _next = (_next + 1) % _capacity;
+    _num_dropped++;
+}
+
+void EventBuffer::for_each(const std::function<void(const QueryTraceEvent&)>& func) {
+    std::lock_guard<SpinLock> l(_mutex);
+    for (size_t i = 0; i < _buffer.size(); i++) {
+        func(_buffer[(_next + i) % _buffer.size()]);
+    }
+}
+
+size_t EventBuffer::num_dropped_events() {
+    std::lock_guard<SpinLock> l(_mutex);
+    return _num_dropped;
 }
 
 QueryTrace::QueryTrace(const TUniqueId& query_id, bool is_enable) : _query_id(query_id), _is_enable(is_enable) {
-#ifdef ENABLE_QUERY_DEBUG_TRACE
     if (_is_enable) {
         _start_ts = MonotonicMicros();
     }
-#endif
 }
 
 void QueryTrace::register_drivers(TUniqueId fragment_instance_id, starrocks::pipeline::Drivers& drivers) {
-#ifdef ENABLE_QUERY_DEBUG_TRACE
     if (!_is_enable) {
         return;
     }
@@ -102,59 +126,76 @@ void QueryTrace::register_drivers(TUniqueId fragment_instance_id, starrocks::pip
     for (auto& driver : drivers) {
         std::uintptr_t ptr = reinterpret_cast<std::uintptr_t>(driver.get());
         iter->second->insert(ptr);
-        _buffers.insert({ptr, std::make_unique<EventBuffer>()});
+        auto buffer = std::make_unique<EventBuffer>(config::query_debug_trace_buffer_size);
+        QueryTraceContext ctx;
+        ctx.start_ts = _start_ts;
+        ctx.fragment_instance_id = fragment_instance_id.lo;
+        ctx.driver = ptr;
+        ctx.event_buffer = buffer.get();
+        driver->set_trace_context(ctx);
+        _buffers.insert({ptr, std::move(buffer)});
+        _driver_names.insert({ptr, driver->get_name()});
     }
-#endif
+}
+
+std::string QueryTrace::dump_file_path(const TUniqueId& query_id) {
+    return fmt::format("{}/{}.json", starrocks::config::query_debug_trace_dir, print_id(query_id));
 }
 
 Status QueryTrace::dump() {
-#ifdef ENABLE_QUERY_DEBUG_TRACE
     if (!_is_enable) {
         return Status::OK();
     }
-    static const char* kProcessNameMetaEventFormat =
-            "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":\"%ld\",\"args\":{\"name\":\"%s\"}}";
-    static const char* kThreadNameMetaEventFormat =
-            "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":\"%ld\",\"tid\":\"%ld\",\"args\":{\"name\":\"%s\"}}";
     try {
         std::filesystem::create_directory(starrocks::config::query_debug_trace_dir);
-        std::string file_name =
-                fmt::format("{}/{}.json", starrocks::config::query_debug_trace_dir, print_id(_query_id));
+        std::string file_name = dump_file_path(_query_id);
         std::ofstream oss(file_name.c_str(), std::ios::out | std::ios::binary);
-        oss << "{\"traceEvents\":[";
-        bool is_first = true;
-        for (auto& [fragment_id, driver_set] : _fragment_drivers) {
-            std::string fragment_id_str = print_id(fragment_id);
-            oss << (is_first ? "" : ",\n");
-            oss << fmt::sprintf(kProcessNameMetaEventFormat, fragment_id.lo, fragment_id_str.c_str());
-            is_first = false;
-            for (auto& driver : *driver_set) {
-                starrocks::pipeline::DriverRawPtr ptr = reinterpret_cast<starrocks::pipeline::DriverRawPtr>(driver);
-                oss << (is_first ? "" : ",\n");
-                oss << fmt::sprintf(kThreadNameMetaEventFormat, fragment_id.lo, (int64_t)driver,
-                                    ptr->get_name().c_str());
-            }
-        }
-
-        for (auto& [_, buffer_ptr] : _buffers) {
-            auto& buffer = buffer_ptr->_buffer;
-            for (auto iter : buffer) {
-                oss << (is_first ? "" : ",\n");
-                oss << iter.to_string();
-            }
-        }
-        oss << "]}";
-
+        RETURN_IF_ERROR(write_json(oss));
         oss.close();
     } catch (std::exception& e) {
         return Status::IOError(fmt::format("dump trace log error {}", e.what()));
     }
-#endif
+    return Status::OK();
+}
+
+Status QueryTrace::write_json(std::ostream& os) {
+    if (!_is_enable) {
+        return Status::NotSupported("the query debug trace is not enabled");
+    }
+    static const char* kProcessNameMetaEventFormat =
+            "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":\"%ld\",\"args\":{\"name\":\"%s\"}}";
+    static const char* kThreadNameMetaEventFormat =
+            "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":\"%ld\",\"tid\":\"%ld\",\"args\":{\"name\":\"%s\"}}";
+    std::shared_lock l(_mutex);
+    os << "{\"traceEvents\":[";
+    bool is_first = true;
+    for (auto& [fragment_id, driver_set] : _fragment_drivers) {
+        std::string fragment_id_str = print_id(fragment_id);
+        os << (is_first ? "" : ",\n");
+        os << fmt::sprintf(kProcessNameMetaEventFormat, fragment_id.lo, fragment_id_str.c_str());
+        is_first = false;
+        for (auto& driver : *driver_set) {
+            os << (is_first ? "" : ",\n");
+            os << fmt::sprintf(kThreadNameMetaEventFormat, fragment_id.lo, (int64_t)driver,
+                               _driver_names.at(driver).c_str());
+        }
+    }
+
+    size_t num_dropped_events = 0;
+    for (auto& [_, buffer_ptr] : _buffers) {
+        buffer_ptr->for_each([&](const QueryTraceEvent& event) {
+            os << (is_first ? "" : ",\n");
+            os << event.to_string();
+            is_first = false;
+        });
+        num_dropped_events += buffer_ptr->num_dropped_events();
+    }
+    os << "],\"otherData\":{\"query_id\":\"" << print_id(_query_id) << "\",\"dropped_events\":" << num_dropped_events
+       << "}}";
     return Status::OK();
 }
 
 void QueryTrace::set_tls_trace_context(QueryTrace* query_trace, TUniqueId fragment_instance_id, std::uintptr_t driver) {
-#ifdef ENABLE_QUERY_DEBUG_TRACE
     if (!query_trace->_is_enable) {
         tls_trace_ctx.reset();
         return;
@@ -168,18 +209,21 @@ void QueryTrace::set_tls_trace_context(QueryTrace* query_trace, TUniqueId fragme
     tls_trace_ctx.start_ts = query_trace->_start_ts;
     tls_trace_ctx.fragment_instance_id = fragment_instance_id.lo;
     tls_trace_ctx.driver = driver;
-#endif
 }
 
-ScopedTracer::ScopedTracer(const std::string& name, const std::string& category) : _name(name), _category(category) {
-    _start_ts = MonotonicMicros();
+ScopedTracer::ScopedTracer(std::string name, std::string category)
+        : _name(std::move(name)), _category(std::move(category)), _event_buffer(tls_trace_ctx.event_buffer) {
+    if (_event_buffer != nullptr) {
+        _start_ts = MonotonicMicros();
+    }
 }
 
 ScopedTracer::~ScopedTracer() {
-    if (tls_trace_ctx.event_buffer != nullptr) {
-        _duration = MonotonicMicros() - _start_ts;
-        tls_trace_ctx.event_buffer->add(QueryTraceEvent::create_with_ctx(
-                _name, _category, -1, 'X', _start_ts - tls_trace_ctx.start_ts, _duration, tls_trace_ctx));
+    if (_event_buffer != nullptr && _event_buffer == tls_trace_ctx.event_buffer) {
+        int64_t duration = MonotonicMicros() - _start_ts;
+        _event_buffer->add(QueryTraceEvent::create_with_ctx(_name, _category, -1, 'X',
+                                                            _start_ts - tls_trace_ctx.start_ts, duration,
+                                                            tls_trace_ctx));
     }
 }
 
@@ -2,14 +2,17 @@
 
 #pragma once
 
-#include <deque>
+#include <algorithm>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <ostream>
 #include <shared_mutex>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include "common/status.h"
 #include "exec/pipeline/pipeline_fwd.h"
@@ -35,7 +38,7 @@ struct QueryTraceEvent {
     std::uintptr_t driver;
     std::vector<std::pair<std::string, std::string>> args;
 
-    std::string to_string();
+    std::string to_string() const;
 
     static QueryTraceEvent create(const std::string& name, const std::string& category, int64_t id, char phase,
                                   int64_t timestamp, int64_t duration, int64_t instance_id, std::uintptr_t driver,
@@ -47,23 +50,38 @@ struct QueryTraceEvent {
     static QueryTraceEvent create_with_ctx(const std::string& name, const std::string& category, int64_t id, char phase,
                                            int64_t start_ts, int64_t duration, const QueryTraceContext& ctx);
 
+    // A counter event, whose args are the names and the values of the counters.
+    static QueryTraceEvent create_counters_with_ctx(const std::string& name, const std::string& category,
+                                                    std::vector<std::pair<std::string, std::string>>&& args,
+                                                    const QueryTraceContext& ctx);
+
 private:
-    std::string args_to_string();
+    std::string args_to_string() const;
 };
 
-// event buffer for a single pipeline driver
+// event buffer for a single pipeline driver, which keeps the latest |capacity| events.
+// The events of a driver are mostly added by the thread running it, so the lock is hardly contended.
 class EventBuffer {
 public:
-    EventBuffer() = default;
+    explicit EventBuffer(size_t capacity) : _capacity(std::max<size_t>(1, capacity)) {}
     ~EventBuffer() = default;
 
     void add(QueryTraceEvent&& event);
 
+    // Call |func| for each of the events kept, from the oldest to the latest.
+    void for_each(const std::function<void(const QueryTraceEvent&)>& func);
+
+    // The number of the events overwritten by the later ones.
+    size_t num_dropped_events();
+
 private:
-    friend class QueryTrace;
     typedef SpinLock Mutex;
     Mutex _mutex;
-    std::deque<QueryTraceEvent> _buffer;
+    const size_t _capacity;
+    // A ring of the events after it grows to |_capacity|, whose oldest one is at |_next|.
+    std::vector<QueryTraceEvent> _buffer;
+    size_t _next = 0;
+    size_t _num_dropped = 0;
 };
 
 class QueryTrace {
@@ -74,8 +92,18 @@ public:
     // init event buffer for all drivers in a single fragment instance
     void register_drivers(TUniqueId fragment_instance_id, starrocks::pipeline::Drivers& drivers);
 
+    // Dump the trace to config::query_debug_trace_dir/<query_id>.json.
     Status dump();
 
+    // Write the events of the trace in the chrome trace json format, which can be opened by chrome://tracing
+    // and https://ui.perfetto.dev. It can be called while the query is running.
+    Status write_json(std::ostream& os);
+
+    bool is_enable() const { return _is_enable; }
+
+    // The file the trace of |query_id| is dumped to.
+    static std::string dump_file_path(const TUniqueId& query_id);
+
     static void set_tls_trace_context(QueryTrace* query_trace, TUniqueId fragment_instance_id, std::uintptr_t driver);
 
 private:
@@ -88,18 +116,22 @@ private:
 
     // fragment_instance_id => driver list, it will be used to generate meta event
     std::unordered_map<TUniqueId, std::shared_ptr<std::unordered_set<std::uintptr_t>>> _fragment_drivers;
+    // The names of the drivers, taken when they are registered, since a driver may be gone before the trace
+    // is written.
+    std::unordered_map<std::uintptr_t, std::string> _driver_names;
 };
 
 class ScopedTracer {
 public:
-    ScopedTracer(const std::string& name, const std::string& category);
+    // |name| and |category| are only used if the trace is enabled, see QUERY_TRACE_SCOPED.
+    ScopedTracer(std::string name, std::string category);
     ~ScopedTracer();
 
 private:
     std::string _name;
     std::string _category;
-    int64_t _start_ts;
-    int64_t _duration = -1;
+    EventBuffer* _event_buffer;
+    int64_t _start_ts = -1;
 };
 
 struct QueryTraceContext {
@@ -126,6 +158,9 @@ inline thread_local QueryTraceContext tls_trace_ctx;
 #define INTERNAL_CREATE_ASYNC_EVENT_WITH_CTX(name, category, id, phase, ctx) \
     starrocks::debug::QueryTraceEvent::create_with_ctx(name, category, id, phase, ctx)
 
+#define INTERNAL_CREATE_COUNTER_EVENT_WITH_CTX(name, category, args, ctx) \
+    starrocks::debug::QueryTraceEvent::create_counters_with_ctx(name, category, args, ctx)
+
 #define INTERNAL_ADD_EVENT_INTO_THREAD_LOCAL_BUFFER(event) \
     INTERNAL_ADD_EVENT_INFO_BUFFER(starrocks::debug::tls_trace_ctx.event_buffer, event)
 
@@ -83,12 +83,14 @@ public:
 
     iterator find(KeyType key) {
         auto search_key = static_cast<search_key_type>(key);
-        if (_hash_table[search_key] != nullptr) {
+        if (_hash_table[search_key] == nullptr) {
             return end();
         }
         return iterator(_hash_table, search_key);
     }
 
+    iterator find(KeyType key, size_t hashval) { return find(key); }
+
     iterator begin() {
         auto iter = iterator(_hash_table, 0);
         iter.skip_empty_value();
@@ -0,0 +1,93 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "util/slice.h"
+
+namespace starrocks {
+
+// GermanString is a 16-byte view of a string, as described in "Umbra: A Disk-Based System with In-Memory
+// Performance". It keeps the length and the first 4 bytes of the string, followed by the next 8 bytes if
+// the string is at most 12 bytes long, or by a pointer to the whole string otherwise.
+//
+// Comparing two views decides on the length and the prefix most of the time, without touching the bytes of
+// the strings, and a short string is compared without any indirection at all. Like a Slice, a view of a long
+// string does not own its bytes, which must outlive the view.
+class GermanString {
+public:
+    static constexpr uint32_t kPrefixSize = 4;
+    static constexpr uint32_t kInlineSize = 12;
+
+    GermanString() = default;
+
+    GermanString(const char* data, uint32_t size) : _size(size) {
+        if (size <= kInlineSize) {
+            memcpy(_prefix, data, std::min(size, kPrefixSize));
+            if (size > kPrefixSize) {
+                memcpy(_suffix, data + kPrefixSize, size - kPrefixSize);
+            }
+        } else {
+            memcpy(_prefix, data, kPrefixSize);
+            _ptr = data;
+        }
+    }
+
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    GermanString(const Slice& slice) : GermanString(slice.data, slice.size) {}
+
+    uint32_t size() const { return _size; }
+    bool is_inline() const { return _size <= kInlineSize; }
+    // The inline bytes follow the prefix, so a short string is contiguous as well.
+    const char* data() const { return is_inline() ? _prefix : _ptr; }
+    Slice to_slice() const { return {data(), _size}; }
+
+    bool operator==(const GermanString& rhs) const {
+        if (_size != rhs._size || memcmp(_prefix, rhs._prefix, kPrefixSize) != 0) {
+            return false;
+        }
+        if (is_inline()) {
+            return memcmp(_suffix, rhs._suffix, sizeof(_suffix)) == 0;
+        }
+        return memcmp(_tail(), rhs._tail(), _size - kPrefixSize) == 0;
+    }
+    bool operator!=(const GermanString& rhs) const { return !(*this == rhs); }
+
+    // The same order as Slice::compare(), returns -1, 0 or 1.
+    int compare(const GermanString& rhs) const {
+        // The unused bytes of the prefix are zeros, and a zero byte sorts before any other one, so the prefixes
+        // are ordered like the strings up to their length.
+        int res = memcmp(_prefix, rhs._prefix, kPrefixSize);
+        if (res == 0) {
+            uint32_t min_size = std::min(_size, rhs._size);
+            if (min_size > kPrefixSize) {
+                res = memcmp(_tail(), rhs._tail(), min_size - kPrefixSize);
+            }
+            if (res == 0) {
+                return _size < rhs._size ? -1 : (_size > rhs._size ? 1 : 0);
+            }
+        }
+        return res < 0 ? -1 : 1;
+    }
+
+    bool operator<(const GermanString& rhs) const { return compare(rhs) < 0; }
+
+private:
+    // The bytes after the prefix.
+    const char* _tail() const { return is_inline() ? _suffix : _ptr + kPrefixSize; }
+
+    // The unused bytes are zeros.
+    uint32_t _size = 0;
+    char _prefix[kPrefixSize] = {};
+    union {
+        char _suffix[kInlineSize - kPrefixSize] = {};
+        const char* _ptr;
+    };
+};
+
+static_assert(sizeof(GermanString) == 16, "GermanString should be 16 bytes");
+
+} // namespace starrocks
@@ -430,6 +430,21 @@ struct ModuloOp {
     uint32_t operator()(uint32_t l, uint32_t r) { return l % r; }
 };
 
+// Same result as ModuloOp with a fixed divisor, but computed by multiplications instead of a division.
+// https://lemire.me/blog/2019/02/08/faster-remainders-when-the-divisor-is-a-constant-beating-compilers-and-libdivide/
+class FastModuloOp {
+public:
+    explicit FastModuloOp(uint32_t r) : _r(r), _m(UINT64_C(0xFFFFFFFFFFFFFFFF) / r + 1) {}
+    uint32_t operator()(uint32_t l) const {
+        uint64_t low_bits = _m * l;
+        return static_cast<uint32_t>((static_cast<__uint128_t>(low_bits) * _r) >> 64);
+    }
+
+private:
+    const uint64_t _r;
+    const uint64_t _m;
+};
+
 // https://lemire.me/blog/2016/06/27/a-fast-alternative-to-the-modulo-reduction/
 // avoid div/modulo operations
 // mapping l to the range [0, r]
@@ -0,0 +1,252 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "util/kll_sketch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+// The lowest levels keep a few items however small their computed capacity is.
+static constexpr size_t kMinLevelCapacity = 8;
+// The ratio between the capacities of two adjacent levels.
+static constexpr double kLevelCapacityRatio = 2.0 / 3.0;
+
+// k, odd offset, number of levels, count, min and max.
+static constexpr size_t kHeaderSize = sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint64_t) +
+                                      sizeof(double) + sizeof(double);
+
+KllSketch::KllSketch(uint16_t k) : _k(std::max<uint16_t>(k, kMinLevelCapacity)), _levels(1) {}
+
+size_t KllSketch::_level_capacity(size_t level) const {
+    size_t depth = _levels.size() - 1 - level;
+    auto capacity = static_cast<size_t>(std::ceil(_k * std::pow(kLevelCapacityRatio, depth)));
+    return std::max(capacity, kMinLevelCapacity);
+}
+
+void KllSketch::add(double value) {
+    add_batch(&value, 1);
+}
+
+void KllSketch::add_batch(const double* values, size_t num_values) {
+    if (num_values == 0) {
+        return;
+    }
+    double min_value = values[0];
+    double max_value = values[0];
+    for (size_t i = 1; i < num_values; ++i) {
+        min_value = std::min(min_value, values[i]);
+        max_value = std::max(max_value, values[i]);
+    }
+    _min = _count == 0 ? min_value : std::min(_min, min_value);
+    _max = _count == 0 ? max_value : std::max(_max, max_value);
+    _count += num_values;
+
+    // The values are copied into level 0 as long as the sketch is within its capacity.
+    while (num_values > 0) {
+        size_t n = std::min(num_values, _capacity() - _num_retained);
+        _levels[0].insert(_levels[0].end(), values, values + n);
+        _num_retained += n;
+        values += n;
+        num_values -= n;
+        if (num_values > 0) {
+            _levels[0].push_back(*values++);
+            ++_num_retained;
+            --num_values;
+            _compress();
+        }
+    }
+}
+
+void KllSketch::merge(const KllSketch& other) {
+    if (other._count == 0) {
+        return;
+    }
+    _min = _count == 0 ? other._min : std::min(_min, other._min);
+    _max = _count == 0 ? other._max : std::max(_max, other._max);
+    _count += other._count;
+
+    if (_levels.size() < other._levels.size()) {
+        _levels.resize(other._levels.size());
+    }
+    _levels[0].insert(_levels[0].end(), other._levels[0].begin(), other._levels[0].end());
+    for (size_t level = 1; level < other._levels.size(); ++level) {
+        const std::vector<double>& src = other._levels[level];
+        std::vector<double> merged(_levels[level].size() + src.size());
+        std::merge(_levels[level].begin(), _levels[level].end(), src.begin(), src.end(), merged.begin());
+        _levels[level].swap(merged);
+    }
+    _num_retained += other._num_retained;
+    _compress();
+}
+
+size_t KllSketch::_capacity() const {
+    size_t capacity = 0;
+    for (size_t level = 0; level < _levels.size(); ++level) {
+        capacity += _level_capacity(level);
+    }
+    return capacity;
+}
+
+void KllSketch::_compress() {
+    size_t capacity = _capacity();
+    while (_num_retained > capacity) {
+        // Some level exceeds its capacity since the sketch does.
+        size_t level = 0;
+        while (_levels[level].size() <= _level_capacity(level)) {
+            ++level;
+        }
+        size_t num_levels = _levels.size();
+        _compact_level(level);
+        if (_levels.size() != num_levels) {
+            capacity = _capacity();
+        }
+    }
+}
+
+void KllSketch::_compact_level(size_t level) {
+    if (level + 1 == _levels.size()) {
+        _levels.emplace_back();
+    }
+    std::vector<double>& items = _levels[level];
+    if (level == 0) {
+        std::sort(items.begin(), items.end());
+    }
+
+    // An odd item out, the largest one, stays in this level.
+    size_t num_promoted = items.size() / 2;
+    size_t offset = _odd_offset ? 1 : 0;
+    _odd_offset = !_odd_offset;
+    std::vector<double> promoted(num_promoted);
+    for (size_t i = 0; i < num_promoted; ++i) {
+        promoted[i] = items[2 * i + offset];
+    }
+    items.erase(items.begin(), items.begin() + 2 * num_promoted);
+
+    std::vector<double>& next = _levels[level + 1];
+    std::vector<double> merged(next.size() + promoted.size());
+    std::merge(next.begin(), next.end(), promoted.begin(), promoted.end(), merged.begin());
+    next.swap(merged);
+    _num_retained -= num_promoted;
+}
+
+double KllSketch::quantile(double q) const {
+    if (_count == 0) {
+        return 0;
+    }
+    if (q <= 0) {
+        return _min;
+    }
+    if (q >= 1) {
+        return _max;
+    }
+
+    std::vector<std::pair<double, uint64_t>> items;
+    items.reserve(_num_retained);
+    for (size_t level = 0; level < _levels.size(); ++level) {
+        uint64_t weight = uint64_t(1) << level;
+        for (double value : _levels[level]) {
+            items.emplace_back(value, weight);
+        }
+    }
+    std::sort(items.begin(), items.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    // The levels hold the weights of all the values added, so the ranks go up to _count.
+    double rank = q * _count;
+    uint64_t cumulative_weight = 0;
+    for (const auto& [value, weight] : items) {
+        cumulative_weight += weight;
+        if (cumulative_weight >= rank) {
+            return std::clamp(value, _min, _max);
+        }
+    }
+    return _max;
+}
+
+size_t KllSketch::serialize_size() const {
+    return kHeaderSize + _levels.size() * sizeof(uint32_t) + _num_retained * sizeof(double);
+}
+
+size_t KllSketch::serialize(uint8_t* dst) const {
+    uint8_t* ptr = dst;
+    auto write = [&ptr](const void* data, size_t size) {
+        memcpy(ptr, data, size);
+        ptr += size;
+    };
+    uint8_t odd_offset = _odd_offset;
+    uint8_t num_levels = _levels.size();
+    write(&_k, sizeof(_k));
+    write(&odd_offset, sizeof(odd_offset));
+    write(&num_levels, sizeof(num_levels));
+    write(&_count, sizeof(_count));
+    write(&_min, sizeof(_min));
+    write(&_max, sizeof(_max));
+    for (const auto& items : _levels) {
+        uint32_t size = items.size();
+        write(&size, sizeof(size));
+    }
+    for (const auto& items : _levels) {
+        write(items.data(), items.size() * sizeof(double));
+    }
+    DCHECK_EQ(ptr - dst, serialize_size());
+    return ptr - dst;
+}
+
+bool KllSketch::deserialize(const Slice& src) {
+    *this = KllSketch();
+    if (src.size < kHeaderSize) {
+        return false;
+    }
+    const auto* ptr = reinterpret_cast<const uint8_t*>(src.data);
+    const uint8_t* end = ptr + src.size;
+    auto read = [&ptr](void* data, size_t size) {
+        memcpy(data, ptr, size);
+        ptr += size;
+    };
+    uint16_t k;
+    uint8_t odd_offset;
+    uint8_t num_levels;
+    uint64_t count;
+    double min_value;
+    double max_value;
+    read(&k, sizeof(k));
+    read(&odd_offset, sizeof(odd_offset));
+    read(&num_levels, sizeof(num_levels));
+    read(&count, sizeof(count));
+    read(&min_value, sizeof(min_value));
+    read(&max_value, sizeof(max_value));
+    if (num_levels == 0 || num_levels >= 64 || static_cast<size_t>(end - ptr) < num_levels * sizeof(uint32_t)) {
+        return false;
+    }
+
+    std::vector<uint32_t> sizes(num_levels);
+    size_t num_retained = 0;
+    for (auto& size : sizes) {
+        read(&size, sizeof(size));
+        num_retained += size;
+    }
+    if (static_cast<size_t>(end - ptr) != num_retained * sizeof(double)) {
+        return false;
+    }
+    std::vector<std::vector<double>> levels(num_levels);
+    for (size_t level = 0; level < num_levels; ++level) {
+        levels[level].resize(sizes[level]);
+        read(levels[level].data(), sizes[level] * sizeof(double));
+    }
+
+    _k = std::max<uint16_t>(k, kMinLevelCapacity);
+    _odd_offset = odd_offset != 0;
+    _count = count;
+    _min = min_value;
+    _max = max_value;
+    _num_retained = num_retained;
+    _levels = std::move(levels);
+    return true;
+}
+
+} // namespace starrocks
@@ -0,0 +1,77 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "util/slice.h"
+
+namespace starrocks {
+
+// KLL quantile sketch, see "Optimal Quantile Approximation in Streams" by Karnin, Lang and Liberty.
+//
+// The sketch keeps its items in levels, an item of level h standing for 2^h input values. New values
+// are appended to level 0, and a level exceeding its capacity is compacted: it is sorted and every
+// other item, starting from the first or the second one, is promoted to the level above. The capacity
+// of a level shrinks geometrically from the top level, which holds k items, so the number of retained
+// items is bounded by about 3k whatever the number of input values, and so is the serialized size.
+//
+// Unlike a t-digest, a sketch only allocates the items it holds, and adding a batch of values amounts
+// to a copy into level 0 with one compaction every few hundred values.
+class KllSketch {
+public:
+    static constexpr uint16_t kDefaultK = 200;
+
+    explicit KllSketch(uint16_t k = kDefaultK);
+
+    void add(double value);
+
+    // The same as calling add() for each of the |num_values| values.
+    void add_batch(const double* values, size_t num_values);
+
+    void merge(const KllSketch& other);
+
+    // The approximate |q|-quantile of the values added, |q| in [0, 1]. Return 0 if no value was added.
+    double quantile(double q) const;
+
+    // The number of values added, including those of the merged sketches.
+    uint64_t count() const { return _count; }
+
+    // The number of items held by the sketch.
+    size_t num_retained() const { return _num_retained; }
+
+    size_t serialize_size() const;
+
+    // |dst| should have serialize_size() bytes, return the number of bytes written.
+    size_t serialize(uint8_t* dst) const;
+
+    // Return false if |src| is not a serialized sketch, in which case this sketch is left empty.
+    bool deserialize(const Slice& src);
+
+private:
+    // The capacity of a level, computed with the current number of levels.
+    size_t _level_capacity(size_t level) const;
+
+    // The sum of the capacities of the levels.
+    size_t _capacity() const;
+
+    // Compact the lowest levels exceeding their capacity until the sketch is within its capacity.
+    void _compress();
+
+    void _compact_level(size_t level);
+
+    uint16_t _k;
+    uint64_t _count = 0;
+    double _min = 0;
+    double _max = 0;
+    size_t _num_retained = 0;
+    // Whether the next compaction promotes the items at the odd positions, alternated between compactions
+    // so that the smaller and the larger items are promoted as often.
+    bool _odd_offset = false;
+    // Level 0 is unsorted, the other levels are sorted.
+    std::vector<std::vector<double>> _levels;
+};
+
+} // namespace starrocks
@@ -0,0 +1,119 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "util/lock_contention_profiler.h"
+
+#include <execinfo.h>
+
+#include <algorithm>
+
+#include "util/hash_util.hpp"
+#include "util/stack_util.h"
+
+namespace starrocks {
+
+void LockContentionSite::_sample_stack(SampleType type, int64_t ns) {
+    void* frames[kMaxStackDepth];
+    int depth = backtrace(frames, kMaxStackDepth);
+    // Skip the frame of this function, the callers in the profiler are inlined.
+    constexpr int kNumSkippedFrames = 1;
+    if (depth <= kNumSkippedFrames) {
+        return;
+    }
+    size_t hash = HashUtil::hash64(frames + kNumSkippedFrames, (depth - kNumSkippedFrames) * sizeof(void*), 0);
+
+    std::lock_guard l(_samples_mutex);
+    auto& samples = _samples[type];
+    auto iter = samples.find(hash);
+    if (iter == samples.end()) {
+        if (samples.size() >= kMaxNumStacks) {
+            _num_dropped_samples++;
+            return;
+        }
+        iter = samples.emplace(hash, StackSample()).first;
+        iter->second.frames.assign(frames + kNumSkippedFrames, frames + depth);
+    }
+    iter->second.count++;
+    iter->second.total_ns += ns;
+}
+
+void LockContentionSite::write_report(std::ostream& os, size_t max_stacks_per_type) {
+    os << "site: " << _name << "\n";
+    os << "  acquires: " << num_acquires() << ", contended: " << num_contended() << "\n";
+    os << "  wait time(us): total=" << wait_ns() / 1000 << ", max=" << max_wait_ns() / 1000 << "\n";
+    os << "  hold time(us): total=" << hold_ns() / 1000 << ", max=" << max_hold_ns() / 1000 << "\n";
+
+    std::lock_guard l(_samples_mutex);
+    for (int type : {WAIT, HOLD}) {
+        std::vector<const StackSample*> samples;
+        for (auto& [_, sample] : _samples[type]) {
+            samples.push_back(&sample);
+        }
+        std::sort(samples.begin(), samples.end(),
+                  [](const StackSample* lhs, const StackSample* rhs) { return lhs->total_ns > rhs->total_ns; });
+        if (samples.size() > max_stacks_per_type) {
+            samples.resize(max_stacks_per_type);
+        }
+        for (const StackSample* sample : samples) {
+            os << "  " << (type == WAIT ? "wait" : "hold") << " stack: count=" << sample->count
+               << ", total time(us)=" << sample->total_ns / 1000 << "\n";
+            write_symbolized_stack(os, sample->frames.data(), sample->frames.size(), "    ");
+        }
+    }
+    if (_num_dropped_samples > 0) {
+        os << "  dropped stack samples: " << _num_dropped_samples << "\n";
+    }
+}
+
+void LockContentionSite::reset() {
+    for (auto* value : {&_num_acquires, &_num_contended, &_wait_ns, &_hold_ns}) {
+        for (size_t i = 0; i < value->size(); i++) {
+            __atomic_store_n(value->access_at_core(i), 0, __ATOMIC_RELAXED);
+        }
+    }
+    _max_wait_ns = 0;
+    _max_hold_ns = 0;
+    std::lock_guard l(_samples_mutex);
+    _samples[WAIT].clear();
+    _samples[HOLD].clear();
+    _num_dropped_samples = 0;
+}
+
+LockContentionProfiler* LockContentionProfiler::instance() {
+    static LockContentionProfiler s_profiler;
+    return &s_profiler;
+}
+
+LockContentionSite* LockContentionProfiler::get_site(const std::string& name) {
+    std::lock_guard l(_mutex);
+    auto& site = _sites[name];
+    if (site == nullptr) {
+        site = std::make_unique<LockContentionSite>(name);
+    }
+    return site.get();
+}
+
+void LockContentionProfiler::write_report(std::ostream& os, size_t max_stacks_per_type) {
+    std::vector<LockContentionSite*> sites;
+    {
+        std::lock_guard l(_mutex);
+        for (auto& [_, site] : _sites) {
+            sites.push_back(site.get());
+        }
+    }
+    std::sort(sites.begin(), sites.end(),
+              [](LockContentionSite* lhs, LockContentionSite* rhs) { return lhs->wait_ns() > rhs->wait_ns(); });
+    os << "lock contention profile: " << (is_enabled() ? "enabled" : "disabled")
+       << ", stack threshold(us): " << config::lock_contention_stack_threshold_us << "\n";
+    for (auto* site : sites) {
+        site->write_report(os, max_stacks_per_type);
+    }
+}
+
+void LockContentionProfiler::reset() {
+    std::lock_guard l(_mutex);
+    for (auto& [_, site] : _sites) {
+        site->reset();
+    }
+}
+
+} // namespace starrocks
@@ -0,0 +1,187 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/config.h"
+#include "util/core_local.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+// The aggregated lock statistics of all the mutexes of the same site, e.g. all the shards of LRUCache.
+// The counters are core local, so that recording them does not become another contention point.
+class LockContentionSite {
+public:
+    static constexpr int kMaxStackDepth = 32;
+    // The distinct stacks sampled of a site, the samples of the other stacks are only counted as dropped.
+    static constexpr size_t kMaxNumStacks = 1024;
+
+    enum SampleType { WAIT = 0, HOLD = 1 };
+
+    explicit LockContentionSite(std::string name) : _name(std::move(name)) {}
+
+    const std::string& name() const { return _name; }
+
+    void record_wait(int64_t wait_ns) {
+        __sync_fetch_and_add(_num_acquires.access(), 1);
+        if (wait_ns > 0) {
+            __sync_fetch_and_add(_num_contended.access(), 1);
+            __sync_fetch_and_add(_wait_ns.access(), wait_ns);
+            _update_max(&_max_wait_ns, wait_ns);
+            if (wait_ns >= config::lock_contention_stack_threshold_us * 1000) {
+                _sample_stack(WAIT, wait_ns);
+            }
+        }
+    }
+
+    void record_hold(int64_t hold_ns) {
+        __sync_fetch_and_add(_hold_ns.access(), hold_ns);
+        _update_max(&_max_hold_ns, hold_ns);
+        if (hold_ns >= config::lock_contention_stack_threshold_us * 1000) {
+            _sample_stack(HOLD, hold_ns);
+        }
+    }
+
+    int64_t num_acquires() const { return _sum(_num_acquires); }
+    int64_t num_contended() const { return _sum(_num_contended); }
+    int64_t wait_ns() const { return _sum(_wait_ns); }
+    int64_t hold_ns() const { return _sum(_hold_ns); }
+    int64_t max_wait_ns() const { return _max_wait_ns; }
+    int64_t max_hold_ns() const { return _max_hold_ns; }
+
+    // Write the counters and the sampled stacks ordered by the total time descending.
+    void write_report(std::ostream& os, size_t max_stacks_per_type);
+
+    // Clear the counters and the samples. The concurrently recorded ones may be partially kept.
+    void reset();
+
+private:
+    struct StackSample {
+        std::vector<void*> frames;
+        int64_t count = 0;
+        int64_t total_ns = 0;
+    };
+
+    static void _update_max(std::atomic<int64_t>* max_value, int64_t value) {
+        int64_t current = max_value->load(std::memory_order_relaxed);
+        while (value > current && !max_value->compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    static int64_t _sum(const CoreLocalValue<int64_t>& value) {
+        int64_t sum = 0;
+        for (size_t i = 0; i < value.size(); i++) {
+            sum += *value.access_at_core(i);
+        }
+        return sum;
+    }
+
+    void _sample_stack(SampleType type, int64_t ns);
+
+    const std::string _name;
+    CoreLocalValue<int64_t> _num_acquires;
+    CoreLocalValue<int64_t> _num_contended;
+    CoreLocalValue<int64_t> _wait_ns;
+    CoreLocalValue<int64_t> _hold_ns;
+    std::atomic<int64_t> _max_wait_ns{0};
+    std::atomic<int64_t> _max_hold_ns{0};
+
+    std::mutex _samples_mutex;
+    // The samples of each SampleType keyed by the hash of the stack.
+    std::unordered_map<size_t, StackSample> _samples[2];
+    int64_t _num_dropped_samples = 0;
+};
+
+// The registry of the sites, which live until the process exits.
+class LockContentionProfiler {
+public:
+    static LockContentionProfiler* instance();
+
+    static bool is_enabled() { return config::enable_lock_contention_profile; }
+
+    // Return the site of |name|, which is created on the first call.
+    LockContentionSite* get_site(const std::string& name);
+
+    // Write the report of all the sites ordered by the total wait time descending.
+    void write_report(std::ostream& os, size_t max_stacks_per_type);
+
+    void reset();
+
+private:
+    LockContentionProfiler() = default;
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::unique_ptr<LockContentionSite>> _sites;
+};
+
+// A drop-in wrapper of |MutexType|, e.g. std::mutex, SpinLock or bthread::Mutex, which records the time waiting
+// for and holding the lock in its site when enable_lock_contention_profile is set, and samples the stacks when
+// either exceeds lock_contention_stack_threshold_us. Otherwise it costs one branch per lock and unlock.
+// Use std::condition_variable_any to wait on it.
+template <typename MutexType>
+class ProfiledMutex {
+public:
+    explicit ProfiledMutex(const std::string& site_name)
+            : _site(LockContentionProfiler::instance()->get_site(site_name)) {}
+
+    ProfiledMutex(const ProfiledMutex&) = delete;
+    ProfiledMutex& operator=(const ProfiledMutex&) = delete;
+
+    void lock() {
+        if (!LockContentionProfiler::is_enabled()) {
+            _mutex.lock();
+            _acquired_ns = 0;
+            return;
+        }
+        int64_t wait_ns = 0;
+        if (!_mutex.try_lock()) {
+            int64_t start_ns = MonotonicNanos();
+            _mutex.lock();
+            wait_ns = std::max<int64_t>(1, MonotonicNanos() - start_ns);
+        }
+        _wait_ns = wait_ns;
+        _acquired_ns = MonotonicNanos();
+    }
+
+    bool try_lock() {
+        if (!_mutex.try_lock()) {
+            return false;
+        }
+        _wait_ns = 0;
+        _acquired_ns = LockContentionProfiler::is_enabled() ? MonotonicNanos() : 0;
+        return true;
+    }
+
+    void unlock() {
+        // Not profiled if the profile was enabled after the lock was acquired.
+        if (_acquired_ns == 0) {
+            _mutex.unlock();
+            return;
+        }
+        int64_t wait_ns = _wait_ns;
+        int64_t hold_ns = MonotonicNanos() - _acquired_ns;
+        _mutex.unlock();
+        // Recorded after the lock is released, so that sampling the stack does not prolong the hold time.
+        _site->record_wait(wait_ns);
+        _site->record_hold(hold_ns);
+    }
+
+private:
+    MutexType _mutex;
+    LockContentionSite* _site;
+    // When the lock was acquired by the holder, 0 if not profiled, and how long the holder waited for it.
+    // Only accessed with the lock held.
+    int64_t _acquired_ns = 0;
+    int64_t _wait_ns = 0;
+};
+
+} // namespace starrocks
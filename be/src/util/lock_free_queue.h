@@ -0,0 +1,95 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include "common/compiler_util.h"
+#include "util/moodycamel/concurrentqueue.h"
+
+namespace starrocks {
+
+// A lock-free multi-producer multi-consumer queue built on moodycamel::ConcurrentQueue.
+//
+// It keeps an exact element counter besides the queue, because size_approx() of moodycamel
+// may lag behind, and the callers poll size()/empty() to decide whether to pull.
+// An element is counted after it is enqueued and uncounted after it is dequeued, so a consumer
+// observing a positive size() is always able to dequeue an element.
+//
+// The queue is not bounded by itself, the producers are throttled by their owner
+// (e.g. LocalExchangeMemoryManager or ChunkBufferLimiter) which accounts the buffered rows more precisely.
+//
+// The elements are not strictly FIFO across different producers, but FIFO for the same producer.
+template <typename T>
+class LockFreeQueue {
+public:
+    // |on_drop| is called with every element dropped by clear(),
+    // so the owner can release the resources accounted for it.
+    explicit LockFreeQueue(std::function<void(const T&)> on_drop = nullptr) : _on_drop(std::move(on_drop)) {}
+    ~LockFreeQueue() = default;
+
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+    // Return false iff this queue has been shutdown, and |val| is dropped.
+    bool put(T&& val) {
+        if (_shutdown.load(std::memory_order_acquire)) {
+            return false;
+        }
+        _queue.enqueue(std::move(val));
+        _size.fetch_add(1, std::memory_order_release);
+        // The consumers may have drained the queue in clear() before this element is enqueued,
+        // drop it here to not leave it in a shutdown queue.
+        if (UNLIKELY(_shutdown.load(std::memory_order_acquire))) {
+            clear();
+        }
+        return true;
+    }
+
+    bool try_get(T* out) {
+        if (_size.load(std::memory_order_acquire) <= 0) {
+            return false;
+        }
+        if (!_queue.try_dequeue(*out)) {
+            return false;
+        }
+        _size.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    // Once shutdown, put() drops the new elements.
+    void shutdown() { _shutdown.store(true, std::memory_order_release); }
+
+    bool is_shutdown() const { return _shutdown.load(std::memory_order_acquire); }
+
+    size_t size() const {
+        int64_t size = _size.load(std::memory_order_acquire);
+        return size > 0 ? size : 0;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    // Drop all the elements.
+    void clear() {
+        T val;
+        while (_queue.try_dequeue(val)) {
+            _size.fetch_sub(1, std::memory_order_release);
+            if (_on_drop != nullptr) {
+                _on_drop(val);
+            }
+            val = T();
+        }
+    }
+
+private:
+    const std::function<void(const T&)> _on_drop;
+    moodycamel::ConcurrentQueue<T> _queue;
+    // Signed, because a consumer may dequeue an element before its producer counts it.
+    std::atomic<int64_t> _size{0};
+    std::atomic<bool> _shutdown{false};
+};
+
+} // namespace starrocks
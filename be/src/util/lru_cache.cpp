@@ -155,12 +155,26 @@ LRUCache::LRUCache() {
     // Make empty circular linked list
     _lru.next = &_lru;
     _lru.prev = &_lru;
+    _protected.next = &_protected;
+    _protected.prev = &_protected;
 }
 
 LRUCache::~LRUCache() {
     prune();
 }
 
+void LRUCache::set_capacity(size_t capacity) {
+    std::vector<LRUHandle*> last_ref_list;
+    {
+        std::lock_guard l(_mutex);
+        _capacity = capacity;
+        _evict_from_lru(0, &last_ref_list);
+    }
+    for (auto entry : last_ref_list) {
+        entry->free();
+    }
+}
+
 bool LRUCache::_unref(LRUHandle* e) {
     DCHECK(e->refs > 0);
     e->refs--;
@@ -168,6 +182,9 @@ bool LRUCache::_unref(LRUHandle* e) {
 }
 
 void LRUCache::_lru_remove(LRUHandle* e) {
+    if (e->in_protected) {
+        _protected_usage -= e->charge;
+    }
     e->next->prev = e->prev;
     e->prev->next = e->next;
     e->prev = e->next = nullptr;
@@ -181,7 +198,26 @@ void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
     e->next->prev = e;
 }
 
-Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
+void LRUCache::_lru_put(LRUHandle* e) {
+    if (e->in_protected) {
+        _lru_append(&_protected, e);
+        _protected_usage += e->charge;
+        // Demote the oldest protected entries to the newest probationary ones.
+        while (_protected_usage > _capacity * _protected_ratio) {
+            LRUHandle* old = _protected.next;
+            _lru_remove(old);
+            old->in_protected = false;
+            _lru_append(&_lru, old);
+        }
+    } else if (e->sequential) {
+        // Make "e" the oldest entry.
+        _lru_append(_lru.next, e);
+    } else {
+        _lru_append(&_lru, e);
+    }
+}
+
+Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash, CacheAccessMode mode) {
     std::lock_guard l(_mutex);
     ++_lookup_count;
     LRUHandle* e = _table.lookup(key, hash);
@@ -192,6 +228,11 @@ Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
             // only in LRU free list, remove it from list
             _lru_remove(e);
         }
+        if (mode == CacheAccessMode::NORMAL) {
+            // Hit again, it will be put into the protected segment when released.
+            e->in_protected = true;
+            e->sequential = false;
+        }
         e->refs++;
         ++_hit_count;
     }
@@ -220,7 +261,7 @@ void LRUCache::release(Cache::Handle* handle) {
                 last_ref = true;
             } else {
                 // put it to LRU free list
-                _lru_append(&_lru, e);
+                _lru_put(e);
             }
         }
     }
@@ -232,24 +273,26 @@ void LRUCache::release(Cache::Handle* handle) {
 }
 
 void LRUCache::_evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted) {
-    LRUHandle* cur = &_lru;
-    // 1. evict normal cache entries
-    while (_usage + charge > _capacity && cur->next != &_lru) {
+    // 1. evict normal cache entries, probationary ones first
+    _evict_from_list(&_lru, charge, true, deleted);
+    _evict_from_list(&_protected, charge, true, deleted);
+    // 2. evict durable cache entries if need
+    _evict_from_list(&_lru, charge, false, deleted);
+    _evict_from_list(&_protected, charge, false, deleted);
+}
+
+void LRUCache::_evict_from_list(LRUHandle* list, size_t charge, bool skip_durable,
+                                std::vector<LRUHandle*>* deleted) {
+    LRUHandle* cur = list;
+    while (_usage + charge > _capacity && cur->next != list) {
         LRUHandle* old = cur->next;
-        if (old->priority == CachePriority::DURABLE) {
+        if (skip_durable && old->priority == CachePriority::DURABLE) {
             cur = cur->next;
             continue;
         }
         _evict_one_entry(old);
         deleted->push_back(old);
     }
-    // 2. evict durable cache entries if need
-    while (_usage + charge > _capacity && _lru.next != &_lru) {
-        LRUHandle* old = _lru.next;
-        DCHECK(old->priority == CachePriority::DURABLE);
-        _evict_one_entry(old);
-        deleted->push_back(old);
-    }
 }
 
 void LRUCache::_evict_one_entry(LRUHandle* e) {
@@ -263,7 +306,8 @@ void LRUCache::_evict_one_entry(LRUHandle* e) {
 }
 
 Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
-                                void (*deleter)(const CacheKey& key, void* value), CachePriority priority) {
+                                void (*deleter)(const CacheKey& key, void* value), CachePriority priority,
+                                CacheAccessMode mode) {
     LRUHandle* e = reinterpret_cast<LRUHandle*>(malloc(sizeof(LRUHandle) - 1 + key.size()));
     e->value = value;
     e->deleter = deleter;
@@ -274,6 +318,8 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->next = e->prev = nullptr;
     e->in_cache = true;
     e->priority = priority;
+    e->in_protected = false;
+    e->sequential = (mode == CacheAccessMode::SEQUENTIAL);
     memcpy(e->key_data, key.data(), key.size());
     std::vector<LRUHandle*> last_ref_list;
     {
@@ -337,16 +383,18 @@ int LRUCache::prune() {
     std::vector<LRUHandle*> last_ref_list;
     {
         std::lock_guard l(_mutex);
-        while (_lru.next != &_lru) {
-            LRUHandle* old = _lru.next;
-            DCHECK(old->in_cache);
-            DCHECK(old->refs == 1); // LRU list contains elements which may be evicted
-            _lru_remove(old);
-            _table.remove(old->key(), old->hash);
-            old->in_cache = false;
-            _unref(old);
-            _usage -= old->charge;
-            last_ref_list.push_back(old);
+        for (LRUHandle* list : {&_lru, &_protected}) {
+            while (list->next != list) {
+                LRUHandle* old = list->next;
+                DCHECK(old->in_cache);
+                DCHECK(old->refs == 1); // LRU list contains elements which may be evicted
+                _lru_remove(old);
+                _table.remove(old->key(), old->hash);
+                old->in_cache = false;
+                _unref(old);
+                _usage -= old->charge;
+                last_ref_list.push_back(old);
+            }
         }
     }
     for (auto entry : last_ref_list) {
@@ -363,7 +411,14 @@ uint32_t ShardedLRUCache::_shard(uint32_t hash) {
     return hash >> (32 - kNumShardBits);
 }
 
-ShardedLRUCache::ShardedLRUCache(size_t capacity) : _last_id(0) {
+ShardedLRUCache::ShardedLRUCache(size_t capacity, double protected_ratio) : _last_id(0) {
+    for (auto& _shard : _shards) {
+        _shard.set_protected_ratio(protected_ratio);
+    }
+    set_capacity(capacity);
+}
+
+void ShardedLRUCache::set_capacity(size_t capacity) {
     const size_t per_shard = (capacity + (kNumShards - 1)) / kNumShards;
 
     for (auto& _shard : _shards) {
@@ -371,15 +426,24 @@ ShardedLRUCache::ShardedLRUCache(size_t capacity) : _last_id(0) {
     }
 }
 
+size_t ShardedLRUCache::get_capacity() {
+    size_t total_capacity = 0;
+    for (const auto& _shard : _shards) {
+        total_capacity += _shard.get_capacity();
+    }
+    return total_capacity;
+}
+
 Cache::Handle* ShardedLRUCache::insert(const CacheKey& key, void* value, size_t charge,
-                                       void (*deleter)(const CacheKey& key, void* value), CachePriority priority) {
+                                       void (*deleter)(const CacheKey& key, void* value), CachePriority priority,
+                                       CacheAccessMode mode) {
     const uint32_t hash = _hash_slice(key);
-    return _shards[_shard(hash)].insert(key, hash, value, charge, deleter, priority);
+    return _shards[_shard(hash)].insert(key, hash, value, charge, deleter, priority, mode);
 }
 
-Cache::Handle* ShardedLRUCache::lookup(const CacheKey& key) {
+Cache::Handle* ShardedLRUCache::lookup(const CacheKey& key, CacheAccessMode mode) {
     const uint32_t hash = _hash_slice(key);
-    return _shards[_shard(hash)].lookup(key, hash);
+    return _shards[_shard(hash)].lookup(key, hash, mode);
 }
 
 void ShardedLRUCache::release(Handle* handle) {
@@ -439,6 +503,8 @@ void ShardedLRUCache::get_cache_status(rapidjson::Document* document) {
         }
 
         shard_info.AddMember("usage_ratio", usage_ratio, document->GetAllocator());
+        shard_info.AddMember("protected_usage", static_cast<double>(_shards[i].get_protected_usage()),
+                             document->GetAllocator());
 
         size_t lookup_count = _shards[i].get_lookup_count();
         size_t hit_count = _shards[i].get_hit_count();
@@ -456,8 +522,8 @@ void ShardedLRUCache::get_cache_status(rapidjson::Document* document) {
     }
 }
 
-Cache* new_lru_cache(size_t capacity) {
-    return new ShardedLRUCache(capacity);
+Cache* new_lru_cache(size_t capacity, double protected_ratio) {
+    return new ShardedLRUCache(capacity, protected_ratio);
 }
 
 } // namespace starrocks
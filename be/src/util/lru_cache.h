@@ -13,6 +13,7 @@
 #include <string_view>
 #include <vector>
 
+#include "util/lock_contention_profiler.h"
 #include "util/slice.h"
 
 namespace starrocks {
@@ -22,7 +23,12 @@ class CacheKey;
 
 // Create a new cache with a fixed size capacity.  This implementation
 // of Cache uses a least-recently-used eviction policy.
-extern Cache* new_lru_cache(size_t capacity);
+//
+// If |protected_ratio| is positive, the cache is a segmented LRU: the entries hit again after
+// they are inserted are moved into a protected segment of at most |protected_ratio| of the capacity,
+// and the other entries are evicted before them. So the entries read once, e.g. by a big scan,
+// don't wipe out the working set.
+extern Cache* new_lru_cache(size_t capacity, double protected_ratio = 0);
 
 class CacheKey {
 public:
@@ -112,6 +118,11 @@ private:
 // The entry with smaller CachePriority will evict firstly
 enum class CachePriority { NORMAL = 0, DURABLE = 1 };
 
+// SEQUENTIAL is for the accesses unlikely to be repeated soon, e.g. by big scans.
+// A SEQUENTIAL lookup doesn't move the entry into the protected segment, and the entries
+// inserted by SEQUENTIAL accesses only are evicted before all the others.
+enum class CacheAccessMode { NORMAL = 0, SEQUENTIAL = 1 };
+
 class Cache {
 public:
     Cache() = default;
@@ -134,14 +145,15 @@ public:
     // value will be passed to "deleter".
     virtual Handle* insert(const CacheKey& key, void* value, size_t charge,
                            void (*deleter)(const CacheKey& key, void* value),
-                           CachePriority priority = CachePriority::NORMAL) = 0;
+                           CachePriority priority = CachePriority::NORMAL,
+                           CacheAccessMode mode = CacheAccessMode::NORMAL) = 0;
 
     // If the cache has no mapping for "key", returns NULL.
     //
     // Else return a handle that corresponds to the mapping.  The caller
     // must call this->release(handle) when the returned mapping is no
     // longer needed.
-    virtual Handle* lookup(const CacheKey& key) = 0;
+    virtual Handle* lookup(const CacheKey& key, CacheAccessMode mode = CacheAccessMode::NORMAL) = 0;
 
     // Release a mapping returned by a previous Lookup().
     // REQUIRES: handle must not have been released yet.
@@ -179,6 +191,10 @@ public:
     virtual size_t get_memory_usage() = 0;
     virtual void get_cache_status(rapidjson::Document* document) = 0;
 
+    // Change the capacity, the entries not in use are evicted if the usage exceeds the new capacity.
+    virtual void set_capacity(size_t capacity) = 0;
+    virtual size_t get_capacity() = 0;
+
 private:
     Cache(const Cache&) = delete;
     const Cache& operator=(const Cache&) = delete;
@@ -198,7 +214,9 @@ typedef struct LRUHandle {
     uint32_t refs;
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
-    char key_data[1]; // Beginning of key
+    bool in_protected; // Whether entry is in the protected segment.
+    bool sequential;   // Whether entry is only accessed by CacheAccessMode::SEQUENTIAL.
+    char key_data[1];  // Beginning of key
 
     CacheKey key() const {
         // For cheaper lookups, we allow a temporary Handle object
@@ -256,13 +274,15 @@ public:
     ~LRUCache();
 
     // Separate from constructor so caller can easily make an array of LRUCache
-    void set_capacity(size_t capacity) { _capacity = capacity; }
+    void set_capacity(size_t capacity);
+    void set_protected_ratio(double protected_ratio) { _protected_ratio = protected_ratio; }
 
     // Like Cache methods, but with an extra "hash" parameter.
     Cache::Handle* insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                           void (*deleter)(const CacheKey& key, void* value),
-                          CachePriority priority = CachePriority::NORMAL);
-    Cache::Handle* lookup(const CacheKey& key, uint32_t hash);
+                          CachePriority priority = CachePriority::NORMAL,
+                          CacheAccessMode mode = CacheAccessMode::NORMAL);
+    Cache::Handle* lookup(const CacheKey& key, uint32_t hash, CacheAccessMode mode = CacheAccessMode::NORMAL);
     void release(Cache::Handle* handle);
     void erase(const CacheKey& key, uint32_t hash);
     int prune();
@@ -270,27 +290,36 @@ public:
     uint64_t get_lookup_count() const { return _lookup_count; }
     uint64_t get_hit_count() const { return _hit_count; }
     size_t get_usage() const { return _usage; }
+    size_t get_protected_usage() const { return _protected_usage; }
     size_t get_capacity() const { return _capacity; }
 
 private:
     void _lru_remove(LRUHandle* e);
     void _lru_append(LRUHandle* list, LRUHandle* e);
+    // Put an entry only referenced by the cache into the list of its segment.
+    void _lru_put(LRUHandle* e);
     bool _unref(LRUHandle* e);
     void _evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted);
+    void _evict_from_list(LRUHandle* list, size_t charge, bool skip_durable, std::vector<LRUHandle*>* deleted);
     void _evict_one_entry(LRUHandle* e);
 
     // Initialized before use.
     size_t _capacity;
+    double _protected_ratio = 0;
 
     // _mutex protects the following state.
-    std::mutex _mutex;
+    ProfiledMutex<std::mutex> _mutex{"lru_cache"};
     size_t _usage{0};
     uint64_t _last_id{0};
 
-    // Dummy head of LRU list.
+    // Dummy head of LRU list of the probationary segment.
     // lru.prev is newest entry, lru.next is oldest entry.
     // Entries have refs==1 and in_cache==true.
     LRUHandle _lru;
+    // Dummy head of LRU list of the protected segment, the entries are evicted after the ones of _lru.
+    LRUHandle _protected;
+    // The total charge of the entries in _protected.
+    size_t _protected_usage{0};
 
     HandleTable _table;
 
@@ -303,11 +332,12 @@ static const int kNumShards = 1 << kNumShardBits;
 
 class ShardedLRUCache : public Cache {
 public:
-    explicit ShardedLRUCache(size_t capacity);
+    explicit ShardedLRUCache(size_t capacity, double protected_ratio = 0);
     ~ShardedLRUCache() override = default;
     Handle* insert(const CacheKey& key, void* value, size_t charge, void (*deleter)(const CacheKey& key, void* value),
-                   CachePriority priority = CachePriority::NORMAL) override;
-    Handle* lookup(const CacheKey& key) override;
+                   CachePriority priority = CachePriority::NORMAL,
+                   CacheAccessMode mode = CacheAccessMode::NORMAL) override;
+    Handle* lookup(const CacheKey& key, CacheAccessMode mode = CacheAccessMode::NORMAL) override;
     void release(Handle* handle) override;
     void erase(const CacheKey& key) override;
     void* value(Handle* handle) override;
@@ -316,6 +346,8 @@ public:
     void prune() override;
     size_t get_memory_usage() override;
     void get_cache_status(rapidjson::Document* document) override;
+    void set_capacity(size_t capacity) override;
+    size_t get_capacity() override;
 
 private:
     static uint32_t _hash_slice(const CacheKey& s);
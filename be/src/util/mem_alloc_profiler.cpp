@@ -0,0 +1,156 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "util/mem_alloc_profiler.h"
+
+#include <execinfo.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <vector>
+
+#include "util/hash_util.hpp"
+#include "util/stack_util.h"
+
+namespace starrocks {
+
+static MemAllocProfiler s_mem_alloc_profiler;
+
+// Whether the thread is sampling, to skip the allocations of backtrace() itself.
+static thread_local bool tls_in_mem_alloc_sample = false;
+
+MemAllocProfiler* MemAllocProfiler::instance() {
+    return &s_mem_alloc_profiler;
+}
+
+void MemAllocProfiler::sample(const char* label) {
+    if (tls_in_mem_alloc_sample) {
+        return;
+    }
+    tls_in_mem_alloc_sample = true;
+    int64_t sample_bytes = std::max<int64_t>(1, config::mem_alloc_profile_sample_bytes);
+    // The bytes allocated since the last sample.
+    int64_t bytes = sample_bytes - tls_mem_alloc_bytes_until_sample;
+    tls_mem_alloc_bytes_until_sample = sample_bytes;
+
+    void* frames[kMaxStackDepth];
+    // Skip the frame of this function.
+    int depth = backtrace(frames, kMaxStackDepth) - 1;
+    if (depth <= 0) {
+        tls_in_mem_alloc_sample = false;
+        return;
+    }
+    size_t label_length = strnlen(label, kMaxLabelLength - 1);
+    uint64_t hash = HashUtil::hash64(frames + 1, depth * sizeof(void*), 0);
+    hash = HashUtil::hash64(label, label_length, hash);
+    hash = std::max<uint64_t>(hash, 1);
+
+    _lock();
+    // Linear probing in at most 64 slots.
+    size_t index = hash % kNumSlots;
+    bool recorded = false;
+    for (size_t i = 0; i < 64; i++, index = (index + 1) % kNumSlots) {
+        Slot& slot = _slots[index];
+        if (slot.hash == 0) {
+            slot.hash = hash;
+            memcpy(slot.label, label, label_length);
+            slot.label[label_length] = '\0';
+            slot.depth = depth;
+            memcpy(slot.frames, frames + 1, depth * sizeof(void*));
+        } else if (slot.hash != hash) {
+            continue;
+        }
+        slot.count++;
+        slot.bytes += bytes;
+        recorded = true;
+        break;
+    }
+    _unlock();
+    if (!recorded) {
+        _num_dropped_samples.fetch_add(1, std::memory_order_relaxed);
+    }
+    tls_in_mem_alloc_sample = false;
+}
+
+std::vector<MemAllocProfiler::Slot> MemAllocProfiler::_copy_slots(const std::string& label_filter) {
+    std::vector<Slot> slots;
+    // The allocations of the copy are not sampled, which would wait for the lock held by this thread.
+    tls_in_mem_alloc_sample = true;
+    _lock();
+    for (const auto& slot : _slots) {
+        if (slot.hash != 0 && (label_filter.empty() || strstr(slot.label, label_filter.c_str()) != nullptr)) {
+            slots.push_back(slot);
+        }
+    }
+    _unlock();
+    tls_in_mem_alloc_sample = false;
+    return slots;
+}
+
+void MemAllocProfiler::write_report(std::ostream& os, const std::string& label_filter, size_t max_stacks) {
+    std::vector<Slot> slots = _copy_slots(label_filter);
+
+    std::map<std::string, std::vector<const Slot*>> label_slots;
+    std::map<std::string, int64_t> label_bytes;
+    for (const auto& slot : slots) {
+        label_slots[slot.label].push_back(&slot);
+        label_bytes[slot.label] += slot.bytes;
+    }
+    std::vector<std::pair<int64_t, std::string>> labels;
+    for (auto& [label, bytes] : label_bytes) {
+        labels.emplace_back(bytes, label);
+    }
+    std::sort(labels.begin(), labels.end(), std::greater<>());
+
+    os << "mem alloc profile: " << (is_enabled() ? "enabled" : "disabled")
+       << ", sample bytes: " << config::mem_alloc_profile_sample_bytes
+       << ", dropped samples: " << num_dropped_samples() << "\n";
+    for (auto& [bytes, label] : labels) {
+        os << "label: " << label << ", allocated bytes: " << bytes << "\n";
+        auto& stacks = label_slots[label];
+        std::sort(stacks.begin(), stacks.end(),
+                  [](const Slot* lhs, const Slot* rhs) { return lhs->bytes > rhs->bytes; });
+        for (size_t i = 0; i < std::min(max_stacks, stacks.size()); i++) {
+            os << "  stack: samples=" << stacks[i]->count << ", allocated bytes=" << stacks[i]->bytes << "\n";
+            write_symbolized_stack(os, stacks[i]->frames, stacks[i]->depth, "    ");
+        }
+    }
+}
+
+void MemAllocProfiler::write_pprof(std::ostream& os, const std::string& label_filter) {
+    std::vector<Slot> slots = _copy_slots(label_filter);
+
+    int64_t total_count = 0;
+    int64_t total_bytes = 0;
+    for (const auto& slot : slots) {
+        total_count += slot.count;
+        total_bytes += slot.bytes;
+    }
+    os << "heap profile: " << total_count << ": " << total_bytes << " [" << total_count << ": " << total_bytes
+       << "] @ heapprofile\n";
+    for (const auto& slot : slots) {
+        os << slot.count << ": " << slot.bytes << " [" << slot.count << ": " << slot.bytes << "] @";
+        for (int i = 0; i < slot.depth; i++) {
+            os << " " << slot.frames[i];
+        }
+        os << "\n";
+    }
+    os << "\nMAPPED_LIBRARIES:\n";
+    std::ifstream maps("/proc/self/maps");
+    os << maps.rdbuf();
+}
+
+void MemAllocProfiler::reset() {
+    _lock();
+    for (auto& slot : _slots) {
+        slot.hash = 0;
+        slot.count = 0;
+        slot.bytes = 0;
+    }
+    _unlock();
+    _num_dropped_samples = 0;
+}
+
+} // namespace starrocks
@@ -0,0 +1,91 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "common/compiler_util.h"
+#include "common/config.h"
+
+namespace starrocks {
+
+// The thread local bytes allocated until the next sample, see MemAllocProfiler::should_sample.
+inline thread_local int64_t tls_mem_alloc_bytes_until_sample = 0;
+
+// A sampled profile of the allocations, which attributes the allocated bytes to the label of the MemTracker of the
+// thread and the call stack, when enable_mem_alloc_profile is set.
+//
+// One allocation is sampled each time the allocated bytes of a thread reach mem_alloc_profile_sample_bytes, and
+// it's weighted by all the bytes allocated since the last sample, so the sum of the weights is the allocated bytes.
+// The frees are not tracked, it shows where the memory is allocated rather than where it's held.
+//
+// It's called by the malloc hooks, so sampling must not allocate: the samples are kept in a fixed size table,
+// once it's full the samples of the new stacks are only counted as dropped.
+class MemAllocProfiler {
+public:
+    static constexpr int kMaxStackDepth = 32;
+    static constexpr size_t kMaxLabelLength = 64;
+    static constexpr size_t kNumSlots = 8192;
+
+    static MemAllocProfiler* instance();
+
+    static bool is_enabled() { return config::enable_mem_alloc_profile; }
+
+    // Whether the allocation of |size| bytes by this thread should be sampled, called by each allocation.
+    static bool should_sample(int64_t size) {
+        if (LIKELY(!is_enabled()) || size <= 0) {
+            return false;
+        }
+        tls_mem_alloc_bytes_until_sample -= size;
+        return tls_mem_alloc_bytes_until_sample <= 0;
+    }
+
+    // Record the current stack with the bytes allocated since the last sample of this thread.
+    void sample(const char* label);
+
+    // Write the samples of the labels containing |label_filter|, all if empty, grouped by the labels in the
+    // descending order of the allocated bytes, with at most |max_stacks| symbolized stacks of each label.
+    void write_report(std::ostream& os, const std::string& label_filter, size_t max_stacks);
+
+    // Write the samples of the labels containing |label_filter| in the legacy heap profile format of gperftools,
+    // which pprof reads, e.g. "pprof --sample_index=alloc_space <binary> <file>". The in-use values are the
+    // allocated bytes too, since the frees are not tracked.
+    void write_pprof(std::ostream& os, const std::string& label_filter);
+
+    void reset();
+
+    int64_t num_dropped_samples() const { return _num_dropped_samples.load(std::memory_order_relaxed); }
+
+private:
+    struct Slot {
+        // 0 if the slot is empty.
+        uint64_t hash;
+        char label[kMaxLabelLength];
+        int depth;
+        void* frames[kMaxStackDepth];
+        int64_t count;
+        int64_t bytes;
+    };
+
+    // Copy the samples of the labels containing |label_filter| out of the lock.
+    std::vector<Slot> _copy_slots(const std::string& label_filter);
+
+    void _lock() {
+        while (_locked.exchange(true, std::memory_order_acquire)) {
+        }
+    }
+    void _unlock() { _locked.store(false, std::memory_order_release); }
+
+    // The slots are zero initialized, so that the profiler is usable by the allocations before the static
+    // initialization.
+    std::atomic<bool> _locked{false};
+    Slot _slots[kNumSlots];
+    std::atomic<int64_t> _num_dropped_samples{0};
+};
+
+} // namespace starrocks
@@ -21,6 +21,8 @@
 
 #include "util/metrics.h"
 
+#include <algorithm>
+#include <limits>
 #include <mutex>
 
 namespace starrocks {
@@ -82,6 +84,68 @@ const char* unit_name(MetricUnit unit) {
     }
 }
 
+IntHistogram::IntHistogram(MetricUnit unit, std::vector<int64_t> bounds)
+        : Metric(MetricType::HISTOGRAM, unit),
+          _bounds(std::move(bounds)),
+          _bucket_counts(new std::atomic<int64_t>[_bounds.size() + 1]) {
+    DCHECK(std::is_sorted(_bounds.begin(), _bounds.end()));
+    for (size_t i = 0; i <= _bounds.size(); i++) {
+        _bucket_counts[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+std::vector<int64_t> IntHistogram::exponential_bounds(int64_t start, int64_t factor, int num_buckets) {
+    DCHECK(start > 0 && factor > 1);
+    std::vector<int64_t> bounds;
+    int64_t bound = start;
+    for (int i = 0; i < num_buckets; i++) {
+        bounds.push_back(bound);
+        if (bound > std::numeric_limits<int64_t>::max() / factor) {
+            break;
+        }
+        bound *= factor;
+    }
+    return bounds;
+}
+
+void IntHistogram::observe(int64_t value) {
+    size_t bucket = std::lower_bound(_bounds.begin(), _bounds.end(), value) - _bounds.begin();
+    _bucket_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(value, std::memory_order_relaxed);
+}
+
+std::vector<int64_t> IntHistogram::cumulative_counts() const {
+    std::vector<int64_t> counts(_bounds.size() + 1);
+    int64_t count = 0;
+    for (size_t i = 0; i <= _bounds.size(); i++) {
+        count += _bucket_counts[i].load(std::memory_order_relaxed);
+        counts[i] = count;
+    }
+    return counts;
+}
+
+int64_t IntHistogram::count() const {
+    int64_t count = 0;
+    for (size_t i = 0; i <= _bounds.size(); i++) {
+        count += _bucket_counts[i].load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+void IntHistogram::write_value(rj::Value& metric_obj, rj::Document::AllocatorType& allocator) {
+    std::vector<int64_t> counts = cumulative_counts();
+    rj::Value buckets(rj::kArrayType);
+    for (size_t i = 0; i < _bounds.size(); i++) {
+        rj::Value bucket(rj::kObjectType);
+        bucket.AddMember("le", rj::Value(_bounds[i]), allocator);
+        bucket.AddMember("count", rj::Value(counts[i]), allocator);
+        buckets.PushBack(bucket, allocator);
+    }
+    metric_obj.AddMember("buckets", buckets, allocator);
+    metric_obj.AddMember("count", rj::Value(counts.back()), allocator);
+    metric_obj.AddMember("sum", rj::Value(sum()), allocator);
+}
+
 void Metric::hide() {
     if (_registry == nullptr) {
         return;
@@ -35,12 +35,14 @@ DIAGNOSTIC_POP
 #include <atomic>
 #include <functional>
 #include <iomanip>
+#include <memory>
 #include <mutex>
 #include <ostream>
 #include <set>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "common/config.h"
 #include "util/core_local.h"
@@ -213,6 +215,37 @@ public:
     virtual ~LockGauge() = default;
 };
 
+// Histogram of the observed values, i.e. the number of values no greater than each of the upper bounds
+// of the buckets plus the count and the sum of all the values, like the histogram of prometheus.
+class IntHistogram : public Metric {
+public:
+    // |bounds| are the ascending upper bounds of the buckets, a last bucket of +Inf is added implicitly.
+    IntHistogram(MetricUnit unit, std::vector<int64_t> bounds);
+    ~IntHistogram() override = default;
+
+    // The bounds start, start*factor, start*factor^2, ... of |num_buckets| buckets.
+    static std::vector<int64_t> exponential_bounds(int64_t start, int64_t factor, int num_buckets);
+
+    // The count of the values.
+    std::string to_string() const override { return std::to_string(count()); }
+
+    void write_value(rj::Value& metric_obj, rj::Document::AllocatorType& allocator) override;
+
+    void observe(int64_t value);
+
+    const std::vector<int64_t>& bounds() const { return _bounds; }
+    // The number of the values no greater than each bound, and the count of all the values at last.
+    std::vector<int64_t> cumulative_counts() const;
+    int64_t count() const;
+    int64_t sum() const { return _sum.load(std::memory_order_relaxed); }
+
+private:
+    const std::vector<int64_t> _bounds;
+    // The number of the values in each bucket, including the one of +Inf.
+    std::unique_ptr<std::atomic<int64_t>[]> _bucket_counts;
+    std::atomic<int64_t> _sum{0};
+};
+
 // one key-value pair used to
 struct MetricLabel {
     std::string name;
@@ -0,0 +1,131 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "util/perf_event_counters.h"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+#include "common/logging.h"
+#include "util/debug/query_trace.h"
+
+namespace starrocks {
+
+static constexpr uint64_t kPerfEventConfigs[PerfEventCounters::NUM_EVENTS] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES};
+
+static constexpr const char* kPerfEventNames[PerfEventCounters::NUM_EVENTS] = {"CPUCycles", "Instructions",
+                                                                                "LLCMisses", "BranchMisses"};
+
+// Whether the perf events of the calling thread have been opened, successfully or not.
+static thread_local bool tls_perf_event_counters_opened = false;
+static thread_local std::unique_ptr<PerfEventCounters> tls_perf_event_counters;
+
+PerfEventCounters::~PerfEventCounters() {
+    for (int fd : _fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+const char* PerfEventCounters::event_name(int event) {
+    DCHECK(event >= 0 && event < NUM_EVENTS);
+    return kPerfEventNames[event];
+}
+
+PerfEventCounters* PerfEventCounters::current_thread() {
+    if (!tls_perf_event_counters_opened) {
+        tls_perf_event_counters_opened = true;
+        std::unique_ptr<PerfEventCounters> counters(new PerfEventCounters());
+        if (counters->_open()) {
+            tls_perf_event_counters = std::move(counters);
+        }
+    }
+    return tls_perf_event_counters.get();
+}
+
+bool PerfEventCounters::_open() {
+    for (int i = 0; i < NUM_EVENTS; ++i) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = kPerfEventConfigs[i];
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        // The group starts counting with its leader.
+        attr.disabled = i == 0 ? 1 : 0;
+        int group_fd = i == 0 ? -1 : _fds[0];
+        _fds[i] = syscall(__NR_perf_event_open, &attr, 0 /* the calling thread */, -1 /* any cpu */, group_fd, 0);
+        if (_fds[i] < 0) {
+            static std::once_flag log_once;
+            std::call_once(log_once, [&]() {
+                PLOG(WARNING) << "Failed to open perf event " << kPerfEventNames[i] << ", the hardware counters of "
+                              << "the operators are not available";
+            });
+            return false;
+        }
+    }
+    return ioctl(_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) == 0;
+}
+
+bool PerfEventCounters::read(Values* values) const {
+    // The number of events, followed by their values.
+    uint64_t buf[NUM_EVENTS + 1];
+    if (::read(_fds[0], buf, sizeof(buf)) != sizeof(buf) || buf[0] != NUM_EVENTS) {
+        return false;
+    }
+    for (int i = 0; i < NUM_EVENTS; ++i) {
+        (*values)[i] = static_cast<int64_t>(buf[i + 1]);
+    }
+    return true;
+}
+
+ScopedPerfEventCounters::ScopedPerfEventCounters(RuntimeProfile::Counter* const* counters,
+                                                 const std::string& trace_name)
+        : _counters(counters), _trace_name(trace_name) {
+    if (_counters == nullptr) {
+        return;
+    }
+    _perf_counters = PerfEventCounters::current_thread();
+    if (_perf_counters != nullptr && !_perf_counters->read(&_start_values)) {
+        _perf_counters = nullptr;
+    }
+}
+
+ScopedPerfEventCounters::~ScopedPerfEventCounters() {
+    PerfEventCounters::Values values;
+    if (!elapsed(&values)) {
+        return;
+    }
+    for (int i = 0; i < PerfEventCounters::NUM_EVENTS; ++i) {
+        _counters[i]->update(values[i]);
+    }
+    if (debug::tls_trace_ctx.event_buffer != nullptr) {
+        std::vector<std::pair<std::string, std::string>> trace_counters;
+        for (int i = 0; i < PerfEventCounters::NUM_EVENTS; ++i) {
+            trace_counters.emplace_back(PerfEventCounters::event_name(i), std::to_string(values[i]));
+        }
+        QUERY_TRACE_COUNTERS(_trace_name, "perf_event", std::move(trace_counters));
+    }
+}
+
+bool ScopedPerfEventCounters::elapsed(PerfEventCounters::Values* values) const {
+    if (_perf_counters == nullptr || !_perf_counters->read(values)) {
+        return false;
+    }
+    for (int i = 0; i < PerfEventCounters::NUM_EVENTS; ++i) {
+        (*values)[i] -= _start_values[i];
+    }
+    return true;
+}
+
+} // namespace starrocks
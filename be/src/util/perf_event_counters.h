@@ -0,0 +1,62 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+// The hardware counters of the calling thread, counted in the user space by perf_event_open(2).
+//
+// The events are opened as a group, so they are always scheduled onto the PMU together and their counts
+// cover the same instructions. Reading them costs a syscall, which suits wrapping the calls doing a batch
+// of work, like pushing or pulling a chunk, rather than the per-row code.
+class PerfEventCounters {
+public:
+    enum Event { CYCLES = 0, INSTRUCTIONS, CACHE_MISSES, BRANCH_MISSES, NUM_EVENTS };
+    using Values = std::array<int64_t, NUM_EVENTS>;
+
+    ~PerfEventCounters();
+
+    // The name of |event| in the profile, e.g. "CPUCycles".
+    static const char* event_name(int event);
+
+    // The counters of the calling thread, opened by its first call. Return nullptr if the perf events
+    // are not available, e.g. not permitted by kernel.perf_event_paranoid, or in a virtual machine without PMU.
+    static PerfEventCounters* current_thread();
+
+    // Read the counts since the counters were opened.
+    bool read(Values* values) const;
+
+private:
+    PerfEventCounters() = default;
+
+    bool _open();
+
+    std::array<int, NUM_EVENTS> _fds{-1, -1, -1, -1};
+};
+
+// Add the counts of the hardware events of the calling thread in the scope to |counters|, which are the
+// counters of PerfEventCounters::event_name(). Do nothing if |counters| is nullptr or the events are unavailable.
+// If the query is traced, the counts are also added to the query trace as a counter event |trace_name|,
+// which must outlive the scope.
+class ScopedPerfEventCounters {
+public:
+    ScopedPerfEventCounters(RuntimeProfile::Counter* const* counters, const std::string& trace_name);
+    ~ScopedPerfEventCounters();
+
+    // The counts of the scope so far.
+    bool elapsed(PerfEventCounters::Values* values) const;
+
+private:
+    RuntimeProfile::Counter* const* _counters;
+    const std::string& _trace_name;
+    const PerfEventCounters* _perf_counters = nullptr;
+    PerfEventCounters::Values _start_values{};
+};
+
+} // namespace starrocks
@@ -17,6 +17,11 @@
 
 #include "util/stack_util.h"
 
+#include <cxxabi.h>
+#include <execinfo.h>
+
+#include <cstdlib>
+
 namespace google::glog_internal_namespace_ {
 void DumpStackTraceToString(std::string* stacktrace);
 } // namespace google::glog_internal_namespace_
@@ -29,4 +34,31 @@ std::string get_stack_trace() {
     return s;
 }
 
+// "binary(mangled+0x1a) [0x4f2a10]" to "demangled+0x1a [0x4f2a10]".
+static std::string demangle_symbol(const char* symbol) {
+    std::string s(symbol);
+    size_t begin = s.find('(');
+    size_t plus = s.find('+', begin);
+    if (begin == std::string::npos || plus == std::string::npos || plus == begin + 1) {
+        return s;
+    }
+    std::string mangled = s.substr(begin + 1, plus - begin - 1);
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(mangled.c_str(), nullptr, nullptr, &status);
+    if (status != 0 || demangled == nullptr) {
+        return s;
+    }
+    std::string result = demangled + s.substr(plus);
+    free(demangled);
+    return result;
+}
+
+void write_symbolized_stack(std::ostream& os, void* const* frames, int depth, const std::string& indent) {
+    char** symbols = backtrace_symbols(frames, depth);
+    for (int i = 0; i < depth; i++) {
+        os << indent << (symbols != nullptr ? demangle_symbol(symbols[i]) : "?") << "\n";
+    }
+    free(symbols);
+}
+
 } // namespace starrocks
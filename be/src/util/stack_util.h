@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <ostream>
 #include <string>
 
 namespace starrocks {
@@ -26,4 +27,8 @@ namespace starrocks {
 // for recursive calls.
 std::string get_stack_trace();
 
+// Write the symbols of the return addresses |frames| captured by backtrace(), demangled if possible, one per line
+// prefixed by |indent|.
+void write_symbolized_stack(std::ostream& os, void* const* frames, int depth, const std::string& indent);
+
 } // namespace starrocks
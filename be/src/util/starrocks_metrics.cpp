@@ -42,9 +42,17 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
     REGISTER_STARROCKS_METRIC(http_request_send_bytes);
     REGISTER_STARROCKS_METRIC(query_scan_bytes);
     REGISTER_STARROCKS_METRIC(query_scan_rows);
+    REGISTER_STARROCKS_METRIC(spill_write_bytes_total);
+    REGISTER_STARROCKS_METRIC(spill_write_duration_us);
+    REGISTER_STARROCKS_METRIC(spill_read_bytes_total);
+    REGISTER_STARROCKS_METRIC(spill_read_duration_us);
+    REGISTER_STARROCKS_METRIC(spill_disk_bytes);
 
     REGISTER_STARROCKS_METRIC(memtable_flush_total);
     REGISTER_STARROCKS_METRIC(memtable_flush_duration_us);
+    REGISTER_STARROCKS_METRIC(memtable_flush_ahead_total);
+    REGISTER_STARROCKS_METRIC(memtable_flush_stall_total);
+    REGISTER_STARROCKS_METRIC(memtable_flush_stall_duration_us);
 
     REGISTER_STARROCKS_METRIC(update_rowset_commit_request_total);
     REGISTER_STARROCKS_METRIC(update_rowset_commit_request_failed);
@@ -137,6 +145,24 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
     _metrics.register_metric("segment_read", MetricLabels().add("type", "segment_rows_read_by_zone_map"),
                              &segment_rows_read_by_zone_map);
 
+    _metrics.register_metric("page_cache_lookup_total", MetricLabels().add("tier", "decompressed"),
+                             &page_cache_lookup_total);
+    _metrics.register_metric("page_cache_hit_total", MetricLabels().add("tier", "decompressed"),
+                             &page_cache_hit_total);
+    _metrics.register_metric("page_cache_capacity", MetricLabels().add("tier", "decompressed"),
+                             &page_cache_capacity);
+    _metrics.register_metric("page_cache_lookup_total", MetricLabels().add("tier", "compressed"),
+                             &compressed_page_cache_lookup_total);
+    _metrics.register_metric("page_cache_hit_total", MetricLabels().add("tier", "compressed"),
+                             &compressed_page_cache_hit_total);
+    _metrics.register_metric("page_cache_capacity", MetricLabels().add("tier", "compressed"),
+                             &compressed_page_cache_capacity);
+
+    REGISTER_STARROCKS_METRIC(block_cache_lookup_total);
+    _metrics.register_metric("block_cache_hit_total", MetricLabels().add("tier", "memory"),
+                             &block_cache_mem_hit_total);
+    _metrics.register_metric("block_cache_hit_total", MetricLabels().add("tier", "disk"), &block_cache_disk_hit_total);
+
     _metrics.register_metric("txn_request", MetricLabels().add("type", "begin"), &txn_begin_request_total);
     _metrics.register_metric("txn_request", MetricLabels().add("type", "commit"), &txn_commit_request_total);
     _metrics.register_metric("txn_request", MetricLabels().add("type", "rollback"), &txn_rollback_request_total);
@@ -160,6 +186,7 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
 
     REGISTER_STARROCKS_METRIC(push_request_write_bytes_per_second);
     REGISTER_STARROCKS_METRIC(query_scan_bytes_per_second);
+    REGISTER_STARROCKS_METRIC(spill_read_bytes_per_second);
     REGISTER_STARROCKS_METRIC(max_disk_io_util_percent);
     REGISTER_STARROCKS_METRIC(max_network_send_bytes_rate);
     REGISTER_STARROCKS_METRIC(max_network_receive_bytes_rate);
@@ -63,6 +63,11 @@ public:
     METRIC_DEFINE_INT_COUNTER(http_request_send_bytes, MetricUnit::BYTES);
     METRIC_DEFINE_INT_COUNTER(query_scan_bytes, MetricUnit::BYTES);
     METRIC_DEFINE_INT_COUNTER(query_scan_rows, MetricUnit::ROWS);
+    METRIC_DEFINE_INT_COUNTER(spill_write_bytes_total, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_COUNTER(spill_write_duration_us, MetricUnit::MICROSECONDS);
+    METRIC_DEFINE_INT_COUNTER(spill_read_bytes_total, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_COUNTER(spill_read_duration_us, MetricUnit::MICROSECONDS);
+    METRIC_DEFINE_INT_GAUGE(spill_disk_bytes, MetricUnit::BYTES);
     METRIC_DEFINE_INT_COUNTER(push_requests_success_total, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(push_requests_fail_total, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(push_request_duration_us, MetricUnit::MICROSECONDS);
@@ -132,6 +137,19 @@ public:
     // total number of rows selected by zone map index
     METRIC_DEFINE_INT_COUNTER(segment_rows_read_by_zone_map, MetricUnit::ROWS);
 
+    // Counters of the tiers of page cache
+    METRIC_DEFINE_INT_COUNTER(page_cache_lookup_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(page_cache_hit_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(compressed_page_cache_lookup_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(compressed_page_cache_hit_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_GAUGE(page_cache_capacity, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_GAUGE(compressed_page_cache_capacity, MetricUnit::BYTES);
+
+    // Counters of the tiers of block cache
+    METRIC_DEFINE_INT_COUNTER(block_cache_lookup_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(block_cache_mem_hit_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(block_cache_disk_hit_total, MetricUnit::OPERATIONS);
+
     METRIC_DEFINE_INT_COUNTER(txn_begin_request_total, MetricUnit::OPERATIONS);
     METRIC_DEFINE_INT_COUNTER(txn_commit_request_total, MetricUnit::OPERATIONS);
     METRIC_DEFINE_INT_COUNTER(txn_rollback_request_total, MetricUnit::OPERATIONS);
@@ -147,6 +165,9 @@ public:
 
     METRIC_DEFINE_INT_COUNTER(memtable_flush_total, MetricUnit::OPERATIONS);
     METRIC_DEFINE_INT_COUNTER(memtable_flush_duration_us, MetricUnit::MICROSECONDS);
+    METRIC_DEFINE_INT_COUNTER(memtable_flush_ahead_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(memtable_flush_stall_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(memtable_flush_stall_duration_us, MetricUnit::MICROSECONDS);
 
     METRIC_DEFINE_INT_COUNTER(update_rowset_commit_request_total, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(update_rowset_commit_request_failed, MetricUnit::REQUESTS);
@@ -182,6 +203,7 @@ public:
     // by metric calculator
     METRIC_DEFINE_INT_GAUGE(push_request_write_bytes_per_second, MetricUnit::BYTES);
     METRIC_DEFINE_INT_GAUGE(query_scan_bytes_per_second, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_GAUGE(spill_read_bytes_per_second, MetricUnit::BYTES);
     METRIC_DEFINE_INT_GAUGE(max_disk_io_util_percent, MetricUnit::PERCENT);
     METRIC_DEFINE_INT_GAUGE(max_network_send_bytes_rate, MetricUnit::BYTES);
     METRIC_DEFINE_INT_GAUGE(max_network_receive_bytes_rate, MetricUnit::BYTES);
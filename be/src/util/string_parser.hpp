@@ -198,6 +198,13 @@ private:
     template <typename T>
     static inline T string_to_float_internal(const char* s, int len, ParseResult* result);
 
+    // Parses the plain decimals with at most 15 digits, e.g. -123.45, which are the most of the
+    // real data. The digits fit in the mantissa of a double and their scale is an exact power
+    // of 10, so one division gives the correctly rounded value (Clinger's fast path).
+    // Return false without setting |value| for any other string.
+    template <typename T>
+    static inline bool string_to_float_fast_path(const char* s, int len, T* value);
+
     // parses a string for 'true' or 'false', case insensitive
     // Return PARSE_FAILURE on leading whitespace. Trailing whitespace is allowed.
     static inline bool string_to_bool_internal(const char* s, int len, ParseResult* result);
@@ -423,6 +430,39 @@ inline T StringParser::string_to_int_no_overflow(const char* s, int len, ParseRe
     return val;
 }
 
+template <typename T>
+inline bool StringParser::string_to_float_fast_path(const char* s, int len, T* value) {
+    static constexpr double kPowersOf10[] = {1e0, 1e1, 1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                             1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15};
+    int i = 0;
+    bool negative = false;
+    if (len > 0 && (s[0] == '-' || s[0] == '+')) {
+        negative = (s[0] == '-');
+        i = 1;
+    }
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int fraction_digits = 0;
+    bool decimal = false;
+    for (; i < len; ++i) {
+        if (LIKELY(s[i] >= '0' && s[i] <= '9')) {
+            mantissa = mantissa * 10 + (s[i] - '0');
+            ++digits;
+            fraction_digits += decimal;
+        } else if (s[i] == '.' && !decimal) {
+            decimal = true;
+        } else {
+            return false;
+        }
+    }
+    if (digits == 0 || digits > 15) {
+        return false;
+    }
+    double val = static_cast<double>(mantissa) / kPowersOf10[fraction_digits];
+    *value = static_cast<T>(negative ? -val : val);
+    return true;
+}
+
 template <typename T>
 inline T StringParser::string_to_float_internal(const char* s, int len, ParseResult* result) {
     if (UNLIKELY(len <= 0)) {
@@ -430,6 +470,12 @@ inline T StringParser::string_to_float_internal(const char* s, int len, ParseRes
         return 0;
     }
 
+    T fast_value;
+    if (LIKELY(string_to_float_fast_path<T>(s, len, &fast_value))) {
+        *result = PARSE_SUCCESS;
+        return fast_value;
+    }
+
     // Use double here to not lose precision while accumulating the result
     double val = 0;
     bool negative = false;
@@ -212,6 +212,8 @@ public:
         return _total_queued_tasks;
     }
 
+    int max_threads() const { return _max_threads; }
+
 private:
     friend class ThreadPoolBuilder;
     friend class ThreadPoolToken;
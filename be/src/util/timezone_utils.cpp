@@ -23,6 +23,7 @@
 #include "util/timezone_utils.h"
 
 #include <charconv>
+#include <limits>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -175,4 +176,60 @@ int64_t TimezoneUtils::to_utc_offset(const cctz::time_zone& ctz) {
     return a.cs - b.cs;
 }
 
+static const cctz::time_point<cctz::seconds> kUnixEpoch =
+        std::chrono::time_point_cast<cctz::seconds>(std::chrono::system_clock::from_time_t(0));
+
+// The offsets of two adjacent segments differ by less than this, so the local seconds farther than it from
+// the transitions of a segment are not shared with the neighbouring segments.
+static constexpr int64_t kMaxOffsetChange = 2 * 86400;
+
+static int64_t transition_second(const cctz::time_zone& ctz, const cctz::time_zone::civil_transition& trans) {
+    const cctz::time_zone::civil_lookup lookup = ctz.lookup(trans.to);
+    const auto tp = lookup.kind == cctz::time_zone::civil_lookup::UNIQUE ? lookup.pre : lookup.trans;
+    return (tp - kUnixEpoch).count();
+}
+
+// Find the segment [*begin, *end) of unix seconds containing |utc| between two transitions of |ctz|,
+// and return its offset.
+static int64_t find_segment(const cctz::time_zone& ctz, int64_t utc, int64_t* begin, int64_t* end) {
+    const auto tp = kUnixEpoch + cctz::seconds(utc);
+    cctz::time_zone::civil_transition trans;
+    *begin = std::numeric_limits<int64_t>::min();
+    *end = std::numeric_limits<int64_t>::max();
+    if (ctz.prev_transition(tp + cctz::seconds(1), &trans)) {
+        *begin = transition_second(ctz, trans);
+    }
+    if (ctz.next_transition(tp, &trans)) {
+        *end = transition_second(ctz, trans);
+    }
+    if (*begin > utc || *end <= utc) {
+        *begin = utc;
+        *end = utc + 1;
+    }
+    return ctz.lookup(tp).offset;
+}
+
+int64_t TimezoneOffsetCache::utc_to_local(int64_t utc) {
+    if (utc < _utc_begin || utc >= _utc_end) {
+        _utc_offset = find_segment(_ctz, utc, &_utc_begin, &_utc_end);
+    }
+    return utc + _utc_offset;
+}
+
+int64_t TimezoneOffsetCache::local_to_utc(int64_t local) {
+    if (local >= _local_begin && local < _local_end) {
+        return local - _local_offset;
+    }
+    const auto tp = cctz::convert(cctz::civil_second(1970, 1, 1, 0, 0, 0) + local, _ctz);
+    int64_t utc = (tp - kUnixEpoch).count();
+
+    int64_t begin;
+    int64_t end;
+    int64_t offset = find_segment(_ctz, utc, &begin, &end);
+    _local_offset = offset;
+    _local_begin = begin == std::numeric_limits<int64_t>::min() ? begin : begin + offset + kMaxOffsetChange;
+    _local_end = end == std::numeric_limits<int64_t>::max() ? end : end + offset - kMaxOffsetChange;
+    return utc;
+}
+
 } // namespace starrocks
@@ -48,4 +48,33 @@ private:
     // RE2 obj is thread safe
     static RE2 time_zone_offset_format_reg;
 };
+
+// TimezoneOffsetCache converts seconds between the UTC and a time zone, remembering the offset of the
+// segment between two transitions of the zone it looked up last. The values of a chunk mostly fall in
+// the same few segments, so most of them are converted by an addition instead of a cctz lookup.
+class TimezoneOffsetCache {
+public:
+    explicit TimezoneOffsetCache(const cctz::time_zone& ctz) : _ctz(ctz) {}
+
+    // Return the local seconds of the unix seconds |utc|.
+    int64_t utc_to_local(int64_t utc);
+
+    // Return the unix seconds of the local seconds |local|, a local time skipped or repeated by a
+    // transition is resolved the same as cctz::convert.
+    int64_t local_to_utc(int64_t local);
+
+private:
+    const cctz::time_zone _ctz;
+
+    // The unix seconds in [_utc_begin, _utc_end) have the offset _utc_offset.
+    int64_t _utc_begin = 0;
+    int64_t _utc_end = 0;
+    int64_t _utc_offset = 0;
+
+    // The local seconds in [_local_begin, _local_end) are mapped to a unique unix second by _local_offset.
+    int64_t _local_begin = 0;
+    int64_t _local_end = 0;
+    int64_t _local_offset = 0;
+};
+
 } // namespace starrocks
@@ -269,4 +269,35 @@ TEST_F(ChunkTest, test_clone_unique) {
     ASSERT_EQ(copy->num_rows(), chunk->num_rows());
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunkTest, test_clone_shallow) {
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(make_column(0), 0);
+    chunk->append_column(make_column(20), 1);
+
+    auto copy = chunk->clone_shallow();
+    ASSERT_EQ(chunk->get_column_by_slot_id(0).get(), copy->get_column_by_slot_id(0).get());
+    ASSERT_EQ(chunk->get_column_by_slot_id(1).get(), copy->get_column_by_slot_id(1).get());
+
+    // The mutation of one chunk copies the shared columns.
+    Buffer<uint8_t> selection(100, 0);
+    selection[10] = 1;
+    ASSERT_EQ(1, copy->filter(selection));
+    ASSERT_EQ(100, chunk->num_rows());
+    check_column(down_cast<const FixedLengthColumn<int32_t>*>(chunk->get_column_by_slot_id(0).get()), 0);
+    check_column(down_cast<const FixedLengthColumn<int32_t>*>(chunk->get_column_by_slot_id(1).get()), 20);
+    ASSERT_EQ(30, down_cast<const FixedLengthColumn<int32_t>*>(copy->get_column_by_slot_id(1).get())->get_data()[0]);
+
+    // The columns of the other chunk are no longer shared, so they are mutated in place.
+    const Column* column = chunk->get_column_by_slot_id(0).get();
+    chunk->append(*chunk->clone_unique(), 0, 10);
+    ASSERT_EQ(110, chunk->num_rows());
+    ASSERT_EQ(column, chunk->get_column_by_slot_id(0).get());
+    ASSERT_EQ(1, copy->num_rows());
+
+    chunk->reset();
+    ASSERT_EQ(0, chunk->num_rows());
+    ASSERT_EQ(1, copy->num_rows());
+}
+
 } // namespace starrocks::vectorized
@@ -295,6 +295,35 @@ PARALLEL_TEST(NullableColumnTest, test_xor_checksum) {
     ASSERT_EQ(checksum, expected_checksum);
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(NullableColumnTest, test_hash_null_runs) {
+    auto c0 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    for (int i = 0; i < 100; i++) {
+        // runs of 1 to 7 nulls and not nulls
+        if ((i / 7) % 2 == 0 || i % 5 == 0) {
+            c0->append_datum({});
+        } else {
+            c0->append_datum((int32_t)i);
+        }
+    }
+
+    // Hashing a range at once is the same as hashing its rows one by one.
+    for (auto [from, to] : std::vector<std::pair<uint32_t, uint32_t>>{{0, 100}, {3, 17}, {20, 21}, {50, 99}}) {
+        std::vector<uint32_t> fnv_hashes(100, 1);
+        std::vector<uint32_t> crc32_hashes(100, 1);
+        c0->fnv_hash(fnv_hashes.data(), from, to);
+        c0->crc32_hash(crc32_hashes.data(), from, to);
+        std::vector<uint32_t> expected_fnv_hashes(100, 1);
+        std::vector<uint32_t> expected_crc32_hashes(100, 1);
+        for (uint32_t i = from; i < to; i++) {
+            c0->fnv_hash(expected_fnv_hashes.data(), i, i + 1);
+            c0->crc32_hash(expected_crc32_hashes.data(), i, i + 1);
+        }
+        ASSERT_EQ(expected_fnv_hashes, fnv_hashes);
+        ASSERT_EQ(expected_crc32_hashes, crc32_hashes);
+    }
+}
+
 PARALLEL_TEST(NullableColumnTest, test_compare_row) {
     auto c0 = NullableColumn::create(Int32Column::create(), NullColumn::create());
     c0->append_datum({});
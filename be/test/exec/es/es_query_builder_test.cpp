@@ -29,6 +29,8 @@
 #include "column/column_helper.h"
 #include "common/logging.h"
 #include "exec/es/es_predicate.h"
+#include "exec/es/es_scan_reader.h"
+#include "exec/es/es_scroll_query.h"
 #include "rapidjson/document.h"
 #include "rapidjson/rapidjson.h"
 #include "rapidjson/stringbuffer.h"
@@ -657,4 +659,23 @@ TEST_F(BooleanQueryBuilderTest, validate_compound_and) {
             "{\"fv\":[\"8.0\",\"16.0\"]}}]}}]}}]}},{\"wildcard\":{\"content\":\"a*e*g?\"}}]}}]}}";
     ASSERT_STREQ(expected_json.c_str(), actual_bool_json.c_str());
 }
+
+TEST_F(BooleanQueryBuilderTest, sliced_scroll) {
+    std::map<std::string, std::string> properties = {{ESScanReader::KEY_BATCH_SIZE, "100"},
+                                                     {ESScanReader::KEY_SLICE_ID, "1"},
+                                                     {ESScanReader::KEY_MAX_SLICES, "4"}};
+    std::vector<std::string> fields = {"k"};
+    std::vector<EsPredicate*> predicates;
+    std::map<std::string, std::string> docvalue_context = {{"k", "k"}};
+    bool doc_value_mode = false;
+    std::string query_dsl =
+            ESScrollQueryBuilder::build(properties, fields, predicates, docvalue_context, &doc_value_mode);
+    ASSERT_TRUE(doc_value_mode);
+    ASSERT_NE(std::string::npos, query_dsl.find("\"size\":100,\"slice\":{\"id\":1,\"max\":4}"));
+
+    // a search terminated after the limit is not sliced.
+    properties[ESScanReader::KEY_TERMINATE_AFTER] = "10";
+    query_dsl = ESScrollQueryBuilder::build(properties, fields, predicates, docvalue_context, &doc_value_mode);
+    ASSERT_EQ(std::string::npos, query_dsl.find("slice"));
+}
 } // namespace starrocks
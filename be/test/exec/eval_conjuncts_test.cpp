@@ -0,0 +1,115 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "exec/adaptive_conjuncts_order.h"
+#include "exec/exec_node.h"
+#include "exprs/expr_context.h"
+#include "exprs/vectorized/binary_predicate.h"
+#include "exprs/vectorized/column_ref.h"
+#include "simd/simd.h"
+#include "testutil/assert.h"
+
+namespace starrocks::vectorized {
+
+class EvalConjunctsTest : public ::testing::Test {
+protected:
+    // A conjunct `slot < bound_slot`.
+    ExprContext* new_less(SlotId slot, SlotId bound_slot) {
+        TExprNode node;
+        node.node_type = TExprNodeType::BINARY_PRED;
+        node.opcode = TExprOpcode::LT;
+        node.__isset.opcode = true;
+        node.child_type = TPrimitiveType::INT;
+        node.__isset.child_type = true;
+        node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+        node.num_children = 2;
+        Expr* expr = _pool.add(VectorizedBinaryPredicateFactory::from_thrift(node));
+        expr->add_child(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), slot)));
+        expr->add_child(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), bound_slot)));
+        return _pool.add(new ExprContext(expr));
+    }
+
+    // The slot 1 is 0..99, the slot 2 is 99..0, the slot 3 is const 10, the slot 4 is const 95 and the
+    // slots 5 and 6 are not referenced.
+    ChunkPtr new_chunk() {
+        auto chunk = std::make_shared<Chunk>();
+        auto c1 = Int32Column::create();
+        auto c2 = Int32Column::create();
+        for (int32_t i = 0; i < kNumRows; i++) {
+            c1->append(i);
+            c2->append(kNumRows - 1 - i);
+        }
+        chunk->append_column(c1, 1);
+        chunk->append_column(c2, 2);
+        chunk->append_column(ColumnHelper::create_const_column<TYPE_INT>(10, kNumRows), 3);
+        chunk->append_column(ColumnHelper::create_const_column<TYPE_INT>(95, kNumRows), 4);
+        chunk->append_column(c1->clone_shared(), 5);
+        chunk->append_column(c2->clone_shared(), 6);
+        return chunk;
+    }
+
+    static constexpr int32_t kNumRows = 100;
+    ObjectPool _pool;
+};
+
+// NOLINTNEXTLINE
+TEST_F(EvalConjunctsTest, test_eval_on_selected_rows) {
+    // slot1 < 10 and 95 > slot2, i.e. slot1 in [0, 10) and slot1 in [5, 100)
+    std::vector<ExprContext*> ctxs{new_less(1, 3), new_less(4, 2)};
+    for (double ratio : {0.0, 0.2}) {
+        config::conjunct_selected_eval_ratio = ratio;
+        auto chunk = new_chunk();
+        FilterPtr filter;
+        ASSERT_OK(ExecNode::eval_conjuncts(ctxs, chunk.get(), &filter));
+        ASSERT_EQ(kNumRows, filter->size());
+        ASSERT_EQ(5, chunk->num_rows());
+        for (int32_t i = 0; i < 5; i++) {
+            ASSERT_EQ(i + 5, chunk->get_column_by_slot_id(1)->get(i).get_int32());
+            ASSERT_EQ(i + 5, chunk->get_column_by_slot_id(5)->get(i).get_int32());
+        }
+        for (int32_t i = 0; i < kNumRows; i++) {
+            ASSERT_EQ(i >= 5 && i < 10, (*filter)[i]) << i;
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(EvalConjunctsTest, test_adaptive_order) {
+    // slot1 < 95 passes 95 rows and slot1 < 10 passes 10 rows, so the latter is evaluated first after the first
+    // sampled chunk.
+    ExprContext* less_95 = new_less(1, 4);
+    ExprContext* less_10 = new_less(1, 3);
+    std::vector<ExprContext*> ctxs{less_95, less_10};
+    int32_t old_interval = config::adaptive_conjuncts_order_sample_interval;
+    config::adaptive_conjuncts_order_sample_interval = 4;
+    AdaptiveConjunctsOrder order;
+    for (int i = 0; i < 8; i++) {
+        auto chunk = new_chunk();
+        FilterPtr filter;
+        ASSERT_OK(order.eval_conjuncts(&ctxs, chunk.get(), &filter));
+        ASSERT_EQ(10, chunk->num_rows());
+        ASSERT_EQ(10, SIMD::count_nonzero(*filter));
+        for (int32_t j = 0; j < 10; j++) {
+            ASSERT_EQ(j, chunk->get_column_by_slot_id(5)->get(j).get_int32());
+        }
+        ASSERT_EQ(less_10, ctxs[0]);
+        ASSERT_EQ(less_95, ctxs[1]);
+    }
+
+    // not reordered if disabled
+    config::adaptive_conjuncts_order_sample_interval = 0;
+    std::vector<ExprContext*> plan_order{less_95, less_10};
+    AdaptiveConjunctsOrder disabled_order;
+    auto chunk = new_chunk();
+    ASSERT_OK(disabled_order.eval_conjuncts(&plan_order, chunk.get()));
+    ASSERT_EQ(10, chunk->num_rows());
+    ASSERT_EQ(less_95, plan_order[0]);
+    config::adaptive_conjuncts_order_sample_interval = old_interval;
+}
+
+} // namespace starrocks::vectorized
@@ -0,0 +1,53 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/pipeline/exchange/exchange_compression_selector.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "testutil/assert.h"
+#include "util/compression/block_compression.h"
+
+namespace starrocks::pipeline {
+
+TEST(ExchangeCompressionSelectorTest, LocalDestination) {
+    ExchangeCompressionSelector selector(true, [] { return 0; });
+    ASSERT_OK(selector.init());
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQ(nullptr, selector.next_codec());
+    }
+}
+
+TEST(ExchangeCompressionSelectorTest, CodecByNetworkThroughput) {
+    int64_t throughput = 0;
+    ExchangeCompressionSelector selector(false, [&throughput] { return throughput; });
+    ASSERT_OK(selector.init());
+
+    // Unknown throughput.
+    ASSERT_EQ(CompressionTypePB::LZ4, selector.next_codec()->type());
+
+    throughput = config::exchange_adaptive_compression_zstd_max_throughput / 2;
+    ASSERT_EQ(CompressionTypePB::ZSTD, selector.next_codec()->type());
+
+    throughput = config::exchange_adaptive_compression_zstd_max_throughput * 2;
+    ASSERT_EQ(CompressionTypePB::LZ4, selector.next_codec()->type());
+}
+
+TEST(ExchangeCompressionSelectorTest, SkipIncompressibleData) {
+    ExchangeCompressionSelector selector(false, [] { return 0; });
+    ASSERT_OK(selector.init());
+
+    ASSERT_NE(nullptr, selector.next_codec());
+    selector.update(1000, 500);
+    ASSERT_NE(nullptr, selector.next_codec());
+
+    // The data doesn't shrink.
+    selector.update(1000, 1000);
+    for (int64_t i = 0; i < config::exchange_adaptive_compression_retry_chunks; i++) {
+        ASSERT_EQ(nullptr, selector.next_codec());
+    }
+    // Retry the compression.
+    ASSERT_NE(nullptr, selector.next_codec());
+}
+
+} // namespace starrocks::pipeline
@@ -3,8 +3,10 @@
 #include <chrono>
 #include <random>
 
+#include "common/config.h"
 #include "exec/pipeline/query_context.h"
 #include "gtest/gtest.h"
+#include "runtime/descriptors.h"
 
 namespace starrocks {
 namespace pipeline {
@@ -206,5 +208,43 @@ TEST(QueryContextManagerTest, testMulitiThreadOperations) {
     query_ctx_mgr->remove(query_id);
     ASSERT_TRUE(query_ctx_mgr->get(query_id) == nullptr);
 }
+
+TEST(QueryContextManagerTest, testDescTblCache) {
+    auto query_ctx_mgr = std::make_shared<QueryContextManager>(6);
+    auto make_desc_tbl = [](int64_t fingerprint) {
+        TDescriptorTable t_desc_tbl;
+        TTupleDescriptor t_tuple_desc;
+        t_tuple_desc.id = 0;
+        t_tuple_desc.byteSize = 0;
+        t_tuple_desc.numNullBytes = 0;
+        t_desc_tbl.tupleDescriptors.emplace_back(t_tuple_desc);
+        if (fingerprint != 0) {
+            t_desc_tbl.__set_fingerprint(fingerprint);
+        }
+        return t_desc_tbl;
+    };
+
+    // No fingerprint, no cache.
+    auto res = query_ctx_mgr->get_desc_tbl(make_desc_tbl(0), 4096);
+    ASSERT_TRUE(res.ok());
+    ASSERT_EQ(nullptr, res.value());
+
+    auto first = query_ctx_mgr->get_desc_tbl(make_desc_tbl(1), 4096).value();
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, first->desc_tbl->get_tuple_descriptor(0));
+    ASSERT_EQ(first, query_ctx_mgr->get_desc_tbl(make_desc_tbl(1), 4096).value());
+    ASSERT_NE(first, query_ctx_mgr->get_desc_tbl(make_desc_tbl(1), 1024).value());
+    ASSERT_EQ(first, query_ctx_mgr->get_desc_tbl(make_desc_tbl(1), 4096).value());
+
+    // The least recently used table is evicted.
+    int64_t old_capacity = config::pipeline_desc_tbl_cache_capacity;
+    config::pipeline_desc_tbl_cache_capacity = 2;
+    auto second = query_ctx_mgr->get_desc_tbl(make_desc_tbl(2), 4096).value();
+    ASSERT_EQ(first, query_ctx_mgr->get_desc_tbl(make_desc_tbl(1), 4096).value());
+    query_ctx_mgr->get_desc_tbl(make_desc_tbl(3), 4096).value();
+    ASSERT_EQ(first, query_ctx_mgr->get_desc_tbl(make_desc_tbl(1), 4096).value());
+    ASSERT_NE(second, query_ctx_mgr->get_desc_tbl(make_desc_tbl(2), 4096).value());
+    config::pipeline_desc_tbl_cache_capacity = old_capacity;
+}
 } // namespace pipeline
 } // namespace starrocks
@@ -0,0 +1,67 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/pipeline/scan/scan_result_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+
+namespace starrocks::pipeline {
+
+static ScanResultCacheEntryPtr make_entry(int64_t version, int32_t value, size_t bytes) {
+    auto column = vectorized::Int32Column::create();
+    column->append(value);
+    auto chunk = std::make_shared<vectorized::Chunk>();
+    chunk->append_column(std::move(column), 1);
+
+    auto entry = std::make_shared<ScanResultCacheEntry>();
+    entry->version = version;
+    entry->chunks.emplace_back(std::move(chunk));
+    entry->bytes = bytes;
+    return entry;
+}
+
+static int32_t entry_value(const ScanResultCacheEntryPtr& entry) {
+    return entry->chunks[0]->get_column_by_slot_id(1)->get(0).get_int32();
+}
+
+TEST(ScanResultCacheTest, lookup_and_insert) {
+    ScanResultCache cache(1 << 20);
+    ASSERT_EQ(nullptr, cache.lookup("digest1", 10));
+
+    cache.insert("digest1", 10, make_entry(2, 100, 100));
+    cache.insert("digest1", 11, make_entry(3, 101, 100));
+    cache.insert("digest2", 10, make_entry(4, 102, 100));
+
+    auto entry = cache.lookup("digest1", 10);
+    ASSERT_NE(nullptr, entry);
+    ASSERT_EQ(2, entry->version);
+    ASSERT_EQ(100, entry_value(entry));
+    ASSERT_EQ(101, entry_value(cache.lookup("digest1", 11)));
+    ASSERT_EQ(102, entry_value(cache.lookup("digest2", 10)));
+    ASSERT_EQ(nullptr, cache.lookup("digest2", 11));
+
+    // A later version replaces the entry, which stays valid for the holder of the former one.
+    cache.insert("digest1", 10, make_entry(5, 103, 100));
+    ASSERT_EQ(5, cache.lookup("digest1", 10)->version);
+    ASSERT_EQ(100, entry_value(entry));
+}
+
+TEST(ScanResultCacheTest, evict) {
+    const size_t capacity = 32 * 1000;
+    ScanResultCache cache(capacity);
+    const int64_t num_tablets = 200;
+    for (int64_t tablet_id = 0; tablet_id < num_tablets; ++tablet_id) {
+        cache.insert("digest", tablet_id, make_entry(1, static_cast<int32_t>(tablet_id), 500));
+    }
+    ASSERT_LE(cache.memory_usage(), capacity);
+    ASSERT_NE(nullptr, cache.lookup("digest", num_tablets - 1));
+    int64_t num_cached = 0;
+    for (int64_t tablet_id = 0; tablet_id < num_tablets; ++tablet_id) {
+        num_cached += cache.lookup("digest", tablet_id) != nullptr;
+    }
+    ASSERT_LE(num_cached * 500, capacity);
+}
+
+} // namespace starrocks::pipeline
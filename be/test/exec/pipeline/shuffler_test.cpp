@@ -0,0 +1,87 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/pipeline/exchange/shuffler.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace starrocks::pipeline {
+
+static std::vector<uint32_t> random_hash_values(size_t num_rows) {
+    std::mt19937 rng(0);
+    std::vector<uint32_t> hash_values(num_rows);
+    for (auto& hash : hash_values) {
+        hash = rng();
+    }
+    hash_values[0] = 0;
+    hash_values[1] = UINT32_MAX;
+    return hash_values;
+}
+
+TEST(ShufflerTest, FastModulo) {
+    for (uint32_t r : {1u, 2u, 3u, 7u, 48u, 1000u, 65537u, UINT32_MAX}) {
+        FastModuloOp op(r);
+        for (uint32_t l : random_hash_values(4096)) {
+            ASSERT_EQ(l % r, op(l));
+        }
+    }
+}
+
+TEST(ShufflerTest, ExchangeShuffle) {
+    const size_t num_rows = 4096;
+    const size_t num_channels = 7;
+    const int32_t num_shuffles_per_channel = 3;
+    auto hash_values = random_hash_values(num_rows);
+    std::vector<uint32_t> shuffle_ids(num_rows);
+
+    // Compatible mode uses modulo.
+    Shuffler modulo_shuffler(true, true, TPartitionType::HASH_PARTITIONED, num_channels, num_shuffles_per_channel);
+    modulo_shuffler.exchange_shuffle(shuffle_ids, hash_values, num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        uint32_t expected = hash_values[i] % num_channels * num_shuffles_per_channel +
+                            HashUtil::xorshift32(hash_values[i]) % num_shuffles_per_channel;
+        ASSERT_EQ(expected, shuffle_ids[i]);
+    }
+
+    Shuffler reduce_shuffler(false, false, TPartitionType::HASH_PARTITIONED, num_channels, 1);
+    reduce_shuffler.exchange_shuffle(shuffle_ids, hash_values, num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        ASSERT_EQ(ReduceOp()(hash_values[i], num_channels), shuffle_ids[i]);
+    }
+
+    reduce_shuffler.local_exchange_shuffle(shuffle_ids, hash_values, num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        ASSERT_EQ(ReduceOp()(HashUtil::xorshift32(hash_values[i]), num_channels), shuffle_ids[i]);
+    }
+}
+
+TEST(ShufflerTest, BuildRowIndexes) {
+    const size_t num_rows = 1000;
+    const size_t num_shuffles = 5;
+    std::vector<uint32_t> shuffle_ids(num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        // Leave the last shuffle empty.
+        shuffle_ids[i] = (i * i) % (num_shuffles - 1);
+    }
+
+    std::vector<uint32_t> start_points;
+    std::vector<uint32_t> row_indexes(num_rows);
+    Shuffler::build_row_indexes(shuffle_ids, num_rows, num_shuffles, start_points, row_indexes.data());
+
+    ASSERT_EQ(num_shuffles + 1, start_points.size());
+    ASSERT_EQ(0, start_points[0]);
+    ASSERT_EQ(num_rows, start_points[num_shuffles]);
+    ASSERT_EQ(start_points[num_shuffles - 1], start_points[num_shuffles]);
+    for (size_t shuffle = 0; shuffle < num_shuffles; shuffle++) {
+        for (size_t i = start_points[shuffle]; i < start_points[shuffle + 1]; i++) {
+            ASSERT_EQ(shuffle, shuffle_ids[row_indexes[i]]);
+            // The rows of the same shuffle keep the original order.
+            if (i > start_points[shuffle]) {
+                ASSERT_LT(row_indexes[i - 1], row_indexes[i]);
+            }
+        }
+    }
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,162 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "exec/pipeline/pipeline_driver_queue.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/pipeline/source_operator.h"
+#include "testutil/assert.h"
+
+namespace starrocks::pipeline {
+
+class WorkStealingMockOperator final : public SourceOperator {
+public:
+    WorkStealingMockOperator() : SourceOperator(nullptr, 1, "mock_operator", 1, 0) {}
+
+    bool has_output() const override { return true; }
+    bool need_input() const override { return true; }
+    bool is_finished() const override { return true; }
+
+    StatusOr<vectorized::ChunkPtr> pull_chunk(RuntimeState* state) override { return nullptr; }
+    Status push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) override { return Status::OK(); }
+};
+
+class WorkStealingDriverQueueTest : public ::testing::Test {
+protected:
+    DriverPtr _create_driver(int level) {
+        Operators operators;
+        operators.emplace_back(std::make_shared<WorkStealingMockOperator>());
+        auto driver = std::make_shared<PipelineDriver>(operators, &_query_ctx, nullptr, -1);
+        driver->set_driver_queue_level(level);
+        return driver;
+    }
+
+    QueryContext _query_ctx;
+};
+
+TEST_F(WorkStealingDriverQueueTest, test_take_local_then_steal) {
+    WorkStealingDriverQueue queue(2);
+    auto driver1 = _create_driver(0);
+    auto driver2 = _create_driver(0);
+
+    // Both drivers are put back by worker 0, so they are in its local queue.
+    queue.bind_worker(0);
+    queue.put_back_from_executor(driver1.get());
+    queue.put_back_from_executor(driver2.get());
+    ASSERT_EQ(2, queue.size());
+
+    // Worker 1 has nothing in its local queue, and steals from worker 0.
+    queue.bind_worker(1);
+    ASSIGN_OR_ABORT(auto* driver, queue.take());
+    ASSERT_EQ(driver1.get(), driver);
+    ASSERT_FALSE(driver->is_in_ready_queue());
+
+    queue.bind_worker(0);
+    ASSIGN_OR_ABORT(driver, queue.take());
+    ASSERT_EQ(driver2.get(), driver);
+    ASSERT_EQ(0, queue.size());
+}
+
+TEST_F(WorkStealingDriverQueueTest, test_level_by_accumulated_time) {
+    WorkStealingDriverQueue queue(2);
+    auto driver0 = _create_driver(0);
+    auto driver1 = _create_driver(1);
+    // Level 0 has spent much more time than level 1, so level 1 is preferred by every worker.
+    driver0->driver_acct().update_last_time_spent(100'000'000L);
+    queue.update_statistics(driver0.get());
+
+    queue.bind_worker(0);
+    queue.put_back_from_executor(driver0.get());
+    queue.bind_worker(1);
+    queue.put_back_from_executor(driver1.get());
+
+    queue.bind_worker(0);
+    ASSIGN_OR_ABORT(auto* driver, queue.take());
+    ASSERT_EQ(driver0.get(), driver);
+    ASSIGN_OR_ABORT(driver, queue.take());
+    ASSERT_EQ(driver1.get(), driver);
+
+    queue.put_back_from_executor(driver0.get());
+    queue.put_back_from_executor(driver1.get());
+    ASSIGN_OR_ABORT(driver, queue.take());
+    ASSERT_EQ(driver1.get(), driver);
+}
+
+TEST_F(WorkStealingDriverQueueTest, test_cancel) {
+    WorkStealingDriverQueue queue(1);
+    auto driver1 = _create_driver(1);
+    auto driver2 = _create_driver(1);
+    queue.put_back(driver1.get());
+    queue.put_back(driver2.get());
+
+    // The cancelled driver is taken first.
+    queue.cancel(driver2.get());
+    ASSIGN_OR_ABORT(auto* driver, queue.take());
+    ASSERT_EQ(driver2.get(), driver);
+    ASSIGN_OR_ABORT(driver, queue.take());
+    ASSERT_EQ(driver1.get(), driver);
+    ASSERT_EQ(0, queue.size());
+}
+
+TEST_F(WorkStealingDriverQueueTest, test_take_block) {
+    WorkStealingDriverQueue queue(4);
+    auto driver1 = _create_driver(1);
+
+    std::thread consumer([&queue, &driver1] {
+        queue.bind_worker(3);
+        auto maybe_driver = queue.take();
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(driver1.get(), maybe_driver.value());
+    });
+
+    sleep(1);
+    queue.put_back(driver1.get());
+    consumer.join();
+}
+
+TEST_F(WorkStealingDriverQueueTest, test_take_close) {
+    WorkStealingDriverQueue queue(4);
+
+    std::thread consumer([&queue] {
+        auto maybe_driver = queue.take();
+        ASSERT_TRUE(maybe_driver.status().is_cancelled());
+    });
+
+    sleep(1);
+    queue.close();
+    consumer.join();
+}
+
+TEST_F(WorkStealingDriverQueueTest, test_steal_within_numa_node) {
+    // Local queues 0 and 2 are of node 0, and local queues 1 and 3 are of node 1.
+    WorkStealingDriverQueue queue(4, 2);
+    // Drivers without fragment context are placed on node 0.
+    auto driver1 = _create_driver(0);
+    auto driver2 = _create_driver(0);
+    queue.bind_worker(0);
+    queue.put_back_from_executor(driver1.get());
+    queue.put_back_from_executor(driver2.get());
+
+    // The worker of node 1 never takes the drivers of node 0.
+    std::thread other_node_worker([&queue] {
+        queue.bind_worker(1);
+        auto maybe_driver = queue.take();
+        ASSERT_TRUE(maybe_driver.status().is_cancelled());
+    });
+    sleep(1);
+    ASSERT_EQ(2, queue.size());
+
+    // The other worker of node 0 steals them.
+    queue.bind_worker(2);
+    ASSIGN_OR_ABORT(auto* driver, queue.take());
+    ASSERT_EQ(driver1.get(), driver);
+    ASSIGN_OR_ABORT(driver, queue.take());
+    ASSERT_EQ(driver2.get(), driver);
+
+    queue.close();
+    other_node_worker.join();
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,194 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/spill/partitioned_spiller.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <set>
+
+#include "column/binary_column.h"
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "exec/spill/spill_manager.h"
+#include "fs/fs_util.h"
+#include "runtime/runtime_state.h"
+#include "util/runtime_profile.h"
+#include "testutil/assert.h"
+
+namespace starrocks::spill {
+
+using namespace vectorized;
+
+class PartitionedSpillerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        _spill_dir = std::filesystem::current_path().string() + "/ut_dir/partitioned_spiller_test";
+        _old_spill_dir = config::spill_local_storage_dir;
+        config::spill_local_storage_dir = _spill_dir;
+
+        TQueryOptions query_options;
+        query_options.batch_size = 64;
+        _state = std::make_unique<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+    }
+
+    void TearDown() override {
+        config::spill_local_storage_dir = _old_spill_dir;
+        (void)fs::remove_all(_spill_dir);
+    }
+
+protected:
+    static ChunkPtr _create_chunk(int32_t begin, int32_t num_rows) {
+        auto keys = Int32Column::create();
+        auto values = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+        for (int32_t i = begin; i < begin + num_rows; i++) {
+            keys->append(i % 100);
+            if (i % 7 == 0) {
+                values->append_nulls(1);
+            } else {
+                std::string value = std::to_string(i);
+                values->append_datum(Datum(Slice(value)));
+            }
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(keys), 1);
+        chunk->append_column(std::move(values), 2);
+        return chunk;
+    }
+
+    std::string _spill_dir;
+    std::string _old_spill_dir;
+    std::unique_ptr<RuntimeState> _state;
+};
+
+TEST_F(PartitionedSpillerTest, test_spill_and_read_back) {
+    PartitionedSpiller spiller(_state.get(), "test", 4, 0);
+    std::vector<uint8_t> selection;
+    int64_t expected_rows = 0;
+    for (int32_t i = 0; i < 10; i++) {
+        auto chunk = _create_chunk(i * 50, 50);
+        selection.assign(chunk->num_rows(), 0);
+        for (size_t j = 0; j < selection.size(); j += 2) {
+            selection[j] = 1;
+            expected_rows++;
+        }
+        ASSERT_OK(spiller.spill(*chunk, {chunk->get_column_by_slot_id(1)}, selection.data()));
+    }
+    ASSERT_EQ(expected_rows, spiller.spilled_rows());
+
+    ASSIGN_OR_ABORT(auto partitions, spiller.finish());
+    ASSERT_EQ(4, partitions.size());
+    ASSERT_GT(spiller.spilled_bytes(), 0);
+
+    int64_t total_rows = 0;
+    std::set<int32_t> seen_keys;
+    for (auto& file : partitions) {
+        if (file == nullptr) {
+            continue;
+        }
+        std::set<int32_t> partition_keys;
+        while (true) {
+            ASSIGN_OR_ABORT(auto chunk, file->read_next());
+            if (chunk == nullptr) {
+                break;
+            }
+            ASSERT_LE(chunk->num_rows(), _state->chunk_size());
+            ASSERT_EQ(2, chunk->num_columns());
+            ASSERT_TRUE(chunk->get_column_by_slot_id(2)->is_nullable());
+            auto* keys = down_cast<Int32Column*>(chunk->get_column_by_slot_id(1).get());
+            for (auto key : keys->get_data()) {
+                // Only even rows are selected, and (i % 100) keeps the parity of i.
+                ASSERT_EQ(0, key % 2);
+                partition_keys.insert(key);
+            }
+            total_rows += chunk->num_rows();
+        }
+        // The same key never appears in two partitions.
+        for (auto key : partition_keys) {
+            ASSERT_TRUE(seen_keys.insert(key).second);
+        }
+    }
+    ASSERT_EQ(expected_rows, total_rows);
+    ASSERT_EQ(50, seen_keys.size());
+
+    // Spill files are removed on destruction.
+    std::vector<std::string> paths;
+    for (auto& file : partitions) {
+        if (file != nullptr) {
+            paths.push_back(file->path());
+        }
+    }
+    partitions.clear();
+    for (const auto& path : paths) {
+        ASSERT_FALSE(fs::path_exist(path));
+    }
+}
+
+TEST_F(PartitionedSpillerTest, test_level_spreads_partition) {
+    // All rows of a partition at level 0 should be spread to several partitions at level 1.
+    PartitionedSpiller spiller0(_state.get(), "level0", 4, 0);
+    auto chunk = _create_chunk(0, 100);
+    ASSERT_OK(spiller0.spill(*chunk, {chunk->get_column_by_slot_id(1)}, nullptr));
+    ASSIGN_OR_ABORT(auto partitions, spiller0.finish());
+    ASSERT_EQ(4, partitions.size());
+    auto it = std::find_if(partitions.begin(), partitions.end(), [](const auto& file) { return file != nullptr; });
+    ASSERT_TRUE(it != partitions.end());
+
+    PartitionedSpiller spiller1(_state.get(), "level1", 4, 1);
+    while (true) {
+        ASSIGN_OR_ABORT(auto restored, (*it)->read_next());
+        if (restored == nullptr) {
+            break;
+        }
+        ASSERT_OK(spiller1.spill(*restored, {restored->get_column_by_slot_id(1)}, nullptr));
+    }
+    ASSIGN_OR_ABORT(auto sub_partitions, spiller1.finish());
+    ASSERT_GT(std::count_if(sub_partitions.begin(), sub_partitions.end(),
+                            [](const auto& file) { return file != nullptr; }),
+              1);
+}
+
+TEST_F(PartitionedSpillerTest, test_spill_file_io_counters) {
+    RuntimeProfile profile("test");
+    SpillIOCounters counters(&profile);
+    ASSIGN_OR_ABORT(auto file, SpillFile::create(_state.get(), "counters", &counters));
+    for (int32_t i = 0; i < 10; i++) {
+        ASSERT_OK(file->append(*_create_chunk(i * 50, 50)));
+    }
+    ASSERT_OK(file->finish_write());
+    ASSERT_EQ(file->file_size(), counters.write_bytes->value());
+    ASSERT_EQ(file->file_size(), SpillManager::instance()->query_bytes(_state->query_id()));
+
+    int32_t next = 0;
+    while (true) {
+        ASSIGN_OR_ABORT(auto chunk, file->read_next());
+        if (chunk == nullptr) {
+            break;
+        }
+        auto expected = _create_chunk(next, chunk->num_rows());
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            ASSERT_EQ(expected->debug_row(i), chunk->debug_row(i));
+        }
+        next += chunk->num_rows();
+    }
+    ASSERT_EQ(500, next);
+    ASSERT_EQ(file->file_size(), counters.read_bytes->value());
+
+    file.reset();
+    ASSERT_EQ(0, SpillManager::instance()->query_bytes(_state->query_id()));
+}
+
+TEST_F(PartitionedSpillerTest, test_query_quota) {
+    int64_t old_limit = config::spill_query_max_bytes;
+    config::spill_query_max_bytes = 1;
+    ASSIGN_OR_ABORT(auto file, SpillFile::create(_state.get(), "quota"));
+    auto st = file->append(*_create_chunk(0, 50));
+    config::spill_query_max_bytes = old_limit;
+    ASSERT_EQ(TStatusCode::RESOURCE_BUSY, st.code()) << st;
+    ASSERT_EQ(0, SpillManager::instance()->query_bytes(_state->query_id()));
+}
+
+} // namespace starrocks::spill
@@ -23,6 +23,9 @@
 
 #include <gtest/gtest.h>
 
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 #include "exec/vectorized/tablet_info.h"
 #include "runtime/descriptor_helper.h"
 
@@ -156,6 +159,93 @@ TEST_F(OlapTablePartitionParamTest, bad_index) {
     }
 }
 
+static TExprNode bigint_literal(int64_t value) {
+    TExprNode node;
+    node.node_type = TExprNodeType::INT_LITERAL;
+    node.type = TypeDescriptor(TYPE_BIGINT).to_thrift();
+    node.num_children = 0;
+    node.__set_int_literal(TIntLiteral());
+    node.int_literal.value = value;
+    return node;
+}
+
+TEST_F(OlapTablePartitionParamTest, find_tablets) {
+    TDescriptorTable t_desc_tbl;
+    auto t_schema = get_schema(&t_desc_tbl);
+    std::shared_ptr<OlapTableSchemaParam> schema(new OlapTableSchemaParam());
+    ASSERT_TRUE(schema->init(t_schema).ok());
+
+    // (-oo, 10) | [10, 50) | [60, +oo)
+    TOlapTablePartitionParam t_partition_param;
+    t_partition_param.db_id = 1;
+    t_partition_param.table_id = 2;
+    t_partition_param.version = 0;
+    t_partition_param.__set_partition_columns({"c2"});
+    t_partition_param.__set_distributed_columns({"c1"});
+    t_partition_param.partitions.resize(3);
+    for (int i = 0; i < 3; ++i) {
+        auto& t_part = t_partition_param.partitions[i];
+        t_part.id = 10 + i;
+        t_part.num_buckets = 2;
+        t_part.indexes.resize(2);
+        t_part.indexes[0].index_id = 4;
+        t_part.indexes[0].tablets = {20 + i * 2, 21 + i * 2};
+        t_part.indexes[1].index_id = 5;
+        t_part.indexes[1].tablets = {30 + i * 2, 31 + i * 2};
+    }
+    t_partition_param.partitions[0].__set_end_keys({bigint_literal(10)});
+    t_partition_param.partitions[1].__set_start_keys({bigint_literal(10)});
+    t_partition_param.partitions[1].__set_end_keys({bigint_literal(50)});
+    t_partition_param.partitions[2].__set_start_keys({bigint_literal(60)});
+
+    vectorized::OlapTablePartitionParam part(schema, t_partition_param);
+    ASSERT_TRUE(part.init().ok());
+
+    const auto& slots = schema->tuple_desc()->slots();
+    std::vector<int64_t> values{5, 10, 49, 55, 60, 1000, -3};
+    std::vector<int64_t> expected{10, 11, 11, -1, 12, 12, 10};
+    auto c1 = vectorized::Int32Column::create();
+    auto c2 = vectorized::Int64Column::create();
+    for (size_t i = 0; i < values.size(); ++i) {
+        c1->append(i);
+        c2->append(values[i]);
+    }
+
+    auto check = [&](const vectorized::ColumnPtr& key_column, const std::vector<int64_t>& expected_ids) {
+        vectorized::Chunk chunk;
+        chunk.append_column(c1, slots[0]->id());
+        chunk.append_column(key_column, slots[1]->id());
+        std::vector<vectorized::OlapTablePartition*> partitions;
+        std::vector<uint32_t> indexes;
+        std::vector<uint8_t> selection(key_column->size(), 1);
+        int invalid_row_index = -1;
+        ASSERT_TRUE(part.find_tablets(&chunk, &partitions, &indexes, &selection, &invalid_row_index).ok());
+        for (size_t i = 0; i < expected_ids.size(); ++i) {
+            if (expected_ids[i] < 0) {
+                ASSERT_EQ(0, selection[i]) << i;
+                ASSERT_EQ(static_cast<int>(i), invalid_row_index);
+            } else {
+                ASSERT_EQ(1, selection[i]) << i;
+                ASSERT_EQ(expected_ids[i], partitions[i]->id) << i;
+                ASSERT_LT(indexes[i], 2u);
+            }
+        }
+    };
+
+    // binary search over the values of the key column
+    check(c2, expected);
+    check(vectorized::NullableColumn::create(c2, vectorized::NullColumn::create(values.size(), 0)), expected);
+
+    // null is the minimum value
+    auto null_data = vectorized::Int64Column::create(*c2);
+    null_data->append(0);
+    auto nulls = vectorized::NullColumn::create(values.size(), 0);
+    nulls->append(1);
+    c1->append(values.size());
+    expected.emplace_back(10);
+    check(vectorized::NullableColumn::create(null_data, nulls), expected);
+}
+
 TEST_F(OlapTablePartitionParamTest, tableLoacation) {
     TOlapTableLocationParam tparam;
     tparam.tablets.resize(1);
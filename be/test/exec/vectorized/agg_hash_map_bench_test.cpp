@@ -0,0 +1,401 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <numeric>
+#include <random>
+
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "column/object_column.h"
+#include "common/config.h"
+#include "exec/vectorized/aggregate/agg_hash_variant.h"
+#include "exprs/agg/aggregate_factory.h"
+#include "runtime/current_thread.h"
+#include "runtime/mem_pool.h"
+#include "runtime/mem_tracker.h"
+#include "runtime/runtime_state.h"
+#include "runtime/types.h"
+#include "testutil/function_utils.h"
+#include "types/bitmap_value.h"
+
+namespace starrocks::vectorized {
+
+static constexpr int kBenchChunkSize = 4096;
+// The rows aggregated by an iteration of the benchmarks.
+static constexpr int kNumRows = 1 << 20;
+// The size of the aggregate states allocated for the groups by the hash map benchmarks, i.e. a sum(bigint).
+static constexpr size_t kAggStateSize = sizeof(int64_t);
+
+// The keys of the rows, uniform in [0, num_groups). With |distinct_per_chunk|, the keys of a chunk are distinct
+// like the output of a partial aggregation merged by the second phase, otherwise they are random.
+static std::vector<int64_t> generate_keys(std::mt19937_64& rng, int64_t num_groups, bool distinct_per_chunk) {
+    std::vector<int64_t> keys(kNumRows);
+    if (distinct_per_chunk) {
+        std::vector<int64_t> groups(num_groups);
+        std::iota(groups.begin(), groups.end(), 0);
+        for (size_t i = 0; i < keys.size(); i += groups.size()) {
+            std::shuffle(groups.begin(), groups.end(), rng);
+            std::copy_n(groups.begin(), std::min(groups.size(), keys.size() - i), keys.begin() + i);
+        }
+    } else {
+        std::uniform_int_distribution<int64_t> group(0, num_groups - 1);
+        for (auto& key : keys) {
+            key = group(rng);
+        }
+    }
+    return keys;
+}
+
+// The null flags of |num_rows| rows, |null_percent| of which are null.
+static NullColumnPtr generate_nulls(std::mt19937_64& rng, size_t num_rows, int null_percent) {
+    std::uniform_int_distribution<int> percent(0, 99);
+    auto nulls = NullColumn::create(num_rows, 0);
+    for (auto& null : nulls->get_data()) {
+        null = percent(rng) < null_percent;
+    }
+    return nulls;
+}
+
+// The column of the group by key |type| of the values |keys[offset, offset + num_rows)|.
+static ColumnPtr create_key_column(PrimitiveType type, const std::vector<int64_t>& keys, size_t offset,
+                                   size_t num_rows) {
+    auto column = ColumnHelper::create_column(TypeDescriptor::from_primtive_type(type), false);
+    column->reserve(num_rows);
+    std::string buffer;
+    for (size_t i = offset; i < offset + num_rows; i++) {
+        switch (type) {
+        case TYPE_INT:
+            column->append_datum(Datum(static_cast<int32_t>(keys[i])));
+            break;
+        case TYPE_BIGINT:
+            column->append_datum(Datum(keys[i] * 1000003));
+            break;
+        default:
+            buffer = "agg_key_" + std::to_string(keys[i]);
+            column->append_datum(Datum(Slice(buffer)));
+            break;
+        }
+    }
+    return column;
+}
+
+static std::shared_ptr<RuntimeState> create_runtime_state() {
+    config::vector_chunk_size = kBenchChunkSize;
+    TQueryOptions query_options;
+    query_options.batch_size = kBenchChunkSize;
+    auto runtime_state = std::make_shared<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+    runtime_state->init_instance_mem_tracker();
+    return runtime_state;
+}
+
+// ========== AggHashMapVariant ==========
+
+// The chunks of the group by columns of kNumRows rows, and the variant of the hash map they are aggregated by.
+class AggHashMapBench {
+public:
+    AggHashMapBench(AggHashMapVariant::Type type, std::vector<PrimitiveType> key_types, bool nullable)
+            : _type(type), _key_types(std::move(key_types)), _nullable(nullable) {
+        _runtime_state = create_runtime_state();
+    }
+
+    void prepare(int64_t num_groups, int null_percent, bool distinct_per_chunk) {
+        std::vector<int64_t> keys = generate_keys(_rng, num_groups, distinct_per_chunk);
+        _key_chunks.clear();
+        for (size_t offset = 0; offset < keys.size(); offset += kBenchChunkSize) {
+            Columns key_columns;
+            for (PrimitiveType type : _key_types) {
+                auto column = create_key_column(type, keys, offset, kBenchChunkSize);
+                if (_nullable) {
+                    column = NullableColumn::create(column, generate_nulls(_rng, kBenchChunkSize, null_percent));
+                }
+                key_columns.emplace_back(std::move(column));
+            }
+            _key_chunks.emplace_back(std::move(key_columns));
+        }
+    }
+
+    // Aggregate all the chunks into |variant|, the states of the groups are allocated from |pool|.
+    void build(AggHashMapVariant* variant, MemPool* pool) {
+        variant->init(_runtime_state.get(), _type);
+        auto allocate_state = [pool](const auto&) { return pool->allocate_aligned(kAggStateSize, 16); };
+        for (const auto& key_columns : _key_chunks) {
+            if (false) {
+            }
+#define HASH_MAP_METHOD(NAME)                                                                            \
+    else if (variant->type == AggHashMapVariant::Type::NAME) {                                           \
+        variant->NAME->compute_agg_states(kBenchChunkSize, key_columns, pool, allocate_state, &_states); \
+    }
+            APPLY_FOR_AGG_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+        }
+    }
+
+private:
+    const AggHashMapVariant::Type _type;
+    const std::vector<PrimitiveType> _key_types;
+    const bool _nullable;
+    std::shared_ptr<RuntimeState> _runtime_state;
+    std::mt19937_64 _rng{20221014};
+
+    std::vector<Columns> _key_chunks;
+    Buffer<AggDataPtr> _states;
+};
+
+// Arguments: the number of groups, and the percent of the null keys.
+static void do_hash_map(benchmark::State& state, AggHashMapVariant::Type type, std::vector<PrimitiveType> key_types,
+                        bool nullable, bool distinct_per_chunk) {
+    int64_t num_groups = state.range(0);
+    AggHashMapBench bench(type, std::move(key_types), nullable);
+    bench.prepare(num_groups, state.range(1), distinct_per_chunk);
+    for (auto _ : state) {
+        AggHashMapVariant variant;
+        MemPool pool;
+        bench.build(&variant, &pool);
+        state.PauseTiming();
+        state.counters["groups"] = variant.size();
+        state.counters["bytes_per_group"] = variant.reserved_memory_usage(&pool) / std::max<size_t>(1, variant.size());
+        variant.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+// ========== AggregateFunction ==========
+
+// The aggregate functions benchmarked, with their argument and intermediate types.
+enum class AggFunctionKind { SUM, MULTI_DISTINCT_COUNT, BITMAP_UNION, PERCENTILE_APPROX };
+
+static const AggregateFunction* get_function_of(AggFunctionKind kind, bool nullable) {
+    switch (kind) {
+    case AggFunctionKind::SUM:
+        return get_aggregate_function("sum", TYPE_BIGINT, TYPE_BIGINT, nullable);
+    case AggFunctionKind::MULTI_DISTINCT_COUNT:
+        return get_aggregate_function("multi_distinct_count", TYPE_BIGINT, TYPE_BIGINT, nullable);
+    case AggFunctionKind::BITMAP_UNION:
+        return get_aggregate_function("bitmap_union", TYPE_OBJECT, TYPE_OBJECT, nullable);
+    case AggFunctionKind::PERCENTILE_APPROX:
+        return get_aggregate_function("percentile_approx", TYPE_DOUBLE, TYPE_DOUBLE, nullable);
+    }
+    __builtin_unreachable();
+}
+
+static PrimitiveType intermediate_type_of(AggFunctionKind kind) {
+    switch (kind) {
+    case AggFunctionKind::SUM:
+        return TYPE_BIGINT;
+    case AggFunctionKind::BITMAP_UNION:
+        return TYPE_OBJECT;
+    default:
+        return TYPE_VARCHAR;
+    }
+}
+
+// The input columns of |kind| of |num_rows| rows.
+static Columns create_input_columns(AggFunctionKind kind, std::mt19937_64& rng, size_t num_rows) {
+    // The distinct values of count distinct and bitmap union are bounded, as they are in most of the groups.
+    std::uniform_int_distribution<int64_t> value(0, 1023);
+    Columns columns;
+    switch (kind) {
+    case AggFunctionKind::SUM:
+    case AggFunctionKind::MULTI_DISTINCT_COUNT: {
+        auto column = Int64Column::create();
+        for (size_t i = 0; i < num_rows; i++) {
+            column->append(value(rng));
+        }
+        columns.emplace_back(std::move(column));
+        break;
+    }
+    case AggFunctionKind::BITMAP_UNION: {
+        auto column = BitmapColumn::create();
+        for (size_t i = 0; i < num_rows; i++) {
+            column->append(BitmapValue(value(rng)));
+        }
+        columns.emplace_back(std::move(column));
+        break;
+    }
+    case AggFunctionKind::PERCENTILE_APPROX: {
+        std::uniform_real_distribution<double> real_value(0, 1);
+        auto column = DoubleColumn::create();
+        for (size_t i = 0; i < num_rows; i++) {
+            column->append(real_value(rng));
+        }
+        columns.emplace_back(std::move(column));
+        columns.emplace_back(ColumnHelper::create_const_column<TYPE_DOUBLE>(0.5, num_rows));
+        break;
+    }
+    }
+    return columns;
+}
+
+// The input chunks of kNumRows rows of an aggregate function, their intermediate results serialized by the
+// streaming pre-aggregation, and the states of the groups they are aggregated into.
+class AggFunctionBench {
+public:
+    AggFunctionBench(AggFunctionKind kind, bool nullable)
+            : _kind(kind), _nullable(nullable), _function(get_function_of(kind, nullable)) {
+        CHECK(_function != nullptr);
+        _ctx = _utils.get_fn_ctx();
+    }
+
+    void prepare(int64_t num_groups, int null_percent) {
+        std::vector<int64_t> keys = generate_keys(_rng, num_groups, false);
+        _num_groups = num_groups;
+        _input_chunks.clear();
+        _intermediate_columns.clear();
+        _row_states.resize(kNumRows);
+        for (size_t offset = 0; offset < kNumRows; offset += kBenchChunkSize) {
+            Columns columns = create_input_columns(_kind, _rng, kBenchChunkSize);
+            if (_nullable) {
+                columns[0] = NullableColumn::create(columns[0], generate_nulls(_rng, kBenchChunkSize, null_percent));
+            }
+            auto intermediate = ColumnHelper::create_column(
+                    TypeDescriptor::from_primtive_type(intermediate_type_of(_kind)), _nullable);
+            _function->convert_to_serialize_format(_ctx, columns, kBenchChunkSize, &intermediate);
+            _input_chunks.emplace_back(std::move(columns));
+            _intermediate_columns.emplace_back(std::move(intermediate));
+        }
+        _keys = std::move(keys);
+    }
+
+    // Create the states of the groups, and point each row to the state of its group.
+    void create_states(MemPool* pool) {
+        _group_states.resize(_num_groups);
+        for (auto& group_state : _group_states) {
+            group_state = pool->allocate_aligned(_function->size(), _function->alignof_size());
+            _function->create(_ctx, group_state);
+        }
+        for (size_t i = 0; i < kNumRows; i++) {
+            _row_states[i] = _group_states[_keys[i]];
+        }
+    }
+
+    void destroy_states() {
+        for (auto group_state : _group_states) {
+            _function->destroy(_ctx, group_state);
+        }
+        _group_states.clear();
+    }
+
+    void update() {
+        for (size_t i = 0; i < _input_chunks.size(); i++) {
+            std::vector<const Column*> columns;
+            for (const auto& column : _input_chunks[i]) {
+                columns.emplace_back(column.get());
+            }
+            _function->update_batch(_ctx, kBenchChunkSize, 0, columns.data(), &_row_states[i * kBenchChunkSize]);
+        }
+    }
+
+    void merge() {
+        for (size_t i = 0; i < _intermediate_columns.size(); i++) {
+            _function->merge_batch(_ctx, kBenchChunkSize, 0, _intermediate_columns[i].get(),
+                                   &_row_states[i * kBenchChunkSize]);
+        }
+    }
+
+private:
+    const AggFunctionKind _kind;
+    const bool _nullable;
+    const AggregateFunction* _function;
+    FunctionUtils _utils;
+    FunctionContext* _ctx;
+    std::mt19937_64 _rng{20221014};
+
+    int64_t _num_groups = 0;
+    std::vector<int64_t> _keys;
+    std::vector<Columns> _input_chunks;
+    Columns _intermediate_columns;
+    std::vector<AggDataPtr> _group_states;
+    std::vector<AggDataPtr> _row_states;
+};
+
+// Arguments: the number of groups, and the percent of the null values. An iteration creates the states of the
+// groups, aggregates all the rows into them with update_batch or merge_batch, and destroys the states, the
+// bytes of a group are the memory allocated for its state by create and update.
+static void do_agg_function(benchmark::State& state, AggFunctionKind kind, bool is_merge) {
+    int64_t num_groups = state.range(0);
+    int null_percent = state.range(1);
+    AggFunctionBench bench(kind, null_percent > 0);
+    bench.prepare(num_groups, null_percent);
+    for (auto _ : state) {
+        MemTracker mem_tracker;
+        MemPool pool;
+        {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(&mem_tracker);
+            bench.create_states(&pool);
+            if (is_merge) {
+                bench.merge();
+            } else {
+                bench.update();
+            }
+        }
+        state.counters["bytes_per_group"] = mem_tracker.consumption() / num_groups;
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(&mem_tracker);
+        bench.destroy_states();
+        pool.free_all();
+    }
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+// From the groups fitting in L1 to those in DRAM.
+static const std::vector<int64_t> kNumGroups = {16, 1 << 10, 1 << 16, 1 << 20};
+
+static void NotNullArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"groups", "null_percent"});
+    for (int64_t num_groups : kNumGroups) {
+        b->Args({num_groups, 0});
+    }
+    b->Unit(benchmark::kMillisecond);
+}
+
+static void NullArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"groups", "null_percent"});
+    for (int64_t num_groups : kNumGroups) {
+        for (int64_t null_percent : {0, 10, 50, 90}) {
+            b->Args({num_groups, null_percent});
+        }
+    }
+    b->Unit(benchmark::kMillisecond);
+}
+
+// The variants phase1_NAME and phase2_NAME, the second phase merges the distinct keys of the first one.
+#define AGG_HASH_MAP_BENCH(NAME, KEY_TYPES, NULLABLE, ARGS)                                     \
+    static void BM_build_##NAME(benchmark::State& state) {                                      \
+        do_hash_map(state, AggHashMapVariant::Type::phase1_##NAME, KEY_TYPES, NULLABLE, false); \
+    }                                                                                           \
+    static void BM_merge_##NAME(benchmark::State& state) {                                      \
+        do_hash_map(state, AggHashMapVariant::Type::phase2_##NAME, KEY_TYPES, NULLABLE, true);  \
+    }                                                                                           \
+    BENCHMARK(BM_build_##NAME)->Apply(ARGS);                                                    \
+    BENCHMARK(BM_merge_##NAME)->Apply(ARGS);
+
+AGG_HASH_MAP_BENCH(int32, {TYPE_INT}, false, NotNullArgs)
+AGG_HASH_MAP_BENCH(int64, {TYPE_BIGINT}, false, NotNullArgs)
+AGG_HASH_MAP_BENCH(string, {TYPE_VARCHAR}, false, NotNullArgs)
+AGG_HASH_MAP_BENCH(slice, (std::vector<PrimitiveType>{TYPE_INT, TYPE_VARCHAR}), false, NotNullArgs)
+AGG_HASH_MAP_BENCH(null_int32, {TYPE_INT}, true, NullArgs)
+AGG_HASH_MAP_BENCH(null_int64, {TYPE_BIGINT}, true, NullArgs)
+AGG_HASH_MAP_BENCH(null_string, {TYPE_VARCHAR}, true, NullArgs)
+AGG_HASH_MAP_BENCH(int32_two_level, {TYPE_INT}, false, NotNullArgs)
+AGG_HASH_MAP_BENCH(slice_two_level, (std::vector<PrimitiveType>{TYPE_INT, TYPE_VARCHAR}), false, NotNullArgs)
+
+#undef AGG_HASH_MAP_BENCH
+
+#define AGG_FUNCTION_BENCH(NAME, KIND)                                                                 \
+    static void BM_agg_update_##NAME(benchmark::State& state) { do_agg_function(state, KIND, false); } \
+    static void BM_agg_merge_##NAME(benchmark::State& state) { do_agg_function(state, KIND, true); }   \
+    BENCHMARK(BM_agg_update_##NAME)->Apply(NullArgs);                                                  \
+    BENCHMARK(BM_agg_merge_##NAME)->Apply(NullArgs);
+
+AGG_FUNCTION_BENCH(sum, AggFunctionKind::SUM)
+AGG_FUNCTION_BENCH(multi_distinct_count, AggFunctionKind::MULTI_DISTINCT_COUNT)
+AGG_FUNCTION_BENCH(bitmap_union, AggFunctionKind::BITMAP_UNION)
+AGG_FUNCTION_BENCH(percentile_approx, AggFunctionKind::PERCENTILE_APPROX)
+
+#undef AGG_FUNCTION_BENCH
+
+} // namespace starrocks::vectorized
+
+BENCHMARK_MAIN();
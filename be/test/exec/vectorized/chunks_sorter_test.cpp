@@ -14,6 +14,7 @@
 #include "exec/vectorized/sorting/sort_helper.h"
 #include "exec/vectorized/sorting/sort_permute.h"
 #include "exec/vectorized/sorting/sorting.h"
+#include "exec/vectorized/topn_runtime_filter.h"
 #include "exprs/vectorized/column_ref.h"
 #include "fmt/core.h"
 #include "runtime/runtime_state.h"
@@ -790,6 +791,76 @@ TEST_F(ChunksSorterTest, stable_sort) {
     ASSERT_EQ(expect, result);
 }
 
+TEST_F(ChunksSorterTest, sort_by_normalized_key) {
+    ColumnPtr col1 = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    ColumnPtr col2 = ColumnHelper::create_column(TypeDescriptor(TYPE_BIGINT), false);
+    constexpr int N = 1000;
+    for (int i = 0; i < N; i++) {
+        if (i % 7 == 0) {
+            ASSERT_TRUE(col1->append_nulls(1));
+        } else {
+            col1->append_datum(Datum(static_cast<int32_t>((i * 37) % 20 - 10)));
+        }
+        col2->append_datum(Datum(static_cast<int64_t>((i * 13) % 50) - 25));
+    }
+    std::vector<Columns> vertical_chunks{{col1, col2}};
+    ASSERT_TRUE(can_sort_by_normalized_key(vertical_chunks));
+
+    // col1 asc nulls first, col2 desc
+    std::vector<int> sort_orders{1, -1};
+    std::vector<int> null_firsts{-1, 1};
+    auto less = [&](const PermutationItem& lhs, const PermutationItem& rhs) {
+        int x = col1->compare_at(lhs.index_in_chunk, rhs.index_in_chunk, *col1, -1);
+        if (x != 0) {
+            return x < 0;
+        }
+        return col2->compare_at(lhs.index_in_chunk, rhs.index_in_chunk, *col2, 1) > 0;
+    };
+    for (size_t limit : {static_cast<size_t>(N), static_cast<size_t>(10)}) {
+        Permutation perm(N);
+        for (uint32_t i = 0; i < N; i++) {
+            perm[i] = PermutationItem(0, i);
+        }
+        ASSERT_OK(sort_by_normalized_key(false, vertical_chunks, sort_orders, null_firsts, perm, limit));
+        ASSERT_EQ(limit, perm.size());
+        ASSERT_TRUE(std::is_sorted(perm.begin(), perm.end(), less));
+        ASSERT_TRUE(col1->is_null(perm[0].index_in_chunk));
+    }
+
+    Permutation perm;
+    ASSERT_OK(sort_and_tie_columns(false, vertical_chunks[0], sort_orders, null_firsts, &perm));
+    ASSERT_EQ(N, perm.size());
+    ASSERT_TRUE(std::is_sorted(perm.begin(), perm.end(), less));
+
+    ColumnPtr col3 = ColumnHelper::create_column(TypeDescriptor(TYPE_VARCHAR), false);
+    ASSERT_FALSE(can_sort_by_normalized_key({{col1, col3}}));
+}
+
+TEST_F(ChunksSorterTest, topn_runtime_filter) {
+    ColumnPtr column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    column->append_datum(Datum(static_cast<int32_t>(10)));
+    column->append_datum(Datum(static_cast<int32_t>(5)));
+    column->append_datum(Datum(static_cast<int32_t>(20)));
+    ASSERT_TRUE(column->append_nulls(1));
+
+    // ORDER BY c DESC, only the greater boundary is tighter.
+    TopnRuntimeFilter filter(1, false);
+    ASSERT_EQ(0, filter.version());
+    ASSERT_TRUE(filter.boundary() == nullptr);
+    filter.update(*column, 3);
+    ASSERT_EQ(0, filter.version());
+    filter.update(*column, 0);
+    ASSERT_EQ(1, filter.version());
+    filter.update(*column, 1);
+    ASSERT_EQ(1, filter.version());
+    filter.update(*column, 2);
+    ASSERT_EQ(2, filter.version());
+    ColumnPtr boundary = filter.boundary();
+    ASSERT_FALSE(boundary->is_nullable());
+    ASSERT_EQ(1, boundary->size());
+    ASSERT_EQ(20, boundary->get(0).get_int32());
+}
+
 TEST_F(ChunksSorterTest, column_incremental_sort) {
     TypeDescriptor type_desc = TypeDescriptor(TYPE_INT);
     ColumnPtr nullable_column = ColumnHelper::create_column(type_desc, true);
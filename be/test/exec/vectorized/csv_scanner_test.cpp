@@ -13,6 +13,7 @@
 #include "runtime/descriptor_helper.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
+#include "testutil/assert.h"
 
 namespace starrocks::vectorized {
 
@@ -502,6 +503,38 @@ TEST_F(CSVScannerTest, test_start_offset) {
     EXPECT_EQ(8, chunk->get(1)[1].get_int32());
 }
 
+TEST_F(CSVScannerTest, test_split_in_multi_row_delimiter) {
+    std::vector<TypeDescriptor> types{TypeDescriptor(TYPE_INT), TypeDescriptor(TYPE_DOUBLE)};
+    types.emplace_back(TYPE_VARCHAR);
+    types.emplace_back(TYPE_DATE);
+    types.emplace_back(TYPE_VARCHAR);
+    types[2].len = 10;
+    types[4].len = 6;
+
+    // The first record delimiter "<br>" of csv_file14 is at [26, 30), split the file at its 'r'.
+    std::vector<int32_t> values;
+    for (auto [start_offset, size] : std::vector<std::pair<int64_t, int64_t>>{{0, 28}, {28, 30}}) {
+        TBrokerRangeDesc range;
+        range.__set_num_of_columns_from_file(types.size());
+        range.__set_start_offset(start_offset);
+        range.__set_size(size);
+        range.__set_format_type(TFileFormatType::FORMAT_CSV_PLAIN);
+        range.__set_path("./be/test/exec/test_data/csv_scanner/csv_file14");
+
+        auto scanner = create_csv_scanner(types, {range}, "<br>", "^^");
+        ASSERT_OK(scanner->open());
+        auto res = scanner->get_next();
+        while (res.ok()) {
+            for (size_t i = 0; i < res.value()->num_rows(); i++) {
+                values.emplace_back(res.value()->get(i)[0].get_int32());
+            }
+            res = scanner->get_next();
+        }
+        ASSERT_TRUE(res.status().is_end_of_file()) << res.status();
+    }
+    ASSERT_EQ((std::vector<int32_t>{1, -1}), values);
+}
+
 TEST_F(CSVScannerTest, test_file_not_ended_with_record_delimiter) {
     std::vector<TypeDescriptor> types{TypeDescriptor(TYPE_INT), TypeDescriptor(TYPE_INT)};
 
@@ -0,0 +1,389 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+// Scan a local parquet or orc file through HdfsScanner, and break the time down into the phases of the scan, e.g.
+//   hdfs_scanner_bench_test --file=lineitem.parquet --columns="l_orderkey:BIGINT,l_shipdate:DATE"
+//                           --conjuncts="l_shipdate>=1995-01-01"
+//
+// The phases are only reported by the scanners measuring them, e.g. the orc scanner does not break the read of the
+// columns down into decompress and decode.
+
+#include <benchmark/benchmark.h>
+#include <gflags/gflags.h>
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/chunk.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "common/statusor.h"
+#include "exec/vectorized/hdfs_scanner_orc.h"
+#include "exec/vectorized/hdfs_scanner_parquet.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "fs/fs.h"
+#include "gutil/strings/split.h"
+#include "gutil/strings/strip.h"
+#include "gutil/strings/util.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "storage/chunk_helper.h"
+
+DEFINE_string(file, "", "the local parquet or orc file to scan");
+DEFINE_string(format, "", "parquet or orc, by the extension of the file if empty");
+DEFINE_string(columns, "", "comma separated columns to read, in the form of <name>:<type>, e.g. c1:INT,c2:VARCHAR");
+DEFINE_string(conjuncts, "", "semicolon separated predicates on the columns, in the form of <name><op><literal>");
+DEFINE_int32(chunk_size, 4096, "the rows of the chunks returned by the scanner");
+
+namespace starrocks::vectorized {
+
+struct BenchColumn {
+    std::string name;
+    TypeDescriptor type;
+};
+
+struct BenchConjunct {
+    std::string column;
+    TExprOpcode::type opcode;
+    std::string literal;
+};
+
+static StatusOr<TypeDescriptor> parse_type(const std::string& name) {
+    static const std::vector<std::pair<std::string, PrimitiveType>> kTypes = {
+            {"BOOLEAN", TYPE_BOOLEAN}, {"TINYINT", TYPE_TINYINT},   {"SMALLINT", TYPE_SMALLINT},
+            {"INT", TYPE_INT},         {"BIGINT", TYPE_BIGINT},     {"FLOAT", TYPE_FLOAT},
+            {"DOUBLE", TYPE_DOUBLE},   {"VARCHAR", TYPE_VARCHAR},   {"DATE", TYPE_DATE},
+            {"DATETIME", TYPE_DATETIME}};
+    for (const auto& [type_name, type] : kTypes) {
+        if (type_name == name) {
+            return type == TYPE_VARCHAR ? TypeDescriptor::create_varchar_type(TypeDescriptor::MAX_VARCHAR_LENGTH)
+                                        : TypeDescriptor::from_primtive_type(type);
+        }
+    }
+    return Status::NotSupported("unsupported type " + name);
+}
+
+static StatusOr<std::vector<BenchColumn>> parse_columns(const std::string& columns) {
+    std::vector<BenchColumn> result;
+    for (const auto& column : strings::Split(columns, ",", strings::SkipWhitespace())) {
+        std::vector<std::string> fields = strings::Split(column, ":");
+        if (fields.size() != 2) {
+            return Status::InvalidArgument("invalid column " + std::string(column));
+        }
+        StripWhiteSpace(&fields[0]);
+        StripWhiteSpace(&fields[1]);
+        ASSIGN_OR_RETURN(auto type, parse_type(fields[1]));
+        result.push_back({fields[0], type});
+    }
+    if (result.empty()) {
+        return Status::InvalidArgument("no column to read");
+    }
+    return result;
+}
+
+static StatusOr<std::vector<BenchConjunct>> parse_conjuncts(const std::string& conjuncts) {
+    // The operators of two characters go first, so that "<=" is not taken as "<".
+    static const std::vector<std::pair<std::string, TExprOpcode::type>> kOperators = {
+            {"<=", TExprOpcode::LE}, {">=", TExprOpcode::GE}, {"!=", TExprOpcode::NE},
+            {"<", TExprOpcode::LT},  {">", TExprOpcode::GT},  {"=", TExprOpcode::EQ}};
+    std::vector<BenchConjunct> result;
+    for (const auto& piece : strings::Split(conjuncts, ";", strings::SkipWhitespace())) {
+        std::string conjunct(piece);
+        size_t pos = conjunct.find_first_of("<>=!");
+        if (pos == std::string::npos) {
+            return Status::InvalidArgument("invalid conjunct " + conjunct);
+        }
+        bool found = false;
+        for (const auto& [op, opcode] : kOperators) {
+            if (conjunct.compare(pos, op.size(), op) == 0) {
+                BenchConjunct bench_conjunct{conjunct.substr(0, pos), opcode, conjunct.substr(pos + op.size())};
+                StripWhiteSpace(&bench_conjunct.column);
+                StripWhiteSpace(&bench_conjunct.literal);
+                result.emplace_back(std::move(bench_conjunct));
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            return Status::InvalidArgument("invalid conjunct " + conjunct);
+        }
+    }
+    return result;
+}
+
+static TTypeDesc create_type_desc(const TypeDescriptor& type) {
+    TTypeDesc result;
+    TTypeNode node;
+    node.__set_type(TTypeNodeType::SCALAR);
+    TScalarType scalar_type;
+    scalar_type.__set_type(to_thrift(type.type));
+    if (type.type == TYPE_VARCHAR) {
+        scalar_type.__set_len(type.len);
+    }
+    node.__set_scalar_type(scalar_type);
+    result.types.push_back(node);
+    return result;
+}
+
+static StatusOr<TExprNode> create_literal_node(const TypeDescriptor& type, const std::string& literal) {
+    TExprNode lit_node;
+    lit_node.__set_num_children(0);
+    lit_node.__set_type(create_type_desc(type));
+    lit_node.__set_use_vectorized(true);
+    switch (type.type) {
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT: {
+        lit_node.__set_node_type(TExprNodeType::INT_LITERAL);
+        TIntLiteral lit_value;
+        lit_value.__set_value(std::stoll(literal));
+        lit_node.__set_int_literal(lit_value);
+        break;
+    }
+    case TYPE_FLOAT:
+    case TYPE_DOUBLE: {
+        lit_node.__set_node_type(TExprNodeType::FLOAT_LITERAL);
+        TFloatLiteral lit_value;
+        lit_value.__set_value(std::stod(literal));
+        lit_node.__set_float_literal(lit_value);
+        break;
+    }
+    case TYPE_VARCHAR: {
+        lit_node.__set_node_type(TExprNodeType::STRING_LITERAL);
+        TStringLiteral lit_value;
+        lit_value.__set_value(literal);
+        lit_node.__set_string_literal(lit_value);
+        break;
+    }
+    case TYPE_DATE:
+    case TYPE_DATETIME: {
+        lit_node.__set_node_type(TExprNodeType::DATE_LITERAL);
+        TDateLiteral lit_value;
+        lit_value.__set_value(literal);
+        lit_node.__set_date_literal(lit_value);
+        break;
+    }
+    default:
+        return Status::NotSupported("unsupported literal of type " + type.debug_string());
+    }
+    return lit_node;
+}
+
+// <slot> <opcode> <literal>
+static StatusOr<ExprContext*> create_conjunct_ctx(ObjectPool* pool, const SlotDescriptor* slot,
+                                                  const BenchConjunct& conjunct) {
+    TExprNode pred_node;
+    pred_node.__set_node_type(TExprNodeType::BINARY_PRED);
+    pred_node.__set_child_type(to_thrift(slot->type().type));
+    pred_node.__set_type(create_type_desc(TypeDescriptor::from_primtive_type(TYPE_BOOLEAN)));
+    pred_node.__set_opcode(conjunct.opcode);
+    pred_node.__set_num_children(2);
+    pred_node.__set_use_vectorized(true);
+
+    TExprNode slot_node;
+    slot_node.__set_node_type(TExprNodeType::SLOT_REF);
+    slot_node.__set_num_children(0);
+    slot_node.__set_type(create_type_desc(slot->type()));
+    TSlotRef slot_ref;
+    slot_ref.__set_slot_id(slot->id());
+    slot_ref.__set_tuple_id(slot->parent());
+    slot_node.__set_slot_ref(slot_ref);
+    slot_node.__set_use_vectorized(true);
+
+    ASSIGN_OR_RETURN(auto lit_node, create_literal_node(slot->type(), conjunct.literal));
+
+    TExpr texpr;
+    texpr.__set_nodes({pred_node, slot_node, lit_node});
+    ExprContext* ctx = nullptr;
+    RETURN_IF_ERROR(Expr::create_expr_tree(pool, texpr, &ctx));
+    return ctx;
+}
+
+// The descriptors and the expressions of the file to scan, shared by all the iterations.
+class ScanContext {
+public:
+    Status init();
+
+    StatusOr<std::shared_ptr<HdfsScanner>> new_scanner() const;
+
+    RuntimeState* runtime_state() const { return _runtime_state; }
+    const TupleDescriptor* tuple_desc() const { return _tuple_desc; }
+    const HdfsScannerParams& params() const { return _params; }
+
+private:
+    ObjectPool _pool;
+    RuntimeState* _runtime_state = nullptr;
+    std::shared_ptr<RowDescriptor> _row_desc;
+    const TupleDescriptor* _tuple_desc = nullptr;
+    THdfsScanRange _scan_range;
+    HdfsScannerParams _params;
+    bool _is_orc = false;
+};
+
+Status ScanContext::init() {
+    if (FLAGS_format.empty()) {
+        _is_orc = HasSuffixString(FLAGS_file, ".orc");
+    } else if (FLAGS_format == "orc" || FLAGS_format == "parquet") {
+        _is_orc = FLAGS_format == "orc";
+    } else {
+        return Status::InvalidArgument("unsupported format " + FLAGS_format);
+    }
+    ASSIGN_OR_RETURN(auto columns, parse_columns(FLAGS_columns));
+    ASSIGN_OR_RETURN(auto conjuncts, parse_conjuncts(FLAGS_conjuncts));
+
+    TQueryOptions query_options;
+    query_options.__set_batch_size(FLAGS_chunk_size);
+    _runtime_state = _pool.add(new RuntimeState(TUniqueId(), query_options, TQueryGlobals(), nullptr));
+    _runtime_state->init_instance_mem_tracker();
+
+    TDescriptorTableBuilder table_desc_builder;
+    TTupleDescriptorBuilder tuple_desc_builder;
+    for (int i = 0; i < columns.size(); i++) {
+        TSlotDescriptorBuilder slot_desc_builder;
+        slot_desc_builder.column_name(columns[i].name).type(columns[i].type).id(i).nullable(true);
+        tuple_desc_builder.add_slot(slot_desc_builder.build());
+    }
+    tuple_desc_builder.build(&table_desc_builder);
+    DescriptorTbl* tbl = nullptr;
+    RETURN_IF_ERROR(DescriptorTbl::create(&_pool, table_desc_builder.desc_tbl(), &tbl, FLAGS_chunk_size));
+    _row_desc = std::make_shared<RowDescriptor>(*tbl, std::vector<TTupleId>{0}, std::vector<bool>{true});
+    _tuple_desc = _row_desc->tuple_descriptors()[0];
+
+    ASSIGN_OR_RETURN(uint64_t file_size, FileSystem::Default()->get_file_size(FLAGS_file));
+    _scan_range.relative_path = FLAGS_file;
+    _scan_range.offset = 0;
+    _scan_range.length = file_size;
+    _scan_range.file_length = file_size;
+
+    _params.fs = FileSystem::Default();
+    _params.path = FLAGS_file;
+    _params.scan_ranges.emplace_back(&_scan_range);
+    _params.tuple_desc = _tuple_desc;
+    for (int i = 0; i < _tuple_desc->slots().size(); i++) {
+        _params.materialize_index_in_chunk.push_back(i);
+        _params.materialize_slots.push_back(_tuple_desc->slots()[i]);
+    }
+
+    // The predicates are all on a single slot, like the ones the scan node pushes down to the scanners.
+    for (const auto& conjunct : conjuncts) {
+        const SlotDescriptor* slot = nullptr;
+        for (const auto* slot_desc : _tuple_desc->slots()) {
+            if (slot_desc->col_name() == conjunct.column) {
+                slot = slot_desc;
+            }
+        }
+        if (slot == nullptr) {
+            return Status::InvalidArgument("the conjunct is on the column not read: " + conjunct.column);
+        }
+        ASSIGN_OR_RETURN(auto* ctx, create_conjunct_ctx(&_pool, slot, conjunct));
+        _params.conjunct_ctxs_by_slot[slot->id()].push_back(ctx);
+    }
+    for (auto& [slot_id, ctxs] : _params.conjunct_ctxs_by_slot) {
+        RETURN_IF_ERROR(Expr::prepare(ctxs, _runtime_state));
+        RETURN_IF_ERROR(Expr::open(ctxs, _runtime_state));
+    }
+    return Status::OK();
+}
+
+StatusOr<std::shared_ptr<HdfsScanner>> ScanContext::new_scanner() const {
+    std::shared_ptr<HdfsScanner> scanner;
+    if (_is_orc) {
+        scanner = std::make_shared<HdfsOrcScanner>();
+    } else {
+        scanner = std::make_shared<HdfsParquetScanner>();
+    }
+    RETURN_IF_ERROR(scanner->init(_runtime_state, _params));
+    return scanner;
+}
+
+// Scan the whole file, and add the statistics of the scan to |stats|.
+static Status scan(const ScanContext& ctx, HdfsScanStats* stats) {
+    ASSIGN_OR_RETURN(auto scanner, ctx.new_scanner());
+    Status st = scanner->open(ctx.runtime_state());
+    auto chunk = ChunkHelper::new_chunk(*ctx.tuple_desc(), 0);
+    while (st.ok()) {
+        chunk->reset();
+        st = scanner->get_next(ctx.runtime_state(), &chunk);
+    }
+    scanner->close(ctx.runtime_state());
+    if (!st.is_end_of_file()) {
+        return st;
+    }
+
+    const HdfsScanStats& scan_stats = scanner->stats();
+    stats->raw_rows_read += scan_stats.raw_rows_read;
+    stats->num_rows_read += scan_stats.num_rows_read;
+    stats->bytes_read += scan_stats.bytes_read;
+    stats->io_ns += scan_stats.io_ns;
+    stats->reader_init_ns += scan_stats.reader_init_ns;
+    stats->column_read_ns += scan_stats.column_read_ns;
+    stats->column_convert_ns += scan_stats.column_convert_ns;
+    stats->page_read_ns += scan_stats.page_read_ns;
+    stats->page_decompress_ns += scan_stats.page_decompress_ns;
+    stats->level_decode_ns += scan_stats.level_decode_ns;
+    stats->value_decode_ns += scan_stats.value_decode_ns;
+    stats->group_dict_filter_ns += scan_stats.group_dict_filter_ns;
+    stats->group_dict_decode_ns += scan_stats.group_dict_decode_ns;
+    stats->expr_filter_ns += scan_stats.expr_filter_ns;
+    return Status::OK();
+}
+
+static void BM_hdfs_scan(benchmark::State& state, const ScanContext* ctx) {
+    HdfsScanStats stats;
+    for (auto _ : state) {
+        Status st = scan(*ctx, &stats);
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            return;
+        }
+    }
+
+    // The time of the phases in milliseconds per scan.
+    auto add_phase = [&state](const std::string& name, int64_t ns) {
+        state.counters[name + "_ms"] = benchmark::Counter(ns / 1e6, benchmark::Counter::kAvgIterations);
+    };
+    add_phase("io", stats.io_ns);
+    add_phase("reader_init", stats.reader_init_ns);
+    add_phase("column_read", stats.column_read_ns);
+    add_phase("page_read", stats.page_read_ns);
+    add_phase("decompress", stats.page_decompress_ns);
+    add_phase("level_decode", stats.level_decode_ns);
+    add_phase("value_decode", stats.value_decode_ns);
+    add_phase("column_convert", stats.column_convert_ns);
+    add_phase("dict_filter", stats.group_dict_filter_ns);
+    add_phase("dict_decode", stats.group_dict_decode_ns);
+    add_phase("conjunct_eval", stats.expr_filter_ns);
+    state.counters["rows_returned"] = benchmark::Counter(stats.num_rows_read, benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(stats.raw_rows_read);
+    state.SetBytesProcessed(stats.bytes_read);
+}
+
+} // namespace starrocks::vectorized
+
+int main(int argc, char** argv) {
+    using namespace starrocks::vectorized;
+
+    benchmark::Initialize(&argc, argv);
+    gflags::SetUsageMessage("scan a local parquet or orc file.\nUsage: " + std::string(argv[0]) +
+                            " --file=<file> --columns=<name>:<type>[,...] [--conjuncts=<name><op><literal>[;...]]" +
+                            " [--format=parquet|orc] [--chunk_size=<n>] [benchmark flags]");
+    google::ParseCommandLineFlags(&argc, &argv, true);
+    if (FLAGS_file.empty() || FLAGS_columns.empty() || FLAGS_chunk_size <= 0) {
+        std::cout << gflags::ProgramUsage() << std::endl;
+        return -1;
+    }
+    starrocks::config::vector_chunk_size = FLAGS_chunk_size;
+
+    ScanContext ctx;
+    if (auto st = ctx.init(); !st.ok()) {
+        std::cout << "fail to init the scan: " << st << std::endl;
+        return -1;
+    }
+    benchmark::RegisterBenchmark("BM_hdfs_scan", BM_hdfs_scan, &ctx)->Unit(benchmark::kMillisecond);
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
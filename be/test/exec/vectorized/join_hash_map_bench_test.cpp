@@ -0,0 +1,303 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include <benchmark/benchmark.h>
+
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "common/config.h"
+#include "exec/vectorized/join_hash_map.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/runtime_state.h"
+#include "runtime/types.h"
+
+namespace starrocks::vectorized {
+
+static constexpr int kBenchChunkSize = 4096;
+// The rows probed by an iteration of the probe benchmarks.
+static constexpr int kNumProbeRows = 1 << 20;
+
+// The join keys of each variant of the hash map, see JoinHashTable::_choose_join_hash_map.
+enum class JoinKeyLayout {
+    TINYINT,       // key8, direct mapping
+    INT,           // key32, one key
+    BIGINT,        // key64, one key
+    VARCHAR,       // keystring, one key
+    INT_INT,       // fixed64, fixed size keys
+    BIGINT_BIGINT, // fixed128, fixed size keys
+    INT_VARCHAR    // slice, serialized keys
+};
+
+static std::vector<PrimitiveType> key_types_of(JoinKeyLayout layout) {
+    switch (layout) {
+    case JoinKeyLayout::TINYINT:
+        return {TYPE_TINYINT};
+    case JoinKeyLayout::INT:
+        return {TYPE_INT};
+    case JoinKeyLayout::BIGINT:
+        return {TYPE_BIGINT};
+    case JoinKeyLayout::VARCHAR:
+        return {TYPE_VARCHAR};
+    case JoinKeyLayout::INT_INT:
+        return {TYPE_INT, TYPE_INT};
+    case JoinKeyLayout::BIGINT_BIGINT:
+        return {TYPE_BIGINT, TYPE_BIGINT};
+    case JoinKeyLayout::INT_VARCHAR:
+        return {TYPE_INT, TYPE_VARCHAR};
+    }
+    __builtin_unreachable();
+}
+
+// The distinct keys a layout can hold, the tinyint keys are direct mapped.
+static int64_t max_distinct_keys_of(JoinKeyLayout layout) {
+    return layout == JoinKeyLayout::TINYINT ? 64 : std::numeric_limits<int32_t>::max();
+}
+
+// The column of the key |type| of the values in |keys|.
+static ColumnPtr create_key_column(PrimitiveType type, const std::vector<int64_t>& keys) {
+    auto column = ColumnHelper::create_column(TypeDescriptor::from_primtive_type(type), false);
+    column->reserve(keys.size());
+    std::string buffer;
+    for (int64_t key : keys) {
+        switch (type) {
+        case TYPE_TINYINT:
+            column->append_datum(Datum(static_cast<int8_t>(key)));
+            break;
+        case TYPE_INT:
+            column->append_datum(Datum(static_cast<int32_t>(key)));
+            break;
+        case TYPE_BIGINT:
+            column->append_datum(Datum(key * 1000003));
+            break;
+        default:
+            buffer = "join_key_" + std::to_string(key);
+            column->append_datum(Datum(Slice(buffer)));
+            break;
+        }
+    }
+    return column;
+}
+
+// A build table of the keys of |layout| with its descriptors, and the chunks of kNumProbeRows rows probing it.
+class JoinHashTableBench {
+public:
+    JoinHashTableBench(JoinKeyLayout layout, TJoinOp::type join_type) : _key_types(key_types_of(layout)) {
+        config::vector_chunk_size = kBenchChunkSize;
+        TQueryOptions query_options;
+        query_options.batch_size = kBenchChunkSize;
+        _runtime_state = std::make_shared<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+        _runtime_state->init_instance_mem_tracker();
+        _runtime_profile = std::make_shared<RuntimeProfile>("join_hash_map_bench");
+
+        // The tuple 0 is the probe side and the tuple 1 is the build side, both of the key columns only.
+        TDescriptorTableBuilder desc_tbl_builder;
+        for (int tuple = 0; tuple < 2; tuple++) {
+            TTupleDescriptorBuilder tuple_desc_builder;
+            for (size_t i = 0; i < _key_types.size(); i++) {
+                TSlotDescriptorBuilder slot_desc_builder;
+                if (_key_types[i] == TYPE_VARCHAR) {
+                    slot_desc_builder.string_type(255);
+                } else {
+                    slot_desc_builder.type(_key_types[i]);
+                }
+                tuple_desc_builder.add_slot(
+                        slot_desc_builder.column_name("c" + std::to_string(i)).column_pos(i).nullable(false).build());
+            }
+            tuple_desc_builder.build(&desc_tbl_builder);
+        }
+        DescriptorTbl* desc_tbl = nullptr;
+        CHECK(DescriptorTbl::create(&_object_pool, desc_tbl_builder.desc_tbl(), &desc_tbl, kBenchChunkSize).ok());
+        _row_desc = std::make_unique<RowDescriptor>(*desc_tbl, std::vector<TTupleId>{0, 1},
+                                                    std::vector<bool>{false, false});
+        _probe_row_desc =
+                std::make_unique<RowDescriptor>(*desc_tbl, std::vector<TTupleId>{0}, std::vector<bool>{false});
+        _build_row_desc =
+                std::make_unique<RowDescriptor>(*desc_tbl, std::vector<TTupleId>{1}, std::vector<bool>{false});
+
+        for (PrimitiveType type : _key_types) {
+            _join_key_types.emplace_back(TypeDescriptor::from_primtive_type(type));
+        }
+        _param.join_type = join_type;
+        _param.row_desc = _row_desc.get();
+        _param.probe_row_desc = _probe_row_desc.get();
+        _param.build_row_desc = _build_row_desc.get();
+        _param.need_create_tuple_columns = false;
+        for (const auto& type : _join_key_types) {
+            _param.join_keys.emplace_back(JoinKeyDesc{&type, false, nullptr});
+        }
+        _param.search_ht_timer = ADD_TIMER(_runtime_profile, "SearchHashTableTime");
+        _param.output_build_column_timer = ADD_TIMER(_runtime_profile, "OutputBuildColumnTime");
+        _param.output_probe_column_timer = ADD_TIMER(_runtime_profile, "OutputProbeColumnTime");
+        _param.output_tuple_column_timer = ADD_TIMER(_runtime_profile, "OutputTupleColumnTime");
+    }
+
+    // The build side holds the distinct keys [0, num_build_rows), shuffled.
+    void prepare_build(int64_t num_build_rows) {
+        std::vector<int64_t> keys(num_build_rows);
+        std::iota(keys.begin(), keys.end(), 0);
+        std::shuffle(keys.begin(), keys.end(), _rng);
+        _build_chunk = _create_chunk(keys, _key_types.size());
+    }
+
+    // |match_percent| of the probe rows hit a build key. With |skewed|, 90% of the hits are on 1% of the
+    // build keys, otherwise the hits are uniform.
+    void prepare_probe(int64_t num_build_rows, int match_percent, bool skewed) {
+        std::uniform_int_distribution<int> percent(0, 99);
+        std::uniform_int_distribution<int64_t> all_keys(0, num_build_rows - 1);
+        std::uniform_int_distribution<int64_t> hot_keys(0, std::max<int64_t>(1, num_build_rows / 100) - 1);
+        // The keys missed are out of the build keys.
+        std::uniform_int_distribution<int64_t> missed_keys(num_build_rows, 2 * num_build_rows);
+        _probe_chunks.clear();
+        for (int offset = 0; offset < kNumProbeRows; offset += kBenchChunkSize) {
+            std::vector<int64_t> keys(kBenchChunkSize);
+            for (auto& key : keys) {
+                if (percent(_rng) >= match_percent) {
+                    key = missed_keys(_rng);
+                } else if (skewed && percent(_rng) < 90) {
+                    key = hot_keys(_rng);
+                } else {
+                    key = all_keys(_rng);
+                }
+            }
+            _probe_chunks.emplace_back(_create_chunk(keys, 0));
+        }
+    }
+
+    void build(JoinHashTable* hash_table) {
+        hash_table->create(_param);
+        hash_table->append_chunk(_runtime_state.get(), _build_chunk, _build_chunk->columns());
+        CHECK(hash_table->build(_runtime_state.get()).ok());
+    }
+
+    // Probe all the probe chunks, and return the number of rows output.
+    int64_t probe(JoinHashTable* hash_table) {
+        int64_t num_rows = 0;
+        for (const auto& probe_chunk : _probe_chunks) {
+            ChunkPtr chunk = probe_chunk;
+            bool eos = false;
+            while (!eos) {
+                ChunkPtr result = std::make_shared<Chunk>();
+                CHECK(hash_table->probe(_runtime_state.get(), chunk->columns(), &chunk, &result, &eos).ok());
+                num_rows += result->num_rows();
+            }
+        }
+        return num_rows;
+    }
+
+private:
+    // The slots of the probe side begin from 0, and those of the build side from the number of the keys.
+    ChunkPtr _create_chunk(const std::vector<int64_t>& keys, SlotId first_slot) {
+        auto chunk = std::make_shared<Chunk>();
+        for (size_t i = 0; i < _key_types.size(); i++) {
+            chunk->append_column(create_key_column(_key_types[i], keys), first_slot + i);
+        }
+        return chunk;
+    }
+
+    const std::vector<PrimitiveType> _key_types;
+    std::vector<TypeDescriptor> _join_key_types;
+    ObjectPool _object_pool;
+    std::shared_ptr<RuntimeState> _runtime_state;
+    std::shared_ptr<RuntimeProfile> _runtime_profile;
+    std::unique_ptr<RowDescriptor> _row_desc;
+    std::unique_ptr<RowDescriptor> _probe_row_desc;
+    std::unique_ptr<RowDescriptor> _build_row_desc;
+    HashTableParam _param;
+    std::mt19937_64 _rng{20221014};
+
+    ChunkPtr _build_chunk;
+    std::vector<ChunkPtr> _probe_chunks;
+};
+
+// Arguments: the number of build rows.
+static void do_build(benchmark::State& state, JoinKeyLayout layout) {
+    int64_t num_build_rows = state.range(0);
+    if (num_build_rows > max_distinct_keys_of(layout)) {
+        state.SkipWithError("too many build rows for the keys");
+        return;
+    }
+    JoinHashTableBench bench(layout, TJoinOp::INNER_JOIN);
+    bench.prepare_build(num_build_rows);
+    for (auto _ : state) {
+        JoinHashTable hash_table;
+        bench.build(&hash_table);
+        state.PauseTiming();
+        state.counters["mem_usage"] = hash_table.mem_usage();
+        hash_table.close();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * num_build_rows);
+}
+
+// Arguments: the join type, the number of build rows, the percent of the probe rows matched, and whether the
+// probe keys are skewed.
+static void do_probe(benchmark::State& state, JoinKeyLayout layout) {
+    auto join_type = static_cast<TJoinOp::type>(state.range(0));
+    int64_t num_build_rows = state.range(1);
+    if (num_build_rows > max_distinct_keys_of(layout)) {
+        state.SkipWithError("too many build rows for the keys");
+        return;
+    }
+    JoinHashTableBench bench(layout, join_type);
+    bench.prepare_build(num_build_rows);
+    bench.prepare_probe(num_build_rows, state.range(2), state.range(3) != 0);
+    JoinHashTable hash_table;
+    bench.build(&hash_table);
+    int64_t num_output_rows = 0;
+    for (auto _ : state) {
+        num_output_rows += bench.probe(&hash_table);
+    }
+    hash_table.close();
+    state.counters["output_rows"] = benchmark::Counter(num_output_rows, benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations() * kNumProbeRows);
+}
+
+// From a build table fitting in L1 to one in DRAM.
+static const std::vector<int64_t> kBuildRows = {64, 1 << 10, 1 << 14, 1 << 18, 1 << 22};
+
+static void BuildArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"build_rows"});
+    for (int64_t num_build_rows : kBuildRows) {
+        b->Arg(num_build_rows);
+    }
+    b->Unit(benchmark::kMillisecond);
+}
+
+static void ProbeArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"join_type", "build_rows", "match_percent", "skewed"});
+    for (int64_t join_type :
+         {TJoinOp::INNER_JOIN, TJoinOp::LEFT_OUTER_JOIN, TJoinOp::LEFT_SEMI_JOIN, TJoinOp::LEFT_ANTI_JOIN}) {
+        for (int64_t num_build_rows : kBuildRows) {
+            for (int64_t match_percent : {10, 50, 100}) {
+                for (int64_t skewed : {0, 1}) {
+                    b->Args({join_type, num_build_rows, match_percent, skewed});
+                }
+            }
+        }
+    }
+    b->Unit(benchmark::kMillisecond);
+}
+
+#define JOIN_HASH_MAP_BENCH(NAME, LAYOUT)                                             \
+    static void BM_build_##NAME(benchmark::State& state) { do_build(state, LAYOUT); } \
+    static void BM_probe_##NAME(benchmark::State& state) { do_probe(state, LAYOUT); } \
+    BENCHMARK(BM_build_##NAME)->Apply(BuildArgs);                                     \
+    BENCHMARK(BM_probe_##NAME)->Apply(ProbeArgs);
+
+JOIN_HASH_MAP_BENCH(key8, JoinKeyLayout::TINYINT)
+JOIN_HASH_MAP_BENCH(key32, JoinKeyLayout::INT)
+JOIN_HASH_MAP_BENCH(key64, JoinKeyLayout::BIGINT)
+JOIN_HASH_MAP_BENCH(keystring, JoinKeyLayout::VARCHAR)
+JOIN_HASH_MAP_BENCH(fixed64, JoinKeyLayout::INT_INT)
+JOIN_HASH_MAP_BENCH(fixed128, JoinKeyLayout::BIGINT_BIGINT)
+JOIN_HASH_MAP_BENCH(slice, JoinKeyLayout::INT_VARCHAR)
+
+#undef JOIN_HASH_MAP_BENCH
+
+} // namespace starrocks::vectorized
+
+BENCHMARK_MAIN();
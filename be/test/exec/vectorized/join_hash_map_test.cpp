@@ -6,6 +6,7 @@
 
 #include "runtime/descriptor_helper.h"
 #include "runtime/exec_env.h"
+#include "util/threadpool.h"
 
 namespace starrocks::vectorized {
 class JoinHashMapTest : public ::testing::Test {
@@ -820,6 +821,103 @@ TEST_F(JoinHashMapTest, CalcBucketNums) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, ParallelLinkBucketChains) {
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_TRUE(ThreadPoolBuilder("join_build_test").set_max_threads(4).build(&pool).ok());
+
+    const uint32_t row_count = 10000;
+    auto calc_buckets = [](uint32_t bucket_size) {
+        return [bucket_size](uint32_t start, uint32_t count, uint32_t* buckets) {
+            for (uint32_t i = 0; i < count; i++) {
+                uint32_t row = start + i;
+                // Every 7th row has null keys.
+                buckets[i] = row % 7 == 0 ? JoinHashMapHelper::NULL_BUCKET
+                                          : JoinHashMapHelper::calc_bucket_num<int32_t>(row % 1000, bucket_size);
+            }
+        };
+    };
+
+    JoinHashTableItems serial;
+    serial.row_count = row_count;
+    serial.bucket_size = JoinHashMapHelper::calc_bucket_size(row_count + 1);
+    serial.first.resize(serial.bucket_size, 0);
+    serial.next.resize(row_count + 1, 0);
+    Buffer<uint32_t> buckets(row_count + 1);
+    calc_buckets(serial.bucket_size)(1, row_count, buckets.data() + 1);
+    for (uint32_t i = 1; i <= row_count; i++) {
+        if (buckets[i] != JoinHashMapHelper::NULL_BUCKET) {
+            serial.next[i] = serial.first[buckets[i]];
+            serial.first[buckets[i]] = i;
+        }
+    }
+
+    JoinHashTableItems parallel;
+    parallel.row_count = row_count;
+    parallel.bucket_size = serial.bucket_size;
+    parallel.first.resize(parallel.bucket_size, 0);
+    parallel.next.resize(row_count + 1, 0);
+    JoinHashMapHelper::parallel_link_bucket_chains(pool.get(), &parallel, calc_buckets(parallel.bucket_size));
+
+    ASSERT_EQ(serial.first, parallel.first);
+    ASSERT_EQ(serial.next, parallel.next);
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, LookupChainHeadsWithPrefetch) {
+    JoinHashTableItems table_items;
+    table_items.row_count = 1000;
+    table_items.bucket_size = JoinHashMapHelper::calc_bucket_size(table_items.row_count + 1);
+    table_items.first.resize(table_items.bucket_size, 0);
+    for (uint32_t i = 0; i < table_items.bucket_size; i++) {
+        table_items.first[i] = i % 3 == 0 ? 0 : i + 1;
+    }
+
+    const uint32_t probe_row_count = 100;
+    Buffer<uint8_t> is_nulls(probe_row_count);
+    HashTableProbeState probe_state;
+    probe_state.probe_row_count = probe_row_count;
+    probe_state.buckets.resize(probe_row_count);
+    for (uint32_t i = 0; i < probe_row_count; i++) {
+        is_nulls[i] = i % 5 == 0;
+        // The bucket numbers of the null rows are garbage.
+        probe_state.buckets[i] = is_nulls[i] ? UINT32_MAX : (i * 7) % table_items.bucket_size;
+    }
+
+    probe_state.next.resize(probe_row_count);
+    probe_state.prefetch_probe = false;
+    JoinHashMapHelper::lookup_chain_heads(table_items, &probe_state, is_nulls.data());
+    Buffer<uint32_t> expected = probe_state.next;
+
+    auto prefetch_probe_rows = std::make_unique<RuntimeProfile::Counter>(TUnit::UNIT);
+    probe_state.next.assign(probe_row_count, 0);
+    probe_state.prefetch_probe = true;
+    probe_state.prefetch_probe_rows = prefetch_probe_rows.get();
+    JoinHashMapHelper::lookup_chain_heads(table_items, &probe_state, is_nulls.data());
+
+    ASSERT_EQ(expected, probe_state.next);
+    ASSERT_EQ(probe_row_count, prefetch_probe_rows->value());
+    for (uint32_t i = 0; i < probe_row_count; i++) {
+        if (is_nulls[i]) {
+            ASSERT_EQ(0, probe_state.next[i]);
+        } else {
+            ASSERT_EQ(table_items.first[probe_state.buckets[i]], probe_state.next[i]);
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, NeedPrefetchProbe) {
+    JoinHashTableItems table_items;
+    table_items.row_count = 1000;
+    table_items.bucket_size = JoinHashMapHelper::calc_bucket_size(table_items.row_count + 1);
+    ASSERT_FALSE(JoinHashMapHelper::need_prefetch_probe(table_items, sizeof(int64_t)));
+
+    table_items.row_count = 4 * 1024 * 1024;
+    table_items.bucket_size = JoinHashMapHelper::calc_bucket_size(table_items.row_count + 1);
+    ASSERT_TRUE(JoinHashMapHelper::need_prefetch_probe(table_items, sizeof(int64_t)));
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, GetHashKey) {
     auto c1 = JoinHashMapTest::create_int32_column(2, 0);
@@ -1141,6 +1239,148 @@ TEST_F(JoinHashMapTest, DirectMappingJoinBuildProbeFuncNullable) {
     ASSERT_TRUE(result_null == check_null);
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, BitsetJoinBuildProbeFuncForLeftSemiAndAntiJoin) {
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, PrimitiveType::TYPE_INT, true, 1);
+    add_tuple_descriptor(&row_desc_builder, PrimitiveType::TYPE_INT, true, 1);
+
+    auto row_desc = create_row_desc(_object_pool, &row_desc_builder, true);
+    auto probe_row_desc = create_probe_desc(_object_pool, &row_desc_builder, true);
+    auto build_row_desc = create_build_desc(_object_pool, &row_desc_builder, true);
+
+    for (auto join_type : {TJoinOp::LEFT_SEMI_JOIN, TJoinOp::LEFT_ANTI_JOIN}) {
+        HashTableParam param;
+        param.need_create_tuple_columns = false;
+        param.with_other_conjunct = false;
+        param.join_type = join_type;
+        param.row_desc = row_desc.get();
+        param.probe_row_desc = probe_row_desc.get();
+        param.build_row_desc = build_row_desc.get();
+        param.output_slots.emplace(0);
+        param.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+        param.search_ht_timer = ADD_TIMER(_runtime_profile, "search_ht");
+        param.output_build_column_timer = ADD_TIMER(_runtime_profile, "output_build_column");
+        param.output_probe_column_timer = ADD_TIMER(_runtime_profile, "output_probe_column");
+        param.output_tuple_column_timer = ADD_TIMER(_runtime_profile, "output_tuple_column");
+
+        JoinHashTable ht;
+
+        // build chunk
+        auto build_chunk = std::make_shared<Chunk>();
+        auto build_data_column = Int32Column::create();
+        auto build_null_column = NullColumn::create();
+        build_data_column->append({100, 103, 0, 110, 131});
+        build_null_column->append({0, 0, 1, 0, 0});
+        build_chunk->append_column(NullableColumn::create(build_data_column, build_null_column), 1);
+
+        // probe chunk of 95, ..., 114, whose 103 and 105 are null, more than a batch of 8 keys
+        auto probe_chunk = std::make_shared<Chunk>();
+        auto probe_data_column = Int32Column::create();
+        auto probe_null_column = NullColumn::create();
+        for (int32_t i = 95; i < 115; i++) {
+            probe_data_column->append(i);
+            probe_null_column->append(i == 103 || i == 105);
+        }
+        auto probe_column = NullableColumn::create(probe_data_column, probe_null_column);
+        probe_chunk->append_column(probe_column, 0);
+        Columns probe_key_columns = {probe_column};
+
+        ChunkPtr result_chunk = std::make_shared<Chunk>();
+        bool eos = false;
+
+        ht.create(param);
+        Columns key_columns{build_chunk->columns()[0]};
+        ht.append_chunk(_runtime_state.get(), build_chunk, key_columns);
+        ht.build(_runtime_state.get());
+        // The bitset replaces the buckets.
+        ASSERT_EQ(0, ht.get_bucket_size());
+        ht.probe(_runtime_state.get(), probe_key_columns, &probe_chunk, &result_chunk, &eos);
+
+        auto* result_column = down_cast<NullableColumn*>(result_chunk->get_column_by_slot_id(0).get());
+        std::vector<int32_t> result_data;
+        size_t num_null_rows = 0;
+        for (size_t i = 0; i < result_column->size(); i++) {
+            if (result_column->is_null(i)) {
+                num_null_rows++;
+            } else {
+                result_data.push_back(down_cast<Int32Column*>(result_column->data_column().get())->get_data()[i]);
+            }
+        }
+        std::sort(result_data.begin(), result_data.end());
+        if (join_type == TJoinOp::LEFT_SEMI_JOIN) {
+            ASSERT_EQ(std::vector<int32_t>({100, 110}), result_data);
+            ASSERT_EQ(0, num_null_rows);
+        } else {
+            std::vector<int32_t> check_data;
+            for (int32_t i = 95; i < 115; i++) {
+                if (i != 100 && i != 103 && i != 105 && i != 110) {
+                    check_data.push_back(i);
+                }
+            }
+            ASSERT_EQ(check_data, result_data);
+            ASSERT_EQ(2, num_null_rows);
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, FindHeavyHitters) {
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, PrimitiveType::TYPE_INT, true, 1);
+    add_tuple_descriptor(&row_desc_builder, PrimitiveType::TYPE_INT, true, 1);
+
+    auto row_desc = create_row_desc(_object_pool, &row_desc_builder, true);
+    auto probe_row_desc = create_probe_desc(_object_pool, &row_desc_builder, true);
+    auto build_row_desc = create_build_desc(_object_pool, &row_desc_builder, true);
+
+    HashTableParam param;
+    param.need_create_tuple_columns = false;
+    param.with_other_conjunct = false;
+    param.join_type = TJoinOp::INNER_JOIN;
+    param.row_desc = row_desc.get();
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+    param.output_slots.emplace(0);
+    param.output_slots.emplace(1);
+    param.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+    param.search_ht_timer = ADD_TIMER(_runtime_profile, "search_ht");
+    param.output_build_column_timer = ADD_TIMER(_runtime_profile, "output_build_column");
+    param.output_probe_column_timer = ADD_TIMER(_runtime_profile, "output_probe_column");
+    param.output_tuple_column_timer = ADD_TIMER(_runtime_profile, "output_tuple_column");
+
+    // 6 rows of 7 from row 1 and 3 rows of 3 from row 2, the null row of 7 is not a key.
+    auto build_chunk = std::make_shared<Chunk>();
+    auto build_data_column = Int32Column::create();
+    auto build_null_column = NullColumn::create();
+    build_data_column->append({7, 3, 7, 1, 7, 3, 2, 7, 7, 7, 4, 7, 3});
+    build_null_column->append({0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0});
+    build_chunk->append_column(NullableColumn::create(build_data_column, build_null_column), 1);
+
+    JoinHashTable ht;
+    ht.create(param);
+    Columns key_columns{build_chunk->columns()[0]};
+    ht.append_chunk(_runtime_state.get(), build_chunk, key_columns);
+    ht.build(_runtime_state.get());
+
+    auto heavy_hitters = ht.find_heavy_hitters(8, 2);
+    ASSERT_EQ(2, heavy_hitters.size());
+    ASSERT_EQ(1, heavy_hitters[0].row);
+    ASSERT_EQ(6, heavy_hitters[0].num_rows);
+    ASSERT_EQ(2, heavy_hitters[1].row);
+    ASSERT_EQ(3, heavy_hitters[1].num_rows);
+
+    heavy_hitters = ht.find_heavy_hitters(1, 2);
+    ASSERT_EQ(1, heavy_hitters.size());
+    ASSERT_EQ(6, heavy_hitters[0].num_rows);
+
+    heavy_hitters = ht.find_heavy_hitters(8, 4);
+    ASSERT_EQ(1, heavy_hitters.size());
+    ASSERT_EQ(1, heavy_hitters[0].row);
+
+    ASSERT_TRUE(ht.find_heavy_hitters(8, 7).empty());
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, FixedSizeJoinBuildProbeFunc) {
     JoinHashTableItems table_items;
@@ -1193,6 +1433,70 @@ TEST_F(JoinHashMapTest, FixedSizeJoinBuildProbeFunc) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, FixedSizeJoinBuildProbeFuncWithPackedStringKey) {
+    JoinHashTableItems table_items;
+    HashTableProbeState probe_state;
+    auto runtime_state = create_runtime_state();
+    runtime_state->init_instance_mem_tracker();
+
+    // The build keys are (i, "k" + i) of i in [0, 10), so that the strings are packed into 1 + 2 bytes.
+    auto build_column1 = ColumnHelper::create_column(_int_type, false);
+    build_column1->append_default();
+    build_column1->append(*JoinHashMapTest::create_int32_column(10, 0), 0, 10);
+    auto build_column2 = BinaryColumn::create();
+    build_column2->append_default();
+    for (int i = 0; i < 10; i++) {
+        build_column2->append(Slice("k" + std::to_string(i)));
+    }
+
+    // The probe rows 0~4 match, 5 has another string, 6 is its prefix, and 7 is too long to be packed.
+    auto probe_column1 = JoinHashMapTest::create_int32_column(8, 0);
+    auto probe_column2 = BinaryColumn::create();
+    for (int i = 0; i < 5; i++) {
+        probe_column2->append(Slice("k" + std::to_string(i)));
+    }
+    probe_column2->append(Slice("x5"));
+    probe_column2->append(Slice("k"));
+    probe_column2->append(Slice("k7k7"));
+
+    table_items.first.resize(16, 0);
+    table_items.key_columns.emplace_back(build_column1);
+    table_items.key_columns.emplace_back(build_column2);
+    table_items.bucket_size = 16;
+    table_items.row_count = 10;
+    table_items.next.resize(11);
+    table_items.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+    table_items.join_keys.emplace_back(JoinKeyDesc{&_varchar_type, false, nullptr});
+    table_items.key_string_max_lengths = {-1, 2};
+    probe_state.probe_row_count = 8;
+    probe_state.buckets.resize(config::vector_chunk_size);
+    probe_state.next.resize(config::vector_chunk_size, 0);
+    Columns probe_columns{probe_column1, probe_column2};
+    probe_state.key_columns = &probe_columns;
+
+    FixedSizeJoinBuildFunc<TYPE_BIGINT>::prepare(runtime_state.get(), &table_items);
+    FixedSizeJoinProbeFunc<TYPE_BIGINT>::prepare(runtime_state.get(), &probe_state);
+    FixedSizeJoinBuildFunc<TYPE_BIGINT>::construct_hash_table(runtime_state.get(), &table_items, &probe_state);
+    FixedSizeJoinProbeFunc<TYPE_BIGINT>::lookup_init(table_items, &probe_state);
+
+    const auto& build_data = ColumnHelper::as_raw_column<Int64Column>(table_items.build_key_column)->get_data();
+    const auto& probe_data = ColumnHelper::as_raw_column<Int64Column>(probe_state.probe_key_column)->get_data();
+    for (size_t i = 0; i < 8; i++) {
+        size_t found_count = 0;
+        size_t probe_index = probe_state.next[i];
+        while (probe_index != 0) {
+            if (probe_data[i] == build_data[probe_index]) {
+                ASSERT_EQ(i + 1, probe_index);
+                found_count++;
+            }
+            probe_index = table_items.next[probe_index];
+        }
+        ASSERT_EQ(i < 5 ? 1 : 0, found_count) << i;
+    }
+    ASSERT_EQ(0, probe_state.next[7]);
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, FixedSizeJoinBuildProbeFuncNullable) {
     auto runtime_state = create_runtime_state();
@@ -846,6 +846,63 @@ TEST_F(JsonScannerTest, test_construct_row_in_object_order) {
     EXPECT_EQ("[NULL, '3.14', NULL, '1', NULL, '123', NULL, 3.14, NULL, 123, NULL]", chunk->debug_row(0));
 }
 
+TEST_F(JsonScannerTest, test_construct_row_in_slot_order_with_unordered_keys) {
+    std::vector<TypeDescriptor> types{TypeDescriptor(TYPE_INT), TypeDescriptor(TYPE_INT), TypeDescriptor(TYPE_INT)};
+
+    std::vector<TBrokerRangeDesc> ranges;
+    TBrokerRangeDesc range;
+    range.format_type = TFileFormatType::FORMAT_JSON;
+    range.strip_outer_array = false;
+    range.__isset.strip_outer_array = false;
+    range.__isset.jsonpaths = false;
+    range.__isset.json_root = false;
+    range.__set_path("./be/test/exec/test_data/json_scanner/test_unordered_ndjson.json");
+    ranges.emplace_back(range);
+
+    auto scanner = create_json_scanner(types, ranges, {"k1", "k2", "k3"});
+
+    Status st;
+    st = scanner->open();
+    ASSERT_TRUE(st.ok());
+
+    ChunkPtr chunk = scanner->get_next().value();
+    EXPECT_EQ(3, chunk->num_columns());
+    EXPECT_EQ(3, chunk->num_rows());
+
+    EXPECT_EQ("[1, 2, 3]", chunk->debug_row(0));
+    EXPECT_EQ("[10, 20, 30]", chunk->debug_row(1));
+    EXPECT_EQ("[100, 200, NULL]", chunk->debug_row(2));
+}
+
+TEST_F(JsonScannerTest, test_construct_row_in_object_order_with_sparse_keys) {
+    std::vector<TypeDescriptor> types{TypeDescriptor(TYPE_INT), TypeDescriptor(TYPE_INT), TypeDescriptor(TYPE_INT)};
+
+    std::vector<TBrokerRangeDesc> ranges;
+    TBrokerRangeDesc range;
+    range.format_type = TFileFormatType::FORMAT_JSON;
+    range.strip_outer_array = false;
+    range.__isset.strip_outer_array = false;
+    range.__isset.jsonpaths = false;
+    range.__isset.json_root = false;
+    range.__set_path("./be/test/exec/test_data/json_scanner/test_sparse_ndjson.json");
+    ranges.emplace_back(range);
+
+    auto scanner = create_json_scanner(types, ranges, {"k1", "k2", "k3"});
+
+    Status st;
+    st = scanner->open();
+    ASSERT_TRUE(st.ok());
+
+    ChunkPtr chunk = scanner->get_next().value();
+    EXPECT_EQ(3, chunk->num_columns());
+    EXPECT_EQ(3, chunk->num_rows());
+
+    // The first one of the duplicated keys is taken.
+    EXPECT_EQ("[1, NULL, NULL]", chunk->debug_row(0));
+    EXPECT_EQ("[1, 2, NULL]", chunk->debug_row(1));
+    EXPECT_EQ("[NULL, NULL, NULL]", chunk->debug_row(2));
+}
+
 TEST_F(JsonScannerTest, test_jsonroot_with_jsonpath) {
     std::vector<TypeDescriptor> types;
     types.emplace_back(TypeDescriptor::create_varchar_type(20));
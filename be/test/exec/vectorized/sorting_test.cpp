@@ -258,6 +258,61 @@ TEST(SortingTest, merge_sorted_chunks) {
     ASSERT_TRUE(output.is_sorted(sort_desc));
 }
 
+TEST(SortingTest, split_sorted_runs) {
+    Chunk::SlotHashMap slot_map{{0, 0}};
+    std::vector<std::unique_ptr<ColumnRef>> exprs;
+    std::vector<ExprContext*> sort_exprs;
+    exprs.push_back(std::make_unique<ColumnRef>(TypeDescriptor(TYPE_INT), 0));
+    sort_exprs.push_back(new ExprContext(exprs.back().get()));
+    DeferOp defer([&]() { clear_exprs(sort_exprs); });
+    SortDescs sort_desc(std::vector<int>{1}, std::vector<int>{-1});
+
+    // Each run has several chunks of sorted values with many duplicates.
+    std::mt19937 rand(0);
+    std::vector<SortedRuns> runs_batch(3);
+    size_t total_rows = 0;
+    for (auto& runs : runs_batch) {
+        std::vector<int32_t> values(1000 + rand() % 1000);
+        for (auto& value : values) {
+            value = rand() % 100;
+        }
+        std::sort(values.begin(), values.end());
+        for (size_t begin = 0; begin < values.size(); begin += 300) {
+            ColumnPtr column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false);
+            for (size_t i = begin; i < std::min(begin + 300, values.size()); i++) {
+                column->append_datum(Datum(values[i]));
+            }
+            runs.chunks.emplace_back(std::make_shared<Chunk>(Columns{column}, slot_map), &sort_exprs);
+        }
+        total_rows += values.size();
+    }
+
+    std::vector<std::vector<SortedRuns>> ranges;
+    split_sorted_runs(sort_desc, runs_batch, 4, &ranges);
+    ASSERT_GT(ranges.size(), 1);
+    ASSERT_LE(ranges.size(), 4);
+
+    size_t merged_rows = 0;
+    int32_t last_max = -1;
+    for (auto& range : ranges) {
+        SortedRuns merged;
+        ASSERT_OK(merge_sorted_chunks(sort_desc, &sort_exprs, range, &merged, 0));
+        ASSERT_TRUE(merged.is_sorted(sort_desc));
+        ChunkPtr chunk = merged.assemble();
+        ASSERT_TRUE(chunk != nullptr);
+        const Column* column = chunk->get_column_by_index(0).get();
+        // The rows equal to each other are in the same range.
+        ASSERT_LT(last_max, column->get(0).get_int32());
+        last_max = column->get(chunk->num_rows() - 1).get_int32();
+        merged_rows += chunk->num_rows();
+    }
+    ASSERT_EQ(total_rows, merged_rows);
+
+    split_sorted_runs(sort_desc, runs_batch, 1, &ranges);
+    ASSERT_EQ(1, ranges.size());
+    ASSERT_EQ(runs_batch.size(), ranges[0].size());
+}
+
 TEST(SortingTest, merge_sorted_stream) {
     constexpr int num_columns = 3;
     constexpr int num_runs = 4;
@@ -325,4 +380,69 @@ TEST(SortingTest, merge_sorted_stream) {
     }
 }
 
+// The chunks of the runs arrive at different paces, the merger must wait for the late ones rather than output
+// the rows of the others before them.
+TEST(SortingTest, merge_sorted_stream_with_late_chunks) {
+    constexpr int num_runs = 3;
+    constexpr int num_chunks_per_run = 5;
+    constexpr int num_rows_per_chunk = 10;
+    TypeDescriptor type_desc = TypeDescriptor(TYPE_INT);
+    ColumnRef expr(type_desc, 0);
+    std::vector<ExprContext*> sort_exprs{new ExprContext(&expr)};
+    DeferOp defer([&]() { clear_exprs(sort_exprs); });
+    SortDescs sort_desc(std::vector<int>{1}, std::vector<int>{-1});
+    Chunk::SlotHashMap map{{0, 0}};
+
+    // Run r has the values of r modulo num_runs in order, so all the values are merged into [0, total_rows).
+    std::vector<int> num_arrived(num_runs, 0);
+    std::vector<int> num_fetched(num_runs, 0);
+    std::vector<std::unique_ptr<SimpleChunkSortCursor>> cursors;
+    for (int run = 0; run < num_runs; run++) {
+        ChunkProvider provider = [&, run](ChunkUniquePtr* output, bool* eos) -> bool {
+            if (output == nullptr || eos == nullptr) {
+                return num_arrived[run] > 0;
+            }
+            if (num_fetched[run] == num_chunks_per_run) {
+                *eos = true;
+                return false;
+            }
+            if (num_fetched[run] == num_arrived[run]) {
+                return false;
+            }
+            int start = (num_fetched[run]++ * num_rows_per_chunk) * num_runs + run;
+            Columns columns{build_sorted_column(type_desc, 0, start, num_rows_per_chunk, num_runs)};
+            *output = std::make_unique<Chunk>(columns, map);
+            return true;
+        };
+        cursors.push_back(std::make_unique<SimpleChunkSortCursor>(std::move(provider), &sort_exprs));
+    }
+    MergeCursorsCascade merger;
+    ASSERT_OK(merger.init(sort_desc, std::move(cursors)));
+
+    std::vector<int32_t> output;
+    for (int step = 1; !merger.is_eos(); step++) {
+        ASSERT_LT(step, 1000);
+        // Run r has a new chunk every r + 1 steps.
+        for (int run = 0; run < num_runs; run++) {
+            if (step % (run + 1) == 0 && num_arrived[run] < num_chunks_per_run) {
+                num_arrived[run]++;
+            }
+        }
+        if (!merger.is_data_ready()) {
+            continue;
+        }
+        ChunkUniquePtr chunk = merger.try_get_next();
+        if (chunk == nullptr) {
+            continue;
+        }
+        for (int i = 0; i < chunk->num_rows(); i++) {
+            output.push_back(chunk->get_column_by_index(0)->get(i).get_int32());
+        }
+    }
+    ASSERT_EQ(num_runs * num_chunks_per_run * num_rows_per_chunk, output.size());
+    for (int i = 0; i < output.size(); i++) {
+        ASSERT_EQ(i, output[i]);
+    }
+}
+
 } // namespace starrocks::vectorized
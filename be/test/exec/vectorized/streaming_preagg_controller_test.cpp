@@ -0,0 +1,85 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exec/vectorized/aggregate/streaming_preagg_controller.h"
+
+#include <gtest/gtest.h>
+
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+
+namespace starrocks::vectorized {
+
+class StreamingPreaggControllerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _window_rows = config::streaming_preagg_adaptive_window_rows;
+        _sample_rows = config::streaming_preagg_adaptive_sample_rows;
+        _limited_ht_bytes = config::streaming_preagg_limited_ht_bytes;
+        config::streaming_preagg_adaptive_window_rows = 4 * kChunkSize;
+        config::streaming_preagg_adaptive_sample_rows = kChunkSize;
+    }
+
+    void TearDown() override {
+        config::streaming_preagg_adaptive_window_rows = _window_rows;
+        config::streaming_preagg_adaptive_sample_rows = _sample_rows;
+        config::streaming_preagg_limited_ht_bytes = _limited_ht_bytes;
+    }
+
+    // The keys of the chunk are [start, start + kChunkSize) % ndv.
+    static Columns make_keys(int32_t start, int32_t ndv) {
+        auto column = Int32Column::create();
+        for (int32_t i = 0; i < kChunkSize; i++) {
+            column->append((start + i) % ndv);
+        }
+        return {column};
+    }
+
+    static constexpr int32_t kChunkSize = 4096;
+
+    RuntimeProfile _profile{"test"};
+    int64_t _window_rows = 0;
+    int64_t _sample_rows = 0;
+    int64_t _limited_ht_bytes = 0;
+};
+
+TEST_F(StreamingPreaggControllerTest, test_pass_through_unique_keys) {
+    StreamingPreaggController controller(&_profile);
+    using Mode = StreamingPreaggController::Mode;
+    // Every row adds a key to the hash table in the first window.
+    for (int i = 0; i < 4; i++) {
+        ASSERT_EQ(Mode::PREAGGREGATE, controller.next_mode(make_keys(i * kChunkSize, INT32_MAX), kChunkSize,
+                                                           (i + 1) * kChunkSize, 0));
+    }
+    for (int i = 4; i < 12; i++) {
+        ASSERT_EQ(Mode::PASS_THROUGH, controller.next_mode(make_keys(i * kChunkSize, INT32_MAX), kChunkSize,
+                                                           4 * kChunkSize, 0));
+    }
+}
+
+TEST_F(StreamingPreaggControllerTest, test_preaggregate_low_ndv) {
+    StreamingPreaggController controller(&_profile);
+    using Mode = StreamingPreaggController::Mode;
+    // The hash table exceeds the limit, but the keys are repeated a lot, so it's expanded anyway.
+    config::streaming_preagg_limited_ht_bytes = 0;
+    ASSERT_EQ(Mode::SELECTIVE, controller.next_mode(make_keys(0, 16), kChunkSize, 0, 1024));
+    for (int i = 1; i < 12; i++) {
+        ASSERT_EQ(i < 4 ? Mode::SELECTIVE : Mode::PREAGGREGATE,
+                  controller.next_mode(make_keys(i * kChunkSize, 16), kChunkSize, 16, 1024));
+    }
+}
+
+TEST_F(StreamingPreaggControllerTest, test_limited_medium_ndv) {
+    StreamingPreaggController controller(&_profile);
+    using Mode = StreamingPreaggController::Mode;
+    config::streaming_preagg_limited_ht_bytes = 1024 * 1024;
+    // Every two chunks have the same keys, and the hash table stays within the limit.
+    for (int i = 0; i < 12; i++) {
+        ASSERT_EQ(Mode::PREAGGREGATE, controller.next_mode(make_keys(i / 2 * kChunkSize, INT32_MAX), kChunkSize,
+                                                           (i + 1) / 2 * kChunkSize, 1024));
+    }
+    // The hash table reaches the limit.
+    ASSERT_EQ(Mode::SELECTIVE,
+              controller.next_mode(make_keys(6 * kChunkSize, INT32_MAX), kChunkSize, 6 * kChunkSize, 1024 * 1024));
+}
+
+} // namespace starrocks::vectorized
@@ -754,6 +754,32 @@ TEST_F(AggregateTest, test_count_distinct) {
     test_agg_function<DateValue, int64_t>(ctx, func, 20, 21, 40);
 }
 
+TEST_F(AggregateTest, test_count_distinct_partitioned) {
+    const AggregateFunction* func = get_aggregate_function("multi_distinct_count3", TYPE_SMALLINT, TYPE_BIGINT, false);
+    test_agg_function<int16_t, int64_t>(ctx, func, 1024, 1000, 2024);
+
+    func = get_aggregate_function("multi_distinct_count3", TYPE_INT, TYPE_BIGINT, false);
+    test_agg_function<int32_t, int64_t>(ctx, func, 1024, 1000, 2024);
+
+    func = get_aggregate_function("multi_distinct_count3", TYPE_BIGINT, TYPE_BIGINT, false);
+    test_agg_function<int64_t, int64_t>(ctx, func, 1024, 1000, 2024);
+
+    func = get_aggregate_function("multi_distinct_count3", TYPE_LARGEINT, TYPE_BIGINT, false);
+    test_agg_function<int128_t, int64_t>(ctx, func, 1024, 1000, 2024);
+
+    func = get_aggregate_function("multi_distinct_count3", TYPE_DOUBLE, TYPE_BIGINT, false);
+    test_agg_function<double, int64_t>(ctx, func, 1024, 1000, 2024);
+
+    func = get_aggregate_function("multi_distinct_count3", TYPE_VARCHAR, TYPE_BIGINT, false);
+    test_agg_function<Slice, int64_t>(ctx, func, 3, 3, 6);
+
+    func = get_aggregate_function("multi_distinct_count3", TYPE_DATETIME, TYPE_BIGINT, false);
+    test_agg_function<TimestampValue, int64_t>(ctx, func, 20, 21, 40);
+
+    func = get_aggregate_function("multi_distinct_count3", TYPE_DATE, TYPE_BIGINT, false);
+    test_agg_function<DateValue, int64_t>(ctx, func, 20, 21, 40);
+}
+
 TEST_F(AggregateTest, test_sum_distinct) {
     const AggregateFunction* func = get_aggregate_function("multi_distinct_sum", TYPE_SMALLINT, TYPE_BIGINT, false);
     test_agg_function<int16_t, int64_t>(ctx, func, 523776, 2499500, 3023276);
@@ -919,6 +945,40 @@ TEST_F(AggregateTest, test_dict_merge) {
     ASSERT_TRUE(origin_data.empty());
 }
 
+TEST_F(AggregateTest, test_maxmin_removable_cumulatively) {
+    // rows between 2 preceding and 1 following
+    const int64_t rows_start_offset = -2;
+    const int64_t rows_end_offset = 1;
+    auto data_column = Int32Column::create();
+    for (int32_t v : {5, 3, 9, 9, 1, 0, 7, 2, 8, 8, 8, -4, -6, 3}) {
+        data_column->append(v);
+    }
+    const Column* column = data_column.get();
+    const int64_t num_rows = data_column->size();
+
+    for (const std::string& name : {"max", "min"}) {
+        const AggregateFunction* func = get_aggregate_function(name, TYPE_INT, TYPE_INT, false);
+        auto state = ManagedAggrState::create(ctx, func);
+        func->update_batch_single_state_with_frame(ctx, state->state(), &column, -1, -1, 0, rows_end_offset + 1);
+        for (int64_t row = 0; row < num_rows; ++row) {
+            if (row > 0) {
+                func->update_state_removable_cumulatively(ctx, state->state(), &column, row, 0, num_rows,
+                                                          rows_start_offset, rows_end_offset, false, false);
+            }
+            auto expected_state = ManagedAggrState::create(ctx, func);
+            func->update_batch_single_state_with_frame(ctx, expected_state->state(), &column, -1, -1,
+                                                       std::max<int64_t>(row + rows_start_offset, 0),
+                                                       std::min<int64_t>(row + rows_end_offset + 1, num_rows));
+
+            auto result = Int32Column::create();
+            auto expected = Int32Column::create();
+            func->finalize_to_column(ctx, state->state(), result.get());
+            func->finalize_to_column(ctx, expected_state->state(), expected.get());
+            ASSERT_EQ(expected->get_data()[0], result->get_data()[0]) << name << " row " << row;
+        }
+    }
+}
+
 TEST_F(AggregateTest, test_sum_nullable) {
     using NullableSumInt64 = NullableAggregateFunctionState<SumAggregateState<int64_t>, false>;
     const AggregateFunction* sum_null = get_aggregate_function("sum", TYPE_INT, TYPE_BIGINT, true);
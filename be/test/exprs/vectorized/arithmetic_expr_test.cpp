@@ -188,6 +188,35 @@ TEST_F(VectorizedArithmeticExprTest, nullMulExpr) {
     }
 }
 
+TEST_F(VectorizedArithmeticExprTest, reuseIntermediateColumn) {
+    // (c1 * 2) + c1, the column of c1 is shared and must not be changed.
+    auto c1 = Int32Column::create();
+    for (int32_t i = 0; i < 10; ++i) {
+        c1->append(i);
+    }
+    MockExpr ref(expr_node, c1);
+    MockConstVectorizedExpr<TYPE_INT> two(expr_node, 2);
+
+    expr_node.opcode = TExprOpcode::MULTIPLY;
+    std::unique_ptr<Expr> mul(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+    mul->_children.push_back(&ref);
+    mul->_children.push_back(&two);
+
+    expr_node.opcode = TExprOpcode::ADD;
+    std::unique_ptr<Expr> add(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+    add->_children.push_back(mul.get());
+    add->_children.push_back(&ref);
+
+    ColumnPtr ptr = add->evaluate(nullptr, nullptr);
+    ASSERT_NE(c1.get(), ptr.get());
+    auto v = std::static_pointer_cast<Int32Column>(ptr);
+    ASSERT_EQ(10, v->size());
+    for (int32_t j = 0; j < v->size(); ++j) {
+        ASSERT_EQ(j * 3, v->get_data()[j]);
+        ASSERT_EQ(j, c1->get_data()[j]);
+    }
+}
+
 TEST_F(VectorizedArithmeticExprTest, divExpr) {
     expr_node.opcode = TExprOpcode::DIVIDE;
     std::unique_ptr<Expr> expr(VectorizedArithmeticExprFactory::from_thrift(expr_node));
@@ -1035,6 +1035,36 @@ TEST_F(ArrayFunctionsTest, array_position_has_null_element) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(ArrayFunctionsTest, array_position_const_target) {
+    // array_position([1, NULL, 3], 3): 3
+    // array_position([NULL], 3): 0
+    // array_position([], 3): 0
+    // array_position([3, 3], 3): 1
+    // array_position([2], 3): 0
+    auto array = ColumnHelper::create_column(TYPE_ARRAY_INT, false);
+    array->append_datum(DatumArray{(int32_t)1, Datum{}, (int32_t)3});
+    array->append_datum(DatumArray{Datum{}});
+    array->append_datum(DatumArray{});
+    array->append_datum(DatumArray{(int32_t)3, (int32_t)3});
+    array->append_datum(DatumArray{(int32_t)2});
+
+    auto target = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false, true, 0);
+    for (int i = 0; i < 5; i++) {
+        target->append_datum(Datum{(int32_t)3});
+    }
+
+    auto positions = ArrayFunctions::array_position(nullptr, {array, target});
+    auto contains = ArrayFunctions::array_contains(nullptr, {array, target});
+    ASSERT_EQ(5, positions->size());
+    ASSERT_EQ(5, contains->size());
+    std::vector<int32_t> expected_positions{3, 0, 0, 1, 0};
+    for (size_t i = 0; i < 5; i++) {
+        EXPECT_EQ(expected_positions[i], positions->get(i).get_int32()) << i;
+        EXPECT_EQ(expected_positions[i] > 0, contains->get(i).get_int8()) << i;
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(ArrayFunctionsTest, array_position_has_null_target) {
     // array_position(["abc", "def"], NULL): 0
@@ -0,0 +1,92 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exprs/vectorized/common_expr_eliminator.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "exprs/expr_context.h"
+#include "exprs/vectorized/arithmetic_expr.h"
+#include "exprs/vectorized/column_ref.h"
+#include "testutil/assert.h"
+
+namespace starrocks::vectorized {
+
+class CommonExprEliminatorTest : public ::testing::Test {
+protected:
+    Expr* new_add(Expr* left, Expr* right) {
+        TExprNode node;
+        node.node_type = TExprNodeType::ARITHMETIC_EXPR;
+        node.opcode = TExprOpcode::ADD;
+        node.__isset.opcode = true;
+        node.child_type = TPrimitiveType::INT;
+        node.__isset.child_type = true;
+        node.type = gen_type_desc(TPrimitiveType::INT);
+        node.num_children = 2;
+        Expr* expr = _pool.add(VectorizedArithmeticExprFactory::from_thrift(node));
+        expr->add_child(left);
+        expr->add_child(right);
+        return expr;
+    }
+
+    Expr* new_ref(SlotId slot_id) { return _pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), slot_id)); }
+
+    ObjectPool _pool;
+};
+
+// NOLINTNEXTLINE
+TEST_F(CommonExprEliminatorTest, test_rewrite_and_evaluate) {
+    // (c1 + c2) + c1, (c1 + c2) + c2 and c1 + c1
+    std::vector<ExprContext*> ctxs{
+            _pool.add(new ExprContext(new_add(new_add(new_ref(1), new_ref(2)), new_ref(1)))),
+            _pool.add(new ExprContext(new_add(new_add(new_ref(1), new_ref(2)), new_ref(2)))),
+            _pool.add(new ExprContext(new_add(new_ref(1), new_ref(1))))};
+
+    CommonExprEliminator eliminator;
+    ASSERT_OK(eliminator.rewrite(&_pool, ctxs, 100));
+    ASSERT_FALSE(eliminator.empty());
+    for (int i = 0; i < 2; i++) {
+        auto* ref = dynamic_cast<ColumnRef*>(ctxs[i]->root()->get_child(0));
+        ASSERT_TRUE(ref != nullptr);
+        ASSERT_EQ(100, ref->slot_id());
+    }
+    ASSERT_TRUE(dynamic_cast<ColumnRef*>(ctxs[2]->root()->get_child(0)) != nullptr);
+    ASSERT_EQ(1, down_cast<ColumnRef*>(ctxs[2]->root()->get_child(0))->slot_id());
+
+    auto c1 = Int32Column::create();
+    auto c2 = Int32Column::create();
+    for (int32_t i = 0; i < 10; i++) {
+        c1->append(i);
+        c2->append(i * 10);
+    }
+    Chunk chunk;
+    chunk.append_column(c1, 1);
+    chunk.append_column(c2, 2);
+
+    ASSERT_OK(eliminator.evaluate(&chunk));
+    ASSERT_EQ(3, chunk.num_columns());
+    ASSIGN_OR_ABORT(auto result0, ctxs[0]->evaluate(&chunk));
+    ASSIGN_OR_ABORT(auto result1, ctxs[1]->evaluate(&chunk));
+    for (int32_t i = 0; i < 10; i++) {
+        ASSERT_EQ(i * 12, result0->get(i).get_int32());
+        ASSERT_EQ(i * 21, result1->get(i).get_int32());
+    }
+
+    eliminator.remove_columns(&chunk);
+    ASSERT_EQ(2, chunk.num_columns());
+    ASSERT_FALSE(chunk.is_slot_exist(100));
+    ASSERT_EQ(c2.get(), chunk.get_column_by_slot_id(2).get());
+}
+
+// NOLINTNEXTLINE
+TEST_F(CommonExprEliminatorTest, test_no_common_expr) {
+    std::vector<ExprContext*> ctxs{_pool.add(new ExprContext(new_add(new_ref(1), new_ref(2)))),
+                                   _pool.add(new ExprContext(new_add(new_ref(2), new_ref(1))))};
+
+    CommonExprEliminator eliminator;
+    ASSERT_OK(eliminator.rewrite(&_pool, ctxs, 100));
+    ASSERT_TRUE(eliminator.empty());
+}
+
+} // namespace starrocks::vectorized
@@ -2837,4 +2837,33 @@ TEST_F(DecimalBinaryFunctionTest, test_decimal128p38s14_div_decimal128p38s14_eq_
     test_vector_vector_assert_overflow<TYPE_DECIMAL128, DivOp, true>(test_case_array, 38, 14, 38, 14, 38, 14,
                                                                      overflows);
 }
+
+TEST_F(DecimalBinaryFunctionTest, test_decimal128_mul_overflow_checked_per_chunk) {
+    using Function = UnpackConstColumnDecimalBinaryFunction<MulOp, true>;
+    auto lhs = Decimal128Column::create(38, 2);
+    auto rhs = Decimal128Column::create(38, 2);
+    for (int i = 0; i < 100; i++) {
+        lhs->append(int128_t(i) * 100);
+        rhs->append(int128_t(-i) * 100);
+    }
+
+    // The magnitudes of the chunk cannot overflow, so no element is checked.
+    ColumnPtr result = Function::evaluate<TYPE_DECIMAL128, TYPE_DECIMAL128, TYPE_DECIMAL128>(lhs, rhs);
+    ASSERT_FALSE(result->is_nullable());
+    auto& values = ColumnHelper::cast_to_raw<TYPE_DECIMAL128>(result)->get_data();
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(int128_t(-i) * i * 10000, values[i]);
+    }
+
+    // One large value makes the whole chunk checked, only the overflowing element is null.
+    lhs->append(get_max<int128_t>() / 2);
+    rhs->append(int128_t(300));
+    result = Function::evaluate<TYPE_DECIMAL128, TYPE_DECIMAL128, TYPE_DECIMAL128>(lhs, rhs);
+    ASSERT_TRUE(result->is_nullable());
+    for (int i = 0; i < 100; i++) {
+        ASSERT_FALSE(result->is_null(i));
+        ASSERT_EQ(int128_t(-i) * i * 10000, result->get(i).get_int128());
+    }
+    ASSERT_TRUE(result->is_null(100));
+}
 } // namespace starrocks::vectorized
\ No newline at end of file
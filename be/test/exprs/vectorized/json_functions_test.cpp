@@ -471,6 +471,43 @@ TEST_P(JsonQueryTestFixture, json_query) {
                         .ok());
 }
 
+// NOLINTNEXTLINE
+TEST_F(JsonFunctionsTest, json_query_variable_path) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    auto jsons = JsonColumn::create();
+    auto paths = BinaryColumn::create();
+
+    // The adjacent rows sharing a path, and an invalid path between them.
+    std::string param_jsons[] = {R"({"k1": 1, "k2": 2})", R"({"k1": 3})", R"({"k1": 4})", R"({"k2": 5})",
+                                 R"({"k2": 6})"};
+    std::string param_paths[] = {"$.k1", "$.k1", "$.[", "$.k1", "$.k2"};
+    std::string results[] = {"1", "3", "NULL", "NULL", "6"};
+    for (int i = 0; i < 5; i++) {
+        JsonValue json;
+        ASSERT_OK(JsonValue::parse(param_jsons[i], &json));
+        jsons->append(&json);
+        paths->append(param_paths[i]);
+    }
+
+    Columns columns{jsons, paths};
+    ctx.get()->impl()->set_constant_columns(columns);
+    ASSERT_OK(JsonFunctions::native_json_path_prepare(ctx.get(), FunctionContext::FunctionStateScope::FRAGMENT_LOCAL));
+
+    ColumnPtr result = JsonFunctions::json_query(ctx.get(), columns);
+    ASSERT_EQ(5, result->size());
+    for (int i = 0; i < 5; i++) {
+        Datum datum = result->get(i);
+        if (results[i] == "NULL") {
+            ASSERT_TRUE(datum.is_null()) << i;
+        } else {
+            ASSERT_FALSE(datum.is_null()) << i;
+            ASSERT_EQ(results[i], datum.get_json()->to_string().value());
+        }
+    }
+
+    ASSERT_OK(JsonFunctions::native_json_path_close(ctx.get(), FunctionContext::FunctionStateScope::FRAGMENT_LOCAL));
+}
+
 INSTANTIATE_TEST_SUITE_P(
         JsonQueryTest, JsonQueryTestFixture,
         ::testing::Values(
@@ -0,0 +1,50 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "exprs/vectorized/regex_utils.h"
+
+#include <gtest/gtest.h>
+
+#include "column/binary_column.h"
+
+namespace starrocks::vectorized {
+
+// NOLINTNEXTLINE
+TEST(RegexUtilsTest, test_required_literal) {
+    ASSERT_EQ("abc", RegexUtils::required_literal("abc"));
+    ASSERT_EQ("hello", RegexUtils::required_literal("^hello\\d+wo"));
+    ASSERT_EQ("ab", RegexUtils::required_literal("abc?d"));
+    ASSERT_EQ("ab", RegexUtils::required_literal("abc*d"));
+    ASSERT_EQ("abc", RegexUtils::required_literal("abc+d"));
+    ASSERT_EQ("ab", RegexUtils::required_literal("abc{0,2}d"));
+    ASSERT_EQ("xyz", RegexUtils::required_literal("([a-z]+)xyz(1|2)?"));
+    ASSERT_EQ("a.b", RegexUtils::required_literal("a\\.b[)|]"));
+    ASSERT_EQ("数据", RegexUtils::required_literal("数据库?"));
+
+    // No literal could be extracted.
+    ASSERT_EQ("", RegexUtils::required_literal(""));
+    ASSERT_EQ("", RegexUtils::required_literal("a*"));
+    ASSERT_EQ("", RegexUtils::required_literal("abc|def"));
+    ASSERT_EQ("", RegexUtils::required_literal("(?i)abc"));
+    ASSERT_EQ("", RegexUtils::required_literal("abc\\x41"));
+    ASSERT_EQ("", RegexUtils::required_literal("(abc"));
+}
+
+// NOLINTNEXTLINE
+TEST(RegexUtilsTest, test_find_candidates) {
+    auto column = BinaryColumn::create();
+    column->append("");
+    column->append("xxab");
+    column->append("ab");
+    column->append("a");
+    column->append("bxxxxab");
+    column->append("xxxx");
+
+    Column::Filter candidates;
+    RegexUtils::find_candidates(*column, "ab", &candidates);
+    ASSERT_EQ((Column::Filter{0, 1, 1, 0, 1, 0}), candidates);
+
+    RegexUtils::find_candidates(*column, "", &candidates);
+    ASSERT_EQ((Column::Filter{1, 1, 1, 1, 1, 1}), candidates);
+}
+
+} // namespace starrocks::vectorized
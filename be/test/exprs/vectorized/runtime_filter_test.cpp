@@ -232,6 +232,54 @@ TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterSerialize2) {
     EXPECT_TRUE(rf3->check_equal(*rf1));
 }
 
+TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterInValues) {
+    RuntimeBloomFilter<TYPE_INT> bf0;
+    bf0.init(10);
+    for (int i = 0; i < 10; i++) {
+        bf0.insert(&i);
+    }
+    ASSERT_TRUE(bf0.has_in_values());
+    EXPECT_EQ(bf0.in_values().size(), 10);
+
+    // too many values to keep.
+    RuntimeBloomFilter<TYPE_INT> bf1;
+    bf1.init(config::max_pushdown_conditions_per_column + 1);
+    EXPECT_FALSE(bf1.has_in_values());
+
+    // the in values are serialized after the filter.
+    ObjectPool pool;
+    size_t max_size = RuntimeFilterHelper::max_runtime_filter_serialized_size(&bf0);
+    std::vector<uint8_t> buffer(max_size, 0);
+    size_t actual_size = RuntimeFilterHelper::serialize_runtime_filter(&bf0, buffer.data());
+    buffer.resize(actual_size);
+    JoinRuntimeFilter* rf = nullptr;
+    RuntimeFilterHelper::deserialize_runtime_filter(&pool, &rf, buffer.data(), actual_size);
+    ASSERT_TRUE(rf != nullptr);
+    auto* bf2 = down_cast<RuntimeBloomFilter<TYPE_INT>*>(rf);
+    ASSERT_TRUE(bf2->has_in_values());
+    EXPECT_EQ(bf2->in_values(), bf0.in_values());
+
+    // the partitions of global runtime filter are concatenated with their in values.
+    RuntimeBloomFilter<TYPE_INT> bf3;
+    bf3.init(10);
+    for (int i = 10; i < 20; i++) {
+        bf3.insert(&i);
+    }
+    RuntimeBloomFilter<TYPE_INT> grf;
+    grf.concat(bf2);
+    grf.concat(&bf3);
+    ASSERT_TRUE(grf.has_in_values());
+    EXPECT_EQ(grf.in_values().size(), 20);
+
+    // the in values are dropped if any partition does not have them.
+    RuntimeBloomFilter<TYPE_INT> bf4;
+    bf4.init(config::max_pushdown_conditions_per_column + 1);
+    int value = 100;
+    bf4.insert(&value);
+    grf.concat(&bf4);
+    EXPECT_FALSE(grf.has_in_values());
+}
+
 TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterMerge) {
     RuntimeBloomFilter<TYPE_INT> bf0;
     JoinRuntimeFilter* rf0 = &bf0;
@@ -1605,6 +1605,44 @@ PARALLEL_TEST(VecStringFunctionsTest, regexpExtractConstPattern) {
                     .ok());
 }
 
+PARALLEL_TEST(VecStringFunctionsTest, regexpReplaceConstPatternWithLiteral) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    auto context = ctx.get();
+
+    Columns columns;
+
+    auto str = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    auto pattern = ColumnHelper::create_const_column<TYPE_VARCHAR>("id=(\\d+);", 1);
+    auto rpl = ColumnHelper::create_const_column<TYPE_VARCHAR>("<\\1>", 1);
+
+    // The rows without the literal "id=" are left unchanged without running the regex.
+    str->append_datum(Slice("id=12;id=3;"));
+    str->append_datum(Slice("no id here"));
+    str->append_nulls(1);
+    str->append_datum(Slice("xid=7;"));
+    str->append_datum(Slice("id=;"));
+
+    columns.push_back(str);
+    columns.push_back(pattern);
+    columns.push_back(rpl);
+
+    context->impl()->set_constant_columns(columns);
+
+    ASSERT_TRUE(StringFunctions::regexp_replace_prepare(context, FunctionContext::FunctionStateScope::THREAD_LOCAL).ok());
+
+    auto result = StringFunctions::regexp_replace(context, columns);
+    ASSERT_EQ(5, result->size());
+    ASSERT_EQ("<12><3>", result->get(0).get_slice().to_string());
+    ASSERT_EQ("no id here", result->get(1).get_slice().to_string());
+    ASSERT_TRUE(result->is_null(2));
+    ASSERT_EQ("x<7>", result->get(3).get_slice().to_string());
+    ASSERT_EQ("id=;", result->get(4).get_slice().to_string());
+
+    ASSERT_TRUE(
+            StringFunctions::regexp_close(context, FunctionContext::FunctionContext::FunctionStateScope::THREAD_LOCAL)
+                    .ok());
+}
+
 PARALLEL_TEST(VecStringFunctionsTest, regexpExtract) {
     std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
     auto context = ctx.get();
@@ -85,6 +85,29 @@ TEST_F(NullableConverterTest, test_read_string_invalid_value_as_error) {
     EXPECT_EQ(0, col->size());
 }
 
+// NOLINTNEXTLINE
+TEST_F(NullableConverterTest, test_read_strings) {
+    auto conv = csv::get_converter(_type, true);
+    std::vector<Slice> fields{"1", "\\N", "abc", "-1"};
+
+    auto col = ColumnHelper::create_column(_type, true);
+    std::vector<uint8_t> invalids(4, 0);
+    EXPECT_EQ(0, conv->read_strings(col.get(), fields.data(), 1, 4, Converter::Options(), invalids.data()));
+    EXPECT_EQ((std::vector<uint8_t>{0, 0, 0, 0}), invalids);
+    EXPECT_EQ(4, col->size());
+    EXPECT_EQ(1, col->get(0).get_int32());
+    EXPECT_TRUE(col->get(1).is_null());
+    EXPECT_TRUE(col->get(2).is_null());
+    EXPECT_EQ(-1, col->get(3).get_int32());
+
+    col = ColumnHelper::create_column(_type, true);
+    Converter::Options opts{.invalid_field_as_null = false};
+    EXPECT_EQ(1, conv->read_strings(col.get(), fields.data(), 1, 4, opts, invalids.data()));
+    EXPECT_EQ((std::vector<uint8_t>{0, 0, 1, 0}), invalids);
+    EXPECT_EQ(4, col->size());
+    EXPECT_TRUE(col->get(1).is_null());
+}
+
 // NOLINTNEXTLINE
 TEST_F(NullableConverterTest, test_write_string) {
     auto conv = csv::get_converter(_type, true);
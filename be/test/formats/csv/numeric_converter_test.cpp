@@ -161,6 +161,25 @@ TEST_F(NumericConverterTest, test_read_string_invalid_value) {
     EXPECT_EQ(0, col->size());
 }
 
+// NOLINTNEXTLINE
+TEST_F(NumericConverterTest, test_read_strings) {
+    auto conv = csv::get_converter(_type, false);
+    auto col = ColumnHelper::create_column(_type, false);
+
+    // Every other field is read.
+    std::vector<Slice> fields{"1", "x", "abc", "x", "2.9", "x", "100000", "x", "-3", "x"};
+    std::vector<uint8_t> invalids(5, 0);
+    EXPECT_EQ(2, conv->read_strings(col.get(), fields.data(), 2, 5, Converter::Options(), invalids.data()));
+
+    EXPECT_EQ((std::vector<uint8_t>{0, 1, 0, 1, 0}), invalids);
+    EXPECT_EQ(5, col->size());
+    EXPECT_EQ(1, col->get(0).get_int16());
+    EXPECT_EQ(0, col->get(1).get_int16());
+    EXPECT_EQ(2, col->get(2).get_int16());
+    EXPECT_EQ(0, col->get(3).get_int16());
+    EXPECT_EQ(-3, col->get(4).get_int16());
+}
+
 // NOLINTNEXTLINE
 TEST_F(NumericConverterTest, test_write_string) {
     auto conv = csv::get_converter(_type, false);
@@ -0,0 +1,38 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "formats/file_metadata_cache.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+TEST(FileMetadataCacheTest, test_lookup_and_insert) {
+    FileMetadataCache cache(1024);
+    std::string key = FileMetadataCache::key("parquet", "hdfs://a/b.parquet", 100, 1);
+    ASSERT_EQ(nullptr, cache.lookup<std::string>(key));
+
+    cache.insert(key, std::make_shared<const std::string>("footer"), 10);
+    auto metadata = cache.lookup<std::string>(key);
+    ASSERT_NE(nullptr, metadata);
+    ASSERT_EQ("footer", *metadata);
+    ASSERT_GE(cache.memory_usage(), 10);
+
+    // a rewritten file or the other formats never hit
+    ASSERT_EQ(nullptr, cache.lookup<std::string>(FileMetadataCache::key("parquet", "hdfs://a/b.parquet", 100, 2)));
+    ASSERT_EQ(nullptr, cache.lookup<std::string>(FileMetadataCache::key("parquet", "hdfs://a/b.parquet", 101, 1)));
+    ASSERT_EQ(nullptr, cache.lookup<std::string>(FileMetadataCache::key("orc", "hdfs://a/b.parquet", 100, 1)));
+}
+
+TEST(FileMetadataCacheTest, test_evict) {
+    // the cache is sharded, so the metadata larger than a shard is evicted at once
+    FileMetadataCache cache(1024);
+    std::string key = FileMetadataCache::key("orc", "hdfs://a/1.orc", 100, 1);
+    auto tail = std::make_shared<const std::string>("tail");
+    cache.insert(key, tail, 1024);
+    ASSERT_EQ(nullptr, cache.lookup<std::string>(key));
+    // the metadata evicted is still valid for its holders
+    ASSERT_EQ("tail", *tail);
+    ASSERT_EQ(0, cache.memory_usage());
+}
+
+} // namespace starrocks
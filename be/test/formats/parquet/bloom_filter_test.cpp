@@ -0,0 +1,112 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "formats/parquet/bloom_filter.h"
+
+#include <gtest/gtest.h>
+
+#include "fs/fs.h"
+#include "gen_cpp/parquet_types.h"
+#include "io/string_input_stream.h"
+#include "testutil/assert.h"
+#include "util/thrift_util.h"
+
+namespace starrocks::parquet {
+
+class ParquetBloomFilterTest : public testing::Test {
+protected:
+    // Insert |hash| into |bitset| as the writers of Parquet do.
+    static void insert_hash(std::vector<uint32_t>* bitset, uint64_t hash) {
+        static const uint32_t kSalt[8] = {0x47b6137b, 0x44974d91, 0x8824ad5b, 0xa2b7289d,
+                                          0x705495c7, 0x2df1424b, 0x9efc4947, 0x5c6bfb31};
+        uint64_t num_blocks = bitset->size() / 8;
+        auto block_index = static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+        auto key = static_cast<uint32_t>(hash);
+        for (int i = 0; i < 8; i++) {
+            (*bitset)[block_index * 8 + i] |= 1u << ((key * kSalt[i]) >> 27);
+        }
+    }
+
+    // Write a Bloom filter of |bitset| after |offset| bytes, return the file.
+    static std::unique_ptr<RandomAccessFile> write_bloom_filter(tparquet::BloomFilterHeader header,
+                                                                const std::vector<uint32_t>& bitset, size_t offset) {
+        std::string buffer(offset, 'x');
+        ThriftSerializer ser(true, 100);
+        uint32_t len = 0;
+        uint8_t* data = nullptr;
+        CHECK(ser.serialize(&header, &len, &data).ok());
+        buffer.append(reinterpret_cast<char*>(data), len);
+        buffer.append(reinterpret_cast<const char*>(bitset.data()), bitset.size() * sizeof(uint32_t));
+        return std::make_unique<RandomAccessFile>(std::make_shared<io::StringInputStream>(std::move(buffer)),
+                                                  "string-file");
+    }
+
+    static tparquet::BloomFilterHeader create_header(size_t num_bytes) {
+        tparquet::BloomFilterHeader header;
+        header.numBytes = num_bytes;
+        header.algorithm.__set_BLOCK(tparquet::SplitBlockAlgorithm());
+        header.hash.__set_XXHASH(tparquet::XxHash());
+        header.compression.__set_UNCOMPRESSED(tparquet::Uncompressed());
+        return header;
+    }
+};
+
+TEST_F(ParquetBloomFilterTest, TestHash) {
+    // the xxHash64 of empty input with seed 0.
+    ASSERT_EQ(0xEF46DB3751D8E999ULL, ParquetBloomFilter::hash("", 0));
+}
+
+// the Bloom filter is small or large, so that the bitset is read with the header or not.
+TEST_F(ParquetBloomFilterTest, TestRead) {
+    for (size_t num_bytes : {1024, 64 * 1024}) {
+        std::vector<uint32_t> bitset(num_bytes / sizeof(uint32_t), 0);
+        for (int64_t i = 0; i < 100; i++) {
+            insert_hash(&bitset, ParquetBloomFilter::hash(&i, sizeof(i)));
+        }
+        auto file = write_bloom_filter(create_header(num_bytes), bitset, 100);
+        ASSIGN_OR_ABORT(auto file_size, file->get_size());
+
+        tparquet::ColumnMetaData column_meta;
+        column_meta.__set_bloom_filter_offset(100);
+        std::unique_ptr<ParquetBloomFilter> bf;
+        ASSERT_OK(ParquetBloomFilter::read(file.get(), file_size, column_meta, &bf));
+        ASSERT_TRUE(bf != nullptr);
+
+        for (int64_t i = 0; i < 100; i++) {
+            ASSERT_TRUE(bf->test_bytes(&i, sizeof(i))) << i;
+        }
+        int false_positives = 0;
+        for (int64_t i = 100; i < 1100; i++) {
+            false_positives += bf->test_bytes(&i, sizeof(i));
+        }
+        ASSERT_LT(false_positives, 100);
+    }
+}
+
+TEST_F(ParquetBloomFilterTest, TestReadUnsupported) {
+    std::vector<uint32_t> bitset(256, 0);
+    auto header = create_header(1024);
+    header.hash.__isset.XXHASH = false;
+    auto file = write_bloom_filter(header, bitset, 0);
+    ASSIGN_OR_ABORT(auto file_size, file->get_size());
+
+    tparquet::ColumnMetaData column_meta;
+    column_meta.__set_bloom_filter_offset(0);
+    std::unique_ptr<ParquetBloomFilter> bf;
+    ASSERT_OK(ParquetBloomFilter::read(file.get(), file_size, column_meta, &bf));
+    ASSERT_TRUE(bf == nullptr);
+}
+
+TEST_F(ParquetBloomFilterTest, TestReadCorrupted) {
+    std::vector<uint32_t> bitset(256, 0);
+    // the size is not a power of 2.
+    auto file = write_bloom_filter(create_header(1000), bitset, 0);
+    ASSIGN_OR_ABORT(auto file_size, file->get_size());
+
+    tparquet::ColumnMetaData column_meta;
+    column_meta.__set_bloom_filter_offset(0);
+    std::unique_ptr<ParquetBloomFilter> bf;
+    auto st = ParquetBloomFilter::read(file.get(), file_size, column_meta, &bf);
+    ASSERT_EQ(TStatusCode::CORRUPTION, st.code());
+}
+
+} // namespace starrocks::parquet
@@ -71,6 +71,28 @@ struct DecoderChecker {
                 ASSERT_FALSE(st.ok());
             }
         }
+        {
+            auto column = starrocks::vectorized::FixedLengthColumn<T>::create();
+
+            decoder->set_data(encoded_data);
+            size_t num_skipped = values.size() / 2;
+            auto st = decoder->skip(num_skipped);
+            ASSERT_TRUE(st.ok());
+            st = decoder->next_batch(values.size() - num_skipped, ColumnContentType::VALUE, column.get());
+            ASSERT_TRUE(st.ok());
+
+            const T* check = (const T*)column->raw_data();
+            for (int i = num_skipped; i < values.size(); ++i) {
+                ASSERT_EQ(values[i], *check);
+                check++;
+            }
+
+            if (!is_dictionary) {
+                // out-of-bounds access
+                st = decoder->skip(1);
+                ASSERT_FALSE(st.ok());
+            }
+        }
     }
 };
 
@@ -129,6 +151,27 @@ struct DecoderChecker<Slice, is_dictionary> {
                 ASSERT_FALSE(st.ok());
             }
         }
+        {
+            auto column = starrocks::vectorized::BinaryColumn::create();
+
+            decoder->set_data(encoded_data);
+            size_t num_skipped = values.size() / 2;
+            auto st = decoder->skip(num_skipped);
+            ASSERT_TRUE(st.ok());
+            st = decoder->next_batch(values.size() - num_skipped, ColumnContentType::VALUE, column.get());
+            ASSERT_TRUE(st.ok());
+
+            ASSERT_EQ(values.size() - num_skipped, column->size());
+            for (int i = num_skipped; i < values.size(); ++i) {
+                ASSERT_EQ(values[i], column->get_slice(i - num_skipped));
+            }
+
+            if (!is_dictionary) {
+                // out-of-bounds access
+                st = decoder->skip(1);
+                ASSERT_FALSE(st.ok());
+            }
+        }
     }
 };
 
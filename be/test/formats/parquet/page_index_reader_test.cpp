@@ -0,0 +1,116 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "formats/parquet/page_index_reader.h"
+
+#include <gtest/gtest.h>
+
+#include "fs/fs.h"
+#include "gen_cpp/parquet_types.h"
+#include "io/string_input_stream.h"
+#include "testutil/assert.h"
+#include "util/thrift_util.h"
+
+namespace starrocks::parquet {
+
+class PageIndexReaderTest : public testing::Test {
+protected:
+    template <typename T>
+    static void append_thrift(T* obj, std::string* buffer, int64_t* offset, int32_t* length) {
+        ThriftSerializer ser(true, 100);
+        uint32_t len = 0;
+        uint8_t* data = nullptr;
+        ASSERT_OK(ser.serialize(obj, &len, &data));
+        *offset = buffer->size();
+        *length = len;
+        buffer->append(reinterpret_cast<char*>(data), len);
+    }
+
+    // Pages starting at rows 0, 100 and 250 of a row group of 300 rows.
+    static tparquet::OffsetIndex create_offset_index() {
+        tparquet::OffsetIndex offset_index;
+        for (int64_t first_row : {0, 100, 250}) {
+            tparquet::PageLocation location;
+            location.offset = first_row * 4;
+            location.compressed_page_size = 64;
+            location.first_row_index = first_row;
+            offset_index.page_locations.emplace_back(location);
+        }
+        return offset_index;
+    }
+};
+
+TEST_F(PageIndexReaderTest, TestRead) {
+    tparquet::ColumnIndex column_index;
+    column_index.null_pages = {false, true, false};
+    column_index.min_values = {"a", "", "k"};
+    column_index.max_values = {"f", "", "z"};
+    column_index.boundary_order = tparquet::BoundaryOrder::ASCENDING;
+    tparquet::OffsetIndex offset_index = create_offset_index();
+
+    // some bytes ahead as the column data.
+    std::string buffer(128, 'x');
+    tparquet::ColumnChunk column_chunk;
+    ASSERT_FALSE(PageIndexReader::has_page_index(column_chunk));
+    append_thrift(&column_index, &buffer, &column_chunk.column_index_offset, &column_chunk.column_index_length);
+    append_thrift(&offset_index, &buffer, &column_chunk.offset_index_offset, &column_chunk.offset_index_length);
+    column_chunk.__isset.column_index_offset = true;
+    column_chunk.__isset.column_index_length = true;
+    column_chunk.__isset.offset_index_offset = true;
+    column_chunk.__isset.offset_index_length = true;
+    ASSERT_TRUE(PageIndexReader::has_page_index(column_chunk));
+
+    RandomAccessFile file(std::make_shared<io::StringInputStream>(std::move(buffer)), "string-file");
+    std::vector<tparquet::ColumnIndex> column_indexes;
+    std::vector<tparquet::OffsetIndex> offset_indexes;
+    ASSERT_OK(PageIndexReader::read(&file, {&column_chunk, &column_chunk}, &column_indexes, &offset_indexes));
+    ASSERT_EQ(2, column_indexes.size());
+    ASSERT_EQ(2, offset_indexes.size());
+    for (size_t i = 0; i < 2; i++) {
+        ASSERT_EQ(column_index.null_pages, column_indexes[i].null_pages);
+        ASSERT_EQ(column_index.min_values, column_indexes[i].min_values);
+        ASSERT_EQ(column_index.max_values, column_indexes[i].max_values);
+        ASSERT_EQ(3, offset_indexes[i].page_locations.size());
+        ASSERT_EQ(250, offset_indexes[i].page_locations[2].first_row_index);
+    }
+}
+
+TEST_F(PageIndexReaderTest, TestReadUnmatchedPages) {
+    tparquet::ColumnIndex column_index;
+    column_index.null_pages = {false, false};
+    column_index.min_values = {"a", "k"};
+    column_index.max_values = {"f", "z"};
+    tparquet::OffsetIndex offset_index = create_offset_index();
+
+    std::string buffer;
+    tparquet::ColumnChunk column_chunk;
+    append_thrift(&column_index, &buffer, &column_chunk.column_index_offset, &column_chunk.column_index_length);
+    append_thrift(&offset_index, &buffer, &column_chunk.offset_index_offset, &column_chunk.offset_index_length);
+    column_chunk.__isset.column_index_offset = true;
+    column_chunk.__isset.column_index_length = true;
+    column_chunk.__isset.offset_index_offset = true;
+    column_chunk.__isset.offset_index_length = true;
+
+    RandomAccessFile file(std::make_shared<io::StringInputStream>(std::move(buffer)), "string-file");
+    std::vector<tparquet::ColumnIndex> column_indexes;
+    std::vector<tparquet::OffsetIndex> offset_indexes;
+    auto st = PageIndexReader::read(&file, {&column_chunk}, &column_indexes, &offset_indexes);
+    ASSERT_EQ(TStatusCode::CORRUPTION, st.code());
+}
+
+TEST_F(PageIndexReaderTest, TestPageRowRanges) {
+    tparquet::OffsetIndex offset_index = create_offset_index();
+
+    auto ranges = PageIndexReader::page_row_ranges(offset_index, 300, {1, 1, 1});
+    ASSERT_EQ(vectorized::SparseRange(0, 300), ranges);
+
+    ranges = PageIndexReader::page_row_ranges(offset_index, 300, {0, 1, 0});
+    ASSERT_EQ(vectorized::SparseRange(100, 250), ranges);
+
+    ranges = PageIndexReader::page_row_ranges(offset_index, 300, {1, 0, 1});
+    ASSERT_EQ((vectorized::SparseRange{vectorized::Range(0, 100), vectorized::Range(250, 300)}), ranges);
+
+    ranges = PageIndexReader::page_row_ranges(offset_index, 300, {0, 0, 0});
+    ASSERT_TRUE(ranges.empty());
+}
+
+} // namespace starrocks::parquet
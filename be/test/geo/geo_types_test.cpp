@@ -180,6 +180,31 @@ TEST_F(GeoTypesTest, polygon_hole_contains) {
     }
 }
 
+TEST_F(GeoTypesTest, contains_point_index) {
+    const char* wkt = "POLYGON ((10 10, 50 10, 50 50, 10 50, 10 10), (20 20, 40 20, 40 40, 20 40, 20 20))";
+    GeoParseStatus status;
+    std::unique_ptr<GeoShape> polygon(GeoShape::from_wkt(wkt, strlen(wkt), &status));
+    ASSERT_EQ(GEO_PARSE_OK, status);
+    GeoCircle circle;
+    ASSERT_EQ(GEO_PARSE_OK, circle.init(30, 30, 1000000));
+
+    for (const GeoShape* shape : {(const GeoShape*)polygon.get(), (const GeoShape*)&circle}) {
+        auto index = GeoContainsPointIndex::create(shape);
+        ASSERT_NE(nullptr, index);
+        for (double x = 0.25; x < 60; x += 1.5) {
+            for (double y = 0.25; y < 60; y += 1.5) {
+                GeoPoint point;
+                point.from_coord(x, y);
+                ASSERT_EQ(shape->contains(&point), index->contains(*point.point())) << x << " " << y;
+            }
+        }
+    }
+
+    GeoPoint point;
+    point.from_coord(10, 10);
+    ASSERT_EQ(nullptr, GeoContainsPointIndex::create(&point));
+}
+
 TEST_F(GeoTypesTest, circle) {
     GeoCircle circle;
     auto res = circle.init(110.123, 64, 1000);
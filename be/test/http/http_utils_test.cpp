@@ -89,4 +89,34 @@ TEST_F(HttpUtilsTest, parse_basic_auth) {
     }
 }
 
+TEST_F(HttpUtilsTest, parse_range_header) {
+    int64_t offset = 0;
+    int64_t length = 0;
+    ASSERT_TRUE(parse_range_header("bytes=0-99", 1000, &offset, &length));
+    ASSERT_EQ(0, offset);
+    ASSERT_EQ(100, length);
+    ASSERT_TRUE(parse_range_header("bytes=900-", 1000, &offset, &length));
+    ASSERT_EQ(900, offset);
+    ASSERT_EQ(100, length);
+    ASSERT_TRUE(parse_range_header("bytes=-100", 1000, &offset, &length));
+    ASSERT_EQ(900, offset);
+    ASSERT_EQ(100, length);
+    // The end and the suffix beyond the file are truncated.
+    ASSERT_TRUE(parse_range_header("bytes=900-2000", 1000, &offset, &length));
+    ASSERT_EQ(900, offset);
+    ASSERT_EQ(100, length);
+    ASSERT_TRUE(parse_range_header("bytes=-2000", 1000, &offset, &length));
+    ASSERT_EQ(0, offset);
+    ASSERT_EQ(1000, length);
+
+    ASSERT_FALSE(parse_range_header("bytes=1000-", 1000, &offset, &length));
+    ASSERT_FALSE(parse_range_header("bytes=100-99", 1000, &offset, &length));
+    ASSERT_FALSE(parse_range_header("bytes=-0", 1000, &offset, &length));
+    ASSERT_FALSE(parse_range_header("bytes=0-1,5-9", 1000, &offset, &length));
+    ASSERT_FALSE(parse_range_header("bytes=a-b", 1000, &offset, &length));
+    ASSERT_FALSE(parse_range_header("bytes=-", 1000, &offset, &length));
+    ASSERT_FALSE(parse_range_header("items=0-99", 1000, &offset, &length));
+    ASSERT_FALSE(parse_range_header("bytes=0-99", 0, &offset, &length));
+}
+
 } // namespace starrocks
@@ -71,6 +71,25 @@ TEST_F(MetricsActionTest, prometheus_output) {
     action.handle(&request);
 }
 
+TEST_F(MetricsActionTest, prometheus_histogram) {
+    MetricRegistry registry("test");
+    IntHistogram chunk_time(MetricUnit::NANOSECONDS, {10, 100});
+    chunk_time.observe(5);
+    chunk_time.observe(50);
+    chunk_time.observe(500);
+    registry.register_metric("chunk_time", MetricLabels().add("operator", "project"), &chunk_time);
+    s_expect_response =
+            "# TYPE test_chunk_time histogram\n"
+            "test_chunk_time_bucket{operator=\"project\",le=\"10\"} 1\n"
+            "test_chunk_time_bucket{operator=\"project\",le=\"100\"} 2\n"
+            "test_chunk_time_bucket{operator=\"project\",le=\"+Inf\"} 3\n"
+            "test_chunk_time_sum{operator=\"project\"} 555\n"
+            "test_chunk_time_count{operator=\"project\"} 3\n";
+    HttpRequest request(_evhttp_req);
+    MetricsAction action(&registry);
+    action.handle(&request);
+}
+
 TEST_F(MetricsActionTest, prometheus_no_prefix) {
     MetricRegistry registry("");
     IntGauge cpu_idle(MetricUnit::PERCENT);
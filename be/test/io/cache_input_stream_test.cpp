@@ -0,0 +1,129 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "io/cache_input_stream.h"
+
+#include <gtest/gtest.h>
+
+#include "fs/fs_util.h"
+#include "io/block_cache.h"
+#include "io/string_input_stream.h"
+#include "testutil/assert.h"
+
+namespace starrocks::io {
+
+// A StringInputStream counting the reads, which stands for the remote file.
+class CountingInputStream final : public StringInputStream {
+public:
+    explicit CountingInputStream(std::string contents) : StringInputStream(std::move(contents)) {}
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override {
+        _num_reads++;
+        return StringInputStream::read_at_fully(offset, out, count);
+    }
+
+    int num_reads() const { return _num_reads; }
+
+private:
+    int _num_reads = 0;
+};
+
+class CacheInputStreamTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        (void)fs::remove_all(kTestDir);
+        for (int i = 0; i < 100; i++) {
+            _contents.push_back(static_cast<char>('a' + i % 26));
+        }
+    }
+
+    void TearDown() override { (void)fs::remove_all(kTestDir); }
+
+    BlockCacheOptions options(int64_t mem_size) const {
+        BlockCacheOptions opts;
+        opts.disk_path = kTestDir;
+        opts.disk_size = 1024 * 1024;
+        opts.mem_size = mem_size;
+        opts.block_size = kBlockSize;
+        return opts;
+    }
+
+    void check_read(CacheInputStream* in) {
+        char buf[100];
+        // Across the blocks
+        ASSERT_OK(in->read_at_fully(5, buf, 30));
+        ASSERT_EQ(_contents.substr(5, 30), std::string_view(buf, 30));
+        // The last block is partial
+        ASSIGN_OR_ABORT(auto nread, in->read_at(90, buf, 20));
+        ASSERT_EQ(10, nread);
+        ASSERT_EQ(_contents.substr(90, 10), std::string_view(buf, 10));
+        ASSERT_FALSE(in->read_at_fully(90, buf, 20).ok());
+        // Sequential reads
+        ASSERT_OK(in->seek(0));
+        ASSIGN_OR_ABORT(nread, in->read(buf, 100));
+        ASSERT_EQ(100, nread);
+        ASSERT_EQ(_contents, std::string_view(buf, 100));
+        ASSERT_EQ(100, *in->position());
+    }
+
+    const std::string kTestDir = "./ut_dir/cache_input_stream_test";
+    static constexpr int64_t kBlockSize = 16;
+    std::string _contents;
+};
+
+TEST_F(CacheInputStreamTest, test_memory_tier) {
+    BlockCache cache(options(1024 * 1024));
+    ASSERT_OK(cache.init());
+    auto remote = std::make_shared<CountingInputStream>(_contents);
+    CacheInputStream in(remote, "test_file", &cache);
+    check_read(&in);
+    // Each of the 7 blocks is read from the remote once.
+    ASSERT_EQ(7, remote->num_reads());
+    ASSERT_EQ(7, in.stats().miss_count);
+    ASSERT_EQ(100, in.stats().miss_bytes);
+    int64_t hit_count = in.stats().hit_count;
+    check_read(&in);
+    ASSERT_EQ(7, remote->num_reads());
+    ASSERT_EQ(7, in.stats().miss_count);
+    ASSERT_GT(in.stats().hit_count, hit_count);
+}
+
+TEST_F(CacheInputStreamTest, test_disk_tier_after_restart) {
+    {
+        BlockCache cache(options(0));
+        ASSERT_OK(cache.init());
+        auto remote = std::make_shared<CountingInputStream>(_contents);
+        CacheInputStream in(remote, "test_file", &cache);
+        check_read(&in);
+        cache.TEST_wait_for_disk_writes();
+    }
+    // The blocks are loaded from the disk.
+    BlockCache cache(options(0));
+    ASSERT_OK(cache.init());
+    auto remote = std::make_shared<CountingInputStream>(_contents);
+    CacheInputStream in(remote, "test_file", &cache);
+    check_read(&in);
+    ASSERT_EQ(0, remote->num_reads());
+
+    // Another file is not hit.
+    CacheInputStream other(remote, "other_file", &cache);
+    check_read(&other);
+    ASSERT_EQ(7, remote->num_reads());
+}
+
+TEST_F(CacheInputStreamTest, test_disk_tier_eviction) {
+    auto opts = options(0);
+    // The disk tier is smaller than the file.
+    opts.disk_size = 2 * kBlockSize;
+    BlockCache cache(opts);
+    ASSERT_OK(cache.init());
+    auto remote = std::make_shared<CountingInputStream>(_contents);
+    CacheInputStream in(remote, "test_file", &cache);
+    check_read(&in);
+    cache.TEST_wait_for_disk_writes();
+
+    std::vector<std::string> files;
+    ASSERT_OK(FileSystem::Default()->get_children(kTestDir, &files));
+    ASSERT_LT(files.size(), 7u);
+}
+
+} // namespace starrocks::io
@@ -0,0 +1,59 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "io/data_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "fs/fs_util.h"
+#include "io/block_cache.h"
+#include "io/cache_input_stream.h"
+#include "io/string_input_stream.h"
+#include "testutil/assert.h"
+
+namespace starrocks::io {
+
+class DataCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override { (void)fs::remove_all(kTestDir); }
+
+    void TearDown() override {
+        DataCache::release_global_cache();
+        (void)fs::remove_all(kTestDir);
+    }
+
+    const std::string kTestDir = "./ut_dir/data_cache_test";
+};
+
+TEST_F(DataCacheTest, test_invalid_options) {
+    ASSERT_FALSE(DataCache::create_global_cache({}, 1024, 16).ok());
+    ASSERT_FALSE(DataCache::create_global_cache({kTestDir + "/1"}, 0, 16).ok());
+    ASSERT_EQ(nullptr, DataCache::instance());
+}
+
+TEST_F(DataCacheTest, test_read_through_cache) {
+    ASSERT_OK(DataCache::create_global_cache({kTestDir + "/1", kTestDir + "/2"}, 1024, 16));
+    auto* data_cache = DataCache::instance();
+    ASSERT_NE(nullptr, data_cache);
+
+    // A rewritten file has another key.
+    auto key = DataCache::file_key("hdfs://a/b.parquet", 1);
+    ASSERT_NE(key, DataCache::file_key("hdfs://a/b.parquet", 2));
+    ASSERT_EQ(data_cache->cache_of(key), data_cache->cache_of(key));
+
+    std::string contents(40, 'x');
+    auto* cache = data_cache->cache_of(key);
+    CacheInputStream in(std::make_shared<StringInputStream>(contents), key, cache);
+    char buf[40];
+    ASSERT_OK(in.read_at_fully(0, buf, 40));
+    ASSERT_EQ(3, in.stats().miss_count);
+    cache->TEST_wait_for_disk_writes();
+
+    CacheInputStream again(std::make_shared<StringInputStream>(contents), key, cache);
+    ASSERT_OK(again.read_at_fully(0, buf, 40));
+    ASSERT_EQ(contents, std::string_view(buf, 40));
+    ASSERT_EQ(3, again.stats().hit_count);
+    ASSERT_EQ(40, again.stats().hit_bytes);
+    ASSERT_EQ(0, again.stats().miss_count);
+}
+
+} // namespace starrocks::io
@@ -8,8 +8,11 @@
 #include <sys/types.h>
 
 #include <cstdlib>
+#include <string>
+#include <vector>
 
 #include "common/logging.h"
+#include "io/io_uring.h"
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
 
@@ -169,4 +172,47 @@ PARALLEL_TEST(FdInputStreamTest, test_op_after_close) {
     ASSERT_ERROR(in.close());
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(FdInputStreamTest, test_read_at_fully_batch) {
+    int fd = open_temp_file();
+    std::string data(100000, 0);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i % 251);
+    }
+    pwrite_or_die(fd, data.data(), data.size(), 0);
+
+    FdInputStream in(fd);
+    in.set_close_on_delete(true);
+
+    // More requests than the entries of a ring.
+    std::vector<std::string> buffs(200, std::string(300, 0));
+    std::vector<ReadRequest> requests;
+    for (size_t i = 0; i < buffs.size(); i++) {
+        requests.push_back({static_cast<int64_t>(i * 499), buffs[i].data(), static_cast<int64_t>(buffs[i].size())});
+    }
+    ASSERT_OK(in.read_at_fully_batch(requests));
+    for (size_t i = 0; i < buffs.size(); i++) {
+        ASSERT_EQ(data.substr(i * 499, 300), buffs[i]) << i;
+    }
+
+    // io_uring may be unavailable in the test environment.
+    auto* ring = IoUring::thread_local_instance();
+    if (ring != nullptr) {
+        for (auto& buff : buffs) {
+            buff.assign(buff.size(), 0);
+        }
+        ASSERT_OK(ring->read_fully(fd, requests.data(), requests.size()));
+        for (size_t i = 0; i < buffs.size(); i++) {
+            ASSERT_EQ(data.substr(i * 499, 300), buffs[i]) << i;
+        }
+    }
+
+    // Reach the end of file.
+    requests.push_back({static_cast<int64_t>(data.size() - 10), buffs[0].data(), 20});
+    ASSERT_ERROR(in.read_at_fully_batch(requests));
+    if (ring != nullptr) {
+        ASSERT_ERROR(ring->read_fully(fd, requests.data(), requests.size()));
+    }
+}
+
 } // namespace starrocks::io
@@ -0,0 +1,109 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "io/mmap_input_stream.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "common/logging.h"
+#include "runtime/mem_tracker.h"
+#include "testutil/assert.h"
+#include "testutil/parallel_test.h"
+
+namespace starrocks::io {
+
+// Create a temporary file of |content| and map it, the file is removed and closed once it's mapped.
+static std::unique_ptr<MmapInputStream> open_temp_file(const std::string& content, MemTracker* mem_tracker) {
+    char tmpl[] = "/tmp/mmap_input_stream_testXXXXXX";
+    int fd = ::mkstemp(tmpl);
+    PCHECK(fd >= 0) << "mkstemp() failed";
+    PCHECK(::unlink(tmpl) == 0) << "unlink() failed";
+    ssize_t written = ::pwrite(fd, content.data(), content.size(), 0);
+    PCHECK(written == static_cast<ssize_t>(content.size())) << "pwrite() failed";
+    auto stream_or = MmapInputStream::open(fd, mem_tracker);
+    ::close(fd);
+    CHECK_OK(stream_or.status());
+    return std::move(stream_or).value();
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(MmapInputStreamTest, test_read_empty) {
+    auto in = open_temp_file("", nullptr);
+    char buff[1];
+    ASSERT_EQ(0, *in->get_size());
+    ASSERT_EQ(0, *in->read(buff, 1));
+    ASSERT_EQ(0, *in->read_at(0, buff, 1));
+    ASSERT_EQ("", *in->peek_at(0, 0));
+    ASSERT_FALSE(in->peek_at(0, 1).ok());
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(MmapInputStreamTest, test_read) {
+    auto in = open_temp_file("0123456789", nullptr);
+    ASSERT_EQ(10, *in->get_size());
+
+    char buff[10];
+    ASSERT_EQ(6, *in->read(buff, 6));
+    ASSERT_EQ("012345", std::string_view(buff, 6));
+    ASSERT_EQ(6, *in->position());
+    ASSERT_EQ("67", *in->peek(2));
+    ASSERT_EQ(4, *in->read(buff + 6, 10));
+    ASSERT_EQ("0123456789", std::string_view(buff, 10));
+    ASSERT_EQ(0, *in->read(buff, 1));
+
+    // read_at() doesn't change the position.
+    ASSERT_OK(in->seek(2));
+    ASSERT_EQ(3, *in->read_at(7, buff, 5));
+    ASSERT_EQ("789", std::string_view(buff, 3));
+    ASSERT_EQ(2, *in->position());
+    ASSERT_EQ(0, *in->read_at(12, buff, 1));
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(MmapInputStreamTest, test_peek_at) {
+    auto in = open_temp_file("0123456789", nullptr);
+    ASSERT_TRUE(in->allows_peek_at());
+    auto view = *in->peek_at(3, 4);
+    ASSERT_EQ("3456", view);
+    // The views are valid after the other reads.
+    char buff[10];
+    ASSERT_OK(in->read_at_fully(0, buff, 10));
+    ASSERT_EQ("0123456789", *in->peek_at(0, 10));
+    ASSERT_EQ("3456", view);
+    ASSERT_TRUE(in->peek_at(8, 3).status().is_end_of_file());
+    ASSERT_TRUE(in->peek_at(-1, 1).status().is_end_of_file());
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(MmapInputStreamTest, test_read_at_fully_batch) {
+    std::string content(64 * 1024, 'a');
+    for (size_t i = 0; i < content.size(); i++) {
+        content[i] = 'a' + i % 26;
+    }
+    auto in = open_temp_file(content, nullptr);
+    char buff1[100];
+    char buff2[5000];
+    std::vector<ReadRequest> requests{{10, buff1, sizeof(buff1)}, {40000, buff2, sizeof(buff2)}};
+    ASSERT_OK(in->read_at_fully_batch(requests));
+    ASSERT_EQ(content.substr(10, sizeof(buff1)), std::string_view(buff1, sizeof(buff1)));
+    ASSERT_EQ(content.substr(40000, sizeof(buff2)), std::string_view(buff2, sizeof(buff2)));
+
+    std::vector<ReadRequest> eof_requests{{static_cast<int64_t>(content.size()) - 1, buff1, 2}};
+    ASSERT_FALSE(in->read_at_fully_batch(eof_requests).ok());
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(MmapInputStreamTest, test_mem_tracker) {
+    MemTracker mem_tracker(-1, "mmap");
+    {
+        auto in = open_temp_file("0123456789", &mem_tracker);
+        ASSERT_EQ(10, mem_tracker.consumption());
+    }
+    ASSERT_EQ(0, mem_tracker.consumption());
+}
+
+} // namespace starrocks::io
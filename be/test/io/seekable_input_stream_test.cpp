@@ -89,4 +89,31 @@ PARALLEL_TEST(SeekableInputStreamTest, test_read_at_fully) {
     ASSERT_ERROR(in.read_at_fully(1, buff, 10));
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(SeekableInputStreamTest, test_coalesce_reads) {
+    std::vector<ReadRequest> requests{{0, nullptr, 10},   {15, nullptr, 5},  {100, nullptr, 10},
+                                      {105, nullptr, 10}, {120, nullptr, 50}};
+    auto reads = coalesce_reads(requests, 10, 60);
+    ASSERT_EQ(4, reads.size());
+    // The gap is 5 bytes
+    ASSERT_EQ(0, reads[0].offset);
+    ASSERT_EQ(20, reads[0].count);
+    ASSERT_EQ(0, reads[0].begin);
+    ASSERT_EQ(2, reads[0].end);
+    // Overlapped with the next one
+    ASSERT_EQ(100, reads[1].offset);
+    ASSERT_EQ(10, reads[1].count);
+    // Larger than 60 bytes if merged with the next one
+    ASSERT_EQ(105, reads[2].offset);
+    ASSERT_EQ(10, reads[2].count);
+    ASSERT_EQ(120, reads[3].offset);
+    ASSERT_EQ(50, reads[3].count);
+    ASSERT_EQ(4, reads[3].begin);
+    ASSERT_EQ(5, reads[3].end);
+
+    ASSERT_EQ(5, coalesce_reads(requests, 0, 1000).size());
+    ASSERT_EQ(2, coalesce_reads(requests, 1000, 1000).size());
+    ASSERT_TRUE(coalesce_reads({}, 10, 10).empty());
+}
+
 } // namespace starrocks::io
@@ -67,4 +67,57 @@ TEST_F(KafkaConsumerPipeTest, append_read) {
     ASSERT_EQ(eof, true);
 }
 
+TEST_F(KafkaConsumerPipeTest, append_batch) {
+    KafkaConsumerPipe k_pipe(1024 * 1024, 64 * 1024);
+
+    std::string msg1 = "i have a dream";
+    std::string msg2 = "This is from kafka";
+    // The second batch is concatenated in two buffers.
+    std::string msg3(100, 'a');
+
+    KafkaMessageBatch batch1;
+    batch1.append_with_row_delimiter(msg1.c_str(), msg1.length(), '\n');
+    batch1.append_with_row_delimiter(msg2.c_str(), msg2.length(), '\n');
+    batch1.cmt_offset()[0] = 10;
+    ASSERT_EQ(2, batch1.num_messages());
+    ASSERT_EQ(msg1.length() + msg2.length(), batch1.message_bytes());
+    ASSERT_TRUE(k_pipe.append_batch(&batch1).ok());
+
+    KafkaMessageBatch batch2(64);
+    batch2.append_with_row_delimiter(msg1.c_str(), msg1.length(), '\n');
+    batch2.append_with_row_delimiter(msg3.c_str(), msg3.length(), '\n');
+    ASSERT_EQ(2, batch2.bufs().size());
+    ASSERT_TRUE(k_pipe.append_batch(&batch2).ok());
+    ASSERT_TRUE(k_pipe.finish().ok());
+
+    std::string expected = msg1 + "\n" + msg2 + "\n" + msg1 + "\n" + msg3 + "\n";
+    char buf[1024];
+    size_t data_size = 1024;
+    bool eof = false;
+    ASSERT_TRUE(k_pipe.read((uint8_t*)buf, &data_size, &eof).ok());
+    ASSERT_EQ(expected, std::string(buf, data_size));
+    ASSERT_EQ(eof, false);
+}
+
+TEST_F(KafkaConsumerPipeTest, append_json_batch) {
+    KafkaConsumerPipe k_pipe(1024 * 1024, 64 * 1024);
+
+    std::string msg1 = R"({"k": 1})";
+    std::string msg2 = R"({"k": 2})";
+    KafkaMessageBatch batch;
+    batch.append_json(msg1.c_str(), msg1.length());
+    batch.append_json(msg2.c_str(), msg2.length());
+    ASSERT_TRUE(k_pipe.append_batch(&batch).ok());
+    ASSERT_TRUE(k_pipe.finish().ok());
+
+    // Each json message is read as a buffer of its own.
+    auto buf = k_pipe.read();
+    ASSERT_TRUE(buf.ok());
+    ASSERT_EQ(msg1, std::string((*buf)->ptr, (*buf)->remaining()));
+    buf = k_pipe.read();
+    ASSERT_TRUE(buf.ok());
+    ASSERT_EQ(msg2, std::string((*buf)->ptr, (*buf)->remaining()));
+    ASSERT_TRUE(k_pipe.read().status().is_end_of_file());
+}
+
 } // namespace starrocks
@@ -129,6 +129,17 @@ TEST(MemPoolTest, Keep) {
 // Maximum allocation size which exceeds 32-bit.
 #define LARGE_ALLOC_SIZE (1LL << 32)
 
+TEST(MemPoolTest, MaxChunkSize) {
+    MemPool p(MemPool::LARGE_CHUNK_SIZE);
+    for (int i = 0; i < 64; ++i) {
+        p.allocate(64 * 1024);
+    }
+    EXPECT_EQ(4 * 1024 * 1024, p.total_allocated_bytes());
+    // The chunk sizes double up to 2M: 64K, 128K, 256K, 512K, 1M, 2M and 2M.
+    EXPECT_EQ((64 + 128 + 256 + 512 + 1024 + 2048 + 2048) * 1024, p.total_reserved_bytes());
+    p.free_all();
+}
+
 TEST(MemPoolTest, MaxAllocation) {
     int64_t int_max_rounded = BitUtil::round_up(LARGE_ALLOC_SIZE, 8);
 
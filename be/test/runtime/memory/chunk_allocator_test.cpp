@@ -38,4 +38,27 @@ TEST(ChunkAllocatorTest, Normal) {
         ChunkAllocator::instance()->free(chunk);
     }
 }
+
+TEST(ChunkAllocatorTest, ReleaseFreeChunks) {
+    config::use_mmap_allocate_chunk = false;
+    // Initialize CpuInfo.
+    ChunkAllocator::instance();
+    ChunkAllocator allocator(nullptr, 1024 * 1024);
+    Chunk chunks[3];
+    ASSERT_TRUE(allocator.allocate(4096, &chunks[0]));
+    ASSERT_TRUE(allocator.allocate(4096, &chunks[1]));
+    ASSERT_TRUE(allocator.allocate(8192, &chunks[2]));
+    for (const auto& chunk : chunks) {
+        allocator.free(chunk);
+    }
+    ASSERT_EQ(16384, allocator.reserved_bytes());
+
+    // The chunks may be in the arenas of different cores, the largest chunk of an arena is released first.
+    size_t released_bytes = allocator.release_free_chunks(1);
+    ASSERT_TRUE(released_bytes == 4096 || released_bytes == 8192);
+    ASSERT_EQ(16384 - released_bytes, allocator.reserved_bytes());
+    ASSERT_EQ(16384 - released_bytes, allocator.release_free_chunks(1024 * 1024));
+    ASSERT_EQ(0, allocator.reserved_bytes());
+    ASSERT_EQ(0, allocator.release_free_chunks(1024 * 1024));
+}
 } // namespace starrocks
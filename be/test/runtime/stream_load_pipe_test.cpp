@@ -23,7 +23,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
@@ -221,4 +224,66 @@ PARALLEL_TEST(StreamLoadPipeTest, append_large_chunk) {
     producer.join();
 }
 
+PARALLEL_TEST(StreamLoadPipeTest, read_whole_records) {
+    StreamLoadPipe pipe(/*max_buffered_bytes=*/64, /*min_chunk_size=*/16);
+    pipe.set_record_delimiter('\n');
+
+    // The records are across the chunks of the pipe.
+    auto producer = std::thread([&pipe]() {
+        for (int i = 0; i < 1000; ++i) {
+            std::string record = std::to_string(i) + "\n";
+            ASSERT_OK(pipe.append(record.data(), record.size()));
+        }
+        // The last record has no delimiter.
+        ASSERT_OK(pipe.append("1000", 4));
+        ASSERT_OK(pipe.finish());
+    });
+
+    std::vector<int> records[2];
+    auto reader = [&pipe](std::vector<int>* records) {
+        char buf[32];
+        while (true) {
+            size_t buf_len = sizeof(buf);
+            bool eof = false;
+            ASSERT_OK(pipe.read((uint8_t*)buf, &buf_len, &eof));
+            if (eof) {
+                break;
+            }
+            ASSERT_GT(buf_len, 0);
+            std::string_view data(buf, buf_len);
+            size_t begin = 0;
+            while (begin < data.size()) {
+                size_t end = std::min(data.find('\n', begin), data.size());
+                records->push_back(std::stoi(std::string(data.substr(begin, end - begin))));
+                begin = end + 1;
+            }
+        }
+    };
+    std::thread reader1(reader, &records[0]);
+    std::thread reader2(reader, &records[1]);
+    producer.join();
+    reader1.join();
+    reader2.join();
+
+    std::vector<int> all(records[0]);
+    all.insert(all.end(), records[1].begin(), records[1].end());
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(1001, all.size());
+    for (int i = 0; i <= 1000; ++i) {
+        ASSERT_EQ(i, all[i]);
+    }
+}
+
+PARALLEL_TEST(StreamLoadPipeTest, read_whole_records_too_large) {
+    StreamLoadPipe pipe(/*max_buffered_bytes=*/64, /*min_chunk_size=*/16);
+    pipe.set_record_delimiter('\n');
+    ASSERT_OK(pipe.append("0123456789\n", 11));
+    ASSERT_OK(pipe.finish());
+
+    char buf[8];
+    size_t buf_len = sizeof(buf);
+    bool eof = false;
+    ASSERT_FALSE(pipe.read((uint8_t*)buf, &buf_len, &eof).ok());
+}
+
 } // namespace starrocks
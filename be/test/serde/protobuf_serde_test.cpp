@@ -83,4 +83,29 @@ PARALLEL_TEST(ProtobufChunkSerde, test_serde) {
     }
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(ProtobufChunkSerde, test_serialize_data) {
+    auto chunk = std::make_unique<vectorized::Chunk>(make_columns(2), make_schema(2));
+
+    StatusOr<ChunkPB> expected = serde::ProtobufChunkSerde::serialize_without_meta(*chunk);
+    ASSERT_TRUE(expected.ok()) << expected.status();
+
+    int64_t size = serde::ProtobufChunkSerde::max_serialized_size(*chunk);
+    std::vector<uint8_t> buff(size);
+    ChunkPB chunk_pb;
+    ASSERT_TRUE(serde::ProtobufChunkSerde::serialize_data(*chunk, buff.data(), size, &chunk_pb).ok());
+    ASSERT_FALSE(chunk_pb.has_data());
+    ASSERT_EQ(expected->serialized_size(), chunk_pb.serialized_size());
+    ASSERT_EQ(expected->uncompressed_size(), chunk_pb.uncompressed_size());
+    ASSERT_EQ(CompressionTypePB::NO_COMPRESSION, chunk_pb.compress_type());
+    ASSERT_EQ(expected->data().substr(0, expected->serialized_size()),
+              std::string(reinterpret_cast<const char*>(buff.data()), chunk_pb.serialized_size()));
+
+    ASSERT_EQ(0, chunk_pb.is_nulls_size());
+    serde::ProtobufChunkSerde::serialize_meta(*chunk, &chunk_pb);
+    ASSERT_EQ(2, chunk_pb.is_nulls_size());
+    ASSERT_EQ(2, chunk_pb.is_consts_size());
+    ASSERT_EQ(4, chunk_pb.slot_id_map_size());
+}
+
 } // namespace starrocks::serde
@@ -22,6 +22,7 @@
 #include "simd/simd.h"
 
 #include "gtest/gtest.h"
+#include "simd/gather.h"
 
 namespace starrocks::vectorized {
 
@@ -76,4 +77,30 @@ TEST_F(SIMDTest, count_nonzero) {
     EXPECT_EQ(30u, SIMD::count_nonzero(numbers));
 }
 
+template <typename T>
+static void check_gather() {
+    std::vector<T> table;
+    for (int i = 0; i < 50; i++) {
+        table.push_back(static_cast<T>(i * 3 + 1));
+    }
+    // not a multiple of the lanes
+    std::vector<uint32_t> indexes;
+    for (int i = 0; i < 37; i++) {
+        indexes.push_back((i * 7) % table.size());
+    }
+    std::vector<T> values(indexes.size());
+    SIMDGather::gather(values.data(), table.data(), indexes.data(), indexes.size());
+    for (size_t i = 0; i < indexes.size(); i++) {
+        EXPECT_EQ(table[indexes[i]], values[i]);
+    }
+}
+
+TEST_F(SIMDTest, gather_by_index) {
+    check_gather<int32_t>();
+    check_gather<float>();
+    check_gather<int64_t>();
+    check_gather<double>();
+    check_gather<int16_t>();
+}
+
 } // namespace starrocks::vectorized
@@ -8,6 +8,7 @@
 #include "column/field.h"
 #include "column/nullable_column.h"
 #include "column/schema.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "gtest/gtest.h"
 #include "runtime/descriptor_helper.h"
@@ -296,5 +297,21 @@ TEST_F(ChunkHelperTest, Accumulator) {
     EXPECT_EQ(input_rows, output_rows);
 }
 
+TEST_F(ChunkHelperTest, ChunkSizeForRowBytes) {
+    int64_t old_target_bytes = config::chunk_target_bytes;
+    config::chunk_target_bytes = 4096 * 1024;
+    // unknown or narrow rows
+    EXPECT_EQ(4096, ChunkHelper::chunk_size_for_row_bytes(4096, 0));
+    EXPECT_EQ(4096, ChunkHelper::chunk_size_for_row_bytes(4096, 8));
+    EXPECT_EQ(4096, ChunkHelper::chunk_size_for_row_bytes(4096, 1024));
+    // wide rows
+    EXPECT_EQ(2048, ChunkHelper::chunk_size_for_row_bytes(4096, 2048));
+    EXPECT_EQ(128, ChunkHelper::chunk_size_for_row_bytes(4096, 1024 * 1024));
+    // disabled
+    config::chunk_target_bytes = 0;
+    EXPECT_EQ(4096, ChunkHelper::chunk_size_for_row_bytes(4096, 1024 * 1024));
+    config::chunk_target_bytes = old_target_bytes;
+}
+
 } // namespace vectorized
 } // namespace starrocks
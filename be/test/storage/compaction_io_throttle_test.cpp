@@ -0,0 +1,57 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/compaction_io_throttle.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "util/defer_op.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+TEST(CompactionIOThrottleTest, test_unlimited) {
+    auto old_rate = config::compaction_hdd_io_bytes_per_second;
+    DeferOp defer([&]() { config::compaction_hdd_io_bytes_per_second = old_rate; });
+    config::compaction_hdd_io_bytes_per_second = 0;
+
+    CompactionIOThrottle throttle(false);
+    int64_t start = MonotonicMillis();
+    throttle.acquire(1L << 40);
+    ASSERT_LT(MonotonicMillis() - start, 100);
+    ASSERT_EQ(0, throttle.rate());
+    ASSERT_FALSE(throttle.is_busy());
+}
+
+TEST(CompactionIOThrottleTest, test_acquire) {
+    auto old_rate = config::compaction_ssd_io_bytes_per_second;
+    DeferOp defer([&]() { config::compaction_ssd_io_bytes_per_second = old_rate; });
+    config::compaction_ssd_io_bytes_per_second = 10 * 1024 * 1024;
+
+    CompactionIOThrottle throttle(true);
+    // The burst of the first second.
+    throttle.acquire(10 * 1024 * 1024);
+    int64_t start = MonotonicMillis();
+    throttle.acquire(2 * 1024 * 1024);
+    // 200ms for 2MB at 10MB/s.
+    ASSERT_GE(MonotonicMillis() - start, 150);
+}
+
+TEST(CompactionIOThrottleTest, test_adapt_to_scan_latency) {
+    auto old_rate = config::compaction_hdd_io_bytes_per_second;
+    auto old_latency = config::compaction_io_throttle_scan_latency_us;
+    DeferOp defer([&]() {
+        config::compaction_hdd_io_bytes_per_second = old_rate;
+        config::compaction_io_throttle_scan_latency_us = old_latency;
+    });
+    config::compaction_hdd_io_bytes_per_second = 100 * 1024 * 1024;
+    config::compaction_io_throttle_scan_latency_us = 1000;
+
+    CompactionIOThrottle throttle(false);
+    // 10ms per page read, way over the target.
+    throttle.update_scan_latency(100 * 1000 * 1000, 10);
+    ASSERT_TRUE(throttle.is_busy());
+    ASSERT_EQ(50 * 1024 * 1024, throttle.rate());
+}
+
+} // namespace starrocks
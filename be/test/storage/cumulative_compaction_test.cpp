@@ -106,14 +106,14 @@ public:
         tablet_meta->init_from_pb(&tablet_meta_pb);
     }
 
-    void rowset_writer_add_rows(std::unique_ptr<RowsetWriter>& writer) {
+    void rowset_writer_add_rows(std::unique_ptr<RowsetWriter>& writer, int32_t start_key = 0) {
         std::vector<std::string> test_data;
         auto schema = ChunkHelper::convert_schema_to_format_v2(*_tablet_schema);
         auto chunk = ChunkHelper::new_chunk(schema, 1024);
         for (size_t i = 0; i < 1024; ++i) {
             test_data.push_back("well" + std::to_string(i));
             auto& cols = chunk->columns();
-            cols[0]->append_datum(vectorized::Datum(static_cast<int32_t>(i)));
+            cols[0]->append_datum(vectorized::Datum(static_cast<int32_t>(start_key + i)));
             Slice field_1(test_data[i]);
             cols[1]->append_datum(vectorized::Datum(field_1));
             cols[2]->append_datum(vectorized::Datum(static_cast<int32_t>(10000 + i)));
@@ -253,6 +253,45 @@ TEST_F(CumulativeCompactionTest, test_vertical_compact_succeed) {
     do_compaction();
 }
 
+TEST_F(CumulativeCompactionTest, test_link_segments_in_key_order) {
+    create_tablet_schema(UNIQUE_KEYS);
+    RowsetWriterContext rowset_writer_context;
+    create_rowset_writer_context(&rowset_writer_context);
+    auto write_rowset = [&](int64_t id, int32_t start_key) {
+        RowsetId rowset_id;
+        rowset_id.init(id);
+        rowset_writer_context.rowset_id = rowset_id;
+        std::unique_ptr<RowsetWriter> writer;
+        CHECK_OK(RowsetFactory::create_rowset_writer(rowset_writer_context, &writer));
+        rowset_writer_add_rows(writer, start_key);
+        CHECK_OK(writer->flush());
+        return *writer->build();
+    };
+    auto rowset_1 = write_rowset(10000, 0);
+    auto rowset_2 = write_rowset(10001, 1024);
+    auto rowset_3 = write_rowset(10002, 1023);
+
+    ASSERT_TRUE(*CompactionUtils::segments_in_key_order(*_tablet_schema, {rowset_1, rowset_2}, false));
+    ASSERT_FALSE(*CompactionUtils::segments_in_key_order(*_tablet_schema, {rowset_2, rowset_1}, true));
+    // The last key of rowset_1 is the first key of rowset_3.
+    ASSERT_FALSE(*CompactionUtils::segments_in_key_order(*_tablet_schema, {rowset_1, rowset_3}, false));
+    ASSERT_TRUE(*CompactionUtils::segments_in_key_order(*_tablet_schema, {rowset_1, rowset_3}, true));
+
+    // The segments are linked one after another.
+    RowsetId output_id;
+    output_id.init(10003);
+    rowset_writer_context.rowset_id = output_id;
+    rowset_writer_context.segments_overlap = NONOVERLAPPING;
+    std::unique_ptr<RowsetWriter> writer;
+    ASSERT_OK(RowsetFactory::create_rowset_writer(rowset_writer_context, &writer));
+    ASSERT_OK(writer->add_rowset(rowset_1));
+    ASSERT_OK(writer->add_rowset(rowset_2));
+    auto output = *writer->build();
+    ASSERT_EQ(2, output->num_segments());
+    ASSERT_EQ(2048, output->num_rows());
+    ASSERT_TRUE(*CompactionUtils::segments_in_key_order(*_tablet_schema, {output}, false));
+}
+
 TEST_F(CumulativeCompactionTest, test_read_chunk_size) {
     // total row size is 0 in old segment
     int64_t mem_limit = 2147483648;
@@ -0,0 +1,194 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/delta_column_group.h"
+
+#include <gtest/gtest.h>
+
+#include "column/fixed_length_column.h"
+#include "fs/fs_util.h"
+#include "storage/range.h"
+#include "storage/tablet_schema.h"
+#include "storage/tablet_schema_helper.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+// A ColumnIterator over the values in memory, which stands for the column of the segment.
+class VectorColumnIterator final : public ColumnIterator {
+public:
+    explicit VectorColumnIterator(std::vector<int32_t> values) : _values(std::move(values)) {}
+
+    Status seek_to_first() override {
+        _ordinal = 0;
+        return Status::OK();
+    }
+
+    Status seek_to_ordinal(ordinal_t ord) override {
+        _ordinal = ord;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, ColumnBlockView* dst, bool* has_null) override {
+        return Status::NotSupported("");
+    }
+
+    Status next_batch(size_t* n, vectorized::Column* dst) override {
+        *n = std::min<size_t>(*n, _values.size() - _ordinal);
+        dst->append_numbers(_values.data() + _ordinal, *n * sizeof(int32_t));
+        _ordinal += *n;
+        return Status::OK();
+    }
+
+    Status next_batch(const vectorized::SparseRange& range, vectorized::Column* dst) override {
+        for (size_t i = 0; i < range.size(); i++) {
+            RETURN_IF_ERROR(seek_to_ordinal(range[i].begin()));
+            size_t n = range[i].span_size();
+            RETURN_IF_ERROR(next_batch(&n, dst));
+        }
+        return Status::OK();
+    }
+
+    ordinal_t get_current_ordinal() const override { return _ordinal; }
+
+    Status fetch_values_by_rowid(const rowid_t* rowids, size_t size, vectorized::Column* values) override {
+        for (size_t i = 0; i < size; i++) {
+            values->append_numbers(&_values[rowids[i]], sizeof(int32_t));
+        }
+        return Status::OK();
+    }
+
+private:
+    std::vector<int32_t> _values;
+    ordinal_t _ordinal = 0;
+};
+
+class DeltaColumnGroupTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_OK(fs::create_directories(kTestDir));
+        TabletSchemaPB schema_pb;
+        schema_pb.set_keys_type(PRIMARY_KEYS);
+        schema_pb.set_num_short_key_columns(1);
+        create_int_key(1, false).to_schema_pb(schema_pb.add_column());
+        create_int_value(2, OLAP_FIELD_AGGREGATION_REPLACE, false).to_schema_pb(schema_pb.add_column());
+        create_int_value(3, OLAP_FIELD_AGGREGATION_REPLACE, false).to_schema_pb(schema_pb.add_column());
+        _tablet_schema = std::make_unique<TabletSchema>(schema_pb);
+    }
+
+    void TearDown() override { ASSERT_OK(fs::remove_all(kTestDir)); }
+
+    // Write a group updating the column 3 of |rowids| to |values|.
+    DeltaColumnGroupPtr write_group(int64_t version, const std::vector<rowid_t>& rowids,
+                                    const std::vector<int32_t>& values) {
+        RowsetId rowset_id;
+        rowset_id.init(2, 1, 0, 0);
+        std::string file_name = DeltaColumnGroup::file_name(rowset_id, 0, version);
+        std::vector<std::unique_ptr<vectorized::Column>> columns;
+        columns.emplace_back(std::make_unique<vectorized::Int32Column>());
+        columns[0]->append_numbers(values.data(), values.size() * sizeof(int32_t));
+        CHECK(DeltaColumnGroup::write(kTestDir + "/" + file_name, *_tablet_schema, {3}, rowids, columns).ok());
+
+        DeltaColumnGroupPB pb;
+        pb.set_version(version);
+        pb.set_file_name(file_name);
+        pb.add_column_unique_ids(3);
+        pb.set_num_rows(rowids.size());
+        auto dcg = std::make_shared<DeltaColumnGroup>(pb);
+        CHECK(dcg->load(kTestDir, *_tablet_schema).ok());
+        return dcg;
+    }
+
+    std::unique_ptr<DeltaColumnIterator> new_iterator(const std::vector<DeltaColumnGroupPtr>& dcgs) {
+        std::vector<int32_t> base(kNumRows);
+        for (int32_t i = 0; i < kNumRows; i++) {
+            base[i] = i;
+        }
+        std::vector<std::pair<DeltaColumnGroupPtr, size_t>> groups;
+        for (const auto& dcg : dcgs) {
+            groups.emplace_back(dcg, 0);
+        }
+        auto iter = std::make_unique<DeltaColumnIterator>(std::make_unique<VectorColumnIterator>(std::move(base)),
+                                                          kNumRows, std::move(groups));
+        ColumnIteratorOptions opts;
+        CHECK(iter->init(opts).ok());
+        return iter;
+    }
+
+    const std::string kTestDir = "./ut_dir/delta_column_group_test";
+    static constexpr int32_t kNumRows = 100;
+    std::unique_ptr<TabletSchema> _tablet_schema;
+};
+
+TEST_F(DeltaColumnGroupTest, test_write_and_load) {
+    auto dcg = write_group(2, {1, 3, 50}, {-1, -3, -50});
+    ASSERT_EQ(2, dcg->version());
+    ASSERT_EQ(0, dcg->column_index(3));
+    ASSERT_EQ(-1, dcg->column_index(2));
+    ASSERT_EQ((std::vector<rowid_t>{1, 3, 50}), dcg->rowids());
+    ASSERT_EQ(3, dcg->column(0).size());
+    ASSERT_EQ(-3, dcg->column(0).get(1).get_int32());
+    ASSERT_GT(dcg->memory_usage(), 0);
+
+    DeltaColumnGroupList dcgs{dcg};
+    ASSERT_TRUE(is_column_updated(dcgs, 3));
+    ASSERT_FALSE(is_column_updated(dcgs, 2));
+
+    DeltaColumnGroupPB pb;
+    dcg->to_pb(&pb);
+    ASSERT_EQ(dcg->file_name(), pb.file_name());
+    ASSERT_EQ(3, pb.num_rows());
+}
+
+TEST_F(DeltaColumnGroupTest, test_overlay) {
+    // rowid 3 is updated twice, the later one wins
+    auto iter = new_iterator({write_group(2, {1, 3, 50}, {-1, -3, -50}), write_group(3, {3, 99}, {-30, -99})});
+
+    auto expected = [](rowid_t rowid) {
+        switch (rowid) {
+        case 1:
+            return -1;
+        case 3:
+            return -30;
+        case 50:
+            return -50;
+        case 99:
+            return -99;
+        default:
+            return static_cast<int32_t>(rowid);
+        }
+    };
+
+    auto column = std::make_unique<vectorized::Int32Column>();
+    ASSERT_OK(iter->seek_to_first());
+    for (size_t n = 7; column->size() < kNumRows;) {
+        ASSERT_OK(iter->next_batch(&n, column.get()));
+    }
+    for (rowid_t i = 0; i < kNumRows; i++) {
+        ASSERT_EQ(expected(i), column->get(i).get_int32()) << i;
+    }
+
+    column->reset_column();
+    vectorized::SparseRange range;
+    range.add(vectorized::Range(2, 4));
+    range.add(vectorized::Range(49, 51));
+    ASSERT_OK(iter->next_batch(range, column.get()));
+    std::vector<rowid_t> rowids{2, 3, 49, 50};
+    ASSERT_EQ(rowids.size(), column->size());
+    for (size_t i = 0; i < rowids.size(); i++) {
+        ASSERT_EQ(expected(rowids[i]), column->get(i).get_int32()) << rowids[i];
+    }
+
+    column->reset_column();
+    rowids = {0, 1, 3, 98, 99};
+    ASSERT_OK(iter->fetch_values_by_rowid(rowids.data(), rowids.size(), column.get()));
+    ASSERT_EQ(rowids.size(), column->size());
+    for (size_t i = 0; i < rowids.size(); i++) {
+        ASSERT_EQ(expected(rowids[i]), column->get(i).get_int32()) << rowids[i];
+    }
+
+    vectorized::SparseRange zm_range;
+    ASSERT_OK(iter->get_row_ranges_by_zone_map({}, nullptr, &zm_range));
+    ASSERT_EQ(kNumRows, zm_range.span_size());
+}
+
+} // namespace starrocks
@@ -83,6 +83,28 @@ TEST_F(FileUtilsTest, TestCopyFile) {
     ASSERT_EQ(4194317, std::filesystem::file_size(dst_file_name));
 }
 
+TEST_F(FileUtilsTest, TestCopyLocalFile) {
+    std::string src_file_name = _s_test_data_path + "/copy_local_src.txt";
+    std::string content;
+    for (int i = 0; i < 100000; ++i) {
+        content.append(std::to_string(i));
+    }
+    save_string_file(src_file_name, content);
+    ASSIGN_OR_ABORT(auto src_md5, fs::md5sum(src_file_name));
+
+    std::string dst_file_name = _s_test_data_path + "/copy_local_dst.txt";
+    ASSERT_OK(fs::copy_local_file(src_file_name, dst_file_name));
+    ASSERT_EQ(content.size(), std::filesystem::file_size(dst_file_name));
+    ASSERT_EQ(src_md5, *fs::md5sum(dst_file_name));
+
+    // Overwrite the existing file, and copy it at most 4MB/s.
+    ASSERT_OK(fs::copy_local_file(src_file_name, dst_file_name, 4 << 20));
+    ASSERT_EQ(content.size(), std::filesystem::file_size(dst_file_name));
+    ASSERT_EQ(src_md5, *fs::md5sum(dst_file_name));
+
+    ASSERT_FALSE(fs::copy_local_file(_s_test_data_path + "/not_exist.txt", dst_file_name).ok());
+}
+
 TEST_F(FileUtilsTest, TestRemove) {
     // remove_all
     ASSERT_OK(fs::remove_all("./file_test"));
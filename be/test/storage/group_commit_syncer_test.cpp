@@ -0,0 +1,67 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/group_commit_syncer.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "fs/fs_util.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class GroupCommitSyncerTest : public testing::Test {
+protected:
+    void SetUp() override {
+        (void)fs::remove_all(kTestDir);
+        ASSERT_OK(fs::create_directories(kTestDir));
+    }
+
+    void TearDown() override { (void)fs::remove_all(kTestDir); }
+
+    constexpr static const char* const kTestDir = "./group_commit_syncer_test";
+};
+
+TEST_F(GroupCommitSyncerTest, test_sync) {
+    GroupCommitSyncer syncer(kTestDir);
+    ASSERT_OK(syncer.sync());
+    ASSERT_OK(syncer.sync());
+    ASSERT_EQ(2, syncer.num_rounds());
+}
+
+TEST_F(GroupCommitSyncerTest, test_concurrent_sync) {
+    GroupCommitSyncer syncer(kTestDir);
+    constexpr int kNumThreads = 16;
+    constexpr int kNumSyncs = 20;
+    std::vector<std::thread> threads;
+    std::atomic<int> num_failed{0};
+    for (int i = 0; i < kNumThreads; i++) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < kNumSyncs; j++) {
+                if (!syncer.sync().ok()) {
+                    num_failed++;
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    ASSERT_EQ(0, num_failed);
+    // Each round covers one or more of the calls.
+    ASSERT_GT(syncer.num_rounds(), 0);
+    ASSERT_LE(syncer.num_rounds(), kNumThreads * kNumSyncs);
+}
+
+TEST_F(GroupCommitSyncerTest, test_error_is_sticky) {
+    GroupCommitSyncer syncer("./group_commit_syncer_test_not_exist");
+    ASSERT_FALSE(syncer.sync().ok());
+    ASSERT_OK(fs::create_directories("./group_commit_syncer_test_not_exist"));
+    ASSERT_FALSE(syncer.sync().ok());
+    (void)fs::remove_all("./group_commit_syncer_test_not_exist");
+}
+
+} // namespace starrocks
@@ -193,6 +193,33 @@ TEST_F(TestHll, Normal) {
     }
 }
 
+TEST_F(TestHll, UpdateBatch) {
+    for (size_t num_values : {0, 10, 160, 161, 1000, 100000}) {
+        std::vector<uint64_t> hash_values;
+        for (size_t i = 0; i < num_values; ++i) {
+            hash_values.push_back(hash(i));
+        }
+        HyperLogLog expected;
+        for (auto value : hash_values) {
+            expected.update(value);
+        }
+        HyperLogLog batch;
+        batch.update_batch(hash_values.data(), hash_values.size());
+        ASSERT_EQ(expected.estimate_cardinality(), batch.estimate_cardinality());
+        std::string expected_bytes(expected.max_serialized_size(), '\0');
+        expected_bytes.resize(expected.serialize(reinterpret_cast<uint8_t*>(expected_bytes.data())));
+        std::string batch_bytes(batch.max_serialized_size(), '\0');
+        batch_bytes.resize(batch.serialize(reinterpret_cast<uint8_t*>(batch_bytes.data())));
+        ASSERT_EQ(expected_bytes, batch_bytes);
+
+        // A value already holding registers.
+        HyperLogLog merged;
+        merged.update_batch(hash_values.data(), hash_values.size() / 2);
+        merged.update_batch(hash_values.data() + hash_values.size() / 2, hash_values.size() - hash_values.size() / 2);
+        ASSERT_EQ(expected.estimate_cardinality(), merged.estimate_cardinality());
+    }
+}
+
 TEST_F(TestHll, InvalidPtr) {
     {
         HyperLogLog hll(Slice((char*)nullptr, 0));
@@ -73,6 +73,47 @@ TEST_F(GCTest, test_metadata_gc) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(GCTest, test_metadata_gc_obsolete_files) {
+    auto fs = FileSystem::Default();
+    auto tablet_id = next_id();
+    auto version_count = config::lake_gc_metadata_max_versions + 2;
+    // Version i + 1 obsoletes the file of version i.
+    std::vector<std::string> files;
+    for (int i = 0; i < version_count; i++) {
+        files.emplace_back(fmt::format("{}.dat", generate_uuid_string()));
+        ASSIGN_OR_ABORT(auto wf, fs->new_writable_file(s_tablet_manager->segment_location(tablet_id, files.back())));
+        ASSERT_OK(wf->close());
+
+        auto metadata = std::make_shared<TabletMetadata>();
+        metadata->set_id(tablet_id);
+        metadata->set_version(i + 1);
+        metadata->set_next_rowset_id(i + 2);
+        auto rowset = metadata->add_rowsets();
+        rowset->set_id(i + 1);
+        rowset->add_segments(files.back());
+        if (i > 0) {
+            metadata->add_obsolete_files(files[i - 1]);
+        }
+        ASSERT_OK(s_tablet_manager->put_tablet_metadata(metadata));
+    }
+
+    ASSERT_OK(metadata_gc(kTestDir, s_tablet_manager.get()));
+
+    // Version 1 and 2 are deleted, so are the files obsoleted by version 2 and 3.
+    for (int i = 0; i < version_count; i++) {
+        auto metadata_st = fs->path_exists(s_tablet_manager->tablet_metadata_location(tablet_id, i + 1));
+        auto file_st = fs->path_exists(s_tablet_manager->segment_location(tablet_id, files[i]));
+        if (i < 2) {
+            ASSERT_TRUE(metadata_st.is_not_found()) << metadata_st;
+            ASSERT_TRUE(file_st.is_not_found()) << file_st;
+        } else {
+            ASSERT_OK(metadata_st);
+            ASSERT_OK(file_st);
+        }
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(GCTest, segment_metadata_gc) {
     auto fs = FileSystem::Default();
@@ -186,6 +186,15 @@ TEST_F(DuplicateKeyHorizontalCompactionTest, test1) {
     ASSIGN_OR_ABORT(auto new_tablet_metadata, _tablet_manager->get_tablet_metadata(tablet_id, version));
     ASSERT_EQ(1, new_tablet_metadata->cumulative_point());
     ASSERT_EQ(1, new_tablet_metadata->rowsets_size());
+
+    // The input segments are recorded as the obsolete files of the new version.
+    ASSIGN_OR_ABORT(auto base_tablet_metadata, _tablet_manager->get_tablet_metadata(tablet_id, version - 1));
+    std::vector<std::string> input_segments;
+    for (const auto& rowset : base_tablet_metadata->rowsets()) {
+        input_segments.insert(input_segments.end(), rowset.segments().begin(), rowset.segments().end());
+    }
+    ASSERT_EQ(input_segments, std::vector<std::string>(new_tablet_metadata->obsolete_files().begin(),
+                                                       new_tablet_metadata->obsolete_files().end()));
 }
 
 class UniqueKeyHorizontalCompactionTest : public testing::Test {
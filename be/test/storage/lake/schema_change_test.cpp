@@ -6,6 +6,7 @@
 
 #include "column/fixed_length_column.h"
 #include "column/datum_tuple.h"
+#include "common/config.h"
 #include "fs/fs_util.h"
 #include "runtime/exec_env.h"
 #include "storage/chunk_helper.h"
@@ -16,6 +17,7 @@
 #include "storage/lake/tablet_manager.h"
 #include "testutil/assert.h"
 #include "testutil/id_generator.h"
+#include "util/defer_op.h"
 
 namespace starrocks::lake {
 
@@ -355,6 +357,10 @@ protected:
 };
 
 TEST_F(DirectSchemaChangeTest, test_alter_column_type) {
+    // Rewrite the data instead of widening c1 at read time.
+    config::enable_lazy_schema_change_widening = false;
+    DeferOp defer([]() { config::enable_lazy_schema_change_widening = true; });
+
     std::vector<int> k0{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
     std::vector<int> v0{2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24};
 
@@ -444,6 +450,72 @@ TEST_F(DirectSchemaChangeTest, test_alter_column_type) {
     ASSERT_TRUE(st.is_end_of_file());
 }
 
+TEST_F(DirectSchemaChangeTest, test_widen_column_type_lazily) {
+    std::vector<int> k0{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    std::vector<int> v0{2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24};
+
+    auto c0 = Int32Column::create();
+    auto c1 = Int32Column::create();
+    c0->append_numbers(k0.data(), k0.size() * sizeof(int));
+    c1->append_numbers(v0.data(), v0.size() * sizeof(int));
+    VChunk chunk0({c0, c1}, _base_schema);
+
+    auto indexes = std::vector<uint32_t>(k0.size());
+    for (int i = 0; i < k0.size(); i++) {
+        indexes[i] = i;
+    }
+
+    int64_t version = 1;
+    int64_t txn_id = 1000;
+    auto base_tablet_id = _base_tablet_metadata->id();
+    {
+        auto delta_writer = DeltaWriter::create(base_tablet_id, txn_id, _partition_id, nullptr, _mem_tracker.get());
+        ASSERT_OK(delta_writer->open());
+        ASSERT_OK(delta_writer->write(chunk0, indexes.data(), indexes.size()));
+        ASSERT_OK(delta_writer->finish());
+        delta_writer->close();
+        ASSERT_OK(_tablet_manager->publish_version(base_tablet_id, version, version + 1, &txn_id, 1));
+        version++;
+        txn_id++;
+    }
+
+    auto new_tablet_id = _new_tablet_metadata->id();
+    TAlterTabletReqV2 request;
+    request.base_tablet_id = base_tablet_id;
+    request.new_tablet_id = new_tablet_id;
+    request.alter_version = version;
+    request.txn_id = txn_id;
+
+    SchemaChangeHandler handler;
+    ASSERT_OK(handler.process_alter_tablet(request));
+    ASSERT_OK(_tablet_manager->publish_version(new_tablet_id, 1, version + 1, &txn_id, 1));
+    version++;
+    txn_id++;
+
+    // The segments of the base tablet are linked.
+    ASSIGN_OR_ABORT(auto base_metadata, _tablet_manager->get_tablet_metadata(base_tablet_id, version - 1));
+    ASSIGN_OR_ABORT(auto new_metadata, _tablet_manager->get_tablet_metadata(new_tablet_id, version));
+    ASSERT_EQ(1, new_metadata->rowsets_size());
+    ASSERT_EQ(base_metadata->rowsets(0).segments(0), new_metadata->rowsets(0).segments(0));
+
+    ASSIGN_OR_ABORT(auto new_tablet, _tablet_manager->get_tablet(new_tablet_id));
+    ASSIGN_OR_ABORT(auto reader, new_tablet.new_reader(version, *_new_schema));
+    CHECK_OK(reader->prepare());
+    CHECK_OK(reader->open(TabletReaderParams()));
+
+    auto chunk = ChunkHelper::new_chunk(*_new_schema, 1024);
+    CHECK_OK(reader->get_next(chunk.get()));
+    ASSERT_EQ(k0.size(), chunk->num_rows());
+    for (int i = 0, sz = k0.size(); i < sz; i++) {
+        EXPECT_EQ(k0[i], chunk->get(i)[0].get_int32());
+        EXPECT_EQ(v0[i], chunk->get(i)[1].get_int64());
+    }
+    chunk->reset();
+
+    auto st = reader->get_next(chunk.get());
+    ASSERT_TRUE(st.is_end_of_file());
+}
+
 class SortedSchemaChangeTest : public testing::Test {
 public:
     SortedSchemaChangeTest() {
@@ -9,6 +9,7 @@
 
 #include "common/config.h"
 #include "fs/fs.h"
+#include "fs/fs_util.h"
 #include "gen_cpp/AgentService_types.h"
 #include "storage/lake/fixed_location_provider.h"
 #include "storage/lake/location_provider.h"
@@ -329,6 +330,48 @@ TEST_F(LakeTabletManagerTest, tablet_schema_load) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(LakeTabletManagerTest, prefetch_metadata) {
+    lake::TabletManager tablet_manager(_location_provider, 1024 * 1024);
+    std::vector<std::pair<int64_t, int64_t>> tablets;
+    for (int64_t tablet_id = 20000; tablet_id < 20010; tablet_id++) {
+        starrocks::lake::TabletMetadata metadata;
+        metadata.set_id(tablet_id);
+        metadata.set_version(2);
+        auto schema = metadata.mutable_schema();
+        schema->set_id(tablet_id);
+        schema->set_num_short_key_columns(1);
+        schema->set_keys_type(DUP_KEYS);
+        schema->set_num_rows_per_row_block(65535);
+        auto c0 = schema->add_column();
+        c0->set_unique_id(0);
+        c0->set_name("c0");
+        c0->set_type("INT");
+        c0->set_is_key(true);
+        c0->set_is_nullable(false);
+        tablet_root_location(tablet_id);
+        ASSERT_OK(tablet_manager.put_tablet_metadata(metadata));
+        tablets.emplace_back(tablet_id, 2);
+    }
+    tablet_manager.prune_metacache();
+    ASSERT_OK(tablet_manager.prefetch_metadata(tablets, true));
+
+    // Served by the metadata cache after the files are gone.
+    for (const auto& [tablet_id, version] : tablets) {
+        ASSERT_OK(fs::delete_file(tablet_manager.tablet_metadata_location(tablet_id, version)));
+    }
+    for (const auto& [tablet_id, version] : tablets) {
+        ASSIGN_OR_ABORT(auto metadata, tablet_manager.get_tablet_metadata(tablet_id, version));
+        ASSERT_EQ(tablet_id, metadata->id());
+        ASSIGN_OR_ABORT(auto tablet, tablet_manager.get_tablet(tablet_id));
+        ASSIGN_OR_ABORT(auto schema, tablet.get_schema());
+        ASSERT_EQ(tablet_id, schema->id());
+    }
+
+    tablets.emplace_back(30000, 2);
+    ASSERT_FALSE(tablet_manager.prefetch_metadata(tablets, false).ok());
+}
+
 // NOLINTNEXTLINE
 TEST_F(LakeTabletManagerTest, create_from_base_tablet) {
     // Create base tablet:
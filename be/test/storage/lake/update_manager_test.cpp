@@ -0,0 +1,200 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/lake/update_manager.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "column/schema.h"
+#include "column/vectorized_fwd.h"
+#include "common/logging.h"
+#include "fs/fs_util.h"
+#include "runtime/mem_tracker.h"
+#include "storage/chunk_helper.h"
+#include "storage/lake/filenames.h"
+#include "storage/lake/fixed_location_provider.h"
+#include "storage/lake/tablet.h"
+#include "storage/lake/tablet_manager.h"
+#include "storage/lake/tablet_reader.h"
+#include "storage/lake/tablet_writer.h"
+#include "storage/tablet_schema.h"
+#include "testutil/assert.h"
+#include "testutil/id_generator.h"
+
+namespace starrocks::lake {
+
+using namespace starrocks::vectorized;
+
+using VSchema = starrocks::vectorized::Schema;
+using VChunk = starrocks::vectorized::Chunk;
+
+class LakeUpdateManagerTest : public testing::Test {
+public:
+    LakeUpdateManagerTest() {
+        _mem_tracker = std::make_unique<MemTracker>(-1);
+        _location_provider = std::make_unique<FixedLocationProvider>(kTestGroupPath);
+        _tablet_manager = std::make_unique<TabletManager>(_location_provider.get(), 0);
+        _tablet_metadata = std::make_unique<TabletMetadata>();
+        _tablet_metadata->set_id(next_id());
+        _tablet_metadata->set_version(1);
+        _tablet_metadata->set_next_rowset_id(1);
+        //
+        //  | column | type | KEY | NULL |
+        //  +--------+------+-----+------+
+        //  |   c0   |  INT | YES |  NO  |
+        //  |   c1   |  INT | NO  |  NO  |
+        auto schema = _tablet_metadata->mutable_schema();
+        schema->set_id(next_id());
+        schema->set_num_short_key_columns(1);
+        schema->set_keys_type(PRIMARY_KEYS);
+        schema->set_num_rows_per_row_block(65535);
+        schema->set_compress_kind(COMPRESS_LZ4);
+        auto c0 = schema->add_column();
+        {
+            c0->set_unique_id(next_id());
+            c0->set_name("c0");
+            c0->set_type("INT");
+            c0->set_is_key(true);
+            c0->set_is_nullable(false);
+        }
+        auto c1 = schema->add_column();
+        {
+            c1->set_unique_id(next_id());
+            c1->set_name("c1");
+            c1->set_type("INT");
+            c1->set_is_key(false);
+            c1->set_is_nullable(false);
+        }
+
+        _tablet_schema = TabletSchema::create(_mem_tracker.get(), *schema);
+        _schema = std::make_shared<VSchema>(ChunkHelper::convert_schema(*_tablet_schema));
+    }
+
+    void SetUp() override {
+        (void)fs::remove_all(kTestGroupPath);
+        CHECK_OK(fs::create_directories(kTestGroupPath));
+        CHECK_OK(_tablet_manager->put_tablet_metadata(*_tablet_metadata));
+    }
+
+    void TearDown() override { (void)fs::remove_all(kTestGroupPath); }
+
+protected:
+    constexpr static const char* const kTestGroupPath = "test_lake_update_manager";
+
+    VChunk generate_chunk(const std::vector<int>& keys, int value_factor) {
+        std::vector<int> values;
+        for (int k : keys) {
+            values.push_back(k * value_factor);
+        }
+        auto c0 = Int32Column::create();
+        auto c1 = Int32Column::create();
+        c0->append_numbers(keys.data(), keys.size() * sizeof(int));
+        c1->append_numbers(values.data(), values.size() * sizeof(int));
+        return VChunk({c0, c1}, _schema);
+    }
+
+    // Write |upserts| and then delete |deletes| in txn |txn_id|.
+    void write_txn(Tablet* tablet, int64_t txn_id, const VChunk& upserts, const std::vector<int>& deletes) {
+        ASSIGN_OR_ABORT(auto writer, tablet->new_writer());
+        ASSERT_OK(writer->open());
+        ASSERT_OK(writer->write(upserts));
+        ASSERT_OK(writer->flush());
+        if (!deletes.empty()) {
+            // The encoded key of a single INT key column is the column itself.
+            auto del_column = Int32Column::create();
+            del_column->append_numbers(deletes.data(), deletes.size() * sizeof(int));
+            ASSERT_OK(writer->flush_del_file(*del_column));
+        }
+        ASSERT_OK(writer->finish());
+
+        auto txn_log = std::make_shared<TxnLog>();
+        txn_log->set_tablet_id(tablet->id());
+        txn_log->set_txn_id(txn_id);
+        auto op_write = txn_log->mutable_op_write();
+        for (auto& f : writer->files()) {
+            if (is_segment(f)) {
+                op_write->mutable_rowset()->add_segments(f);
+            } else {
+                op_write->add_deletes(f);
+            }
+        }
+        op_write->mutable_rowset()->set_num_rows(writer->num_rows());
+        op_write->mutable_rowset()->set_data_size(writer->data_size());
+        op_write->mutable_rowset()->set_overlapped(false);
+        writer->close();
+        ASSERT_OK(tablet->put_txn_log(std::move(txn_log)));
+    }
+
+    std::map<int, int> read_rows(Tablet* tablet, int64_t version) {
+        std::map<int, int> rows;
+        ASSIGN_OR_ABORT(auto reader, tablet->new_reader(version, *_schema));
+        CHECK_OK(reader->prepare());
+        CHECK_OK(reader->open(TabletReaderParams()));
+        auto chunk = ChunkHelper::new_chunk(*_schema, 1024);
+        while (true) {
+            chunk->reset();
+            auto st = reader->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            CHECK_OK(st);
+            for (int i = 0; i < chunk->num_rows(); i++) {
+                auto row = chunk->get(i);
+                EXPECT_TRUE(rows.emplace(row[0].get_int32(), row[1].get_int32()).second) << row[0].get_int32();
+            }
+        }
+        reader->close();
+        return rows;
+    }
+
+    std::unique_ptr<MemTracker> _mem_tracker;
+    std::unique_ptr<FixedLocationProvider> _location_provider;
+    std::unique_ptr<TabletManager> _tablet_manager;
+    std::unique_ptr<TabletMetadata> _tablet_metadata;
+    std::shared_ptr<TabletSchema> _tablet_schema;
+    std::shared_ptr<VSchema> _schema;
+};
+
+TEST_F(LakeUpdateManagerTest, test_upsert_and_delete) {
+    ASSIGN_OR_ABORT(auto tablet, _tablet_manager->get_tablet(_tablet_metadata->id()));
+
+    int64_t txn_id = next_id();
+    write_txn(&tablet, txn_id, generate_chunk({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, 1), {});
+    ASSERT_OK(_tablet_manager->publish_version(tablet.id(), 1, 2, &txn_id, 1));
+
+    // Replace 0~4 and delete 8 and 9.
+    txn_id = next_id();
+    write_txn(&tablet, txn_id, generate_chunk({0, 1, 2, 3, 4}, 10), {8, 9});
+    ASSERT_OK(_tablet_manager->publish_version(tablet.id(), 2, 3, &txn_id, 1));
+
+    ASSIGN_OR_ABORT(auto metadata, tablet.get_metadata(3));
+    ASSERT_EQ(2, metadata->rowsets_size());
+    ASSERT_EQ(1, metadata->rowsets(0).del_vectors_size());
+    ASSERT_FALSE(metadata->rowsets(0).del_vectors(0).empty());
+    ASSERT_EQ(0, metadata->rowsets(1).del_vectors_size());
+
+    std::map<int, int> expected{{0, 0}, {1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 5}, {6, 6}, {7, 7}};
+    ASSERT_EQ(expected, read_rows(&tablet, 3));
+    // The old version is not changed.
+    ASSERT_EQ(10, read_rows(&tablet, 2).size());
+
+    // The index is rebuilt from the metadata if the cached one is of another version, e.g. the previous
+    // version was published by another compute node.
+    TabletManager other_manager(_location_provider.get(), 0);
+    txn_id = next_id();
+    write_txn(&tablet, txn_id, generate_chunk({5, 10}, 100), {0});
+    ASSERT_OK(other_manager.publish_version(tablet.id(), 3, 4, &txn_id, 1));
+    std::map<int, int> expected2{{1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 500}, {6, 6}, {7, 7}, {10, 1000}};
+    ASSERT_EQ(expected2, read_rows(&tablet, 4));
+
+    txn_id = next_id();
+    write_txn(&tablet, txn_id, generate_chunk({1}, 1), {});
+    ASSERT_OK(_tablet_manager->publish_version(tablet.id(), 4, 5, &txn_id, 1));
+    std::map<int, int> expected3{{1, 1}, {2, 20}, {3, 30}, {4, 40}, {5, 500}, {6, 6}, {7, 7}, {10, 1000}};
+    ASSERT_EQ(expected3, read_rows(&tablet, 5));
+}
+
+} // namespace starrocks::lake
@@ -0,0 +1,204 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/lake/vertical_compaction_task.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "column/schema.h"
+#include "column/vectorized_fwd.h"
+#include "common/config.h"
+#include "fs/fs_util.h"
+#include "runtime/exec_env.h"
+#include "runtime/mem_tracker.h"
+#include "storage/chunk_helper.h"
+#include "storage/lake/delta_writer.h"
+#include "storage/lake/fixed_location_provider.h"
+#include "storage/lake/tablet.h"
+#include "storage/lake/tablet_manager.h"
+#include "storage/lake/tablet_reader.h"
+#include "storage/lake/txn_log.h"
+#include "testutil/assert.h"
+#include "testutil/id_generator.h"
+#include "util/defer_op.h"
+
+namespace starrocks::lake {
+
+using namespace starrocks::vectorized;
+
+using VSchema = starrocks::vectorized::Schema;
+using VChunk = starrocks::vectorized::Chunk;
+
+class VerticalCompactionTest : public testing::TestWithParam<KeysType> {
+public:
+    VerticalCompactionTest() {
+        _tablet_manager = ExecEnv::GetInstance()->lake_tablet_manager();
+
+        _parent_mem_tracker = std::make_unique<MemTracker>(-1);
+        _mem_tracker = std::make_unique<MemTracker>(-1, "", _parent_mem_tracker.get());
+        _location_provider = std::make_unique<FixedLocationProvider>(kTestGroupPath);
+        _backup_location_provider = _tablet_manager->TEST_set_location_provider(_location_provider.get());
+
+        _tablet_metadata = std::make_shared<TabletMetadata>();
+        _tablet_metadata->set_id(next_id());
+        _tablet_metadata->set_version(1);
+        _tablet_metadata->set_cumulative_point(0);
+        //
+        //  | column | type | KEY | NULL |
+        //  +--------+------+-----+------+
+        //  |   c0   |  INT | YES |  NO  |
+        //  |   c1   |  INT | NO  |  NO  |
+        //  |   c2   |  INT | NO  |  NO  |
+        //  |   c3   |  INT | NO  |  NO  |
+        auto schema = _tablet_metadata->mutable_schema();
+        schema->set_id(next_id());
+        schema->set_num_short_key_columns(1);
+        schema->set_keys_type(GetParam());
+        schema->set_num_rows_per_row_block(65535);
+        schema->set_compress_kind(COMPRESS_LZ4);
+        for (int i = 0; i < kNumColumns; i++) {
+            auto c = schema->add_column();
+            c->set_unique_id(next_id());
+            c->set_name(fmt::format("c{}", i));
+            c->set_type("INT");
+            c->set_is_key(i == 0);
+            c->set_is_nullable(false);
+            if (i > 0 && GetParam() == UNIQUE_KEYS) {
+                c->set_aggregation("REPLACE");
+            }
+        }
+
+        _tablet_schema = TabletSchema::create(_mem_tracker.get(), *schema);
+        _schema = std::make_shared<VSchema>(ChunkHelper::convert_schema(*_tablet_schema));
+    }
+
+protected:
+    constexpr static const char* const kTestGroupPath = "test_lake_vcompaction_task";
+    constexpr static const int kChunkSize = 12;
+    constexpr static const int kNumColumns = 4;
+
+    void SetUp() override {
+        (void)ExecEnv::GetInstance()->lake_tablet_manager()->TEST_set_location_provider(_location_provider.get());
+        (void)fs::remove_all(kTestGroupPath);
+        CHECK_OK(fs::create_directories(kTestGroupPath));
+        CHECK_OK(_tablet_manager->put_tablet_metadata(*_tablet_metadata));
+    }
+
+    void TearDown() override {
+        ASSIGN_OR_ABORT(auto tablet, _tablet_manager->get_tablet(_tablet_metadata->id()));
+        tablet.delete_txn_log(_txn_id);
+        _txn_id++;
+        (void)ExecEnv::GetInstance()->lake_tablet_manager()->TEST_set_location_provider(_backup_location_provider);
+        (void)fs::remove_all(kTestGroupPath);
+    }
+
+    // The value of the column i of a row is c0 * (i + 1).
+    VChunk generate_data(int64_t chunk_size) {
+        std::vector<int> v0(chunk_size);
+        for (int i = 0; i < chunk_size; i++) {
+            v0[i] = i;
+        }
+        auto rng = std::default_random_engine{};
+        std::shuffle(v0.begin(), v0.end(), rng);
+
+        Columns columns;
+        for (int i = 0; i < kNumColumns; i++) {
+            std::vector<int> v(chunk_size);
+            for (int j = 0; j < chunk_size; j++) {
+                v[j] = v0[j] * (i + 1);
+            }
+            auto c = Int32Column::create();
+            c->append_numbers(v.data(), v.size() * sizeof(int));
+            columns.emplace_back(std::move(c));
+        }
+        return VChunk(std::move(columns), _schema);
+    }
+
+    // Returns the number of rows, and checks the values of each row.
+    int64_t read(int64_t version) {
+        ASSIGN_OR_ABORT(auto tablet, _tablet_manager->get_tablet(_tablet_metadata->id()));
+        ASSIGN_OR_ABORT(auto reader, tablet.new_reader(version, *_schema));
+        CHECK_OK(reader->prepare());
+        CHECK_OK(reader->open(TabletReaderParams()));
+        auto chunk = ChunkHelper::new_chunk(*_schema, 128);
+        int64_t ret = 0;
+        while (true) {
+            auto st = reader->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            CHECK_OK(st);
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                auto c0 = chunk->get_column_by_index(0)->get(i).get_int32();
+                for (int j = 1; j < kNumColumns; j++) {
+                    EXPECT_EQ(c0 * (j + 1), chunk->get_column_by_index(j)->get(i).get_int32());
+                }
+            }
+            ret += chunk->num_rows();
+            chunk->reset();
+        }
+        return ret;
+    }
+
+    TabletManager* _tablet_manager;
+    std::unique_ptr<MemTracker> _parent_mem_tracker;
+    std::unique_ptr<MemTracker> _mem_tracker;
+    std::unique_ptr<FixedLocationProvider> _location_provider;
+    LocationProvider* _backup_location_provider;
+    std::shared_ptr<TabletMetadata> _tablet_metadata;
+    std::shared_ptr<TabletSchema> _tablet_schema;
+    std::shared_ptr<VSchema> _schema;
+    int64_t _partition_id = 4563;
+    int64_t _txn_id = 1003;
+};
+
+TEST_P(VerticalCompactionTest, test1) {
+    auto old_max_columns_per_group = config::vertical_compaction_max_columns_per_group;
+    config::vertical_compaction_max_columns_per_group = 2;
+    DeferOp defer([&]() { config::vertical_compaction_max_columns_per_group = old_max_columns_per_group; });
+
+    // Prepare data for writing
+    auto chunk0 = generate_data(kChunkSize);
+    auto indexes = std::vector<uint32_t>(kChunkSize);
+    for (int i = 0; i < kChunkSize; i++) {
+        indexes[i] = i;
+    }
+
+    auto version = 1;
+    auto tablet_id = _tablet_metadata->id();
+    for (int i = 0; i < 3; i++) {
+        _txn_id++;
+        auto delta_writer = DeltaWriter::create(tablet_id, _txn_id, _partition_id, nullptr, _mem_tracker.get());
+        ASSERT_OK(delta_writer->open());
+        ASSERT_OK(delta_writer->write(chunk0, indexes.data(), indexes.size()));
+        ASSERT_OK(delta_writer->finish());
+        delta_writer->close();
+        // Publish version
+        ASSERT_OK(_tablet_manager->publish_version(tablet_id, version, version + 1, &_txn_id, 1));
+        version++;
+    }
+    const int64_t expected_rows = GetParam() == DUP_KEYS ? kChunkSize * 3 : kChunkSize;
+    ASSERT_EQ(expected_rows, read(version));
+
+    _txn_id++;
+    ASSIGN_OR_ABORT(auto task, _tablet_manager->compact(tablet_id, version, _txn_id));
+    ASSERT_TRUE(dynamic_cast<VerticalCompactionTask*>(task.get()) != nullptr);
+    ASSERT_OK(task->execute());
+    ASSERT_OK(_tablet_manager->publish_version(tablet_id, version, version + 1, &_txn_id, 1));
+    version++;
+    ASSERT_EQ(expected_rows, read(version));
+
+    ASSIGN_OR_ABORT(auto new_tablet_metadata, _tablet_manager->get_tablet_metadata(tablet_id, version));
+    ASSERT_EQ(1, new_tablet_metadata->cumulative_point());
+    ASSERT_EQ(1, new_tablet_metadata->rowsets_size());
+}
+
+INSTANTIATE_TEST_SUITE_P(VerticalCompactionTest, VerticalCompactionTest, testing::Values(DUP_KEYS, UNIQUE_KEYS));
+
+} // namespace starrocks::lake
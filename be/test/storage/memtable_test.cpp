@@ -19,6 +19,7 @@
 #include "storage/rowset/rowset_writer.h"
 #include "storage/rowset/rowset_writer_context.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks::vectorized {
 
@@ -314,6 +315,59 @@ TEST_F(MemTableTest, testUniqKeysInsertFlushRead) {
     ASSERT_EQ(n, pkey_read);
 }
 
+TEST_F(MemTableTest, testUniqKeysIncrementalSort) {
+    const string path = "./ut_dir/MemTableTest_testUniqKeysIncrementalSort";
+    bool old_incremental_sort = config::enable_memtable_incremental_sort;
+    config::enable_memtable_incremental_sort = true;
+    DeferOp defer([&] { config::enable_memtable_incremental_sort = old_incremental_sort; });
+    MySetUp("pk int,name varchar,pv int", "pk int,name varchar,pv int", 1, KeysType::UNIQUE_KEYS, path);
+    const size_t n = 1000;
+    auto pchunk = gen_chunk(*_slots, n);
+    vector<uint32_t> indexes;
+    indexes.reserve(3 * n);
+    for (int k = 0; k < 3; k++) {
+        for (int i = 0; i < n; i++) {
+            indexes.emplace_back(i);
+        }
+    }
+    std::random_shuffle(indexes.begin(), indexes.end());
+    // 7 sorted runs of different sizes
+    const uint32_t batch = 449;
+    for (uint32_t from = 0; from < indexes.size(); from += batch) {
+        uint32_t size = std::min<uint32_t>(batch, indexes.size() - from);
+        _mem_table->insert(*pchunk, indexes.data(), from, size);
+    }
+    ASSERT_TRUE(_mem_table->finalize().ok());
+    ASSERT_OK(_mem_table->flush());
+    RowsetSharedPtr rowset = *_writer->build();
+    unique_ptr<Schema> read_schema = create_schema("pk int", 1);
+    OlapReaderStatistics stats;
+    RowsetReadOptions rs_opts;
+    rs_opts.sorted = false;
+    rs_opts.use_page_cache = false;
+    rs_opts.stats = &stats;
+    auto itr = rowset->new_iterator(*read_schema, rs_opts);
+    ASSERT_TRUE(itr.ok()) << itr.status().to_string();
+    std::shared_ptr<vectorized::Chunk> chunk = ChunkHelper::new_chunk(*read_schema, 4096);
+    size_t pkey_read = 0;
+    int last_value = 0;
+    while (true) {
+        Status st = (*itr)->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        auto column = chunk->get_column_by_name("pk");
+        for (size_t i = 0; i < column->size(); i++) {
+            int new_value = column->get(i).get_int32();
+            ASSERT_LT(last_value, new_value);
+            last_value = new_value;
+        }
+        pkey_read += chunk->num_rows();
+        chunk->reset();
+    }
+    ASSERT_EQ(n, pkey_read);
+}
+
 TEST_F(MemTableTest, testPrimaryKeysWithDeletes) {
     const string path = "./ut_dir/MemTableTest_testPrimaryKeysWithDeletes";
     MySetUp("pk bigint,v1 int", "pk bigint,v1 int,__op tinyint", 1, KeysType::PRIMARY_KEYS, path);
@@ -141,6 +141,26 @@ TEST_F(MergeIteratorTest, merge_one) {
     ASSERT_TRUE(st.is_end_of_file());
 }
 
+// NOLINTNEXTLINE
+TEST_F(MergeIteratorTest, gallop_lower_bound) {
+    std::vector<int> keys{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    for (int bound = 0; bound <= 11; bound++) {
+        for (size_t begin = 0; begin <= keys.size(); begin++) {
+            size_t num_compares = 0;
+            size_t index = gallop_lower_bound(begin, keys.size(), [&](size_t i) {
+                num_compares++;
+                return keys[i] < bound;
+            });
+            size_t expected = std::lower_bound(keys.begin() + begin, keys.end(), bound) - keys.begin();
+            ASSERT_EQ(expected, index) << "bound=" << bound << " begin=" << begin;
+            if (expected == begin && begin < keys.size()) {
+                // A run of no rows takes one comparison.
+                ASSERT_EQ(1, num_compares);
+            }
+        }
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(MergeIteratorTest, test_issue_DSDB_2715) {
     auto sub1 = std::make_shared<VectorChunkIterator>(_schema, COL_INT({1, 1, 2, 3, 4, 5}));
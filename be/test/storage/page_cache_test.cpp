@@ -94,4 +94,54 @@ TEST_F(StoragePageCacheTest, normal) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(StoragePageCacheTest, compressed_tier) {
+    const size_t capacity = kNumShards * 1024 * 1024;
+    StoragePageCache cache(_mem_tracker.get(), capacity, 0, 0.5);
+    ASSERT_TRUE(cache.has_compressed_tier());
+    const size_t initial_compressed_capacity = cache.compressed_capacity();
+    ASSERT_EQ(capacity / 2, initial_compressed_capacity);
+
+    StoragePageCache::CacheKey key("abc", 0);
+    StoragePageCache::CacheKey compressed_key("abc", 1024);
+    {
+        PageCacheHandle handle;
+        Slice data(new char[1024], 1024);
+        cache.insert(key, data, &handle, false);
+    }
+    {
+        char* buf = new char[256];
+        PageCacheHandle handle;
+        cache.insert_compressed(compressed_key, Slice(buf, 256), &handle, false);
+        ASSERT_EQ(buf, handle.data().data);
+    }
+
+    // The tiers are independent.
+    {
+        PageCacheHandle handle;
+        ASSERT_FALSE(cache.lookup(compressed_key, &handle));
+        ASSERT_TRUE(cache.lookup_compressed(compressed_key, &handle));
+        ASSERT_EQ(256, handle.data().size);
+        ASSERT_FALSE(cache.lookup_compressed(key, &handle));
+    }
+
+    // The compressed tier grows if it serves more hits per byte.
+    for (int i = 0; i < 100000; i++) {
+        PageCacheHandle handle;
+        ASSERT_FALSE(cache.lookup(compressed_key, &handle));
+        ASSERT_TRUE(cache.lookup_compressed(compressed_key, &handle));
+    }
+    const size_t grown_compressed_capacity = cache.compressed_capacity();
+    ASSERT_GT(grown_compressed_capacity, initial_compressed_capacity);
+    ASSERT_LT(grown_compressed_capacity, capacity);
+
+    // And shrinks if the decompressed tier does.
+    for (int i = 0; i < 100000; i++) {
+        PageCacheHandle handle;
+        ASSERT_TRUE(cache.lookup(key, &handle));
+    }
+    ASSERT_LT(cache.compressed_capacity(), grown_compressed_capacity);
+    ASSERT_GT(cache.compressed_capacity(), 0);
+}
+
 } // namespace starrocks
@@ -6,6 +6,7 @@
 
 #include <cstdlib>
 
+#include "common/config.h"
 #include "fs/fs_memory.h"
 #include "fs/fs_util.h"
 #include "storage/chunk_helper.h"
@@ -20,6 +21,7 @@
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
 #include "util/coding.h"
+#include "util/defer_op.h"
 #include "util/faststring.h"
 
 namespace starrocks {
@@ -661,4 +663,215 @@ PARALLEL_TEST(PersistentIndexTest, test_flush_varlen_to_immutable) {
     ASSERT_TRUE(fs::remove_all(kPersistentIndexDir).ok());
 }
 
+TEST(PersistentIndexTest, test_l1_delta) {
+    FileSystem* fs = FileSystem::Default();
+    const std::string kPersistentIndexDir = "./PersistentIndexTest_test_l1_delta";
+    const std::string kIndexFile = kPersistentIndexDir + "/index.l0.0.0";
+    bool created;
+    ASSERT_OK(fs->create_dir_if_missing(kPersistentIndexDir, &created));
+    {
+        ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(kIndexFile));
+        ASSERT_OK(wfile->close());
+    }
+    bool old_enable_l1_delta = config::enable_persistent_index_l1_delta;
+    int32_t old_max_l1_delta_num = config::persistent_index_max_l1_delta_num;
+    config::enable_persistent_index_l1_delta = true;
+    config::persistent_index_max_l1_delta_num = 2;
+    DeferOp defer([&]() {
+        config::enable_persistent_index_l1_delta = old_enable_l1_delta;
+        config::persistent_index_max_l1_delta_num = old_max_l1_delta_num;
+    });
+
+    using Key = uint64_t;
+    // every commit below flushes l0, which is larger than 8MB
+    const int N = 1000000;
+    vector<Key> keys(N);
+    vector<Slice> key_slices(N);
+    vector<IndexValue> values(N);
+    vector<IndexValue> new_values(N);
+    for (int i = 0; i < N; i++) {
+        keys[i] = i;
+        key_slices[i] = Slice((uint8_t*)(&keys[i]), sizeof(Key));
+        values[i] = i * 2;
+        new_values[i] = i * 3;
+    }
+
+    PersistentIndexMetaPB index_meta;
+    EditVersion version(0, 0);
+    index_meta.set_key_size(sizeof(Key));
+    index_meta.set_size(0);
+    version.to_pb(index_meta.mutable_version());
+    version.to_pb(index_meta.mutable_l0_meta()->mutable_snapshot()->mutable_version());
+
+    auto check_values = [&](PersistentIndex& index, int num_erased, const vector<IndexValue>& expected) {
+        std::vector<IndexValue> get_values(N);
+        ASSERT_OK(index.get(N, key_slices.data(), get_values.data()));
+        for (int i = 0; i < num_erased; i++) {
+            ASSERT_EQ(NullIndexValue, get_values[i].get_value());
+        }
+        for (int i = num_erased; i < N; i++) {
+            ASSERT_EQ(expected[i], get_values[i]);
+        }
+    };
+
+    {
+        PersistentIndex index(kPersistentIndexDir);
+        ASSERT_OK(index.load(index_meta));
+        // l1
+        ASSERT_OK(index.prepare(EditVersion(1, 0)));
+        ASSERT_OK(index.insert(N, key_slices.data(), values.data(), false));
+        ASSERT_OK(index.commit(&index_meta));
+        ASSERT_OK(index.on_commited());
+        ASSERT_EQ(0, index_meta.l1_delta_versions_size());
+
+        // the first delta overrides all the keys of l1
+        std::vector<IndexValue> old_values(N);
+        ASSERT_OK(index.prepare(EditVersion(2, 0)));
+        ASSERT_OK(index.upsert(N, key_slices.data(), new_values.data(), old_values.data()));
+        for (int i = 0; i < N; i++) {
+            ASSERT_EQ(values[i], old_values[i]);
+        }
+        ASSERT_OK(index.commit(&index_meta));
+        ASSERT_OK(index.on_commited());
+        ASSERT_EQ(1, index_meta.l1_delta_versions_size());
+        ASSERT_EQ(N, index.size());
+
+        // the second delta erases the first half of the keys
+        std::vector<IndexValue> erase_old_values(N / 2);
+        ASSERT_OK(index.prepare(EditVersion(3, 0)));
+        ASSERT_OK(index.erase(N / 2, key_slices.data(), erase_old_values.data()));
+        for (int i = 0; i < N / 2; i++) {
+            ASSERT_EQ(new_values[i], erase_old_values[i]);
+        }
+        ASSERT_OK(index.commit(&index_meta));
+        ASSERT_OK(index.on_commited());
+        ASSERT_EQ(2, index_meta.l1_delta_versions_size());
+        ASSERT_EQ(N / 2, index.size());
+        check_values(index, N / 2, new_values);
+        ASSERT_TRUE(fs->path_exists(kPersistentIndexDir + "/index.l1.1.0").ok());
+        ASSERT_TRUE(fs->path_exists(kPersistentIndexDir + "/index.l1d.2.0").ok());
+        ASSERT_TRUE(fs->path_exists(kPersistentIndexDir + "/index.l1d.3.0").ok());
+    }
+
+    {
+        PersistentIndex index(kPersistentIndexDir);
+        ASSERT_OK(index.load(index_meta));
+        check_values(index, N / 2, new_values);
+
+        // the keys erased by a delta can be inserted again
+        ASSERT_OK(index.prepare(EditVersion(4, 0)));
+        ASSERT_OK(index.insert(N / 2, key_slices.data(), values.data(), true));
+        // there are persistent_index_max_l1_delta_num deltas, so l0 and the deltas are merged into l1
+        ASSERT_OK(index.commit(&index_meta));
+        ASSERT_OK(index.on_commited());
+        ASSERT_EQ(0, index_meta.l1_delta_versions_size());
+        ASSERT_TRUE(fs->path_exists(kPersistentIndexDir + "/index.l1.4.0").ok());
+        ASSERT_TRUE(fs->path_exists(kPersistentIndexDir + "/index.l1d.2.0").is_not_found());
+        ASSERT_TRUE(fs->path_exists(kPersistentIndexDir + "/index.l1d.3.0").is_not_found());
+    }
+
+    {
+        PersistentIndex index(kPersistentIndexDir);
+        ASSERT_OK(index.load(index_meta));
+        std::vector<IndexValue> expected(N);
+        for (int i = 0; i < N; i++) {
+            expected[i] = i < N / 2 ? values[i] : new_values[i];
+        }
+        check_values(index, 0, expected);
+    }
+    ASSERT_TRUE(fs::remove_all(kPersistentIndexDir).ok());
+}
+
+TEST(PersistentIndexTest, test_l1_bloom_filter) {
+    FileSystem* fs = FileSystem::Default();
+    const std::string kPersistentIndexDir = "./PersistentIndexTest_test_l1_bloom_filter";
+    const std::string kIndexFile = kPersistentIndexDir + "/index.l0.0.0";
+    bool created;
+    ASSERT_OK(fs->create_dir_if_missing(kPersistentIndexDir, &created));
+    {
+        ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(kIndexFile));
+        ASSERT_OK(wfile->close());
+    }
+    bool old_enable_bloom_filter = config::enable_persistent_index_bloom_filter;
+    DeferOp defer([&]() { config::enable_persistent_index_bloom_filter = old_enable_bloom_filter; });
+
+    using Key = uint64_t;
+    // the keys of [N, 2N) are not in the index
+    const int N = 1000000;
+    vector<Key> keys(2 * N);
+    vector<Slice> key_slices(2 * N);
+    vector<IndexValue> values(2 * N);
+    for (int i = 0; i < 2 * N; i++) {
+        keys[i] = i;
+        key_slices[i] = Slice((uint8_t*)(&keys[i]), sizeof(Key));
+        values[i] = i * 2;
+    }
+
+    PersistentIndexMetaPB index_meta;
+    EditVersion version(0, 0);
+    index_meta.set_key_size(sizeof(Key));
+    index_meta.set_size(0);
+    version.to_pb(index_meta.mutable_version());
+    version.to_pb(index_meta.mutable_l0_meta()->mutable_snapshot()->mutable_version());
+
+    auto check_l1 = [&](bool has_bloom_filter) {
+        PersistentIndex index(kPersistentIndexDir);
+        ASSERT_OK(index.load(index_meta));
+        if (has_bloom_filter) {
+            // the bloom filters of the shards of l1 are kept in memory
+            ASSERT_GT(index.memory_usage(), 0);
+        }
+        std::vector<IndexValue> get_values(2 * N);
+        ASSERT_OK(index.get(2 * N, key_slices.data(), get_values.data()));
+        for (int i = 0; i < N; i++) {
+            ASSERT_EQ(values[i], get_values[i]);
+        }
+        for (int i = N; i < 2 * N; i++) {
+            ASSERT_EQ(NullIndexValue, get_values[i].get_value());
+        }
+        ASSERT_OK(index.prepare(EditVersion(2, 0)));
+        ASSERT_TRUE(index.insert(1, &key_slices[N - 1], &values[N - 1], true).is_already_exist());
+        ASSERT_OK(index.insert(N, key_slices.data() + N, values.data() + N, true));
+    };
+
+    // an l1 written without the bloom filters
+    config::enable_persistent_index_bloom_filter = false;
+    {
+        PersistentIndex index(kPersistentIndexDir);
+        ASSERT_OK(index.load(index_meta));
+        ASSERT_OK(index.prepare(EditVersion(1, 0)));
+        ASSERT_OK(index.insert(N, key_slices.data(), values.data(), false));
+        ASSERT_OK(index.commit(&index_meta));
+        ASSERT_OK(index.on_commited());
+        ASSERT_TRUE(index_meta.has_l1_version());
+    }
+    check_l1(false);
+
+    // rewrite the l1 with the bloom filters
+    config::enable_persistent_index_bloom_filter = true;
+    ASSERT_OK(fs::remove_all(kPersistentIndexDir));
+    ASSERT_OK(fs->create_dir_if_missing(kPersistentIndexDir, &created));
+    {
+        ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(kIndexFile));
+        ASSERT_OK(wfile->close());
+    }
+    index_meta.Clear();
+    index_meta.set_key_size(sizeof(Key));
+    index_meta.set_size(0);
+    version.to_pb(index_meta.mutable_version());
+    version.to_pb(index_meta.mutable_l0_meta()->mutable_snapshot()->mutable_version());
+    {
+        PersistentIndex index(kPersistentIndexDir);
+        ASSERT_OK(index.load(index_meta));
+        ASSERT_OK(index.prepare(EditVersion(1, 0)));
+        ASSERT_OK(index.insert(N, key_slices.data(), values.data(), false));
+        ASSERT_OK(index.commit(&index_meta));
+        ASSERT_OK(index.on_commited());
+        ASSERT_TRUE(index_meta.has_l1_version());
+    }
+    check_l1(true);
+
+    ASSERT_TRUE(fs::remove_all(kPersistentIndexDir).ok());
+}
+
 } // namespace starrocks
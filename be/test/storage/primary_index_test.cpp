@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "column/binary_column.h"
 #include "column/fixed_length_column.h"
 #include "column/schema.h"
@@ -11,6 +13,7 @@
 #include "storage/chunk_helper.h"
 #include "storage/primary_key_encoder.h"
 #include "testutil/parallel_test.h"
+#include "util/threadpool.h"
 
 using namespace starrocks::vectorized;
 
@@ -295,6 +298,57 @@ PARALLEL_TEST(PrimaryIndexTest, test_composite_key) {
     ASSERT_EQ(deletes[1].size(), kSegmentSize);
 }
 
+PARALLEL_TEST(PrimaryIndexTest, test_parallel_upsert_segments) {
+    auto f = std::make_shared<vectorized::Field>(0, "c0", OLAP_FIELD_TYPE_BIGINT, false);
+    f->set_is_key(true);
+    auto schema = std::make_shared<vectorized::Schema>(Fields{f});
+
+    constexpr int kSegmentSize = 10000;
+    constexpr int kNumSegments = 4;
+    // segment i has the keys [i * kSegmentSize / 2, i * kSegmentSize / 2 + kSegmentSize), so it overwrites
+    // half of the keys of segment i - 1.
+    std::vector<std::unique_ptr<Int64Column>> segments;
+    std::vector<const vectorized::Column*> pks_list;
+    for (int i = 0; i < kNumSegments; i++) {
+        auto col = Int64Column::create_mutable();
+        for (int j = 0; j < kSegmentSize; j++) {
+            col->append(i * kSegmentSize / 2 + j);
+        }
+        pks_list.emplace_back(col.get());
+        segments.emplace_back(std::move(col));
+    }
+    pks_list.emplace_back(nullptr);
+
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_TRUE(ThreadPoolBuilder("test_upsert").set_max_threads(4).build(&pool).ok());
+
+    auto serial_index = TEST_create_primary_index(*schema);
+    auto parallel_index = TEST_create_primary_index(*schema);
+    PrimaryIndex::DeletesMap serial_deletes;
+    PrimaryIndex::DeletesMap parallel_deletes;
+    serial_index->upsert(10, pks_list, nullptr, &serial_deletes);
+    parallel_index->upsert(10, pks_list, pool.get(), &parallel_deletes);
+
+    ASSERT_EQ(kNumSegments - 1, parallel_deletes.size());
+    for (auto& [rssid, rowids] : parallel_deletes) {
+        std::sort(rowids.begin(), rowids.end());
+        ASSERT_EQ(serial_deletes[rssid], rowids);
+        ASSERT_EQ(kSegmentSize / 2, rowids.size());
+    }
+    ASSERT_EQ(serial_index->size(), parallel_index->size());
+
+    auto all_keys = Int64Column::create_mutable();
+    for (int j = 0; j < (kNumSegments + 1) * kSegmentSize / 2; j++) {
+        all_keys->append(j);
+    }
+    std::vector<uint64_t> serial_rowids(all_keys->size());
+    std::vector<uint64_t> parallel_rowids(all_keys->size());
+    serial_index->get(*all_keys, &serial_rowids);
+    parallel_index->get(*all_keys, &parallel_rowids);
+    ASSERT_EQ(serial_rowids, parallel_rowids);
+    pool->shutdown();
+}
+
 // TODO: test composite primary key
 
 } // namespace starrocks
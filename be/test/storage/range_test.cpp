@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include "storage/roaring2range.h"
+
 namespace starrocks::vectorized {
 
 inline std::string to_bitmap_string(const uint8_t* bitmap, size_t n) {
@@ -87,6 +89,24 @@ TEST(SparseRangeTest, range_intersection) {
     EXPECT_EQ(SparseRange({{1, 10}, {25, 26}, {30, 40}, {50, 65}}), r);
 }
 
+TEST(SparseRangeTest, range_subtraction) {
+    SparseRange r1({{1, 10}, {20, 40}, {50, 70}});
+
+    EXPECT_EQ(SparseRange(), r1 - r1);
+    EXPECT_EQ(SparseRange(), r1 - SparseRange(0, 100));
+    EXPECT_EQ(r1, r1 - SparseRange());
+    EXPECT_EQ(r1, r1 - SparseRange({{10, 20}, {40, 50}}));
+    EXPECT_EQ(SparseRange({{1, 5}, {6, 10}, {20, 40}, {50, 70}}), r1 - SparseRange(5, 6));
+    // A range of the right side intersects with several ranges of the left side.
+    EXPECT_EQ(SparseRange({{1, 5}, {65, 70}}), r1 - SparseRange(5, 65));
+    EXPECT_EQ(SparseRange({{1, 2}, {9, 10}, {30, 35}, {60, 70}}),
+              r1 - SparseRange({{0, 1}, {2, 9}, {15, 30}, {35, 60}}));
+
+    SparseRange r2 = r1;
+    r2 -= SparseRange({{0, 2}, {69, 80}});
+    EXPECT_EQ(SparseRange({{2, 10}, {20, 40}, {50, 69}}), r2);
+}
+
 TEST(SparseRangeIteratorTest, covered_ranges) {
     SparseRange r1({{0, 10}, {20, 40}, {50, 70}});
     SparseRangeIterator iter = r1.new_iterator();
@@ -166,4 +186,22 @@ TEST(SparseRangeIteratorTest, convert_to_bitmap) {
     ASSERT_EQ("111111111100000000011001", to_bitmap_string(bitmap.data(), 24));
 }
 
+TEST(SparseRangeTest, subtract_roaring) {
+    Roaring deleted;
+    deleted.addRange(0, 3);
+    deleted.add(8);
+    deleted.addRange(10, 30);
+    deleted.add(45);
+    deleted.add(1000);
+
+    SparseRange range({{2, 12}, {20, 40}, {44, 50}});
+    ASSERT_EQ(SparseRange({{3, 8}, {9, 10}, {30, 40}, {44, 45}, {46, 50}}), subtract_roaring(range, deleted));
+    ASSERT_EQ(roaring2range(range2roaring(range) - deleted), subtract_roaring(range, deleted));
+
+    ASSERT_TRUE(subtract_roaring(SparseRange(10, 30), deleted).empty());
+    ASSERT_EQ(SparseRange(50, 100), subtract_roaring(SparseRange(50, 100), deleted));
+    ASSERT_TRUE(subtract_roaring(SparseRange(), deleted).empty());
+    ASSERT_EQ(range, subtract_roaring(range, Roaring()));
+}
+
 } // namespace starrocks::vectorized
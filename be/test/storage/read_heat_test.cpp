@@ -0,0 +1,49 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/read_heat.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+class ReadHeatTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _half_life_sec = config::scan_heat_half_life_sec;
+        config::scan_heat_half_life_sec = 10;
+    }
+    void TearDown() override { config::scan_heat_half_life_sec = _half_life_sec; }
+
+private:
+    int64_t _half_life_sec = 0;
+};
+
+TEST_F(ReadHeatTest, test_decay) {
+    ReadHeat heat;
+    ASSERT_EQ(0, heat.reads(1000));
+    ASSERT_EQ(0, heat.last_read_ms());
+
+    heat.record(100, 1000);
+    heat.record(300, 1000);
+    ASSERT_DOUBLE_EQ(2, heat.reads(1000));
+    ASSERT_DOUBLE_EQ(400, heat.bytes(1000));
+    // Halved after a half-life.
+    ASSERT_DOUBLE_EQ(1, heat.reads(11000));
+    ASSERT_DOUBLE_EQ(200, heat.bytes(11000));
+
+    heat.record(100, 21000);
+    ASSERT_DOUBLE_EQ(1.5, heat.reads(21000));
+    ASSERT_DOUBLE_EQ(200, heat.bytes(21000));
+    ASSERT_EQ(3, heat.total_reads());
+    ASSERT_EQ(500, heat.total_bytes());
+    ASSERT_EQ(21000, heat.last_read_ms());
+}
+
+TEST_F(ReadHeatTest, test_no_decay) {
+    config::scan_heat_half_life_sec = 0;
+    ReadHeat heat;
+    heat.record(100, 1000);
+    ASSERT_DOUBLE_EQ(1, heat.reads(1000 * 1000));
+}
+
+} // namespace starrocks
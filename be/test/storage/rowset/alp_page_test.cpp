@@ -0,0 +1,133 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/rowset/alp_page.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "column/fixed_length_column.h"
+#include "storage/chunk_helper.h"
+#include "storage/rowset/options.h"
+
+namespace starrocks {
+
+class AlpPageTest : public testing::Test {
+public:
+    template <FieldType Type>
+    OwnedSlice encode(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        AlpPageBuilder<Type> page_builder(builder_options);
+        size_t added = page_builder.add(reinterpret_cast<const uint8_t*>(src.data()), src.size());
+        EXPECT_EQ(src.size(), added);
+        EXPECT_EQ(src.size(), page_builder.count());
+        return page_builder.finish()->build();
+    }
+
+    // Compare the bits, so NaN and -0.0 are checked too.
+    template <typename T>
+    static bool same_bits(T a, T b) {
+        return memcmp(&a, &b, sizeof(T)) == 0;
+    }
+
+    template <FieldType Type>
+    size_t test_encode_decode(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        using CppType = typename TypeTraits<Type>::CppType;
+        const size_t size = src.size();
+        OwnedSlice s = encode<Type>(src);
+        LOG(INFO) << "ALP encoded size for " << size << " values: " << s.slice().size
+                  << ", original size:" << size * sizeof(CppType);
+
+        PageDecoderOptions decoder_options;
+        AlpPageDecoder<Type> page_decoder(s.slice(), decoder_options);
+        EXPECT_TRUE(page_decoder.init().ok());
+        EXPECT_EQ(size, page_decoder.count());
+
+        auto column = ChunkHelper::column_from_field_type(Type, false);
+        size_t size_to_fetch = size;
+        EXPECT_TRUE(page_decoder.next_batch(&size_to_fetch, column.get()).ok());
+        EXPECT_EQ(size, size_to_fetch);
+        const auto& data = down_cast<vectorized::FixedLengthColumn<CppType>*>(column.get())->get_data();
+        for (size_t i = 0; i < size; i++) {
+            EXPECT_TRUE(same_bits(src[i], data[i])) << "Fail at index " << i;
+        }
+
+        if (size > 0) {
+            EXPECT_TRUE(page_decoder.seek_to_position_in_page(size / 2).ok());
+            auto column1 = ChunkHelper::column_from_field_type(Type, false);
+            vectorized::SparseRange read_range;
+            read_range.add(vectorized::Range(size / 2, size));
+            EXPECT_TRUE(page_decoder.next_batch(read_range, column1.get()).ok());
+            const auto& data1 = down_cast<vectorized::FixedLengthColumn<CppType>*>(column1.get())->get_data();
+            EXPECT_EQ(size - size / 2, data1.size());
+            for (size_t i = 0; i < data1.size(); i++) {
+                EXPECT_TRUE(same_bits(src[size / 2 + i], data1[i])) << "Fail at index " << size / 2 + i;
+            }
+        }
+        return s.slice().size;
+    }
+};
+
+TEST_F(AlpPageTest, TestDoubleDecimals) {
+    std::mt19937_64 rng(1);
+    std::vector<double> values;
+    for (int i = 0; i < 10000; i++) {
+        // prices of two decimal digits.
+        values.push_back(static_cast<double>(rng() % 100000) / 100);
+    }
+    size_t size = test_encode_decode<OLAP_FIELD_TYPE_DOUBLE>(values);
+    // 4 bytes per value.
+    ASSERT_EQ(alp_page::kHeaderSize + values.size() * 4, size);
+}
+
+TEST_F(AlpPageTest, TestDoubleExceptions) {
+    std::vector<double> values{0.0, -0.0, NAN, INFINITY, -INFINITY, 1e300, -1e-300, M_PI};
+    for (int i = 0; i < 1000; i++) {
+        values.push_back(i * 0.5);
+    }
+    size_t size = test_encode_decode<OLAP_FIELD_TYPE_DOUBLE>(values);
+    ASSERT_LT(size, values.size() * sizeof(double));
+}
+
+TEST_F(AlpPageTest, TestDoubleRandom) {
+    std::mt19937_64 rng(1);
+    std::uniform_real_distribution<double> dist(0, 1);
+    std::vector<double> values;
+    for (int i = 0; i < 10000; i++) {
+        values.push_back(dist(rng));
+    }
+    size_t size = test_encode_decode<OLAP_FIELD_TYPE_DOUBLE>(values);
+    // falls back to the raw values.
+    ASSERT_EQ(alp_page::kHeaderSize + values.size() * sizeof(double), size);
+}
+
+TEST_F(AlpPageTest, TestFloatDecimals) {
+    std::mt19937_64 rng(1);
+    std::vector<float> values;
+    for (int i = 0; i < 10000; i++) {
+        values.push_back(static_cast<float>(rng() % 10000) / 100);
+    }
+    size_t size = test_encode_decode<OLAP_FIELD_TYPE_FLOAT>(values);
+    ASSERT_EQ(alp_page::kHeaderSize + values.size() * 2, size);
+}
+
+TEST_F(AlpPageTest, TestFewValues) {
+    test_encode_decode<OLAP_FIELD_TYPE_DOUBLE>({});
+    test_encode_decode<OLAP_FIELD_TYPE_DOUBLE>({1.5});
+    test_encode_decode<OLAP_FIELD_TYPE_DOUBLE>({NAN});
+}
+
+TEST_F(AlpPageTest, TestCorruption) {
+    std::vector<double> values{1.5, 2.25, 3.125};
+    OwnedSlice s = encode<OLAP_FIELD_TYPE_DOUBLE>(values);
+    Slice truncated(s.slice().data, s.slice().size - 1);
+    PageDecoderOptions decoder_options;
+    AlpPageDecoder<OLAP_FIELD_TYPE_DOUBLE> page_decoder(truncated, decoder_options);
+    ASSERT_FALSE(page_decoder.init().ok());
+}
+
+} // namespace starrocks
@@ -300,4 +300,50 @@ TEST_F(BinaryDictPageTest, TestEncodingRatio) {
     test_with_large_data_size(slices);
 }
 
+TEST_F(BinaryDictPageTest, TestGetDictCodes) {
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    options.dict_page_size = 256 * 1024;
+    BinaryDictPageBuilder page_builder(options);
+    uint32_t min_code = 0;
+    uint32_t max_code = 0;
+    std::string code_bitmap;
+    ASSERT_FALSE(page_builder.get_dict_codes(&min_code, &max_code, &code_bitmap));
+
+    // codes of the first page: "a" -> 0, "b" -> 1, "c" -> 2
+    std::vector<Slice> slices{"a", "b", "a", "c"};
+    ASSERT_EQ(slices.size(), page_builder.add(reinterpret_cast<const uint8_t*>(slices.data()), slices.size()));
+    page_builder.finish();
+    ASSERT_TRUE(page_builder.get_dict_codes(&min_code, &max_code, &code_bitmap));
+    ASSERT_EQ(0, min_code);
+    ASSERT_EQ(2, max_code);
+    ASSERT_EQ(1, code_bitmap.size());
+    ASSERT_EQ(0x07, static_cast<uint8_t>(code_bitmap[0]));
+
+    // the second page has "c" -> 2 and "d" -> 3 only
+    page_builder.reset();
+    slices = {"d", "c"};
+    ASSERT_EQ(slices.size(), page_builder.add(reinterpret_cast<const uint8_t*>(slices.data()), slices.size()));
+    page_builder.finish();
+    ASSERT_TRUE(page_builder.get_dict_codes(&min_code, &max_code, &code_bitmap));
+    ASSERT_EQ(2, min_code);
+    ASSERT_EQ(3, max_code);
+    ASSERT_EQ(1, code_bitmap.size());
+    ASSERT_EQ(0x0c, static_cast<uint8_t>(code_bitmap[0]));
+
+    // "0", "1", ... are coded from 4, no bitmap for the large codes
+    page_builder.reset();
+    std::vector<std::string> words;
+    for (int i = 0; i < 2000; i++) {
+        words.emplace_back(std::to_string(i));
+    }
+    slices.assign(words.begin(), words.end());
+    ASSERT_EQ(slices.size(), page_builder.add(reinterpret_cast<const uint8_t*>(slices.data()), slices.size()));
+    page_builder.finish();
+    ASSERT_TRUE(page_builder.get_dict_codes(&min_code, &max_code, &code_bitmap));
+    ASSERT_EQ(4, min_code);
+    ASSERT_EQ(2003, max_code);
+    ASSERT_TRUE(code_bitmap.empty());
+}
+
 } // namespace starrocks
@@ -27,11 +27,13 @@
 #include "fs/fs_memory.h"
 #include "runtime/mem_pool.h"
 #include "runtime/mem_tracker.h"
+#include "storage/column_or_predicate.h"
 #include "storage/key_coder.h"
 #include "storage/olap_common.h"
 #include "storage/rowset/bitmap_index_reader.h"
 #include "storage/rowset/bitmap_index_writer.h"
 #include "storage/types.h"
+#include "storage/vectorized_column_predicate.h"
 #include "testutil/assert.h"
 
 namespace starrocks {
@@ -267,4 +269,106 @@ TEST_F(BitmapIndexTest, test_concurrent_load) {
     delete[] val;
 }
 
+TEST_F(BitmapIndexTest, test_inverted_index) {
+    std::vector<Slice> values{"hello world", "Hello, starrocks!", "world world", "", "starrocks-2.0 world"};
+
+    std::string file_name = kTestDir + "/inverted_index";
+    ColumnIndexMetaPB meta;
+    {
+        ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+        std::unique_ptr<BitmapIndexWriter> writer;
+        ASSERT_OK(BitmapIndexWriter::create_inverted_index(get_type_info(OLAP_FIELD_TYPE_VARCHAR), &writer));
+        writer->add_values(values.data(), values.size());
+        writer->add_nulls(1);
+        ASSERT_OK(writer->finish(wfile.get(), &meta));
+        ASSERT_EQ(INVERTED_INDEX, meta.type());
+        ASSERT_OK(wfile->close());
+    }
+    std::unique_ptr<BitmapIndexWriter> unsupported;
+    ASSERT_FALSE(BitmapIndexWriter::create_inverted_index(get_type_info(OLAP_FIELD_TYPE_INT), &unsupported).ok());
+
+    BitmapIndexReader reader;
+    ASSIGN_OR_ABORT(auto r, reader.load(_fs.get(), file_name, meta.inverted_index(), true, false));
+    ASSERT_TRUE(r);
+    BitmapIndexIterator* iter = nullptr;
+    ASSERT_OK(reader.new_iterator(&iter));
+    std::unique_ptr<BitmapIndexIterator> iter_guard(iter);
+
+    // tokens: 0, 2, Hello, hello, starrocks, world and the null bitmap.
+    ASSERT_EQ(7, iter->bitmap_nums());
+    ASSERT_TRUE(iter->has_null_bitmap());
+
+    auto read_token = [&](const std::string& token) {
+        Slice value(token);
+        bool exact_match = false;
+        Roaring bitmap;
+        Status st = iter->seek_dictionary(&value, &exact_match);
+        if (st.ok() && exact_match) {
+            CHECK(iter->read_bitmap(iter->current_ordinal(), &bitmap).ok());
+        }
+        return bitmap;
+    };
+    ASSERT_TRUE(Roaring::bitmapOf(3, 0, 2, 4) == read_token("world"));
+    ASSERT_TRUE(Roaring::bitmapOf(2, 1, 4) == read_token("starrocks"));
+    ASSERT_TRUE(Roaring::bitmapOf(1, 0) == read_token("hello"));
+    ASSERT_TRUE(Roaring::bitmapOf(1, 1) == read_token("Hello"));
+    ASSERT_TRUE(Roaring::bitmapOf(1, 4) == read_token("2"));
+    ASSERT_TRUE(read_token("rocks").isEmpty());
+
+    Roaring null_bitmap;
+    ASSERT_OK(iter->read_null_bitmap(&null_bitmap));
+    ASSERT_TRUE(Roaring::bitmapOf(1, 5) == null_bitmap);
+}
+
+TEST_F(BitmapIndexTest, test_seek_or_and_not_in_predicates) {
+    // 0, 1, ..., 99 and 10 nulls.
+    std::vector<int> values(100);
+    for (int i = 0; i < values.size(); i++) {
+        values[i] = i;
+    }
+    std::string file_name = kTestDir + "/or_and_not_in";
+    ColumnIndexMetaPB meta;
+    write_index_file<OLAP_FIELD_TYPE_INT>(file_name, values.data(), values.size(), 10, &meta);
+
+    BitmapIndexReader* reader = nullptr;
+    BitmapIndexIterator* iter = nullptr;
+    get_bitmap_reader_iter(file_name, meta, &reader, &iter);
+    std::unique_ptr<BitmapIndexReader> reader_guard(reader);
+    std::unique_ptr<BitmapIndexIterator> iter_guard(iter);
+    ASSERT_EQ(101, iter->bitmap_nums());
+
+    auto type_info = get_type_info(OLAP_FIELD_TYPE_INT);
+    std::unique_ptr<vectorized::ColumnPredicate> eq(vectorized::new_column_eq_predicate(type_info, 0, "10"));
+    std::unique_ptr<vectorized::ColumnPredicate> lt(vectorized::new_column_lt_predicate(type_info, 0, "3"));
+    std::unique_ptr<vectorized::ColumnPredicate> is_null(vectorized::new_column_null_predicate(type_info, 0, true));
+    std::unique_ptr<vectorized::ColumnPredicate> ne(vectorized::new_column_ne_predicate(type_info, 0, "10"));
+    std::unique_ptr<vectorized::ColumnPredicate> not_in(
+            vectorized::new_column_not_in_predicate(type_info, 0, {"0", "50", "99", "1000"}));
+    std::unique_ptr<vectorized::ColumnPredicate> not_null(vectorized::new_column_null_predicate(type_info, 0, false));
+
+    // c0 = 10 OR c0 < 3 OR c0 IS NULL
+    vectorized::ColumnOrPredicate or_pred(type_info, 0);
+    or_pred.add_child(eq.get());
+    or_pred.add_child(lt.get());
+    or_pred.add_child(is_null.get());
+    vectorized::SparseRange range;
+    ASSERT_OK(or_pred.seek_bitmap_dictionary(iter, &range));
+    ASSERT_EQ(vectorized::SparseRange({{0, 3}, {10, 11}, {100, 101}}), range);
+    Roaring bitmap;
+    ASSERT_OK(iter->read_union_bitmap(range, &bitmap));
+    ASSERT_EQ(3 + 1 + 10, bitmap.cardinality());
+
+    // The nulls are not selected by c0 != 10 and c0 NOT IN (...).
+    ASSERT_OK(ne->seek_bitmap_dictionary(iter, &range));
+    ASSERT_EQ(vectorized::SparseRange({{0, 10}, {11, 100}}), range);
+    ASSERT_OK(not_in->seek_bitmap_dictionary(iter, &range));
+    ASSERT_EQ(vectorized::SparseRange({{1, 50}, {51, 99}}), range);
+
+    // An OR with a child not supporting bitmap index is evaluated on the data.
+    vectorized::ColumnOrPredicate or_pred2(type_info, 0);
+    or_pred2.add_child(eq.get());
+    or_pred2.add_child(not_null.get());
+    ASSERT_TRUE(or_pred2.seek_bitmap_dictionary(iter, &range).is_cancelled());
+}
+
 } // namespace starrocks
@@ -274,4 +274,43 @@ TEST_F(BloomFilterIndexReaderWriterTest, test_decimal) {
     delete[] val;
 }
 
+TEST_F(BloomFilterIndexReaderWriterTest, test_ngram) {
+    std::string fname = kTestDir + "/bloom_filter_ngram";
+    std::vector<std::string> page0{"connection refused", "timeout"};
+    std::vector<std::string> page1{"disk full", "ok"};
+    ColumnIndexMetaPB meta;
+    {
+        ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(fname));
+        BloomFilterOptions bf_options;
+        bf_options.gram_num = 3;
+        std::unique_ptr<BloomFilterIndexWriter> writer;
+        ASSERT_OK(BloomFilterIndexWriter::create(bf_options, get_type_info(OLAP_FIELD_TYPE_VARCHAR), &writer));
+        for (const auto* values : {&page0, &page1}) {
+            std::vector<Slice> slices(values->begin(), values->end());
+            writer->add_values(slices.data(), slices.size());
+            ASSERT_OK(writer->flush());
+        }
+        ASSERT_OK(writer->finish(wfile.get(), &meta));
+        ASSERT_OK(wfile->close());
+    }
+    ASSERT_EQ(NGRAM_BLOOM_FILTER_INDEX, meta.type());
+    ASSERT_EQ(3, meta.ngram_bloom_filter_index().gram_num());
+
+    BloomFilterIndexReader reader;
+    ASSIGN_OR_ABORT(auto r, reader.load(_fs.get(), fname, meta.ngram_bloom_filter_index(), true, false));
+    ASSERT_TRUE(r);
+    std::unique_ptr<BloomFilterIndexIterator> iter;
+    ASSERT_OK(reader.new_iterator(&iter));
+
+    std::unique_ptr<BloomFilter> bf;
+    ASSERT_OK(iter->read_bloom_filter(0, &bf));
+    for (const char* gram : {"con", "ref", "sed", "out"}) {
+        ASSERT_TRUE(bf->test_bytes(gram, 3)) << gram;
+    }
+    ASSERT_OK(iter->read_bloom_filter(1, &bf));
+    for (const char* gram : {"dis", "k f", "ull"}) {
+        ASSERT_TRUE(bf->test_bytes(gram, 3)) << gram;
+    }
+}
+
 } // namespace starrocks
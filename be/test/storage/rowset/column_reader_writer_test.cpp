@@ -30,6 +30,7 @@
 #include "column/fixed_length_column.h"
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "fs/fs_memory.h"
 #include "gen_cpp/segment.pb.h"
 #include "runtime/mem_pool.h"
@@ -48,6 +49,7 @@
 #include "storage/tablet_schema_helper.h"
 #include "storage/types.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 #include "types/date_value.h"
 
 using std::string;
@@ -570,6 +572,24 @@ TEST_F(ColumnReaderWriterTest, test_double) {
     test_numeric_types<OLAP_FIELD_TYPE_DOUBLE>();
 }
 
+// NOLINTNEXTLINE
+TEST_F(ColumnReaderWriterTest, test_read_ahead) {
+    const int32_t old_num = config::column_page_read_ahead_num;
+    const int64_t old_gap = config::column_page_read_ahead_max_gap_bytes;
+    DeferOp defer([&]() {
+        config::column_page_read_ahead_num = old_num;
+        config::column_page_read_ahead_max_gap_bytes = old_gap;
+    });
+    config::column_page_read_ahead_num = 4;
+    config::column_page_read_ahead_max_gap_bytes = 4096;
+
+    // Multiple data pages.
+    auto col = numeric_data<OLAP_FIELD_TYPE_INT>(200000);
+    test_nullable_data<OLAP_FIELD_TYPE_INT, BIT_SHUFFLE, 2>(*col, "0", "200000");
+    auto c = high_cardinality_strings(100000);
+    test_nullable_data<OLAP_FIELD_TYPE_VARCHAR, DICT_ENCODING, 2>(*c, "0", "100000");
+}
+
 // NOLINTNEXTLINE
 TEST_F(ColumnReaderWriterTest, test_date) {
     auto col = date_values(100);
@@ -0,0 +1,182 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/rowset/delta_page.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "runtime/mem_pool.h"
+#include "storage/chunk_helper.h"
+#include "storage/rowset/options.h"
+
+namespace starrocks {
+
+class DeltaPageTest : public testing::Test {
+public:
+    template <FieldType Type>
+    OwnedSlice encode(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        DeltaPageBuilder<Type> page_builder(builder_options);
+        size_t added = page_builder.add(reinterpret_cast<const uint8_t*>(src.data()), src.size());
+        EXPECT_EQ(src.size(), added);
+        EXPECT_EQ(src.size(), page_builder.count());
+        OwnedSlice s = page_builder.finish()->build();
+        if (!src.empty()) {
+            typename TypeTraits<Type>::CppType first;
+            typename TypeTraits<Type>::CppType last;
+            EXPECT_TRUE(page_builder.get_first_value(&first).ok());
+            EXPECT_TRUE(page_builder.get_last_value(&last).ok());
+            EXPECT_EQ(src.front(), first);
+            EXPECT_EQ(src.back(), last);
+        }
+        return s;
+    }
+
+    template <FieldType Type>
+    void test_encode_decode(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        using CppType = typename TypeTraits<Type>::CppType;
+        const size_t size = src.size();
+        OwnedSlice s = encode<Type>(src);
+        LOG(INFO) << "Delta encoded size for " << size << " values: " << s.slice().size
+                  << ", original size:" << size * sizeof(CppType);
+
+        PageDecoderOptions decoder_options;
+        DeltaPageDecoder<Type> page_decoder(s.slice(), decoder_options);
+        ASSERT_TRUE(page_decoder.init().ok());
+        ASSERT_EQ(0, page_decoder.current_index());
+        ASSERT_EQ(size, page_decoder.count());
+
+        auto column = ChunkHelper::column_from_field_type(Type, false);
+        size_t size_to_fetch = size;
+        ASSERT_TRUE(page_decoder.next_batch(&size_to_fetch, column.get()).ok());
+        ASSERT_EQ(size, size_to_fetch);
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_EQ(src[i], column->get(i).get<CppType>());
+        }
+        if (size == 0) {
+            return;
+        }
+
+        ASSERT_TRUE(page_decoder.seek_to_position_in_page(0).ok());
+        auto column1 = ChunkHelper::column_from_field_type(Type, false);
+        vectorized::SparseRange read_range;
+        read_range.add(vectorized::Range(0, size / 3));
+        read_range.add(vectorized::Range(size / 2, (size * 2 / 3)));
+        read_range.add(vectorized::Range((size * 3 / 4), size));
+        size_t read_num = read_range.span_size();
+        ASSERT_TRUE(page_decoder.next_batch(read_range, column1.get()).ok());
+        ASSERT_EQ(read_num, column1->size());
+
+        vectorized::SparseRangeIterator read_iter = read_range.new_iterator();
+        size_t offset = 0;
+        while (read_iter.has_more()) {
+            vectorized::Range r = read_iter.next(read_num);
+            for (size_t i = 0; i < r.span_size(); ++i) {
+                ASSERT_EQ(src[r.begin() + i], column1->get(offset + i).get<CppType>());
+            }
+            offset += r.span_size();
+        }
+    }
+};
+
+TEST_F(DeltaPageTest, TestInt32Sequence) {
+    std::vector<int32_t> values;
+    for (int i = 0; i < 10000; i++) {
+        values.push_back(12345 + i * 3);
+    }
+    test_encode_decode<OLAP_FIELD_TYPE_INT>(values);
+    // constant deltas need no packed bits.
+    ASSERT_EQ(delta_page::header_size<int32_t>(), encode<OLAP_FIELD_TYPE_INT>(values).slice().size);
+}
+
+TEST_F(DeltaPageTest, TestInt32Random) {
+    std::vector<int32_t> values;
+    for (int i = 0; i < 10000; i++) {
+        values.push_back(random());
+    }
+    test_encode_decode<OLAP_FIELD_TYPE_INT>(values);
+}
+
+TEST_F(DeltaPageTest, TestInt64Timestamps) {
+    // millisecond timestamps of events arrived about every second.
+    std::vector<int64_t> values;
+    int64_t ts = 1650000000000;
+    for (int i = 0; i < 10000; i++) {
+        ts += 1000 + random() % 16;
+        values.push_back(ts);
+    }
+    test_encode_decode<OLAP_FIELD_TYPE_BIGINT>(values);
+    // one byte per delta.
+    ASSERT_EQ(delta_page::header_size<int64_t>() + values.size() - 1,
+              encode<OLAP_FIELD_TYPE_BIGINT>(values).slice().size);
+}
+
+TEST_F(DeltaPageTest, TestInt64DeltaOfDelta) {
+    std::vector<int64_t> values;
+    for (int64_t i = 0; i < 10000; i++) {
+        values.push_back(i * i);
+    }
+    test_encode_decode<OLAP_FIELD_TYPE_BIGINT>(values);
+    // the deltas of deltas are all 2.
+    ASSERT_EQ(delta_page::header_size<int64_t>(), encode<OLAP_FIELD_TYPE_BIGINT>(values).slice().size);
+}
+
+TEST_F(DeltaPageTest, TestInt64Overflow) {
+    std::vector<int64_t> values{INT64_MIN, INT64_MAX, 0, -1, INT64_MAX, INT64_MIN, 1};
+    test_encode_decode<OLAP_FIELD_TYPE_BIGINT>(values);
+}
+
+TEST_F(DeltaPageTest, TestFewValues) {
+    test_encode_decode<OLAP_FIELD_TYPE_BIGINT>({});
+    test_encode_decode<OLAP_FIELD_TYPE_BIGINT>({100});
+    test_encode_decode<OLAP_FIELD_TYPE_BIGINT>({100, -100});
+}
+
+TEST_F(DeltaPageTest, TestPageFull) {
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = 1024;
+    DeltaPageBuilder<OLAP_FIELD_TYPE_INT> page_builder(builder_options);
+    std::vector<int32_t> values(1000, 1);
+    ASSERT_EQ(256, page_builder.add(reinterpret_cast<const uint8_t*>(values.data()), values.size()));
+    ASSERT_TRUE(page_builder.is_page_full());
+    ASSERT_EQ(0, page_builder.add(reinterpret_cast<const uint8_t*>(values.data()), values.size()));
+}
+
+TEST_F(DeltaPageTest, TestSeekAtOrAfterValue) {
+    std::vector<int32_t> values;
+    for (int i = 0; i < 1000; i++) {
+        values.push_back(i * 10);
+    }
+    OwnedSlice s = encode<OLAP_FIELD_TYPE_INT>(values);
+    PageDecoderOptions decoder_options;
+    DeltaPageDecoder<OLAP_FIELD_TYPE_INT> page_decoder(s.slice(), decoder_options);
+    ASSERT_TRUE(page_decoder.init().ok());
+
+    bool exact_match = false;
+    int32_t target = 500;
+    ASSERT_TRUE(page_decoder.seek_at_or_after_value(&target, &exact_match).ok());
+    ASSERT_TRUE(exact_match);
+    ASSERT_EQ(50, page_decoder.current_index());
+
+    target = 505;
+    ASSERT_TRUE(page_decoder.seek_at_or_after_value(&target, &exact_match).ok());
+    ASSERT_FALSE(exact_match);
+    ASSERT_EQ(51, page_decoder.current_index());
+
+    target = 100000;
+    ASSERT_TRUE(page_decoder.seek_at_or_after_value(&target, &exact_match).is_not_found());
+}
+
+TEST_F(DeltaPageTest, TestCorruption) {
+    std::vector<int32_t> values{1, 2, 4, 8, 16};
+    OwnedSlice s = encode<OLAP_FIELD_TYPE_INT>(values);
+    Slice truncated(s.slice().data, s.slice().size - 1);
+    PageDecoderOptions decoder_options;
+    DeltaPageDecoder<OLAP_FIELD_TYPE_INT> page_decoder(truncated, decoder_options);
+    ASSERT_FALSE(page_decoder.init().ok());
+}
+
+} // namespace starrocks
@@ -16,6 +16,7 @@
 #include "storage/rowset/segment_options.h"
 #include "storage/rowset/segment_writer.h"
 #include "storage/tablet_schema_helper.h"
+#include "storage/vectorized_column_predicate.h"
 #include "testutil/assert.h"
 
 namespace starrocks {
@@ -290,4 +291,96 @@ TEST_F(SegmentIteratorTest, TestGlobalDictNoLocalDict) {
     res_chunk->reset();
 }
 
+TEST_F(SegmentIteratorTest, TestLateMaterialization) {
+    TabletColumn c1 = create_int_key(1, false);
+    TabletColumn c2 = create_int_value(2, OLAP_FIELD_AGGREGATION_SUM, false);
+    TabletColumn c3 = create_with_default_value<OLAP_FIELD_TYPE_VARCHAR>("");
+    c3.set_is_nullable(false);
+    c3.set_length(128);
+
+    std::unique_ptr<TabletSchema> tablet_schema = create_schema({c1, c2, c3});
+
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 1024;
+
+    std::string file_name = kSegmentDir + "/late_materialization";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+
+    SegmentWriter writer(std::move(wfile), 0, tablet_schema.get(), opts);
+    ASSERT_OK(writer.init());
+
+    int32_t chunk_size = config::vector_chunk_size;
+    const int32_t num_rows = 100000;
+    auto schema = ChunkHelper::convert_schema_to_format_v2(*tablet_schema);
+    auto chunk = ChunkHelper::new_chunk(schema, chunk_size);
+    for (int32_t i = 0; i < num_rows; i += chunk_size) {
+        chunk->reset();
+        auto& cols = chunk->columns();
+        for (int32_t j = i; j < std::min(i + chunk_size, num_rows); ++j) {
+            std::string str = "value-" + std::to_string(j);
+            cols[0]->append_datum(vectorized::Datum(j));
+            cols[1]->append_datum(vectorized::Datum(j % 100));
+            cols[2]->append_datum(vectorized::Datum(Slice(str)));
+        }
+        ASSERT_OK(writer.append_chunk(*chunk));
+    }
+    uint64_t file_size = 0;
+    uint64_t index_size = 0;
+    uint64_t footer_position = 0;
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+
+    auto segment = *Segment::open(_tablet_meta_mem_tracker.get(), _fs, file_name, 0, tablet_schema.get());
+    ASSERT_EQ(segment->num_rows(), num_rows);
+
+    vectorized::Schema vec_schema;
+    vec_schema.append(std::make_shared<vectorized::Field>(0, "c1", OLAP_FIELD_TYPE_INT, -1, -1, false));
+    vec_schema.append(std::make_shared<vectorized::Field>(1, "c2", OLAP_FIELD_TYPE_INT, -1, -1, false));
+    vec_schema.append(std::make_shared<vectorized::Field>(2, "c3", OLAP_FIELD_TYPE_VARCHAR, -1, -1, false));
+
+    const int32_t old_ratio = config::late_materialization_ratio;
+    const bool old_by_range = config::enable_late_materialization_by_range;
+    DeferOp defer([&]() {
+        config::late_materialization_ratio = old_ratio;
+        config::enable_late_materialization_by_range = old_by_range;
+    });
+    config::late_materialization_ratio = 1000;
+
+    for (bool by_range : {true, false}) {
+        config::enable_late_materialization_by_range = by_range;
+
+        ObjectPool pool;
+        OlapReaderStatistics stats;
+        vectorized::SegmentReadOptions seg_opts;
+        seg_opts.fs = _fs;
+        seg_opts.stats = &stats;
+        // c2 = 5 or c2 = 6, so the surviving rows are in short runs.
+        auto type_int = get_type_info(OLAP_FIELD_TYPE_INT);
+        seg_opts.predicates[1].push_back(
+                pool.add(vectorized::new_column_in_predicate(type_int, 1, std::vector<std::string>{"5", "6"})));
+
+        auto chunk_iter = new_segment_iterator(segment, vec_schema, seg_opts);
+        auto res_chunk = ChunkHelper::new_chunk(vec_schema, chunk_size);
+        int32_t num_read = 0;
+        while (true) {
+            res_chunk->reset();
+            auto st = chunk_iter->get_next(res_chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            ASSERT_OK(st);
+            for (size_t i = 0; i < res_chunk->num_rows(); ++i) {
+                int32_t v1 = res_chunk->get_column_by_id(0)->get(i).get_int32();
+                int32_t v2 = res_chunk->get_column_by_id(1)->get(i).get_int32();
+                Slice v3 = res_chunk->get_column_by_id(2)->get(i).get_slice();
+                ASSERT_EQ(v1 % 100, v2);
+                ASSERT_TRUE(v2 == 5 || v2 == 6);
+                ASSERT_EQ("value-" + std::to_string(v1), v3.to_string());
+            }
+            num_read += res_chunk->num_rows();
+        }
+        ASSERT_EQ(num_rows / 50, num_read);
+        chunk_iter->close();
+    }
+}
+
 } // namespace starrocks
@@ -0,0 +1,286 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "column/chunk.h"
+#include "column/datum.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "fmt/format.h"
+#include "fs/fs_memory.h"
+#include "gen_cpp/olap_file.pb.h"
+#include "runtime/mem_tracker.h"
+#include "storage/chunk_helper.h"
+#include "storage/olap_common.h"
+#include "storage/page_cache.h"
+#include "storage/rowset/encoding_info.h"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
+#include "storage/rowset/segment_writer.h"
+#include "storage/tablet_schema.h"
+#include "storage/types.h"
+#include "storage/vectorized_column_predicate.h"
+
+namespace starrocks {
+
+static constexpr int kBenchChunkSize = 4096;
+// The rows of a synthetic segment.
+static constexpr int kNumRows = 1 << 21;
+// The distinct values of the low-NDV strings.
+static constexpr int kNumLowNdvStrings = 100;
+
+// The values of the single column of a synthetic segment.
+enum class DataDistribution {
+    SORTED_INT,     // the int values [0, kNumRows) in order
+    RANDOM_INT,     // the int values uniform in [0, kNumRows)
+    LOW_NDV_STRING, // kNumLowNdvStrings strings of the same prefix, random
+};
+
+static FieldType field_type_of(DataDistribution distribution) {
+    return distribution == DataDistribution::LOW_NDV_STRING ? OLAP_FIELD_TYPE_VARCHAR : OLAP_FIELD_TYPE_INT;
+}
+
+static std::string low_ndv_string(int64_t value) {
+    return fmt::format("low_ndv_string_{:03d}", value);
+}
+
+// A segment of kNumRows rows of a distribution written with an encoding into a memory file system, so that a scan
+// measures the decoding rather than the IO.
+struct SyntheticSegment {
+    std::shared_ptr<MemoryFileSystem> fs;
+    std::shared_ptr<TabletSchema> tablet_schema;
+    std::shared_ptr<Segment> segment;
+    // The bytes of the values, i.e. the bytes decoded by a full scan.
+    int64_t raw_bytes = 0;
+    uint64_t file_size = 0;
+};
+
+static MemTracker* bench_mem_tracker() {
+    static MemTracker s_mem_tracker;
+    return &s_mem_tracker;
+}
+
+static StatusOr<std::unique_ptr<SyntheticSegment>> write_segment(DataDistribution distribution,
+                                                                 EncodingTypePB encoding) {
+    auto synthetic = std::make_unique<SyntheticSegment>();
+    synthetic->fs = std::make_shared<MemoryFileSystem>();
+    RETURN_IF_ERROR(synthetic->fs->create_dir("/segment_scan_bench"));
+
+    // A duplicate key table of the single key column, which has a zone map like the key columns do.
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(DUP_KEYS);
+    schema_pb.set_num_short_key_columns(1);
+    ColumnPB* column_pb = schema_pb.add_column();
+    column_pb->set_unique_id(0);
+    column_pb->set_name("v");
+    column_pb->set_is_key(true);
+    column_pb->set_is_nullable(false);
+    if (field_type_of(distribution) == OLAP_FIELD_TYPE_VARCHAR) {
+        column_pb->set_type("VARCHAR");
+        column_pb->set_length(64);
+    } else {
+        column_pb->set_type("INT");
+        column_pb->set_length(4);
+    }
+    synthetic->tablet_schema = TabletSchema::create(bench_mem_tracker(), schema_pb);
+
+    std::string file_name = "/segment_scan_bench/segment";
+    ASSIGN_OR_RETURN(auto wfile, synthetic->fs->new_writable_file(file_name));
+    SegmentWriterOptions opts;
+    // The encoding overrides the one chosen by the column writer.
+    opts.string_encodings[0] = encoding;
+    SegmentWriter writer(std::move(wfile), 0, synthetic->tablet_schema.get(), opts);
+    RETURN_IF_ERROR(writer.init());
+
+    std::mt19937_64 rng(20221014);
+    std::uniform_int_distribution<int32_t> random_int(0, kNumRows - 1);
+    std::uniform_int_distribution<int32_t> random_string(0, kNumLowNdvStrings - 1);
+    auto schema = ChunkHelper::convert_schema_to_format_v2(*synthetic->tablet_schema);
+    auto chunk = ChunkHelper::new_chunk(schema, kBenchChunkSize);
+    std::string buffer;
+    for (int row = 0; row < kNumRows;) {
+        chunk->reset();
+        auto& column = chunk->get_column_by_index(0);
+        for (int i = 0; i < kBenchChunkSize && row < kNumRows; i++, row++) {
+            switch (distribution) {
+            case DataDistribution::SORTED_INT:
+                column->append_datum(vectorized::Datum(static_cast<int32_t>(row)));
+                synthetic->raw_bytes += sizeof(int32_t);
+                break;
+            case DataDistribution::RANDOM_INT:
+                column->append_datum(vectorized::Datum(random_int(rng)));
+                synthetic->raw_bytes += sizeof(int32_t);
+                break;
+            case DataDistribution::LOW_NDV_STRING:
+                buffer = low_ndv_string(random_string(rng));
+                column->append_datum(vectorized::Datum(Slice(buffer)));
+                synthetic->raw_bytes += buffer.size();
+                break;
+            }
+        }
+        RETURN_IF_ERROR(writer.append_chunk(*chunk));
+    }
+    uint64_t index_size = 0;
+    uint64_t footer_position = 0;
+    RETURN_IF_ERROR(writer.finalize(&synthetic->file_size, &index_size, &footer_position));
+
+    ASSIGN_OR_RETURN(synthetic->segment, Segment::open(bench_mem_tracker(), synthetic->fs, file_name, 0,
+                                                       synthetic->tablet_schema));
+    return synthetic;
+}
+
+// The segments are written once for all the benchmarks using them.
+static StatusOr<SyntheticSegment*> get_segment(DataDistribution distribution, EncodingTypePB encoding) {
+    static std::map<std::pair<DataDistribution, EncodingTypePB>, std::unique_ptr<SyntheticSegment>> s_segments;
+    auto& synthetic = s_segments[{distribution, encoding}];
+    if (synthetic == nullptr) {
+        ASSIGN_OR_RETURN(synthetic, write_segment(distribution, encoding));
+    }
+    return synthetic.get();
+}
+
+static void init_page_cache() {
+    static bool s_initialized = false;
+    if (!s_initialized) {
+        StoragePageCache::create_global_cache(bench_mem_tracker(), 4L * 1024 * 1024 * 1024);
+        s_initialized = true;
+    }
+}
+
+// The predicate on the column of |distribution| which |selectivity_percent| of the rows pass.
+static vectorized::ColumnPredicate* new_predicate(DataDistribution distribution, int selectivity_percent,
+                                                  ObjectPool* pool) {
+    std::string operand;
+    if (distribution == DataDistribution::LOW_NDV_STRING) {
+        operand = low_ndv_string(kNumLowNdvStrings * selectivity_percent / 100);
+    } else {
+        operand = std::to_string(static_cast<int64_t>(kNumRows) * selectivity_percent / 100);
+    }
+    return pool->add(
+            vectorized::new_column_lt_predicate(get_type_info(field_type_of(distribution)), 0, Slice(operand)));
+}
+
+// Scan all the rows of |synthetic| passing the predicate, and return the number of rows returned.
+static StatusOr<int64_t> scan(SyntheticSegment* synthetic, const vectorized::SegmentReadOptions& base_options,
+                              OlapReaderStatistics* stats) {
+    vectorized::SegmentReadOptions options = base_options;
+    options.stats = stats;
+    auto schema = ChunkHelper::convert_schema_to_format_v2(*synthetic->tablet_schema);
+    auto res = synthetic->segment->new_iterator(schema, options);
+    if (res.status().is_end_of_file()) {
+        // All the pages are filtered by the zone maps.
+        return 0;
+    }
+    RETURN_IF_ERROR(res);
+    auto iterator = std::move(res).value();
+    auto chunk = ChunkHelper::new_chunk(schema, kBenchChunkSize);
+    int64_t num_rows = 0;
+    while (true) {
+        chunk->reset();
+        Status st = iterator->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        RETURN_IF_ERROR(st);
+        num_rows += chunk->num_rows();
+    }
+    iterator->close();
+    return num_rows;
+}
+
+// Arguments: the encoding, the percent of the rows passing the predicate, 100 without any predicate, and whether
+// the pages are read through the page cache, which is warmed up before the measurement.
+static void do_scan(benchmark::State& state, DataDistribution distribution) {
+    auto encoding = static_cast<EncodingTypePB>(state.range(0));
+    int selectivity_percent = state.range(1);
+    bool use_page_cache = state.range(2) != 0;
+    const EncodingInfo* encoding_info = nullptr;
+    if (!EncodingInfo::get(field_type_of(distribution), encoding, &encoding_info).ok()) {
+        state.SkipWithError("encoding not supported by the type");
+        return;
+    }
+    config::vector_chunk_size = kBenchChunkSize;
+    init_page_cache();
+    auto synthetic_or = get_segment(distribution, encoding);
+    if (!synthetic_or.ok()) {
+        state.SkipWithError(synthetic_or.status().to_string().c_str());
+        return;
+    }
+    SyntheticSegment* synthetic = synthetic_or.value();
+
+    ObjectPool pool;
+    vectorized::SegmentReadOptions options;
+    options.fs = synthetic->fs;
+    options.use_page_cache = use_page_cache;
+    options.chunk_size = kBenchChunkSize;
+    if (selectivity_percent < 100) {
+        auto* predicate = new_predicate(distribution, selectivity_percent, &pool);
+        options.predicates[0].push_back(predicate);
+        options.predicates_for_zone_map[0].push_back(predicate);
+    }
+    if (use_page_cache) {
+        OlapReaderStatistics stats;
+        CHECK(scan(synthetic, options, &stats).ok());
+    }
+
+    int64_t num_rows_returned = 0;
+    OlapReaderStatistics stats;
+    for (auto _ : state) {
+        auto num_rows_or = scan(synthetic, options, &stats);
+        if (!num_rows_or.ok()) {
+            state.SkipWithError(num_rows_or.status().to_string().c_str());
+            return;
+        }
+        num_rows_returned += num_rows_or.value();
+    }
+    state.counters["rows_returned"] = benchmark::Counter(num_rows_returned, benchmark::Counter::kAvgIterations);
+    state.counters["cached_pages"] = benchmark::Counter(stats.cached_pages_num, benchmark::Counter::kAvgIterations);
+    state.counters["segment_bytes"] = synthetic->file_size;
+    // The rows and the bytes of the values of the whole segment, as if they were all decoded.
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+    state.SetBytesProcessed(state.iterations() * synthetic->raw_bytes);
+}
+
+static void ScanArgs(benchmark::internal::Benchmark* b, const std::vector<EncodingTypePB>& encodings) {
+    b->ArgNames({"encoding", "selectivity", "page_cache"});
+    for (int64_t encoding : encodings) {
+        for (int64_t selectivity_percent : {100, 50, 10, 1}) {
+            for (int64_t use_page_cache : {0, 1}) {
+                b->Args({encoding, selectivity_percent, use_page_cache});
+            }
+        }
+    }
+    b->Unit(benchmark::kMillisecond);
+}
+
+// The encodings registered in EncodingInfoResolver for INT and VARCHAR.
+static void IntScanArgs(benchmark::internal::Benchmark* b) {
+    ScanArgs(b, {PLAIN_ENCODING, BIT_SHUFFLE, FOR_ENCODING, DELTA_ENCODING});
+}
+
+static void StringScanArgs(benchmark::internal::Benchmark* b) {
+    ScanArgs(b, {PLAIN_ENCODING, DICT_ENCODING, PREFIX_ENCODING});
+}
+
+static void BM_scan_sorted_int(benchmark::State& state) {
+    do_scan(state, DataDistribution::SORTED_INT);
+}
+static void BM_scan_random_int(benchmark::State& state) {
+    do_scan(state, DataDistribution::RANDOM_INT);
+}
+static void BM_scan_low_ndv_string(benchmark::State& state) {
+    do_scan(state, DataDistribution::LOW_NDV_STRING);
+}
+
+BENCHMARK(BM_scan_sorted_int)->Apply(IntScanArgs);
+BENCHMARK(BM_scan_random_int)->Apply(IntScanArgs);
+BENCHMARK(BM_scan_low_ndv_string)->Apply(StringScanArgs);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
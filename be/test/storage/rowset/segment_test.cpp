@@ -38,6 +38,7 @@
 #include "storage/olap_common.h"
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/column_reader.h"
+#include "storage/rowset/encoding_info.h"
 #include "storage/rowset/segment_options.h"
 #include "storage/rowset/segment_writer.h"
 #include "storage/tablet_schema.h"
@@ -258,6 +259,66 @@ TEST_F(SegmentReaderWriterTest, TestHorizontalWrite) {
     EXPECT_EQ(count, num_rows);
 }
 
+TEST_F(SegmentReaderWriterTest, TestGivenStringEncoding) {
+    std::unique_ptr<TabletSchema> tablet_schema = create_schema({create_int_key(1), create_varchar_key(2)});
+    // Few distinct values, which are dict encoded by speculation.
+    static std::vector<std::string> values{"a", "b", "c"};
+    auto generator = [](size_t rid, int cid, int block_id) {
+        if (cid == 0) {
+            return vectorized::Datum(static_cast<int32_t>(rid));
+        }
+        return vectorized::Datum(Slice(values[rid % values.size()]));
+    };
+
+    SegmentWriterOptions opts;
+    shared_ptr<Segment> segment;
+    build_segment(opts, *tablet_schema, *tablet_schema, 4096, generator, &segment);
+    ASSERT_EQ(DICT_ENCODING, segment->column(1)->encoding_info()->encoding());
+
+    opts.string_encodings[tablet_schema->column(1).unique_id()] = PLAIN_ENCODING;
+    build_segment(opts, *tablet_schema, *tablet_schema, 4096, generator, &segment);
+    ASSERT_EQ(PLAIN_ENCODING, segment->column(1)->encoding_info()->encoding());
+}
+
+TEST_F(SegmentReaderWriterTest, TestReadWidenedColumn) {
+    std::unique_ptr<TabletSchema> build_schema = create_schema({create_int_key(1), create_int_value(2)});
+    // The value column widened to BIGINT by a linked schema change.
+    TabletColumn widened = create_int_value(2);
+    widened.set_type(OLAP_FIELD_TYPE_BIGINT);
+    widened.set_length(8);
+    widened.set_index_length(8);
+    std::unique_ptr<TabletSchema> query_schema = create_schema({create_int_key(1), widened});
+
+    SegmentWriterOptions opts;
+    shared_ptr<Segment> segment;
+    build_segment(opts, *build_schema, *query_schema, 100, DefaultIntGenerator, &segment);
+
+    ASSIGN_OR_ABORT(auto read_file, _fs->new_random_access_file(segment->file_name()));
+    OlapReaderStatistics stats;
+    ColumnIteratorOptions iter_opts;
+    iter_opts.read_file = read_file.get();
+    iter_opts.stats = &stats;
+    ColumnIterator* raw_iter = nullptr;
+    ASSERT_OK(segment->new_column_iterator(1, &raw_iter));
+    std::unique_ptr<ColumnIterator> iter(raw_iter);
+    ASSERT_OK(iter->init(iter_opts));
+
+    auto column = ChunkHelper::column_from_field_type(OLAP_FIELD_TYPE_BIGINT, true);
+    ASSERT_OK(iter->seek_to_first());
+    size_t n = 100;
+    ASSERT_OK(iter->next_batch(&n, column.get()));
+    ASSERT_EQ(100, column->size());
+    for (size_t i = 0; i < 100; i++) {
+        ASSERT_EQ(static_cast<int64_t>(i * 10 + 1), column->get(i).get_int64());
+    }
+
+    column->reset_column();
+    std::vector<rowid_t> rowids{3, 50, 99};
+    ASSERT_OK(iter->fetch_values_by_rowid(rowids.data(), rowids.size(), column.get()));
+    ASSERT_EQ(3, column->size());
+    ASSERT_EQ(991, column->get(2).get_int64());
+}
+
 TEST_F(SegmentReaderWriterTest, TestVerticalWrite) {
     std::unique_ptr<TabletSchema> tablet_schema =
             create_schema({create_int_key(1), create_int_key(2), create_int_value(3), create_int_value(4)});
@@ -80,20 +80,24 @@ protected:
         ASSIGN_OR_ABORT(auto r, column_zone_map.load(_fs.get(), filename, index_meta.zone_map_index(), true, false));
         ASSERT_TRUE(r);
         ASSERT_EQ(3, column_zone_map.num_pages());
-        const std::vector<ZoneMapPB>& zone_maps = column_zone_map.page_zone_maps();
-        ASSERT_EQ(3, zone_maps.size());
-        ASSERT_EQ("aaaa", zone_maps[0].min());
-        ASSERT_EQ("ffff", zone_maps[0].max());
-        ASSERT_EQ(false, zone_maps[0].has_null());
-        ASSERT_EQ(true, zone_maps[0].has_not_null());
-
-        ASSERT_EQ("aaaaa", zone_maps[1].min());
-        ASSERT_EQ("fffff", zone_maps[1].max());
-        ASSERT_EQ(true, zone_maps[1].has_null());
-        ASSERT_EQ(true, zone_maps[1].has_not_null());
-
-        ASSERT_EQ(true, zone_maps[2].has_null());
-        ASSERT_EQ(false, zone_maps[2].has_not_null());
+        std::vector<ZoneMapView> zone_maps;
+        for (int32_t i = 0; i < column_zone_map.num_pages(); i++) {
+            zone_maps.push_back(column_zone_map.page_zone_map(i));
+        }
+        ASSERT_EQ("aaaa", zone_maps[0].min.to_string());
+        ASSERT_EQ("ffff", zone_maps[0].max.to_string());
+        ASSERT_EQ(false, zone_maps[0].has_null);
+        ASSERT_EQ(true, zone_maps[0].has_not_null);
+
+        ASSERT_EQ("aaaaa", zone_maps[1].min.to_string());
+        ASSERT_EQ("fffff", zone_maps[1].max.to_string());
+        ASSERT_EQ(true, zone_maps[1].has_null);
+        ASSERT_EQ(true, zone_maps[1].has_not_null);
+
+        ASSERT_EQ(true, zone_maps[2].has_null);
+        ASSERT_EQ(false, zone_maps[2].has_not_null);
+        // Only the numeric columns have the aggregates.
+        ASSERT_FALSE(zone_maps[0].has_not_null_count);
     }
 
     std::shared_ptr<MemoryFileSystem> _fs = nullptr;
@@ -134,21 +138,38 @@ TEST_F(ColumnZoneMapTest, NormalTestIntPage) {
     ASSIGN_OR_ABORT(auto r, column_zone_map.load(_fs.get(), filename, index_meta.zone_map_index(), true, false));
     ASSERT_TRUE(r);
     ASSERT_EQ(3, column_zone_map.num_pages());
-    const std::vector<ZoneMapPB>& zone_maps = column_zone_map.page_zone_maps();
-    ASSERT_EQ(3, zone_maps.size());
-
-    ASSERT_EQ(std::to_string(1), zone_maps[0].min());
-    ASSERT_EQ(std::to_string(22), zone_maps[0].max());
-    ASSERT_EQ(false, zone_maps[0].has_null());
-    ASSERT_EQ(true, zone_maps[0].has_not_null());
-
-    ASSERT_EQ(std::to_string(2), zone_maps[1].min());
-    ASSERT_EQ(std::to_string(31), zone_maps[1].max());
-    ASSERT_EQ(true, zone_maps[1].has_null());
-    ASSERT_EQ(true, zone_maps[1].has_not_null());
+    std::vector<ZoneMapView> zone_maps;
+    for (int32_t i = 0; i < column_zone_map.num_pages(); i++) {
+        zone_maps.push_back(column_zone_map.page_zone_map(i));
+    }
 
-    ASSERT_EQ(true, zone_maps[2].has_null());
-    ASSERT_EQ(false, zone_maps[2].has_not_null());
+    ASSERT_EQ(std::to_string(1), zone_maps[0].min.to_string());
+    ASSERT_EQ(std::to_string(22), zone_maps[0].max.to_string());
+    ASSERT_EQ(false, zone_maps[0].has_null);
+    ASSERT_EQ(true, zone_maps[0].has_not_null);
+
+    ASSERT_EQ(std::to_string(2), zone_maps[1].min.to_string());
+    ASSERT_EQ(std::to_string(31), zone_maps[1].max.to_string());
+    ASSERT_EQ(true, zone_maps[1].has_null);
+    ASSERT_EQ(true, zone_maps[1].has_not_null);
+
+    ASSERT_EQ(true, zone_maps[2].has_null);
+    ASSERT_EQ(false, zone_maps[2].has_not_null);
+
+    // The aggregates of the not-null values.
+    ASSERT_TRUE(zone_maps[0].has_not_null_count);
+    ASSERT_TRUE(zone_maps[0].has_int_sum);
+    ASSERT_FALSE(zone_maps[0].has_float_sum);
+    ASSERT_EQ(6, zone_maps[0].not_null_count);
+    ASSERT_EQ(85, zone_maps[0].int_sum);
+    ASSERT_EQ(6, zone_maps[1].not_null_count);
+    ASSERT_EQ(111, zone_maps[1].int_sum);
+    ASSERT_TRUE(zone_maps[2].has_int_sum);
+    ASSERT_EQ(0, zone_maps[2].not_null_count);
+    ASSERT_EQ(0, zone_maps[2].int_sum);
+    ZoneMapView segment_zone_map = ZoneMapView::from_pb(index_meta.zone_map_index().segment_zone_map());
+    ASSERT_EQ(12, segment_zone_map.not_null_count);
+    ASSERT_EQ(196, segment_zone_map.int_sum);
     delete field;
 }
 
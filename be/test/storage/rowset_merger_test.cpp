@@ -301,7 +301,15 @@ TEST_F(RowsetMergerTest, vertical_merge) {
     ASSERT_TRUE(PrimaryKeyEncoder::create_column(schema, &writer.all_pks).ok());
     writer.non_key_columns.emplace_back(std::move(vectorized::Int16Column::create_mutable()));
     writer.non_key_columns.emplace_back(std::move(vectorized::Int32Column::create_mutable()));
+    std::unique_ptr<vectorized::Column> output_pks;
+    ASSERT_TRUE(PrimaryKeyEncoder::create_column(schema, &output_pks).ok());
+    cfg.output_pks = output_pks.get();
     ASSERT_TRUE(vectorized::compaction_merge_rowsets(*_tablet, version, rowsets, &writer, cfg).ok());
+    ASSERT_EQ(pks.size(), output_pks->size());
+    const int64_t* raw_output_pk_array = reinterpret_cast<const int64_t*>(output_pks->raw_data());
+    for (int64_t i = 0; i < pks.size(); i++) {
+        ASSERT_EQ(pks[i], raw_output_pk_array[i]);
+    }
 
     ASSERT_EQ(pks.size(), writer.all_pks->size());
     ASSERT_EQ(2, writer.non_key_columns.size());
@@ -0,0 +1,111 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "storage/runtime_range_pruner.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/assert.h"
+
+namespace starrocks::vectorized {
+
+TEST(RuntimeRangePrunerTest, update_range_if_arrived) {
+    RuntimeRangePruner pruner;
+    ASSERT_TRUE(pruner.empty());
+
+    bool arrived0 = false;
+    bool arrived1 = false;
+    int num_built = 0;
+    // Fake predicates, they are only passed through.
+    auto* pred0 = reinterpret_cast<const ColumnPredicate*>(0x10);
+    auto* pred1 = reinterpret_cast<const ColumnPredicate*>(0x20);
+    pruner.add_runtime_filter(
+            0, [&]() { return arrived0; },
+            [&](RuntimeRangePruner::PredicateList* preds) {
+                num_built++;
+                preds->push_back(pred0);
+                return Status::OK();
+            });
+    pruner.add_runtime_filter(
+            1, [&]() { return arrived1; },
+            [&](RuntimeRangePruner::PredicateList* preds) {
+                num_built++;
+                preds->push_back(pred1);
+                return Status::OK();
+            });
+    ASSERT_FALSE(pruner.empty());
+
+    std::vector<std::pair<ColumnId, const ColumnPredicate*>> updated;
+    auto updater = [&](ColumnId cid, const RuntimeRangePruner::PredicateList& preds) {
+        updated.emplace_back(cid, preds[0]);
+        return Status::OK();
+    };
+
+    size_t num_applied0 = 0;
+    ASSERT_OK(pruner.update_range_if_arrived(&num_applied0, updater));
+    ASSERT_TRUE(updated.empty());
+
+    arrived1 = true;
+    ASSERT_OK(pruner.update_range_if_arrived(&num_applied0, updater));
+    ASSERT_EQ(1, updated.size());
+    EXPECT_EQ(1, updated[0].first);
+    EXPECT_EQ(pred1, updated[0].second);
+    EXPECT_EQ(1, num_applied0);
+
+    // Nothing new arrived.
+    updated.clear();
+    ASSERT_OK(pruner.update_range_if_arrived(&num_applied0, updater));
+    ASSERT_TRUE(updated.empty());
+
+    // Another iterator applies all the arrived filters, which are built only once.
+    arrived0 = true;
+    size_t num_applied1 = 0;
+    ASSERT_OK(pruner.update_range_if_arrived(&num_applied1, updater));
+    ASSERT_EQ(2, updated.size());
+    EXPECT_EQ(1, updated[0].first);
+    EXPECT_EQ(0, updated[1].first);
+    EXPECT_EQ(2, num_built);
+
+    updated.clear();
+    ASSERT_OK(pruner.update_range_if_arrived(&num_applied0, updater));
+    ASSERT_EQ(1, updated.size());
+    EXPECT_EQ(0, updated[0].first);
+    EXPECT_EQ(2, num_applied0);
+}
+
+TEST(RuntimeRangePrunerTest, versioned_filter) {
+    RuntimeRangePruner pruner;
+    int64_t version = 0;
+    int num_built = 0;
+    auto* pred = reinterpret_cast<const ColumnPredicate*>(0x10);
+    pruner.add_versioned_filter(
+            2, [&]() { return version; },
+            [&](RuntimeRangePruner::PredicateList* preds) {
+                num_built++;
+                preds->push_back(pred);
+                return Status::OK();
+            });
+    ASSERT_FALSE(pruner.empty());
+
+    size_t num_updated = 0;
+    auto updater = [&](ColumnId cid, const RuntimeRangePruner::PredicateList& preds) {
+        EXPECT_EQ(2, cid);
+        num_updated++;
+        return Status::OK();
+    };
+    size_t num_applied = 0;
+    ASSERT_OK(pruner.update_range_if_arrived(&num_applied, updater));
+    EXPECT_EQ(0, num_updated);
+
+    // Each new version is built and applied once.
+    version = 1;
+    ASSERT_OK(pruner.update_range_if_arrived(&num_applied, updater));
+    ASSERT_OK(pruner.update_range_if_arrived(&num_applied, updater));
+    EXPECT_EQ(1, num_updated);
+    version = 3;
+    ASSERT_OK(pruner.update_range_if_arrived(&num_applied, updater));
+    EXPECT_EQ(2, num_updated);
+    EXPECT_EQ(2, num_built);
+    EXPECT_EQ(2, num_applied);
+}
+
+} // namespace starrocks::vectorized
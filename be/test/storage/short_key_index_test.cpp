@@ -93,4 +93,33 @@ TEST_F(ShortKeyIndexTest, buider) {
     }
 }
 
+// The keys longer than the 8 bytes prefix and the ones of the same prefix.
+TEST_F(ShortKeyIndexTest, long_keys) {
+    ShortKeyIndexBuilder builder(0, 1024);
+    std::vector<std::string> keys = {"abc", "abcdefgh", "abcdefgh", "abcdefgh1", "abcdefgh2", "abcdefgi", "b"};
+    for (const auto& key : keys) {
+        builder.add_item(key);
+    }
+    std::vector<Slice> slices;
+    PageFooterPB footer;
+    ASSERT_TRUE(builder.finalize(keys.size() * 1024, &slices, &footer).ok());
+    std::string buf;
+    for (auto& slice : slices) {
+        buf.append(slice.data, slice.size);
+    }
+    ShortKeyIndexDecoder decoder;
+    ASSERT_TRUE(decoder.parse(buf, footer.short_key_page_footer()).ok());
+
+    ASSERT_EQ(0, decoder.lower_bound("").ordinal());
+    ASSERT_EQ(1, decoder.lower_bound("abcd").ordinal());
+    ASSERT_EQ(1, decoder.lower_bound("abcdefgh").ordinal());
+    ASSERT_EQ(3, decoder.upper_bound("abcdefgh").ordinal());
+    ASSERT_EQ(3, decoder.lower_bound("abcdefgh0").ordinal());
+    ASSERT_EQ(4, decoder.lower_bound("abcdefgh2").ordinal());
+    ASSERT_EQ(5, decoder.upper_bound("abcdefgh2").ordinal());
+    ASSERT_EQ(5, decoder.lower_bound("abcdefgh3").ordinal());
+    ASSERT_EQ(6, decoder.upper_bound("abcdefgi").ordinal());
+    ASSERT_FALSE(decoder.upper_bound("b").valid());
+}
+
 } // namespace starrocks
@@ -2428,6 +2428,43 @@ TEST_F(TabletUpdatesTest, get_column_values_with_persistent_index) {
     test_get_column_values(true);
 }
 
+TEST_F(TabletUpdatesTest, get_rows_by_keys) {
+    auto tablet = create_tablet(rand(), rand());
+    DeferOp del_tablet([&]() {
+        (void)StorageEngine::instance()->tablet_manager()->drop_tablet(tablet->tablet_id());
+        (void)fs::remove_all(tablet->schema_hash_path());
+    });
+    std::vector<int64_t> keys;
+    for (int i = 0; i < 100; i++) {
+        keys.push_back(i);
+    }
+    ASSERT_TRUE(tablet->rowset_commit(2, create_rowset(tablet, keys)).ok());
+    std::vector<int64_t> updated_keys = {1, 2};
+    ASSERT_TRUE(tablet->rowset_commit(3, create_rowset(tablet, updated_keys)).ok());
+
+    auto pkey_schema = ChunkHelper::convert_schema_to_format_v2(tablet->tablet_schema(), {0});
+    auto lookup_keys = ChunkHelper::new_chunk(pkey_schema, 3);
+    for (int64_t key : {5, 200, 1}) {
+        lookup_keys->get_column_by_index(0)->append_datum(vectorized::Datum(key));
+    }
+    std::unique_ptr<vectorized::Column> pks;
+    ASSERT_OK(PrimaryKeyEncoder::create_column(pkey_schema, &pks));
+    PrimaryKeyEncoder::encode(pkey_schema, *lookup_keys, 0, lookup_keys->num_rows(), pks.get());
+
+    std::vector<uint32_t> column_ids = {1};
+    const auto& tablet_column = tablet->tablet_schema().column(1);
+    std::vector<std::unique_ptr<vectorized::Column>> columns;
+    columns.emplace_back(ChunkHelper::column_from_field_type(tablet_column.type(), tablet_column.is_nullable())
+                                 ->clone_empty());
+    std::vector<bool> found;
+    int64_t version = 0;
+    ASSERT_OK(tablet->updates()->get_rows_by_keys(*pks, column_ids, &found, &columns, &version));
+    ASSERT_EQ(3, version);
+    ASSERT_EQ(std::vector<bool>({true, false, true}), found);
+    // The rows of the keys found, in the order of the keys.
+    ASSERT_EQ("[6, 2]", columns[0]->debug_string());
+}
+
 void TabletUpdatesTest::test_get_missing_version_ranges(const std::vector<int64_t>& versions,
                                                         const std::vector<int64_t>& expected_missing_ranges) {
     auto tablet = create_tablet(rand(), rand());
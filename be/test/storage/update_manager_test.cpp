@@ -4,6 +4,9 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
+
+#include "common/config.h"
 #include "fs/fs_util.h"
 #include "runtime/mem_tracker.h"
 #include "storage/chunk_helper.h"
@@ -146,6 +149,35 @@ TEST_F(UpdateManagerTest, testDelVec) {
     ASSERT_EQ(5, tmp->version());
 }
 
+TEST_F(UpdateManagerTest, testIndexCacheCapacity) {
+    int32_t old_percent = config::update_index_cache_capacity_percent;
+    config::update_index_cache_capacity_percent = 50;
+    MemTracker mem_tracker(1000, "update_limited");
+    UpdateManager update_manager(&mem_tracker);
+    ASSERT_OK(update_manager.init());
+    auto& index_cache = update_manager.index_cache();
+    ASSERT_EQ(500, index_cache.capacity());
+
+    // the least recently used index not in use is evicted
+    auto entry1 = index_cache.get_or_create(1);
+    index_cache.update_object_size(entry1, 200);
+    index_cache.release(entry1);
+    auto entry2 = index_cache.get_or_create(2);
+    index_cache.update_object_size(entry2, 200);
+    index_cache.release(entry2);
+    auto entry3 = index_cache.get_or_create(3);
+    index_cache.update_object_size(entry3, 200);
+    index_cache.release(entry3);
+    ASSERT_EQ(2, index_cache.object_size());
+    ASSERT_EQ(nullptr, index_cache.get(1));
+
+    // the capacity follows the config
+    config::update_index_cache_capacity_percent = 0;
+    update_manager.expire_cache();
+    ASSERT_EQ(std::numeric_limits<size_t>::max(), index_cache.capacity());
+    config::update_index_cache_capacity_percent = old_percent;
+}
+
 TEST_F(UpdateManagerTest, testExpireEntry) {
     srand(time(NULL));
     create_tablet(rand(), rand());
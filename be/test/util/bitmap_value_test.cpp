@@ -23,6 +23,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "util/coding.h"
 #define private public
@@ -407,5 +408,53 @@ TEST(BitmapValueTest, bitmap_xor) {
     }
 }
 
+TEST(BitmapValueTest, bitmap_add_many) {
+    // The values cross the boundaries of the high 32 bits, and some of them are duplicated.
+    std::vector<uint64_t> values;
+    for (uint64_t i = 0; i < 1000; i++) {
+        values.push_back(i * 7);
+        values.push_back((1ULL << 32) + i);
+        values.push_back(i * 7);
+    }
+    BitmapValue expected;
+    for (uint64_t value : values) {
+        expected.add(value);
+    }
+    BitmapValue bitmap;
+    bitmap.add_many(values.size(), values.data());
+    ASSERT_EQ(2000, bitmap.cardinality());
+    ASSERT_EQ(expected.to_string(), bitmap.to_string());
+
+    BitmapValue small;
+    small.add_many(2, values.data());
+    ASSERT_EQ(1, small.cardinality());
+}
+
+TEST(BitmapValueTest, bitmap_lazy_union) {
+    BitmapValue expected;
+    BitmapValue lazy;
+    for (uint64_t i = 0; i < 100; i++) {
+        // Dense bitmaps of bitset containers, and a single value.
+        BitmapValue bitmap;
+        for (uint64_t j = 0; j < 10000; j += 2) {
+            bitmap.add(i * 1000 + j);
+        }
+        bitmap.add((1ULL << 32) + i);
+        expected |= bitmap;
+        lazy.lazy_union(bitmap);
+        lazy.lazy_union(BitmapValue(i));
+        expected.add(i);
+    }
+    lazy.repair_after_lazy_union();
+    ASSERT_EQ(expected.cardinality(), lazy.cardinality());
+    ASSERT_EQ(expected.to_string(), lazy.to_string());
+
+    // A repaired bitmap is serialized as usual.
+    std::string buf(lazy.getSizeInBytes(), '\0');
+    lazy.write(buf.data());
+    BitmapValue deserialized(buf.data());
+    ASSERT_EQ(expected.cardinality(), deserialized.cardinality());
+}
+
 } // namespace vectorized
 } // namespace starrocks
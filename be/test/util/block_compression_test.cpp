@@ -196,6 +196,54 @@ TEST_F(BlockCompressionTest, multi) {
     test_multi_slices(starrocks::CompressionTypePB::GZIP);
 }
 
+void test_decompress_batch(starrocks::CompressionTypePB type) {
+    const BlockCompressionCodec* codec = nullptr;
+    auto st = get_block_compression_codec(type, &codec);
+    ASSERT_TRUE(st.ok());
+
+    size_t test_sizes[] = {0, 1, 10, 1000, 100000};
+    std::vector<std::string> origs;
+    std::vector<std::string> compressed_strs;
+    std::vector<Slice> compressed_slices;
+    for (auto size : test_sizes) {
+        origs.emplace_back(generate_str(size));
+        auto& compressed = compressed_strs.emplace_back();
+        compressed.resize(codec->max_compressed_len(size));
+    }
+    for (size_t i = 0; i < origs.size(); i++) {
+        Slice compressed_slice(compressed_strs[i]);
+        ASSERT_TRUE(codec->compress(origs[i], &compressed_slice).ok());
+        compressed_slices.emplace_back(compressed_slice);
+    }
+
+    std::vector<std::string> uncompressed_strs(origs.size());
+    std::vector<Slice> uncompressed_slices;
+    for (size_t i = 0; i < origs.size(); i++) {
+        uncompressed_strs[i].resize(origs[i].size());
+        uncompressed_slices.emplace_back(uncompressed_strs[i]);
+    }
+    ASSERT_TRUE(codec->decompress_batch(compressed_slices, &uncompressed_slices).ok());
+    for (size_t i = 0; i < origs.size(); i++) {
+        ASSERT_EQ(origs[i].size(), uncompressed_slices[i].size);
+        ASSERT_EQ(origs[i], uncompressed_slices[i].to_string());
+    }
+
+    // a corrupted page fails the batch
+    if (type != starrocks::CompressionTypePB::SNAPPY && type != starrocks::CompressionTypePB::GZIP) {
+        compressed_slices.back().size -= 1;
+        ASSERT_FALSE(codec->decompress_batch(compressed_slices, &uncompressed_slices).ok());
+    }
+}
+
+TEST_F(BlockCompressionTest, decompress_batch) {
+    test_decompress_batch(starrocks::CompressionTypePB::SNAPPY);
+    test_decompress_batch(starrocks::CompressionTypePB::ZLIB);
+    test_decompress_batch(starrocks::CompressionTypePB::LZ4);
+    test_decompress_batch(starrocks::CompressionTypePB::LZ4_FRAME);
+    test_decompress_batch(starrocks::CompressionTypePB::ZSTD);
+    test_decompress_batch(starrocks::CompressionTypePB::GZIP);
+}
+
 static std::string random_string(int len) {
     static starrocks::Random rand(20200722);
     std::string s;
@@ -0,0 +1,61 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "util/german_string.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace starrocks {
+
+static int sign(int value) {
+    return value < 0 ? -1 : (value > 0 ? 1 : 0);
+}
+
+TEST(GermanStringTest, inline_and_pointer) {
+    std::string short_string = "hello world";
+    std::string long_string = "hello world, hello starrocks";
+
+    GermanString short_view(Slice(short_string.data(), short_string.size()));
+    ASSERT_TRUE(short_view.is_inline());
+    ASSERT_EQ(short_string, short_view.to_slice().to_string());
+
+    GermanString long_view(Slice(long_string.data(), long_string.size()));
+    ASSERT_FALSE(long_view.is_inline());
+    ASSERT_EQ(long_string.data(), long_view.data());
+    ASSERT_EQ(long_string, long_view.to_slice().to_string());
+
+    ASSERT_EQ(0, GermanString().size());
+    ASSERT_EQ(GermanString(), GermanString(Slice()));
+}
+
+TEST(GermanStringTest, same_order_as_slice) {
+    std::vector<std::string> values = {"",
+                                       "a",
+                                       std::string("a\0", 2),
+                                       std::string("a\0b", 3),
+                                       "ab",
+                                       "abcd",
+                                       "abcde",
+                                       "abcdefghijkl",
+                                       "abcdefghijklm",
+                                       "abcdefghijklmn",
+                                       "abcdefghijklmo",
+                                       "abce",
+                                       "b",
+                                       "\xff\xff\xff\xff\xff",
+                                       "\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff"};
+    for (const auto& lhs : values) {
+        for (const auto& rhs : values) {
+            Slice lhs_slice(lhs.data(), lhs.size());
+            Slice rhs_slice(rhs.data(), rhs.size());
+            GermanString lhs_view(lhs_slice);
+            GermanString rhs_view(rhs_slice);
+            ASSERT_EQ(sign(lhs_slice.compare(rhs_slice)), lhs_view.compare(rhs_view)) << lhs << " " << rhs;
+            ASSERT_EQ(lhs == rhs, lhs_view == rhs_view) << lhs << " " << rhs;
+        }
+    }
+}
+
+} // namespace starrocks
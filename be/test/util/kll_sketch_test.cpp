@@ -0,0 +1,109 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "util/kll_sketch.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace starrocks {
+
+class KllSketchTest : public ::testing::Test {};
+
+static std::vector<double> shuffled_values(size_t num_values) {
+    std::vector<double> values(num_values);
+    for (size_t i = 0; i < num_values; ++i) {
+        values[i] = i;
+    }
+    std::mt19937 rng(42);
+    std::shuffle(values.begin(), values.end(), rng);
+    return values;
+}
+
+TEST_F(KllSketchTest, empty) {
+    KllSketch sketch;
+    ASSERT_EQ(0, sketch.count());
+    ASSERT_EQ(0, sketch.quantile(0.5));
+}
+
+TEST_F(KllSketchTest, exact_when_small) {
+    KllSketch sketch;
+    for (double value : shuffled_values(100)) {
+        sketch.add(value);
+    }
+    ASSERT_EQ(100, sketch.count());
+    ASSERT_EQ(100, sketch.num_retained());
+    ASSERT_EQ(0, sketch.quantile(0));
+    ASSERT_EQ(49, sketch.quantile(0.5));
+    ASSERT_EQ(99, sketch.quantile(1));
+}
+
+TEST_F(KllSketchTest, bounded_error) {
+    const size_t num_values = 1000000;
+    std::vector<double> values = shuffled_values(num_values);
+    KllSketch sketch;
+    sketch.add_batch(values.data(), values.size());
+    ASSERT_EQ(num_values, sketch.count());
+    ASSERT_LT(sketch.num_retained(), 3 * KllSketch::kDefaultK + 200);
+    for (double q : {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99}) {
+        ASSERT_NEAR(q * num_values, sketch.quantile(q), 0.02 * num_values) << q;
+    }
+}
+
+TEST_F(KllSketchTest, add_batch) {
+    std::vector<double> values = shuffled_values(50000);
+    KllSketch one_by_one;
+    for (double value : values) {
+        one_by_one.add(value);
+    }
+    KllSketch batch;
+    for (size_t i = 0; i < values.size(); i += 4096) {
+        batch.add_batch(values.data() + i, std::min<size_t>(4096, values.size() - i));
+    }
+    ASSERT_EQ(one_by_one.count(), batch.count());
+    for (double q : {0.1, 0.5, 0.9}) {
+        ASSERT_NEAR(one_by_one.quantile(q), batch.quantile(q), 0.02 * values.size());
+    }
+}
+
+TEST_F(KllSketchTest, merge) {
+    const size_t num_values = 200000;
+    std::vector<double> values = shuffled_values(num_values);
+    KllSketch merged;
+    for (size_t i = 0; i < 10; ++i) {
+        KllSketch part;
+        size_t begin = i * num_values / 10;
+        size_t end = (i + 1) * num_values / 10;
+        part.add_batch(values.data() + begin, end - begin);
+        merged.merge(part);
+    }
+    ASSERT_EQ(num_values, merged.count());
+    ASSERT_LT(merged.num_retained(), 3 * KllSketch::kDefaultK + 200);
+    for (double q : {0.1, 0.5, 0.9}) {
+        ASSERT_NEAR(q * num_values, merged.quantile(q), 0.02 * num_values) << q;
+    }
+}
+
+TEST_F(KllSketchTest, serialize) {
+    std::vector<double> values = shuffled_values(100000);
+    KllSketch sketch;
+    sketch.add_batch(values.data(), values.size());
+
+    std::vector<uint8_t> buffer(sketch.serialize_size());
+    ASSERT_EQ(buffer.size(), sketch.serialize(buffer.data()));
+
+    KllSketch deserialized;
+    ASSERT_TRUE(deserialized.deserialize(Slice(buffer.data(), buffer.size())));
+    ASSERT_EQ(sketch.count(), deserialized.count());
+    ASSERT_EQ(sketch.num_retained(), deserialized.num_retained());
+    for (double q : {0.0, 0.1, 0.5, 0.9, 1.0}) {
+        ASSERT_EQ(sketch.quantile(q), deserialized.quantile(q));
+    }
+
+    ASSERT_FALSE(deserialized.deserialize(Slice(buffer.data(), buffer.size() - 1)));
+    ASSERT_EQ(0, deserialized.count());
+}
+
+} // namespace starrocks
@@ -0,0 +1,76 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "util/lock_contention_profiler.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+namespace starrocks {
+
+class LockContentionProfilerTest : public testing::Test {
+protected:
+    void TearDown() override {
+        config::enable_lock_contention_profile = false;
+        config::lock_contention_stack_threshold_us = 1000;
+    }
+};
+
+TEST_F(LockContentionProfilerTest, test_disabled) {
+    config::enable_lock_contention_profile = false;
+    ProfiledMutex<std::mutex> mutex("test_disabled");
+    for (int i = 0; i < 10; i++) {
+        std::lock_guard l(mutex);
+    }
+    auto* site = LockContentionProfiler::instance()->get_site("test_disabled");
+    ASSERT_EQ(0, site->num_acquires());
+    ASSERT_EQ(0, site->hold_ns());
+}
+
+TEST_F(LockContentionProfilerTest, test_wait_and_hold) {
+    config::enable_lock_contention_profile = true;
+    config::lock_contention_stack_threshold_us = 10 * 1000;
+    ProfiledMutex<std::mutex> mutex("test_wait_and_hold");
+    auto* site = LockContentionProfiler::instance()->get_site("test_wait_and_hold");
+
+    std::atomic<bool> locked = false;
+    std::thread holder([&]() {
+        std::lock_guard l(mutex);
+        locked = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    });
+    while (!locked) {
+        std::this_thread::yield();
+    }
+    {
+        std::lock_guard l(mutex);
+    }
+    holder.join();
+    ASSERT_TRUE(mutex.try_lock());
+    mutex.unlock();
+
+    ASSERT_EQ(3, site->num_acquires());
+    ASSERT_EQ(1, site->num_contended());
+    ASSERT_GE(site->max_wait_ns(), 10 * 1000 * 1000);
+    ASSERT_GE(site->max_hold_ns(), 50 * 1000 * 1000);
+
+    std::stringstream ss;
+    site->write_report(ss, 10);
+    ASSERT_NE(std::string::npos, ss.str().find("wait stack: count=1"));
+    ASSERT_NE(std::string::npos, ss.str().find("hold stack: count=1"));
+
+    site->reset();
+    ASSERT_EQ(0, site->num_acquires());
+    ASSERT_EQ(0, site->max_hold_ns());
+}
+
+TEST_F(LockContentionProfilerTest, test_enabled_while_held) {
+    ProfiledMutex<std::mutex> mutex("test_enabled_while_held");
+    mutex.lock();
+    config::enable_lock_contention_profile = true;
+    mutex.unlock();
+    ASSERT_EQ(0, LockContentionProfiler::instance()->get_site("test_enabled_while_held")->num_acquires());
+}
+
+} // namespace starrocks
@@ -0,0 +1,86 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "util/lock_free_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace starrocks {
+
+TEST(LockFreeQueueTest, test_put_and_get) {
+    LockFreeQueue<int> queue;
+    ASSERT_TRUE(queue.empty());
+    int val = 0;
+    ASSERT_FALSE(queue.try_get(&val));
+
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(queue.put(int(i)));
+    }
+    ASSERT_EQ(10, queue.size());
+    // FIFO for the same producer.
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(queue.try_get(&val));
+        ASSERT_EQ(i, val);
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(LockFreeQueueTest, test_shutdown_and_clear) {
+    int64_t dropped_sum = 0;
+    LockFreeQueue<int> queue([&](const int& val) { dropped_sum += val; });
+    ASSERT_TRUE(queue.put(1));
+    ASSERT_TRUE(queue.put(2));
+
+    queue.shutdown();
+    ASSERT_TRUE(queue.is_shutdown());
+    ASSERT_FALSE(queue.put(3));
+    ASSERT_EQ(2, queue.size());
+
+    queue.clear();
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(3, dropped_sum);
+}
+
+TEST(LockFreeQueueTest, test_multi_producer_multi_consumer) {
+    constexpr int kNumProducers = 4;
+    constexpr int kNumConsumers = 4;
+    constexpr int kNumPerProducer = 10000;
+
+    LockFreeQueue<int64_t> queue;
+    std::atomic<int> num_finished_producers = 0;
+    std::atomic<int64_t> num_got = 0;
+    std::atomic<int64_t> sum = 0;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kNumProducers; i++) {
+        threads.emplace_back([&]() {
+            for (int64_t j = 1; j <= kNumPerProducer; j++) {
+                ASSERT_TRUE(queue.put(int64_t(j)));
+            }
+            num_finished_producers++;
+        });
+    }
+    for (int i = 0; i < kNumConsumers; i++) {
+        threads.emplace_back([&]() {
+            int64_t val = 0;
+            while (num_finished_producers < kNumProducers || !queue.empty()) {
+                if (queue.try_get(&val)) {
+                    sum += val;
+                    num_got++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(kNumProducers * kNumPerProducer, num_got);
+    ASSERT_EQ(kNumProducers * int64_t(kNumPerProducer) * (kNumPerProducer + 1) / 2, sum);
+}
+
+} // namespace starrocks
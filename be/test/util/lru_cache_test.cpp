@@ -255,6 +255,84 @@ TEST_F(CacheTest, Usage) {
     ASSERT_EQ(950, cache.get_usage());
 }
 
+static void noop_deleter(const CacheKey& key, void* v) {}
+
+static void insert_LRUCache(LRUCache& cache, int key, CacheAccessMode mode) {
+    std::string result;
+    CacheKey cache_key = EncodeKey(&result, key);
+    uint32_t hash = cache_key.hash(cache_key.data(), cache_key.size(), 0);
+    cache.release(cache.insert(cache_key, hash, EncodeValue(key), 1, &noop_deleter, CachePriority::NORMAL, mode));
+}
+
+static bool lookup_LRUCache(LRUCache& cache, int key, CacheAccessMode mode) {
+    std::string result;
+    CacheKey cache_key = EncodeKey(&result, key);
+    uint32_t hash = cache_key.hash(cache_key.data(), cache_key.size(), 0);
+    Cache::Handle* handle = cache.lookup(cache_key, hash, mode);
+    if (handle == nullptr) {
+        return false;
+    }
+    cache.release(handle);
+    return true;
+}
+
+TEST_F(CacheTest, ScanResistant) {
+    LRUCache cache;
+    cache.set_capacity(100);
+    cache.set_protected_ratio(0.5);
+
+    // The working set, hit again after inserted.
+    for (int i = 0; i < 40; i++) {
+        insert_LRUCache(cache, i, CacheAccessMode::NORMAL);
+        ASSERT_TRUE(lookup_LRUCache(cache, i, CacheAccessMode::NORMAL));
+    }
+    ASSERT_EQ(40, cache.get_protected_usage());
+
+    // A scan reads every entry once.
+    for (int i = 1000; i < 2000; i++) {
+        insert_LRUCache(cache, i, CacheAccessMode::NORMAL);
+    }
+    ASSERT_EQ(100, cache.get_usage());
+    for (int i = 0; i < 40; i++) {
+        ASSERT_TRUE(lookup_LRUCache(cache, i, CacheAccessMode::NORMAL)) << i;
+    }
+    ASSERT_FALSE(lookup_LRUCache(cache, 1000, CacheAccessMode::NORMAL));
+    ASSERT_TRUE(lookup_LRUCache(cache, 1999, CacheAccessMode::NORMAL));
+
+    // The protected segment is bounded, the oldest ones are demoted.
+    for (int i = 100; i < 200; i++) {
+        insert_LRUCache(cache, i, CacheAccessMode::NORMAL);
+        ASSERT_TRUE(lookup_LRUCache(cache, i, CacheAccessMode::NORMAL));
+        ASSERT_LE(cache.get_protected_usage(), 50);
+    }
+    ASSERT_EQ(100, cache.get_usage());
+    ASSERT_TRUE(lookup_LRUCache(cache, 199, CacheAccessMode::NORMAL));
+}
+
+TEST_F(CacheTest, SequentialAccess) {
+    LRUCache cache;
+    cache.set_capacity(100);
+    cache.set_protected_ratio(0.5);
+
+    for (int i = 0; i < 60; i++) {
+        insert_LRUCache(cache, i, CacheAccessMode::NORMAL);
+    }
+    // The entries inserted by sequential accesses are evicted first.
+    for (int i = 1000; i < 2000; i++) {
+        insert_LRUCache(cache, i, CacheAccessMode::SEQUENTIAL);
+    }
+    for (int i = 0; i < 60; i++) {
+        ASSERT_TRUE(lookup_LRUCache(cache, i, CacheAccessMode::SEQUENTIAL)) << i;
+    }
+    ASSERT_TRUE(lookup_LRUCache(cache, 1999, CacheAccessMode::SEQUENTIAL));
+    ASSERT_LE(cache.get_usage(), 100);
+
+    // Sequential lookups don't protect the entries.
+    ASSERT_EQ(0, cache.get_protected_usage());
+    ASSERT_TRUE(lookup_LRUCache(cache, 0, CacheAccessMode::NORMAL));
+    ASSERT_EQ(1, cache.get_protected_usage());
+}
+
 TEST_F(CacheTest, HeavyEntries) {
     // Add a bunch of light and heavy entries and then count the combined
     // size of items still in the cache, which must be approximately the
@@ -0,0 +1,73 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "util/mem_alloc_profiler.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace starrocks {
+
+class MemAllocProfilerTest : public testing::Test {
+protected:
+    void SetUp() override { MemAllocProfiler::instance()->reset(); }
+
+    void TearDown() override {
+        config::enable_mem_alloc_profile = false;
+        config::mem_alloc_profile_sample_bytes = 1048576;
+        tls_mem_alloc_bytes_until_sample = 0;
+        MemAllocProfiler::instance()->reset();
+    }
+};
+
+TEST_F(MemAllocProfilerTest, test_should_sample) {
+    config::enable_mem_alloc_profile = false;
+    ASSERT_FALSE(MemAllocProfiler::should_sample(1 << 30));
+
+    config::enable_mem_alloc_profile = true;
+    config::mem_alloc_profile_sample_bytes = 100;
+    tls_mem_alloc_bytes_until_sample = 100;
+    ASSERT_FALSE(MemAllocProfiler::should_sample(0));
+    ASSERT_FALSE(MemAllocProfiler::should_sample(60));
+    ASSERT_TRUE(MemAllocProfiler::should_sample(60));
+    MemAllocProfiler::instance()->sample("test_should_sample");
+    // The countdown restarts after the sample.
+    ASSERT_EQ(100, tls_mem_alloc_bytes_until_sample);
+}
+
+TEST_F(MemAllocProfilerTest, test_report) {
+    config::enable_mem_alloc_profile = true;
+    config::mem_alloc_profile_sample_bytes = 100;
+    tls_mem_alloc_bytes_until_sample = 100;
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(MemAllocProfiler::should_sample(150));
+        MemAllocProfiler::instance()->sample("query_pool");
+    }
+    ASSERT_TRUE(MemAllocProfiler::should_sample(100));
+    MemAllocProfiler::instance()->sample("load");
+
+    std::stringstream ss;
+    MemAllocProfiler::instance()->write_report(ss, "", 10);
+    std::string report = ss.str();
+    ASSERT_NE(std::string::npos, report.find("label: query_pool, allocated bytes: 450")) << report;
+    ASSERT_NE(std::string::npos, report.find("label: load, allocated bytes: 100")) << report;
+    // Ordered by the allocated bytes descending.
+    ASSERT_LT(report.find("label: query_pool"), report.find("label: load"));
+
+    std::stringstream filtered;
+    MemAllocProfiler::instance()->write_report(filtered, "load", 10);
+    ASSERT_EQ(std::string::npos, filtered.str().find("query_pool"));
+    ASSERT_NE(std::string::npos, filtered.str().find("label: load"));
+
+    std::stringstream pprof;
+    MemAllocProfiler::instance()->write_pprof(pprof, "load");
+    ASSERT_EQ(0, pprof.str().find("heap profile: 1: 100 [1: 100] @ heapprofile\n")) << pprof.str();
+    ASSERT_NE(std::string::npos, pprof.str().find("MAPPED_LIBRARIES:"));
+
+    MemAllocProfiler::instance()->reset();
+    std::stringstream empty;
+    MemAllocProfiler::instance()->write_report(empty, "", 10);
+    ASSERT_EQ(std::string::npos, empty.str().find("label:"));
+}
+
+} // namespace starrocks
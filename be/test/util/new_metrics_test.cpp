@@ -181,6 +181,22 @@ TEST_F(MetricsTest, Gauge) {
     }
 }
 
+TEST_F(MetricsTest, Histogram) {
+    ASSERT_EQ(std::vector<int64_t>({10, 20, 40, 80}), IntHistogram::exponential_bounds(10, 2, 4));
+
+    IntHistogram histogram(MetricUnit::NANOSECONDS, {10, 100, 1000});
+    ASSERT_EQ(0, histogram.count());
+    ASSERT_EQ(std::vector<int64_t>({0, 0, 0, 0}), histogram.cumulative_counts());
+    for (int64_t value : {1, 10, 11, 100, 500, 5000}) {
+        histogram.observe(value);
+    }
+    ASSERT_EQ(6, histogram.count());
+    ASSERT_EQ(5622, histogram.sum());
+    // The bounds are inclusive, and the last bucket is +Inf.
+    ASSERT_EQ(std::vector<int64_t>({2, 4, 5, 6}), histogram.cumulative_counts());
+    ASSERT_STREQ("6", histogram.to_string().c_str());
+}
+
 TEST_F(MetricsTest, MetricLabel) {
     std::string put("put");
     MetricLabel label("type", put);
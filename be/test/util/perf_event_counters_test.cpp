@@ -0,0 +1,42 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "util/perf_event_counters.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+// The perf events may be unavailable in the test environment, e.g. a container without CAP_PERFMON.
+TEST(PerfEventCountersTest, test_scoped_counters) {
+    RuntimeProfile profile("test");
+    std::array<RuntimeProfile::Counter*, PerfEventCounters::NUM_EVENTS> counters{};
+    for (int i = 0; i < PerfEventCounters::NUM_EVENTS; ++i) {
+        counters[i] = ADD_COUNTER(&profile, PerfEventCounters::event_name(i), TUnit::UNIT);
+    }
+
+    const std::string trace_name = "test";
+    volatile int64_t sum = 0;
+    {
+        ScopedPerfEventCounters scoped_counters(counters.data(), trace_name);
+        for (int i = 0; i < 1000000; ++i) {
+            sum = sum + i;
+        }
+    }
+    if (PerfEventCounters::current_thread() == nullptr) {
+        for (auto* counter : counters) {
+            ASSERT_EQ(0, counter->value());
+        }
+        return;
+    }
+    ASSERT_GT(counters[PerfEventCounters::CYCLES]->value(), 0);
+    ASSERT_GT(counters[PerfEventCounters::INSTRUCTIONS]->value(), 1000000);
+}
+
+TEST(PerfEventCountersTest, test_disabled) {
+    const std::string trace_name = "test";
+    ScopedPerfEventCounters scoped_counters(nullptr, trace_name);
+    PerfEventCounters::Values values;
+    ASSERT_FALSE(scoped_counters.elapsed(&values));
+}
+
+} // namespace starrocks
@@ -0,0 +1,66 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "util/debug/query_trace.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace starrocks::debug {
+
+static QueryTraceEvent make_event(const std::string& name, int64_t timestamp) {
+    return QueryTraceEvent::create(name, "test", -1, 'i', timestamp, -1, 1, 2, {});
+}
+
+TEST(QueryTraceTest, test_event_buffer_keeps_latest_events) {
+    EventBuffer buffer(3);
+    for (int i = 0; i < 5; i++) {
+        buffer.add(make_event("event_" + std::to_string(i), i));
+    }
+    std::vector<std::string> names;
+    buffer.for_each([&](const QueryTraceEvent& event) { names.push_back(event.name); });
+    ASSERT_EQ(std::vector<std::string>({"event_2", "event_3", "event_4"}), names);
+    ASSERT_EQ(2, buffer.num_dropped_events());
+}
+
+TEST(QueryTraceTest, test_scoped_tracer_without_context) {
+    tls_trace_ctx.reset();
+    EventBuffer buffer(16);
+    {
+        QUERY_TRACE_SCOPED("name", "category");
+    }
+    size_t num_events = 0;
+    buffer.for_each([&](const QueryTraceEvent&) { num_events++; });
+    ASSERT_EQ(0, num_events);
+}
+
+TEST(QueryTraceTest, test_scoped_tracer_with_context) {
+    EventBuffer buffer(16);
+    tls_trace_ctx.start_ts = 0;
+    tls_trace_ctx.event_buffer = &buffer;
+    {
+        QUERY_TRACE_SCOPED("name", "category");
+    }
+    tls_trace_ctx.reset();
+    std::vector<char> phases;
+    buffer.for_each([&](const QueryTraceEvent& event) { phases.push_back(event.phase); });
+    ASSERT_EQ(std::vector<char>({'X'}), phases);
+}
+
+TEST(QueryTraceTest, test_write_json) {
+    TUniqueId query_id;
+    query_id.__set_hi(1);
+    query_id.__set_lo(2);
+    std::stringstream ss;
+    QueryTrace disabled_trace(query_id, false);
+    ASSERT_FALSE(disabled_trace.write_json(ss).ok());
+
+    QueryTrace trace(query_id, true);
+    ASSERT_TRUE(trace.write_json(ss).ok());
+    ASSERT_EQ(
+            "{\"traceEvents\":[],\"otherData\":{\"query_id\":\"00000000-0000-0001-0000-000000000002\","
+            "\"dropped_events\":0}}",
+            ss.str());
+}
+
+} // namespace starrocks::debug
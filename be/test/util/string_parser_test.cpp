@@ -26,6 +26,7 @@
 #include <boost/lexical_cast.hpp>
 #include <cstdint>
 #include <cstdio>
+#include <random>
 #include <string>
 
 #include "util/logging.h"
@@ -532,6 +533,24 @@ TEST(StringToFloat, InvalidLeadingTrailing) {
     test_float_value<double>("   ", StringParser::PARSE_FAILURE);
 }
 
+// The plain decimals with at most 15 digits are parsed by the fast path and rounded as strtod.
+TEST(StringToFloat, FastPath) {
+    test_all_float_variants("0.3", StringParser::PARSE_SUCCESS);
+    test_all_float_variants("123.456", StringParser::PARSE_SUCCESS);
+    test_all_float_variants("0.000000000000001", StringParser::PARSE_SUCCESS);
+    test_all_float_variants("999999999999999", StringParser::PARSE_SUCCESS);
+    test_all_float_variants("99999999999999.9", StringParser::PARSE_SUCCESS);
+    test_all_float_variants("1.", StringParser::PARSE_SUCCESS);
+
+    std::mt19937_64 rng(0);
+    for (int i = 0; i < 10000; ++i) {
+        std::string s = std::to_string(rng() % 1000000000000000ULL);
+        s.insert(s.begin() + rng() % (s.size() + 1), '.');
+        test_float_value<double>(s, StringParser::PARSE_SUCCESS);
+        test_float_value<float>(s, StringParser::PARSE_SUCCESS);
+    }
+}
+
 TEST(StringToFloat, BruteForce) {
     TestFloatBruteForce<float>();
     TestFloatBruteForce<double>();
@@ -0,0 +1,48 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Inc.
+
+#include "util/timezone_utils.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+static const cctz::time_point<cctz::seconds> kEpoch =
+        std::chrono::time_point_cast<cctz::seconds>(std::chrono::system_clock::from_time_t(0));
+
+// NOLINTNEXTLINE
+TEST(TimezoneOffsetCacheTest, test_same_as_cctz) {
+    cctz::time_zone ctz;
+    ASSERT_TRUE(cctz::load_time_zone("America/Los_Angeles", &ctz));
+    TimezoneOffsetCache offsets(ctz);
+
+    // Every 17 minutes across 2021, which includes the two daylight saving transitions.
+    const cctz::civil_second base(1970, 1, 1, 0, 0, 0);
+    int64_t begin = (cctz::convert(cctz::civil_second(2021, 1, 1, 0, 0, 0), cctz::utc_time_zone()) - kEpoch).count();
+    for (int64_t utc = begin; utc < begin + 366 * 86400; utc += 17 * 60) {
+        int64_t local = offsets.utc_to_local(utc);
+        ASSERT_EQ(cctz::convert(kEpoch + cctz::seconds(utc), ctz) - base, local) << utc;
+
+        // The local seconds counted as if they were in UTC.
+        int64_t expected = (cctz::convert(base + local, ctz) - kEpoch).count();
+        ASSERT_EQ(expected, offsets.local_to_utc(local)) << local;
+    }
+
+    // The local time skipped by the daylight saving time and the repeated one.
+    for (const auto& civil : {cctz::civil_second(2021, 3, 14, 2, 30, 0), cctz::civil_second(2021, 11, 7, 1, 30, 0)}) {
+        int64_t expected = (cctz::convert(civil, ctz) - kEpoch).count();
+        ASSERT_EQ(expected, offsets.local_to_utc(civil - base));
+    }
+}
+
+// NOLINTNEXTLINE
+TEST(TimezoneOffsetCacheTest, test_fixed_offset) {
+    cctz::time_zone ctz;
+    ASSERT_TRUE(TimezoneUtils::find_cctz_time_zone("+08:00", ctz));
+    TimezoneOffsetCache offsets(ctz);
+    for (int64_t utc : {0L, 1000000000L, -86400L}) {
+        ASSERT_EQ(utc + 8 * 3600, offsets.utc_to_local(utc));
+        ASSERT_EQ(utc, offsets.local_to_utc(utc + 8 * 3600));
+    }
+}
+
+} // namespace starrocks
@@ -441,10 +441,16 @@ public class FunctionSet {
 
     // If low cardinality string column with global dict, for some string functions,
     // we could evaluate the function only with the dict content, not all string column data.
+    // The deterministic functions, evaluated once per entry of the global dictionary of their only input column.
     public final ImmutableSet<String> couldApplyDictOptimizationFunctions =
-            ImmutableSet.of(APPEND_TRAILING_CHAR_IF_ABSENT, CONCAT, CONCAT_WS, HEX, LEFT, LIKE, LOWER, LPAD, LTRIM,
-                    REGEXP_EXTRACT, REGEXP_REPLACE, REPEAT, REVERSE, RIGHT, RPAD, RTRIM, SPLIT_PART, SUBSTR, SUBSTRING,
-                    TRIM, UPPER, IF);
+            ImmutableSet.<String>builder()
+                    .add(APPEND_TRAILING_CHAR_IF_ABSENT, CONCAT, CONCAT_WS, HEX, LEFT, LIKE, LOWER, LPAD, LTRIM,
+                            REGEXP_EXTRACT, REGEXP_REPLACE, REPEAT, REVERSE, RIGHT, RPAD, RTRIM, SPLIT_PART, SUBSTR,
+                            SUBSTRING, TRIM, UPPER, IF)
+                    .add(ASCII, CHAR_LENGTH, ENDS_WITH, FIND_IN_SET, FROM_BASE64, INSTR, LCASE, LENGTH, LOCATE, MD5,
+                            NULL_OR_EMPTY, PARSE_URL, SHA2, STARTS_WITH, STR_TO_DATE, STRLEFT, STRRIGHT, TO_BASE64,
+                            UNHEX)
+                    .build();
 
     public static final Set<String> alwaysReturnNonNullableFunctions =
             ImmutableSet.<String>builder()
@@ -99,6 +99,9 @@ public class RemoteScanRangeLocations {
         hdfsScanRange.setFile_length(fileDesc.getLength());
         hdfsScanRange.setFile_format(partition.getFormat().toThrift());
         hdfsScanRange.setText_file_desc(fileDesc.getTextFileFormatDesc().toThrift());
+        if (fileDesc.getModificationTime() > 0) {
+            hdfsScanRange.setModification_time(fileDesc.getModificationTime());
+        }
         TScanRange scanRange = new TScanRange();
         scanRange.setHdfs_scan_range(hdfsScanRange);
         scanRangeLocations.setScan_range(scanRange);
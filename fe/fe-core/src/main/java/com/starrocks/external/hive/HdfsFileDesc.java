@@ -20,6 +20,9 @@ public class HdfsFileDesc {
     private boolean splittable;
     private TextFileFormatDesc textFileFormatDesc;
     private ImmutableList<String> hudiDeltaLogs;
+    // 0 if unknown, the be caches the metadata of the file only if it's known.
+    @SerializedName(value = "modificationTime")
+    private long modificationTime;
 
     public HdfsFileDesc(String fileName, String compression, long length,
                         ImmutableList<HdfsFileBlockDesc> blockDescs, ImmutableList<String> hudiDeltaLogs,
@@ -61,4 +64,12 @@ public class HdfsFileDesc {
         return hudiDeltaLogs;
     }
 
+    public long getModificationTime() {
+        return modificationTime;
+    }
+
+    public void setModificationTime(long modificationTime) {
+        this.modificationTime = modificationTime;
+    }
+
 }
@@ -682,9 +682,11 @@ public class HiveMetaClient {
                 String fileName = Utils.getSuffixName(dirPath, locatedFileStatus.getPath().toString());
                 BlockLocation[] blockLocations = locatedFileStatus.getBlockLocations();
                 List<HdfsFileBlockDesc> fileBlockDescs = getHdfsFileBlockDescs(blockLocations);
-                fileDescs.add(new HdfsFileDesc(fileName, "", locatedFileStatus.getLen(),
+                HdfsFileDesc fileDesc = new HdfsFileDesc(fileName, "", locatedFileStatus.getLen(),
                         ImmutableList.copyOf(fileBlockDescs), ImmutableList.of(),
-                        isSplittable, getTextFileFormatDesc(sd)));
+                        isSplittable, getTextFileFormatDesc(sd));
+                fileDesc.setModificationTime(locatedFileStatus.getModificationTime());
+                fileDescs.add(fileDesc);
             }
         } catch (FileNotFoundException ignored) {
             // hive empty partition may not create directory
@@ -6,8 +6,10 @@ import com.clearspring.analytics.util.Lists;
 import com.google.common.base.Joiner;
 import com.google.common.base.MoreObjects;
 import com.starrocks.analysis.Analyzer;
+import com.starrocks.analysis.BinaryPredicate;
 import com.starrocks.analysis.Expr;
 import com.starrocks.analysis.ExprSubstitutionMap;
+import com.starrocks.analysis.IntLiteral;
 import com.starrocks.analysis.SlotDescriptor;
 import com.starrocks.analysis.SlotRef;
 import com.starrocks.analysis.TupleDescriptor;
@@ -15,6 +17,7 @@ import com.starrocks.catalog.Column;
 import com.starrocks.catalog.JDBCResource;
 import com.starrocks.catalog.JDBCTable;
 import com.starrocks.common.UserException;
+import com.starrocks.qe.ConnectContext;
 import com.starrocks.server.GlobalStateMgr;
 import com.starrocks.thrift.TExplainLevel;
 import com.starrocks.thrift.TJDBCScanNode;
@@ -23,7 +26,9 @@ import com.starrocks.thrift.TPlanNodeType;
 import com.starrocks.thrift.TScanRangeLocations;
 
 import java.util.ArrayList;
+import java.util.HashMap;
 import java.util.List;
+import java.util.Map;
 
 /**
  * full scan on JDBC table.
@@ -32,6 +37,7 @@ public class JDBCScanNode extends ScanNode {
 
     private final List<String> columns = new ArrayList<>();
     private final List<String> filters = new ArrayList<>();
+    private final List<String> splitFilters = new ArrayList<>();
     private String tableName;
     private JDBCTable table;
 
@@ -64,6 +70,9 @@ public class JDBCScanNode extends ScanNode {
         StringBuilder output = new StringBuilder();
         output.append(prefix).append("TABLE: ").append(tableName).append("\n");
         output.append(prefix).append("QUERY: ").append(getJDBCQueryStr()).append("\n");
+        if (!splitFilters.isEmpty()) {
+            output.append(prefix).append("SPLITS: ").append(splitFilters.size()).append("\n");
+        }
         return output.toString();
     }
 
@@ -115,6 +124,74 @@ public class JDBCScanNode extends ScanNode {
         for (Expr p : mysqlConjuncts) {
             filters.add(p.toJDBCSQL(isMySQL));
         }
+        createJDBCTableSplitFilters(mysqlConjuncts, isMySQL);
+    }
+
+    // Split the table into ranges of an integer column bounded on both sides by the filters,
+    // e.g. `id >= 0 AND id < 1000000`, which BE reads in parallel, each through a connection.
+    private void createJDBCTableSplitFilters(List<Expr> jdbcConjuncts, boolean isMySQL) {
+        splitFilters.clear();
+        ConnectContext connectContext = ConnectContext.get();
+        int maxSplits = connectContext == null ? 1 : connectContext.getSessionVariable().getDegreeOfParallelism();
+        if (maxSplits <= 1) {
+            return;
+        }
+        // The inclusive lower bound and the exclusive upper bound of each column.
+        Map<String, Long> lowerBounds = new HashMap<>();
+        Map<String, Long> upperBounds = new HashMap<>();
+        for (Expr conjunct : jdbcConjuncts) {
+            if (!(conjunct instanceof BinaryPredicate) || !(conjunct.getChild(0) instanceof SlotRef) ||
+                    !(conjunct.getChild(1) instanceof IntLiteral) || !conjunct.getChild(0).getType().isIntegerType()) {
+                continue;
+            }
+            String column = conjunct.getChild(0).toJDBCSQL(isMySQL);
+            long value = ((IntLiteral) conjunct.getChild(1)).getValue();
+            switch (((BinaryPredicate) conjunct).getOp()) {
+                case GE:
+                    lowerBounds.merge(column, value, Math::max);
+                    break;
+                case GT:
+                    if (value < Long.MAX_VALUE) {
+                        lowerBounds.merge(column, value + 1, Math::max);
+                    }
+                    break;
+                case LT:
+                    upperBounds.merge(column, value, Math::min);
+                    break;
+                case LE:
+                    if (value < Long.MAX_VALUE) {
+                        upperBounds.merge(column, value + 1, Math::min);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+        for (Map.Entry<String, Long> lowerBound : lowerBounds.entrySet()) {
+            Long upperBound = upperBounds.get(lowerBound.getKey());
+            if (upperBound == null || upperBound <= lowerBound.getValue()) {
+                continue;
+            }
+            long width;
+            try {
+                width = Math.subtractExact(upperBound, lowerBound.getValue());
+            } catch (ArithmeticException e) {
+                continue;
+            }
+            int numSplits = (int) Math.min(maxSplits, width);
+            if (numSplits <= 1) {
+                continue;
+            }
+            long step = (width + numSplits - 1) / numSplits;
+            long begin = lowerBound.getValue();
+            while (begin < upperBound) {
+                long end = begin + Math.min(step, upperBound - begin);
+                splitFilters.add(String.format("%s >= %d AND %s < %d", lowerBound.getKey(), begin,
+                        lowerBound.getKey(), end));
+                begin = end;
+            }
+            return;
+        }
     }
 
     @Override
@@ -131,6 +208,9 @@ public class JDBCScanNode extends ScanNode {
         msg.jdbc_scan_node.setColumns(columns);
         msg.jdbc_scan_node.setFilters(filters);
         msg.jdbc_scan_node.setLimit(limit);
+        if (!splitFilters.isEmpty()) {
+            msg.jdbc_scan_node.setSplit_filters(splitFilters);
+        }
     }
 
     @Override
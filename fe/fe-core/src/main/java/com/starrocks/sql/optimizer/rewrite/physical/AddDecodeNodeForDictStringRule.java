@@ -742,6 +742,8 @@ public class AddDecodeNodeForDictStringRule implements PhysicalOperatorTreeRewri
 
             PhysicalJoinOperator joinOperator = (PhysicalJoinOperator) optExpression.getOp();
             joinOperator.fillDisableDictOptimizeColumns(context.disableDictOptimizeColumns);
+            ColumnRefSet predicateColumns = new ColumnRefSet();
+            joinOperator.fillDisableDictOptimizeColumns(predicateColumns);
 
             DecodeContext mergeContext = new DecodeContext(context.globalDictCache,
                     context.tableIdToStringColumnIds, context.columnRefFactory);
@@ -751,11 +753,12 @@ public class AddDecodeNodeForDictStringRule implements PhysicalOperatorTreeRewri
                 OptExpression newChildExpr = childExpr.getOp().accept(this, childExpr, context);
                 optExpression.setChild(i, newChildExpr);
                 if (context.hasEncoded) {
-                    if (joinOperator.couldApplyStringDict(context.stringColumnIdToDictColumnIds.keySet())) {
-                        mergeContext.merge(context);
-                    } else {
-                        insertDecodeExpr(optExpression, Collections.singletonList(newChildExpr), i, context);
+                    if (!joinOperator.couldApplyStringDict(context.stringColumnIdToDictColumnIds.keySet())) {
+                        // Only decode the columns used by the join predicates, the other columns
+                        // stay encoded across the join
+                        insertPartialDecodeExpr(optExpression, newChildExpr, i, predicateColumns, context);
                     }
+                    mergeContext.merge(context);
                 }
             }
 
@@ -915,6 +918,30 @@ public class AddDecodeNodeForDictStringRule implements PhysicalOperatorTreeRewri
         context.clear();
     }
 
+    // Decode the encoded columns of the child at |index| which are in |decodeColumns|, and keep the other
+    // encoded columns in |context|.
+    private static void insertPartialDecodeExpr(OptExpression parentExpr, OptExpression childExpr, int index,
+                                                ColumnRefSet decodeColumns, DecodeContext context) {
+        DecodeContext decodeContext = new DecodeContext(context.globalDictCache,
+                context.tableIdToStringColumnIds, context.columnRefFactory);
+        for (Integer stringId : Lists.newArrayList(context.stringColumnIdToDictColumnIds.keySet())) {
+            if (!decodeColumns.contains(stringId)) {
+                continue;
+            }
+            Integer dictId = context.stringColumnIdToDictColumnIds.remove(stringId);
+            decodeContext.stringColumnIdToDictColumnIds.put(stringId, dictId);
+            ColumnRefOperator dictColumn = context.columnRefFactory.getColumnRef(dictId);
+            ScalarOperator stringFunction = context.stringFunctions.remove(dictColumn);
+            if (stringFunction != null) {
+                decodeContext.stringFunctions.put(dictColumn, stringFunction);
+            }
+        }
+        parentExpr.setChild(index, generateDecodeOExpr(decodeContext, Collections.singletonList(childExpr)));
+        if (context.stringColumnIdToDictColumnIds.isEmpty()) {
+            context.clear();
+        }
+    }
+
     private static OptExpression generateDecodeOExpr(DecodeContext context, List<OptExpression> childExpr) {
         Map<Integer, Integer> dictToStrings = Maps.newHashMap();
         for (Integer id : context.stringColumnIdToDictColumnIds.keySet()) {
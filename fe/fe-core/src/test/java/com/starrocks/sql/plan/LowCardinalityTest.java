@@ -288,6 +288,17 @@ public class LowCardinalityTest extends PlanTestBase {
         Assert.assertTrue(plan.contains("group by: [10: S_ADDRESS, INT, true]"));
     }
 
+    @Test
+    public void testDecodeNodeRewriteNonStringResultFunction() throws Exception {
+        String sql = "select length(S_ADDRESS) as a, count(*) from supplier group by a";
+        String plan = getFragmentPlan(sql);
+        Assert.assertTrue(plan.contains("S_ADDRESS,[length(<place-holder>)])"));
+
+        sql = "select count(*) from supplier where starts_with(S_ADDRESS, 'kks')";
+        plan = getFragmentPlan(sql);
+        Assert.assertTrue(plan.contains("S_ADDRESS,[starts_with(<place-holder>, 'kks')])"));
+    }
+
     @Test
     public void testDecodeNodeRewriteMultiCountDistinct() throws Exception {
         String sql;
@@ -916,6 +927,15 @@ public class LowCardinalityTest extends PlanTestBase {
         Assert.assertFalse(plan.contains("Decode"));
     }
 
+    @Test
+    public void testJoinPartialDecode() throws Exception {
+        // Only MA used by the join predicate is decoded below the join, MC is decoded above it
+        String sql = "select l.MA, l.MC from (select S_SUPPKEY, max(S_ADDRESS) as MA, max(S_COMMENT) as MC " +
+                "from supplier group by S_SUPPKEY) l join [broadcast] supplier r on l.MA = r.S_ADDRESS";
+        String plan = getFragmentPlan(sql);
+        Assert.assertEquals(plan, 2, plan.split(":Decode").length - 1);
+    }
+
     @Test
     public void testJoinGlobalDict() throws Exception {
         String sql =
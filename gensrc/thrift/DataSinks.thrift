@@ -43,7 +43,9 @@ enum TResultSinkType {
     MYSQL_PROTOCAL,
     FILE,
     STATISTIC,
-    VARIABLE
+    VARIABLE,
+    // record batches in Arrow IPC stream format, one stream per result batch
+    ARROW
 }
 
 struct TResultFileSinkOptions {
@@ -116,6 +118,9 @@ struct TMultiCastDataStreamSink {
 struct TResultSink {
     1: optional TResultSinkType type;
     2: optional TResultFileSinkOptions file_options;
+    // The number of result buffers of a fragment instance, each one fetched on its own, so that a client
+    // downloads the results in parallel. The pipeline engine only, the drivers are spread over the buffers.
+    3: optional i32 num_result_partitions
 }
 
 struct TMysqlTableSink {
@@ -397,4 +397,7 @@ struct TDescriptorTable {
   // all table descriptors referenced by tupleDescriptors
   3: optional list<TTableDescriptor> tableDescriptors;
   4: optional bool is_cached;
+  // Set by FE for the plans of parameterized queries, the descriptor tables with the same fingerprint are the same,
+  // whatever the query.
+  5: optional i64 fingerprint;
 }
@@ -431,6 +431,8 @@ struct TFetchDataParams {
   // required in V1
   // query id which want to fetch data
   2: required Types.TUniqueId fragment_instance_id
+  // the result buffer of the fragment instance, see TResultSink.num_result_partitions
+  3: optional i32 partition
 }
 
 struct TFetchDataResult {
@@ -234,6 +234,9 @@ struct TEsScanRange {
   2: required string index
   3: optional string type
   4: required i32 shard_id
+  // The slice of the shard read by a sliced scroll, see es_scroll_slices_per_shard.
+  5: optional i32 slice_id
+  6: optional i32 max_slices
 }
 
 // Hdfs scan range
@@ -268,10 +271,19 @@ struct THdfsScanRange {
 
     // whether to use JNI scanner to read data of hudi MOR table for snapshot queries
     10: optional bool use_hudi_jni_reader;
+
+    // modification time of hdfs file, for the file metadata cache of be
+    11: optional i64 modification_time
 }
 
 // Specification of an individual data range which is held in its entirety
 // by a storage server
+// A split of a JDBC table, read by a data source of the scan node
+struct TJDBCScanRange {
+  // The filter of the rows of this split, in addition to the filters of the scan node
+  1: optional string split_filter
+}
+
 struct TScanRange {
   // one of these must be set for every TScanRange
   4: optional TInternalScanRange internal_scan_range
@@ -281,6 +293,9 @@ struct TScanRange {
 
   // scan range for hdfs
   20: optional THdfsScanRange hdfs_scan_range
+
+  // scan range for jdbc, only created by BE for the splits of a TJDBCScanNode
+  21: optional TJDBCScanRange jdbc_scan_range
 }
 
 struct TMySQLScanNode {
@@ -363,6 +378,9 @@ struct TOlapScanNode {
   23: optional map<i32, i32> dict_string_id_to_int_ids
   // which columns only be used to filter data in the stage of scan data
   24: optional list<string> unused_output_column_name
+  // The digest of the normalized scan, i.e. the table, the output columns and the predicates, set if the chunks
+  // read from a tablet may be cached by BE and reused by the scans with the same digest.
+  25: optional binary scan_cache_digest
 }
 
 struct TJDBCScanNode {
@@ -371,6 +389,8 @@ struct TJDBCScanNode {
   3: optional list<string> columns
   4: optional list<string> filters
   5: optional i64 limit
+  // The filters of the splits of the table, which are read in parallel, each through a connection
+  6: optional list<string> split_filters
 }
 
 struct TLakeScanNode {
@@ -566,6 +586,10 @@ struct TAggregationNode {
   23: optional string sql_aggregate_functions
 
   24: optional i32 agg_func_set_version = 1
+
+  // The input of each driver is ordered by the grouping exprs, and a group never spans two drivers,
+  // so the groups could be aggregated one after another without a hash table.
+  25: optional bool use_sort_agg
 }
 
 struct TRepeatNode {